@@ -68,7 +68,7 @@ void BnetServiceGenerator::GenerateInterface(pb::io::Printer* printer)
         printer->Print(vars_, "\n");
     }
 
-    printer->Print("void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;\n");
+    printer->Print("void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;\n");
 
     if (!descriptor_->options().HasExtension(Battlenet::sdk_service_options) || descriptor_->options().GetExtension(Battlenet::sdk_service_options).outbound())
     {
@@ -201,7 +201,7 @@ void BnetServiceGenerator::GenerateImplementation(pb::io::Printer* printer)
     else
     {
         printer->Print(vars_,
-            "void $classname$::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {\n"
+            "void $classname$::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {\n"
             "  LogDisallowedMethod(methodId);\n"
             "}\n"
             "\n");
@@ -254,7 +254,7 @@ void BnetServiceGenerator::GenerateClientMethodImplementations(pb::io::Printer*
 void BnetServiceGenerator::GenerateServerCallMethod(pb::io::Printer* printer)
 {
     printer->Print(vars_,
-        "void $classname$::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {\n"
+        "void $classname$::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {\n"
         "  switch(methodId & 0x3FFFFFFF) {\n");
 
     for (int i = 0; i < descriptor_->method_count(); i++)
@@ -342,8 +342,8 @@ void BnetServiceGenerator::GenerateServerMethodParserImplementations(pb::io::Pri
 
         printer->Print(sub_vars,
             "void $classname$::ParseAndHandle$name$(uint32 token, uint32 methodId, MessageBuffer& buffer) {\n"
-            "  $input_type$ request;\n"
-            "  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {\n"
+            "  PooledRpcMessage<$input_type$> request(GetMessagePool());\n"
+            "  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {\n"
             "    LogFailedParsingRequest(\"$full_name$\");\n"
             "    SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);\n"
             "    return;\n"
@@ -353,19 +353,19 @@ void BnetServiceGenerator::GenerateServerMethodParserImplementations(pb::io::Pri
         if (method->output_type()->name() != "NO_RESPONSE")
         {
             printer->Print(sub_vars,
-                "  LogCallServerMethod(\"$full_name$\", \"$input_type_name$\", &request);\n"
+                "  LogCallServerMethod(\"$full_name$\", \"$input_type_name$\", request.get());\n"
                 "  std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, \"$full_name$\", $output_type$::descriptor());\n"
-                "  $output_type$ response;\n"
-                "  uint32 status = Handle$name$(&request, &response, continuation);\n"
+                "  PooledRpcMessage<$output_type$> response(GetMessagePool());\n"
+                "  uint32 status = Handle$name$(request.get(), response.get(), continuation);\n"
                 "  if (continuation)\n"
-                "    continuation(this, status, &response);\n"
+                "    continuation(this, status, response.get());\n"
             );
         }
         else
         {
             printer->Print(sub_vars,
-                "  uint32 status = Handle$name$(&request);\n"
-                "  LogCallServerMethod(\"$full_name$\", \"$input_type_name$\", &request);\n"
+                "  uint32 status = Handle$name$(request.get());\n"
+                "  LogCallServerMethod(\"$full_name$\", \"$input_type_name$\", request.get());\n"
                 "  if (status)\n"
                 "    SendResponse(service_hash_, methodId, token, status);\n");
         }
@@ -38,6 +38,7 @@ namespace Trinity
             operator boost::asio::io_context const&() const { return _impl; }
 
             std::size_t run() { return _impl.run(); }
+            std::size_t run_one() { return _impl.run_one(); }
             std::size_t poll() { return _impl.poll(); }
             void stop() { _impl.stop(); }
 
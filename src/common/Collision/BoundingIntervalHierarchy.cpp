@@ -16,8 +16,55 @@
  */
 
 #include "BoundingIntervalHierarchy.h"
+#include <array>
+#include <future>
+#include <limits>
 #include <stdexcept>
 
+namespace
+{
+// number of buckets the primitive centers of a node are sorted into by the SAH split
+constexpr int SAHBinCount = 16;
+
+// below this the binning costs more than the better split saves, small nodes keep the midpoint split
+constexpr int SAHMinPrims = 32;
+
+struct SAHBin
+{
+    G3D::Vector3 Lo = G3D::Vector3(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+    G3D::Vector3 Hi = -Lo;
+    int Count = 0;
+
+    void Merge(G3D::AABox const& bound)
+    {
+        Lo = Lo.min(bound.low());
+        Hi = Hi.max(bound.high());
+        ++Count;
+    }
+
+    void Merge(SAHBin const& other)
+    {
+        Lo = Lo.min(other.Lo);
+        Hi = Hi.max(other.Hi);
+        Count += other.Count;
+    }
+
+    float Area() const
+    {
+        if (!Count)
+            return 0.0f;
+
+        G3D::Vector3 d = Hi - Lo;
+        return d.x * d.y + d.y * d.z + d.z * d.x;
+    }
+};
+
+// a node is only split across threads when both its halves have at least this many primitives,
+// the depth is fixed so that the layout of the tree does not depend on the machine building it
+constexpr int ParallelSubtreeMinPrims = 4096;
+constexpr int ParallelBuildDepth = 3;
+}
+
 void BIH::buildHierarchy(std::vector<uint32>& tempTree, buildData& dat, BuildStats& stats) const
 {
     // create space for the first node
@@ -26,10 +73,94 @@ void BIH::buildHierarchy(std::vector<uint32>& tempTree, buildData& dat, BuildSta
     // seed bbox
     AABound gridBox{ .lo = bounds.low(), .hi = bounds.high() };
     AABound nodeBox = gridBox;
+    dat.parallelDepth = ParallelBuildDepth;
     // seed subdivide function
     subdivide(0, dat.numPrims - 1, tempTree, dat, gridBox, nodeBox, 0, 1, stats);
 }
 
+bool BIH::findSAHSplit(int left, int right, buildData const& dat, int& axis, float& split)
+{
+    // plain min/max on the bounds, G3D::AABox::merge tests for empty boxes with a call per merge
+    G3D::Vector3 centerLo(G3D::finf(), G3D::finf(), G3D::finf());
+    G3D::Vector3 centerHi = -centerLo;
+    for (int i = left; i <= right; ++i)
+    {
+        G3D::AABox const& primBound = dat.primBound[dat.indices[i]];
+        G3D::Vector3 center = (primBound.low() + primBound.high()) * 0.5f;
+        centerLo = centerLo.min(center);
+        centerHi = centerHi.max(center);
+    }
+
+    G3D::Vector3 extent = centerHi - centerLo;
+    G3D::Vector3 scale;
+    for (int binAxis = 0; binAxis < 3; ++binAxis)
+        scale[binAxis] = extent[binAxis] > 0.0f ? SAHBinCount / extent[binAxis] : 0.0f;
+
+    std::array<std::array<SAHBin, SAHBinCount>, 3> bins;
+    for (int i = left; i <= right; ++i)
+    {
+        G3D::AABox const& primBound = dat.primBound[dat.indices[i]];
+        for (int binAxis = 0; binAxis < 3; ++binAxis)
+        {
+            float center = (primBound.low()[binAxis] + primBound.high()[binAxis]) * 0.5f;
+            int bin = std::min(int((center - centerLo[binAxis]) * scale[binAxis]), SAHBinCount - 1);
+            bins[binAxis][bin].Merge(primBound);
+        }
+    }
+
+    float bestCost = G3D::finf();
+    for (int binAxis = 0; binAxis < 3; ++binAxis)
+    {
+        if (scale[binAxis] == 0.0f)
+            continue;
+
+        // surface area and primitive count of everything right of each bin boundary
+        std::array<float, SAHBinCount> rightArea;
+        std::array<int, SAHBinCount> rightCount;
+        SAHBin bound;
+        for (int bin = SAHBinCount - 1; bin > 0; --bin)
+        {
+            bound.Merge(bins[binAxis][bin]);
+            rightArea[bin] = bound.Area();
+            rightCount[bin] = bound.Count;
+        }
+
+        bound = SAHBin();
+        for (int bin = 0; bin < SAHBinCount - 1; ++bin)
+        {
+            bound.Merge(bins[binAxis][bin]);
+            if (!bound.Count || !rightCount[bin + 1])
+                continue;
+
+            float cost = bound.Area() * bound.Count + rightArea[bin + 1] * rightCount[bin + 1];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                axis = binAxis;
+                split = centerLo[binAxis] + (bin + 1) / scale[binAxis];
+            }
+        }
+    }
+
+    return bestCost < G3D::finf();
+}
+
+void BIH::appendSubtree(std::vector<uint32>& tempTree, int nodeIndex, std::vector<uint32> const& subtree)
+{
+    // the root of the subtree was built at index 0 and takes the node allocated for it, the other nodes (from index 3 on)
+    // are appended and the child offsets of inner nodes are moved along with them
+    uint32 base = uint32(tempTree.size()) - 3;
+    tempTree.insert(tempTree.end(), subtree.begin() + 3, subtree.end());
+    for (std::size_t node = 0; node < subtree.size(); node += 3)
+    {
+        uint32 target = node ? base + node : nodeIndex;
+        uint32 header = subtree[node];
+        tempTree[target + 0] = (header >> 30) == 3 ? header : header + base;
+        tempTree[target + 1] = subtree[node + 1];
+        tempTree[target + 2] = subtree[node + 2];
+    }
+}
+
 void BIH::subdivide(int left, int right, std::vector<uint32>& tempTree, buildData& dat, AABound& gridBox, AABound& nodeBox, int nodeIndex, int depth, BuildStats& stats)
 {
     if ((right - left + 1) <= dat.maxPrims || depth >= MAX_STACK_SIZE)
@@ -44,6 +175,8 @@ void BIH::subdivide(int left, int right, std::vector<uint32>& tempTree, buildDat
     float clipL = G3D::fnan(), clipR = G3D::fnan(), prevClip = G3D::fnan();
     float split = G3D::fnan(), prevSplit;
     bool wasLeft = true;
+    // the SAH split always separates the primitives, the midpoint loop below only takes over when the centers coincide
+    bool trySAH = dat.splitMethod == SplitMethod::BinnedSAH && right - left + 1 >= SAHMinPrims;
     while (true)
     {
         prevAxis = axis;
@@ -60,9 +193,13 @@ void BIH::subdivide(int left, int right, std::vector<uint32>& tempTree, buildDat
                 throw std::logic_error("invalid node overlap");
             }
         }
-        // find longest axis
-        axis = d.primaryAxis();
-        split = 0.5f * (gridBox.lo[axis] + gridBox.hi[axis]);
+        if (!trySAH || !findSAHSplit(left, right, dat, axis, split))
+        {
+            // find longest axis
+            axis = d.primaryAxis();
+            split = 0.5f * (gridBox.lo[axis] + gridBox.hi[axis]);
+        }
+        trySAH = false;
         // partition L/R subsets
         clipL = -G3D::finf();
         clipR = G3D::finf();
@@ -235,6 +372,21 @@ void BIH::subdivide(int left, int right, std::vector<uint32>& tempTree, buildDat
     gridBoxL.hi[axis] = gridBoxR.lo[axis] = split;
     nodeBoxL.hi[axis] = clipL;
     nodeBoxR.lo[axis] = clipR;
+    // large halves near the root are built concurrently, the left one into its own array that is appended once done
+    if (nl >= ParallelSubtreeMinPrims && nr >= ParallelSubtreeMinPrims && depth <= dat.parallelDepth)
+    {
+        std::vector<uint32> leftTree = { 0u, 0u, 0u };
+        BuildStats leftStats;
+        std::future<void> leftBuild = std::async(std::launch::async, [&]
+        {
+            subdivide(left, right, leftTree, dat, gridBoxL, nodeBoxL, 0, depth + 1, leftStats);
+        });
+        subdivide(right + 1, rightOrig, tempTree, dat, gridBoxR, nodeBoxR, nextIndex + 3, depth + 1, stats);
+        leftBuild.get();
+        stats.merge(leftStats);
+        appendSubtree(tempTree, nextIndex, leftTree);
+        return;
+    }
     // recurse
     if (nl > 0)
         subdivide(left, right, tempTree, dat, gridBoxL, nodeBoxL, nextIndex, depth + 1, stats);
@@ -269,14 +421,28 @@ bool BIH::readFromFile(FILE* rf)
     check += fread(&hi, sizeof(float), 3, rf);
     bounds = G3D::AABox(lo, hi);
     check += fread(&treeSize, sizeof(uint32), 1, rf);
-    tree.resize(treeSize);
-    check += fread(tree.data(), sizeof(uint32), treeSize, rf);
+    std::vector<uint32> treeData(treeSize);
+    check += fread(treeData.data(), sizeof(uint32), treeSize, rf);
+    tree = std::move(treeData);
     check += fread(&count, sizeof(uint32), 1, rf);
-    objects.resize(count); // = new uint32[nObjects];
-    check += fread(objects.data(), sizeof(uint32), count, rf);
+    std::vector<uint32> objectData(count);
+    check += fread(objectData.data(), sizeof(uint32), count, rf);
+    objects = std::move(objectData);
     return uint64(check) == uint64(3 + 3 + 1 + 1 + uint64(treeSize) + uint64(count));
 }
 
+bool BIH::readFromData(VMAP::ModelDataReader& reader)
+{
+    G3D::Vector3 lo, hi;
+    uint32 treeSize = 0, count = 0;
+    if (!reader.readBytes(&lo, sizeof(float) * 3) || !reader.readBytes(&hi, sizeof(float) * 3))
+        return false;
+
+    bounds = G3D::AABox(lo, hi);
+    return reader.read(treeSize) && reader.readArray(treeSize, tree)
+        && reader.read(count) && reader.readArray(count, objects);
+}
+
 void BIH::BuildStats::updateLeaf(int depth, int n)
 {
     numLeaves++;
@@ -290,6 +456,21 @@ void BIH::BuildStats::updateLeaf(int depth, int n)
     ++numLeavesN[nl];
 }
 
+void BIH::BuildStats::merge(BuildStats const& other)
+{
+    numNodes += other.numNodes;
+    numLeaves += other.numLeaves;
+    sumObjects += other.sumObjects;
+    minObjects = std::min(other.minObjects, minObjects);
+    maxObjects = std::max(other.maxObjects, maxObjects);
+    sumDepth += other.sumDepth;
+    minDepth = std::min(other.minDepth, minDepth);
+    maxDepth = std::max(other.maxDepth, maxDepth);
+    for (int i = 0; i < 6; ++i)
+        numLeavesN[i] += other.numLeavesN[i];
+    numBVH2 += other.numBVH2;
+}
+
 void BIH::BuildStats::printStats() const
 {
     printf("Tree stats:\n");
@@ -19,11 +19,14 @@
 #define TRINITYCORE_BOUNDING_INTERVAL_HIERARCHY_H
 
 #include "Define.h"
+#include "ModelData.h"
 #include "advstd.h"
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
 #include <algorithm>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 #define MAX_STACK_SIZE 64
@@ -52,9 +55,15 @@ class TC_COMMON_API BIH
             tree = { 3u << 30u, 0u, 0u }; // dummy leaf
         }
     public:
+        enum class SplitMethod : uint8
+        {
+            Midpoint,   // middle of the longest axis of the node
+            BinnedSAH   // surface area heuristic evaluated over binned primitive centers, slower to build
+        };
+
         BIH() { init_empty(); }
         template <class BoundsFunc, class PrimArray>
-        void build(PrimArray const& primitives, BoundsFunc const& getBounds, uint32 leafSize = 3, bool printStats = false)
+        void build(PrimArray const& primitives, BoundsFunc const& getBounds, uint32 leafSize = 3, bool printStats = false, SplitMethod splitMethod = SplitMethod::Midpoint)
         {
             if (primitives.size() == 0)
             {
@@ -64,6 +73,7 @@ class TC_COMMON_API BIH
 
             buildData dat;
             dat.maxPrims = leafSize;
+            dat.splitMethod = splitMethod;
             dat.numPrims = uint32(primitives.size());
             dat.indices = new uint32[dat.numPrims];
             dat.primBound = static_cast<G3D::AABox*>(::operator new[](dat.numPrims * sizeof(G3D::AABox)));
@@ -81,8 +91,7 @@ class TC_COMMON_API BIH
             if (printStats)
                 stats.printStats();
 
-            objects.resize(dat.numPrims);
-            std::ranges::copy_n(dat.indices, dat.numPrims, objects.begin());
+            objects = std::vector<uint32>(dat.indices, dat.indices + dat.numPrims);
             tree = tempTree;    // copy instead of move to allocate exactly tempTree.size() elements and avoid shrink_to_fit
             delete[] dat.primBound;
             delete[] dat.indices;
@@ -191,12 +200,21 @@ class TC_COMMON_API BIH
                         {
                             // leaf - test some objects
                             int n = tree[node + 1];
-                            while (n > 0)
+                            if constexpr (std::is_invocable_r_v<bool, RayCallback&, G3D::Ray const&, std::span<uint32 const>, float&, bool>)
                             {
-                                bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirst);
+                                // callbacks taking the whole leaf test its objects at once
+                                bool hit = n > 0 && intersectCallback(r, std::span(objects.data() + offset, n), maxDist, stopAtFirst);
                                 if (stopAtFirst && hit) return;
-                                --n;
-                                ++offset;
+                            }
+                            else
+                            {
+                                while (n > 0)
+                                {
+                                    bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirst);
+                                    if (stopAtFirst && hit) return;
+                                    --n;
+                                    ++offset;
+                                }
                             }
                             break;
                         }
@@ -316,10 +334,11 @@ class TC_COMMON_API BIH
 
         bool writeToFile(FILE* wf) const;
         bool readFromFile(FILE* rf);
+        bool readFromData(VMAP::ModelDataReader& reader);
 
     protected:
-        std::vector<uint32> tree;
-        std::vector<uint32> objects;
+        VMAP::ModelArray<uint32> tree;
+        VMAP::ModelArray<uint32> objects;
         G3D::AABox bounds;
 
         struct buildData
@@ -328,6 +347,8 @@ class TC_COMMON_API BIH
             G3D::AABox* primBound;
             uint32 numPrims;
             int maxPrims;
+            SplitMethod splitMethod;
+            int parallelDepth;      // nodes above this depth build their halves concurrently
         };
         struct StackNode
         {
@@ -362,6 +383,7 @@ class TC_COMMON_API BIH
             void updateInner() { numNodes++; }
             void updateBVH2() { numBVH2++; }
             void updateLeaf(int depth, int n);
+            void merge(BuildStats const& other);
             void printStats() const;
         };
 
@@ -374,6 +396,8 @@ class TC_COMMON_API BIH
             tempTree[nodeIndex + 1] = right - left + 1;
         }
 
+        static bool findSAHSplit(int left, int right, buildData const& dat, int& axis, float& split);
+        static void appendSubtree(std::vector<uint32>& tempTree, int nodeIndex, std::vector<uint32> const& subtree);
         static void subdivide(int left, int right, std::vector<uint32>& tempTree, buildData& dat, AABound& gridBox, AABound& nodeBox, int nodeIndex, int depth, BuildStats& stats);
 };
 
@@ -31,8 +31,9 @@ class BIHWrap
         std::size_t objects_size;
         T const* const* objects;
         RayCallback& _callback;
+        bool didHit;
 
-        MDLCallback(RayCallback& callback, T const* const* objects_array, std::size_t objects_size ) : objects_size(objects_size), objects(objects_array), _callback(callback) { }
+        MDLCallback(RayCallback& callback, T const* const* objects_array, std::size_t objects_size ) : objects_size(objects_size), objects(objects_array), _callback(callback), didHit(false) { }
 
         /// Intersect ray
         bool operator() (G3D::Ray const& ray, std::size_t idx, float& maxDist, bool /*stopAtFirst*/)
@@ -40,8 +41,9 @@ class BIHWrap
             if (idx >= objects_size)
                 return false;
             if (T const* obj = objects[idx])
-                return _callback(ray, *obj, maxDist/*, stopAtFirst*/);
-            return false;
+                if (_callback(ray, *obj, maxDist/*, stopAtFirst*/))
+                    didHit = true;
+            return didHit;
         }
 
         /// Intersect point
@@ -54,21 +56,56 @@ class BIHWrap
         }
     };
 
+    struct ObjectEntry
+    {
+        std::size_t Index;
+        uint32 Generation;
+    };
+
+public:
+    /*
+     * Everything needed to build a new tree away from the owning thread.
+     * Bounds are copied when the request is prepared so that Build() never touches the objects themselves.
+     */
+    struct RebuildRequest
+    {
+        uint32 Generation = 0;
+        std::vector<T const*> Objects;
+        std::vector<G3D::AABox> Bounds;
+        BIH Tree;
+
+        void Build()
+        {
+            Tree.build(Bounds, [](G3D::AABox const& bounds, G3D::AABox& out) { out = bounds; });
+            Bounds = {};
+        }
+    };
+
+private:
+    // last built tree and the objects it indexes, objects removed since then are nulled out
     BIH m_tree;
+    std::vector<T const*> m_treeObjects;
+    std::unordered_map<T const*, std::size_t> m_treeObj2Idx;
+
+    // objects inserted since m_tree was built, tested one by one until the next rebuild
+    std::vector<T const*> m_pending;
+
     std::vector<T const*> m_objects;
-    std::unordered_map<T const*, std::size_t> m_obj2Idx;
+    std::unordered_map<T const*, ObjectEntry> m_obj2Idx;
+    uint32 m_generation; // bumped by every insert and remove, entries remember the value they were inserted at
     int unbalanced_times;
 
 public:
-    BIHWrap() : unbalanced_times(0) { }
+    BIHWrap() : m_generation(0), unbalanced_times(0) { }
 
     void insert(T const& obj)
     {
-        auto [itr, isNew] = m_obj2Idx.try_emplace(&obj, m_objects.size());
+        auto [itr, isNew] = m_obj2Idx.try_emplace(&obj, ObjectEntry{ .Index = m_objects.size(), .Generation = ++m_generation });
         if (!isNew)
             return;
 
         m_objects.push_back(itr->first);
+        m_pending.push_back(itr->first);
         ++unbalanced_times;
     }
 
@@ -81,40 +118,94 @@ public:
         if (node.key() != m_objects.back())
         {
             // update index of last element (will be swapped with removed one)
-            m_obj2Idx.find(m_objects.back())->second = node.mapped();
+            m_obj2Idx.find(m_objects.back())->second.Index = node.mapped().Index;
 
             // move last into removed element slot
-            m_objects[node.mapped()] = m_objects.back();
+            m_objects[node.mapped().Index] = m_objects.back();
         }
 
         m_objects.pop_back();
 
+        if (auto treeNode = m_treeObj2Idx.extract(&obj))
+            m_treeObjects[treeNode.mapped()] = nullptr;
+        else
+            std::erase(m_pending, &obj);
+
+        ++m_generation;
         ++unbalanced_times;
     }
 
+    bool needsRebalance() const { return unbalanced_times != 0; }
+
+    RebuildRequest prepareRebuild()
+    {
+        RebuildRequest request;
+        request.Generation = m_generation;
+        request.Objects = m_objects;
+        request.Bounds.resize(m_objects.size(), G3D::AABox::empty());
+        for (std::size_t i = 0; i < m_objects.size(); ++i)
+            BoundsFunc()(m_objects[i], request.Bounds[i]);
+
+        return request;
+    }
+
+    // Installs a tree built from an earlier prepareRebuild(), objects inserted or removed since then are
+    // respectively kept in the pending list or nulled out so that queries stay exact
+    void installRebuild(RebuildRequest&& request)
+    {
+        m_tree = std::move(request.Tree);
+        m_treeObjects = std::move(request.Objects);
+        m_treeObj2Idx.clear();
+        m_pending.clear();
+
+        for (std::size_t i = 0; i < m_treeObjects.size(); ++i)
+        {
+            auto itr = m_obj2Idx.find(m_treeObjects[i]);
+            if (itr == m_obj2Idx.end() || itr->second.Generation > request.Generation)
+                m_treeObjects[i] = nullptr;
+            else
+                m_treeObj2Idx.emplace(m_treeObjects[i], i);
+        }
+
+        for (auto const& [obj, entry] : m_obj2Idx)
+            if (entry.Generation > request.Generation)
+                m_pending.push_back(obj);
+
+        // anything that changed while the tree was being built needs another pass
+        unbalanced_times = m_generation != request.Generation ? 1 : 0;
+    }
+
     void balance()
     {
         if (unbalanced_times == 0)
             return;
 
-        m_tree.build(m_objects, BoundsFunc());
-        unbalanced_times = 0;
+        RebuildRequest request = prepareRebuild();
+        request.Build();
+        installRebuild(std::move(request));
     }
 
     template<typename RayCallback>
-    void intersectRay(G3D::Ray const& ray, RayCallback& intersectCallback, float& maxDist)
+    void intersectRay(G3D::Ray const& ray, RayCallback& intersectCallback, float& maxDist) const
     {
-        balance();
-        MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.data(), m_objects.size());
+        MDLCallback<RayCallback> temp_cb(intersectCallback, m_treeObjects.data(), m_treeObjects.size());
         m_tree.intersectRay(ray, temp_cb, maxDist, true);
+        if (temp_cb.didHit)
+            return;
+
+        for (T const* obj : m_pending)
+            if (intersectCallback(ray, *obj, maxDist))
+                return;
     }
 
     template<typename IsectCallback>
-    void intersectPoint(G3D::Vector3 const& point, IsectCallback& intersectCallback)
+    void intersectPoint(G3D::Vector3 const& point, IsectCallback& intersectCallback) const
     {
-        balance();
-        MDLCallback<IsectCallback> callback(intersectCallback, m_objects.data(), m_objects.size());
+        MDLCallback<IsectCallback> callback(intersectCallback, m_treeObjects.data(), m_treeObjects.size());
         m_tree.intersectPoint(point, callback);
+
+        for (T const* obj : m_pending)
+            intersectCallback(point, *obj);
     }
 
     std::span<T const* const> getObjects() const { return m_objects; }
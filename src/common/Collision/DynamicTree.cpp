@@ -21,6 +21,7 @@
 #include "MapTree.h"
 #include "ModelIgnoreFlags.h"
 #include "RegularGrid.h"
+#include "ThreadPool.h"
 #include "Timer.h"
 #include "VMapFactory.h"
 #include "VMapManager.h"
@@ -28,6 +29,7 @@
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <atomic>
 
 namespace {
 
@@ -52,6 +54,19 @@ static bool operator==(GameObjectModel const& mdl, GameObjectModel const& mdl2){
 
 typedef RegularGrid2D<GameObjectModel, BIHWrap<GameObjectModel> > ParentTree;
 
+// Cell trees rebuilt together on a worker thread, only ever touched by the worker until Done is set
+struct DynTreeRebuildBatch
+{
+    struct CellRebuild
+    {
+        BIHWrap<GameObjectModel>* Node;
+        BIHWrap<GameObjectModel>::RebuildRequest Request;
+    };
+
+    std::vector<CellRebuild> Cells;
+    std::atomic<bool> Done = false;
+};
+
 struct DynTreeImpl : public ParentTree/*, public Intersectable*/
 {
     typedef GameObjectModel Model;
@@ -59,7 +74,8 @@ struct DynTreeImpl : public ParentTree/*, public Intersectable*/
 
     DynTreeImpl() :
         rebalance_timer(CHECK_TREE_PERIOD),
-        unbalanced_times(0)
+        unbalanced_times(0),
+        rebuild_pool(nullptr)
     {
     }
 
@@ -77,12 +93,52 @@ struct DynTreeImpl : public ParentTree/*, public Intersectable*/
 
     void balance()
     {
+        // a synchronous rebuild supersedes whatever the worker is doing
+        pending_rebuild.reset();
         base::balance();
         unbalanced_times = 0;
     }
 
+    void scheduleRebuild()
+    {
+        std::shared_ptr<DynTreeRebuildBatch> batch = std::make_shared<DynTreeRebuildBatch>();
+        for (int x = 0; x < CELL_NUMBER; ++x)
+            for (int y = 0; y < CELL_NUMBER; ++y)
+                if (BIHWrap<GameObjectModel>* node = nodes[x][y].get(); node && node->needsRebalance())
+                    batch->Cells.push_back({ .Node = node, .Request = node->prepareRebuild() });
+
+        unbalanced_times = 0;
+        if (batch->Cells.empty())
+            return;
+
+        pending_rebuild = batch;
+        rebuild_pool->PostWork([batch]()
+        {
+            for (DynTreeRebuildBatch::CellRebuild& cell : batch->Cells)
+                cell.Request.Build();
+
+            batch->Done.store(true, std::memory_order_release);
+        });
+    }
+
+    bool installPendingRebuild()
+    {
+        if (!pending_rebuild->Done.load(std::memory_order_acquire))
+            return false;
+
+        for (DynTreeRebuildBatch::CellRebuild& cell : pending_rebuild->Cells)
+            cell.Node->installRebuild(std::move(cell.Request));
+
+        pending_rebuild.reset();
+        return true;
+    }
+
     void update(uint32 difftime)
     {
+        // finished trees are swapped in on the owning thread so that queries never observe a partial tree
+        if (pending_rebuild && !installPendingRebuild())
+            return;
+
         if (empty())
             return;
 
@@ -91,12 +147,19 @@ struct DynTreeImpl : public ParentTree/*, public Intersectable*/
         {
             rebalance_timer.Reset(CHECK_TREE_PERIOD);
             if (unbalanced_times > 0)
-                balance();
+            {
+                if (rebuild_pool)
+                    scheduleRebuild();
+                else
+                    balance();
+            }
         }
     }
 
     TimeTracker rebalance_timer;
     int unbalanced_times;
+    Trinity::ThreadPool* rebuild_pool;
+    std::shared_ptr<DynTreeRebuildBatch> pending_rebuild;
 };
 
 DynamicMapTree::DynamicMapTree() : impl(new DynTreeImpl()) { }
@@ -128,6 +191,11 @@ void DynamicMapTree::update(uint32 t_diff)
     impl->update(t_diff);
 }
 
+void DynamicMapTree::setRebuildPool(Trinity::ThreadPool* pool)
+{
+    impl->rebuild_pool = pool;
+}
+
 struct DynamicTreeIntersectionCallback
 {
     DynamicTreeIntersectionCallback(PhaseShift const& phaseShift) : _didHit(false), _phaseShift(phaseShift) { }
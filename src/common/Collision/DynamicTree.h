@@ -33,6 +33,11 @@ class GameObjectModel;
 class PhaseShift;
 struct DynTreeImpl;
 
+namespace Trinity
+{
+    class ThreadPool;
+}
+
 namespace VMAP
 {
     struct AreaAndLiquidData;
@@ -61,6 +66,10 @@ public:
     void balance();
     void update(uint32 diff);
 
+    // Rebuilds cell trees on the given pool instead of inline in update(), queries keep using the previous
+    // tree (plus a linear check of objects inserted since) until the rebuilt one is installed by a later update()
+    void setRebuildPool(Trinity::ThreadPool* pool);
+
     std::span<GameObjectModel const* const> getModelsInGrid(uint32 gx, uint32 gy) const;
 };
 
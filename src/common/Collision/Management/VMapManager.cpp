@@ -23,6 +23,7 @@
 #include "VMapDefinitions.h"
 #include "WorldModel.h"
 #include <G3D/Vector3.h>
+#include <algorithm>
 
 namespace VMAP
 {
@@ -58,6 +59,7 @@ namespace VMAP
     VMapManager::VMapManager() :
         iEnableLineOfSightCalc(true),
         iEnableHeightCalc(true),
+        iMapModelFiles(false),
         thread_safe_environment(true),
         GetLiquidFlagsPtr([](uint32 /*liquidTypeId*/) { return 0u; }),
         IsVMAPDisabledForPtr([](uint32 /*mapId*/, uint8 /*disableFlags*/) { return false; }),
@@ -108,6 +110,40 @@ namespace VMAP
         return pos;
     }
 
+    // Indices of the queries ordered along a Z-order curve of 8 yard cells around their x/y,
+    // consecutive queries then mostly descend into the same tree nodes and touch the same models
+    template<typename Query, typename Projection>
+    static std::vector<uint32> GetLocalityOrder(std::span<Query const> queries, Projection projection)
+    {
+        auto spread = [](uint32 value)
+        {
+            uint64 bits = value & 0xFFFF;
+            bits = (bits | (bits << 8)) & 0x00FF00FF;
+            bits = (bits | (bits << 4)) & 0x0F0F0F0F;
+            bits = (bits | (bits << 2)) & 0x33333333;
+            bits = (bits | (bits << 1)) & 0x55555555;
+            return bits;
+        };
+
+        std::vector<std::pair<uint64, uint32>> keys;
+        keys.reserve(queries.size());
+        for (uint32 i = 0; i < queries.size(); ++i)
+        {
+            auto [x, y] = projection(queries[i]);
+            uint32 cellX = uint32(int32(x / 8.0f) + 0x8000);
+            uint32 cellY = uint32(int32(y / 8.0f) + 0x8000);
+            keys.emplace_back(spread(cellX) | (spread(cellY) << 1), i);
+        }
+
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<uint32> order;
+        order.reserve(keys.size());
+        for (auto const& [key, index] : keys)
+            order.push_back(index);
+        return order;
+    }
+
     std::string VMapManager::getMapFileName(uint32 mapId)
     {
         return Trinity::StringFormat("{:04}/{:04}.vmtree", mapId, mapId);
@@ -186,6 +222,26 @@ namespace VMAP
         return true;
     }
 
+    void VMapManager::isInLineOfSight(uint32 mapId, std::span<LineOfSightRay const> rays, ModelIgnoreFlags ignoreFlags, std::vector<bool>& results)
+    {
+        results.assign(rays.size(), true);
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+            return;
+
+        auto instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+            return;
+
+        for (uint32 i : GetLocalityOrder(rays, [](LineOfSightRay const& ray) { return std::pair(ray.X1, ray.Y1); }))
+        {
+            LineOfSightRay const& ray = rays[i];
+            G3D::Vector3 pos1 = convertPositionToInternalRep(ray.X1, ray.Y1, ray.Z1);
+            G3D::Vector3 pos2 = convertPositionToInternalRep(ray.X2, ray.Y2, ray.Z2);
+            if (pos1 != pos2)
+                results[i] = instanceTree->second->isInLineOfSight(pos1, pos2, ignoreFlags);
+        }
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
@@ -239,6 +295,25 @@ namespace VMAP
         return VMAP_INVALID_HEIGHT_VALUE;
     }
 
+    void VMapManager::getHeight(uint32 mapId, std::span<HeightQuery const> points, float maxSearchDist, std::vector<float>& heights)
+    {
+        heights.assign(points.size(), VMAP_INVALID_HEIGHT_VALUE);
+        if (!isHeightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_HEIGHT))
+            return;
+
+        auto instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+            return;
+
+        for (uint32 i : GetLocalityOrder(points, [](HeightQuery const& point) { return std::pair(point.X, point.Y); }))
+        {
+            G3D::Vector3 pos = convertPositionToInternalRep(points[i].X, points[i].Y, points[i].Z);
+            float height = instanceTree->second->getHeight(pos, maxSearchDist);
+            if (height < G3D::finf())
+                heights[i] = height;
+        }
+    }
+
     bool VMapManager::getAreaAndLiquidData(uint32 mapId, float x, float y, float z, Optional<uint8> reqLiquidType, AreaAndLiquidData& data) const
     {
         InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
@@ -281,7 +356,7 @@ namespace VMAP
             return std::shared_ptr<WorldModel>(worldmodel, &worldmodel->Model);
 
         worldmodel = std::make_shared<ManagedModel>(*this, key);
-        if (!worldmodel->Model.readFile(basepath + filename + ".vmo"))
+        if (!worldmodel->Model.readFile(basepath + filename + ".vmo", iMapModelFiles))
         {
             TC_LOG_ERROR("misc", "VMapManager: could not load '{}{}.vmo'", basepath, filename);
             return nullptr;
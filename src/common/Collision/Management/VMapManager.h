@@ -58,6 +58,19 @@ namespace VMAP
         VMAP_DISABLE_LIQUIDSTATUS   = 0x8
     };
 
+    // Segment in world coordinates, queried in batches
+    struct LineOfSightRay
+    {
+        float X1, Y1, Z1;
+        float X2, Y2, Z2;
+    };
+
+    // Point in world coordinates, queried in batches
+    struct HeightQuery
+    {
+        float X, Y, Z;
+    };
+
     enum class LoadResult : uint8
     {
         Success,
@@ -101,6 +114,7 @@ namespace VMAP
         protected:
             bool iEnableLineOfSightCalc;
             bool iEnableHeightCalc;
+            bool iMapModelFiles;
             bool thread_safe_environment;
             // Tree to check collision
             ModelFileMap iLoadedModelFiles;
@@ -140,6 +154,12 @@ namespace VMAP
             */
             void setEnableHeightCalc(bool enableHeightCalc) { iEnableHeightCalc = enableHeightCalc; }
 
+            /**
+                Map model files instead of reading them, their geometry is then used in place and shared with other processes
+                loading the same files. Only affects models loaded afterwards
+            */
+            void setMapModelFiles(bool mapModelFiles) { iMapModelFiles = mapModelFiles; }
+
             bool isLineOfSightCalcEnabled() const { return iEnableLineOfSightCalc; }
             bool isHeightCalcEnabled() const { return iEnableHeightCalc; }
             bool isMapLoadingEnabled() const { return iEnableLineOfSightCalc || iEnableHeightCalc; }
@@ -158,6 +178,13 @@ namespace VMAP
             bool getObjectHitPos(uint32 mapId, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
             float getHeight(uint32 mapId, float x, float y, float z, float maxSearchDist);
 
+            /**
+                Batched forms of isInLineOfSight and getHeight, the map tree is resolved once and the queries are
+                processed ordered by their position. results[i] (heights[i]) holds the answer to query i
+            */
+            void isInLineOfSight(uint32 mapId, std::span<LineOfSightRay const> rays, ModelIgnoreFlags ignoreFlags, std::vector<bool>& results);
+            void getHeight(uint32 mapId, std::span<HeightQuery const> points, float maxSearchDist, std::vector<float>& heights);
+
             /**
                 Query world model area info.
             */
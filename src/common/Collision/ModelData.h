@@ -0,0 +1,169 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MODEL_DATA_H
+#define TRINITYCORE_MODEL_DATA_H
+
+#include "Define.h"
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace VMAP
+{
+    /*! Elements of a model, either owned or viewed in place in the mapped file the model keeps alive */
+    template<typename T>
+    class ModelArray
+    {
+        public:
+            ModelArray() : _isView(false) { }
+            ModelArray(ModelArray const& other) : _owned(other._owned), _isView(other._isView) { _view = _isView ? other._view : std::span<T const>(_owned); }
+            ModelArray(ModelArray&& other) noexcept : _owned(std::move(other._owned)), _isView(other._isView) { _view = _isView ? other._view : std::span<T const>(_owned); other.clear(); }
+
+            ModelArray& operator=(ModelArray const& other)
+            {
+                if (this != &other)
+                {
+                    _owned = other._owned;
+                    _isView = other._isView;
+                    _view = _isView ? other._view : std::span<T const>(_owned);
+                }
+                return *this;
+            }
+
+            ModelArray& operator=(ModelArray&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    _owned = std::move(other._owned);
+                    _isView = other._isView;
+                    _view = _isView ? other._view : std::span<T const>(_owned);
+                    other.clear();
+                }
+                return *this;
+            }
+
+            ModelArray& operator=(std::vector<T> elements)
+            {
+                _owned = std::move(elements);
+                _isView = false;
+                _view = _owned;
+                return *this;
+            }
+
+            //! elements must outlive the array and every copy of it
+            void view(std::span<T const> elements)
+            {
+                _owned = {};
+                _isView = true;
+                _view = elements;
+            }
+
+            void clear()
+            {
+                _owned = {};
+                _isView = false;
+                _view = {};
+            }
+
+            T const& operator[](std::size_t index) const { return _view[index]; }
+            T const* data() const { return _view.data(); }
+            std::size_t size() const { return _view.size(); }
+            bool empty() const { return _view.empty(); }
+            auto begin() const { return _view.begin(); }
+            auto end() const { return _view.end(); }
+            operator std::span<T const>() const { return _view; }
+
+        private:
+            std::vector<T> _owned;
+            std::span<T const> _view;
+            bool _isView;
+    };
+
+    /*! Reads model files from memory. Arrays are viewed in place if the data is a mapped file the model keeps alive
+        and they are aligned for their element type, otherwise they are copied */
+    class ModelDataReader
+    {
+        public:
+            ModelDataReader(std::span<uint8 const> data, bool viewArrays) : _data(data), _position(0), _viewArrays(viewArrays) { }
+
+            template<typename T> requires std::is_trivially_copyable_v<T>
+            bool read(T& value) { return readBytes(&value, sizeof(T)); }
+
+            bool readBytes(void* dest, std::size_t size)
+            {
+                if (!canRead(size))
+                    return false;
+
+                std::memcpy(dest, _data.data() + _position, size);
+                _position += size;
+                return true;
+            }
+
+            bool skip(std::size_t size)
+            {
+                if (!canRead(size))
+                    return false;
+
+                _position += size;
+                return true;
+            }
+
+            std::size_t position() const { return _position; }
+
+            bool readChunk(char const* expected, std::size_t size)
+            {
+                if (!canRead(size) || std::memcmp(_data.data() + _position, expected, size) != 0)
+                    return false;
+
+                _position += size;
+                return true;
+            }
+
+            template<typename T> requires std::is_trivially_copyable_v<T>
+            bool readArray(uint32 count, ModelArray<T>& array)
+            {
+                std::size_t size = std::size_t(count) * sizeof(T);
+                if (!canRead(size))
+                    return false;
+
+                uint8 const* elements = _data.data() + _position;
+                if (_viewArrays && reinterpret_cast<std::uintptr_t>(elements) % alignof(T) == 0)
+                    array.view(std::span(reinterpret_cast<T const*>(elements), count));
+                else
+                {
+                    std::vector<T> copy(count);
+                    std::memcpy(copy.data(), elements, size);
+                    array = std::move(copy);
+                }
+
+                _position += size;
+                return true;
+            }
+
+        private:
+            bool canRead(std::size_t size) const { return _data.size() - _position >= size; }
+
+            std::span<uint8 const> _data;
+            std::size_t _position;
+            bool _viewArrays;
+    };
+}
+
+#endif // TRINITYCORE_MODEL_DATA_H
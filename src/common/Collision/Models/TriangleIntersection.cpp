@@ -0,0 +1,228 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TriangleIntersection.h"
+#include "WorldModel.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRIANGLE_INTERSECTION_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define TRIANGLE_INTERSECTION_NEON
+#endif
+
+using G3D::Vector3;
+
+namespace
+{
+constexpr float TRIANGLE_INTERSECTION_EPS = 1e-5f;
+
+// four lanes of floats and lane masks, the kernel below is written once against these
+#if defined(TRIANGLE_INTERSECTION_SSE2)
+struct Float4 { __m128 V; };
+struct Mask4 { __m128 V; };
+
+inline Float4 Load(float const* values) { return { _mm_loadu_ps(values) }; }
+inline Float4 Splat(float value) { return { _mm_set1_ps(value) }; }
+inline Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.V, b.V) }; }
+inline Float4 operator-(Float4 a, Float4 b) { return { _mm_sub_ps(a.V, b.V) }; }
+inline Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.V, b.V) }; }
+inline Float4 operator/(Float4 a, Float4 b) { return { _mm_div_ps(a.V, b.V) }; }
+inline Float4 Abs(Float4 a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.V) }; }
+inline Mask4 operator<(Float4 a, Float4 b) { return { _mm_cmplt_ps(a.V, b.V) }; }
+inline Mask4 operator<=(Float4 a, Float4 b) { return { _mm_cmple_ps(a.V, b.V) }; }
+inline Mask4 operator&(Mask4 a, Mask4 b) { return { _mm_and_ps(a.V, b.V) }; }
+inline uint32 Bits(Mask4 mask) { return uint32(_mm_movemask_ps(mask.V)); }
+inline void Store(float* values, Float4 a) { _mm_storeu_ps(values, a.V); }
+#elif defined(TRIANGLE_INTERSECTION_NEON)
+struct Float4 { float32x4_t V; };
+struct Mask4 { uint32x4_t V; };
+
+inline Float4 Load(float const* values) { return { vld1q_f32(values) }; }
+inline Float4 Splat(float value) { return { vdupq_n_f32(value) }; }
+inline Float4 operator+(Float4 a, Float4 b) { return { vaddq_f32(a.V, b.V) }; }
+inline Float4 operator-(Float4 a, Float4 b) { return { vsubq_f32(a.V, b.V) }; }
+inline Float4 operator*(Float4 a, Float4 b) { return { vmulq_f32(a.V, b.V) }; }
+inline Float4 operator/(Float4 a, Float4 b) { return { vdivq_f32(a.V, b.V) }; }
+inline Float4 Abs(Float4 a) { return { vabsq_f32(a.V) }; }
+inline Mask4 operator<(Float4 a, Float4 b) { return { vcltq_f32(a.V, b.V) }; }
+inline Mask4 operator<=(Float4 a, Float4 b) { return { vcleq_f32(a.V, b.V) }; }
+inline Mask4 operator&(Mask4 a, Mask4 b) { return { vandq_u32(a.V, b.V) }; }
+inline uint32 Bits(Mask4 mask)
+{
+    uint32x4_t const weights = { 1, 2, 4, 8 };
+    return vaddvq_u32(vandq_u32(mask.V, weights));
+}
+inline void Store(float* values, Float4 a) { vst1q_f32(values, a.V); }
+#else
+struct Float4 { std::array<float, 4> V; };
+struct Mask4 { std::array<bool, 4> V; };
+
+template<typename Op>
+inline Float4 Apply(Float4 a, Float4 b, Op op) { return { { op(a.V[0], b.V[0]), op(a.V[1], b.V[1]), op(a.V[2], b.V[2]), op(a.V[3], b.V[3]) } }; }
+template<typename Op>
+inline Mask4 Compare(Float4 a, Float4 b, Op op) { return { { op(a.V[0], b.V[0]), op(a.V[1], b.V[1]), op(a.V[2], b.V[2]), op(a.V[3], b.V[3]) } }; }
+
+inline Float4 Load(float const* values) { return { { values[0], values[1], values[2], values[3] } }; }
+inline Float4 Splat(float value) { return { { value, value, value, value } }; }
+inline Float4 operator+(Float4 a, Float4 b) { return Apply(a, b, [](float l, float r) { return l + r; }); }
+inline Float4 operator-(Float4 a, Float4 b) { return Apply(a, b, [](float l, float r) { return l - r; }); }
+inline Float4 operator*(Float4 a, Float4 b) { return Apply(a, b, [](float l, float r) { return l * r; }); }
+inline Float4 operator/(Float4 a, Float4 b) { return Apply(a, b, [](float l, float r) { return l / r; }); }
+inline Float4 Abs(Float4 a) { return { { std::fabs(a.V[0]), std::fabs(a.V[1]), std::fabs(a.V[2]), std::fabs(a.V[3]) } }; }
+inline Mask4 operator<(Float4 a, Float4 b) { return Compare(a, b, [](float l, float r) { return l < r; }); }
+inline Mask4 operator<=(Float4 a, Float4 b) { return Compare(a, b, [](float l, float r) { return l <= r; }); }
+inline Mask4 operator&(Mask4 a, Mask4 b) { return { { a.V[0] && b.V[0], a.V[1] && b.V[1], a.V[2] && b.V[2], a.V[3] && b.V[3] } }; }
+inline uint32 Bits(Mask4 mask) { return uint32(mask.V[0]) | uint32(mask.V[1]) << 1 | uint32(mask.V[2]) << 2 | uint32(mask.V[3]) << 3; }
+inline void Store(float* values, Float4 a) { std::ranges::copy(a.V, values); }
+#endif
+
+struct Vector4x3
+{
+    Float4 X, Y, Z;
+};
+
+inline Vector4x3 operator-(Vector4x3 const& a, Vector4x3 const& b) { return { a.X - b.X, a.Y - b.Y, a.Z - b.Z }; }
+
+// same operation order as G3D::Vector3::cross and dot, lanes give the results of the scalar test
+inline Vector4x3 Cross(Vector4x3 const& a, Vector4x3 const& b) { return { a.Y * b.Z - a.Z * b.Y, a.Z * b.X - a.X * b.Z, a.X * b.Y - a.Y * b.X }; }
+inline Float4 Dot(Vector4x3 const& a, Vector4x3 const& b) { return a.X * b.X + a.Y * b.Y + a.Z * b.Z; }
+
+inline Vector4x3 Splat(Vector3 const& v) { return { Splat(v.x), Splat(v.y), Splat(v.z) }; }
+
+// distances of the four triangles, mask bits are set for the ones hit closer than distance
+uint32 IntersectTriangles4(std::array<VMAP::MeshTriangle const*, 4> const& triangles, Vector3 const* points, G3D::Ray const& ray, float distance, std::array<float, 4>& hits)
+{
+    std::array<float, 4> coords[9];
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        Vector3 const* vertices[3] = { &points[triangles[i]->idx0], &points[triangles[i]->idx1], &points[triangles[i]->idx2] };
+        for (std::size_t v = 0; v < 3; ++v)
+        {
+            coords[v * 3 + 0][i] = vertices[v]->x;
+            coords[v * 3 + 1][i] = vertices[v]->y;
+            coords[v * 3 + 2][i] = vertices[v]->z;
+        }
+    }
+
+    Vector4x3 v0 = { Load(coords[0].data()), Load(coords[1].data()), Load(coords[2].data()) };
+    Vector4x3 v1 = { Load(coords[3].data()), Load(coords[4].data()), Load(coords[5].data()) };
+    Vector4x3 v2 = { Load(coords[6].data()), Load(coords[7].data()), Load(coords[8].data()) };
+    Vector4x3 direction = Splat(ray.direction());
+
+    Vector4x3 e1 = v1 - v0;
+    Vector4x3 e2 = v2 - v0;
+    Vector4x3 p = Cross(direction, e2);
+    Float4 a = Dot(e1, p);
+    Mask4 valid = Splat(TRIANGLE_INTERSECTION_EPS) <= Abs(a);
+
+    Float4 f = Splat(1.0f) / a;
+    Vector4x3 s = Splat(ray.origin()) - v0;
+    Float4 u = f * Dot(s, p);
+    valid = valid & (Splat(0.0f) <= u) & (u <= Splat(1.0f));
+
+    Vector4x3 q = Cross(s, e1);
+    Float4 v = f * Dot(direction, q);
+    valid = valid & (Splat(0.0f) <= v) & (u + v <= Splat(1.0f));
+
+    Float4 t = f * Dot(e2, q);
+    valid = valid & (Splat(0.0f) < t) & (t < Splat(distance));
+
+    Store(hits.data(), t);
+    return Bits(valid);
+}
+}
+
+namespace VMAP
+{
+    bool IntersectTriangle(MeshTriangle const& tri, Vector3 const* points, G3D::Ray const& ray, float& distance)
+    {
+        // See RTR2 ch. 13.7 for the algorithm.
+
+        const Vector3 e1 = points[tri.idx1] - points[tri.idx0];
+        const Vector3 e2 = points[tri.idx2] - points[tri.idx0];
+        const Vector3 p(ray.direction().cross(e2));
+        const float a = e1.dot(p);
+
+        if (std::fabs(a) < TRIANGLE_INTERSECTION_EPS) {
+            // Determinant is ill-conditioned; abort early
+            return false;
+        }
+
+        const float f = 1.0f / a;
+        const Vector3 s(ray.origin() - points[tri.idx0]);
+        const float u = f * s.dot(p);
+
+        if ((u < 0.0f) || (u > 1.0f)) {
+            // We hit the plane of the m_geometry, but outside the m_geometry
+            return false;
+        }
+
+        const Vector3 q(s.cross(e1));
+        const float v = f * ray.direction().dot(q);
+
+        if ((v < 0.0f) || ((u + v) > 1.0f)) {
+            // We hit the plane of the triangle, but outside the triangle
+            return false;
+        }
+
+        const float t = f * e2.dot(q);
+
+        if ((t > 0.0f) && (t < distance))
+        {
+            // This is a new hit, closer than the previous one
+            distance = t;
+
+            /* baryCoord[0] = 1.0 - u - v;
+            baryCoord[1] = u;
+            baryCoord[2] = v; */
+
+            return true;
+        }
+        // This hit is after the previous hit, so ignore it
+        return false;
+    }
+
+    bool IntersectTriangles(std::span<uint32 const> indices, MeshTriangle const* triangles, Vector3 const* points, G3D::Ray const& ray, float& distance)
+    {
+        bool hit = false;
+        for (std::size_t first = 0; first < indices.size(); first += 4)
+        {
+            // a partial batch repeats its last triangle, which can not be closer than itself
+            std::array<MeshTriangle const*, 4> batch;
+            for (std::size_t i = 0; i < 4; ++i)
+                batch[i] = &triangles[indices[std::min(first + i, indices.size() - 1)]];
+
+            std::array<float, 4> hits;
+            uint32 mask = IntersectTriangles4(batch, points, ray, distance, hits);
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                if (mask & (1 << i) && hits[i] < distance)
+                {
+                    distance = hits[i];
+                    hit = true;
+                }
+            }
+        }
+
+        return hit;
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_TRIANGLE_INTERSECTION_H
+#define TRINITYCORE_TRIANGLE_INTERSECTION_H
+
+#include "Define.h"
+#include <G3D/Ray.h>
+#include <G3D/Vector3.h>
+#include <span>
+
+namespace VMAP
+{
+    struct MeshTriangle;
+
+    //! Moeller-Trumbore test of one triangle, distance is lowered to the hit if it is closer
+    TC_COMMON_API bool IntersectTriangle(MeshTriangle const& tri, G3D::Vector3 const* points, G3D::Ray const& ray, float& distance);
+
+    //! Tests the triangles at indices four at a time (SSE2 or NEON where available), distance is lowered to the closest hit.
+    //! Gives the same result as calling IntersectTriangle for each of them
+    TC_COMMON_API bool IntersectTriangles(std::span<uint32 const> indices, MeshTriangle const* triangles, G3D::Vector3 const* points, G3D::Ray const& ray, float& distance);
+}
+
+#endif // TRINITYCORE_TRIANGLE_INTERSECTION_H
@@ -19,6 +19,10 @@
 #include "VMapDefinitions.h"
 #include "MapTree.h"
 #include "ModelIgnoreFlags.h"
+#include "TriangleIntersection.h"
+#include "Memory.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <array>
 #include <cstring>
 
@@ -32,60 +36,10 @@ template<> struct BoundsTrait<VMAP::GroupModel>
 
 namespace VMAP
 {
-    bool IntersectTriangle(MeshTriangle const& tri, std::vector<Vector3>::const_iterator points, G3D::Ray const& ray, float& distance)
-    {
-        static const float EPS = 1e-5f;
-
-        // See RTR2 ch. 13.7 for the algorithm.
-
-        const Vector3 e1 = points[tri.idx1] - points[tri.idx0];
-        const Vector3 e2 = points[tri.idx2] - points[tri.idx0];
-        const Vector3 p(ray.direction().cross(e2));
-        const float a = e1.dot(p);
-
-        if (std::fabs(a) < EPS) {
-            // Determinant is ill-conditioned; abort early
-            return false;
-        }
-
-        const float f = 1.0f / a;
-        const Vector3 s(ray.origin() - points[tri.idx0]);
-        const float u = f * s.dot(p);
-
-        if ((u < 0.0f) || (u > 1.0f)) {
-            // We hit the plane of the m_geometry, but outside the m_geometry
-            return false;
-        }
-
-        const Vector3 q(s.cross(e1));
-        const float v = f * ray.direction().dot(q);
-
-        if ((v < 0.0f) || ((u + v) > 1.0f)) {
-            // We hit the plane of the triangle, but outside the triangle
-            return false;
-        }
-
-        const float t = f * e2.dot(q);
-
-        if ((t > 0.0f) && (t < distance))
-        {
-            // This is a new hit, closer than the previous one
-            distance = t;
-
-            /* baryCoord[0] = 1.0 - u - v;
-            baryCoord[1] = u;
-            baryCoord[2] = v; */
-
-            return true;
-        }
-        // This hit is after the previous hit, so ignore it
-        return false;
-    }
-
     class TriBoundFunc
     {
         public:
-            TriBoundFunc(std::vector<Vector3>& vert): vertices(vert.begin()) { }
+            TriBoundFunc(std::span<Vector3 const> vert): vertices(vert.data()) { }
             void operator()(MeshTriangle const& tri, G3D::AABox& out) const
             {
                 G3D::Vector3 lo = vertices[tri.idx0];
@@ -97,7 +51,7 @@ namespace VMAP
                 out = G3D::AABox(lo, hi);
             }
         protected:
-            const std::vector<Vector3>::const_iterator vertices;
+            Vector3 const* const vertices;
     };
 
     // ===================== WmoLiquid ==================================
@@ -243,31 +197,31 @@ namespace VMAP
         return result;
     }
 
-    bool WmoLiquid::readFromFile(FILE* rf, WmoLiquid*& out)
+    bool WmoLiquid::readFromData(ModelDataReader& reader, WmoLiquid*& out)
     {
         bool result = false;
         WmoLiquid* liquid = new WmoLiquid();
 
-        if (fread(&liquid->iTilesX, sizeof(uint32), 1, rf) == 1 &&
-            fread(&liquid->iTilesY, sizeof(uint32), 1, rf) == 1 &&
-            fread(&liquid->iCorner, sizeof(Vector3), 1, rf) == 1 &&
-            fread(&liquid->iType, sizeof(uint32), 1, rf) == 1)
+        if (reader.read(liquid->iTilesX) &&
+            reader.read(liquid->iTilesY) &&
+            reader.readBytes(&liquid->iCorner, sizeof(Vector3)) &&
+            reader.read(liquid->iType))
         {
             if (liquid->iTilesX && liquid->iTilesY)
             {
                 uint32 size = (liquid->iTilesX + 1) * (liquid->iTilesY + 1);
                 liquid->iHeight = new float[size];
-                if (fread(liquid->iHeight, sizeof(float), size, rf) == size)
+                if (reader.readBytes(liquid->iHeight, sizeof(float) * size))
                 {
                     size = liquid->iTilesX * liquid->iTilesY;
                     liquid->iFlags = new uint8[size];
-                    result = fread(liquid->iFlags, sizeof(uint8), size, rf) == size;
+                    result = reader.readBytes(liquid->iFlags, sizeof(uint8) * size);
                 }
             }
             else
             {
                 liquid->iHeight = new float[1];
-                result = fread(liquid->iHeight, sizeof(float), 1, rf) == 1;
+                result = reader.readBytes(liquid->iHeight, sizeof(float));
             }
         }
 
@@ -343,16 +297,19 @@ namespace VMAP
             if (result && fwrite(&chunkSize, sizeof(uint32), 1, wf) != 1) result = false;
             return result;
         }
-        chunkSize = iLiquid->GetFileSize();
+        // padded for the arrays of the following group models to stay aligned when they are viewed in a mapped file
+        uint32 liquidSize = iLiquid->GetFileSize();
+        chunkSize = (liquidSize + 3) & ~3u;
         if (result && fwrite(&chunkSize, sizeof(uint32), 1, wf) != 1) result = false;
         if (result) result = iLiquid->writeToFile(wf);
+        uint8 const padding[4] = { };
+        if (result && chunkSize != liquidSize && fwrite(padding, 1, chunkSize - liquidSize, wf) != chunkSize - liquidSize) result = false;
 
         return result;
     }
 
-    bool GroupModel::readFromFile(FILE* rf)
+    bool GroupModel::readFromData(ModelDataReader& reader)
     {
-        char chunk[8];
         bool result = true;
         uint32 chunkSize = 0;
         uint32 count = 0;
@@ -361,49 +318,58 @@ namespace VMAP
         delete iLiquid;
         iLiquid = nullptr;
 
-        if (result && fread(&iBound, sizeof(G3D::AABox), 1, rf) != 1) result = false;
-        if (result && fread(&iMogpFlags, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result && fread(&iGroupWMOID, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.readBytes(&iBound, sizeof(G3D::AABox))) result = false;
+        if (result && !reader.read(iMogpFlags)) result = false;
+        if (result && !reader.read(iGroupWMOID)) result = false;
 
         // read vertices
-        if (result && !readChunk(rf, chunk, "VERT", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result && fread(&count, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.readChunk("VERT", 4)) result = false;
+        if (result && !reader.read(chunkSize)) result = false;
+        if (result && !reader.read(count)) result = false;
         if (!count) // models without (collision) geometry end here, unsure if they are useful
             return result;
-        if (result) vertices.resize(count);
-        if (result && fread(&vertices[0], sizeof(Vector3), count, rf) != count) result = false;
+        if (result && !reader.readArray(count, vertices)) result = false;
 
         // read triangle mesh
-        if (result && !readChunk(rf, chunk, "TRIM", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result && fread(&count, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result) triangles.resize(count);
-        if (result && fread(&triangles[0], sizeof(MeshTriangle), count, rf) != count) result = false;
+        if (result && !reader.readChunk("TRIM", 4)) result = false;
+        if (result && !reader.read(chunkSize)) result = false;
+        if (result && !reader.read(count)) result = false;
+        if (result && !reader.readArray(count, triangles)) result = false;
 
         // read mesh BIH
-        if (result && !readChunk(rf, chunk, "MBIH", 4)) result = false;
-        if (result) result = meshTree.readFromFile(rf);
+        if (result && !reader.readChunk("MBIH", 4)) result = false;
+        if (result) result = meshTree.readFromData(reader);
 
         // write liquid data
-        if (result && !readChunk(rf, chunk, "LIQU", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.readChunk("LIQU", 4)) result = false;
+        if (result && !reader.read(chunkSize)) result = false;
         if (result && chunkSize > 0)
-            result = WmoLiquid::readFromFile(rf, iLiquid);
+        {
+            // files written before the liquid chunk was padded end right after the liquid data
+            std::size_t liquidStart = reader.position();
+            result = WmoLiquid::readFromData(reader, iLiquid);
+            if (result && reader.position() - liquidStart < chunkSize)
+                result = reader.skip(chunkSize - (reader.position() - liquidStart));
+        }
         return result;
     }
 
     struct GModelRayCallback
     {
-        GModelRayCallback(std::vector<MeshTriangle> const& tris, const std::vector<Vector3> &vert):
-            vertices(vert.begin()), triangles(tris.begin()), hit(false) { }
+        GModelRayCallback(std::span<MeshTriangle const> tris, std::span<Vector3 const> vert):
+            vertices(vert.data()), triangles(tris.data()), hit(false) { }
         bool operator()(G3D::Ray const& ray, uint32 entry, float& distance, bool /*pStopAtFirstHit*/)
         {
             hit = IntersectTriangle(triangles[entry], vertices, ray, distance) || hit;
             return hit;
         }
-        std::vector<Vector3>::const_iterator vertices;
-        std::vector<MeshTriangle>::const_iterator triangles;
+        bool operator()(G3D::Ray const& ray, std::span<uint32 const> entries, float& distance, bool /*pStopAtFirstHit*/)
+        {
+            hit = IntersectTriangles(entries, triangles, vertices, ray, distance) || hit;
+            return hit;
+        }
+        Vector3 const* vertices;
+        MeshTriangle const* triangles;
         bool hit;
     };
 
@@ -612,47 +578,77 @@ namespace VMAP
         return result;
     }
 
-    bool WorldModel::readFile(const std::string& filename)
+    bool WorldModel::readFile(const std::string& filename, bool mapFile)
     {
-        FILE* rf = fopen(filename.c_str(), "rb");
-        if (!rf)
-            return false;
+        std::shared_ptr<boost::interprocess::mapped_region const> mappedFile;
+        std::vector<uint8> contents;
+        std::span<uint8 const> data;
+        if (mapFile)
+        {
+            try
+            {
+                boost::interprocess::file_mapping file(filename.c_str(), boost::interprocess::read_only);
+                mappedFile = std::make_shared<boost::interprocess::mapped_region const>(file, boost::interprocess::read_only);
+                data = std::span(static_cast<uint8 const*>(mappedFile->get_address()), mappedFile->get_size());
+            }
+            catch (boost::interprocess::interprocess_exception const& /*e*/)
+            {
+                // missing or empty files, the error is reported by reading them
+            }
+        }
+
+        if (!mappedFile)
+        {
+            auto rf = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(filename.c_str(), "rb"));
+            if (!rf)
+                return false;
+
+            fseek(rf.get(), 0, SEEK_END);
+            long size = ftell(rf.get());
+            fseek(rf.get(), 0, SEEK_SET);
+            if (size < 0)
+                return false;
 
+            contents.resize(size);
+            if (size && fread(contents.data(), size, 1, rf.get()) != 1)
+                return false;
+
+            data = contents;
+        }
+
+        ModelDataReader reader(data, mappedFile != nullptr);
         bool result = true;
         uint32 chunkSize = 0;
         uint32 count = 0;
-        char chunk[8];                          // Ignore the added magic header
-        if (!readChunk(rf, chunk, VMAP_MAGIC, 8)) result = false;
+        if (!reader.readChunk(VMAP_MAGIC, 8)) result = false;
 
-        if (result && !readChunk(rf, chunk, "WMOD", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.readChunk("WMOD", 4)) result = false;
+        if (result && !reader.read(chunkSize)) result = false;
         if (result)
         {
             ModelFlags flags;
-            if (fread(&flags, sizeof(flags), 1, rf) == 1)
+            if (reader.read(flags))
                 Flags = flags;
             else
                 result = false;
         }
-        if (result && fread(&RootWMOID, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.read(RootWMOID)) result = false;
 
         // read group models
-        if (result && readChunk(rf, chunk, "GMOD", 4))
+        if (result && reader.readChunk("GMOD", 4))
         {
-            //if (fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
-
-            if (result && fread(&count, sizeof(uint32), 1, rf) != 1) result = false;
+            if (result && !reader.read(count)) result = false;
             if (result) groupModels.resize(count);
-            //if (result && fread(&groupModels[0], sizeof(GroupModel), count, rf) != count) result = false;
             for (uint32 i = 0; i < count && result; ++i)
-                result = groupModels[i].readFromFile(rf);
+                result = groupModels[i].readFromData(reader);
 
             // read group BIH
-            if (result && !readChunk(rf, chunk, "GBIH", 4)) result = false;
-            if (result) result = groupTree.readFromFile(rf);
+            if (result && !reader.readChunk("GBIH", 4)) result = false;
+            if (result) result = groupTree.readFromData(reader);
         }
 
-        fclose(rf);
+        // geometry viewed in place references the mapping, it stays open as long as the model exists
+        iMappedFile = std::move(mappedFile);
         return result;
     }
 }
@@ -25,6 +25,13 @@
 
 #include "Define.h"
 #include "EnumFlag.h"
+#include <memory>
+#include <span>
+
+namespace boost::interprocess
+{
+    class mapped_region;
+}
 
 namespace VMAP
 {
@@ -64,7 +71,7 @@ namespace VMAP
             uint8 const* GetFlagsStorage()  const { return iFlags; }
             uint32 GetFileSize();
             bool writeToFile(FILE* wf);
-            static bool readFromFile(FILE* rf, WmoLiquid* &liquid);
+            static bool readFromData(ModelDataReader& reader, WmoLiquid* &liquid);
             void getPosInfo(uint32 &tilesX, uint32 &tilesY, G3D::Vector3 &corner) const;
         private:
             WmoLiquid() : iTilesX(0), iTilesY(0), iCorner(), iType(0), iHeight(nullptr), iFlags(nullptr) { }
@@ -95,20 +102,20 @@ namespace VMAP
             bool GetLiquidLevel(const G3D::Vector3 &pos, float &liqHeight) const;
             uint32 GetLiquidType() const;
             bool writeToFile(FILE* wf);
-            bool readFromFile(FILE* rf);
+            bool readFromData(ModelDataReader& reader);
             G3D::AABox const& GetBound() const { return iBound; }
             G3D::AABox const& GetMeshTreeBound() const { return meshTree.bound(); }
             uint32 GetMogpFlags() const { return iMogpFlags; }
             uint32 GetWmoID() const { return iGroupWMOID; }
-            std::vector<G3D::Vector3> const& GetVertices() const { return vertices; }
-            std::vector<MeshTriangle> const& GetTriangles() const { return triangles; }
+            std::span<G3D::Vector3 const> GetVertices() const { return vertices; }
+            std::span<MeshTriangle const> GetTriangles() const { return triangles; }
             WmoLiquid const* GetLiquid() const { return iLiquid; }
         protected:
             G3D::AABox iBound;
             uint32 iMogpFlags;// 0x8 outdor; 0x2000 indoor
             uint32 iGroupWMOID;
-            std::vector<G3D::Vector3> vertices;
-            std::vector<MeshTriangle> triangles;
+            ModelArray<G3D::Vector3> vertices;
+            ModelArray<MeshTriangle> triangles;
             BIH meshTree;
             WmoLiquid* iLiquid;
     };
@@ -126,7 +133,8 @@ namespace VMAP
             bool IntersectRay(const G3D::Ray &ray, float &distance, bool stopAtFirstHit, ModelIgnoreFlags ignoreFlags) const;
             bool GetLocationInfo(const G3D::Vector3 &p, const G3D::Vector3 &down, float &dist, GroupLocationInfo& info) const;
             bool writeFile(const std::string &filename);
-            bool readFile(const std::string &filename);
+            //! mapped files are kept open by the model, its geometry is read in place instead of being copied
+            bool readFile(const std::string &filename, bool mapFile = false);
             bool IsM2() const { return Flags.HasFlag(ModelFlags::IsM2); }
             std::vector<GroupModel> const& getGroupModels() const { return groupModels; }
         protected:
@@ -134,6 +142,7 @@ namespace VMAP
             uint32 RootWMOID;
             std::vector<GroupModel> groupModels;
             BIH groupTree;
+            std::shared_ptr<boost::interprocess::mapped_region const> iMappedFile;
     };
 } // namespace VMAP
 
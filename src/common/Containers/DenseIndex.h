@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_DENSE_INDEX_H
+#define TRINITYCORE_DENSE_INDEX_H
+
+#include "Define.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace Trinity::Containers
+{
+/*
+ * Pointers to the values of a map keyed by mostly contiguous ids, looked up by offset from the lowest id.
+ * The map keeps owning the values; values must not move or be destroyed before the index is rebuilt or
+ * cleared (node based maps only). Ids added after Build are not known to the index, callers fall back to the map
+ * once it no longer Covers it.
+ */
+template <class T>
+class DenseIndex
+{
+public:
+    // Ids spread over more than this many slots per value are not indexed at all
+    static constexpr std::size_t MaxSlotsPerValue = 8;
+
+    template <class Map, class Projection = std::identity>
+    void Build(Map& map, Projection projection = {})
+    {
+        Clear();
+        if (map.empty())
+            return;
+
+        auto [minItr, maxItr] = std::ranges::minmax_element(map, {}, [](auto const& pair) { return pair.first; });
+        uint32 first = uint32(minItr->first);
+        std::size_t slots = std::size_t(uint32(maxItr->first) - first) + 1;
+        if (slots > map.size() * MaxSlotsPerValue)
+            return;
+
+        _first = first;
+        _indexedCount = map.size();
+        _values.resize(slots, nullptr);
+        for (auto& [id, value] : map)
+            _values[uint32(id) - _first] = &std::invoke(projection, value);
+    }
+
+    void Clear()
+    {
+        _first = 0;
+        _indexedCount = 0;
+        _values.clear();
+        _values.shrink_to_fit();
+    }
+
+    T* Find(uint32 id) const
+    {
+        uint32 slot = id - _first;
+        return slot < _values.size() ? _values[slot] : nullptr;
+    }
+
+    bool IsEmpty() const { return _values.empty(); }
+
+    // True while the map holds exactly the values indexed, a miss in Find is then a miss in the map too
+    bool Covers(std::size_t mapSize) const { return !_values.empty() && mapSize == _indexedCount; }
+
+private:
+    uint32 _first = 0;
+    std::size_t _indexedCount = 0;
+    std::vector<T*> _values;
+};
+}
+
+#endif // TRINITYCORE_DENSE_INDEX_H
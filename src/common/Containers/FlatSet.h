@@ -17,8 +17,11 @@
 #ifndef TRINITYCORE_FLAT_SET_H
 #define TRINITYCORE_FLAT_SET_H
 
+#include "Define.h"
 #include <algorithm>
+#include <bit>
 #include <functional>
+#include <iterator>
 #include <vector>
 
 namespace Trinity::Containers
@@ -102,6 +105,217 @@ public:
 private:
     KeyContainer _storage;
 };
+
+/*
+ * Open addressing hash set with linear probing for small trivially copyable keys.
+ * Keys live in one contiguous array, so copying, clearing and iterating a set don't touch a node per key
+ * and a cleared set keeps its capacity. Erasing shifts the following keys of the probe sequence back
+ * instead of leaving tombstones. Inserting and erasing invalidate all iterators, so unlike std::unordered_set
+ * a set can't be erased from while it is iterated.
+ */
+template <class Key, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class FlatHashSet
+{
+public:
+    static constexpr std::size_t MinCapacity = 16;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Key;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Key const*;
+        using reference = Key const&;
+
+        const_iterator() : _set(nullptr), _index(0) { }
+
+        reference operator*() const { return _set->_keys[_index]; }
+        pointer operator->() const { return &_set->_keys[_index]; }
+
+        const_iterator& operator++()
+        {
+            _index = _set->NextUsed(_index + 1);
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator itr = *this;
+            ++*this;
+            return itr;
+        }
+
+        friend bool operator==(const_iterator const& left, const_iterator const& right) { return left._index == right._index; }
+
+    private:
+        friend FlatHashSet;
+
+        const_iterator(FlatHashSet const* set, std::size_t index) : _set(set), _index(index) { }
+
+        FlatHashSet const* _set;
+        std::size_t _index;
+    };
+
+    using iterator = const_iterator;
+    using value_type = Key;
+    using size_type = std::size_t;
+
+    FlatHashSet() = default;
+    FlatHashSet(FlatHashSet const&) = default;
+    FlatHashSet(FlatHashSet&& other) noexcept : FlatHashSet() { swap(other); }
+    FlatHashSet& operator=(FlatHashSet const&) = default;
+    FlatHashSet& operator=(FlatHashSet&& other) noexcept
+    {
+        FlatHashSet(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~FlatHashSet() = default;
+
+    void swap(FlatHashSet& other) noexcept
+    {
+        std::swap(_keys, other._keys);
+        std::swap(_used, other._used);
+        std::swap(_size, other._size);
+        std::swap(_mask, other._mask);
+        std::swap(_shift, other._shift);
+    }
+
+    bool empty() const { return _size == 0; }
+    std::size_t size() const { return _size; }
+    std::size_t capacity() const { return _keys.size(); }
+
+    const_iterator begin() const { return { this, NextUsed(0) }; }
+    const_iterator end() const { return { this, _keys.size() }; }
+
+    bool contains(Key const& key) const { return FindSlot(key) != _keys.size(); }
+    std::size_t count(Key const& key) const { return contains(key) ? 1 : 0; }
+    const_iterator find(Key const& key) const { return { this, FindSlot(key) }; }
+
+    template <class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(Key(std::forward<Args>(args)...));
+    }
+
+    std::pair<iterator, bool> insert(Key const& key)
+    {
+        if ((_size + 1) * 4 > _keys.size() * 3)
+            Rehash(std::max(_keys.size() * 2, MinCapacity));
+
+        std::size_t i = GetHome(key);
+        for (; _used[i]; i = (i + 1) & _mask)
+            if (KeyEqual()(_keys[i], key))
+                return { { this, i }, false };
+
+        _keys[i] = key;
+        _used[i] = 1;
+        ++_size;
+        return { { this, i }, true };
+    }
+
+    template <class InputItr>
+    void insert(InputItr first, InputItr last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    std::size_t erase(Key const& key)
+    {
+        std::size_t i = FindSlot(key);
+        if (i == _keys.size())
+            return 0;
+
+        // shift the following keys of the probe sequence back so that lookups never need tombstones
+        for (std::size_t j = (i + 1) & _mask; _used[j]; j = (j + 1) & _mask)
+        {
+            std::size_t home = GetHome(_keys[j]);
+            if (((j - home) & _mask) < ((j - i) & _mask))
+                continue;
+
+            _keys[i] = _keys[j];
+            i = j;
+        }
+
+        _used[i] = 0;
+        --_size;
+        return 1;
+    }
+
+    void clear()
+    {
+        if (!_size)
+            return;
+
+        std::fill(_used.begin(), _used.end(), 0);
+        _size = 0;
+    }
+
+    void reserve(std::size_t count)
+    {
+        std::size_t capacity = std::bit_ceil(std::max((count * 4 + 2) / 3, MinCapacity));
+        if (capacity > _keys.size())
+            Rehash(capacity);
+    }
+
+private:
+    std::size_t GetHome(Key const& key) const
+    {
+        // fibonacci hashing, the hashes of std::hash are often the keys themselves
+        return std::size_t((uint64(Hash()(key)) * UI64LIT(0x9E3779B97F4A7C15)) >> _shift);
+    }
+
+    std::size_t FindSlot(Key const& key) const
+    {
+        if (!_size)
+            return _keys.size();
+
+        for (std::size_t i = GetHome(key); _used[i]; i = (i + 1) & _mask)
+            if (KeyEqual()(_keys[i], key))
+                return i;
+
+        return _keys.size();
+    }
+
+    std::size_t NextUsed(std::size_t i) const
+    {
+        while (i < _used.size() && !_used[i])
+            ++i;
+        return i;
+    }
+
+    void Rehash(std::size_t capacity)
+    {
+        std::vector<Key> keys(capacity);
+        std::vector<uint8> used(capacity);
+        std::swap(keys, _keys);
+        std::swap(used, _used);
+        _mask = capacity - 1;
+        _shift = 64 - std::countr_zero(capacity);
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if (!used[i])
+                continue;
+
+            std::size_t j = GetHome(keys[i]);
+            while (_used[j])
+                j = (j + 1) & _mask;
+
+            _keys[j] = keys[i];
+            _used[j] = 1;
+        }
+    }
+
+    // empty keys are valid keys (clients send them), so slots are marked used separately instead of with a sentinel key
+    std::vector<Key> _keys;
+    std::vector<uint8> _used;
+    std::size_t _size = 0;
+    std::size_t _mask = 0;
+    int32 _shift = 64;
+};
 }
 
 #endif // TRINITYCORE_FLAT_SET_H
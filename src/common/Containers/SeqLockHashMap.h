@@ -0,0 +1,263 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_SEQ_LOCK_HASH_MAP_H
+#define TRINITYCORE_SEQ_LOCK_HASH_MAP_H
+
+#include "Define.h"
+#include "Errors.h"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Trinity::Containers
+{
+/*
+ * Open addressing map of pointers that any thread can read without writing shared memory.
+ * Readers probe the slots and retry when the sequence number of the map changed meanwhile, every
+ * Insert and Remove makes it odd while it moves slots. Writers must be serialized by the caller.
+ * Growing keeps the previous slot arrays until the map is destroyed because readers may still be
+ * probing them, together they are smaller than the current one. Removing never shrinks the map.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class SeqLockHashMap
+{
+    static_assert(std::is_trivially_copyable_v<Key> && sizeof(Key) % sizeof(uint64) == 0, "Keys are stored as atomic 64 bit words");
+
+    static constexpr std::size_t KeyWords = sizeof(Key) / sizeof(uint64);
+    using KeyData = std::array<uint64, KeyWords>;
+
+public:
+    static constexpr std::size_t MinCapacity = 64;
+
+    SeqLockHashMap() : _sequence(0), _table(nullptr), _size(0)
+    {
+        _table.store(CreateTable(MinCapacity), std::memory_order_relaxed);
+    }
+
+    SeqLockHashMap(SeqLockHashMap const&) = delete;
+    SeqLockHashMap(SeqLockHashMap&&) = delete;
+    SeqLockHashMap& operator=(SeqLockHashMap const&) = delete;
+    SeqLockHashMap& operator=(SeqLockHashMap&&) = delete;
+
+    ~SeqLockHashMap() = default;
+
+    // Safe to call from any thread at any time
+    Value* Find(Key const& key) const
+    {
+        KeyData keyData = std::bit_cast<KeyData>(key);
+        std::size_t hash = Hash()(key);
+        for (;;)
+        {
+            uint64 sequence = _sequence.load(std::memory_order_acquire);
+            if (sequence & 1)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            Table const* table = _table.load(std::memory_order_acquire);
+            Value* value = nullptr;
+            for (std::size_t i = table->GetHome(hash), probes = 0; probes <= table->Mask; i = (i + 1) & table->Mask, ++probes)
+            {
+                Slot const& slot = table->Slots[i];
+                Value* slotValue = slot.Pointer.load(std::memory_order_relaxed);
+                if (!slotValue)
+                    break;
+
+                if (slot.HasKey(keyData))
+                {
+                    value = slotValue;
+                    break;
+                }
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_sequence.load(std::memory_order_relaxed) == sequence)
+                return value;
+        }
+    }
+
+    // Writers only, replaces the value of a key already present
+    void Insert(Key const& key, Value* value)
+    {
+        ASSERT(value);
+
+        KeyData keyData = std::bit_cast<KeyData>(key);
+        std::size_t hash = Hash()(key);
+
+        BeginWrite();
+        if ((_size + 1) * 2 > GetCapacity())
+            Grow();
+
+        Table* table = _table.load(std::memory_order_relaxed);
+        std::size_t i = table->GetHome(hash);
+        while (table->Slots[i].Pointer.load(std::memory_order_relaxed) && !table->Slots[i].HasKey(keyData))
+            i = (i + 1) & table->Mask;
+
+        Slot& slot = table->Slots[i];
+        if (!slot.Pointer.load(std::memory_order_relaxed))
+            ++_size;
+
+        slot.SetKey(keyData);
+        slot.Pointer.store(value, std::memory_order_relaxed);
+        EndWrite();
+    }
+
+    // Writers only
+    void Remove(Key const& key)
+    {
+        KeyData keyData = std::bit_cast<KeyData>(key);
+        Table* table = _table.load(std::memory_order_relaxed);
+        std::size_t i = table->GetHome(Hash()(key));
+        for (;;)
+        {
+            Value* slotValue = table->Slots[i].Pointer.load(std::memory_order_relaxed);
+            if (!slotValue)
+                return;
+
+            if (table->Slots[i].HasKey(keyData))
+                break;
+
+            i = (i + 1) & table->Mask;
+        }
+
+        BeginWrite();
+
+        // shift the following entries of the probe sequence back so that lookups never need tombstones
+        for (std::size_t j = (i + 1) & table->Mask; ; j = (j + 1) & table->Mask)
+        {
+            Slot& next = table->Slots[j];
+            Value* nextValue = next.Pointer.load(std::memory_order_relaxed);
+            if (!nextValue)
+                break;
+
+            std::size_t home = table->GetHome(Hash()(std::bit_cast<Key>(next.GetKey())));
+            if (((j - home) & table->Mask) < ((j - i) & table->Mask))
+                continue;
+
+            table->Slots[i].SetKey(next.GetKey());
+            table->Slots[i].Pointer.store(nextValue, std::memory_order_relaxed);
+            i = j;
+        }
+
+        table->Slots[i].Pointer.store(nullptr, std::memory_order_relaxed);
+        --_size;
+        EndWrite();
+    }
+
+    // Writers only
+    std::size_t GetSize() const { return _size; }
+    std::size_t GetCapacity() const { return _table.load(std::memory_order_relaxed)->Mask + 1; }
+
+private:
+    struct Slot
+    {
+        std::array<std::atomic<uint64>, KeyWords> Words = { };
+        std::atomic<Value*> Pointer = nullptr;
+
+        bool HasKey(KeyData const& key) const
+        {
+            for (std::size_t w = 0; w < KeyWords; ++w)
+                if (Words[w].load(std::memory_order_relaxed) != key[w])
+                    return false;
+            return true;
+        }
+
+        KeyData GetKey() const
+        {
+            KeyData key;
+            for (std::size_t w = 0; w < KeyWords; ++w)
+                key[w] = Words[w].load(std::memory_order_relaxed);
+            return key;
+        }
+
+        void SetKey(KeyData const& key)
+        {
+            for (std::size_t w = 0; w < KeyWords; ++w)
+                Words[w].store(key[w], std::memory_order_relaxed);
+        }
+    };
+
+    struct Table
+    {
+        std::unique_ptr<Slot[]> Slots;
+        std::size_t Mask = 0;
+        int32 Shift = 0;
+
+        // fibonacci hashing, the hashes of std::hash are often the keys themselves
+        std::size_t GetHome(std::size_t hash) const
+        {
+            return std::size_t((uint64(hash) * UI64LIT(0x9E3779B97F4A7C15)) >> Shift);
+        }
+    };
+
+    Table* CreateTable(std::size_t capacity)
+    {
+        std::unique_ptr<Table>& table = _tables.emplace_back(std::make_unique<Table>());
+        table->Slots = std::make_unique<Slot[]>(capacity);
+        table->Mask = capacity - 1;
+        table->Shift = 64 - std::countr_zero(capacity);
+        return table.get();
+    }
+
+    void Grow()
+    {
+        Table const* oldTable = _table.load(std::memory_order_relaxed);
+        Table* newTable = CreateTable((oldTable->Mask + 1) * 2);
+        for (std::size_t i = 0; i <= oldTable->Mask; ++i)
+        {
+            Slot const& slot = oldTable->Slots[i];
+            Value* value = slot.Pointer.load(std::memory_order_relaxed);
+            if (!value)
+                continue;
+
+            KeyData key = slot.GetKey();
+            std::size_t j = newTable->GetHome(Hash()(std::bit_cast<Key>(key)));
+            while (newTable->Slots[j].Pointer.load(std::memory_order_relaxed))
+                j = (j + 1) & newTable->Mask;
+
+            newTable->Slots[j].SetKey(key);
+            newTable->Slots[j].Pointer.store(value, std::memory_order_relaxed);
+        }
+
+        _table.store(newTable, std::memory_order_release);
+    }
+
+    void BeginWrite()
+    {
+        _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void EndWrite()
+    {
+        _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    alignas(64) std::atomic<uint64> _sequence;
+    std::atomic<Table*> _table;
+    std::size_t _size;
+    std::vector<std::unique_ptr<Table>> _tables;
+};
+}
+
+#endif // TRINITYCORE_SEQ_LOCK_HASH_MAP_H
@@ -0,0 +1,285 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_TIMER_WHEEL_H
+#define TRINITYCORE_TIMER_WHEEL_H
+
+#include "Define.h"
+#include <array>
+#include <bit>
+
+namespace Trinity::Containers
+{
+template<typename T>
+class TimerWheel;
+
+// Intrusive link of objects scheduled in a TimerWheel, unschedules itself when destroyed
+class TimerWheelNode
+{
+public:
+    TimerWheelNode() : _prev(nullptr), _next(nullptr), _expiry(0) { }
+    TimerWheelNode(TimerWheelNode const&) : TimerWheelNode() { }
+    TimerWheelNode& operator=(TimerWheelNode const&) { return *this; }
+    ~TimerWheelNode() { Unlink(); }
+
+    bool IsScheduled() const { return _next != nullptr; }
+    uint64 GetExpiry() const { return _expiry; }
+
+private:
+    template<typename T>
+    friend class TimerWheel;
+
+    void Unlink()
+    {
+        if (!_next)
+            return;
+
+        _prev->_next = _next;
+        _next->_prev = _prev;
+        _prev = nullptr;
+        _next = nullptr;
+    }
+
+    void LinkBefore(TimerWheelNode* head)
+    {
+        _next = head;
+        _prev = head->_prev;
+        _prev->_next = this;
+        head->_prev = this;
+    }
+
+    TimerWheelNode* _prev;
+    TimerWheelNode* _next;
+    uint64 _expiry;
+};
+
+/*
+ * Hierarchical timer wheel: scheduling and cancelling are O(1) and advancing only touches
+ * the entries that become due, plus an occasional cascade of a coarser slot into finer ones.
+ * Ticks whose finest slot is empty are skipped, except for the cascade points every SlotCount ticks.
+ * Time is in arbitrary integer ticks, T must derive from TimerWheelNode.
+ *
+ * Entries of the same tick expire in scheduling order.
+ */
+template<typename T>
+class TimerWheel
+{
+public:
+    static constexpr uint32 SlotBits = 6;
+    static constexpr uint32 SlotCount = 1 << SlotBits;
+    static constexpr uint32 LevelCount = 5;
+
+    explicit TimerWheel(uint64 now) : _now(now), _occupiedSlots(0)
+    {
+        InitList(_expired);
+        InitList(_overflow);
+        for (std::array<TimerWheelNode, SlotCount>& level : _slots)
+            for (TimerWheelNode& slot : level)
+                InitList(slot);
+    }
+
+    TimerWheel(TimerWheel const&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel const&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    ~TimerWheel()
+    {
+        Clear();
+    }
+
+    uint64 GetCurrentTick() const { return _now; }
+
+    // (re)schedules entry, expiry at or before the current tick makes it due immediately
+    void Schedule(T* entry, uint64 expiry)
+    {
+        TimerWheelNode* node = entry;
+        node->Unlink();
+        node->_expiry = expiry;
+        Place(node);
+    }
+
+    void Cancel(T* entry)
+    {
+        static_cast<TimerWheelNode*>(entry)->Unlink();
+    }
+
+    // Unschedules and returns one entry due at now, nullptr when all due entries were taken
+    T* PopExpired(uint64 now)
+    {
+        while (IsEmptyList(_expired))
+        {
+            if (_now >= now)
+                return nullptr;
+
+            Advance(now);
+        }
+
+        TimerWheelNode* node = _expired._next;
+        node->Unlink();
+        return static_cast<T*>(node);
+    }
+
+    // Moves to now without looking at any slot, only valid while nothing is scheduled
+    void SkipTo(uint64 now)
+    {
+        if (now > _now)
+            _now = now;
+    }
+
+    // Visits every scheduled entry in no particular order, visitor must not schedule or cancel entries
+    template<typename Visitor>
+    void ForEach(Visitor&& visitor) const
+    {
+        VisitList(_expired, visitor);
+        for (std::array<TimerWheelNode, SlotCount> const& level : _slots)
+            for (TimerWheelNode const& slot : level)
+                VisitList(slot, visitor);
+        VisitList(_overflow, visitor);
+    }
+
+    // unschedules everything without touching the entries themselves
+    void Clear()
+    {
+        ClearList(_expired);
+        ClearList(_overflow);
+        for (std::array<TimerWheelNode, SlotCount>& level : _slots)
+            for (TimerWheelNode& slot : level)
+                ClearList(slot);
+        _occupiedSlots = 0;
+    }
+
+private:
+    static constexpr uint64 SlotMask = SlotCount - 1;
+
+    static constexpr uint32 LevelShift(uint32 level) { return SlotBits * level; }
+
+    static void InitList(TimerWheelNode& head)
+    {
+        head._prev = &head;
+        head._next = &head;
+    }
+
+    static bool IsEmptyList(TimerWheelNode const& head) { return head._next == &head; }
+
+    template<typename Visitor>
+    static void VisitList(TimerWheelNode const& head, Visitor& visitor)
+    {
+        for (TimerWheelNode* node = head._next; node != &head; node = node->_next)
+            visitor(static_cast<T*>(node));
+    }
+
+    static void ClearList(TimerWheelNode& head)
+    {
+        while (!IsEmptyList(head))
+            head._next->Unlink();
+    }
+
+    void Place(TimerWheelNode* node)
+    {
+        if (node->_expiry <= _now)
+        {
+            node->LinkBefore(&_expired);
+            return;
+        }
+
+        uint64 delta = node->_expiry - _now;
+        for (uint32 level = 0; level < LevelCount; ++level)
+        {
+            if (delta < (uint64(1) << LevelShift(level + 1)))
+            {
+                uint64 slot = (node->_expiry >> LevelShift(level)) & SlotMask;
+                node->LinkBefore(&_slots[level][slot]);
+                if (!level)
+                    _occupiedSlots |= uint64(1) << slot;
+                return;
+            }
+        }
+
+        node->LinkBefore(&_overflow);
+    }
+
+    // re-place every entry of a list, they all end up in finer slots (or expired)
+    void Cascade(TimerWheelNode& head)
+    {
+        TimerWheelNode pending;
+        InitList(pending);
+        if (!IsEmptyList(head))
+        {
+            pending._next = head._next;
+            pending._prev = head._prev;
+            pending._next->_prev = &pending;
+            pending._prev->_next = &pending;
+            InitList(head);
+        }
+
+        while (!IsEmptyList(pending))
+        {
+            TimerWheelNode* node = pending._next;
+            node->Unlink();
+            Place(node);
+        }
+    }
+
+    // Next tick holding entries in the finest level or cascading coarser ones. Bits of slots emptied by
+    // cancelled entries are only cleared once the slot is reached, such ticks are visited for nothing
+    uint64 GetNextTick() const
+    {
+        uint64 rotationEnd = (_now | SlotMask) + 1;
+        uint64 pending = _occupiedSlots & ~((uint64(2) << (_now & SlotMask)) - 1);
+        if (pending)
+            return (_now & ~SlotMask) + std::countr_zero(pending);
+
+        return rotationEnd;
+    }
+
+    // processes the next tick holding entries, or moves to limit if there is none until then
+    void Advance(uint64 limit)
+    {
+        uint64 next = GetNextTick();
+        if (next > limit)
+        {
+            _now = limit;
+            return;
+        }
+
+        _now = next;
+
+        // coarsest level first, cascaded entries must not land in a finer slot already processed for this tick
+        uint32 wrapped = 0;
+        while (wrapped + 1 < LevelCount && !(_now & ((uint64(1) << LevelShift(wrapped + 1)) - 1)))
+            ++wrapped;
+
+        if (wrapped + 1 == LevelCount && !(_now & ((uint64(1) << LevelShift(LevelCount)) - 1)))
+            Cascade(_overflow);
+
+        for (uint32 level = wrapped; level > 0; --level)
+            Cascade(_slots[level][(_now >> LevelShift(level)) & SlotMask]);
+
+        Cascade(_slots[0][_now & SlotMask]);
+        _occupiedSlots &= ~(uint64(1) << (_now & SlotMask));
+    }
+
+    uint64 _now;
+    TimerWheelNode _expired;
+    TimerWheelNode _overflow;
+    std::array<std::array<TimerWheelNode, SlotCount>, LevelCount> _slots;
+    uint64 _occupiedSlots;      ///< finest level slots that may hold entries
+};
+}
+
+#endif // TRINITYCORE_TIMER_WHEEL_H
@@ -17,6 +17,8 @@
 
 #include "AES.h"
 #include "Errors.h"
+#include <openssl/core_names.h>
+#include <openssl/params.h>
 #include <limits>
 
 Trinity::Crypto::AES::AES(bool encrypting, size_t keySizeBits /*= 128*/) : _ctx(EVP_CIPHER_CTX_new()), _encrypting(encrypting)
@@ -73,7 +75,9 @@ bool Trinity::Crypto::AES::Process(IV const& iv, uint8* data, size_t length, Tag
 
     len -= outLen;
 
-    if (!_encrypting && !EVP_CIPHER_CTX_ctrl(_ctx, EVP_CTRL_GCM_SET_TAG, sizeof(tag), tag))
+    // tags are passed as params directly, EVP_CIPHER_CTX_ctrl translates to them with much more overhead than the encryption of a small packet
+    OSSL_PARAM tagParams[2] = { OSSL_PARAM_construct_octet_string(OSSL_CIPHER_PARAM_AEAD_TAG, tag, sizeof(tag)), OSSL_PARAM_construct_end() };
+    if (!_encrypting && !EVP_CIPHER_CTX_set_params(_ctx, tagParams))
         return false;
 
     if (!EVP_CipherFinal_ex(_ctx, data + outLen, &outLen))
@@ -81,12 +85,21 @@ bool Trinity::Crypto::AES::Process(IV const& iv, uint8* data, size_t length, Tag
 
     ASSERT(len == outLen);
 
-    if (_encrypting && !EVP_CIPHER_CTX_ctrl(_ctx, EVP_CTRL_GCM_GET_TAG, sizeof(tag), tag))
+    if (_encrypting && !EVP_CIPHER_CTX_get_params(_ctx, tagParams))
         return false;
 
     return true;
 }
 
+bool Trinity::Crypto::AES::ProcessBatch(std::span<BatchEntry const> entries)
+{
+    for (BatchEntry const& entry : entries)
+        if (!Process(entry.Iv, entry.Data, entry.Length, *entry.TagData))
+            return false;
+
+    return true;
+}
+
 bool Trinity::Crypto::AES::ProcessNoIntegrityCheck(IV const& iv, uint8* data, size_t partialLength)
 {
     ASSERT(!_encrypting, "Partial encryption is not allowed");
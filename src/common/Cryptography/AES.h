@@ -36,6 +36,15 @@ namespace Trinity::Crypto
         using Key = std::array<uint8, KEY_SIZE_BYTES>;
         using Tag = uint8[TAG_SIZE_BYTES];
 
+        /// One message of ProcessBatch, its tag is written when encrypting and checked when decrypting
+        struct BatchEntry
+        {
+            IV Iv;
+            uint8* Data;
+            size_t Length;
+            Tag* TagData;
+        };
+
         AES(bool encrypting, size_t keySizeBits = 128);
         AES(AES const&) = delete;
         AES(AES&&) = delete;
@@ -47,6 +56,8 @@ namespace Trinity::Crypto
         void Init(std::span<uint8 const> key);
 
         bool Process(IV const& iv, uint8* data, size_t length, Tag& tag);
+        /// Processes the messages in order, stops at the first one that fails
+        bool ProcessBatch(std::span<BatchEntry const> entries);
         bool ProcessNoIntegrityCheck(IV const& iv, uint8* data, size_t partialLength);
 
     private:
@@ -82,3 +82,21 @@ bool WorldPacketCrypt::EncryptSend(uint8* data, size_t length, Trinity::Crypto::
     ++_serverCounter;
     return true;
 }
+
+void WorldPacketCrypt::AddToSendBatch(uint8* data, size_t length, Trinity::Crypto::AES::Tag* tag)
+{
+    if (_initialized)
+        _sendBatch.push_back({ .Iv = WorldPacketCryptIV(_serverCounter, 0x52565253).Value, .Data = data, .Length = length, .TagData = tag });
+    else
+        memset(*tag, 0, sizeof(*tag));
+
+    ++_serverCounter;
+}
+
+bool WorldPacketCrypt::EncryptSendBatch()
+{
+    // the vector keeps its capacity, a socket stops allocating once it sent its largest batch
+    bool result = _serverEncrypt.ProcessBatch(_sendBatch);
+    _sendBatch.clear();
+    return result;
+}
@@ -19,6 +19,7 @@
 #define _WORLDPACKETCRYPT_H
 
 #include "AES.h"
+#include <vector>
 
 class TC_COMMON_API WorldPacketCrypt
 {
@@ -32,6 +33,11 @@ public:
     bool DecryptRecv(uint8* data, size_t length, Trinity::Crypto::AES::Tag& tag);
     bool EncryptSend(uint8* data, size_t length, Trinity::Crypto::AES::Tag& tag);
 
+    /// Packets added to the send batch get their counters right away and are encrypted together by EncryptSendBatch,
+    /// their data and tags must stay where they are until then
+    void AddToSendBatch(uint8* data, size_t length, Trinity::Crypto::AES::Tag* tag);
+    bool EncryptSendBatch();
+
     bool IsInitialized() const { return _initialized; }
 
 protected:
@@ -40,6 +46,7 @@ protected:
     uint64 _clientCounter;
     uint64 _serverCounter;
     bool _initialized;
+    std::vector<Trinity::Crypto::AES::BatchEntry> _sendBatch;
 };
 
 #endif // _WORLDPACKETCRYPT_H
@@ -37,6 +37,22 @@ namespace Trinity::Impl
 
         static EVP_MD_CTX* MakeCTX() noexcept { return EVP_MD_CTX_new(); }
         static void DestroyCTX(EVP_MD_CTX* ctx) { EVP_MD_CTX_free(ctx); }
+
+        // EVP_sha1() and friends are looked up in the provider again on every init, this resolves them once
+        struct Algorithm
+        {
+            explicit Algorithm(EVP_MD const* md) : Md(EVP_MD_fetch(nullptr, EVP_MD_get0_name(md), nullptr))
+            {
+                ASSERT(Md);
+            }
+
+            ~Algorithm() { EVP_MD_free(Md); }
+
+            Algorithm(Algorithm const&) = delete;
+            Algorithm& operator=(Algorithm const&) = delete;
+
+            EVP_MD* Md;
+        };
     };
 
     template <GenericHashImpl::HashCreator HashCreator, size_t DigestLength>
@@ -65,7 +81,7 @@ namespace Trinity::Impl
 
             GenericHash() : _ctx(GenericHashImpl::MakeCTX())
             {
-                int result = EVP_DigestInit_ex(_ctx, HashCreator(), nullptr);
+                int result = EVP_DigestInit_ex(_ctx, GetAlgorithm(), nullptr);
                 ASSERT(result == 1);
             }
 
@@ -130,6 +146,12 @@ namespace Trinity::Impl
             Digest const& GetDigest() const { return _digest; }
 
         private:
+            static EVP_MD const* GetAlgorithm()
+            {
+                static GenericHashImpl::Algorithm const algorithm(HashCreator());
+                return algorithm.Md;
+            }
+
             EVP_MD_CTX* _ctx;
             Digest _digest = { };
     };
@@ -25,11 +25,44 @@
 #include <array>
 #include <string>
 #include <string_view>
+#include <openssl/core_names.h>
 
 class BigNumber;
 
 namespace Trinity::Impl
 {
+    struct GenericHMACImpl
+    {
+        // Fetching the algorithm and resolving the digest by name is the expensive part of setting up a MAC,
+        // every instance duplicates a context prepared once per hash and only sets its key
+        struct Prototype
+        {
+            explicit Prototype(EVP_MD const* md)
+            {
+                EVP_MAC* mac = EVP_MAC_fetch(nullptr, OSSL_MAC_NAME_HMAC, nullptr);
+                ASSERT(mac);
+                Ctx = EVP_MAC_CTX_new(mac);
+                EVP_MAC_free(mac);  // context holds its own reference
+                ASSERT(Ctx);
+
+                OSSL_PARAM params[] =
+                {
+                    OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>(EVP_MD_get0_name(md)), 0),
+                    OSSL_PARAM_construct_end()
+                };
+                int result = EVP_MAC_CTX_set_params(Ctx, params);
+                ASSERT(result == 1);
+            }
+
+            ~Prototype() { EVP_MAC_CTX_free(Ctx); }
+
+            Prototype(Prototype const&) = delete;
+            Prototype& operator=(Prototype const&) = delete;
+
+            EVP_MAC_CTX* Ctx;
+        };
+    };
+
     template <GenericHashImpl::HashCreator HashCreator, size_t DigestLength>
     class GenericHMAC
     {
@@ -55,30 +88,28 @@ namespace Trinity::Impl
                 return hash.GetDigest();
             }
 
-            GenericHMAC(uint8 const* seed, size_t len) : _ctx(GenericHashImpl::MakeCTX()), _key(EVP_PKEY_new_mac_key(EVP_PKEY_HMAC, nullptr, seed, len))
+            GenericHMAC(uint8 const* seed, size_t len) : _ctx(EVP_MAC_CTX_dup(GetPrototype()))
             {
-                int result = EVP_DigestSignInit(_ctx, nullptr, HashCreator(), nullptr, _key);
+                ASSERT(_ctx);
+                int result = EVP_MAC_init(_ctx, seed, len, nullptr);
                 ASSERT(result == 1);
             }
             template <typename Container>
             GenericHMAC(Container const& container) : GenericHMAC(std::data(container), std::size(container)) {}
 
-            GenericHMAC(GenericHMAC const& right) : _ctx(GenericHashImpl::MakeCTX())
+            GenericHMAC(GenericHMAC const& right) : _ctx(EVP_MAC_CTX_dup(right._ctx)), _digest(right._digest)
             {
-                *this = right;
+                ASSERT(_ctx);
             }
 
-            GenericHMAC(GenericHMAC&& right) noexcept
+            GenericHMAC(GenericHMAC&& right) noexcept : _ctx(std::exchange(right._ctx, nullptr)), _digest(std::exchange(right._digest, Digest{}))
             {
-                *this = std::move(right);
             }
 
             ~GenericHMAC()
             {
-                GenericHashImpl::DestroyCTX(_ctx);
+                EVP_MAC_CTX_free(_ctx);
                 _ctx = nullptr;
-                EVP_PKEY_free(_key);
-                _key = nullptr;
             }
 
             GenericHMAC& operator=(GenericHMAC const& right)
@@ -86,10 +117,9 @@ namespace Trinity::Impl
                 if (this == &right)
                     return *this;
 
-                int result = EVP_MD_CTX_copy_ex(_ctx, right._ctx);
-                ASSERT(result == 1);
-                _key = right._key;      // EVP_PKEY uses reference counting internally, just copy the pointer
-                EVP_PKEY_up_ref(_key);  // Bump reference count for PKEY, as every instance of this class holds two references to PKEY and destructor decrements it twice
+                EVP_MAC_CTX* ctx = EVP_MAC_CTX_dup(right._ctx);
+                ASSERT(ctx);
+                EVP_MAC_CTX_free(std::exchange(_ctx, ctx));
                 _digest = right._digest;
                 return *this;
             }
@@ -99,15 +129,14 @@ namespace Trinity::Impl
                 if (this == &right)
                     return *this;
 
-                _ctx = std::exchange(right._ctx, GenericHashImpl::MakeCTX());
-                _key = std::exchange(right._key, EVP_PKEY_new());
+                std::swap(_ctx, right._ctx);
                 _digest = std::exchange(right._digest, Digest{});
                 return *this;
             }
 
             void UpdateData(uint8 const* data, size_t len)
             {
-                int result = EVP_DigestSignUpdate(_ctx, data, len);
+                int result = EVP_MAC_update(_ctx, data, len);
                 ASSERT(result == 1);
             }
             void UpdateData(std::string_view str) { UpdateData(reinterpret_cast<uint8 const*>(str.data()), str.size()); }
@@ -118,16 +147,21 @@ namespace Trinity::Impl
 
             void Finalize()
             {
-                size_t length = DIGEST_LENGTH;
-                int result = EVP_DigestSignFinal(_ctx, _digest.data(), &length);
+                size_t length = 0;
+                int result = EVP_MAC_final(_ctx, _digest.data(), &length, DIGEST_LENGTH);
                 ASSERT(result == 1);
                 ASSERT(length == DIGEST_LENGTH);
             }
 
             Digest const& GetDigest() const { return _digest; }
         private:
-            EVP_MD_CTX* _ctx;
-            EVP_PKEY* _key;
+            static EVP_MAC_CTX const* GetPrototype()
+            {
+                static GenericHMACImpl::Prototype const prototype(HashCreator());
+                return prototype.Ctx;
+            }
+
+            EVP_MAC_CTX* _ctx;
             Digest _digest = { };
     };
 }
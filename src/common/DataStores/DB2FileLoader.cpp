@@ -175,6 +175,7 @@ public:
     virtual bool LoadCatalogData(DB2FileSource* source, uint32 section) = 0;
     virtual void SetAdditionalData(std::vector<uint32> idTable, std::vector<DB2RecordCopy> copyTable, std::vector<std::vector<DB2IndexData>> parentIndexes) = 0;
     virtual char* AutoProduceData(uint32& indexTableSize, char**& indexTable) = 0;
+    virtual bool AutoProduceDataInPlace(uint8* /*fileData*/, uint32& /*indexTableSize*/, char**& /*indexTable*/, char*& /*dataTable*/) { return false; }
     virtual char* AutoProduceStrings(char** indexTable, uint32 indexTableSize, uint32 locale) = 0;
     virtual void AutoProduceRecordCopies(uint32 records, char** indexTable, char* dataTable) = 0;
     virtual DB2Record GetRecord(uint32 recordNumber) const = 0;
@@ -220,6 +221,7 @@ public:
     bool LoadCatalogData(DB2FileSource* /*source*/, uint32 /*section*/) override { return true; }
     void SetAdditionalData(std::vector<uint32> idTable, std::vector<DB2RecordCopy> copyTable, std::vector<std::vector<DB2IndexData>> parentIndexes) override;
     char* AutoProduceData(uint32& indexTableSize, char**& indexTable) override;
+    bool AutoProduceDataInPlace(uint8* fileData, uint32& indexTableSize, char**& indexTable, char*& dataTable) override;
     char* AutoProduceStrings(char** indexTable, uint32 indexTableSize, uint32 locale) override;
     void AutoProduceRecordCopies(uint32 records, char** indexTable, char* dataTable) override;
     DB2Record GetRecord(uint32 recordNumber) const override;
@@ -232,6 +234,7 @@ public:
     DB2SectionHeader& GetSection(uint32 section) const override;
 
 private:
+    bool IsStoredAsStructure(uint8 const* fileData) const;
     void FillParentLookup(char* dataTable);
     uint32 GetRecordSection(uint32 recordNumber) const;
     unsigned char const* GetRawRecordData(uint32 recordNumber, uint32 const* section) const override;
@@ -610,6 +613,114 @@ char* DB2FileLoaderRegularImpl::AutoProduceStrings(char** indexTable, uint32 ind
     return stringPool;
 }
 
+bool DB2FileLoaderRegularImpl::IsStoredAsStructure(uint8 const* fileData) const
+{
+    DB2Meta const* meta = _loadInfo->Meta;
+    if (!meta->HasIndexFieldInData() || !_parentIndexes.empty() || !_columnMeta || _loadInfo->GetStringFieldCount(false))
+        return false;
+
+    if (_header->FieldCount != meta->FieldCount || _header->RecordSize != meta->GetRecordSize())
+        return false;
+
+    // every field must be uncompressed and start right where the previous one ended
+    uint32 offset = 0;
+    uint32 alignment = 1;
+    uint32 fieldIndex = 0;
+    for (uint32 x = 0; x < _header->FieldCount; ++x)
+    {
+        if (_columnMeta[x].CompressionType != DB2ColumnCompression::None || _columnMeta[x].BitOffset != offset * 8)
+            return false;
+
+        uint32 fieldSize = 0;
+        switch (_loadInfo->Fields[fieldIndex].Type)
+        {
+            case FT_BYTE:
+                fieldSize = 1;
+                break;
+            case FT_SHORT:
+                fieldSize = 2;
+                break;
+            case FT_INT:
+            case FT_FLOAT:
+                fieldSize = 4;
+                break;
+            case FT_LONG:
+                fieldSize = 8;
+                break;
+            default:
+                return false;
+        }
+
+        alignment = std::max(alignment, fieldSize);
+        offset += fieldSize * meta->Fields[x].ArraySize;
+        fieldIndex += meta->Fields[x].ArraySize;
+    }
+
+    if (offset != _header->RecordSize || _header->RecordSize % alignment)
+        return false;
+
+    for (uint32 section = 0; section < _header->SectionCount; ++section)
+        if (reinterpret_cast<uintptr_t>(fileData + GetSection(section).FileOffset) % alignment)
+            return false;
+
+    return true;
+}
+
+bool DB2FileLoaderRegularImpl::AutoProduceDataInPlace(uint8* fileData, uint32& indexTableSize, char**& indexTable, char*& dataTable)
+{
+    if (!IsStoredAsStructure(fileData))
+        return false;
+
+    uint32 maxi = GetMaxId() + 1;
+
+    using index_entry_t = char*;
+
+    indexTableSize = maxi;
+    indexTable = new index_entry_t[maxi];
+    memset(indexTable, 0, maxi * sizeof(index_entry_t));
+
+    uint32 recordIndex = 0;
+    for (uint32 section = 0; section < _header->SectionCount; ++section)
+    {
+        DB2SectionHeader const& sectionHeader = GetSection(section);
+        if (!IsKnownTactId(sectionHeader.TactId))
+        {
+            recordIndex += sectionHeader.RecordCount;
+            continue;
+        }
+
+        uint8* records = fileData + sectionHeader.FileOffset;
+        for (uint32 sr = 0; sr < sectionHeader.RecordCount; ++sr, ++recordIndex)
+        {
+            uint8* record = records + sr * _header->RecordSize;
+            indexTable[RecordGetId(record, recordIndex)] = reinterpret_cast<char*>(record);
+        }
+    }
+
+    // copies get their own id written into them, they cannot point into the file
+    dataTable = nullptr;
+    if (uint32 recordCopies = GetRecordCopyCount())
+    {
+        uint32 recordsize = _loadInfo->Meta->GetRecordSize();
+        uint32 idFieldOffset = GetFieldOffset(_loadInfo->Meta->GetIndexField());
+        uint32 offset = 0;
+        dataTable = new char[recordCopies * recordsize];
+        for (uint32 c = 0; c < recordCopies; ++c)
+        {
+            DB2RecordCopy copy = GetRecordCopy(c);
+            if (copy.SourceRowId && copy.SourceRowId < maxi && copy.NewRowId < maxi && indexTable[copy.SourceRowId])
+            {
+                memcpy(&dataTable[offset], indexTable[copy.SourceRowId], recordsize);
+                *reinterpret_cast<uint32*>(&dataTable[offset + idFieldOffset]) = copy.NewRowId;
+                indexTable[copy.NewRowId] = &dataTable[offset];
+                offset += recordsize;
+            }
+        }
+    }
+
+    return true;
+}
+
 void DB2FileLoaderRegularImpl::AutoProduceRecordCopies(uint32 records, char** indexTable, char* dataTable)
 {
     uint32 recordCopies = GetRecordCopyCount();
@@ -2030,6 +2141,11 @@ char* DB2FileLoader::AutoProduceData(uint32& indexTableSize, char**& indexTable)
     return _impl->AutoProduceData(indexTableSize, indexTable);
 }
 
+bool DB2FileLoader::AutoProduceDataInPlace(uint8* fileData, uint32& indexTableSize, char**& indexTable, char*& dataTable)
+{
+    return _impl->AutoProduceDataInPlace(fileData, indexTableSize, indexTable, dataTable);
+}
+
 char* DB2FileLoader::AutoProduceStrings(char** indexTable, uint32 indexTableSize, LocaleConstant locale)
 {
     return _impl->AutoProduceStrings(indexTable, indexTableSize, locale);
@@ -124,6 +124,9 @@ struct TC_COMMON_API DB2FileSource
     virtual char const* GetFileName() const = 0;
 
     virtual DB2EncryptedSectionHandling HandleEncryptedSection(DB2SectionHeader const& sectionHeader) const = 0;
+
+    // Returns the whole file when the source keeps it in memory, records can then be used without copying them
+    virtual uint8* GetMappedData() { return nullptr; }
 };
 
 class TC_COMMON_API DB2Record
@@ -200,6 +203,9 @@ public:
     void LoadHeaders(DB2FileSource* source, DB2FileLoadInfo const* loadInfo);
     void Load(DB2FileSource* source, DB2FileLoadInfo const* loadInfo);
     char* AutoProduceData(uint32& indexTableSize, char**& indexTable);
+    // Points indexTable into fileData when records are stored exactly like their structure, returns false otherwise.
+    // Only record copies are allocated (dataTable), strings and the parent lookup must not be needed
+    bool AutoProduceDataInPlace(uint8* fileData, uint32& indexTableSize, char**& indexTable, char*& dataTable);
     char* AutoProduceStrings(char** indexTable, uint32 indexTableSize, LocaleConstant locale);
     void AutoProduceRecordCopies(uint32 records, char** indexTable, char* dataTable);
 
@@ -0,0 +1,91 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DB2MappedFileSource.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
+
+DB2MappedFileSource::DB2MappedFileSource(std::string const& fileName) : _fileName(fileName), _position(0)
+{
+    try
+    {
+        // copy on write, a few stores are patched after loading and those pages must stay private
+        boost::interprocess::file_mapping file(_fileName.c_str(), boost::interprocess::read_only);
+        _region = std::make_unique<boost::interprocess::mapped_region>(file, boost::interprocess::copy_on_write);
+    }
+    catch (boost::interprocess::interprocess_exception const& /*e*/)
+    {
+        _region = nullptr;
+    }
+}
+
+DB2MappedFileSource::~DB2MappedFileSource() = default;
+
+bool DB2MappedFileSource::IsOpen() const
+{
+    return _region != nullptr;
+}
+
+bool DB2MappedFileSource::Read(void* buffer, std::size_t numBytes)
+{
+    if (numBytes > _region->get_size() - _position)
+        return false;
+
+    memcpy(buffer, static_cast<uint8 const*>(_region->get_address()) + _position, numBytes);
+    _position += numBytes;
+    return true;
+}
+
+int64 DB2MappedFileSource::GetPosition() const
+{
+    return _position;
+}
+
+bool DB2MappedFileSource::SetPosition(int64 position)
+{
+    if (position < 0 || std::size_t(position) > _region->get_size())
+        return false;
+
+    _position = position;
+    return true;
+}
+
+int64 DB2MappedFileSource::GetFileSize() const
+{
+    return _region ? _region->get_size() : 0;
+}
+
+char const* DB2MappedFileSource::GetFileName() const
+{
+    return _fileName.c_str();
+}
+
+DB2EncryptedSectionHandling DB2MappedFileSource::HandleEncryptedSection(DB2SectionHeader const& /*sectionHeader*/) const
+{
+    return DB2EncryptedSectionHandling::Skip;
+}
+
+uint8* DB2MappedFileSource::GetMappedData()
+{
+    return _region ? static_cast<uint8*>(_region->get_address()) : nullptr;
+}
+
+std::unique_ptr<boost::interprocess::mapped_region> DB2MappedFileSource::ReleaseMapping()
+{
+    return std::move(_region);
+}
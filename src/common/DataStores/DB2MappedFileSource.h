@@ -0,0 +1,57 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DB2MappedFileSource_h__
+#define DB2MappedFileSource_h__
+
+#include "DB2FileLoader.h"
+#include <memory>
+#include <string>
+
+namespace boost::interprocess
+{
+class mapped_region;
+}
+
+// Maps the whole file copy on write, records of stores laid out exactly like their structures are used in place
+struct TC_COMMON_API DB2MappedFileSource : public DB2FileSource
+{
+    DB2MappedFileSource(std::string const& fileName);
+    DB2MappedFileSource(DB2MappedFileSource const& other) = delete;
+    DB2MappedFileSource(DB2MappedFileSource&& other) noexcept = delete;
+    DB2MappedFileSource& operator=(DB2MappedFileSource const& other) = delete;
+    DB2MappedFileSource& operator=(DB2MappedFileSource&& other) noexcept = delete;
+    ~DB2MappedFileSource();
+    bool IsOpen() const override;
+    bool Read(void* buffer, std::size_t numBytes) override;
+    int64 GetPosition() const override;
+    bool SetPosition(int64 position) override;
+    int64 GetFileSize() const override;
+    char const* GetFileName() const override;
+    DB2EncryptedSectionHandling HandleEncryptedSection(DB2SectionHeader const& sectionHeader) const override;
+    uint8* GetMappedData() override;
+
+    // Hands the mapping over to whoever keeps records pointing into it, the source is closed afterwards
+    std::unique_ptr<boost::interprocess::mapped_region> ReleaseMapping();
+
+private:
+    std::string _fileName;
+    std::unique_ptr<boost::interprocess::mapped_region> _region;
+    std::size_t _position;
+};
+
+#endif // DB2MappedFileSource_h__
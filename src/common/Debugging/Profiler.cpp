@@ -0,0 +1,254 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Profiler.h"
+#include "Log.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <cstdio>
+#include <unordered_map>
+
+namespace Trinity::Impl
+{
+struct ProfilerThreadZones
+{
+    struct Zone
+    {
+        char const* Name;
+        TimePoint Start;
+        TimePoint End;
+    };
+
+    // about 24 MB per thread, further zones of the capture are dropped
+    static constexpr std::size_t MaxZones = 1'000'000;
+
+    explicit ProfilerThreadZones(uint32 index) : Index(index), Dropped(0) { }
+
+    std::mutex Lock;
+    std::vector<Zone> Zones;
+    uint32 Index;
+    uint64 Dropped;
+
+    // only used by the owning thread
+    std::unordered_map<char const*, ProfilerZoneStats> Stats;
+};
+}
+
+namespace
+{
+thread_local std::shared_ptr<Trinity::Impl::ProfilerThreadZones> ThreadZones;
+
+void AppendJsonString(std::string& out, std::string_view value)
+{
+    out += '"';
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    out += '"';
+}
+}
+
+namespace Trinity
+{
+Profiler::Profiler() : _capturing(false), _zoneStatsEnabled(false), _stopRequested(false)
+{
+}
+
+Profiler::~Profiler()
+{
+    Stop();
+}
+
+Profiler* Profiler::instance()
+{
+    static Profiler instance;
+    return &instance;
+}
+
+bool Profiler::StartCapture(Seconds duration, std::string path)
+{
+    std::unique_lock lock(_captureLock);
+    if (_capturing)
+        return false;
+
+    // the previous capture finished writing its trace
+    if (_captureThread.joinable())
+    {
+        lock.unlock();
+        _captureThread.join();
+        lock.lock();
+    }
+
+    {
+        std::scoped_lock threadsLock(_threadsLock);
+        for (std::shared_ptr<Impl::ProfilerThreadZones> const& thread : _threads)
+        {
+            std::scoped_lock zonesLock(thread->Lock);
+            thread->Zones.clear();
+            thread->Dropped = 0;
+        }
+    }
+
+    _stopRequested = false;
+    _captureStart = std::chrono::steady_clock::now();
+    _capturing = true;
+    _captureThread = std::thread(&Profiler::RunCapture, this, duration, std::move(path));
+    return true;
+}
+
+void Profiler::Stop()
+{
+    {
+        std::scoped_lock lock(_captureLock);
+        _stopRequested = true;
+    }
+
+    _captureStopped.notify_all();
+    if (_captureThread.joinable())
+        _captureThread.join();
+}
+
+void Profiler::RecordZone(char const* name, TimePoint start, TimePoint end)
+{
+    if (!ThreadZones)
+    {
+        std::scoped_lock lock(_threadsLock);
+        ThreadZones = std::make_shared<Impl::ProfilerThreadZones>(uint32(_threads.size()));
+        _threads.push_back(ThreadZones);
+    }
+
+    if (_zoneStatsEnabled.load(std::memory_order_relaxed))
+    {
+        ProfilerZoneStats& stats = ThreadZones->Stats.try_emplace(name, ProfilerZoneStats{ .Name = name, .Count = 0, .Total = {} }).first->second;
+        ++stats.Count;
+        stats.Total += end - start;
+    }
+
+    // zones started before the capture are not part of it
+    if (!IsCapturing() || start < _captureStart)
+        return;
+
+    std::scoped_lock lock(ThreadZones->Lock);
+    if (ThreadZones->Zones.size() < Impl::ProfilerThreadZones::MaxZones)
+        ThreadZones->Zones.push_back({ .Name = name, .Start = start, .End = end });
+    else
+        ++ThreadZones->Dropped;
+}
+
+std::vector<ProfilerZoneStats> Profiler::TakeThreadZoneStats()
+{
+    std::vector<ProfilerZoneStats> stats;
+    if (!ThreadZones)
+        return stats;
+
+    stats.reserve(ThreadZones->Stats.size());
+    for (auto const& [_, zone] : ThreadZones->Stats)
+        stats.push_back(zone);
+
+    ThreadZones->Stats.clear();
+    std::ranges::sort(stats, std::ranges::greater(), &ProfilerZoneStats::Total);
+    return stats;
+}
+
+void Profiler::AddThreadZoneStats(std::vector<ProfilerZoneStats> const& stats)
+{
+    if (!ThreadZones)
+        return;
+
+    for (ProfilerZoneStats const& zone : stats)
+    {
+        ProfilerZoneStats& threadStats = ThreadZones->Stats.try_emplace(zone.Name, ProfilerZoneStats{ .Name = zone.Name, .Count = 0, .Total = {} }).first->second;
+        threadStats.Count += zone.Count;
+        threadStats.Total += zone.Total;
+    }
+}
+
+void Profiler::RunCapture(Seconds duration, std::string path)
+{
+    {
+        std::unique_lock lock(_captureLock);
+        _captureStopped.wait_for(lock, duration, [this] { return _stopRequested; });
+    }
+
+    _capturing = false;
+    WriteTrace(path);
+}
+
+void Profiler::WriteTrace(std::string const& path)
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        TC_LOG_ERROR("server.profiler", "Profile could not be written to {}", path);
+        return;
+    }
+
+    std::vector<std::shared_ptr<Impl::ProfilerThreadZones>> threads;
+    {
+        std::scoped_lock lock(_threadsLock);
+        threads = _threads;
+    }
+
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    std::size_t zoneCount = 0;
+    uint64 dropped = 0;
+    bool first = true;
+    for (std::shared_ptr<Impl::ProfilerThreadZones> const& thread : threads)
+    {
+        std::scoped_lock lock(thread->Lock);
+        dropped += thread->Dropped;
+        for (Impl::ProfilerThreadZones::Zone const& zone : thread->Zones)
+        {
+            if (!first)
+                out += ',';
+
+            out += "{\"ph\":\"X\",\"pid\":1,\"tid\":";
+            out += std::to_string(thread->Index);
+            out += ",\"name\":";
+            AppendJsonString(out, zone.Name);
+            Trinity::StringFormatTo(std::back_inserter(out), ",\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                std::chrono::duration<double, std::micro>(zone.Start - _captureStart).count(),
+                std::chrono::duration<double, std::micro>(zone.End - zone.Start).count());
+
+            first = false;
+
+            // keeps memory bounded for long captures
+            if (out.size() > 1 << 20)
+            {
+                fwrite(out.data(), 1, out.size(), file);
+                out.clear();
+            }
+        }
+
+        zoneCount += thread->Zones.size();
+        thread->Zones.clear();
+        thread->Zones.shrink_to_fit();
+    }
+
+    out += "]}\n";
+    fwrite(out.data(), 1, out.size(), file);
+    fclose(file);
+
+    if (dropped)
+        TC_LOG_WARN("server.profiler", "Profile: {} zones were dropped, threads recorded more than {} zones", dropped, Impl::ProfilerThreadZones::MaxZones);
+
+    TC_LOG_INFO("server.profiler", "Profile of {} zones on {} threads written to {}", zoneCount, threads.size(), path);
+}
+}
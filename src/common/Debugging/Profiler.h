@@ -0,0 +1,132 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PROFILER_H
+#define TRINITYCORE_PROFILER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Trinity
+{
+namespace Impl
+{
+    struct ProfilerThreadZones;
+}
+
+struct ProfilerZoneStats
+{
+    char const* Name;
+    uint32 Count;
+    std::chrono::steady_clock::duration Total;
+};
+
+/*
+ * Records the zones marked with TC_PROFILE_ZONE on every thread while a capture is running and writes
+ * them as a Chrome trace (chrome://tracing, Perfetto, speedscope) once it ends.
+ * Outside of captures a zone costs a single relaxed load.
+ *
+ * Zone statistics can also be kept per thread without a capture, summing up count and time of every zone
+ * until the thread takes them, which costs two clock reads per zone while enabled.
+ */
+class TC_COMMON_API Profiler
+{
+public:
+    static Profiler* instance();
+
+    Profiler(Profiler const&) = delete;
+    Profiler& operator=(Profiler const&) = delete;
+
+    bool IsCapturing() const { return _capturing.load(std::memory_order_relaxed); }
+    bool IsRecording() const { return IsCapturing() || _zoneStatsEnabled.load(std::memory_order_relaxed); }
+
+    void SetZoneStatsEnabled(bool enabled) { _zoneStatsEnabled = enabled; }
+
+    // Statistics of the zones the calling thread ended since it last took them, slowest first
+    std::vector<ProfilerZoneStats> TakeThreadZoneStats();
+    // Adds statistics taken earlier back to those of the calling thread
+    void AddThreadZoneStats(std::vector<ProfilerZoneStats> const& stats);
+
+    // Records for duration and writes the trace to path from a background thread, false if a capture is already running
+    bool StartCapture(Seconds duration, std::string path);
+
+    void RecordZone(char const* name, TimePoint start, TimePoint end);
+
+    // Ends the running capture early, its trace is still written
+    void Stop();
+
+private:
+    Profiler();
+    ~Profiler();
+
+    void RunCapture(Seconds duration, std::string path);
+    void WriteTrace(std::string const& path);
+
+    std::atomic<bool> _capturing;
+    std::atomic<bool> _zoneStatsEnabled;
+    TimePoint _captureStart;
+    std::thread _captureThread;
+    std::mutex _captureLock;
+    std::condition_variable _captureStopped;
+    bool _stopRequested;
+
+    std::mutex _threadsLock;
+    std::vector<std::shared_ptr<Impl::ProfilerThreadZones>> _threads;
+};
+
+class ProfilerZone
+{
+public:
+    explicit ProfilerZone(char const* name) : _name(name), _start(Profiler::instance()->IsRecording() ? std::chrono::steady_clock::now() : TimePoint())
+    {
+    }
+
+    ~ProfilerZone()
+    {
+        if (_start != TimePoint())
+            Profiler::instance()->RecordZone(_name, _start, std::chrono::steady_clock::now());
+    }
+
+    ProfilerZone(ProfilerZone const&) = delete;
+    ProfilerZone& operator=(ProfilerZone const&) = delete;
+
+private:
+    char const* _name;
+    TimePoint _start;
+};
+}
+
+#define sProfiler Trinity::Profiler::instance()
+
+#define TC_PROFILE_DO_CONCAT(a, b) a ## b
+#define TC_PROFILE_CONCAT(a, b) TC_PROFILE_DO_CONCAT(a, b)
+
+// Name must outlive the capture, usually a string literal
+#ifdef PERFORMANCE_PROFILING
+#define TC_PROFILE_ZONE(name) ((void)0)
+#else
+#define TC_PROFILE_ZONE(name) Trinity::ProfilerZone TC_PROFILE_CONCAT(__tc_profiler_zone, __LINE__)(name)
+#endif
+
+#endif // TRINITYCORE_PROFILER_H
@@ -46,6 +46,7 @@ class TC_COMMON_API Appender
         void write(LogMessage* message);
         static std::string_view getLogLevelString(LogLevel level);
         virtual void setRealmId(uint32 /*realmId*/) { }
+        virtual void flush() { }    // called after every batch of deferred messages
 
     private:
         virtual void _write(LogMessage const* /*message*/) = 0;
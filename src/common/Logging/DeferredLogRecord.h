@@ -0,0 +1,137 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_DEFERRED_LOG_RECORD_H
+#define TRINITYCORE_DEFERRED_LOG_RECORD_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "LogCommon.h"
+#include "StringFormat.h"
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+class Logger;
+
+namespace Trinity::Impl::DeferredLog
+{
+// Formats the arguments stored after a record, in the types they were stored as
+using FormatFn = std::string(*)(FormatStringView fmt, uint8 const* args);
+
+/*
+ * Header of a message written to a thread's log ring buffer, followed by its filter, param1 and arguments.
+ * Messages whose arguments can't be stored are formatted by the logging thread, Format is null for those
+ * and the arguments are the text itself.
+ */
+struct Record
+{
+    Logger const* Target;
+    FormatFn Format;
+    char const* FormatData;     // format strings are literals, only the pointer is kept
+    std::size_t FormatSize;
+    SystemTimePoint Time;
+    uint32 FilterSize;
+    uint32 Param1Size;
+    uint32 ArgsSize;
+    LogLevel Level;
+};
+
+// Only values that can't change before they are formatted are stored, arithmetic types and enums by value, strings by content
+template<typename T>
+struct StoredType { using Type = void; };
+
+template<typename T> requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+struct StoredType<T> { using Type = T; };
+
+template<typename T> requires std::is_convertible_v<T const&, std::string_view> && (!std::is_arithmetic_v<T>)
+struct StoredType<T> { using Type = std::string_view; };
+
+template<typename T>
+using StoredTypeT = typename StoredType<std::remove_cvref_t<T>>::Type;
+
+template<typename... Args>
+inline constexpr bool CanStore = (!std::is_void_v<StoredTypeT<Args>> && ...);
+
+template<typename T>
+std::string_view AsStringView(T const& value)
+{
+    if constexpr (std::is_pointer_v<std::decay_t<T>>)
+        return value ? std::string_view(value) : std::string_view();
+    else
+        return std::string_view(value);
+}
+
+template<typename T>
+std::size_t GetStoredSize(T const& value)
+{
+    if constexpr (std::is_same_v<StoredTypeT<T>, std::string_view>)
+        return sizeof(uint32) + AsStringView(value).size();
+    else
+        return sizeof(T);
+}
+
+template<typename T>
+void Store(uint8*& data, T const& value)
+{
+    if constexpr (std::is_same_v<StoredTypeT<T>, std::string_view>)
+    {
+        std::string_view string = AsStringView(value);
+        uint32 size = uint32(string.size());
+        std::memcpy(data, &size, sizeof(size));
+        std::memcpy(data + sizeof(size), string.data(), size);
+        data += sizeof(size) + size;
+    }
+    else
+    {
+        std::memcpy(data, &value, sizeof(T));
+        data += sizeof(T);
+    }
+}
+
+template<typename T>
+T Load(uint8 const*& data)
+{
+    if constexpr (std::is_same_v<T, std::string_view>)
+    {
+        uint32 size;
+        std::memcpy(&size, data, sizeof(size));
+        std::string_view string(reinterpret_cast<char const*>(data + sizeof(size)), size);
+        data += sizeof(size) + size;
+        return string;
+    }
+    else
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        return value;
+    }
+}
+
+template<typename... Stored>
+std::string Format(FormatStringView fmt, uint8 const* args)
+{
+    // braced initialization loads the arguments in order
+    std::tuple<Stored...> values{ Load<Stored>(args)... };
+    return std::apply([fmt](Stored&... value) { return StringVFormat(fmt, MakeFormatArgs(value...)); }, values);
+}
+}
+
+#endif // TRINITYCORE_DEFERRED_LOG_RECORD_H
@@ -22,12 +22,33 @@
 #include "Errors.h"
 #include "LogMessage.h"
 #include "LogOperation.h"
+#include "LogRingBuffer.h"
 #include "Logger.h"
 #include "Strand.h"
 #include "StringConvert.h"
 #include "Util.h"
+#include <algorithm>
+#include <cinttypes>
 
-Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), m_logsTimestamp('_' + GetTimestampStr()), _ioContext(nullptr), _strand(nullptr)
+namespace
+{
+struct DeferredLogThreadBuffer
+{
+    std::shared_ptr<Trinity::LogRingBuffer> Buffer;
+    uint32 Generation = 0;
+};
+
+thread_local DeferredLogThreadBuffer ThreadBuffer;
+
+struct PendingDeferredRecord
+{
+    SystemTimePoint Time;
+    uint8 const* Data;
+};
+}
+
+Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _loggersGeneration(1), m_logsTimestamp('_' + GetTimestampStr()), _ioContext(nullptr), _strand(nullptr),
+    _deferred(false), _deferredStopping(false), _deferredGeneration(0), _deferredBufferSize(0)
 {
     RegisterAppender<AppenderConsole>();
     RegisterAppender<AppenderFile>();
@@ -35,6 +56,7 @@ Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), m_logsTimestamp('_'
 
 Log::~Log()
 {
+    StopDeferred();
     delete _strand;
     Close();
 }
@@ -232,7 +254,9 @@ void Log::OutCommandImpl(uint32 account, Trinity::FormatStringView messageFormat
 {
     Logger const* logger = GetLoggerByType("commands.gm");
 
-    if (_ioContext)
+    if (IsDeferred())
+        OutTextDeferred(logger, "commands.gm", LOG_LEVEL_INFO, Trinity::StringVFormat(messageFormat, messageFormatArgs), Trinity::ToString(account));
+    else if (_ioContext)
         Trinity::Asio::post(*_strand, LogOperation(logger, new LogMessage(LOG_LEVEL_INFO, "commands.gm", Trinity::StringVFormat(messageFormat, messageFormatArgs), Trinity::ToString(account))));
     else
     {
@@ -258,6 +282,14 @@ Logger const* Log::GetLoggerByType(std::string_view type) const
     return GetLoggerByType(parentLogger);
 }
 
+void Log::ResolveCallSite(LogCallSite& callSite, std::string_view type, uint32 generation) const noexcept
+{
+    Logger const* logger = GetLoggerByType(type);
+    callSite.Target.store(logger, std::memory_order_relaxed);
+    callSite.Level.store(logger ? logger->getLogLevel() : LOG_LEVEL_DISABLED, std::memory_order_relaxed);
+    callSite.Generation.store(generation, std::memory_order_release);
+}
+
 std::string Log::GetTimestampStr()
 {
     return TimeToTimestampStr(time(nullptr));
@@ -280,6 +312,7 @@ bool Log::SetLogLevel(std::string const& name, int32 newLeveli, bool isLogger /*
             return false;
 
         it->second->setLogLevel(newLevel);
+        ++_loggersGeneration;
 
         if (newLevel != LOG_LEVEL_DISABLED && newLevel < lowestLogLevel)
             lowestLogLevel = newLevel;
@@ -306,7 +339,9 @@ void Log::OutCharDump(std::string const& str, uint32 accountId, uint64 guid, std
 
     Logger const* logger = GetLoggerByType("entities.player.dump");
 
-    if (_ioContext)
+    if (IsDeferred())
+        OutTextDeferred(logger, "entities.player.dump", LOG_LEVEL_INFO, ss, param);
+    else if (_ioContext)
         Trinity::Asio::post(*_strand, LogOperation(logger, new LogMessage(LOG_LEVEL_INFO, "entities.player.dump", std::move(ss), std::move(param))));
     else
     {
@@ -382,13 +417,178 @@ void Log::SetAsynchronous(Trinity::Asio::IoContext* ioContext)
 
 void Log::SetSynchronous()
 {
+    StopDeferred();
     delete _strand;
     _strand = nullptr;
     _ioContext = nullptr;
 }
 
+void Log::SetDeferred(std::size_t bufferSize)
+{
+    if (_deferredWriter.joinable())
+        return;
+
+    _deferredBufferSize = bufferSize;
+    _deferredStopping = false;
+    ++_deferredGeneration;
+    _deferredWriter = std::thread(&Log::RunDeferredWriter, this);
+    _deferred = true;
+}
+
+void Log::StopDeferred()
+{
+    if (!_deferredWriter.joinable())
+        return;
+
+    // the writer empties every buffer before it exits
+    _deferred = false;
+    _deferredStopping = true;
+    _deferredWriter.join();
+
+    std::scoped_lock lock(_deferredBuffersLock);
+    _deferredBuffers.clear();
+}
+
+uint8* Log::ReserveDeferredRecord(Logger const* logger, std::string_view filter, LogLevel level, std::string_view param1, std::size_t argsSize,
+    Trinity::Impl::DeferredLog::FormatFn format, Trinity::FormatStringView messageFormat) const noexcept
+{
+    uint32 generation = _deferredGeneration.load(std::memory_order_acquire);
+    if (!ThreadBuffer.Buffer || ThreadBuffer.Generation != generation)
+    {
+        ThreadBuffer.Buffer = std::make_shared<Trinity::LogRingBuffer>(_deferredBufferSize);
+        ThreadBuffer.Generation = generation;
+
+        std::scoped_lock lock(_deferredBuffersLock);
+        _deferredBuffers.push_back(ThreadBuffer.Buffer);
+    }
+
+    Trinity::Impl::DeferredLog::Record record;
+    record.Target = logger;
+    record.Format = format;
+    record.FormatData = messageFormat.data();
+    record.FormatSize = messageFormat.size();
+    record.Time = std::chrono::system_clock::now();
+    record.FilterSize = uint32(filter.size());
+    record.Param1Size = uint32(param1.size());
+    record.ArgsSize = uint32(argsSize);
+    record.Level = level;
+
+    uint8* data = ThreadBuffer.Buffer->Reserve(sizeof(record) + filter.size() + param1.size() + argsSize);
+    if (!data)
+        return nullptr;
+
+    std::memcpy(data, &record, sizeof(record));
+    data += sizeof(record);
+    std::memcpy(data, filter.data(), filter.size());
+    data += filter.size();
+    std::memcpy(data, param1.data(), param1.size());
+    return data + param1.size();
+}
+
+void Log::CommitDeferredRecord() noexcept
+{
+    ThreadBuffer.Buffer->Commit();
+}
+
+void Log::OutTextDeferred(Logger const* logger, std::string_view filter, LogLevel level, std::string_view text, std::string_view param1) const noexcept
+{
+    if (uint8* data = ReserveDeferredRecord(logger, filter, level, param1, text.size(), nullptr, {}))
+    {
+        std::memcpy(data, text.data(), text.size());
+        CommitDeferredRecord();
+    }
+}
+
+void Log::RunDeferredWriter()
+{
+    while (true)
+    {
+        bool stopping = _deferredStopping.load(std::memory_order_acquire);
+        std::size_t written;
+        {
+            std::scoped_lock lock(_deferredWriteLock);
+            written = WriteDeferredMessages();
+        }
+
+        if (written)
+            continue;
+
+        if (stopping)
+            break;
+
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
+std::size_t Log::WriteDeferredMessages()
+{
+    std::vector<std::shared_ptr<Trinity::LogRingBuffer>> buffers;
+    {
+        std::scoped_lock lock(_deferredBuffersLock);
+        // the thread owning the buffer exited and everything it logged was written
+        std::erase_if(_deferredBuffers, [](std::shared_ptr<Trinity::LogRingBuffer> const& buffer) { return buffer.use_count() == 1 && buffer->IsEmpty(); });
+        buffers = _deferredBuffers;
+    }
+
+    std::vector<PendingDeferredRecord> records;
+    std::vector<uint64> positions(buffers.size());
+    uint64 dropped = 0;
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+        positions[i] = buffers[i]->Read([&](uint8 const* data)
+        {
+            Trinity::Impl::DeferredLog::Record record;
+            std::memcpy(&record, data, sizeof(record));
+            records.push_back({ .Time = record.Time, .Data = data });
+        });
+        dropped += buffers[i]->TakeDroppedCount();
+    }
+
+    // messages of different threads are interleaved in the order they were logged
+    std::stable_sort(records.begin(), records.end(), [](PendingDeferredRecord const& left, PendingDeferredRecord const& right) { return left.Time < right.Time; });
+    for (PendingDeferredRecord const& record : records)
+        WriteDeferredRecord(record.Data);
+
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+        buffers[i]->Release(positions[i]);
+
+    if (!records.empty())
+        for (std::pair<uint8 const, std::unique_ptr<Appender>>& appender : appenders)
+            appender.second->flush();
+
+    if (dropped)
+        fprintf(stderr, "Log: %" PRIu64 " messages were dropped, log buffers are full (Log.Deferred.BufferSize)\n", dropped);
+
+    return records.size();
+}
+
+void Log::WriteDeferredRecord(uint8 const* data)
+{
+    Trinity::Impl::DeferredLog::Record record;
+    std::memcpy(&record, data, sizeof(record));
+    data += sizeof(record);
+
+    std::string_view filter(reinterpret_cast<char const*>(data), record.FilterSize);
+    data += record.FilterSize;
+    std::string param1(reinterpret_cast<char const*>(data), record.Param1Size);
+    data += record.Param1Size;
+
+    std::string text = record.Format
+        ? record.Format({ record.FormatData, record.FormatSize }, data)
+        : std::string(reinterpret_cast<char const*>(data), record.ArgsSize);
+
+    LogMessage msg(record.Level, filter, std::move(text), std::move(param1));
+    msg.mtime = std::chrono::system_clock::to_time_t(record.Time);
+    record.Target->write(&msg);
+}
+
 void Log::LoadFromConfig()
 {
+    // deferred messages point to the current loggers, they are written before the loggers are replaced
+    std::scoped_lock lock(_deferredWriteLock);
+    if (IsDeferred())
+        WriteDeferredMessages();
+
     Close();
 
     lowestLogLevel = LOG_LEVEL_FATAL;
@@ -400,4 +600,5 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+    ++_loggersGeneration;
 }
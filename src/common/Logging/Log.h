@@ -20,9 +20,13 @@
 
 #include "Define.h"
 #include "AsioHacksFwd.h"
+#include "DeferredLogRecord.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -32,6 +36,8 @@ struct LogMessage;
 
 namespace Trinity
 {
+    class LogRingBuffer;
+
     namespace Asio
     {
         class IoContext;
@@ -40,6 +46,19 @@ namespace Trinity
 
 #define LOGGER_ROOT "root"
 
+// Messages below this level are compiled out, e.g. -DTRINITY_LOG_MIN_LEVEL=LOG_LEVEL_INFO removes every TC_LOG_DEBUG and TC_LOG_TRACE
+#ifndef TRINITY_LOG_MIN_LEVEL
+#define TRINITY_LOG_MIN_LEVEL LOG_LEVEL_TRACE
+#endif
+
+// Logger of a TC_LOG_* call site, resolved on its first use and again after loggers were reloaded or their level changed
+struct LogCallSite
+{
+    std::atomic<uint32> Generation;
+    std::atomic<Logger const*> Target;
+    std::atomic<LogLevel> Level;
+};
+
 typedef Appender*(*AppenderCreatorFn)(uint8 id, std::string name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& extraArgs);
 
 template <class AppenderImpl>
@@ -65,22 +84,53 @@ class TC_COMMON_API Log
         void Initialize(Trinity::Asio::IoContext* ioContext);
         void SetAsynchronous(Trinity::Asio::IoContext* ioContext);
         void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
+        // Threads write messages and their arguments to their own ring buffer of bufferSize bytes, formatting and writing is done by a single logging thread
+        void SetDeferred(std::size_t bufferSize);
+        bool IsDeferred() const { return _deferred.load(std::memory_order_relaxed); }
         void LoadFromConfig();
         void Close();
         bool ShouldLog(std::string_view type, LogLevel level) const noexcept;
         Logger const* GetEnabledLogger(std::string_view type, LogLevel level) const noexcept;
+
+        // Call sites logging to a literal filter keep the logger they resolved
+        template <size_t CharArraySize>
+        Logger const* GetEnabledLogger(LogCallSite& callSite, char const(&type)[CharArraySize], LogLevel level) const noexcept
+        {
+            // Don't even look for a logger if the LogLevel is lower than lowest log levels across all loggers
+            if (level < lowestLogLevel)
+                return nullptr;
+
+            uint32 generation = _loggersGeneration.load(std::memory_order_relaxed);
+            if (callSite.Generation.load(std::memory_order_acquire) != generation)
+                ResolveCallSite(callSite, { std::begin(type), (type[CharArraySize - 1] == '\0' ? CharArraySize - 1 : CharArraySize) }, generation);
+
+            LogLevel logLevel = callSite.Level.load(std::memory_order_relaxed);
+            return logLevel != LOG_LEVEL_DISABLED && logLevel <= level ? callSite.Target.load(std::memory_order_relaxed) : nullptr;
+        }
+
+        template <typename StringOrStringView>
+        Logger const* GetEnabledLogger(LogCallSite& /*callSite*/, StringOrStringView const& type, LogLevel level) const noexcept
+        {
+            return GetEnabledLogger(make_string_view(type), level);
+        }
         bool SetLogLevel(std::string const& name, int32 level, bool isLogger = true);
 
         template<typename... Args>
         void OutMessage(std::string_view filter, LogLevel level, Trinity::FormatString<Args...> fmt, Args&&... args) noexcept
         {
-            this->OutMessageImpl(GetLoggerByType(filter), filter, level, fmt, Trinity::MakeFormatArgs(args...));
+            if (IsDeferred())
+                this->OutMessageDeferred(GetLoggerByType(filter), filter, level, fmt.get(), args...);
+            else
+                this->OutMessageImpl(GetLoggerByType(filter), filter, level, fmt, Trinity::MakeFormatArgs(args...));
         }
 
         template<typename... Args>
         void OutMessageTo(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatString<Args...> fmt, Args&&... args) noexcept
         {
-            this->OutMessageImpl(logger, filter, level, fmt, Trinity::MakeFormatArgs(args...));
+            if (IsDeferred())
+                this->OutMessageDeferred(logger, filter, level, fmt.get(), args...);
+            else
+                this->OutMessageImpl(logger, filter, level, fmt, Trinity::MakeFormatArgs(args...));
         }
 
         template<typename... Args>
@@ -130,6 +180,7 @@ class TC_COMMON_API Log
         static std::string GetTimestampStr();
 
         Logger const* GetLoggerByType(std::string_view type) const;
+        void ResolveCallSite(LogCallSite& callSite, std::string_view type, uint32 generation) const noexcept;
         Appender* GetAppenderByName(std::string_view name);
         uint8 NextAppenderId();
         void CreateAppenderFromConfig(std::string const& name);
@@ -140,25 +191,64 @@ class TC_COMMON_API Log
         void OutMessageImpl(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept;
         void OutCommandImpl(uint32 account, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept;
 
+        template<typename... Args>
+        void OutMessageDeferred(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Args&... args) const noexcept
+        {
+            using namespace Trinity::Impl::DeferredLog;
+            if constexpr (CanStore<Args...>)
+            {
+                std::size_t argsSize = (std::size_t(0) + ... + GetStoredSize(args));
+                if (uint8* data = ReserveDeferredRecord(logger, filter, level, {}, argsSize, &Format<StoredTypeT<Args>...>, messageFormat))
+                {
+                    (Store(data, args), ...);
+                    CommitDeferredRecord();
+                }
+            }
+            else
+                OutTextDeferred(logger, filter, level, Trinity::StringVFormat(messageFormat, Trinity::MakeFormatArgs(args...)), {});
+        }
+
+        // Space for argsSize bytes of arguments after the record, null if the buffer of this thread is full
+        uint8* ReserveDeferredRecord(Logger const* logger, std::string_view filter, LogLevel level, std::string_view param1, std::size_t argsSize,
+            Trinity::Impl::DeferredLog::FormatFn format, Trinity::FormatStringView messageFormat) const noexcept;
+        static void CommitDeferredRecord() noexcept;
+        void OutTextDeferred(Logger const* logger, std::string_view filter, LogLevel level, std::string_view text, std::string_view param1) const noexcept;
+        void RunDeferredWriter();
+        std::size_t WriteDeferredMessages();
+        void WriteDeferredRecord(uint8 const* data);
+        void StopDeferred();
+
         std::unordered_map<uint8, AppenderCreatorFn> appenderFactory;
         std::unordered_map<uint8, std::unique_ptr<Appender>> appenders;
         std::unordered_map<std::string_view, std::unique_ptr<Logger>> loggers;
         uint8 AppenderId;
         LogLevel lowestLogLevel;
+        std::atomic<uint32> _loggersGeneration;     // changed whenever call sites must resolve their logger again
 
         std::string m_logsDir;
         std::string m_logsTimestamp;
 
         Trinity::Asio::IoContext* _ioContext;
         Trinity::Asio::Strand* _strand;
+
+        std::atomic<bool> _deferred;
+        std::atomic<bool> _deferredStopping;
+        std::atomic<uint32> _deferredGeneration;    // buffers of earlier generations are no longer read
+        std::size_t _deferredBufferSize;
+        std::thread _deferredWriter;
+        std::mutex _deferredWriteLock;              // held while deferred messages are written, loggers and appenders can't be replaced meanwhile
+        mutable std::mutex _deferredBuffersLock;
+        mutable std::vector<std::shared_ptr<Trinity::LogRingBuffer>> _deferredBuffers;
 };
 
 #define sLog Log::instance()
 
 #define TC_LOG_MESSAGE_BODY_CORE(filterType__, level__, message__, ...)                                                         \
         do {                                                                                                                    \
+            static LogCallSite logCallSite;                                                                                     \
             Log* logInstance = sLog;                                                                                            \
-            if (Logger const* loggerInstance = logInstance->GetEnabledLogger(Log::make_string_view((filterType__)), (level__))) \
+            if (Logger const* loggerInstance = (level__) >= TRINITY_LOG_MIN_LEVEL                                               \
+                ? logInstance->GetEnabledLogger(logCallSite, (filterType__), (level__)) : nullptr)                             \
                 logInstance->OutMessageTo(loggerInstance, Log::make_string_view((filterType__)), (level__),                     \
                     Log::make_format_string_view((message__)), ## __VA_ARGS__);                                                 \
         } while (0)
@@ -0,0 +1,120 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LOG_RING_BUFFER_H
+#define TRINITYCORE_LOG_RING_BUFFER_H
+
+#include "Define.h"
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
+
+namespace Trinity
+{
+/*
+ * Single producer single consumer ring of variable sized records, kept contiguous.
+ * The producer reserves space for a record, fills it and commits it; the consumer reads every committed
+ * record in order and releases them once done, until then the producer cannot reuse their space.
+ */
+class LogRingBuffer
+{
+public:
+    explicit LogRingBuffer(std::size_t capacity) : _capacity(std::bit_ceil(std::max<std::size_t>(capacity, 64))),
+        _data(std::make_unique<uint8[]>(_capacity)), _head(0), _pendingHead(0), _tail(0), _dropped(0) { }
+
+    LogRingBuffer(LogRingBuffer const&) = delete;
+    LogRingBuffer& operator=(LogRingBuffer const&) = delete;
+
+    // Producer: space for size bytes aligned to 8, null if the ring is full. Nothing is visible to the consumer before Commit
+    uint8* Reserve(std::size_t size)
+    {
+        uint64 recordSize = (sizeof(uint64) + size + 7) & ~uint64(7);
+        uint64 head = _head.load(std::memory_order_relaxed);
+        uint64 tail = _tail.load(std::memory_order_acquire);
+        uint64 offset = head & (_capacity - 1);
+        uint64 padding = offset + recordSize > _capacity ? _capacity - offset : 0;
+        if (recordSize > _capacity || head + padding + recordSize - tail > _capacity)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        // records don't wrap around, the rest of the ring is skipped instead
+        if (padding)
+        {
+            std::memcpy(&_data[offset], &Padding, sizeof(uint64));
+            offset = 0;
+        }
+
+        std::memcpy(&_data[offset], &recordSize, sizeof(uint64));
+        _pendingHead = head + padding + recordSize;
+        return &_data[offset + sizeof(uint64)];
+    }
+
+    void Commit()
+    {
+        _head.store(_pendingHead, std::memory_order_release);
+    }
+
+    // Consumer: calls consumer(data) for every committed record in order, returns the position to release them up to
+    template<typename Consumer>
+    uint64 Read(Consumer&& consumer) const
+    {
+        uint64 tail = _tail.load(std::memory_order_relaxed);
+        uint64 head = _head.load(std::memory_order_acquire);
+        while (tail != head)
+        {
+            uint64 offset = tail & (_capacity - 1);
+            uint64 recordSize;
+            std::memcpy(&recordSize, &_data[offset], sizeof(uint64));
+            if (recordSize == Padding)
+            {
+                tail += _capacity - offset;
+                continue;
+            }
+
+            consumer(static_cast<uint8 const*>(&_data[offset + sizeof(uint64)]));
+            tail += recordSize;
+        }
+
+        return head;
+    }
+
+    void Release(uint64 position)
+    {
+        _tail.store(position, std::memory_order_release);
+    }
+
+    bool IsEmpty() const { return _tail.load(std::memory_order_relaxed) == _head.load(std::memory_order_acquire); }
+
+    // Number of records that did not fit since the last call
+    uint64 TakeDroppedCount() { return _dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    static constexpr uint64 Padding = ~uint64(0);
+
+    std::size_t _capacity;
+    std::unique_ptr<uint8[]> _data;
+    alignas(64) std::atomic<uint64> _head;
+    uint64 _pendingHead;
+    alignas(64) std::atomic<uint64> _tail;
+    std::atomic<uint64> _dropped;
+};
+}
+
+#endif // TRINITYCORE_LOG_RING_BUFFER_H
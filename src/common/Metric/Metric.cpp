@@ -22,11 +22,45 @@
 #include "Log.h"
 #include "Util.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <iterator>
+
+namespace
+{
+std::string GetPrometheusName(std::string_view name)
+{
+    std::string result(name);
+    for (char& c : result)
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != ':')
+            c = '_';
+    return result;
+}
+
+void AppendPrometheusLabel(std::string& out, std::string_view name, std::string_view value)
+{
+    if (out.back() != '{')
+        out += ',';
+
+    out += GetPrometheusName(name);
+    out += "=\"";
+    for (char c : value)
+    {
+        switch (c)
+        {
+            case '\\': out += "\\\\"; break;
+            case '"': out += "\\\""; break;
+            case '\n': out += "\\n"; break;
+            default: out += c; break;
+        }
+    }
+    out += '"';
+}
+}
 
 void Metric::Initialize(std::string const& realmName, Trinity::Asio::IoContext& ioContext, std::function<void()> overallStatusLogger)
 {
     _dataStream = std::make_unique<boost::asio::ip::tcp::iostream>();
     _realmName = FormatInfluxDBTagValue(realmName);
+    _realmLabel = realmName;
     _batchTimer = std::make_unique<Trinity::Asio::DeadlineTimer>(ioContext);
     _overallStatusTimer = std::make_unique<Trinity::Asio::DeadlineTimer>(ioContext);
     _overallStatusLogger = overallStatusLogger;
@@ -51,7 +85,10 @@ bool Metric::Connect()
 void Metric::LoadFromConfigs()
 {
     bool previousValue = _enabled;
-    _enabled = sConfigMgr->GetBoolDefault("Metric.Enable", false);
+    bool previousPushValue = _pushEnabled;
+    _pushEnabled = sConfigMgr->GetBoolDefault("Metric.Enable", false);
+    _pullEnabled = sConfigMgr->GetBoolDefault("Metric.Prometheus.Enable", false);
+    _enabled = _pushEnabled || _pullEnabled;
     _updateInterval = sConfigMgr->GetIntDefault("Metric.Interval", 1);
     if (_updateInterval < 1)
     {
@@ -66,6 +103,8 @@ void Metric::LoadFromConfigs()
         _overallStatusTimerInterval = 1;
     }
 
+    _aggregateTimers = sConfigMgr->GetBoolDefault("Metric.AggregateTimers", true);
+
     _thresholds.clear();
     std::vector<std::string> thresholdSettings = sConfigMgr->GetKeysByString("Metric.Threshold.");
     for (std::string const& thresholdSetting : thresholdSettings)
@@ -75,9 +114,12 @@ void Metric::LoadFromConfigs()
         _thresholds[thresholdName] = thresholdValue;
     }
 
+    if (_enabled && !previousValue)
+        ScheduleOverallStatusLog();
+
     // Schedule a send at this point only if the config changed from Disabled to Enabled.
     // Cancel any scheduled operation if the config changed from Enabled to Disabled.
-    if (_enabled && !previousValue)
+    if (_pushEnabled && !previousPushValue)
     {
         std::string connectionInfo = sConfigMgr->GetStringDefault("Metric.ConnectionInfo", "");
         if (connectionInfo.empty())
@@ -99,7 +141,6 @@ void Metric::LoadFromConfigs()
         Connect();
 
         ScheduleSend();
-        ScheduleOverallStatusLog();
     }
 }
 
@@ -112,7 +153,7 @@ void Metric::Update()
     }
 }
 
-bool Metric::ShouldLog(std::string const& category, int64 value) const
+bool Metric::ShouldLog(std::string_view category, int64 value) const
 {
     auto threshold = _thresholds.find(category);
     if (threshold == _thresholds.end())
@@ -124,6 +165,10 @@ void Metric::LogEvent(std::string category, std::string title, std::string descr
 {
     using namespace std::chrono;
 
+    // events don't map to any Prometheus metric type
+    if (!_pushEnabled)
+        return;
+
     MetricData* data = new MetricData;
     data->Category = std::move(category);
     data->Timestamp = system_clock::now();
@@ -139,8 +184,35 @@ void Metric::SendBatch()
     using namespace std::chrono;
 
     std::stringstream batchedData;
-    MetricData* data;
     bool firstLoop = true;
+    std::string const timestamp = std::to_string(duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count());
+    _timerAggregator.Flush([&](std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary)
+    {
+        if (_pullEnabled)
+            AddScrapedTimer(category, tags, summary);
+
+        if (!firstLoop)
+            batchedData << "\n";
+
+        batchedData << category;
+        if (!_realmName.empty())
+            batchedData << ",realm=" << _realmName;
+
+        for (MetricTag const& tag : tags)
+            if (!tag.first.empty())
+                batchedData << "," << tag.first << "=" << FormatInfluxDBTagValue(tag.second);
+
+        batchedData << " value=" << FormatInfluxDBValue(summary.Mean)
+            << ",count=" << FormatInfluxDBValue(summary.Count)
+            << ",max=" << FormatInfluxDBValue(summary.Max)
+            << ",p50=" << FormatInfluxDBValue(summary.P50)
+            << ",p99=" << FormatInfluxDBValue(summary.P99)
+            << " " << timestamp;
+
+        firstLoop = false;
+    });
+
+    MetricData* data;
     while (_queuedData.Dequeue(data))
     {
         if (!firstLoop)
@@ -221,7 +293,7 @@ void Metric::SendBatch()
 
 void Metric::ScheduleSend()
 {
-    if (_enabled)
+    if (_pushEnabled)
     {
         _batchTimer->expires_after(std::chrono::seconds(_updateInterval));
         _batchTimer->async_wait([this](boost::system::error_code const&){ SendBatch(); });
@@ -233,18 +305,27 @@ void Metric::ScheduleSend()
         // Clear the queue
         while (_queuedData.Dequeue(data))
             delete data;
+        // the exporter now takes what the batches would have sent
+        _timerAggregator.Flush([this](std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary)
+        {
+            if (_pullEnabled)
+                AddScrapedTimer(category, tags, summary);
+        });
     }
 }
 
 void Metric::Unload()
 {
     // Send what's queued only if IoContext is stopped (so only on shutdown)
-    if (_enabled && Trinity::Asio::get_io_context(*_batchTimer).stopped())
+    if (_pushEnabled && Trinity::Asio::get_io_context(*_batchTimer).stopped())
     {
-        _enabled = false;
+        _pushEnabled = false;
         SendBatch();
     }
 
+    _enabled = false;
+    _pullEnabled = false;
+
     _batchTimer->cancel();
     _overallStatusTimer->cancel();
 }
@@ -262,6 +343,149 @@ void Metric::ScheduleOverallStatusLog()
     }
 }
 
+std::string Metric::MakeScrapedSeriesKey(std::string_view category, std::span<MetricTagView const> tags)
+{
+    std::string key(category);
+    for (MetricTagView const& tag : tags)
+    {
+        key += '\x1F';
+        key += tag.first;
+        key += '=';
+        key += tag.second;
+    }
+    return key;
+}
+
+void Metric::SetScrapedGauge(std::string_view category, std::span<MetricTagView const> tags, double value)
+{
+    std::string key = MakeScrapedSeriesKey(category, tags);
+
+    std::scoped_lock lock(_scrapeLock);
+    auto [itr, inserted] = _scrapedGauges.try_emplace(std::move(key));
+    if (inserted)
+    {
+        itr->second.Category.assign(category);
+        for (MetricTagView const& tag : tags)
+            itr->second.Tags.emplace_back(tag.first, tag.second);
+    }
+
+    itr->second.Value = value;
+}
+
+void Metric::AddScrapedTimer(std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary)
+{
+    std::vector<MetricTagView> tagViews(tags.begin(), tags.end());
+    std::string key = MakeScrapedSeriesKey(category, tagViews);
+
+    std::scoped_lock lock(_scrapeLock);
+    auto [itr, inserted] = _scrapedTimers.try_emplace(std::move(key));
+    ScrapedSeries& series = itr->second;
+    if (inserted)
+    {
+        series.Category = category;
+        series.Tags = tags;
+    }
+
+    series.Count += summary.Count;
+    series.Total += summary.Total;
+    for (std::size_t i = 0; i < series.Buckets.size() && i < summary.Buckets.size(); ++i)
+        series.Buckets[i] += summary.Buckets[i];
+}
+
+void Metric::WriteScrapedLabels(std::string& out, std::vector<MetricTag> const& tags, std::string_view extraLabel /*= {}*/) const
+{
+    out += '{';
+    if (!_realmLabel.empty())
+        AppendPrometheusLabel(out, "realm", _realmLabel);
+
+    for (MetricTag const& tag : tags)
+        if (!tag.first.empty())
+            AppendPrometheusLabel(out, tag.first, tag.second);
+
+    if (!extraLabel.empty())
+    {
+        if (out.back() != '{')
+            out += ',';
+        out += extraLabel;
+    }
+
+    if (out.back() == '{')
+        out.pop_back();
+    else
+        out += '}';
+}
+
+std::string Metric::Scrape()
+{
+    if (!_pullEnabled)
+        return {};
+
+    // without batches being sent, timers are only collected when scraped
+    if (!_pushEnabled)
+        _timerAggregator.Flush([this](std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary)
+        {
+            AddScrapedTimer(category, tags, summary);
+        });
+
+    std::string out;
+    std::scoped_lock lock(_scrapeLock);
+
+    std::string const* previousCategory = nullptr;
+    for (auto const& [key, series] : _scrapedGauges)
+    {
+        std::string name = GetPrometheusName(series.Category);
+        if (!previousCategory || *previousCategory != series.Category)
+            Trinity::StringFormatTo(std::back_inserter(out), "# TYPE {} gauge\n", name);
+
+        out += name;
+        WriteScrapedLabels(out, series.Tags);
+        Trinity::StringFormatTo(std::back_inserter(out), " {}\n", series.Value);
+        previousCategory = &series.Category;
+    }
+
+    // durations below 1us, 4us, 16us ... ~67s, every second bucket of the aggregator
+    constexpr std::size_t LastExportedBucket = 26;
+
+    previousCategory = nullptr;
+    for (auto const& [key, series] : _scrapedTimers)
+    {
+        std::string name = GetPrometheusName(series.Category);
+        if (!previousCategory || *previousCategory != series.Category)
+            Trinity::StringFormatTo(std::back_inserter(out), "# TYPE {} histogram\n", name);
+
+        uint64 cumulativeCount = 0;
+        for (std::size_t i = 0; i < series.Buckets.size(); ++i)
+        {
+            cumulativeCount += series.Buckets[i];
+            if (i % 2 || i > LastExportedBucket)
+                continue;
+
+            out += name;
+            out += "_bucket";
+            WriteScrapedLabels(out, series.Tags, Trinity::StringFormat("le=\"{}\"", double(uint64(1) << i) / 1000000.0));
+            Trinity::StringFormatTo(std::back_inserter(out), " {}\n", cumulativeCount);
+        }
+
+        out += name;
+        out += "_bucket";
+        WriteScrapedLabels(out, series.Tags, "le=\"+Inf\"");
+        Trinity::StringFormatTo(std::back_inserter(out), " {}\n", series.Count);
+
+        out += name;
+        out += "_sum";
+        WriteScrapedLabels(out, series.Tags);
+        Trinity::StringFormatTo(std::back_inserter(out), " {}\n", std::chrono::duration<double>(series.Total).count());
+
+        out += name;
+        out += "_count";
+        WriteScrapedLabels(out, series.Tags);
+        Trinity::StringFormatTo(std::back_inserter(out), " {}\n", series.Count);
+        previousCategory = &series.Category;
+    }
+
+    return out;
+}
+
 std::string Metric::FormatInfluxDBValue(bool value)
 {
     return std::string(1, value ? 't' : 'f');
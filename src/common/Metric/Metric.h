@@ -20,11 +20,15 @@
 
 #include "Define.h"
 #include "Duration.h"
+#include "MetricAggregator.h"
 #include "MPSCQueue.h"
 #include "Optional.h"
+#include <array>
 #include <functional>
 #include <iosfwd>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -45,8 +49,6 @@ enum MetricDataType
     METRIC_DATA_EVENT
 };
 
-using MetricTag = std::pair<std::string, std::string>;
-
 struct MetricData
 {
     std::string Category;
@@ -71,18 +73,43 @@ private:
     std::iostream& GetDataStream() { return *_dataStream; }
     std::unique_ptr<std::iostream> _dataStream;
     MPSCQueue<MetricData, &MetricData::QueueLink> _queuedData;
+    MetricTimerAggregator _timerAggregator;
     std::unique_ptr<Trinity::Asio::DeadlineTimer> _batchTimer;
     std::unique_ptr<Trinity::Asio::DeadlineTimer> _overallStatusTimer;
     int32 _updateInterval = 0;
     int32 _overallStatusTimerInterval = 0;
     bool _enabled = false;
+    bool _pushEnabled = false;      // batches sent to InfluxDB
+    bool _pullEnabled = false;      // kept for the Prometheus exporter
     bool _overallStatusTimerTriggered = false;
+    bool _aggregateTimers = false;
     std::string _hostname;
     std::string _port;
     std::string _databaseName;
     std::function<void()> _overallStatusLogger;
     std::string _realmName;
-    std::unordered_map<std::string, int64> _thresholds;
+    std::string _realmLabel;
+    std::unordered_map<std::string, int64, MetricStringHash, std::equal_to<>> _thresholds;
+
+    struct ScrapedSeries
+    {
+        std::string Category;
+        std::vector<MetricTag> Tags;
+        double Value = 0.0;                                         // gauges
+        uint64 Count = 0;                                           // timers, cumulative since startup
+        std::chrono::nanoseconds Total = std::chrono::nanoseconds::zero();
+        std::array<uint64, MetricTimerSummary::BucketCount> Buckets = { };
+    };
+
+    // keyed by category first, series of the same metric are next to each other
+    std::mutex _scrapeLock;
+    std::map<std::string, ScrapedSeries> _scrapedGauges;
+    std::map<std::string, ScrapedSeries> _scrapedTimers;
+
+    static std::string MakeScrapedSeriesKey(std::string_view category, std::span<MetricTagView const> tags);
+    void SetScrapedGauge(std::string_view category, std::span<MetricTagView const> tags, double value);
+    void AddScrapedTimer(std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary);
+    void WriteScrapedLabels(std::string& out, std::vector<MetricTag> const& tags, std::string_view extraLabel = {}) const;
 
     bool Connect();
     void SendBatch();
@@ -114,13 +141,25 @@ public:
     void Initialize(std::string const& realmName, Trinity::Asio::IoContext& ioContext, std::function<void()> overallStatusLogger);
     void LoadFromConfigs();
     void Update();
-    bool ShouldLog(std::string const& category, int64 value) const;
+    bool ShouldLog(std::string_view category, int64 value) const;
 
     template<class T, class... TagsList>
-    void LogValue(std::string category, T value, TagsList&&... tags)
+    void LogValue(std::string category, T value, TagsList const&... tags)
     {
         using namespace std::chrono;
 
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            if (_pullEnabled)
+            {
+                std::array<MetricTagView, sizeof...(tags)> tagViews = { tags... };
+                SetScrapedGauge(category, tagViews, double(value));
+            }
+        }
+
+        if (!_pushEnabled)
+            return;
+
         MetricData* data = new MetricData;
         data->Category = std::move(category);
         data->Timestamp = system_clock::now();
@@ -132,20 +171,37 @@ public:
             if constexpr (sizeof...(tags) > 2)
             {
                 decltype(auto) tagsVector = data->Tags->emplace<1>();
-                (tagsVector.emplace_back(std::move(tags)), ...);
+                (tagsVector.emplace_back(tags.first, tags.second), ...);
             }
             else
             {
                 decltype(auto) tagsArray = data->Tags->emplace<0>();
-                tagsArray = { std::move(tags)... };
+                tagsArray = { MetricTag(tags.first, tags.second)... };
             }
         }
 
         _queuedData.Enqueue(data);
     }
 
+    // Unless disabled by Metric.AggregateTimers, durations are summarized per category and tags until the next batch
+    template<class... TagsList>
+    void LogTimer(std::string_view category, std::chrono::nanoseconds duration, TagsList const&... tags)
+    {
+        if (_aggregateTimers || _pullEnabled)
+        {
+            std::array<MetricTagView, sizeof...(tags)> tagViews = { tags... };
+            _timerAggregator.Record(category, tagViews, duration);
+        }
+        else
+            LogValue(std::string(category), duration, tags...);
+    }
+
     void LogEvent(std::string category, std::string title, std::string description);
 
+    // Every gauge and timer in the Prometheus text exposition format, timers are histograms in seconds
+    std::string Scrape();
+    bool IsPullEnabled() const { return _pullEnabled; }
+
     void Unload();
     bool IsEnabled() const { return _enabled; }
 };
@@ -181,7 +237,7 @@ Optional<MetricStopWatch<LoggerType>> MakeMetricStopWatch(LoggerType&& loggerFun
     return Optional<MetricStopWatch<LoggerType>>(std::in_place, std::forward<LoggerType>(loggerFunc));
 }
 
-#define TC_METRIC_TAG(name, value) MetricTag(name, value)
+#define TC_METRIC_TAG(name, value) MetricTagView(name, value)
 
 #define TC_METRIC_DO_CONCAT(a, b) a ## b
 #define TC_METRIC_CONCAT(a, b) TC_METRIC_DO_CONCAT(a, b)
@@ -227,16 +283,15 @@ Optional<MetricStopWatch<LoggerType>> MakeMetricStopWatch(LoggerType&& loggerFun
 #define TC_METRIC_TIMER(category, ...)                                                                           \
         auto TC_METRIC_UNIQUE_NAME(__tc_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start)            \
         {                                                                                                        \
-            sMetric->LogValue(category, std::chrono::steady_clock::now() - start, ##__VA_ARGS__);                \
+            sMetric->LogTimer(category, std::chrono::steady_clock::now() - start, ##__VA_ARGS__);                \
         });
 #  if defined WITH_DETAILED_METRICS
 #define TC_METRIC_DETAILED_TIMER(category, ...)                                                                  \
         auto TC_METRIC_UNIQUE_NAME(__tc_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start)            \
         {                                                                                                        \
-            int64 duration = int64(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - start).count()); \
-            std::string category2 = category;                                                                    \
-            if (sMetric->ShouldLog(category2, duration))                                                         \
-                sMetric->LogValue(std::move(category2), duration, ##__VA_ARGS__);                                \
+            std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start;                        \
+            if (sMetric->ShouldLog(category, std::chrono::duration_cast<Milliseconds>(duration).count()))        \
+                sMetric->LogTimer(category, duration, ##__VA_ARGS__);                                            \
         });
 #define TC_METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) TC_METRIC_TIMER(category, ##__VA_ARGS__)
 #define TC_METRIC_DETAILED_EVENT(category, title, description) TC_METRIC_EVENT(category, title, description)
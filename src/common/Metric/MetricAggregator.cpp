@@ -0,0 +1,151 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricAggregator.h"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+// Shard is private to the aggregator, the owning reference of this thread is kept type erased
+thread_local std::shared_ptr<void> ThreadShard;
+}
+
+MetricTimerAggregator::Shard& MetricTimerAggregator::GetThreadShard()
+{
+    if (!ThreadShard)
+    {
+        std::shared_ptr<Shard> shard = std::make_shared<Shard>();
+        {
+            std::scoped_lock lock(_shardsLock);
+            _shards.push_back(shard);
+        }
+        ThreadShard = std::move(shard);
+    }
+
+    return *static_cast<Shard*>(ThreadShard.get());
+}
+
+void MetricTimerAggregator::Record(std::string_view category, std::span<MetricTagView const> tags, std::chrono::nanoseconds duration)
+{
+    Shard& shard = GetThreadShard();
+    shard.Key.assign(category);
+    for (MetricTagView const& tag : tags)
+    {
+        shard.Key += '\x1F';
+        shard.Key += tag.first;
+        shard.Key += '=';
+        shard.Key += tag.second;
+    }
+
+    uint64 microseconds = uint64(std::max<int64>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), 0));
+    std::size_t bucket = std::min<std::size_t>(std::bit_width(microseconds), BucketCount - 1);
+
+    std::scoped_lock lock(shard.Lock);
+    auto itr = shard.Entries.find(std::string_view(shard.Key));
+    if (itr == shard.Entries.end())
+    {
+        itr = shard.Entries.try_emplace(shard.Key).first;
+        itr->second.Category.assign(category);
+        for (MetricTagView const& tag : tags)
+            itr->second.Tags.emplace_back(tag.first, tag.second);
+    }
+
+    Series& series = itr->second;
+    ++series.Count;
+    series.Total += duration;
+    series.Max = std::max(series.Max, duration);
+    ++series.Buckets[bucket];
+}
+
+int64 MetricTimerAggregator::GetPercentile(Series const& series, double percentile)
+{
+    uint64 rank = uint64(double(series.Count - 1) * percentile);
+    uint64 seen = 0;
+    for (std::size_t i = 0; i < BucketCount; ++i)
+    {
+        seen += series.Buckets[i];
+        if (seen > rank)
+        {
+            std::chrono::microseconds upperBound(i ? (uint64(1) << i) - 1 : 0);
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::min<std::chrono::nanoseconds>(upperBound, series.Max)).count();
+        }
+    }
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(series.Max).count();
+}
+
+void MetricTimerAggregator::Flush(std::function<void(std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary)> const& consumer)
+{
+    std::vector<std::shared_ptr<Shard>> shards;
+    {
+        std::scoped_lock lock(_shardsLock);
+        // shards of exited threads are dropped once everything they recorded was sent
+        std::erase_if(_shards, [](std::shared_ptr<Shard> const& shard)
+        {
+            if (shard.use_count() != 1)
+                return false;
+
+            std::scoped_lock shardLock(shard->Lock);
+            return std::ranges::all_of(shard->Entries, [](auto const& series) { return series.second.Count == 0; });
+        });
+        shards = _shards;
+    }
+
+    // a series recorded by several threads is sent as a single point
+    std::unordered_map<std::string, Series> merged;
+    for (std::shared_ptr<Shard> const& shard : shards)
+    {
+        std::scoped_lock lock(shard->Lock);
+        for (auto& [key, series] : shard->Entries)
+        {
+            if (!series.Count)
+                continue;
+
+            auto [itr, inserted] = merged.try_emplace(key);
+            Series& total = itr->second;
+            if (inserted)
+            {
+                total.Category = series.Category;
+                total.Tags = series.Tags;
+            }
+
+            total.Count += series.Count;
+            total.Total += series.Total;
+            total.Max = std::max(total.Max, series.Max);
+            for (std::size_t i = 0; i < BucketCount; ++i)
+                total.Buckets[i] += series.Buckets[i];
+
+            series.Count = 0;
+            series.Total = std::chrono::nanoseconds::zero();
+            series.Max = std::chrono::nanoseconds::zero();
+            series.Buckets = { };
+        }
+    }
+
+    for (auto const& [key, series] : merged)
+    {
+        MetricTimerSummary summary{ .Buckets = series.Buckets };
+        summary.Count = series.Count;
+        summary.Mean = std::chrono::duration_cast<std::chrono::milliseconds>(series.Total / series.Count).count();
+        summary.Max = std::chrono::duration_cast<std::chrono::milliseconds>(series.Max).count();
+        summary.P50 = GetPercentile(series, 0.5);
+        summary.P99 = GetPercentile(series, 0.99);
+        summary.Total = series.Total;
+        consumer(series.Category, series.Tags, summary);
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_METRIC_AGGREGATOR_H
+#define TRINITYCORE_METRIC_AGGREGATOR_H
+
+#include "Define.h"
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using MetricTag = std::pair<std::string, std::string>;
+using MetricTagView = std::pair<std::string_view, std::string_view>;
+
+// Allows looking up containers keyed by std::string with any string_view
+struct MetricStringHash
+{
+    using is_transparent = void;
+    std::size_t operator()(std::string_view value) const { return std::hash<std::string_view>()(value); }
+};
+
+struct MetricTimerSummary
+{
+    // Power of two buckets of microseconds, bucket i holds the durations below 2^i microseconds not held by the previous ones
+    static constexpr std::size_t BucketCount = 40;
+
+    uint64 Count = 0;
+    int64 Mean = 0;         // durations in milliseconds
+    int64 Max = 0;
+    int64 P50 = 0;
+    int64 P99 = 0;
+    std::chrono::nanoseconds Total = std::chrono::nanoseconds::zero();
+    std::span<uint64 const> Buckets;
+};
+
+/*
+ * Durations of timers summarized per series (category and tags) until the next batch is sent.
+ * Every thread records into its own shard, recording a series seen before doesn't allocate.
+ */
+class TC_COMMON_API MetricTimerAggregator
+{
+public:
+    MetricTimerAggregator() = default;
+    MetricTimerAggregator(MetricTimerAggregator const&) = delete;
+    MetricTimerAggregator& operator=(MetricTimerAggregator const&) = delete;
+
+    void Record(std::string_view category, std::span<MetricTagView const> tags, std::chrono::nanoseconds duration);
+
+    // Calls consumer for every series recorded since the previous call and resets them
+    void Flush(std::function<void(std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary)> const& consumer);
+
+private:
+    // percentiles are reported as the upper bound of their bucket
+    static constexpr std::size_t BucketCount = MetricTimerSummary::BucketCount;
+
+    struct Series
+    {
+        std::string Category;
+        std::vector<MetricTag> Tags;
+        uint64 Count = 0;
+        std::chrono::nanoseconds Total = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds Max = std::chrono::nanoseconds::zero();
+        std::array<uint64, BucketCount> Buckets = { };
+    };
+
+    struct Shard
+    {
+        std::mutex Lock;
+        std::unordered_map<std::string, Series, MetricStringHash, std::equal_to<>> Entries;
+        std::string Key;    // reused to build series keys
+    };
+
+    static int64 GetPercentile(Series const& series, double percentile);
+
+    Shard& GetThreadShard();
+
+    std::mutex _shardsLock;
+    std::vector<std::shared_ptr<Shard>> _shards;
+};
+
+#endif // TRINITYCORE_METRIC_AGGREGATOR_H
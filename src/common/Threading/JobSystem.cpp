@@ -0,0 +1,115 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "JobSystem.h"
+#include "Log.h"
+#include <algorithm>
+
+namespace
+{
+thread_local Trinity::JobSystem* CurrentSystem = nullptr;
+thread_local std::size_t CurrentWorker = 0;
+
+Trinity::Impl::DetachedJob RunSpawned(Trinity::Job<void> job)
+{
+    try
+    {
+        co_await std::move(job);
+    }
+    catch (std::exception const& e)
+    {
+        TC_LOG_ERROR("misc", "JobSystem: spawned job failed: {}", e.what());
+    }
+    catch (...)
+    {
+        TC_LOG_ERROR("misc", "JobSystem: spawned job failed with an unknown exception");
+    }
+}
+}
+
+namespace Trinity
+{
+JobSystem::JobSystem(std::size_t workerCount) : _queue(std::max<std::size_t>(workerCount, 1)), _nextWorker(0), _queuedCount(0), _stopping(false)
+{
+    _workers.reserve(_queue.GetWorkerCount());
+    for (std::size_t i = 0; i < _queue.GetWorkerCount(); ++i)
+        _workers.emplace_back(&JobSystem::WorkerThread, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    Stop();
+}
+
+void JobSystem::Spawn(Job<void> job)
+{
+    Post(RunSpawned(std::move(job)).Handle);
+}
+
+void JobSystem::Post(std::coroutine_handle<> handle)
+{
+    std::size_t worker = CurrentSystem == this ? CurrentWorker : _nextWorker.fetch_add(1, std::memory_order_relaxed);
+    _queue.Push(worker, handle);
+
+    {
+        std::scoped_lock lock(_sleepLock);
+        ++_queuedCount;
+    }
+    _wakeUp.notify_one();
+}
+
+void JobSystem::Stop()
+{
+    {
+        std::scoped_lock lock(_sleepLock);
+        _stopping = true;
+    }
+    _wakeUp.notify_all();
+
+    for (std::thread& worker : _workers)
+        if (worker.joinable())
+            worker.join();
+}
+
+void JobSystem::WorkerThread(std::size_t index)
+{
+    CurrentSystem = this;
+    CurrentWorker = index;
+
+    while (true)
+    {
+        std::coroutine_handle<> handle;
+        if (_queue.Pop(index, handle))
+        {
+            {
+                std::scoped_lock lock(_sleepLock);
+                --_queuedCount;
+            }
+            handle.resume();
+            continue;
+        }
+
+        // jobs are counted after being pushed, a count above zero with nothing to pop only lasts until the popping worker decrements it
+        std::unique_lock lock(_sleepLock);
+        _wakeUp.wait(lock, [this] { return _queuedCount > 0 || _stopping; });
+        if (_stopping && _queuedCount <= 0)
+            break;
+    }
+
+    CurrentSystem = nullptr;
+}
+}
@@ -0,0 +1,357 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_JOB_SYSTEM_H
+#define TRINITY_JOB_SYSTEM_H
+
+#include "Define.h"
+#include "MPSCInbox.h"
+#include "Optional.h"
+#include "WorkStealingQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Trinity
+{
+template<typename T = void>
+class Job;
+
+namespace Impl
+{
+struct JobPromiseBase
+{
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+        {
+            if (std::coroutine_handle<> continuation = handle.promise().Continuation)
+                return continuation;
+
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept { }
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() { Exception = std::current_exception(); }
+
+    std::coroutine_handle<> Continuation;
+    std::exception_ptr Exception;
+};
+
+template<typename T>
+struct JobPromise : JobPromiseBase
+{
+    Job<T> get_return_object();
+
+    template<typename Value>
+    void return_value(Value&& value) { Result.emplace(std::forward<Value>(value)); }
+
+    T TakeResult()
+    {
+        if (Exception)
+            std::rethrow_exception(Exception);
+
+        return std::move(*Result);
+    }
+
+    Optional<T> Result;
+};
+
+template<>
+struct JobPromise<void> : JobPromiseBase
+{
+    Job<void> get_return_object();
+
+    void return_void() const noexcept { }
+
+    void TakeResult() const
+    {
+        if (Exception)
+            std::rethrow_exception(Exception);
+    }
+};
+
+// Coroutine owning itself, destroyed as soon as it finishes. Used to start jobs nobody waits for
+struct DetachedJob
+{
+    struct promise_type
+    {
+        DetachedJob get_return_object() { return { std::coroutine_handle<promise_type>::from_promise(*this) }; }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept { }
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> Handle;
+};
+}
+
+/*
+ * Lazily started coroutine producing a T. Nothing runs until the job is awaited (co_await std::move(job))
+ * or handed to JobSystem::Spawn; awaiting a job runs it on the awaiting thread until it suspends itself.
+ * Exceptions thrown by the job are rethrown to whoever awaits it.
+ */
+template<typename T>
+class [[nodiscard]] Job
+{
+public:
+    using promise_type = Impl::JobPromise<T>;
+
+    Job() : _handle(nullptr) { }
+    explicit Job(std::coroutine_handle<promise_type> handle) : _handle(handle) { }
+
+    Job(Job const&) = delete;
+    Job(Job&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) { }
+    Job& operator=(Job const&) = delete;
+    Job& operator=(Job&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle)
+                _handle.destroy();
+
+            _handle = std::exchange(other._handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~Job()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    bool IsValid() const { return _handle != nullptr; }
+
+    auto operator co_await() &&
+    {
+        struct Awaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                Handle.promise().Continuation = awaiting;
+                return Handle;
+            }
+
+            T await_resume() { return Handle.promise().TakeResult(); }
+
+            std::coroutine_handle<promise_type> Handle;
+        };
+
+        return Awaiter{ _handle };
+    }
+
+private:
+    std::coroutine_handle<promise_type> _handle;
+};
+
+template<typename T>
+inline Job<T> Impl::JobPromise<T>::get_return_object() { return Job<T>(std::coroutine_handle<JobPromise>::from_promise(*this)); }
+
+inline Job<void> Impl::JobPromise<void>::get_return_object() { return Job<void>(std::coroutine_handle<JobPromise>::from_promise(*this)); }
+
+/*
+ * Worker threads resuming jobs, each worker has its own deque of ready jobs and steals from the others once
+ * it runs out. Jobs move onto the workers with co_await jobSystem.Schedule() and fork with WhenAll.
+ *
+ * Jobs suspended on something other than the job system (a JobResumeQueue or a database callback) are not
+ * tracked, they must not outlive what they reference; the system only finishes the jobs already queued to it
+ * when it is stopped.
+ */
+class TC_COMMON_API JobSystem
+{
+public:
+    explicit JobSystem(std::size_t workerCount);
+    ~JobSystem();
+
+    JobSystem(JobSystem const&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    JobSystem& operator=(JobSystem const&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+    // Resumes the awaiting job on one of the workers
+    auto Schedule()
+    {
+        struct Awaiter
+        {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) const { System->Post(handle); }
+            void await_resume() const noexcept { }
+
+            JobSystem* System;
+        };
+
+        return Awaiter{ this };
+    }
+
+    // Starts job on a worker, the job is destroyed once it finishes. Exceptions escaping it are logged
+    void Spawn(Job<void> job);
+
+    // Runs every job on the workers and resumes the awaiting job once all of them finished,
+    // results are returned in the order of jobs. The first exception thrown by any of them is rethrown
+    template<typename T>
+    auto WhenAll(std::vector<Job<T>> jobs)
+    {
+        using Slot = std::conditional_t<std::is_void_v<T>, bool, Optional<T>>;
+
+        struct Awaiter
+        {
+            bool await_ready() const noexcept { return Jobs.empty(); }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                Continuation = handle;
+                Results.resize(Jobs.size());
+                Exceptions.resize(Jobs.size());
+                Remaining.store(Jobs.size() + 1, std::memory_order_relaxed);
+                for (std::size_t i = 0; i < Jobs.size(); ++i)
+                    System->Post(RunForked(std::move(Jobs[i]), i).Handle);
+
+                // every forked job may have finished already, the last one to finish resumes the awaiting job
+                return Remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            auto await_resume()
+            {
+                for (std::exception_ptr const& exception : Exceptions)
+                    if (exception)
+                        std::rethrow_exception(exception);
+
+                if constexpr (!std::is_void_v<T>)
+                {
+                    std::vector<T> results;
+                    results.reserve(Results.size());
+                    for (Slot& result : Results)
+                        results.push_back(std::move(*result));
+                    return results;
+                }
+            }
+
+            Impl::DetachedJob RunForked(Job<T> job, std::size_t index)
+            {
+                try
+                {
+                    if constexpr (std::is_void_v<T>)
+                        co_await std::move(job);
+                    else
+                        Results[index].emplace(co_await std::move(job));
+                }
+                catch (...)
+                {
+                    Exceptions[index] = std::current_exception();
+                }
+
+                if (Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    Continuation.resume();
+            }
+
+            JobSystem* System;
+            std::vector<Job<T>> Jobs;
+            std::vector<Slot> Results;
+            std::vector<std::exception_ptr> Exceptions;
+            std::atomic<std::size_t> Remaining;
+            std::coroutine_handle<> Continuation;
+        };
+
+        return Awaiter{ .System = this, .Jobs = std::move(jobs), .Results = {}, .Exceptions = {}, .Remaining = {}, .Continuation = nullptr };
+    }
+
+    // Resumes handle on a worker, preferring the deque of the calling worker
+    void Post(std::coroutine_handle<> handle);
+
+    std::size_t GetWorkerCount() const { return _workers.size(); }
+
+    // Finishes the queued jobs and joins the workers
+    void Stop();
+
+private:
+    void WorkerThread(std::size_t index);
+
+    WorkStealingQueue<std::coroutine_handle<>> _queue;
+    std::vector<std::thread> _workers;
+    std::atomic<std::size_t> _nextWorker;
+
+    std::mutex _sleepLock;
+    std::condition_variable _wakeUp;
+    std::ptrdiff_t _queuedCount;
+    bool _stopping;
+};
+
+/*
+ * Jobs waiting to be resumed by the thread calling Process, used to get back onto the thread owning
+ * the objects a job works on (co_await queue.Resume()). Jobs still waiting when the queue is destroyed are never resumed.
+ */
+class JobResumeQueue
+{
+    struct Awaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            Handle = handle;
+            Queue->_waiting.Enqueue(this);
+        }
+        void await_resume() const noexcept { }
+
+        JobResumeQueue* Queue;
+        std::coroutine_handle<> Handle;
+        std::atomic<Awaiter*> QueueLink;
+    };
+
+public:
+    JobResumeQueue() = default;
+
+    ~JobResumeQueue()
+    {
+        // awaiters live in the frames of the suspended jobs, they are not owned by the inbox
+        _waiting.Drain([](Awaiter* /*awaiter*/) { });
+    }
+
+    JobResumeQueue(JobResumeQueue const&) = delete;
+    JobResumeQueue(JobResumeQueue&&) = delete;
+    JobResumeQueue& operator=(JobResumeQueue const&) = delete;
+    JobResumeQueue& operator=(JobResumeQueue&&) = delete;
+
+    Awaiter Resume() { return { .Queue = this, .Handle = nullptr, .QueueLink = nullptr }; }
+
+    // Resumes every job that was waiting when called, returns their number
+    std::size_t Process()
+    {
+        return _waiting.Drain([](Awaiter* awaiter) { awaiter->Handle.resume(); });
+    }
+
+private:
+    MPSCInbox<Awaiter, &Awaiter::QueueLink> _waiting;
+};
+}
+
+#endif // TRINITY_JOB_SYSTEM_H
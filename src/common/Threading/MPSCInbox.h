@@ -0,0 +1,88 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_MPSC_INBOX_H
+#define TRINITY_MPSC_INBOX_H
+
+#include <atomic>
+
+namespace Trinity
+{
+/*
+ * Intrusive multi producer single consumer inbox.
+ * Unlike MPSCQueue the consumer cannot pop items one by one, it takes everything enqueued so far with a single
+ * atomic exchange and receives it in enqueue order. Meant for consumers that process in batches anyway.
+ */
+template<typename T, std::atomic<T*> T::* IntrusiveLink>
+class MPSCInbox
+{
+public:
+    MPSCInbox() : _head(nullptr) { }
+
+    ~MPSCInbox()
+    {
+        Drain([](T* item) { delete item; });
+    }
+
+    MPSCInbox(MPSCInbox const&) = delete;
+    MPSCInbox(MPSCInbox&&) = delete;
+    MPSCInbox& operator=(MPSCInbox const&) = delete;
+    MPSCInbox& operator=(MPSCInbox&&) = delete;
+
+    void Enqueue(T* input)
+    {
+        T* head = _head.load(std::memory_order_relaxed);
+        do
+            (input->*IntrusiveLink).store(head, std::memory_order_relaxed);
+        while (!_head.compare_exchange_weak(head, input, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Calls consumer for every item enqueued so far, oldest first. Returns number of items drained
+    template<typename Consumer>
+    std::size_t Drain(Consumer&& consumer)
+    {
+        // items are linked newest first, reverse the list to hand them out in order
+        T* newest = _head.exchange(nullptr, std::memory_order_acquire);
+        T* oldest = nullptr;
+        while (newest)
+        {
+            T* next = (newest->*IntrusiveLink).load(std::memory_order_relaxed);
+            (newest->*IntrusiveLink).store(oldest, std::memory_order_relaxed);
+            oldest = newest;
+            newest = next;
+        }
+
+        std::size_t count = 0;
+        while (oldest)
+        {
+            T* next = (oldest->*IntrusiveLink).load(std::memory_order_relaxed);
+            consumer(oldest);
+            oldest = next;
+            ++count;
+        }
+
+        return count;
+    }
+
+    bool Empty() const { return _head.load(std::memory_order_relaxed) == nullptr; }
+
+private:
+    std::atomic<T*> _head;
+};
+}
+
+#endif // TRINITY_MPSC_INBOX_H
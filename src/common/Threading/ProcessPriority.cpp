@@ -17,11 +17,19 @@
 
 #include "ProcessPriority.h"
 #include "Log.h"
+#include "StringConvert.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <vector>
 
 #ifdef _WIN32 // Windows
 #include <Windows.h>
 #elif defined(__linux__)
 #include <cstring>
+#include <pthread.h>
 #include <sched.h>
 #include <sys/resource.h>
 #define PROCESS_HIGH_PRIORITY -15 // [-20, 19], default is 0
@@ -96,3 +104,107 @@ void SetProcessPriority(std::string const& logChannel, uint32 affinity, bool hig
     (void)highPriority;
 #endif
 }
+
+namespace
+{
+// "0-3,8" is { 0, 1, 2, 3, 8 }, anything malformed is an empty list
+std::vector<uint32> ParseProcessorList(std::string list)
+{
+    std::erase_if(list, [](char c) { return std::isspace(static_cast<unsigned char>(c)); });
+
+    std::vector<uint32> processors;
+    for (std::string_view range : Trinity::Tokenize(list, ',', false))
+    {
+        std::vector<std::string_view> bounds = Trinity::Tokenize(range, '-', true);
+        if (bounds.size() > 2)
+            return {};
+
+        Optional<uint32> first = Trinity::StringTo<uint32>(bounds.front());
+        Optional<uint32> last = bounds.size() == 2 ? Trinity::StringTo<uint32>(bounds.back()) : first;
+        if (!first || !last || *last < *first)
+            return {};
+
+        for (uint32 processor = *first; processor <= *last; ++processor)
+            processors.push_back(processor);
+    }
+
+    return processors;
+}
+
+std::vector<uint32> GetNodeProcessors(uint32 node)
+{
+#ifdef _WIN32
+    ULONGLONG mask = 0;
+    std::vector<uint32> processors;
+    if (node <= 0xFF && GetNumaNodeProcessorMask(UCHAR(node), &mask))
+        for (uint32 i = 0; i < 64; ++i)
+            if (mask & (ULONGLONG(1) << i))
+                processors.push_back(i);
+    return processors;
+#else
+    std::ifstream file(Trinity::StringFormat("/sys/devices/system/node/node{}/cpulist", node));
+    std::string list;
+    if (!std::getline(file, list))
+        return {};
+
+    return ParseProcessorList(std::move(list));
+#endif
+}
+}
+
+bool SetCurrentThreadAffinity(std::string const& logChannel, std::string_view processors)
+{
+    if (processors.empty())
+        return true;
+
+    Optional<uint32> node;
+    std::vector<uint32> processorList;
+    if (processors.starts_with("node:"))
+    {
+        node = Trinity::StringTo<uint32>(processors.substr(5));
+        if (node)
+            processorList = GetNodeProcessors(*node);
+    }
+    else
+        processorList = ParseProcessorList(std::string(processors));
+
+    if (processorList.empty())
+    {
+        TC_LOG_ERROR(logChannel, "Thread affinity '{}' is not a processor list or an existing NUMA node.", processors);
+        return false;
+    }
+
+#ifdef _WIN32
+    DWORD_PTR mask = 0;
+    for (uint32 processor : processorList)
+        if (processor < sizeof(mask) * 8)
+            mask |= DWORD_PTR(1) << processor;
+
+    if (!mask || !SetThreadAffinityMask(GetCurrentThread(), mask))
+    {
+        TC_LOG_ERROR(logChannel, "Can't bind thread to processors '{}', error: {}", processors, GetLastError());
+        return false;
+    }
+#elif defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (uint32 processor : processorList)
+        if (processor < CPU_SETSIZE)
+            CPU_SET(processor, &mask);
+
+    if (int error = pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask))
+    {
+        TC_LOG_ERROR(logChannel, "Can't bind thread to processors '{}', error: {}", processors, strerror(error));
+        return false;
+    }
+
+    // the kernel takes new pages from the node of the processor that touches them first,
+    // so a thread bound to a node allocates from it without any memory policy
+#else
+    (void)logChannel;
+    return false;
+#endif
+
+    TC_LOG_DEBUG(logChannel, "Thread bound to processors '{}'", processors);
+    return true;
+}
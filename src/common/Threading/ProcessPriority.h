@@ -20,10 +20,15 @@
 
 #include "Define.h"
 #include <string>
+#include <string_view>
 
 #define CONFIG_PROCESSOR_AFFINITY "UseProcessors"
 #define CONFIG_HIGH_PRIORITY "ProcessPriority"
 
 void TC_COMMON_API SetProcessPriority(std::string const& logChannel, uint32 affinity, bool highPriority);
 
+// Binds the calling thread to a list of processor ranges like "0-7,16-23" or to every processor of a NUMA node with "node:1",
+// the memory the thread touches first then comes from that node. An empty list leaves the thread as it is.
+bool TC_COMMON_API SetCurrentThreadAffinity(std::string const& logChannel, std::string_view processors);
+
 #endif
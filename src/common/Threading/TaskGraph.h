@@ -0,0 +1,120 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_TASK_GRAPH_H
+#define TRINITY_TASK_GRAPH_H
+
+#include "Errors.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Set of named tasks with dependencies between them, run once on a fixed number of threads.
+ * A task is started as soon as every task it depends on has finished.
+ *
+ * Dependencies must be added before their dependents, which keeps the graph acyclic and
+ * makes insertion order a valid sequential execution order.
+ */
+class TaskGraph
+{
+public:
+    using TaskId = std::size_t;
+
+    TaskId Add(std::string name, std::function<void()> work, std::initializer_list<TaskId> dependencies = {})
+    {
+        TaskId id = _tasks.size();
+        Task& task = _tasks.emplace_back();
+        task.Name = std::move(name);
+        task.Work = std::move(work);
+        for (TaskId dependency : dependencies)
+        {
+            ASSERT(dependency < id, "Task %s depends on a task added after it", task.Name.c_str());
+            _tasks[dependency].Dependents.push_back(id);
+            ++task.DependencyCount;
+        }
+
+        return id;
+    }
+
+    // Runs every task and returns once all of them finished
+    void Run(std::size_t threadCount)
+    {
+        if (threadCount <= 1 || _tasks.size() <= 1)
+        {
+            for (Task& task : _tasks)
+                Execute(task);
+            return;
+        }
+
+        ThreadPool pool(threadCount);
+        std::unique_ptr<std::atomic<std::size_t>[]> pending = std::make_unique<std::atomic<std::size_t>[]>(_tasks.size());
+        for (TaskId id = 0; id < _tasks.size(); ++id)
+            pending[id] = _tasks[id].DependencyCount;
+
+        std::function<void(TaskId)> post = [&](TaskId id)
+        {
+            pool.PostWork([&, id]
+            {
+                Task& task = _tasks[id];
+                Execute(task);
+                for (TaskId dependent : task.Dependents)
+                    if (--pending[dependent] == 0)
+                        post(dependent);
+            });
+        };
+
+        for (TaskId id = 0; id < _tasks.size(); ++id)
+            if (!_tasks[id].DependencyCount)
+                post(id);
+
+        pool.Join();
+    }
+
+    std::size_t GetTaskCount() const { return _tasks.size(); }
+    std::string const& GetName(TaskId id) const { return _tasks[id].Name; }
+    std::chrono::steady_clock::duration GetDuration(TaskId id) const { return _tasks[id].Duration; }
+
+private:
+    struct Task
+    {
+        std::string Name;
+        std::function<void()> Work;
+        std::vector<TaskId> Dependents;
+        std::size_t DependencyCount = 0;
+        std::chrono::steady_clock::duration Duration = std::chrono::steady_clock::duration::zero();
+    };
+
+    static void Execute(Task& task)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        task.Work();
+        task.Duration = std::chrono::steady_clock::now() - start;
+    }
+
+    std::vector<Task> _tasks;
+};
+}
+
+#endif // TRINITY_TASK_GRAPH_H
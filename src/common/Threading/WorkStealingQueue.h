@@ -0,0 +1,102 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_WORK_STEALING_QUEUE_H
+#define TRINITY_WORK_STEALING_QUEUE_H
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Set of per-worker task deques. Each worker pops from its own deque and only touches
+ * the deques of other workers when its own runs dry, so contention is limited to the
+ * moments where work is actually being redistributed.
+ *
+ * Tasks are consumed from the front by both owner and thieves: producers are expected
+ * to push tasks in the order they should be started (most expensive first).
+ */
+template<typename T>
+class WorkStealingQueue
+{
+public:
+    explicit WorkStealingQueue(std::size_t workerCount) : _workers(workerCount)
+    {
+        for (std::unique_ptr<WorkerDeque>& worker : _workers)
+            worker = std::make_unique<WorkerDeque>();
+    }
+
+    WorkStealingQueue(WorkStealingQueue const&) = delete;
+    WorkStealingQueue(WorkStealingQueue&&) = delete;
+    WorkStealingQueue& operator=(WorkStealingQueue const&) = delete;
+    WorkStealingQueue& operator=(WorkStealingQueue&&) = delete;
+
+    std::size_t GetWorkerCount() const { return _workers.size(); }
+
+    void Push(std::size_t worker, T value)
+    {
+        WorkerDeque& deque = *_workers[worker % _workers.size()];
+        std::scoped_lock lock(deque.Lock);
+        deque.Tasks.push_back(std::move(value));
+    }
+
+    // Pops a task from worker's own deque, falling back to stealing from the others
+    bool Pop(std::size_t worker, T& value)
+    {
+        std::size_t count = _workers.size();
+        for (std::size_t i = 0; i < count; ++i)
+            if (TryPopFrom(*_workers[(worker + i) % count], value))
+                return true;
+
+        return false;
+    }
+
+    void Clear()
+    {
+        for (std::unique_ptr<WorkerDeque>& worker : _workers)
+        {
+            std::scoped_lock lock(worker->Lock);
+            worker->Tasks.clear();
+        }
+    }
+
+private:
+    struct WorkerDeque
+    {
+        std::mutex Lock;
+        std::deque<T> Tasks;
+    };
+
+    static bool TryPopFrom(WorkerDeque& deque, T& value)
+    {
+        std::scoped_lock lock(deque.Lock);
+        if (deque.Tasks.empty())
+            return false;
+
+        value = std::move(deque.Tasks.front());
+        deque.Tasks.pop_front();
+        return true;
+    }
+
+    std::vector<std::unique_ptr<WorkerDeque>> _workers;
+};
+}
+
+#endif // TRINITY_WORK_STEALING_QUEUE_H
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_ALIAS_TABLE_H
+#define TRINITYCORE_ALIAS_TABLE_H
+
+#include "Define.h"
+#include "Random.h"
+#include <span>
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Picks an index with the probability of its weight in constant time (Vose's alias method).
+ * Every column holds its own index with Probability and the index of an overfull weight otherwise,
+ * so one uniform column and one uniform roll decide. Building is linear in the number of weights.
+ */
+class AliasTable
+{
+public:
+    void Build(std::span<double const> weights)
+    {
+        std::size_t count = weights.size();
+        _probabilities.assign(count, 1.0);
+        _aliases.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+            _aliases[i] = uint32(i);
+
+        double total = 0.0;
+        for (double weight : weights)
+            total += weight;
+
+        if (total <= 0.0)
+        {
+            _probabilities.clear();
+            _aliases.clear();
+            return;
+        }
+
+        std::vector<uint32> small;
+        std::vector<uint32> large;
+        std::vector<double> scaled(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            scaled[i] = weights[i] * double(count) / total;
+            (scaled[i] < 1.0 ? small : large).push_back(uint32(i));
+        }
+
+        while (!small.empty() && !large.empty())
+        {
+            uint32 less = small.back();
+            small.pop_back();
+            uint32 more = large.back();
+
+            _probabilities[less] = scaled[less];
+            _aliases[less] = more;
+            scaled[more] -= 1.0 - scaled[less];
+            if (scaled[more] < 1.0)
+            {
+                large.pop_back();
+                small.push_back(more);
+            }
+        }
+
+        // what is left only differs from 1 by rounding errors
+        for (uint32 i : small)
+            _probabilities[i] = 1.0;
+        for (uint32 i : large)
+            _probabilities[i] = 1.0;
+    }
+
+    bool IsEmpty() const { return _probabilities.empty(); }
+    std::size_t GetSize() const { return _probabilities.size(); }
+
+    // column in [0, GetSize()), roll in [0, 1)
+    uint32 Select(uint32 column, double roll) const
+    {
+        return roll < _probabilities[column] ? column : _aliases[column];
+    }
+
+    uint32 Select() const
+    {
+        return Select(urand(0, uint32(_probabilities.size() - 1)), rand_norm());
+    }
+
+private:
+    std::vector<double> _probabilities;
+    std::vector<uint32> _aliases;
+};
+}
+
+#endif // TRINITYCORE_ALIAS_TABLE_H
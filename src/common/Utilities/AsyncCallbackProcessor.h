@@ -19,25 +19,50 @@
 #define TRINITYCORE_ASYNC_CALLBACK_PROCESSOR_H
 
 #include "AsyncCallbackProcessorFwd.h"
+#include "AsyncCompletionSignal.h"
+#include "Profiler.h"
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
+/*
+ * Callbacks waiting for async results, invoked by ProcessReadyCallbacks on the thread owning the processor.
+ * Callbacks whose results signal completion (SignaledAsyncCallback) are only looked at once their producer
+ * reported them ready, so processing costs scale with completed callbacks instead of pending ones.
+ * All other callbacks are polled on every call.
+ */
 template<AsyncCallback T>
 class AsyncCallbackProcessor
 {
 public:
-    AsyncCallbackProcessor() = default;
+    AsyncCallbackProcessor() : _completions(std::make_shared<AsyncCompletionQueue>()), _nextCallbackId(0) { }
     ~AsyncCallbackProcessor() = default;
 
     T& AddCallback(T&& query)
     {
+        if constexpr (SignaledAsyncCallback<T>)
+        {
+            if (GetAsyncCallbackCompletionSignal(query))
+            {
+                uint64 callbackId = ++_nextCallbackId;
+                T& callback = _signaledCallbacks.try_emplace(callbackId, std::move(query)).first->second;
+                Watch(callbackId, callback);
+                return callback;
+            }
+        }
+
         return _callbacks.emplace_back(std::move(query));
     }
 
     void ProcessReadyCallbacks()
     {
+        if constexpr (SignaledAsyncCallback<T>)
+            ProcessSignaledCallbacks();
+
         if (_callbacks.empty())
             return;
 
+        TC_PROFILE_ZONE("AsyncCallbackProcessor: polled callbacks");
         std::vector<T> updateCallbacks{ std::move(_callbacks) };
 
         std::erase_if(updateCallbacks, [](T& callback)
@@ -50,19 +75,58 @@ public:
 
     bool Empty() const
     {
-        return _callbacks.empty();
+        return _callbacks.empty() && _signaledCallbacks.empty();
     }
 
     void CancelAll()
     {
         _callbacks.clear();
+        _signaledCallbacks.clear();
+        _readyCallbacks.clear();
     }
 
 private:
     AsyncCallbackProcessor(AsyncCallbackProcessor const&) = delete;
     AsyncCallbackProcessor& operator=(AsyncCallbackProcessor const&) = delete;
 
+    // Waits for the current result of callback, chained callbacks are watched again for each query of the chain
+    void Watch(uint64 callbackId, T& callback)
+    {
+        AsyncCompletionSignal* signal = GetAsyncCallbackCompletionSignal(callback);
+        if (!signal || !signal->Subscribe(_completions, callbackId))
+            _readyCallbacks.push_back(callbackId);
+    }
+
+    void ProcessSignaledCallbacks()
+    {
+        _completions->Drain([this](uint64 callbackId) { _readyCallbacks.push_back(callbackId); });
+        if (_readyCallbacks.empty())
+            return;
+
+        TC_PROFILE_ZONE("AsyncCallbackProcessor: signaled callbacks");
+        // callbacks may add new callbacks or cancel all of them while being invoked
+        std::vector<uint64> readyCallbacks = std::move(_readyCallbacks);
+        _readyCallbacks.clear();
+        for (uint64 callbackId : readyCallbacks)
+        {
+            auto node = _signaledCallbacks.extract(callbackId);
+            if (node.empty())
+                continue;
+
+            if (InvokeAsyncCallbackIfReady(node.mapped()))
+                continue;
+
+            T& callback = _signaledCallbacks.insert(std::move(node)).position->second;
+            Watch(callbackId, callback);
+        }
+    }
+
     std::vector<T> _callbacks;
+
+    std::unordered_map<uint64, T> _signaledCallbacks;
+    std::vector<uint64> _readyCallbacks;    ///< signaled callbacks to be invoked by the next ProcessSignaledCallbacks
+    std::shared_ptr<AsyncCompletionQueue> _completions;
+    uint64 _nextCallbackId;
 };
 
 #endif // TRINITYCORE_ASYNC_CALLBACK_PROCESSOR_H
@@ -20,9 +20,15 @@
 
 #include <concepts>
 
+class AsyncCompletionSignal;
+
 template <typename T>
 concept AsyncCallback = requires(T& t) { { InvokeAsyncCallbackIfReady(t) } -> std::convertible_to<bool>; };
 
+// Callbacks that can tell when their result is ready, null if they have to be polled
+template <typename T>
+concept SignaledAsyncCallback = AsyncCallback<T> && requires(T& t) { { GetAsyncCallbackCompletionSignal(t) } -> std::convertible_to<AsyncCompletionSignal*>; };
+
 template<AsyncCallback T>
 class AsyncCallbackProcessor;
 
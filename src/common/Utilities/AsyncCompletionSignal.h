@@ -0,0 +1,133 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_ASYNC_COMPLETION_SIGNAL_H
+#define TRINITYCORE_ASYNC_COMPLETION_SIGNAL_H
+
+#include "Define.h"
+#include "MPSCInbox.h"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <utility>
+
+// Ids of the callbacks of an AsyncCallbackProcessor whose results became ready, filled by the threads producing them
+class AsyncCompletionQueue
+{
+public:
+    void Push(uint64 callbackId)
+    {
+        _completions.Enqueue(new Completion{ .CallbackId = callbackId, .QueueLink = nullptr });
+    }
+
+    template<typename Consumer>
+    void Drain(Consumer&& consumer)
+    {
+        _completions.Drain([&](Completion* completion)
+        {
+            consumer(completion->CallbackId);
+            delete completion;
+        });
+    }
+
+private:
+    struct Completion
+    {
+        uint64 CallbackId;
+        std::atomic<Completion*> QueueLink;
+    };
+
+    Trinity::MPSCInbox<Completion, &Completion::QueueLink> _completions;
+};
+
+/*
+ * Completion state of a single async result, shared by its producer and the callback waiting for it.
+ * The producer calls Complete once the result can be retrieved, after that the queue given to Subscribe
+ * (if any) receives the id of the callback. Subscribe and Complete may race, exactly one of them sees the other.
+ */
+class AsyncCompletionSignal
+{
+public:
+    AsyncCompletionSignal() : _state(Pending), _callbackId(0) { }
+
+    AsyncCompletionSignal(AsyncCompletionSignal const&) = delete;
+    AsyncCompletionSignal& operator=(AsyncCompletionSignal const&) = delete;
+
+    void Complete()
+    {
+        if (_state.exchange(Completed, std::memory_order_acq_rel) == Subscribed)
+            _queue->Push(_callbackId);
+    }
+
+    // Returns false if the result is ready already, nothing will be pushed to queue then
+    bool Subscribe(std::shared_ptr<AsyncCompletionQueue> queue, uint64 callbackId)
+    {
+        _queue = std::move(queue);
+        _callbackId = callbackId;
+        uint8 expected = Pending;
+        return _state.compare_exchange_strong(expected, Subscribed, std::memory_order_acq_rel);
+    }
+
+private:
+    enum State : uint8
+    {
+        Pending,
+        Subscribed,
+        Completed
+    };
+
+    std::atomic<uint8> _state;
+    std::shared_ptr<AsyncCompletionQueue> _queue;
+    uint64 _callbackId;
+};
+
+// std::promise completing a signal when its value is set, or when it is destroyed without one (the future then holds broken_promise)
+template<typename Result>
+class AsyncCompletionPromise
+{
+public:
+    AsyncCompletionPromise() : _signal(std::make_shared<AsyncCompletionSignal>()) { }
+
+    AsyncCompletionPromise(AsyncCompletionPromise&&) noexcept = default;
+    AsyncCompletionPromise& operator=(AsyncCompletionPromise&&) = delete;
+
+    ~AsyncCompletionPromise()
+    {
+        if (_signal)
+        {
+            // the future has to be ready before the signal goes off
+            { std::promise<Result> abandoned(std::move(_promise)); }
+            _signal->Complete();
+        }
+    }
+
+    std::future<Result> GetFuture() { return _promise.get_future(); }
+    std::shared_ptr<AsyncCompletionSignal> const& GetSignal() const { return _signal; }
+
+    template<typename... Args>
+    void SetValue(Args&&... args)
+    {
+        _promise.set_value(std::forward<Args>(args)...);
+        std::exchange(_signal, nullptr)->Complete();
+    }
+
+private:
+    std::promise<Result> _promise;
+    std::shared_ptr<AsyncCompletionSignal> _signal;
+};
+
+#endif // TRINITYCORE_ASYNC_COMPLETION_SIGNAL_H
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CaseFoldedName.h"
+#include "Util.h"
+#include <utf8.h>
+
+namespace
+{
+// decodes the next character of str and lowers it, false at the end and on invalid UTF-8
+bool NextFoldedCharacter(std::string_view::const_iterator& itr, std::string_view::const_iterator end, uint32& character)
+{
+    if (itr == end)
+        return false;
+
+    utf8::utfchar32_t codePoint = 0;
+    if (utf8::internal::validate_next(itr, end, codePoint) != utf8::internal::UTF8_OK)
+        return false;
+
+    // normalizePlayerName works on UTF-16, characters outside of the BMP are never changed by wcharToLower there
+    character = codePoint <= 0xFFFF ? uint32(uint16(wcharToLower(wchar_t(codePoint)))) : uint32(codePoint);
+    return true;
+}
+}
+
+std::size_t Trinity::CaseFoldedNameHash::operator()(std::string_view name) const
+{
+    uint64 hash = UI64LIT(0xCBF29CE484222325);
+    uint32 character;
+    for (auto itr = name.begin(); NextFoldedCharacter(itr, name.end(), character);)
+    {
+        hash ^= character;
+        hash *= UI64LIT(0x100000001B3);
+    }
+
+    return std::size_t(hash);
+}
+
+bool Trinity::CaseFoldedNameEqual::operator()(std::string_view left, std::string_view right) const
+{
+    auto leftItr = left.begin();
+    auto rightItr = right.begin();
+    for (;;)
+    {
+        uint32 leftCharacter = 0, rightCharacter = 0;
+        bool hasLeft = NextFoldedCharacter(leftItr, left.end(), leftCharacter);
+        bool hasRight = NextFoldedCharacter(rightItr, right.end(), rightCharacter);
+        if (!hasLeft || !hasRight)
+            return !hasLeft && !hasRight && leftItr == left.end() && rightItr == right.end();
+
+        if (leftCharacter != rightCharacter)
+            return false;
+    }
+}
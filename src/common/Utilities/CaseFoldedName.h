@@ -0,0 +1,47 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_CASE_FOLDED_NAME_H
+#define TRINITYCORE_CASE_FOLDED_NAME_H
+
+#include "Define.h"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Trinity
+{
+// Hash and equality of UTF-8 names ignoring case the same way normalizePlayerName does (wcharToLower of every character),
+// containers keyed by normalized names can be searched with any spelling of the name without normalizing or allocating it.
+// Invalid UTF-8 never equals anything.
+struct CaseFoldedNameHash
+{
+    using is_transparent = void;
+    TC_COMMON_API std::size_t operator()(std::string_view name) const;
+};
+
+struct CaseFoldedNameEqual
+{
+    using is_transparent = void;
+    TC_COMMON_API bool operator()(std::string_view left, std::string_view right) const;
+};
+
+template <class T>
+using CaseFoldedNameMap = std::unordered_map<std::string, T, CaseFoldedNameHash, CaseFoldedNameEqual>;
+}
+
+#endif // TRINITYCORE_CASE_FOLDED_NAME_H
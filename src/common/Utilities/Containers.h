@@ -170,7 +170,11 @@ namespace Trinity
         template <std::random_access_iterator Iterator>
         inline void RandomShuffle(Iterator begin, Iterator end)
         {
-            std::ranges::shuffle(begin, end, RandomEngine());
+            // large ranges take a random number for every one or two elements
+            if (std::distance(begin, end) > std::ptrdiff_t(BufferedRandomEngine::BufferSize * 2))
+                std::ranges::shuffle(begin, end, BufferedRandomEngine());
+            else
+                std::ranges::shuffle(begin, end, RandomEngine());
         }
 
         /**
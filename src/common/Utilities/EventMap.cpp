@@ -17,6 +17,7 @@
 
 #include "EventMap.h"
 #include "Random.h"
+#include <algorithm>
 
 EventMap::EventMap(EventMap const& other) = default;
 EventMap& EventMap::operator=(EventMap const& other) = default;
@@ -29,6 +30,12 @@ void EventMap::Reset()
     _phase = 0;
 }
 
+void EventMap::Insert(TimePoint time, uint32 eventData)
+{
+    auto itr = std::ranges::lower_bound(_eventMap, time, std::ranges::greater(), &Event::Time);
+    _eventMap.insert(itr, Event{ .Time = time, .Data = eventData });
+}
+
 void EventMap::SetPhase(uint8 phase)
 {
     if (!phase)
@@ -45,7 +52,7 @@ void EventMap::ScheduleEvent(uint32 eventId, Milliseconds time, uint32 group /*=
     if (phase && phase <= 8)
         eventId |= (1 << (phase + 23));
 
-    _eventMap.insert({ _time + time, eventId });
+    Insert(_time + time, eventId);
 }
 
 void EventMap::ScheduleEvent(uint32 eventId, Milliseconds minTime, Milliseconds maxTime, uint32 group /*= 0*/, uint8 phase /*= 0*/)
@@ -66,7 +73,7 @@ void EventMap::RescheduleEvent(uint32 eventId, Milliseconds minTime, Millisecond
 
 void EventMap::Repeat(Milliseconds time)
 {
-    _eventMap.insert(EventStore::value_type(_time + time, _lastEvent));
+    Insert(_time + time, _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
@@ -78,17 +85,17 @@ uint32 EventMap::ExecuteEvent()
 {
     while (!Empty())
     {
-        EventStore::iterator itr = _eventMap.begin();
+        Event const& event = _eventMap.back();
 
-        if (itr->first > _time)
+        if (event.Time > _time)
             return 0;
-        else if (_phase && (itr->second & 0xFF000000) && !((itr->second >> 24) & _phase))
-            _eventMap.erase(itr);
+        else if (_phase && (event.Data & 0xFF000000) && !((event.Data >> 24) & _phase))
+            _eventMap.pop_back();
         else
         {
-            uint32 eventId = (itr->second & 0x0000FFFF);
-            _lastEvent = itr->second; // include phase/group
-            _eventMap.erase(itr);
+            uint32 eventId = (event.Data & 0x0000FFFF);
+            _lastEvent = event.Data; // include phase/group
+            _eventMap.pop_back();
             ScheduleNextFromSeries(_lastEvent);
             return eventId;
         }
@@ -102,13 +109,8 @@ void EventMap::DelayEvents(Milliseconds delay)
     if (Empty())
         return;
 
-    EventStore delayed = std::move(_eventMap);
-    for (EventStore::iterator itr = delayed.begin(); itr != delayed.end();)
-    {
-        EventStore::node_type node = delayed.extract(itr++);
-        node.key() += delay;
-        _eventMap.insert(_eventMap.end(), std::move(node));
-    }
+    for (Event& event : _eventMap)
+        event.Time += delay;
 }
 
 void EventMap::DelayEvents(Milliseconds delay, uint32 group)
@@ -116,20 +118,19 @@ void EventMap::DelayEvents(Milliseconds delay, uint32 group)
     if (!group || group > 8 || Empty())
         return;
 
+    // delayed events go after the others scheduled for the same time, in the order they had
     EventStore delayed;
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [&](Event const& event)
     {
-        if (itr->second & (1 << (group + 15)))
-        {
-            EventStore::node_type node = _eventMap.extract(itr++);
-            node.key() += delay;
-            delayed.insert(delayed.end(), std::move(node));
-        }
-        else
-            ++itr;
-    }
+        if (!(event.Data & (1 << (group + 15))))
+            return false;
 
-    _eventMap.merge(delayed);
+        delayed.push_back(event);
+        return true;
+    }), _eventMap.end());
+
+    for (auto itr = delayed.rbegin(); itr != delayed.rend(); ++itr)
+        Insert(itr->Time + delay, itr->Data);
 }
 
 void EventMap::CancelEvent(uint32 eventId)
@@ -137,13 +138,7 @@ void EventMap::CancelEvent(uint32 eventId)
     if (Empty())
         return;
 
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (eventId == (itr->second & 0x0000FFFF))
-            _eventMap.erase(itr++);
-        else
-            ++itr;
-    }
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [eventId](Event const& event) { return eventId == (event.Data & 0x0000FFFF); }), _eventMap.end());
 
     for (EventSeriesStore::iterator itr = _timerSeries.begin(); itr != _timerSeries.end();)
     {
@@ -159,13 +154,7 @@ void EventMap::CancelEventGroup(uint32 group)
     if (!group || group > 8 || Empty())
         return;
 
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (itr->second & (1 << (group + 15)))
-            _eventMap.erase(itr++);
-        else
-            ++itr;
-    }
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [group](Event const& event) { return (event.Data & (1 << (group + 15))) != 0; }), _eventMap.end());
 
     for (EventSeriesStore::iterator itr = _timerSeries.begin(); itr != _timerSeries.end();)
     {
@@ -178,9 +167,9 @@ void EventMap::CancelEventGroup(uint32 group)
 
 Milliseconds EventMap::GetTimeUntilEvent(uint32 eventId) const
 {
-    for (std::pair<TimePoint const, uint32> const& itr : _eventMap)
-        if (eventId == (itr.second & 0x0000FFFF))
-            return std::chrono::duration_cast<Milliseconds>(itr.first - _time);
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (eventId == (itr->Data & 0x0000FFFF))
+            return std::chrono::duration_cast<Milliseconds>(itr->Time - _time);
 
     return Milliseconds::max();
 }
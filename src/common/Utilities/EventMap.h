@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "Duration.h"
+#include <boost/container/small_vector.hpp>
 #include <map>
 #include <vector>
 
@@ -27,8 +28,8 @@ class TC_COMMON_API EventMap
 {
     /**
     * Internal storage type.
-    * Key: Time as TimePoint when the event should occur.
-    * Value: The event data as uint32.
+    * Time: TimePoint when the event should occur.
+    * Data: The event data as uint32.
     *
     * Structure of event data:
     * - Bit  0 - 15: Event Id.
@@ -36,7 +37,19 @@ class TC_COMMON_API EventMap
     * - Bit 24 - 31: Phase
     * - Pattern: 0xPPGGEEEE
     */
-    typedef std::multimap<TimePoint, uint32> EventStore;
+    struct Event
+    {
+        TimePoint Time;
+        uint32 Data;
+    };
+
+    /**
+    * Events sorted by descending time, the next event to execute is the last one.
+    * Events of the same time execute in the order they were scheduled in.
+    * Scripts rarely have more than a handful of events scheduled at once,
+    * those are kept inside the map without allocating.
+    */
+    typedef boost::container::small_vector<Event, 16> EventStore;
     typedef std::map<uint32 /*event data*/, std::vector<Milliseconds>> EventSeriesStore;
 
 public:
@@ -258,6 +271,14 @@ public:
     void ScheduleEventSeries(uint32 eventId, std::initializer_list<Milliseconds> series);
 
 private:
+    /**
+    * @name Insert
+    * @brief Adds an event after all events scheduled for the same time.
+    * @param time Time at which the event occurs.
+    * @param eventData Full event data, including group and phase.
+    */
+    void Insert(TimePoint time, uint32 eventData);
+
     /**
     * @name _time
     * @brief Internal timer.
@@ -17,6 +17,8 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include <algorithm>
+#include <vector>
 
 void BasicEvent::ScheduleAbort()
 {
@@ -42,13 +44,17 @@ void EventProcessor::Update(uint32 p_time)
     // update time
     m_time += p_time;
 
-    // main event loop
-    std::multimap<uint64, BasicEvent*>::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    // most units have no events, the wheel does not need to step through the elapsed ticks then
+    if (!m_eventCount)
     {
-        // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        m_events.SkipTo(m_time);
+        return;
+    }
+
+    // main event loop, events are taken out of the wheel in execution time order
+    while (BasicEvent* event = m_events.PopExpired(m_time))
+    {
+        --m_eventCount;
 
         if (event->IsRunning())
         {
@@ -81,33 +87,31 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    std::vector<BasicEvent*> events;
+    events.reserve(m_eventCount);
+    m_events.ForEach([&](BasicEvent* event) { events.push_back(event); });
+
+    // abort in execution time order
+    std::ranges::stable_sort(events, {}, &BasicEvent::m_execTime);
+
+    for (BasicEvent* event : events)
     {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
-        {
-            ++itr;
+        if (!force && !event->IsDeletable())
             continue;
-        }
 
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        m_events.Cancel(event);
+        --m_eventCount;
+        delete event;
     }
-
-    if (force)
-        m_events.clear();
 }
 
 void EventProcessor::AddEvent(BasicEvent* event, Milliseconds e_time, bool set_addtime)
@@ -115,19 +119,17 @@ void EventProcessor::AddEvent(BasicEvent* event, Milliseconds e_time, bool set_a
     if (set_addtime)
         event->m_addTime = m_time;
     event->m_execTime = e_time.count();
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time.count(), event));
+    if (!event->IsScheduled())
+        ++m_eventCount;
+    m_events.Schedule(event, event->m_execTime);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    // only events waiting in this processor can be moved
+    if (!event->IsScheduled())
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    event->m_execTime = newTime.count();
+    m_events.Schedule(event, event->m_execTime);
 }
@@ -21,15 +21,15 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
+#include "TimerWheel.h"
 #include <concepts>
-#include <map>
 #include <type_traits>
 
 class EventProcessor;
 
 // Note. All times are in milliseconds here.
 
-class TC_COMMON_API BasicEvent
+class TC_COMMON_API BasicEvent : public Trinity::Containers::TimerWheelNode
 {
         friend class EventProcessor;
 
@@ -87,10 +87,11 @@ private:
     T _callback;
 };
 
+// Events are linked into a timer wheel of millisecond ticks, adding one neither allocates nor searches
 class TC_COMMON_API EventProcessor
 {
     public:
-        EventProcessor() : m_time(0) { }
+        EventProcessor() : m_time(0), m_events(0), m_eventCount(0) { }
         EventProcessor(EventProcessor const&) = delete;
         EventProcessor(EventProcessor&&) = delete;
         EventProcessor& operator=(EventProcessor const&) = delete;
@@ -111,11 +112,14 @@ class TC_COMMON_API EventProcessor
         void AddEventAtOffset(T&& event, Milliseconds offset, Milliseconds offset2) { AddEventAtOffset(new LambdaBasicEvent<T>(std::forward<T>(event)), offset, offset2); }
         void ModifyEventTime(BasicEvent* event, Milliseconds newTime);
         Milliseconds CalculateTime(Milliseconds t_offset) const { return Milliseconds(m_time) + t_offset; }
-        std::multimap<uint64, BasicEvent*> const& GetEvents() const { return m_events; }
+        template<std::invocable<BasicEvent*> Visitor>
+        void ForEachEvent(Visitor&& visitor) const { m_events.ForEach(std::forward<Visitor>(visitor)); }
+        std::size_t GetEventCount() const { return m_eventCount; }
 
     protected:
         uint64 m_time;
-        std::multimap<uint64, BasicEvent*> m_events;
+        Trinity::Containers::TimerWheel<BasicEvent> m_events;
+        std::size_t m_eventCount;
 };
 
 #endif
@@ -0,0 +1,215 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MallocControl.h"
+#include <string>
+
+#ifdef TRINITY_USE_JEMALLOC
+#include <jemalloc/jemalloc.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#endif
+
+namespace Trinity::MallocControl
+{
+#ifdef TRINITY_USE_JEMALLOC
+namespace
+{
+template <class T>
+bool Read(std::string const& name, T& value)
+{
+    std::size_t size = sizeof(T);
+    return mallctl(name.c_str(), &value, &size, nullptr, 0) == 0 && size == sizeof(T);
+}
+
+template <class T>
+bool Write(std::string const& name, T value)
+{
+    return mallctl(name.c_str(), nullptr, nullptr, &value, sizeof(T)) == 0;
+}
+
+std::string ArenaName(uint32 arena, char const* name)
+{
+    return "arena." + std::to_string(arena) + '.' + name;
+}
+
+std::string ArenaStatName(uint32 arena, char const* name)
+{
+    return "stats.arenas." + std::to_string(arena) + '.' + name;
+}
+
+extent_hooks_t* DefaultHooks = nullptr;
+extent_hooks_t HugePageHooks;
+
+void* AllocateHugePageExtent(extent_hooks_t* /*hooks*/, void* address, std::size_t size, std::size_t alignment, bool* zero, bool* commit, unsigned arena)
+{
+    void* extent = DefaultHooks->alloc(DefaultHooks, address, size, alignment, zero, commit, arena);
+    if (extent)
+        madvise(extent, size, MADV_HUGEPAGE);
+
+    return extent;
+}
+}
+
+bool IsAvailable()
+{
+    uint32 arenas = 0;
+    return Read("arenas.narenas", arenas);
+}
+
+bool SetBackgroundThreads(bool enable)
+{
+    return Write("background_thread", enable);
+}
+
+bool SetDecayTime(Milliseconds decayTime)
+{
+    // pages are kept as dirty only, the muzzy state in between is disabled by default
+    ssize_t decayMs = decayTime.count();
+    if (!Write("arenas.dirty_decay_ms", decayMs))
+        return false;
+
+    // arenas not created yet fail, they take the default set above
+    uint32 arenas = 0;
+    Read("arenas.narenas", arenas);
+    for (uint32 arena = 0; arena < arenas; ++arena)
+        Write(ArenaName(arena, "dirty_decay_ms"), decayMs);
+
+    return true;
+}
+
+Optional<uint32> CreateArena(bool hugePages)
+{
+    uint32 arena = 0;
+    std::size_t size = sizeof(arena);
+    if (!hugePages)
+    {
+        if (mallctl("arenas.create", &arena, &size, nullptr, 0))
+            return {};
+
+        return arena;
+    }
+
+    if (!DefaultHooks)
+    {
+        if (!Read("arena.0.extent_hooks", DefaultHooks))
+            return {};
+
+        HugePageHooks = *DefaultHooks;
+        HugePageHooks.alloc = &AllocateHugePageExtent;
+    }
+
+    extent_hooks_t* hooks = &HugePageHooks;
+    if (mallctl("arenas.create", &arena, &size, &hooks, sizeof(hooks)))
+        return {};
+
+    return arena;
+}
+
+Optional<uint32> GetCurrentThreadArena()
+{
+    uint32 arena = 0;
+    if (!Read("thread.arena", arena))
+        return {};
+
+    return arena;
+}
+
+bool SetCurrentThreadArena(uint32 arena)
+{
+    return Write("thread.arena", arena);
+}
+
+Optional<Stats> GetStats()
+{
+    // statistics are only refreshed when the epoch changes
+    uint64 epoch = 1;
+    std::size_t size = sizeof(epoch);
+    if (mallctl("epoch", &epoch, &size, &epoch, size))
+        return {};
+
+    std::size_t pageSize = 0;
+    uint32 arenas = 0;
+    if (!Read("arenas.page", pageSize) || !Read("arenas.narenas", arenas))
+        return {};
+
+    // byte counts need jemalloc built with statistics, they stay 0 otherwise
+    Stats stats;
+    std::size_t value = 0;
+    if (Read("stats.allocated", value))
+        stats.AllocatedBytes = value;
+    if (Read("stats.active", value))
+        stats.ActiveBytes = value;
+    if (Read("stats.resident", value))
+        stats.ResidentBytes = value;
+    if (Read("stats.mapped", value))
+        stats.MappedBytes = value;
+    if (Read("stats.retained", value))
+        stats.RetainedBytes = value;
+
+    for (uint32 arena = 0; arena < arenas; ++arena)
+    {
+        bool initialized = false;
+        if (!Read(ArenaName(arena, "initialized"), initialized) || !initialized)
+            continue;
+
+        ArenaStats& arenaStats = stats.Arenas.emplace_back();
+        arenaStats.Index = arena;
+
+        uint32 threads = 0;
+        if (Read(ArenaStatName(arena, "nthreads"), threads))
+            arenaStats.Threads = threads;
+        if (Read(ArenaStatName(arena, "pactive"), value))
+            arenaStats.ActiveBytes = uint64(value) * pageSize;
+        if (Read(ArenaStatName(arena, "pdirty"), value))
+            arenaStats.DirtyBytes = uint64(value) * pageSize;
+        if (Read(ArenaStatName(arena, "pmuzzy"), value))
+            arenaStats.MuzzyBytes = uint64(value) * pageSize;
+        if (Read(ArenaStatName(arena, "small.allocated"), value))
+            arenaStats.AllocatedBytes += value;
+        if (Read(ArenaStatName(arena, "large.allocated"), value))
+            arenaStats.AllocatedBytes += value;
+    }
+
+    return stats;
+}
+#else
+bool IsAvailable() { return false; }
+bool SetBackgroundThreads(bool /*enable*/) { return false; }
+bool SetDecayTime(Milliseconds /*decayTime*/) { return false; }
+Optional<uint32> CreateArena(bool /*hugePages*/) { return {}; }
+Optional<uint32> GetCurrentThreadArena() { return {}; }
+bool SetCurrentThreadArena(uint32 /*arena*/) { return false; }
+Optional<Stats> GetStats() { return {}; }
+#endif
+
+ScopedThreadArena::ScopedThreadArena(Optional<uint32> arena)
+{
+    if (!arena)
+        return;
+
+    _previousArena = GetCurrentThreadArena();
+    if (_previousArena && !SetCurrentThreadArena(*arena))
+        _previousArena.reset();
+}
+
+ScopedThreadArena::~ScopedThreadArena()
+{
+    if (_previousArena)
+        SetCurrentThreadArena(*_previousArena);
+}
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_MALLOC_CONTROL_H
+#define TRINITY_MALLOC_CONTROL_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "Optional.h"
+#include <vector>
+
+/*
+ * Runtime controls of the bundled jemalloc, every function fails (false or an empty optional)
+ * on builds using the system allocator.
+ */
+namespace Trinity::MallocControl
+{
+struct ArenaStats
+{
+    uint32 Index = 0;
+    uint32 Threads = 0;
+    uint64 AllocatedBytes = 0;      // in use by the application
+    uint64 ActiveBytes = 0;         // pages holding allocations
+    uint64 DirtyBytes = 0;          // freed pages not yet returned to the system
+    uint64 MuzzyBytes = 0;          // freed pages returned lazily, the system may still count them as resident
+};
+
+struct Stats
+{
+    uint64 AllocatedBytes = 0;
+    uint64 ActiveBytes = 0;
+    uint64 ResidentBytes = 0;
+    uint64 MappedBytes = 0;
+    uint64 RetainedBytes = 0;       // address space kept for reuse, not resident
+    std::vector<ArenaStats> Arenas;
+};
+
+TC_COMMON_API bool IsAvailable();
+
+// Threads purging unused pages in the background instead of the threads that free memory
+TC_COMMON_API bool SetBackgroundThreads(bool enable);
+
+// How long freed pages are kept for reuse before they are returned to the system, for all arenas and the ones created later
+TC_COMMON_API bool SetDecayTime(Milliseconds decayTime);
+
+// hugePages: memory of the arena is advised to be backed by transparent huge pages
+TC_COMMON_API Optional<uint32> CreateArena(bool hugePages);
+
+TC_COMMON_API Optional<uint32> GetCurrentThreadArena();
+TC_COMMON_API bool SetCurrentThreadArena(uint32 arena);
+
+TC_COMMON_API Optional<Stats> GetStats();
+
+// Allocations of the current thread go to arena until the guard is destroyed
+class TC_COMMON_API ScopedThreadArena
+{
+public:
+    explicit ScopedThreadArena(Optional<uint32> arena);
+    ~ScopedThreadArena();
+
+    ScopedThreadArena(ScopedThreadArena const&) = delete;
+    ScopedThreadArena(ScopedThreadArena&&) = delete;
+    ScopedThreadArena& operator=(ScopedThreadArena const&) = delete;
+    ScopedThreadArena& operator=(ScopedThreadArena&&) = delete;
+
+private:
+    Optional<uint32> _previousArena;
+};
+}
+
+#endif // TRINITY_MALLOC_CONTROL_H
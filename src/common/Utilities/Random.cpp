@@ -72,6 +72,11 @@ uint32 rand32()
     return GetRng()->RandomUInt32();
 }
 
+void rand32(std::span<uint32> values)
+{
+    GetRng()->RandomUInt32(values);
+}
+
 float rand_norm()
 {
     std::uniform_real_distribution<float> urd;
@@ -20,7 +20,9 @@
 
 #include "Define.h"
 #include "Duration.h"
+#include <array>
 #include <limits>
+#include <span>
 
 /* Return a random number in the range min..max. */
 TC_COMMON_API int32 irand(int32 min, int32 max);
@@ -34,6 +36,9 @@ TC_COMMON_API uint32 urandms(uint32 min, uint32 max);
 /* Return a random number in the range 0 .. UINT32_MAX. */
 TC_COMMON_API uint32 rand32();
 
+/* Fill values with random numbers in the range 0 .. UINT32_MAX, cheaper than calling rand32() for each of them. */
+TC_COMMON_API void rand32(std::span<uint32> values);
+
 /* Return a random time in the range min..max (up to millisecond precision). Only works for values where millisecond difference is a valid uint32. */
 TC_COMMON_API Milliseconds randtime(Milliseconds min, Milliseconds max);
 
@@ -74,4 +79,34 @@ public:
     result_type operator()() const { return rand32(); }
 };
 
+/*
+* RandomEngine drawing its numbers BufferSize at a time, for algorithms taking a lot of them in a row
+* (shuffling large containers, many values of one distribution). Numbers left when it is destroyed are lost.
+* The buffer is large and aligned enough for SFMT to generate it in place.
+*/
+class BufferedRandomEngine
+{
+public:
+    typedef uint32 result_type;
+
+    static constexpr std::size_t BufferSize = 1024;
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()()
+    {
+        if (_index == BufferSize)
+        {
+            rand32(_buffer);
+            _index = 0;
+        }
+
+        return _buffer[_index++];
+    }
+
+private:
+    alignas(16) std::array<uint32, BufferSize> _buffer;
+    std::size_t _index = BufferSize;
+};
+
 #endif // Random_h__
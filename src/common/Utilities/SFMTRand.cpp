@@ -36,7 +36,26 @@ SFMTRand::SFMTRand() noexcept
         sfmt_init_gen_rand(&_state, uint32(time(nullptr)));
 }
 
-uint32 SFMTRand::RandomUInt32() noexcept                            // Output random bits
+SFMTRand::SFMTRand(uint32 seed) noexcept
 {
-    return sfmt_genrand_uint32(&_state);
+    sfmt_init_gen_rand(&_state, seed);
+}
+
+void SFMTRand::RandomUInt32(std::span<uint32> values) noexcept
+{
+    // the rest of the current block first, sfmt_fill_array32 continues at block boundaries only
+    std::size_t i = 0;
+    for (; i < values.size() && _state.idx < SFMT_N32; ++i)
+        values[i] = sfmt_genrand_uint32(&_state);
+
+    // sfmt_fill_array32 writes the array as 128 bit words, at least a whole block of them
+    std::size_t blockSize = (values.size() - i) & ~std::size_t(3);
+    if (blockSize >= std::size_t(SFMT_N32) && reinterpret_cast<std::uintptr_t>(values.data() + i) % alignof(w128_t) == 0)
+    {
+        sfmt_fill_array32(&_state, values.data() + i, int(blockSize));
+        i += blockSize;
+    }
+
+    for (; i < values.size(); ++i)
+        values[i] = sfmt_genrand_uint32(&_state);
 }
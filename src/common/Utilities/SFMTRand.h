@@ -21,6 +21,7 @@
 #include "Define.h"
 #include <SFMT.h>
 #include <new>
+#include <span>
 
 /*
  * C++ Wrapper for SFMT
@@ -28,7 +29,9 @@
 class SFMTRand {
 public:
     SFMTRand() noexcept;
-    uint32 RandomUInt32() noexcept; // Output random bits
+    explicit SFMTRand(uint32 seed) noexcept;
+    uint32 RandomUInt32() noexcept { return sfmt_genrand_uint32(&_state); } // Output random bits
+    void RandomUInt32(std::span<uint32> values) noexcept;   // Same as calling RandomUInt32 for every value, large aligned arrays are generated in place
     void* operator new(size_t size) noexcept { return ::operator new (size, std::align_val_t(alignof(SFMTRand)), std::nothrow); }
     void operator delete(void* ptr) noexcept { ::operator delete (ptr, std::align_val_t(alignof(SFMTRand)), std::nothrow); }
     void* operator new[](size_t size) noexcept { return ::operator new[](size, std::align_val_t(alignof(SFMTRand)), std::nothrow); }
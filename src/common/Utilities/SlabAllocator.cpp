@@ -0,0 +1,243 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SlabAllocator.h"
+#include "Errors.h"
+#include <algorithm>
+#include <new>
+
+namespace Trinity
+{
+namespace
+{
+constexpr std::size_t AlignUp(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+constexpr std::align_val_t SlotAlignment = std::align_val_t(SlabAllocator::HeaderSize);
+}
+
+struct SlabAllocator::Slab
+{
+    SlabAllocator* Owner;
+    Slab* Prev;
+    Slab* Next;
+    void* FreeList;
+    std::size_t LiveObjects;
+    bool Partial;
+};
+
+// stored in the HeaderSize bytes before every object, nullptr for objects too big to be pooled
+struct SlotHeader
+{
+    void* Slab;
+};
+
+static_assert(sizeof(SlotHeader) <= SlabAllocator::HeaderSize);
+
+SlabAllocator::SlabAllocator(std::size_t objectSize, std::size_t objectsPerSlab)
+    : _objectSize(objectSize), _slotSize(HeaderSize + AlignUp(std::max(objectSize, sizeof(void*)), HeaderSize)),
+    _objectsPerSlab(std::max<std::size_t>(objectsPerSlab, 1)), _partialSlabs(nullptr), _emptySlabs(0)
+{
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    // objects still alive at this point are leaked by their owners, only empty slabs are freed
+    while (_partialSlabs && !_partialSlabs->LiveObjects)
+    {
+        Slab* slab = _partialSlabs;
+        UnlinkPartial(slab);
+        FreeSlab(slab);
+    }
+}
+
+void* SlabAllocator::Allocate()
+{
+    std::scoped_lock lock(_lock);
+
+    Slab* slab = _partialSlabs;
+    if (!slab)
+    {
+        slab = CreateSlab();
+        LinkPartial(slab);
+    }
+
+    if (!slab->LiveObjects)
+        --_emptySlabs;
+
+    void* slot = slab->FreeList;
+    slab->FreeList = *static_cast<void**>(slot);
+    ++slab->LiveObjects;
+    ++_stats.Objects;
+
+    if (!slab->FreeList)
+        UnlinkPartial(slab);
+
+    return slot;
+}
+
+void SlabAllocator::Deallocate(void* ptr)
+{
+    Slab* slab = static_cast<Slab*>(reinterpret_cast<SlotHeader*>(static_cast<std::byte*>(ptr) - HeaderSize)->Slab);
+    slab->Owner->Release(slab, ptr);
+}
+
+SlabAllocator::Stats SlabAllocator::GetStats() const
+{
+    std::scoped_lock lock(_lock);
+    return _stats;
+}
+
+SlabAllocator::Slab* SlabAllocator::CreateSlab()
+{
+    std::size_t slabHeaderSize = AlignUp(sizeof(Slab), HeaderSize);
+    std::byte* memory = static_cast<std::byte*>(::operator new(slabHeaderSize + _slotSize * _objectsPerSlab, SlotAlignment));
+
+    Slab* slab = new (memory) Slab{ .Owner = this, .Prev = nullptr, .Next = nullptr, .FreeList = nullptr, .LiveObjects = 0, .Partial = false };
+
+    // thread the free list in address order so consecutive allocations are adjacent
+    std::byte* slots = memory + slabHeaderSize;
+    for (std::size_t i = _objectsPerSlab; i > 0; --i)
+    {
+        std::byte* slot = slots + (i - 1) * _slotSize;
+        new (slot) SlotHeader{ .Slab = slab };
+        void* object = slot + HeaderSize;
+        *static_cast<void**>(object) = slab->FreeList;
+        slab->FreeList = object;
+    }
+
+    ++_stats.Slabs;
+    ++_emptySlabs;
+    return slab;
+}
+
+void SlabAllocator::FreeSlab(Slab* slab)
+{
+    --_stats.Slabs;
+    --_emptySlabs;
+    slab->~Slab();
+    ::operator delete(static_cast<void*>(slab), SlotAlignment);
+}
+
+void SlabAllocator::Release(Slab* slab, void* slot)
+{
+    std::scoped_lock lock(_lock);
+
+    ASSERT(slab->LiveObjects);
+
+    *static_cast<void**>(slot) = slab->FreeList;
+    slab->FreeList = slot;
+    --slab->LiveObjects;
+    --_stats.Objects;
+
+    if (!slab->Partial)
+        LinkPartial(slab);
+
+    if (slab->LiveObjects)
+        return;
+
+    ++_emptySlabs;
+    if (_emptySlabs > 1)
+    {
+        UnlinkPartial(slab);
+        FreeSlab(slab);
+    }
+}
+
+void SlabAllocator::LinkPartial(Slab* slab)
+{
+    slab->Prev = nullptr;
+    slab->Next = _partialSlabs;
+    if (_partialSlabs)
+        _partialSlabs->Prev = slab;
+
+    _partialSlabs = slab;
+    slab->Partial = true;
+}
+
+void SlabAllocator::UnlinkPartial(Slab* slab)
+{
+    if (slab->Prev)
+        slab->Prev->Next = slab->Next;
+    else
+        _partialSlabs = slab->Next;
+
+    if (slab->Next)
+        slab->Next->Prev = slab->Prev;
+
+    slab->Prev = nullptr;
+    slab->Next = nullptr;
+    slab->Partial = false;
+}
+
+SlabPool::SlabPool(std::size_t slabSize) : _slabSize(slabSize)
+{
+}
+
+SlabPool::~SlabPool() = default;
+
+void* SlabPool::Allocate(std::size_t size)
+{
+    if (size > MaxObjectSize)
+    {
+        std::byte* memory = static_cast<std::byte*>(::operator new(SlabAllocator::HeaderSize + size, SlotAlignment));
+        new (memory) SlotHeader{ .Slab = nullptr };
+        return memory + SlabAllocator::HeaderSize;
+    }
+
+    std::size_t sizeClass = AlignUp(size, SizeClassGranularity);
+
+    SlabAllocator* allocator;
+    {
+        std::scoped_lock lock(_lock);
+        std::unique_ptr<SlabAllocator>& sizeClassAllocator = _sizeClasses[sizeClass];
+        if (!sizeClassAllocator)
+            sizeClassAllocator = std::make_unique<SlabAllocator>(sizeClass, _slabSize / (SlabAllocator::HeaderSize + sizeClass));
+
+        allocator = sizeClassAllocator.get();
+    }
+
+    return allocator->Allocate();
+}
+
+void SlabPool::Deallocate(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    std::byte* slot = static_cast<std::byte*>(ptr) - SlabAllocator::HeaderSize;
+    if (reinterpret_cast<SlotHeader*>(slot)->Slab)
+        SlabAllocator::Deallocate(ptr);
+    else
+        ::operator delete(static_cast<void*>(slot), SlotAlignment);
+}
+
+SlabAllocator::Stats SlabPool::GetStats() const
+{
+    SlabAllocator::Stats stats;
+    std::scoped_lock lock(_lock);
+    for (auto const& [sizeClass, allocator] : _sizeClasses)
+    {
+        SlabAllocator::Stats sizeClassStats = allocator->GetStats();
+        stats.Slabs += sizeClassStats.Slabs;
+        stats.Objects += sizeClassStats.Objects;
+    }
+    return stats;
+}
+}
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_SLAB_ALLOCATOR_H
+#define TRINITY_SLAB_ALLOCATOR_H
+
+#include "Define.h"
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace Trinity
+{
+/*
+ * Fixed size allocator carving objects out of large slabs, objects allocated in sequence
+ * (like everything spawned by a grid load) end up next to each other in memory.
+ * Slabs that become empty are returned to the system right away, except for one kept
+ * around to absorb allocate/free churn (respawns).
+ *
+ * Thread safe, objects may be freed from any thread.
+ */
+class TC_COMMON_API SlabAllocator
+{
+public:
+    struct Stats
+    {
+        std::size_t Slabs = 0;
+        std::size_t Objects = 0;
+    };
+
+    SlabAllocator(std::size_t objectSize, std::size_t objectsPerSlab);
+    ~SlabAllocator();
+
+    SlabAllocator(SlabAllocator const&) = delete;
+    SlabAllocator(SlabAllocator&&) = delete;
+    SlabAllocator& operator=(SlabAllocator const&) = delete;
+    SlabAllocator& operator=(SlabAllocator&&) = delete;
+
+    void* Allocate();
+
+    // ptr must come from Allocate of any SlabAllocator
+    static void Deallocate(void* ptr);
+
+    std::size_t GetObjectSize() const { return _objectSize; }
+    Stats GetStats() const;
+
+    // space reserved in front of every object, shared with SlabPool
+    static constexpr std::size_t HeaderSize = alignof(std::max_align_t);
+
+private:
+    struct Slab;
+
+    Slab* CreateSlab();
+    void FreeSlab(Slab* slab);
+    void Release(Slab* slab, void* slot);
+
+    void LinkPartial(Slab* slab);
+    void UnlinkPartial(Slab* slab);
+
+    std::size_t _objectSize;
+    std::size_t _slotSize;
+    std::size_t _objectsPerSlab;
+    mutable std::mutex _lock;
+    Slab* _partialSlabs;        // slabs with at least one free slot
+    std::size_t _emptySlabs;
+    Stats _stats;
+};
+
+/*
+ * Routes allocations of various sizes to a SlabAllocator per size class.
+ * Sizes above MaxObjectSize go to the global operator new.
+ */
+class TC_COMMON_API SlabPool
+{
+public:
+    static constexpr std::size_t SizeClassGranularity = 64;
+    static constexpr std::size_t MaxObjectSize = 64 * 1024;
+
+    explicit SlabPool(std::size_t slabSize = 256 * 1024);
+    ~SlabPool();
+
+    SlabPool(SlabPool const&) = delete;
+    SlabPool(SlabPool&&) = delete;
+    SlabPool& operator=(SlabPool const&) = delete;
+    SlabPool& operator=(SlabPool&&) = delete;
+
+    void* Allocate(std::size_t size);
+    static void Deallocate(void* ptr);
+
+    SlabAllocator::Stats GetStats() const;
+
+private:
+    std::size_t _slabSize;
+    mutable std::mutex _lock;
+    std::map<std::size_t, std::unique_ptr<SlabAllocator>> _sizeClasses;
+};
+
+/*
+ * Base for classes whose instances (including derived classes) are allocated from a SlabPool
+ * shared by the whole hierarchy rooted at T.
+ */
+template<typename T>
+class SlabAllocated
+{
+public:
+    static void* operator new(std::size_t size)
+    {
+        static_assert(alignof(T) <= SlabAllocator::HeaderSize, "SlabAllocated does not support over-aligned types");
+        return GetSlabPool().Allocate(size);
+    }
+
+    static void operator delete(void* ptr) { SlabPool::Deallocate(ptr); }
+
+    static SlabPool& GetSlabPool()
+    {
+        // never destroyed, objects can still be freed during static destruction
+        static SlabPool* pool = new SlabPool();
+        return *pool;
+    }
+
+protected:
+    SlabAllocated() = default;
+    ~SlabAllocated() = default;
+};
+}
+
+#endif // TRINITY_SLAB_ALLOCATOR_H
@@ -18,6 +18,93 @@
 #include "TaskScheduler.h"
 #include "Errors.h"
 
+namespace
+{
+// Recycles the memory of tasks (shared with their control block) on the thread that released them
+template<typename T>
+struct TaskAllocator
+{
+    using value_type = T;
+
+    // more than enough for the tasks of every script on a map
+    static constexpr std::size_t MaxFreeBlocks = 4096;
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    // trivially destructible, tasks released by static destructors after the thread's cleanup still find it
+    struct FreeList
+    {
+        FreeBlock* Head;
+        std::size_t Size;
+    };
+
+    struct FreeListCleanup
+    {
+        ~FreeListCleanup()
+        {
+            FreeList& freeList = GetFreeList();
+            while (freeList.Head)
+                ::operator delete(std::exchange(freeList.Head, freeList.Head->Next));
+
+            // nothing is kept from now on
+            freeList.Size = MaxFreeBlocks;
+        }
+    };
+
+    static_assert(sizeof(T) >= sizeof(FreeBlock));
+
+    TaskAllocator() = default;
+    template<typename U>
+    TaskAllocator(TaskAllocator<U> const&) { }
+
+    static FreeList& GetFreeList()
+    {
+        static thread_local FreeList freeList = { .Head = nullptr, .Size = 0 };
+        return freeList;
+    }
+
+    static void RegisterCleanup()
+    {
+        static thread_local FreeListCleanup cleanup;
+    }
+
+    T* allocate(std::size_t n)
+    {
+        FreeList& freeList = GetFreeList();
+        if (n == 1 && freeList.Head)
+        {
+            --freeList.Size;
+            return reinterpret_cast<T*>(std::exchange(freeList.Head, freeList.Head->Next));
+        }
+
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n)
+    {
+        FreeList& freeList = GetFreeList();
+        if (n != 1 || freeList.Size >= MaxFreeBlocks)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        if (!freeList.Head)
+            RegisterCleanup();
+
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(ptr);
+        block->Next = freeList.Head;
+        freeList.Head = block;
+        ++freeList.Size;
+    }
+
+    friend bool operator==(TaskAllocator const&, TaskAllocator const&) { return true; }
+};
+}
+
 TaskScheduler::TaskScheduler()
     : self_reference(this, [](TaskScheduler const*) { }),
     _now(clock_t::now()),
@@ -141,15 +228,38 @@ TaskScheduler& TaskScheduler::InsertTask(TaskContainer task)
     return *this;
 }
 
+TaskScheduler& TaskScheduler::InsertBatch(TaskBatch&& batch)
+{
+    _task_holder.PushAll(std::move(batch._tasks));
+    return *this;
+}
+
+auto TaskScheduler::MakeTask(timepoint_t end, duration_t duration, Optional<group_t> group, task_handler_t task) -> TaskContainer
+{
+    static constexpr repeated_t DEFAULT_REPEATED = 0;
+    return std::allocate_shared<Task>(TaskAllocator<Task>(), end, duration, group, DEFAULT_REPEATED, std::move(task));
+}
+
 TaskScheduler& TaskScheduler::ScheduleAt(timepoint_t end, duration_t time, task_handler_t task)
 {
-    return InsertTask(TaskContainer(new Task(end + time, time, std::move(task))));
+    return InsertTask(MakeTask(end + time, time, std::nullopt, std::move(task)));
 }
 
 TaskScheduler& TaskScheduler::ScheduleAt(timepoint_t end, duration_t time, group_t const group, task_handler_t task)
 {
-    static constexpr repeated_t DEFAULT_REPEATED = 0;
-    return InsertTask(TaskContainer(new Task(end + time, time, group, DEFAULT_REPEATED, std::move(task))));
+    return InsertTask(MakeTask(end + time, time, group, std::move(task)));
+}
+
+auto TaskScheduler::TaskBatch::Schedule(duration_t time, task_handler_t task) -> TaskBatch&
+{
+    _tasks.push_back(MakeTask(_start + time, time, std::nullopt, std::move(task)));
+    return *this;
+}
+
+auto TaskScheduler::TaskBatch::Schedule(duration_t time, group_t const group, task_handler_t task) -> TaskBatch&
+{
+    _tasks.push_back(MakeTask(_start + time, time, group, std::move(task)));
+    return *this;
 }
 
 void TaskScheduler::Dispatch(success_t const& callback/* = nullptr*/)
@@ -174,9 +284,13 @@ void TaskScheduler::Dispatch(success_t const& callback/* = nullptr*/)
         if (_task_holder.First()->_end > _now)
             break;
 
+        TaskContainer task = _task_holder.Pop();
+        ++task->_invocation;
+        task->_consumed = false;
+
         // Perfect forward the context to the handler
         // Use weak references to catch destruction before callbacks.
-        TaskContext context(_task_holder.Pop(), std::weak_ptr<TaskScheduler>(self_reference));
+        TaskContext context(std::move(task), std::weak_ptr<TaskScheduler>(self_reference));
 
         // Invoke the context
         context.Invoke();
@@ -193,19 +307,33 @@ void TaskScheduler::Dispatch(success_t const& callback/* = nullptr*/)
 
 void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    container.emplace(std::move(task));
+    task->_sequence = _nextSequence++;
+    container.push_back(std::move(task));
+    std::ranges::push_heap(container, Later);
+}
+
+void TaskScheduler::TaskQueue::PushAll(std::vector<TaskContainer>&& tasks)
+{
+    for (TaskContainer& task : tasks)
+    {
+        task->_sequence = _nextSequence++;
+        container.push_back(std::move(task));
+    }
+
+    std::ranges::make_heap(container, Later);
 }
 
 auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    std::ranges::pop_heap(container, Later);
+    TaskContainer result = std::move(container.back());
+    container.pop_back();
     return result;
 }
 
 auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
 {
-    return *container.begin();
+    return container.front();
 }
 
 void TaskScheduler::TaskQueue::Clear()
@@ -215,26 +343,19 @@ void TaskScheduler::TaskQueue::Clear()
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-            itr = container.erase(itr);
-        else
-            ++itr;
+    if (std::erase_if(container, filter))
+        std::ranges::make_heap(container, Later);
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
-            ++itr;
+    // modified tasks go after the unmodified ones of the same end, in the order they had
+    std::ranges::sort(container, [](TaskContainer const& left, TaskContainer const& right) { return Later(right, left); });
+    for (TaskContainer const& task : container)
+        if (filter(task))
+            task->_sequence = _nextSequence++;
 
-    container.insert(cache.begin(), cache.end());
+    std::ranges::make_heap(container, Later);
 }
 
 bool TaskScheduler::TaskQueue::IsEmpty() const
@@ -285,7 +406,7 @@ TaskContext& TaskContext::Repeat(TaskScheduler::duration_t duration)
     _task->_duration = duration;
     _task->_end += duration;
     _task->_repeated += 1;
-    (*_consumed) = true;
+    _task->_consumed = true;
     return this->Dispatch([this](TaskScheduler& scheduler) -> TaskScheduler&
     {
         return scheduler.InsertTask(_task);
@@ -371,11 +492,16 @@ TaskContext& TaskContext::RescheduleGroup(TaskScheduler::group_t const group, Ta
     });
 }
 
+bool TaskContext::IsConsumed() const
+{
+    return !_task || _task->_consumed || _task->_invocation != _invocation;
+}
+
 void TaskContext::AssertOnConsumed() const
 {
     // This was adapted to TC to prevent static analysis tools from complaining.
     // If you encounter this assertion check if you repeat a TaskContext more then 1 time!
-    ASSERT(!(*_consumed) && "Bad task logic, task context was consumed already!");
+    ASSERT(!IsConsumed() && "Bad task logic, task context was consumed already!");
 }
 
 void TaskContext::Invoke()
@@ -27,7 +27,6 @@
 #include <queue>
 #include <memory>
 #include <utility>
-#include <set>
 
 class TaskContext;
 
@@ -44,6 +43,8 @@ class TaskContext;
 /// with the same duration or a new one.
 /// It also provides access to the repeat counter which is useful for task that repeat itself often
 /// but behave different every time (spoken event dialogs for example).
+/// Tasks are allocated from a per thread pool and kept in a binary heap, tasks ending at the same
+/// time are executed in the order they were scheduled in.
 class TC_COMMON_API TaskScheduler
 {
     friend class TaskContext;
@@ -74,16 +75,19 @@ class TC_COMMON_API TaskScheduler
         Optional<group_t> _group;
         repeated_t _repeated;
         task_handler_t _task;
+        uint64 _sequence;       ///< Insertion order, orders tasks of the same end
+        uint32 _invocation;     ///< Incremented every time the task is invoked
+        bool _consumed;         ///< The current invocation repeated the task
 
     public:
         // All Argument construct
         Task(timepoint_t end, duration_t duration, Optional<group_t> group,
             repeated_t const repeated, task_handler_t task)
-                : _end(end), _duration(duration), _group(group), _repeated(repeated), _task(std::move(task)) { }
+                : _end(end), _duration(duration), _group(group), _repeated(repeated), _task(std::move(task)), _sequence(0), _invocation(0), _consumed(false) { }
 
         // Minimal Argument construct
         Task(timepoint_t end, duration_t duration, task_handler_t task)
-            : _end(end), _duration(duration), _group(std::nullopt), _repeated(0), _task(std::move(task)) { }
+            : _end(end), _duration(duration), _group(std::nullopt), _repeated(0), _task(std::move(task)), _sequence(0), _invocation(0), _consumed(false) { }
 
         // Copy construct
         Task(Task const&) = delete;
@@ -118,22 +122,27 @@ class TC_COMMON_API TaskScheduler
     typedef std::shared_ptr<Task> TaskContainer;
 
     /// Container which provides Task order, insert and reschedule operations.
-    struct Compare
+    /// Min heap on end and insertion order, pushing reuses the storage of popped tasks.
+    class TC_COMMON_API TaskQueue
     {
-        bool operator() (TaskContainer const& left, TaskContainer const& right) const
+        std::vector<TaskContainer> container;
+        uint64 _nextSequence = 0;
+
+        static bool Later(TaskContainer const& left, TaskContainer const& right)
         {
-            return (*left.get()) < (*right.get());
-        }
-    };
+            if (left->_end != right->_end)
+                return left->_end > right->_end;
 
-    class TC_COMMON_API TaskQueue
-    {
-        std::multiset<TaskContainer, Compare> container;
+            return left->_sequence > right->_sequence;
+        }
 
     public:
         // Pushes the task in the container
         void Push(TaskContainer&& task);
 
+        // Pushes every task, restoring the order only once
+        void PushAll(std::vector<TaskContainer>&& tasks);
+
         /// Pops the task out of the container
         TaskContainer Pop();
 
@@ -171,6 +180,40 @@ class TC_COMMON_API TaskScheduler
     }
 
 public:
+    /// Tasks scheduled together through Batch, all of them are inserted at once.
+    class TC_COMMON_API TaskBatch
+    {
+        friend class TaskScheduler;
+        friend class TaskContext;
+
+        timepoint_t _start;
+        std::vector<TaskContainer> _tasks;
+
+        explicit TaskBatch(timepoint_t start) : _start(start) { }
+
+    public:
+        TaskBatch(TaskBatch const&) = delete;
+        TaskBatch& operator=(TaskBatch const&) = delete;
+
+        /// Schedule an event with a fixed rate.
+        TaskBatch& Schedule(duration_t time, task_handler_t task);
+
+        /// Schedule an event with a fixed rate.
+        TaskBatch& Schedule(duration_t time, group_t const group, task_handler_t task);
+
+        /// Schedule an event with a randomized rate between min and max rate.
+        TaskBatch& Schedule(std::chrono::milliseconds min, std::chrono::milliseconds max, task_handler_t task)
+        {
+            return this->Schedule(::randtime(min, max), std::move(task));
+        }
+
+        /// Schedule an event with a randomized rate between min and max rate.
+        TaskBatch& Schedule(std::chrono::milliseconds min, std::chrono::milliseconds max, group_t const group, task_handler_t task)
+        {
+            return this->Schedule(::randtime(min, max), group, std::move(task));
+        }
+    };
+
     TaskScheduler();
 
     template<typename P>
@@ -244,6 +287,18 @@ public:
         return this->Schedule(::randtime(min, max), group, std::move(task));
     }
 
+    /// Schedules the tasks added to the batch by fill with a single queue update,
+    /// for example all abilities of a boss phase:
+    /// scheduler.Batch([&](TaskScheduler::TaskBatch& batch) { batch.Schedule(5s, ...).Schedule(10s, ...); });
+    /// Never call this from within a task context! Use TaskContext::Batch instead!
+    template<std::invocable<TaskBatch&> F>
+    TaskScheduler& Batch(F&& fill)
+    {
+        TaskBatch batch(_now);
+        fill(batch);
+        return InsertBatch(std::move(batch));
+    }
+
     /// Cancels all tasks.
     /// Never call this from within a task context! Use TaskContext::CancelAll instead!
     TaskScheduler& CancelAll();
@@ -301,6 +356,12 @@ private:
     /// Insert a new task to the enqueued tasks.
     TaskScheduler& InsertTask(TaskContainer task);
 
+    /// Insert every task of the batch to the enqueued tasks.
+    TaskScheduler& InsertBatch(TaskBatch&& batch);
+
+    /// Allocates a task from the task pool of the calling thread.
+    static TaskContainer MakeTask(timepoint_t end, duration_t duration, Optional<group_t> group, task_handler_t task);
+
     TaskScheduler& ScheduleAt(timepoint_t end,
         duration_t time, task_handler_t task);
 
@@ -324,8 +385,9 @@ class TC_COMMON_API TaskContext
     /// Owner
     std::weak_ptr<TaskScheduler> _owner;
 
-    /// Marks the task as consumed
-    std::shared_ptr<bool> _consumed;
+    /// Invocation of the task this context was created for, the context is consumed
+    /// once the task was repeated or invoked again
+    uint32 _invocation;
 
     /// Dispatches an action safe on the TaskScheduler
     TaskContext& Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply);
@@ -333,11 +395,11 @@ class TC_COMMON_API TaskContext
 public:
     // Empty constructor
     TaskContext()
-        : _task(), _owner(), _consumed(std::make_shared<bool>(true)) { }
+        : _task(), _owner(), _invocation(0) { }
 
     // Construct from task and owner
     explicit TaskContext(TaskScheduler::TaskContainer&& task, std::weak_ptr<TaskScheduler>&& owner)
-        : _task(std::move(task)), _owner(std::move(owner)), _consumed(std::make_shared<bool>(false)) { }
+        : _task(std::move(task)), _owner(std::move(owner)), _invocation(_task->_invocation) { }
 
     // Copy construct
     TaskContext(TaskContext const& right) = default;
@@ -431,6 +493,20 @@ public:
         return this->Schedule(::randtime(min, max), group, std::move(task));
     }
 
+    /// Schedules the tasks added to the batch by fill with a single queue update from within the context.
+    /// Its possible that the new events are executed immediately!
+    template<std::invocable<TaskScheduler::TaskBatch&> F>
+    TaskContext& Batch(F&& fill)
+    {
+        auto const end = _task->_end;
+        return this->Dispatch([&](TaskScheduler& scheduler) -> TaskScheduler&
+        {
+            TaskScheduler::TaskBatch batch(end);
+            fill(batch);
+            return scheduler.InsertBatch(std::move(batch));
+        });
+    }
+
     /// Cancels all tasks from within the context.
     TaskContext& CancelAll();
 
@@ -484,6 +560,8 @@ public:
     }
 
 private:
+    bool IsConsumed() const;
+
     /// Asserts if the task was consumed already.
     void AssertOnConsumed() const;
 
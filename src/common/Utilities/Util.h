@@ -508,6 +508,11 @@ class HookList
             return _container.size();
         }
 
+        bool empty() const
+        {
+            return _container.empty();
+        }
+
         iterator begin()
         {
             return _container.begin();
@@ -700,7 +700,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void TerrainBuilder::transformVertices(std::vector<G3D::Vector3> const& source, std::vector<float>& dest, float scale, G3D::Matrix3 const& rotation, G3D::Vector3 const& position)
+    void TerrainBuilder::transformVertices(std::span<G3D::Vector3 const> source, std::vector<float>& dest, float scale, G3D::Matrix3 const& rotation, G3D::Vector3 const& position)
     {
         std::size_t offset = dest.size();
         dest.resize(dest.size() + source.size() * 3);
@@ -718,7 +718,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void TerrainBuilder::copyIndices(std::vector<VMAP::MeshTriangle> const& source, std::vector<int>& dest, int offset, bool flip)
+    void TerrainBuilder::copyIndices(std::span<VMAP::MeshTriangle const> source, std::vector<int>& dest, int offset, bool flip)
     {
         std::size_t destOffset = dest.size();
         dest.resize(dest.size() + source.size() * 3);
@@ -22,6 +22,7 @@
 #include "WorldModel.h"
 #include <G3D/Vector3.h>
 #include <boost/filesystem/path.hpp>
+#include <span>
 
 namespace VMAP
 {
@@ -93,9 +94,9 @@ namespace MMAP
             bool usesLiquids() const { return !m_skipLiquid; }
 
             // vert and triangle methods
-            static void transformVertices(std::vector<G3D::Vector3> const& source, std::vector<float>& dest,
+            static void transformVertices(std::span<G3D::Vector3 const> source, std::vector<float>& dest,
                 float scale, G3D::Matrix3 const& rotation, G3D::Vector3 const& position);
-            static void copyIndices(std::vector<VMAP::MeshTriangle> const& source, std::vector<int>& dest, int offset, bool flip);
+            static void copyIndices(std::span<VMAP::MeshTriangle const> source, std::vector<int>& dest, int offset, bool flip);
             static void copyIndices(std::vector<int> const& source, std::vector<int>& dest, int offset);
             static void cleanVertices(std::vector<float>& verts, std::vector<int>& tris);
         private:
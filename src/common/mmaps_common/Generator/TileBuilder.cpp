@@ -19,6 +19,7 @@
 #include "IntermediateValues.h"
 #include "Log.h"
 #include "MMapDefines.h"
+#include "MMapTileCompression.h"
 #include "Memory.h"
 #include "StringFormat.h"
 #include "VMapManager.h"
@@ -70,12 +71,13 @@ namespace MMAP
 
     TileBuilder::TileBuilder(boost::filesystem::path const& inputDirectory, boost::filesystem::path const& outputDirectory,
         Optional<float> maxWalkableAngle, Optional<float> maxWalkableAngleNotSteep,
-        bool skipLiquid, bool bigBaseUnit, bool debugOutput, std::vector<OffMeshData> const* offMeshConnections) :
+        bool skipLiquid, bool bigBaseUnit, bool debugOutput, bool compressTiles, std::vector<OffMeshData> const* offMeshConnections) :
         m_outputDirectory(outputDirectory),
         m_maxWalkableAngle(maxWalkableAngle),
         m_maxWalkableAngleNotSteep(maxWalkableAngleNotSteep),
         m_bigBaseUnit(bigBaseUnit),
         m_debugOutput(debugOutput),
+        m_compressTiles(compressTiles),
         m_terrainBuilder(inputDirectory, skipLiquid),
         m_rcContext(false),
         m_offMeshConnections(offMeshConnections)
@@ -122,14 +124,9 @@ namespace MMAP
             return;
         }
 
-        // gather all mesh data for final data check, and bounds calculation
-        std::vector<float> allVerts(meshData.liquidVerts.size() + meshData.solidVerts.size());
-        std::ranges::copy(meshData.liquidVerts, allVerts.begin());
-        std::ranges::copy(meshData.solidVerts, allVerts.begin() + std::ssize(meshData.liquidVerts));
-
         // get bounds of current tile
         float bmin[3], bmax[3];
-        getTileBounds(tileX, tileY, allVerts.data(), allVerts.size() / 3, bmin, bmax);
+        getTileBounds(tileX, tileY, meshData, bmin, bmax);
 
         if (m_offMeshConnections)
             m_terrainBuilder.loadOffMeshConnections(mapID, tileX, tileY, meshData, *m_offMeshConnections);
@@ -186,6 +183,20 @@ namespace MMAP
         std::unique_ptr<rcPolyMesh*[]> pmmerge = std::make_unique<rcPolyMesh*[]>(TILES_PER_MAP * TILES_PER_MAP);
         std::unique_ptr<rcPolyMeshDetail*[]> dmmerge = std::make_unique<rcPolyMeshDetail*[]>(TILES_PER_MAP * TILES_PER_MAP);
         int nmerge = 0;
+        // mark all walkable tiles, both liquids and solids
+
+        /* we want to have triangles with slope less than walkableSlopeAngleNotSteep (<= 55) to have NAV_AREA_GROUND
+         * and with slope between walkableSlopeAngleNotSteep and walkableSlopeAngle (55 < .. <= 70) to have NAV_AREA_GROUND_STEEP.
+         * we achieve this using recast API: memset everything to NAV_AREA_GROUND_STEEP, call rcClearUnwalkableTriangles with 70 so
+         * any area above that will get RC_NULL_AREA (unwalkable), then call rcMarkWalkableTriangles with 55 to set NAV_AREA_GROUND
+         * on anything below 55 . Players and idle Creatures can use NAV_AREA_GROUND, while Creatures in combat can use NAV_AREA_GROUND_STEEP.
+         * The slopes don't depend on the subregion, the flags are the same for all of them.
+         */
+        std::unique_ptr<unsigned char[]> triFlags = std::make_unique<unsigned char[]>(tTriCount);
+        memset(triFlags.get(), NAV_AREA_GROUND_STEEP, tTriCount * sizeof(unsigned char));
+        rcClearUnwalkableTriangles(&m_rcContext, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags.get());
+        rcMarkWalkableTriangles(&m_rcContext, tileCfg.walkableSlopeAngleNotSteep, tVerts, tVertCount, tTris, tTriCount, triFlags.get(), NAV_AREA_GROUND);
+
         // build all tiles
         for (int y = 0; y < TILES_PER_MAP; ++y)
         {
@@ -212,18 +223,6 @@ namespace MMAP
                     continue;
                 }
 
-                // mark all walkable tiles, both liquids and solids
-
-                /* we want to have triangles with slope less than walkableSlopeAngleNotSteep (<= 55) to have NAV_AREA_GROUND
-                 * and with slope between walkableSlopeAngleNotSteep and walkableSlopeAngle (55 < .. <= 70) to have NAV_AREA_GROUND_STEEP.
-                 * we achieve this using recast API: memset everything to NAV_AREA_GROUND_STEEP, call rcClearUnwalkableTriangles with 70 so
-                 * any area above that will get RC_NULL_AREA (unwalkable), then call rcMarkWalkableTriangles with 55 to set NAV_AREA_GROUND
-                 * on anything below 55 . Players and idle Creatures can use NAV_AREA_GROUND, while Creatures in combat can use NAV_AREA_GROUND_STEEP.
-                 */
-                std::unique_ptr<unsigned char[]> triFlags = std::make_unique<unsigned char[]>(tTriCount);
-                memset(triFlags.get(), NAV_AREA_GROUND_STEEP, tTriCount * sizeof(unsigned char));
-                rcClearUnwalkableTriangles(&m_rcContext, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags.get());
-                rcMarkWalkableTriangles(&m_rcContext, tileCfg.walkableSlopeAngleNotSteep, tVerts, tVertCount, tTris, tTriCount, triFlags.get(), NAV_AREA_GROUND);
                 rcRasterizeTriangles(&m_rcContext, tVerts, tVertCount, tTris, triFlags.get(), tTriCount, *tile.solid, config.walkableClimb);
 
                 rcFilterLowHangingWalkableObstacles(&m_rcContext, config.walkableClimb, *tile.solid);
@@ -324,6 +323,17 @@ namespace MMAP
         pmmerge = nullptr;
         dmmerge = nullptr;
         tiles = nullptr;
+        triFlags = nullptr;
+
+        // the input geometry is only written to the debug output from here on, release it before the navmesh data is built
+        if (!m_debugOutput)
+        {
+            meshData.solidVerts = {};
+            meshData.solidTris = {};
+            meshData.liquidVerts = {};
+            meshData.liquidTris = {};
+            meshData.liquidType = {};
+        }
 
         // set polygons as walkable
         // TODO: special flags for DYNAMIC polygons, ie surfaces that can be turned on and off
@@ -476,14 +486,27 @@ namespace MMAP
 
         TC_LOG_DEBUG("maps.mmapgen", "[Map {:04}] [{:02},{:02}]: Writing to file...", mapID, tileX, tileY);
 
+        std::vector<unsigned char> compressed;
+        if (m_compressTiles)
+            compressed = CompressTileData(tileResult.data.get(), uint32(tileResult.size));
+
         // write header
         MmapTileHeader header;
         header.usesLiquids = m_terrainBuilder.usesLiquids();
-        header.size = uint32(tileResult.size);
+        if (!compressed.empty())
+        {
+            header.size = uint32(compressed.size());
+            header.compression = MMAP_TILE_ZLIB;
+        }
+        else
+            header.size = uint32(tileResult.size);
         fwrite(&header, sizeof(MmapTileHeader), 1, file.get());
 
         // write data
-        fwrite(tileResult.data.get(), sizeof(unsigned char), tileResult.size, file.get());
+        if (!compressed.empty())
+            fwrite(compressed.data(), sizeof(unsigned char), compressed.size(), file.get());
+        else
+            fwrite(tileResult.data.get(), sizeof(unsigned char), tileResult.size, file.get());
     }
 
     /**************************************************************************/
@@ -505,6 +528,26 @@ namespace MMAP
         bmin[2] = bmax[2] - GRID_SIZE;
     }
 
+    void TileBuilder::getTileBounds(uint32 tileX, uint32 tileY, MeshData const& meshData, float* bmin, float* bmax)
+    {
+        getTileBounds(tileX, tileY, meshData.solidVerts.data(), meshData.solidVerts.size() / 3, bmin, bmax);
+        if (meshData.liquidVerts.empty())
+            return;
+
+        float liquidMin[3], liquidMax[3];
+        rcCalcBounds(meshData.liquidVerts.data(), int(meshData.liquidVerts.size() / 3), liquidMin, liquidMax);
+        if (meshData.solidVerts.empty())
+        {
+            bmin[1] = liquidMin[1];
+            bmax[1] = liquidMax[1];
+        }
+        else
+        {
+            bmin[1] = std::min(bmin[1], liquidMin[1]);
+            bmax[1] = std::max(bmax[1], liquidMax[1]);
+        }
+    }
+
     /**************************************************************************/
     bool TileBuilder::shouldSkipTile(uint32 /*mapID*/, uint32 /*tileX*/, uint32 /*tileY*/) const
     {
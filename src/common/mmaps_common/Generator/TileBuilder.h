@@ -41,6 +41,7 @@ public:
         bool skipLiquid,
         bool bigBaseUnit,
         bool debugOutput,
+        bool compressTiles,
         std::vector<OffMeshData> const* offMeshConnections);
 
     TileBuilder(TileBuilder const&) = delete;
@@ -76,6 +77,8 @@ public:
     static void getTileBounds(uint32 tileX, uint32 tileY,
         float const* verts, std::size_t vertCount,
         float* bmin, float* bmax);
+    // bounds of both solid and liquid geometry, without gathering all vertices in one buffer first
+    static void getTileBounds(uint32 tileX, uint32 tileY, MeshData const& meshData, float* bmin, float* bmax);
 
     rcConfig GetMapSpecificConfig(uint32 mapID, float const (&bmin)[3], float const (&bmax)[3], TileConfig const& tileConfig) const;
 
@@ -89,6 +92,7 @@ protected:
     Optional<float> m_maxWalkableAngleNotSteep;
     bool m_bigBaseUnit;
     bool m_debugOutput;
+    bool m_compressTiles;
 
     TerrainBuilder m_terrainBuilder;
     // build performance - not really used for now
@@ -34,14 +34,21 @@ struct MmapNavMeshHeader
 
 static_assert(sizeof(MmapNavMeshHeader) == 40);
 
+enum MmapTileCompression : uint8
+{
+    MMAP_TILE_UNCOMPRESSED  = 0,
+    MMAP_TILE_ZLIB          = 1     // data is the uint32 size of the tile followed by the deflated tile
+};
+
 struct MmapTileHeader
 {
     uint32 mmapMagic = MMAP_MAGIC;
     uint32 dtVersion = DT_NAVMESH_VERSION;
     uint32 mmapVersion = MMAP_VERSION;
-    uint32 size = 0;
+    uint32 size = 0;                // size of the data stored after the header
     char usesLiquids = true;
-    char padding[3] = { };
+    uint8 compression = MMAP_TILE_UNCOMPRESSED;
+    char padding[2] = { };
 };
 
 // All padding fields must be handled and initialized to ensure mmaps_generator will produce binary-identical *.mmtile files
@@ -51,6 +58,7 @@ static_assert(sizeof(MmapTileHeader) == sizeof(MmapTileHeader::mmapMagic) +
                                         sizeof(MmapTileHeader::mmapVersion) +
                                         sizeof(MmapTileHeader::size) +
                                         sizeof(MmapTileHeader::usesLiquids) +
+                                        sizeof(MmapTileHeader::compression) +
                                         sizeof(MmapTileHeader::padding), "MmapTileHeader has uninitialized padding fields");
 
 enum NavArea
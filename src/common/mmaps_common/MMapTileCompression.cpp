@@ -0,0 +1,57 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MMapTileCompression.h"
+#include <zlib.h>
+#include <cstring>
+
+namespace MMAP
+{
+    std::vector<unsigned char> CompressTileData(unsigned char const* data, uint32 size)
+    {
+        std::vector<unsigned char> compressed(sizeof(uint32) + compressBound(size));
+        memcpy(compressed.data(), &size, sizeof(uint32));
+
+        uLongf compressedSize = uLongf(compressed.size() - sizeof(uint32));
+        if (compress2(compressed.data() + sizeof(uint32), &compressedSize, data, size, Z_BEST_SPEED) != Z_OK
+            || sizeof(uint32) + compressedSize >= size)
+            return {};
+
+        compressed.resize(sizeof(uint32) + compressedSize);
+        return compressed;
+    }
+
+    uint32 GetDecompressedTileSize(unsigned char const* compressed, uint32 compressedSize)
+    {
+        if (compressedSize <= sizeof(uint32))
+            return 0;
+
+        uint32 size;
+        memcpy(&size, compressed, sizeof(uint32));
+        return size;
+    }
+
+    bool DecompressTileData(unsigned char const* compressed, uint32 compressedSize, unsigned char* data, uint32 size)
+    {
+        if (GetDecompressedTileSize(compressed, compressedSize) != size)
+            return false;
+
+        uLongf decompressedSize = size;
+        return uncompress(data, &decompressedSize, compressed + sizeof(uint32), compressedSize - sizeof(uint32)) == Z_OK
+            && decompressedSize == size;
+    }
+}
@@ -0,0 +1,37 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MMAP_TILE_COMPRESSION_H
+#define TRINITYCORE_MMAP_TILE_COMPRESSION_H
+
+#include "Define.h"
+#include <vector>
+
+namespace MMAP
+{
+    // Payload of a MMAP_TILE_ZLIB tile, deflated at the fastest level since every load of the tile has to inflate it again.
+    // Returns an empty buffer when the tile does not get smaller, such tiles should be stored uncompressed
+    TC_MMAPS_COMMON_API std::vector<unsigned char> CompressTileData(unsigned char const* data, uint32 size);
+
+    // Size of the tile stored in a MMAP_TILE_ZLIB payload, 0 if the payload is too short to hold it
+    TC_MMAPS_COMMON_API uint32 GetDecompressedTileSize(unsigned char const* compressed, uint32 compressedSize);
+
+    // Inflates a MMAP_TILE_ZLIB payload into data, which must hold GetDecompressedTileSize bytes
+    TC_MMAPS_COMMON_API bool DecompressTileData(unsigned char const* compressed, uint32 compressedSize, unsigned char* data, uint32 size);
+}
+
+#endif // TRINITYCORE_MMAP_TILE_COMPRESSION_H
@@ -20,8 +20,12 @@
 #include "Hash.h"
 #include "Log.h"
 #include "MMapDefines.h"
+#include "MMapTileCompression.h"
 #include "MapUtils.h"
 #include "Memory.h"
+#include "Optional.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <algorithm>
 
 namespace MMAP
@@ -36,12 +40,30 @@ namespace MMAP
 
     struct MMapMapData
     {
+        // tiles added from mapped files, declared before navMesh to outlive it, detour does not free their data
+        std::unordered_map<uint32, boost::interprocess::mapped_region> mappedTiles;
         dtNavMesh navMesh;
         MMapTileSet loadedTileRefs;        // maps [map grid coords] to [dtTile]
     };
 
     using MeshDataMap = std::unordered_map<uint32, MMapMapData>;
 
+    // Mapped copy on write: detour writes the links of a tile into its data, only the pages holding polygons and links
+    // become private to the mesh while vertices, detail meshes and bounding volumes stay shared through the page cache
+    static Optional<boost::interprocess::mapped_region> MapTileFile(std::string const& fileName, uint32 dataSize)
+    {
+        try
+        {
+            boost::interprocess::file_mapping file(fileName.c_str(), boost::interprocess::read_only);
+            return Optional<boost::interprocess::mapped_region>(std::in_place, file, boost::interprocess::copy_on_write, 0, sizeof(MmapTileHeader) + dataSize);
+        }
+        catch (boost::interprocess::interprocess_exception const& e)
+        {
+            TC_LOG_ERROR("maps", "MMAP:loadMap: Could not map '{}' ({}), reading it instead", fileName, e.what());
+            return {};
+        }
+    }
+
     // dummy struct to hold map's mmap data
     struct MMapData
     {
@@ -288,21 +310,80 @@ namespace MMAP
 
         fseek(file.get(), pos, SEEK_SET);
 
-        auto data = Trinity::make_unique_ptr_with_deleter<&::dtFree>(dtAlloc(fileHeader.size, DT_ALLOC_PERM));
-        ASSERT(data);
+        if (fileHeader.compression != MMAP_TILE_UNCOMPRESSED && fileHeader.compression != MMAP_TILE_ZLIB)
+        {
+            TC_LOG_ERROR("maps", "MMAP:loadMap: {:04}_{:02}_{:02}.mmtile uses unknown compression {}", mapId, x, y, uint32(fileHeader.compression));
+            return LoadResult::VersionMismatch;
+        }
 
-        size_t result = fread(data.get(), fileHeader.size, 1, file.get());
-        if (!result)
+        // compressed tiles cannot be mapped, they are inflated into memory owned by detour
+        if (mapTileFiles && fileHeader.compression == MMAP_TILE_UNCOMPRESSED)
         {
-            TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:04}_{:02}_{:02}.mmtile", mapId, x, y);
-            return LoadResult::ReadFromFileFailed;
+            file.reset();
+            if (Optional<boost::interprocess::mapped_region> region = MapTileFile(fileName, fileHeader.size))
+            {
+                unsigned char* data = static_cast<unsigned char*>(region->get_address()) + sizeof(MmapTileHeader);
+                dtMeshHeader const* header = reinterpret_cast<dtMeshHeader const*>(data);
+                dtTileRef tileRef = 0;
+                if (dtStatusFailed(meshData.navMesh.addTile(data, fileHeader.size, 0, 0, &tileRef)))
+                {
+                    TC_LOG_ERROR("maps", "MMAP:loadMap: Could not load {:04}_{:02}_{:02}.mmtile into navmesh", mapId, x, y);
+                    return LoadResult::LibraryError;
+                }
+
+                meshData.loadedTileRefs[packedGridPos] = tileRef;
+                meshData.mappedTiles.insert_or_assign(packedGridPos, std::move(*region));
+                ++loadedTiles;
+                TC_LOG_DEBUG("maps", "MMAP:loadMap: Mapped mmtile {:04}[{:02}, {:02}] into {:04}[{:02}, {:02}]", mapId, x, y, mapId, header->x, header->y);
+                return LoadResult::Success;
+            }
+
+            file.reset(fopen(fileName.c_str(), "rb"));
+            if (!file || fseek(file.get(), pos, SEEK_SET) != 0)
+                return LoadResult::ReadFromFileFailed;
+        }
+
+        uint32 dataSize = fileHeader.size;
+        std::unique_ptr<void, decltype(Trinity::unique_ptr_deleter<void*, &::dtFree>())> data;
+        if (fileHeader.compression == MMAP_TILE_ZLIB)
+        {
+            // reused by all tiles loaded on this thread, only the inflated tile has to be allocated for each of them
+            static thread_local std::vector<unsigned char> compressed;
+            compressed.resize(fileHeader.size);
+            if (fread(compressed.data(), fileHeader.size, 1, file.get()) != 1)
+            {
+                TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:04}_{:02}_{:02}.mmtile", mapId, x, y);
+                return LoadResult::ReadFromFileFailed;
+            }
+
+            dataSize = GetDecompressedTileSize(compressed.data(), fileHeader.size);
+            if (dataSize)
+                data.reset(dtAlloc(dataSize, DT_ALLOC_PERM));
+
+            if (!data || !DecompressTileData(compressed.data(), fileHeader.size, static_cast<unsigned char*>(data.get()), dataSize))
+            {
+                TC_LOG_ERROR("maps", "MMAP:loadMap: {:04}_{:02}_{:02}.mmtile has corrupted compressed data", mapId, x, y);
+                return LoadResult::ReadFromFileFailed;
+            }
+        }
+        else
+        {
+            data.reset(dtAlloc(dataSize, DT_ALLOC_PERM));
+            ASSERT(data);
+
+            size_t result = fread(data.get(), dataSize, 1, file.get());
+            if (!result)
+            {
+                TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:04}_{:02}_{:02}.mmtile", mapId, x, y);
+                return LoadResult::ReadFromFileFailed;
+            }
         }
 
         dtMeshHeader* header = static_cast<dtMeshHeader*>(data.get());
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(meshData.navMesh.addTile(static_cast<unsigned char*>(data.release()), fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        if (dtStatusSucceed(meshData.navMesh.addTile(static_cast<unsigned char*>(data.release()), dataSize, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
             meshData.loadedTileRefs[packedGridPos] = tileRef;
             ++loadedTiles;
@@ -381,6 +462,7 @@ namespace MMAP
             }
             else
             {
+                meshData.mappedTiles.erase(packedGridPos);
                 --loadedTiles;
                 TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:04}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
             }
@@ -409,6 +491,7 @@ namespace MMAP
                     TC_LOG_ERROR("maps", "MMAP:unloadMap: Could not unload {:04}_{:02}_{:02}.mmtile from navmesh", mapId, x, y);
                 else
                 {
+                    mesh.mappedTiles.erase(tileId);
                     --loadedTiles;
                     TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:04}[{:02}, {:02}] from {:04}", mapId, x, y, mapId);
                 }
@@ -484,4 +567,24 @@ namespace MMAP
 
         return &queryItr->second;
     }
+
+    dtNavMeshQuery const* MMapManager::GetThreadNavMeshQuery(dtNavMesh const* navMesh)
+    {
+        // searches reset the node pools themselves, a query only has to be attached again when the mesh changes
+        static thread_local dtNavMeshQuery query;
+        static thread_local dtNavMesh const* attachedNavMesh = nullptr;
+        if (attachedNavMesh != navMesh)
+        {
+            attachedNavMesh = nullptr;
+            if (dtStatusFailed(query.init(navMesh, 1024)))
+            {
+                TC_LOG_ERROR("maps", "MMAP:GetThreadNavMeshQuery: Failed to initialize dtNavMeshQuery");
+                return nullptr;
+            }
+
+            attachedNavMesh = navMesh;
+        }
+
+        return &query;
+    }
 }
@@ -67,6 +67,8 @@ namespace MMAP
 
             // the returned [dtNavMeshQuery const*] is NOT threadsafe
             dtNavMeshQuery const* GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
+            // query owned by the calling thread, attached to navMesh until it is called with another one
+            static dtNavMeshQuery const* GetThreadNavMeshQuery(dtNavMesh const* navMesh);
             dtNavMesh* GetNavMesh(uint32 mapId, uint32 instanceId);
 
             uint32 getLoadedTilesCount() const { return loadedTiles; }
@@ -74,6 +76,9 @@ namespace MMAP
 
             static bool isRebuildingTilesEnabledOnMap(uint32 mapId);
 
+            // tiles loaded afterwards are mapped from their files instead of being read into allocated memory
+            void setMapTileFiles(bool enable) { mapTileFiles = enable; }
+
         private:
             LoadResult loadMapData(std::string_view basePath, uint32 mapId, uint32 instanceId);
             uint32 packTileID(int32 x, int32 y);
@@ -81,6 +86,7 @@ namespace MMAP
             MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
             MMapDataSet loadedMMaps;
             uint32 loadedTiles = 0;
+            bool mapTileFiles = false;
 
             std::unordered_map<uint32, uint32> parentMapData;
     };
@@ -24,11 +24,13 @@
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "ProcessPriority.h"
 #include "Socket.h"
 #include <boost/asio/ip/tcp.hpp>
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 
 namespace Trinity::Net
@@ -60,11 +62,13 @@ public:
         _ioContext.stop();
     }
 
-    bool Start()
+    // threadAffinity: processors of the thread, see SetCurrentThreadAffinity
+    bool Start(std::string threadAffinity = {})
     {
         if (_thread)
             return false;
 
+        _threadAffinity = std::move(threadAffinity);
         _thread = std::make_unique<std::thread>(&NetworkThread::Run, this);
         return true;
     }
@@ -121,6 +125,8 @@ protected:
     {
         TC_LOG_DEBUG("misc", "Network Thread Starting");
 
+        SetCurrentThreadAffinity("network", _threadAffinity);
+
         _updateTimer.expires_after(1ms);
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
         _ioContext.run();
@@ -164,6 +170,7 @@ private:
     std::atomic<bool> _stopped;
 
     std::unique_ptr<std::thread> _thread;
+    std::string _threadAffinity;
 
     SocketContainer _sockets;
 
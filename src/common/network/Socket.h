@@ -27,9 +27,10 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 #ifdef BOOST_ASIO_HAS_IOCP
 #define TC_SOCKET_USE_IOCP
@@ -214,9 +215,26 @@ public:
             });
     }
 
+    // Returns a buffer with at least size bytes of storage, reusing one that was already sent if possible
+    MessageBuffer AcquireWriteBuffer(std::size_t size)
+    {
+        for (auto itr = _freeWriteBuffers.begin(); itr != _freeWriteBuffers.end(); ++itr)
+        {
+            if (itr->GetBufferSize() < size)
+                continue;
+
+            MessageBuffer buffer = std::move(*itr);
+            _freeWriteBuffers.erase(itr);
+            buffer.Reset();
+            return buffer;
+        }
+
+        return MessageBuffer(size);
+    }
+
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -269,8 +287,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef TC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()),
+        std::size_t bytesToSend;
+        _socket.async_write_some(GatherWriteBuffers(bytesToSend),
             [self = this->shared_from_this()](boost::system::error_code const& error, std::size_t transferedBytes)
             {
                 self->WriteHandler(error, transferedBytes);
@@ -310,11 +328,47 @@ private:
 
     void QueuedBufferWriteDone()
     {
-        _writeQueue.pop();
+        MessageBuffer& buffer = _writeQueue.front();
+        if (_freeWriteBuffers.size() < MaxFreeWriteBuffers && buffer.GetBufferSize() <= MaxFreeWriteBufferSize)
+            _freeWriteBuffers.push_back(std::move(buffer));
+
+        _writeQueue.pop_front();
         if (_openState == OpenState_Closing && _writeQueue.empty())
             CloseSocket();
     }
 
+    // Collects the front of the write queue into a single buffer sequence so that it can be sent with one syscall
+    std::vector<boost::asio::const_buffer> const& GatherWriteBuffers(std::size_t& bytesToSend)
+    {
+        _gatheredWriteBuffers.clear();
+        bytesToSend = 0;
+        for (MessageBuffer& buffer : _writeQueue)
+        {
+            _gatheredWriteBuffers.emplace_back(buffer.GetReadPointer(), buffer.GetActiveSize());
+            bytesToSend += buffer.GetActiveSize();
+            if (_gatheredWriteBuffers.size() >= MaxGatheredWriteBuffers)
+                break;
+        }
+
+        return _gatheredWriteBuffers;
+    }
+
+    void WriteCompleted(std::size_t bytesSent)
+    {
+        while (bytesSent > 0 && !_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            if (bytesSent < buffer.GetActiveSize())
+            {
+                buffer.ReadCompleted(bytesSent);
+                return;
+            }
+
+            bytesSent -= buffer.GetActiveSize();
+            QueuedBufferWriteDone();
+        }
+    }
+
 #ifdef TC_SOCKET_USE_IOCP
 
     void WriteHandler(boost::system::error_code const& error, std::size_t transferedBytes)
@@ -322,9 +376,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-            if (!_writeQueue.front().GetActiveSize())
-                QueuedBufferWriteDone();
+            WriteCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -346,12 +398,9 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
-
+        std::size_t bytesToSend;
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(GatherWriteBuffers(bytesToSend), error);
 
         if (error)
         {
@@ -366,13 +415,11 @@ private:
             QueuedBufferWriteDone();
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
-        {
-            queuedMessage.ReadCompleted(bytesSent);
+
+        WriteCompleted(bytesSent);
+        if (bytesSent < bytesToSend) // now n > 0
             return AsyncProcessQueue();
-        }
 
-        QueuedBufferWriteDone();
         return !_writeQueue.empty();
     }
 
@@ -384,7 +431,15 @@ private:
     uint16 _remotePort = 0;
 
     MessageBuffer _readBuffer = MessageBuffer(0x1000);
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+
+    // sent buffers kept for AcquireWriteBuffer
+    static constexpr std::size_t MaxFreeWriteBuffers = 4;
+    static constexpr std::size_t MaxFreeWriteBufferSize = 0x10000;
+    std::vector<MessageBuffer> _freeWriteBuffers;
+
+    static constexpr std::size_t MaxGatheredWriteBuffers = 16;
+    std::vector<boost::asio::const_buffer> _gatheredWriteBuffers;
 
     // Socket open state "enum" (not enum to enable integral std::atomic api)
     static constexpr uint8 OpenState_Open       = 0x0;
@@ -69,7 +69,7 @@ public:
         ASSERT(_threads);
 
         for (int32 i = 0; i < _threadCount; ++i)
-            _threads[i].Start();
+            _threads[i].Start(_threadAffinity);
 
         _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
 
@@ -140,6 +140,7 @@ protected:
     std::unique_ptr<AsyncAcceptor> _acceptor;
     std::unique_ptr<NetworkThread<SocketType>[]> _threads;
     int32 _threadCount;
+    std::string _threadAffinity;   // set by derived managers before StartNetwork
 };
 }
 
@@ -18,8 +18,56 @@
 #include "SslStream.h"
 #include "IpAddress.h"
 #include "Log.h"
+#include <atomic>
+
+namespace
+{
+struct HandshakeCounters
+{
+    std::atomic<uint64> FullHandshakes;
+    std::atomic<uint64> ResumedHandshakes;
+    std::atomic<int64> FullHandshakeTime;
+    std::atomic<int64> ResumedHandshakeTime;
+    std::atomic<int64> NextReport;
+} Counters;
+}
 
 void Trinity::Net::SslHandshakeHelpers::LogFailure(boost::asio::ip::address const& ipAddress, uint16 port, boost::system::error_code const& error)
 {
     TC_LOG_ERROR("session", "{}:{} SSL Handshake failed {}", ipAddress, port, error.message());
 }
+
+void Trinity::Net::SslHandshakeHelpers::RecordSuccess(bool resumed, std::chrono::steady_clock::duration handshakeTime)
+{
+    int64 handshakeTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(handshakeTime).count();
+    if (resumed)
+    {
+        ++Counters.ResumedHandshakes;
+        Counters.ResumedHandshakeTime.fetch_add(handshakeTimeUs, std::memory_order_relaxed);
+    }
+    else
+    {
+        ++Counters.FullHandshakes;
+        Counters.FullHandshakeTime.fetch_add(handshakeTimeUs, std::memory_order_relaxed);
+    }
+
+    int64 nowUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64 nextReport = Counters.NextReport.load(std::memory_order_relaxed);
+    if (nowUs >= nextReport && Counters.NextReport.compare_exchange_strong(nextReport, nowUs + std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::minutes(1)).count()))
+    {
+        HandshakeStats stats = GetStats();
+        TC_LOG_DEBUG("server.ssl", "SSL handshakes: {} full (avg {} us), {} resumed (avg {} us)",
+            stats.FullHandshakes, stats.FullHandshakes ? stats.FullHandshakeTime.count() / int64(stats.FullHandshakes) : 0,
+            stats.ResumedHandshakes, stats.ResumedHandshakes ? stats.ResumedHandshakeTime.count() / int64(stats.ResumedHandshakes) : 0);
+    }
+}
+
+Trinity::Net::SslHandshakeHelpers::HandshakeStats Trinity::Net::SslHandshakeHelpers::GetStats()
+{
+    HandshakeStats stats;
+    stats.FullHandshakes = Counters.FullHandshakes.load(std::memory_order_relaxed);
+    stats.ResumedHandshakes = Counters.ResumedHandshakes.load(std::memory_order_relaxed);
+    stats.FullHandshakeTime = std::chrono::microseconds(Counters.FullHandshakeTime.load(std::memory_order_relaxed));
+    stats.ResumedHandshakeTime = std::chrono::microseconds(Counters.ResumedHandshakeTime.load(std::memory_order_relaxed));
+    return stats;
+}
@@ -24,12 +24,25 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/system/error_code.hpp>
+#include <chrono>
 
 namespace Trinity::Net
 {
 namespace SslHandshakeHelpers
 {
+struct HandshakeStats
+{
+    uint64 FullHandshakes = 0;
+    uint64 ResumedHandshakes = 0;
+    std::chrono::microseconds FullHandshakeTime = std::chrono::microseconds::zero();
+    std::chrono::microseconds ResumedHandshakeTime = std::chrono::microseconds::zero();
+};
+
 TC_NETWORK_API void LogFailure(boost::asio::ip::address const& ipAddress, uint16 port, boost::system::error_code const& error);
+
+// time is measured from the start of the handshake until it completed, including network round trips
+TC_NETWORK_API void RecordSuccess(bool resumed, std::chrono::steady_clock::duration handshakeTime);
+TC_NETWORK_API HandshakeStats GetStats();
 }
 
 template <typename SocketImpl>
@@ -40,7 +53,7 @@ struct SslHandshakeConnectionInitializer final : SocketConnectionInitializer
     void Start() override
     {
         _socket->underlying_stream().async_handshake(boost::asio::ssl::stream_base::server,
-            [socketRef = _socket->weak_from_this(), self = this->shared_from_this()](boost::system::error_code const& error)
+            [socketRef = _socket->weak_from_this(), self = this->shared_from_this(), start = std::chrono::steady_clock::now()](boost::system::error_code const& error)
             {
                 std::shared_ptr<SocketImpl> socket = static_pointer_cast<SocketImpl>(socketRef.lock());
                 if (!socket)
@@ -53,6 +66,7 @@ struct SslHandshakeConnectionInitializer final : SocketConnectionInitializer
                     return;
                 }
 
+                SslHandshakeHelpers::RecordSuccess(SSL_session_reused(socket->underlying_stream().native_handle()) != 0, std::chrono::steady_clock::now() - start);
                 self->InvokeNext();
         });
     }
@@ -147,6 +161,11 @@ public:
         return _sslSocket.async_handshake(type, std::forward<HandshakeHandlerType>(handler));
     }
 
+    SSL* native_handle()
+    {
+        return _sslSocket.native_handle();
+    }
+
     void set_server_name(std::string const& serverName, boost::system::error_code& error)
     {
         if (!SSL_set_tlsext_host_name(_sslSocket.native_handle(), serverName.c_str()))
@@ -32,8 +32,10 @@
 #include "DeadlineTimer.h"
 #include "GitRevision.h"
 #include "IPLocation.h"
+#include "IpBanList.h"
 #include "IpNetwork.h"
 #include "Locales.h"
+#include "LoginAdmission.h"
 #include "LoginRESTService.h"
 #include "Memory.h"
 #include "MySQLThreading.h"
@@ -43,6 +45,7 @@
 #include "SecretMgr.h"
 #include "SessionManager.h"
 #include "SslContext.h"
+#include "SslStream.h"
 #include "Util.h"
 #include <boost/asio/signal_set.hpp>
 #include <boost/dll/runtime_symbol_info.hpp>
@@ -205,6 +208,15 @@ int main(int argc, char** argv)
 
     Trinity::Net::ScanLocalNetworks();
 
+    sLoginAdmission.Initialize();
+
+    int32 networkThreads = sConfigMgr->GetIntDefault("Network.Threads", 1);
+    if (networkThreads <= 0)
+    {
+        TC_LOG_ERROR("server.bnetserver", "Network.Threads must be greater than 0");
+        return 1;
+    }
+
     std::string httpBindIp = sConfigMgr->GetStringDefault("BindIP", "0.0.0.0");
     int32 httpPort = sConfigMgr->GetIntDefault("LoginREST.Port", 8081);
     if (httpPort <= 0 || httpPort > 0xFFFF)
@@ -213,7 +225,7 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    if (!sLoginService.StartNetwork(*ioContext, httpBindIp, httpPort))
+    if (!sLoginService.StartNetwork(*ioContext, httpBindIp, httpPort, networkThreads))
     {
         TC_LOG_ERROR("server.bnetserver", "Failed to initialize login service");
         return 1;
@@ -234,9 +246,13 @@ int main(int argc, char** argv)
 
     auto sRealmListHandle = Trinity::make_unique_ptr_with_deleter<&RealmList::Close>(sRealmList);
 
+    sIpBanList->Initialize(*ioContext, sConfigMgr->GetIntDefault("IpBanList.UpdateInterval", 0));
+
+    auto sIpBanListHandle = Trinity::make_unique_ptr_with_deleter<&IpBanList::Close>(sIpBanList);
+
     std::string bindIp = sConfigMgr->GetStringDefault("BindIP", "0.0.0.0");
 
-    if (!sSessionMgr.StartNetwork(*ioContext, bindIp, bnport))
+    if (!sSessionMgr.StartNetwork(*ioContext, bindIp, bnport, networkThreads))
     {
         TC_LOG_ERROR("server.bnetserver", "Failed to initialize network");
         return 1;
@@ -293,6 +309,11 @@ int main(int argc, char** argv)
     banExpiryCheckTimer->cancel();
     dbPingTimer->cancel();
 
+    Trinity::Net::SslHandshakeHelpers::HandshakeStats handshakeStats = Trinity::Net::SslHandshakeHelpers::GetStats();
+    if (uint64 handshakes = handshakeStats.FullHandshakes + handshakeStats.ResumedHandshakes)
+        TC_LOG_INFO("server.bnetserver", "SSL handshakes: {} full, {} resumed ({}%)", handshakeStats.FullHandshakes, handshakeStats.ResumedHandshakes,
+            handshakeStats.ResumedHandshakes * 100 / handshakes);
+
     TC_LOG_INFO("server.bnetserver", "Halting process...");
 
     signals.cancel();
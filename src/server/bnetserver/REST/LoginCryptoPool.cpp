@@ -0,0 +1,133 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginCryptoPool.h"
+#include "Duration.h"
+#include "Log.h"
+#include "ThreadPool.h"
+#include <atomic>
+
+namespace Battlenet
+{
+LoginCryptoCallback::LoginCryptoCallback(std::future<void>&& work, std::shared_ptr<AsyncCompletionSignal> completion, std::function<void()>&& callback)
+    : _work(std::move(work)), _completion(std::move(completion)), _callback(std::move(callback))
+{
+}
+
+LoginCryptoCallback::~LoginCryptoCallback() = default;
+
+bool LoginCryptoCallback::InvokeIfReady()
+{
+    if (_work.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    _work.get();
+    _callback();
+    return true;
+}
+
+struct LoginCryptoPool::Counters
+{
+    std::atomic<uint32> QueuedTasks = 0;
+    std::atomic<uint64> CompletedTasks = 0;
+    std::atomic<uint64> RefusedTasks = 0;
+    std::atomic<int64> TotalQueueTime = 0;      // microseconds
+    std::atomic<int64> MaxQueueTime = 0;
+    std::atomic<int64> NextReport = 0;          // steady clock microseconds
+};
+
+LoginCryptoPool::LoginCryptoPool() : _counters(std::make_unique<Counters>()), _maxQueuedTasks(0)
+{
+}
+
+LoginCryptoPool::~LoginCryptoPool()
+{
+    Stop();
+}
+
+void LoginCryptoPool::Start(uint32 threadCount, uint32 maxQueuedTasks)
+{
+    _threads = std::make_unique<Trinity::ThreadPool>(std::max(threadCount, 1u));
+    _maxQueuedTasks = std::max(maxQueuedTasks, 1u);
+    TC_LOG_INFO("server.http.login", "Using {} threads for login cryptography, up to {} queued logins", std::max(threadCount, 1u), _maxQueuedTasks);
+}
+
+void LoginCryptoPool::Stop()
+{
+    if (!_threads)
+        return;
+
+    // queued work still runs, its callbacks are dropped together with the sessions that owned them
+    _threads->Join();
+    _threads.reset();
+}
+
+Optional<LoginCryptoCallback> LoginCryptoPool::Enqueue(std::function<void()>&& work, std::function<void()>&& callback)
+{
+    uint32 queued = _counters->QueuedTasks.load(std::memory_order_relaxed);
+    do
+    {
+        if (queued >= _maxQueuedTasks || !_threads)
+        {
+            uint64 refused = ++_counters->RefusedTasks;
+            if (refused == 1 || refused % 100 == 0)
+                TC_LOG_WARN("server.http.login", "Login cryptography queue is full ({} logins), {} logins refused so far", queued, refused);
+            return {};
+        }
+    } while (!_counters->QueuedTasks.compare_exchange_weak(queued, queued + 1, std::memory_order_relaxed));
+
+    AsyncCompletionPromise<void> promise;
+    std::future<void> future = promise.GetFuture();
+    std::shared_ptr<AsyncCompletionSignal> completion = promise.GetSignal();
+    _threads->PostWork([counters = _counters.get(), work = std::move(work), promise = std::make_shared<AsyncCompletionPromise<void>>(std::move(promise)),
+        queuedAt = std::chrono::steady_clock::now()]()
+    {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        int64 queueTime = std::chrono::duration_cast<std::chrono::microseconds>(now - queuedAt).count();
+        counters->TotalQueueTime.fetch_add(queueTime, std::memory_order_relaxed);
+        int64 maxQueueTime = counters->MaxQueueTime.load(std::memory_order_relaxed);
+        while (queueTime > maxQueueTime && !counters->MaxQueueTime.compare_exchange_weak(maxQueueTime, queueTime, std::memory_order_relaxed))
+            ;
+
+        work();
+
+        counters->QueuedTasks.fetch_sub(1, std::memory_order_relaxed);
+        uint64 completed = ++counters->CompletedTasks;
+        promise->SetValue();
+
+        int64 nowUs = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+        int64 nextReport = counters->NextReport.load(std::memory_order_relaxed);
+        if (nowUs >= nextReport && counters->NextReport.compare_exchange_strong(nextReport, nowUs + std::chrono::duration_cast<std::chrono::microseconds>(Minutes(1)).count()))
+            TC_LOG_DEBUG("server.http.login", "Login cryptography: {} logins done, {} queued, {} refused, queue time avg {} us, max {} us",
+                completed, counters->QueuedTasks.load(std::memory_order_relaxed), counters->RefusedTasks.load(std::memory_order_relaxed),
+                counters->TotalQueueTime.load(std::memory_order_relaxed) / int64(completed), counters->MaxQueueTime.load(std::memory_order_relaxed));
+    });
+
+    return Optional<LoginCryptoCallback>(std::in_place, std::move(future), std::move(completion), std::move(callback));
+}
+
+LoginCryptoPool::Stats LoginCryptoPool::GetStats() const
+{
+    Stats stats;
+    stats.CompletedTasks = _counters->CompletedTasks.load(std::memory_order_relaxed);
+    stats.RefusedTasks = _counters->RefusedTasks.load(std::memory_order_relaxed);
+    stats.QueuedTasks = _counters->QueuedTasks.load(std::memory_order_relaxed);
+    stats.TotalQueueTime = std::chrono::microseconds(_counters->TotalQueueTime.load(std::memory_order_relaxed));
+    stats.MaxQueueTime = std::chrono::microseconds(_counters->MaxQueueTime.load(std::memory_order_relaxed));
+    return stats;
+}
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LOGIN_CRYPTO_POOL_H
+#define TRINITYCORE_LOGIN_CRYPTO_POOL_H
+
+#include "AsyncCompletionSignal.h"
+#include "Define.h"
+#include "Optional.h"
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Trinity
+{
+class ThreadPool;
+}
+
+namespace Battlenet
+{
+// Work finished by the crypto pool, its callback is invoked by the session that queued it
+class LoginCryptoCallback
+{
+public:
+    LoginCryptoCallback(std::future<void>&& work, std::shared_ptr<AsyncCompletionSignal> completion, std::function<void()>&& callback);
+    LoginCryptoCallback(LoginCryptoCallback&& right) noexcept = default;
+    LoginCryptoCallback& operator=(LoginCryptoCallback&& right) noexcept = default;
+    ~LoginCryptoCallback();
+
+    // returns true when completed
+    bool InvokeIfReady();
+
+    AsyncCompletionSignal* GetCompletionSignal() const { return _completion.get(); }
+
+private:
+    LoginCryptoCallback(LoginCryptoCallback const& right) = delete;
+    LoginCryptoCallback& operator=(LoginCryptoCallback const& right) = delete;
+
+    std::future<void> _work;
+    std::shared_ptr<AsyncCompletionSignal> _completion;
+    std::function<void()> _callback;
+};
+
+inline bool InvokeAsyncCallbackIfReady(LoginCryptoCallback& callback) { return callback.InvokeIfReady(); }
+inline AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(LoginCryptoCallback& callback) { return callback.GetCompletionSignal(); }
+
+/*
+ * Threads doing the SRP math of logins (verifier modexp, public B, client evidence) so the network threads
+ * keep accepting connections and doing TLS handshakes during a login storm.
+ * The queue is bounded, once it is full new work is refused and the login is answered with "try again later"
+ * instead of letting every client wait behind it.
+ */
+class LoginCryptoPool
+{
+public:
+    struct Stats
+    {
+        uint64 CompletedTasks = 0;
+        uint64 RefusedTasks = 0;
+        uint32 QueuedTasks = 0;
+        std::chrono::microseconds TotalQueueTime = std::chrono::microseconds::zero();
+        std::chrono::microseconds MaxQueueTime = std::chrono::microseconds::zero();
+    };
+
+    LoginCryptoPool();
+    ~LoginCryptoPool();
+
+    LoginCryptoPool(LoginCryptoPool const&) = delete;
+    LoginCryptoPool(LoginCryptoPool&&) = delete;
+    LoginCryptoPool& operator=(LoginCryptoPool const&) = delete;
+    LoginCryptoPool& operator=(LoginCryptoPool&&) = delete;
+
+    void Start(uint32 threadCount, uint32 maxQueuedTasks);
+    void Stop();
+
+    // Runs work on a pool thread, nothing if maxQueuedTasks are waiting already
+    Optional<LoginCryptoCallback> Enqueue(std::function<void()>&& work, std::function<void()>&& callback);
+
+    // Counters since Start, the queue time is measured from Enqueue until a thread picked the work up
+    Stats GetStats() const;
+
+private:
+    struct Counters;
+
+    std::unique_ptr<Trinity::ThreadPool> _threads;
+    std::unique_ptr<Counters> _counters;
+    uint32 _maxQueuedTasks;
+};
+}
+
+#endif // TRINITYCORE_LOGIN_CRYPTO_POOL_H
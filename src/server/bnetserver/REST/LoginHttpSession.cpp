@@ -139,6 +139,7 @@ bool LoginHttpSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _cryptoProcessor.ProcessReadyCallbacks();
     return true;
 }
 
@@ -146,4 +147,9 @@ void LoginHttpSession::QueueQuery(QueryCallback&& queryCallback)
 {
     _queryProcessor.AddCallback(std::move(queryCallback));
 }
+
+void LoginHttpSession::QueueCryptoCallback(LoginCryptoCallback&& cryptoCallback)
+{
+    _cryptoProcessor.AddCallback(std::move(cryptoCallback));
+}
 }
@@ -24,9 +24,11 @@
 #include "DatabaseEnv.h"
 #include "IpNetwork.h"
 #include "IteratorPair.h"
+#include "LoginAdmission.h"
 #include "ProtobufJSON.h"
 #include "Resolver.h"
 #include "SslContext.h"
+#include "StringConvert.h"
 #include "Timer.h"
 #include "Util.h"
 
@@ -65,7 +67,7 @@ bool LoginRESTService::StartNetwork(Trinity::Asio::IoContext& ioContext, std::st
         return HandlePostLogin(std::move(session), context);
     }, RequestHandlerFlag::DoNotLogRequestContent);
 
-    RegisterHandler(boost::beast::http::verb::post, "/bnetserver/login/srp/"sv, [](std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context)
+    RegisterHandler(boost::beast::http::verb::post, "/bnetserver/login/srp/"sv, [this](std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context)
     {
         return HandlePostLoginSrpChallenge(std::move(session), context);
     });
@@ -129,6 +131,8 @@ bool LoginRESTService::StartNetwork(Trinity::Asio::IoContext& ioContext, std::st
 
     MigrateLegacyPasswordHashes();
 
+    _cryptoPool.Start(sConfigMgr->GetIntDefault("LoginREST.CryptoThreads"sv, 2), sConfigMgr->GetIntDefault("LoginREST.CryptoQueueSize"sv, 256));
+
     _acceptor->AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
     {
         OnSocketOpen(std::move(sock), threadIndex);
@@ -136,6 +140,17 @@ bool LoginRESTService::StartNetwork(Trinity::Asio::IoContext& ioContext, std::st
     return true;
 }
 
+void LoginRESTService::StopNetwork()
+{
+    HttpService::StopNetwork();
+    _cryptoPool.Stop();
+
+    LoginCryptoPool::Stats stats = _cryptoPool.GetStats();
+    if (stats.CompletedTasks)
+        TC_LOG_INFO("server.http.login", "Login cryptography: {} logins done, {} refused, queue time avg {} us, max {} us",
+            stats.CompletedTasks, stats.RefusedTasks, stats.TotalQueueTime.count() / int64(stats.CompletedTasks), stats.MaxQueueTime.count());
+}
+
 std::string const& LoginRESTService::GetHostnameForClient(boost::asio::ip::address const& address) const
 {
     if (Optional<std::size_t> addressIndex = Trinity::Net::SelectAddressForClient(address, _addresses))
@@ -240,8 +255,15 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandleGetPortal(std::sh
     return RequestHandlerResult::Handled;
 }
 
-LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const
+LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context)
 {
+    LoginAdmission::Admission admission = sLoginAdmission.TryAdmit(session->GetRemoteIpAddress());
+    if (!admission)
+    {
+        SendLoginServiceBusy(session, context, boost::beast::http::status::too_many_requests, admission.RetryAfter);
+        return RequestHandlerResult::Handled;
+    }
+
     std::shared_ptr<JSON::Login::LoginForm> loginForm = std::make_shared<JSON::Login::LoginForm>();
     if (!::JSON::Deserialize(context.request.body(), loginForm.get()))
     {
@@ -273,139 +295,176 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLogin(std::sh
     stmt->setString(0, login);
 
     session->QueueQuery(LoginDatabase.AsyncQuery(stmt)
-        .WithChainingPreparedCallback([this, session, context = std::move(context), loginForm = std::move(loginForm), getInputValue](QueryCallback& callback, PreparedQueryResult result) mutable
+        .WithPreparedCallback([this, session, context = std::make_shared<HttpRequestContext>(std::move(context)), loginForm = std::move(loginForm), getInputValue,
+            inFlightLogin = std::move(admission.Login)](PreparedQueryResult result) mutable
     {
         if (!result)
         {
             JSON::Login::LoginResult loginResult;
             loginResult.set_authentication_state(JSON::Login::DONE);
-            context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-            context.response.body() = ::JSON::Serialize(loginResult);
-            session->SendResponse(context);
+            context->response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+            context->response.body() = ::JSON::Serialize(loginResult);
+            session->SendResponse(*context);
             return;
         }
 
-        std::string login(getInputValue(loginForm.get(), "account_name"));
-        Utf8ToUpperOnlyLatin(login);
-        bool passwordCorrect = false;
-        Optional<std::string> serverM2;
+        std::shared_ptr<LoginCredentials> credentials = std::make_shared<LoginCredentials>();
+        credentials->Login = getInputValue(loginForm.get(), "account_name");
+        Utf8ToUpperOnlyLatin(credentials->Login);
 
         Field* fields = result->Fetch();
-        uint32 accountId = fields[0].GetUInt32();
+        credentials->AccountId = fields[0].GetUInt32();
+        credentials->FailedLogins = fields[4].GetUInt32();
+        credentials->LoginTicket = fields[5].GetString();
+        credentials->LoginTicketExpiry = fields[6].GetUInt32();
+        credentials->IsBanned = fields[7].GetUInt64() != 0;
+
+        // the srp math runs on the crypto pool, only this thread touches the session state
+        std::function<void()> checkCredentials;
         if (!session->GetSessionState()->Srp)
         {
             SrpVersion version = SrpVersion(fields[1].GetInt8());
-            std::string srpUsername = ByteArrayToHexStr(Trinity::Crypto::SHA256::GetDigestOf(login));
+            std::string srpUsername = ByteArrayToHexStr(Trinity::Crypto::SHA256::GetDigestOf(credentials->Login));
             Trinity::Crypto::SRP::Salt s = fields[2].GetBinary<Trinity::Crypto::SRP::SALT_LENGTH>();
             Trinity::Crypto::SRP::Verifier v = fields[3].GetBinary();
-            session->GetSessionState()->Srp = CreateSrpImplementation(version, SrpHashFunction::Sha256, srpUsername, s, v);
 
             std::string password(getInputValue(loginForm.get(), "password"));
             if (version == SrpVersion::v1)
                 Utf8ToUpperOnlyLatin(password);
 
-            passwordCorrect = session->GetSessionState()->Srp->CheckCredentials(srpUsername, password);
+            checkCredentials = [credentials, version, srpUsername = std::move(srpUsername), s, v = std::move(v), password = std::move(password)]()
+            {
+                credentials->Srp = CreateSrpImplementation(version, SrpHashFunction::Sha256, srpUsername, s, v);
+                credentials->PasswordCorrect = credentials->Srp && credentials->Srp->CheckCredentials(srpUsername, password);
+            };
         }
         else
         {
-            BigNumber A(getInputValue(loginForm.get(), "public_A"));
-            BigNumber M1(getInputValue(loginForm.get(), "client_evidence_M1"));
-            if (Optional<BigNumber> sessionKey = session->GetSessionState()->Srp->VerifyClientEvidence(A, M1))
+            credentials->Srp = std::move(session->GetSessionState()->Srp);
+            checkCredentials = [credentials, A = BigNumber(getInputValue(loginForm.get(), "public_A")), M1 = BigNumber(getInputValue(loginForm.get(), "client_evidence_M1"))]()
             {
-                passwordCorrect = true;
-                serverM2 = session->GetSessionState()->Srp->CalculateServerEvidence(A, M1, *sessionKey).AsHexStr();
-            }
+                if (Optional<BigNumber> sessionKey = credentials->Srp->VerifyClientEvidence(A, M1))
+                {
+                    credentials->PasswordCorrect = true;
+                    credentials->ServerM2 = credentials->Srp->CalculateServerEvidence(A, M1, *sessionKey).AsHexStr();
+                }
+            };
         }
 
-        uint32 failedLogins = fields[4].GetUInt32();
-        std::string loginTicket = fields[5].GetString();
-        uint32 loginTicketExpiry = fields[6].GetUInt32();
-        bool isBanned = fields[7].GetUInt64() != 0;
+        Optional<LoginCryptoCallback> cryptoCallback = _cryptoPool.Enqueue(std::move(checkCredentials), [this, session, context, credentials, inFlightLogin]()
+        {
+            if (!session->GetSessionState()->Srp)
+                session->GetSessionState()->Srp = std::move(credentials->Srp);
+
+            HandleLoginCredentialsChecked(session, *context, *credentials);
+        });
 
-        if (!passwordCorrect)
+        if (!cryptoCallback)
         {
-            if (!isBanned)
-            {
-                std::string ip_address = session->GetRemoteIpAddress().to_string();
-                uint32 maxWrongPassword = uint32(sConfigMgr->GetIntDefault("WrongPass.MaxCount", 0));
+            if (!session->GetSessionState()->Srp)
+                session->GetSessionState()->Srp = std::move(credentials->Srp);
 
-                if (sConfigMgr->GetBoolDefault("WrongPass.Logging", false))
-                    TC_LOG_DEBUG("server.http.login", "[{}, Account {}, Id {}] Attempted to connect with wrong password!", ip_address, login, accountId);
+            SendLoginServiceBusy(session, *context, boost::beast::http::status::service_unavailable, 5s);
+            return;
+        }
 
-                if (maxWrongPassword)
-                {
-                    LoginDatabaseTransaction trans = LoginDatabase.BeginTransaction();
-                    LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_FAILED_LOGINS);
-                    stmt->setUInt32(0, accountId);
-                    trans->Append(stmt);
+        session->QueueCryptoCallback(std::move(*cryptoCallback));
+    }));
 
-                    ++failedLogins;
+    return RequestHandlerResult::Async;
+}
+
+void LoginRESTService::HandleLoginCredentialsChecked(std::shared_ptr<LoginHttpSession> const& session, HttpRequestContext& context, LoginCredentials& credentials) const
+{
+    if (!credentials.PasswordCorrect)
+    {
+        if (!credentials.IsBanned)
+        {
+            std::string ip_address = session->GetRemoteIpAddress().to_string();
+            uint32 maxWrongPassword = uint32(sConfigMgr->GetIntDefault("WrongPass.MaxCount", 0));
+
+            if (sConfigMgr->GetBoolDefault("WrongPass.Logging", false))
+                TC_LOG_DEBUG("server.http.login", "[{}, Account {}, Id {}] Attempted to connect with wrong password!", ip_address, credentials.Login, credentials.AccountId);
 
-                    TC_LOG_DEBUG("server.http.login", "MaxWrongPass : {}, failed_login : {}", maxWrongPassword, accountId);
+            if (maxWrongPassword)
+            {
+                LoginDatabaseTransaction trans = LoginDatabase.BeginTransaction();
+                LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_FAILED_LOGINS);
+                stmt->setUInt32(0, credentials.AccountId);
+                trans->Append(stmt);
+
+                ++credentials.FailedLogins;
+
+                TC_LOG_DEBUG("server.http.login", "MaxWrongPass : {}, failed_login : {}", maxWrongPassword, credentials.AccountId);
 
-                    if (failedLogins >= maxWrongPassword)
+                if (credentials.FailedLogins >= maxWrongPassword)
+                {
+                    BanMode banType = BanMode(sConfigMgr->GetIntDefault("WrongPass.BanType", uint16(BanMode::BAN_IP)));
+                    int32 banTime = sConfigMgr->GetIntDefault("WrongPass.BanTime", 600);
+
+                    if (banType == BanMode::BAN_ACCOUNT)
                     {
-                        BanMode banType = BanMode(sConfigMgr->GetIntDefault("WrongPass.BanType", uint16(BanMode::BAN_IP)));
-                        int32 banTime = sConfigMgr->GetIntDefault("WrongPass.BanTime", 600);
-
-                        if (banType == BanMode::BAN_ACCOUNT)
-                        {
-                            stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_ACCOUNT_AUTO_BANNED);
-                            stmt->setUInt32(0, accountId);
-                        }
-                        else
-                        {
-                            stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_IP_AUTO_BANNED);
-                            stmt->setString(0, ip_address);
-                        }
-
-                        stmt->setUInt32(1, banTime);
-                        trans->Append(stmt);
-
-                        stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_RESET_FAILED_LOGINS);
-                        stmt->setUInt32(0, accountId);
-                        trans->Append(stmt);
+                        stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_ACCOUNT_AUTO_BANNED);
+                        stmt->setUInt32(0, credentials.AccountId);
                     }
+                    else
+                    {
+                        stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_IP_AUTO_BANNED);
+                        stmt->setString(0, ip_address);
+                    }
+
+                    stmt->setUInt32(1, banTime);
+                    trans->Append(stmt);
 
-                    LoginDatabase.CommitTransaction(trans);
+                    stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_RESET_FAILED_LOGINS);
+                    stmt->setUInt32(0, credentials.AccountId);
+                    trans->Append(stmt);
                 }
+
+                LoginDatabase.CommitTransaction(trans);
             }
+        }
 
-            JSON::Login::LoginResult loginResult;
-            loginResult.set_authentication_state(JSON::Login::DONE);
+        JSON::Login::LoginResult loginResult;
+        loginResult.set_authentication_state(JSON::Login::DONE);
 
-            context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-            context.response.body() = ::JSON::Serialize(loginResult);
-            session->SendResponse(context);
-            return;
-        }
+        context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+        context.response.body() = ::JSON::Serialize(loginResult);
+        session->SendResponse(context);
+        return;
+    }
 
-        if (loginTicket.empty() || loginTicketExpiry < time(nullptr))
-            loginTicket = "TC-" + ByteArrayToHexStr(Trinity::Crypto::GetRandomBytes<20>());
+    if (credentials.LoginTicket.empty() || credentials.LoginTicketExpiry < time(nullptr))
+        credentials.LoginTicket = "TC-" + ByteArrayToHexStr(Trinity::Crypto::GetRandomBytes<20>());
 
-        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_AUTHENTICATION);
-        stmt->setString(0, loginTicket);
-        stmt->setUInt32(1, time(nullptr) + _loginTicketDuration);
-        stmt->setUInt32(2, accountId);
-        callback.WithPreparedCallback([session, context = std::move(context), loginTicket = std::move(loginTicket), serverM2 = std::move(serverM2)](PreparedQueryResult) mutable
-        {
-            JSON::Login::LoginResult loginResult;
-            loginResult.set_authentication_state(JSON::Login::DONE);
-            loginResult.set_login_ticket(loginTicket);
-            if (serverM2)
-                loginResult.set_server_evidence_m2(*serverM2);
-
-            context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-            context.response.body() = ::JSON::Serialize(loginResult);
-            session->SendResponse(context);
-        }).SetNextQuery(LoginDatabase.AsyncQuery(stmt));
-    }));
+    LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_AUTHENTICATION);
+    stmt->setString(0, credentials.LoginTicket);
+    stmt->setUInt32(1, time(nullptr) + _loginTicketDuration);
+    stmt->setUInt32(2, credentials.AccountId);
+    session->QueueQuery(LoginDatabase.AsyncQuery(stmt)
+        .WithPreparedCallback([session, context = std::move(context), loginTicket = std::move(credentials.LoginTicket), serverM2 = std::move(credentials.ServerM2)](PreparedQueryResult) mutable
+    {
+        JSON::Login::LoginResult loginResult;
+        loginResult.set_authentication_state(JSON::Login::DONE);
+        loginResult.set_login_ticket(loginTicket);
+        if (serverM2)
+            loginResult.set_server_evidence_m2(*serverM2);
 
-    return RequestHandlerResult::Async;
+        context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+        context.response.body() = ::JSON::Serialize(loginResult);
+        session->SendResponse(context);
+    }));
 }
 
 LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChallenge(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context)
 {
+    LoginAdmission::Admission admission = sLoginAdmission.TryAdmit(session->GetRemoteIpAddress());
+    if (!admission)
+    {
+        SendLoginServiceBusy(session, context, boost::beast::http::status::too_many_requests, admission.RetryAfter);
+        return RequestHandlerResult::Handled;
+    }
+
     JSON::Login::LoginForm loginForm;
     if (!::JSON::Deserialize(context.request.body(), &loginForm))
     {
@@ -434,15 +493,16 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChall
     stmt->setString(0, login);
 
     session->QueueQuery(LoginDatabase.AsyncQuery(stmt)
-        .WithPreparedCallback([session, context = std::move(context), login = std::move(login)](PreparedQueryResult result) mutable
+        .WithPreparedCallback([this, session, context = std::make_shared<HttpRequestContext>(std::move(context)), login = std::move(login),
+            inFlightLogin = std::move(admission.Login)](PreparedQueryResult result) mutable
     {
         if (!result)
         {
             JSON::Login::LoginResult loginResult;
             loginResult.set_authentication_state(JSON::Login::DONE);
-            context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-            context.response.body() = ::JSON::Serialize(loginResult);
-            session->SendResponse(context);
+            context->response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+            context->response.body() = ::JSON::Serialize(loginResult);
+            session->SendResponse(*context);
             return;
         }
 
@@ -453,44 +513,80 @@ LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostLoginSrpChall
         Trinity::Crypto::SRP::Salt s = fields[1].GetBinary<Trinity::Crypto::SRP::SALT_LENGTH>();
         Trinity::Crypto::SRP::Verifier v = fields[2].GetBinary();
 
-        session->GetSessionState()->Srp = CreateSrpImplementation(version, hashFunction, srpUsername, s, v);
-        if (!session->GetSessionState()->Srp)
+        // generating the server public key B is a modexp, done by the crypto pool
+        std::shared_ptr<std::unique_ptr<Trinity::Crypto::SRP::BnetSRP6Base>> srp = std::make_shared<std::unique_ptr<Trinity::Crypto::SRP::BnetSRP6Base>>();
+        Optional<LoginCryptoCallback> cryptoCallback = _cryptoPool.Enqueue([srp, version, hashFunction, srpUsername, s, v = std::move(v)]()
         {
-            context.response.result(boost::beast::http::status::internal_server_error);
-            session->SendResponse(context);
-            return;
-        }
-
-        JSON::Login::SrpLoginChallenge challenge;
-        challenge.set_version(session->GetSessionState()->Srp->GetVersion());
-        challenge.set_iterations(session->GetSessionState()->Srp->GetXIterations());
-        challenge.set_modulus(session->GetSessionState()->Srp->GetN().AsHexStr());
-        challenge.set_generator(session->GetSessionState()->Srp->Getg().AsHexStr());
-        challenge.set_hash_function([=]
+            *srp = CreateSrpImplementation(version, hashFunction, srpUsername, s, v);
+        }, [session, context, srp, hashFunction, srpUsername, inFlightLogin]()
         {
-            switch (hashFunction)
+            if (!*srp)
             {
-                case SrpHashFunction::Sha256:
-                    return "SHA-256";
-                case SrpHashFunction::Sha512:
-                    return "SHA-512";
-                default:
-                    break;
+                context->response.result(boost::beast::http::status::internal_server_error);
+                session->SendResponse(*context);
+                return;
             }
-            return "";
-        }());
-        challenge.set_username(srpUsername);
-        challenge.set_salt(ByteArrayToHexStr(session->GetSessionState()->Srp->s));
-        challenge.set_public_b(session->GetSessionState()->Srp->B.AsHexStr());
 
-        context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
-        context.response.body() = ::JSON::Serialize(challenge);
-        session->SendResponse(context);
+            session->GetSessionState()->Srp = std::move(*srp);
+            SendSrpChallenge(session, *context, hashFunction, srpUsername);
+        });
+
+        if (!cryptoCallback)
+        {
+            SendLoginServiceBusy(session, *context, boost::beast::http::status::service_unavailable, 5s);
+            return;
+        }
+
+        session->QueueCryptoCallback(std::move(*cryptoCallback));
     }));
 
     return RequestHandlerResult::Async;
 }
 
+void LoginRESTService::SendSrpChallenge(std::shared_ptr<LoginHttpSession> const& session, HttpRequestContext& context, SrpHashFunction hashFunction, std::string const& srpUsername)
+{
+    JSON::Login::SrpLoginChallenge challenge;
+    challenge.set_version(session->GetSessionState()->Srp->GetVersion());
+    challenge.set_iterations(session->GetSessionState()->Srp->GetXIterations());
+    challenge.set_modulus(session->GetSessionState()->Srp->GetN().AsHexStr());
+    challenge.set_generator(session->GetSessionState()->Srp->Getg().AsHexStr());
+    challenge.set_hash_function([=]
+    {
+        switch (hashFunction)
+        {
+            case SrpHashFunction::Sha256:
+                return "SHA-256";
+            case SrpHashFunction::Sha512:
+                return "SHA-512";
+            default:
+                break;
+        }
+        return "";
+    }());
+    challenge.set_username(srpUsername);
+    challenge.set_salt(ByteArrayToHexStr(session->GetSessionState()->Srp->s));
+    challenge.set_public_b(session->GetSessionState()->Srp->B.AsHexStr());
+
+    context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+    context.response.body() = ::JSON::Serialize(challenge);
+    session->SendResponse(context);
+}
+
+void LoginRESTService::SendLoginServiceBusy(std::shared_ptr<LoginHttpSession> const& session, HttpRequestContext& context,
+    boost::beast::http::status status, Seconds retryAfter)
+{
+    JSON::Login::LoginResult loginResult;
+    loginResult.set_authentication_state(JSON::Login::LOGIN);
+    loginResult.set_error_code("SERVICE_UNAVAILABLE");
+    loginResult.set_error_message("There are too many logins at the moment. Please try again later.");
+
+    context.response.result(status);
+    context.response.set(boost::beast::http::field::retry_after, Trinity::ToString(retryAfter.count()));
+    context.response.set(boost::beast::http::field::content_type, "application/json;charset=utf-8");
+    context.response.body() = ::JSON::Serialize(loginResult);
+    session->SendResponse(context);
+}
+
 LoginRESTService::RequestHandlerResult LoginRESTService::HandlePostRefreshLoginTicket(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const
 {
     std::string ticket = ExtractAuthorization(context.request);
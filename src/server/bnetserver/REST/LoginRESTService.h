@@ -56,6 +56,7 @@ public:
     static LoginRESTService& Instance();
 
     bool StartNetwork(Trinity::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port, int32 threadCount = 1) override;
+    void StopNetwork() override;
 
     std::string const& GetHostnameForClient(boost::asio::ip::address const& address) const;
     uint16 GetPort() const { return _port; }
@@ -69,13 +70,32 @@ private:
     static RequestHandlerResult HandleGetGameAccounts(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context);
     RequestHandlerResult HandleGetPortal(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const;
 
-    RequestHandlerResult HandlePostLogin(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const;
-    static RequestHandlerResult HandlePostLoginSrpChallenge(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context);
+    RequestHandlerResult HandlePostLogin(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context);
+    RequestHandlerResult HandlePostLoginSrpChallenge(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context);
     RequestHandlerResult HandlePostRefreshLoginTicket(std::shared_ptr<LoginHttpSession> session, HttpRequestContext& context) const;
 
     static std::unique_ptr<Trinity::Crypto::SRP::BnetSRP6Base> CreateSrpImplementation(SrpVersion version, SrpHashFunction hashFunction,
         std::string const& username, Trinity::Crypto::SRP::Salt const& salt, Trinity::Crypto::SRP::Verifier const& verifier);
 
+    // account data of a login, kept while the crypto pool checks the password
+    struct LoginCredentials
+    {
+        std::string Login;
+        uint32 AccountId = 0;
+        uint32 FailedLogins = 0;
+        std::string LoginTicket;
+        uint32 LoginTicketExpiry = 0;
+        bool IsBanned = false;
+        std::unique_ptr<Trinity::Crypto::SRP::BnetSRP6Base> Srp;
+        bool PasswordCorrect = false;
+        Optional<std::string> ServerM2;
+    };
+
+    void HandleLoginCredentialsChecked(std::shared_ptr<LoginHttpSession> const& session, HttpRequestContext& context, LoginCredentials& credentials) const;
+    static void SendSrpChallenge(std::shared_ptr<LoginHttpSession> const& session, HttpRequestContext& context, SrpHashFunction hashFunction, std::string const& srpUsername);
+    static void SendLoginServiceBusy(std::shared_ptr<LoginHttpSession> const& session, HttpRequestContext& context,
+        boost::beast::http::status status, Seconds retryAfter);
+
     void MigrateLegacyPasswordHashes() const;
 
     JSON::Login::FormInputs _formInputs;
@@ -86,6 +106,7 @@ private:
     std::vector<boost::asio::ip::address> _addresses;
     std::size_t _firstLocalAddressIndex; // index inside _addresses where the first local address can be found
     uint32 _loginTicketDuration;
+    LoginCryptoPool _cryptoPool;
 };
 }
 
@@ -0,0 +1,124 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginAdmission.h"
+#include "Config.h"
+#include "Log.h"
+#include <cmath>
+#include <string_view>
+
+namespace
+{
+constexpr Seconds OverloadedRetryAfter = 5s;
+constexpr Minutes BucketCleanupInterval = 1min;
+}
+
+namespace Battlenet
+{
+std::size_t LoginAdmission::AddressKeyHash::operator()(AddressKey const& key) const
+{
+    return std::hash<std::string_view>()(std::string_view(reinterpret_cast<char const*>(key.data()), key.size()));
+}
+
+LoginAdmission::LoginAdmission() : _tokensPerSecond(0.0f), _burst(0.0f), _maxInFlight(0), _inFlight(0), _refused(0)
+{
+}
+
+LoginAdmission& LoginAdmission::Instance()
+{
+    static LoginAdmission instance;
+    return instance;
+}
+
+void LoginAdmission::Initialize()
+{
+    _tokensPerSecond = std::max(sConfigMgr->GetFloatDefault("LoginAdmission.IpRate", 1.0f), 0.0f);
+    _burst = std::max(sConfigMgr->GetFloatDefault("LoginAdmission.IpBurst", 10.0f), 1.0f);
+    _maxInFlight = uint32(std::max(sConfigMgr->GetIntDefault("LoginAdmission.MaxConcurrentLogins", 200), 0));
+    _nextCleanup = std::chrono::steady_clock::now() + BucketCleanupInterval;
+}
+
+LoginAdmission::Admission LoginAdmission::TryAdmit(boost::asio::ip::address const& address)
+{
+    Admission admission;
+
+    if (_tokensPerSecond > 0.0f)
+    {
+        AddressKey key = address.is_v4()
+            ? boost::asio::ip::make_address_v6(boost::asio::ip::v4_mapped, address.to_v4()).to_bytes()
+            : address.to_v6().to_bytes();
+
+        TimePoint now = std::chrono::steady_clock::now();
+        std::scoped_lock lock(_bucketsLock);
+        if (now >= _nextCleanup)
+            RemoveFullBuckets(now);
+
+        auto [itr, inserted] = _buckets.try_emplace(key, TokenBucket{ .Tokens = _burst, .LastRefill = now });
+        TokenBucket& bucket = itr->second;
+        if (!inserted)
+        {
+            bucket.Tokens = std::min(_burst, bucket.Tokens + std::chrono::duration<float>(now - bucket.LastRefill).count() * _tokensPerSecond);
+            bucket.LastRefill = now;
+        }
+
+        if (bucket.Tokens < 1.0f)
+        {
+            admission.Status = Result::RateLimited;
+            admission.RetryAfter = Seconds(int64(std::ceil((1.0f - bucket.Tokens) / _tokensPerSecond)));
+        }
+        else
+            bucket.Tokens -= 1.0f;
+    }
+
+    if (admission && _maxInFlight)
+    {
+        uint32 inFlight = _inFlight.load(std::memory_order_relaxed);
+        do
+        {
+            if (inFlight >= _maxInFlight)
+            {
+                admission.Status = Result::Overloaded;
+                admission.RetryAfter = OverloadedRetryAfter;
+                break;
+            }
+        } while (!_inFlight.compare_exchange_weak(inFlight, inFlight + 1, std::memory_order_relaxed));
+
+        if (admission)
+            admission.Login = std::make_shared<InFlightLogin>(_inFlight);
+    }
+
+    if (!admission)
+    {
+        uint64 refused = ++_refused;
+        if (refused == 1 || refused % 1000 == 0)
+            TC_LOG_INFO("server.bnetserver", "Login admission: {} logins refused so far, last one from {} ({})", refused, address.to_string(),
+                admission.Status == Result::RateLimited ? "rate limited" : "too many logins in progress");
+    }
+
+    return admission;
+}
+
+void LoginAdmission::RemoveFullBuckets(TimePoint now)
+{
+    std::erase_if(_buckets, [&](std::pair<AddressKey const, TokenBucket> const& bucket)
+    {
+        return bucket.second.Tokens + std::chrono::duration<float>(now - bucket.second.LastRefill).count() * _tokensPerSecond >= _burst;
+    });
+
+    _nextCleanup = now + BucketCleanupInterval;
+}
+}
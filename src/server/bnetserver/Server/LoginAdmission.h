@@ -0,0 +1,113 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LOGIN_ADMISSION_H
+#define TRINITYCORE_LOGIN_ADMISSION_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <boost/asio/ip/address.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Battlenet
+{
+/*
+ * Admission control of the auth pipeline (REST login, SRP challenge, web credentials of a bnet session).
+ * Every request takes a token from the bucket of its source address and a slot of the global cap on logins
+ * in progress, refused requests are answered right away without touching the database.
+ * Clients coming back after a restart are spread over time instead of all queueing in the login database.
+ */
+class LoginAdmission
+{
+public:
+    enum class Result : uint8
+    {
+        Admitted,
+        RateLimited,        // too many logins from the address
+        Overloaded          // too many logins in progress
+    };
+
+    // Slot of a login in progress, freed when the last reference goes away
+    class InFlightLogin
+    {
+    public:
+        explicit InFlightLogin(std::atomic<uint32>& inFlight) : _inFlight(inFlight) { }
+        ~InFlightLogin() { _inFlight.fetch_sub(1, std::memory_order_relaxed); }
+
+        InFlightLogin(InFlightLogin const&) = delete;
+        InFlightLogin(InFlightLogin&&) = delete;
+        InFlightLogin& operator=(InFlightLogin const&) = delete;
+        InFlightLogin& operator=(InFlightLogin&&) = delete;
+
+    private:
+        std::atomic<uint32>& _inFlight;
+    };
+
+    struct Admission
+    {
+        Result Status = Result::Admitted;
+        Seconds RetryAfter = 0s;
+        std::shared_ptr<InFlightLogin> Login;   // held until the login finished
+
+        explicit operator bool() const { return Status == Result::Admitted; }
+    };
+
+    static LoginAdmission& Instance();
+
+    void Initialize();
+
+    Admission TryAdmit(boost::asio::ip::address const& address);
+
+private:
+    LoginAdmission();
+
+    using AddressKey = std::array<uint8, 16>;
+
+    struct AddressKeyHash
+    {
+        std::size_t operator()(AddressKey const& key) const;
+    };
+
+    struct TokenBucket
+    {
+        float Tokens;
+        TimePoint LastRefill;
+    };
+
+    // buckets that refilled completely are the same as no bucket at all
+    void RemoveFullBuckets(TimePoint now);
+
+    float _tokensPerSecond;
+    float _burst;
+    uint32 _maxInFlight;
+
+    std::mutex _bucketsLock;
+    std::unordered_map<AddressKey, TokenBucket, AddressKeyHash> _buckets;
+    TimePoint _nextCleanup;
+
+    std::atomic<uint32> _inFlight;
+    std::atomic<uint64> _refused;
+};
+}
+
+#define sLoginAdmission Battlenet::LoginAdmission::Instance()
+
+#endif // TRINITYCORE_LOGIN_ADMISSION_H
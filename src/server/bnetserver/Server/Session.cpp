@@ -26,6 +26,7 @@
 #include "Hash.h"
 #include "IPLocation.h"
 #include "IpBanCheckConnectionInitializer.h"
+#include "LoginAdmission.h"
 #include "LoginRESTService.h"
 #include "MapUtils.h"
 #include "ProtobufJSON.h"
@@ -302,12 +303,17 @@ uint32 Battlenet::Session::VerifyWebCredentials(std::string const& webCredential
     if (webCredentials.empty())
         return ERROR_DENIED;
 
+    LoginAdmission::Admission admission = sLoginAdmission.TryAdmit(_socket->GetRemoteIpAddress());
+    if (!admission)
+        return ERROR_SERVER_BUSY;
+
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_ACCOUNT_INFO);
     stmt->setString(0, webCredentials);
 
     std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> asyncContinuation = std::move(continuation);
     std::shared_ptr<AccountInfo> accountInfo = std::make_shared<AccountInfo>();
-    QueueQuery(LoginDatabase.AsyncQuery(stmt).WithChainingPreparedCallback([this, accountInfo, asyncContinuation](QueryCallback& callback, PreparedQueryResult result)
+    // the slot of the login is held until the whole chain of queries finished
+    QueueQuery(LoginDatabase.AsyncQuery(stmt).WithChainingPreparedCallback([this, accountInfo, asyncContinuation, inFlightLogin = std::move(admission.Login)](QueryCallback& callback, PreparedQueryResult result)
     {
         Battlenet::Services::Authentication asyncContinuationService(this);
         NoData response;
@@ -385,7 +391,7 @@ uint32 Battlenet::Session::VerifyWebCredentials(std::string const& webCredential
         }
         else
         {
-            if (IpLocationRecord const* location = sIPLocation->GetLocationRecord(ip_address))
+            if (IpLocationRecord const* location = sIPLocation->GetLocationRecord(_socket->GetRemoteIpAddress()))
                 _ipCountry = location->CountryCode;
 
             TC_LOG_DEBUG("session", "[Session::HandleVerifyWebCredentials] Account '{}' is not locked to ip", _accountInfo->Login);
@@ -786,7 +792,9 @@ bool Battlenet::Session::ReadDataHandler()
 
     if (header.service_id() != 0xFE)
     {
-        sServiceDispatcher.Dispatch(this, header.service_hash(), header.token(), header.method_id(), std::move(_packetBuffer));
+        // the buffer keeps its storage for the next packet
+        sServiceDispatcher.Dispatch(this, header.service_hash(), header.token(), header.method_id(), _packetBuffer);
+        _packetBuffer.Reset();
     }
     else
     {
@@ -23,6 +23,7 @@
 #include "DatabaseEnvFwd.h"
 #include "Duration.h"
 #include "Realm.h"
+#include "ServiceBase.h"
 #include "Socket.h"
 #include "SslStream.h"
 #include <boost/asio/ip/tcp.hpp>
@@ -134,6 +135,8 @@ namespace Battlenet
 
         void QueueQuery(QueryCallback&& queryCallback);
 
+        RpcMessagePool* GetRpcMessagePool() { return &_rpcMessagePool; }
+
         uint32 HandleLogon(authentication::v1::LogonRequest const* logonRequest, std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)>& continuation);
         uint32 HandleVerifyWebCredentials(authentication::v1::VerifyWebCredentialsRequest const* verifyWebCredentialsRequest, std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)>& continuation);
         uint32 HandleGenerateWebCredentials(authentication::v1::GenerateWebCredentialsRequest const* request, std::function<void(ServiceBase*, uint32, google::protobuf::Message const*)>& continuation);
@@ -191,6 +194,8 @@ namespace Battlenet
 
         std::unordered_map<uint32, std::function<void(MessageBuffer)>> _responseCallbacks;
         uint32 _requestToken;
+
+        RpcMessagePool _rpcMessagePool;
     };
 }
 
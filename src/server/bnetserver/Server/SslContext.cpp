@@ -17,12 +17,18 @@
 
 #include "SslContext.h"
 #include "Config.h"
+#include "Duration.h"
 #include "Log.h"
 #include "Memory.h"
+#include "Optional.h"
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <openssl/core_names.h>
+#include <openssl/rand.h>
 #include <openssl/store.h>
 #include <openssl/ui.h>
+#include <array>
+#include <mutex>
 
 bool Battlenet::SslContext::_usesDevWildcardCertificate = false;
 
@@ -56,6 +62,106 @@ boost::system::error_code GetLastOpenSSLError()
 
     return boost::system::error_code(static_cast<int>(ossl_error), boost::asio::error::get_ssl_category());
 }
+
+// Session ticket keys shared by all network threads; a new key is made every rotation interval
+// and the previous one is kept to decrypt (and renew) tickets issued shortly before the rotation
+class SessionTicketKeys
+{
+public:
+    struct Key
+    {
+        std::array<unsigned char, 16> Name;
+        std::array<unsigned char, 32> AesKey;
+        std::array<unsigned char, 32> HmacKey;
+        TimePoint Created;
+    };
+
+    void SetRotationInterval(Seconds rotationInterval) { _rotationInterval = rotationInterval; }
+
+    bool GetCurrent(Key* key)
+    {
+        std::scoped_lock lock(_lock);
+        TimePoint now = std::chrono::steady_clock::now();
+        if (!_current || now - _current->Created >= _rotationInterval)
+        {
+            Key newKey;
+            if (RAND_bytes(newKey.Name.data(), int(newKey.Name.size())) != 1
+                || RAND_priv_bytes(newKey.AesKey.data(), int(newKey.AesKey.size())) != 1
+                || RAND_priv_bytes(newKey.HmacKey.data(), int(newKey.HmacKey.size())) != 1)
+                return false;
+
+            newKey.Created = now;
+            _previous = std::move(_current);
+            _current = std::move(newKey);
+            TC_LOG_DEBUG("server.ssl", "Rotated session ticket keys");
+        }
+
+        *key = *_current;
+        return true;
+    }
+
+    // returns false if the ticket was encrypted with a key that is no longer known
+    bool Find(unsigned char const* name, Key* key, bool* isCurrent) const
+    {
+        std::scoped_lock lock(_lock);
+        for (Optional<Key> const* candidate : { &_current, &_previous })
+        {
+            if (*candidate && std::equal((*candidate)->Name.begin(), (*candidate)->Name.end(), name))
+            {
+                *key = **candidate;
+                *isCurrent = candidate == &_current;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    mutable std::mutex _lock;
+    Optional<Key> _current;
+    Optional<Key> _previous;
+    Seconds _rotationInterval = 1h;
+} TicketKeys;
+
+bool InitTicketMac(EVP_MAC_CTX* macContext, SessionTicketKeys::Key& key)
+{
+    std::array<OSSL_PARAM, 3> params =
+    {
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.HmacKey.data(), key.HmacKey.size()),
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0),
+        OSSL_PARAM_construct_end()
+    };
+
+    return EVP_MAC_CTX_set_params(macContext, params.data()) == 1;
+}
+
+int SessionTicketKeyCallback(SSL* /*ssl*/, unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* cipherContext, EVP_MAC_CTX* macContext, int encrypt)
+{
+    SessionTicketKeys::Key key;
+    if (encrypt)
+    {
+        if (!TicketKeys.GetCurrent(&key) || RAND_bytes(iv, EVP_CIPHER_get_iv_length(EVP_aes_256_cbc())) != 1)
+            return -1;
+
+        std::copy(key.Name.begin(), key.Name.end(), keyName);
+        if (EVP_EncryptInit_ex(cipherContext, EVP_aes_256_cbc(), nullptr, key.AesKey.data(), iv) != 1 || !InitTicketMac(macContext, key))
+            return -1;
+
+        return 1;
+    }
+
+    // unknown key, fall back to a full handshake
+    bool isCurrent = false;
+    if (!TicketKeys.Find(keyName, &key, &isCurrent))
+        return 0;
+
+    if (EVP_DecryptInit_ex(cipherContext, EVP_aes_256_cbc(), nullptr, key.AesKey.data(), iv) != 1 || !InitTicketMac(macContext, key))
+        return -1;
+
+    // tickets of the previous key are accepted but replaced by one using the current key
+    return isCurrent ? 1 : 2;
+}
 }
 
 bool Battlenet::SslContext::Initialize()
@@ -158,6 +264,36 @@ bool Battlenet::SslContext::Initialize()
 
 #undef LOAD_CHECK
 
+    if (EVP_PKEY* privateKey = SSL_CTX_get0_privatekey(nativeContext))
+        TC_LOG_INFO("server.ssl", "Using {} bit {} private key", EVP_PKEY_get_bits(privateKey), EVP_PKEY_get0_type_name(privateKey));
+
+    // prefer the cheapest key exchanges, clients reconnect for every realm switch
+    if (!SSL_CTX_set1_groups_list(nativeContext, "X25519:P-256:P-384"))
+        TC_LOG_ERROR("server.ssl", "SSL_CTX_set1_groups_list failed: {}", GetLastOpenSSLError().message());
+
+    // resumed sessions skip the certificate signature and key exchange of a full handshake
+    Seconds sessionTimeout = Seconds(std::max(sConfigMgr->GetIntDefault("SSL.SessionTimeout", 3600), 60));
+    int32 sessionCacheSize = sConfigMgr->GetIntDefault("SSL.SessionCacheSize", 20480);
+
+    static constexpr unsigned char SessionIdContext[] = "bnetserver";
+    SSL_CTX_set_session_id_context(nativeContext, SessionIdContext, sizeof(SessionIdContext) - 1);
+    SSL_CTX_set_timeout(nativeContext, long(sessionTimeout.count()));
+    if (sessionCacheSize > 0)
+    {
+        SSL_CTX_set_session_cache_mode(nativeContext, SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(nativeContext, sessionCacheSize);
+    }
+    else
+        SSL_CTX_set_session_cache_mode(nativeContext, SSL_SESS_CACHE_OFF);
+
+    if (sConfigMgr->GetBoolDefault("SSL.SessionTickets", true))
+    {
+        TicketKeys.SetRotationInterval(sessionTimeout);
+        SSL_CTX_set_tlsext_ticket_key_evp_cb(nativeContext, &SessionTicketKeyCallback);
+    }
+    else
+        SSL_CTX_set_options(nativeContext, SSL_OP_NO_TICKET);
+
     return true;
 }
 
@@ -42,3 +42,8 @@ std::string Battlenet::ServiceBaseCaller::GetCallerInfo() const
 {
     return _session->GetClientInfo();
 }
+
+RpcMessagePool* Battlenet::ServiceBaseCaller::GetMessagePool()
+{
+    return _session->GetRpcMessagePool();
+}
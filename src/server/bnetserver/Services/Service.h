@@ -27,6 +27,8 @@ namespace google::protobuf
 class Message;
 }
 
+class RpcMessagePool;
+
 namespace bgs::protocol { }
 using namespace bgs::protocol;
 
@@ -44,6 +46,7 @@ namespace Battlenet
         void SendResponse(uint32 serviceHash, uint32 methodId, uint32 token, uint32 status);
         void SendResponse(uint32 serviceHash, uint32 methodId, uint32 token, google::protobuf::Message const* response);
         std::string GetCallerInfo() const;
+        RpcMessagePool* GetMessagePool();
 
         Session* _session;
     };
@@ -79,6 +82,11 @@ namespace Battlenet
         {
             return ServiceBaseCaller::GetCallerInfo();
         }
+
+        RpcMessagePool* GetMessagePool() override
+        {
+            return ServiceBaseCaller::GetMessagePool();
+        }
     };
 }
 
@@ -54,11 +54,11 @@ Battlenet::ServiceDispatcher::ServiceDispatcher()
     AddService<Service<whisper::v2::client::WhisperService>>();
 }
 
-void Battlenet::ServiceDispatcher::Dispatch(Session* session, uint32 serviceHash, uint32 token, uint32 methodId, MessageBuffer buffer)
+void Battlenet::ServiceDispatcher::Dispatch(Session* session, uint32 serviceHash, uint32 token, uint32 methodId, MessageBuffer& buffer)
 {
     auto itr = _dispatchers.find(serviceHash);
     if (itr != _dispatchers.end())
-        itr->second(session, token, methodId, std::move(buffer));
+        itr->second(session, token, methodId, buffer);
     else
         TC_LOG_DEBUG("session.rpc", "{} tried to call invalid service 0x{:X}", session->GetClientInfo(), serviceHash);
 }
@@ -28,7 +28,7 @@ namespace Battlenet
     class ServiceDispatcher
     {
     public:
-        void Dispatch(Session* session, uint32 serviceHash, uint32 token, uint32 methodId, MessageBuffer buffer);
+        void Dispatch(Session* session, uint32 serviceHash, uint32 token, uint32 methodId, MessageBuffer& buffer);
 
         static ServiceDispatcher& Instance();
 
@@ -42,12 +42,12 @@ namespace Battlenet
         }
 
         template<class Service>
-        static void Dispatch(Session* session, uint32 token, uint32 methodId, MessageBuffer buffer)
+        static void Dispatch(Session* session, uint32 token, uint32 methodId, MessageBuffer& buffer)
         {
-            Service(session).CallServerMethod(token, methodId, std::move(buffer));
+            Service(session).CallServerMethod(token, methodId, buffer);
         }
 
-        typedef void(*ServiceMethod)(Session*, uint32, uint32, MessageBuffer);
+        typedef void(*ServiceMethod)(Session*, uint32, uint32, MessageBuffer&);
         std::unordered_map<uint32, ServiceMethod> _dispatchers;
     };
 }
@@ -27,6 +27,7 @@ class Field;
 class ResultSet;
 using QueryResult = std::shared_ptr<ResultSet>;
 
+class MySQLConnection;
 class CharacterDatabaseConnection;
 class HotfixDatabaseConnection;
 class LoginDatabaseConnection;
@@ -47,6 +48,7 @@ using PreparedQueryResult = std::shared_ptr<PreparedResultSet>;
 
 class QueryCallback;
 bool InvokeAsyncCallbackIfReady(QueryCallback& callback);
+AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(QueryCallback& callback);
 
 using QueryCallbackProcessor = AsyncCallbackProcessor<QueryCallback>;
 
@@ -57,6 +59,7 @@ class Transaction;
 
 class TransactionCallback;
 bool InvokeAsyncCallbackIfReady(TransactionCallback& callback);
+AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(TransactionCallback& callback);
 
 template<typename T>
 using SQLTransaction = std::shared_ptr<Transaction<T>>;
@@ -78,6 +81,7 @@ using WorldDatabaseQueryHolder = SQLQueryHolder<WorldDatabaseConnection>;
 
 class SQLQueryHolderCallback;
 bool InvokeAsyncCallbackIfReady(SQLQueryHolderCallback& callback);
+AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(SQLQueryHolderCallback& callback);
 
 // mysql
 struct MySQLHandle;
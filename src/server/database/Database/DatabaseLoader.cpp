@@ -22,6 +22,7 @@
 #include "Log.h"
 
 #include <mysqld_error.h>
+#include <algorithm>
 
 DatabaseLoader::DatabaseLoader(std::string const& logger, uint32 const defaultUpdateMask)
     : _logger(logger), _autoSetup(sConfigMgr->GetBoolDefault("Updates.AutoSetup", true)),
@@ -51,9 +52,24 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
             return false;
         }
 
+        int32 const maxAsyncThreads = sConfigMgr->GetIntDefault(name + "Database.WorkerThreads.Max", 0);
+        if (maxAsyncThreads < 0 || maxAsyncThreads > 32)
+        {
+            TC_LOG_ERROR(_logger, "{} database: invalid maximum number of worker threads specified. "
+                "Please pick a value between 0 and 32.", name);
+            return false;
+        }
+
         uint8 const synchThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.SynchThreads", 1));
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetGroupCommit(uint32(std::max(sConfigMgr->GetIntDefault(name + "Database.GroupCommit.MaxTransactions", 1), 1)),
+            Milliseconds(std::max(sConfigMgr->GetIntDefault(name + "Database.GroupCommit.Delay", 0), 0)));
+        pool.SetResultCache(uint32(std::max(sConfigMgr->GetIntDefault(name + "Database.ResultCache.MaxEntries", 0), 0)));
+        pool.SetAutoscaling(uint8(maxAsyncThreads), uint32(std::max(sConfigMgr->GetIntDefault(name + "Database.WorkerThreads.ScaleUpQueueSize", 100), 1)));
+        pool.SetStatementLatencyTracking(sConfigMgr->GetBoolDefault(name + "Database.StatementLatency", false));
+        pool.SetQueryHolderParallelism(uint32(std::max(sConfigMgr->GetIntDefault(name + "Database.QueryHolder.MaxParallelTasks", 1), 1)));
+        pool.SetWorkerThreadAffinity(sConfigMgr->GetStringDefault(name + "Database.WorkerThreads.Affinity", ""));
         if (uint32 error = pool.Open())
         {
             // Database does not exist
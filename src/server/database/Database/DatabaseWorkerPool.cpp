@@ -17,7 +17,9 @@
 
 #include "DatabaseWorkerPool.h"
 #include "AdhocStatement.h"
+#include "AsyncCompletionSignal.h"
 #include "Common.h"
+#include "DeadlineTimer.h"
 #include "Errors.h"
 #include "IoContext.h"
 #include "Implementation/LoginDatabase.h"
@@ -25,16 +27,20 @@
 #include "Implementation/CharacterDatabase.h"
 #include "Implementation/HotfixDatabase.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLPreparedStatement.h"
 #include "PreparedStatement.h"
 #include "ProducerConsumerQueue.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
+#include "QueryResultCache.h"
+#include "StatementLatencyTracker.h"
 #include "Transaction.h"
 #include "MySQLWorkaround.h"
-#include <boost/asio/use_future.hpp>
 #include <mysqld_error.h>
+#include <algorithm>
+#include <iterator>
 #include <utility>
 #ifdef TRINITY_DEBUG
 #include <boost/stacktrace.hpp>
@@ -73,6 +79,14 @@ static consteval uint32 ParseVersionString(std::string_view chars)
 
 namespace
 {
+// seconds the queue has to stay long before another async connection is opened
+constexpr uint32 AUTOSCALE_BUSY_CHECKS = 3;
+// seconds the queue has to stay empty before a connection opened by the autoscaler is closed
+constexpr uint32 AUTOSCALE_IDLE_CHECKS = 60;
+
+//! Query holders are not split into tasks running fewer statements than this, the round trips saved would not pay for the extra task
+constexpr std::size_t QUERY_HOLDER_MIN_STATEMENTS_PER_TASK = 4;
+
 #ifdef TRINITY_DEBUG
 template<typename Database>
 thread_local bool WarnSyncQueries = false;
@@ -131,7 +145,9 @@ private:
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool()
-    : _async_threads(0), _synch_threads(0)
+    : _async_threads(0), _synch_threads(0), _groupCommitState(GroupCommitState::Idle), _maxGroupedTransactions(1), _groupCommitDelay(0),
+    _trackStatementLatency(false), _maxAsyncThreads(0), _scaleUpQueueSize(0), _busyChecks(0), _idleChecks(0),
+    _maxQueryHolderTasks(1)
 {
     // We only need check compiled version match on Windows
     // because on other platforms ABI compatibility is ensured by SOVERSION
@@ -162,6 +178,51 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string const& infoString,
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetGroupCommit(uint32 maxTransactions, Milliseconds delay)
+{
+    _maxGroupedTransactions = std::max(maxTransactions, 1u);
+    _groupCommitDelay = delay;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetResultCache(uint32 maxEntries)
+{
+    if (!maxEntries)
+    {
+        _resultCache.reset();
+        return;
+    }
+
+    _resultCache = std::make_unique<QueryResultCache>(maxEntries);
+    T::RegisterCachedStatements(*_resultCache);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetAutoscaling(uint8 maxAsyncThreads, uint32 scaleUpQueueSize)
+{
+    _maxAsyncThreads = maxAsyncThreads;
+    _scaleUpQueueSize = std::max(scaleUpQueueSize, 1u);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetStatementLatencyTracking(bool enable)
+{
+    _trackStatementLatency = enable;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetQueryHolderParallelism(uint32 maxTasks)
+{
+    _maxQueryHolderTasks = std::max(maxTasks, 1u);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetWorkerThreadAffinity(std::string threadAffinity)
+{
+    _workerThreadAffinity = std::move(threadAffinity);
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
@@ -172,6 +233,8 @@ uint32 DatabaseWorkerPool<T>::Open()
         GetDatabaseName(), _async_threads, _synch_threads);
 
     _ioContext = std::make_unique<Trinity::Asio::IoContext>(_async_threads);
+    if (_maxGroupedTransactions > 1 && _groupCommitDelay > 0ms)
+        _groupCommitTimer = std::make_unique<Trinity::Asio::DeadlineTimer>(_ioContext->get_executor());
 
     uint32 error = OpenConnections(IDX_ASYNC, _async_threads);
 
@@ -184,7 +247,7 @@ uint32 DatabaseWorkerPool<T>::Open()
         return error;
 
     for (std::unique_ptr<T> const& connection : _connections[IDX_ASYNC])
-        connection->StartWorkerThread(_ioContext.get());
+        connection->StartWorkerThread(_ioContext.get(), _workerThreadAffinity);
 
     TC_LOG_INFO("sql.driver", "DatabasePool '{}' opened successfully. "
         "{} total connections running.", GetDatabaseName(),
@@ -202,8 +265,15 @@ void DatabaseWorkerPool<T>::Close()
         _ioContext->stop();
 
     //! Closes the actualy MySQL connection.
-    _connections[IDX_ASYNC].clear();
+    std::vector<std::unique_ptr<T>> asyncConnections;
+    {
+        std::scoped_lock lock(_asyncConnectionsLock);
+        asyncConnections.swap(_connections[IDX_ASYNC]);
+    }
+    asyncConnections.clear();
 
+    _groupCommitTimer.reset();
+    _autoscaleTimer.reset();
     _ioContext.reset();
 
     TC_LOG_INFO("sql.driver", "Asynchronous connections on DatabasePool '{}' terminated. "
@@ -260,6 +330,16 @@ bool DatabaseWorkerPool<T>::PrepareStatements()
         }
     }
 
+    if (_trackStatementLatency)
+        _statementLatency = std::make_unique<StatementLatencyTracker>(_preparedStatementSize.size());
+
+    // connections opened later prepare their statements on their own
+    if (_maxAsyncThreads > _async_threads)
+    {
+        _autoscaleTimer = std::make_unique<Trinity::Asio::DeadlineTimer>(_ioContext->get_executor());
+        ScheduleAutoscale();
+    }
+
     return true;
 }
 
@@ -278,9 +358,25 @@ QueryResult DatabaseWorkerPool<T>::Query(char const* sql, T* connection /*= null
 template <class T>
 PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
 {
+    uint64 generation = 0;
+    if (_resultCache)
+    {
+        if (PreparedQueryResult cached = _resultCache->Find(stmt, generation))
+        {
+            delete stmt;
+            return cached;
+        }
+    }
+
+    TimePoint queued = std::chrono::steady_clock::now();
     T* connection = GetFreeConnection();
+    TimePoint started = std::chrono::steady_clock::now();
     PreparedQueryResult ret = PreparedStatementTask::Query(connection, stmt);
     connection->Unlock();
+    RecordStatementLatency(stmt, queued, started);
+
+    if (_resultCache)
+        _resultCache->Store(stmt, generation, ret);
 
     //! Delete proxy-class. Not needed anymore
     delete stmt;
@@ -288,37 +384,122 @@ PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
     return ret;
 }
 
+template <class T>
+PreparedQueryResult DatabaseWorkerPool<T>::QueryUnbuffered(PreparedStatement<T>* stmt)
+{
+    T* connection = GetFreeConnection();
+    //! The result set takes over the connection lock and releases it after the last row
+    PreparedResultSet* result = connection->QueryUnbuffered(stmt);
+    if (!result)
+        connection->Unlock();
+    else if (!result->GetRowCount())
+    {
+        delete result;
+        result = nullptr;
+    }
+
+    //! Delete proxy-class. Not needed anymore
+    delete stmt;
+
+    return PreparedQueryResult(result);
+}
+
 template <class T>
 QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql)
 {
-    std::future<QueryResult> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, sql = std::string(sql), tracker = QueueSizeTracker(this)]
+    AsyncCompletionPromise<QueryResult> promise;
+    QueryCallback callback(promise.GetFuture(), promise.GetSignal());
+    boost::asio::post(_ioContext->get_executor(), [this, sql = std::string(sql), promise = std::move(promise), tracker = QueueSizeTracker(this)]() mutable
     {
         T* conn = GetAsyncConnectionForCurrentThread();
-        return BasicStatementTask::Query(conn, sql.c_str());
-    }));
-    return QueryCallback(std::move(result));
+        promise.SetValue(BasicStatementTask::Query(conn, sql.c_str()));
+    });
+    return callback;
 }
 
 template <class T>
 QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 {
-    std::future<PreparedQueryResult> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
+    uint64 generation = 0;
+    if (_resultCache)
+    {
+        if (PreparedQueryResult cached = _resultCache->Find(stmt, generation))
+        {
+            delete stmt;
+            AsyncCompletionPromise<PreparedQueryResult> promise;
+            QueryCallback callback(promise.GetFuture(), promise.GetSignal());
+            promise.SetValue(std::move(cached));
+            return callback;
+        }
+    }
+
+    AsyncCompletionPromise<PreparedQueryResult> promise;
+    QueryCallback callback(promise.GetFuture(), promise.GetSignal());
+    boost::asio::post(_ioContext->get_executor(), [this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), generation, queued = std::chrono::steady_clock::now(), promise = std::move(promise), tracker = QueueSizeTracker(this)]() mutable
     {
         T* conn = GetAsyncConnectionForCurrentThread();
-        return PreparedStatementTask::Query(conn, stmt.get());
-    }));
-    return QueryCallback(std::move(result));
+        TimePoint started = std::chrono::steady_clock::now();
+        PreparedQueryResult ret = PreparedStatementTask::Query(conn, stmt.get());
+        RecordStatementLatency(stmt.get(), queued, started);
+        if (_resultCache)
+            _resultCache->Store(stmt.get(), generation, ret);
+        promise.SetValue(std::move(ret));
+    });
+    return callback;
 }
 
 template <class T>
 SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
 {
-    std::future<void> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, holder, tracker = QueueSizeTracker(this)]
+    AsyncCompletionPromise<void> promise;
+    std::future<void> result = promise.GetFuture();
+    std::shared_ptr<AsyncCompletionSignal> completion = promise.GetSignal();
+
+    std::size_t tasks = 1;
+    if (_maxQueryHolderTasks > 1)
     {
-        T* conn = GetAsyncConnectionForCurrentThread();
-        SQLQueryHolderTask::Execute(conn, holder.get());
-    }));
-    return { std::move(holder), std::move(result) };
+        std::size_t connections;
+        {
+            std::scoped_lock lock(_asyncConnectionsLock);
+            connections = _connections[IDX_ASYNC].size();
+        }
+
+        tasks = std::min({ std::size_t(_maxQueryHolderTasks), connections, holder->GetSize() / QUERY_HOLDER_MIN_STATEMENTS_PER_TASK });
+    }
+
+    if (tasks <= 1)
+    {
+        boost::asio::post(_ioContext->get_executor(), [this, holder, promise = std::move(promise), tracker = QueueSizeTracker(this)]() mutable
+        {
+            T* conn = GetAsyncConnectionForCurrentThread();
+            SQLQueryHolderTask::Execute(conn, holder.get());
+            promise.SetValue();
+        });
+        return { std::move(holder), std::move(result), std::move(completion) };
+    }
+
+    // the statements of a holder only read, each task runs every tasks-th one and the last to finish completes the holder
+    struct ParallelExecution
+    {
+        ParallelExecution(AsyncCompletionPromise<void>&& promise, std::size_t tasks) : Promise(std::move(promise)), RemainingTasks(tasks) { }
+
+        AsyncCompletionPromise<void> Promise;
+        std::atomic<std::size_t> RemainingTasks;
+    };
+
+    std::shared_ptr<ParallelExecution> execution = std::make_shared<ParallelExecution>(std::move(promise), tasks);
+    for (std::size_t i = 0; i < tasks; ++i)
+    {
+        boost::asio::post(_ioContext->get_executor(), [this, holder, execution, first = i, stride = tasks, tracker = QueueSizeTracker(this)]()
+        {
+            T* conn = GetAsyncConnectionForCurrentThread();
+            SQLQueryHolderTask::Execute(conn, holder.get(), first, stride);
+            if (--execution->RemainingTasks == 0)
+                execution->Promise.SetValue();
+        });
+    }
+
+    return { std::move(holder), std::move(result), std::move(completion) };
 }
 
 template <class T>
@@ -347,13 +528,128 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // TRINITY_DEBUG
 
+    BeginCachedResultsWrite(*transaction);
+
+    if (_maxGroupedTransactions > 1)
+    {
+        if (!transaction->GetSize())
+            return;
+
+        ++_queueSize;
+
+        std::scoped_lock lock(_groupedTransactionsLock);
+        _groupedTransactions.push_back(std::move(transaction));
+        // a full group does not wait for the timer
+        if (_groupCommitState == GroupCommitState::Idle)
+            ScheduleGroupedTransactions(false);
+        else if (_groupCommitState == GroupCommitState::Waiting && _groupedTransactions.size() >= _maxGroupedTransactions)
+            ScheduleGroupedTransactions(true);
+
+        return;
+    }
+
     boost::asio::post(_ioContext->get_executor(), [this, transaction, tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         TransactionTask::Execute(conn, transaction);
+        EndCachedResultsWrite(*transaction);
     });
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::ScheduleGroupedTransactions(bool immediate)
+{
+    if (immediate || !_groupCommitTimer)
+    {
+        // a cancelled timer still runs its handler, with an error unless it had already expired
+        // ExecuteGroupedTransactions ignores such extra calls
+        if (_groupCommitState == GroupCommitState::Waiting)
+            _groupCommitTimer->cancel();
+
+        _groupCommitState = GroupCommitState::Queued;
+        boost::asio::post(_ioContext->get_executor(), [this] { ExecuteGroupedTransactions(); });
+        return;
+    }
+
+    _groupCommitState = GroupCommitState::Waiting;
+    _groupCommitTimer->expires_after(_groupCommitDelay);
+    _groupCommitTimer->async_wait([this](boost::system::error_code const& error)
+    {
+        if (!error)
+            ExecuteGroupedTransactions();
+    });
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ExecuteGroupedTransactions()
+{
+    std::vector<std::shared_ptr<TransactionBase>> transactions;
+    {
+        std::scoped_lock lock(_groupedTransactionsLock);
+        if (_groupCommitState != GroupCommitState::Waiting && _groupCommitState != GroupCommitState::Queued)
+            return;
+
+        _groupCommitState = GroupCommitState::Running;
+        if (_groupedTransactions.size() > _maxGroupedTransactions)
+        {
+            auto groupEnd = _groupedTransactions.begin() + _maxGroupedTransactions;
+            transactions.assign(std::make_move_iterator(_groupedTransactions.begin()), std::make_move_iterator(groupEnd));
+            _groupedTransactions.erase(_groupedTransactions.begin(), groupEnd);
+        }
+        else
+            transactions.swap(_groupedTransactions);
+    }
+
+    TC_METRIC_VALUE("db_group_commit_size", uint64(transactions.size()), TC_METRIC_TAG("db_name", GetDatabaseName()));
+
+    {
+        TC_METRIC_TIMER("db_group_commit_time", TC_METRIC_TAG("db_name", GetDatabaseName()));
+        CommitTransactionGroup(GetAsyncConnectionForCurrentThread(), transactions);
+    }
+
+    for (std::shared_ptr<TransactionBase> const& transaction : transactions)
+        EndCachedResultsWrite(*transaction);
+
+    _queueSize -= transactions.size();
+
+    // transactions queued meanwhile already waited for this group, don't delay them any further
+    std::scoped_lock lock(_groupedTransactionsLock);
+    if (!_groupedTransactions.empty())
+        ScheduleGroupedTransactions(true);
+    else
+        _groupCommitState = GroupCommitState::Idle;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::CommitTransactionGroup(T* connection, std::span<std::shared_ptr<TransactionBase> const> group)
+{
+    while (group.size() > 1)
+    {
+        std::size_t failedIndex = 0;
+        int errorCode = connection->ExecuteTransactions(group, failedIndex);
+        if (!errorCode)
+        {
+            for (std::shared_ptr<TransactionBase> const& transaction : group)
+                transaction->Cleanup();
+
+            return;
+        }
+
+        // deadlocks are retried one transaction at a time by TransactionTask
+        if (errorCode == ER_LOCK_DEADLOCK)
+            break;
+
+        // everything was rolled back, commit the members before the failing one again
+        // and give the failing one the usual error handling on its own
+        CommitTransactionGroup(connection, group.first(failedIndex));
+        TransactionTask::Execute(connection, group[failedIndex]);
+        group = group.subspan(failedIndex + 1);
+    }
+
+    for (std::shared_ptr<TransactionBase> const& transaction : group)
+        TransactionTask::Execute(connection, transaction);
+}
+
 template <class T>
 TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
 {
@@ -374,22 +670,31 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
     }
 #endif // TRINITY_DEBUG
 
-    std::future<bool> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, transaction, tracker = QueueSizeTracker(this)]
+    BeginCachedResultsWrite(*transaction);
+
+    AsyncCompletionPromise<bool> promise;
+    TransactionCallback callback(promise.GetFuture(), promise.GetSignal());
+    boost::asio::post(_ioContext->get_executor(), [this, transaction, promise = std::move(promise), tracker = QueueSizeTracker(this)]() mutable
     {
         T* conn = GetAsyncConnectionForCurrentThread();
-        return TransactionTask::Execute(conn, transaction);
-    }));
-    return TransactionCallback(std::move(result));
+        bool success = TransactionTask::Execute(conn, transaction);
+        EndCachedResultsWrite(*transaction);
+        promise.SetValue(success);
+    });
+    return callback;
 }
 
 template <class T>
 void DatabaseWorkerPool<T>::DirectCommitTransaction(SQLTransaction<T>& transaction)
 {
+    BeginCachedResultsWrite(*transaction);
+
     T* connection = GetFreeConnection();
     int errorCode = connection->ExecuteTransaction(transaction);
     if (!errorCode)
     {
         connection->Unlock();      // OK, operation succesful
+        EndCachedResultsWrite(*transaction);
         return;
     }
 
@@ -410,6 +715,8 @@ void DatabaseWorkerPool<T>::DirectCommitTransaction(SQLTransaction<T>& transacti
     transaction->Cleanup();
 
     connection->Unlock();
+
+    EndCachedResultsWrite(*transaction);
 }
 
 template <class T>
@@ -418,6 +725,17 @@ PreparedStatement<T>* DatabaseWorkerPool<T>::GetPreparedStatement(PreparedStatem
     return new PreparedStatement<T>(index, _preparedStatementSize[index]);
 }
 
+template <class T>
+PreparedStatement<T>* DatabaseWorkerPool<T>::AddPreparedStatementRow(PreparedStatement<T>* stmt, PreparedStatementIndex index)
+{
+    if (!stmt)
+        return GetPreparedStatement(index);
+
+    ASSERT(stmt->GetIndex() == uint32(index));
+    stmt->AddRow();
+    return stmt;
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::EscapeString(std::string& str)
 {
@@ -446,8 +764,12 @@ void DatabaseWorkerPool<T>::KeepAlive()
     //! Assuming all worker threads are free, every worker thread will receive 1 ping operation request
     //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
     //! as the sole purpose is to prevent connections from idling.
-    auto const count = _connections[IDX_ASYNC].size();
-    for (uint8 i = 0; i < count; ++i)
+    std::size_t count;
+    {
+        std::scoped_lock lock(_asyncConnectionsLock);
+        count = _connections[IDX_ASYNC].size();
+    }
+    for (std::size_t i = 0; i < count; ++i)
     {
         boost::asio::post(_ioContext->get_executor(), [this, tracker = QueueSizeTracker(this)]
         {
@@ -511,6 +833,134 @@ size_t DatabaseWorkerPool<T>::QueueSize() const
     return _queueSize;
 }
 
+template <class T>
+size_t DatabaseWorkerPool<T>::GetSynchConnectionCount() const
+{
+    return _connections[IDX_SYNCH].size();
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ReportResultCacheMetrics()
+{
+    if (_resultCache)
+        _resultCache->ReportMetrics(GetDatabaseName());
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ReportStatementLatencyMetrics()
+{
+    if (_statementLatency)
+        _statementLatency->ReportMetrics(GetDatabaseName());
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::RecordStatementLatency(PreparedStatementBase const* stmt, TimePoint queued, TimePoint started)
+{
+    if (_statementLatency)
+        _statementLatency->Record(stmt->GetIndex(), std::chrono::duration_cast<std::chrono::microseconds>(started - queued),
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started));
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ScheduleAutoscale()
+{
+    _autoscaleTimer->expires_after(1s);
+    _autoscaleTimer->async_wait([this](boost::system::error_code const& error)
+    {
+        if (!error)
+            Autoscale();
+    });
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::Autoscale()
+{
+    std::scoped_lock lock(_asyncConnectionsLock);
+    if (_ioContext->stopped())
+        return;
+
+    // a connection retired by an earlier call is closed once its thread has left
+    std::vector<std::unique_ptr<T>>& connections = _connections[IDX_ASYNC];
+    bool retiring = std::ranges::any_of(connections, [](std::unique_ptr<T> const& connection) { return connection->IsWorkerThreadRetired(); });
+    std::erase_if(connections, [](std::unique_ptr<T> const& connection) { return connection->HasWorkerThreadStopped(); });
+
+    std::size_t const queueSize = _queueSize;
+    if (queueSize > connections.size() * _scaleUpQueueSize)
+    {
+        ++_busyChecks;
+        _idleChecks = 0;
+    }
+    else if (!queueSize)
+    {
+        ++_idleChecks;
+        _busyChecks = 0;
+    }
+    else
+        _busyChecks = _idleChecks = 0;
+
+    if (_busyChecks >= AUTOSCALE_BUSY_CHECKS && connections.size() < _maxAsyncThreads)
+    {
+        _busyChecks = 0;
+        std::unique_ptr<T> connection = std::make_unique<T>(*_connectionInfo, CONNECTION_ASYNC);
+        if (connection->Open() || !connection->PrepareStatements())
+            TC_LOG_ERROR("sql.driver", "DatabasePool '{}': could not open another asynchronous connection, {} operations are queued.", GetDatabaseName(), queueSize);
+        else
+        {
+            connection->StartWorkerThread(_ioContext.get(), _workerThreadAffinity);
+            connections.push_back(std::move(connection));
+            TC_LOG_INFO("sql.driver", "DatabasePool '{}': {} operations queued, asynchronous connections raised to {} (at most {}).",
+                GetDatabaseName(), queueSize, connections.size(), _maxAsyncThreads);
+        }
+    }
+    else if (_idleChecks >= AUTOSCALE_IDLE_CHECKS && connections.size() > _async_threads && !retiring)
+    {
+        _idleChecks = 0;
+        // whichever worker runs this stops after it, the connection itself is closed by a later call
+        boost::asio::post(_ioContext->get_executor(), []
+        {
+            MySQLConnection::GetCurrentWorkerThreadConnection()->RetireWorkerThread();
+        });
+        TC_LOG_INFO("sql.driver", "DatabasePool '{}': queue stayed empty, asynchronous connections lowered to {}.", GetDatabaseName(), connections.size() - 1);
+    }
+
+    ScheduleAutoscale();
+}
+
+template <class T>
+std::vector<CachedResultInvalidation> DatabaseWorkerPool<T>::BeginCachedResultsWrite(PreparedStatementBase const* stmt)
+{
+    std::vector<CachedResultInvalidation> invalidations;
+    if (_resultCache)
+        _resultCache->BeginWrite(stmt, invalidations);
+
+    return invalidations;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::BeginCachedResultsWrite(TransactionBase& transaction)
+{
+    if (!_resultCache)
+        return;
+
+    for (TransactionData const& data : transaction.m_queries)
+        if (std::unique_ptr<PreparedStatementBase> const* stmt = std::get_if<std::unique_ptr<PreparedStatementBase>>(&data.query))
+            _resultCache->BeginWrite(stmt->get(), transaction.m_cachedResultInvalidations);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::EndCachedResultsWrite(std::vector<CachedResultInvalidation> const& invalidations)
+{
+    if (_resultCache)
+        _resultCache->EndWrite(invalidations);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::EndCachedResultsWrite(TransactionBase& transaction)
+{
+    EndCachedResultsWrite(transaction.m_cachedResultInvalidations);
+    transaction.m_cachedResultInvalidations.clear();
+}
+
 template <class T>
 T* DatabaseWorkerPool<T>::GetFreeConnection()
 {
@@ -539,12 +989,8 @@ T* DatabaseWorkerPool<T>::GetFreeConnection()
 template <class T>
 T* DatabaseWorkerPool<T>::GetAsyncConnectionForCurrentThread() const
 {
-    std::thread::id id = std::this_thread::get_id();
-    for (auto&& connection : _connections[IDX_ASYNC])
-        if (connection->GetWorkerThreadId() == id)
-            return connection.get();
-
-    return nullptr;
+    // the async connections of a pool are the only ones running its io context
+    return static_cast<T*>(MySQLConnection::GetCurrentWorkerThreadConnection());
 }
 
 template <class T>
@@ -569,10 +1015,14 @@ void DatabaseWorkerPool<T>::Execute(char const* sql)
 template <class T>
 void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
 {
-    boost::asio::post(_ioContext->get_executor(), [this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
+    std::vector<CachedResultInvalidation> invalidations = BeginCachedResultsWrite(stmt);
+    boost::asio::post(_ioContext->get_executor(), [this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), invalidations = std::move(invalidations), queued = std::chrono::steady_clock::now(), tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
+        TimePoint started = std::chrono::steady_clock::now();
         PreparedStatementTask::Execute(conn, stmt.get());
+        RecordStatementLatency(stmt.get(), queued, started);
+        EndCachedResultsWrite(invalidations);
     });
 }
 
@@ -587,12 +1037,34 @@ void DatabaseWorkerPool<T>::DirectExecute(char const* sql)
     connection->Unlock();
 }
 
+template <class T>
+bool DatabaseWorkerPool<T>::DirectExecuteScript(std::string_view sql)
+{
+    T* connection = GetFreeConnection();
+    connection->BeginTransaction();
+    bool success = connection->ExecuteMultiStatements(sql);
+    if (success)
+        connection->CommitTransaction();
+    else
+        connection->RollbackTransaction();
+
+    connection->Unlock();
+    return success;
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::DirectExecute(PreparedStatement<T>* stmt)
 {
+    std::vector<CachedResultInvalidation> invalidations = BeginCachedResultsWrite(stmt);
+
+    TimePoint queued = std::chrono::steady_clock::now();
     T* connection = GetFreeConnection();
+    TimePoint started = std::chrono::steady_clock::now();
     PreparedStatementTask::Execute(connection, stmt);
     connection->Unlock();
+    RecordStatementLatency(stmt, queued, started);
+
+    EndCachedResultsWrite(invalidations);
 
     //! Delete proxy-class. Not needed anymore
     delete stmt;
@@ -21,13 +21,20 @@
 #include "AsioHacksFwd.h"
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include "Duration.h"
 #include "StringFormat.h"
 #include <array>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
 struct MySQLConnectionInfo;
+class QueryResultCache;
+class StatementLatencyTracker;
+struct CachedResultInvalidation;
 
 template <class T>
 class DatabaseWorkerPool
@@ -40,6 +47,14 @@ class DatabaseWorkerPool
             IDX_SIZE
         };
 
+        enum class GroupCommitState : uint8
+        {
+            Idle,       // nothing queued
+            Waiting,    // group commit timer running
+            Queued,     // task posted to the async threads
+            Running     // a worker is committing a group
+        };
+
     public:
         /* Activity state */
         DatabaseWorkerPool();
@@ -48,6 +63,29 @@ class DatabaseWorkerPool
 
         void SetConnectionInfo(std::string const& infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+        //! Allows CommitTransaction to merge up to maxTransactions queued transactions into a single one (1 disables merging).
+        //! A group is started at most delay after its first transaction was queued, giving later ones a chance to join
+        void SetGroupCommit(uint32 maxTransactions, Milliseconds delay);
+
+        //! Keeps the results of up to maxEntries parameter sets of every statement the connection type registers
+        //! as cacheable, see T::RegisterCachedStatements (0 disables caching).
+        void SetResultCache(uint32 maxEntries);
+
+        //! Lets the pool open up to maxAsyncThreads async connections while more than scaleUpQueueSize operations per
+        //! connection stay queued, connections opened that way are closed again once the queue stays empty.
+        //! maxAsyncThreads at or below the number given to SetConnectionInfo disables scaling
+        void SetAutoscaling(uint8 maxAsyncThreads, uint32 scaleUpQueueSize);
+
+        //! Records queue wait and execution time of every prepared statement, see ReportStatementLatencyMetrics
+        void SetStatementLatencyTracking(bool enable);
+
+        //! Spreads the statements of a query holder over up to maxTasks async connections that run them in parallel,
+        //! the holder callback runs once all of them finished (1 executes every holder on a single connection)
+        void SetQueryHolderParallelism(uint32 maxTasks);
+
+        //! Processors of the asynchronous worker threads, see SetCurrentThreadAffinity
+        void SetWorkerThreadAffinity(std::string threadAffinity);
+
         uint32 Open();
 
         void Close();
@@ -106,6 +144,10 @@ class DatabaseWorkerPool
         //! Statement must be prepared with the CONNECTION_SYNCH flag.
         void DirectExecute(PreparedStatement<T>* stmt);
 
+        //! Directly executes a script of several ';' separated statements in one transaction on one connection.
+        //! The transaction is rolled back if any statement fails. Meant for sql files applied at startup.
+        bool DirectExecuteScript(std::string_view sql);
+
         /**
             Synchronous query (with resultset) methods.
         */
@@ -141,6 +183,13 @@ class DatabaseWorkerPool
         //! Statement must be prepared with CONNECTION_SYNCH flag.
         PreparedQueryResult Query(PreparedStatement<T>* stmt);
 
+        //! Directly executes an SQL query in prepared format without buffering its resultset, meant for very large results.
+        //! Rows are read from the server by NextRow and only the current one is kept in memory, GetRowCount returns the number of rows read so far.
+        //! The connection stays in use until the last row was read or the result is released, so if SynchThreads is 1
+        //! no other synchronous query may be done until then.
+        //! Statement must be prepared with CONNECTION_SYNCH flag.
+        PreparedQueryResult QueryUnbuffered(PreparedStatement<T>* stmt);
+
         /**
             Asynchronous query (with resultset) methods.
         */
@@ -169,6 +218,7 @@ class DatabaseWorkerPool
 
         //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
         //! were appended to the transaction will be respected during execution.
+        //! Transactions queued while the async connections are busy may be committed together (see SetGroupCommit).
         void CommitTransaction(SQLTransaction<T> transaction);
 
         //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
@@ -198,6 +248,10 @@ class DatabaseWorkerPool
         //! This object is not tied to the prepared statement on the MySQL context yet until execution.
         PreparedStatement<T>* GetPreparedStatement(PreparedStatementIndex index);
 
+        //! Starts a new row of a multi-row INSERT or REPLACE statement, creating the statement for the first row (stmt is null).
+        //! All rows are then executed in a few round trips instead of one per row.
+        PreparedStatement<T>* AddPreparedStatementRow(PreparedStatement<T>* stmt, PreparedStatementIndex index);
+
         //! Apply escape string'ing for current collation. (utf8)
         void EscapeString(std::string& str);
 
@@ -212,6 +266,15 @@ class DatabaseWorkerPool
 
         size_t QueueSize() const;
 
+        //! Number of connections serving synchronous queries, the most threads that can query at once.
+        size_t GetSynchConnectionCount() const;
+
+        //! Sends hit rate, entry count and memory usage of the result cache (if enabled) to Metric.
+        void ReportResultCacheMetrics();
+
+        //! Sends latency percentiles of the prepared statements used since the last call (if tracking is enabled) to Metric.
+        void ReportStatementLatencyMetrics();
+
     private:
         uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
@@ -225,6 +288,27 @@ class DatabaseWorkerPool
 
         char const* GetDatabaseName() const;
 
+        //! Queues a task executing the grouped transactions, caller must hold _groupedTransactionsLock
+        void ScheduleGroupedTransactions(bool immediate);
+
+        //! Runs on an async worker thread, commits queued transactions in groups of at most _maxGroupedTransactions
+        void ExecuteGroupedTransactions();
+
+        //! Commits group in order, members whose queries fail are split off and executed on their own
+        void CommitTransactionGroup(T* connection, std::span<std::shared_ptr<TransactionBase> const> group);
+
+        //! Drops cached results the statements are about to change, EndCachedResultsWrite must follow once they were executed
+        std::vector<CachedResultInvalidation> BeginCachedResultsWrite(PreparedStatementBase const* stmt);
+        void BeginCachedResultsWrite(TransactionBase& transaction);
+        void EndCachedResultsWrite(std::vector<CachedResultInvalidation> const& invalidations);
+        void EndCachedResultsWrite(TransactionBase& transaction);
+
+        void RecordStatementLatency(PreparedStatementBase const* stmt, TimePoint queued, TimePoint started);
+
+        void ScheduleAutoscale();
+        //! Runs on an async worker thread, opens or retires at most one async connection per call
+        void Autoscale();
+
         struct QueueSizeTracker;
         friend QueueSizeTracker;
 
@@ -235,6 +319,29 @@ class DatabaseWorkerPool
         std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
         std::vector<uint8> _preparedStatementSize;
         uint8 _async_threads, _synch_threads;
+
+        //! Transactions waiting to be committed together, groups are committed one at a time to keep them in order
+        std::mutex _groupedTransactionsLock;
+        std::vector<std::shared_ptr<TransactionBase>> _groupedTransactions;
+        GroupCommitState _groupCommitState;
+        std::unique_ptr<Trinity::Asio::DeadlineTimer> _groupCommitTimer;
+        uint32 _maxGroupedTransactions;
+        Milliseconds _groupCommitDelay;
+
+        std::unique_ptr<QueryResultCache> _resultCache;
+        bool _trackStatementLatency;
+        std::unique_ptr<StatementLatencyTracker> _statementLatency;
+
+        //! Guards _connections[IDX_ASYNC] once the pool is open, the autoscaler changes it from a worker thread
+        std::mutex _asyncConnectionsLock;
+        std::unique_ptr<Trinity::Asio::DeadlineTimer> _autoscaleTimer;
+        uint8 _maxAsyncThreads;
+        uint32 _scaleUpQueueSize;
+        uint32 _busyChecks;
+        uint32 _idleChecks;
+
+        uint32 _maxQueryHolderTasks;
+        std::string _workerThreadAffinity;
 };
 
 #endif
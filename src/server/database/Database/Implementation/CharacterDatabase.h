@@ -428,6 +428,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_CHAR_SOCIAL,
     CHAR_SEL_CHAR_OLD_CHARS,
     CHAR_SEL_MAIL,
+    CHAR_SEL_MAIL_BODIES,
     CHAR_DEL_CHAR_AURA_FROZEN,
     CHAR_SEL_CHAR_INVENTORY_COUNT_ITEM,
     CHAR_SEL_MAIL_COUNT_ITEM,
@@ -500,6 +501,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_GUILD_BANK_EVENTLOG_BY_PLAYER,
     CHAR_DEL_CHAR_GLYPHS,
     CHAR_DEL_CHAR_TALENT,
+    CHAR_DEL_CHAR_TALENT_BY_ID,
     CHAR_DEL_CHAR_PVP_TALENT,
     CHAR_DEL_CHAR_SKILLS,
     CHAR_UPD_CHAR_MONEY,
@@ -639,7 +641,7 @@ enum CharacterDatabaseStatements : uint32
 
     CHAR_DEL_CHARACTER_INSTANCE_LOCK,
     CHAR_DEL_CHARACTER_INSTANCE_LOCK_BY_GUID,
-    CHAR_INS_CHARACTER_INSTANCE_LOCK,
+    CHAR_REP_CHARACTER_INSTANCE_LOCK,
     CHAR_UPD_CHARACTER_INSTANCE_LOCK_EXTENSION,
     CHAR_UPD_CHARACTER_INSTANCE_LOCK_FORCE_EXPIRE,
     CHAR_DEL_INSTANCE,
@@ -671,6 +673,8 @@ public:
 
     //- Loads database type specific prepared statements
     void DoPrepareStatements() override;
+
+    static void RegisterCachedStatements(QueryResultCache& cache);
 };
 
 #endif
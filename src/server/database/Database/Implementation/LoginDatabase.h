@@ -50,6 +50,7 @@ enum LoginDatabaseStatements : uint32
     LOGIN_DEL_IP_NOT_BANNED,
     LOGIN_SEL_IP_BANNED_ALL,
     LOGIN_SEL_IP_BANNED_BY_IP,
+    LOGIN_SEL_IP_BANNED_ACTIVE,
     LOGIN_SEL_ACCOUNT_BY_ID,
     LOGIN_INS_ACCOUNT_BANNED,
     LOGIN_UPD_ACCOUNT_NOT_BANNED,
@@ -99,6 +100,7 @@ enum LoginDatabaseStatements : uint32
 
     LOGIN_SEL_ACCOUNT_ACCESS_BY_ID,
     LOGIN_SEL_RBAC_ACCOUNT_PERMISSIONS,
+    LOGIN_SEL_RBAC_ACCOUNT_PERMISSIONS_BY_NAME,
     LOGIN_INS_RBAC_ACCOUNT_PERMISSION,
     LOGIN_DEL_RBAC_ACCOUNT_PERMISSION,
 
@@ -86,6 +86,8 @@ enum WorldDatabaseStatements : uint32
     WORLD_DEL_GAMEOBJECT_ADDON,
     WORLD_SEL_GUILD_REWARDS_REQ_ACHIEVEMENTS,
     WORLD_INS_CONDITION,
+    WORLD_SEL_CREATURE_SPAWNS,
+    WORLD_SEL_GAMEOBJECT_SPAWNS,
 
     MAX_WORLDDATABASE_STATEMENTS
 };
@@ -17,11 +17,14 @@
 
 #include "MySQLConnection.h"
 #include "Common.h"
+#include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLPreparedStatement.h"
+#include "Optional.h"
 #include "PreparedStatement.h"
+#include "ProcessPriority.h"
 #include "QueryResult.h"
 #include "StringConvert.h"
 #include "Timer.h"
@@ -30,6 +33,56 @@
 #include <errmsg.h>
 #include "MySQLWorkaround.h"
 #include <mysqld_error.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+namespace
+{
+// largest number of rows of a multi-row statement sent in a single round trip
+constexpr uint32 MAX_MULTI_ROW_STATEMENT_ROWS = 128;
+
+// async connection whose worker thread is the current one
+thread_local MySQLConnection* WorkerThreadConnection = nullptr;
+
+// Repeats the VALUES tuple of a single row INSERT or REPLACE statement, only statements ending with it qualify
+Optional<std::string> MakeMultiRowQuery(std::string_view sql, uint32 rowCount)
+{
+    std::size_t end = sql.find_last_not_of(" \t\r\n;");
+    if (end == std::string_view::npos || sql[end] != ')')
+        return {};
+
+    std::size_t tupleStart = end;
+    for (int32 depth = 0; ; --tupleStart)
+    {
+        if (sql[tupleStart] == ')')
+            ++depth;
+        else if (sql[tupleStart] == '(' && !--depth)
+            break;
+
+        if (!tupleStart)
+            return {};
+    }
+
+    // the tuple must directly follow the first VALUES, that isn't the case for ON DUPLICATE KEY UPDATE a = VALUES(a)
+    std::string_view head = sql.substr(0, tupleStart);
+    head = head.substr(0, head.find_last_not_of(" \t\r\n") + 1);
+    if (head.length() < 6 || !StringEqualI(head.substr(head.length() - 6), "VALUES"))
+        return {};
+
+    for (std::size_t i = 0; i + 6 < head.length(); ++i)
+        if (StringEqualI(head.substr(i, 6), "VALUES"))
+            return {};
+
+    std::string_view tuple = sql.substr(tupleStart, end - tupleStart + 1);
+    std::string query(sql.substr(0, end + 1));
+    query.reserve(query.length() + (tuple.length() + 2) * (rowCount - 1));
+    for (uint32 i = 1; i < rowCount; ++i)
+        query.append(", ").append(tuple);
+
+    return query;
+}
+}
 
 MySQLConnectionInfo::MySQLConnectionInfo(std::string const& infoString)
 {
@@ -50,8 +103,13 @@ MySQLConnectionInfo::MySQLConnectionInfo(std::string const& infoString)
 
 struct MySQLConnection::WorkerThread
 {
+    explicit WorkerThread(boost::asio::executor_work_guard<Trinity::Asio::IoContext::Executor>&& workGuard)
+        : WorkGuard(std::move(workGuard)), Retired(false), Stopped(false) { }
+
     std::thread ThreadHandle;
     boost::asio::executor_work_guard<Trinity::Asio::IoContext::Executor> WorkGuard;
+    std::atomic<bool> Retired;
+    std::atomic<bool> Stopped;
 };
 
 MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo, ConnectionFlags connectionFlags) :
@@ -78,6 +136,7 @@ void MySQLConnection::Close()
         m_workerThread.reset();
     }
 
+    m_multiRowStmts.clear();
     m_stmts.clear();
 
     if (m_Mysql)
@@ -182,6 +241,8 @@ uint32 MySQLConnection::Open()
 
 bool MySQLConnection::PrepareStatements()
 {
+    // prepared again on first use
+    m_multiRowStmts.clear();
     DoPrepareStatements();
     return !m_prepareError;
 }
@@ -213,17 +274,80 @@ bool MySQLConnection::Execute(char const* sql)
     return true;
 }
 
+bool MySQLConnection::ExecuteMultiStatements(std::string_view sql)
+{
+    if (!m_Mysql)
+        return false;
+
+    if (mysql_set_server_option(m_Mysql, MYSQL_OPTION_MULTI_STATEMENTS_ON))
+    {
+        TC_LOG_ERROR("sql.sql", "[{}] {}", mysql_errno(m_Mysql), mysql_error(m_Mysql));
+        return false;
+    }
+
+    uint32 _s = getMSTime();
+    bool success = !mysql_real_query(m_Mysql, sql.data(), sql.length());
+
+    // the results of all succeeded statements must be consumed before the connection accepts anything else
+    while (success)
+    {
+        if (MYSQL_RES* result = mysql_store_result(m_Mysql))
+            mysql_free_result(result);
+
+        int status = mysql_next_result(m_Mysql);
+        if (status < 0)
+            break;
+
+        success = status == 0;
+    }
+
+    if (success)
+        TC_LOG_DEBUG("sql.sql", "[{} ms] SQL: {} bytes of statements", getMSTimeDiff(_s, getMSTime()), sql.length());
+    else
+        TC_LOG_ERROR("sql.sql", "[{}] {}", mysql_errno(m_Mysql), mysql_error(m_Mysql));
+
+    mysql_set_server_option(m_Mysql, MYSQL_OPTION_MULTI_STATEMENTS_OFF);
+    return success;
+}
+
 bool MySQLConnection::Execute(PreparedStatementBase* stmt)
 {
     if (!m_Mysql)
         return false;
 
+    // rows are sent in chunks of a power of two rows, that bounds the multi-row variants prepared for each statement
+    uint32 rowCount = stmt->GetRowCount();
+    for (uint32 row = 0; row < rowCount;)
+    {
+        uint32 chunkRows = std::bit_floor(std::min(rowCount - row, MAX_MULTI_ROW_STATEMENT_ROWS));
+        if (!ExecuteRows(stmt, row, chunkRows))
+            return false;
+
+        row += chunkRows;
+    }
+
+    return true;
+}
+
+bool MySQLConnection::ExecuteRows(PreparedStatementBase* stmt, uint32 firstRow, uint32 rowCount)
+{
     uint32 index = stmt->GetIndex();
 
-    MySQLPreparedStatement* m_mStmt = GetPreparedStatement(index);
+    MySQLPreparedStatement* m_mStmt = GetPreparedStatement(index, rowCount);
+    if (!m_mStmt && rowCount > 1)
+    {
+        // no multi-row variant of this statement, send the rows one by one
+        for (uint32 i = 0; i < rowCount; ++i)
+            if (!ExecuteRows(stmt, firstRow + i, 1))
+                return false;
+
+        return true;
+    }
+
     ASSERT(m_mStmt);            // Can only be null if preparation failed, server side error or bad query
 
-    m_mStmt->BindParameters(stmt);
+    std::span<PreparedStatementData const> parameters(stmt->GetParameters());
+    m_mStmt->BindParameters(stmt, parameters.subspan(std::size_t(firstRow) * stmt->GetRowSize(), std::size_t(rowCount) * stmt->GetRowSize()));
 
     MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
@@ -236,7 +360,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         TC_LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return ExecuteRows(stmt, firstRow, rowCount);       // Try again
 
         m_mStmt->ClearParameters();
         return false;
@@ -248,7 +372,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         TC_LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return ExecuteRows(stmt, firstRow, rowCount);       // Try again
 
         m_mStmt->ClearParameters();
         return false;
@@ -265,6 +389,8 @@ bool MySQLConnection::_Query(PreparedStatementBase* stmt, MySQLPreparedStatement
     if (!m_Mysql)
         return false;
 
+    ASSERT(stmt->GetRowCount() == 1, "Multi-row statements can not return results");
+
     uint32 index = stmt->GetIndex();
 
     MySQLPreparedStatement* m_mStmt = GetPreparedStatement(index);
@@ -414,6 +540,30 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
     return 0;
 }
 
+int MySQLConnection::ExecuteTransactions(std::span<std::shared_ptr<TransactionBase> const> transactions, std::size_t& failedIndex)
+{
+    BeginTransaction();
+
+    for (std::size_t i = 0; i < transactions.size(); ++i)
+    {
+        for (TransactionData const& data : transactions[i]->m_queries)
+        {
+            if (!std::visit([this](auto&& query) { return this->Execute(TransactionData::ToExecutable(query)); }, data.query))
+            {
+                TC_LOG_WARN("sql.sql", "Grouped transaction aborted at member {}. {} transactions not executed.", i, transactions.size());
+                int errorCode = GetLastError();
+                RollbackTransaction();
+                failedIndex = i;
+                // nothing was committed, never report success
+                return errorCode ? errorCode : -1;
+            }
+        }
+    }
+
+    CommitTransaction();
+    return 0;
+}
+
 size_t MySQLConnection::EscapeString(char* to, const char* from, size_t length)
 {
     return mysql_real_escape_string(m_Mysql, to, from, length);
@@ -429,16 +579,45 @@ uint32 MySQLConnection::GetLastError()
     return mysql_errno(m_Mysql);
 }
 
-void MySQLConnection::StartWorkerThread(Trinity::Asio::IoContext* context)
+void MySQLConnection::StartWorkerThread(Trinity::Asio::IoContext* context, std::string threadAffinity)
 {
     boost::asio::executor_work_guard executorWorkGuard = boost::asio::make_work_guard(context->get_executor()); // construct guard before thread starts running
 
-    m_workerThread = std::make_unique<WorkerThread>(WorkerThread{
-        .ThreadHandle = std::thread([context] { context->run(); }),
-        .WorkGuard = std::move(executorWorkGuard)
+    m_workerThread = std::make_unique<WorkerThread>(std::move(executorWorkGuard));
+    m_workerThread->ThreadHandle = std::thread([this, context, worker = m_workerThread.get(), threadAffinity = std::move(threadAffinity)]
+    {
+        WorkerThreadConnection = this;
+        SetCurrentThreadAffinity("sql.driver", threadAffinity);
+
+        // handlers are run one at a time to let a retired thread leave between them
+        while (!worker->Retired && context->run_one())
+            ;
+
+        worker->Stopped = true;
     });
 }
 
+void MySQLConnection::RetireWorkerThread()
+{
+    ASSERT(WorkerThreadConnection == this, "RetireWorkerThread must be called by the worker thread of the connection");
+    m_workerThread->Retired = true;
+}
+
+bool MySQLConnection::IsWorkerThreadRetired() const
+{
+    return m_workerThread && m_workerThread->Retired;
+}
+
+bool MySQLConnection::HasWorkerThreadStopped() const
+{
+    return m_workerThread && m_workerThread->Stopped;
+}
+
+MySQLConnection* MySQLConnection::GetCurrentWorkerThreadConnection()
+{
+    return WorkerThreadConnection;
+}
+
 std::thread::id MySQLConnection::GetWorkerThreadId() const
 {
     if (m_workerThread)
@@ -474,6 +653,29 @@ MySQLPreparedStatement* MySQLConnection::GetPreparedStatement(uint32 index)
     return ret;
 }
 
+MySQLPreparedStatement* MySQLConnection::GetPreparedStatement(uint32 index, uint32 rowCount)
+{
+    MySQLPreparedStatement* stmt = GetPreparedStatement(index);
+    if (rowCount == 1 || !stmt)
+        return stmt;
+
+    auto [itr, isNew] = m_multiRowStmts.try_emplace({ index, rowCount });
+    if (isNew)
+    {
+        if (Optional<std::string> sql = MakeMultiRowQuery(stmt->m_queryString, rowCount))
+            itr->second = CreatePreparedStatement(index, *sql);
+
+        if (itr->second && itr->second->GetParameterCount() != stmt->GetParameterCount() * rowCount)
+            itr->second.reset();
+
+        if (!itr->second)
+            TC_LOG_ERROR("sql.sql", "Prepared statement {} on database `{}` is not a single row INSERT or REPLACE, its rows will be sent one by one.",
+                index, m_connectionInfo.database);
+    }
+
+    return itr->second.get();
+}
+
 void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags)
 {
     // Check if specified query should be prepared on this connection
@@ -485,25 +687,30 @@ void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, Conne
         return;
     }
 
+    m_stmts[index] = CreatePreparedStatement(index, sql);
+    if (!m_stmts[index])
+        m_prepareError = true;
+}
+
+std::unique_ptr<MySQLPreparedStatement> MySQLConnection::CreatePreparedStatement(uint32 index, std::string_view sql)
+{
     MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
     if (!stmt)
     {
         TC_LOG_ERROR("sql.sql", "In mysql_stmt_init() id: {}, sql: \"{}\"", index, sql);
         TC_LOG_ERROR("sql.sql", "{}", mysql_error(m_Mysql));
-        m_prepareError = true;
+        return nullptr;
     }
-    else
+
+    if (mysql_stmt_prepare(stmt, sql.data(), static_cast<unsigned long>(sql.size())))
     {
-        if (mysql_stmt_prepare(stmt, sql.data(), static_cast<unsigned long>(sql.size())))
-        {
-            TC_LOG_ERROR("sql.sql", "In mysql_stmt_prepare() id: {}, sql: \"{}\"", index, sql);
-            TC_LOG_ERROR("sql.sql", "{}", mysql_stmt_error(stmt));
-            mysql_stmt_close(stmt);
-            m_prepareError = true;
-        }
-        else
-            m_stmts[index] = std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), std::string(sql));
+        TC_LOG_ERROR("sql.sql", "In mysql_stmt_prepare() id: {}, sql: \"{}\"", index, sql);
+        TC_LOG_ERROR("sql.sql", "{}", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return nullptr;
     }
+
+    return std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), std::string(sql));
 }
 
 PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
@@ -523,6 +730,19 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
     return new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
 }
 
+PreparedResultSet* MySQLConnection::QueryUnbuffered(PreparedStatementBase* stmt)
+{
+    MySQLPreparedStatement* mysqlStmt = nullptr;
+    MySQLResult* result = nullptr;
+    uint64 rowCount = 0;
+    uint32 fieldCount = 0;
+
+    if (!_Query(stmt, &mysqlStmt, &result, &rowCount, &fieldCount))
+        return nullptr;
+
+    return new PreparedResultSet(mysqlStmt->GetSTMT(), result, fieldCount, this);
+}
+
 bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, uint8 attempts /*= 5*/)
 {
     switch (errNo)
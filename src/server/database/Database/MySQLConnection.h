@@ -21,13 +21,16 @@
 #include "AsioHacksFwd.h"
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <vector>
 
 class MySQLPreparedStatement;
+class QueryResultCache;
 
 enum ConnectionFlags
 {
@@ -52,6 +55,7 @@ class TC_DATABASE_API MySQLConnection
 {
     template <class T> friend class DatabaseWorkerPool;
     friend class PingOperation;
+    friend class PreparedResultSet;
 
     public:
         MySQLConnection(MySQLConnectionInfo& connInfo, ConnectionFlags connectionFlags);
@@ -64,8 +68,13 @@ class TC_DATABASE_API MySQLConnection
 
         bool Execute(char const* sql);
         bool Execute(PreparedStatementBase* stmt);
+        //! Sends every statement of sql in one round trip and stops at the first failing one
+        bool ExecuteMultiStatements(std::string_view sql);
         ResultSet* Query(char const* sql);
         PreparedResultSet* Query(PreparedStatementBase* stmt);
+        /// Rows of the returned result set are read from the server one at a time.
+        /// The result set releases the connection lock when done, if no result set is returned the lock stays with the caller
+        PreparedResultSet* QueryUnbuffered(PreparedStatementBase* stmt);
         bool _Query(char const* sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
         bool _Query(PreparedStatementBase* stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
 
@@ -73,13 +82,28 @@ class TC_DATABASE_API MySQLConnection
         void RollbackTransaction();
         void CommitTransaction();
         int ExecuteTransaction(std::shared_ptr<TransactionBase> transaction);
+        /// Executes all queries of several transactions within a single one, saving a commit per transaction.
+        /// On error everything is rolled back and failedIndex is set to the member that failed.
+        /// Cleanup of the transactions is left to the caller, like for ExecuteTransaction
+        int ExecuteTransactions(std::span<std::shared_ptr<TransactionBase> const> transactions, std::size_t& failedIndex);
         size_t EscapeString(char* to, const char* from, size_t length);
         void Ping();
 
         uint32 GetLastError();
 
-        void StartWorkerThread(Trinity::Asio::IoContext* context);
+        /// threadAffinity: processors of the worker thread, see SetCurrentThreadAffinity
+        void StartWorkerThread(Trinity::Asio::IoContext* context, std::string threadAffinity = {});
         std::thread::id GetWorkerThreadId() const;
+        /// Makes the worker thread stop once the handler calling this returns, the connection may be closed after HasWorkerThreadStopped
+        void RetireWorkerThread();
+        bool IsWorkerThreadRetired() const;
+        bool HasWorkerThreadStopped() const;
+        /// Connection of the worker thread calling this, null for any other thread
+        static MySQLConnection* GetCurrentWorkerThreadConnection();
+
+        /// Statements whose results DatabaseWorkerPool may cache, along with the statements changing them.
+        /// Connection types with cacheable statements hide this with their own list
+        static void RegisterCachedStatements(QueryResultCache& /*cache*/) { }
 
     protected:
         /// Tries to acquire lock. If lock is acquired by another thread
@@ -91,6 +115,8 @@ class TC_DATABASE_API MySQLConnection
 
         uint32 GetServerVersion() const;
         MySQLPreparedStatement* GetPreparedStatement(uint32 index);
+        /// Multi-row variant of statement index, prepared on first use. Null if the statement can't have several rows
+        MySQLPreparedStatement* GetPreparedStatement(uint32 index, uint32 rowCount);
         void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
 
         virtual void DoPrepareStatements() = 0;
@@ -98,11 +124,14 @@ class TC_DATABASE_API MySQLConnection
         typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
         PreparedStatementContainer           m_stmts;         //!< PreparedStatements storage
+        std::map<std::pair<uint32, uint32>, std::unique_ptr<MySQLPreparedStatement>> m_multiRowStmts; //!< Multi-row variants of m_stmts, by index and row count
         bool                                 m_reconnecting;  //!< Are we reconnecting?
         bool                                 m_prepareError;  //!< Was there any error while preparing statements?
 
     private:
         bool _HandleMySQLErrno(uint32 errNo, uint8 attempts = 5);
+        bool ExecuteRows(PreparedStatementBase* stmt, uint32 firstRow, uint32 rowCount);
+        std::unique_ptr<MySQLPreparedStatement> CreatePreparedStatement(uint32 index, std::string_view sql);
 
         struct WorkerThread;
         std::unique_ptr<WorkerThread> m_workerThread;       //!< Core worker thread.
@@ -64,11 +64,17 @@ MySQLPreparedStatement::~MySQLPreparedStatement()
 }
 
 void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
+{
+    BindParameters(stmt, stmt->GetParameters());
+}
+
+void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt, std::span<PreparedStatementData const> parameters)
 {
     m_stmt = stmt;     // Cross reference them for debug output
+    m_parameters = parameters;
 
-    uint8 pos = 0;
-    for (PreparedStatementData const& data : stmt->GetParameters())
+    uint32 pos = 0;
+    for (PreparedStatementData const& data : parameters)
     {
         std::visit([&](auto&& param)
         {
@@ -94,14 +100,14 @@ void MySQLPreparedStatement::ClearParameters()
     }
 }
 
-static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 paramCount)
+static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint32 index, uint32 paramCount)
 {
     TC_LOG_ERROR("sql.driver", "Attempted to bind parameter {}{} on a PreparedStatement {} (statement has only {} parameters)", uint32(index) + 1, (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
     return false;
 }
 
 //- Bind on mysql level
-void MySQLPreparedStatement::AssertValidIndex(uint8 index)
+void MySQLPreparedStatement::AssertValidIndex(uint32 index)
 {
     ASSERT(index < m_paramCount || ParamenterIndexAssertFail(m_stmt->GetIndex(), index, m_paramCount));
 
@@ -109,7 +115,7 @@ void MySQLPreparedStatement::AssertValidIndex(uint8 index)
         TC_LOG_ERROR("sql.sql", "[ERROR] Prepared Statement (id: {}) trying to bind value on already bound index ({}).", m_stmt->GetIndex(), index);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::nullptr_t)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::nullptr_t)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -123,13 +129,13 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::nullptr_t)
     param->length = nullptr;
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, bool value)
+void MySQLPreparedStatement::SetParameter(uint32 index, bool value)
 {
     SetParameter(index, uint8(value ? 1 : 0));
 }
 
 template<typename T>
-void MySQLPreparedStatement::SetParameter(uint8 index, T value)
+void MySQLPreparedStatement::SetParameter(uint32 index, T value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -146,7 +152,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, T value)
     memcpy(param->buffer, &value, len);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, SystemTimePoint value)
+void MySQLPreparedStatement::SetParameter(uint32 index, SystemTimePoint value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -173,7 +179,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, SystemTimePoint value)
     time->second_part = hms.subseconds().count();
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::string const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -190,7 +196,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
     memcpy(param->buffer, value.c_str(), len);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::vector<uint8> const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::vector<uint8> const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -212,7 +218,7 @@ std::string MySQLPreparedStatement::getQueryString() const
     std::string queryString(m_queryString);
 
     size_t pos = 0;
-    for (PreparedStatementData const& data : m_stmt->GetParameters())
+    for (PreparedStatementData const& data : m_parameters)
     {
         pos = queryString.find('?', pos);
 
@@ -21,11 +21,13 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Duration.h"
+#include <span>
 #include <string>
 #include <vector>
 
 class MySQLConnection;
 class PreparedStatementBase;
+struct PreparedStatementData;
 
 //- Class of which the instances are unique per MySQLConnection
 //- access to these class objects is only done when a prepared statement task
@@ -40,23 +42,26 @@ class TC_DATABASE_API MySQLPreparedStatement
         ~MySQLPreparedStatement();
 
         void BindParameters(PreparedStatementBase* stmt);
+        //! Binds a subset of the parameters of stmt, used to send the rows of a multi-row statement in chunks
+        void BindParameters(PreparedStatementBase* stmt, std::span<PreparedStatementData const> parameters);
 
         uint32 GetParameterCount() const { return m_paramCount; }
 
     protected:
-        void SetParameter(uint8 index, std::nullptr_t);
-        void SetParameter(uint8 index, bool value);
+        void SetParameter(uint32 index, std::nullptr_t);
+        void SetParameter(uint32 index, bool value);
         template<typename T>
-        void SetParameter(uint8 index, T value);
-        void SetParameter(uint8 index, SystemTimePoint value);
-        void SetParameter(uint8 index, std::string const& value);
-        void SetParameter(uint8 index, std::vector<uint8> const& value);
+        void SetParameter(uint32 index, T value);
+        void SetParameter(uint32 index, SystemTimePoint value);
+        void SetParameter(uint32 index, std::string const& value);
+        void SetParameter(uint32 index, std::vector<uint8> const& value);
 
         MySQLStmt* GetSTMT() { return m_Mstmt; }
         MySQLBind* GetBind() { return m_bind; }
         PreparedStatementBase* m_stmt;
+        std::span<PreparedStatementData const> m_parameters;
         void ClearParameters();
-        void AssertValidIndex(uint8 index);
+        void AssertValidIndex(uint32 index);
         std::string getQueryString() const;
 
     private:
@@ -23,111 +23,106 @@
 #include <fmt/chrono.h>
 
 PreparedStatementBase::PreparedStatementBase(uint32 index, uint8 capacity) :
-    m_index(index), statement_data(capacity) { }
+    m_index(index), m_rowCount(1), m_rowSize(capacity), statement_data(capacity) { }
 
 PreparedStatementBase::~PreparedStatementBase() { }
 
+void PreparedStatementBase::AddRow()
+{
+    ++m_rowCount;
+    statement_data.resize(std::size_t(m_rowCount) * m_rowSize);
+}
+
+PreparedStatementData& PreparedStatementBase::GetRowParameter(uint8 index)
+{
+    ASSERT(index < m_rowSize);
+    return statement_data[std::size_t(m_rowCount - 1) * m_rowSize + index];
+}
+
 //- Bind to buffer
 void PreparedStatementBase::setBool(uint8 index, bool value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setUInt8(uint8 index, uint8 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setUInt16(uint8 index, uint16 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setUInt32(uint8 index, uint32 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setUInt64(uint8 index, uint64 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setInt8(uint8 index, int8 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setInt16(uint8 index, int16 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setInt32(uint8 index, int32 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setInt64(uint8 index, int64 value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setFloat(uint8 index, float value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setDouble(uint8 index, double value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setDate(uint8 index, SystemTimePoint value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = value;
+    GetRowParameter(index).data = value;
 }
 
 void PreparedStatementBase::setString(uint8 index, std::string&& value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = std::move(value);
+    GetRowParameter(index).data = std::move(value);
 }
 
 void PreparedStatementBase::setString(uint8 index, std::string_view value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data.emplace<std::string>(value);
+    GetRowParameter(index).data.emplace<std::string>(value);
 }
 
 void PreparedStatementBase::setBinary(uint8 index, std::vector<uint8>&& value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = std::move(value);
+    GetRowParameter(index).data = std::move(value);
 }
 
 void PreparedStatementBase::setBinary(uint8 index, std::span<uint8 const> value)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data.emplace<std::vector<uint8>>(value.begin(), value.end());
+    GetRowParameter(index).data.emplace<std::vector<uint8>>(value.begin(), value.end());
 }
 
 void PreparedStatementBase::setNull(uint8 index)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data = nullptr;
+    GetRowParameter(index).data = nullptr;
 }
 
 //- Execution
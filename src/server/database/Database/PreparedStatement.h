@@ -87,11 +87,22 @@ class TC_DATABASE_API PreparedStatementBase
         void setBinary(uint8 index, std::vector<uint8>&& value);
         void setBinary(uint8 index, std::span<uint8 const> value);
 
+        //! Starts binding the next row of a multi-row INSERT or REPLACE statement, the indexes passed to
+        //! the setters above are relative to the current row. All rows are sent in a few round trips,
+        //! each using a multi-row variant of the statement prepared on first use
+        void AddRow();
+
         uint32 GetIndex() const { return m_index; }
+        uint32 GetRowCount() const { return m_rowCount; }
+        uint8 GetRowSize() const { return m_rowSize; }
         std::vector<PreparedStatementData> const& GetParameters() const { return statement_data; }
 
     protected:
+        PreparedStatementData& GetRowParameter(uint8 index);
+
         uint32 m_index;
+        uint32 m_rowCount;
+        uint8 m_rowSize;
 
         //- Buffer of parameters, not tied to MySQL in any way yet
         std::vector<PreparedStatementData> statement_data;
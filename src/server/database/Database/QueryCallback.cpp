@@ -19,15 +19,18 @@
 #include "Duration.h"
 #include "Errors.h"
 
-QueryCallback::QueryCallback(std::future<QueryResult>&& result) : _query(std::move(result))
+QueryCallback::QueryCallback(std::future<QueryResult>&& result, std::shared_ptr<AsyncCompletionSignal> completion)
+    : _query(std::move(result)), _completion(std::move(completion))
 {
 }
 
-QueryCallback::QueryCallback(std::future<PreparedQueryResult>&& result) : _query(std::move(result))
+QueryCallback::QueryCallback(std::future<PreparedQueryResult>&& result, std::shared_ptr<AsyncCompletionSignal> completion)
+    : _query(std::move(result)), _completion(std::move(completion))
 {
 }
 
-QueryCallback::QueryCallback(QueryCallback&& right) noexcept : _query(std::move(right._query)), _callbacks(std::move(right._callbacks))
+QueryCallback::QueryCallback(QueryCallback&& right) noexcept : _query(std::move(right._query)), _completion(std::move(right._completion)),
+    _callbacks(std::move(right._callbacks))
 {
 }
 
@@ -36,6 +39,7 @@ QueryCallback& QueryCallback::operator=(QueryCallback&& right) noexcept
     if (this != &right)
     {
         _query = std::move(right._query);
+        _completion = std::move(right._completion);
         _callbacks = std::move(right._callbacks);
     }
     return *this;
@@ -70,7 +74,10 @@ QueryCallback&& QueryCallback::WithChainingPreparedCallback(std::function<void(Q
 void QueryCallback::SetNextQuery(QueryCallback&& next)
 {
     if (this != &next)
+    {
         _query = std::move(next)._query;
+        _completion = std::move(next._completion);
+    }
 }
 
 bool QueryCallback::InvokeIfReady()
@@ -23,14 +23,15 @@
 #include <functional>
 #include <future>
 #include <list>
+#include <memory>
 #include <queue>
 #include <variant>
 
 class TC_DATABASE_API QueryCallback
 {
 public:
-    explicit QueryCallback(std::future<QueryResult>&& result);
-    explicit QueryCallback(std::future<PreparedQueryResult>&& result);
+    explicit QueryCallback(std::future<QueryResult>&& result, std::shared_ptr<AsyncCompletionSignal> completion = nullptr);
+    explicit QueryCallback(std::future<PreparedQueryResult>&& result, std::shared_ptr<AsyncCompletionSignal> completion = nullptr);
     QueryCallback(QueryCallback&& right) noexcept;
     QueryCallback& operator=(QueryCallback&& right) noexcept;
     ~QueryCallback();
@@ -47,16 +48,21 @@ public:
     // returns true when completed
     bool InvokeIfReady();
 
+    // signal of the current query of the chain, null if it has to be polled
+    AsyncCompletionSignal* GetCompletionSignal() const { return _completion.get(); }
+
 private:
     QueryCallback(QueryCallback const& right) = delete;
     QueryCallback& operator=(QueryCallback const& right) = delete;
 
     std::variant<std::future<QueryResult>, std::future<PreparedQueryResult>> _query;
+    std::shared_ptr<AsyncCompletionSignal> _completion;
 
     using QueryCallbackData = std::variant<std::function<void(QueryCallback&, QueryResult)>, std::function<void(QueryCallback&, PreparedQueryResult)>>;
     std::queue<QueryCallbackData, std::list<QueryCallbackData>> _callbacks;
 };
 
 inline bool InvokeAsyncCallbackIfReady(QueryCallback& callback) { return callback.InvokeIfReady(); }
+inline AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(QueryCallback& callback) { return callback.GetCompletionSignal(); }
 
 #endif // _QUERY_CALLBACK_H
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_QUERY_CALLBACK_AWAITER_H
+#define TRINITYCORE_QUERY_CALLBACK_AWAITER_H
+
+#include "AsyncCallbackProcessor.h"
+#include "QueryCallback.h"
+#include <coroutine>
+#include <type_traits>
+
+/*
+ * Result of an async query awaited by a Trinity::Job, the job is resumed by processor.ProcessReadyCallbacks()
+ * once the result is ready. Has to be awaited on the thread owning processor, a job cancelled with the
+ * callbacks of processor is never resumed.
+ */
+template<typename Result>
+class QueryCallbackAwaiter
+{
+public:
+    QueryCallbackAwaiter(QueryCallbackProcessor& processor, QueryCallback&& query) : _processor(processor), _query(std::move(query)) { }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        auto resume = [this, handle](Result result)
+        {
+            _result = std::move(result);
+            handle.resume();
+        };
+
+        if constexpr (std::is_same_v<Result, PreparedQueryResult>)
+            _processor.AddCallback(std::move(_query).WithPreparedCallback(std::move(resume)));
+        else
+            _processor.AddCallback(std::move(_query).WithCallback(std::move(resume)));
+    }
+
+    Result await_resume() { return std::move(_result); }
+
+private:
+    QueryCallbackProcessor& _processor;
+    QueryCallback _query;
+    Result _result;
+};
+
+inline QueryCallbackAwaiter<QueryResult> AwaitQuery(QueryCallbackProcessor& processor, QueryCallback&& query)
+{
+    return { processor, std::move(query) };
+}
+
+inline QueryCallbackAwaiter<PreparedQueryResult> AwaitPreparedQuery(QueryCallbackProcessor& processor, QueryCallback&& query)
+{
+    return { processor, std::move(query) };
+}
+
+#endif // TRINITYCORE_QUERY_CALLBACK_AWAITER_H
@@ -74,8 +74,13 @@ void SQLQueryHolderBase::SetSize(size_t size)
 
 bool SQLQueryHolderTask::Execute(MySQLConnection* conn, SQLQueryHolderBase* holder)
 {
-    /// execute all queries in the holder and pass the results
-    for (size_t i = 0; i < holder->m_queries.size(); ++i)
+    return Execute(conn, holder, 0, 1);
+}
+
+bool SQLQueryHolderTask::Execute(MySQLConnection* conn, SQLQueryHolderBase* holder, size_t first, size_t stride)
+{
+    /// execute the queries of this part of the holder and pass the results
+    for (size_t i = first; i < holder->m_queries.size(); i += stride)
         if (PreparedStatementBase* stmt = holder->m_queries[i].first)
             holder->SetPreparedResult(i, conn->Query(stmt));
 
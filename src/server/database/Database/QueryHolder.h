@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
 #include <future>
+#include <memory>
 #include <vector>
 
 class MySQLConnection;
@@ -34,6 +35,7 @@ class TC_DATABASE_API SQLQueryHolderBase
         SQLQueryHolderBase() = default;
         virtual ~SQLQueryHolderBase();
         void SetSize(size_t size);
+        size_t GetSize() const { return m_queries.size(); }
         PreparedQueryResult GetPreparedResult(size_t index) const;
         void SetPreparedResult(size_t index, PreparedResultSet* result);
 
@@ -55,13 +57,16 @@ class TC_DATABASE_API SQLQueryHolderTask
 {
 public:
     static bool Execute(MySQLConnection* conn, SQLQueryHolderBase* holder);
+
+    //! Executes the statements at first, first + stride, ... only, tasks running disjoint parts of a holder may run concurrently
+    static bool Execute(MySQLConnection* conn, SQLQueryHolderBase* holder, size_t first, size_t stride);
 };
 
 class TC_DATABASE_API SQLQueryHolderCallback
 {
 public:
-    SQLQueryHolderCallback(std::shared_ptr<SQLQueryHolderBase>&& holder, std::future<void>&& future)
-        : m_holder(std::move(holder)), m_future(std::move(future)) { }
+    SQLQueryHolderCallback(std::shared_ptr<SQLQueryHolderBase>&& holder, std::future<void>&& future, std::shared_ptr<AsyncCompletionSignal> completion = nullptr)
+        : m_holder(std::move(holder)), m_future(std::move(future)), m_completion(std::move(completion)) { }
 
     SQLQueryHolderCallback(SQLQueryHolderCallback&&) = default;
 
@@ -76,9 +81,11 @@ public:
 
     std::shared_ptr<SQLQueryHolderBase> m_holder;
     std::future<void> m_future;
+    std::shared_ptr<AsyncCompletionSignal> m_completion;
     std::function<void(SQLQueryHolderBase const&)> m_callback;
 };
 
 inline bool InvokeAsyncCallbackIfReady(SQLQueryHolderCallback& callback) { return callback.InvokeIfReady(); }
+inline AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(SQLQueryHolderCallback& callback) { return callback.m_completion.get(); }
 
 #endif
@@ -20,10 +20,13 @@
 #include "Field.h"
 #include "FieldValueConverters.h"
 #include "Log.h"
+#include "MySQLConnection.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
 #include <chrono>
+#include <cstddef>
 #include <cstring>
+#include <limits>
 
 namespace
 {
@@ -391,6 +394,66 @@ void InitializeDatabaseFieldMetadata(QueryResultFieldMetadata* meta, MySQLField
     meta->Type = MysqlTypeToFieldType(field->type, field->flags);
     meta->Converter = binaryProtocol ? BinaryValueConverters[std::ptrdiff_t(meta->Type)].get() : FromStringValueConverters[std::ptrdiff_t(meta->Type)].get();
 }
+
+bool IsStringType(enum_field_types type)
+{
+    switch (type)
+    {
+        case MYSQL_TYPE_TINY_BLOB:
+        case MYSQL_TYPE_MEDIUM_BLOB:
+        case MYSQL_TYPE_LONG_BLOB:
+        case MYSQL_TYPE_BLOB:
+        case MYSQL_TYPE_STRING:
+        case MYSQL_TYPE_VAR_STRING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void TerminateString(MYSQL_BIND& bind, unsigned long fetchedLength)
+{
+    // warning - the string will not be null-terminated if there is no space for it in the buffer
+    // when mysql_stmt_fetch returned MYSQL_DATA_TRUNCATED
+    // we cannot blindly null-terminate the data either as it may be retrieved as binary blob and not specifically a string
+    // in this case using Field::GetCString will result in garbage
+    // TODO: remove Field::GetCString and use std::string_view in C++17
+    if (IsStringType(bind.buffer_type) && fetchedLength < bind.buffer_length)
+        static_cast<char*>(bind.buffer)[fetchedLength] = '\0';
+}
+
+// marks NULL values in PreparedResultSet::m_lengths
+constexpr uint32 NULL_VALUE_LENGTH = std::numeric_limits<uint32>::max();
+
+// every column of buffered prepared results starts at a multiple of this so that GetColumn spans are aligned
+constexpr std::size_t COLUMN_ALIGNMENT = alignof(std::max_align_t);
+
+// initial buffer size of string columns of unbuffered prepared results
+constexpr uint32 UNBUFFERED_STRING_BUFFER_SIZE = 256;
+
+template<typename T> constexpr DatabaseFieldTypes ColumnTypeFor = DatabaseFieldTypes::Null;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<uint8> = DatabaseFieldTypes::UInt8;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<int8> = DatabaseFieldTypes::Int8;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<uint16> = DatabaseFieldTypes::UInt16;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<int16> = DatabaseFieldTypes::Int16;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<uint32> = DatabaseFieldTypes::UInt32;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<int32> = DatabaseFieldTypes::Int32;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<uint64> = DatabaseFieldTypes::UInt64;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<int64> = DatabaseFieldTypes::Int64;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<float> = DatabaseFieldTypes::Float;
+template<> constexpr DatabaseFieldTypes ColumnTypeFor<double> = DatabaseFieldTypes::Double;
+
+template<typename T> constexpr char const* ColumnTypeNameFor = "";
+template<> constexpr char const* ColumnTypeNameFor<uint8> = "uint8";
+template<> constexpr char const* ColumnTypeNameFor<int8> = "int8";
+template<> constexpr char const* ColumnTypeNameFor<uint16> = "uint16";
+template<> constexpr char const* ColumnTypeNameFor<int16> = "int16";
+template<> constexpr char const* ColumnTypeNameFor<uint32> = "uint32";
+template<> constexpr char const* ColumnTypeNameFor<int32> = "int32";
+template<> constexpr char const* ColumnTypeNameFor<uint64> = "uint64";
+template<> constexpr char const* ColumnTypeNameFor<int64> = "int64";
+template<> constexpr char const* ColumnTypeNameFor<float> = "float";
+template<> constexpr char const* ColumnTypeNameFor<double> = "double";
 }
 
 ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount) :
@@ -413,16 +476,145 @@ _fields(fields)
 }
 
 PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount) :
+m_dataSize(0),
 m_rowCount(rowCount),
 m_rowPosition(0),
 m_fieldCount(fieldCount),
+m_unbuffered(false),
 m_rBind(nullptr),
 m_stmt(stmt),
-m_metadataResult(result)
+m_metadataResult(result),
+m_connection(nullptr)
 {
     if (!m_metadataResult)
         return;
 
+    //- This is where we store the (entire) resultset
+    if (mysql_stmt_store_result(m_stmt))
+    {
+        TC_LOG_WARN("sql.sql", "{}:mysql_stmt_store_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
+        m_rowCount = 0;
+        return;
+    }
+
+    m_rowCount = mysql_stmt_num_rows(m_stmt);
+
+    //- This is where we prepare the buffer based on metadata
+    //- every column gets its own range of the buffer, holding its values for all rows
+    MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
+    std::vector<uint32> sizes(m_fieldCount);
+    m_columnOffsets.resize(m_fieldCount);
+    std::size_t dataSize = 0;
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        sizes[i] = SizeForType(&field[i]);
+        m_columnOffsets[i] = dataSize;
+        dataSize += (sizes[i] * std::size_t(m_rowCount) + COLUMN_ALIGNMENT - 1) & ~(COLUMN_ALIGNMENT - 1);
+    }
+
+    m_data = std::make_unique<char[]>(dataSize);
+    m_dataSize = dataSize;
+
+    if (!BindResult(sizes.data()))
+    {
+        mysql_stmt_free_result(m_stmt);
+        m_rowCount = 0;
+        return;
+    }
+
+    m_lengths.resize(std::size_t(m_rowCount) * m_fieldCount);
+    while (_NextRow())
+    {
+        uint32* lengths = &m_lengths[std::size_t(m_rowPosition) * m_fieldCount];
+        for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+        {
+            MYSQL_BIND& bind = m_stmt->bind[fIndex];
+            if (!*m_rBind[fIndex].is_null)
+            {
+                TerminateString(bind, *m_rBind[fIndex].length);
+                lengths[fIndex] = *m_rBind[fIndex].length;
+            }
+            else
+                lengths[fIndex] = NULL_VALUE_LENGTH;
+
+            // move buffer pointer to the value of next row
+            bind.buffer = static_cast<char*>(bind.buffer) + bind.buffer_length;
+        }
+        m_rowPosition++;
+    }
+
+    // rows that could not be fetched are not part of the result
+    m_rowCount = m_rowPosition;
+    m_rowPosition = 0;
+    if (m_rowCount)
+        SetCurrentRow();
+
+    /// All data is buffered, let go of mysql c api structures
+    mysql_stmt_free_result(m_stmt);
+}
+
+PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint32 fieldCount, MySQLConnection* connection) :
+m_dataSize(0),
+m_rowCount(0),
+m_rowPosition(0),
+m_fieldCount(fieldCount),
+m_unbuffered(true),
+m_rBind(nullptr),
+m_stmt(stmt),
+m_metadataResult(result),
+m_connection(connection)
+{
+    if (!m_metadataResult)
+    {
+        ReleaseConnection();
+        return;
+    }
+
+    //- Without mysql_stmt_store_result the longest value of string columns is not known,
+    //- their buffers start small and grow when a longer value is fetched
+    MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
+    std::vector<uint32> sizes(m_fieldCount);
+    m_columnBuffers.resize(m_fieldCount);
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        sizes[i] = IsStringType(field[i].type) ? UNBUFFERED_STRING_BUFFER_SIZE : SizeForType(&field[i]);
+        m_columnBuffers[i] = std::make_unique<char[]>(sizes[i]);
+    }
+
+    if (!BindResult(sizes.data()))
+    {
+        ReleaseConnection();
+        return;
+    }
+
+    // position on the first row, like buffered results
+    FetchUnbufferedRow();
+}
+
+PreparedResultSet::PreparedResultSet(std::shared_ptr<PreparedResultSet const> source) :
+m_dataSize(0),
+m_rowCount(source->m_rowCount),
+m_rowPosition(0),
+m_fieldCount(source->m_fieldCount),
+m_unbuffered(false),
+m_rBind(nullptr),
+m_stmt(nullptr),
+m_metadataResult(nullptr),
+m_connection(nullptr),
+m_source(source->m_source ? source->m_source : std::move(source))
+{
+    ASSERT(!m_source->m_unbuffered, "Unbuffered results can not be shared");
+
+    m_currentRow.resize(m_fieldCount);
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+        m_currentRow[i].SetMetadata(&m_source->m_fieldMetadata[i]);
+
+    if (m_rowCount)
+        SetCurrentRow();
+}
+
+bool PreparedResultSet::BindResult(uint32 const* sizes)
+{
     if (m_stmt->bind_result_done)
     {
         delete[] m_stmt->bind->length;
@@ -441,111 +633,112 @@ m_metadataResult(result)
     memset(m_rBind, 0, sizeof(MySQLBind) * m_fieldCount);
     memset(m_length, 0, sizeof(unsigned long) * m_fieldCount);
 
-    //- This is where we store the (entire) resultset
-    if (mysql_stmt_store_result(m_stmt))
-    {
-        TC_LOG_WARN("sql.sql", "{}:mysql_stmt_store_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
-        delete[] m_rBind;
-        delete[] m_isNull;
-        delete[] m_length;
-        return;
-    }
-
-    m_rowCount = mysql_stmt_num_rows(m_stmt);
-
-    //- This is where we prepare the buffer based on metadata
     MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
     m_fieldMetadata.resize(m_fieldCount);
     m_fieldIndexByAlias.reserve(m_fieldCount);
-    std::size_t rowSize = 0;
+    m_currentRow.resize(m_fieldCount);
     for (uint32 i = 0; i < m_fieldCount; ++i)
     {
-        uint32 size = SizeForType(&field[i]);
-        rowSize += size;
-
         InitializeDatabaseFieldMetadata(&m_fieldMetadata[i], &field[i], i, true);
         auto [itr, success] = m_fieldIndexByAlias.try_emplace({ Trinity::DB::FieldLookupByAliasKey::RuntimeInit, m_fieldMetadata[i].Alias }, i);
         ASSERT(success, "Duplicate column alias %s in query for column %s.%s, conflicts with column %s.%s",
             m_fieldMetadata[i].Alias, m_fieldMetadata[i].TableName, m_fieldMetadata[i].Name, m_fieldMetadata[itr->second].TableName, m_fieldMetadata[itr->second].Name);
+        m_currentRow[i].SetMetadata(&m_fieldMetadata[i]);
 
         m_rBind[i].buffer_type = field[i].type;
-        m_rBind[i].buffer_length = size;
+        m_rBind[i].buffer = m_unbuffered ? m_columnBuffers[i].get() : m_data.get() + m_columnOffsets[i];
+        m_rBind[i].buffer_length = sizes[i];
         m_rBind[i].length = &m_length[i];
         m_rBind[i].is_null = &m_isNull[i];
         m_rBind[i].error = nullptr;
         m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
     }
 
-    char* dataBuffer = new char[rowSize * m_rowCount];
-    for (uint32 i = 0, offset = 0; i < m_fieldCount; ++i)
-    {
-        m_rBind[i].buffer = dataBuffer + offset;
-        offset += m_rBind[i].buffer_length;
-    }
-
     //- This is where we bind the bind the buffer to the statement
     if (mysql_stmt_bind_result(m_stmt, m_rBind))
     {
         TC_LOG_WARN("sql.sql", "{}:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
-        mysql_stmt_free_result(m_stmt);
-        CleanUp();
+        delete[] m_rBind;
+        m_rBind = nullptr;
         delete[] m_isNull;
         delete[] m_length;
-        return;
+        return false;
     }
 
-    m_rows.resize(std::size_t(m_rowCount) * m_fieldCount);
-    while (_NextRow())
+    return true;
+}
+
+void PreparedResultSet::SetCurrentRow()
+{
+    PreparedResultSet const& storage = GetStorage();
+    std::size_t rowOffset = std::size_t(m_rowPosition) * m_fieldCount;
+    for (uint32 i = 0; i < m_fieldCount; ++i)
     {
-        for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
-        {
-            m_rows[std::size_t(m_rowPosition) * m_fieldCount + fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
+        uint32 length = storage.m_lengths[rowOffset + i];
+        if (length != NULL_VALUE_LENGTH)
+            m_currentRow[i].SetValue(storage.m_data.get() + storage.m_columnOffsets[i] + std::size_t(m_rowPosition) * storage.m_rBind[i].buffer_length, length);
+        else
+            m_currentRow[i].SetValue(nullptr, 0);
+    }
+}
 
-            unsigned long buffer_length = m_rBind[fIndex].buffer_length;
-            unsigned long fetched_length = *m_rBind[fIndex].length;
-            if (!*m_rBind[fIndex].is_null)
-            {
-                void* buffer = m_stmt->bind[fIndex].buffer;
-                switch (m_rBind[fIndex].buffer_type)
-                {
-                    case MYSQL_TYPE_TINY_BLOB:
-                    case MYSQL_TYPE_MEDIUM_BLOB:
-                    case MYSQL_TYPE_LONG_BLOB:
-                    case MYSQL_TYPE_BLOB:
-                    case MYSQL_TYPE_STRING:
-                    case MYSQL_TYPE_VAR_STRING:
-                        // warning - the string will not be null-terminated if there is no space for it in the buffer
-                        // when mysql_stmt_fetch returned MYSQL_DATA_TRUNCATED
-                        // we cannot blindly null-terminate the data either as it may be retrieved as binary blob and not specifically a string
-                        // in this case using Field::GetCString will result in garbage
-                        // TODO: remove Field::GetCString and use std::string_view in C++17
-                        if (fetched_length < buffer_length)
-                            *((char*)buffer + fetched_length) = '\0';
-                        break;
-                    default:
-                        break;
-                }
+bool PreparedResultSet::FetchUnbufferedRow()
+{
+    if (!m_connection)
+        return false;
 
-                m_rows[std::size_t(m_rowPosition) * m_fieldCount + fIndex].SetValue(
-                    (char const*)buffer,
-                    fetched_length);
+    int retval = mysql_stmt_fetch(m_stmt);
+    if (retval != 0 && retval != MYSQL_DATA_TRUNCATED)
+    {
+        if (retval != MYSQL_NO_DATA)
+            TC_LOG_ERROR("sql.sql", "{}:mysql_stmt_fetch, cannot fetch row from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
 
-                // move buffer pointer to next part
-                m_stmt->bind[fIndex].buffer = (char*)buffer + rowSize;
-            }
-            else
+        m_rowPosition = m_rowCount;
+        ReleaseConnection();
+        return false;
+    }
+
+    for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+    {
+        MYSQL_BIND& bind = m_stmt->bind[fIndex];
+        if (*m_rBind[fIndex].is_null)
+        {
+            m_currentRow[fIndex].SetValue(nullptr, 0);
+            continue;
+        }
+
+        unsigned long length = *m_rBind[fIndex].length;
+        if (length >= bind.buffer_length && IsStringType(bind.buffer_type))
+        {
+            // value did not fit, grow the buffer (for all following rows too) and read the column again
+            m_columnBuffers[fIndex] = std::make_unique<char[]>(length + 1);
+            bind.buffer = m_columnBuffers[fIndex].get();
+            bind.buffer_length = length + 1;
+            if (mysql_stmt_fetch_column(m_stmt, &bind, fIndex, 0))
             {
-                m_rows[std::size_t(m_rowPosition) * m_fieldCount + fIndex].SetValue(
-                    nullptr,
-                    *m_rBind[fIndex].length);
+                TC_LOG_ERROR("sql.sql", "{}:mysql_stmt_fetch_column, cannot fetch column {} from MySQL server. Error: {}", __FUNCTION__, fIndex, mysql_stmt_error(m_stmt));
+                m_currentRow[fIndex].SetValue(nullptr, 0);
+                continue;
             }
         }
-        m_rowPosition++;
+
+        TerminateString(bind, length);
+        m_currentRow[fIndex].SetValue(static_cast<char const*>(bind.buffer), length);
     }
-    m_rowPosition = 0;
 
-    /// All data is buffered, let go of mysql c api structures
+    m_rowPosition = m_rowCount++;
+    return true;
+}
+
+void PreparedResultSet::ReleaseConnection()
+{
+    if (!m_connection)
+        return;
+
+    //- Also discards the rows that were not read
     mysql_stmt_free_result(m_stmt);
+    m_connection->Unlock();
+    m_connection = nullptr;
 }
 
 ResultSet::~ResultSet()
@@ -555,6 +748,7 @@ ResultSet::~ResultSet()
 
 PreparedResultSet::~PreparedResultSet()
 {
+    ReleaseConnection();
     CleanUp();
 }
 
@@ -586,11 +780,15 @@ bool ResultSet::NextRow()
 
 bool PreparedResultSet::NextRow()
 {
+    if (m_unbuffered)
+        return FetchUnbufferedRow();
+
     /// Only updates the m_rowPosition so upper level code knows in which element
     /// of the rows vector to look
     if (++m_rowPosition >= m_rowCount)
         return false;
 
+    SetCurrentRow();
     return true;
 }
 
@@ -623,14 +821,13 @@ void ResultSet::CleanUp()
 void PreparedResultSet::CleanUp()
 {
     if (m_metadataResult)
-        mysql_free_result(m_metadataResult);
-
-    if (m_rBind)
     {
-        delete[](char*)m_rBind->buffer;
-        delete[] m_rBind;
-        m_rBind = nullptr;
+        mysql_free_result(m_metadataResult);
+        m_metadataResult = nullptr;
     }
+
+    delete[] m_rBind;
+    m_rBind = nullptr;
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
@@ -662,33 +859,74 @@ QueryResultFieldMetadata const& ResultSet::GetFieldMetadata(Trinity::DB::FieldLo
 Field* PreparedResultSet::Fetch() const
 {
     ASSERT(m_rowPosition < m_rowCount);
-    return const_cast<Field*>(&m_rows[std::size_t(m_rowPosition) * m_fieldCount]);
+    return const_cast<Field*>(m_currentRow.data());
 }
 
 Field const& PreparedResultSet::operator[](std::size_t index) const
 {
     ASSERT(m_rowPosition < m_rowCount);
     ASSERT(index < std::size_t(m_fieldCount));
-    return m_rows[std::size_t(m_rowPosition) * m_fieldCount + index];
+    return m_currentRow[index];
 }
 
 Field const& PreparedResultSet::operator[](Trinity::DB::FieldLookupByAliasKey const& alias) const
 {
     ASSERT(m_rowPosition < m_rowCount);
-    auto itr = m_fieldIndexByAlias.find(alias);
-    ASSERT(itr != m_fieldIndexByAlias.end());
-    return m_rows[std::size_t(m_rowPosition) * m_fieldCount + itr->second];
+    PreparedResultSet const& storage = GetStorage();
+    auto itr = storage.m_fieldIndexByAlias.find(alias);
+    ASSERT(itr != storage.m_fieldIndexByAlias.end());
+    return m_currentRow[itr->second];
 }
 
 QueryResultFieldMetadata const& PreparedResultSet::GetFieldMetadata(std::size_t index) const
 {
     ASSERT(index < std::size_t(m_fieldCount));
-    return m_fieldMetadata[index];
+    return GetStorage().m_fieldMetadata[index];
 }
 
 QueryResultFieldMetadata const& PreparedResultSet::GetFieldMetadata(Trinity::DB::FieldLookupByAliasKey const& alias) const
 {
-    auto itr = m_fieldIndexByAlias.find(alias);
-    ASSERT(itr != m_fieldIndexByAlias.end());
-    return m_fieldMetadata[itr->second];
+    PreparedResultSet const& storage = GetStorage();
+    auto itr = storage.m_fieldIndexByAlias.find(alias);
+    ASSERT(itr != storage.m_fieldIndexByAlias.end());
+    return storage.m_fieldMetadata[itr->second];
 }
+
+template<typename T>
+std::span<T const> PreparedResultSet::GetColumn(std::size_t index) const
+{
+    ASSERT(!m_unbuffered, "Columns of unbuffered results can not be accessed");
+    ASSERT(index < std::size_t(m_fieldCount));
+    if (!m_rowCount)
+        return {};
+
+    PreparedResultSet const& storage = GetStorage();
+    QueryResultFieldMetadata const& metadata = storage.m_fieldMetadata[index];
+    ASSERT(metadata.Type == ColumnTypeFor<T> && storage.m_rBind[index].buffer_length == sizeof(T),
+        "Column %s.%s has type %s which can not be read as %s", metadata.TableName, metadata.Name, metadata.TypeName, ColumnTypeNameFor<T>);
+    return { reinterpret_cast<T const*>(storage.m_data.get() + storage.m_columnOffsets[index]), std::size_t(m_rowCount) };
+}
+
+bool PreparedResultSet::IsNull(uint64 row, std::size_t index) const
+{
+    ASSERT(!m_unbuffered, "Columns of unbuffered results can not be accessed");
+    ASSERT(row < m_rowCount);
+    ASSERT(index < std::size_t(m_fieldCount));
+    return GetStorage().m_lengths[std::size_t(row) * m_fieldCount + index] == NULL_VALUE_LENGTH;
+}
+
+std::size_t PreparedResultSet::GetMemoryUsage() const
+{
+    return m_dataSize + m_lengths.size() * sizeof(uint32);
+}
+
+template TC_DATABASE_API std::span<uint8 const> PreparedResultSet::GetColumn<uint8>(std::size_t index) const;
+template TC_DATABASE_API std::span<int8 const> PreparedResultSet::GetColumn<int8>(std::size_t index) const;
+template TC_DATABASE_API std::span<uint16 const> PreparedResultSet::GetColumn<uint16>(std::size_t index) const;
+template TC_DATABASE_API std::span<int16 const> PreparedResultSet::GetColumn<int16>(std::size_t index) const;
+template TC_DATABASE_API std::span<uint32 const> PreparedResultSet::GetColumn<uint32>(std::size_t index) const;
+template TC_DATABASE_API std::span<int32 const> PreparedResultSet::GetColumn<int32>(std::size_t index) const;
+template TC_DATABASE_API std::span<uint64 const> PreparedResultSet::GetColumn<uint64>(std::size_t index) const;
+template TC_DATABASE_API std::span<int64 const> PreparedResultSet::GetColumn<int64>(std::size_t index) const;
+template TC_DATABASE_API std::span<float const> PreparedResultSet::GetColumn<float>(std::size_t index) const;
+template TC_DATABASE_API std::span<double const> PreparedResultSet::GetColumn<double>(std::size_t index) const;
@@ -21,6 +21,8 @@
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
 #include "Hash.h"
+#include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -79,15 +81,28 @@ class TC_DATABASE_API ResultSet
         ResultSet& operator=(ResultSet const& right) = delete;
 };
 
+/*
+ * Buffered results keep all values of a column next to each other in a single allocation shared by all columns,
+ * fixed size columns can be read directly as typed spans with GetColumn.
+ * Unbuffered results only ever hold the current row, it is fetched from the server by NextRow.
+ */
 class TC_DATABASE_API PreparedResultSet
 {
     public:
         PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
+        /// Unbuffered result. The connection lock is owned by the result set from here on,
+        /// it is released once the last row was read or the result set is destroyed
+        PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint32 fieldCount, MySQLConnection* connection);
+        /// Reads the rows of another buffered result without copying them (cached results),
+        /// every such result set has its own row position
+        explicit PreparedResultSet(std::shared_ptr<PreparedResultSet const> source);
         ~PreparedResultSet();
 
         bool NextRow();
+        /// Number of rows of the result, or of rows read so far for unbuffered results
         uint64 GetRowCount() const { return m_rowCount; }
         uint32 GetFieldCount() const { return m_fieldCount; }
+        bool IsUnbuffered() const { return m_unbuffered; }
 
         Field* Fetch() const;
         Field const& operator[](std::size_t index) const;
@@ -96,19 +111,41 @@ class TC_DATABASE_API PreparedResultSet
         QueryResultFieldMetadata const& GetFieldMetadata(std::size_t index) const;
         QueryResultFieldMetadata const& GetFieldMetadata(Trinity::DB::FieldLookupByAliasKey const& alias) const;
 
+        /// Values of an integer or floating point column for every row, T must match the column type exactly.
+        /// NULL values read as 0, use IsNull to tell them apart. Buffered results only
+        template<typename T>
+        std::span<T const> GetColumn(std::size_t index) const;
+        bool IsNull(uint64 row, std::size_t index) const;
+
+        /// Bytes taken by the buffered values, 0 for results reading another one
+        std::size_t GetMemoryUsage() const;
+
     protected:
         std::vector<QueryResultFieldMetadata> m_fieldMetadata;
         Trinity::DB::FieldAliasToIndexMap m_fieldIndexByAlias;
-        std::vector<Field> m_rows;
+        std::unique_ptr<char[]> m_data;                 ///< All columns, each one rowCount * buffer_length bytes long
+        std::size_t m_dataSize;
+        std::vector<std::size_t> m_columnOffsets;       ///< Start of each column in m_data
+        std::vector<uint32> m_lengths;                  ///< Length of every value, row by row (NULL_VALUE_LENGTH for NULL)
+        std::vector<std::unique_ptr<char[]>> m_columnBuffers; ///< Unbuffered results: buffer of each column for the current row
+        std::vector<Field> m_currentRow;
         uint64 m_rowCount;
         uint64 m_rowPosition;
         uint32 m_fieldCount;
+        bool m_unbuffered;
 
     private:
         MySQLBind* m_rBind;
         MySQLStmt* m_stmt;
         MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
-
+        MySQLConnection* m_connection;    ///< Locked connection the unbuffered result is read from
+        std::shared_ptr<PreparedResultSet const> m_source;    ///< Result whose rows are read instead of our own
+
+        PreparedResultSet const& GetStorage() const { return m_source ? *m_source : *this; }
+        bool BindResult(uint32 const* sizes);
+        void SetCurrentRow();
+        bool FetchUnbufferedRow();
+        void ReleaseConnection();
         void CleanUp();
         bool _NextRow();
 
@@ -0,0 +1,222 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResultCache.h"
+#include "Metric.h"
+#include "PreparedStatement.h"
+#include "QueryResult.h"
+#include <cstring>
+#include <utility>
+
+namespace
+{
+template<typename T>
+void AppendBytes(std::string& key, T value)
+{
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    key.append(bytes, sizeof(T));
+}
+}
+
+void QueryResultCache::Register(uint32 select, std::initializer_list<WriteStatement> invalidatedBy)
+{
+    std::scoped_lock lock(_lock);
+    _statements.try_emplace(select);
+    for (WriteStatement write : invalidatedBy)
+        _invalidatedBy[write.Index].emplace_back(select, write.Parameter);
+}
+
+// Integer parameters compare by value whatever their type is, a uint32 guid of a write still matches the uint64 guid of a select
+std::string QueryResultCache::MakeKey(PreparedStatementData const& parameter)
+{
+    std::string key;
+    std::visit([&]<typename T>(T const& value)
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            key += 'i';
+            AppendBytes(key, int64(value));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            key += 'f';
+            AppendBytes(key, double(value));
+        }
+        else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<uint8>>)
+        {
+            key += 's';
+            AppendBytes(key, uint32(value.size()));
+            key.append(reinterpret_cast<char const*>(value.data()), value.size());
+        }
+        else if constexpr (std::is_same_v<T, SystemTimePoint>)
+        {
+            key += 't';
+            AppendBytes(key, int64(value.time_since_epoch().count()));
+        }
+        else
+            key += 'n';
+    }, parameter.data);
+    return key;
+}
+
+std::string QueryResultCache::MakeKey(std::vector<PreparedStatementData> const& parameters)
+{
+    std::string key;
+    for (PreparedStatementData const& parameter : parameters)
+        key += MakeKey(parameter);
+    return key;
+}
+
+PreparedQueryResult QueryResultCache::Find(PreparedStatementBase const* stmt, uint64& generation)
+{
+    // registration is done before the database is used, lookups don't need the lock
+    auto statementItr = _statements.find(stmt->GetIndex());
+    if (statementItr == _statements.end())
+        return nullptr;
+
+    std::string key = MakeKey(stmt->GetParameters());
+
+    std::scoped_lock lock(_lock);
+    CachedStatement& statement = statementItr->second;
+    auto itr = statement.Entries.find(key);
+    if (itr == statement.Entries.end())
+    {
+        ++_misses;
+        generation = statement.Generation;
+        return nullptr;
+    }
+
+    ++_hits;
+    statement.Lru.splice(statement.Lru.begin(), statement.Lru, itr->second.LruPosition);
+    return std::make_shared<PreparedResultSet>(itr->second.Result);
+}
+
+void QueryResultCache::Store(PreparedStatementBase const* stmt, uint64 generation, PreparedQueryResult const& result)
+{
+    // empty results are not kept, rows inserted later could not be matched against them
+    if (!result || result->IsUnbuffered())
+        return;
+
+    auto statementItr = _statements.find(stmt->GetIndex());
+    if (statementItr == _statements.end())
+        return;
+
+    std::string key = MakeKey(stmt->GetParameters());
+    std::string firstParameter = stmt->GetParameters().empty() ? std::string() : MakeKey(stmt->GetParameters().front());
+
+    std::scoped_lock lock(_lock);
+    CachedStatement& statement = statementItr->second;
+    if (statement.PendingWrites || statement.Generation != generation)
+        return;
+
+    if (auto itr = statement.Entries.find(key); itr != statement.Entries.end())
+        Erase(statement, itr);
+
+    while (statement.Entries.size() >= _maxEntries && !statement.Lru.empty())
+        Erase(statement, statement.Entries.find(statement.Lru.back()));
+
+    statement.Lru.push_front(key);
+    _memoryUsage += result->GetMemoryUsage() + key.size();
+    ++_entryCount;
+    statement.Entries.try_emplace(std::move(key), Entry{ .Result = result, .FirstParameter = std::move(firstParameter), .LruPosition = statement.Lru.begin() });
+}
+
+void QueryResultCache::BeginWrite(PreparedStatementBase const* stmt, std::vector<CachedResultInvalidation>& invalidations)
+{
+    auto writeItr = _invalidatedBy.find(stmt->GetIndex());
+    if (writeItr == _invalidatedBy.end())
+        return;
+
+    std::vector<PreparedStatementData> const& parameters = stmt->GetParameters();
+    std::size_t firstInvalidation = invalidations.size();
+    for (auto const& [select, parameter] : writeItr->second)
+    {
+        if (parameter == AllEntries)
+        {
+            invalidations.push_back({ .Select = select, .Key = {} });
+            continue;
+        }
+
+        // every row of multi-row statements changes its own results
+        uint8 rowParameter = parameter == LastParameter ? stmt->GetRowSize() - 1 : parameter;
+        for (uint32 row = 0; row < stmt->GetRowCount(); ++row)
+            invalidations.push_back({ .Select = select, .Key = MakeKey(parameters[std::size_t(row) * stmt->GetRowSize() + rowParameter]) });
+    }
+
+    std::scoped_lock lock(_lock);
+    for (std::size_t i = firstInvalidation; i < invalidations.size(); ++i)
+    {
+        CachedStatement& statement = _statements[invalidations[i].Select];
+        ++statement.PendingWrites;
+        Drop(statement, invalidations[i].Key);
+    }
+}
+
+void QueryResultCache::EndWrite(std::vector<CachedResultInvalidation> const& invalidations)
+{
+    if (invalidations.empty())
+        return;
+
+    std::scoped_lock lock(_lock);
+    for (CachedResultInvalidation const& invalidation : invalidations)
+    {
+        CachedStatement& statement = _statements[invalidation.Select];
+        --statement.PendingWrites;
+        ++statement.Generation;
+        Drop(statement, invalidation.Key);
+    }
+}
+
+void QueryResultCache::Drop(CachedStatement& statement, Optional<std::string> const& firstParameter)
+{
+    for (auto itr = statement.Entries.begin(); itr != statement.Entries.end();)
+    {
+        auto next = std::next(itr);
+        if (!firstParameter || itr->second.FirstParameter == *firstParameter)
+            Erase(statement, itr);
+        itr = next;
+    }
+}
+
+void QueryResultCache::Erase(CachedStatement& statement, std::unordered_map<std::string, Entry>::iterator itr)
+{
+    _memoryUsage -= itr->second.Result->GetMemoryUsage() + itr->first.size();
+    --_entryCount;
+    statement.Lru.erase(itr->second.LruPosition);
+    statement.Entries.erase(itr);
+}
+
+void QueryResultCache::ReportMetrics(std::string const& databaseName)
+{
+    uint64 hits, misses;
+    std::size_t entryCount, memoryUsage;
+    {
+        std::scoped_lock lock(_lock);
+        hits = std::exchange(_hits, 0);
+        misses = std::exchange(_misses, 0);
+        entryCount = _entryCount;
+        memoryUsage = _memoryUsage;
+    }
+
+    TC_METRIC_VALUE("db_result_cache_hits", hits, TC_METRIC_TAG("db_name", databaseName));
+    TC_METRIC_VALUE("db_result_cache_misses", misses, TC_METRIC_TAG("db_name", databaseName));
+    if (hits + misses)
+        TC_METRIC_VALUE("db_result_cache_hit_rate", double(hits) / double(hits + misses), TC_METRIC_TAG("db_name", databaseName));
+    TC_METRIC_VALUE("db_result_cache_entries", uint64(entryCount), TC_METRIC_TAG("db_name", databaseName));
+    TC_METRIC_VALUE("db_result_cache_memory", uint64(memoryUsage), TC_METRIC_TAG("db_name", databaseName));
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERYRESULTCACHE_H
+#define _QUERYRESULTCACHE_H
+
+#include "Define.h"
+#include "DatabaseEnvFwd.h"
+#include "Optional.h"
+#include <initializer_list>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct PreparedStatementData;
+
+//! Cached results dropped by a write statement, kept until the write was executed
+struct CachedResultInvalidation
+{
+    uint32 Select;
+    Optional<std::string> Key;      ///< First parameter of the dropped results, nothing for all of them
+};
+
+/*! Read-through cache of prepared statement results, bounded per statement.
+    Only registered statements are cached, each one lists the write statements that change its results.
+    Writes issued as ad hoc SQL strings (or by anything but this worldserver) are not seen, statements
+    whose tables are written that way must not be registered. */
+class TC_DATABASE_API QueryResultCache
+{
+public:
+    //! Parameter of a write statement that is compared against the first parameter of the cached select
+    static constexpr uint8 AllEntries = 0xFF;       ///< every cached result of the select is dropped
+    static constexpr uint8 LastParameter = 0xFE;    ///< usually the guid of "... WHERE guid = ?"
+
+    struct WriteStatement
+    {
+        uint32 Index;
+        uint8 Parameter;
+    };
+
+    explicit QueryResultCache(uint32 maxEntries) : _maxEntries(maxEntries), _hits(0), _misses(0), _entryCount(0), _memoryUsage(0) { }
+
+    QueryResultCache(QueryResultCache const&) = delete;
+    QueryResultCache& operator=(QueryResultCache const&) = delete;
+
+    //! Must be called before the database is used
+    void Register(uint32 select, std::initializer_list<WriteStatement> invalidatedBy);
+
+    //! A result to read the cached rows from, or null. On a miss generation is set for storing the result later
+    PreparedQueryResult Find(PreparedStatementBase const* stmt, uint64& generation);
+    //! Keeps result unless a write that may have changed it was issued since Find returned generation
+    void Store(PreparedStatementBase const* stmt, uint64 generation, PreparedQueryResult const& result);
+
+    //! Drops the results stmt may change and keeps new ones from being stored until EndWrite is called with invalidations
+    void BeginWrite(PreparedStatementBase const* stmt, std::vector<CachedResultInvalidation>& invalidations);
+    void EndWrite(std::vector<CachedResultInvalidation> const& invalidations);
+
+    void ReportMetrics(std::string const& databaseName);
+
+private:
+    struct Entry
+    {
+        PreparedQueryResult Result;
+        std::string FirstParameter;
+        std::list<std::string>::iterator LruPosition;
+    };
+
+    struct CachedStatement
+    {
+        std::unordered_map<std::string, Entry> Entries;
+        std::list<std::string> Lru;     ///< Keys of Entries, most recently used first
+        uint64 Generation = 0;
+        uint32 PendingWrites = 0;
+    };
+
+    static std::string MakeKey(PreparedStatementData const& parameter);
+    static std::string MakeKey(std::vector<PreparedStatementData> const& parameters);
+
+    void Drop(CachedStatement& statement, Optional<std::string> const& firstParameter);
+    void Erase(CachedStatement& statement, std::unordered_map<std::string, Entry>::iterator itr);
+
+    uint32 _maxEntries;
+    std::unordered_map<uint32, CachedStatement> _statements;
+    std::unordered_map<uint32, std::vector<std::pair<uint32, uint8>>> _invalidatedBy;    ///< write statement -> cached selects and parameter
+    std::mutex _lock;
+    uint64 _hits;
+    uint64 _misses;
+    std::size_t _entryCount;
+    std::size_t _memoryUsage;
+};
+
+#endif
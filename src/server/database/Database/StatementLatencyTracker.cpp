@@ -0,0 +1,89 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatementLatencyTracker.h"
+#include "Metric.h"
+#include <algorithm>
+#include <bit>
+
+StatementLatencyTracker::StatementLatencyTracker(std::size_t statementCount)
+    : _statements(std::make_unique<Statement[]>(statementCount)), _statementCount(statementCount)
+{
+}
+
+void StatementLatencyTracker::Add(Histogram& histogram, std::chrono::microseconds duration)
+{
+    uint64 micros = uint64(std::max<std::chrono::microseconds::rep>(duration.count(), 0));
+    histogram[std::min<std::size_t>(std::bit_width(micros), BucketCount - 1)].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64 StatementLatencyTracker::GetPercentile(BucketCounts const& buckets, uint64 count, uint32 percent)
+{
+    uint64 rank = (count * percent + 99) / 100;
+    uint64 seen = 0;
+    for (std::size_t i = 0; i < BucketCount; ++i)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+            return uint64(1) << i;
+    }
+
+    return uint64(1) << (BucketCount - 1);
+}
+
+void StatementLatencyTracker::Record(uint32 index, std::chrono::microseconds queueWait, std::chrono::microseconds execution)
+{
+    if (index >= _statementCount)
+        return;
+
+    Add(_statements[index].QueueWait, queueWait);
+    Add(_statements[index].Execution, execution);
+}
+
+void StatementLatencyTracker::ReportMetrics(std::string const& databaseName)
+{
+    for (std::size_t index = 0; index < _statementCount; ++index)
+    {
+        BucketCounts queueWait, execution;
+        uint64 count = 0;
+        for (std::size_t i = 0; i < BucketCount; ++i)
+        {
+            queueWait[i] = _statements[index].QueueWait[i].exchange(0, std::memory_order_relaxed);
+            execution[i] = _statements[index].Execution[i].exchange(0, std::memory_order_relaxed);
+            count += execution[i];
+        }
+
+        if (!count)
+            continue;
+
+        // a record racing with the exchanges above may have only one of its two values in this report
+        uint64 queueWaitCount = 0;
+        for (uint32 bucket : queueWait)
+            queueWaitCount += bucket;
+
+        std::string statement = std::to_string(index);
+        TC_METRIC_VALUE("db_statement_count", count, TC_METRIC_TAG("db_name", databaseName), TC_METRIC_TAG("statement", statement));
+        if (queueWaitCount)
+        {
+            TC_METRIC_VALUE("db_statement_queue_wait_p50", GetPercentile(queueWait, queueWaitCount, 50), TC_METRIC_TAG("db_name", databaseName), TC_METRIC_TAG("statement", statement));
+            TC_METRIC_VALUE("db_statement_queue_wait_p99", GetPercentile(queueWait, queueWaitCount, 99), TC_METRIC_TAG("db_name", databaseName), TC_METRIC_TAG("statement", statement));
+        }
+        TC_METRIC_VALUE("db_statement_execution_p50", GetPercentile(execution, count, 50), TC_METRIC_TAG("db_name", databaseName), TC_METRIC_TAG("statement", statement));
+        TC_METRIC_VALUE("db_statement_execution_p99", GetPercentile(execution, count, 99), TC_METRIC_TAG("db_name", databaseName), TC_METRIC_TAG("statement", statement));
+        TC_METRIC_VALUE("db_statement_execution_max", GetPercentile(execution, count, 100), TC_METRIC_TAG("db_name", databaseName), TC_METRIC_TAG("statement", statement));
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STATEMENTLATENCYTRACKER_H
+#define _STATEMENTLATENCYTRACKER_H
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+/*! Histograms of the time prepared statements wait for a connection and the time they take to execute,
+    kept by statement index. Recording is lock free; ReportMetrics sends percentiles of everything recorded
+    since the previous report. */
+class TC_DATABASE_API StatementLatencyTracker
+{
+public:
+    explicit StatementLatencyTracker(std::size_t statementCount);
+
+    StatementLatencyTracker(StatementLatencyTracker const&) = delete;
+    StatementLatencyTracker& operator=(StatementLatencyTracker const&) = delete;
+
+    void Record(uint32 index, std::chrono::microseconds queueWait, std::chrono::microseconds execution);
+
+    //! Percentiles are the upper bounds of their buckets, statements not used since the last report are skipped
+    void ReportMetrics(std::string const& databaseName);
+
+private:
+    //! Bucket i counts durations below 2^i microseconds, the last one everything longer
+    static constexpr std::size_t BucketCount = 25;
+    using Histogram = std::array<std::atomic<uint32>, BucketCount>;
+    using BucketCounts = std::array<uint32, BucketCount>;
+
+    struct Statement
+    {
+        Histogram QueueWait;
+        Histogram Execution;
+    };
+
+    static void Add(Histogram& histogram, std::chrono::microseconds duration);
+    static uint64 GetPercentile(BucketCounts const& buckets, uint64 count, uint32 percent);
+
+    std::unique_ptr<Statement[]> _statements;
+    std::size_t _statementCount;
+};
+
+#endif
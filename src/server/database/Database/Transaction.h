@@ -20,9 +20,11 @@
 
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include "QueryResultCache.h"
 #include "StringFormat.h"
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <variant>
 #include <vector>
@@ -75,6 +77,7 @@ class TC_DATABASE_API TransactionBase
         void AppendPreparedStatement(PreparedStatementBase* statement);
         void Cleanup();
         std::vector<TransactionData> m_queries;
+        std::vector<CachedResultInvalidation> m_cachedResultInvalidations;    ///< Filled when committed, kept until executed
 
     private:
         bool _cleanedUp;
@@ -106,7 +109,8 @@ private:
 class TC_DATABASE_API TransactionCallback
 {
 public:
-    TransactionCallback(std::future<bool>&& future) : m_future(std::move(future)) { }
+    TransactionCallback(std::future<bool>&& future, std::shared_ptr<AsyncCompletionSignal> completion = nullptr)
+        : m_future(std::move(future)), m_completion(std::move(completion)) { }
     TransactionCallback(TransactionCallback&&) = default;
 
     TransactionCallback& operator=(TransactionCallback&&) = default;
@@ -119,9 +123,11 @@ public:
     bool InvokeIfReady();
 
     std::future<bool> m_future;
+    std::shared_ptr<AsyncCompletionSignal> m_completion;
     std::function<void(bool)> m_callback;
 };
 
 inline bool InvokeAsyncCallbackIfReady(TransactionCallback& callback) { return callback.InvokeIfReady(); }
+inline AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(TransactionCallback& callback) { return callback.m_completion.get(); }
 
 #endif
@@ -18,6 +18,7 @@
 #include "DBUpdater.h"
 #include "BuiltInConfig.h"
 #include "Config.h"
+#include "CryptoHash.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "GitRevision.h"
@@ -25,6 +26,7 @@
 #include "QueryResult.h"
 #include "StartProcess.h"
 #include "UpdateFetcher.h"
+#include "Util.h"
 #include <boost/filesystem/operations.hpp>
 #include <fstream>
 #include <iostream>
@@ -57,6 +59,26 @@ bool DownloadFile(const std::string& url, const std::string& dest) {
 }
 #endif
 
+namespace
+{
+// DELIMITER, SOURCE and the backslash commands are interpreted by the mysql client, the server rejects them
+bool UsesClientCommands(std::string_view sql)
+{
+    for (std::string_view line : Trinity::Tokenize(sql, '\n', false))
+    {
+        std::size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string_view::npos)
+            continue;
+
+        line.remove_prefix(start);
+        if (line.starts_with('\\') || StringStartsWithI(line, "DELIMITER ") || StringStartsWithI(line, "SOURCE "))
+            return true;
+    }
+
+    return false;
+}
+}
+
 std::string DBUpdaterUtil::GetCorrectedMySQLExecutable()
 {
     if (!corrected_path().empty())
@@ -271,9 +293,16 @@ bool DBUpdater<T>::Update(DatabaseWorkerPool<T>& pool)
         return false;
     }
 
+    bool const inProcess = sConfigMgr->GetBoolDefault("Updates.InProcess", false);
+
     UpdateFetcher updateFetcher(sourceDirectory, [&](std::string const& query) { DBUpdater<T>::Apply(pool, query); },
-        [&](Path const& file) { DBUpdater<T>::ApplyFile(pool, file); },
-        [&](std::string const& query) -> QueryResult { return DBUpdater<T>::Retrieve(pool, query); });
+        [&](Path const& file)
+        {
+            if (!inProcess || !DBUpdater<T>::ApplyFileInProcess(pool, file))
+                DBUpdater<T>::ApplyFile(pool, file);
+        },
+        [&](std::string const& query) -> QueryResult { return DBUpdater<T>::Retrieve(pool, query); },
+        sConfigMgr->GetStringDefault("Updates.HashCacheFile", ""));
 
     UpdateResult result;
     try
@@ -406,6 +435,27 @@ bool DBUpdater<T>::Populate(DatabaseWorkerPool<T>& pool)
 }
 
 
+template<class T>
+std::string DBUpdater<T>::GetAppliedUpdatesHash(DatabaseWorkerPool<T>& pool)
+{
+    QueryResult const result = Retrieve(pool, "SELECT `name`, `hash` FROM `updates` ORDER BY `name` ASC");
+    if (!result)
+        return "";
+
+    Trinity::Crypto::SHA1 hash;
+    do
+    {
+        Field* fields = result->Fetch();
+        hash.UpdateData(fields[0].GetStringView());
+        hash.UpdateData(":");
+        hash.UpdateData(fields[1].GetStringView());
+        hash.UpdateData(";");
+    } while (result->NextRow());
+
+    hash.Finalize();
+    return ByteArrayToHexStr(hash.GetDigest());
+}
+
 template<class T>
 QueryResult DBUpdater<T>::Retrieve(DatabaseWorkerPool<T>& pool, std::string const& query)
 {
@@ -418,6 +468,39 @@ void DBUpdater<T>::Apply(DatabaseWorkerPool<T>& pool, std::string const& query)
     pool.DirectExecute(query.c_str());
 }
 
+template<class T>
+bool DBUpdater<T>::ApplyFileInProcess(DatabaseWorkerPool<T>& pool, Path const& path)
+{
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in.is_open())
+        return false;
+
+    std::string const sql((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (UsesClientCommands(sql))
+    {
+        TC_LOG_DEBUG("sql.updates", ">> \"{}\" uses mysql client commands, applying it with the mysql client.", path.filename().generic_string());
+        return false;
+    }
+
+    // an empty script is no query at all for the server
+    if (sql.find_first_not_of(" \t\r\n") == std::string::npos)
+        return true;
+
+    if (!pool.DirectExecuteScript(sql))
+    {
+        TC_LOG_FATAL("sql.updates", "Applying of file \'{}\' to database \'{}\' failed!" \
+            " If you are a user, please pull the latest revision from the repository. "
+            "Also make sure you have not applied any of the databases with your sql client. "
+            "You cannot use auto-update system and import sql files from TrinityCore repository with your sql client. "
+            "If you are a developer, please fix your sql query.",
+            path.generic_string(), pool.GetConnectionInfo()->database);
+
+        throw UpdateException("update failed");
+    }
+
+    return true;
+}
+
 template<class T>
 void DBUpdater<T>::ApplyFile(DatabaseWorkerPool<T>& pool, Path const& path)
 {
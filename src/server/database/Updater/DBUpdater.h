@@ -79,10 +79,15 @@ public:
 
     static bool Populate(DatabaseWorkerPool<T>& pool);
 
+    // Hex digest of the names and hashes of every applied update, empty if the updates table can not be read
+    static std::string GetAppliedUpdatesHash(DatabaseWorkerPool<T>& pool);
+
 private:
     static QueryResult Retrieve(DatabaseWorkerPool<T>& pool, std::string const& query);
     static void Apply(DatabaseWorkerPool<T>& pool, std::string const& query);
     static void ApplyFile(DatabaseWorkerPool<T>& pool, Path const& path);
+    // Sends the file over a connection of the pool instead of spawning the mysql client, false if it needs the client
+    static bool ApplyFileInProcess(DatabaseWorkerPool<T>& pool, Path const& path);
     static void ApplyFile(DatabaseWorkerPool<T>& pool, std::string const& host, std::string const& user,
         std::string const& password, std::string const& port_or_socket, std::string const& database, std::string const& ssl,
         Path const& path);
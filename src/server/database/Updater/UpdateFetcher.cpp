@@ -40,9 +40,10 @@ struct UpdateFetcher::DirectoryEntry
 UpdateFetcher::UpdateFetcher(Path const& sourceDirectory,
     std::function<void(std::string const&)> const& apply,
     std::function<void(Path const& path)> const& applyFile,
-    std::function<QueryResult(std::string const&)> const& retrieve) :
+    std::function<QueryResult(std::string const&)> const& retrieve,
+    std::string const& hashCacheFile /*= ""*/) :
         _sourceDirectory(std::make_unique<Path>(sourceDirectory)), _apply(apply), _applyFile(applyFile),
-        _retrieve(retrieve)
+        _retrieve(retrieve), _hashCacheFile(hashCacheFile)
 {
 }
 
@@ -170,6 +171,70 @@ std::string UpdateFetcher::ReadSQLUpdate(boost::filesystem::path const& file) co
     return update;
 }
 
+UpdateFetcher::FileHashCache UpdateFetcher::LoadHashCache() const
+{
+    FileHashCache cache;
+    if (_hashCacheFile.empty())
+        return cache;
+
+    // every line is "<hash> <size> <write time> <path>", the path comes last because it may contain spaces
+    std::ifstream in(_hashCacheFile);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream entry(line);
+        CachedFileHash cached;
+        std::string file;
+        if (!(entry >> cached.hash >> cached.size >> cached.writeTime) || !std::getline(entry >> std::ws, file) || file.empty())
+            continue;
+
+        cache[file] = std::move(cached);
+    }
+
+    return cache;
+}
+
+void UpdateFetcher::SaveHashCache(FileHashCache const& cache) const
+{
+    std::ofstream out(_hashCacheFile, std::ios::trunc);
+    if (!out.is_open())
+    {
+        TC_LOG_WARN("sql.updates", "Failed to write the sql update hash cache \"{}\".", _hashCacheFile);
+        return;
+    }
+
+    // the file is shared by the updaters of all databases, only entries of removed files are dropped
+    for (auto const& [file, cached] : cache)
+    {
+        boost::system::error_code error;
+        if (is_regular_file(file, error))
+            out << cached.hash << ' ' << cached.size << ' ' << cached.writeTime << ' ' << file << '\n';
+    }
+}
+
+std::string UpdateFetcher::GetFileHash(Path const& file, FileHashCache& cache, bool& cacheChanged) const
+{
+    if (_hashCacheFile.empty())
+        return ByteArrayToHexStr(Trinity::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(file)));
+
+    boost::system::error_code error;
+    uint64 const size = file_size(file, error);
+    int64 const writeTime = error ? 0 : int64(last_write_time(file, error));
+    if (error)
+        return ByteArrayToHexStr(Trinity::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(file)));
+
+    CachedFileHash& cached = cache[file.generic_string()];
+    if (cached.hash.empty() || cached.size != size || cached.writeTime != writeTime)
+    {
+        cached.size = size;
+        cached.writeTime = writeTime;
+        cached.hash = ByteArrayToHexStr(Trinity::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(file)));
+        cacheChanged = true;
+    }
+
+    return cached.hash;
+}
+
 UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
                                    bool const allowRehash,
                                    bool const archivedRedundancy,
@@ -195,6 +260,9 @@ UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
 
     size_t importedUpdates = 0;
 
+    FileHashCache hashCache = LoadHashCache();
+    bool hashCacheChanged = false;
+
     for (auto const& availableQuery : available)
     {
         std::string availableQueryFilename = availableQuery.first.filename().string();
@@ -222,7 +290,7 @@ UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
         }
 
         // Calculate a Sha1 hash based on query content.
-        std::string const hash = ByteArrayToHexStr(Trinity::Crypto::SHA1::GetDigestOf(ReadSQLUpdate(availableQuery.first)));
+        std::string const hash = GetFileHash(availableQuery.first, hashCache, hashCacheChanged);
 
         UpdateMode mode = MODE_APPLY;
 
@@ -316,6 +384,9 @@ UpdateResult UpdateFetcher::Update(bool const redundancyChecks,
             ++importedUpdates;
     }
 
+    if (hashCacheChanged)
+        SaveHashCache(hashCache);
+
     // Cleanup up orphaned entries (if enabled)
     if (!applied.empty())
     {
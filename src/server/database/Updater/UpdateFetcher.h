@@ -55,7 +55,8 @@ public:
     UpdateFetcher(Path const& updateDirectory,
         std::function<void(std::string const&)> const& apply,
         std::function<void(Path const& path)> const& applyFile,
-        std::function<QueryResult(std::string const&)> const& retrieve);
+        std::function<QueryResult(std::string const&)> const& retrieve,
+        std::string const& hashCacheFile = "");
     ~UpdateFetcher();
 
     UpdateResult Update(bool const redundancyChecks, bool const allowRehash,
@@ -126,6 +127,17 @@ private:
     typedef std::unordered_map<std::string, AppliedFileEntry> AppliedFileStorage;
     typedef std::vector<UpdateFetcher::DirectoryEntry> DirectoryStorage;
 
+    // Hashes of unchanged files are taken from the cache file instead of reading them again,
+    // a file counts as unchanged while its size and last write time stay the same
+    struct CachedFileHash
+    {
+        uint64 size;
+        int64 writeTime;
+        std::string hash;
+    };
+
+    typedef std::unordered_map<std::string, CachedFileHash> FileHashCache;
+
     LocaleFileStorage GetFileList() const;
     void FillFileListRecursively(Path const& path, LocaleFileStorage& storage,
         State const state, uint32 const depth) const;
@@ -135,6 +147,10 @@ private:
 
     std::string ReadSQLUpdate(Path const& file) const;
 
+    FileHashCache LoadHashCache() const;
+    void SaveHashCache(FileHashCache const& cache) const;
+    std::string GetFileHash(Path const& file, FileHashCache& cache, bool& cacheChanged) const;
+
     uint32 Apply(Path const& path) const;
 
     void UpdateEntry(AppliedFileEntry const& entry, uint32 const speed = 0) const;
@@ -148,6 +164,7 @@ private:
     std::function<void(std::string const&)> const _apply;
     std::function<void(Path const& path)> const _applyFile;
     std::function<QueryResult(std::string const&)> const _retrieve;
+    std::string const _hashCacheFile;
 };
 
 #endif // UpdateFetcher_h__
@@ -30,6 +30,8 @@ class TC_GAME_API AggressorAI : public CreatureAI
 
         void UpdateAI(uint32) override;
         static int32 Permissible(Creature const* creature);
+
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::AggroRadius;
 };
 
 typedef std::vector<uint32> SpellVector;
@@ -48,6 +50,8 @@ class TC_GAME_API CombatAI : public CreatureAI
 
         static int32 Permissible(Creature const* /*creature*/) { return PERMIT_BASE_NO; }
 
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::AggroRadius;
+
     protected:
         EventMap _events;
         SpellVector _spells;
@@ -75,6 +79,8 @@ struct TC_GAME_API TurretAI : public CreatureAI
 
         static int32 Permissible(Creature const* /*creature*/) { return PERMIT_BASE_NO; }
 
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::AggroRadius;
+
     protected:
         float _minimumRange;
 };
@@ -89,6 +95,7 @@ struct TC_GAME_API VehicleAI : public CreatureAI
 
         void UpdateAI(uint32 diff) override;
         void MoveInLineOfSight(Unit*) override { }
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::None;
         void AttackStart(Unit*) override { }
         void OnCharmed(bool isNew) override;
 
@@ -28,6 +28,7 @@ class TC_GAME_API GuardAI : public ScriptedAI
         using ScriptedAI::ScriptedAI;
 
         static int32 Permissible(Creature const* creature);
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::AggroRadius;
         void UpdateAI(uint32 diff) override;
         bool CanSeeAlways(WorldObject const* obj) override;
 
@@ -49,6 +49,9 @@ int32 NullCreatureAI::Permissible(Creature const* creature)
 
 void PassiveAI::UpdateAI(uint32)
 {
+    // only reached by AIs not overriding UpdateAI, they have nothing to do out of combat
+    SetSleepsWhileIdle(true);
+
     if (me->IsEngaged() && !me->IsInCombat())
         EnterEvadeMode(EvadeReason::NoHostiles);
 }
@@ -67,6 +70,12 @@ void PossessedAI::UpdateAI(uint32 /*diff*/)
     }
 }
 
+void NullCreatureAI::UpdateAI(uint32)
+{
+    // only reached by AIs not overriding UpdateAI
+    SetSleepsWhileIdle(true);
+}
+
 void PossessedAI::JustDied(Unit* /*u*/)
 {
     // We died while possessed, disable our loot
@@ -86,6 +95,8 @@ void CritterAI::JustEngagedWith(Unit* who)
 
 void CritterAI::UpdateAI(uint32 diff)
 {
+    SetSleepsWhileIdle(true);
+
     if (me->IsEngaged())
     {
         if (!me->IsInCombat())
@@ -27,6 +27,7 @@ class TC_GAME_API PassiveAI : public CreatureAI
         explicit PassiveAI(Creature* creature, uint32 scriptId = {}) noexcept;
 
         void MoveInLineOfSight(Unit*) override { }
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::None;
         void AttackStart(Unit*) override { }
         void UpdateAI(uint32) override;
 
@@ -39,6 +40,7 @@ class TC_GAME_API PossessedAI : public CreatureAI
         explicit PossessedAI(Creature* creature, uint32 scriptId = {}) noexcept;
 
         void MoveInLineOfSight(Unit*) override { }
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::None;
         void AttackStart(Unit* target) override;
         void JustEnteredCombat(Unit* who) override { EngagementStart(who); }
         void JustExitedCombat() override { EngagementOver(); }
@@ -57,10 +59,11 @@ class TC_GAME_API NullCreatureAI : public CreatureAI
         explicit NullCreatureAI(Creature* creature, uint32 scriptId = {}) noexcept;
 
         void MoveInLineOfSight(Unit*) override { }
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::None;
         void AttackStart(Unit*) override { }
         void JustStartedThreateningMe(Unit*) override { }
         void JustEnteredCombat(Unit*) override { }
-        void UpdateAI(uint32) override { }
+        void UpdateAI(uint32) override;
         void JustAppeared() override { }
         void EnterEvadeMode(EvadeReason /*why*/) override { }
         void OnCharmed(bool /*isNew*/) override { }
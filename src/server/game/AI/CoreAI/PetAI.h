@@ -53,6 +53,7 @@ class TC_GAME_API PetAI : public CreatureAI
 
         void MoveInLineOfSight(Unit* /*who*/) override { } // CreatureAI interferes with returning pets
         void MoveInLineOfSight_Safe(Unit* /*who*/) { } // CreatureAI interferes with returning pets
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::None;
         void JustAppeared() override { } // we will control following manually
         void EnterEvadeMode(EvadeReason /*why*/) override { } // For fleeing, pets don't use this type of Evade mechanic
 
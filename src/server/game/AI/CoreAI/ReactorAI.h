@@ -26,6 +26,7 @@ class TC_GAME_API ReactorAI : public CreatureAI
         using CreatureAI::CreatureAI;
 
         void MoveInLineOfSight(Unit*) override { }
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::None;
         void UpdateAI(uint32 diff) override;
 
         static int32 Permissible(Creature const* creature);
@@ -26,6 +26,7 @@ class TC_GAME_API ScheduledChangeAI final : public CreatureAI
         using CreatureAI::CreatureAI;
 
         void MoveInLineOfSight(Unit*) override { }
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::None;
         void AttackStart(Unit*) override { }
         void JustStartedThreateningMe(Unit*) override { }
         void JustEnteredCombat(Unit*) override { }
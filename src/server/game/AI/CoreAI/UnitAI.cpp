@@ -40,6 +40,26 @@ void UnitAI::AttackStart(Unit* victim)
     }
 }
 
+bool UnitAI::UpdateSleep(uint32& diff, bool engaged)
+{
+    if (!engaged)
+    {
+        if (_sleepsWhileIdle)
+            return false;
+
+        if (_sleepTimer > diff)
+        {
+            _sleepTimer -= diff;
+            _sleptTime += diff;
+            return false;
+        }
+    }
+
+    _sleepTimer = 0;
+    diff += std::exchange(_sleptTime, 0);
+    return true;
+}
+
 void UnitAI::InitializeAI()
 {
     if (!me->isDead())
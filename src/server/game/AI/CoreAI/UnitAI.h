@@ -18,6 +18,7 @@
 #ifndef TRINITY_UNITAI_H
 #define TRINITY_UNITAI_H
 
+#include "Duration.h"
 #include "Errors.h"
 #include "Hash.h"
 #include "ObjectGuid.h"
@@ -52,13 +53,25 @@ class TC_GAME_API UnitAI
     protected:
         Unit* const me;
     public:
-        explicit UnitAI(Unit* unit) : me(unit) { }
+        explicit UnitAI(Unit* unit) : me(unit), _sleepsWhileIdle(false), _sleepTimer(0), _sleptTime(0) { }
         virtual ~UnitAI() { }
 
         virtual bool CanAIAttack(Unit const* /*target*/) const { return true; }
         virtual void AttackStart(Unit* victim);
         virtual void UpdateAI(uint32 diff) = 0;
 
+        // UpdateAI is only called while the unit is engaged, for AIs which have nothing to do out of combat
+        void SetSleepsWhileIdle(bool sleeps) { _sleepsWhileIdle = sleeps; }
+        bool SleepsWhileIdle() const { return _sleepsWhileIdle; }
+
+        // Skips UpdateAI until duration passed, the unit got engaged or WakeUp is called.
+        // The skipped time is added to the diff of the next UpdateAI call, so EventMap and TaskScheduler timers stay exact
+        void SleepFor(Milliseconds duration) { _sleepTimer = std::max<uint32>(duration.count(), 1); }
+        void WakeUp() { _sleepTimer = 0; }
+
+        // Called by Unit::AIUpdateTick, adds the time slept to diff and returns true if UpdateAI is due
+        bool UpdateSleep(uint32& diff, bool engaged);
+
         virtual void InitializeAI();
 
         virtual void Reset() { }
@@ -178,6 +191,10 @@ class TC_GAME_API UnitAI
         Unit* FinalizeTargetSelection(std::list<Unit*>& targetList, SelectTargetMethod targetType);
         bool PrepareTargetListSelection(std::list<Unit*>& targetList, SelectTargetMethod targetType, uint32 offset);
         void FinalizeTargetListSelection(std::list<Unit*>& targetList, uint32 num, SelectTargetMethod targetType);
+
+        bool _sleepsWhileIdle;
+        uint32 _sleepTimer;
+        uint32 _sleptTime;
 };
 
 #endif
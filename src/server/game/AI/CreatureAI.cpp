@@ -44,7 +44,8 @@ AISpellInfoType* GetAISpellInfo(uint32 spellId, Difficulty difficulty)
 
 CreatureAI::CreatureAI(Creature* creature, uint32 scriptId) noexcept
     : UnitAI(creature), me(creature), _boundary(nullptr),
-      _negateBoundary(false), _scriptId(scriptId ? scriptId : creature->GetScriptId()), _isEngaged(false), _moveInLOSLocked(false)
+      _negateBoundary(false), _scriptId(scriptId ? scriptId : creature->GetScriptId()), _isEngaged(false), _moveInLOSLocked(false),
+      _moveInLineOfSightInterest(MoveInLineOfSightInterest::All)
 {
     ASSERT(_scriptId, "A CreatureAI was initialized with an invalid scriptId!");
 }
@@ -119,6 +120,22 @@ void CreatureAI::MoveInLineOfSight_Safe(Unit* who)
     _moveInLOSLocked = false;
 }
 
+bool CreatureAI::IsInterestedInMoveInLineOfSight(Unit const* who) const
+{
+    switch (_moveInLineOfSightInterest)
+    {
+        case MoveInLineOfSightInterest::None:
+            return false;
+        case MoveInLineOfSightInterest::AggroRadius:
+            // same conditions as MoveInLineOfSight, the distance is the largest aggro radius any unit can have
+            if (me->IsEngaged() || !me->HasReactState(REACT_AGGRESSIVE))
+                return false;
+            return me->IsWithinDistInMap(who, Creature::GetMaxAttackDistance() + me->m_CombatDistance);
+        default:
+            return true;
+    }
+}
+
 void CreatureAI::MoveInLineOfSight(Unit* who)
 {
     if (me->IsEngaged())
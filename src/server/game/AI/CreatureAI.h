@@ -56,6 +56,14 @@ enum SCEquip
     EQUIP_UNEQUIP   = 0
 };
 
+// Units moving around a creature its AI reacts to in MoveInLineOfSight, only stealth alerts are checked for the others
+enum class MoveInLineOfSightInterest : uint8
+{
+    All,
+    AggroRadius,    // CreatureAI::MoveInLineOfSight, only units that can be engaged
+    None
+};
+
 class TC_GAME_API CreatureAI : public UnitAI
 {
     protected:
@@ -84,6 +92,14 @@ class TC_GAME_API CreatureAI : public UnitAI
         // Called if IsVisible(Unit* who) is true at each who move, reaction at visibility zone enter
         void MoveInLineOfSight_Safe(Unit* who);
 
+        // Interest of AIs created by CreatureAIFactory, scripts deriving from an AI keep All
+        static constexpr MoveInLineOfSightInterest FactoryMoveInLineOfSightInterest = MoveInLineOfSightInterest::All;
+
+        void SetMoveInLineOfSightInterest(MoveInLineOfSightInterest interest) { _moveInLineOfSightInterest = interest; }
+
+        // False if MoveInLineOfSight can't do anything about who, checked before the visibility of who is
+        bool IsInterestedInMoveInLineOfSight(Unit const* who) const;
+
         // Trigger Creature "Alert" state (creature can see stealthed unit)
         void TriggerAlert(Unit const* who) const;
 
@@ -262,6 +278,7 @@ class TC_GAME_API CreatureAI : public UnitAI
         uint32 const _scriptId;
         bool _isEngaged;
         bool _moveInLOSLocked;
+        MoveInLineOfSightInterest _moveInLineOfSightInterest;
 };
 
 #endif
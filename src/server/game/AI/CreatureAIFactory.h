@@ -32,7 +32,9 @@ struct CreatureAIFactory : public SelectableAI<Creature, CreatureAI>
 
     inline CreatureAI* Create(Creature* c) const override
     {
-        return new REAL_AI(c, this->GetScriptId());
+        CreatureAI* ai = new REAL_AI(c, this->GetScriptId());
+        ai->SetMoveInLineOfSightInterest(REAL_AI::FactoryMoveInLineOfSightInterest);
+        return ai;
     }
 
     int32 Permit(Creature const* c) const override
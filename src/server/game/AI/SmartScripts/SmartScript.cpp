@@ -39,6 +39,7 @@
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "PhasingHandler.h"
+#include "Profiler.h"
 #include "Random.h"
 #include "ScriptActions.h"
 #include "SmartAI.h"
@@ -71,6 +72,14 @@ SmartScript::SmartScript()
     mEventSortingRequired = false;
     mNestedEventsCounter = 0;
     mAllEventFlags = 0;
+    mTargetBufferDepth = 0;
+}
+
+SmartScript::ScopedTargets::ScopedTargets(SmartScript& script) : _script(script),
+    _targets(script.mTargetBufferDepth < script.mTargetBuffers.size() ? script.mTargetBuffers[script.mTargetBufferDepth] : script.mTargetBuffers.emplace_back())
+{
+    ++_script.mTargetBufferDepth;
+    _targets.clear();
 }
 
 SmartScript::SmartScript(SmartScript const& other) = default;
@@ -210,6 +219,7 @@ void SmartScript::OnReset()
             mEventSortingRequired = true;
         }
     }
+    BuildEventIndex();
     ProcessEventsFor(SMART_EVENT_RESET);
     mLastInvoker.Clear();
 }
@@ -257,17 +267,24 @@ void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint3
     {
         TC_LOG_WARN("scripts.ai", "SmartScript::ProcessEventsFor: reached the limit of max allowed nested ProcessEventsFor() calls with event {}, skipping!\n{}", e, GetBaseObject()->GetDebugInfo());
     }
-    else
+    else if (e != SMART_EVENT_LINK) // special handling
     {
-        for (SmartScriptHolder& event : mEvents)
+        auto [begin, end] = std::equal_range(mEventIndex.begin(), mEventIndex.end(), EventIndexEntry{ .EventType = uint32(e), .Position = 0, .PhaseMask = 0 },
+            [](EventIndexEntry const& left, EventIndexEntry const& right) { return left.EventType < right.EventType; });
+
+        // iteration by index - actions may rebuild the index (same size, mEvents only grows in OnUpdate)
+        for (std::size_t i = begin - mEventIndex.begin(), last = end - mEventIndex.begin(); i < last && i < mEventIndex.size(); ++i)
         {
-            SMART_EVENT eventType = SMART_EVENT(event.GetEventType());
-            if (eventType == SMART_EVENT_LINK)//special handling
+            EventIndexEntry const entry = mEventIndex[i];
+            if (entry.PhaseMask && !IsInPhase(entry.PhaseMask))
                 continue;
 
-            if (eventType == e)
-                if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
-                    ProcessEvent(event, unit, var0, var1, bvar, spell, gob, varString);
+            SmartScriptHolder& event = mEvents[entry.Position];
+            if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
+            {
+                ProcessEvent(event, unit, var0, var1, bvar, spell, gob, varString);
+                TrackEventTimer(event);
+            }
         }
     }
 
@@ -322,7 +339,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     if (Unit* tempInvoker = GetLastInvoker())
         TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: Invoker: {} {}", tempInvoker->GetName(), tempInvoker->GetGUID());
 
-    ObjectVector targets;
+    ScopedTargets scopedTargets(*this);
+    ObjectVector& targets = scopedTargets.Get();
     GetTargets(targets, e, Coalesce<WorldObject>(unit, gob));
 
     switch (e.GetActionType())
@@ -2702,7 +2720,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     {
         SmartScriptHolder& linked = SmartAIMgr::FindLinkedEvent(mEvents, e.link);
         if (linked)
+        {
             ProcessEvent(linked, unit, var0, var1, bvar, spell, gob, varString);
+            TrackEventTimer(linked);
+        }
         else
             TC_LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} not found or invalid, skipped.", e.entryOrGuid, e.GetScriptType(), e.event_id, e.link);
     }
@@ -2869,7 +2890,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 break;
             }
 
-            std::vector<Creature*> creatures;
+            std::vector<Creature*>& creatures = _creatureSearchBuffer;
+            creatures.clear();
             ref->GetCreatureListWithOptionsInGrid(creatures, static_cast<float>(e.target.unitRange.maxDist), {
                 .CreatureId = e.target.unitRange.creature ? Optional<uint32>(e.target.unitRange.creature) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
@@ -2886,13 +2908,14 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<Creature*> creatures;
+            std::vector<Creature*>& creatures = _creatureSearchBuffer;
+            creatures.clear();
             baseObject->GetCreatureListWithOptionsInGrid(creatures, static_cast<float>(e.target.unitDistance.dist), {
                 .CreatureId = e.target.unitDistance.creature ? Optional<uint32>(e.target.unitDistance.creature) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
             });
 
-            targets = { creatures.begin(), creatures.end() };
+            targets.assign(creatures.begin(), creatures.end());
 
             if (e.target.unitDistance.maxSize)
                 Trinity::Containers::RandomResize(targets, e.target.unitDistance.maxSize);
@@ -2911,7 +2934,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 break;
             }
 
-            std::vector<GameObject*> gameObjects;
+            std::vector<GameObject*>& gameObjects = _gameObjectSearchBuffer;
+            gameObjects.clear();
             ref->GetGameObjectListWithOptionsInGrid(gameObjects, static_cast<float>(e.target.goRange.maxDist), {
                 .GameObjectId = e.target.goRange.entry ? Optional<uint32>(e.target.goRange.entry) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
@@ -2928,13 +2952,14 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<GameObject*> gameObjects;
+            std::vector<GameObject*>& gameObjects = _gameObjectSearchBuffer;
+            gameObjects.clear();
             baseObject->GetGameObjectListWithOptionsInGrid(gameObjects, static_cast<float>(e.target.goDistance.dist), {
                 .GameObjectId = e.target.goDistance.entry ? Optional<uint32>(e.target.goDistance.entry) : Optional<uint32>(),
                 .StringId = !e.target.param_string.empty() ? Optional<std::string_view>(e.target.param_string) : Optional<std::string_view>(),
             });
 
-            targets = { gameObjects.begin(), gameObjects.end() };
+            targets.assign(gameObjects.begin(), gameObjects.end());
 
             if (e.target.goDistance.maxSize)
                 Trinity::Containers::RandomResize(targets, e.target.goDistance.maxSize);
@@ -2973,7 +2998,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<Player*> players;
+            std::vector<Player*>& players = _playerSearchBuffer;
+            players.clear();
             baseObject->GetPlayerListInGrid(players, static_cast<float>(e.target.playerRange.maxDist));
             std::ranges::copy_if(players, std::back_inserter(targets), [&](Player const* target) { return !baseObject->IsWithinDist(target, static_cast<float>(e.target.playerRange.minDist)); });
             break;
@@ -2983,9 +3009,10 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!baseObject)
                 break;
 
-            std::vector<Player*> players;
+            std::vector<Player*>& players = _playerSearchBuffer;
+            players.clear();
             baseObject->GetPlayerListInGrid(players, static_cast<float>(e.target.playerDistance.dist));
-            targets = { players.begin(), players.end() };
+            targets.assign(players.begin(), players.end());
             break;
         }
         case SMART_TARGET_STORED:
@@ -3610,7 +3637,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 case SMART_TARGET_PLAYER_RANGE:
                 case SMART_TARGET_PLAYER_DISTANCE:
                 {
-                    ObjectVector targets;
+                    ScopedTargets scopedTargets(*this);
+                    ObjectVector& targets = scopedTargets.Get();
                     GetTargets(targets, e);
 
                     auto unitTargetItr = std::ranges::find_if(targets, [this, &e](WorldObject* target)
@@ -3866,7 +3894,74 @@ void SmartScript::InstallEvents()
     {
         mEvents.insert(mEvents.end(), std::move_iterator(mInstallEvents.begin()), std::move_iterator(mInstallEvents.end()));
         mInstallEvents.clear();
+        BuildEventIndex();
+    }
+}
+
+// events processed by UpdateTimer when their timer expires
+/*static*/ bool SmartScript::IsTimedEvent(uint32 eventType)
+{
+    switch (eventType)
+    {
+        case SMART_EVENT_UPDATE:
+        case SMART_EVENT_UPDATE_OOC:
+        case SMART_EVENT_UPDATE_IC:
+        case SMART_EVENT_HEALTH_PCT:
+        case SMART_EVENT_MANA_PCT:
+        case SMART_EVENT_RANGE:
+        case SMART_EVENT_VICTIM_CASTING:
+        case SMART_EVENT_FRIENDLY_IS_CC:
+        case SMART_EVENT_FRIENDLY_MISSING_BUFF:
+        case SMART_EVENT_HAS_AURA:
+        case SMART_EVENT_TARGET_BUFFED:
+        case SMART_EVENT_FRIENDLY_HEALTH_PCT:
+        case SMART_EVENT_DISTANCE_CREATURE:
+        case SMART_EVENT_DISTANCE_GAMEOBJECT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void SmartScript::BuildEventIndex()
+{
+    mEventIndex.clear();
+    mTimedEvents.clear();
+    mRunningEventTimers.clear();
+    mEventIndex.reserve(mEvents.size());
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+    {
+        SmartScriptHolder const& e = mEvents[i];
+        EventIndexEntry entry{ .EventType = e.GetEventType(), .Position = i, .PhaseMask = e.event.event_phase_mask };
+        mEventIndex.push_back(entry);
+        if (entry.EventType == SMART_EVENT_LINK)
+            continue;
+
+        if (IsTimedEvent(entry.EventType))
+            mTimedEvents.push_back(entry);
+        else if (!e.active || e.priority != SmartScriptHolder::DEFAULT_PRIORITY)
+            mRunningEventTimers.push_back(i);
     }
+
+    std::stable_sort(mEventIndex.begin(), mEventIndex.end(), [](EventIndexEntry const& left, EventIndexEntry const& right) { return left.EventType < right.EventType; });
+}
+
+void SmartScript::TrackEventTimer(SmartScriptHolder const& e)
+{
+    // stored events and timed action lists are updated every tick
+    std::less<SmartScriptHolder const*> before;
+    if (before(&e, mEvents.data()) || !before(&e, mEvents.data() + mEvents.size()))
+        return;
+
+    if (e.GetEventType() == SMART_EVENT_LINK || IsTimedEvent(e.GetEventType()))
+        return;
+
+    if (e.active && e.priority == SmartScriptHolder::DEFAULT_PRIORITY)
+        return;
+
+    uint32 position = uint32(&e - mEvents.data());
+    if (std::find(mRunningEventTimers.begin(), mRunningEventTimers.end(), position) == mRunningEventTimers.end())
+        mRunningEventTimers.push_back(position);
 }
 
 void SmartScript::RemoveStoredEvent(uint32 id)
@@ -3905,6 +4000,8 @@ WorldObject* SmartScript::GetBaseObjectOrUnitInvoker(Unit* invoker)
 
 void SmartScript::OnUpdate(uint32 const diff)
 {
+    TC_PROFILE_ZONE("SmartScript::OnUpdate");
+
     if ((mScriptType == SMART_SCRIPT_TYPE_CREATURE
         || mScriptType == SMART_SCRIPT_TYPE_GAMEOBJECT
         || mScriptType == SMART_SCRIPT_TYPE_AREATRIGGER_ENTITY
@@ -3938,11 +4035,29 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        BuildEventIndex();
         mEventSortingRequired = false;
     }
 
-    for (SmartScriptHolder& mEvent : mEvents)
-        UpdateTimer(mEvent, diff);
+    // iteration by index - actions may rebuild the index
+    for (std::size_t i = 0; i < mTimedEvents.size(); ++i)
+    {
+        EventIndexEntry const entry = mTimedEvents[i];
+        if (entry.PhaseMask && !IsInPhase(entry.PhaseMask))
+            continue;
+
+        UpdateTimer(mEvents[entry.Position], diff);
+    }
+
+    // cooldowns of events raised by ProcessEventsFor, anything started while updating them is picked up as well
+    for (std::size_t i = 0; i < mRunningEventTimers.size(); ++i)
+        UpdateTimer(mEvents[mRunningEventTimers[i]], diff);
+
+    std::erase_if(mRunningEventTimers, [&](uint32 position)
+    {
+        SmartScriptHolder const& e = mEvents[position];
+        return e.active && e.priority == SmartScriptHolder::DEFAULT_PRIORITY;
+    });
 
     if (!mStoredEvents.empty())
     {
@@ -4219,6 +4334,7 @@ void SmartScript::OnInitialize(WorldObject* obj, AreaTriggerEntry const* at, Sce
     for (SmartScriptHolder& event : mEvents)
         InitTimer(event);//calculate timers for first time use
 
+    BuildEventIndex();
     ProcessEventsFor(SMART_EVENT_AI_INIT);
     InstallEvents();
     ProcessEventsFor(SMART_EVENT_JUST_CREATED);
@@ -20,7 +20,9 @@
 
 #include "Define.h"
 #include "SmartScriptMgr.h"
+#include <deque>
 #include <memory>
+#include <vector>
 
 class AreaTrigger;
 class Creature;
@@ -111,9 +113,26 @@ class TC_GAME_API SmartScript
 
         void SortEvents(SmartAIEventList& events);
         void RaisePriority(SmartScriptHolder& e);
+
+        // Positions of mEvents grouped by event type, phase masks are copied to skip events of other phases without touching them.
+        // Must be rebuilt whenever mEvents is reordered or grows
+        struct EventIndexEntry
+        {
+            uint32 EventType;
+            uint32 Position;
+            uint32 PhaseMask;
+        };
+
+        static bool IsTimedEvent(uint32 eventType);
+        void BuildEventIndex();
+        // events that are not timed only need their timer updated while a cooldown or retry runs
+        void TrackEventTimer(SmartScriptHolder const& e);
         void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
         SmartAIEventList mEvents;
+        std::vector<EventIndexEntry> mEventIndex;           // sorted by event type, then position
+        std::vector<EventIndexEntry> mTimedEvents;          // positions in mEvents order
+        std::vector<uint32> mRunningEventTimers;            // positions of events that are not timed but have a running timer
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         ObjectGuid mTimedActionListInvoker;
@@ -150,6 +169,32 @@ class TC_GAME_API SmartScript
 
         ObjectVectorMap _storedTargets;
 
+        // Target lists of ProcessAction are reused instead of allocated for every action.
+        // Actions may process other events, each nesting level gets its own buffer (deque keeps references stable)
+        class ScopedTargets
+        {
+        public:
+            explicit ScopedTargets(SmartScript& script);
+            ~ScopedTargets() { --_script.mTargetBufferDepth; }
+
+            ScopedTargets(ScopedTargets const&) = delete;
+            ScopedTargets& operator=(ScopedTargets const&) = delete;
+
+            ObjectVector& Get() const { return _targets; }
+
+        private:
+            SmartScript& _script;
+            ObjectVector& _targets;
+        };
+
+        std::deque<ObjectVector> mTargetBuffers;
+        uint32 mTargetBufferDepth;
+
+        // grid search results of GetTargets, which never calls out to other scripts
+        mutable std::vector<Creature*> _creatureSearchBuffer;
+        mutable std::vector<GameObject*> _gameObjectSearchBuffer;
+        mutable std::vector<Player*> _playerSearchBuffer;
+
         void InstallEvents();
 
         void RemoveStoredEvent(uint32 id);
@@ -50,7 +50,10 @@ struct VisibleAchievementCheck
     }
 };
 
-AchievementMgr::AchievementMgr() : _achievementPoints(0) { }
+AchievementMgr::AchievementMgr() : _achievementPoints(0)
+{
+    _indexActiveCriteria = true;
+}
 
 AchievementMgr::~AchievementMgr() { }
 
@@ -205,6 +208,19 @@ bool AchievementMgr::RequiredAchievementSatisfied(uint32 achievementId) const
     return HasAchieved(achievementId);
 }
 
+bool AchievementMgr::IsActiveCriteria(Criteria const* criteria) const
+{
+    // same as the first checks of CanUpdateCriteriaTree, criteria of earned achievements only come back with Reset
+    CriteriaTreeList const* trees = sCriteriaMgr->GetCriteriaTreesByCriteria(criteria->ID);
+    if (!trees)
+        return false;
+
+    return std::ranges::any_of(*trees, [&](CriteriaTree const* tree)
+    {
+        return tree->Achievement && !HasAchieved(tree->Achievement->ID);
+    });
+}
+
 PlayerAchievementMgr::PlayerAchievementMgr(Player* owner) : _owner(owner)
 {
 }
@@ -222,6 +238,7 @@ void PlayerAchievementMgr::Reset()
 
     _completedAchievements.clear();
     _achievementPoints = 0;
+    InvalidateActiveCriteria();
     DeleteFromDB(_owner->GetGUID());
 
     // re-fill data
@@ -270,6 +287,8 @@ void PlayerAchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, Pre
                         _owner->SetTitle(titleEntry);
 
         } while (achievementResult->NextRow());
+
+        InvalidateActiveCriteria();
     }
 
     if (criteriaResult)
@@ -484,6 +503,7 @@ void PlayerAchievementMgr::CompletedAchievement(AchievementEntry const* achievem
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.Date = GameTime::GetGameTime();
     ca.Changed = true;
+    InvalidateActiveCriteria();
 
     if (achievement->Flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
         sAchievementMgr->SetRealmCompleted(achievement);
@@ -687,6 +707,93 @@ CriteriaList const& PlayerAchievementMgr::GetCriteriaByType(CriteriaType type, u
     return sCriteriaMgr->GetPlayerCriteriaByType(type, asset);
 }
 
+namespace
+{
+// Result of the modifier tree for the parts that never change for a logged in character, nothing if it depends on anything else
+Optional<bool> GetCharacterModifierTreeResult(ModifierTreeNode const* tree, Player const* player)
+{
+    auto modifierResult = [&](ModifierTreeEntry const* modifier) -> Optional<bool>
+    {
+        switch (ModifierTreeType(modifier->Type))
+        {
+            case ModifierTreeType::PlayerRace:
+                return player->GetRace() == modifier->Asset;
+            case ModifierTreeType::PlayerClass:
+                return player->GetClass() == modifier->Asset;
+            default:
+                break;
+        }
+        return {};
+    };
+
+    // same evaluation as CriteriaHandler::ModifierTreeSatisfied with unknown results
+    switch (ModifierTreeOperator(tree->Entry->Operator))
+    {
+        case ModifierTreeOperator::SingleTrue:
+            if (!tree->Entry->Type)
+                return false;
+            return modifierResult(tree->Entry);
+        case ModifierTreeOperator::SingleFalse:
+            if (!tree->Entry->Type)
+                return false;
+            if (Optional<bool> result = modifierResult(tree->Entry))
+                return !*result;
+            return {};
+        case ModifierTreeOperator::All:
+        {
+            bool hasUnknown = false;
+            for (ModifierTreeNode const* node : tree->Children)
+            {
+                Optional<bool> result = GetCharacterModifierTreeResult(node, player);
+                if (!result)
+                    hasUnknown = true;
+                else if (!*result)
+                    return false;
+            }
+            if (hasUnknown)
+                return {};
+            return true;
+        }
+        case ModifierTreeOperator::Some:
+        {
+            int32 requiredAmount = std::max<int8>(tree->Entry->Amount, 1);
+            int32 satisfied = 0;
+            int32 unknown = 0;
+            for (ModifierTreeNode const* node : tree->Children)
+            {
+                Optional<bool> result = GetCharacterModifierTreeResult(node, player);
+                if (!result)
+                    ++unknown;
+                else if (*result)
+                    ++satisfied;
+            }
+            if (satisfied >= requiredAmount)
+                return true;
+            if (satisfied + unknown < requiredAmount)
+                return false;
+            return {};
+        }
+        default:
+            break;
+    }
+
+    return false;
+}
+}
+
+bool PlayerAchievementMgr::IsActiveCriteria(Criteria const* criteria) const
+{
+    if (!AchievementMgr::IsActiveCriteria(criteria))
+        return false;
+
+    // race and class modifiers of the criteria are evaluated once instead of on every event
+    if (criteria->Modifier)
+        if (Optional<bool> result = GetCharacterModifierTreeResult(criteria->Modifier, _owner); result && !*result)
+            return false;
+
+    return true;
+}
+
 GuildAchievementMgr::GuildAchievementMgr(Guild* owner) : _owner(owner)
 {
 }
@@ -711,6 +818,7 @@ void GuildAchievementMgr::Reset()
 
     _achievementPoints = 0;
     _completedAchievements.clear();
+    InvalidateActiveCriteria();
     DeleteFromDB(guid);
 }
 
@@ -753,6 +861,8 @@ void GuildAchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, Prep
 
             _achievementPoints += achievement->Points;
         } while (achievementResult->NextRow());
+
+        InvalidateActiveCriteria();
     }
 
     if (criteriaResult)
@@ -954,6 +1064,7 @@ void GuildAchievementMgr::CompletedAchievement(AchievementEntry const* achieveme
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.Date = GameTime::GetGameTime();
     ca.Changed = true;
+    InvalidateActiveCriteria();
 
     if (achievement->Flags & ACHIEVEMENT_FLAG_SHOW_GUILD_MEMBERS)
     {
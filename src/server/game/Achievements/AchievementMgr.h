@@ -69,6 +69,8 @@ protected:
 
     bool RequiredAchievementSatisfied(uint32 achievementId) const override;
 
+    bool IsActiveCriteria(Criteria const* criteria) const override;
+
 protected:
     std::unordered_map<uint32, CompletedAchievementData> _completedAchievements;
     uint32 _achievementPoints;
@@ -104,6 +106,8 @@ protected:
     std::string GetOwnerInfo() const override;
     CriteriaList const& GetCriteriaByType(CriteriaType type, uint32 asset) const override;
 
+    bool IsActiveCriteria(Criteria const* criteria) const override;
+
 private:
     Player* _owner;
 };
@@ -446,7 +446,7 @@ bool CriteriaDataSet::Meets(Player const* source, WorldObject const* target, uin
     return true;
 }
 
-CriteriaHandler::CriteriaHandler() { }
+CriteriaHandler::CriteriaHandler() : _indexActiveCriteria(false), _activeCriteriaInvalidated(false), _updateCriteriaDepth(0) { }
 
 CriteriaHandler::~CriteriaHandler() { }
 
@@ -487,9 +487,31 @@ void CriteriaHandler::UpdateCriteria(CriteriaType type, uint64 miscValue1 /*= 0*
     TC_LOG_DEBUG("criteria", "CriteriaHandler::UpdateCriteria({}, {}, {}, {}, {}) {}",
         CriteriaMgr::GetCriteriaTypeString(type), uint32(type), miscValue1, miscValue2, miscValue3, GetOwnerInfo());
 
-    CriteriaList const& criteriaList = GetCriteriaByType(type, uint32(miscValue1));
+    CriteriaList const& criteriaList = GetActiveCriteria(GetCriteriaByType(type, uint32(miscValue1)));
+    ++_updateCriteriaDepth;
     for (Criteria const* criteria : criteriaList)
         UpdateCriteria(criteria, miscValue1, miscValue2, miscValue3, ref, referencePlayer);
+    --_updateCriteriaDepth;
+}
+
+CriteriaList const& CriteriaHandler::GetActiveCriteria(CriteriaList const& criteriaList)
+{
+    if (!_indexActiveCriteria || criteriaList.empty())
+        return criteriaList;
+
+    // completing criteria from UpdateCriteria starts nested updates, the lists walked by the outer ones must outlive them
+    // (unordered_map keeps its values in place when new lists are added)
+    if (_activeCriteriaInvalidated && !_updateCriteriaDepth)
+    {
+        _activeCriteria.clear();
+        _activeCriteriaInvalidated = false;
+    }
+
+    auto [itr, inserted] = _activeCriteria.try_emplace(&criteriaList);
+    if (inserted)
+        std::ranges::copy_if(criteriaList, std::back_inserter(itr->second), [this](Criteria const* criteria) { return IsActiveCriteria(criteria); });
+
+    return itr->second;
 }
 
 void CriteriaHandler::UpdateCriteria(Criteria const* criteria, uint64 miscValue1, uint64 miscValue2, uint64 miscValue3, WorldObject const* ref, Player* referencePlayer)
@@ -311,8 +311,21 @@ protected:
     virtual std::string GetOwnerInfo() const = 0;
     virtual CriteriaList const& GetCriteriaByType(CriteriaType type, uint32 asset) const = 0;
 
+    /// Criteria of the list that IsActiveCriteria accepts, filtered once per list until InvalidateActiveCriteria
+    CriteriaList const& GetActiveCriteria(CriteriaList const& criteriaList);
+    /// Whether the criteria can still be updated for this owner, only called by handlers that set _indexActiveCriteria
+    virtual bool IsActiveCriteria(Criteria const* /*criteria*/) const { return true; }
+    /// Filtered lists are dropped before the next event, lists iterated by the current one stay valid until it ends
+    void InvalidateActiveCriteria() { _activeCriteriaInvalidated = true; }
+
     CriteriaProgressMap _criteriaProgress;
     std::unordered_map<uint32 /*criteriaID*/, Milliseconds /*time left*/> _startedCriteria;
+    bool _indexActiveCriteria;
+
+private:
+    std::unordered_map<CriteriaList const*, CriteriaList> _activeCriteria;
+    bool _activeCriteriaInvalidated;
+    uint32 _updateCriteriaDepth;
 };
 
 class TC_GAME_API CriteriaMgr
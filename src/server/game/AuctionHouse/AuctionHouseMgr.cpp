@@ -27,6 +27,7 @@
 #include "DB2Stores.h"
 #include "DatabaseEnv.h"
 #include "GameTime.h"
+#include "JobSystem.h"
 #include "Language.h"
 #include "Log.h"
 #include "Mail.h"
@@ -263,7 +264,7 @@ private:
             case AuctionHouseSortOrder::Buyout:
                 return int64(left->MinPrice) - int64(right->MinPrice);
             case AuctionHouseSortOrder::Name:
-                return left->FullName[_locale].compare(right->FullName[_locale]);
+                return (*left->FullName)[_locale].compare((*right->FullName)[_locale]);
             case AuctionHouseSortOrder::Level:
                 return int32(left->SortLevel) - int32(right->SortLevel);
             default:
@@ -311,7 +312,7 @@ private:
                 return leftPrice - rightPrice;
             }
             case AuctionHouseSortOrder::Name:
-                return left->Bucket->FullName[_locale].compare(right->Bucket->FullName[_locale]);
+                return (*left->Bucket->FullName)[_locale].compare((*right->Bucket->FullName)[_locale]);
             case AuctionHouseSortOrder::Level:
             {
                 int32 leftLevel = !left->Items[0]->GetModifier(ITEM_MODIFIER_BATTLE_PET_SPECIES_ID)
@@ -690,8 +691,12 @@ void AuctionHouseMgr::PendingAuctionProcess(Player* player)
         do
         {
             PendingAuctionInfo const& pendingAuction = *itrAH;
-            if (AuctionPosting* auction = GetAuctionsById(pendingAuction.AuctionHouseId)->GetAuction(pendingAuction.AuctionId))
+            AuctionHouseObject* auctionHouse = GetAuctionsById(pendingAuction.AuctionHouseId);
+            if (AuctionPosting* auction = auctionHouse->GetAuction(pendingAuction.AuctionId))
+            {
                 auction->EndTime = GameTime::GetSystemTime();
+                auctionHouse->OnAuctionChanged(auction);
+            }
 
             CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_AUCTION_EXPIRATION);
             stmt->setUInt32(0, uint32(GameTime::GetGameTime()));
@@ -733,8 +738,12 @@ void AuctionHouseMgr::UpdatePendingAuctions()
             CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
             for (PendingAuctionInfo const& pendingAuction : itr->second.Auctions)
             {
-                if (AuctionPosting* auction = GetAuctionsById(pendingAuction.AuctionHouseId)->GetAuction(pendingAuction.AuctionId))
+                AuctionHouseObject* auctionHouse = GetAuctionsById(pendingAuction.AuctionHouseId);
+                if (AuctionPosting* auction = auctionHouse->GetAuction(pendingAuction.AuctionId))
+                {
                     auction->EndTime = GameTime::GetSystemTime();
+                    auctionHouse->OnAuctionChanged(auction);
+                }
 
                 CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_AUCTION_EXPIRATION);
                 stmt->setUInt32(0, uint32(GameTime::GetGameTime()));
@@ -832,6 +841,240 @@ AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(uint32 factionTem
     return sAuctionHouseStore.LookupEntry(houseid);
 }
 
+AuctionsBucketIndex::AuctionsBucketIndex() = default;
+
+AuctionsBucketIndex::~AuctionsBucketIndex() = default;
+
+uint64 AuctionsBucketIndex::GetNameSignature(std::wstring_view name)
+{
+    uint64 signature = 0;
+    for (std::size_t i = 1; i < name.length(); ++i)
+    {
+        uint32 pair = uint32(name[i - 1]) * 65599 + uint32(name[i]);
+        signature |= UI64LIT(1) << ((pair * 0x9E3779B1u) >> 26);
+    }
+
+    return signature;
+}
+
+AuctionsBucketIndex::Group& AuctionsBucketIndex::GetGroupForUpdate(AuctionsBucketData const* bucket)
+{
+    std::shared_ptr<Group>& group = bucket->ItemClass < MAX_ITEM_CLASS && bucket->ItemSubClass < MAX_ITEM_SUBCLASS_TOTAL
+        ? _current._groups[bucket->ItemClass][bucket->ItemSubClass]
+        : _current._unclassified;
+
+    // snapshots only ever release their references from other threads, a group used by nobody else cannot gain new users meanwhile
+    if (!group)
+        group = std::make_shared<Group>();
+    else if (group.use_count() > 1)
+        group = std::make_shared<Group>(*group);
+
+    ++_current._epoch;
+    return *group;
+}
+
+void AuctionsBucketIndex::Add(AuctionsBucketData const* bucket)
+{
+    Group& group = GetGroupForUpdate(bucket);
+    auto levelItr = std::upper_bound(group.Levels.begin(), group.Levels.end(), bucket->RequiredLevel);
+    std::ptrdiff_t index = levelItr - group.Levels.begin();
+
+    group.Levels.insert(levelItr, bucket->RequiredLevel);
+    group.Keys.insert(group.Keys.begin() + index, bucket->Key);
+    group.InventoryTypes.insert(group.InventoryTypes.begin() + index, bucket->InventoryType);
+    group.Names.insert(group.Names.begin() + index, bucket->FullName);
+    for (std::size_t locale = 0; locale < TOTAL_LOCALES; ++locale)
+        group.NameSignatures[locale].insert(group.NameSignatures[locale].begin() + index, GetNameSignature((*bucket->FullName)[locale]));
+
+    ++_current._size;
+}
+
+std::size_t AuctionsBucketIndex::GetGroupIndex(AuctionsBucketData const* bucket)
+{
+    if (bucket->ItemClass < MAX_ITEM_CLASS && bucket->ItemSubClass < MAX_ITEM_SUBCLASS_TOTAL)
+        return bucket->ItemClass * MAX_ITEM_SUBCLASS_TOTAL + bucket->ItemSubClass;
+
+    return MAX_ITEM_CLASS * MAX_ITEM_SUBCLASS_TOTAL;
+}
+
+void AuctionsBucketIndex::Add(std::span<AuctionsBucketData const* const> buckets)
+{
+    // stable, buckets of the same level end up in the order single adds would give them
+    std::vector<AuctionsBucketData const*> sortedBuckets(buckets.begin(), buckets.end());
+    std::ranges::stable_sort(sortedBuckets, [](AuctionsBucketData const* left, AuctionsBucketData const* right)
+    {
+        return std::pair(GetGroupIndex(left), left->RequiredLevel) < std::pair(GetGroupIndex(right), right->RequiredLevel);
+    });
+
+    for (auto groupBegin = sortedBuckets.begin(); groupBegin != sortedBuckets.end();)
+    {
+        std::size_t groupIndex = GetGroupIndex(*groupBegin);
+        auto groupEnd = std::find_if(groupBegin, sortedBuckets.end(), [&](AuctionsBucketData const* bucket) { return GetGroupIndex(bucket) != groupIndex; });
+
+        // the run is sorted by level, so are the positions the buckets would get from single adds
+        Group& group = GetGroupForUpdate(*groupBegin);
+        std::span<AuctionsBucketData const* const> run(groupBegin, groupEnd);
+        std::vector<std::size_t> positions(run.size());
+        for (std::size_t i = 0; i < run.size(); ++i)
+            positions[i] = std::upper_bound(group.Levels.begin(), group.Levels.end(), run[i]->RequiredLevel) - group.Levels.begin() + i;
+
+        // grow every column once and move the existing entries back from the end, each of them moves once
+        auto mergeColumn = [&]<typename T, typename Value>(std::vector<T>& column, Value value)
+        {
+            std::size_t oldSize = column.size();
+            column.resize(oldSize + run.size());
+            auto oldEnd = column.begin() + oldSize;
+            for (std::size_t i = run.size(); i > 0; --i)
+            {
+                auto oldBegin = column.begin() + (positions[i - 1] - (i - 1));
+                std::move_backward(oldBegin, oldEnd, oldEnd + i);
+                column[positions[i - 1]] = value(run[i - 1]);
+                oldEnd = oldBegin;
+            }
+        };
+
+        mergeColumn(group.Keys, [](AuctionsBucketData const* bucket) { return bucket->Key; });
+        mergeColumn(group.Levels, [](AuctionsBucketData const* bucket) { return bucket->RequiredLevel; });
+        mergeColumn(group.InventoryTypes, [](AuctionsBucketData const* bucket) { return bucket->InventoryType; });
+        mergeColumn(group.Names, [](AuctionsBucketData const* bucket) { return bucket->FullName; });
+        for (std::size_t locale = 0; locale < TOTAL_LOCALES; ++locale)
+            mergeColumn(group.NameSignatures[locale], [locale](AuctionsBucketData const* bucket) { return GetNameSignature((*bucket->FullName)[locale]); });
+
+        _current._size += groupEnd - groupBegin;
+        groupBegin = groupEnd;
+    }
+}
+
+void AuctionsBucketIndex::Remove(AuctionsBucketData const* bucket)
+{
+    Group& group = GetGroupForUpdate(bucket);
+    auto [levelBegin, levelEnd] = std::equal_range(group.Levels.begin(), group.Levels.end(), bucket->RequiredLevel);
+    auto keyEnd = group.Keys.begin() + (levelEnd - group.Levels.begin());
+    auto keyItr = std::find(group.Keys.begin() + (levelBegin - group.Levels.begin()), keyEnd, bucket->Key);
+    if (keyItr == keyEnd)
+        return;
+
+    std::ptrdiff_t index = keyItr - group.Keys.begin();
+    group.Levels.erase(group.Levels.begin() + index);
+    group.Keys.erase(keyItr);
+    group.InventoryTypes.erase(group.InventoryTypes.begin() + index);
+    group.Names.erase(group.Names.begin() + index);
+    for (std::vector<uint64>& signatures : group.NameSignatures)
+        signatures.erase(signatures.begin() + index);
+
+    --_current._size;
+}
+
+std::shared_ptr<AuctionsBucketIndex::Snapshot const> AuctionsBucketIndex::GetSnapshot()
+{
+    if (!_lastSnapshot || _lastSnapshot->GetEpoch() != _current.GetEpoch())
+        _lastSnapshot = std::make_shared<Snapshot const>(_current);
+
+    return _lastSnapshot;
+}
+
+void AuctionsBucketIndex::Snapshot::Search(LocaleConstant locale, std::wstring_view name, bool exactMatch, uint8 minLevel, uint8 maxLevel,
+    Optional<AuctionSearchClassFilters> const& classFilters, std::vector<AuctionsBucketKey>& result) const
+{
+    uint64 nameSignature = GetNameSignature(name);
+    if (!classFilters)
+    {
+        for (std::array<std::shared_ptr<Group>, MAX_ITEM_SUBCLASS_TOTAL> const& classGroups : _groups)
+            for (std::shared_ptr<Group> const& group : classGroups)
+                SearchGroup(group.get(), locale, name, exactMatch, nameSignature, minLevel, maxLevel, ~UI64LIT(0), result);
+
+        SearchGroup(_unclassified.get(), locale, name, exactMatch, nameSignature, minLevel, maxLevel, ~UI64LIT(0), result);
+        return;
+    }
+
+    for (std::size_t itemClass = 0; itemClass < MAX_ITEM_CLASS; ++itemClass)
+    {
+        // if we dont want this class included, SubclassMask is set to FILTER_SKIP_CLASS
+        // if we want this class and did not specify and subclasses, its set to FILTER_SKIP_SUBCLASS
+        // otherwise full restrictions apply
+        AuctionSearchClassFilters::SubclassFilter const& filter = classFilters->Classes[itemClass];
+        if (filter.SubclassMask == AuctionSearchClassFilters::FILTER_SKIP_CLASS)
+            continue;
+
+        for (std::size_t itemSubClass = 0; itemSubClass < MAX_ITEM_SUBCLASS_TOTAL; ++itemSubClass)
+        {
+            Group const* group = _groups[itemClass][itemSubClass].get();
+            if (filter.SubclassMask == AuctionSearchClassFilters::FILTER_SKIP_SUBCLASS)
+                SearchGroup(group, locale, name, exactMatch, nameSignature, minLevel, maxLevel, ~UI64LIT(0), result);
+            else if (filter.SubclassMask & (1 << itemSubClass))
+                SearchGroup(group, locale, name, exactMatch, nameSignature, minLevel, maxLevel, filter.InvTypes[itemSubClass], result);
+        }
+    }
+}
+
+void AuctionsBucketIndex::Snapshot::SearchGroup(Group const* group, LocaleConstant locale, std::wstring_view name, bool exactMatch, uint64 nameSignature,
+    uint8 minLevel, uint8 maxLevel, uint64 inventoryTypeMask, std::vector<AuctionsBucketKey>& result)
+{
+    if (!group)
+        return;
+
+    auto levelBegin = minLevel ? std::lower_bound(group->Levels.begin(), group->Levels.end(), minLevel) : group->Levels.begin();
+    auto levelEnd = maxLevel ? std::upper_bound(levelBegin, group->Levels.end(), maxLevel) : group->Levels.end();
+
+    std::vector<uint64> const& nameSignatures = group->NameSignatures[locale];
+    for (std::ptrdiff_t i = levelBegin - group->Levels.begin(), end = levelEnd - group->Levels.begin(); i < end; ++i)
+    {
+        if ((nameSignatures[i] & nameSignature) != nameSignature)
+            continue;
+
+        if (!(inventoryTypeMask & (UI64LIT(1) << group->InventoryTypes[i])))
+            continue;
+
+        if (!name.empty())
+        {
+            std::wstring const& fullName = (*group->Names[i])[locale];
+            if (exactMatch ? fullName != name : fullName.find(name) == std::wstring::npos)
+                continue;
+        }
+
+        result.push_back(group->Keys[i]);
+    }
+}
+
+AuctionReplicatePageCache::Page const* AuctionReplicatePageCache::Find(uint32 cursor, uint32 count, TimePoint now) const
+{
+    auto itr = _pages.find({ cursor, count });
+    if (itr == _pages.end() || now - itr->second.BuildTime >= MaxAge)
+        return nullptr;
+
+    return &itr->second;
+}
+
+AuctionReplicatePageCache::Page const& AuctionReplicatePageCache::Store(uint32 cursor, uint32 count, Page page, TimePoint now)
+{
+    if (_pages.size() >= MaxPages)
+    {
+        std::erase_if(_pages, [now](std::pair<std::pair<uint32, uint32> const, Page> const& cachedPage)
+        {
+            return now - cachedPage.second.BuildTime >= MaxAge;
+        });
+
+        // scans with unusual page sizes, there is no point in keeping all of them
+        if (_pages.size() >= MaxPages)
+            _pages.clear();
+    }
+
+    Page& cachedPage = _pages[{ cursor, count }];
+    cachedPage = std::move(page);
+    return cachedPage;
+}
+
+void AuctionReplicatePageCache::Invalidate(uint32 auctionId)
+{
+    for (auto itr = _pages.begin(); itr != _pages.end() && itr->first.first < auctionId;)
+    {
+        if (!itr->second.IsFull || auctionId <= itr->second.LastAuctionId)
+            itr = _pages.erase(itr);
+        else
+            ++itr;
+    }
+}
+
 AuctionHouseObject::AuctionHouseObject(uint32 auctionHouseId) : _auctionHouse(sAuctionHouseStore.AssertEntry(auctionHouseId))
 {
 }
@@ -849,6 +1092,74 @@ AuctionPosting* AuctionHouseObject::GetAuction(uint32 auctionId)
 }
 
 void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionPosting auction)
+{
+    if (trans)
+    {
+        CharacterDatabasePreparedStatement* auctionStmt = nullptr;
+        CharacterDatabasePreparedStatement* itemsStmt = nullptr;
+        AddAuctionRows(auction, auctionStmt, itemsStmt);
+        trans->Append(auctionStmt);
+        if (itemsStmt)
+            trans->Append(itemsStmt);
+    }
+
+    AuctionPosting* addedAuction = InsertAuction(std::move(auction), nullptr);
+
+    sScriptMgr->OnAuctionAdd(this, addedAuction);
+}
+
+void AuctionHouseObject::AddAuctions(CharacterDatabaseTransaction trans, std::vector<AuctionPosting> auctions)
+{
+    CharacterDatabasePreparedStatement* auctionStmt = nullptr;
+    CharacterDatabasePreparedStatement* itemsStmt = nullptr;
+    std::vector<AuctionsBucketData const*> newBuckets;
+    std::vector<AuctionPosting*> addedAuctions;
+    addedAuctions.reserve(auctions.size());
+    for (AuctionPosting& auction : auctions)
+    {
+        if (trans)
+            AddAuctionRows(auction, auctionStmt, itemsStmt);
+
+        addedAuctions.push_back(InsertAuction(std::move(auction), &newBuckets));
+    }
+
+    if (auctionStmt)
+        trans->Append(auctionStmt);
+
+    if (itemsStmt)
+        trans->Append(itemsStmt);
+
+    _bucketIndex.Add(newBuckets);
+
+    for (AuctionPosting* addedAuction : addedAuctions)
+        sScriptMgr->OnAuctionAdd(this, addedAuction);
+}
+
+void AuctionHouseObject::AddAuctionRows(AuctionPosting const& auction, CharacterDatabasePreparedStatement*& auctionStmt,
+    CharacterDatabasePreparedStatement*& itemsStmt) const
+{
+    auctionStmt = CharacterDatabase.AddPreparedStatementRow(auctionStmt, CHAR_INS_AUCTION);
+    auctionStmt->setUInt32(0, auction.Id);
+    auctionStmt->setUInt32(1, _auctionHouse->ID);
+    auctionStmt->setUInt64(2, auction.Owner.GetCounter());
+    auctionStmt->setUInt64(3, ObjectGuid::Empty.GetCounter());
+    auctionStmt->setUInt64(4, auction.MinBid);
+    auctionStmt->setUInt64(5, auction.BuyoutOrUnitPrice);
+    auctionStmt->setUInt64(6, auction.Deposit);
+    auctionStmt->setUInt64(7, auction.BidAmount);
+    auctionStmt->setInt64(8, std::chrono::system_clock::to_time_t(auction.StartTime));
+    auctionStmt->setInt64(9, std::chrono::system_clock::to_time_t(auction.EndTime));
+    auctionStmt->setUInt8(10, auction.ServerFlags.AsUnderlyingType());
+
+    for (Item* item : auction.Items)
+    {
+        itemsStmt = CharacterDatabase.AddPreparedStatementRow(itemsStmt, CHAR_INS_AUCTION_ITEMS);
+        itemsStmt->setUInt32(0, auction.Id);
+        itemsStmt->setUInt64(1, item->GetGUID().GetCounter());
+    }
+}
+
+AuctionPosting* AuctionHouseObject::InsertAuction(AuctionPosting auction, std::vector<AuctionsBucketData const*>* newBuckets)
 {
     AuctionsBucketKey key = AuctionsBucketKey::ForItem(auction.Items[0]);
     auto [bucketItr, isNew] = _buckets.try_emplace(key);
@@ -890,6 +1201,7 @@ void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionP
                 break;
         }
 
+        std::shared_ptr<AuctionsBucketNames> fullName = std::make_shared<AuctionsBucketNames>();
         for (LocaleConstant locale = LOCALE_enUS; locale < TOTAL_LOCALES; locale = LocaleConstant(locale + 1))
         {
             if (locale == LOCALE_none)
@@ -899,8 +1211,15 @@ void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionP
             if (!Utf8toWStr(auction.Items[0]->GetNameForLocaleIdx(locale), utf16name))
                 continue;
 
-            bucket->FullName[locale] = wstrCaseAccentInsensitiveParse(utf16name, locale);
+            (*fullName)[locale] = wstrCaseAccentInsensitiveParse(utf16name, locale);
         }
+
+        bucket->FullName = std::move(fullName);
+
+        if (newBuckets)
+            newBuckets->push_back(bucket);
+        else
+            _bucketIndex.Add(bucket);
     }
 
     // update cache fields
@@ -947,31 +1266,6 @@ void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionP
     bucket->QualityMask |= static_cast<AuctionHouseFilterMask>(AsUnderlyingType(AuctionHouseFilterMask::PoorQuality) << quality);
     ++bucket->QualityCounts[quality];
 
-    if (trans)
-    {
-        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AUCTION);
-        stmt->setUInt32(0, auction.Id);
-        stmt->setUInt32(1, _auctionHouse->ID);
-        stmt->setUInt64(2, auction.Owner.GetCounter());
-        stmt->setUInt64(3, ObjectGuid::Empty.GetCounter());
-        stmt->setUInt64(4, auction.MinBid);
-        stmt->setUInt64(5, auction.BuyoutOrUnitPrice);
-        stmt->setUInt64(6, auction.Deposit);
-        stmt->setUInt64(7, auction.BidAmount);
-        stmt->setInt64(8, std::chrono::system_clock::to_time_t(auction.StartTime));
-        stmt->setInt64(9, std::chrono::system_clock::to_time_t(auction.EndTime));
-        stmt->setUInt8(10, auction.ServerFlags.AsUnderlyingType());
-        trans->Append(stmt);
-
-        for (Item* item : auction.Items)
-        {
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AUCTION_ITEMS);
-            stmt->setUInt32(0, auction.Id);
-            stmt->setUInt64(1, item->GetGUID().GetCounter());
-            trans->Append(stmt);
-        }
-    }
-
     for (Item* item : auction.Items)
         sAuctionMgr->AddAItem(item);
 
@@ -980,13 +1274,14 @@ void AuctionHouseObject::AddAuction(CharacterDatabaseTransaction trans, AuctionP
     for (ObjectGuid bidder : auction.BidderHistory)
         _playerBidderAuctions.emplace(bidder, auction.Id);
 
+    _replicatePages.Invalidate(auction.Id);
     AuctionPosting* addedAuction = &(_itemsByAuctionId[auction.Id] = std::move(auction));
 
     WorldPackets::AuctionHouse::AuctionSortDef priceSort{ AuctionHouseSortOrder::Price, false };
     AuctionPosting::Sorter insertSorter(LOCALE_enUS, std::span(&priceSort, 1));
     bucket->Auctions.insert(std::ranges::lower_bound(bucket->Auctions, addedAuction, std::cref(insertSorter)), addedAuction);
 
-    sScriptMgr->OnAuctionAdd(this, addedAuction);
+    return addedAuction;
 }
 
 std::map<uint32, AuctionPosting>::node_type AuctionHouseObject::RemoveAuction(CharacterDatabaseTransaction trans, AuctionPosting* auction,
@@ -994,6 +1289,8 @@ std::map<uint32, AuctionPosting>::node_type AuctionHouseObject::RemoveAuction(Ch
 {
     AuctionsBucketData* bucket = auction->Bucket;
 
+    _replicatePages.Invalidate(auction->Id);
+
     std::erase(bucket->Auctions, auction);
     if (!bucket->Auctions.empty())
     {
@@ -1051,6 +1348,7 @@ std::map<uint32, AuctionPosting>::node_type AuctionHouseObject::RemoveAuction(Ch
     else
     {
         auction->Bucket = nullptr;
+        _bucketIndex.Remove(bucket);
         _buckets.erase(bucket->Key);
     }
 
@@ -1139,6 +1437,48 @@ void AuctionHouseObject::Update()
 void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionListBucketsResult& listBucketsResult, Player const* player,
     std::wstring const& name, uint8 minLevel, uint8 maxLevel, EnumFlag<AuctionHouseFilterMask> filters, Optional<AuctionSearchClassFilters> const& classFilters,
     std::span<uint8 const> knownPetBits, uint8 maxKnownPetLevel, uint32 offset, std::span<WorldPackets::AuctionHouse::AuctionSortDef const> sorts) const
+{
+    // class, subclass, inventory type, level and name filters are answered by the index
+    std::vector<AuctionsBucketKey> candidates;
+    _bucketIndex.Search(player->GetSession()->GetSessionDbcLocale(), name, filters.HasFlag(AuctionHouseFilterMask::ExactMatch), minLevel, maxLevel, classFilters, candidates);
+
+    BuildListBuckets(listBucketsResult, player, candidates, filters, knownPetBits, maxKnownPetLevel, offset, sorts);
+}
+
+void AuctionHouseObject::QueueListBuckets(WorldSession* session, AuctionBrowseQuery query, uint32 desiredDelay)
+{
+    sWorld->GetJobSystem().Spawn(ListBucketsJob(_bucketIndex.GetSnapshot(), session->GetAccountId(), session->GetPlayer()->GetGUID(),
+        session->GetSessionDbcLocale(), std::move(query), desiredDelay));
+}
+
+Trinity::Job<void> AuctionHouseObject::ListBucketsJob(std::shared_ptr<AuctionsBucketIndex::Snapshot const> snapshot, uint32 accountId, ObjectGuid playerGuid,
+    LocaleConstant locale, AuctionBrowseQuery query, uint32 desiredDelay)
+{
+    std::vector<AuctionsBucketKey> candidates;
+    snapshot->Search(locale, query.Name, query.Filters.HasFlag(AuctionHouseFilterMask::ExactMatch), query.MinLevel, query.MaxLevel, query.ClassFilters, candidates);
+    snapshot = nullptr;
+
+    // the remaining filters need the player and the live buckets, buckets removed since the snapshot are skipped
+    co_await sWorld->GetWorldThreadJobs().Resume();
+
+    WorldSession* session = sWorld->FindSession(accountId);
+    if (!session)
+        co_return;
+
+    Player* player = session->GetPlayer();
+    if (!player || player->GetGUID() != playerGuid || !player->IsInWorld())
+        co_return;
+
+    WorldPackets::AuctionHouse::AuctionListBucketsResult listBucketsResult;
+    BuildListBuckets(listBucketsResult, player, candidates, query.Filters, query.KnownPetBits, query.MaxKnownPetLevel, query.Offset, query.Sorts);
+    listBucketsResult.BrowseMode = AuctionHouseBrowseMode::Search;
+    listBucketsResult.DesiredDelay = desiredDelay;
+    session->SendPacket(listBucketsResult.Write());
+}
+
+void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionListBucketsResult& listBucketsResult, Player const* player,
+    std::span<AuctionsBucketKey const> candidates, EnumFlag<AuctionHouseFilterMask> filters, std::span<uint8 const> knownPetBits, uint8 maxKnownPetLevel,
+    uint32 offset, std::span<WorldPackets::AuctionHouse::AuctionSortDef const> sorts) const
 {
     std::unordered_set<uint32> knownAppearanceIds;
     boost::dynamic_bitset<uint8> knownPetSpecies;
@@ -1153,49 +1493,16 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
 
     AuctionsResultBuilder<AuctionsBucketData> builder(offset, player->GetSession()->GetSessionDbcLocale(), sorts, AuctionHouseResultLimits::Browse);
 
-    for (std::pair<AuctionsBucketKey const, AuctionsBucketData> const& bucket : _buckets)
+    for (AuctionsBucketKey const& key : candidates)
     {
-        AuctionsBucketData const* bucketData = &bucket.second;
-        if (!name.empty())
-        {
-            if (filters.HasFlag(AuctionHouseFilterMask::ExactMatch))
-            {
-                if (bucketData->FullName[player->GetSession()->GetSessionDbcLocale()] != name)
-                    continue;
-            }
-            else
-                if (bucketData->FullName[player->GetSession()->GetSessionDbcLocale()].find(name) == std::wstring::npos)
-                    continue;
-        }
-
-        if (minLevel && bucketData->RequiredLevel < minLevel)
-            continue;
-
-        if (maxLevel && bucketData->RequiredLevel > maxLevel)
+        auto bucketItr = _buckets.find(key);
+        if (bucketItr == _buckets.end())
             continue;
 
+        AuctionsBucketData const* bucketData = &bucketItr->second;
         if (!filters.HasFlag(bucketData->QualityMask))
             continue;
 
-        if (classFilters)
-        {
-            // if we dont want any class filters, Optional is not initialized
-            // if we dont want this class included, SubclassMask is set to FILTER_SKIP_CLASS
-            // if we want this class and did not specify and subclasses, its set to FILTER_SKIP_SUBCLASS
-            // otherwise full restrictions apply
-            if (classFilters->Classes[bucketData->ItemClass].SubclassMask == AuctionSearchClassFilters::FILTER_SKIP_CLASS)
-                continue;
-
-            if (classFilters->Classes[bucketData->ItemClass].SubclassMask != AuctionSearchClassFilters::FILTER_SKIP_SUBCLASS)
-            {
-                if (!(classFilters->Classes[bucketData->ItemClass].SubclassMask & (1 << bucketData->ItemSubClass)))
-                    continue;
-
-                if (!(classFilters->Classes[bucketData->ItemClass].InvTypes[bucketData->ItemSubClass] & (UI64LIT(1) << bucketData->InventoryType)))
-                    continue;
-            }
-        }
-
         if (filters.HasFlag(AuctionHouseFilterMask::UncollectedOnly))
         {
             // appearances - by ItemAppearanceId, not ItemModifiedAppearanceId
@@ -1218,15 +1525,15 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
                     continue;
             }
             // caged pets
-            else if (bucket.first.BattlePetSpeciesId)
+            else if (bucketData->Key.BattlePetSpeciesId)
             {
-                if (knownPetSpecies.test(bucket.first.BattlePetSpeciesId))
+                if (knownPetSpecies.test(bucketData->Key.BattlePetSpeciesId))
                     continue;
             }
             // toys
-            else if (sDB2Manager.IsToyItem(bucket.first.ItemId))
+            else if (sDB2Manager.IsToyItem(bucketData->Key.ItemId))
             {
-                if (player->GetSession()->GetCollectionMgr()->HasToy(bucket.first.ItemId))
+                if (player->GetSession()->GetCollectionMgr()->HasToy(bucketData->Key.ItemId))
                     continue;
             }
             // mounts
@@ -1234,7 +1541,7 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
             // pet items
             else if (bucketData->ItemClass == ITEM_CLASS_CONSUMABLE || bucketData->ItemClass == ITEM_CLASS_RECIPE || bucketData->ItemClass == ITEM_CLASS_MISCELLANEOUS)
             {
-                ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucket.first.ItemId));
+                ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucketData->Key.ItemId));
                 if (itemTemplate->Effects.size() >= 2 && (itemTemplate->Effects[0]->SpellID == 483 || itemTemplate->Effects[0]->SpellID == 55884))
                 {
                     if (player->HasSpell(itemTemplate->Effects[1]->SpellID))
@@ -1252,7 +1559,7 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
             if (bucketData->RequiredLevel && player->GetLevel() < bucketData->RequiredLevel)
                 continue;
 
-            if (player->CanUseItem(sObjectMgr->GetItemTemplate(bucket.first.ItemId), true) != EQUIP_ERR_OK)
+            if (player->CanUseItem(sObjectMgr->GetItemTemplate(bucketData->Key.ItemId), true) != EQUIP_ERR_OK)
                 continue;
 
             // cannot learn caged pets whose level exceeds highest level of currently owned pet
@@ -1262,7 +1569,7 @@ void AuctionHouseObject::BuildListBuckets(WorldPackets::AuctionHouse::AuctionLis
 
         if (filters.HasFlag(AuctionHouseFilterMask::CurrentExpansionOnly))
         {
-            ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucket.first.ItemId));
+            ItemTemplate const* itemTemplate = ASSERT_NOTNULL(sObjectMgr->GetItemTemplate(bucketData->Key.ItemId));
             if (itemTemplate->GetRequiredExpansion() != sWorld->getIntConfig(CONFIG_EXPANSION))
                 continue;
         }
@@ -1436,21 +1743,42 @@ void AuctionHouseObject::BuildReplicate(WorldPackets::AuctionHouse::AuctionRepli
     if (_itemsByAuctionId.empty() || !count)
         return;
 
-    auto itr = _itemsByAuctionId.upper_bound(cursor);
-    for (; itr != _itemsByAuctionId.end(); ++itr)
+    // every player scanning the auction house asks for the same pages, only the change numbers are their own
+    AuctionReplicatePageCache::Page const* page = _replicatePages.Find(cursor, count, curTime);
+    if (!page)
     {
-        AuctionPosting const& auction = itr->second;
+        std::vector<WorldPackets::AuctionHouse::AuctionItem> items;
+        for (auto itr = _itemsByAuctionId.upper_bound(cursor); itr != _itemsByAuctionId.end() && items.size() < count; ++itr)
+        {
+            AuctionPosting const& auction = itr->second;
 
-        replicateResponse.Items.emplace_back();
-        WorldPackets::AuctionHouse::AuctionItem& auctionItem = replicateResponse.Items.back();
-        auction.BuildAuctionItem(&auctionItem, false, true, true, auction.Bidder.IsEmpty());
-        if (!--count)
-            break;
+            items.emplace_back();
+            WorldPackets::AuctionHouse::AuctionItem& auctionItem = items.back();
+            auction.BuildAuctionItem(&auctionItem, false, true, true, auction.Bidder.IsEmpty());
+        }
+
+        if (items.empty())
+        {
+            replicateResponse.ChangeNumberGlobal = throttleItr->second.Global;
+            replicateResponse.ChangeNumberCursor = throttleItr->second.Cursor = 0;
+            replicateResponse.ChangeNumberTombstone = throttleItr->second.Tombstone = 0;
+            return;
+        }
+
+        AuctionReplicatePageCache::Page newPage;
+        newPage.Items = WorldPackets::AuctionHouse::AuctionReplicateResponse::WriteItems(items);
+        newPage.ItemCount = uint32(items.size());
+        newPage.LastAuctionId = items.back().AuctionID;
+        newPage.IsFull = items.size() == count;
+        newPage.BuildTime = curTime;
+        page = &_replicatePages.Store(cursor, count, std::move(newPage), curTime);
     }
 
+    replicateResponse.SerializedItems = page->Items;
+    replicateResponse.SerializedItemCount = page->ItemCount;
     replicateResponse.ChangeNumberGlobal = throttleItr->second.Global;
-    replicateResponse.ChangeNumberCursor = throttleItr->second.Cursor = !replicateResponse.Items.empty() ? replicateResponse.Items.back().AuctionID : 0;
-    replicateResponse.ChangeNumberTombstone = throttleItr->second.Tombstone = !count ? _itemsByAuctionId.rbegin()->first : 0;
+    replicateResponse.ChangeNumberCursor = throttleItr->second.Cursor = page->LastAuctionId;
+    replicateResponse.ChangeNumberTombstone = throttleItr->second.Tombstone = page->IsFull ? _itemsByAuctionId.rbegin()->first : 0;
 }
 
 uint64 AuctionHouseObject::CalculateAuctionHouseCut(uint64 bidAmount) const
@@ -1633,6 +1961,7 @@ bool AuctionHouseObject::BuyCommodity(CharacterDatabaseTransaction trans, Player
 
                 auctionItem->SetCount(auctionItem->GetCount() - remainingQuantity);
                 auctionItem->FSetState(ITEM_CHANGED);
+                OnAuctionChanged(auction);
                 auctionItem->SaveToDB(trans);
                 itemsBatch->AddItem(clonedItem, auction->BuyoutOrUnitPrice);
                 boughtFromAuction += remainingQuantity;
@@ -26,12 +26,22 @@
 #include "ObjectGuid.h"
 #include "Optional.h"
 #include <map>
+#include <memory>
 #include <span>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 class Item;
 class Player;
 class WorldPacket;
+class WorldSession;
+
+namespace Trinity
+{
+template<typename T>
+class Job;
+}
 
 namespace WorldPackets
 {
@@ -187,6 +197,8 @@ struct std::hash<AuctionsBucketKey>
 
 struct AuctionPosting;
 
+using AuctionsBucketNames = std::array<std::wstring, TOTAL_LOCALES>;
+
 struct AuctionsBucketData
 {
     AuctionsBucketKey Key{};
@@ -203,7 +215,7 @@ struct AuctionsBucketData
     uint16 SortLevel = 0;
     uint8 MinBattlePetLevel = 0;
     uint8 MaxBattlePetLevel = 0;
-    std::array<std::wstring, TOTAL_LOCALES> FullName = { };
+    std::shared_ptr<AuctionsBucketNames const> FullName; // shared with snapshots of the bucket index
 
     std::vector<AuctionPosting*> Auctions;
 
@@ -249,6 +261,128 @@ struct AuctionPosting
     class Sorter;
 };
 
+/// Secondary indexes of the buckets of an auction house for browse queries.
+/// Buckets are grouped by item class and subclass and sorted by required level within each group. Every bucket also keeps
+/// a signature of the character pairs in its name for each locale, names can only contain the query if their signature
+/// has all bits of the query signature set - this rejects almost all names without comparing strings.
+class TC_GAME_API AuctionsBucketIndex
+{
+    struct Group;
+
+public:
+    /// State of the index at one point in time. Snapshots are never modified and can be searched from any thread,
+    /// groups are shared between the index and its snapshots until the index changes them.
+    class TC_GAME_API Snapshot
+    {
+    public:
+        // Appends keys of buckets of the requested classes, subclasses, inventory types and level range whose name contains name
+        void Search(LocaleConstant locale, std::wstring_view name, bool exactMatch, uint8 minLevel, uint8 maxLevel,
+            Optional<AuctionSearchClassFilters> const& classFilters, std::vector<AuctionsBucketKey>& result) const;
+
+        uint64 GetEpoch() const { return _epoch; }
+        std::size_t GetSize() const { return _size; }
+
+    private:
+        friend AuctionsBucketIndex;
+
+        static void SearchGroup(Group const* group, LocaleConstant locale, std::wstring_view name, bool exactMatch, uint64 nameSignature,
+            uint8 minLevel, uint8 maxLevel, uint64 inventoryTypeMask, std::vector<AuctionsBucketKey>& result);
+
+        std::array<std::array<std::shared_ptr<Group>, MAX_ITEM_SUBCLASS_TOTAL>, MAX_ITEM_CLASS> _groups;
+        std::shared_ptr<Group> _unclassified;    // classes and subclasses that class filters cannot select
+        std::size_t _size = 0;
+        uint64 _epoch = 0;
+    };
+
+    AuctionsBucketIndex();
+    ~AuctionsBucketIndex();
+
+    AuctionsBucketIndex(AuctionsBucketIndex const&) = delete;
+    AuctionsBucketIndex(AuctionsBucketIndex&&) = delete;
+    AuctionsBucketIndex& operator=(AuctionsBucketIndex const&) = delete;
+    AuctionsBucketIndex& operator=(AuctionsBucketIndex&&) = delete;
+
+    // class, subclass, required level and names of the bucket must not change while it is indexed
+    void Add(AuctionsBucketData const* bucket);
+    // merges the buckets into their groups instead of inserting them one by one
+    void Add(std::span<AuctionsBucketData const* const> buckets);
+    void Remove(AuctionsBucketData const* bucket);
+
+    void Search(LocaleConstant locale, std::wstring_view name, bool exactMatch, uint8 minLevel, uint8 maxLevel,
+        Optional<AuctionSearchClassFilters> const& classFilters, std::vector<AuctionsBucketKey>& result) const
+    {
+        _current.Search(locale, name, exactMatch, minLevel, maxLevel, classFilters, result);
+    }
+
+    std::size_t GetSize() const { return _current.GetSize(); }
+
+    // Returns the current state, a new snapshot is only made when the index changed since the last one
+    std::shared_ptr<Snapshot const> GetSnapshot();
+
+    static uint64 GetNameSignature(std::wstring_view name);
+
+private:
+    struct Group
+    {
+        std::vector<AuctionsBucketKey> Keys;
+        std::vector<uint8> Levels;
+        std::vector<uint8> InventoryTypes;
+        std::vector<std::shared_ptr<AuctionsBucketNames const>> Names;
+        std::array<std::vector<uint64>, TOTAL_LOCALES> NameSignatures;
+    };
+
+    // copies the group first if a snapshot still uses it
+    Group& GetGroupForUpdate(AuctionsBucketData const* bucket);
+    static std::size_t GetGroupIndex(AuctionsBucketData const* bucket);
+
+    Snapshot _current;
+    std::shared_ptr<Snapshot const> _lastSnapshot;
+};
+
+/// Serialized item lists of SMSG_AUCTION_REPLICATE_RESPONSE shared by every player scanning the auction house.
+/// A page covers the auctions following its cursor, it is dropped as soon as one of them changes. Pages older than
+/// MaxAge are built again to refresh the duration left of their auctions.
+class TC_GAME_API AuctionReplicatePageCache
+{
+public:
+    static constexpr Seconds MaxAge = 30s;
+    static constexpr std::size_t MaxPages = 512;
+
+    struct Page
+    {
+        std::vector<uint8> Items;
+        uint32 ItemCount = 0;
+        uint32 LastAuctionId = 0;
+        bool IsFull = false;    // auctions after LastAuctionId are not part of the page
+        TimePoint BuildTime;
+    };
+
+    Page const* Find(uint32 cursor, uint32 count, TimePoint now) const;
+    Page const& Store(uint32 cursor, uint32 count, Page page, TimePoint now);
+
+    // Drops the pages containing auctionId, or that would contain it if they were requested again
+    void Invalidate(uint32 auctionId);
+
+    std::size_t GetSize() const { return _pages.size(); }
+
+private:
+    std::map<std::pair<uint32, uint32>, Page> _pages; // by cursor and count
+};
+
+// Parameters of a browse query, kept by the query while it waits for the job system
+struct AuctionBrowseQuery
+{
+    std::wstring Name;
+    uint8 MinLevel = 0;
+    uint8 MaxLevel = 0;
+    EnumFlag<AuctionHouseFilterMask> Filters = AuctionHouseFilterMask::None;
+    Optional<AuctionSearchClassFilters> ClassFilters;
+    std::vector<uint8> KnownPetBits;
+    uint8 MaxKnownPetLevel = 0;
+    uint32 Offset = 0;
+    std::vector<WorldPackets::AuctionHouse::AuctionSortDef> Sorts;
+};
+
 struct CommodityQuote
 {
     uint64 TotalPrice = 0;
@@ -292,6 +426,9 @@ public:
 
     void AddAuction(CharacterDatabaseTransaction trans, AuctionPosting auction);
 
+    // Adds many auctions at once, they are saved with multi-row statements and their new buckets are indexed in one pass
+    void AddAuctions(CharacterDatabaseTransaction trans, std::vector<AuctionPosting> auctions);
+
     std::map<uint32, AuctionPosting>::node_type RemoveAuction(CharacterDatabaseTransaction trans, AuctionPosting* auction,
         std::map<uint32, AuctionPosting>::iterator* auctionItr = nullptr);
 
@@ -304,6 +441,8 @@ public:
     void BuildListBuckets(WorldPackets::AuctionHouse::AuctionListBucketsResult& listBucketsResult, Player const* player,
         std::span<WorldPackets::AuctionHouse::AuctionBucketKey const> keys,
         std::span<WorldPackets::AuctionHouse::AuctionSortDef const> sorts) const;
+    // Searches a snapshot of the bucket index on the job system, the result is built and sent on the world thread
+    void QueueListBuckets(WorldSession* session, AuctionBrowseQuery query, uint32 desiredDelay);
     void BuildListBiddedItems(WorldPackets::AuctionHouse::AuctionListBiddedItemsResult& listBiddedItemsResult, Player const* player,
         uint32 offset, std::span<WorldPackets::AuctionHouse::AuctionSortDef const> sorts) const;
     void BuildListAuctionItems(WorldPackets::AuctionHouse::AuctionListItemsResult& listItemsResult, Player const* player, AuctionsBucketKey const& bucketKey,
@@ -315,6 +454,9 @@ public:
     void BuildReplicate(WorldPackets::AuctionHouse::AuctionReplicateResponse& replicateResponse, Player* player,
         uint32 global, uint32 cursor, uint32 tombstone, uint32 count);
 
+    // Must be called after changing what players see of an auction (bids, item count, end time), adding and removing auctions is handled by the auction house
+    void OnAuctionChanged(AuctionPosting const* auction) { _replicatePages.Invalidate(auction->Id); }
+
     uint64 CalculateAuctionHouseCut(uint64 bidAmount) const;
 
     CommodityQuote const* CreateCommodityQuote(Player const* player, uint32 itemId, uint32 quantity);
@@ -330,11 +472,22 @@ public:
     void SendAuctionInvoice(AuctionPosting const* auction, Player* owner, CharacterDatabaseTransaction trans) const;
 
 private:
+    void AddAuctionRows(AuctionPosting const& auction, CharacterDatabasePreparedStatement*& auctionStmt, CharacterDatabasePreparedStatement*& itemsStmt) const;
+    // new buckets are indexed right away unless they are collected in newBuckets
+    AuctionPosting* InsertAuction(AuctionPosting auction, std::vector<AuctionsBucketData const*>* newBuckets);
+
+    void BuildListBuckets(WorldPackets::AuctionHouse::AuctionListBucketsResult& listBucketsResult, Player const* player,
+        std::span<AuctionsBucketKey const> candidates, EnumFlag<AuctionHouseFilterMask> filters, std::span<uint8 const> knownPetBits, uint8 maxKnownPetLevel,
+        uint32 offset, std::span<WorldPackets::AuctionHouse::AuctionSortDef const> sorts) const;
+    Trinity::Job<void> ListBucketsJob(std::shared_ptr<AuctionsBucketIndex::Snapshot const> snapshot, uint32 accountId, ObjectGuid playerGuid,
+        LocaleConstant locale, AuctionBrowseQuery query, uint32 desiredDelay);
+
     AuctionHouseEntry const* _auctionHouse;
 
     std::map<uint32, AuctionPosting> _itemsByAuctionId; // ordered for replicate
     std::unordered_map<uint32, AuctionPosting> _soldItemsById;
     std::map<AuctionsBucketKey, AuctionsBucketData> _buckets; // ordered for search by itemid only
+    AuctionsBucketIndex _bucketIndex;
     std::unordered_map<ObjectGuid, CommodityQuote> _commodityQuotes;
 
     std::unordered_multimap<ObjectGuid, uint32> _playerOwnedAuctions;
@@ -343,6 +496,7 @@ private:
     // Map of throttled players for GetAll, and throttle expiry time
     // Stored here, rather than player object to maintain persistence after logout
     std::unordered_map<ObjectGuid, PlayerReplicateThrottleData> _replicateThrottleMap;
+    AuctionReplicatePageCache _replicatePages;
 };
 
 class TC_GAME_API AuctionHouseMgr
@@ -442,6 +442,7 @@ void AuctionBotBuyer::PlaceBidToEntry(AuctionPosting* auction, AuctionHouseObjec
     // Set bot as bidder and set new bid amount
     auction->Bidder = newBidder;
     auction->BidAmount = bidPrice;
+    auctionHouse->OnAuctionChanged(auction);
     auction->ServerFlags &= ~AuctionPostingServerFlag::GmLogBuyer;
 
     // Update auction to DB
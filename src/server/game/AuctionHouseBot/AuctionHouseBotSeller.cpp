@@ -831,7 +831,8 @@ void AuctionBotSeller::AddNewAuctions(SellerConfiguration& config)
     AllItemsArray allItems;
     // Main loop
     // getRandomArray will give what categories of items should be added (return true if there is at least 1 items missed)
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    // the whole refill is posted at once, one insert per table and one index update per item class
+    std::vector<AuctionPosting> auctions;
     while (GetItemsToSell(config, itemsToSell, allItems) && items > 0)
     {
         --items;
@@ -862,7 +863,7 @@ void AuctionBotSeller::AddNewAuctions(SellerConfiguration& config)
         if (!item)
         {
             TC_LOG_ERROR("ahbot", "AHBot: Item::CreateItem() returned NULL for item {} (stack: {})", itemId, stackCount);
-            return;
+            break;
         }
 
         // Update the just created item so that if it needs random properties it has them.
@@ -902,11 +903,17 @@ void AuctionBotSeller::AddNewAuctions(SellerConfiguration& config)
         auction.StartTime = GameTime::GetSystemTime();
         auction.EndTime = auction.StartTime + Hours(urand(config.GetMinTime(), config.GetMaxTime()));
 
-        auctionHouse->AddAuction(trans, std::move(auction));
+        auctions.push_back(std::move(auction));
 
         ++count;
     }
-    CharacterDatabase.CommitTransaction(trans);
+
+    if (!auctions.empty())
+    {
+        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        auctionHouse->AddAuctions(trans, std::move(auctions));
+        CharacterDatabase.CommitTransaction(trans);
+    }
 
     TC_LOG_DEBUG("ahbot", "AHBot: Added {} items to auction", count);
 }
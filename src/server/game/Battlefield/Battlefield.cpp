@@ -214,16 +214,18 @@ void Battlefield::InvitePlayersInZoneToWar()
 {
     for (uint8 team = 0; team < PVP_TEAMS_COUNT; ++team)
     {
+        // runs every second during the battle, most players of the zone are already in it
         for (auto itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
         {
+            if (m_PlayersInWar[team].contains(*itr) || m_InvitedPlayers[team].contains(*itr))
+                continue;
+
             if (Player* player = ObjectAccessor::FindPlayer(*itr))
             {
-                if (m_PlayersInWar[player->GetTeamId()].count(player->GetGUID()) || m_InvitedPlayers[player->GetTeamId()].count(player->GetGUID()))
-                    continue;
-                if (m_PlayersInWar[player->GetTeamId()].size() + m_InvitedPlayers[player->GetTeamId()].size() < m_MaxPlayer)
+                if (m_PlayersInWar[team].size() + m_InvitedPlayers[team].size() < m_MaxPlayer)
                     InvitePlayerToWar(player);
                 else // Battlefield is full of players
-                    m_PlayersWillBeKick[player->GetTeamId()][player->GetGUID()] = GameTime::GetGameTime() + 10;
+                    m_PlayersWillBeKick[team][player->GetGUID()] = GameTime::GetGameTime() + 10;
             }
         }
     }
@@ -59,6 +59,9 @@ BattlegroundQueue::~BattlegroundQueue()
             for (GroupsQueueType::iterator itr = m_QueuedGroups[i][j].begin(); itr!= m_QueuedGroups[i][j].end(); ++itr)
                 delete (*itr);
         }
+
+        for (GroupQueueInfo* ginfo : m_InvitedGroups[i])
+            delete ginfo;
     }
 }
 
@@ -188,7 +191,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player const* leader, Group const* g
 
     //add GroupInfo to m_QueuedGroups
     {
-        m_QueuedGroups[bracketId][index].push_back(ginfo);
+        QueueGroup(ginfo, bracketId, index);
 
         //announce to world, this code needs mutex
         if (!m_queueId.Rated && !isPremade && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
@@ -228,6 +231,31 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player const* leader, Group const* g
     return ginfo;
 }
 
+// puts the group at the end (or front) of the queue of its type, rated groups are also indexed by their matchmaker rating
+void BattlegroundQueue::QueueGroup(GroupQueueInfo* ginfo, BattlegroundBracketId bracket_id, uint8 queueType, bool front /*= false*/)
+{
+    GroupsQueueType& queue = m_QueuedGroups[bracket_id][queueType];
+    ginfo->BracketId = bracket_id;
+    ginfo->QueueType = queueType;
+    ginfo->QueuedGroupsItr = queue.insert(front ? queue.begin() : queue.end(), ginfo);
+    if (m_queueId.Rated && queueType < BG_QUEUE_NORMAL_ALLIANCE)
+        ginfo->RatedGroupsItr = m_RatedGroups[bracket_id][queueType].emplace(ginfo->ArenaMatchmakerRating, ginfo);
+}
+
+// takes the group out of the queue it waits in, or out of the invited groups
+void BattlegroundQueue::UnqueueGroup(GroupQueueInfo* ginfo)
+{
+    if (ginfo->QueueType == BG_QUEUE_GROUP_TYPES_COUNT)
+    {
+        m_InvitedGroups[ginfo->BracketId].erase(ginfo->QueuedGroupsItr);
+        return;
+    }
+
+    m_QueuedGroups[ginfo->BracketId][ginfo->QueueType].erase(ginfo->QueuedGroupsItr);
+    if (m_queueId.Rated && ginfo->QueueType < BG_QUEUE_NORMAL_ALLIANCE)
+        m_RatedGroups[ginfo->BracketId][ginfo->QueueType].erase(ginfo->RatedGroupsItr);
+}
+
 void BattlegroundQueue::PlayerInvitedToBGUpdateAverageWaitTime(GroupQueueInfo* ginfo, BattlegroundBracketId bracket_id)
 {
     uint32 timeInQueue = getMSTimeDiff(ginfo->JoinTime, GameTime::GetGameTimeMS());
@@ -280,7 +308,6 @@ uint32 BattlegroundQueue::GetAverageQueueWaitTime(GroupQueueInfo* ginfo, Battleg
 //remove player from queue and from group info, if group info is empty then remove it too
 void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
 {
-    int32 bracket_id = -1;                                     // signed for proper for-loop finish
     QueuedPlayersMap::iterator itr;
 
     //remove player from map, if he's there
@@ -296,40 +323,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     }
 
     GroupQueueInfo* group = itr->second.GroupInfo;
-    GroupsQueueType::iterator group_itr;
-    // mostly people with the highest levels are in battlegrounds, thats why
-    // we count from MAX_BATTLEGROUND_QUEUES - 1 to 0
-
-    uint32 index = (group->Team == HORDE) ? BG_QUEUE_PREMADE_HORDE : BG_QUEUE_PREMADE_ALLIANCE;
-
-    for (int32 bracket_id_tmp = MAX_BATTLEGROUND_BRACKETS - 1; bracket_id_tmp >= 0 && bracket_id == -1; --bracket_id_tmp)
-    {
-        //we must check premade and normal team's queue - because when players from premade are joining bg,
-        //they leave groupinfo so we can't use its players size to find out index
-        for (uint32 j = index; j < BG_QUEUE_GROUP_TYPES_COUNT; j += PVP_TEAMS_COUNT)
-        {
-            GroupsQueueType::iterator k = m_QueuedGroups[bracket_id_tmp][j].begin();
-            for (; k != m_QueuedGroups[bracket_id_tmp][j].end(); ++k)
-            {
-                if ((*k) == group)
-                {
-                    bracket_id = bracket_id_tmp;
-                    group_itr = k;
-                    //we must store index to be able to erase iterator
-                    index = j;
-                    break;
-                }
-            }
-        }
-    }
-
-    //player can't be in queue without group, but just in case
-    if (bracket_id == -1)
-    {
-        TC_LOG_ERROR("bg.battleground", "BattlegroundQueue: ERROR Cannot find groupinfo for {}", guid.ToString());
-        return;
-    }
-    TC_LOG_DEBUG("bg.battleground", "BattlegroundQueue: Removing {}, from bracket_id {}", guid.ToString(), (uint32)bracket_id);
+    TC_LOG_DEBUG("bg.battleground", "BattlegroundQueue: Removing {}, from bracket_id {}", guid.ToString(), (uint32)group->BracketId);
 
     // ALL variables are correctly set
     // We can ignore leveling up in queue - it should not cause crash
@@ -371,7 +365,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info if needed
     if (group->Players.empty())
     {
-        m_QueuedGroups[bracket_id][index].erase(group_itr);
+        UnqueueGroup(group);
         delete group;
         return;
     }
@@ -439,6 +433,11 @@ bool BattlegroundQueue::InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg,
 
         ginfo->RemoveInviteTime = GameTime::GetGameTimeMS() + INVITE_ACCEPT_WAIT_TIME;
 
+        // invited groups wait for their players outside of the queues, they are not matched again
+        UnqueueGroup(ginfo);
+        ginfo->QueueType = BG_QUEUE_GROUP_TYPES_COUNT;
+        ginfo->QueuedGroupsItr = m_InvitedGroups[ginfo->BracketId].insert(m_InvitedGroups[ginfo->BracketId].end(), ginfo);
+
         // loop through the players
         for (std::map<ObjectGuid, PlayerQueueInfo*>::iterator itr = ginfo->Players.begin(); itr != ginfo->Players.end(); ++itr)
         {
@@ -594,51 +593,37 @@ bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id, uint
     //check match
     if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty() && !m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
     {
-        //start premade match
-        //if groups aren't invited
-        GroupsQueueType::const_iterator ali_group, horde_group;
-        for (ali_group = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].begin(); ali_group != m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].end(); ++ali_group)
-            if (!(*ali_group)->IsInvitedToBGInstanceGUID)
-                break;
-        for (horde_group = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].begin(); horde_group != m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].end(); ++horde_group)
-            if (!(*horde_group)->IsInvitedToBGInstanceGUID)
-                break;
-
-        if (ali_group != m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].end() && horde_group != m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].end())
+        //start premade match, queues only hold groups that aren't invited yet
+        m_SelectionPools[TEAM_ALLIANCE].AddGroup(m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].front(), MaxPlayersPerTeam);
+        m_SelectionPools[TEAM_HORDE].AddGroup(m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].front(), MaxPlayersPerTeam);
+        //add groups/players from normal queue to size of bigger group
+        uint32 maxPlayers = std::min(m_SelectionPools[TEAM_ALLIANCE].GetPlayerCount(), m_SelectionPools[TEAM_HORDE].GetPlayerCount());
+        GroupsQueueType::const_iterator itr;
+        for (uint32 i = 0; i < PVP_TEAMS_COUNT; i++)
         {
-            m_SelectionPools[TEAM_ALLIANCE].AddGroup((*ali_group), MaxPlayersPerTeam);
-            m_SelectionPools[TEAM_HORDE].AddGroup((*horde_group), MaxPlayersPerTeam);
-            //add groups/players from normal queue to size of bigger group
-            uint32 maxPlayers = std::min(m_SelectionPools[TEAM_ALLIANCE].GetPlayerCount(), m_SelectionPools[TEAM_HORDE].GetPlayerCount());
-            GroupsQueueType::const_iterator itr;
-            for (uint32 i = 0; i < PVP_TEAMS_COUNT; i++)
+            for (itr = m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].begin(); itr != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].end(); ++itr)
             {
-                for (itr = m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].begin(); itr != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].end(); ++itr)
-                {
-                    //if itr can join BG and player count is less that maxPlayers, then add group to selectionpool
-                    if (!(*itr)->IsInvitedToBGInstanceGUID && !m_SelectionPools[i].AddGroup((*itr), maxPlayers))
-                        break;
-                }
+                //if player count is less that maxPlayers, then add group to selectionpool
+                if (!m_SelectionPools[i].AddGroup((*itr), maxPlayers))
+                    break;
             }
-            //premade selection pools are set
-            return true;
         }
+        //premade selection pools are set
+        return true;
     }
     // now check if we can move group from Premade queue to normal queue (timer has expired) or group size lowered!!
-    // this could be 2 cycles but i'm checking only first team in queue - it can cause problem -
-    // if first is invited to BG and seconds timer expired, but we can ignore it, because players have only 80 seconds to click to enter bg
-    // and when they click or after 80 seconds the queue info is removed from queue
+    // this could be 2 cycles but i'm checking only first team in queue, the one that waits longest
     uint32 time_before = GameTime::GetGameTimeMS() - sWorld->getIntConfig(CONFIG_BATTLEGROUND_PREMADE_GROUP_WAIT_FOR_MATCH);
     for (uint32 i = 0; i < PVP_TEAMS_COUNT; i++)
     {
         if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].empty())
         {
-            GroupsQueueType::iterator itr = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].begin();
-            if (!(*itr)->IsInvitedToBGInstanceGUID && ((*itr)->JoinTime < time_before || (*itr)->Players.size() < MinPlayersPerTeam))
+            GroupQueueInfo* ginfo = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].front();
+            if (ginfo->JoinTime < time_before || ginfo->Players.size() < MinPlayersPerTeam)
             {
                 //we must insert group to normal queue and erase pointer from premade queue
-                m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].push_front((*itr));
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].erase(itr);
+                UnqueueGroup(ginfo);
+                QueueGroup(ginfo, bracket_id, BG_QUEUE_NORMAL_ALLIANCE + i, true);
             }
         }
     }
@@ -655,12 +640,9 @@ bool BattlegroundQueue::CheckNormalMatch(BattlegroundBracketId bracket_id, uint3
         itr_team[i] = m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].begin();
         for (; itr_team[i] != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].end(); ++(itr_team[i]))
         {
-            if (!(*(itr_team[i]))->IsInvitedToBGInstanceGUID)
-            {
-                m_SelectionPools[i].AddGroup(*(itr_team[i]), maxPlayers);
-                if (m_SelectionPools[i].GetPlayerCount() >= minPlayers)
-                    break;
-            }
+            m_SelectionPools[i].AddGroup(*(itr_team[i]), maxPlayers);
+            if (m_SelectionPools[i].GetPlayerCount() >= minPlayers)
+                break;
         }
     }
     //try to invite same number of players - this cycle may cause longer wait time even if there are enough players in queue, but we want ballanced bg
@@ -674,9 +656,8 @@ bool BattlegroundQueue::CheckNormalMatch(BattlegroundBracketId bracket_id, uint3
         ++(itr_team[j]);                                         //this will not cause a crash, because for cycle above reached break;
         for (; itr_team[j] != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + j].end(); ++(itr_team[j]))
         {
-            if (!(*(itr_team[j]))->IsInvitedToBGInstanceGUID)
-                if (!m_SelectionPools[j].AddGroup(*(itr_team[j]), m_SelectionPools[(j + 1) % PVP_TEAMS_COUNT].GetPlayerCount()))
-                    break;
+            if (!m_SelectionPools[j].AddGroup(*(itr_team[j]), m_SelectionPools[(j + 1) % PVP_TEAMS_COUNT].GetPlayerCount()))
+                break;
         }
         // do not allow to start bg with more than 2 players more on 1 faction
         if (abs((int32)(m_SelectionPools[TEAM_HORDE].GetPlayerCount() - m_SelectionPools[TEAM_ALLIANCE].GetPlayerCount())) > 2)
@@ -707,20 +688,15 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
     m_SelectionPools[otherTeam].Init();
     //store last ginfo pointer
     GroupQueueInfo* ginfo = m_SelectionPools[teamIndex].SelectedGroups.back();
-    //set itr_team to group that was added to selection pool latest
-    GroupsQueueType::iterator itr_team = m_QueuedGroups[bracket_id][uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].begin();
-    for (; itr_team != m_QueuedGroups[bracket_id][uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].end(); ++itr_team)
-        if (ginfo == *itr_team)
-            break;
-    if (itr_team == m_QueuedGroups[bracket_id][uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].end())
+    if (ginfo->QueueType != uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex))
         return false;
-    GroupsQueueType::iterator itr_team2 = itr_team;
-    ++itr_team2;
+    //start after the group that was added to selection pool latest
+    GroupsQueueType::iterator itr_team2 = std::next(ginfo->QueuedGroupsItr);
     //invite players to other selection pool
     for (; itr_team2 != m_QueuedGroups[bracket_id][uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].end(); ++itr_team2)
     {
         //if selection pool is full then break;
-        if (!(*itr_team2)->IsInvitedToBGInstanceGUID && !m_SelectionPools[otherTeam].AddGroup(*itr_team2, minPlayersPerTeam))
+        if (!m_SelectionPools[otherTeam].AddGroup(*itr_team2, minPlayersPerTeam))
             break;
     }
     if (m_SelectionPools[otherTeam].GetPlayerCount() != minPlayersPerTeam)
@@ -731,19 +707,9 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
     {
         //set correct team
         (*itr)->Team = otherTeamId;
-        //add team to other queue
-        m_QueuedGroups[bracket_id][uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(otherTeam)].push_front(*itr);
-        //remove team from old queue
-        GroupsQueueType::iterator itr2 = itr_team;
-        ++itr2;
-        for (; itr2 != m_QueuedGroups[bracket_id][uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].end(); ++itr2)
-        {
-            if (*itr2 == *itr)
-            {
-                m_QueuedGroups[bracket_id][uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].erase(itr2);
-                break;
-            }
-        }
+        //move team from old queue to other queue
+        UnqueueGroup(*itr);
+        QueueGroup(*itr, bracket_id, uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(otherTeam), true);
     }
     return true;
 }
@@ -910,55 +876,33 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundBra
         int32 discardTime = GameTime::GetGameTimeMS() - sBattlegroundMgr->GetRatingDiscardTimer();
 
         // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[PVP_TEAMS_COUNT];
+        GroupQueueInfo* teams[PVP_TEAMS_COUNT] = { };
         uint8 found = 0;
         uint8 team = 0;
 
         for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
         {
             // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
+            if (GroupQueueInfo* ginfo = SelectRatedGroup(bracket_id, i, arenaMinRating, arenaMaxRating, discardTime, nullptr))
             {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
+                teams[found++] = ginfo;
+                team = i;
             }
         }
 
         if (!found)
             return;
 
+        // disable this check to allow arena queue without other team
         if (found == 1)
-        {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
-            {
-
-                // disable this check to allow arena queue without other team
-                if (itr3 == itr_teams[0])
-                    continue; // skip already found team
-
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr3)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
-        }
+            if (GroupQueueInfo* ginfo = SelectRatedGroup(bracket_id, team, arenaMinRating, arenaMaxRating, discardTime, teams[0]))
+                teams[found++] = ginfo;
 
         //if we have 2 teams, then start new arena and invite players!
         if (found == 2)
         {
-            GroupQueueInfo* aTeam = *itr_teams[TEAM_ALLIANCE];
-            GroupQueueInfo* hTeam = *itr_teams[TEAM_HORDE];
+            GroupQueueInfo* aTeam = teams[TEAM_ALLIANCE];
+            GroupQueueInfo* hTeam = teams[TEAM_HORDE];
             Battleground* arena = sBattlegroundMgr->CreateNewBattleground(m_queueId, bracket_id);
             if (!arena)
             {
@@ -973,18 +917,7 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundBra
             TC_LOG_DEBUG("bg.battleground", "setting oposite teamrating for to {}", aTeam->OpponentsTeamRating);
             TC_LOG_DEBUG("bg.battleground", "setting oposite teamrating for to {}", hTeam->OpponentsTeamRating);
 
-            // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-            if (aTeam->Team != ALLIANCE)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
-            }
-            if (hTeam->Team != HORDE)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
-            }
-
+            // teams don't need to be moved to the queue of their new faction, InviteGroupToBG takes them out of the queues
             arena->SetArenaMatchmakerRating(ALLIANCE, aTeam->ArenaMatchmakerRating);
             arena->SetArenaMatchmakerRating(   HORDE, hTeam->ArenaMatchmakerRating);
             InviteGroupToBG(aTeam, arena, ALLIANCE);
@@ -996,6 +929,29 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundBra
     }
 }
 
+// returns the rated group that joined first among the ones with matching rating or that wait longer than the rating discard time
+GroupQueueInfo* BattlegroundQueue::SelectRatedGroup(BattlegroundBracketId bracket_id, uint8 queueType, uint32 minRating, uint32 maxRating, int32 discardTime, GroupQueueInfo const* skip) const
+{
+    // queues are in join order, if the group waiting longest didn't wait long enough to discard ratings none did
+    for (GroupQueueInfo* ginfo : m_QueuedGroups[bracket_id][queueType])
+    {
+        if (ginfo == skip)
+            continue;
+        if ((int32)ginfo->JoinTime < discardTime)
+            return ginfo;
+        break;
+    }
+
+    // only the groups in rating range are looked at, not the whole queue
+    GroupQueueInfo* selected = nullptr;
+    GroupsRatingIndexType const& ratedGroups = m_RatedGroups[bracket_id][queueType];
+    for (GroupsRatingIndexType::const_iterator itr = ratedGroups.lower_bound(minRating); itr != ratedGroups.end() && itr->first <= maxRating; ++itr)
+        if (itr->second != skip && (!selected || itr->second->JoinTime < selected->JoinTime))
+            selected = itr->second;
+
+    return selected;
+}
+
 /*********************************************************/
 /***            BATTLEGROUND QUEUE EVENTS              ***/
 /*********************************************************/
@@ -22,6 +22,8 @@
 #include "DBCEnums.h"
 #include "Battleground.h"
 #include "EventProcessor.h"
+#include <list>
+#include <map>
 
 //this container can't be deque, because deque doesn't like removing the last element - if you remove it, it invalidates next iterator and crash appears
 typedef std::list<Battleground*> BGFreeSlotQueueContainer;
@@ -46,6 +48,10 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  ArenaMatchmakerRating;                          // if rated match, inited to the rating of the team
     uint32  OpponentsTeamRating;                            // for rated arena matches
     uint32  OpponentsMatchmakerRating;                      // for rated arena matches
+    BattlegroundBracketId BracketId;                        // bracket the group is queued in
+    uint8   QueueType;                                      // BattlegroundQueueGroupTypes it waits in, BG_QUEUE_GROUP_TYPES_COUNT once invited
+    std::list<GroupQueueInfo*>::iterator QueuedGroupsItr;   // position in m_QueuedGroups, or in m_InvitedGroups once invited
+    std::multimap<uint32, GroupQueueInfo*>::iterator RatedGroupsItr; // position in m_RatedGroups, for rated groups waiting for invitation
 };
 
 enum BattlegroundQueueGroupTypes
@@ -90,10 +96,12 @@ class TC_GAME_API BattlegroundQueue
 
         //do NOT use deque because deque.erase() invalidates ALL iterators
         typedef std::list<GroupQueueInfo*> GroupsQueueType;
+        // rated groups by matchmaker rating, groups with the same rating in join order
+        typedef std::multimap<uint32, GroupQueueInfo*> GroupsRatingIndexType;
 
         /*
-        This two dimensional array is used to store All queued groups
-        First dimension specifies the bgTypeId
+        This two dimensional array is used to store queued groups waiting for an invitation, in join order
+        First dimension specifies the bracket
         Second dimension specifies the player's group types -
              BG_QUEUE_PREMADE_ALLIANCE  is used for premade alliance groups and alliance rated arena teams
              BG_QUEUE_PREMADE_HORDE     is used for premade horde groups and horde rated arena teams
@@ -101,6 +109,10 @@ class TC_GAME_API BattlegroundQueue
              BG_QUEUE_NORMAL_HORDE      is used for normal (or small) horde groups or non-rated arena matches
         */
         GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT];
+        // invited groups stay in queue until all their players entered the battleground or declined, they are not matched again
+        GroupsQueueType m_InvitedGroups[MAX_BATTLEGROUND_BRACKETS];
+        // rated groups of m_QueuedGroups premade queues by matchmaker rating, only used for rated queues
+        GroupsRatingIndexType m_RatedGroups[MAX_BATTLEGROUND_BRACKETS][PVP_TEAMS_COUNT];
 
         // class to select and invite groups to bg
         class SelectionPool
@@ -127,6 +139,9 @@ class TC_GAME_API BattlegroundQueue
         BattlegroundQueueTypeId m_queueId;
 
         bool InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, Team side);
+        void QueueGroup(GroupQueueInfo* ginfo, BattlegroundBracketId bracket_id, uint8 queueType, bool front = false);
+        void UnqueueGroup(GroupQueueInfo* ginfo);
+        GroupQueueInfo* SelectRatedGroup(BattlegroundBracketId bracket_id, uint8 queueType, uint32 minRating, uint32 maxRating, int32 discardTime, GroupQueueInfo const* skip) const;
         uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
         uint32 m_WaitTimeLastPlayer[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
         uint32 m_SumOfWaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
@@ -17,6 +17,8 @@
 
 #include "CharacterCache.h"
 #include "ArenaTeam.h"
+#include "CaseFoldedName.h"
+#include "CharacterEnumCache.h"
 #include "DatabaseEnv.h"
 #include "Log.h"
 #include "MiscPackets.h"
@@ -28,7 +30,8 @@
 namespace
 {
     std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    // found by any spelling of the name, callers don't need to normalize it first
+    Trinity::CaseFoldedNameMap<CharacterCacheEntry*> _characterCacheByNameStore;
 }
 
 CharacterCache::CharacterCache()
@@ -113,6 +116,10 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accou
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
+    auto itr = _characterCacheStore.find(guid);
+    if (itr != _characterCacheStore.end())
+        sCharacterEnumCache->Invalidate(itr->second.AccountId);
+
     _characterCacheStore.erase(guid);
     _characterCacheByNameStore.erase(name);
 }
@@ -132,6 +139,8 @@ void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string con
     if (race)
         itr->second.Race = *race;
 
+    sCharacterEnumCache->Invalidate(itr->second.AccountId);
+
     WorldPackets::Misc::InvalidatePlayer invalidatePlayer;
     invalidatePlayer.Guid = guid;
     sWorld->SendGlobalMessage(invalidatePlayer.Write());
@@ -165,6 +174,8 @@ void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 acc
     if (itr == _characterCacheStore.end())
         return;
 
+    sCharacterEnumCache->Invalidate(itr->second.AccountId);
+    sCharacterEnumCache->Invalidate(accountId);
     itr->second.AccountId = accountId;
 }
 
@@ -200,6 +211,8 @@ void CharacterCache::UpdateCharacterInfoDeleted(ObjectGuid const& guid, bool del
 
     itr->second.Name = name;
     itr->second.IsDeleted = deleted;
+
+    sCharacterEnumCache->Invalidate(itr->second.AccountId);
 }
 
 /*
@@ -219,7 +232,7 @@ CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid co
     return nullptr;
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
+CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string_view name) const
 {
     auto itr = _characterCacheByNameStore.find(name);
     if (itr != _characterCacheByNameStore.end())
@@ -228,7 +241,7 @@ CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string c
     return nullptr;
 }
 
-ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
+ObjectGuid CharacterCache::GetCharacterGuidByName(std::string_view name) const
 {
     auto itr = _characterCacheByNameStore.find(name);
     if (itr != _characterCacheByNameStore.end())
@@ -265,7 +278,7 @@ uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
     return itr->second.AccountId;
 }
 
-uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
+uint32 CharacterCache::GetCharacterAccountIdByName(std::string_view name) const
 {
     auto itr = _characterCacheByNameStore.find(name);
     if (itr != _characterCacheByNameStore.end())
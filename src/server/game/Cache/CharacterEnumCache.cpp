@@ -0,0 +1,119 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharacterEnumCache.h"
+#include <algorithm>
+
+namespace
+{
+// writes queued before an invalidation (like the save at logout) are expected to be committed by then
+constexpr Seconds WRITE_SETTLE_TIME = 30s;
+constexpr std::size_t MIN_CLEANUP_SIZE = 64;
+}
+
+CharacterEnumCache::CharacterEnumCache() : _nextCleanupSize(MIN_CLEANUP_SIZE), _duration(0)
+{
+}
+
+CharacterEnumCache::~CharacterEnumCache() = default;
+
+CharacterEnumCache* CharacterEnumCache::instance()
+{
+    static CharacterEnumCache instance;
+    return &instance;
+}
+
+void CharacterEnumCache::SetDuration(Seconds duration)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    _duration = std::max(duration, Seconds::zero());
+    if (!IsEnabled())
+    {
+        _entries.clear();
+        _nextCleanupSize = MIN_CLEANUP_SIZE;
+    }
+}
+
+std::shared_ptr<CharacterEnumCache::Characters const> CharacterEnumCache::Get(uint32 accountId, TimePoint now)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    auto itr = _entries.find(accountId);
+    if (itr == _entries.end() || !itr->second.List)
+        return nullptr;
+
+    if (itr->second.Expires <= now)
+    {
+        itr->second.List.reset();
+        return nullptr;
+    }
+
+    return itr->second.List;
+}
+
+void CharacterEnumCache::Store(uint32 accountId, TimePoint queried, bool writesPending, Characters characters, TimePoint now)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!IsEnabled())
+        return;
+
+    Entry& entry = _entries[accountId];
+    if (entry.Invalidated >= queried)
+        return;
+
+    if (writesPending && queried - entry.Invalidated < WRITE_SETTLE_TIME)
+        return;
+
+    entry.List = std::make_shared<Characters const>(std::move(characters));
+    entry.Expires = now + _duration;
+
+    if (_entries.size() >= _nextCleanupSize)
+        RemoveExpired(now);
+}
+
+void CharacterEnumCache::Invalidate(uint32 accountId, TimePoint now)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!IsEnabled())
+        return;
+
+    Entry& entry = _entries[accountId];
+    entry.List.reset();
+    entry.Invalidated = now;
+
+    if (_entries.size() >= _nextCleanupSize)
+        RemoveExpired(now);
+}
+
+std::size_t CharacterEnumCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return _entries.size();
+}
+
+void CharacterEnumCache::RemoveExpired(TimePoint now)
+{
+    // accounts only need to be remembered while they have characters or recent invalidations
+    std::erase_if(_entries, [&](std::pair<uint32 const, Entry> const& entry)
+    {
+        if (entry.second.List && entry.second.Expires > now)
+            return false;
+
+        return now - entry.second.Invalidated >= WRITE_SETTLE_TIME;
+    });
+
+    _nextCleanupSize = std::max(_entries.size() * 2, MIN_CLEANUP_SIZE);
+}
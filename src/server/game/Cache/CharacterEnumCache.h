@@ -0,0 +1,81 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CharacterEnumCache_h__
+#define CharacterEnumCache_h__
+
+#include "Define.h"
+#include "CharacterPackets.h"
+#include "Duration.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/// Character lists of accounts as sent in SMSG_ENUM_CHARACTERS_RESULT, to answer repeated visits
+/// of the character screen without querying the characters of the account again.
+/// Anything changing a listed character outside of the game (like GM commands editing offline
+/// characters) only shows up once the entry expired.
+class TC_GAME_API CharacterEnumCache
+{
+    public:
+        using Characters = std::vector<WorldPackets::Character::EnumCharactersResult::CharacterInfo>;
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        CharacterEnumCache();
+        CharacterEnumCache(CharacterEnumCache const&) = delete;
+        CharacterEnumCache(CharacterEnumCache&&) = delete;
+        CharacterEnumCache& operator=(CharacterEnumCache const&) = delete;
+        CharacterEnumCache& operator=(CharacterEnumCache&&) = delete;
+        ~CharacterEnumCache();
+        static CharacterEnumCache* instance();
+
+        /// Entries are kept for duration after they were stored (0 disables the cache)
+        void SetDuration(Seconds duration);
+        bool IsEnabled() const { return _duration > Seconds::zero(); }
+
+        std::shared_ptr<Characters const> Get(uint32 accountId, TimePoint now = std::chrono::steady_clock::now());
+
+        /// Stores the characters of an account queried at queried, unless the account was invalidated since.
+        /// writesPending tells that the database still had queued operations when the query was started,
+        /// results of those are only kept once the last invalidation of the account is long enough ago for its writes to be done
+        void Store(uint32 accountId, TimePoint queried, bool writesPending, Characters characters, TimePoint now = std::chrono::steady_clock::now());
+
+        /// Drops the characters of the account, results of queries started before are not stored anymore
+        void Invalidate(uint32 accountId, TimePoint now = std::chrono::steady_clock::now());
+
+        std::size_t GetSize() const;
+
+    private:
+        struct Entry
+        {
+            std::shared_ptr<Characters const> List;
+            TimePoint Expires;
+            TimePoint Invalidated;
+        };
+
+        void RemoveExpired(TimePoint now);
+
+        mutable std::mutex _lock;
+        std::unordered_map<uint32, Entry> _entries;
+        std::size_t _nextCleanupSize;
+        Seconds _duration;
+};
+
+#define sCharacterEnumCache CharacterEnumCache::instance()
+
+#endif // CharacterEnumCache_h__
@@ -94,6 +94,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarEvent* calendarEvent = new CalendarEvent(eventID, ownerGUID, guildID, type, textureID, date, flags, title, description, lockDate);
             _events.insert(calendarEvent);
+            IndexEvent(calendarEvent);
 
             _maxEventId = std::max(_maxEventId, eventID);
 
@@ -122,6 +123,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarInvite* invite = new CalendarInvite(inviteId, eventId, invitee, senderGUID, responseTime, status, rank, note);
             _invites[eventId].push_back(invite);
+            IndexInvite(invite);
 
             _maxInviteId = std::max(_maxInviteId, inviteId);
 
@@ -140,9 +142,58 @@ void CalendarMgr::LoadFromDB()
             _freeInviteIds.push_back(i);
 }
 
+void CalendarMgr::IndexEvent(CalendarEvent* calendarEvent)
+{
+    _eventsById[calendarEvent->GetEventId()] = calendarEvent;
+    _ownerEvents[calendarEvent->GetOwnerGUID()].insert(calendarEvent);
+    if (calendarEvent->GetGuildId())
+        _guildEvents[calendarEvent->GetGuildId()].insert(calendarEvent);
+}
+
+void CalendarMgr::UnindexEvent(CalendarEvent* calendarEvent)
+{
+    _eventsById.erase(calendarEvent->GetEventId());
+
+    auto ownerItr = _ownerEvents.find(calendarEvent->GetOwnerGUID());
+    if (ownerItr != _ownerEvents.end())
+    {
+        ownerItr->second.erase(calendarEvent);
+        if (ownerItr->second.empty())
+            _ownerEvents.erase(ownerItr);
+    }
+
+    auto guildItr = _guildEvents.find(calendarEvent->GetGuildId());
+    if (guildItr != _guildEvents.end())
+    {
+        guildItr->second.erase(calendarEvent);
+        if (guildItr->second.empty())
+            _guildEvents.erase(guildItr);
+    }
+}
+
+void CalendarMgr::IndexInvite(CalendarInvite* invite)
+{
+    _invitesById[invite->GetInviteId()] = invite;
+    _playerInvites[invite->GetInviteeGUID()].push_back(invite);
+}
+
+void CalendarMgr::UnindexInvite(CalendarInvite* invite)
+{
+    _invitesById.erase(invite->GetInviteId());
+
+    auto playerItr = _playerInvites.find(invite->GetInviteeGUID());
+    if (playerItr != _playerInvites.end())
+    {
+        std::erase(playerItr->second, invite);
+        if (playerItr->second.empty())
+            _playerInvites.erase(playerItr);
+    }
+}
+
 void CalendarMgr::AddEvent(CalendarEvent* calendarEvent, CalendarSendEventType sendType)
 {
     _events.insert(calendarEvent);
+    IndexEvent(calendarEvent);
     UpdateEvent(calendarEvent);
     SendCalendarEvent(calendarEvent->GetOwnerGUID(), *calendarEvent, sendType);
 }
@@ -158,6 +209,7 @@ void CalendarMgr::AddInvite(CalendarEvent* calendarEvent, CalendarInvite* invite
     if (!calendarEvent->IsGuildAnnouncement())
     {
         _invites[invite->GetEventId()].push_back(invite);
+        IndexInvite(invite);
         UpdateInvite(invite, trans);
     }
 }
@@ -204,6 +256,7 @@ void CalendarMgr::RemoveEvent(CalendarEvent* calendarEvent, ObjectGuid remover)
             mail.SendMailTo(trans, MailReceiver(invite->GetInviteeGUID().GetCounter()), calendarEvent, MAIL_CHECK_MASK_COPIED);
         }
 
+        UnindexInvite(invite);
         delete invite;
     }
 
@@ -215,6 +268,7 @@ void CalendarMgr::RemoveEvent(CalendarEvent* calendarEvent, ObjectGuid remover)
     CharacterDatabase.CommitTransaction(trans);
 
     _events.erase(calendarEvent);
+    UnindexEvent(calendarEvent);
     delete calendarEvent;
 }
 
@@ -249,6 +303,7 @@ void CalendarMgr::RemoveInvite(uint64 inviteId, uint64 eventId, ObjectGuid /*rem
     //    MailDraft(calendarEvent->BuildCalendarMailSubject(remover), calendarEvent->BuildCalendarMailBody())
     //        .SendMailTo(trans, MailReceiver((*itr)->GetInvitee()), calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+    UnindexInvite(*itr);
     delete *itr;
     _invites[eventId].erase(itr);
 }
@@ -284,13 +339,9 @@ void CalendarMgr::UpdateInvite(CalendarInvite* invite, CharacterDatabaseTransact
 
 void CalendarMgr::RemoveAllPlayerEventsAndInvites(ObjectGuid guid)
 {
-    for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end();)
-    {
-        CalendarEvent* event = *itr;
-        ++itr;
-        if (event->GetOwnerGUID() == guid)
-            RemoveEvent(event, ObjectGuid::Empty); // don't send mail if removing a character
-    }
+    CalendarEventStore playerEvents = GetEventsCreatedBy(guid, true);
+    for (CalendarEvent* event : playerEvents)
+        RemoveEvent(event, ObjectGuid::Empty); // don't send mail if removing a character
 
     CalendarInviteStore playerInvites = GetPlayerInvites(guid);
     for (CalendarInviteStore::const_iterator itr = playerInvites.begin(); itr != playerInvites.end(); ++itr)
@@ -299,9 +350,10 @@ void CalendarMgr::RemoveAllPlayerEventsAndInvites(ObjectGuid guid)
 
 void CalendarMgr::RemovePlayerGuildEventsAndSignups(ObjectGuid guid, ObjectGuid::LowType guildId)
 {
-    for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->GetOwnerGUID() == guid && ((*itr)->IsGuildEvent() || (*itr)->IsGuildAnnouncement()))
-            RemoveEvent((*itr)->GetEventId(), guid);
+    CalendarEventStore playerEvents = GetEventsCreatedBy(guid, true);
+    for (CalendarEvent* event : playerEvents)
+        if (event->IsGuildEvent() || event->IsGuildAnnouncement())
+            RemoveEvent(event, guid);
 
     CalendarInviteStore playerInvites = GetPlayerInvites(guid);
     for (CalendarInviteStore::const_iterator itr = playerInvites.begin(); itr != playerInvites.end(); ++itr)
@@ -312,9 +364,8 @@ void CalendarMgr::RemovePlayerGuildEventsAndSignups(ObjectGuid guid, ObjectGuid:
 
 CalendarEvent* CalendarMgr::GetEvent(uint64 eventId) const
 {
-    for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->GetEventId() == eventId)
-            return *itr;
+    if (CalendarEvent* calendarEvent = Trinity::Containers::MapGetValuePtr(_eventsById, eventId))
+        return calendarEvent;
 
     TC_LOG_DEBUG("calendar", "CalendarMgr::GetEvent: [{}] not found!", eventId);
     return nullptr;
@@ -322,10 +373,8 @@ CalendarEvent* CalendarMgr::GetEvent(uint64 eventId) const
 
 CalendarInvite* CalendarMgr::GetInvite(uint64 inviteId) const
 {
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteId() == inviteId)
-                return *itr2;
+    if (CalendarInvite* invite = Trinity::Containers::MapGetValuePtr(_invitesById, inviteId))
+        return invite;
 
     TC_LOG_DEBUG("calendar", "CalendarMgr::GetInvite: [{}] not found!", inviteId);
     return nullptr;
@@ -383,9 +432,10 @@ void CalendarMgr::DeleteOldEvents()
 CalendarEventStore CalendarMgr::GetEventsCreatedBy(ObjectGuid guid, bool includeGuildEvents) const
 {
     CalendarEventStore result;
-    for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->GetOwnerGUID() == guid && (includeGuildEvents || (!(*itr)->IsGuildEvent() && !(*itr)->IsGuildAnnouncement())))
-            result.insert(*itr);
+    if (CalendarEventStore const* ownerEvents = Trinity::Containers::MapGetValuePtr(_ownerEvents, guid))
+        for (CalendarEvent* event : *ownerEvents)
+            if (includeGuildEvents || (!event->IsGuildEvent() && !event->IsGuildAnnouncement()))
+                result.insert(event);
 
     return result;
 }
@@ -397,10 +447,10 @@ CalendarEventStore CalendarMgr::GetGuildEvents(ObjectGuid::LowType guildId) cons
     if (!guildId)
         return result;
 
-    for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->IsGuildEvent() || (*itr)->IsGuildAnnouncement())
-            if ((*itr)->GetGuildId() == guildId)
-                result.insert(*itr);
+    if (CalendarEventStore const* guildEvents = Trinity::Containers::MapGetValuePtr(_guildEvents, guildId))
+        for (CalendarEvent* event : *guildEvents)
+            if (event->IsGuildEvent() || event->IsGuildAnnouncement())
+                result.insert(event);
 
     return result;
 }
@@ -409,17 +459,15 @@ CalendarEventStore CalendarMgr::GetPlayerEvents(ObjectGuid guid) const
 {
     CalendarEventStore events;
 
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                if (CalendarEvent* event = GetEvent(itr->first)) // NULL check added as attempt to fix #11512
-                    events.insert(event);
+    if (CalendarInviteStore const* playerInvites = Trinity::Containers::MapGetValuePtr(_playerInvites, guid))
+        for (CalendarInvite const* invite : *playerInvites)
+            if (CalendarEvent* event = GetEvent(invite->GetEventId())) // NULL check added as attempt to fix #11512
+                events.insert(event);
 
     if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
         if (player->GetGuildId())
-            for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-                if ((*itr)->GetGuildId() == player->GetGuildId())
-                    events.insert(*itr);
+            if (CalendarEventStore const* guildEvents = Trinity::Containers::MapGetValuePtr(_guildEvents, player->GetGuildId()))
+                events.insert(guildEvents->begin(), guildEvents->end());
 
     return events;
 }
@@ -436,21 +484,20 @@ CalendarInviteStore CalendarMgr::GetEventInvites(uint64 eventId) const
 CalendarInviteStore CalendarMgr::GetPlayerInvites(ObjectGuid guid) const
 {
     CalendarInviteStore invites;
-
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                invites.push_back(*itr2);
+    if (CalendarInviteStore const* playerInvites = Trinity::Containers::MapGetValuePtr(_playerInvites, guid))
+        invites = *playerInvites;
 
     return invites;
 }
 
-uint32 CalendarMgr::GetPlayerNumPending(ObjectGuid guid)
+uint32 CalendarMgr::GetPlayerNumPending(ObjectGuid guid) const
 {
-    CalendarInviteStore const& invites = GetPlayerInvites(guid);
+    CalendarInviteStore const* invites = Trinity::Containers::MapGetValuePtr(_playerInvites, guid);
+    if (!invites)
+        return 0;
 
     uint32 pendingNum = 0;
-    for (CalendarInviteStore::const_iterator itr = invites.begin(); itr != invites.end(); ++itr)
+    for (CalendarInviteStore::const_iterator itr = invites->begin(); itr != invites->end(); ++itr)
     {
         switch ((*itr)->GetStatus())
         {
@@ -24,6 +24,7 @@
 #include <deque>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 class Player;
@@ -288,6 +289,18 @@ class TC_GAME_API CalendarMgr
         CalendarEventStore _events;
         CalendarEventInviteStore _invites;
 
+        // kept in sync with _events and _invites, requests of one player don't look at the others
+        std::unordered_map<uint64, CalendarEvent*> _eventsById;
+        std::unordered_map<uint64, CalendarInvite*> _invitesById;
+        std::unordered_map<ObjectGuid, CalendarEventStore> _ownerEvents;
+        std::unordered_map<ObjectGuid::LowType, CalendarEventStore> _guildEvents;
+        std::unordered_map<ObjectGuid, CalendarInviteStore> _playerInvites;
+
+        void IndexEvent(CalendarEvent* calendarEvent);
+        void UnindexEvent(CalendarEvent* calendarEvent);
+        void IndexInvite(CalendarInvite* invite);
+        void UnindexInvite(CalendarInvite* invite);
+
         std::deque<uint64> _freeEventIds;
         std::deque<uint64> _freeInviteIds;
         uint64 _maxEventId;
@@ -322,7 +335,7 @@ class TC_GAME_API CalendarMgr
 
         void DeleteOldEvents();
 
-        uint32 GetPlayerNumPending(ObjectGuid guid);
+        uint32 GetPlayerNumPending(ObjectGuid guid) const;
 
         void AddEvent(CalendarEvent* calendarEvent, CalendarSendEventType sendType);
         void RemoveEvent(uint64 eventId, ObjectGuid remover);
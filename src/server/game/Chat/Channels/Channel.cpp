@@ -33,8 +33,38 @@
 #include "StringConvert.h"
 #include "World.h"
 #include "WorldSession.h"
+#include <array>
 #include <sstream>
 
+namespace
+{
+// same as PlayerSocial::HasIgnore of every member, but only looks at the players that ignore the sender
+class IgnoreFilter
+{
+public:
+    IgnoreFilter(ObjectGuid const& guid, ObjectGuid const& accountGuid)
+    {
+        if (guid.IsEmpty())
+            return;
+
+        _ignoredBy[0] = sSocialMgr->GetIgnoredBy(guid);
+        _ignoredBy[1] = sSocialMgr->GetIgnoredBy(accountGuid);
+    }
+
+    bool IsIgnoring(ObjectGuid const& member) const
+    {
+        for (GuidUnorderedSet const* ignoredBy : _ignoredBy)
+            if (ignoredBy && ignoredBy->contains(member))
+                return true;
+
+        return false;
+    }
+
+private:
+    std::array<GuidUnorderedSet const*, 2> _ignoredBy = { };
+};
+}
+
 Channel::Channel(ObjectGuid const& guid, uint32 channelId, uint32 team /*= 0*/, AreaTableEntry const* zoneEntry /*= nullptr*/) :
     _isDirty(false),
     _nextActivityUpdateTime(0),
@@ -212,6 +242,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
         _nextActivityUpdateTime = 0; // force activity update on next channel tick
 
     PlayerInfo& playerInfo = _playersStore[guid];
+    playerInfo.SetPlayer(player);
     playerInfo.SetInvisible(!player->isGMVisible());
 
     /*
@@ -988,11 +1019,11 @@ template <class Builder>
 void Channel::SendToAll(Builder& builder, ObjectGuid const& guid, ObjectGuid const& accountGuid) const
 {
     Trinity::LocalizedDo<Builder> localizer(builder);
+    IgnoreFilter ignoreFilter(guid, accountGuid);
 
     for (PlayerContainer::value_type const& i : _playersStore)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
-            if (guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid))
-                localizer(player);
+        if (!ignoreFilter.IsIgnoring(i.first))
+            localizer(i.second.GetPlayer());
 }
 
 template <class Builder>
@@ -1002,8 +1033,7 @@ void Channel::SendToAllButOne(Builder& builder, ObjectGuid const& who) const
 
     for (PlayerContainer::value_type const& i : _playersStore)
         if (i.first != who)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
-                localizer(player);
+            localizer(i.second.GetPlayer());
 }
 
 template <class Builder>
@@ -1020,9 +1050,9 @@ void Channel::SendToAllWithAddon(Builder& builder, std::string const& addonPrefi
     ObjectGuid const& accountGuid /*= ObjectGuid::Empty*/) const
 {
     Trinity::LocalizedDo<Builder> localizer(builder);
+    IgnoreFilter ignoreFilter(guid, accountGuid);
 
     for (PlayerContainer::value_type const& i : _playersStore)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i.first))
-            if (player->GetSession()->IsAddonRegistered(addonPrefix) && (guid.IsEmpty() || !player->GetSocial()->HasIgnore(guid, accountGuid)))
-                localizer(player);
+        if (i.second.GetPlayer()->GetSession()->IsAddonRegistered(addonPrefix) && !ignoreFilter.IsIgnoring(i.first))
+            localizer(i.second.GetPlayer());
 }
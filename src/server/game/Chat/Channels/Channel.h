@@ -118,6 +118,10 @@ class TC_GAME_API Channel
     {
         uint8 GetFlags() const { return _flags; }
 
+        // members leave the channel before their player is deleted, see Player::CleanupChannels
+        Player* GetPlayer() const { return _player; }
+        void SetPlayer(Player* player) { _player = player; }
+
         bool IsInvisible() const { return _invisible; }
         void SetInvisible(bool on) { _invisible = on; }
 
@@ -153,6 +157,7 @@ class TC_GAME_API Channel
         }
 
     private:
+        Player* _player = nullptr;
         uint8 _flags = MEMBER_FLAG_NONE;
         bool _invisible = false;
     };
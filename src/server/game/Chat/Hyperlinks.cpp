@@ -27,9 +27,58 @@
 #include "SpellMgr.h"
 #include "StringFormat.h"
 #include "World.h"
+#include <shared_mutex>
+#include <unordered_set>
 
 using namespace Trinity::Hyperlinks;
 
+namespace
+{
+// Trade chat spam repeats the same few links, each of them costs several store lookups and name comparisons to validate
+class ValidatedLinkCache
+{
+public:
+    static constexpr std::size_t MaxSize = 8192;
+
+    bool Contains(std::string_view link, int32 severity) const
+    {
+        std::shared_lock lock(_lock);
+        return _severity == severity && _links.contains(link);
+    }
+
+    void Add(std::string_view link, int32 severity)
+    {
+        std::unique_lock lock(_lock);
+
+        // starting over is cheaper than tracking use, the links currently spammed come back right away
+        if (_severity != severity || _links.size() >= MaxSize)
+        {
+            _links.clear();
+            _severity = severity;
+        }
+
+        _links.emplace(link);
+    }
+
+    void Clear()
+    {
+        std::unique_lock lock(_lock);
+        _links.clear();
+    }
+
+private:
+    struct StringHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view value) const { return std::hash<std::string_view>()(value); }
+    };
+
+    mutable std::shared_mutex _lock;
+    std::unordered_set<std::string, StringHash, std::equal_to<>> _links;
+    int32 _severity = 0;
+} ValidatedLinks;
+}
+
 bool HyperlinkColor::operator==(ItemQualities q) const
 {
     return data.starts_with("IQ") && q < MAX_ITEM_QUALITY && Trinity::StringTo<uint32>(data.substr(2)) == uint32(q);
@@ -880,9 +929,14 @@ static bool ValidateLinkInfo(HyperlinkInfo const& info)
 // Validates all hyperlinks and control sequences contained in str
 bool Trinity::Hyperlinks::CheckAllLinks(std::string_view str)
 {
+    // most messages have no control sequence at all, find (memchr) tells that without looking at every character by itself
+    std::string_view::size_type first = str.find('|');
+    if (first == std::string_view::npos)
+        return true;
+
     // Step 1: Disallow all control sequences except ||, |H, |h, |c, |A, |a and |r
     {
-        std::string_view::size_type pos = 0;
+        std::string_view::size_type pos = first;
         while ((pos = str.find('|', pos)) != std::string::npos)
         {
             ++pos;
@@ -913,9 +967,20 @@ bool Trinity::Hyperlinks::CheckAllLinks(std::string_view str)
             }
 
             HyperlinkInfo info = ParseSingleHyperlink(str.substr(pos));
-            if (!info || !ValidateLinkInfo(info))
+            if (!info)
                 return false;
 
+            // severity decides which checks were made, links validated with another one are checked again
+            std::string_view link = str.substr(pos, info.tail.data() - str.data() - pos);
+            int32 const severity = static_cast<int32>(sWorld->getIntConfig(CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY));
+            if (!ValidatedLinks.Contains(link, severity))
+            {
+                if (!ValidateLinkInfo(info))
+                    return false;
+
+                ValidatedLinks.Add(link, severity);
+            }
+
             // tag is fine, find the next one
             str = info.tail;
         }
@@ -924,3 +989,8 @@ bool Trinity::Hyperlinks::CheckAllLinks(std::string_view str)
     // all tags are valid
     return true;
 }
+
+void Trinity::Hyperlinks::ClearValidatedLinkCache()
+{
+    ValidatedLinks.Clear();
+}
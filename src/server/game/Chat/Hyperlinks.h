@@ -576,6 +576,9 @@ namespace Trinity::Hyperlinks
     HyperlinkInfo TC_GAME_API ParseSingleHyperlink(std::string_view str);
     bool TC_GAME_API CheckAllLinks(std::string_view str);
 
+    // Forgets the links already found valid, needed whenever data they are validated against changes
+    void TC_GAME_API ClearValidatedLinkCache();
+
 }
 
 #endif
@@ -126,7 +126,7 @@ void PvPCombatReference::RefreshTimer()
     _combatTimer = PVP_COMBAT_TIMEOUT;
 }
 
-CombatManager::CombatManager(Unit* owner) : _owner(owner)
+CombatManager::CombatManager(Unit* owner) : _owner(owner), _distantPvECombatPartnersRange(0.0f), _distantPvECombatPartnersValid(false)
 {
 }
 
@@ -138,17 +138,17 @@ CombatManager::~CombatManager()
 
 void CombatManager::Update(uint32 tdiff)
 {
-    auto it = _pvpRefs.begin(), end = _pvpRefs.end();
-    while (it != end)
+    // iteration by index - refs are stored contiguously, EndCombat may call into AI which can add or remove any of them
+    for (std::size_t i = 0; i < _pvpRefs.size();)
     {
-        PvPCombatReference* const ref = it->second;
+        PvPCombatReference* const ref = _pvpRefs.nth(i)->second;
         if (ref->first == _owner && !ref->Update(tdiff)) // only update if we're the first unit involved (otherwise double decrement)
         {
-            it = _pvpRefs.erase(it), end = _pvpRefs.end(); // remove it from our refs first to prevent invalidation
+            _pvpRefs.erase(_pvpRefs.nth(i)); // remove it from our refs first to prevent invalidation
             ref->EndCombat(); // this will remove it from the other side
         }
         else
-            ++it;
+            ++i;
     }
 }
 
@@ -162,7 +162,7 @@ bool CombatManager::HasPvECombat() const
 
 bool CombatManager::HasPvECombatWithPlayers() const
 {
-    for (std::pair<ObjectGuid const, CombatReference*> const& reference : _pveRefs)
+    for (auto const& reference : _pveRefs)
         if (!reference.second->IsSuppressedFor(_owner) && reference.second->GetOther(_owner)->GetTypeId() == TYPEID_PLAYER)
             return true;
 
@@ -269,33 +269,31 @@ void CombatManager::InheritCombatStatesFrom(Unit const* who)
 
 void CombatManager::EndCombatBeyondRange(float range, bool includingPvP)
 {
-    auto it = _pveRefs.begin(), end = _pveRefs.end();
-    while (it != end)
+    for (std::size_t i = 0; i < _pveRefs.size();)
     {
-        CombatReference* const ref = it->second;
+        CombatReference* const ref = _pveRefs.nth(i)->second;
         if (!ref->first->IsWithinDistInMap(ref->second, range))
         {
-            it = _pveRefs.erase(it), end = _pveRefs.end(); // erase manually here to avoid iterator invalidation
+            _pveRefs.erase(_pveRefs.nth(i)); // erase manually here to avoid iterator invalidation
             ref->EndCombat();
         }
         else
-            ++it;
+            ++i;
     }
 
     if (!includingPvP)
         return;
 
-    auto it2 = _pvpRefs.begin(), end2 = _pvpRefs.end();
-    while (it2 != end2)
+    for (std::size_t i = 0; i < _pvpRefs.size();)
     {
-        CombatReference* const ref = it2->second;
+        CombatReference* const ref = _pvpRefs.nth(i)->second;
         if (!ref->first->IsWithinDistInMap(ref->second, range))
         {
-            it2 = _pvpRefs.erase(it2), end2 = _pvpRefs.end(); // erase manually here to avoid iterator invalidation
+            _pvpRefs.erase(_pvpRefs.nth(i)); // erase manually here to avoid iterator invalidation
             ref->EndCombat();
         }
         else
-            ++it2;
+            ++i;
     }
 }
 
@@ -328,30 +326,28 @@ void CombatManager::EndAllPvECombat(UnitFilter* unitFilter /*= nullptr*/)
 
 void CombatManager::RevalidateCombat()
 {
-    auto it = _pveRefs.begin(), end = _pveRefs.end();
-    while (it != end)
+    for (std::size_t i = 0; i < _pveRefs.size();)
     {
-        CombatReference* const ref = it->second;
+        CombatReference* const ref = _pveRefs.nth(i)->second;
         if (!CanBeginCombat(_owner, ref->GetOther(_owner)))
         {
-            it = _pveRefs.erase(it), end = _pveRefs.end(); // erase manually here to avoid iterator invalidation
+            _pveRefs.erase(_pveRefs.nth(i)); // erase manually here to avoid iterator invalidation
             ref->EndCombat();
         }
         else
-            ++it;
+            ++i;
     }
 
-    auto it2 = _pvpRefs.begin(), end2 = _pvpRefs.end();
-    while (it2 != end2)
+    for (std::size_t i = 0; i < _pvpRefs.size();)
     {
-        CombatReference* const ref = it2->second;
+        CombatReference* const ref = _pvpRefs.nth(i)->second;
         if (!CanBeginCombat(_owner, ref->GetOther(_owner)))
         {
-            it2 = _pvpRefs.erase(it2), end2 = _pvpRefs.end(); // erase manually here to avoid iterator invalidation
+            _pvpRefs.erase(_pvpRefs.nth(i)); // erase manually here to avoid iterator invalidation
             ref->EndCombat();
         }
         else
-            ++it2;
+            ++i;
     }
 }
 
@@ -386,6 +382,7 @@ void CombatManager::PutReference(ObjectGuid const& guid, CombatReference* ref)
         auto& inMap = _pveRefs[guid];
         ASSERT(!inMap, "Duplicate combat state at %p being inserted for %s vs %s - memory leak!", ref, _owner->GetGUID().ToString().c_str(), guid.ToString().c_str());
         inMap = ref;
+        _distantPvECombatPartnersValid.store(false, std::memory_order_relaxed);
     }
 }
 
@@ -393,8 +390,30 @@ void CombatManager::PurgeReference(ObjectGuid const& guid, bool pvp)
 {
     if (pvp)
         _pvpRefs.erase(guid);
-    else
-        _pveRefs.erase(guid);
+    else if (_pveRefs.erase(guid))
+        _distantPvECombatPartnersValid.store(false, std::memory_order_relaxed);
+}
+
+std::vector<Creature*> const& CombatManager::GetDistantPvECombatPartners(float range) const
+{
+    if (_distantPvECombatPartnersValid.exchange(true, std::memory_order_relaxed) && _distantPvECombatPartnersRange == range)
+        return _distantPvECombatPartners;
+
+    _distantPvECombatPartners.clear();
+    _distantPvECombatPartnersRange = range;
+    for (auto const& [guid, ref] : _pveRefs)
+        if (Creature* creature = ref->GetOther(_owner)->ToCreature())
+            if (creature->GetMapId() == _owner->GetMapId() && !creature->IsWithinDistInMap(_owner, range, false))
+                _distantPvECombatPartners.push_back(creature);
+
+    return _distantPvECombatPartners;
+}
+
+void CombatManager::OnOwnerRelocated()
+{
+    _distantPvECombatPartnersValid.store(false, std::memory_order_relaxed);
+    for (auto const& [guid, ref] : _pveRefs)
+        ref->GetOther(_owner)->GetCombatManager()._distantPvECombatPartnersValid.store(false, std::memory_order_relaxed);
 }
 
 bool CombatManager::UpdateOwnerCombatState() const
@@ -20,8 +20,12 @@
 
 #include "Common.h"
 #include "ObjectGuid.h"
-#include <unordered_map>
+#include "SlabAllocator.h"
+#include <boost/container/flat_map.hpp>
+#include <atomic>
+#include <vector>
 
+class Creature;
 class Unit;
 
 /********************************************************************************************************************************************************\
@@ -49,7 +53,8 @@ class Unit;
 \********************************************************************************************************************************************************/
 
 // Please check Game/Combat/CombatManager.h for documentation on how this class works!
-struct TC_GAME_API CombatReference
+// references are created and destroyed in bursts (pulls, wipes), they come from a pool shared with PvPCombatReference
+struct TC_GAME_API CombatReference : public Trinity::SlabAllocated<CombatReference>
 {
     Unit* const first;
     Unit* const second;
@@ -98,6 +103,10 @@ private:
 class TC_GAME_API CombatManager
 {
     public:
+        // sorted by guid and stored contiguously, most units are only in combat with a handful of others
+        using PvECombatRefContainer = boost::container::flat_map<ObjectGuid, CombatReference*>;
+        using PvPCombatRefContainer = boost::container::flat_map<ObjectGuid, PvPCombatReference*>;
+
         static bool CanBeginCombat(Unit const* a, Unit const* b);
 
         CombatManager(Unit* owner);
@@ -108,9 +117,14 @@ class TC_GAME_API CombatManager
         bool HasCombat() const { return HasPvECombat() || HasPvPCombat(); }
         bool HasPvECombat() const;
         bool HasPvECombatWithPlayers() const;
-        std::unordered_map<ObjectGuid, CombatReference*> const& GetPvECombatRefs() const { return _pveRefs; }
+        PvECombatRefContainer const& GetPvECombatRefs() const { return _pveRefs; }
         bool HasPvPCombat() const;
-        std::unordered_map<ObjectGuid, PvPCombatReference*> const& GetPvPCombatRefs() const { return _pvpRefs; }
+        PvPCombatRefContainer const& GetPvPCombatRefs() const { return _pvpRefs; }
+        // Creatures in PvE combat with the owner that are on its map but farther away than range.
+        // Kept until the owner, one of them or the combat references change
+        std::vector<Creature*> const& GetDistantPvECombatPartners(float range) const;
+        // called by Map after relocating the owner
+        void OnOwnerRelocated();
         // If the Unit is in combat, returns an arbitrary Unit that it's in combat with. Otherwise, returns nullptr.
         Unit* GetAnyTarget() const;
 
@@ -139,8 +153,13 @@ class TC_GAME_API CombatManager
         void PurgeReference(ObjectGuid const& guid, bool pvp);
         bool UpdateOwnerCombatState() const;
         Unit* const _owner;
-        std::unordered_map<ObjectGuid, CombatReference*> _pveRefs;
-        std::unordered_map<ObjectGuid, PvPCombatReference*> _pvpRefs;
+        PvECombatRefContainer _pveRefs;
+        PvPCombatRefContainer _pvpRefs;
+
+        // partners may be updated by another map update thread than the owner
+        mutable std::vector<Creature*> _distantPvECombatPartners;
+        mutable float _distantPvECombatPartnersRange;
+        mutable std::atomic<bool> _distantPvECombatPartnersValid;
 
     friend struct CombatReference;
     friend struct PvPCombatReference;
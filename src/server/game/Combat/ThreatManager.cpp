@@ -154,19 +154,70 @@ void ThreatReference::UnregisterAndFree()
 class ThreatReferenceImpl : public ThreatReference
 {
 public:
-    explicit ThreatReferenceImpl(ThreatManager* mgr, Unit* victim) : ThreatReference(mgr, victim) { }
+    explicit ThreatReferenceImpl(ThreatManager* mgr, Unit* victim) : ThreatReference(mgr, victim), _heapUpdatePending(false) { }
 
     ThreatManager::Heap::handle_type _handle;
+    bool _heapUpdatePending;
 };
 
 void ThreatReference::HeapNotifyIncreased()
 {
-    _mgr._sortedThreatList->increase(static_cast<ThreatReferenceImpl*>(this)->_handle);
+    if (_mgr._updateBatchDepth)
+        _mgr.DeferHeapUpdate(this);
+    else
+        _mgr._sortedThreatList->increase(static_cast<ThreatReferenceImpl*>(this)->_handle);
 }
 
 void ThreatReference::HeapNotifyDecreased()
 {
-    _mgr._sortedThreatList->decrease(static_cast<ThreatReferenceImpl*>(this)->_handle);
+    if (_mgr._updateBatchDepth)
+        _mgr.DeferHeapUpdate(this);
+    else
+        _mgr._sortedThreatList->decrease(static_cast<ThreatReferenceImpl*>(this)->_handle);
+}
+
+ThreatManager::UpdateBatch::~UpdateBatch()
+{
+    if (--_mgr._updateBatchDepth)
+        return;
+
+    _mgr.FlushHeapUpdates();
+    if (std::exchange(_mgr._aiUpdateDeferred, false))
+        _mgr.ProcessAIUpdates();
+}
+
+void ThreatManager::DeferHeapUpdate(ThreatReference* ref)
+{
+    ThreatReferenceImpl* impl = static_cast<ThreatReferenceImpl*>(ref);
+    if (impl->_heapUpdatePending)
+        return;
+
+    impl->_heapUpdatePending = true;
+    ++_pendingHeapUpdates;
+}
+
+void ThreatManager::FlushHeapUpdates() const
+{
+    if (!_pendingHeapUpdates)
+        return;
+
+    // every changed node is moved to the root list, the last update consolidates the heap once for all of them
+    ThreatReferenceImpl* last = nullptr;
+    for (auto const& pair : _myThreatListEntries)
+    {
+        ThreatReferenceImpl* impl = static_cast<ThreatReferenceImpl*>(pair.second);
+        if (!impl->_heapUpdatePending)
+            continue;
+
+        impl->_heapUpdatePending = false;
+        if (last)
+            _sortedThreatList->update_lazy(last->_handle);
+        last = impl;
+    }
+
+    _pendingHeapUpdates = 0;
+    if (last)
+        _sortedThreatList->update(last->_handle);
 }
 
 /*static*/ bool ThreatManager::CanHaveThreatList(Unit const* who)
@@ -190,7 +241,7 @@ void ThreatReference::HeapNotifyDecreased()
 }
 
 ThreatManager::ThreatManager(Unit* owner) : _owner(owner), _ownerCanHaveThreatList(false), _needClientUpdate(false), _needThreatClearUpdate(false), _updateTimer(THREAT_UPDATE_INTERVAL),
-    _sortedThreatList(std::make_unique<Heap>()), _currentVictimRef(nullptr), _fixateRef(nullptr)
+    _sortedThreatList(std::make_unique<Heap>()), _updateBatchDepth(0), _pendingHeapUpdates(0), _aiUpdateDeferred(false), _currentVictimRef(nullptr), _fixateRef(nullptr)
 {
     for (int8 i = 0; i < MAX_SPELL_SCHOOL; ++i)
         _singleSchoolModifiers[i] = 1.0f;
@@ -306,6 +357,7 @@ Trinity::IteratorPair<ThreatManager::ThreatListIterator, std::nullptr_t> ThreatM
 
 Trinity::IteratorPair<ThreatManager::ThreatListIterator, std::nullptr_t> ThreatManager::GetSortedThreatList() const
 {
+    FlushHeapUpdates();
     auto itr = _sortedThreatList->ordered_begin();
     auto end = _sortedThreatList->ordered_end();
     std::function<ThreatReference const* ()> generator = [itr, end]() mutable -> ThreatReference const*
@@ -322,6 +374,7 @@ std::vector<ThreatReference*> ThreatManager::GetModifiableThreatList()
 {
     std::vector<ThreatReference*> list;
     list.reserve(_myThreatListEntries.size());
+    FlushHeapUpdates();
     for (auto it = _sortedThreatList->ordered_begin(), end = _sortedThreatList->ordered_end(); it != end; ++it)
         list.push_back(const_cast<ThreatReference*>(*it));
     return list;
@@ -478,6 +531,13 @@ void ThreatManager::AddThreat(Unit* target, float amount, SpellInfo const* spell
         ProcessAIUpdates();
 }
 
+void ThreatManager::AddThreat(std::span<std::pair<Unit*, float> const> targets, SpellInfo const* spell, bool ignoreModifiers, bool ignoreRedirects)
+{
+    UpdateBatch batch(*this);
+    for (auto const& [target, amount] : targets)
+        AddThreat(target, amount, spell, ignoreModifiers, ignoreRedirects);
+}
+
 void ThreatManager::ScaleThreat(Unit* target, float factor)
 {
     auto it = _myThreatListEntries.find(target->GetGUID());
@@ -485,11 +545,19 @@ void ThreatManager::ScaleThreat(Unit* target, float factor)
         it->second->ScaleThreat(std::max<float>(factor,0.0f));
 }
 
+void ThreatManager::ScaleAllThreat(float factor)
+{
+    UpdateBatch batch(*this);
+    for (auto const& pair : _myThreatListEntries)
+        pair.second->ScaleThreat(std::max<float>(factor, 0.0f));
+}
+
 void ThreatManager::MatchUnitThreatToHighestThreat(Unit* target)
 {
     if (_sortedThreatList->empty())
         return;
 
+    FlushHeapUpdates();
     auto it = _sortedThreatList->ordered_begin(), end = _sortedThreatList->ordered_end();
     ThreatReference const* highest = *it;
     if (!highest->IsAvailable())
@@ -515,13 +583,16 @@ void ThreatManager::TauntUpdate()
     for (AuraEffect const* tauntEffect : tauntEffects)
         tauntStates[tauntEffect->GetCasterGUID()] = ++tauntPriority;
 
-    for (auto const& pair : _myThreatListEntries)
     {
-        auto it = tauntStates.find(pair.first);
-        if (it != tauntStates.end())
-            pair.second->UpdateTauntState(ThreatReference::TauntState(ThreatReference::TAUNT_STATE_TAUNT + tauntStates.size() - it->second));
-        else
-            pair.second->UpdateTauntState();
+        UpdateBatch batch(*this);
+        for (auto const& pair : _myThreatListEntries)
+        {
+            auto it = tauntStates.find(pair.first);
+            if (it != tauntStates.end())
+                pair.second->UpdateTauntState(ThreatReference::TauntState(ThreatReference::TAUNT_STATE_TAUNT + tauntStates.size() - it->second));
+            else
+                pair.second->UpdateTauntState();
+        }
     }
 
     // taunt aura update also re-evaluates all suppressed states (retail behavior)
@@ -530,8 +601,7 @@ void ThreatManager::TauntUpdate()
 
 void ThreatManager::ResetAllThreat()
 {
-    for (auto const& pair : _myThreatListEntries)
-        pair.second->ScaleThreat(0.0f);
+    ScaleAllThreat(0.0f);
 }
 
 void ThreatManager::ClearThreat(Unit* target)
@@ -602,8 +672,11 @@ ThreatReference const* ThreatManager::ReselectVictim()
     if (_sortedThreatList->empty())
         return nullptr;
 
-    for (auto const& pair : _myThreatListEntries)
-        pair.second->UpdateOffline(); // AI notifies are processed in ::UpdateVictim caller
+    {
+        UpdateBatch batch(*this);
+        for (auto const& pair : _myThreatListEntries)
+            pair.second->UpdateOffline(); // AI notifies are processed in ::UpdateVictim caller
+    }
 
     // fixated target is always preferred
     if (_fixateRef && _fixateRef->IsAvailable())
@@ -613,6 +686,7 @@ ThreatReference const* ThreatManager::ReselectVictim()
     if (oldVictimRef && oldVictimRef->IsOffline())
         oldVictimRef = nullptr;
     // in 99% of cases - we won't need to actually look at anything beyond the first element
+    FlushHeapUpdates(); // a batch of our caller may still be open
     ThreatReference const* highest = _sortedThreatList->top();
     // if the highest reference is offline, the entire list is offline, and we indicate this
     if (!highest->IsAvailable())
@@ -654,6 +728,13 @@ ThreatReference const* ThreatManager::ReselectVictim()
 
 void ThreatManager::ProcessAIUpdates()
 {
+    // lazy mode - the outermost batch processes them once every change was applied
+    if (_updateBatchDepth)
+    {
+        _aiUpdateDeferred = true;
+        return;
+    }
+
     CreatureAI* ai = ASSERT_NOTNULL(_owner->ToCreature())->AI();
     std::vector<ObjectGuid> v(std::move(_needsAIUpdate)); // _needsAIUpdate is now empty in case this triggers a recursive call
     if (!ai)
@@ -902,6 +983,8 @@ void ThreatManager::PurgeThreatListRef(ObjectGuid const& guid)
         return;
     ThreatReference* ref = it->second;
     _myThreatListEntries.erase(it);
+    if (static_cast<ThreatReferenceImpl*>(ref)->_heapUpdatePending)
+        --_pendingHeapUpdates;
     _sortedThreatList->erase(static_cast<ThreatReferenceImpl*>(ref)->_handle);
 
     if (_fixateRef == ref)
@@ -24,7 +24,9 @@
 #include "SharedDefines.h"
 #include <array>
 #include <memory>
+#include <span>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 class Creature;
@@ -83,6 +85,7 @@ class TC_GAME_API ThreatManager
     public:
         class Heap;
         class ThreatListIterator;
+        class UpdateBatch;
         static const uint32 THREAT_UPDATE_INTERVAL = 1000u;
 
         static bool CanHaveThreatList(Unit const* who);
@@ -141,7 +144,13 @@ class TC_GAME_API ThreatManager
         void EvaluateSuppressed(bool canExpire = false);
         ///== AFFECT MY THREAT LIST ==
         void AddThreat(Unit* target, float amount, SpellInfo const* spell = nullptr, bool ignoreModifiers = false, bool ignoreRedirects = false);
+        // Adds threat to every target at once, the threat list is only resorted once all of it was added
+        void AddThreat(std::span<std::pair<Unit*, float> const> targets, SpellInfo const* spell = nullptr, bool ignoreModifiers = false, bool ignoreRedirects = false);
         void ScaleThreat(Unit* target, float factor);
+        // Scales the threat of every threat list entry, the threat list is only resorted once
+        void ScaleAllThreat(float factor);
+        // Modify the threat of every threat list entry by +percent%
+        void ModifyAllThreatByPercent(int32 percent) { if (percent) ScaleAllThreat(0.01f*float(100 + percent)); }
         // Modify target's threat by +percent%
         void ModifyThreatByPercent(Unit* target, int32 percent) { if (percent) ScaleThreat(target, 0.01f*float(100 + percent)); }
         // Resets the specified unit's threat to zero
@@ -205,6 +214,14 @@ class TC_GAME_API ThreatManager
         std::unique_ptr<Heap> _sortedThreatList;
         std::unordered_map<ObjectGuid, ThreatReference*> _myThreatListEntries;
 
+        // while an UpdateBatch is open, changed references are only marked and fixed up in the heap together
+        // anything reading the heap in order must call FlushHeapUpdates first
+        void DeferHeapUpdate(ThreatReference* ref);
+        void FlushHeapUpdates() const;
+        uint32 _updateBatchDepth;
+        mutable uint32 _pendingHeapUpdates;
+        bool _aiUpdateDeferred;
+
         // AI notifies are delayed to ensure we are in a consistent state before we call out to arbitrary logic
         // threat references might register themselves here when ::UpdateOffline() is called - MAKE SURE THIS IS PROCESSED JUST BEFORE YOU EXIT THREATMANAGER LOGIC
         void ProcessAIUpdates();
@@ -233,6 +250,21 @@ class TC_GAME_API ThreatManager
         ThreatManager(ThreatManager const&) = delete;
         ThreatManager& operator=(ThreatManager const&) = delete;
 
+        // Groups many changes of the owner's threat list: the heap is fixed up once when the outermost batch ends
+        // and AI notifies are delayed until then. Sorted reads inside the batch are still correct, they resort first
+        class UpdateBatch
+        {
+        public:
+            explicit UpdateBatch(ThreatManager& mgr) : _mgr(mgr) { ++_mgr._updateBatchDepth; }
+            ~UpdateBatch();
+
+            UpdateBatch(UpdateBatch const&) = delete;
+            UpdateBatch& operator=(UpdateBatch const&) = delete;
+
+        private:
+            ThreatManager& _mgr;
+        };
+
         class ThreatListIterator
         {
         private:
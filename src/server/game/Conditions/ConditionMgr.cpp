@@ -52,10 +52,12 @@
 #include "SpellAuraEffects.h"
 #include "SpellAuras.h"
 #include "SpellMgr.h"
+#include "Tuples.h"
 #include "World.h"
 #include "WorldSession.h"
 #include "WorldStateMgr.h"
 #include "WowTime.h"
+#include <boost/container/small_vector.hpp>
 #include <random>
 #include <sstream>
 
@@ -931,6 +933,27 @@ uint32 Condition::GetMaxAvailableConditionTargets() const
     }
 }
 
+bool Condition::ReadsConditionTarget(uint8 conditionTarget) const
+{
+    // references and scripts may read any of them
+    if (ReferenceId || ScriptId)
+        return true;
+
+    switch (ConditionType)
+    {
+        case CONDITION_RELATION_TO:
+        case CONDITION_REACTION_TO:
+        case CONDITION_DISTANCE_TO:
+            if (ConditionValue1 == conditionTarget)
+                return true;
+            break;
+        default:
+            break;
+    }
+
+    return ConditionTarget == conditionTarget;
+}
+
 std::string Condition::ToString(bool ext /*= false*/) const
 {
     std::ostringstream ss;
@@ -961,6 +984,78 @@ std::string Condition::ToString(bool ext /*= false*/) const
     return std::move(ss).str();
 }
 
+namespace
+{
+// Rough cost of evaluating condition, compiled lists check the conditions of an else group cheapest first
+uint8 GetConditionEvaluationCost(Condition const& condition)
+{
+    if (condition.ReferenceId || condition.ScriptId)
+        return 2;
+
+    switch (condition.ConditionType)
+    {
+        case CONDITION_NONE:
+        case CONDITION_ZONEID:
+        case CONDITION_TEAM:
+        case CONDITION_DRUNKENSTATE:
+        case CONDITION_ACTIVE_EVENT:
+        case CONDITION_CLASS:
+        case CONDITION_RACE:
+        case CONDITION_GENDER:
+        case CONDITION_UNIT_STATE:
+        case CONDITION_MAPID:
+        case CONDITION_AREAID:
+        case CONDITION_CREATURE_TYPE:
+        case CONDITION_LEVEL:
+        case CONDITION_OBJECT_ENTRY_GUID_LEGACY:
+        case CONDITION_TYPE_MASK_LEGACY:
+        case CONDITION_ALIVE:
+        case CONDITION_HP_VAL:
+        case CONDITION_HP_PCT:
+        case CONDITION_STAND_STATE:
+        case CONDITION_CHARMED:
+        case CONDITION_TAXI:
+        case CONDITION_DIFFICULTY_ID:
+        case CONDITION_GAMEMASTER:
+        case CONDITION_OBJECT_ENTRY_GUID:
+        case CONDITION_TYPE_MASK:
+        case CONDITION_PRIVATE_OBJECT:
+            return 0;
+        case CONDITION_NEAR_CREATURE:
+        case CONDITION_NEAR_GAMEOBJECT:
+        case CONDITION_DISTANCE_TO:
+        case CONDITION_IN_WATER:
+        case CONDITION_PLAYER_CONDITION:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+// Conditions only reading state of the player that increases its quest status or aura application revision when changed
+bool IsCacheableCondition(Condition const& condition)
+{
+    if (condition.ReferenceId || condition.ScriptId || condition.ConditionTarget != 0)
+        return false;
+
+    switch (condition.ConditionType)
+    {
+        case CONDITION_AURA:
+        case CONDITION_QUESTREWARDED:
+        case CONDITION_QUESTTAKEN:
+        case CONDITION_QUEST_NONE:
+        case CONDITION_CLASS:
+        case CONDITION_RACE:
+        case CONDITION_QUEST_COMPLETE:
+        case CONDITION_QUESTSTATE:
+        case CONDITION_QUEST_OBJECTIVE_PROGRESS:
+            return true;
+        default:
+            return false;
+    }
+}
+}
+
 ConditionMgr::ConditionMgr() = default;
 
 ConditionMgr::~ConditionMgr()
@@ -1009,48 +1104,141 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionContainer cons
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
 {
     //     groupId, groupCheckPassed
-    std::map<uint32, bool> elseGroupStore;
+    boost::container::small_vector<std::pair<uint32, bool>, 4> elseGroupStore;
     for (Condition const& condition : conditions)
     {
         TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} val1: {}", condition.ToString(), condition.ConditionValue1);
         if (condition.isLoaded())
         {
             //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::iterator itr = elseGroupStore.try_emplace(condition.ElseGroup, true).first;
+            auto itr = std::ranges::find(elseGroupStore, condition.ElseGroup, Trinity::TupleElement<0>);
+            if (itr == elseGroupStore.end())
+                itr = elseGroupStore.emplace(elseGroupStore.end(), condition.ElseGroup, true);
+
             if (!itr->second) //! If another condition in this group was unmatched before this, don't bother checking (the group is false anyway)
                 continue;
 
-            if (condition.ReferenceId)//handle reference
-            {
-                auto ref = ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].find({ condition.ReferenceId, 0, 0 });
-                if (ref != ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].end())
-                {
-                    bool condMeets = IsObjectMeetToConditionList(sourceInfo, *ref->second);
-                    if (condition.NegativeCondition)
-                        condMeets = !condMeets;
+            if (!IsConditionMet(sourceInfo, condition))
+                itr->second = false;
+            else if (condition.LastOfElseGroup) //! Every condition of this group was met, the other groups can't change the result
+                return true;
+        }
+    }
 
-                    if (!condMeets)
-                        itr->second = false;
-                }
-                else
-                {
-                    TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
-                        condition.ToString(), condition.ReferenceId); // checked at loading, should never happen
-                }
+    return std::ranges::any_of(elseGroupStore, Trinity::TupleElement<1>);
+}
 
-            }
-            else //handle normal condition
-            {
-                if (!condition.Meets(sourceInfo))
-                    itr->second = false;
-            }
+bool ConditionMgr::IsObjectMeetToCacheableConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
+{
+    Player const* player = sourceInfo.mConditionTargets[0] ? sourceInfo.mConditionTargets[0]->ToPlayer() : nullptr;
+    if (!player)
+        return IsObjectMeetToConditionList(sourceInfo, conditions);
+
+    ConditionResultCache::Entry& cached = player->GetConditionResultCache().Results[&conditions];
+    if (cached.StoreRevision != StoreRevision
+        || cached.QuestStatusRevision != player->GetQuestStatusRevision()
+        || cached.AuraApplicationRevision != player->GetAuraApplicationRevision())
+    {
+        Condition const* lastFailedCondition = std::exchange(sourceInfo.mLastFailedCondition, nullptr);
+        cached.Result = IsObjectMeetToConditionList(sourceInfo, conditions);
+        cached.FailedCondition = sourceInfo.mLastFailedCondition;
+        cached.StoreRevision = StoreRevision;
+        cached.QuestStatusRevision = player->GetQuestStatusRevision();
+        cached.AuraApplicationRevision = player->GetAuraApplicationRevision();
+        if (!cached.FailedCondition)
+            sourceInfo.mLastFailedCondition = lastFailedCondition;
+    }
+    else if (cached.FailedCondition)
+        sourceInfo.mLastFailedCondition = cached.FailedCondition;
+
+    return cached.Result;
+}
+
+void ConditionMgr::CompileConditionList(ConditionSourceType sourceType, ConditionContainer& conditions)
+{
+    // the last failed condition of spell cast conditions is reported back to the caster, like conditions with error texts they keep their order
+    bool canReorder = sourceType != CONDITION_SOURCE_TYPE_SPELL && std::ranges::none_of(conditions, [](Condition const& condition)
+    {
+        return condition.ErrorType || condition.ErrorTextId;
+    });
+
+    if (canReorder)
+        std::ranges::stable_sort(conditions, std::less(), [](Condition const& condition) { return std::pair(condition.ElseGroup, GetConditionEvaluationCost(condition)); });
+
+    bool cacheable = !conditions.empty() && std::ranges::all_of(conditions, IsCacheableCondition);
+    for (auto itr = conditions.begin(); itr != conditions.end(); ++itr)
+    {
+        itr->LastOfElseGroup = std::none_of(std::next(itr), conditions.end(), [&](Condition const& later) { return later.ElseGroup == itr->ElseGroup; });
+        itr->CacheableList = cacheable;
+    }
+}
+
+bool ConditionMgr::IsConditionMet(ConditionSourceInfo& sourceInfo, Condition const& condition) const
+{
+    if (condition.ReferenceId)//handle reference
+    {
+        auto ref = ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].find({ condition.ReferenceId, 0, 0 });
+        if (ref != ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].end())
+        {
+            bool condMeets = IsObjectMeetToConditionList(sourceInfo, *ref->second);
+            if (condition.NegativeCondition)
+                condMeets = !condMeets;
+
+            return condMeets;
         }
+
+        TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
+            condition.ToString(), condition.ReferenceId); // checked at loading, should never happen
+        return true;
     }
-    for (std::map<uint32, bool>::const_iterator i = elseGroupStore.begin(); i != elseGroupStore.end(); ++i)
-        if (i->second)
-            return true;
 
-    return false;
+    //handle normal condition
+    return condition.Meets(sourceInfo);
+}
+
+bool ConditionMgr::PrecheckConditions(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions, uint8 variableTarget, ConditionPrecheck& precheck) const
+{
+    precheck.ElseGroups.clear();
+    precheck.VariableTarget = variableTarget;
+    for (Condition const& condition : conditions)
+    {
+        if (!condition.isLoaded())
+            continue;
+
+        auto itr = std::ranges::find(precheck.ElseGroups, condition.ElseGroup, Trinity::TupleElement<0>);
+        if (itr == precheck.ElseGroups.end())
+            itr = precheck.ElseGroups.emplace(precheck.ElseGroups.end(), condition.ElseGroup, true);
+
+        if (!itr->second || condition.ReadsConditionTarget(variableTarget))
+            continue;
+
+        if (!IsConditionMet(sourceInfo, condition))
+            itr->second = false;
+    }
+
+    return conditions.empty() || std::ranges::any_of(precheck.ElseGroups, Trinity::TupleElement<1>);
+}
+
+bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions, ConditionPrecheck const& precheck) const
+{
+    if (conditions.empty())
+        return true;
+
+    boost::container::small_vector<std::pair<uint32, bool>, 4> elseGroupStore(precheck.ElseGroups.begin(), precheck.ElseGroups.end());
+    for (Condition const& condition : conditions)
+    {
+        if (!condition.isLoaded() || !condition.ReadsConditionTarget(precheck.VariableTarget))
+            continue;
+
+        auto itr = std::ranges::find(elseGroupStore, condition.ElseGroup, Trinity::TupleElement<0>);
+        if (!itr->second)
+            continue;
+
+        if (!IsConditionMet(sourceInfo, condition))
+            itr->second = false;
+    }
+
+    return std::ranges::any_of(elseGroupStore, Trinity::TupleElement<1>);
 }
 
 bool ConditionMgr::IsObjectMeetToConditions(WorldObject const* object, ConditionContainer const& conditions) const
@@ -1071,6 +1259,9 @@ bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, Con
         return true;
 
     TC_LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditions");
+    if (conditions.front().CacheableList && sWorld->getBoolConfig(CONFIG_CONDITION_RESULT_CACHE))
+        return IsObjectMeetToCacheableConditionList(sourceInfo, conditions);
+
     return IsObjectMeetToConditionList(sourceInfo, conditions);
 }
 
@@ -1170,6 +1361,53 @@ bool ConditionMgr::HasConditionsForNotGroupedEntry(ConditionSourceType sourceTyp
     return false;
 }
 
+bool ConditionMgr::IsConditionListDependingOnQuest(ConditionContainer const& conditions, uint32 questId) const
+{
+    return std::ranges::any_of(conditions, [&](Condition const& condition)
+    {
+        if (condition.ScriptId)
+            return true;
+
+        if (condition.ReferenceId)
+        {
+            auto ref = ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].find({ condition.ReferenceId, 0, 0 });
+            return ref == ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_CONDITION].end() || IsConditionListDependingOnQuest(*ref->second, questId);
+        }
+
+        switch (condition.ConditionType)
+        {
+            case CONDITION_QUESTREWARDED:
+            case CONDITION_QUESTTAKEN:
+            case CONDITION_QUEST_NONE:
+            case CONDITION_QUEST_COMPLETE:
+            case CONDITION_DAILY_QUEST_DONE:
+            case CONDITION_QUESTSTATE:
+                return condition.ConditionValue1 == questId;
+            case CONDITION_QUEST_OBJECTIVE_PROGRESS:
+            {
+                QuestObjective const* objective = sObjectMgr->GetQuestObjective(condition.ConditionValue1);
+                return !objective || objective->QuestID == questId;
+            }
+            case CONDITION_PLAYER_CONDITION:
+                return true;
+            default:
+                return false;
+        }
+    });
+}
+
+bool ConditionMgr::IsNotGroupedEntryDependingOnQuest(ConditionSourceType sourceType, uint32 entry, uint32 questId) const
+{
+    if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
+    {
+        auto i = ConditionStore[sourceType].find({ 0, int32(entry), 0 });
+        if (i != ConditionStore[sourceType].end())
+            return IsConditionListDependingOnQuest(*i->second, questId);
+    }
+
+    return false;
+}
+
 bool ConditionMgr::IsObjectMeetingSpellClickConditions(uint32 creatureId, uint32 spellId, WorldObject const* clicker, WorldObject const* target) const
 {
     auto itr = ConditionStore[CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT].find({ creatureId, int32(spellId), 0 });
@@ -1412,41 +1650,10 @@ void ConditionMgr::LoadConditions(bool isReload)
     }
     while (result->NextRow());
 
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_CREATURE_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Creature.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_DISENCHANT_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Disenchant.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_FISHING_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Fishing.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_GAMEOBJECT_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Gameobject.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_ITEM_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Item.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_MAIL_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Mail.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_MILLING_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Milling.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_PICKPOCKETING_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Pickpocketing.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_PROSPECTING_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Prospecting.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_REFERENCE_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Reference.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_SKINNING_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Skinning.GetLootForConditionFill(id.SourceGroup));
-
-    for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_SPELL_LOOT_TEMPLATE])
-        addToLootTemplate(id, conditions, LootTemplates_Spell.GetLootForConditionFill(id.SourceGroup));
+    for (LootStore* store : { &LootTemplates_Creature, &LootTemplates_Disenchant, &LootTemplates_Fishing, &LootTemplates_Gameobject,
+        &LootTemplates_Item, &LootTemplates_Mail, &LootTemplates_Milling, &LootTemplates_Pickpocketing, &LootTemplates_Prospecting,
+        &LootTemplates_Reference, &LootTemplates_Skinning, &LootTemplates_Spell })
+        LinkLootConditions(*store);
 
     for (auto&& [id, conditions] : ConditionStore[CONDITION_SOURCE_TYPE_GOSSIP_MENU])
         addToGossipMenus(id, conditions);
@@ -1508,7 +1715,23 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
     }
 
+    // lists handed out above are shared, phase lists are compiled when copied out of the store and spell implicit target lists are evaluated in their original order
+    for (std::size_t sourceType = 0; sourceType < ConditionStore.size(); ++sourceType)
+        for (auto&& [id, conditions] : ConditionStore[sourceType])
+            CompileConditionList(ConditionSourceType(sourceType), *conditions);
+
+    ++StoreRevision;
+
     TC_LOG_INFO("server.loading", ">> Loaded {} conditions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+
+    if (isReload)
+        Map::InvalidateAllSpawnGroupConditions();
+}
+
+void ConditionMgr::LinkLootConditions(LootStore& store) const
+{
+    for (auto&& [id, conditions] : ConditionStore[store.GetConditionSourceType()])
+        addToLootTemplate(id, conditions, store.GetLootForConditionFill(id.SourceGroup));
 }
 
 void ConditionMgr::addToLootTemplate(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions, LootTemplate* loot) const
@@ -1686,6 +1909,7 @@ void ConditionMgr::addToPhases(ConditionId const& id, std::shared_ptr<std::vecto
                         if (phase.PhaseInfo->Id == id.SourceGroup)
                         {
                             phase.Conditions.insert(phase.Conditions.end(), conditions->begin(), conditions->end());
+                            CompileConditionList(CONDITION_SOURCE_TYPE_PHASE, phase.Conditions);
                             found = true;
                         }
                     }
@@ -1703,6 +1927,7 @@ void ConditionMgr::addToPhases(ConditionId const& id, std::shared_ptr<std::vecto
             if (phase.PhaseInfo->Id == id.SourceGroup)
             {
                 phase.Conditions.insert(phase.Conditions.end(), conditions->begin(), conditions->end());
+                CompileConditionList(CONDITION_SOURCE_TYPE_PHASE, phase.Conditions);
                 return;
             }
         }
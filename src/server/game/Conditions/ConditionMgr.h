@@ -32,6 +32,7 @@ class Map;
 class Player;
 class Unit;
 class WorldObject;
+class LootStore;
 class LootTemplate;
 struct Condition;
 struct PlayerConditionEntry;
@@ -263,6 +264,8 @@ struct TC_GAME_API Condition
     uint32                  ScriptId;
     uint8                   ConditionTarget;
     bool                    NegativeCondition;
+    bool                    LastOfElseGroup;   // no later condition of the list belongs to ElseGroup, set by ConditionMgr::CompileConditionList
+    bool                    CacheableList;     // every condition of the list only reads quests, auras, class or race of a player ConditionTarget 0
 
     Condition()
     {
@@ -281,17 +284,42 @@ struct TC_GAME_API Condition
         ErrorTextId        = 0;
         ScriptId           = 0;
         NegativeCondition  = false;
+        LastOfElseGroup    = false;
+        CacheableList      = false;
     }
 
     bool Meets(ConditionSourceInfo& sourceInfo) const;
     uint32 GetSearcherTypeMaskForCondition() const;
     bool isLoaded() const { return ConditionType > CONDITION_NONE || ReferenceId || ScriptId; }
     uint32 GetMaxAvailableConditionTargets() const;
+    bool ReadsConditionTarget(uint8 conditionTarget) const;
 
     std::string ToString(bool ext = false) const; /// For logging purpose
 };
 
 typedef std::vector<Condition> ConditionContainer;
+
+// Else groups of a condition list after evaluating every condition not reading one of the condition targets, see ConditionMgr::PrecheckConditions
+struct ConditionPrecheck
+{
+    std::vector<std::pair<uint32 /*elseGroup*/, bool /*passed*/>> ElseGroups;
+    uint8 VariableTarget = 0;
+};
+// Results of cacheable condition lists checked for a player, dropped once its quests or auras change or conditions are reloaded
+struct ConditionResultCache
+{
+    struct Entry
+    {
+        uint32 StoreRevision = 0;
+        uint32 QuestStatusRevision = 0;
+        uint32 AuraApplicationRevision = 0;
+        Condition const* FailedCondition = nullptr;
+        bool Result = false;
+    };
+
+    std::unordered_map<ConditionContainer const*, Entry> Results;
+};
+
 typedef std::unordered_map<ConditionId, std::shared_ptr<ConditionContainer>> ConditionsByEntryMap; // stored as shared_ptr to give out weak_ptrs to hold by other code (ownership not shared)
 typedef std::array<ConditionsByEntryMap, CONDITION_SOURCE_TYPE_MAX> ConditionEntriesByTypeArray;
 
@@ -310,12 +338,19 @@ class TC_GAME_API ConditionMgr
         static ConditionMgr* instance();
 
         void LoadConditions(bool isReload = false);
+        // Links the loaded loot conditions to the templates of store, used when the templates were replaced without reloading the conditions
+        void LinkLootConditions(LootStore& store) const;
         bool isConditionTypeValid(Condition* cond) const;
 
         uint32 GetSearcherTypeMaskForConditionList(ConditionContainer const& conditions) const;
         bool IsObjectMeetToConditions(WorldObject const* object, ConditionContainer const& conditions) const;
         bool IsObjectMeetToConditions(WorldObject const* object1, WorldObject const* object2, ConditionContainer const& conditions) const;
         bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        // Evaluates the conditions not reading condition target variableTarget once for checking many objects as that target,
+        // returns false if no else group can be met whatever object it is
+        bool PrecheckConditions(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions, uint8 variableTarget, ConditionPrecheck& precheck) const;
+        // Same result as IsObjectMeetToConditions, only evaluates the conditions skipped by PrecheckConditions
+        bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions, ConditionPrecheck const& precheck) const;
         static bool CanHaveSourceGroupSet(ConditionSourceType sourceType);
         static bool CanHaveSourceIdSet(ConditionSourceType sourceType);
         static bool CanHaveConditionType(ConditionSourceType sourceType, ConditionTypes conditionType);
@@ -323,6 +358,11 @@ class TC_GAME_API ConditionMgr
         bool IsObjectMeetingNotGroupedConditions(ConditionSourceType sourceType, uint32 entry, WorldObject const* target0, WorldObject const* target1 = nullptr, WorldObject const* target2 = nullptr) const;
         bool IsMapMeetingNotGroupedConditions(ConditionSourceType sourceType, uint32 entry, Map const* map) const;
         bool HasConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const;
+        // True if a change of quest questId can change the result of conditions, lists checking player conditions, references or scripts always can
+        bool IsConditionListDependingOnQuest(ConditionContainer const& conditions, uint32 questId) const;
+        bool IsNotGroupedEntryDependingOnQuest(ConditionSourceType sourceType, uint32 entry, uint32 questId) const;
+        // Increased on every load of the conditions
+        uint32 GetStoreRevision() const { return StoreRevision; }
         bool IsObjectMeetingSpellClickConditions(uint32 creatureId, uint32 spellId, WorldObject const* clicker, WorldObject const* target) const;
         bool HasConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
         bool IsObjectMeetingVehicleSpellConditions(uint32 creatureId, uint32 spellId, Player const* player, Unit const* vehicle) const;
@@ -362,6 +402,9 @@ class TC_GAME_API ConditionMgr
         void addToPhases(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
         void addToGraveyardData(ConditionId const& id, std::shared_ptr<std::vector<Condition>> conditions) const;
         bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        bool IsObjectMeetToCacheableConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        static void CompileConditionList(ConditionSourceType sourceType, ConditionContainer& conditions);
+        bool IsConditionMet(ConditionSourceInfo& sourceInfo, Condition const& condition) const;
 
         static void LogUselessConditionValue(Condition const* cond, uint8 index, uint32 value);
         static void LogUselessConditionValue(Condition const* cond, uint8 index, std::string_view value);
@@ -369,6 +412,7 @@ class TC_GAME_API ConditionMgr
         void Clean(); // free up resources
 
         ConditionEntriesByTypeArray     ConditionStore;
+        uint32                          StoreRevision = 0;          // increased by every load, cached results of older lists are not used
 
         std::unordered_set<uint32> SpellsUsedInSpellClickConditions;
 };
@@ -17,15 +17,20 @@
 
 #include "DB2Stores.h"
 #include "Containers.h"
+#include "ByteBuffer.h"
+#include "Config.h"
 #include "DB2LoadInfo.h"
+#include "DB2StringArena.h"
 #include "DatabaseEnv.h"
 #include "Hash.h"
+#include "Hyperlinks.h"
 #include "ItemTemplate.h"
 #include "IteratorPair.h"
 #include "Log.h"
 #include "MapUtils.h"
 #include "Random.h"
 #include "Regex.h"
+#include "TaskGraph.h"
 #include "Timer.h"
 #include "Util.h"
 #include "World.h"
@@ -37,6 +42,9 @@
 #include <numeric>
 #include <cctype>
 #include <cmath>
+#include <exception>
+#include <iterator>
+#include <shared_mutex>
 
 DB2Storage<AchievementEntry>                    sAchievementStore("Achievement.db2", &AchievementLoadInfo::Instance);
 DB2Storage<Achievement_CategoryEntry>           sAchievementCategoryStore("Achievement_Category.db2", &AchievementCategoryLoadInfo::Instance);
@@ -463,6 +471,12 @@ namespace
     std::unordered_multimap<uint32 /*tableHash*/, AllowedHotfixOptionalData> _allowedHotfixOptionalData;
     std::array<std::map<HotfixBlobKey, std::vector<DB2Manager::HotfixOptionalData>>, TOTAL_LOCALES> _hotfixOptionalData;
 
+    // replies are identical for every client using the same locale, they are built on first request
+    constexpr std::size_t MaxSerializedRecordsPerLocale = 0x10000;
+    std::shared_mutex _serializedHotfixesLock;
+    std::array<std::map<HotfixBlobKey, std::shared_ptr<std::vector<uint8> const>>, TOTAL_LOCALES> _serializedRecords;
+    std::array<std::unordered_map<int32, std::shared_ptr<DB2Manager::SerializedHotfixPush const>>, TOTAL_LOCALES> _serializedHotfixPushes;
+
     AreaGroupMemberContainer _areaGroupMembers;
     ArtifactPowersContainer _artifactPowers;
     ArtifactPowerLinksContainer _artifactPowerLinks;
@@ -546,10 +560,20 @@ namespace
     std::unordered_set<int32> _uiMapPhases;
     WMOAreaTableLookupContainer _wmoAreaTableLookup;
     std::unordered_map<uint32, std::unordered_set<uint32>> _pvpStatIdsByMap;
+
+    void ClearSerializedHotfixes()
+    {
+        std::unique_lock lock(_serializedHotfixesLock);
+        for (auto& records : _serializedRecords)
+            records.clear();
+        for (auto& pushes : _serializedHotfixPushes)
+            pushes.clear();
+    }
 }
 
-static void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector<std::string>& errlist, StorageMap& stores, DB2StorageBase* storage, std::string const& db2Path,
-    LocaleConstant defaultLocale, std::size_t cppRecordSize)
+// Only touches storage and errlist, stores are loaded in parallel
+static void LoadDB2(std::bitset<TOTAL_LOCALES> const& availableDb2Locales, std::vector<std::string>& errlist, DB2StorageBase* storage, std::string const& db2Path,
+    LocaleConstant defaultLocale, std::size_t cppRecordSize, bool mapFiles)
 {
     // validate structure
     {
@@ -584,7 +608,7 @@ static void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector
 
     try
     {
-        storage->Load(db2Path + localeNames[defaultLocale] + '/', defaultLocale);
+        storage->Load(db2Path + localeNames[defaultLocale] + '/', defaultLocale, mapFiles);
     }
     catch (std::system_error const& e)
     {
@@ -630,7 +654,7 @@ static void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector
         if (availableDb2Locales[i])
             storage->LoadStringsFromDB(i);
 
-    stores[storage->GetTableHash()] = storage;
+    storage->InternStrings();
 }
 
 DB2Manager& DB2Manager::Instance()
@@ -648,12 +672,24 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
     std::vector<std::string> loadErrors;
     std::bitset<TOTAL_LOCALES> availableDb2Locales = [&]()
     {
+        // an empty list loads every locale found in the data directory
+        std::bitset<TOTAL_LOCALES> configuredLocales;
+        std::string configuredLocaleNames = sConfigMgr->GetStringDefault("Load.DB2Locales"sv, ""sv);
+        for (std::string_view localeName : Trinity::Tokenize(configuredLocaleNames, ' ', false))
+        {
+            LocaleConstant locale = GetLocaleByName(localeName);
+            if (IsValidLocale(locale))
+                configuredLocales[locale] = true;
+            else
+                TC_LOG_ERROR("server.loading", "Load.DB2Locales contains unknown locale {}, skipped", localeName);
+        }
+
         std::bitset<TOTAL_LOCALES> foundLocales;
         boost::filesystem::directory_iterator db2PathItr(db2Path), end;
         while (db2PathItr != end)
         {
             LocaleConstant locale = GetLocaleByName(db2PathItr->path().filename().string());
-            if (IsValidLocale(locale) && (sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) || locale == defaultLocale))
+            if (IsValidLocale(locale) && ((sWorld->getBoolConfig(CONFIG_LOAD_LOCALES) && (configuredLocales.none() || configuredLocales[locale])) || locale == defaultLocale))
                 foundLocales[locale] = true;
 
             ++db2PathItr;
@@ -664,9 +700,18 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
     if (!availableDb2Locales[defaultLocale])
         return 0;
 
+    struct StoreLoad
+    {
+        DB2StorageBase* Storage;
+        std::size_t RecordSize;
+        std::vector<std::string> Errors;
+        std::exception_ptr Exception;
+    };
+
+    std::vector<StoreLoad> storeLoads;
     auto LOAD_DB2 = [&]<typename T>(DB2Storage<T>& store)
     {
-        LoadDB2(availableDb2Locales, loadErrors, _stores, &store, db2Path, defaultLocale, sizeof(T));
+        storeLoads.push_back({ .Storage = &store, .RecordSize = sizeof(T), .Errors = {}, .Exception = nullptr });
     };
 
     LOAD_DB2(sAchievementStore);
@@ -1030,6 +1075,37 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
     LOAD_DB2(sWorldMapOverlayStore);
     LOAD_DB2(sWorldStateExpressionStore);
 
+    // every store reads its own files and hotfix tables, each thread queries over its own hotfix database connection
+    std::size_t threadCount = std::min<std::size_t>(sWorld->getIntConfig(CONFIG_STARTUP_LOADER_THREADS), HotfixDatabase.GetSynchConnectionCount());
+    bool mapFiles = sWorld->getBoolConfig(CONFIG_LOAD_MAP_DB2_FILES);
+    Trinity::TaskGraph loaders;
+    for (StoreLoad& storeLoad : storeLoads)
+    {
+        loaders.Add(storeLoad.Storage->GetFileName(), [&]
+        {
+            try
+            {
+                LoadDB2(availableDb2Locales, storeLoad.Errors, storeLoad.Storage, db2Path, defaultLocale, storeLoad.RecordSize, mapFiles);
+            }
+            catch (...)
+            {
+                storeLoad.Exception = std::current_exception();
+            }
+        });
+    }
+
+    loaders.Run(threadCount);
+
+    // errors are reported in the same order as if the stores were loaded one after another
+    for (StoreLoad& storeLoad : storeLoads)
+    {
+        if (storeLoad.Exception)
+            std::rethrow_exception(storeLoad.Exception);
+
+        std::ranges::move(storeLoad.Errors, std::back_inserter(loadErrors));
+        _stores[storeLoad.Storage->GetTableHash()] = storeLoad.Storage;
+    }
+
     // error checks
 
     // Check loaded DB2 files proper version
@@ -1047,7 +1123,8 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
         return 0;
     }
 
-    TC_LOG_INFO("server.loading", ">> Initialized {} DB2 data stores in {} ms", _stores.size(), GetMSTimeDiffToNow(oldMSTime));
+    TC_LOG_INFO("server.loading", ">> Initialized {} DB2 data stores in {} ms on {} thread(s)", _stores.size(), GetMSTimeDiffToNow(oldMSTime), threadCount);
+    TC_LOG_INFO("server.loading", ">> Kept {} distinct DB2 strings in {} KB", sDB2StringArena.GetStringCount(), sDB2StringArena.GetMemoryUsage() / 1024);
 
     return availableDb2Locales.to_ulong();
 }
@@ -1744,6 +1821,9 @@ void DB2Manager::LoadHotfixData(uint32 localeMask)
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearSerializedHotfixes();
+    Trinity::Hyperlinks::ClearValidatedLinkCache();
+
     QueryResult result = HotfixDatabase.Query("SELECT Id, UniqueId, TableHash, RecordId, Status FROM hotfix_data ORDER BY Id");
 
     if (!result)
@@ -1814,6 +1894,8 @@ void DB2Manager::LoadHotfixBlob(uint32 localeMask)
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearSerializedHotfixes();
+
     QueryResult result = HotfixDatabase.Query("SELECT TableHash, RecordId, locale, `Blob` FROM hotfix_blob ORDER BY TableHash");
 
     if (!result)
@@ -1869,6 +1951,8 @@ void DB2Manager::LoadHotfixOptionalData(uint32 localeMask)
 
     uint32 oldMSTime = getMSTime();
 
+    ClearSerializedHotfixes();
+
     QueryResult result = HotfixDatabase.Query("SELECT TableHash, RecordId, locale, `Key`, `Data` FROM hotfix_optional_data ORDER BY TableHash");
 
     if (!result)
@@ -1963,6 +2047,87 @@ std::vector<DB2Manager::HotfixOptionalData> const* DB2Manager::GetHotfixOptional
     return Trinity::Containers::MapGetValuePtr(_hotfixOptionalData[locale], std::make_pair(tableHash, recordId));
 }
 
+std::shared_ptr<std::vector<uint8> const> DB2Manager::GetSerializedRecord(uint32 tableHash, uint32 recordId, LocaleConstant locale) const
+{
+    ASSERT(IsValidLocale(locale), "Locale %u is invalid locale", uint32(locale));
+
+    HotfixBlobKey key(tableHash, int32(recordId));
+    {
+        std::shared_lock lock(_serializedHotfixesLock);
+        if (std::shared_ptr<std::vector<uint8> const> record = Trinity::Containers::MapGetValuePtr(_serializedRecords[locale], key))
+            return record;
+    }
+
+    DB2StorageBase const* storage = GetStorage(tableHash);
+    if (!storage || !storage->HasRecord(recordId))
+        return nullptr;
+
+    ByteBuffer buffer;
+    storage->WriteRecord(recordId, locale, buffer);
+    if (std::vector<HotfixOptionalData> const* optionalDataEntries = GetHotfixOptionalData(tableHash, int32(recordId), locale))
+    {
+        for (HotfixOptionalData const& optionalData : *optionalDataEntries)
+        {
+            buffer << uint32(optionalData.Key);
+            buffer.append(optionalData.Data.data(), optionalData.Data.size());
+        }
+    }
+
+    std::shared_ptr<std::vector<uint8> const> record = std::make_shared<std::vector<uint8> const>(std::move(buffer).Release());
+
+    // clients may ask for any record, only so many are kept
+    std::unique_lock lock(_serializedHotfixesLock);
+    if (_serializedRecords[locale].size() < MaxSerializedRecordsPerLocale)
+        return _serializedRecords[locale].try_emplace(key, std::move(record)).first->second;
+
+    return record;
+}
+
+std::shared_ptr<DB2Manager::SerializedHotfixPush const> DB2Manager::GetSerializedHotfixPush(int32 pushId, LocaleConstant locale) const
+{
+    ASSERT(IsValidLocale(locale), "Locale %u is invalid locale", uint32(locale));
+
+    {
+        std::shared_lock lock(_serializedHotfixesLock);
+        if (std::shared_ptr<SerializedHotfixPush const> push = Trinity::Containers::MapGetValuePtr(_serializedHotfixPushes[locale], pushId))
+            return push;
+    }
+
+    HotfixPush const* hotfixRecords = Trinity::Containers::MapGetValuePtr(_hotfixData, pushId);
+    if (!hotfixRecords)
+        return nullptr;
+
+    std::shared_ptr<SerializedHotfixPush> push = std::make_shared<SerializedHotfixPush>();
+    for (HotfixRecord const& hotfixRecord : hotfixRecords->Records)
+    {
+        if (!(hotfixRecord.AvailableLocalesMask & (1 << locale)))
+            continue;
+
+        SerializedHotfix& hotfix = push->Hotfixes.emplace_back();
+        hotfix.Record = hotfixRecord;
+        if (hotfixRecord.HotfixStatus != HotfixRecord::Status::Valid)
+            continue;
+
+        DB2StorageBase const* storage = GetStorage(hotfixRecord.TableHash);
+        if (std::shared_ptr<std::vector<uint8> const> record = storage ? GetSerializedRecord(hotfixRecord.TableHash, uint32(hotfixRecord.RecordID), locale) : nullptr)
+        {
+            hotfix.Size = record->size();
+            push->Content.insert(push->Content.end(), record->begin(), record->end());
+        }
+        else if (std::vector<uint8> const* blobData = GetHotfixBlobData(hotfixRecord.TableHash, hotfixRecord.RecordID, locale))
+        {
+            hotfix.Size = blobData->size();
+            push->Content.insert(push->Content.end(), blobData->begin(), blobData->end());
+        }
+        else
+            // Do not send Status::Valid when we don't have a hotfix blob for current locale
+            hotfix.Record.HotfixStatus = storage ? HotfixRecord::Status::RecordRemoved : HotfixRecord::Status::Invalid;
+    }
+
+    std::unique_lock lock(_serializedHotfixesLock);
+    return _serializedHotfixPushes[locale].try_emplace(pushId, std::move(push)).first->second;
+}
+
 uint32 DB2Manager::GetEmptyAnimStateID() const
 {
     return sAnimationDataStore.GetNumRows();
@@ -1977,6 +2142,8 @@ void DB2Manager::InsertNewHotfix(uint32 tableHash, uint32 recordId)
     hotfixRecord.ID.UniqueID = rand32();
     hotfixRecord.AvailableLocalesMask = 0xDFF;
 
+    ClearSerializedHotfixes();
+
     HotfixPush& push = _hotfixData[hotfixRecord.ID.PushID];
     push.Records.push_back(hotfixRecord);
     push.AvailableLocalesMask |= hotfixRecord.AvailableLocalesMask;
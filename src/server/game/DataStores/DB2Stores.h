@@ -24,6 +24,7 @@
 #include "SharedDefines.h"
 #include "advstd.h"
 #include <map>
+#include <memory>
 #include <set>
 #include <span>
 #include <unordered_set>
@@ -425,6 +426,19 @@ public:
 
     using HotfixContainer = std::map<int32, HotfixPush>;
 
+    struct SerializedHotfix
+    {
+        HotfixRecord Record;
+        uint32 Size = 0;
+    };
+
+    // Everything SMSG_HOTFIX_CONNECT sends for one push in one locale
+    struct SerializedHotfixPush
+    {
+        std::vector<SerializedHotfix> Hotfixes;
+        std::vector<uint8> Content;
+    };
+
     using FriendshipRepReactionSet = std::set<FriendshipRepReactionEntry const*, FriendshipRepReactionEntryComparator>;
     using MapDifficultyConditionsContainer = std::vector<std::pair<uint32, PlayerConditionEntry const*>>;
     using MountTypeXCapabilitySet = std::set<MountTypeXCapabilityEntry const*, MountTypeXCapabilityEntryComparator>;
@@ -443,6 +457,9 @@ public:
     HotfixContainer const& GetHotfixData() const;
     std::vector<uint8> const* GetHotfixBlobData(uint32 tableHash, int32 recordId, LocaleConstant locale) const;
     std::vector<HotfixOptionalData> const* GetHotfixOptionalData(uint32 tableHash, int32 recordId, LocaleConstant locale) const;
+    // Record followed by its optional data as sent to clients, serialized once per locale. Null if the store has no such record
+    std::shared_ptr<std::vector<uint8> const> GetSerializedRecord(uint32 tableHash, uint32 recordId, LocaleConstant locale) const;
+    std::shared_ptr<SerializedHotfixPush const> GetSerializedHotfixPush(int32 pushId, LocaleConstant locale) const;
 
     uint32 GetEmptyAnimStateID() const;
     std::vector<uint32> GetAreasForGroup(uint32 areaGroupId) const;
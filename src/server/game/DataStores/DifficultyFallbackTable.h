@@ -0,0 +1,140 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_DIFFICULTY_FALLBACK_TABLE_H
+#define TRINITYCORE_DIFFICULTY_FALLBACK_TABLE_H
+
+#include "DBCEnums.h"
+#include "Optional.h"
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <vector>
+
+/*
+ * Values stored per id and difficulty, looked up with the difficulty fallback chain already applied:
+ * a difficulty without its own value resolves to the value of the first difficulty of its chain that has one.
+ *
+ * Lookups index a dense array by id, then a row mapping every difficulty to one of the values of that id.
+ * Rows only depend on which difficulties an id has values for and are shared between ids, most ids only
+ * have a DIFFICULTY_NONE value and use the same row.
+ */
+template<typename T>
+class DifficultyFallbackTable
+{
+    static constexpr std::size_t DifficultyCount = std::numeric_limits<std::underlying_type_t<Difficulty>>::max() + 1;
+    static constexpr uint8 NoValue = 0xFF;
+
+public:
+    //! values must be sorted by id, then difficulty. getFallback returns the next difficulty of a chain, nothing where the chain ends
+    template<typename FallbackGetter>
+    void Build(std::vector<std::tuple<uint32, Difficulty, T const*>> const& values, FallbackGetter getFallback)
+    {
+        Clear();
+        if (values.empty())
+            return;
+
+        _ids.resize(std::get<0>(values.back()) + 1, Entry{ .FirstValue = 0, .Row = 0 });
+
+        // row 0 resolves nothing, it is used by every id without values
+        _rows.assign(DifficultyCount, NoValue);
+        std::map<std::vector<Difficulty>, uint32> rowsByDifficulties;
+
+        for (auto itr = values.begin(); itr != values.end();)
+        {
+            uint32 id = std::get<0>(*itr);
+            std::vector<Difficulty> difficulties;
+            Entry& entry = _ids[id];
+            entry.FirstValue = _values.size();
+            for (; itr != values.end() && std::get<0>(*itr) == id; ++itr)
+            {
+                difficulties.push_back(std::get<1>(*itr));
+                _values.push_back(std::get<2>(*itr));
+            }
+
+            auto [row, inserted] = rowsByDifficulties.try_emplace(std::move(difficulties), uint32(_rows.size()));
+            if (inserted)
+                AddRow(row->first, getFallback);
+
+            entry.Row = row->second;
+        }
+    }
+
+    void Clear()
+    {
+        _ids.clear();
+        _values.clear();
+        _rows.clear();
+    }
+
+    bool IsEmpty() const { return _ids.empty(); }
+
+    T const* Find(uint32 id, Difficulty difficulty) const
+    {
+        if (id >= _ids.size())
+            return nullptr;
+
+        Entry const& entry = _ids[id];
+        uint8 value = _rows[entry.Row + difficulty];
+        return value != NoValue ? _values[entry.FirstValue + value] : nullptr;
+    }
+
+private:
+    struct Entry
+    {
+        uint32 FirstValue;
+        uint32 Row;
+    };
+
+    template<typename FallbackGetter>
+    void AddRow(std::vector<Difficulty> const& difficulties, FallbackGetter& getFallback)
+    {
+        auto indexOf = [&](Difficulty difficulty) -> uint8
+        {
+            auto itr = std::ranges::find(difficulties, difficulty);
+            // ids with more values than a row can address keep the first ones
+            if (itr == difficulties.end() || itr - difficulties.begin() >= NoValue)
+                return NoValue;
+            return uint8(itr - difficulties.begin());
+        };
+
+        for (std::size_t i = 0; i < DifficultyCount; ++i)
+        {
+            Difficulty difficulty = Difficulty(i);
+            uint8 value = indexOf(difficulty);
+            // chains are bounded by the number of difficulties in case the data contains a loop
+            for (std::size_t step = 0; value == NoValue && step < DifficultyCount; ++step)
+            {
+                Optional<Difficulty> fallback = getFallback(difficulty);
+                if (!fallback)
+                    break;
+
+                difficulty = *fallback;
+                value = indexOf(difficulty);
+            }
+
+            _rows.push_back(value);
+        }
+    }
+
+    std::vector<Entry> _ids;
+    std::vector<T const*> _values;
+    std::vector<uint8> _rows;
+};
+
+#endif // TRINITYCORE_DIFFICULTY_FALLBACK_TABLE_H
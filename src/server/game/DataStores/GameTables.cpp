@@ -19,10 +19,13 @@
 #include "ItemTemplate.h"
 #include "Timer.h"
 #include "Log.h"
+#include "Optional.h"
 #include "StringConvert.h"
 #include "Util.h"
+#include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
-#include <fstream>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <sstream>
 
 GameTable<GtArtifactKnowledgeMultiplierEntry>   sArtifactKnowledgeMultiplierGameTable;
@@ -40,21 +43,53 @@ GameTable<GtSpellScalingEntry>                  sSpellScalingGameTable;
 GameTable<GtStaminaMultByILvl>                  sStaminaMultByILvlGameTable;
 GameTable<GtXpEntry>                            sXpGameTable;
 
+namespace
+{
+struct GameTableUsage
+{
+    char const* FileName;
+    std::function<bool()> IsLoaded;
+};
+
+std::vector<GameTableUsage> GameTableUsages;
+}
+
 template<class T>
-inline uint32 LoadGameTable(std::vector<std::string>& errors, GameTable<T>& storage, boost::filesystem::path const& path)
+Optional<std::vector<T>> ParseGameTable(std::vector<std::string>& errors, boost::filesystem::path const& path)
 {
-    std::ifstream stream(path.string());
-    if (!stream)
+    boost::interprocess::mapped_region region;
+    try
     {
-        errors.push_back(Trinity::StringFormat("GameTable file {} cannot be opened.", path.string()));
-        return 0;
+        boost::interprocess::file_mapping file(path.string().c_str(), boost::interprocess::read_only);
+        region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const&)
+    {
+        errors.push_back(Trinity::StringFormat("GameTable file {} cannot be opened or is empty.", path.string()));
+        return {};
     }
 
-    std::string headers;
-    if (!std::getline(stream, headers))
+    std::string_view contents(static_cast<char const*>(region.get_address()), region.get_size());
+    auto getLine = [&contents](std::string_view& line)
+    {
+        if (contents.empty())
+            return false;
+
+        std::size_t end = contents.find('\n');
+        line = contents.substr(0, end);
+        contents.remove_prefix(end != std::string_view::npos ? end + 1 : contents.size());
+
+        // file extracted from client will always have CRLF line endings
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        return true;
+    };
+
+    std::string_view headers;
+    if (!getLine(headers))
     {
         errors.push_back(Trinity::StringFormat("GameTable file {} is empty.", path.string()));
-        return 0;
+        return {};
     }
 
     std::vector<std::string_view> columnDefs = Trinity::Tokenize(headers, '\t', false);
@@ -66,10 +101,9 @@ inline uint32 LoadGameTable(std::vector<std::string>& errors, GameTable<T>& stor
     std::vector<T> data;
     data.emplace_back(); // row id 0, unused
 
-    std::string line;
-    while (std::getline(stream, line))
+    std::string_view line;
+    while (getLine(line))
     {
-        RemoveCRLF(line); // file extracted from client will always have CRLF line endings, on linux opening file in text mode will not work, manually erase \r
         std::vector<std::string_view> values = Trinity::Tokenize(line, '\t', true);
         if (values.empty())
             break;
@@ -97,11 +131,43 @@ inline uint32 LoadGameTable(std::vector<std::string>& errors, GameTable<T>& stor
             *row++ = Trinity::StringTo<float>(*itr, 10).value_or(0.0f);
     }
 
-    storage.SetData(std::move(data));
+    return data;
+}
+
+template<class T>
+inline uint32 LoadGameTable(std::vector<std::string>& errors, GameTable<T>& storage, boost::filesystem::path const& path, bool lazy)
+{
+    if (!lazy)
+    {
+        Optional<std::vector<T>> data = ParseGameTable<T>(errors, path);
+        if (!data)
+            return 0;
+
+        storage.SetData(std::move(*data));
+        return 1;
+    }
+
+    if (!boost::filesystem::is_regular_file(path))
+    {
+        errors.push_back(Trinity::StringFormat("GameTable file {} cannot be opened.", path.string()));
+        return 0;
+    }
+
+    storage.SetLoader([path]
+    {
+        uint32 oldMSTime = getMSTime();
+
+        std::vector<std::string> errors;
+        Optional<std::vector<T>> data = ParseGameTable<T>(errors, path);
+        WPFatal(data.has_value(), "%s", errors.front().c_str());
+
+        TC_LOG_INFO("server.loading", ">> Loaded GameTable {} on first use in {} ms", path.filename().string(), GetMSTimeDiffToNow(oldMSTime));
+        return std::move(*data);
+    });
     return 1;
 }
 
-void LoadGameTables(std::string const& dataPath)
+void LoadGameTables(std::string const& dataPath, bool lazy)
 {
     uint32 oldMSTime = getMSTime();
 
@@ -110,11 +176,13 @@ void LoadGameTables(std::string const& dataPath)
 
     std::vector<std::string> bad_gt_files;
     uint32 gameTableCount = 0, expectedGameTableCount = 0;
+    GameTableUsages.clear();
 
     auto LOAD_GT = [&]<typename T>(GameTable<T>& gameTable, char const* file)
     {
-        gameTableCount += LoadGameTable(bad_gt_files, gameTable, gtPath / file);
+        gameTableCount += LoadGameTable(bad_gt_files, gameTable, gtPath / file, lazy);
         ++expectedGameTableCount;
+        GameTableUsages.push_back({ .FileName = file, .IsLoaded = [&gameTable] { return gameTable.IsLoaded(); } });
     };
 
     LOAD_GT(sArtifactKnowledgeMultiplierGameTable, "ArtifactKnowledgeMultiplier.txt");
@@ -147,6 +215,26 @@ void LoadGameTables(std::string const& dataPath)
     TC_LOG_INFO("server.loading", ">> Initialized {} GameTables in {} ms", gameTableCount, GetMSTimeDiffToNow(oldMSTime));
 }
 
+void ReportGameTableUsage()
+{
+    std::string unused;
+    uint32 usedCount = 0;
+    for (GameTableUsage const& usage : GameTableUsages)
+    {
+        if (usage.IsLoaded())
+        {
+            ++usedCount;
+            continue;
+        }
+
+        if (!unused.empty())
+            unused += ", ";
+        unused += usage.FileName;
+    }
+
+    TC_LOG_INFO("server.loading", ">> {} of {} GameTables were read so far, not read: {}", usedCount, GameTableUsages.size(), !unused.empty() ? unused : "none");
+}
+
 template<class T>
 float GetIlvlStatMultiplier(T const* row, InventoryType invType)
 {
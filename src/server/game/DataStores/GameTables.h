@@ -20,6 +20,9 @@
 
 #include "SharedDefines.h"
 #include "Common.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <vector>
 
 enum InventoryType : uint8;
@@ -176,20 +179,50 @@ template<class T>
 class GameTable
 {
 public:
+    GameTable() : _loaded(false) { }
+
     T const* GetRow(uint32 row) const
     {
-        if (row >= _data.size())
+        std::vector<T> const& data = GetData();
+        if (row >= data.size())
             return nullptr;
 
-        return &_data[row];
+        return &data[row];
+    }
+
+    std::size_t GetTableRowCount() const { return GetData().size(); }
+
+    void SetData(std::vector<T> data)
+    {
+        _data = std::move(data);
+        _loaded.store(true, std::memory_order_release);
     }
 
-    std::size_t GetTableRowCount() const { return _data.size(); }
+    // Defers parsing the table to the first access of its rows, from whichever thread that happens on
+    void SetLoader(std::function<std::vector<T>()> loader) { _loader = std::move(loader); }
 
-    void SetData(std::vector<T> data) { _data = std::move(data); }
+    bool IsLoaded() const { return _loaded.load(std::memory_order_acquire); }
 
 private:
-    std::vector<T> _data;
+    std::vector<T> const& GetData() const
+    {
+        if (!IsLoaded())
+        {
+            std::call_once(_loadOnce, [this]
+            {
+                if (_loader)
+                    _data = _loader();
+                _loaded.store(true, std::memory_order_release);
+            });
+        }
+
+        return _data;
+    }
+
+    mutable std::vector<T> _data;
+    mutable std::once_flag _loadOnce;
+    mutable std::atomic<bool> _loaded;
+    std::function<std::vector<T>()> _loader;
 };
 
 TC_GAME_API extern GameTable<GtArtifactKnowledgeMultiplierEntry>    sArtifactKnowledgeMultiplierGameTable;
@@ -207,7 +240,10 @@ TC_GAME_API extern GameTable<GtSpellScalingEntry>                   sSpellScalin
 TC_GAME_API extern GameTable<GtStaminaMultByILvl>                   sStaminaMultByILvlGameTable;
 TC_GAME_API extern GameTable<GtXpEntry>                             sXpGameTable;
 
-TC_GAME_API void LoadGameTables(std::string const& dataPath);
+// With lazy set the files are only checked to exist, each table is parsed the first time its rows are read
+TC_GAME_API void LoadGameTables(std::string const& dataPath, bool lazy);
+// Logs which GameTables were read so far, the ones that weren't are not needed by the content of this server
+TC_GAME_API void ReportGameTableUsage();
 
 template<class T>
 inline float GetGameTableColumnForClass(T const* row, int32 class_)
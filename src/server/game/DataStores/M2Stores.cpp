@@ -22,13 +22,20 @@
 #include "MapUtils.h"
 #include "Timer.h"
 #include <G3D/Vector4.h>
-#include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
-#include <fstream>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <mutex>
+#include <unordered_set>
 
 typedef std::vector<FlyByCamera> FlyByCameraCollection;
 std::unordered_map<uint32, FlyByCameraCollection> sFlyByCameraStore;
 
+// Set when cameras are loaded on first use, the elements of the store never move once they were inserted
+boost::filesystem::path sLazyCamerasPath;
+std::unordered_set<uint32> sFlyByCameraLoadedIds;
+std::mutex sFlyByCameraLock;
+
 // Convert the geomoetry from a spline value, to an actual WoW XYZ
 G3D::Vector3 translateLocation(G3D::Vector4 const* dbcLocation, G3D::Vector3 const* basePosition, G3D::Vector3 const* splineVector)
 {
@@ -172,98 +179,110 @@ bool readCamera(M2Camera const* cam, uint32 buffSize, M2Header const* header, Ci
     return true;
 }
 
-TC_GAME_API void LoadM2Cameras(std::string const& dataPath)
+static void LoadM2Camera(boost::filesystem::path const& camerasPath, CinematicCameraEntry const* cameraEntry)
 {
-    sFlyByCameraStore.clear();
-    TC_LOG_INFO("server.loading", ">> Loading Cinematic Camera files");
+    boost::filesystem::path filename = camerasPath / Trinity::StringFormat("FILE{:08X}.xxx", cameraEntry->FileDataID);
 
-    boost::filesystem::path camerasPath = boost::filesystem::path(dataPath) / "cameras";
+    // Convert to native format
+    filename.make_preferred();
 
-    uint32 oldMSTime = getMSTime();
-    for (CinematicCameraEntry const* cameraEntry : sCinematicCameraStore)
+    // The file is only read while parsing it, map it instead of copying it
+    boost::interprocess::mapped_region region;
+    try
     {
-        boost::filesystem::path filename = camerasPath / Trinity::StringFormat("FILE{:08X}.xxx", cameraEntry->FileDataID);
+        boost::interprocess::file_mapping m2file(filename.string().c_str(), boost::interprocess::read_only);
+        region = boost::interprocess::mapped_region(m2file, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const&)
+    {
+        return;
+    }
 
-        // Convert to native format
-        filename.make_preferred();
+    char const* buffer = static_cast<char const*>(region.get_address());
+    std::size_t fileSize = region.get_size();
 
-        std::ifstream m2file(filename.string().c_str(), std::ios::in | std::ios::binary);
-        if (!m2file.is_open())
-            continue;
+    // Reject if not at least the size of the header
+    if (fileSize < sizeof(M2Header) + 4)
+    {
+        TC_LOG_ERROR("server.loading", "Camera file {} is damaged. File is smaller than header size", filename.string());
+        return;
+    }
 
-        // Get file size
-        std::streamoff fileSize = boost::filesystem::file_size(filename);
+    // Check file has correct magic (MD21)
+    if (memcmp(buffer, "MD21", 4))
+    {
+        TC_LOG_ERROR("server.loading", "Camera file {} is damaged. File identifier not found.", filename.string());
+        return;
+    }
 
-        // Reject if not at least the size of the header
-        if (static_cast<uint32>(fileSize) < sizeof(M2Header) + 4)
+    bool fileValid = true;
+    uint32 m2start = 0;
+    char const* ptr = buffer;
+    while (m2start + 4 < fileSize && memcmp(ptr, "MD20", 4) != 0)
+    {
+        ++m2start;
+        ++ptr;
+        if (m2start + sizeof(M2Header) > fileSize)
         {
-            TC_LOG_ERROR("server.loading", "Camera file {} is damaged. File is smaller than header size", filename.string());
-            m2file.close();
-            continue;
+            fileValid = false;
+            break;
         }
+    }
 
-        // Read 4 bytes (signature)
-        char fileCheck[5];
-        m2file.read(fileCheck, 4);
-        fileCheck[4] = '\0';
+    if (!fileValid)
+    {
+        TC_LOG_ERROR("server.loading", "Camera file {} is damaged. File is smaller than header size.", filename.string());
+        return;
+    }
 
-        // Check file has correct magic (MD21)
-        if (strcmp(fileCheck, "MD21"))
-        {
-            TC_LOG_ERROR("server.loading", "Camera file {} is damaged. File identifier not found.", filename.string());
-            m2file.close();
-            continue;
-        }
+    // Read header
+    M2Header const* header = reinterpret_cast<M2Header const*>(buffer + m2start);
 
-        // Now we have a good file, read it all into a vector of char's, then close the file.
-        std::vector<char> buffer(fileSize);
-        m2file.seekg(0, std::ios::beg);
-        if (!m2file.read(buffer.data(), fileSize))
-        {
-            m2file.close();
-            continue;
-        }
-        m2file.close();
+    if (m2start + header->ofsCameras + sizeof(M2Camera) > fileSize)
+    {
+        TC_LOG_ERROR("server.loading", "Camera file {} is damaged. Camera references position beyond file end", filename.string());
+        return;
+    }
 
-        bool fileValid = true;
-        uint32 m2start = 0;
-        char const* ptr = buffer.data();
-        while (m2start + 4 < buffer.size() && memcmp(ptr, "MD20", 4) != 0)
-        {
-            ++m2start;
-            ++ptr;
-            if (m2start + sizeof(M2Header) > buffer.size())
-            {
-                fileValid = false;
-                break;
-            }
-        }
+    // Get camera(s) - Main header, then dump them.
+    M2Camera const* cam = reinterpret_cast<M2Camera const*>(buffer + m2start + header->ofsCameras);
+    if (!readCamera(cam, uint32(fileSize - m2start), header, cameraEntry))
+        TC_LOG_ERROR("server.loading", "Camera file {} is damaged. Camera references position beyond file end", filename.string());
+}
 
-        if (!fileValid)
-        {
-            TC_LOG_ERROR("server.loading", "Camera file {} is damaged. File is smaller than header size.", filename.string());
-            continue;
-        }
+TC_GAME_API void LoadM2Cameras(std::string const& dataPath, bool lazy)
+{
+    sFlyByCameraStore.clear();
+    sFlyByCameraLoadedIds.clear();
+    sLazyCamerasPath.clear();
 
-        // Read header
-        M2Header const* header = reinterpret_cast<M2Header const*>(buffer.data() + m2start);
+    boost::filesystem::path camerasPath = boost::filesystem::path(dataPath) / "cameras";
+    if (lazy)
+    {
+        TC_LOG_INFO("server.loading", ">> Cinematic Camera files are loaded on first use");
+        sLazyCamerasPath = camerasPath;
+        return;
+    }
 
-        if (m2start + header->ofsCameras + sizeof(M2Camera) > static_cast<uint32>(fileSize))
-        {
-            TC_LOG_ERROR("server.loading", "Camera file {} is damaged. Camera references position beyond file end", filename.string());
-            continue;
-        }
+    TC_LOG_INFO("server.loading", ">> Loading Cinematic Camera files");
 
-        // Get camera(s) - Main header, then dump them.
-        M2Camera const* cam = reinterpret_cast<M2Camera const*>(buffer.data() + m2start + header->ofsCameras);
-        if (!readCamera(cam, fileSize - m2start, header, cameraEntry))
-            TC_LOG_ERROR("server.loading", "Camera file {} is damaged. Camera references position beyond file end", filename.string());
-    }
+    uint32 oldMSTime = getMSTime();
+    for (CinematicCameraEntry const* cameraEntry : sCinematicCameraStore)
+        LoadM2Camera(camerasPath, cameraEntry);
 
     TC_LOG_INFO("server.loading", ">> Loaded {} cinematic waypoint sets in {} ms", sFlyByCameraStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
 std::vector<FlyByCamera> const* GetFlyByCameras(uint32 cinematicCameraId)
 {
+    if (sLazyCamerasPath.empty())
+        return Trinity::Containers::MapGetValuePtr(sFlyByCameraStore, cinematicCameraId);
+
+    // players of any map can start a cinematic, loading the camera and reading the store is serialized
+    std::scoped_lock lock(sFlyByCameraLock);
+    if (sFlyByCameraLoadedIds.insert(cinematicCameraId).second)
+        if (CinematicCameraEntry const* cameraEntry = sCinematicCameraStore.LookupEntry(cinematicCameraId))
+            LoadM2Camera(sLazyCamerasPath, cameraEntry);
+
     return Trinity::Containers::MapGetValuePtr(sFlyByCameraStore, cinematicCameraId);
 }
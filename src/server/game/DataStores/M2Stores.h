@@ -28,7 +28,8 @@ struct FlyByCamera
     Position locations;
 };
 
-TC_GAME_API void LoadM2Cameras(std::string const& dataPath);
+// With lazy set each camera file is read the first time its cinematic is played
+TC_GAME_API void LoadM2Cameras(std::string const& dataPath, bool lazy);
 
 TC_GAME_API std::vector<FlyByCamera> const* GetFlyByCameras(uint32 cinematicCameraId);
 
@@ -0,0 +1,369 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LFGMatchmaker.h"
+#include <algorithm>
+#include <bit>
+
+namespace lfg
+{
+
+namespace
+{
+constexpr uint8 GetStateTanks(uint32 state) { return state & 1; }
+constexpr uint8 GetStateHealers(uint32 state) { return (state >> 1) & 1; }
+constexpr uint8 GetStateDps(uint32 state) { return state >> 2; }
+
+// states with a tank or a healer in them
+constexpr LfgMatchmaker::RoleStates ScarceRoleStates = 0xEEEE;
+
+// states of dps only players, by their count
+constexpr LfgMatchmaker::RoleStates GetDpsOnlyStates(uint8 dps) { return dps <= LFG_DPS_NEEDED ? 1 << (dps << 2) : 0; }
+
+// states that can still take the players of state 'added', adding two valid states is a plain sum of their indexes
+constexpr std::array<LfgMatchmaker::RoleStates, 16> CombinableStates = []()
+{
+    std::array<LfgMatchmaker::RoleStates, 16> combinable = { };
+    for (uint32 added = 0; added < 16; ++added)
+        for (uint32 state = 0; state < 16; ++state)
+            if (GetStateTanks(state) + GetStateTanks(added) <= LFG_TANKS_NEEDED
+                && GetStateHealers(state) + GetStateHealers(added) <= LFG_HEALERS_NEEDED
+                && GetStateDps(state) + GetStateDps(added) <= LFG_DPS_NEEDED)
+                combinable[added] |= 1 << state;
+
+    return combinable;
+}();
+}
+
+LfgMatchmaker::RoleStates LfgMatchmaker::GetRoleStates(uint8 roles)
+{
+    RoleStates states = 0;
+    if (roles & PLAYER_ROLE_TANK)
+        states |= 1 << 1;
+    if (roles & PLAYER_ROLE_HEALER)
+        states |= 1 << 2;
+    if (roles & PLAYER_ROLE_DAMAGE)
+        states |= 1 << 4;
+
+    return states;
+}
+
+LfgMatchmaker::RoleStates LfgMatchmaker::CombineRoleStates(RoleStates left, RoleStates right)
+{
+    RoleStates result = 0;
+    for (; right; right &= right - 1)
+    {
+        uint32 added = std::countr_zero(right);
+        result |= (left & CombinableStates[added]) << added;
+    }
+
+    return result;
+}
+
+LfgMatchmaker::LfgMatchmaker() : _scarceCandidates(0), _searchSteps(0) { }
+LfgMatchmaker::LfgMatchmaker(LfgMatchmaker&& other) noexcept = default;
+LfgMatchmaker& LfgMatchmaker::operator=(LfgMatchmaker&& right) noexcept = default;
+LfgMatchmaker::~LfgMatchmaker() = default;
+
+LfgMatchmaker::QueueId LfgMatchmaker::Add(ObjectGuid guid, LfgRolesMap const& roles, LfgDungeonSet const& dungeons, bool isLfgGroup)
+{
+    QueueId id;
+    if (!_freeIds.empty())
+    {
+        id = _freeIds.back();
+        _freeIds.pop_back();
+    }
+    else
+    {
+        id = QueueId(_entries.size());
+        _entries.emplace_back();
+    }
+
+    Entry& entry = _entries[id];
+    entry.Guid = guid;
+    entry.IsLfgGroup = isLfgGroup;
+
+    for (uint32 dungeonId : dungeons)
+    {
+        uint32 bit = _dungeonBits.emplace(dungeonId, uint32(_dungeonBits.size())).first->second;
+        if (entry.Dungeons.size() <= bit / 64)
+            entry.Dungeons.resize(bit / 64 + 1);
+
+        entry.Dungeons[bit / 64] |= UI64LIT(1) << (bit % 64);
+    }
+
+    // entries without players never match, they would only grow groups without filling them
+    entry.Players = uint8(std::min<std::size_t>(roles.size(), GroupSize + 1));
+    entry.Roles = roles.empty() ? 0 : NoPlayersRoleStates;
+    for (auto const& [playerGuid, playerRoles] : roles)
+        entry.Roles = CombineRoleStates(entry.Roles, GetRoleStates(playerRoles));
+
+    ResetBestGroup(entry, id);
+    return id;
+}
+
+void LfgMatchmaker::Remove(QueueId id)
+{
+    RemoveFromWaiting(id);
+
+    // best groups of others with this entry in it see the new generation and are dropped when they are used next
+    uint32 generation = _entries[id].Generation + 1;
+    _entries[id] = Entry();
+    _entries[id].Generation = generation;
+    _freeIds.push_back(id);
+}
+
+void LfgMatchmaker::AddToWaiting(QueueId id, bool front /*= false*/)
+{
+    Entry& entry = _entries[id];
+    if (entry.IsWaiting)
+        return;
+
+    entry.IsWaiting = true;
+    std::vector<QueueId>& waiting = _waiting[IsScarce(entry)];
+    if (front)
+        waiting.insert(waiting.begin(), id);
+    else
+        waiting.push_back(id);
+}
+
+void LfgMatchmaker::RemoveFromWaiting(QueueId id)
+{
+    Entry& entry = _entries[id];
+    if (!entry.IsWaiting)
+        return;
+
+    entry.IsWaiting = false;
+    std::vector<QueueId>& waiting = _waiting[IsScarce(entry)];
+    waiting.erase(std::ranges::find(waiting, id));
+}
+
+bool LfgMatchmaker::FindGroup(QueueId id, AcceptGroup const& accept)
+{
+    Entry const& entry = _entries[id];
+    _group.assign(1, id);
+
+    // full groups don't need anyone else, their roles were checked when they joined
+    if (entry.Players == GroupSize)
+        return accept(_group);
+
+    if (!entry.Roles || entry.Players > GroupSize)
+        return false;
+
+    // only waiting entries that fit with the new one on their own can be part of its group
+    // there are few tanks and healers, trying them first finds the group before the search runs out of steps on dps only combinations
+    _candidates.clear();
+    for (bool scarce : { true, false })
+    {
+        std::size_t maxCandidates = _candidates.size() + MaxCandidates;
+        for (QueueId other : _waiting[scarce])
+        {
+            Entry const& otherEntry = _entries[other];
+            if (other == id || entry.Players + otherEntry.Players > GroupSize || (entry.IsLfgGroup && otherEntry.IsLfgGroup))
+                continue;
+
+            if (!CombineRoleStates(entry.Roles, otherEntry.Roles) || !HasCommonDungeon(entry.Dungeons, otherEntry.Dungeons))
+                continue;
+
+            _candidates.push_back(other);
+            if (_candidates.size() == maxCandidates)
+                break;
+        }
+
+        if (scarce)
+            _scarceCandidates = _candidates.size();
+    }
+
+    _groupDungeons[0] = entry.Dungeons;
+    _searchSteps = 0;
+    return Search(0, entry.Players, entry.Roles, entry.IsLfgGroup, accept);
+}
+
+bool LfgMatchmaker::Search(std::size_t candidate, uint8 players, RoleStates roles, bool hasLfgGroup, AcceptGroup const& accept)
+{
+    for (; candidate < _candidates.size(); ++candidate)
+    {
+        // past the tanks and healers, a group still missing one of them can't be completed anymore
+        if (candidate == _scarceCandidates && !CombineRoleStates(roles, GetDpsOnlyStates(GroupSize - players)))
+        {
+            GrowBestGroup(candidate, players, roles, hasLfgGroup);
+            return false;
+        }
+
+        if (++_searchSteps > MaxSearchSteps)
+            return false;
+
+        QueueId id = _candidates[candidate];
+        Entry const& entry = _entries[id];
+        uint8 groupPlayers;
+        RoleStates groupRoles;
+        if (!CanJoin(entry, players, roles, hasLfgGroup, groupPlayers, groupRoles))
+            continue;
+
+        _group.push_back(id);
+        UpdateBestGroup(groupPlayers, groupRoles);
+
+        if (groupPlayers == GroupSize ? accept(_group) : Search(candidate + 1, groupPlayers, groupRoles, hasLfgGroup || entry.IsLfgGroup, accept))
+            return true;
+
+        _group.pop_back();
+    }
+
+    return false;
+}
+
+// Only for the queue status of the group's members, adds every dps that fits
+void LfgMatchmaker::GrowBestGroup(std::size_t candidate, uint8 players, RoleStates roles, bool hasLfgGroup)
+{
+    std::size_t size = _group.size();
+    for (; candidate < _candidates.size() && _group.size() < GroupSize; ++candidate)
+    {
+        if (++_searchSteps > MaxSearchSteps)
+            break;
+
+        Entry const& entry = _entries[_candidates[candidate]];
+        if (!CanJoin(entry, players, roles, hasLfgGroup, players, roles))
+            continue;
+
+        _group.push_back(_candidates[candidate]);
+        hasLfgGroup = hasLfgGroup || entry.IsLfgGroup;
+    }
+
+    if (_group.size() > size)
+        UpdateBestGroup(players, roles);
+
+    _group.resize(size);
+}
+
+bool LfgMatchmaker::CanJoin(Entry const& entry, uint8 players, RoleStates roles, bool hasLfgGroup, uint8& groupPlayers, RoleStates& groupRoles)
+{
+    if (players + entry.Players > GroupSize || (hasLfgGroup && entry.IsLfgGroup))
+        return false;
+
+    RoleStates combinedRoles = CombineRoleStates(roles, entry.Roles);
+    if (!combinedRoles)
+        return false;
+
+    std::size_t depth = _group.size();
+    if (!IntersectDungeons(_groupDungeons[depth - 1], entry.Dungeons, _groupDungeons[depth]))
+        return false;
+
+    groupPlayers = players + entry.Players;
+    groupRoles = combinedRoles;
+    return true;
+}
+
+bool LfgMatchmaker::IsScarce(Entry const& entry)
+{
+    return (entry.Roles & ScarceRoleStates) != 0;
+}
+
+bool LfgMatchmaker::HasCommonDungeon(std::vector<uint64> const& left, std::vector<uint64> const& right)
+{
+    for (std::size_t i = 0; i < left.size() && i < right.size(); ++i)
+        if (left[i] & right[i])
+            return true;
+
+    return false;
+}
+
+bool LfgMatchmaker::IntersectDungeons(std::vector<uint64> const& left, std::vector<uint64> const& right, std::vector<uint64>& result)
+{
+    result.resize(std::min(left.size(), right.size()));
+    uint64 any = 0;
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        result[i] = left[i] & right[i];
+        any |= result[i];
+    }
+
+    return any != 0;
+}
+
+void LfgMatchmaker::UpdateBestGroup(uint8 players, RoleStates roles)
+{
+    for (QueueId id : _group)
+    {
+        Entry& entry = _entries[id];
+        if (IsBestGroupValid(entry) && players <= entry.BestGroupPlayers)
+            continue;
+
+        for (std::size_t i = 0; i < _group.size(); ++i)
+        {
+            entry.BestGroup[i] = _group[i];
+            entry.BestGroupGenerations[i] = _entries[_group[i]].Generation;
+        }
+
+        entry.BestGroupSize = uint8(_group.size());
+        entry.BestGroupPlayers = players;
+        entry.BestGroupRoles = roles;
+    }
+}
+
+void LfgMatchmaker::ResetBestGroup(Entry& entry, QueueId id)
+{
+    entry.BestGroup[0] = id;
+    entry.BestGroupGenerations[0] = entry.Generation;
+    entry.BestGroupSize = 1;
+    entry.BestGroupPlayers = entry.Players;
+    entry.BestGroupRoles = entry.Roles;
+}
+
+std::vector<LfgMatchmaker::QueueId> LfgMatchmaker::GetWaiting() const
+{
+    std::vector<QueueId> waiting(_waiting[1]);
+    waiting.insert(waiting.end(), _waiting[0].begin(), _waiting[0].end());
+    return waiting;
+}
+
+bool LfgMatchmaker::IsBestGroupValid(Entry const& entry) const
+{
+    for (uint8 i = 0; i < entry.BestGroupSize; ++i)
+        if (_entries[entry.BestGroup[i]].Generation != entry.BestGroupGenerations[i])
+            return false;
+
+    return true;
+}
+
+std::vector<LfgMatchmaker::QueueId> LfgMatchmaker::GetBestGroup(QueueId id) const
+{
+    Entry const& entry = _entries[id];
+    if (!IsBestGroupValid(entry))
+        return { id };
+
+    return { entry.BestGroup.begin(), entry.BestGroup.begin() + entry.BestGroupSize };
+}
+
+void LfgMatchmaker::GetNeededRoles(QueueId id, uint8& tanks, uint8& healers, uint8& dps) const
+{
+    tanks = LFG_TANKS_NEEDED;
+    healers = LFG_HEALERS_NEEDED;
+    dps = LFG_DPS_NEEDED;
+
+    // same preference as LFGMgr::CheckGroupRoles, players that can tank or heal do that before anyone is dps
+    Entry const& entry = _entries[id];
+    RoleStates roles = IsBestGroupValid(entry) ? entry.BestGroupRoles : entry.Roles;
+    if (!roles)
+        return;
+
+    uint32 state = std::countr_zero(roles);
+    tanks -= GetStateTanks(state);
+    healers -= GetStateHealers(state);
+    dps -= GetStateDps(state);
+}
+
+} // namespace lfg
@@ -0,0 +1,137 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LFGMATCHMAKER_H
+#define _LFGMATCHMAKER_H
+
+#include "LFG.h"
+#include <array>
+#include <functional>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace lfg
+{
+
+/**
+    Finds full groups among the players and groups waiting in one queue.
+
+    Every queued player or group gets an integer id, its dungeons are kept as a bitset and its members
+    as the set of role counts (tanks, healers, dps) they can fill together. Joining and leaving only
+    touch the entry itself, a search for a new entry only combines the waiting entries that fit with
+    it on their own and gives up after MaxSearchSteps combinations.
+*/
+class TC_GAME_API LfgMatchmaker
+{
+    public:
+        using QueueId = uint32;
+        static constexpr QueueId InvalidQueueId = std::numeric_limits<QueueId>::max();
+
+        static constexpr uint8 GroupSize = LFG_TANKS_NEEDED + LFG_HEALERS_NEEDED + LFG_DPS_NEEDED;
+
+        // combinations tried for one new entry, if none of them matched it keeps waiting for the next ones
+        static constexpr uint32 MaxSearchSteps = 1024;
+        // waiting entries the new one is combined with, per tank/healer and dps only entries, oldest first
+        static constexpr std::size_t MaxCandidates = 128;
+
+        /// One bit for every (tanks, healers, dps) count a set of players can fill, bit index is tanks | healers << 1 | dps << 2
+        using RoleStates = uint16;
+
+        static constexpr RoleStates NoPlayersRoleStates = 1;
+
+        /// Role counts a single player with the given PLAYER_ROLE_* flags can fill
+        static RoleStates GetRoleStates(uint8 roles);
+        /// Role counts two sets of players can fill together, 0 if they can't be in the same group
+        static RoleStates CombineRoleStates(RoleStates left, RoleStates right);
+
+        /// Called with every full group found, decides about the conditions not known here (ignores, player states) and creates the proposal
+        using AcceptGroup = std::function<bool(std::span<QueueId const> group)>;
+
+        LfgMatchmaker();
+        LfgMatchmaker(LfgMatchmaker const&) = delete;
+        LfgMatchmaker(LfgMatchmaker&& other) noexcept;
+        LfgMatchmaker& operator=(LfgMatchmaker const&) = delete;
+        LfgMatchmaker& operator=(LfgMatchmaker&& right) noexcept;
+        ~LfgMatchmaker();
+
+        QueueId Add(ObjectGuid guid, LfgRolesMap const& roles, LfgDungeonSet const& dungeons, bool isLfgGroup);
+        void Remove(QueueId id);
+
+        /// Waiting entries are the ones new entries are combined with, entries returning from a failed proposal go to the front
+        void AddToWaiting(QueueId id, bool front = false);
+        void RemoveFromWaiting(QueueId id);
+
+        /// Tries to complete a group for id with the waiting entries, the ones that can tank or heal first, each in their waiting order
+        bool FindGroup(QueueId id, AcceptGroup const& accept);
+
+        ObjectGuid GetGuid(QueueId id) const { return _entries[id].Guid; }
+        std::size_t GetWaitingCount() const { return _waiting[0].size() + _waiting[1].size(); }
+        /// Waiting entries that can tank or heal first, for debug output
+        std::vector<QueueId> GetWaiting() const;
+
+        /// Largest group found for id so far, it stays until one of its members leaves
+        std::vector<QueueId> GetBestGroup(QueueId id) const;
+        /// Roles the best group found for id still needs
+        void GetNeededRoles(QueueId id, uint8& tanks, uint8& healers, uint8& dps) const;
+
+    private:
+        struct Entry
+        {
+            ObjectGuid Guid;
+            std::vector<uint64> Dungeons;
+            RoleStates Roles = 0;
+            uint8 Players = 0;
+            bool IsLfgGroup = false;
+            bool IsWaiting = false;
+            uint32 Generation = 0;                          // changes when the id is freed, for the best groups of others
+
+            std::array<QueueId, GroupSize> BestGroup = { };
+            std::array<uint32, GroupSize> BestGroupGenerations = { };
+            uint8 BestGroupSize = 0;
+            uint8 BestGroupPlayers = 0;
+            RoleStates BestGroupRoles = 0;
+        };
+
+        static bool IsScarce(Entry const& entry);
+        static bool HasCommonDungeon(std::vector<uint64> const& left, std::vector<uint64> const& right);
+        static bool IntersectDungeons(std::vector<uint64> const& left, std::vector<uint64> const& right, std::vector<uint64>& result);
+
+        bool Search(std::size_t candidate, uint8 players, RoleStates roles, bool hasLfgGroup, AcceptGroup const& accept);
+        void GrowBestGroup(std::size_t candidate, uint8 players, RoleStates roles, bool hasLfgGroup);
+        bool CanJoin(Entry const& entry, uint8 players, RoleStates roles, bool hasLfgGroup, uint8& groupPlayers, RoleStates& groupRoles);
+        void UpdateBestGroup(uint8 players, RoleStates roles);
+        void ResetBestGroup(Entry& entry, QueueId id);
+        bool IsBestGroupValid(Entry const& entry) const;
+
+        std::vector<Entry> _entries;
+        std::vector<QueueId> _freeIds;
+        std::array<std::vector<QueueId>, 2> _waiting;       // dps only, can tank or heal
+        std::unordered_map<uint32, uint32> _dungeonBits;
+
+        // search state of FindGroup
+        std::vector<QueueId> _candidates;
+        std::size_t _scarceCandidates;
+        std::vector<QueueId> _group;
+        std::array<std::vector<uint64>, GroupSize> _groupDungeons;
+        uint32 _searchSteps;
+};
+
+} // namespace lfg
+
+#endif
@@ -18,7 +18,6 @@
 #include "LFGQueue.h"
 #include "Containers.h"
 #include "GameTime.h"
-#include "Group.h"
 #include "LFGMgr.h"
 #include "Log.h"
 #include <sstream>
@@ -26,61 +25,27 @@
 namespace lfg
 {
 
-/**
-   Given a list of guids returns the concatenation using | as delimiter
-
-   @param[in]     check list of guids
-   @returns Concatenated string
-*/
-std::string ConcatenateGuids(GuidList const& check)
-{
-    if (check.empty())
-        return "";
-
-    // need the guids in order to avoid duplicates
-    GuidSet guids(check.begin(), check.end());
-
-    std::ostringstream o;
-
-    GuidSet::const_iterator it = guids.begin();
-    o << it->ToHexString();
-    for (++it; it != guids.end(); ++it)
-        o << '|' << it->ToHexString();
-
-    return o.str();
-}
-
 char const* GetCompatibleString(LfgCompatibility compatibles)
 {
     switch (compatibles)
     {
-        case LFG_COMPATIBILITY_PENDING:
-            return "Pending";
         case LFG_COMPATIBLES_BAD_STATES:
             return "Compatibles (Bad States)";
         case LFG_COMPATIBLES_MATCH:
             return "Match";
-        case LFG_COMPATIBLES_WITH_LESS_PLAYERS:
-            return "Compatibles (Not enough players)";
         case LFG_INCOMPATIBLES_HAS_IGNORES:
             return "Has ignores";
-        case LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS:
-            return "Multiple Lfg Groups";
         case LFG_INCOMPATIBLES_NO_DUNGEONS:
             return "Incompatible dungeons";
         case LFG_INCOMPATIBLES_NO_ROLES:
             return "Incompatible roles";
-        case LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS:
-            return "Too many players";
-        case LFG_INCOMPATIBLES_WRONG_GROUP_SIZE:
-            return "Wrong group size";
         default:
             return "Unknown";
     }
 }
 
 LfgQueueData::LfgQueueData() : joinTime(GameTime::GetGameTime()), tanks(LFG_TANKS_NEEDED),
-healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED)
+healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED), queueId(LfgMatchmaker::InvalidQueueId)
 { }
 
 LFGQueue::LFGQueue() = default;
@@ -143,26 +108,7 @@ void LFGQueue::AddToQueue(ObjectGuid guid, bool reAdd)
 void LFGQueue::RemoveFromQueue(ObjectGuid guid)
 {
     RemoveFromNewQueue(guid);
-    RemoveFromCurrentQueue(guid);
-    RemoveFromCompatibles(guid);
-
-    std::string sguid = guid.ToHexString();
-
-    LfgQueueDataContainer::iterator itDelete = QueueDataStore.end();
-    for (LfgQueueDataContainer::iterator itr = QueueDataStore.begin(); itr != QueueDataStore.end(); ++itr)
-        if (itr->first != guid)
-        {
-            if (std::string::npos != itr->second.bestCompatible.find(sguid))
-            {
-                itr->second.bestCompatible.clear();
-                FindBestCompatibleInQueue(itr);
-            }
-        }
-        else
-            itDelete = itr;
-
-    if (itDelete != QueueDataStore.end())
-        QueueDataStore.erase(itDelete);
+    RemoveQueueData(guid);
 }
 
 void LFGQueue::AddToNewQueue(ObjectGuid guid)
@@ -177,22 +123,33 @@ void LFGQueue::RemoveFromNewQueue(ObjectGuid guid)
 
 void LFGQueue::AddToCurrentQueue(ObjectGuid guid)
 {
-    currentQueueStore.push_back(guid);
+    LfgQueueDataContainer::const_iterator itQueue = QueueDataStore.find(guid);
+    if (itQueue != QueueDataStore.end())
+        Matchmaker.AddToWaiting(itQueue->second.queueId);
 }
 
 void LFGQueue::AddToFrontCurrentQueue(ObjectGuid guid)
 {
-    currentQueueStore.push_front(guid);
+    LfgQueueDataContainer::const_iterator itQueue = QueueDataStore.find(guid);
+    if (itQueue != QueueDataStore.end())
+        Matchmaker.AddToWaiting(itQueue->second.queueId, true);
 }
 
 void LFGQueue::RemoveFromCurrentQueue(ObjectGuid guid)
 {
-    currentQueueStore.remove(guid);
+    LfgQueueDataContainer::const_iterator itQueue = QueueDataStore.find(guid);
+    if (itQueue != QueueDataStore.end())
+        Matchmaker.RemoveFromWaiting(itQueue->second.queueId);
 }
 
 void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
 {
-    QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+    LfgQueueData& queueData = QueueDataStore[guid];
+    if (queueData.queueId != LfgMatchmaker::InvalidQueueId)
+        Matchmaker.Remove(queueData.queueId);
+
+    queueData = LfgQueueData(joinTime, dungeons, rolesMap);
+    queueData.queueId = Matchmaker.Add(guid, rolesMap, dungeons, sLFGMgr->IsLfgGroup(guid));
     AddToQueue(guid);
 }
 
@@ -200,7 +157,10 @@ void LFGQueue::RemoveQueueData(ObjectGuid guid)
 {
     LfgQueueDataContainer::iterator it = QueueDataStore.find(guid);
     if (it != QueueDataStore.end())
+    {
+        Matchmaker.Remove(it->second.queueId);
         QueueDataStore.erase(it);
+    }
 }
 
 void LFGQueue::UpdateWaitTimeAvg(int32 waitTime, uint32 dungeonId)
@@ -231,83 +191,36 @@ void LFGQueue::UpdateWaitTimeDps(int32 waitTime, uint32 dungeonId)
     wt.time = int32((wt.time * old_number + waitTime) / wt.number);
 }
 
-/**
-   Remove from cached compatible dungeons any entry that contains the given guid
-
-   @param[in]     guid Guid to remove from compatible cache
-*/
-void LFGQueue::RemoveFromCompatibles(ObjectGuid guid)
-{
-    std::string strGuid = guid.ToHexString();
-
-    TC_LOG_DEBUG("lfg.queue.data.compatibles.remove", "Removing {}", guid.ToString());
-    for (LfgCompatibleContainer::iterator itNext = CompatibleMapStore.begin(); itNext != CompatibleMapStore.end();)
-    {
-        LfgCompatibleContainer::iterator it = itNext++;
-        if (std::string::npos != it->first.find(strGuid))
-            CompatibleMapStore.erase(it);
-    }
-}
-
-/**
-   Stores the compatibility of a list of guids
-
-   @param[in]     key String concatenation of guids (| used as separator)
-   @param[in]     compatibles type of compatibility
-*/
-void LFGQueue::SetCompatibles(std::string const& key, LfgCompatibility compatibles)
-{
-    LfgCompatibilityData& data = CompatibleMapStore[key];
-    data.compatibility = compatibles;
-}
-
-void LFGQueue::SetCompatibilityData(std::string const& key, LfgCompatibilityData const& data)
-{
-    CompatibleMapStore[key] = data;
-}
-
-/**
-   Get the compatibility of a group of guids
-
-   @param[in]     key String concatenation of guids (| used as separator)
-   @return LfgCompatibility type of compatibility
-*/
-LfgCompatibility LFGQueue::GetCompatibles(std::string const& key)
-{
-    LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
-    if (itr != CompatibleMapStore.end())
-        return itr->second.compatibility;
-
-    return LFG_COMPATIBILITY_PENDING;
-}
-
-LfgCompatibilityData* LFGQueue::GetCompatibilityData(std::string const& key)
-{
-    LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
-    if (itr != CompatibleMapStore.end())
-        return &(itr->second);
-
-    return nullptr;
-}
-
 uint8 LFGQueue::FindGroups()
 {
     uint8 proposals = 0;
-    GuidList firstNew;
     while (!newToQueueStore.empty())
     {
         ObjectGuid frontguid = newToQueueStore.front();
+        newToQueueStore.pop_front();
+
+        LfgQueueDataContainer::const_iterator itQueue = QueueDataStore.find(frontguid);
+        if (itQueue == QueueDataStore.end())
+        {
+            TC_LOG_ERROR("lfg.queue.match.check.new", "Guid: [{}] is not queued but listed as queued!", frontguid.ToString());
+            continue;
+        }
+
         TC_LOG_DEBUG("lfg.queue.match.check.new", "Checking [{}] newToQueue({}), currentQueue({})", frontguid.ToString(),
-            uint32(newToQueueStore.size()), uint32(currentQueueStore.size()));
+            uint32(newToQueueStore.size()), uint32(Matchmaker.GetWaitingCount()));
 
-        firstNew.clear();
-        firstNew.push_back(frontguid);
-        RemoveFromNewQueue(frontguid);
+        bool found = Matchmaker.FindGroup(itQueue->second.queueId, [this](std::span<LfgMatchmaker::QueueId const> group)
+        {
+            GuidList check;
+            for (LfgMatchmaker::QueueId queueId : group)
+                check.push_back(Matchmaker.GetGuid(queueId));
 
-        GuidList temporalList = currentQueueStore;
-        LfgCompatibility compatibles = FindNewGroups(firstNew, temporalList);
+            LfgCompatibility compatibles = CheckCompatibility(check);
+            TC_LOG_DEBUG("lfg.queue.match.check", "Guids: ({}): {}", GetDetailedMatchRoles(check), GetCompatibleString(compatibles));
+            return compatibles == LFG_COMPATIBLES_MATCH;
+        });
 
-        if (compatibles == LFG_COMPATIBLES_MATCH)
+        if (found)
             ++proposals;
         else
             AddToCurrentQueue(frontguid);                  // Lfg group not found, add this group to the queue.
@@ -316,101 +229,30 @@ uint8 LFGQueue::FindGroups()
 }
 
 /**
-   Checks que main queue to try to form a Lfg group. Returns first match found (if any)
-
-   @param[in]     check List of guids trying to match with other groups
-   @param[in]     all List of all other guids in main queue to match against
-   @return LfgCompatibility type of compatibility between groups
-*/
-LfgCompatibility LFGQueue::FindNewGroups(GuidList& check, GuidList& all)
-{
-    std::string strGuids = ConcatenateGuids(check);
-    LfgCompatibility compatibles = GetCompatibles(strGuids);
-
-    TC_LOG_DEBUG("lfg.queue.match.check", "Guids: ({}): {} - all({})", GetDetailedMatchRoles(check), GetCompatibleString(compatibles), GetDetailedMatchRoles(all));
-    if (compatibles == LFG_COMPATIBILITY_PENDING) // Not previously cached, calculate
-        compatibles = CheckCompatibility(check);
-
-    if (compatibles == LFG_COMPATIBLES_BAD_STATES && sLFGMgr->AllQueued(check))
-    {
-        TC_LOG_DEBUG("lfg.queue.match.check", "Guids: ({}) compatibles (cached) changed from bad states to match", GetDetailedMatchRoles(check));
-        SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
-        return LFG_COMPATIBLES_MATCH;
-    }
-
-    if (compatibles != LFG_COMPATIBLES_WITH_LESS_PLAYERS)
-        return compatibles;
-
-    // Try to match with queued groups
-    while (!all.empty())
-    {
-        check.push_back(all.front());
-        all.pop_front();
-        LfgCompatibility subcompatibility = FindNewGroups(check, all);
-        if (subcompatibility == LFG_COMPATIBLES_MATCH)
-            return LFG_COMPATIBLES_MATCH;
-        check.pop_back();
-    }
-    return compatibles;
-}
-
-/**
-   Check compatibilities between groups. If group is Matched proposal will be created
+   Checks the conditions of a full group found by the matchmaker it does not keep itself. If they hold the proposal is created
 
-   @param[in]     check List of guids to check compatibilities
+   @param[in]     check List of guids of the group
    @return LfgCompatibility type of compatibility
 */
-LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
+LfgCompatibility LFGQueue::CheckCompatibility(GuidList const& check)
 {
-    std::string strGuids = ConcatenateGuids(check);
     LfgProposal proposal;
     LfgDungeonSet proposalDungeons;
     LfgGroupsMap proposalGroups;
     LfgRolesMap proposalRoles;
 
-    // Check for correct size
-    if (check.size() > MAX_GROUP_SIZE || check.empty())
-    {
-        TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}): Size wrong - Not compatibles", GetDetailedMatchRoles(check));
-        return LFG_INCOMPATIBLES_WRONG_GROUP_SIZE;
-    }
-
-    // Check all-but-new compatiblitity
-    if (check.size() > 2)
-    {
-        ObjectGuid frontGuid = check.front();
-        check.pop_front();
-
-        // Check all-but-new compatibilities (New, A, B, C, D) --> check(A, B, C, D)
-        LfgCompatibility child_compatibles = CheckCompatibility(check);
-        if (child_compatibles < LFG_COMPATIBLES_WITH_LESS_PLAYERS) // Group not compatible
-        {
-            TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) child {} not compatibles", strGuids, GetDetailedMatchRoles(check));
-            SetCompatibles(strGuids, child_compatibles);
-            return child_compatibles;
-        }
-        check.push_front(frontGuid);
-    }
-
-    // Check if more than one LFG group and number of players joining
+    // Player count and lfg groups were checked by the matchmaker already
     uint8 numPlayers = 0;
     uint8 numLfgGroups = 0;
-    for (GuidList::const_iterator it = check.begin(); it != check.end() && numLfgGroups < 2 && numPlayers <= MAX_GROUP_SIZE; ++it)
+    for (ObjectGuid guid : check)
     {
-        ObjectGuid guid = *it;
-        LfgQueueDataContainer::iterator itQueue = QueueDataStore.find(guid);
-        if (itQueue == QueueDataStore.end())
-        {
-            TC_LOG_ERROR("lfg.queue.match.compatibility.check", "Guid: [{}] is not queued but listed as queued!", guid.ToString());
-            RemoveFromQueue(guid);
-            return LFG_COMPATIBILITY_PENDING;
-        }
+        LfgQueueData const& queueData = QueueDataStore[guid];
 
         // Store group so we don't need to call Mgr to get it later (if it's player group will be 0 otherwise would have joined as group)
-        for (LfgRolesMap::const_iterator it2 = itQueue->second.roles.begin(); it2 != itQueue->second.roles.end(); ++it2)
-            proposalGroups[it2->first] = itQueue->first.IsParty() ? itQueue->first : ObjectGuid::Empty;
+        for (LfgRolesMap::const_iterator it2 = queueData.roles.begin(); it2 != queueData.roles.end(); ++it2)
+            proposalGroups[it2->first] = guid.IsParty() ? guid : ObjectGuid::Empty;
 
-        numPlayers += itQueue->second.roles.size();
+        numPlayers += queueData.roles.size();
 
         if (sLFGMgr->IsLfgGroup(guid))
         {
@@ -420,35 +262,6 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         }
     }
 
-    // Group with less that MAX_GROUP_SIZE members always compatible
-    if (check.size() == 1 && numPlayers != MAX_GROUP_SIZE)
-    {
-        TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) single group. Compatibles", GetDetailedMatchRoles(check));
-        LfgQueueDataContainer::iterator itQueue = QueueDataStore.find(check.front());
-
-        LfgCompatibilityData data(LFG_COMPATIBLES_WITH_LESS_PLAYERS);
-        data.roles = itQueue->second.roles;
-        LFGMgr::CheckGroupRoles(data.roles);
-
-        UpdateBestCompatibleInQueue(itQueue, strGuids, data.roles);
-        SetCompatibilityData(strGuids, data);
-        return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
-    }
-
-    if (numLfgGroups > 1)
-    {
-        TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) More than one Lfggroup ({})", GetDetailedMatchRoles(check), numLfgGroups);
-        SetCompatibles(strGuids, LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS);
-        return LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS;
-    }
-
-    if (numPlayers > MAX_GROUP_SIZE)
-    {
-        TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Too many players ({})", GetDetailedMatchRoles(check), numPlayers);
-        SetCompatibles(strGuids, LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS);
-        return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
-    }
-
     // If it's single group no need to check for duplicate players, ignores, bad roles or bad dungeons as it's been checked before joining
     if (check.size() > 1)
     {
@@ -473,7 +286,6 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         if (uint8 playersize = numPlayers - proposalRoles.size())
         {
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) not compatible, {} players are ignoring each other", GetDetailedMatchRoles(check), playersize);
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_HAS_IGNORES);
             return LFG_INCOMPATIBLES_HAS_IGNORES;
         }
 
@@ -485,11 +297,10 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
                 o << ", " << it->first.ToHexString() << ": " << GetRolesString(it->second);
 
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Roles not compatible{}", GetDetailedMatchRoles(check), o.str());
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_ROLES);
             return LFG_INCOMPATIBLES_NO_ROLES;
         }
 
-        GuidList::iterator itguid = check.begin();
+        GuidList::const_iterator itguid = check.begin();
         proposalDungeons = QueueDataStore[*itguid].dungeons;
         std::ostringstream o;
         o << ", " << itguid->ToHexString() << ": (" << ConcatenateDungeons(proposalDungeons) << ")";
@@ -505,7 +316,6 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         if (proposalDungeons.empty())
         {
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) No compatible dungeons{}", GetDetailedMatchRoles(check), o.str());
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_DUNGEONS);
             return LFG_INCOMPATIBLES_NO_DUNGEONS;
         }
     }
@@ -518,20 +328,6 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         LFGMgr::CheckGroupRoles(proposalRoles);          // assing new roles
     }
 
-    // Enough players?
-    if (numPlayers != MAX_GROUP_SIZE)
-    {
-        TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Compatibles but not enough players({})", GetDetailedMatchRoles(check), numPlayers);
-        LfgCompatibilityData data(LFG_COMPATIBLES_WITH_LESS_PLAYERS);
-        data.roles = proposalRoles;
-
-        for (GuidList::const_iterator itr = check.begin(); itr != check.end(); ++itr)
-            UpdateBestCompatibleInQueue(QueueDataStore.find(*itr), strGuids, data.roles);
-
-        SetCompatibilityData(strGuids, data);
-        return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
-    }
-
     ObjectGuid gguid = *check.begin();
     proposal.queues = check;
     proposal.isNew = numLfgGroups != 1 || sLFGMgr->GetOldState(gguid) != LFG_STATE_DUNGEON;
@@ -539,7 +335,6 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
     if (!sLFGMgr->AllQueued(check))
     {
         TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Group MATCH but can't create proposal!", GetDetailedMatchRoles(check));
-        SetCompatibles(strGuids, LFG_COMPATIBLES_BAD_STATES);
         return LFG_COMPATIBLES_BAD_STATES;
     }
 
@@ -581,7 +376,6 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
     sLFGMgr->AddProposal(proposal);
 
     TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) MATCH! Group formed", GetDetailedMatchRoles(check));
-    SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
     return LFG_COMPATIBLES_MATCH;
 }
 
@@ -623,8 +417,7 @@ void LFGQueue::UpdateQueueTimers(uint8 queueId, time_t currTime)
                 break;
         }
 
-        if (queueinfo.bestCompatible.empty())
-            FindBestCompatibleInQueue(itQueue);
+        Matchmaker.GetNeededRoles(queueinfo.queueId, queueinfo.tanks, queueinfo.healers, queueinfo.dps);
 
         LfgQueueStatusData queueData(queueId, dungeonId, waitTime, wtAvg, wtTank, wtHealer, wtDps, queuedTime, queueinfo.tanks, queueinfo.healers, queueinfo.dps);
         for (LfgRolesMap::const_iterator itPlayer = queueinfo.roles.begin(); itPlayer != queueinfo.roles.end(); ++itPlayer)
@@ -650,21 +443,22 @@ std::string LFGQueue::DumpQueueInfo() const
     uint32 groups = 0;
     uint32 playersInGroup = 0;
 
-    for (uint8 i = 0; i < 2; ++i)
+    auto count = [&](ObjectGuid guid)
     {
-        GuidList const& queue = i ? newToQueueStore : currentQueueStore;
-        for (GuidList::const_iterator it = queue.begin(); it != queue.end(); ++it)
+        if (guid.IsParty())
         {
-            ObjectGuid guid = *it;
-            if (guid.IsParty())
-            {
-                groups++;
-                playersInGroup += sLFGMgr->GetPlayerCount(guid);
-            }
-            else
-                players++;
+            groups++;
+            playersInGroup += sLFGMgr->GetPlayerCount(guid);
         }
-    }
+        else
+            players++;
+    };
+
+    for (LfgMatchmaker::QueueId queueId : Matchmaker.GetWaiting())
+        count(Matchmaker.GetGuid(queueId));
+
+    for (ObjectGuid guid : newToQueueStore)
+        count(guid);
     std::ostringstream o;
     o << "Queued Players: " << players << " (in group: " << playersInGroup << ") Groups: " << groups << "\n";
     return o.str();
@@ -673,72 +467,25 @@ std::string LFGQueue::DumpQueueInfo() const
 std::string LFGQueue::DumpCompatibleInfo(bool full /* = false */) const
 {
     std::ostringstream o;
-    o << "Compatible Map size: " << CompatibleMapStore.size() << "\n";
+    o << "Waiting groups: " << Matchmaker.GetWaitingCount() << "\n";
     if (full)
-        for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
+    {
+        for (LfgMatchmaker::QueueId queueId : Matchmaker.GetWaiting())
         {
-            o << "(" << itr->first << "): " << GetCompatibleString(itr->second.compatibility);
-            if (!itr->second.roles.empty())
+            o << Matchmaker.GetGuid(queueId).ToString() << " best group (";
+            bool first = true;
+            for (LfgMatchmaker::QueueId member : Matchmaker.GetBestGroup(queueId))
             {
-                o << " (";
-                bool first = true;
-                for (auto const& role : itr->second.roles)
-                {
-                    if (!first)
-                        o << "|";
-                    o << role.first.ToString() << " " << GetRolesString(role.second & uint8(~PLAYER_ROLE_LEADER));
-                    first = false;
-                }
-                o << ")";
+                if (!first)
+                    o << "|";
+                o << Matchmaker.GetGuid(member).ToString();
+                first = false;
             }
-            o << "\n";
+            o << ")\n";
         }
+    }
 
     return o.str();
 }
 
-void LFGQueue::FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue)
-{
-    TC_LOG_DEBUG("lfg.queue.compatibles.find", "{}", itrQueue->first.ToString());
-    std::string sguid = itrQueue->first.ToHexString();
-
-    for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
-        if (itr->second.compatibility == LFG_COMPATIBLES_WITH_LESS_PLAYERS &&
-            std::string::npos != itr->first.find(sguid))
-        {
-            UpdateBestCompatibleInQueue(itrQueue, itr->first, itr->second.roles);
-        }
-}
-
-void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles)
-{
-    LfgQueueData& queueData = itrQueue->second;
-
-    uint8 storedSize = queueData.bestCompatible.empty() ? 0 :
-        std::count(queueData.bestCompatible.begin(), queueData.bestCompatible.end(), '|') + 1;
-
-    uint8 size = std::count(key.begin(), key.end(), '|') + 1;
-
-    if (size <= storedSize)
-        return;
-
-    TC_LOG_DEBUG("lfg.queue.compatibles.update", "Changed ({}) to ({}) as best compatible group for {}",
-        queueData.bestCompatible, key, itrQueue->first.ToString());
-
-    queueData.bestCompatible = key;
-    queueData.tanks = LFG_TANKS_NEEDED;
-    queueData.healers = LFG_HEALERS_NEEDED;
-    queueData.dps = LFG_DPS_NEEDED;
-    for (LfgRolesMap::const_iterator it = roles.begin(); it != roles.end(); ++it)
-    {
-        uint8 role = it->second;
-        if (role & PLAYER_ROLE_TANK)
-            --queueData.tanks;
-        else if (role & PLAYER_ROLE_HEALER)
-            --queueData.healers;
-        else
-            --queueData.dps;
-    }
-}
-
 } // namespace lfg
@@ -19,34 +19,20 @@
 #define _LFGQUEUE_H
 
 #include "LFG.h"
+#include "LFGMatchmaker.h"
 #include <list>
 
 namespace lfg
 {
 
+/// Checks of a full group found by LfgMatchmaker that it does not know about
 enum LfgCompatibility
 {
-    LFG_COMPATIBILITY_PENDING,
-    LFG_INCOMPATIBLES_WRONG_GROUP_SIZE,
-    LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS,
-    LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS,
     LFG_INCOMPATIBLES_HAS_IGNORES,
     LFG_INCOMPATIBLES_NO_ROLES,
     LFG_INCOMPATIBLES_NO_DUNGEONS,
-    LFG_COMPATIBLES_WITH_LESS_PLAYERS,                     // Values under this = not compatible (do not modify order)
     LFG_COMPATIBLES_BAD_STATES,
-    LFG_COMPATIBLES_MATCH                                  // Must be the last one
-};
-
-struct LfgCompatibilityData
-{
-    LfgCompatibilityData(): compatibility(LFG_COMPATIBILITY_PENDING) { }
-    LfgCompatibilityData(LfgCompatibility _compatibility): compatibility(_compatibility) { }
-    LfgCompatibilityData(LfgCompatibility _compatibility, LfgRolesMap const& _roles):
-        compatibility(_compatibility), roles(_roles) { }
-
-    LfgCompatibility compatibility;
-    LfgRolesMap roles;
+    LFG_COMPATIBLES_MATCH
 };
 
 /// Stores player or group queue info
@@ -56,7 +42,7 @@ struct LfgQueueData
 
     LfgQueueData(time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles):
         joinTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
-        dps(LFG_DPS_NEEDED), dungeons(_dungeons), roles(_roles)
+        dps(LFG_DPS_NEEDED), dungeons(_dungeons), roles(_roles), queueId(LfgMatchmaker::InvalidQueueId)
         { }
 
     time_t joinTime;                                       ///< Player queue join time (to calculate wait times)
@@ -65,7 +51,7 @@ struct LfgQueueData
     uint8 dps;                                             ///< Dps needed
     LfgDungeonSet dungeons;                                ///< Selected Player/Group Dungeon/s
     LfgRolesMap roles;                                     ///< Selected Player Role/s
-    std::string bestCompatible;                            ///< Best compatible combination of people queued
+    LfgMatchmaker::QueueId queueId;                        ///< Id used by the matchmaker
 };
 
 struct LfgWaitTime
@@ -76,7 +62,6 @@ struct LfgWaitTime
 };
 
 typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
-typedef std::map<std::string, LfgCompatibilityData> LfgCompatibleContainer;
 typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
 
 /**
@@ -123,27 +108,16 @@ class TC_GAME_API LFGQueue
         void RemoveFromNewQueue(ObjectGuid guid);
         void RemoveFromCurrentQueue(ObjectGuid guid);
 
-        void SetCompatibles(std::string const& key, LfgCompatibility compatibles);
-        LfgCompatibility GetCompatibles(std::string const& key);
-        void RemoveFromCompatibles(ObjectGuid guid);
-
-        void SetCompatibilityData(std::string const& key, LfgCompatibilityData const& compatibles);
-        LfgCompatibilityData* GetCompatibilityData(std::string const& key);
-        void FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
-        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles);
-
-        LfgCompatibility FindNewGroups(GuidList& check, GuidList& all);
-        LfgCompatibility CheckCompatibility(GuidList check);
+        LfgCompatibility CheckCompatibility(GuidList const& check);
 
         // Queue
         LfgQueueDataContainer QueueDataStore;              ///< Queued groups
-        LfgCompatibleContainer CompatibleMapStore;         ///< Compatible dungeons
+        LfgMatchmaker Matchmaker;                          ///< Groups waiting in queue, used to find groups
 
         LfgWaitTimesContainer waitTimesAvgStore;           ///< Average wait time to find a group queuing as multiple roles
         LfgWaitTimesContainer waitTimesTankStore;          ///< Average wait time to find a group queuing as tank
         LfgWaitTimesContainer waitTimesHealerStore;        ///< Average wait time to find a group queuing as healer
         LfgWaitTimesContainer waitTimesDpsStore;           ///< Average wait time to find a group queuing as dps
-        GuidList currentQueueStore;                        ///< Ordered list. Used to find groups
         GuidList newToQueueStore;                          ///< New groups to add to queue
 };
 
@@ -637,21 +637,26 @@ void AreaTrigger::UpdateTargetList()
 {
     std::vector<Unit*> targetList;
 
-    m_areaTriggerData->ShapeData.Visit([&]<typename ShapeType>(ShapeType const& shape)
+    if (!GetCachedTargets(targetList))
     {
-        if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerSphere>)
-            this->SearchUnitInSphere(shape, targetList);
-        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerBox>)
-            this->SearchUnitInBox(shape, targetList);
-        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerPolygon>)
-            this->SearchUnitInPolygon(shape, targetList);
-        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerCylinder>)
-            this->SearchUnitInCylinder(shape, targetList);
-        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerDisk>)
-            this->SearchUnitInDisk(shape, targetList);
-        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerBoundedPlane>)
-            this->SearchUnitInBoundedPlane(shape, targetList);
-    });
+        m_areaTriggerData->ShapeData.Visit([&]<typename ShapeType>(ShapeType const& shape)
+        {
+            if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerSphere>)
+                this->SearchUnitInSphere(shape, targetList);
+            else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerBox>)
+                this->SearchUnitInBox(shape, targetList);
+            else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerPolygon>)
+                this->SearchUnitInPolygon(shape, targetList);
+            else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerCylinder>)
+                this->SearchUnitInCylinder(shape, targetList);
+            else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerDisk>)
+                this->SearchUnitInDisk(shape, targetList);
+            else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerBoundedPlane>)
+                this->SearchUnitInBoundedPlane(shape, targetList);
+        });
+
+        SetCachedTargets(targetList);
+    }
 
     if (GetTemplate())
     {
@@ -709,6 +714,89 @@ void AreaTrigger::UpdateTargetList()
     HandleUnitEnterExit(targetList);
 }
 
+// the grid search is repeated at least this often, for changes of the units not tracked by the cache (phases)
+static constexpr uint32 MaxTargetSearchCacheTime = 1000;
+
+bool AreaTrigger::GetCachedTargets(std::vector<Unit*>& targetList) const
+{
+    TargetSearchCache const& cache = _targetSearchCache;
+    if (!cache.IsValid || GameTime::GetGameTimeMS() - cache.SearchTime >= MaxTargetSearchCacheTime)
+        return false;
+
+    if (cache.SearchPosition.GetPositionX() != GetPositionX() || cache.SearchPosition.GetPositionY() != GetPositionY()
+        || cache.SearchPosition.GetPositionZ() != GetPositionZ() || cache.SearchPosition.GetOrientation() != GetOrientation())
+        return false;
+
+    if (cache.Scale != CalcCurrentScale() || cache.MorphProgress != GetShapeMorphProgress())
+        return false;
+
+    // a unit entered or moved in one of the cells
+    if (cache.UnitMoveCounter != GetMap()->GetUnitMoveCounter(this, GetMaxSearchRadius()))
+        return false;
+
+    targetList.reserve(cache.Units.size());
+    for (auto const& [guid, position] : cache.Units)
+    {
+        // moving away is only noticed by the units themselves, the counter doesn't include the cells they moved to
+        Unit* unit = ObjectAccessor::GetUnit(*this, guid);
+        if (!unit || !unit->IsInWorld() || !InSamePhase(unit)
+            || unit->GetPositionX() != position.GetPositionX() || unit->GetPositionY() != position.GetPositionY() || unit->GetPositionZ() != position.GetPositionZ())
+        {
+            targetList.clear();
+            return false;
+        }
+
+        targetList.push_back(unit);
+    }
+
+    return true;
+}
+
+void AreaTrigger::SetCachedTargets(std::vector<Unit*> const& targetList)
+{
+    TargetSearchCache& cache = _targetSearchCache;
+    cache.SearchPosition = GetPosition();
+    cache.Scale = CalcCurrentScale();
+    cache.MorphProgress = GetShapeMorphProgress();
+    cache.UnitMoveCounter = GetMap()->GetUnitMoveCounter(this, GetMaxSearchRadius());
+    cache.SearchTime = GameTime::GetGameTimeMS();
+    cache.Units.clear();
+    for (Unit const* unit : targetList)
+        cache.Units.emplace_back(unit->GetGUID(), unit->GetPosition());
+    cache.IsValid = true;
+}
+
+// progress of the shape towards its target size, shapes without a target don't change with the progress
+float AreaTrigger::GetShapeMorphProgress() const
+{
+    bool isMorphing = m_areaTriggerData->ShapeData.Visit([]<typename ShapeType>(ShapeType const& shape)
+    {
+        if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerSphere>)
+            return shape.Radius != shape.RadiusTarget;
+        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerBox>)
+            return *shape.Extents != *shape.ExtentsTarget;
+        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerPolygon>)
+            return !shape.VerticesTarget.empty() || shape.Height != shape.HeightTarget;
+        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerCylinder>)
+            return shape.Radius != shape.RadiusTarget || shape.Height != shape.HeightTarget;
+        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerDisk>)
+            return shape.InnerRadius != shape.InnerRadiusTarget || shape.OuterRadius != shape.OuterRadiusTarget || shape.Height != shape.HeightTarget;
+        else if constexpr (std::is_same_v<ShapeType, UF::AreaTriggerBoundedPlane>)
+            return *shape.Extents != *shape.ExtentsTarget;
+        else
+            return false;
+    });
+
+    if (!isMorphing)
+        return 0.0f;
+
+    float progress = GetProgress();
+    if (m_areaTriggerData->MorphCurveId)
+        progress = sDB2Manager.GetCurveValueAt(m_areaTriggerData->MorphCurveId, progress);
+
+    return progress;
+}
+
 void AreaTrigger::SearchUnits(std::vector<Unit*>& targetList, float radius, bool check3D)
 {
     Trinity::AnyUnitInObjectRangeCheck check(this, radius, check3D, false);
@@ -972,6 +1060,8 @@ uint32 AreaTrigger::GetFaction() const
 
 void AreaTrigger::SetShape(AreaTriggerShapeInfo const& shape)
 {
+    _targetSearchCache.IsValid = false;
+
     std::visit([this]<typename ShapeType>(ShapeType const& shapeData)
     {
         auto areaTriggerData = m_values.ModifyValue(&AreaTrigger::m_areaTriggerData);
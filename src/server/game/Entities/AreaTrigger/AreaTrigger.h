@@ -234,6 +234,9 @@ class TC_GAME_API AreaTrigger final : public WorldObject, public GridObject<Area
         void SearchUnitInCylinder(UF::AreaTriggerCylinder const& cylinder, std::vector<Unit*>& targetList);
         void SearchUnitInDisk(UF::AreaTriggerDisk const& disk, std::vector<Unit*>& targetList);
         void SearchUnitInBoundedPlane(UF::AreaTriggerBoundedPlane const& boundedPlane, std::vector<Unit*>& targetList);
+        bool GetCachedTargets(std::vector<Unit*>& targetList) const;
+        void SetCachedTargets(std::vector<Unit*> const& targetList);
+        float GetShapeMorphProgress() const;
         void HandleUnitEnterExit(std::vector<Unit*> const& targetList, AreaTriggerExitReason exitMode = AreaTriggerExitReason::NotInside);
         void HandleUnitEnter(Unit* unit);
         void HandleUnitExitInternal(Unit* unit, AreaTriggerExitReason exitMode = AreaTriggerExitReason::NotInside);
@@ -275,6 +278,19 @@ class TC_GAME_API AreaTrigger final : public WorldObject, public GridObject<Area
         AreaTriggerTemplate const* _areaTriggerTemplate;
         GuidUnorderedSet _insideUnits;
 
+        // units in the shape at the last grid search, reused while neither this nor any unit in the searched cells moved
+        struct TargetSearchCache
+        {
+            Position SearchPosition;
+            float Scale = 0.0f;
+            float MorphProgress = 0.0f;
+            uint32 UnitMoveCounter = 0;
+            uint32 SearchTime = 0;
+            std::vector<std::pair<ObjectGuid, Position>> Units;
+            bool IsValid = false;
+        };
+        TargetSearchCache _targetSearchCache;
+
         std::unique_ptr<AreaTriggerAI> _ai;
 };
 
@@ -35,6 +35,7 @@ class TC_GAME_API Conversation final : public WorldObject, public GridObject<Con
     protected:
         void BuildValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
         void BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
+        bool HasViewerDependentChanges() const override { return true; } // line start times are relative to each receiver
         void ClearUpdateMask(bool remove) override;
 
     public:
@@ -290,11 +290,9 @@ bool AssistDelayEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 {
     if (Unit* victim = ObjectAccessor::GetUnit(m_owner, m_victim))
     {
-        while (!m_assistants.empty())
+        for (ObjectGuid const& assistantGuid : m_assistants)
         {
-            Creature* assistant = ObjectAccessor::GetCreature(m_owner, *m_assistants.begin());
-            m_assistants.pop_front();
-
+            Creature* assistant = ObjectAccessor::GetCreature(m_owner, assistantGuid);
             if (assistant && assistant->CanAssistTo(&m_owner, victim))
             {
                 assistant->SetNoCallAssistance(true);
@@ -318,7 +316,7 @@ bool ForcedDespawnDelayEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 
 Creature::Creature(bool isWorldObject) : Unit(isWorldObject), MapObject(), m_PlayerDamageReq(0), m_dontClearTapListOnEvade(false), _pickpocketLootRestore(0),
     m_corpseRemoveTime(0), m_respawnTime(0), m_respawnDelay(300), m_corpseDelay(60), m_ignoreCorpseDecayRatio(false), m_wanderDistance(0.0f),
-    m_boundaryCheckTime(2500), m_reactState(REACT_AGGRESSIVE),
+    m_boundaryCheckTime(2500), m_deferredUpdateDiff(0), m_deferredUpdateThreshold(0), m_reactState(REACT_AGGRESSIVE),
     m_defaultMovementType(IDLE_MOTION_TYPE), m_spawnId(UI64LIT(0)), m_equipmentId(0), m_originalEquipmentId(0),
     m_AlreadyCallAssistance(false), m_AlreadySearchedAssistance(false), m_cannotReachTarget(false), m_cannotReachTimer(0),
     m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_homePosition(), m_transportHomePosition(),
@@ -745,6 +743,44 @@ void Creature::ApplyAllStaticFlags(CreatureStaticFlagsHolder const& flags)
     m_updateFlag.NoBirthAnim = flags.HasFlag(CREATURE_STATIC_FLAG_4_NO_BIRTH_ANIM);
 }
 
+bool Creature::CanUpdateAtReducedRate() const
+{
+    // scripts and fights rely on precise timing, as does anything that keeps the area around it active
+    if (IsEngaged() || IsInEvadeMode() || isActiveObject() || GetTransport() || IsCharmedOwnedByPlayerOrPlayer() || IsVehicle())
+        return false;
+
+    // unless the script has nothing to do out of combat
+    if (GetScriptId() && !(IsAIEnabled() && AI()->SleepsWhileIdle()))
+        return false;
+
+    return !GetMap()->IsCellObservedByPlayers(Trinity::ComputeCellCoord(GetPositionX(), GetPositionY()).GetId());
+}
+
+bool Creature::ConsumeUpdateDiff(uint32& diff, uint32 reducedRateInterval)
+{
+    if (!reducedRateInterval || !CanUpdateAtReducedRate())
+    {
+        // catch up on everything skipped while nobody was watching
+        diff += m_deferredUpdateDiff;
+        m_deferredUpdateDiff = 0;
+        m_deferredUpdateThreshold = 0;
+        return true;
+    }
+
+    // spread the first deferred update so creatures loaded together don't all update on the same tick
+    if (!m_deferredUpdateThreshold)
+        m_deferredUpdateThreshold = reducedRateInterval / 2 + GetGUID().GetCounter() % (reducedRateInterval / 2 + 1);
+
+    m_deferredUpdateDiff += diff;
+    if (m_deferredUpdateDiff < m_deferredUpdateThreshold)
+        return false;
+
+    diff = m_deferredUpdateDiff;
+    m_deferredUpdateDiff = 0;
+    m_deferredUpdateThreshold = reducedRateInterval;
+    return true;
+}
+
 void Creature::Update(uint32 diff)
 {
     if (IsAIEnabled() && m_triggerJustAppeared && m_deathState != DEAD)
@@ -2159,14 +2195,19 @@ bool Creature::CheckNoGrayAggroConfig(uint32 playerLevel, uint32 creatureLevel)
     return false;
 }
 
+float Creature::GetMaxAttackDistance()
+{
+    // WoW Wiki: the minimum radius seems to be 5 yards, while the maximum range is 45 yards
+    return 45.0f * sWorld->getRate(RATE_CREATURE_AGGRO);
+}
+
 float Creature::GetAttackDistance(Unit const* player) const
 {
     float aggroRate = sWorld->getRate(RATE_CREATURE_AGGRO);
     if (aggroRate == 0)
         return 0.0f;
 
-    // WoW Wiki: the minimum radius seems to be 5 yards, while the maximum range is 45 yards
-    float maxRadius = 45.0f * aggroRate;
+    float maxRadius = GetMaxAttackDistance();
     float minRadius = 5.0f * aggroRate;
 
     int32 expansionMaxLevel = int32(GetMaxLevelForExpansion(GetCreatureTemplate()->RequiredExpansion));
@@ -3876,6 +3917,13 @@ void Creature::BuildValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Pl
     }
 }
 
+bool Creature::BuildCreateValuesViewerKey(ByteBuffer* data, Player const* target) const
+{
+    m_objectData->WriteViewerDependentValues(*data, this, target);
+    m_unitData->WriteViewerDependentValues(*data, this, target);
+    return true;
+}
+
 void Creature::BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const
 {
     if (m_entityFragments.ContentsChangedMask & m_entityFragments.GetUpdateMaskFor(WowCS::EntityFragment::CGObject))
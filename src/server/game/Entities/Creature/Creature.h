@@ -25,6 +25,7 @@
 #include "Duration.h"
 #include "GridObject.h"
 #include "MapObject.h"
+#include "SlabAllocator.h"
 #include <list>
 
 class CreatureAI;
@@ -78,7 +79,7 @@ static constexpr size_t CREATURE_TAPPERS_SOFT_CAP = 5;
 typedef std::vector<uint8> CreatureTextRepeatIds;
 typedef std::unordered_map<uint8, CreatureTextRepeatIds> CreatureTextRepeatGroup;
 
-class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public MapObject
+class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public MapObject, public Trinity::SlabAllocated<Creature>
 {
     public:
         explicit Creature(bool isWorldObject = false);
@@ -325,6 +326,7 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
 
         bool CanStartAttack(Unit const* u, bool force) const;
         float GetAttackDistance(Unit const* player) const;
+        static float GetMaxAttackDistance();
         float GetAggroRange(Unit const* target) const;
 
         void SendAIReaction(AiReaction reactionType);
@@ -449,6 +451,10 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         bool CanGiveExperience() const;
         void SetCanGiveExperience(bool xpEnabled) { _staticFlags.ApplyFlag(CREATURE_STATIC_FLAG_NO_XP, !xpEnabled); }
 
+        // Creatures nobody can observe are updated every reducedRateInterval ms with the time accumulated in between.
+        // Returns false while the update is deferred, otherwise diff is the time to pass to Update
+        bool ConsumeUpdateDiff(uint32& diff, uint32 reducedRateInterval);
+
         bool IsEngaged() const override;
         void AtEngage(Unit* target) override;
         void AtDisengage() override;
@@ -494,6 +500,7 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
     protected:
         void BuildValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
         void BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
+        bool BuildCreateValuesViewerKey(ByteBuffer* data, Player const* target) const override;
 
     public:
         void BuildValuesUpdateWithFlag(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
@@ -534,10 +541,13 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         bool m_ignoreCorpseDecayRatio;
         float m_wanderDistance;
         uint32 m_boundaryCheckTime;                         // (msecs) remaining time for next evade boundary check
+        uint32 m_deferredUpdateDiff;                        // (msecs) time not yet passed to Update while updated at reduced rate
+        uint32 m_deferredUpdateThreshold;                   // (msecs) deferred time that triggers the next update, 0 at full rate
 
         ReactStates m_reactState;                           // for AI, not charmInfo
         void RegenerateHealth();
         void Regenerate(Powers power);
+        bool CanUpdateAtReducedRate() const;
         MovementGeneratorType m_defaultMovementType;
         ObjectGuid::LowType m_spawnId;                               ///< For new or temporary creatures is 0 for saved it is lowguid
         uint8 m_equipmentId;
@@ -623,7 +633,7 @@ class TC_GAME_API AssistDelayEvent : public BasicEvent
         AssistDelayEvent();
 
         ObjectGuid        m_victim;
-        GuidList          m_assistants;
+        GuidSmallVector<4> m_assistants;
         Unit&             m_owner;
 };
 
@@ -56,6 +56,7 @@
 #include "Util.h"
 #include "Vignette.h"
 #include "World.h"
+#include "WorldStatePackets.h"
 #include <G3D/Box.h>
 #include <G3D/CoordinateFrame.h>
 #include <G3D/Quat.h>
@@ -418,7 +419,7 @@ public:
     void UpdatePassengerPositions()
     {
         for (WorldObject* passenger : _passengers)
-            UpdatePassengerPosition(_owner.GetMap(), passenger, _owner.GetPositionWithOffset(passenger->m_movementInfo.transport.pos), true);
+            UpdatePassengerPosition(_owner.GetMap(), passenger, _owner.GetPositionWithOffset(passenger->m_movementInfo.transport.pos), true, true);
     }
 
     uint32 GetTransportPeriod() const
@@ -622,12 +623,15 @@ public:
         switch (action)
         {
             case GameObjectActions::MakeInert:
+            {
+                WorldPacket hide = BuildWorldStateUpdate(_owner.GetGOInfo()->controlZone.worldState1, 0);
                 for (ObjectGuid const& guid : _insidePlayers)
                     if (Player* player = ObjectAccessor::GetPlayer(_owner, guid))
-                        player->SendUpdateWorldState(_owner.GetGOInfo()->controlZone.worldState1, 0);
+                        player->SendDirectMessage(&hide);
 
                 _insidePlayers.clear();
                 break;
+            }
             default:
                 break;
         }
@@ -686,8 +690,9 @@ public:
             _contestedTriggered = true;
         }
 
+        WorldPacket progress = BuildWorldStateUpdate(_owner.GetGOInfo()->controlZone.worldstate2, roundedValue);
         for (Player* player : targetList)
-            player->SendUpdateWorldState(_owner.GetGOInfo()->controlZone.worldstate2, roundedValue);
+            player->SendDirectMessage(&progress);
     }
 
     void SearchTargets(std::vector<Player*>& targetList)
@@ -764,22 +769,37 @@ public:
             _insidePlayers.insert(unit->GetGUID());
         }
 
-        for (Player* player : enteringPlayers)
+        // the packets are the same for everyone, they are built once per heartbeat
+        if (!enteringPlayers.empty())
         {
-            player->SendUpdateWorldState(_owner.GetGOInfo()->controlZone.worldState1, 1);
-            player->SendUpdateWorldState(_owner.GetGOInfo()->controlZone.worldstate2, static_cast<int32>(_value));
-            player->SendUpdateWorldState(_owner.GetGOInfo()->controlZone.worldstate3, _owner.GetGOInfo()->controlZone.neutralPercent);
+            WorldPacket show = BuildWorldStateUpdate(_owner.GetGOInfo()->controlZone.worldState1, 1);
+            WorldPacket progress = BuildWorldStateUpdate(_owner.GetGOInfo()->controlZone.worldstate2, static_cast<int32>(_value));
+            WorldPacket neutral = BuildWorldStateUpdate(_owner.GetGOInfo()->controlZone.worldstate3, _owner.GetGOInfo()->controlZone.neutralPercent);
+            for (Player* player : enteringPlayers)
+            {
+                player->SendDirectMessage(&show);
+                player->SendDirectMessage(&progress);
+                player->SendDirectMessage(&neutral);
+            }
         }
 
-        for (ObjectGuid const& exitPlayerGuid : exitPlayers)
+        if (!exitPlayers.empty())
         {
-            if (Player* player = ObjectAccessor::GetPlayer(_owner, exitPlayerGuid))
-            {
-                player->SendUpdateWorldState(_owner.GetGOInfo()->controlZone.worldState1, 0);
-            }
+            WorldPacket hide = BuildWorldStateUpdate(_owner.GetGOInfo()->controlZone.worldState1, 0);
+            for (ObjectGuid const& exitPlayerGuid : exitPlayers)
+                if (Player* player = ObjectAccessor::GetPlayer(_owner, exitPlayerGuid))
+                    player->SendDirectMessage(&hide);
         }
     }
 
+    static WorldPacket BuildWorldStateUpdate(uint32 variable, int32 value)
+    {
+        WorldPackets::WorldState::UpdateWorldState updateWorldState;
+        updateWorldState.VariableID = variable;
+        updateWorldState.Value = value;
+        return *updateWorldState.Write();
+    }
+
     float GetMaxHordeValue() const
     {
         // ex: if neutralPercent is 40; then 0 - 30 is Horde Controlled
@@ -3996,6 +4016,8 @@ void GameObject::EnableCollision(bool enable)
         GetMap()->InsertGameObjectModel(*m_model);*/
 
     m_model->EnableCollision(enable);
+    if (IsInWorld())
+        GetMap()->InvalidateDynamicLineOfSight();
 }
 
 void GameObject::UpdateModel()
@@ -4090,6 +4112,28 @@ void GameObject::BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags,
         m_gameObjectData->WriteUpdate(*data, flags, this, target);
 }
 
+bool GameObject::HasViewerDependentChanges() const
+{
+    if (WorldObject::HasViewerDependentChanges())
+        return true;
+
+    UF::GameObjectData const& gameObjectData = *m_gameObjectData;
+    return gameObjectData.IsChanged(&UF::GameObjectData::StateWorldEffectIDs)
+        || gameObjectData.IsChanged(&UF::GameObjectData::StateSpellVisualID)
+        || gameObjectData.IsChanged(&UF::GameObjectData::SpawnTrackingStateAnimID)
+        || gameObjectData.IsChanged(&UF::GameObjectData::SpawnTrackingStateAnimKitID)
+        || gameObjectData.IsChanged(&UF::GameObjectData::StateWorldEffectsQuestObjectiveID)
+        || gameObjectData.IsChanged(&UF::GameObjectData::Flags)
+        || gameObjectData.IsChanged(&UF::GameObjectData::State);
+}
+
+bool GameObject::BuildCreateValuesViewerKey(ByteBuffer* data, Player const* target) const
+{
+    m_objectData->WriteViewerDependentValues(*data, this, target);
+    m_gameObjectData->WriteViewerDependentValues(*data, this, target);
+    return true;
+}
+
 void GameObject::BuildValuesUpdateForPlayerWithMask(UpdateData* data, UF::ObjectData::Mask const& requestedObjectMask,
     UF::GameObjectData::Mask const& requestedGameObjectMask, Player const* target) const
 {
@@ -23,6 +23,7 @@
 #include "GameObjectData.h"
 #include "MapObject.h"
 #include "SharedDefines.h"
+#include "SlabAllocator.h"
 
 class GameObject;
 class GameObjectAI;
@@ -162,7 +163,7 @@ enum LootState
 // 5 sec for bobber catch
 #define FISHING_BOBBER_READY_TIME 5
 
-class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>, public MapObject
+class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>, public MapObject, public Trinity::SlabAllocated<GameObject>
 {
     public:
         explicit GameObject();
@@ -171,6 +172,8 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
     protected:
         void BuildValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
         void BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const override;
+        bool HasViewerDependentChanges() const override;
+        bool BuildCreateValuesViewerKey(ByteBuffer* data, Player const* target) const override;
         void ClearUpdateMask(bool remove) override;
 
     public:
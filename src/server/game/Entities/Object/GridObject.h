@@ -30,6 +30,7 @@ class GridObject
         bool IsInGrid() const { return _gridRef.isValid(); }
         void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); }
         void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); }
+        void InvalidateGridPositionCache() { if (IsInGrid()) _gridRef.getTarget()->InvalidatePositionCache(); }
     private:
         GridReference<T> _gridRef;
 };
@@ -55,6 +55,7 @@
 #include "VMapManager.h"
 #include "World.h"
 #include <G3D/Vector3.h>
+#include <atomic>
 #include <sstream>
 
 constexpr float VisibilityDistances[AsUnderlyingType(VisibilityDistanceType::Max)] =
@@ -67,6 +68,11 @@ constexpr float VisibilityDistances[AsUnderlyingType(VisibilityDistanceType::Max
     MAX_VISIBILITY_DISTANCE
 };
 
+namespace
+{
+std::atomic<uint64> NextValuesGeneration = 0;
+}
+
 Object::Object() : m_scriptRef(this, NoopObjectDeleter())
 {
     m_objectTypeId      = TYPEID_OBJECT;
@@ -78,6 +84,9 @@ Object::Object() : m_scriptRef(this, NoopObjectDeleter())
     m_isNewObject       = false;
     m_isDestroyedObject = false;
     m_objectUpdated     = false;
+
+    m_valuesGeneration  = ++NextValuesGeneration;
+    m_createValuesShared = false;
 }
 
 Object::~Object()
@@ -183,12 +192,39 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
     buf << uint8(fieldFlags);
     BuildEntityFragments(&buf, m_entityFragments.GetIds());
     buf << uint8(1);  // IndirectFragmentActive: CGObject
-    BuildValuesCreate(&buf, fieldFlags, target);
+    BuildSharedValuesCreate(&buf, fieldFlags, target);
     buf.put<uint32>(sizePos, buf.wpos() - sizePos - 4);
 
     data->AddUpdateBlock();
 }
 
+void Object::BuildSharedValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const
+{
+    Map* map = target != this && IsWorldObject() && IsInWorld() ? static_cast<WorldObject const*>(this)->GetMap() : nullptr;
+
+    thread_local ByteBuffer viewerKey;
+    viewerKey.clear();
+
+    if (!map || data->HasUnfinishedBitPack() || !BuildCreateValuesViewerKey(&viewerKey, target))
+    {
+        BuildValuesCreate(data, flags, target);
+        return;
+    }
+
+    viewerKey.FlushBits();
+    std::span<uint8 const> key(viewerKey.data(), viewerKey.wpos());
+    if (map->AppendCreateValuesBlock(*data, GetGUID(), m_valuesGeneration, uint8(flags), key))
+        return;
+
+    std::size_t valuesPos = data->wpos();
+    BuildValuesCreate(data, flags, target);
+    if (data->HasUnfinishedBitPack())
+        return;
+
+    map->StoreCreateValuesBlock(GetGUID(), m_valuesGeneration, uint8(flags), key, { data->data() + valuesPos, data->wpos() - valuesPos });
+    m_createValuesShared = true;
+}
+
 void Object::SendUpdateToPlayer(Player* player)
 {
     // send create update to player
@@ -702,6 +738,12 @@ UF::UpdateFieldFlag Object::GetUpdateFieldFlagsFor(Player const* /*target*/) con
     return UF::UpdateFieldFlag::None;
 }
 
+bool Object::HasViewerDependentChanges() const
+{
+    return m_objectData->IsChanged(&UF::ObjectData::EntryID)
+        || m_objectData->IsChanged(&UF::ObjectData::DynamicFlags);
+}
+
 void Object::BuildValuesUpdateWithFlag(ByteBuffer* data, UF::UpdateFieldFlag /*flags*/, Player const* /*target*/) const
 {
     *data << uint32(0);
@@ -709,6 +751,13 @@ void Object::BuildValuesUpdateWithFlag(ByteBuffer* data, UF::UpdateFieldFlag /*f
 
 void Object::AddToObjectUpdateIfNeeded()
 {
+    // values stored for other receivers are outdated now
+    if (m_createValuesShared)
+    {
+        m_valuesGeneration = ++NextValuesGeneration;
+        m_createValuesShared = false;
+    }
+
     if (m_inWorld && !m_objectUpdated)
         m_objectUpdated = AddToObjectUpdate();
 }
@@ -732,6 +781,25 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) cons
     BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
 }
 
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, UpdateDataPool& sharedBlocks) const
+{
+    // without viewer dependent changes the block only differs by field visibility flags and the active player data sent to self
+    uint8 fieldFlags = AsUnderlyingType(GetUpdateFieldFlagsFor(player));
+    bool forSelf = player == this;
+
+    UpdateData const* block = sharedBlocks.FindSharedValuesBlock(fieldFlags, forSelf);
+    if (!block)
+    {
+        UpdateData& newBlock = sharedBlocks.AddSharedValuesBlock(fieldFlags, forSelf);
+        BuildValuesUpdateBlockForPlayer(&newBlock, player);
+        block = &newBlock;
+    }
+
+    UpdateData& data = data_map.try_emplace(player, player->GetMapId()).first->second;
+    data.GetBuffer().append(block->GetBuffer());
+    data.AddUpdateBlock();
+}
+
 std::string Object::GetDebugInfo() const
 {
     std::stringstream sstr;
@@ -1089,22 +1157,26 @@ bool WorldObject::IsWithinLOS(float ox, float oy, float oz, LineOfSightChecks ch
 {
     if (IsInWorld())
     {
-        oz += GetCollisionHeight();
         float x, y, z;
-        if (GetTypeId() == TYPEID_PLAYER)
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
-
+        GetLineOfSightRay(x, y, z, ox, oy, oz);
         return GetMap()->isInLineOfSight(GetPhaseShift(), x, y, z, ox, oy, oz, checks, ignoreFlags);
     }
 
     return true;
 }
 
+void WorldObject::GetLineOfSightRay(float& x, float& y, float& z, float ox, float oy, float& oz) const
+{
+    oz += GetCollisionHeight();
+    if (GetTypeId() == TYPEID_PLAYER)
+    {
+        GetPosition(x, y, z);
+        z += GetCollisionHeight();
+    }
+    else
+        GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
+}
+
 bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
     if (!IsInMap(obj))
@@ -1714,6 +1786,25 @@ struct CombatLogSender
     }
 };
 
+struct CombatLogBatchSender
+{
+    CombatLogBatch const* i_messages;
+
+    explicit CombatLogBatchSender(CombatLogBatch const& msgs)
+        : i_messages(&msgs)
+    {
+        for (std::unique_ptr<WorldPackets::CombatLog::CombatLogServerPacket> const& msg : msgs)
+            msg->Write();
+    }
+
+    void operator()(Player const* player) const
+    {
+        bool advancedCombatLogging = player->IsAdvancedCombatLoggingEnabled();
+        for (std::unique_ptr<WorldPackets::CombatLog::CombatLogServerPacket> const& msg : *i_messages)
+            player->SendDirectMessage(advancedCombatLogging ? msg->GetFullLogPacket() : msg->GetBasicLogPacket());
+    }
+};
+
 void WorldObject::SendCombatLogMessage(WorldPackets::CombatLog::CombatLogServerPacket* combatLog) const
 {
     CombatLogSender combatLogSender(combatLog);
@@ -1725,6 +1816,20 @@ void WorldObject::SendCombatLogMessage(WorldPackets::CombatLog::CombatLogServerP
     Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
 }
 
+void WorldObject::SendCombatLogMessages(CombatLogBatch const& combatLogs) const
+{
+    if (combatLogs.empty())
+        return;
+
+    CombatLogBatchSender combatLogSender(combatLogs);
+
+    if (Player const* self = ToPlayer())
+        combatLogSender(self);
+
+    Trinity::MessageDistDeliverer<CombatLogBatchSender> notifier(this, combatLogSender, GetVisibilityRange());
+    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
+}
+
 void WorldObject::SetMap(Map* map)
 {
     ASSERT(map);
@@ -3665,6 +3770,7 @@ struct WorldObjectClientDestroyWork
 
         object->DestroyForPlayer(player);
         player->m_clientGUIDs.erase(object->GetGUID());
+        object->RemoveClientObserver(player->GetGUID());
     }
 };
 
@@ -3686,27 +3792,41 @@ void WorldObject::UpdateObjectVisibility(bool /*forced*/)
     Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
 }
 
-struct WorldObjectChangeAccumulator
+void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
 {
-    UpdateDataMapType& i_updateDatas;
-    WorldObject& i_object;
-    GuidUnorderedSet plr_list;
-    WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d) : i_updateDatas(d), i_object(obj) { }
-
-    void operator()(Player* player)
+    UpdateDataPool* sharedBlocks = nullptr;
+    if (sWorld->getBoolConfig(CONFIG_MAPUPDATE_SHARED_VALUES_UPDATES) && !HasViewerDependentChanges())
     {
-        // Only send update once to a player
-        if (player->HaveAtClient(&i_object) && plr_list.insert(player->GetGUID()).second)
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+        sharedBlocks = &GetMap()->GetUpdateDataPool();
+        sharedBlocks->ResetSharedValuesBlocks();
     }
-};
 
-void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
-{
-    WorldObjectChangeAccumulator notifier(*this, data_map);
-    WorldObjectVisibleChangeVisitor visitor(notifier);
-    //we must build packets for all visible players
-    Cell::VisitWorldObjects(this, visitor, GetVisibilityRange());
+    auto buildFieldsUpdate = [&](Player* player)
+    {
+        if (sharedBlocks)
+            BuildFieldsUpdate(player, data_map, *sharedBlocks);
+        else
+            BuildFieldsUpdate(player, data_map);
+    };
+
+    // players are never in their own m_clientGUIDs
+    if (Player* player = ToPlayer())
+        buildFieldsUpdate(player);
+
+    //we must build packets for all players that have this object at client
+    for (auto itr = m_clientObservers.begin(); itr != m_clientObservers.end();)
+    {
+        // observers left the map or dropped the object without telling it (map change, failed object updates, grid visibility updates)
+        Player* player = ObjectAccessor::GetPlayer(*this, *itr);
+        if (!player || !player->HaveAtClient(this))
+        {
+            itr = m_clientObservers.erase(itr);
+            continue;
+        }
+
+        buildFieldsUpdate(player);
+        ++itr;
+    }
 
     ClearUpdateMask(false);
 }
@@ -61,6 +61,7 @@ class TempSummon;
 class TransportBase;
 class Unit;
 class UpdateData;
+class UpdateDataPool;
 class WorldObject;
 class WorldPacket;
 class ZoneScript;
@@ -239,6 +240,8 @@ class TC_GAME_API Object
         void SetDestroyedObject(bool destroyed) { m_isDestroyedObject = destroyed; }
         virtual void BuildUpdate(UpdateDataMapType&) { }
         void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
+        // same as above but copies the block from sharedBlocks when a receiver of the same class was already built
+        void BuildFieldsUpdate(Player*, UpdateDataMapType &, UpdateDataPool& sharedBlocks) const;
 
         inline bool IsWorldObject() const { return isType(TYPEMASK_WORLDOBJECT); }
         static WorldObject* ToWorldObject(Object* o) { return o ? o->ToWorldObject() : nullptr; }
@@ -444,8 +447,13 @@ class TC_GAME_API Object
 
         void BuildMovementUpdate(ByteBuffer* data, CreateObjectBits flags, Player const* target) const;
         virtual UF::UpdateFieldFlag GetUpdateFieldFlagsFor(Player const* target) const;
+        // pending changes include fields serialized through ViewerDependentValue, values update must be built per receiver
+        virtual bool HasViewerDependentChanges() const;
         virtual void BuildValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const = 0;
         virtual void BuildValuesUpdate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const = 0;
+        // writes every value BuildValuesCreate serializes per receiver, objects returning true share their create values between receivers writing the same key
+        virtual bool BuildCreateValuesViewerKey(ByteBuffer* /*data*/, Player const* /*target*/) const { return false; }
+        void BuildSharedValuesCreate(ByteBuffer* data, UF::UpdateFieldFlag flags, Player const* target) const;
         static void BuildEntityFragments(ByteBuffer* data, std::span<WowCS::EntityFragment const> fragments);
         void BuildEntityFragmentsForValuesUpdateForPlayerWithMask(ByteBuffer* data, EnumFlag<UF::UpdateFieldFlag> flags) const;
 
@@ -464,6 +472,8 @@ class TC_GAME_API Object
         bool m_objectUpdated;
 
     private:
+        uint64 m_valuesGeneration;                          // changes with the update fields, identifies the create values stored in the map
+        mutable bool m_createValuesShared;
         bool m_inWorld;
         bool m_isNewObject;
         bool m_isDestroyedObject;
@@ -735,6 +745,8 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         bool IsWithinDistInMap(WorldObject const* obj, float dist2compare, bool is3D = true, bool incOwnRadius = true, bool incTargetRadius = true) const;
         bool IsWithinLOS(float x, float y, float z, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing) const;
         bool IsWithinLOSInMap(WorldObject const* obj, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing) const;
+        // Segment checked by IsWithinLOS(ox, oy, oz), x, y, z receives the start and oz is raised to the end
+        void GetLineOfSightRay(float& x, float& y, float& z, float ox, float oy, float& oz) const;
         Position GetHitSpherePointFor(Position const& dest) const;
         void GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z) const;
         bool GetDistanceOrder(WorldObject const* obj1, WorldObject const* obj2, bool is3D = true) const;
@@ -754,6 +766,8 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         virtual void SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const;
 
         void SendCombatLogMessage(WorldPackets::CombatLog::CombatLogServerPacket* combatLog) const;
+        // Same as calling SendCombatLogMessage for every packet, but finds the receivers only once
+        void SendCombatLogMessages(CombatLogBatch const& combatLogs) const;
 
         virtual uint8 GetLevelForTarget(WorldObject const* /*target*/) const { return 1; }
 
@@ -890,6 +904,10 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         bool AddToObjectUpdate() override;
         void RemoveFromObjectUpdate() override;
 
+        // players that have this object in Player::m_clientGUIDs, entries of players that forgot it are dropped by BuildUpdate
+        void AddClientObserver(ObjectGuid const& playerGuid) { m_clientObservers.insert(playerGuid); }
+        void RemoveClientObserver(ObjectGuid const& playerGuid) { m_clientObservers.erase(playerGuid); }
+
         //relocation and visibility system functions
         void AddToNotify(uint16 f) { m_notifyflags |= f;}
         bool isNeedNotify(uint16 f) const { return (m_notifyflags & f) != 0; }
@@ -994,6 +1012,8 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
 
         uint16 m_notifyflags;
 
+        GuidUnorderedSet m_clientObservers;
+
         ObjectGuid _privateObjectOwner;
 
         std::unique_ptr<SmoothPhasing> _smoothPhasing;
@@ -20,9 +20,12 @@
 
 #include "Define.h"
 #include "EnumFlag.h"
+#include "FlatSet.h"
 #include "StringFormatFwd.h"
 #include "advstd.h"
 #include <array>
+#include <bit>
+#include <boost/container/small_vector.hpp>
 #include <functional>
 #include <list>
 #include <set>
@@ -412,6 +415,19 @@ using GuidList = std::list<ObjectGuid>;
 using GuidVector = std::vector<ObjectGuid>;
 using GuidUnorderedSet = std::unordered_set<ObjectGuid>;
 
+// Inline, without hash_combine. The counter of the low part is 40 bits wide, the high part is rotated above it
+struct ObjectGuidFastHash
+{
+    std::size_t operator()(ObjectGuid const& key) const noexcept
+    {
+        return std::size_t(key.GetRawValue(0) ^ std::rotl(key.GetRawValue(1), 40));
+    }
+};
+
+using GuidFlatSet = Trinity::Containers::FlatHashSet<ObjectGuid, ObjectGuidFastHash>;
+template <std::size_t N>
+using GuidSmallVector = boost::container::small_vector<ObjectGuid, N>;
+
 TC_GAME_API ByteBuffer& operator<<(ByteBuffer& buf, ObjectGuid const& guid);
 TC_GAME_API ByteBuffer& operator>>(ByteBuffer& buf, ObjectGuid&       guid);
 
@@ -18,9 +18,25 @@
 #include "ObjectGuidSequenceGenerator.h"
 #include "Log.h"
 #include "World.h"
+#include <algorithm>
+#include <array>
 
 namespace
 {
+// identifies the counter a block was reserved from, unique for every generator and every Set
+std::atomic<uint64> NextBlockGeneration = 1;
+
+struct ThreadGuidBlock
+{
+    uint64 Generation = 0;
+    ObjectGuid::LowType Next = 0;
+    ObjectGuid::LowType End = 0;
+};
+
+// only a few generators use blocks, a thread that needs more drops the oldest block
+thread_local std::array<ThreadGuidBlock, 8> ThreadGuidBlocks;
+thread_local uint32 NextReplacedThreadGuidBlock = 0;
+
 void HandleCounterOverflow(HighGuid high)
 {
     TC_LOG_ERROR("misc", "{} guid overflow!! Can't continue, shutting down server. ", ObjectGuid::GetTypeName(high));
@@ -48,7 +64,42 @@ ObjectGuid::LowType CheckGeneratedGuidValue(HighGuid high, ObjectGuid::LowType n
 }
 }
 
+ObjectGuidGenerator::ObjectGuidGenerator(HighGuid high, ObjectGuid::LowType start /*= UI64LIT(1)*/, uint32 blockSize /*= 1*/)
+    : _nextGuid(start), _blockGeneration(NextBlockGeneration++), _high(high), _blockSize(std::max(blockSize, 1u))
+{
+}
+
+void ObjectGuidGenerator::Set(ObjectGuid::LowType val)
+{
+    _nextGuid = val;
+    _blockGeneration = NextBlockGeneration++;
+}
+
 ObjectGuid::LowType ObjectGuidGenerator::Generate()
 {
+    if (_blockSize > 1)
+        return CheckGeneratedGuidValue(_high, GenerateFromBlock());
+
     return CheckGeneratedGuidValue(_high, _nextGuid++);
 }
+
+ObjectGuid::LowType ObjectGuidGenerator::GenerateFromBlock()
+{
+    uint64 generation = _blockGeneration.load(std::memory_order_relaxed);
+    auto itr = std::ranges::find(ThreadGuidBlocks, generation, &ThreadGuidBlock::Generation);
+    if (itr == ThreadGuidBlocks.end())
+    {
+        itr = ThreadGuidBlocks.begin() + NextReplacedThreadGuidBlock;
+        NextReplacedThreadGuidBlock = (NextReplacedThreadGuidBlock + 1) % ThreadGuidBlocks.size();
+        itr->Generation = generation;
+        itr->Next = itr->End = 0;
+    }
+
+    if (itr->Next == itr->End)
+    {
+        itr->Next = _nextGuid.fetch_add(_blockSize);
+        itr->End = itr->Next + _blockSize;
+    }
+
+    return itr->Next++;
+}
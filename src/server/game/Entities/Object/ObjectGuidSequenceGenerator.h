@@ -21,18 +21,28 @@
 #include "ObjectGuid.h"
 #include <atomic>
 
-class ObjectGuidGenerator
+/*
+ * With a block size above 1 every thread reserves that many values at once and hands them out without touching
+ * the shared counter. Values left in the blocks are skipped, persistent counters are set after the highest saved
+ * value at startup again so they are never lost for good. GetNextAfterMaxUsed includes all reserved blocks.
+ */
+class TC_GAME_API ObjectGuidGenerator
 {
 public:
-    explicit ObjectGuidGenerator(HighGuid high, ObjectGuid::LowType start = UI64LIT(1)) : _nextGuid(start), _high(high) { }
+    explicit ObjectGuidGenerator(HighGuid high, ObjectGuid::LowType start = UI64LIT(1), uint32 blockSize = 1);
 
-    void Set(ObjectGuid::LowType val) { _nextGuid = val; }
+    // discards the blocks reserved from the previous value
+    void Set(ObjectGuid::LowType val);
     ObjectGuid::LowType Generate();
     ObjectGuid::LowType GetNextAfterMaxUsed() const { return _nextGuid; }
 
 private:
+    ObjectGuid::LowType GenerateFromBlock();
+
     std::atomic<ObjectGuid::LowType> _nextGuid;
+    std::atomic<uint64> _blockGeneration;
     HighGuid _high;
+    uint32 _blockSize;
 };
 
 #endif // TRINITYCORE_OBJECT_GUID_SEQUENCE_GENERATOR_H
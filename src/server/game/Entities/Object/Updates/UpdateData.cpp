@@ -19,15 +19,21 @@
 #include "Errors.h"
 #include "WorldPacket.h"
 #include "Opcodes.h"
+#include <algorithm>
 
 UpdateData::UpdateData(uint32 map) : m_map(map), m_blockCount(0) { }
 
+UpdateData::UpdateData(uint32 map, std::vector<uint8>&& storage) : m_map(map), m_blockCount(0), m_data(std::move(storage))
+{
+    ASSERT(m_data.empty());
+}
+
 void UpdateData::AddDestroyObject(ObjectGuid guid)
 {
     m_destroyGUIDs.insert(guid);
 }
 
-void UpdateData::AddOutOfRangeGUID(GuidSet& guids)
+void UpdateData::AddOutOfRangeGUID(GuidFlatSet const& guids)
 {
     m_outOfRangeGUIDs.insert(guids.begin(), guids.end());
 }
@@ -71,3 +77,72 @@ void UpdateData::Clear()
     m_blockCount = 0;
     m_map = 0;
 }
+
+std::vector<uint8> UpdateData::ReleaseStorage()
+{
+    std::vector<uint8> storage = std::move(m_data).Release();
+    storage.clear();
+    Clear();
+    return storage;
+}
+
+std::vector<uint8> UpdateDataPool::AcquireStorage()
+{
+    if (_storage.empty())
+        return std::vector<uint8>();
+
+    std::vector<uint8> storage = std::move(_storage.back());
+    _storage.pop_back();
+    return storage;
+}
+
+void UpdateDataPool::ReleaseStorage(std::vector<uint8>&& storage)
+{
+    storage.clear();
+    _storage.push_back(std::move(storage));
+}
+
+UpdateData const* UpdateDataPool::FindSharedValuesBlock(uint8 fieldFlags, bool forSelf) const
+{
+    for (std::size_t i = 0; i < _sharedBlockCount; ++i)
+        if (_sharedBlocks[i].FieldFlags == fieldFlags && _sharedBlocks[i].ForSelf == forSelf)
+            return &_sharedBlocks[i].Block;
+
+    return nullptr;
+}
+
+UpdateData& UpdateDataPool::AddSharedValuesBlock(uint8 fieldFlags, bool forSelf)
+{
+    if (_sharedBlockCount == _sharedBlocks.size())
+        _sharedBlocks.push_back({ .FieldFlags = fieldFlags, .ForSelf = forSelf, .Block = UpdateData(0) });
+
+    SharedValuesBlock& block = _sharedBlocks[_sharedBlockCount++];
+    block.FieldFlags = fieldFlags;
+    block.ForSelf = forSelf;
+    block.Block.Clear();
+    return block.Block;
+}
+
+std::size_t UpdateDataPool::GetCreateValuesBlockIndex(ObjectGuid const& guid, uint8 fieldFlags)
+{
+    return (std::hash<ObjectGuid>()(guid) ^ fieldFlags) % CreateValuesBlockCount;
+}
+
+std::span<uint8 const> UpdateDataPool::FindCreateValuesBlock(ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey) const
+{
+    CreateValuesBlock const& block = _createValuesBlocks[GetCreateValuesBlockIndex(guid, fieldFlags)];
+    if (block.Guid != guid || block.Generation != generation || block.FieldFlags != fieldFlags || !std::ranges::equal(block.ViewerKey, viewerKey))
+        return {};
+
+    return block.Values;
+}
+
+void UpdateDataPool::StoreCreateValuesBlock(ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey, std::span<uint8 const> values)
+{
+    CreateValuesBlock& block = _createValuesBlocks[GetCreateValuesBlockIndex(guid, fieldFlags)];
+    block.Guid = guid;
+    block.Generation = generation;
+    block.FieldFlags = fieldFlags;
+    block.ViewerKey.assign(viewerKey.begin(), viewerKey.end());
+    block.Values.assign(values.begin(), values.end());
+}
@@ -21,7 +21,10 @@
 #include "Define.h"
 #include "ByteBuffer.h"
 #include "ObjectGuid.h"
+#include <array>
 #include <set>
+#include <span>
+#include <vector>
 
 class WorldPacket;
 
@@ -37,6 +40,7 @@ class UpdateData
 {
     public:
         UpdateData(uint32 map);
+        UpdateData(uint32 map, std::vector<uint8>&& storage);
         UpdateData(UpdateData&& right) noexcept : m_map(right.m_map), m_blockCount(right.m_blockCount),
             m_outOfRangeGUIDs(std::move(right.m_outOfRangeGUIDs)),
             m_data(std::move(right.m_data))
@@ -44,24 +48,75 @@ class UpdateData
         }
 
         void AddDestroyObject(ObjectGuid guid);
-        void AddOutOfRangeGUID(GuidSet& guids);
+        void AddOutOfRangeGUID(GuidFlatSet const& guids);
         void AddOutOfRangeGUID(ObjectGuid guid);
         void AddUpdateBlock() { ++m_blockCount; }
         ByteBuffer& GetBuffer() { return m_data; }
+        ByteBuffer const& GetBuffer() const { return m_data; }
+        uint32 GetBlockCount() const { return m_blockCount; }
+        std::vector<uint8> ReleaseStorage();
         bool BuildPacket(WorldPacket* packet);
         bool HasData() const { return m_blockCount > 0 || !m_outOfRangeGUIDs.empty() || !m_destroyGUIDs.empty(); }
         void Clear();
 
-        GuidSet const& GetOutOfRangeGUIDs() const { return m_outOfRangeGUIDs; }
+        GuidFlatSet const& GetOutOfRangeGUIDs() const { return m_outOfRangeGUIDs; }
 
     protected:
         uint32 m_map;
         uint32 m_blockCount;
-        GuidSet m_destroyGUIDs;
-        GuidSet m_outOfRangeGUIDs;
+        GuidFlatSet m_destroyGUIDs;
+        GuidFlatSet m_outOfRangeGUIDs;
         ByteBuffer m_data;
 
         UpdateData(UpdateData const& right) = delete;
         UpdateData& operator=(UpdateData const& right) = delete;
 };
+
+// Buffers kept between Map::SendObjectUpdates passes so that building update packets doesn't allocate in steady state
+class UpdateDataPool
+{
+    public:
+        UpdateDataPool() : _sharedBlockCount(0) { }
+
+        std::vector<uint8> AcquireStorage();
+        void ReleaseStorage(std::vector<uint8>&& storage);
+
+        // values update blocks of the object currently being built, keyed by receiver class
+        UpdateData const* FindSharedValuesBlock(uint8 fieldFlags, bool forSelf) const;
+        UpdateData& AddSharedValuesBlock(uint8 fieldFlags, bool forSelf);
+        void ResetSharedValuesBlocks() { _sharedBlockCount = 0; }
+
+        // values of create blocks, reused for viewers with the same field flags and viewer dependent values until the object changes generation
+        // one slot per object and field flags hash, a busy area keeps the objects most recently created for someone
+        static constexpr std::size_t CreateValuesBlockCount = 256;
+        std::span<uint8 const> FindCreateValuesBlock(ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey) const;
+        void StoreCreateValuesBlock(ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey, std::span<uint8 const> values);
+
+    private:
+        struct SharedValuesBlock
+        {
+            uint8 FieldFlags;
+            bool ForSelf;
+            UpdateData Block;
+        };
+
+        struct CreateValuesBlock
+        {
+            ObjectGuid Guid;
+            uint64 Generation = 0;
+            uint8 FieldFlags = 0;
+            std::vector<uint8> ViewerKey;
+            std::vector<uint8> Values;
+        };
+
+        static std::size_t GetCreateValuesBlockIndex(ObjectGuid const& guid, uint8 fieldFlags);
+
+        std::vector<std::vector<uint8>> _storage;
+        std::vector<SharedValuesBlock> _sharedBlocks;
+        std::size_t _sharedBlockCount;
+        std::array<CreateValuesBlock, CreateValuesBlockCount> _createValuesBlocks;
+
+        UpdateDataPool(UpdateDataPool const& right) = delete;
+        UpdateDataPool& operator=(UpdateDataPool const& right) = delete;
+};
 #endif
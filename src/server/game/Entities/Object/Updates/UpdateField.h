@@ -720,6 +720,14 @@ namespace UF
             _changesMask.Reset(Bit);
         }
 
+        template<typename Derived, typename T, int32 BlockBit, uint32 Bit>
+        bool IsChanged(UpdateField<T, BlockBit, Bit>(Derived::*)) const
+        {
+            static_assert(std::is_base_of_v<Base, Derived>, "Given field argument must belong to the same structure as this HasChangesMask");
+
+            return _changesMask[Bit];
+        }
+
         Mask const& GetChangesMask() const { return _changesMask; }
 
     protected:
@@ -980,6 +988,12 @@ namespace UF
             return (_updateMask[UpdateMaskHelpers::GetBlockIndex(index)] & UpdateMaskHelpers::GetBlockFlag(index)) != 0;
         }
 
+        /// Indexes of changed values in ascending order, all of them when ignoreChangesMask is set
+        UpdateMaskHelpers::SetBitRange GetChangedIndexes(bool ignoreChangesMask) const
+        {
+            return { _updateMask.data(), 0, uint32(_values.size()), ignoreChangesMask };
+        }
+
         void WriteUpdateMask(ByteBuffer& data, int32 bitsForSize = 32) const
         {
             WriteDynamicFieldUpdateMask(_values.size(), _updateMask, data, bitsForSize);
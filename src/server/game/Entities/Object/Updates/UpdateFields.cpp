@@ -71,6 +71,12 @@ void ObjectData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ign
     }
 }
 
+void ObjectData::WriteViewerDependentValues(ByteBuffer& data, Object const* owner, Player const* receiver) const
+{
+    data << int32(ViewerDependentValue<EntryIDTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<DynamicFlagsTag>::GetValue(this, owner, receiver));
+}
+
 void ObjectData::ClearChangesMask()
 {
     Base::ClearChangesMask(EntryID);
@@ -172,12 +178,9 @@ void ItemModList::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Item con
     data.FlushBits();
     if (changesMask[0])
     {
-        for (uint32 i = 0; i < Values.size(); ++i)
+        for (uint32 i : Values.GetChangedIndexes(ignoreChangesMask))
         {
-            if (Values.HasChanged(i) || ignoreChangesMask)
-            {
-                Values[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
-            }
+            Values[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
         }
     }
     data.FlushBits();
@@ -244,12 +247,9 @@ void SocketedGem::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Item con
     }
     if (changesMask[3])
     {
-        for (uint32 i = 0; i < 16; ++i)
+        for (uint32 i : changesMask.GetSetBits(4, 16))
         {
-            if (changesMask[4 + i])
-            {
-                data << uint16(BonusListIDs[i]);
-            }
+            data << uint16(BonusListIDs[i]);
         }
     }
 }
@@ -371,22 +371,16 @@ void ItemData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ignor
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < ArtifactPowers.size(); ++i)
+            for (uint32 i : ArtifactPowers.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (ArtifactPowers.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    ArtifactPowers[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                ArtifactPowers[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[2])
         {
-            for (uint32 i = 0; i < Gems.size(); ++i)
+            for (uint32 i : Gems.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Gems.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    Gems[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                Gems[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[3])
@@ -464,22 +458,16 @@ void ItemData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ignor
     }
     if (changesMask[21])
     {
-        for (uint32 i = 0; i < 5; ++i)
+        for (uint32 i : changesMask.GetSetBits(22, 5))
         {
-            if (changesMask[22 + i])
-            {
-                data << int32(SpellCharges[i]);
-            }
+            data << int32(SpellCharges[i]);
         }
     }
     if (changesMask[27])
     {
-        for (uint32 i = 0; i < 13; ++i)
+        for (uint32 i : changesMask.GetSetBits(28, 13))
         {
-            if (changesMask[28 + i])
-            {
-                Enchantment[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-            }
+            Enchantment[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
         }
     }
 }
@@ -542,12 +530,9 @@ void ContainerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool
     }
     if (changesMask[2])
     {
-        for (uint32 i = 0; i < 98; ++i)
+        for (uint32 i : changesMask.GetSetBits(3, 98))
         {
-            if (changesMask[3 + i])
-            {
-                data << Slots[i];
-            }
+            data << Slots[i];
         }
     }
 }
@@ -581,12 +566,9 @@ void AzeriteEmpoweredItemData::WriteUpdate(ByteBuffer& data, Mask const& changes
     data.FlushBits();
     if (changesMask[0])
     {
-        for (uint32 i = 0; i < 5; ++i)
+        for (uint32 i : changesMask.GetSetBits(1, 5))
         {
-            if (changesMask[1 + i])
-            {
-                data << int32(Selections[i]);
-            }
+            data << int32(Selections[i]);
         }
     }
 }
@@ -653,12 +635,9 @@ void SelectedAzeriteEssences::WriteUpdate(ByteBuffer& data, bool ignoreChangesMa
     }
     if (changesMask[3])
     {
-        for (uint32 i = 0; i < 4; ++i)
+        for (uint32 i : changesMask.GetSetBits(4, 4))
         {
-            if (changesMask[4 + i])
-            {
-                data << uint32(AzeriteEssenceID[i]);
-            }
+            data << uint32(AzeriteEssenceID[i]);
         }
     }
     data.FlushBits();
@@ -766,32 +745,23 @@ void AzeriteItemData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, boo
     {
         if (changesMask[2])
         {
-            for (uint32 i = 0; i < UnlockedEssences.size(); ++i)
+            for (uint32 i : UnlockedEssences.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (UnlockedEssences.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    UnlockedEssences[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                UnlockedEssences[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[4])
         {
-            for (uint32 i = 0; i < UnlockedEssenceMilestones.size(); ++i)
+            for (uint32 i : UnlockedEssenceMilestones.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (UnlockedEssenceMilestones.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint32(UnlockedEssenceMilestones[i]);
-                }
+                data << uint32(UnlockedEssenceMilestones[i]);
             }
         }
         if (changesMask[3])
         {
-            for (uint32 i = 0; i < SelectedEssences.size(); ++i)
+            for (uint32 i : SelectedEssences.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (SelectedEssences.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    SelectedEssences[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                SelectedEssences[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[5])
@@ -1295,32 +1265,23 @@ void UnitData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ignor
     {
         if (changesMask[3])
         {
-            for (uint32 i = 0; i < PassiveSpells.size(); ++i)
+            for (uint32 i : PassiveSpells.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (PassiveSpells.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    PassiveSpells[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                PassiveSpells[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[4])
         {
-            for (uint32 i = 0; i < WorldEffects.size(); ++i)
+            for (uint32 i : WorldEffects.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (WorldEffects.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(WorldEffects[i]);
-                }
+                data << int32(WorldEffects[i]);
             }
         }
         if (changesMask[5])
         {
-            for (uint32 i = 0; i < ChannelObjects.size(); ++i)
+            for (uint32 i : ChannelObjects.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (ChannelObjects.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << ChannelObjects[i];
-                }
+                data << ChannelObjects[i];
             }
         }
         if (changesMask[6])
@@ -1869,22 +1830,16 @@ void UnitData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ignor
     }
     if (changesMask[177])
     {
-        for (uint32 i = 0; i < 3; ++i)
+        for (uint32 i : changesMask.GetSetBits(178, 3))
         {
-            if (changesMask[178 + i])
-            {
-                VirtualItems[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-            }
+            VirtualItems[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
         }
     }
     if (changesMask[181])
     {
-        for (uint32 i = 0; i < 2; ++i)
+        for (uint32 i : changesMask.GetSetBits(182, 2))
         {
-            if (changesMask[182 + i])
-            {
-                data << uint32(AttackRoundBaseTime[i]);
-            }
+            data << uint32(AttackRoundBaseTime[i]);
         }
     }
     if (changesMask[184])
@@ -1930,6 +1885,33 @@ void UnitData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ignor
     data.FlushBits();
 }
 
+void UnitData::WriteViewerDependentValues(ByteBuffer& data, Unit const* owner, Player const* receiver) const
+{
+    ViewerDependentValue<StateWorldEffectIDsTag>::value_type stateWorldEffectIDs = {};
+
+    data << int32(ViewerDependentValue<DisplayIDTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<NpcFlagsTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<NpcFlags2Tag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<StateSpellVisualIDTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<StateAnimIDTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<StateAnimKitIDTag>::GetValue(this, owner, receiver));
+    stateWorldEffectIDs = ViewerDependentValue<StateWorldEffectIDsTag>::GetValue(this, owner, receiver);
+    data << uint32(stateWorldEffectIDs->size());
+    for (uint32 i = 0; i < stateWorldEffectIDs->size(); ++i)
+    {
+        data << uint32((*stateWorldEffectIDs)[i]);
+    }
+    data << uint32(ViewerDependentValue<StateWorldEffectsQuestObjectiveIDTag>::GetValue(this, owner, receiver));
+    data << int32(ViewerDependentValue<FactionTemplateTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<FlagsTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<Flags2Tag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<Flags3Tag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<Flags4Tag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<AuraStateTag>::GetValue(this, owner, receiver));
+    data << uint8(ViewerDependentValue<PvpFlagsTag>::GetValue(this, owner, receiver));
+    data << int32(ViewerDependentValue<InteractSpellIDTag>::GetValue(this, owner, receiver));
+}
+
 void UnitData::ClearChangesMask()
 {
     Base::ClearChangesMask(Field_314);
@@ -2141,12 +2123,9 @@ void QuestLog::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Player cons
     }
     if (changesMask[5])
     {
-        for (uint32 i = 0; i < 24; ++i)
+        for (uint32 i : changesMask.GetSetBits(6, 24))
         {
-            if (changesMask[6 + i])
-            {
-                data << int16(ObjectiveProgress[i]);
-            }
+            data << int16(ObjectiveProgress[i]);
         }
     }
 }
@@ -2390,23 +2369,17 @@ void DeclinedNames::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Player
 
     if (changesMask[0])
     {
-        for (uint32 i = 0; i < 5; ++i)
+        for (uint32 i : changesMask.GetSetBits(1, 5))
         {
-            if (changesMask[1 + i])
-            {
-                data.WriteBits(Name[i].size(), 10);
-            }
+            data.WriteBits(Name[i].size(), 10);
         }
     }
     data.FlushBits();
     if (changesMask[0])
     {
-        for (uint32 i = 0; i < 5; ++i)
+        for (uint32 i : changesMask.GetSetBits(1, 5))
         {
-            if (changesMask[1 + i])
-            {
-                data << WorldPackets::SizedString::Data(Name[i]);
-            }
+            data << WorldPackets::SizedString::Data(Name[i]);
         }
     }
     data.FlushBits();
@@ -2680,65 +2653,47 @@ void PlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ign
     {
         if (changesMask[3])
         {
-            for (uint32 i = 0; i < Customizations.size(); ++i)
+            for (uint32 i : Customizations.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Customizations.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    Customizations[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                Customizations[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[4])
         {
-            for (uint32 i = 0; i < QaCustomizations.size(); ++i)
+            for (uint32 i : QaCustomizations.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (QaCustomizations.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    QaCustomizations[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                QaCustomizations[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[5])
         {
-            for (uint32 i = 0; i < QuestSessionQuestLog.size(); ++i)
+            for (uint32 i : QuestSessionQuestLog.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (QuestSessionQuestLog.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    if (noQuestLogChangesMask)
-                        QuestSessionQuestLog[i].WriteCreate(data, owner, receiver);
-                    else
-                        QuestSessionQuestLog[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                if (noQuestLogChangesMask)
+                    QuestSessionQuestLog[i].WriteCreate(data, owner, receiver);
+                else
+                    QuestSessionQuestLog[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[6])
         {
-            for (uint32 i = 0; i < ArenaCooldowns.size(); ++i)
+            for (uint32 i : ArenaCooldowns.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (ArenaCooldowns.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    ArenaCooldowns[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                ArenaCooldowns[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[8])
         {
-            for (uint32 i = 0; i < VisualItemReplacements.size(); ++i)
+            for (uint32 i : VisualItemReplacements.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (VisualItemReplacements.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(VisualItemReplacements[i]);
-                }
+                data << int32(VisualItemReplacements[i]);
             }
         }
         if (changesMask[7])
         {
-            for (uint32 i = 0; i < PetNames.size(); ++i)
+            for (uint32 i : PetNames.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (PetNames.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    PetNames[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                PetNames[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[9])
@@ -2908,75 +2863,54 @@ void PlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ign
     }
     if (changesMask[48])
     {
-        for (uint32 i = 0; i < 2; ++i)
+        for (uint32 i : changesMask.GetSetBits(49, 2))
         {
-            if (changesMask[49 + i])
-            {
-                data << uint8(PartyType[i]);
-            }
+            data << uint8(PartyType[i]);
         }
     }
     if (changesMask[51])
     {
-        for (uint32 i = 0; i < 175; ++i)
+        for (uint32 i : changesMask.GetSetBits(52, 175))
         {
-            if (changesMask[52 + i])
-            {
-                if (noQuestLogChangesMask)
-                    QuestLog[i].WriteCreate(data, owner, receiver);
-                else
-                    QuestLog[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-            }
+            if (noQuestLogChangesMask)
+                QuestLog[i].WriteCreate(data, owner, receiver);
+            else
+                QuestLog[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
         }
     }
     if (changesMask[227])
     {
-        for (uint32 i = 0; i < 19; ++i)
+        for (uint32 i : changesMask.GetSetBits(228, 19))
         {
-            if (changesMask[228 + i])
-            {
-                VisibleItems[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-            }
+            VisibleItems[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
         }
     }
     if (changesMask[247])
     {
-        for (uint32 i = 0; i < 6; ++i)
+        for (uint32 i : changesMask.GetSetBits(248, 6))
         {
-            if (changesMask[248 + i])
-            {
-                data << float(AvgItemLevel[i]);
-            }
+            data << float(AvgItemLevel[i]);
         }
     }
     if (changesMask[254])
     {
-        for (uint32 i = 0; i < 32; ++i)
+        for (uint32 i : changesMask.GetSetBits(255, 32))
         {
-            if (changesMask[255 + i])
-            {
-                ForcedReactions[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-            }
+            ForcedReactions[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
         }
     }
     if (changesMask[304])
     {
-        for (uint32 i = 0; i < 19; ++i)
+        for (uint32 i : changesMask.GetSetBits(305, 19))
         {
-            if (changesMask[305 + i])
-            {
-                data << uint32(Field_3120[i]);
-            }
+            data << uint32(Field_3120[i]);
         }
     }
     if (changesMask[287])
     {
-        for (uint32 i = 0; i < 16; ++i)
+        for (uint32 i : changesMask.GetSetBits(288, 16))
         {
-            if (changesMask[288 + i])
-            {
-                data << VisibleEquipableSpells[i];
-            }
+            data << VisibleEquipableSpells[i];
         }
     }
     data.FlushBits();
@@ -3148,12 +3082,9 @@ void BitVector::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Player con
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < Values.size(); ++i)
+            for (uint32 i : Values.GetChangedIndexes(ignoreChangesMask))
             {
-                if (Values.HasChanged(i) || ignoreChangesMask)
-                {
-                    data << uint64(Values[i]);
-                }
+                data << uint64(Values[i]);
             }
         }
     }
@@ -3186,12 +3117,9 @@ void BitVectors::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Player co
     data.FlushBits();
     if (changesMask[0])
     {
-        for (uint32 i = 0; i < 13; ++i)
+        for (uint32 i : changesMask.GetSetBits(1, 13))
         {
-            if (changesMask[1 + i])
-            {
-                Values[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
-            }
+            Values[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
         }
     }
 }
@@ -3547,12 +3475,9 @@ void ResearchHistory::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Play
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < CompletedProjects.size(); ++i)
+            for (uint32 i : CompletedProjects.GetChangedIndexes(ignoreChangesMask))
             {
-                if (CompletedProjects.HasChanged(i) || ignoreChangesMask)
-                {
-                    CompletedProjects[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
-                }
+                CompletedProjects[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
             }
         }
     }
@@ -3855,22 +3780,16 @@ void TraitConfig::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Player c
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < Entries.size(); ++i)
+            for (uint32 i : Entries.GetChangedIndexes(ignoreChangesMask))
             {
-                if (Entries.HasChanged(i) || ignoreChangesMask)
-                {
-                    Entries[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
-                }
+                Entries[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
             }
         }
         if (changesMask[2])
         {
-            for (uint32 i = 0; i < SubTrees.size(); ++i)
+            for (uint32 i : SubTrees.GetChangedIndexes(ignoreChangesMask))
             {
-                if (SubTrees.HasChanged(i) || ignoreChangesMask)
-                {
-                    SubTrees[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
-                }
+                SubTrees[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
             }
         }
         if (changesMask[3])
@@ -4167,12 +4086,9 @@ void CraftingOrderData::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Pl
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < Reagents.size(); ++i)
+            for (uint32 i : Reagents.GetChangedIndexes(ignoreChangesMask))
             {
-                if (Reagents.HasChanged(i) || ignoreChangesMask)
-                {
-                    Reagents[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
-                }
+                Reagents[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
             }
         }
         if (changesMask[2])
@@ -4370,22 +4286,16 @@ void CraftingOrder::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Player
     data.FlushBits();
     if (changesMask[0])
     {
-        for (uint32 i = 0; i < Enchantments.size(); ++i)
+        for (uint32 i : Enchantments.GetChangedIndexes(ignoreChangesMask))
         {
-            if (Enchantments.HasChanged(i) || ignoreChangesMask)
-            {
-                data << Enchantments[i];
-            }
+            data << Enchantments[i];
         }
     }
     if (changesMask[1])
     {
-        for (uint32 i = 0; i < Gems.size(); ++i)
+        for (uint32 i : Gems.GetChangedIndexes(ignoreChangesMask))
         {
-            if (Gems.HasChanged(i) || ignoreChangesMask)
-            {
-                data << Gems[i];
-            }
+            data << Gems[i];
         }
     }
     if (changesMask[2])
@@ -4633,12 +4543,9 @@ void StableInfo::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, Player co
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < Pets.size(); ++i)
+            for (uint32 i : Pets.GetChangedIndexes(ignoreChangesMask))
             {
-                if (Pets.HasChanged(i) || ignoreChangesMask)
-                {
-                    Pets[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
-                }
+                Pets[i].WriteUpdate(data, ignoreChangesMask, owner, receiver);
             }
         }
         if (changesMask[2])
@@ -5360,12 +5267,9 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
         {
             if (changesMask[43])
             {
-                for (uint32 j = 0; j < ResearchSites[i].size(); ++j)
+                for (uint32 j : ResearchSites[i].GetChangedIndexes(ignoreNestedChangesMask))
                 {
-                    if (ResearchSites[i].HasChanged(j) || ignoreNestedChangesMask)
-                    {
-                        data << uint16(ResearchSites[i][j]);
-                    }
+                    data << uint16(ResearchSites[i][j]);
                 }
             }
         }
@@ -5376,12 +5280,9 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
         {
             if (changesMask[45])
             {
-                for (uint32 j = 0; j < ResearchSiteProgress[i].size(); ++j)
+                for (uint32 j : ResearchSiteProgress[i].GetChangedIndexes(ignoreNestedChangesMask))
                 {
-                    if (ResearchSiteProgress[i].HasChanged(j) || ignoreNestedChangesMask)
-                    {
-                        data << uint32(ResearchSiteProgress[i][j]);
-                    }
+                    data << uint32(ResearchSiteProgress[i][j]);
                 }
             }
         }
@@ -5392,12 +5293,9 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
         {
             if (changesMask[47])
             {
-                for (uint32 j = 0; j < Research[i].size(); ++j)
+                for (uint32 j : Research[i].GetChangedIndexes(ignoreNestedChangesMask))
                 {
-                    if (Research[i].HasChanged(j) || ignoreNestedChangesMask)
-                    {
-                        Research[i][j].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                    }
+                    Research[i][j].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
                 }
             }
         }
@@ -5610,232 +5508,163 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
     {
         if (changesMask[7])
         {
-            for (uint32 i = 0; i < KnownTitles.size(); ++i)
+            for (uint32 i : KnownTitles.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (KnownTitles.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint64(KnownTitles[i]);
-                }
+                data << uint64(KnownTitles[i]);
             }
         }
         if (changesMask[8])
         {
-            for (uint32 i = 0; i < CharacterDataElements.size(); ++i)
+            for (uint32 i : CharacterDataElements.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (CharacterDataElements.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    CharacterDataElements[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                CharacterDataElements[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[9])
         {
-            for (uint32 i = 0; i < AccountDataElements.size(); ++i)
+            for (uint32 i : AccountDataElements.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (AccountDataElements.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    AccountDataElements[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                AccountDataElements[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[11])
         {
-            for (uint32 i = 0; i < DailyQuestsCompleted.size(); ++i)
+            for (uint32 i : DailyQuestsCompleted.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (DailyQuestsCompleted.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(DailyQuestsCompleted[i]);
-                }
+                data << int32(DailyQuestsCompleted[i]);
             }
         }
         if (changesMask[12])
         {
-            for (uint32 i = 0; i < Field_1328.size(); ++i)
+            for (uint32 i : Field_1328.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Field_1328.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(Field_1328[i]);
-                }
+                data << int32(Field_1328[i]);
             }
         }
         if (changesMask[13])
         {
-            for (uint32 i = 0; i < AvailableQuestLineXQuestIDs.size(); ++i)
+            for (uint32 i : AvailableQuestLineXQuestIDs.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (AvailableQuestLineXQuestIDs.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(AvailableQuestLineXQuestIDs[i]);
-                }
+                data << int32(AvailableQuestLineXQuestIDs[i]);
             }
         }
         if (changesMask[14])
         {
-            for (uint32 i = 0; i < Heirlooms.size(); ++i)
+            for (uint32 i : Heirlooms.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Heirlooms.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(Heirlooms[i]);
-                }
+                data << int32(Heirlooms[i]);
             }
         }
         if (changesMask[15])
         {
-            for (uint32 i = 0; i < HeirloomFlags.size(); ++i)
+            for (uint32 i : HeirloomFlags.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (HeirloomFlags.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint32(HeirloomFlags[i]);
-                }
+                data << uint32(HeirloomFlags[i]);
             }
         }
         if (changesMask[16])
         {
-            for (uint32 i = 0; i < Toys.size(); ++i)
+            for (uint32 i : Toys.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Toys.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(Toys[i]);
-                }
+                data << int32(Toys[i]);
             }
         }
         if (changesMask[17])
         {
-            for (uint32 i = 0; i < ToyFlags.size(); ++i)
+            for (uint32 i : ToyFlags.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (ToyFlags.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint32(ToyFlags[i]);
-                }
+                data << uint32(ToyFlags[i]);
             }
         }
         if (changesMask[18])
         {
-            for (uint32 i = 0; i < Transmog.size(); ++i)
+            for (uint32 i : Transmog.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Transmog.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint32(Transmog[i]);
-                }
+                data << uint32(Transmog[i]);
             }
         }
         if (changesMask[19])
         {
-            for (uint32 i = 0; i < ConditionalTransmog.size(); ++i)
+            for (uint32 i : ConditionalTransmog.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (ConditionalTransmog.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(ConditionalTransmog[i]);
-                }
+                data << int32(ConditionalTransmog[i]);
             }
         }
         if (changesMask[20])
         {
-            for (uint32 i = 0; i < SelfResSpells.size(); ++i)
+            for (uint32 i : SelfResSpells.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (SelfResSpells.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(SelfResSpells[i]);
-                }
+                data << int32(SelfResSpells[i]);
             }
         }
         if (changesMask[21])
         {
-            for (uint32 i = 0; i < RuneforgePowers.size(); ++i)
+            for (uint32 i : RuneforgePowers.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (RuneforgePowers.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint32(RuneforgePowers[i]);
-                }
+                data << uint32(RuneforgePowers[i]);
             }
         }
         if (changesMask[22])
         {
-            for (uint32 i = 0; i < TransmogIllusions.size(); ++i)
+            for (uint32 i : TransmogIllusions.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (TransmogIllusions.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint32(TransmogIllusions[i]);
-                }
+                data << uint32(TransmogIllusions[i]);
             }
         }
         if (changesMask[23])
         {
-            for (uint32 i = 0; i < WarbandScenes.size(); ++i)
+            for (uint32 i : WarbandScenes.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (WarbandScenes.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << uint32(WarbandScenes[i]);
-                }
+                data << uint32(WarbandScenes[i]);
             }
         }
         if (changesMask[25])
         {
-            for (uint32 i = 0; i < SpellPctModByLabel.size(); ++i)
+            for (uint32 i : SpellPctModByLabel.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (SpellPctModByLabel.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    SpellPctModByLabel[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                SpellPctModByLabel[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[26])
         {
-            for (uint32 i = 0; i < SpellFlatModByLabel.size(); ++i)
+            for (uint32 i : SpellFlatModByLabel.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (SpellFlatModByLabel.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    SpellFlatModByLabel[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                SpellFlatModByLabel[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[27])
         {
-            for (uint32 i = 0; i < MawPowers.size(); ++i)
+            for (uint32 i : MawPowers.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (MawPowers.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    MawPowers[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                MawPowers[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[28])
         {
-            for (uint32 i = 0; i < MultiFloorExploration.size(); ++i)
+            for (uint32 i : MultiFloorExploration.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (MultiFloorExploration.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    MultiFloorExploration[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                MultiFloorExploration[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[29])
         {
-            for (uint32 i = 0; i < RecipeProgression.size(); ++i)
+            for (uint32 i : RecipeProgression.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (RecipeProgression.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    RecipeProgression[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                RecipeProgression[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[30])
         {
-            for (uint32 i = 0; i < ReplayedQuests.size(); ++i)
+            for (uint32 i : ReplayedQuests.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (ReplayedQuests.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    ReplayedQuests[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                ReplayedQuests[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[31])
         {
-            for (uint32 i = 0; i < TaskQuests.size(); ++i)
+            for (uint32 i : TaskQuests.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (TaskQuests.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    TaskQuests[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                TaskQuests[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
     }
@@ -5843,62 +5672,44 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
     {
         if (changesMask[33])
         {
-            for (uint32 i = 0; i < DisabledSpells.size(); ++i)
+            for (uint32 i : DisabledSpells.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (DisabledSpells.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(DisabledSpells[i]);
-                }
+                data << int32(DisabledSpells[i]);
             }
         }
         if (changesMask[35])
         {
-            for (uint32 i = 0; i < PersonalCraftingOrderCounts.size(); ++i)
+            for (uint32 i : PersonalCraftingOrderCounts.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (PersonalCraftingOrderCounts.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    PersonalCraftingOrderCounts[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                PersonalCraftingOrderCounts[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[36])
         {
-            for (uint32 i = 0; i < NpcCraftingOrders.size(); ++i)
+            for (uint32 i : NpcCraftingOrders.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (NpcCraftingOrders.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    NpcCraftingOrders[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                NpcCraftingOrders[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[37])
         {
-            for (uint32 i = 0; i < CategoryCooldownMods.size(); ++i)
+            for (uint32 i : CategoryCooldownMods.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (CategoryCooldownMods.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    CategoryCooldownMods[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                CategoryCooldownMods[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[38])
         {
-            for (uint32 i = 0; i < WeeklySpellUses.size(); ++i)
+            for (uint32 i : WeeklySpellUses.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (WeeklySpellUses.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    WeeklySpellUses[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                WeeklySpellUses[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[39])
         {
-            for (uint32 i = 0; i < TrackedCollectableSources.size(); ++i)
+            for (uint32 i : TrackedCollectableSources.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (TrackedCollectableSources.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    TrackedCollectableSources[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                TrackedCollectableSources[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
     }
@@ -5925,22 +5736,16 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
     {
         if (changesMask[10])
         {
-            for (uint32 i = 0; i < PvpInfo.size(); ++i)
+            for (uint32 i : PvpInfo.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (PvpInfo.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    PvpInfo[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                PvpInfo[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[24])
         {
-            for (uint32 i = 0; i < CharacterRestrictions.size(); ++i)
+            for (uint32 i : CharacterRestrictions.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (CharacterRestrictions.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    CharacterRestrictions[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                CharacterRestrictions[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
     }
@@ -5948,32 +5753,23 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
     {
         if (changesMask[34])
         {
-            for (uint32 i = 0; i < CraftingOrders.size(); ++i)
+            for (uint32 i : CraftingOrders.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (CraftingOrders.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    CraftingOrders[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                CraftingOrders[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[40])
         {
-            for (uint32 i = 0; i < CharacterBankTabSettings.size(); ++i)
+            for (uint32 i : CharacterBankTabSettings.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (CharacterBankTabSettings.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    CharacterBankTabSettings[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                CharacterBankTabSettings[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[41])
         {
-            for (uint32 i = 0; i < AccountBankTabSettings.size(); ++i)
+            for (uint32 i : AccountBankTabSettings.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (AccountBankTabSettings.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    AccountBankTabSettings[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                AccountBankTabSettings[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[48])
@@ -6417,22 +6213,16 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
     }
     if (changesMask[150])
     {
-        for (uint32 i = 0; i < 105; ++i)
+        for (uint32 i : changesMask.GetSetBits(151, 105))
         {
-            if (changesMask[151 + i])
-            {
-                data << InvSlots[i];
-            }
+            data << InvSlots[i];
         }
     }
     if (changesMask[256])
     {
-        for (uint32 i = 0; i < 2; ++i)
+        for (uint32 i : changesMask.GetSetBits(257, 2))
         {
-            if (changesMask[257 + i])
-            {
-                RestInfo[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-            }
+            RestInfo[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
         }
     }
     if (changesMask[259])
@@ -6487,52 +6277,37 @@ void ActivePlayerData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
     }
     if (changesMask[320])
     {
-        for (uint32 i = 0; i < 32; ++i)
+        for (uint32 i : changesMask.GetSetBits(321, 32))
         {
-            if (changesMask[321 + i])
-            {
-                data << int32(CombatRatings[i]);
-            }
+            data << int32(CombatRatings[i]);
         }
     }
     if (changesMask[353])
     {
-        for (uint32 i = 0; i < 4; ++i)
+        for (uint32 i : changesMask.GetSetBits(354, 4))
         {
-            if (changesMask[354 + i])
-            {
-                data << uint32(NoReagentCostMask[i]);
-            }
+            data << uint32(NoReagentCostMask[i]);
         }
     }
     if (changesMask[358])
     {
-        for (uint32 i = 0; i < 2; ++i)
+        for (uint32 i : changesMask.GetSetBits(359, 2))
         {
-            if (changesMask[359 + i])
-            {
-                data << int32(ProfessionSkillLine[i]);
-            }
+            data << int32(ProfessionSkillLine[i]);
         }
     }
     if (changesMask[361])
     {
-        for (uint32 i = 0; i < 5; ++i)
+        for (uint32 i : changesMask.GetSetBits(362, 5))
         {
-            if (changesMask[362 + i])
-            {
-                data << uint32(BagSlotFlags[i]);
-            }
+            data << uint32(BagSlotFlags[i]);
         }
     }
     if (changesMask[367])
     {
-        for (uint32 i = 0; i < 17; ++i)
+        for (uint32 i : changesMask.GetSetBits(368, 17))
         {
-            if (changesMask[368 + i])
-            {
-                data << float(ItemUpgradeHighWatermark[i]);
-            }
+            data << float(ItemUpgradeHighWatermark[i]);
         }
     }
     data.FlushBits();
@@ -6832,22 +6607,16 @@ void GameObjectData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool
     {
         if (changesMask[2])
         {
-            for (uint32 i = 0; i < EnableDoodadSets.size(); ++i)
+            for (uint32 i : EnableDoodadSets.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (EnableDoodadSets.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(EnableDoodadSets[i]);
-                }
+                data << int32(EnableDoodadSets[i]);
             }
         }
         if (changesMask[3])
         {
-            for (uint32 i = 0; i < WorldEffects.size(); ++i)
+            for (uint32 i : WorldEffects.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (WorldEffects.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    data << int32(WorldEffects[i]);
-                }
+                data << int32(WorldEffects[i]);
             }
         }
         if (changesMask[4])
@@ -6949,6 +6718,24 @@ void GameObjectData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool
     }
 }
 
+void GameObjectData::WriteViewerDependentValues(ByteBuffer& data, GameObject const* owner, Player const* receiver) const
+{
+    ViewerDependentValue<StateWorldEffectIDsTag>::value_type stateWorldEffectIDs = {};
+
+    data << uint32(ViewerDependentValue<StateSpellVisualIDTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<SpawnTrackingStateAnimIDTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<SpawnTrackingStateAnimKitIDTag>::GetValue(this, owner, receiver));
+    stateWorldEffectIDs = ViewerDependentValue<StateWorldEffectIDsTag>::GetValue(this, owner, receiver);
+    data << uint32(stateWorldEffectIDs->size());
+    for (uint32 i = 0; i < stateWorldEffectIDs->size(); ++i)
+    {
+        data << uint32((*stateWorldEffectIDs)[i]);
+    }
+    data << uint32(ViewerDependentValue<StateWorldEffectsQuestObjectiveIDTag>::GetValue(this, owner, receiver));
+    data << uint32(ViewerDependentValue<FlagsTag>::GetValue(this, owner, receiver));
+    data << int8(ViewerDependentValue<StateTag>::GetValue(this, owner, receiver));
+}
+
 void GameObjectData::ClearChangesMask()
 {
     Base::ClearChangesMask(StateWorldEffectIDs);
@@ -7090,12 +6877,9 @@ void CorpseData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ign
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < Customizations.size(); ++i)
+            for (uint32 i : Customizations.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Customizations.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    Customizations[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                Customizations[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[2])
@@ -7145,12 +6929,9 @@ void CorpseData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bool ign
     }
     if (changesMask[13])
     {
-        for (uint32 i = 0; i < 19; ++i)
+        for (uint32 i : changesMask.GetSetBits(14, 19))
         {
-            if (changesMask[14 + i])
-            {
-                data << uint32(Items[i]);
-            }
+            data << uint32(Items[i]);
         }
     }
 }
@@ -7214,12 +6995,9 @@ void ScaleCurve::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, AreaTrigg
     }
     if (changesMask[4])
     {
-        for (uint32 i = 0; i < 2; ++i)
+        for (uint32 i : changesMask.GetSetBits(5, 2))
         {
-            if (changesMask[5 + i])
-            {
-                data << Points[i];
-            }
+            data << Points[i];
         }
     }
     data.FlushBits();
@@ -7360,12 +7138,9 @@ void AreaTriggerSplineCalculator::WriteUpdate(ByteBuffer& data, bool ignoreChang
     {
         if (changesMask[2])
         {
-            for (uint32 i = 0; i < Points.size(); ++i)
+            for (uint32 i : Points.GetChangedIndexes(ignoreChangesMask))
             {
-                if (Points.HasChanged(i) || ignoreChangesMask)
-                {
-                    data << Points[i];
-                }
+                data << Points[i];
             }
         }
     }
@@ -7600,22 +7375,16 @@ void AreaTriggerPolygon::WriteUpdate(ByteBuffer& data, bool ignoreChangesMask, A
     {
         if (changesMask[1])
         {
-            for (uint32 i = 0; i < Vertices.size(); ++i)
+            for (uint32 i : Vertices.GetChangedIndexes(ignoreChangesMask))
             {
-                if (Vertices.HasChanged(i) || ignoreChangesMask)
-                {
-                    data << Vertices[i];
-                }
+                data << Vertices[i];
             }
         }
         if (changesMask[2])
         {
-            for (uint32 i = 0; i < VerticesTarget.size(); ++i)
+            for (uint32 i : VerticesTarget.GetChangedIndexes(ignoreChangesMask))
             {
-                if (VerticesTarget.HasChanged(i) || ignoreChangesMask)
-                {
-                    data << VerticesTarget[i];
-                }
+                data << VerticesTarget[i];
             }
         }
         if (changesMask[3])
@@ -8330,12 +8099,9 @@ void ConversationData::WriteUpdate(ByteBuffer& data, Mask const& changesMask, bo
     {
         if (changesMask[3])
         {
-            for (uint32 i = 0; i < Actors.size(); ++i)
+            for (uint32 i : Actors.GetChangedIndexes(ignoreNestedChangesMask))
             {
-                if (Actors.HasChanged(i) || ignoreNestedChangesMask)
-                {
-                    Actors[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
-                }
+                Actors[i].WriteUpdate(data, ignoreNestedChangesMask, owner, receiver);
             }
         }
         if (changesMask[4])
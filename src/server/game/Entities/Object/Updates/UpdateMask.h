@@ -20,12 +20,62 @@
 
 #include "Define.h"
 #include <algorithm>
+#include <bit>
 #include <cstring> // std::memset
 
 namespace UpdateMaskHelpers
 {
     inline constexpr std::size_t GetBlockIndex(std::size_t bit) { return bit / 32u; }
     inline constexpr uint32 GetBlockFlag(std::size_t bit) { return 1u << (bit % 32u); }
+
+    /// Indexes of the set bits in [first, first + count) of a block array, relative to first, or all indexes when all is set
+    /// Finds the next set bit a block at a time, serializing a few changed elements of a large array doesn't test every bit
+    class SetBitRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            constexpr iterator(SetBitRange const* range, uint32 index) : _range(range), _index(index) { }
+
+            constexpr uint32 operator*() const { return _index; }
+            constexpr iterator& operator++() { _index = _range->FindNext(_index + 1); return *this; }
+            constexpr bool operator==(iterator const& right) const { return _index == right._index; }
+
+        private:
+            SetBitRange const* _range;
+            uint32 _index;
+        };
+
+        constexpr SetBitRange(uint32 const* blocks, uint32 first, uint32 count, bool all = false) : _blocks(blocks), _first(first), _count(count), _all(all) { }
+
+        constexpr iterator begin() const { return { this, FindNext(0) }; }
+        constexpr iterator end() const { return { this, _count }; }
+
+    private:
+        constexpr uint32 FindNext(uint32 index) const
+        {
+            if (_all || index >= _count)
+                return std::min(index, _count);
+
+            uint32 bit = _first + index;
+            uint32 endBit = _first + _count;
+            while (bit < endBit)
+            {
+                if (uint32 block = _blocks[GetBlockIndex(bit)] >> (bit % 32u))
+                    return std::min(bit + uint32(std::countr_zero(block)), endBit) - _first;
+
+                bit = (bit | 31u) + 1;
+            }
+
+            return _count;
+        }
+
+        uint32 const* _blocks;
+        uint32 _first;
+        uint32 _count;
+        bool _all;
+    };
 }
 
 template<uint32 Bits>
@@ -66,6 +116,12 @@ public:
         return (_blocks[UpdateMaskHelpers::GetBlockIndex(index)] & UpdateMaskHelpers::GetBlockFlag(index)) != 0;
     }
 
+    /// Indexes of the set bits in [first, first + count), relative to first, in ascending order
+    constexpr UpdateMaskHelpers::SetBitRange GetSetBits(uint32 first, uint32 count) const
+    {
+        return { _blocks.data(), first, count };
+    }
+
     constexpr bool IsAnySet() const
     {
         return std::ranges::any_of(_blocksMask, [](uint32 blockMask)
@@ -492,13 +492,11 @@ void Pet::SavePetToDB(PetSaveMode mode)
 
     _SaveSpells(trans);
     GetSpellHistory()->SaveToDB<Pet>(trans);
-    CharacterDatabase.CommitTransaction(trans);
 
-    // current/stable/not_in_slot
+    // current/stable/not_in_slot, saved in the same transaction as the auras and spells
     if (mode != PET_SAVE_AS_DELETED)
     {
         ObjectGuid::LowType ownerLowGUID = GetOwnerGUID().GetCounter();
-        trans = CharacterDatabase.BeginTransaction();
         // remove current data
 
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_PET_BY_ID);
@@ -530,11 +528,11 @@ void Pet::SavePetToDB(PetSaveMode mode)
         stmt->setUInt8(15, getPetType());
         stmt->setUInt16(16, GetSpecialization());
         trans->Append(stmt);
-
-        CharacterDatabase.CommitTransaction(trans);
     }
-    // delete
-    else
+
+    CharacterDatabase.CommitTransaction(trans);
+
+    if (mode == PET_SAVE_AS_DELETED)
     {
         RemoveAllAuras();
         DeleteFromDB(m_charmInfo->GetPetNumber());
@@ -1123,6 +1121,9 @@ void Pet::_LoadSpells(PreparedQueryResult result)
 
 void Pet::_SaveSpells(CharacterDatabaseTransaction trans)
 {
+    // new rows are inserted after all deletes, with a single multi-row statement
+    CharacterDatabasePreparedStatement* spellStmt = nullptr;
+
     for (PetSpellMap::iterator itr = m_spells.begin(), next = m_spells.begin(); itr != m_spells.end(); itr = next)
     {
         ++next;
@@ -1148,26 +1149,21 @@ void Pet::_SaveSpells(CharacterDatabaseTransaction trans)
                 stmt->setUInt32(0, m_charmInfo->GetPetNumber());
                 stmt->setUInt32(1, itr->first);
                 trans->Append(stmt);
-
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PET_SPELL);
-                stmt->setUInt32(0, m_charmInfo->GetPetNumber());
-                stmt->setUInt32(1, itr->first);
-                stmt->setUInt8(2, itr->second.active);
-                trans->Append(stmt);
-
-                break;
+                [[fallthrough]];
             case PETSPELL_NEW:
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PET_SPELL);
-                stmt->setUInt32(0, m_charmInfo->GetPetNumber());
-                stmt->setUInt32(1, itr->first);
-                stmt->setUInt8(2, itr->second.active);
-                trans->Append(stmt);
+                spellStmt = CharacterDatabase.AddPreparedStatementRow(spellStmt, CHAR_INS_PET_SPELL);
+                spellStmt->setUInt32(0, m_charmInfo->GetPetNumber());
+                spellStmt->setUInt32(1, itr->first);
+                spellStmt->setUInt8(2, itr->second.active);
                 break;
             case PETSPELL_UNCHANGED:
                 continue;
         }
         itr->second.state = PETSPELL_UNCHANGED;
     }
+
+    if (spellStmt)
+        trans->Append(spellStmt);
 }
 
 void Pet::_LoadAuras(PreparedQueryResult auraResult, PreparedQueryResult effectResult, uint32 timediff)
@@ -1299,6 +1295,9 @@ void Pet::_SaveAuras(CharacterDatabaseTransaction trans)
     stmt->setUInt32(0, m_charmInfo->GetPetNumber());
     trans->Append(stmt);
 
+    // all auras are inserted before their effects, each with a single multi-row statement
+    CharacterDatabasePreparedStatement* auraStmt = nullptr;
+    CharacterDatabasePreparedStatement* effectStmt = nullptr;
     uint8 index;
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
@@ -1315,7 +1314,7 @@ void Pet::_SaveAuras(CharacterDatabaseTransaction trans)
             key.Caster.Clear();
 
         index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PET_AURA);
+        stmt = auraStmt = CharacterDatabase.AddPreparedStatementRow(auraStmt, CHAR_INS_PET_AURA);
         stmt->setUInt32(index++, m_charmInfo->GetPetNumber());
         stmt->setBinary(index++, key.Caster.GetRawValue());
         stmt->setUInt32(index++, key.SpellId);
@@ -1326,12 +1325,11 @@ void Pet::_SaveAuras(CharacterDatabaseTransaction trans)
         stmt->setInt32(index++, aura->GetMaxDuration());
         stmt->setInt32(index++, aura->GetDuration());
         stmt->setUInt8(index++, aura->GetCharges());
-        trans->Append(stmt);
 
         for (AuraEffect const* effect : aura->GetAuraEffects())
         {
             index = 0;
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PET_AURA_EFFECT);
+            stmt = effectStmt = CharacterDatabase.AddPreparedStatementRow(effectStmt, CHAR_INS_PET_AURA_EFFECT);
             stmt->setUInt32(index++, m_charmInfo->GetPetNumber());
             stmt->setBinary(index++, key.Caster.GetRawValue());
             stmt->setUInt32(index++, key.SpellId);
@@ -1339,9 +1337,14 @@ void Pet::_SaveAuras(CharacterDatabaseTransaction trans)
             stmt->setUInt8(index++, effect->GetEffIndex());
             stmt->setInt32(index++, effect->GetAmount());
             stmt->setInt32(index++, effect->GetBaseAmount());
-            trans->Append(stmt);
         }
     }
+
+    if (auraStmt)
+        trans->Append(auraStmt);
+
+    if (effectStmt)
+        trans->Append(effectStmt);
 }
 
 bool Pet::addSpell(uint32 spellId, ActiveStates active /*= ACT_DECIDE*/, PetSpellState state /*= PETSPELL_NEW*/, PetSpellType type /*= PETSPELL_NORMAL*/)
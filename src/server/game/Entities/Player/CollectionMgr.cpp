@@ -26,6 +26,7 @@
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "Timer.h"
+#include "ToyPackets.h"
 #include "TransmogrificationPackets.h"
 #include "WorldSession.h"
 #include <boost/dynamic_bitset.hpp>
@@ -93,6 +94,16 @@ namespace
 
         return flags;
     }
+
+    uint32 GetBitsetBlock(boost::dynamic_bitset<uint32> const& bitset, std::size_t blockIndex)
+    {
+        uint32 block = 0;
+        for (std::size_t bit = blockIndex * 32, end = std::min(bit + 32, bitset.size()); bit < end; ++bit)
+            if (bitset.test(bit))
+                block |= 1 << (bit % 32);
+
+        return block;
+    }
 }
 
 CollectionMgr::CollectionMgr(WorldSession* owner) : _owner(owner), _appearances(std::make_unique<boost::dynamic_bitset<uint32>>()), _transmogIllusions(std::make_unique<boost::dynamic_bitset<uint32>>())
@@ -134,20 +145,31 @@ void CollectionMgr::LoadAccountToys(PreparedQueryResult result)
 void CollectionMgr::SaveAccountToys(LoginDatabaseTransaction trans)
 {
     LoginDatabasePreparedStatement* stmt = nullptr;
-    for (auto const& toy : _toys)
+    for (uint32 itemId : _changedToys)
     {
+        auto toy = _toys.find(itemId);
+        if (toy == _toys.end())
+            continue;
+
         stmt = LoginDatabase.GetPreparedStatement(LOGIN_REP_ACCOUNT_TOYS);
         stmt->setUInt32(0, _owner->GetBattlenetAccountId());
-        stmt->setUInt32(1, toy.first);
-        stmt->setBool(2, toy.second.HasFlag(ToyFlags::Favorite));
-        stmt->setBool(3, toy.second.HasFlag(ToyFlags::HasFanfare));
+        stmt->setUInt32(1, toy->first);
+        stmt->setBool(2, toy->second.HasFlag(ToyFlags::Favorite));
+        stmt->setBool(3, toy->second.HasFlag(ToyFlags::HasFanfare));
         trans->Append(stmt);
     }
+
+    _changedToys.clear();
 }
 
 bool CollectionMgr::UpdateAccountToys(uint32 itemId, bool isFavourite, bool hasFanfare)
 {
-    return _toys.insert(ToyBoxContainer::value_type(itemId, GetToyFlags(isFavourite, hasFanfare))).second;
+    if (!_toys.insert(ToyBoxContainer::value_type(itemId, GetToyFlags(isFavourite, hasFanfare))).second)
+        return false;
+
+    _changedToys.insert(itemId);
+    InvalidateFullCollectionUpdates();
+    return true;
 }
 
 void CollectionMgr::ToySetFavorite(uint32 itemId, bool favorite)
@@ -160,6 +182,9 @@ void CollectionMgr::ToySetFavorite(uint32 itemId, bool favorite)
         itr->second |= ToyFlags::Favorite;
     else
         itr->second &= ~ToyFlags::Favorite;
+
+    _changedToys.insert(itemId);
+    InvalidateFullCollectionUpdates();
 }
 
 void CollectionMgr::ToyClearFanfare(uint32 itemId)
@@ -169,6 +194,8 @@ void CollectionMgr::ToyClearFanfare(uint32 itemId)
         return;
 
     itr->second &= ~ ToyFlags::HasFanfare;
+    _changedToys.insert(itemId);
+    InvalidateFullCollectionUpdates();
 }
 
 void CollectionMgr::OnItemAdded(Item* item)
@@ -212,19 +239,30 @@ void CollectionMgr::LoadAccountHeirlooms(PreparedQueryResult result)
 void CollectionMgr::SaveAccountHeirlooms(LoginDatabaseTransaction trans)
 {
     LoginDatabasePreparedStatement* stmt = nullptr;
-    for (auto const& heirloom : _heirlooms)
+    for (uint32 itemId : _changedHeirlooms)
     {
+        auto heirloom = _heirlooms.find(itemId);
+        if (heirloom == _heirlooms.end())
+            continue;
+
         stmt = LoginDatabase.GetPreparedStatement(LOGIN_REP_ACCOUNT_HEIRLOOMS);
         stmt->setUInt32(0, _owner->GetBattlenetAccountId());
-        stmt->setUInt32(1, heirloom.first);
-        stmt->setUInt32(2, heirloom.second.flags);
+        stmt->setUInt32(1, heirloom->first);
+        stmt->setUInt32(2, heirloom->second.flags);
         trans->Append(stmt);
     }
+
+    _changedHeirlooms.clear();
 }
 
 bool CollectionMgr::UpdateAccountHeirlooms(uint32 itemId, uint32 flags)
 {
-    return _heirlooms.insert(HeirloomContainer::value_type(itemId, HeirloomData(flags, 0))).second;
+    if (!_heirlooms.insert(HeirloomContainer::value_type(itemId, HeirloomData(flags, 0))).second)
+        return false;
+
+    _changedHeirlooms.insert(itemId);
+    InvalidateFullCollectionUpdates();
+    return true;
 }
 
 uint32 CollectionMgr::GetHeirloomBonus(uint32 itemId) const
@@ -288,6 +326,8 @@ void CollectionMgr::UpgradeHeirloom(uint32 itemId, int32 castItem)
     player->SetHeirloomFlags(offset, flags);
     itr->second.flags = flags;
     itr->second.bonusId = bonusId;
+    _changedHeirlooms.insert(itemId);
+    InvalidateFullCollectionUpdates();
 }
 
 void CollectionMgr::CheckHeirloomUpgrades(Item* item)
@@ -330,6 +370,8 @@ void CollectionMgr::CheckHeirloomUpgrades(Item* item)
 
             _heirlooms.erase(itr);
             _heirlooms[newItemId] = 0;
+            _changedHeirlooms.insert(newItemId);
+            InvalidateFullCollectionUpdates();
 
             return;
         }
@@ -376,14 +418,20 @@ void CollectionMgr::LoadAccountMounts(PreparedQueryResult result)
 
 void CollectionMgr::SaveAccountMounts(LoginDatabaseTransaction trans)
 {
-    for (auto const& mount : _mounts)
+    for (uint32 spellId : _changedMounts)
     {
+        auto mount = _mounts.find(spellId);
+        if (mount == _mounts.end())
+            continue;
+
         LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_REP_ACCOUNT_MOUNTS);
         stmt->setUInt32(0, _owner->GetBattlenetAccountId());
-        stmt->setUInt32(1, mount.first);
-        stmt->setUInt8(2, mount.second);
+        stmt->setUInt32(1, mount->first);
+        stmt->setUInt8(2, mount->second);
         trans->Append(stmt);
     }
+
+    _changedMounts.clear();
 }
 
 bool CollectionMgr::AddMount(uint32 spellId, MountStatusFlags flags, bool factionMount /*= false*/, bool learned /*= false*/)
@@ -400,7 +448,11 @@ bool CollectionMgr::AddMount(uint32 spellId, MountStatusFlags flags, bool factio
     if (itr != FactionSpecificMounts.end() && !factionMount)
         AddMount(itr->second, flags, true, learned);
 
-    _mounts.insert(MountContainer::value_type(spellId, flags));
+    if (_mounts.insert(MountContainer::value_type(spellId, flags)).second)
+    {
+        _changedMounts.insert(spellId);
+        InvalidateFullCollectionUpdates();
+    }
 
     // Mount condition only applies to using it, should still learn it.
     if (!ConditionMgr::IsPlayerMeetingCondition(player, mount->PlayerConditionID))
@@ -428,6 +480,8 @@ void CollectionMgr::MountSetFavorite(uint32 spellId, bool favorite)
     else
         itr->second = MountStatusFlags(itr->second & ~MOUNT_IS_FAVORITE);
 
+    _changedMounts.insert(spellId);
+    InvalidateFullCollectionUpdates();
     SendSingleMountUpdate(*itr);
 }
 
@@ -532,29 +586,30 @@ void CollectionMgr::LoadAccountItemAppearances(PreparedQueryResult knownAppearan
         ASSERT(hiddenAppearance);
         if (_appearances->size() <= hiddenAppearance->ID)
             _appearances->resize(hiddenAppearance->ID + 1);
+        else if (_appearances->test(hiddenAppearance->ID))
+            continue;
 
         _appearances->set(hiddenAppearance->ID);
+        _changedAppearanceBlocks.insert(hiddenAppearance->ID / 32);
     }
 }
 
 void CollectionMgr::SaveAccountItemAppearances(LoginDatabaseTransaction trans)
 {
-    uint16 blockIndex = 0;
-    boost::to_block_range(*_appearances, DynamicBitsetBlockOutputIterator([this, &blockIndex, trans = trans.get()](uint32 blockValue)
+    LoginDatabasePreparedStatement* stmt;
+
+    // this table is only appended/bits are set (never cleared) so only blocks that got new bits since the last save are written
+    for (uint32 blockIndex : _changedAppearanceBlocks)
     {
-        if (blockValue) // this table is only appended/bits are set (never cleared) so don't save empty blocks
-        {
-            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_ITEM_APPEARANCES);
-            stmt->setUInt32(0, _owner->GetBattlenetAccountId());
-            stmt->setUInt16(1, blockIndex);
-            stmt->setUInt32(2, blockValue);
-            trans->Append(stmt);
-        }
+        stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_ITEM_APPEARANCES);
+        stmt->setUInt32(0, _owner->GetBattlenetAccountId());
+        stmt->setUInt16(1, blockIndex);
+        stmt->setUInt32(2, GetBitsetBlock(*_appearances, blockIndex));
+        trans->Append(stmt);
+    }
 
-        ++blockIndex;
-    }));
+    _changedAppearanceBlocks.clear();
 
-    LoginDatabasePreparedStatement* stmt;
     for (auto itr = _favoriteAppearances.begin(); itr != _favoriteAppearances.end();)
     {
         switch (itr->second)
@@ -738,6 +793,7 @@ void CollectionMgr::AddItemAppearance(ItemModifiedAppearanceEntry const* itemMod
     _appearances->set(itemModifiedAppearance->ID);
     uint32 blockIndex = itemModifiedAppearance->ID / 32;
     uint32 bitIndex = itemModifiedAppearance->ID % 32;
+    _changedAppearanceBlocks.insert(blockIndex);
     owner->AddTransmogFlag(blockIndex, 1 << bitIndex);
     auto temporaryAppearance = _temporaryAppearances.find(itemModifiedAppearance->ID);
     if (temporaryAppearance != _temporaryAppearances.end())
@@ -853,6 +909,8 @@ void CollectionMgr::SetAppearanceIsFavorite(uint32 itemModifiedAppearanceId, boo
     else
         return;
 
+    InvalidateFullCollectionUpdates();
+
     WorldPackets::Transmogrification::AccountTransmogUpdate accountTransmogUpdate;
     accountTransmogUpdate.IsFullUpdate = false;
     accountTransmogUpdate.IsSetFavorite = apply;
@@ -861,18 +919,6 @@ void CollectionMgr::SetAppearanceIsFavorite(uint32 itemModifiedAppearanceId, boo
     _owner->SendPacket(accountTransmogUpdate.Write());
 }
 
-void CollectionMgr::SendFavoriteAppearances() const
-{
-    WorldPackets::Transmogrification::AccountTransmogUpdate accountTransmogUpdate;
-    accountTransmogUpdate.IsFullUpdate = true;
-    accountTransmogUpdate.FavoriteAppearances.reserve(_favoriteAppearances.size());
-    for (auto [itemModifiedAppearanceId, state] : _favoriteAppearances)
-        if (state != CollectionItemState::Removed)
-            accountTransmogUpdate.FavoriteAppearances.push_back(itemModifiedAppearanceId);
-
-    _owner->SendPacket(accountTransmogUpdate.Write());
-}
-
 void CollectionMgr::LoadTransmogIllusions()
 {
     Player* owner = _owner->GetPlayer();
@@ -917,27 +963,27 @@ void CollectionMgr::LoadAccountTransmogIllusions(PreparedQueryResult knownTransm
     {
         if (_transmogIllusions->size() <= illusionId)
             _transmogIllusions->resize(illusionId + 1);
+        else if (_transmogIllusions->test(illusionId))
+            continue;
 
         _transmogIllusions->set(illusionId);
+        _changedTransmogIllusionBlocks.insert(illusionId / 32);
     }
 }
 
 void CollectionMgr::SaveAccountTransmogIllusions(LoginDatabaseTransaction trans)
 {
-    uint16 blockIndex = 0;
-
-    boost::to_block_range(*_transmogIllusions, DynamicBitsetBlockOutputIterator([this, &blockIndex, trans = trans.get()](uint32 blockValue)
+    // this table is only appended/bits are set (never cleared) so only blocks that got new bits since the last save are written
+    for (uint32 blockIndex : _changedTransmogIllusionBlocks)
     {
-        if (blockValue) // this table is only appended/bits are set (never cleared) so don't save empty blocks
-        {
-            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_TRANSMOG_ILLUSIONS);
-            stmt->setUInt32(0, _owner->GetBattlenetAccountId());
-            stmt->setUInt16(1, blockIndex);
-            stmt->setUInt32(2, blockValue);
-            trans->Append(stmt);
-        }
-        ++blockIndex;
-    }));
+        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_INS_BNET_TRANSMOG_ILLUSIONS);
+        stmt->setUInt32(0, _owner->GetBattlenetAccountId());
+        stmt->setUInt16(1, blockIndex);
+        stmt->setUInt32(2, GetBitsetBlock(*_transmogIllusions, blockIndex));
+        trans->Append(stmt);
+    }
+
+    _changedTransmogIllusionBlocks.clear();
 }
 
 void CollectionMgr::AddTransmogIllusion(uint32 transmogIllusionId)
@@ -955,6 +1001,7 @@ void CollectionMgr::AddTransmogIllusion(uint32 transmogIllusionId)
     _transmogIllusions->set(transmogIllusionId);
     uint32 blockIndex = transmogIllusionId / 32;
     uint32 bitIndex = transmogIllusionId % 32;
+    _changedTransmogIllusionBlocks.insert(blockIndex);
 
     owner->AddIllusionFlag(blockIndex, 1 << bitIndex);
 }
@@ -1037,6 +1084,7 @@ void CollectionMgr::SaveAccountWarbandScenes(LoginDatabaseTransaction trans)
                 stmt->setUInt32(1, warbandSceneId);
                 trans->Append(stmt);
                 itr = _warbandScenes.erase(itr);
+                InvalidateFullCollectionUpdates();
                 break;
             default:
                 ++itr;
@@ -1052,6 +1100,7 @@ void CollectionMgr::AddWarbandScene(uint32 warbandSceneId)
 
     WarbandSceneCollectionItem& warbandScene = _warbandScenes.try_emplace(warbandSceneId).first->second;
     warbandScene.State = CollectionItemState::New;
+    InvalidateFullCollectionUpdates();
 
     uint32 blockIndex = warbandSceneId / 32;
     uint32 bitIndex = warbandSceneId % 32;
@@ -1076,6 +1125,8 @@ void CollectionMgr::SetWarbandSceneIsFavorite(uint32 warbandSceneId, bool apply)
 
     if (warbandScene->State == CollectionItemState::Unchanged)
         warbandScene->State = CollectionItemState::Changed;
+
+    InvalidateFullCollectionUpdates();
 }
 
 void CollectionMgr::SendWarbandSceneCollectionData() const
@@ -1096,3 +1147,51 @@ void CollectionMgr::SendWarbandSceneCollectionData() const
 
     _owner->SendPacket(accountItemCollection.Write());
 }
+
+void CollectionMgr::SendFullCollectionUpdates()
+{
+    if (_fullCollectionUpdates.empty())
+    {
+        // SMSG_ACCOUNT_MOUNT_UPDATE
+        WorldPackets::Misc::AccountMountUpdate mountUpdate;
+        mountUpdate.IsFullUpdate = true;
+        mountUpdate.Mounts = &_mounts;
+        _fullCollectionUpdates.push_back(*mountUpdate.Write());
+
+        // SMSG_ACCOUNT_TOYS_UPDATE
+        WorldPackets::Toy::AccountToyUpdate toyUpdate;
+        toyUpdate.IsFullUpdate = true;
+        toyUpdate.Toys = &_toys;
+        _fullCollectionUpdates.push_back(*toyUpdate.Write());
+
+        // SMSG_ACCOUNT_HEIRLOOM_UPDATE
+        WorldPackets::Misc::AccountHeirloomUpdate heirloomUpdate;
+        heirloomUpdate.IsFullUpdate = true;
+        heirloomUpdate.Heirlooms = &_heirlooms;
+        _fullCollectionUpdates.push_back(*heirloomUpdate.Write());
+
+        // SMSG_ACCOUNT_TRANSMOG_UPDATE
+        WorldPackets::Transmogrification::AccountTransmogUpdate accountTransmogUpdate;
+        accountTransmogUpdate.IsFullUpdate = true;
+        accountTransmogUpdate.FavoriteAppearances.reserve(_favoriteAppearances.size());
+        for (auto [itemModifiedAppearanceId, state] : _favoriteAppearances)
+            if (state != CollectionItemState::Removed)
+                accountTransmogUpdate.FavoriteAppearances.push_back(itemModifiedAppearanceId);
+
+        _fullCollectionUpdates.push_back(*accountTransmogUpdate.Write());
+
+        // SMSG_ACCOUNT_WARBAND_SCENE_UPDATE
+        WorldPackets::Misc::AccountWarbandSceneUpdate warbandSceneUpdate;
+        warbandSceneUpdate.IsFullUpdate = true;
+        warbandSceneUpdate.WarbandScenes = &_warbandScenes;
+        _fullCollectionUpdates.push_back(*warbandSceneUpdate.Write());
+    }
+
+    for (WorldPacket const& packet : _fullCollectionUpdates)
+        _owner->SendPacket(&packet);
+}
+
+void CollectionMgr::InvalidateFullCollectionUpdates()
+{
+    _fullCollectionUpdates.clear();
+}
@@ -26,8 +26,10 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 class Item;
+class WorldPacket;
 class WorldSession;
 struct ItemModifiedAppearanceEntry;
 
@@ -170,7 +172,6 @@ public:
     std::unordered_set<uint32> GetAppearanceIds() const;
 
     void SetAppearanceIsFavorite(uint32 itemModifiedAppearanceId, bool apply);
-    void SendFavoriteAppearances() const;
 
     // Illusions
     void LoadTransmogIllusions();
@@ -190,10 +191,14 @@ public:
 
     void SendWarbandSceneCollectionData() const;
 
+    // Full SMSG_ACCOUNT_*_UPDATE packets of every character login, built once and reused by all characters of the session until the collections change
+    void SendFullCollectionUpdates();
+
 private:
     bool CanAddAppearance(ItemModifiedAppearanceEntry const* itemModifiedAppearance) const;
     void AddItemAppearance(ItemModifiedAppearanceEntry const* itemModifiedAppearance);
     void AddTemporaryAppearance(ObjectGuid const& itemGuid, ItemModifiedAppearanceEntry const* itemModifiedAppearance);
+    void InvalidateFullCollectionUpdates();
 
     WorldSession* _owner;
 
@@ -205,6 +210,15 @@ private:
     std::unordered_map<uint32, CollectionItemState> _favoriteAppearances;
     std::unique_ptr<boost::dynamic_bitset<uint32>> _transmogIllusions;
     WarbandSceneCollectionContainer _warbandScenes;
+
+    // entries and bitset blocks changed since the last save, only these are written
+    std::unordered_set<uint32> _changedToys;
+    std::unordered_set<uint32> _changedHeirlooms;
+    std::unordered_set<uint32> _changedMounts;
+    std::unordered_set<uint32> _changedAppearanceBlocks;
+    std::unordered_set<uint32> _changedTransmogIllusionBlocks;
+
+    std::vector<WorldPacket> _fullCollectionUpdates;
 };
 
 #endif // TRINITYCORE_COLLECTION_MGR_H
@@ -88,6 +88,7 @@
 #include "MailPackets.h"
 #include "MapManager.h"
 #include "MapUtils.h"
+#include "Metric.h"
 #include "MiscPackets.h"
 #include "MotionMaster.h"
 #include "MovementPackets.h"
@@ -125,7 +126,6 @@
 #include "StringConvert.h"
 #include "TalentPackets.h"
 #include "TerrainMgr.h"
-#include "ToyPackets.h"
 #include "TradeData.h"
 #include "TraitMgr.h"
 #include "TraitPacketsCommon.h"
@@ -149,6 +149,11 @@
 #define DEATH_EXPIRE_STEP (5*MINUTE)
 #define MAX_DEATH_COUNT 3
 
+// incremental visibility scans (Visibility.Incremental) between mandatory full rescans
+#define MAX_INCREMENTAL_VISIBILITY_SCANS 8
+// viewpoint movement since the last full rescan, as fraction of sight range, that forces a new full rescan
+#define MAX_INCREMENTAL_VISIBILITY_DRIFT 0.25f
+
 enum PlayerSpells
 {
     SPELL_EXPERIENCE_ELIMINATED = 206662,
@@ -156,7 +161,7 @@ enum PlayerSpells
 
 static uint32 copseReclaimDelay[MAX_DEATH_COUNT] = { 30, 60, 120 };
 
-Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
+Player::Player(WorldSession* session) : Unit(true), m_changedSaveData(PlayerSaveData::All), m_sceneMgr(this)
 {
     m_objectTypeId = TYPEID_PLAYER;
 
@@ -235,6 +240,7 @@ Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
     m_MirrorTimerFlagsLast = UNDERWATER_NONE;
 
     m_hostileReferenceCheckTimer = 0;
+    m_nextEnchantExpireTime = TimePoint::max();
     m_drunkTimer = 0;
     m_deathTimer = 0;
     m_deathExpireTime = 0;
@@ -264,6 +270,8 @@ Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
     m_lastpetnumber = 0;
 
     m_mailsUpdated = false;
+    m_mailContentLoaded = false;
+    m_mailContentLoading = false;
     unReadMails = 0;
     m_nextMailDelivereTime = 0;
 
@@ -338,6 +346,9 @@ Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
 
     _cinematicMgr = std::make_unique<CinematicMgr>(this);
 
+    _incrementalVisibilityScans = 0;
+    _fullVisibilityRescanRequired = true;
+
     m_achievementMgr = std::make_unique<PlayerAchievementMgr>(this);
     m_reputationMgr = std::make_unique<ReputationMgr>(this);
     m_questObjectiveCriteriaMgr = std::make_unique<QuestObjectiveCriteriaMgr>(this);
@@ -350,6 +361,8 @@ Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
     _restMgr = std::make_unique<RestMgr>(this);
 
     _usePvpItemLevels = false;
+
+    m_questStatusRevision = 0;
 }
 
 Player::~Player()
@@ -933,9 +946,12 @@ void Player::Update(uint32 p_time)
     }
 
     //used to implement delayed far teleport
-    SetCanDelayTeleport(true);
-    Unit::Update(p_time);
-    SetCanDelayTeleport(false);
+    {
+        TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("player_update_time", TC_METRIC_TAG("phase", "Unit"));
+        SetCanDelayTeleport(true);
+        Unit::Update(p_time);
+        SetCanDelayTeleport(false);
+    }
 
     // Unit::Update updates the spell history and spell states. We can now check if we can launch another pending cast.
     if (CanExecutePendingSpellCastRequest())
@@ -943,45 +959,17 @@ void Player::Update(uint32 p_time)
 
     time_t now = GameTime::GetGameTime();
 
-    UpdatePvPFlag(now);
+    // everything checked against whole seconds of game time only changes on the first update of a second
+    if (now > m_Last_tick)
+        UpdateEverySecond(now);
 
     UpdateContestedPvP(p_time);
 
-    UpdateDuelFlag(now);
-
-    CheckDuelDistance(now);
-
-    UpdateAfkReport(now);
-
-    if (GetCombatManager().HasPvPCombat())
-        if (Aura* aura = GetAura(SPELL_PVP_RULES_ENABLED))
-            if (!aura->IsPermanent())
-                aura->SetDuration(aura->GetSpellInfo()->GetMaxDuration());
-
     Unit::AIUpdateTick(p_time);
 
-    // Update items that have just a limited lifetime
-    if (now > m_Last_tick)
-        UpdateItemDuration(uint32(now - m_Last_tick));
-
-    // check every second
-    if (now > m_Last_tick + 1)
-        UpdateSoulboundTradeItems();
-
-    // If mute expired, remove it from the DB
-    if (GetSession()->m_muteTime && GetSession()->m_muteTime < now)
-    {
-        GetSession()->m_muteTime = 0;
-        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_MUTE_TIME);
-        stmt->setInt64(0, 0); // Set the mute time to 0
-        stmt->setString(1, ""sv);
-        stmt->setString(2, ""sv);
-        stmt->setUInt32(3, GetSession()->GetAccountId());
-        LoginDatabase.Execute(stmt);
-    }
-
     if (!m_timedquests.empty())
     {
+        TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("player_update_time", TC_METRIC_TAG("phase", "Timed quests"));
         QuestSet::iterator iter = m_timedquests.begin();
         while (iter != m_timedquests.end())
         {
@@ -1001,7 +989,10 @@ void Player::Update(uint32 p_time)
         }
     }
 
-    m_achievementMgr->UpdateTimedCriteria(Milliseconds(p_time));
+    {
+        TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("player_update_time", TC_METRIC_TAG("phase", "Timed criteria"));
+        m_achievementMgr->UpdateTimedCriteria(Milliseconds(p_time));
+    }
 
     DoMeleeAttackIfReady();
 
@@ -1018,6 +1009,7 @@ void Player::Update(uint32 p_time)
 
     if (IsAlive())
     {
+        TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("player_update_time", TC_METRIC_TAG("phase", "Regeneration"));
         m_regenTimer += p_time;
         RegenerateAll();
     }
@@ -1029,6 +1021,7 @@ void Player::Update(uint32 p_time)
     {
         if (p_time >= m_nextSave)
         {
+            TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("player_update_time", TC_METRIC_TAG("phase", "Save"));
             // m_nextSave reset in SaveToDB call
             SaveToDB();
             TC_LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
@@ -1038,7 +1031,10 @@ void Player::Update(uint32 p_time)
     }
 
     //Handle Water/drowning
-    HandleDrowning(p_time);
+    {
+        TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("player_update_time", TC_METRIC_TAG("phase", "Drowning"));
+        HandleDrowning(p_time);
+    }
 
     // Played time
     if (now > m_Last_tick)
@@ -1082,25 +1078,9 @@ void Player::Update(uint32 p_time)
             m_deathTimer -= p_time;
     }
 
-    UpdateEnchantTime(p_time);
+    UpdateEnchantTime();
     UpdateHomebindTime(p_time);
 
-    if (!_instanceResetTimes.empty())
-    {
-        for (InstanceTimeMap::iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end();)
-        {
-            if (itr->second < now)
-                _instanceResetTimes.erase(itr++);
-            else
-                ++itr;
-        }
-    }
-
-    Pet* pet = GetPet();
-    if (pet && !pet->IsWithinDistInMap(this, GetMap()->GetVisibilityRange()) && !pet->isPossessed())
-    //if (pet && !pet->IsWithinDistInMap(this, GetMap()->GetVisibilityDistance()) && (GetCharmGUID() && (pet->GetGUID() != GetCharmGUID())))
-        RemovePet(pet, PET_SAVE_NOT_IN_SLOT, true);
-
     if (IsAlive())
     {
         if (m_hostileReferenceCheckTimer <= p_time)
@@ -1119,6 +1099,62 @@ void Player::Update(uint32 p_time)
         TeleportTo(m_teleport_dest, m_teleport_options, m_teleportSpellId);
 }
 
+void Player::UpdateEverySecond(time_t now)
+{
+    TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("player_update_time", TC_METRIC_TAG("phase", "Every second"));
+
+    UpdatePvPFlag(now);
+
+    UpdateDuelFlag(now);
+
+    CheckDuelDistance(now);
+
+    UpdateAfkReport(now);
+
+    if (GetCombatManager().HasPvPCombat())
+        if (Aura* aura = GetAura(SPELL_PVP_RULES_ENABLED))
+            if (!aura->IsPermanent())
+                aura->SetDuration(aura->GetSpellInfo()->GetMaxDuration());
+
+    // Update items that have just a limited lifetime
+    UpdateItemDuration(uint32(now - m_Last_tick));
+
+    // check every second
+    if (now > m_Last_tick + 1)
+        UpdateSoulboundTradeItems();
+
+    // If mute expired, remove it from the DB
+    if (GetSession()->m_muteTime && GetSession()->m_muteTime < now)
+    {
+        GetSession()->m_muteTime = 0;
+        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_MUTE_TIME);
+        stmt->setInt64(0, 0); // Set the mute time to 0
+        stmt->setString(1, ""sv);
+        stmt->setString(2, ""sv);
+        stmt->setUInt32(3, GetSession()->GetAccountId());
+        LoginDatabase.Execute(stmt);
+    }
+
+    if (!_instanceResetTimes.empty())
+    {
+        for (InstanceTimeMap::iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end();)
+        {
+            if (itr->second < now)
+            {
+                _instanceResetTimes.erase(itr++);
+                SetSaveDataChanged(PlayerSaveData::InstanceTimes);
+            }
+            else
+                ++itr;
+        }
+    }
+
+    Pet* pet = GetPet();
+    if (pet && !pet->IsWithinDistInMap(this, GetMap()->GetVisibilityRange()) && !pet->isPossessed())
+    //if (pet && !pet->IsWithinDistInMap(this, GetMap()->GetVisibilityDistance()) && (GetCharmGUID() && (pet->GetGUID() != GetCharmGUID())))
+        RemovePet(pet, PET_SAVE_NOT_IN_SLOT, true);
+}
+
 void Player::Heartbeat()
 {
     Unit::Heartbeat();
@@ -1505,6 +1541,7 @@ void Player::ProcessDelayedOperations()
         {
             CastSpell(this, m_bgData.mountSpell, true);
             m_bgData.mountSpell = 0;
+            SetSaveDataChanged(PlayerSaveData::BattlegroundData);
         }
     }
 
@@ -1515,6 +1552,7 @@ void Player::ProcessDelayedOperations()
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[0]);
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[1]);
             m_bgData.ClearTaxiPath();
+            SetSaveDataChanged(PlayerSaveData::BattlegroundData);
 
             ContinueTaxiFlight();
         }
@@ -5586,6 +5624,7 @@ bool Player::UpdateFishingSkill(int32 expansion)
 
     uint8 stepsNeededToLevelUp = GetFishingStepsNeededToLevelUp(skillValue);
     ++m_fishingSteps;
+    SetSaveDataChanged(PlayerSaveData::FishingSteps);
 
     if (m_fishingSteps >= stepsNeededToLevelUp)
     {
@@ -7573,7 +7612,7 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
     uint32 const oldZone = m_zoneUpdateId;
     m_zoneUpdateId = newZone;
 
-    GetMap()->UpdatePlayerZoneStats(oldZone, newZone);
+    GetMap()->UpdatePlayerZoneStats(this, oldZone, newZone);
 
     // call leave script hooks immedately (before updating flags)
     if (oldZone != newZone)
@@ -13176,8 +13215,13 @@ void Player::UpdateItemDuration(uint32 time, bool realtimeonly)
     }
 }
 
-void Player::UpdateEnchantTime(uint32 time)
+void Player::UpdateEnchantTime()
 {
+    TimePoint now = GameTime::Now();
+    if (m_enchantDuration.empty() || now < m_nextEnchantExpireTime)
+        return;
+
+    m_nextEnchantExpireTime = TimePoint::max();
     for (EnchantDurationList::iterator itr = m_enchantDuration.begin(), next; itr != m_enchantDuration.end(); itr = next)
     {
         ASSERT(itr->item);
@@ -13186,15 +13230,15 @@ void Player::UpdateEnchantTime(uint32 time)
         {
             next = m_enchantDuration.erase(itr);
         }
-        else if (itr->leftduration <= time)
+        else if (itr->expireTime <= now)
         {
             ApplyEnchantment(itr->item, itr->slot, false, false);
             itr->item->ClearEnchantment(itr->slot);
             next = m_enchantDuration.erase(itr);
         }
-        else if (itr->leftduration > time)
+        else
         {
-            itr->leftduration -= time;
+            m_nextEnchantExpireTime = std::min(m_nextEnchantExpireTime, itr->expireTime);
             ++next;
         }
     }
@@ -13220,7 +13264,7 @@ void Player::RemoveEnchantmentDurations(Item* item)
         if (itr->item == item)
         {
             // save duration in item
-            item->SetEnchantmentDuration(EnchantmentSlot(itr->slot), itr->leftduration, this);
+            item->SetEnchantmentDuration(EnchantmentSlot(itr->slot), itr->GetLeftDuration(GameTime::Now()), this);
             itr = m_enchantDuration.erase(itr);
         }
         else
@@ -13298,7 +13342,7 @@ void Player::AddEnchantmentDuration(Item* item, EnchantmentSlot slot, uint32 dur
     {
         if (itr->item == item && itr->slot == slot)
         {
-            itr->item->SetEnchantmentDuration(itr->slot, itr->leftduration, this);
+            itr->item->SetEnchantmentDuration(itr->slot, itr->GetLeftDuration(GameTime::Now()), this);
             m_enchantDuration.erase(itr);
             break;
         }
@@ -13306,7 +13350,9 @@ void Player::AddEnchantmentDuration(Item* item, EnchantmentSlot slot, uint32 dur
     if (duration > 0)
     {
         GetSession()->SendItemEnchantTimeUpdate(GetGUID(), item->GetGUID(), slot, uint32(duration/1000));
-        m_enchantDuration.push_back(EnchantDuration(item, slot, duration));
+        TimePoint expireTime = GameTime::Now() + Milliseconds(duration);
+        m_enchantDuration.push_back(EnchantDuration(item, slot, expireTime));
+        m_nextEnchantExpireTime = std::min(m_nextEnchantExpireTime, expireTime);
     }
 }
 
@@ -13720,7 +13766,7 @@ void Player::UpdateSkillEnchantments(uint16 skill_id, uint16 curr_value, uint16
 void Player::SendEnchantmentDurations()
 {
     for (EnchantDurationList::const_iterator itr = m_enchantDuration.begin(); itr != m_enchantDuration.end(); ++itr)
-        GetSession()->SendItemEnchantTimeUpdate(GetGUID(), itr->item->GetGUID(), itr->slot, uint32(itr->leftduration) / 1000);
+        GetSession()->SendItemEnchantTimeUpdate(GetGUID(), itr->item->GetGUID(), itr->slot, itr->GetLeftDuration(GameTime::Now()) / 1000);
 }
 
 void Player::SendItemDurations()
@@ -14765,6 +14811,7 @@ void Player::AddQuest(Quest const* quest, Object* questGiver)
     questStatusData.AcceptTime = GameTime::GetGameTime();
 
     m_QuestStatusSave[quest_id] = QUEST_DEFAULT_SAVE_TYPE;
+    ++m_questStatusRevision;
 
     StartCriteria(CriteriaStartEvent::AcceptQuest, quest_id);
 
@@ -14772,7 +14819,7 @@ void Player::AddQuest(Quest const* quest, Object* questGiver)
 
     bool updateVisibility = false;
     if (quest->HasFlag(QUEST_FLAGS_UPDATE_PHASESHIFT))
-        updateVisibility = PhasingHandler::OnConditionChange(this, false);
+        updateVisibility = PhasingHandler::OnQuestChange(this, quest_id, false);
 
     if (sWorld->getBoolConfig(CONFIG_QUEST_ENABLE_QUEST_TRACKER)) // check if Quest Tracker is enabled
     {
@@ -15201,6 +15248,7 @@ void Player::SetRewardedQuest(uint32 quest_id)
 {
     m_RewardedQuests.insert(quest_id);
     m_RewardedQuestsSave[quest_id] = QUEST_DEFAULT_SAVE_TYPE;
+    ++m_questStatusRevision;
 
     SetQuestCompletedBit(quest_id, true);
 }
@@ -15850,6 +15898,7 @@ void Player::SetQuestStatus(uint32 questId, QuestStatus status, bool update /*=
     {
         QuestStatus oldStatus = m_QuestStatus[questId].Status;
         m_QuestStatus[questId].Status = status;
+        ++m_questStatusRevision;
 
         if (!quest->IsTurnIn())
             m_QuestStatusSave[questId] = QUEST_DEFAULT_SAVE_TYPE;
@@ -15878,6 +15927,7 @@ void Player::RemoveActiveQuest(uint32 questId, bool update /*= true*/)
         }
         m_QuestStatus.erase(itr);
         m_QuestStatusSave[questId] = QUEST_DELETE_SAVE_TYPE;
+        ++m_questStatusRevision;
     }
 
     Quest const* quest = sObjectMgr->GetQuestTemplate(questId);
@@ -15888,7 +15938,7 @@ void Player::RemoveActiveQuest(uint32 questId, bool update /*= true*/)
         SendQuestUpdate(questId);
 
         if (quest && quest->HasFlag(QUEST_FLAGS_UPDATE_PHASESHIFT))
-            updateVisibility = PhasingHandler::OnConditionChange(this, false);
+            updateVisibility = PhasingHandler::OnQuestChange(this, questId, false);
     }
 
     if (updateVisibility)
@@ -15902,6 +15952,7 @@ void Player::RemoveRewardedQuest(uint32 questId, bool update /*= true*/)
     {
         m_RewardedQuests.erase(rewItr);
         m_RewardedQuestsSave[questId] = QUEST_FORCE_DELETE_SAVE_TYPE;
+        ++m_questStatusRevision;
     }
 
     SetQuestCompletedBit(questId, false);
@@ -15927,7 +15978,7 @@ void Player::RemoveRewardedQuest(uint32 questId, bool update /*= true*/)
         SendQuestUpdate(questId);
 
         if (quest && quest->HasFlag(QUEST_FLAGS_UPDATE_PHASESHIFT))
-            updateVisibility = PhasingHandler::OnConditionChange(this, false);
+            updateVisibility = PhasingHandler::OnQuestChange(this, questId, false);
     }
 
     if (updateVisibility)
@@ -16445,9 +16496,15 @@ struct
 
 void Player::ItemAddedQuestCheck(uint32 entry, uint32 count, Optional<bool> boundItemFlagRequirement /*= {}*/, bool* hadBoundItemObjective /*= nullptr*/)
 {
+    ItemTemplate const* itemTemplate = sObjectMgr->GetItemTemplate(entry);
+
+    // most items aren't needed by any quest in the log
+    if (!m_questObjectiveStatus.contains({ QUEST_OBJECTIVE_ITEM, int32(entry) })
+        && (!itemTemplate->QuestLogItemId || !m_questObjectiveStatus.contains({ QUEST_OBJECTIVE_ITEM, itemTemplate->QuestLogItemId })))
+        return;
+
     std::vector<QuestObjective const*> updatedObjectives;
     std::function<bool(QuestObjective const*)> const* objectiveFilter = nullptr;
-    ItemTemplate const* itemTemplate = sObjectMgr->GetItemTemplate(entry);
     if (boundItemFlagRequirement)
     {
         bool ignoresQuestBoundItemFlag = std::ranges::any_of(itemTemplate->Effects, [](int8 triggerType)
@@ -16584,6 +16641,10 @@ void Player::CurrencyChanged(uint32 currencyId, int32 change)
 void Player::UpdateQuestObjectiveProgress(QuestObjectiveType objectiveType, int32 objectId, int64 addCount, ObjectGuid victimGuid /*= ObjectGuid::Empty*/,
     std::vector<QuestObjective const*>* updatedObjectives /*= nullptr*/, std::function<bool(QuestObjective const*)> const* objectiveFilter /*= nullptr*/)
 {
+    // every kill, loot, spell and currency change ends up here, usually without any objective for it in the quest log
+    if (!m_questObjectiveStatus.contains({ objectiveType, objectId }))
+        return;
+
     bool anyObjectiveChangedCompletionState = false;
     bool updatePhaseShift = false;
     bool updateZoneAuras = false;
@@ -16964,6 +17025,7 @@ void Player::SetQuestObjectiveData(QuestObjective const& objective, int32 data)
 
     // Add to save
     m_QuestStatusSave[objective.QuestID] = QUEST_DEFAULT_SAVE_TYPE;
+    ++m_questStatusRevision;
 
     // Update quest fields
     if (!objective.IsStoringFlag())
@@ -17669,6 +17731,9 @@ bool Player::LoadFromDB(ObjectGuid guid, CharacterDatabaseQueryHolder const& hol
         return false;
     }
 
+    // everything loaded below matches the database, only later changes need to be written back
+    m_changedSaveData = PlayerSaveData::None;
+
     struct PlayerLoadData
     {
         // "SELECT c.guid, account, name, race, class, gender, level, xp, money, inventorySlots, inventoryBagFlags, bagSlotFlags1, bagSlotFlags2, bagSlotFlags3, bagSlotFlags4, bagSlotFlags5, "
@@ -18057,6 +18122,7 @@ bool Player::LoadFromDB(ObjectGuid guid, CharacterDatabaseQueryHolder const& hol
 
             // We are not in BG anymore
             m_bgData.bgInstanceID = 0;
+            SetSaveDataChanged(PlayerSaveData::BattlegroundData);
         }
     }
     // currently we do not support transport in bg
@@ -18181,6 +18247,13 @@ bool Player::LoadFromDB(ObjectGuid guid, CharacterDatabaseQueryHolder const& hol
         }
     }
 
+    if (!sMapMgr->IsMapHosted(mapId))
+    {
+        TC_LOG_DEBUG("entities.player.loading", "Player::LoadFromDB: Player '{}' ({}) tried login at map {} which is not hosted by this node",
+            GetName(), GetGUID().ToString(), mapId);
+        RelocateToHomebind();
+    }
+
     // NOW player must have valid map
     // load the player's map here if it's not already loaded
     if (!map)
@@ -18386,13 +18459,7 @@ bool Player::LoadFromDB(ObjectGuid guid, CharacterDatabaseQueryHolder const& hol
     StartLoadingActionButtons();
 
     // unread mails and next delivery time, actual mails not loaded
-    _LoadMail(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAILS),
-        holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS),
-        holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_ARTIFACT),
-        holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE),
-        holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_MILESTONE_POWER),
-        holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_UNLOCKED_ESSENCE),
-        holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_EMPOWERED));
+    _LoadMail(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAILS));
 
     m_social = sSocialMgr->LoadFromDB(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST), GetGUID());
 
@@ -19227,11 +19294,8 @@ Item* Player::_LoadMailedItem(ObjectGuid const& playerGuid, Player* player, uint
     return item;
 }
 
-void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mailItemsResult, PreparedQueryResult artifactResult, PreparedQueryResult azeriteItemResult,
-    PreparedQueryResult azeriteItemMilestonePowersResult, PreparedQueryResult azeriteItemUnlockedEssencesResult, PreparedQueryResult azeriteEmpoweredItemResult)
+void Player::_LoadMail(PreparedQueryResult mailsResult)
 {
-    std::unordered_map<uint64, Mail*> mailById;
-
     if (mailsResult)
     {
         do
@@ -19244,14 +19308,13 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
             m->sender         = fields[2].GetUInt64();
             m->receiver       = fields[3].GetUInt64();
             m->subject        = fields[4].GetString();
-            m->body           = fields[5].GetString();
-            m->expire_time    = fields[6].GetInt64();
-            m->deliver_time   = fields[7].GetInt64();
-            m->money          = fields[8].GetUInt64();
-            m->COD            = fields[9].GetUInt64();
-            m->checked        = fields[10].GetUInt8();
-            m->stationery     = fields[11].GetUInt8();
-            m->mailTemplateId = fields[12].GetInt16();
+            m->expire_time    = fields[5].GetInt64();
+            m->deliver_time   = fields[6].GetInt64();
+            m->money          = fields[7].GetUInt64();
+            m->COD            = fields[8].GetUInt64();
+            m->checked        = fields[9].GetUInt8();
+            m->stationery     = fields[10].GetUInt8();
+            m->mailTemplateId = fields[11].GetInt16();
 
             if (m->mailTemplateId && !sMailTemplateStore.LookupEntry(m->mailTemplateId))
             {
@@ -19262,11 +19325,34 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
             m->state = MAIL_STATE_UNCHANGED;
 
             m_mail.push_back(m);
-            mailById[m->messageID] = m;
         }
         while (mailsResult->NextRow());
     }
 
+    // mails received from now on have their content in memory
+    m_mailContentLoaded = m_mail.empty();
+
+    UpdateNextMailTimeAndUnreads();
+}
+
+void Player::_LoadMailContent(PreparedQueryResult bodiesResult, PreparedQueryResult mailItemsResult, PreparedQueryResult artifactResult, PreparedQueryResult azeriteItemResult,
+    PreparedQueryResult azeriteItemMilestonePowersResult, PreparedQueryResult azeriteItemUnlockedEssencesResult, PreparedQueryResult azeriteEmpoweredItemResult)
+{
+    std::unordered_map<uint64, Mail*> mailById;
+    for (Mail* m : m_mail)
+        mailById[m->messageID] = m;
+
+    if (bodiesResult)
+    {
+        do
+        {
+            Field* fields = bodiesResult->Fetch();
+            if (Mail* m = Trinity::Containers::MapGetValuePtr(mailById, fields[0].GetUInt64()))
+                m->body = fields[1].GetString();
+        }
+        while (bodiesResult->NextRow());
+    }
+
     if (mailItemsResult)
     {
         std::unordered_map<ObjectGuid::LowType, ItemAdditionalLoadInfo> additionalData;
@@ -19276,12 +19362,18 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
         do
         {
             Field* fields = mailItemsResult->Fetch();
+
+            // items of mails received after login are already here
+            if (GetMItem(fields[0].GetUInt64()))
+                continue;
+
             uint64 mailId = fields[53].GetUInt64();
-            _LoadMailedItem(GetGUID(), this, mailId, mailById[mailId], fields, Trinity::Containers::MapGetValuePtr(additionalData, fields[0].GetUInt64()));
+            _LoadMailedItem(GetGUID(), this, mailId, Trinity::Containers::MapGetValuePtr(mailById, mailId), fields, Trinity::Containers::MapGetValuePtr(additionalData, fields[0].GetUInt64()));
         } while (mailItemsResult->NextRow());
     }
 
-    UpdateNextMailTimeAndUnreads();
+    m_mailContentLoaded = true;
+    m_mailContentLoading = false;
 }
 
 void Player::_LoadQuestStatus(PreparedQueryResult result)
@@ -19900,8 +19992,8 @@ bool Player::CheckInstanceCount(uint32 instanceId) const
 
 void Player::AddInstanceEnterTime(uint32 instanceId, time_t enterTime)
 {
-    if (_instanceResetTimes.find(instanceId) == _instanceResetTimes.end())
-        _instanceResetTimes.insert(InstanceTimeMap::value_type(instanceId, enterTime + HOUR));
+    if (_instanceResetTimes.insert(InstanceTimeMap::value_type(instanceId, enterTime + HOUR)).second)
+        SetSaveDataChanged(PlayerSaveData::InstanceTimes);
 }
 
 WorldSafeLocsEntry const* Player::GetInstanceEntrance(uint32 targetMapId)
@@ -20152,10 +20244,6 @@ void Player::SaveToDB(LoginDatabaseTransaction loginTransaction, CharacterDataba
     CharacterDatabasePreparedStatement* stmt = nullptr;
     uint8 index = 0;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_FISHINGSTEPS);
-    stmt->setUInt64(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
     auto finiteAlways = [](float f) { return std::isfinite(f) ? f : 0.0f; };
 
     if (create)
@@ -20471,13 +20559,22 @@ void Player::SaveToDB(LoginDatabaseTransaction loginTransaction, CharacterDataba
 
     trans->Append(stmt);
 
-    if (m_fishingSteps != 0)
+    if (m_changedSaveData.HasFlag(PlayerSaveData::FishingSteps))
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_FISHINGSTEPS);
-        index = 0;
-        stmt->setUInt64(index++, GetGUID().GetCounter());
-        stmt->setUInt32(index++, m_fishingSteps);
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_FISHINGSTEPS);
+        stmt->setUInt64(0, GetGUID().GetCounter());
         trans->Append(stmt);
+
+        if (m_fishingSteps != 0)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_FISHINGSTEPS);
+            index = 0;
+            stmt->setUInt64(index++, GetGUID().GetCounter());
+            stmt->setUInt32(index++, m_fishingSteps);
+            trans->Append(stmt);
+        }
+
+        m_changedSaveData.RemoveFlag(PlayerSaveData::FishingSteps);
     }
 
     if (m_mailsUpdated)                                     //save mails only when needed
@@ -20677,6 +20774,9 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans)
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
 
+    // all auras are inserted before their effects, each with a single multi-row statement
+    CharacterDatabasePreparedStatement* auraStmt = nullptr;
+    CharacterDatabasePreparedStatement* effectStmt = nullptr;
     uint8 index;
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
@@ -20688,7 +20788,7 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans)
         AuraKey key = aura->GenerateKey(recalculateMask);
 
         index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        stmt = auraStmt = CharacterDatabase.AddPreparedStatementRow(auraStmt, CHAR_INS_AURA);
         stmt->setUInt64(index++, GetGUID().GetCounter());
         stmt->setBinary(index++, key.Caster.GetRawValue());
         stmt->setBinary(index++, key.Item.GetRawValue());
@@ -20702,12 +20802,11 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans)
         stmt->setUInt8(index++, aura->GetCharges());
         stmt->setUInt32(index++, aura->GetCastItemId());
         stmt->setInt32(index++, aura->GetCastItemLevel());
-        trans->Append(stmt);
 
         for (AuraEffect const* effect : aura->GetAuraEffects())
         {
             index = 0;
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA_EFFECT);
+            stmt = effectStmt = CharacterDatabase.AddPreparedStatementRow(effectStmt, CHAR_INS_AURA_EFFECT);
             stmt->setUInt64(index++, GetGUID().GetCounter());
             stmt->setBinary(index++, key.Caster.GetRawValue());
             stmt->setBinary(index++, key.Item.GetRawValue());
@@ -20716,9 +20815,14 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans)
             stmt->setUInt8(index++, effect->GetEffIndex());
             stmt->setInt32(index++, effect->GetAmount());
             stmt->setInt32(index++, effect->GetBaseAmount());
-            trans->Append(stmt);
         }
     }
+
+    if (auraStmt)
+        trans->Append(auraStmt);
+
+    if (effectStmt)
+        trans->Append(effectStmt);
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction trans)
@@ -20775,9 +20879,11 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
         }
     }
 
-    // update enchantment durations
-    for (EnchantDurationList::iterator itr = m_enchantDuration.begin(); itr != m_enchantDuration.end(); ++itr)
-        itr->item->SetEnchantmentDuration(itr->slot, itr->leftduration, this);
+    // enchantments count down by their expire time, the items only need to store what is left when the player leaves
+    // (unequipped items store it in RemoveEnchantmentDurations)
+    if (GetSession()->PlayerLogout())
+        for (EnchantDurationList::iterator itr = m_enchantDuration.begin(); itr != m_enchantDuration.end(); ++itr)
+            itr->item->SetEnchantmentDuration(itr->slot, itr->GetLeftDuration(GameTime::Now()), this);
 
     // if no changes
     if (m_itemUpdateQueue.empty())
@@ -20857,6 +20963,11 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
 
 void Player::_SaveCUFProfiles(CharacterDatabaseTransaction trans)
 {
+    if (!m_changedSaveData.HasFlag(PlayerSaveData::CUFProfiles))
+        return;
+
+    m_changedSaveData.RemoveFlag(PlayerSaveData::CUFProfiles);
+
     CharacterDatabasePreparedStatement* stmt;
     for (uint8 i = 0; i < MAX_CUF_PROFILES; ++i)
     {
@@ -21246,6 +21357,9 @@ void Player::_SaveSkills(CharacterDatabaseTransaction trans)
 void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 {
     CharacterDatabasePreparedStatement* stmt;
+    // new rows are inserted after all deletes, with a single multi-row statement per table
+    CharacterDatabasePreparedStatement* spellStmt = nullptr;
+    CharacterDatabasePreparedStatement* favoriteStmt = nullptr;
 
     for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
     {
@@ -21262,12 +21376,11 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
             // add only changed/new not dependent spells
             if (!itr->second.dependent)
             {
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_SPELL);
-                stmt->setUInt64(0, GetGUID().GetCounter());
-                stmt->setUInt32(1, itr->first);
-                stmt->setBool(2, itr->second.active);
-                stmt->setBool(3, itr->second.disabled);
-                trans->Append(stmt);
+                spellStmt = CharacterDatabase.AddPreparedStatementRow(spellStmt, CHAR_INS_CHAR_SPELL);
+                spellStmt->setUInt64(0, GetGUID().GetCounter());
+                spellStmt->setUInt32(1, itr->first);
+                spellStmt->setBool(2, itr->second.active);
+                spellStmt->setBool(3, itr->second.disabled);
             }
 
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_FAVORITE);
@@ -21277,10 +21390,9 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 
             if (itr->second.favorite)
             {
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_SPELL_FAVORITE);
-                stmt->setUInt64(0, GetGUID().GetCounter());
-                stmt->setUInt32(1, itr->first);
-                trans->Append(stmt);
+                favoriteStmt = CharacterDatabase.AddPreparedStatementRow(favoriteStmt, CHAR_INS_CHAR_SPELL_FAVORITE);
+                favoriteStmt->setUInt64(0, GetGUID().GetCounter());
+                favoriteStmt->setUInt32(1, itr->first);
             }
         }
 
@@ -21295,6 +21407,12 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 
         ++itr;
     }
+
+    if (spellStmt)
+        trans->Append(spellStmt);
+
+    if (favoriteStmt)
+        trans->Append(favoriteStmt);
 }
 
 void Player::_SaveStoredAuraTeleportLocations(CharacterDatabaseTransaction trans)
@@ -23970,11 +24088,14 @@ void Player::SetBattlegroundEntryPoint()
 
     if (m_bgData.joinPos.m_mapId == MAPID_INVALID) // In error cases use homebind position
         m_bgData.joinPos.WorldRelocate(m_homebind);
+
+    SetSaveDataChanged(PlayerSaveData::BattlegroundData);
 }
 
 void Player::SetBGTeam(Team team)
 {
     m_bgData.bgTeam = team;
+    SetSaveDataChanged(PlayerSaveData::BattlegroundData);
     SetArenaFaction(uint8(team == ALLIANCE ? 1 : 0));
 }
 
@@ -24299,6 +24420,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
                 target->DestroyForPlayer(this);
 
             m_clientGUIDs.erase(target->GetGUID());
+            target->RemoveClientObserver(GetGUID());
 
             #ifdef TRINITY_DEBUG
                 TC_LOG_DEBUG("maps", "Object {} out of range for player {}. Distance = {}", target->GetGUID().ToString(), GetGUID().ToString(), GetDistance(target));
@@ -24311,6 +24433,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
         {
             target->SendUpdateToPlayer(this);
             m_clientGUIDs.insert(target->GetGUID());
+            target->AddClientObserver(GetGUID());
 
             #ifdef TRINITY_DEBUG
                 TC_LOG_DEBUG("maps", "Object {} is visible now for player {}. Distance = {}", target->GetGUID().ToString(), GetGUID().ToString(), GetDistance(target));
@@ -24412,6 +24535,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObjec
                 target->BuildDestroyUpdateBlock(&data);
 
             m_clientGUIDs.erase(target->GetGUID());
+            target->RemoveClientObserver(GetGUID());
 
             #ifdef TRINITY_DEBUG
                 TC_LOG_DEBUG("maps", "Object {} is out of range for player {}. Distance = {}", target->GetGUID().ToString(), GetGUID().ToString(), GetDistance(target));
@@ -24424,6 +24548,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObjec
         {
             target->BuildCreateUpdateBlockForPlayer(&data, this);
             m_clientGUIDs.insert(target->GetGUID());
+            target->AddClientObserver(GetGUID());
             visibleNow.insert(target);
 
             #ifdef TRINITY_DEBUG
@@ -24448,6 +24573,9 @@ void Player::UpdateObjectVisibility(bool forced)
     if (!IsInWorld())
         return;
 
+    // anything other than plain movement may change what we can see regardless of distance
+    _fullVisibilityRescanRequired = true;
+
     if (!forced)
         AddToNotify(NOTIFY_VISIBILITY_CHANGED);
     else
@@ -24457,12 +24585,55 @@ void Player::UpdateObjectVisibility(bool forced)
     }
 }
 
+void Player::UpdateObjectVisibilityOnRelocation()
+{
+    if (!IsInWorld())
+        return;
+
+    AddToNotify(NOTIFY_VISIBILITY_CHANGED);
+}
+
 void Player::UpdateVisibilityForPlayer()
 {
     // updates visibility of all objects around point of view for current player
     Trinity::VisibleNotifier notifier(*this);
     Cell::VisitAllObjects(m_seer, notifier, GetSightRange());
     notifier.SendToSelf();   // send gathered data
+    OnVisibilityScanned(true);
+}
+
+bool Player::CanScanVisibilityIncrementally(float& drift) const
+{
+    if (!sWorld->getIntConfig(CONFIG_VISIBILITY_INCREMENTAL))
+        return false;
+
+    if (_fullVisibilityRescanRequired || !_visibilityScanOrigin || _visibilityScanSeer != m_seer->GetGUID())
+        return false;
+
+    // periodic full rescan catches objects that left the grid without notifying us
+    if (_incrementalVisibilityScans >= MAX_INCREMENTAL_VISIBILITY_SCANS)
+        return false;
+
+    // ghosts see through their corpse, cinematics and transports have their own visibility rules
+    if (isDead() || GetTransport() || _cinematicMgr->IsOnCinematic())
+        return false;
+
+    drift = m_seer->GetExactDist2d(*_visibilityScanOrigin);
+    return drift < GetSightRange() * MAX_INCREMENTAL_VISIBILITY_DRIFT;
+}
+
+void Player::OnVisibilityScanned(bool fullRescan)
+{
+    if (!fullRescan)
+    {
+        ++_incrementalVisibilityScans;
+        return;
+    }
+
+    _visibilityScanOrigin = m_seer->GetPosition();
+    _visibilityScanSeer = m_seer->GetGUID();
+    _incrementalVisibilityScans = 0;
+    _fullVisibilityRescanRequired = false;
 }
 
 void Player::InitPrimaryProfessions()
@@ -24509,6 +24680,14 @@ void Player::SetMoney(uint64 value)
         UpdateCriteria(CriteriaType::MostMoneyOwned);
 }
 
+ConditionResultCache& Player::GetConditionResultCache() const
+{
+    if (!m_conditionResultCache)
+        m_conditionResultCache = std::make_unique<ConditionResultCache>();
+
+    return *m_conditionResultCache;
+}
+
 bool Player::IsQuestRewarded(uint32 quest_id) const
 {
     return m_RewardedQuests.find(quest_id) != m_RewardedQuests.end();
@@ -24661,31 +24840,8 @@ void Player::SendInitialPacketsBeforeAddToMap()
     // Spell modifiers
     SendSpellModifiers();
 
-    // SMSG_ACCOUNT_MOUNT_UPDATE
-    WorldPackets::Misc::AccountMountUpdate mountUpdate;
-    mountUpdate.IsFullUpdate = true;
-    mountUpdate.Mounts = &GetSession()->GetCollectionMgr()->GetAccountMounts();
-    SendDirectMessage(mountUpdate.Write());
-
-    // SMSG_ACCOUNT_TOYS_UPDATE
-    WorldPackets::Toy::AccountToyUpdate toyUpdate;
-    toyUpdate.IsFullUpdate = true;
-    toyUpdate.Toys = &GetSession()->GetCollectionMgr()->GetAccountToys();
-    SendDirectMessage(toyUpdate.Write());
-
-    // SMSG_ACCOUNT_HEIRLOOM_UPDATE
-    WorldPackets::Misc::AccountHeirloomUpdate heirloomUpdate;
-    heirloomUpdate.IsFullUpdate = true;
-    heirloomUpdate.Heirlooms = &GetSession()->GetCollectionMgr()->GetAccountHeirlooms();
-    SendDirectMessage(heirloomUpdate.Write());
-
-    GetSession()->GetCollectionMgr()->SendFavoriteAppearances();
-
-    // SMSG_ACCOUNT_WARBAND_SCENE_UPDATE
-    WorldPackets::Misc::AccountWarbandSceneUpdate warbandSceneUpdate;
-    warbandSceneUpdate.IsFullUpdate = true;
-    warbandSceneUpdate.WarbandScenes = &GetSession()->GetCollectionMgr()->GetWarbandScenes();
-    SendDirectMessage(warbandSceneUpdate.Write());
+    // SMSG_ACCOUNT_MOUNT_UPDATE, SMSG_ACCOUNT_TOYS_UPDATE, SMSG_ACCOUNT_HEIRLOOM_UPDATE, SMSG_ACCOUNT_TRANSMOG_UPDATE, SMSG_ACCOUNT_WARBAND_SCENE_UPDATE
+    GetSession()->GetCollectionMgr()->SendFullCollectionUpdates();
 
     WorldPackets::Character::InitialSetup initialSetup;
     initialSetup.ServerExpansionLevel = sWorld->getIntConfig(CONFIG_EXPANSION);
@@ -25398,6 +25554,7 @@ void Player::SetBattlegroundId(uint32 val, BattlegroundTypeId bgTypeId, Battlegr
     m_bgData.bgInstanceID = val;
     m_bgData.bgTypeID = bgTypeId;
     m_bgData.queueId = queueId;
+    SetSaveDataChanged(PlayerSaveData::BattlegroundData);
 }
 
 uint32 Player::AddBattlegroundQueueId(BattlegroundQueueTypeId val)
@@ -27390,6 +27547,7 @@ bool Player::AddPvpTalent(PvpTalentEntry const* talent, uint8 activeTalentGroup,
     }
 
     GetPvpTalentMap(activeTalentGroup)[slot] = talent->ID;
+    SetSaveDataChanged(PlayerSaveData::PvpTalents);
 
     return true;
 }
@@ -27409,7 +27567,10 @@ void Player::RemovePvpTalent(PvpTalentEntry const* talent, uint8 activeTalentGro
     // if this talent rank can be found in the PlayerTalentMap, mark the talent as removed so it gets deleted
     auto plrPvpTalent = std::find(GetPvpTalentMap(activeTalentGroup).begin(), GetPvpTalentMap(activeTalentGroup).end(), talent->ID);
     if (plrPvpTalent != GetPvpTalentMap(activeTalentGroup).end())
+    {
         *plrPvpTalent = 0;
+        SetSaveDataChanged(PlayerSaveData::PvpTalents);
+    }
 }
 
 void Player::TogglePvpTalents(bool enable)
@@ -27909,6 +28070,11 @@ void Player::_SaveEquipmentSets(CharacterDatabaseTransaction trans)
 
 void Player::_SaveBGData(CharacterDatabaseTransaction trans)
 {
+    if (!m_changedSaveData.HasFlag(PlayerSaveData::BattlegroundData))
+        return;
+
+    m_changedSaveData.RemoveFlag(PlayerSaveData::BattlegroundData);
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_BGDATA);
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -28001,8 +28167,13 @@ void Player::_LoadGlyphs(PreparedQueryResult result)
     } while (result->NextRow());
 }
 
-void Player::_SaveGlyphs(CharacterDatabaseTransaction trans) const
+void Player::_SaveGlyphs(CharacterDatabaseTransaction trans)
 {
+    if (!m_changedSaveData.HasFlag(PlayerSaveData::Glyphs))
+        return;
+
+    m_changedSaveData.RemoveFlag(PlayerSaveData::Glyphs);
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_GLYPHS);
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -28221,30 +28392,43 @@ void Player::_LoadTraits(PreparedQueryResult configsResult, PreparedQueryResult
 
 void Player::_SaveTalents(CharacterDatabaseTransaction trans)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_TALENT);
-    stmt->setUInt64(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    CharacterDatabasePreparedStatement* stmt = nullptr;
 
     for (uint8 group = 0; group < MAX_SPECIALIZATIONS; ++group)
     {
         PlayerTalentMap* talents = GetTalentMap(group);
         for (auto itr = talents->begin(); itr != talents->end();)
         {
-            if (itr->second == PLAYERSPELL_REMOVED)
+            switch (itr->second)
             {
-                itr = talents->erase(itr);
-                continue;
+                case PLAYERSPELL_REMOVED:
+                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_TALENT_BY_ID);
+                    stmt->setUInt64(0, GetGUID().GetCounter());
+                    stmt->setUInt32(1, itr->first);
+                    stmt->setUInt8(2, group);
+                    trans->Append(stmt);
+                    itr = talents->erase(itr);
+                    continue;
+                case PLAYERSPELL_NEW:
+                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_TALENT);
+                    stmt->setUInt64(0, GetGUID().GetCounter());
+                    stmt->setUInt32(1, itr->first);
+                    stmt->setUInt8(2, group);
+                    trans->Append(stmt);
+                    itr->second = PLAYERSPELL_UNCHANGED;
+                    break;
+                default:
+                    break;
             }
-
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_TALENT);
-            stmt->setUInt64(0, GetGUID().GetCounter());
-            stmt->setUInt32(1, itr->first);
-            stmt->setUInt8(2, group);
-            trans->Append(stmt);
             ++itr;
         }
     }
 
+    if (!m_changedSaveData.HasFlag(PlayerSaveData::PvpTalents))
+        return;
+
+    m_changedSaveData.RemoveFlag(PlayerSaveData::PvpTalents);
+
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_PVP_TALENT);
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -29637,6 +29821,11 @@ void Player::_LoadPetStable(uint32 summonedPetNumber, PreparedQueryResult result
 
 void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
 {
+    if (!m_changedSaveData.HasFlag(PlayerSaveData::InstanceTimes))
+        return;
+
+    m_changedSaveData.RemoveFlag(PlayerSaveData::InstanceTimes);
+
     if (_instanceResetTimes.empty())
         return;
 
@@ -49,6 +49,7 @@ struct BonusData;
 struct CharTitlesEntry;
 struct ChatChannelsEntry;
 struct ChrSpecializationEntry;
+struct ConditionResultCache;
 struct CreatureTemplate;
 struct CurrencyTypesEntry;
 struct FactionEntry;
@@ -453,13 +454,19 @@ struct Runes
 
 struct EnchantDuration
 {
-    EnchantDuration() : item(nullptr), slot(MAX_ENCHANTMENT_SLOT), leftduration(0) { }
-    EnchantDuration(Item* _item, EnchantmentSlot _slot, uint32 _leftduration) : item(_item), slot(_slot),
-        leftduration(_leftduration){ ASSERT(item); }
+    EnchantDuration() : item(nullptr), slot(MAX_ENCHANTMENT_SLOT) { }
+    EnchantDuration(Item* _item, EnchantmentSlot _slot, TimePoint _expireTime) : item(_item), slot(_slot),
+        expireTime(_expireTime) { ASSERT(item); }
+
+    // milliseconds left, what the item stores while the enchantment isn't counting down
+    uint32 GetLeftDuration(TimePoint now) const
+    {
+        return now < expireTime ? uint32(std::chrono::duration_cast<Milliseconds>(expireTime - now).count()) : 0;
+    }
 
     Item* item;
     EnchantmentSlot slot;
-    uint32 leftduration;
+    TimePoint expireTime;
 };
 
 typedef std::list<EnchantDuration> EnchantDurationList;
@@ -920,12 +927,6 @@ enum PlayerLoginQueryIndex
     PLAYER_LOGIN_QUERY_LOAD_AZERITE_UNLOCKED_ESSENCES,
     PLAYER_LOGIN_QUERY_LOAD_AZERITE_EMPOWERED,
     PLAYER_LOGIN_QUERY_LOAD_MAILS,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_ARTIFACT,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_MILESTONE_POWER,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_UNLOCKED_ESSENCE,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_EMPOWERED,
     PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST,
     PLAYER_LOGIN_QUERY_LOAD_HOME_BIND,
     PLAYER_LOGIN_QUERY_LOAD_SPELL_COOLDOWNS,
@@ -978,6 +979,22 @@ enum PlayerDelayedOperations
     DELAYED_END
 };
 
+// Sections of the character saved only when they changed since the last save
+enum class PlayerSaveData : uint8
+{
+    None                = 0x00,
+    FishingSteps        = 0x01,
+    BattlegroundData    = 0x02,
+    Glyphs              = 0x04,
+    PvpTalents          = 0x08,
+    CUFProfiles         = 0x10,
+    InstanceTimes       = 0x20,
+
+    All                 = FishingSteps | BattlegroundData | Glyphs | PvpTalents | CUFProfiles | InstanceTimes
+};
+
+DEFINE_ENUM_FLAG(PlayerSaveData);
+
 // Player summoning auto-decline time (in secs)
 #define MAX_PLAYER_SUMMON_DELAY                   (2*MINUTE)
 // Maximum money amount : 2^31 - 1
@@ -1201,6 +1218,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         bool Create(ObjectGuid::LowType guidlow, WorldPackets::Character::CharacterCreateInfo const* createInfo);
 
         void Update(uint32 time) override;
+        // checks against whole seconds of game time, Update only calls it on its first run of every game second
+        void UpdateEverySecond(time_t now);
 
         void Heartbeat() override;
 
@@ -1592,7 +1611,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         CinematicMgr* GetCinematicMgr() const { return _cinematicMgr.get(); }
 
-        void UpdateEnchantTime(uint32 time);
+        void UpdateEnchantTime();
         void UpdateSoulboundTradeItems();
         void AddTradeableItem(Item* item);
         void RemoveTradeableItem(Item* item);
@@ -1777,8 +1796,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void AddTimedQuest(uint32 questId);
         void RemoveTimedQuest(uint32 questId);
 
-        void SaveCUFProfile(uint8 id, std::nullptr_t) { _CUFProfiles[id] = nullptr; } ///> Empties a CUF profile at position 0-4
-        void SaveCUFProfile(uint8 id, std::unique_ptr<CUFProfile> profile) { _CUFProfiles[id] = std::move(profile); } ///> Replaces a CUF profile at position 0-4
+        void SaveCUFProfile(uint8 id, std::nullptr_t) { _CUFProfiles[id] = nullptr; SetSaveDataChanged(PlayerSaveData::CUFProfiles); } ///> Empties a CUF profile at position 0-4
+        void SaveCUFProfile(uint8 id, std::unique_ptr<CUFProfile> profile) { _CUFProfiles[id] = std::move(profile); SetSaveDataChanged(PlayerSaveData::CUFProfiles); } ///> Replaces a CUF profile at position 0-4
         CUFProfile* GetCUFProfile(uint8 id) const { return _CUFProfiles[id].get(); } ///> Retrieves a CUF profile at position 0-4
         uint8 GetCUFProfilesCount() const
         {
@@ -1817,6 +1836,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void SaveToDB(bool create = false);
         void SaveToDB(LoginDatabaseTransaction loginTransaction, CharacterDatabaseTransaction trans, bool create = false);
         void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
+        void SetSaveDataChanged(PlayerSaveData data) { m_changedSaveData |= data; }   // marks a section written by SaveToDB only when changed
 
         static void SaveCustomizations(CharacterDatabaseTransaction trans, ObjectGuid::LowType guid,
             Trinity::IteratorPair<UF::ChrCustomizationChoice const*> customizations);
@@ -1847,6 +1867,9 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         QuestStatusMap& getQuestStatusMap() { return m_QuestStatus; }
 
         size_t GetRewardedQuestCount() const { return m_RewardedQuests.size(); }
+        // Increased whenever a quest is added, removed, rewarded, changes status or objective progress
+        uint32 GetQuestStatusRevision() const { return m_questStatusRevision; }
+        ConditionResultCache& GetConditionResultCache() const;
         bool IsQuestRewarded(uint32 quest_id) const;
 
         Unit* GetSelectedUnit() const;
@@ -1867,6 +1890,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         Mail* GetMail(uint64 id);
 
         PlayerMails const& GetMails() const { return m_mail; }
+        // bodies and attached items of the mails found at login are loaded when the mailbox is opened the first time
+        bool IsMailContentLoaded() const { return m_mailContentLoaded; }
 
         void SendItemRetrievalMail(uint32 itemEntry, uint32 count, ItemContext context); // Item retrieval mails sent by The Postmaster (34337), used in multiple places.
 
@@ -2627,7 +2652,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         uint8 GetStartLevel(uint8 race, uint8 playerClass, Optional<int32> characterTemplateId) const;
 
         // currently visible objects at player client
-        GuidUnorderedSet m_clientGUIDs;
+        GuidFlatSet m_clientGUIDs;
         GuidUnorderedSet m_visibleTransports;
 
         bool HaveAtClient(Object const* u) const;
@@ -2639,7 +2664,11 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void SendInitialVisiblePackets(WorldObject* target) const;
         void OnPhaseChange() override;
         void UpdateObjectVisibility(bool forced = true) override;
+        // movement only visibility update, the next relocation notify may use an incremental scan (Visibility.Incremental)
+        void UpdateObjectVisibilityOnRelocation();
         void UpdateVisibilityForPlayer();
+        bool CanScanVisibilityIncrementally(float& drift) const;
+        void OnVisibilityScanned(bool fullRescan);
         void UpdateVisibilityOf(WorldObject* target);
         void UpdateVisibilityOf(Trinity::IteratorPair<WorldObject**> targets);
         void UpdateTriggerVisibility();
@@ -3049,7 +3078,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void _LoadInventory(PreparedQueryResult result, PreparedQueryResult artifactsResult, PreparedQueryResult azeriteResult,
             PreparedQueryResult azeriteItemMilestonePowersResult, PreparedQueryResult azeriteItemUnlockedEssencesResult,
             PreparedQueryResult azeriteEmpoweredItemResult, uint32 timeDiff);
-        void _LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mailItemsResult, PreparedQueryResult artifactResult, PreparedQueryResult azeriteItemResult,
+        void _LoadMail(PreparedQueryResult mailsResult);
+        void _LoadMailContent(PreparedQueryResult bodiesResult, PreparedQueryResult mailItemsResult, PreparedQueryResult artifactResult, PreparedQueryResult azeriteItemResult,
             PreparedQueryResult azeriteItemMilestonePowersResult, PreparedQueryResult azeriteItemUnlockedEssencesResult, PreparedQueryResult azeriteEmpoweredItemResult);
         static Item* _LoadMailedItem(ObjectGuid const& playerGuid, Player* player, uint64 mailId, Mail* mail, Field* fields, ItemAdditionalLoadInfo* addionalData);
         void _LoadQuestStatus(PreparedQueryResult result);
@@ -3101,7 +3131,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void _SaveStoredAuraTeleportLocations(CharacterDatabaseTransaction trans);
         void _SaveEquipmentSets(CharacterDatabaseTransaction trans);
         void _SaveBGData(CharacterDatabaseTransaction trans);
-        void _SaveGlyphs(CharacterDatabaseTransaction trans) const;
+        void _SaveGlyphs(CharacterDatabaseTransaction trans);
         void _SaveTalents(CharacterDatabaseTransaction trans);
         void _SaveTraits(CharacterDatabaseTransaction trans);
         void _SaveStats(CharacterDatabaseTransaction trans) const;
@@ -3130,6 +3160,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         Team m_team;
         uint32 m_nextSave;
         bool m_customizationsChanged;
+        EnumFlag<PlayerSaveData> m_changedSaveData;
         std::array<ChatFloodThrottle, ChatFloodThrottle::MAX> m_chatFloodData;
         Difficulty m_dungeonDifficulty;
         Difficulty m_raidDifficulty;
@@ -3153,6 +3184,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         RewardedQuestSet m_RewardedQuests;
         QuestStatusSaveMap m_RewardedQuestsSave;
+        uint32 m_questStatusRevision;
+        mutable std::unique_ptr<ConditionResultCache> m_conditionResultCache;
 
         SkillStatusMap mSkillStatus;
 
@@ -3160,6 +3193,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         uint32 m_ArenaTeamIdInvited;
 
         PlayerMails m_mail;
+        bool m_mailContentLoaded;
+        bool m_mailContentLoading;
         PlayerSpellMap m_spells;
         std::unordered_map<uint32 /*overridenSpellId*/, std::unordered_set<uint32> /*newSpellId*/> m_overrideSpells;
         uint32 m_lastPotionId;                              // last used health/mana potion in combat, that block next potion use
@@ -3183,6 +3218,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         SpellModContainer m_spellMods;
 
         EnchantDurationList m_enchantDuration;
+        TimePoint m_nextEnchantExpireTime;              // no enchantment of m_enchantDuration expires before
         ItemDurationList m_itemDuration;
         std::forward_list<int32> m_itemPassives;
         GuidUnorderedSet m_itemSoulboundTradeable;
@@ -3268,6 +3304,12 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         std::unique_ptr<CinematicMgr> _cinematicMgr;
 
+        // viewpoint state at the last full visibility rescan
+        Optional<Position> _visibilityScanOrigin;
+        ObjectGuid _visibilityScanSeer;
+        uint8 _incrementalVisibilityScans;
+        bool _fullVisibilityRescanRequired;
+
         GuidSet m_refundableItems;
         void SendRefundInfo(Item* item);
         void RefundItem(Item* item);
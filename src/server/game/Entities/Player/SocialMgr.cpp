@@ -78,7 +78,11 @@ bool PlayerSocial::AddToSocialList(ObjectGuid const& friendGuid, ObjectGuid cons
     }
 
     if (flag & SOCIAL_FLAG_IGNORED)
+    {
         _ignoredAccounts.insert(accountGuid);
+        sSocialMgr->AddIgnoredBy(friendGuid, GetPlayerGUID());
+        sSocialMgr->AddIgnoredBy(accountGuid, GetPlayerGUID());
+    }
 
     return true;
 }
@@ -89,6 +93,9 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid const& friendGuid, SocialFlag
     if (itr == _playerSocialMap.end())
         return;
 
+    if (flag & SOCIAL_FLAG_IGNORED)
+        sSocialMgr->RemoveIgnoredBy(friendGuid, GetPlayerGUID());
+
     itr->second.Flags &= ~flag;
 
     if (!itr->second.Flags)
@@ -112,7 +119,10 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid const& friendGuid, SocialFlag
             });
 
             if (otherIgnoreForAccount == _playerSocialMap.end())
+            {
                 _ignoredAccounts.erase(accountGuid);
+                sSocialMgr->RemoveIgnoredBy(accountGuid, GetPlayerGUID());
+            }
         }
     }
     else
@@ -217,6 +227,44 @@ SocialMgr* SocialMgr::instance()
     return &instance;
 }
 
+void SocialMgr::RemovePlayerSocial(ObjectGuid const& guid)
+{
+    SocialMap::iterator itr = _socialMap.find(guid);
+    if (itr == _socialMap.end())
+        return;
+
+    for (PlayerSocial::PlayerSocialMap::value_type const& social : itr->second._playerSocialMap)
+        if (social.second.Flags & SOCIAL_FLAG_IGNORED)
+            RemoveIgnoredBy(social.first, guid);
+
+    for (ObjectGuid const& accountGuid : itr->second._ignoredAccounts)
+        RemoveIgnoredBy(accountGuid, guid);
+
+    _socialMap.erase(itr);
+}
+
+GuidUnorderedSet const* SocialMgr::GetIgnoredBy(ObjectGuid const& guid) const
+{
+    auto itr = _ignoredBy.find(guid);
+    return itr != _ignoredBy.end() ? &itr->second : nullptr;
+}
+
+void SocialMgr::AddIgnoredBy(ObjectGuid const& guid, ObjectGuid const& ignorerGuid)
+{
+    _ignoredBy[guid].insert(ignorerGuid);
+}
+
+void SocialMgr::RemoveIgnoredBy(ObjectGuid const& guid, ObjectGuid const& ignorerGuid)
+{
+    auto itr = _ignoredBy.find(guid);
+    if (itr == _ignoredBy.end())
+        return;
+
+    itr->second.erase(ignorerGuid);
+    if (itr->second.empty())
+        _ignoredBy.erase(itr);
+}
+
 void SocialMgr::GetFriendInfo(Player* player, ObjectGuid const& friendGUID, FriendInfo& friendInfo)
 {
     if (!player)
@@ -332,7 +380,11 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid const
             uint8 flag = fields[2].GetUInt8();
             social->_playerSocialMap[friendGuid] = FriendInfo(friendAccountGuid, flag, fields[3].GetString());
             if (flag & SOCIAL_FLAG_IGNORED)
+            {
                 social->_ignoredAccounts.insert(friendAccountGuid);
+                AddIgnoredBy(friendGuid, guid);
+                AddIgnoredBy(friendAccountGuid, guid);
+            }
         }
         while (result->NextRow());
     }
@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <unordered_map>
 
 class Player;
 class WorldPacket;
@@ -154,7 +155,9 @@ class SocialMgr
         static SocialMgr* instance();
 
         // Misc
-        void RemovePlayerSocial(ObjectGuid const& guid) { _socialMap.erase(guid); }
+        void RemovePlayerSocial(ObjectGuid const& guid);
+        /// Players ignoring the character or account, nullptr if nobody does
+        GuidUnorderedSet const* GetIgnoredBy(ObjectGuid const& guid) const;
 
         static void GetFriendInfo(Player* player, ObjectGuid const& friendGUID, FriendInfo& friendInfo);
 
@@ -166,8 +169,15 @@ class SocialMgr
         PlayerSocial* LoadFromDB(PreparedQueryResult result, ObjectGuid const& guid);
 
     private:
+        friend class PlayerSocial;
+
+        void AddIgnoredBy(ObjectGuid const& guid, ObjectGuid const& ignorerGuid);
+        void RemoveIgnoredBy(ObjectGuid const& guid, ObjectGuid const& ignorerGuid);
+
         typedef std::map<ObjectGuid, PlayerSocial> SocialMap;
         SocialMap _socialMap;
+        // reverse of the ignore lists of loaded players, ignored character or account guid -> players ignoring it
+        std::unordered_map<ObjectGuid, GuidUnorderedSet> _ignoredBy;
 };
 
 #define sSocialMgr SocialMgr::instance()
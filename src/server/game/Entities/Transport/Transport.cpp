@@ -32,7 +32,7 @@
 #include <boost/dynamic_bitset.hpp>
 #include <sstream>
 
-void TransportBase::UpdatePassengerPosition(Map* map, WorldObject* passenger, Position const& position, bool setHomePosition)
+void TransportBase::UpdatePassengerPosition(Map* map, WorldObject* passenger, Position const& position, bool setHomePosition, bool updateVisibility)
 {
     // transport teleported but passenger not yet (can happen for players)
     if (passenger->GetMap() != map)
@@ -48,7 +48,7 @@ void TransportBase::UpdatePassengerPosition(Map* map, WorldObject* passenger, Po
         case TYPEID_UNIT:
         {
             Creature* creature = passenger->ToCreature();
-            map->CreatureRelocation(creature, x, y, z, o, false);
+            map->CreatureRelocation(creature, x, y, z, o, false, updateVisibility);
             if (setHomePosition)
                 creature->SetHomePosition(GetPositionWithOffset(creature->GetTransportHomePosition()));
             break;
@@ -540,6 +540,8 @@ void Transport::UpdatePosition(float x, float y, float z, float o)
     else
         UpdatePassengerPositions(_staticPassengers);
     // 4. is handed by grid unload
+
+    UpdatePassengerVisibility();
 }
 
 void Transport::LoadStaticPassengers()
@@ -684,7 +686,35 @@ void Transport::TeleportPassengersAndHideTransport(uint32 newMapid)
 void Transport::UpdatePassengerPositions(PassengerSet const& passengers)
 {
     for (WorldObject* passenger : passengers)
-        UpdatePassengerPosition(GetMap(), passenger, GetPositionWithOffset(passenger->m_movementInfo.transport.pos), true);
+        UpdatePassengerPosition(GetMap(), passenger, GetPositionWithOffset(passenger->m_movementInfo.transport.pos), true, false);
+}
+
+void Transport::UpdatePassengerVisibility()
+{
+    // creatures on board keep their positions relative to each other and to the players on board, who update their own visibility,
+    // so instead of every creature visiting the grid around itself only the players around the transport check all of them at once
+    std::vector<WorldObject*> creatures;
+    float maxOffset = 0.0f;
+    for (PassengerSet const* passengers : { &_passengers, &_staticPassengers })
+    {
+        for (WorldObject* passenger : *passengers)
+        {
+            if (passenger->GetTypeId() != TYPEID_UNIT || !passenger->IsInWorld())
+                continue;
+
+            creatures.push_back(passenger);
+            maxOffset = std::max(maxOffset, passenger->m_movementInfo.transport.pos.GetExactDist2d(0.0f, 0.0f));
+        }
+    }
+
+    if (creatures.empty())
+        return;
+
+    std::vector<Player*> players;
+    GetPlayerListInGrid(players, GetMap()->GetVisibilityRange() + maxOffset, false);
+    for (Player* player : players)
+        if (player->GetTransport() != this && !player->m_seer->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+            player->UpdateVisibilityOf(Trinity::IteratorPair(creatures.data(), creatures.data() + creatures.size()));
 }
 
 void Transport::BuildUpdate(UpdateDataMapType& data_map)
@@ -58,6 +58,7 @@
 #include "MovementGenerator.h"
 #include "MovementPackets.h"
 #include "MoveSpline.h"
+#include "MoveSplineBatch.h"
 #include "MoveSplineInit.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
@@ -308,12 +309,12 @@ SpellNonMeleeDamage::SpellNonMeleeDamage(Unit* _attacker, Unit* _target, SpellIn
 Unit::Unit(bool isWorldObject) :
     WorldObject(isWorldObject), m_lastSanctuaryTime(0), LastCharmerGUID(), movespline(std::make_unique<Movement::MoveSpline>()),
     m_ControlledByPlayer(false), m_procDeep(0), m_procChainLength(0), m_transformSpell(0),
-    m_removedAurasCount(0), m_interruptMask(SpellAuraInterruptFlags::None), m_interruptMask2(SpellAuraInterruptFlags2::None),
+    m_procAuraGeneration(0), m_removedAurasCount(0), m_auraApplicationRevision(0), m_periodicAuraLogCount(0), m_auraModifierCacheGeneration(0), m_interruptMask(SpellAuraInterruptFlags::None), m_interruptMask2(SpellAuraInterruptFlags2::None),
     m_unitMovedByMe(nullptr), m_playerMovingMe(nullptr), m_charmer(nullptr), m_charmed(nullptr),
     i_motionMaster(std::make_unique<MotionMaster>(this)), m_regenTimer(0), m_vehicle(nullptr),
     m_unitTypeMask(UNIT_MASK_NONE), m_Diminishing(), m_combatManager(this),
     m_threatManager(this), m_aiLocked(false), _playHoverAnim(false), _aiAnimKitId(0), _movementAnimKitId(0), _meleeAnimKitId(0),
-    _spellHistory(std::make_unique<SpellHistory>(this))
+    _spellHistory(std::make_unique<SpellHistory>(this)), _moveSplineBatchSlot(Movement::MoveSplineBatch::NoSlot)
 {
     m_objectTypeId = TYPEID_UNIT;
 
@@ -481,7 +482,9 @@ void Unit::Update(uint32 p_time)
         ModifyAuraState(AURA_STATE_WOUNDED_50_PERCENT, HealthBelowPct(50));
     }
 
-    UpdateSplineMovement(p_time);
+    // splines advanced by the map were updated before its objects
+    if (_moveSplineBatchSlot == Movement::MoveSplineBatch::NoSlot)
+        UpdateSplineMovement(p_time);
     i_motionMaster->Update(p_time);
 
     // Wait with the aura interrupts until we have updated our movement generators and position
@@ -612,8 +615,11 @@ void Unit::UpdateSplineMovement(uint32 t_diff)
 
 void Unit::UpdateSplinePosition()
 {
-    Movement::Location loc = movespline->ComputePosition();
+    UpdateSplinePosition(movespline->ComputePosition());
+}
 
+void Unit::UpdateSplinePosition(Movement::Location loc)
+{
     if (movespline->onTransport)
     {
         Position& pos = m_movementInfo.transport.pos;
@@ -3498,6 +3504,7 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint32 effMask)
 
     AuraApplication * aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+    AddProcAuraApplication(aurApp);
 
     if (aurSpellInfo->HasAnyAuraInterruptFlag())
     {
@@ -3603,6 +3610,7 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
 
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
+    RemoveProcAuraApplication(aurApp);
 
     if (aura->GetSpellInfo()->HasAnyAuraInterruptFlag())
     {
@@ -3718,6 +3726,8 @@ void Unit::_RemoveNoStackAurasDueToAura(Aura* aura, bool owned)
 
 void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
 {
+    InvalidateAuraModifierCache(aurEff->GetAuraType());
+
     if (apply)
     {
         m_modAuras[aurEff->GetAuraType()].push_front(aurEff);
@@ -5050,104 +5060,235 @@ int32 Unit::GetMaxNegativeAuraModifier(AuraType auraType, std::function<bool(Aur
     return modifier;
 }
 
+namespace
+{
+std::atomic<uint32> AuraModifierCacheGeneration = 0;
+}
+
+void Unit::InvalidateAllAuraModifierCaches()
+{
+    ++AuraModifierCacheGeneration;
+}
+
+Unit::AuraModifierCache& Unit::GetAuraModifierCache(AuraType auraType) const
+{
+    uint32 generation = AuraModifierCacheGeneration.load(std::memory_order_relaxed);
+    if (m_auraModifierCacheGeneration != generation)
+    {
+        m_auraModifierCache.clear();
+        m_auraModifierCacheGeneration = generation;
+    }
+
+    return m_auraModifierCache[auraType];
+}
+
+template<typename Key>
+Unit::AuraModifierTotals& Unit::GetAuraModifierTotals(std::vector<std::pair<Key, AuraModifierTotals>>& totals, Key key)
+{
+    auto itr = std::ranges::find(totals, key, &std::pair<Key, AuraModifierTotals>::first);
+    if (itr != totals.end())
+        return itr->second;
+
+    return totals.emplace_back(key, AuraModifierTotals()).second;
+}
+
 int32 Unit::GetTotalAuraModifier(AuraType auraType) const
 {
-    return GetTotalAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& total = GetAuraModifierCache(auraType).All.Total;
+    if (!total)
+        total = GetTotalAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    return *total;
 }
 
 float Unit::GetTotalAuraMultiplier(AuraType auraType) const
 {
-    return GetTotalAuraMultiplier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 1.0f;
+
+    Optional<float>& multiplier = GetAuraModifierCache(auraType).All.Multiplier;
+    if (!multiplier)
+        multiplier = GetTotalAuraMultiplier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    return *multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auraType) const
 {
-    return GetMaxPositiveAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& modifier = GetAuraModifierCache(auraType).All.MaxPositive;
+    if (!modifier)
+        modifier = GetMaxPositiveAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    return *modifier;
 }
 
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auraType) const
 {
-    return GetMaxNegativeAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& modifier = GetAuraModifierCache(auraType).All.MaxNegative;
+    if (!modifier)
+        modifier = GetMaxNegativeAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    return *modifier;
 }
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auraType, uint32 miscMask) const
 {
-    return GetTotalAuraModifier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& total = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscMask, miscMask).Total;
+    if (!total)
     {
-        if ((aurEff->GetMiscValue() & miscMask) != 0)
-            return true;
-        return false;
-    });
+        total = GetTotalAuraModifier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+        {
+            if ((aurEff->GetMiscValue() & miscMask) != 0)
+                return true;
+            return false;
+        });
+    }
+    return *total;
 }
 
 float Unit::GetTotalAuraMultiplierByMiscMask(AuraType auraType, uint32 miscMask) const
 {
-    return GetTotalAuraMultiplier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 1.0f;
+
+    Optional<float>& multiplier = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscMask, miscMask).Multiplier;
+    if (!multiplier)
     {
-        if ((aurEff->GetMiscValue() & miscMask) != 0)
-            return true;
-        return false;
-    });
+        multiplier = GetTotalAuraMultiplier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+        {
+            if ((aurEff->GetMiscValue() & miscMask) != 0)
+                return true;
+            return false;
+        });
+    }
+    return *multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifierByMiscMask(AuraType auraType, uint32 miscMask, AuraEffect const* except /*= nullptr*/) const
 {
-    return GetMaxPositiveAuraModifier(auraType, [miscMask, except](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    // excluding an effect is not cached
+    if (except)
     {
-        if (except != aurEff && (aurEff->GetMiscValue() & miscMask) != 0)
-            return true;
-        return false;
-    });
+        return GetMaxPositiveAuraModifier(auraType, [miscMask, except](AuraEffect const* aurEff) -> bool
+        {
+            if (except != aurEff && (aurEff->GetMiscValue() & miscMask) != 0)
+                return true;
+            return false;
+        });
+    }
+
+    Optional<int32>& modifier = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscMask, miscMask).MaxPositive;
+    if (!modifier)
+    {
+        modifier = GetMaxPositiveAuraModifier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+        {
+            if ((aurEff->GetMiscValue() & miscMask) != 0)
+                return true;
+            return false;
+        });
+    }
+    return *modifier;
 }
 
 int32 Unit::GetMaxNegativeAuraModifierByMiscMask(AuraType auraType, uint32 miscMask) const
 {
-    return GetMaxNegativeAuraModifier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& modifier = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscMask, miscMask).MaxNegative;
+    if (!modifier)
     {
-        if ((aurEff->GetMiscValue() & miscMask) != 0)
-            return true;
-        return false;
-    });
+        modifier = GetMaxNegativeAuraModifier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+        {
+            if ((aurEff->GetMiscValue() & miscMask) != 0)
+                return true;
+            return false;
+        });
+    }
+    return *modifier;
 }
 
 int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auraType, int32 miscValue) const
 {
-    return GetTotalAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& total = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscValue, miscValue).Total;
+    if (!total)
     {
-        if (aurEff->GetMiscValue() == miscValue)
-            return true;
-        return false;
-    });
+        total = GetTotalAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+        {
+            if (aurEff->GetMiscValue() == miscValue)
+                return true;
+            return false;
+        });
+    }
+    return *total;
 }
 
 float Unit::GetTotalAuraMultiplierByMiscValue(AuraType auraType, int32 miscValue) const
 {
-    return GetTotalAuraMultiplier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 1.0f;
+
+    Optional<float>& multiplier = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscValue, miscValue).Multiplier;
+    if (!multiplier)
     {
-        if (aurEff->GetMiscValue() == miscValue)
-            return true;
-        return false;
-    });
+        multiplier = GetTotalAuraMultiplier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+        {
+            if (aurEff->GetMiscValue() == miscValue)
+                return true;
+            return false;
+        });
+    }
+    return *multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifierByMiscValue(AuraType auraType, int32 miscValue) const
 {
-    return GetMaxPositiveAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& modifier = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscValue, miscValue).MaxPositive;
+    if (!modifier)
     {
-        if (aurEff->GetMiscValue() == miscValue)
-            return true;
-        return false;
-    });
+        modifier = GetMaxPositiveAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+        {
+            if (aurEff->GetMiscValue() == miscValue)
+                return true;
+            return false;
+        });
+    }
+    return *modifier;
 }
 
 int32 Unit::GetMaxNegativeAuraModifierByMiscValue(AuraType auraType, int32 miscValue) const
 {
-    return GetMaxNegativeAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    Optional<int32>& modifier = GetAuraModifierTotals(GetAuraModifierCache(auraType).ByMiscValue, miscValue).MaxNegative;
+    if (!modifier)
     {
-        if (aurEff->GetMiscValue() == miscValue)
-            return true;
-        return false;
-    });
+        modifier = GetMaxNegativeAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+        {
+            if (aurEff->GetMiscValue() == miscValue)
+                return true;
+            return false;
+        });
+    }
+    return *modifier;
 }
 
 int32 Unit::GetTotalAuraModifierByAffectMask(AuraType auraType, SpellInfo const* affectedSpell) const
@@ -5521,9 +5662,10 @@ void Unit::ExitAllAreaTriggers()
         at->HandleUnitExit(this);
 }
 
-void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage const* log)
+void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage const* log, CombatLogBatch* batch /*= nullptr*/)
 {
-    WorldPackets::CombatLog::SpellNonMeleeDamageLog packet;
+    std::unique_ptr<WorldPackets::CombatLog::SpellNonMeleeDamageLog> packetHolder = std::make_unique<WorldPackets::CombatLog::SpellNonMeleeDamageLog>();
+    WorldPackets::CombatLog::SpellNonMeleeDamageLog& packet = *packetHolder;
     packet.Me = log->target->GetGUID();
     packet.CasterGUID = log->attacker ? log->attacker->GetGUID() : ObjectGuid::Empty;
     packet.CastID = log->castId;
@@ -5547,7 +5689,10 @@ void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage const* log)
     if (contentTuningParams.GenerateDataForUnits(log->attacker, log->target))
         packet.ContentTuning = contentTuningParams;
 
-    SendCombatLogMessage(&packet);
+    if (batch)
+        batch->push_back(std::move(packetHolder));
+    else
+        SendCombatLogMessage(&packet);
 }
 
 /*static*/ void Unit::ProcSkillsAndAuras(Unit* actor, Unit* actionTarget, ProcFlagsInit const& typeMaskActor, ProcFlagsInit const& typeMaskActionTarget,
@@ -5585,13 +5730,32 @@ void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage const* log)
 void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* info)
 {
     AuraEffect const* aura = info->auraEff;
-    WorldPackets::CombatLog::SpellPeriodicAuraLog data;
-    data.TargetGUID = GetGUID();
-    data.CasterGUID = aura->GetCasterGUID();
-    data.SpellID = aura->GetId();
-    data.LogData.Initialize(this);
+    CombatLogBatch* batch = aura->GetBase()->GetPeriodicLogBatch();
+    WorldPackets::CombatLog::SpellPeriodicAuraLog* log = nullptr;
+    std::unique_ptr<WorldPackets::CombatLog::SpellPeriodicAuraLog> packetHolder;
+    if (batch)
+    {
+        // caster and spell are the same for the whole batch, it only ever holds periodic aura logs
+        auto itr = std::ranges::find_if(*batch, [&](std::unique_ptr<WorldPackets::CombatLog::CombatLogServerPacket> const& batched)
+        {
+            return static_cast<WorldPackets::CombatLog::SpellPeriodicAuraLog const*>(batched.get())->TargetGUID == GetGUID();
+        });
 
-    WorldPackets::CombatLog::PeriodicAuraLogEffect& spellLogEffect = data.Effects.emplace_back();
+        if (itr != batch->end())
+            log = static_cast<WorldPackets::CombatLog::SpellPeriodicAuraLog*>(itr->get());
+    }
+
+    if (!log)
+    {
+        packetHolder = std::make_unique<WorldPackets::CombatLog::SpellPeriodicAuraLog>();
+        log = packetHolder.get();
+        log->TargetGUID = GetGUID();
+        log->CasterGUID = aura->GetCasterGUID();
+        log->SpellID = aura->GetId();
+        log->LogData.Initialize(this);
+    }
+
+    WorldPackets::CombatLog::PeriodicAuraLogEffect& spellLogEffect = log->Effects.emplace_back();
     spellLogEffect.Effect = aura->GetAuraType();
     spellLogEffect.Amount = info->damage;
     spellLogEffect.OriginalDamage = info->originalDamage;
@@ -5607,7 +5771,65 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* info)
         if (contentTuningParams.GenerateDataForUnits(caster, this))
             spellLogEffect.ContentTuning = contentTuningParams;
 
-    SendCombatLogMessage(&data);
+    if (!packetHolder)
+        return;
+
+    if (batch)
+        batch->push_back(std::move(packetHolder));
+    else
+        SendPeriodicAuraLogMessage(log);
+}
+
+struct PeriodicAuraLogSender
+{
+    WorldPackets::CombatLog::SpellPeriodicAuraLog const* Log;
+    std::array<Player const*, 2> InvolvedPlayers;
+    bool SendToObservers;
+
+    PeriodicAuraLogSender(WorldPackets::CombatLog::SpellPeriodicAuraLog* log, Player const* target, Player const* caster, bool sendToObservers)
+        : Log(log), InvolvedPlayers({ target, caster }), SendToObservers(sendToObservers)
+    {
+        log->Write();
+    }
+
+    void operator()(Player const* player) const
+    {
+        if (!SendToObservers && !IsInvolved(player))
+            return;
+
+        player->SendDirectMessage(player->IsAdvancedCombatLoggingEnabled() ? Log->GetFullLogPacket() : Log->GetBasicLogPacket());
+    }
+
+    bool IsInvolved(Player const* player) const
+    {
+        for (Player const* involved : InvolvedPlayers)
+            if (involved && (involved == player || involved->IsInSameRaidWith(player)))
+                return true;
+
+        return false;
+    }
+};
+
+void Unit::SendPeriodicAuraLogMessage(WorldPackets::CombatLog::SpellPeriodicAuraLog* log)
+{
+    uint32 observerRate = sWorld->getIntConfig(CONFIG_COMBAT_LOG_PERIODIC_OBSERVER_RATE);
+    if (observerRate == 1)
+    {
+        SendCombatLogMessage(log);
+        return;
+    }
+
+    Player const* caster = nullptr;
+    if (Unit* casterUnit = ObjectAccessor::GetUnit(*this, log->CasterGUID))
+        caster = casterUnit->GetCharmerOrOwnerPlayerOrPlayerItself();
+
+    bool sendToObservers = observerRate && m_periodicAuraLogCount++ % observerRate == 0;
+    PeriodicAuraLogSender sender(log, GetCharmerOrOwnerPlayerOrPlayerItself(), caster, sendToObservers);
+    if (Player const* self = ToPlayer())
+        sender(self);
+
+    Trinity::MessageDistDeliverer<PeriodicAuraLogSender> notifier(this, sender, GetVisibilityRange());
+    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
 }
 
 void Unit::SendSpellDamageResist(Unit* target, uint32 spellId)
@@ -6735,9 +6957,10 @@ void Unit::UnsummonAllTotems()
     }
 }
 
-void Unit::SendHealSpellLog(HealInfo& healInfo, bool critical /*= false*/)
+void Unit::SendHealSpellLog(HealInfo& healInfo, bool critical /*= false*/, CombatLogBatch* batch /*= nullptr*/)
 {
-    WorldPackets::CombatLog::SpellHealLog spellHealLog;
+    std::unique_ptr<WorldPackets::CombatLog::SpellHealLog> packetHolder = std::make_unique<WorldPackets::CombatLog::SpellHealLog>();
+    WorldPackets::CombatLog::SpellHealLog& spellHealLog = *packetHolder;
 
     TC_LOG_DEBUG("spells", "HealSpellLog -- SpellId: {} Caster: {} Target: {} (Health: {} OverHeal: {} Absorbed: {} Crit: {})", healInfo.GetSpellInfo()->Id, healInfo.GetHealer()->GetGUID().ToString(), healInfo.GetTarget()->GetGUID().ToString(),
         healInfo.GetHeal(), healInfo.GetHeal() - healInfo.GetEffectiveHeal(), healInfo.GetAbsorb(), critical);
@@ -6751,15 +6974,18 @@ void Unit::SendHealSpellLog(HealInfo& healInfo, bool critical /*= false*/)
     spellHealLog.Absorbed = healInfo.GetAbsorb();
     spellHealLog.Crit = critical;
     spellHealLog.LogData.Initialize(healInfo.GetTarget());
-    SendCombatLogMessage(&spellHealLog);
+    if (batch)
+        batch->push_back(std::move(packetHolder));
+    else
+        SendCombatLogMessage(&spellHealLog);
 }
 
-int32 Unit::HealBySpell(HealInfo& healInfo, bool critical /*= false*/)
+int32 Unit::HealBySpell(HealInfo& healInfo, bool critical /*= false*/, CombatLogBatch* batch /*= nullptr*/)
 {
     // calculate heal absorb and reduce healing
     Unit::CalcHealAbsorb(healInfo);
     Unit::DealHeal(healInfo);
-    SendHealSpellLog(healInfo, critical);
+    SendHealSpellLog(healInfo, critical, batch);
     return healInfo.GetEffectiveHeal();
 }
 
@@ -10155,6 +10381,9 @@ void Unit::AIUpdateTick(uint32 diff)
 {
     if (UnitAI* ai = GetAI())
     {
+        if (!ai->UpdateSleep(diff, IsEngaged()))
+            return;
+
         m_aiLocked = true;
         ai->UpdateAI(diff);
         m_aiLocked = false;
@@ -10254,6 +10483,9 @@ void Unit::RemoveFromWorld()
         if (UnitAI* ai = GetAI())
             ai->OnDespawn();
 
+        if (_moveSplineBatchSlot != Movement::MoveSplineBatch::NoSlot)
+            GetMap()->GetMoveSplineBatch()->Remove(ToCreature());
+
         if (IsVehicle())
             RemoveVehicleKit(true);
 
@@ -10519,6 +10751,53 @@ void Unit::ProcSkillsAndReactives(bool isVictim, Unit* procTarget, ProcFlagsInit
     }
 }
 
+void Unit::AddProcAuraApplication(AuraApplication* aurApp)
+{
+    if (m_procAuraGeneration != sSpellMgr->GetSpellProcGeneration())
+    {
+        // rebuilding picks up aurApp as well, it was added to m_appliedAuras already
+        RebuildProcAuraApplications();
+        return;
+    }
+
+    Aura const* aura = aurApp->GetBase();
+    SpellProcEntry const* procEntry = aura->GetProcEntry();
+    if (!procEntry)
+        return;
+
+    // failed procs still burn charges or start the cooldown of these, whatever the event is
+    ProcFlagsInit procFlags = procEntry->ProcFlags;
+    if (aura->GetSpellInfo()->HasAttribute(SPELL_ATTR0_PROC_FAILURE_BURNS_CHARGE) || aura->GetSpellInfo()->HasAttribute(SPELL_ATTR2_PROC_COOLDOWN_ON_FAILURE))
+        procFlags = ~ProcFlagsInit();
+
+    // keep the order of m_appliedAuras, new applications go after the ones of the same spell
+    uint32 spellId = aura->GetId();
+    auto itr = std::ranges::upper_bound(m_procAuraApplications, spellId, {}, [](ProcAuraApplication const& procAura) { return procAura.Application->GetBase()->GetId(); });
+    m_procAuraApplications.insert(itr, { .Application = aurApp, .ProcFlags = procFlags });
+    m_procAuraFlags |= procFlags;
+}
+
+void Unit::RemoveProcAuraApplication(AuraApplication* aurApp)
+{
+    auto itr = std::ranges::find(m_procAuraApplications, aurApp, &ProcAuraApplication::Application);
+    if (itr == m_procAuraApplications.end())
+        return;
+
+    m_procAuraApplications.erase(itr);
+    m_procAuraFlags = ProcFlagsInit();
+    for (ProcAuraApplication const& procAura : m_procAuraApplications)
+        m_procAuraFlags |= procAura.ProcFlags;
+}
+
+void Unit::RebuildProcAuraApplications()
+{
+    m_procAuraApplications.clear();
+    m_procAuraFlags = ProcFlagsInit();
+    m_procAuraGeneration = sSpellMgr->GetSpellProcGeneration();
+    for (auto const& [spellId, aurApp] : m_appliedAuras)
+        AddProcAuraApplication(aurApp);
+}
+
 void Unit::GetProcAurasTriggeredOnEvent(AuraApplicationProcContainer& aurasTriggeringProc, AuraApplicationList* procAuras, ProcEventInfo& eventInfo)
 {
     TimePoint now = GameTime::Now();
@@ -10534,7 +10813,7 @@ void Unit::GetProcAurasTriggeredOnEvent(AuraApplicationProcContainer& aurasTrigg
         {
             if (aurApp->GetBase()->GetSpellInfo()->HasAttribute(SPELL_ATTR0_PROC_FAILURE_BURNS_CHARGE))
             {
-                if (SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(aurApp->GetBase()->GetSpellInfo()))
+                if (SpellProcEntry const* procEntry = aurApp->GetBase()->GetProcEntry())
                 {
                     aurApp->GetBase()->PrepareProcChargeDrop(procEntry, eventInfo);
                     aurasTriggeringProc.emplace_back(0, aurApp);
@@ -10542,7 +10821,7 @@ void Unit::GetProcAurasTriggeredOnEvent(AuraApplicationProcContainer& aurasTrigg
             }
 
             if (aurApp->GetBase()->GetSpellInfo()->HasAttribute(SPELL_ATTR2_PROC_COOLDOWN_ON_FAILURE))
-                if (SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(aurApp->GetBase()->GetSpellInfo()))
+                if (SpellProcEntry const* procEntry = aurApp->GetBase()->GetProcEntry())
                     aurApp->GetBase()->AddProcCooldown(procEntry, now);
         }
     };
@@ -10556,11 +10835,24 @@ void Unit::GetProcAurasTriggeredOnEvent(AuraApplicationProcContainer& aurasTrigg
             processAuraApplication(aurApp);
         }
     }
-    // or generate one on our own
+    // or generate one on our own, auras without a proc entry or proc flags matching the event can't trigger
     else
     {
-        for (AuraApplicationMap::iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
-            processAuraApplication(itr->second);
+        if (m_procAuraGeneration != sSpellMgr->GetSpellProcGeneration())
+            RebuildProcAuraApplications();
+
+        ProcFlagsInit typeMask = eventInfo.GetTypeMask();
+        if (!(m_procAuraFlags & typeMask))
+            return;
+
+        // processing may apply new auras
+        boost::container::small_vector<AuraApplication*, 16> candidates;
+        for (ProcAuraApplication const& procAura : m_procAuraApplications)
+            if (procAura.ProcFlags & typeMask)
+                candidates.push_back(procAura.Application);
+
+        for (AuraApplication* aurApp : candidates)
+            processAuraApplication(aurApp);
     }
 }
 
@@ -12358,17 +12650,17 @@ void Unit::CancelSpellMissiles(uint32 spellId, bool reverseMissile /*= false*/,
     bool hasMissile = false;
     if (abortSpell)
     {
-        for (std::pair<uint64 const, BasicEvent*> const& itr : m_Events.GetEvents())
+        m_Events.ForEachEvent([&](BasicEvent* event)
         {
-            if (Spell const* spell = Spell::ExtractSpellFromEvent(itr.second))
+            if (Spell const* spell = Spell::ExtractSpellFromEvent(event))
             {
                 if (spell->GetSpellInfo()->Id == spellId)
                 {
-                    itr.second->ScheduleAbort();
+                    event->ScheduleAbort();
                     hasMissile = true;
                 }
             }
-        }
+        });
     }
     else
         hasMissile = true;
@@ -14101,6 +14393,30 @@ UF::UpdateFieldFlag Unit::GetUpdateFieldFlagsFor(Player const* target) const
     return flags;
 }
 
+bool Unit::HasViewerDependentChanges() const
+{
+    if (WorldObject::HasViewerDependentChanges())
+        return true;
+
+    UF::UnitData const& unitData = *m_unitData;
+    return unitData.IsChanged(&UF::UnitData::StateWorldEffectIDs)
+        || unitData.IsChanged(&UF::UnitData::DisplayID)
+        || unitData.IsChanged(&UF::UnitData::NpcFlags)
+        || unitData.IsChanged(&UF::UnitData::NpcFlags2)
+        || unitData.IsChanged(&UF::UnitData::StateSpellVisualID)
+        || unitData.IsChanged(&UF::UnitData::StateAnimID)
+        || unitData.IsChanged(&UF::UnitData::StateAnimKitID)
+        || unitData.IsChanged(&UF::UnitData::StateWorldEffectsQuestObjectiveID)
+        || unitData.IsChanged(&UF::UnitData::FactionTemplate)
+        || unitData.IsChanged(&UF::UnitData::Flags)
+        || unitData.IsChanged(&UF::UnitData::Flags2)
+        || unitData.IsChanged(&UF::UnitData::Flags3)
+        || unitData.IsChanged(&UF::UnitData::Flags4)
+        || unitData.IsChanged(&UF::UnitData::AuraState)
+        || unitData.IsChanged(&UF::UnitData::PvpFlags)
+        || unitData.IsChanged(&UF::UnitData::InteractSpellID);
+}
+
 void Unit::DestroyForPlayer(Player* target) const
 {
     if (Battleground* bg = target->GetBattleground())
@@ -31,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <stack>
+#include <unordered_map>
 
 #define VISUAL_WAYPOINT 1 // Creature Entry ID used for waypoints show, visible only for GMs
 #define WORLD_TRIGGER 12999
@@ -112,6 +113,8 @@ enum ZLiquidStatus : uint32;
 namespace Movement
 {
     class MoveSpline;
+    class MoveSplineBatch;
+    struct Location;
     struct SpellEffectExtraData;
 }
 
@@ -1095,8 +1098,9 @@ class TC_GAME_API Unit : public WorldObject
         bool IsOnOceanFloor() const;
         bool isInAccessiblePlaceFor(Creature const* c) const;
 
-        void SendHealSpellLog(HealInfo& healInfo, bool critical = false);
-        int32 HealBySpell(HealInfo& healInfo, bool critical = false);
+        // batch collects the log instead of sending it, see WorldObject::SendCombatLogMessages
+        void SendHealSpellLog(HealInfo& healInfo, bool critical = false, CombatLogBatch* batch = nullptr);
+        int32 HealBySpell(HealInfo& healInfo, bool critical = false, CombatLogBatch* batch = nullptr);
         void SendEnergizeSpellLog(Unit* victim, uint32 spellId, int32 damage, int32 overEnergize, Powers powerType);
         void EnergizeBySpell(Unit* victim, SpellInfo const* spellInfo, int32 damage, Powers powerType);
 
@@ -1117,8 +1121,10 @@ class TC_GAME_API Unit : public WorldObject
 
         void SendAttackStateUpdate(CalcDamageInfo* damageInfo);
         void SendAttackStateUpdate(uint32 HitInfo, Unit* target, uint8 SwingType, SpellSchoolMask damageSchoolMask, uint32 Damage, uint32 AbsorbDamage, uint32 Resist, VictimState TargetState, uint32 BlockedAmount, uint32 RageGained);
-        void SendSpellNonMeleeDamageLog(SpellNonMeleeDamage const* log);
+        void SendSpellNonMeleeDamageLog(SpellNonMeleeDamage const* log, CombatLogBatch* batch = nullptr);
+        // merged with the other effects of the aura ticking in the same update, see Aura::GetPeriodicLogBatch
         void SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo);
+        void SendPeriodicAuraLogMessage(WorldPackets::CombatLog::SpellPeriodicAuraLog* log);
         void SendSpellDamageResist(Unit* target, uint32 spellId);
         void SendSpellDamageImmune(Unit* target, uint32 spellId, bool isPeriodic);
 
@@ -1356,6 +1362,9 @@ class TC_GAME_API Unit : public WorldObject
         void GetDispellableAuraList(WorldObject const* caster, uint32 dispelMask, DispelChargesList& dispelList, bool isReflect = false) const;
 
         bool HasAuraEffect(uint32 spellId, uint8 effIndex, ObjectGuid caster = ObjectGuid::Empty) const;
+        // Increased whenever an effect of an applied aura is applied or removed, HasAuraEffect results can only change with it
+        uint32 GetAuraApplicationRevision() const { return m_auraApplicationRevision; }
+        void IncreaseAuraApplicationRevision() { ++m_auraApplicationRevision; }
         uint32 GetAuraCount(uint32 spellId) const;
         bool HasAura(uint32 spellId, ObjectGuid casterGUID = ObjectGuid::Empty, ObjectGuid itemCasterGUID = ObjectGuid::Empty, uint32 reqEffMask = 0) const;
         bool HasAura(std::function<bool(Aura const*)> const& predicate) const;
@@ -1399,6 +1408,12 @@ class TC_GAME_API Unit : public WorldObject
         int32 GetMaxPositiveAuraModifierByAffectMask(AuraType auraType, SpellInfo const* affectedSpell) const;
         int32 GetMaxNegativeAuraModifierByAffectMask(AuraType auraType, SpellInfo const* affectedSpell) const;
 
+        // Aggregates without a predicate (or by misc value/mask) are cached until an effect of auraType is registered,
+        // unregistered or changes its amount
+        void InvalidateAuraModifierCache(AuraType auraType) { m_auraModifierCache.erase(auraType); }
+        // Drops the cached aggregates of every unit, needed when spell stack rules are reloaded
+        static void InvalidateAllAuraModifierCaches();
+
         void InitStatBuffMods();
         void UpdateStatBuffMod(Stats stat);
         void UpdateStatBuffModForClient(Stats stat);
@@ -1876,6 +1891,7 @@ class TC_GAME_API Unit : public WorldObject
         explicit Unit (bool isWorldObject);
 
         UF::UpdateFieldFlag GetUpdateFieldFlagsFor(Player const* target) const override;
+        bool HasViewerDependentChanges() const override;
 
         void DestroyForPlayer(Player* target) const override;
         void ClearUpdateMask(bool remove) override;
@@ -1915,11 +1931,50 @@ class TC_GAME_API Unit : public WorldObject
 
         AuraMap m_ownedAuras;
         AuraApplicationMap m_appliedAuras;
+
+        // Applied auras with a proc entry, in m_appliedAuras order, along with the proc flags they can trigger on
+        struct ProcAuraApplication
+        {
+            AuraApplication* Application;
+            ProcFlagsInit ProcFlags;
+        };
+
+        void AddProcAuraApplication(AuraApplication* aurApp);
+        void RemoveProcAuraApplication(AuraApplication* aurApp);
+        void RebuildProcAuraApplications();
+
+        std::vector<ProcAuraApplication> m_procAuraApplications;
+        ProcFlagsInit m_procAuraFlags;                             // union of the proc flags of m_procAuraApplications
+        uint32 m_procAuraGeneration;                               // proc table generation m_procAuraApplications was built from
         AuraList m_removedAuras;
         AuraMap::iterator m_auraUpdateIterator;
         uint32 m_removedAurasCount;
+        uint32 m_auraApplicationRevision;
+        uint32 m_periodicAuraLogCount;                             // periodic aura logs sent by this unit, see CONFIG_COMBAT_LOG_PERIODIC_OBSERVER_RATE
 
         std::array<AuraEffectList, TOTAL_AURAS> m_modAuras;
+
+        struct AuraModifierTotals
+        {
+            Optional<int32> Total;
+            Optional<float> Multiplier;
+            Optional<int32> MaxPositive;
+            Optional<int32> MaxNegative;
+        };
+
+        struct AuraModifierCache
+        {
+            AuraModifierTotals All;
+            std::vector<std::pair<int32, AuraModifierTotals>> ByMiscValue;
+            std::vector<std::pair<uint32, AuraModifierTotals>> ByMiscMask;
+        };
+
+        AuraModifierCache& GetAuraModifierCache(AuraType auraType) const;
+        template<typename Key>
+        static AuraModifierTotals& GetAuraModifierTotals(std::vector<std::pair<Key, AuraModifierTotals>>& totals, Key key);
+
+        mutable std::unordered_map<AuraType, AuraModifierCache> m_auraModifierCache;
+        mutable uint32 m_auraModifierCacheGeneration;
         AuraList m_scAuras;                        // cast singlecast auras
         AuraApplicationList m_interruptableAuras;  // auras which have interrupt mask applied on unit
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
@@ -1978,8 +2033,10 @@ class TC_GAME_API Unit : public WorldObject
 
     private:
 
+        friend class Movement::MoveSplineBatch;
         void UpdateSplineMovement(uint32 t_diff);
         void UpdateSplinePosition();
+        void UpdateSplinePosition(Movement::Location loc);
         void SendFlightSplineSyncUpdate();
         void InterruptMovementBasedAuras();
 
@@ -2039,6 +2096,7 @@ class TC_GAME_API Unit : public WorldObject
 
         std::unique_ptr<MovementForces> _movementForces;
         PositionUpdateInfo _positionUpdateInfo;
+        uint32 _moveSplineBatchSlot;    ///< Slot in the MoveSplineBatch of the map advancing the spline, MoveSplineBatch::NoSlot if the unit does it itself
 
         bool _isCombatDisallowed;
 };
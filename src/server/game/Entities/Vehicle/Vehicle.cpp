@@ -577,7 +577,7 @@ void Vehicle::RelocatePassengers()
     }
 
     for (auto const& [passenger, position] : seatRelocation)
-        UpdatePassengerPosition(_me->GetMap(), passenger, position, false);
+        UpdatePassengerPosition(_me->GetMap(), passenger, position, false, true);
 }
 
 /**
@@ -186,7 +186,8 @@ public:
 
     virtual TransportBase* RemovePassenger(WorldObject* passenger) = 0;
 
-    void UpdatePassengerPosition(Map* map, WorldObject* passenger, Position const& position, bool setHomePosition);
+    /// Moves the passenger on the map, updateVisibility false leaves the visibility of creatures staying in their cell to the caller
+    void UpdatePassengerPosition(Map* map, WorldObject* passenger, Position const& position, bool setHomePosition, bool updateVisibility);
 
     virtual int32 GetMapIdForSpawning() const = 0;
 };
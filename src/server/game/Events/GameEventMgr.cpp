@@ -36,6 +36,12 @@
 #include "WorldStateMgr.h"
 #include "WowTime.h"
 
+namespace
+{
+// time spent on spawning and removing the objects of started and stopped events per world update
+constexpr Milliseconds SpawnChangesTimeBudget = 5ms;
+}
+
 GameEventMgr* GameEventMgr::instance()
 {
     static GameEventMgr instance;
@@ -933,6 +939,8 @@ void GameEventMgr::LoadFromDB()
             TC_LOG_INFO("server.loading", ">> Loaded {} pools for game events in {} ms.", count, GetMSTimeDiffToNow(oldMSTime));
         }
     }
+
+    LoadSpawnChanges();
 }
 
 uint64 GameEventMgr::GetNPCFlag(Creature* cr)
@@ -1098,6 +1106,8 @@ void GameEventMgr::UnApplyEvent(uint16 event_id)
     UpdateEventNPCFlags(event_id);
     // remove vendor items
     UpdateEventNPCVendor(event_id, false);
+    // spawn groups may depend on the event
+    Map::InvalidateAllSpawnGroupConditions();
 }
 
 void GameEventMgr::ApplyNewEvent(uint16 event_id)
@@ -1122,6 +1132,8 @@ void GameEventMgr::ApplyNewEvent(uint16 event_id)
     UpdateEventNPCFlags(event_id);
     // add vendor items
     UpdateEventNPCVendor(event_id, true);
+    // spawn groups may depend on the event
+    Map::InvalidateAllSpawnGroupConditions();
 
     //! Run SAI scripts with SMART_EVENT_GAME_EVENT_START
     RunSmartAIScripts(event_id, true);
@@ -1182,65 +1194,14 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 {
     int32 internal_event_id = mGameEvent.size() + event_id - 1;
 
-    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventCreatureGuids.size()))
-    {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempted access to out of range mGameEventCreatureGuids element {} (size: {}).",
-            internal_event_id, mGameEventCreatureGuids.size());
-        return;
-    }
-
-    for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
-    {
-        // Add to correct cell
-        if (CreatureData const* data = sObjectMgr->GetCreatureData(*itr))
-        {
-            sObjectMgr->AddCreatureToGrid(data);
-
-            // Spawn if necessary (loaded grids only)
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr, data](Map* map)
-            {
-                map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, *itr);
-                // We use spawn coords to spawn
-                if (map->IsGridLoaded(data->spawnPoint))
-                    Creature::CreateCreatureFromDB(*itr, map);
-            });
-        }
-    }
-
-    if (internal_event_id >= int32(mGameEventGameobjectGuids.size()))
+    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventSpawnChanges.size()))
     {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempted access to out of range mGameEventGameobjectGuids element {} (size: {}).",
-            internal_event_id, mGameEventGameobjectGuids.size());
+        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempted access to out of range mGameEventSpawnChanges element {} (size: {}).",
+            internal_event_id, mGameEventSpawnChanges.size());
         return;
     }
 
-    for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
-    {
-        // Add to correct cell
-        if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
-        {
-            sObjectMgr->AddGameobjectToGrid(data);
-            // Spawn if necessary (loaded grids only)
-            // this base map checked as non-instanced and then only existed
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr, data](Map* map)
-            {
-                map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, *itr);
-                // We use current coords to unspawn, not spawn coords since creature can have changed grid
-                if (map->IsGridLoaded(data->spawnPoint))
-                {
-                    if (GameObject* go = GameObject::CreateGameObjectFromDB(*itr, map, false))
-                    {
-                        /// @todo find out when it is add to map
-                        if (go->isSpawnedByDefault())
-                        {
-                            if (!map->AddToMap(go))
-                                delete go;
-                        }
-                    }
-                }
-            });
-        }
-    }
+    QueueSpawnChanges(internal_event_id, event_id, true);
 
     if (internal_event_id >= int32(mGameEventPoolIds.size()))
     {
@@ -1265,84 +1226,200 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
 {
     int32 internal_event_id = mGameEvent.size() + event_id - 1;
 
-    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventCreatureGuids.size()))
+    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventSpawnChanges.size()))
     {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventCreatureGuids element {} (size: {}).",
-            internal_event_id, mGameEventCreatureGuids.size());
+        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventSpawnChanges element {} (size: {}).",
+            internal_event_id, mGameEventSpawnChanges.size());
         return;
     }
 
-    for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
+    QueueSpawnChanges(internal_event_id, event_id, false);
+
+    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventPoolIds.size()))
     {
-        // check if it's needed by another event, if so, don't remove
-        if (event_id > 0 && hasCreatureActiveEventExcept(*itr, event_id))
-            continue;
-        // Remove the creature from grid
-        if (CreatureData const* data = sObjectMgr->GetCreatureData(*itr))
-        {
-            sObjectMgr->RemoveCreatureFromGrid(data);
+        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventPoolIds element {} (size: {}).", internal_event_id, mGameEventPoolIds.size());
+        return;
+    }
 
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr](Map* map)
+    for (IdList::iterator itr = mGameEventPoolIds[internal_event_id].begin(); itr != mGameEventPoolIds[internal_event_id].end(); ++itr)
+    {
+        if (PoolTemplateData const* poolTemplate = sPoolMgr->GetPoolTemplate(*itr))
+        {
+            sMapMgr->DoForAllMapsWithMapId(poolTemplate->MapId, [&itr](Map* map)
             {
-                map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, *itr);
-                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = creatureBounds.first; itr2 != creatureBounds.second;)
-                {
-                    Creature* creature = itr2->second;
-                    ++itr2;
-                    creature->AddObjectToRemoveList();
-                }
+                sPoolMgr->DespawnPool(map->GetPoolData(), *itr, true);
             });
         }
     }
+}
+
+void GameEventMgr::LoadSpawnChanges()
+{
+    // indexes of the old spawn lists are meaningless now
+    _pendingSpawnChangeGrids.clear();
+    _pendingSpawnChanges.clear();
 
-    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventGameobjectGuids.size()))
+    struct SortedSpawn
     {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventGameobjectGuids element {} (size: {}).",
-            internal_event_id, mGameEventGameobjectGuids.size());
-        return;
+        uint32 MapId;
+        uint32 GridId;
+        SpawnObjectType Type;
+        ObjectGuid::LowType SpawnId;
+    };
+
+    mGameEventSpawnChanges.assign(mGameEventCreatureGuids.size(), {});
+    std::vector<SortedSpawn> spawns;
+    for (std::size_t i = 0; i < mGameEventSpawnChanges.size(); ++i)
+    {
+        auto addSpawns = [&](GuidList const& guids, SpawnObjectType type)
+        {
+            for (ObjectGuid::LowType spawnId : guids)
+                if (SpawnData const* data = sObjectMgr->GetSpawnData(type, spawnId))
+                    spawns.push_back({ .MapId = data->mapId, .GridId = Trinity::ComputeGridCoord(data->spawnPoint.GetPositionX(), data->spawnPoint.GetPositionY()).GetId(),
+                        .Type = type, .SpawnId = spawnId });
+        };
+
+        spawns.clear();
+        addSpawns(mGameEventCreatureGuids[i], SPAWN_TYPE_CREATURE);
+        if (i < mGameEventGameobjectGuids.size())
+            addSpawns(mGameEventGameobjectGuids[i], SPAWN_TYPE_GAMEOBJECT);
+
+        // creatures stay before the gameobjects of their grid
+        std::ranges::stable_sort(spawns, {}, [](SortedSpawn const& spawn) { return std::make_pair(spawn.MapId, spawn.GridId); });
+
+        EventSpawnChanges& changes = mGameEventSpawnChanges[i];
+        changes.Spawns.reserve(spawns.size());
+        for (SortedSpawn const& spawn : spawns)
+        {
+            if (changes.Grids.empty() || changes.Grids.back().MapId != spawn.MapId || changes.Grids.back().GridId != spawn.GridId)
+                changes.Grids.push_back({ .MapId = spawn.MapId, .GridId = spawn.GridId, .Begin = uint32(changes.Spawns.size()), .End = uint32(changes.Spawns.size()) });
+
+            changes.Spawns.emplace_back(spawn.Type, spawn.SpawnId);
+            ++changes.Grids.back().End;
+        }
     }
+}
 
-    for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
+void GameEventMgr::QueueSpawnChanges(int32 internal_event_id, int16 event_id, bool spawn)
+{
+    EventSpawnChanges const& changes = mGameEventSpawnChanges[internal_event_id];
+    for (std::pair<SpawnObjectType, ObjectGuid::LowType> const& spawnKey : changes.Spawns)
     {
-        // check if it's needed by another event, if so, don't remove
-        if (event_id >0 && hasGameObjectActiveEventExcept(*itr, event_id))
-            continue;
-        // Remove the gameobject from grid
-        if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
+        auto [type, spawnId] = spawnKey;
+        if (spawn)
+        {
+            // Add to correct cell, grids loaded from now on spawn it by themselves
+            if (type == SPAWN_TYPE_CREATURE)
+                sObjectMgr->AddCreatureToGrid(sObjectMgr->GetCreatureData(spawnId));
+            else
+                sObjectMgr->AddGameobjectToGrid(sObjectMgr->GetGameObjectData(spawnId));
+        }
+        else
         {
-            sObjectMgr->RemoveGameobjectFromGrid(data);
+            // check if it's needed by another event, if so, don't remove
+            if (event_id > 0 && (type == SPAWN_TYPE_CREATURE ? hasCreatureActiveEventExcept(spawnId, event_id) : hasGameObjectActiveEventExcept(spawnId, event_id)))
+                continue;
 
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr](Map* map)
-            {
-                map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, *itr);
-                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = gameobjectBounds.first; itr2 != gameobjectBounds.second;)
-                {
-                    GameObject* go = itr2->second;
-                    ++itr2;
-                    go->AddObjectToRemoveList();
-                }
-            });
+            // Remove from grid
+            if (type == SPAWN_TYPE_CREATURE)
+                sObjectMgr->RemoveCreatureFromGrid(sObjectMgr->GetCreatureData(spawnId));
+            else
+                sObjectMgr->RemoveGameobjectFromGrid(sObjectMgr->GetGameObjectData(spawnId));
         }
+
+        // an event stopping before its spawns were applied overrides them
+        _pendingSpawnChanges[spawnKey] = spawn;
     }
 
-    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventPoolIds.size()))
-    {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventPoolIds element {} (size: {}).", internal_event_id, mGameEventPoolIds.size());
+    for (uint32 gridIndex = 0; gridIndex < changes.Grids.size(); ++gridIndex)
+        _pendingSpawnChangeGrids.emplace_back(internal_event_id, gridIndex);
+}
+
+void GameEventMgr::UpdateSpawnChanges()
+{
+    if (_pendingSpawnChangeGrids.empty())
         return;
-    }
 
-    for (IdList::iterator itr = mGameEventPoolIds[internal_event_id].begin(); itr != mGameEventPoolIds[internal_event_id].end(); ++itr)
+    TimePoint budgetEnd = std::chrono::steady_clock::now() + SpawnChangesTimeBudget;
+    do
     {
-        if (PoolTemplateData const* poolTemplate = sPoolMgr->GetPoolTemplate(*itr))
+        auto [internal_event_id, gridIndex] = _pendingSpawnChangeGrids.front();
+        _pendingSpawnChangeGrids.pop_front();
+        ApplySpawnChanges(internal_event_id, gridIndex);
+    } while (!_pendingSpawnChangeGrids.empty() && std::chrono::steady_clock::now() < budgetEnd);
+}
+
+void GameEventMgr::ApplySpawnChanges(int32 internal_event_id, uint32 gridIndex)
+{
+    EventSpawnChanges const& changes = mGameEventSpawnChanges[internal_event_id];
+    SpawnChangeGrid const& grid = changes.Grids[gridIndex];
+    sMapMgr->DoForAllMapsWithMapId(grid.MapId, [&](Map* map)
+    {
+        // grids that aren't loaded only need the respawn times gone, they load the spawns of active events themselves
+        bool gridLoaded = map->IsGridLoaded(grid.GridId);
+        for (uint32 i = grid.Begin; i < grid.End; ++i)
         {
-            sMapMgr->DoForAllMapsWithMapId(poolTemplate->MapId, [&itr](Map* map)
+            auto state = _pendingSpawnChanges.find(changes.Spawns[i]);
+            if (state == _pendingSpawnChanges.end())
+                continue;
+
+            auto [type, spawnId] = changes.Spawns[i];
+            map->RemoveRespawnTime(type, spawnId);
+
+            if (state->second)
             {
-                sPoolMgr->DespawnPool(map->GetPoolData(), *itr, true);
-            });
+                if (!gridLoaded)
+                    continue;
+
+                if (type == SPAWN_TYPE_CREATURE)
+                {
+                    // the grid may have been loaded with it after the event started
+                    if (map->GetCreatureBySpawnIdStore().count(spawnId))
+                        continue;
+
+                    Creature::CreateCreatureFromDB(spawnId, map);
+                }
+                else
+                {
+                    if (map->GetGameObjectBySpawnIdStore().count(spawnId))
+                        continue;
+
+                    if (GameObject* go = GameObject::CreateGameObjectFromDB(spawnId, map, false))
+                    {
+                        /// @todo find out when it is add to map
+                        if (go->isSpawnedByDefault())
+                        {
+                            if (!map->AddToMap(go))
+                                delete go;
+                        }
+                    }
+                }
+            }
+            else if (type == SPAWN_TYPE_CREATURE)
+            {
+                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(spawnId);
+                for (auto itr = creatureBounds.first; itr != creatureBounds.second;)
+                {
+                    Creature* creature = itr->second;
+                    ++itr;
+                    creature->AddObjectToRemoveList();
+                }
+            }
+            else
+            {
+                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(spawnId);
+                for (auto itr = gameobjectBounds.first; itr != gameobjectBounds.second;)
+                {
+                    GameObject* go = itr->second;
+                    ++itr;
+                    go->AddObjectToRemoveList();
+                }
+            }
         }
-    }
+    });
+
+    for (uint32 i = grid.Begin; i < grid.End; ++i)
+        _pendingSpawnChanges.erase(changes.Spawns[i]);
 }
 
 void GameEventMgr::ChangeEquipOrModel(int16 event_id, bool activate)
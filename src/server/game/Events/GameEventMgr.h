@@ -21,8 +21,11 @@
 #include "Common.h"
 #include "SharedDefines.h"
 #include "Define.h"
+#include "Hash.h"
 #include "ObjectGuid.h"
 #include "Optional.h"
+#include "SpawnData.h"
+#include <deque>
 #include <list>
 #include <map>
 #include <set>
@@ -114,6 +117,8 @@ class TC_GAME_API GameEventMgr
         uint32 NextCheck(uint16 entry) const;
         void LoadFromDB();
         uint32 Update();
+        /// Spawns and removes the objects of started and stopped events on loaded grids, a few grids per world update
+        void UpdateSpawnChanges();
         bool IsActiveEvent(uint16 event_id) const { return (m_ActiveEvents.contains(event_id)); }
         uint32 StartSystem();
         void Initialize();
@@ -132,6 +137,9 @@ class TC_GAME_API GameEventMgr
         void UnApplyEvent(uint16 event_id);
         void GameEventSpawn(int16 event_id);
         void GameEventUnspawn(int16 event_id);
+        void LoadSpawnChanges();
+        void QueueSpawnChanges(int32 internal_event_id, int16 event_id, bool spawn);
+        void ApplySpawnChanges(int32 internal_event_id, uint32 gridIndex);
         void ChangeEquipOrModel(int16 event_id, bool activate);
         void UpdateEventQuests(uint16 event_id, bool activate);
         void UpdateWorldStates(uint16 event_id, bool Activate);
@@ -176,6 +184,25 @@ class TC_GAME_API GameEventMgr
         ActiveEvents m_ActiveEvents;
         bool isSystemInit;
 
+        // creatures and gameobjects of an event sorted by map and grid, the ones of each grid are spawned and removed together
+        struct SpawnChangeGrid
+        {
+            uint32 MapId;
+            uint32 GridId;
+            uint32 Begin;
+            uint32 End;
+        };
+
+        struct EventSpawnChanges
+        {
+            std::vector<std::pair<SpawnObjectType, ObjectGuid::LowType>> Spawns;
+            std::vector<SpawnChangeGrid> Grids;
+        };
+
+        std::vector<EventSpawnChanges> mGameEventSpawnChanges;
+        std::deque<std::pair<int32 /*internal_event_id*/, uint32 /*gridIndex*/>> _pendingSpawnChangeGrids;
+        std::unordered_map<std::pair<SpawnObjectType, ObjectGuid::LowType>, bool /*spawn*/> _pendingSpawnChanges;  // last requested state of each spawn
+
     public:
         GameEventGuidMap  mGameEventCreatureGuids;
         GameEventGuidMap  mGameEventGameobjectGuids;
@@ -24,6 +24,7 @@
 #include "ObjectGridLoader.h"
 #include "Player.h"
 #include "World.h"
+#include <bitset>
 
 class GarrisonGridLoader
 {
@@ -45,6 +46,7 @@ private:
     NGridType* i_grid;
     GarrisonMap* i_map;
     Garrison* i_garrison;
+    std::vector<std::pair<CellCoord, Garrison::Plot*>> i_plots;
     uint32 i_gameObjects;
     uint32 i_creatures;
 };
@@ -53,12 +55,29 @@ void GarrisonGridLoader::LoadN()
 {
     if (i_garrison)
     {
+        // plot cells are computed once per grid, cells without a plot are not visited at all
+        std::bitset<MAX_NUMBER_OF_CELLS * MAX_NUMBER_OF_CELLS> cellsWithPlots;
+        for (Garrison::Plot* plot : i_garrison->GetPlots())
+        {
+            Position const& spawn = plot->PacketInfo.PlotPos.Pos;
+            CellCoord cellCoord = Trinity::ComputeCellCoord(spawn.GetPositionX(), spawn.GetPositionY());
+            Cell cell(cellCoord);
+            if (cell.GridX() != i_cell.GridX() || cell.GridY() != i_cell.GridY())
+                continue;
+
+            i_plots.emplace_back(cellCoord, plot);
+            cellsWithPlots.set(cell.CellX() * MAX_NUMBER_OF_CELLS + cell.CellY());
+        }
+
         i_cell.data.Part.cell_y = 0;
         for (uint32 x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
         {
             i_cell.data.Part.cell_x = x;
             for (uint32 y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
             {
+                if (!cellsWithPlots[x * MAX_NUMBER_OF_CELLS + y])
+                    continue;
+
                 i_cell.data.Part.cell_y = y;
 
                 //Load creatures and game objects
@@ -73,25 +92,20 @@ void GarrisonGridLoader::LoadN()
 
 void GarrisonGridLoader::Visit(GameObjectMapType& m)
 {
-    std::vector<Garrison::Plot*> plots = i_garrison->GetPlots();
-    if (!plots.empty())
+    CellCoord cellCoord = i_cell.GetCellCoord();
+    for (auto const& [plotCellCoord, plot] : i_plots)
     {
-        CellCoord cellCoord = i_cell.GetCellCoord();
-        for (Garrison::Plot* plot : plots)
-        {
-            Position const& spawn = plot->PacketInfo.PlotPos.Pos;
-            if (cellCoord != Trinity::ComputeCellCoord(spawn.GetPositionX(), spawn.GetPositionY()))
-                continue;
+        if (plotCellCoord != cellCoord)
+            continue;
 
-            GameObject* go = plot->CreateGameObject(i_map, i_garrison->GetFaction());
-            if (!go)
-                continue;
+        GameObject* go = plot->CreateGameObject(i_map, i_garrison->GetFaction());
+        if (!go)
+            continue;
 
-            go->AddToGrid(m);
-            ObjectGridLoader::SetObjectCell(go, cellCoord);
-            go->AddToWorld();
-            ++i_gameObjects;
-        }
+        go->AddToGrid(m);
+        ObjectGridLoader::SetObjectCell(go, cellCoord);
+        go->AddToWorld();
+        ++i_gameObjects;
     }
 }
 
@@ -16,6 +16,7 @@
  */
 
 #include "ObjectAccessor.h"
+#include "CaseFoldedName.h"
 #include "Corpse.h"
 #include "Creature.h"
 #include "DynamicObject.h"
@@ -26,9 +27,21 @@
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "SeqLockHashMap.h"
 #include "Transport.h"
 #include <mutex>
 
+namespace
+{
+// the map threads look up players constantly, the index lets them do it without touching the lock
+template<class T>
+Trinity::Containers::SeqLockHashMap<ObjectGuid, T>& GetLookupIndex()
+{
+    static Trinity::Containers::SeqLockHashMap<ObjectGuid, T> _index;
+    return _index;
+}
+}
+
 template<class T>
 void HashMapHolder<T>::Insert(T* o)
 {
@@ -38,6 +51,7 @@ void HashMapHolder<T>::Insert(T* o)
     std::scoped_lock lock(*GetLock());
 
     GetContainer()[o->GetGUID()] = o;
+    GetLookupIndex<T>().Insert(o->GetGUID(), o);
 }
 
 template<class T>
@@ -46,15 +60,13 @@ void HashMapHolder<T>::Remove(T* o)
     std::scoped_lock lock(*GetLock());
 
     GetContainer().erase(o->GetGUID());
+    GetLookupIndex<T>().Remove(o->GetGUID());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock lock(*GetLock());
-
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetLookupIndex<T>().Find(guid);
 }
 
 template<class T>
@@ -75,26 +87,56 @@ template class TC_GAME_API HashMapHolder<Player>;
 
 namespace PlayerNameMapHolder
 {
-    typedef std::unordered_map<std::string, Player*> MapType;
+    typedef Trinity::CaseFoldedNameMap<Player*> MapType;
     static MapType PlayerNameMap;
 
+    // players by case folded hash of their name for lookups without the lock, names with the hash of another online player are only in PlayerNameMap
+    static Trinity::Containers::SeqLockHashMap<uint64, Player> PlayerNameIndex;
+    static std::atomic<bool> HasNameHashCollisions = false;
+
+    uint64 GetNameHash(std::string_view name)
+    {
+        return Trinity::CaseFoldedNameHash()(name);
+    }
+
     void Insert(Player* p)
     {
+        std::scoped_lock lock(*HashMapHolder<Player>::GetLock());
+
         PlayerNameMap[p->GetName()] = p;
+
+        uint64 hash = GetNameHash(p->GetName());
+        if (Player* indexed = PlayerNameIndex.Find(hash); indexed && !Trinity::CaseFoldedNameEqual()(indexed->GetName(), p->GetName()))
+        {
+            HasNameHashCollisions = true;
+            return;
+        }
+
+        PlayerNameIndex.Insert(hash, p);
     }
 
     void Remove(Player* p)
     {
+        std::scoped_lock lock(*HashMapHolder<Player>::GetLock());
+
         PlayerNameMap.erase(p->GetName());
+
+        uint64 hash = GetNameHash(p->GetName());
+        if (PlayerNameIndex.Find(hash) == p)
+            PlayerNameIndex.Remove(hash);
     }
 
+    // any spelling of the name, same as normalizing it first
     Player* Find(std::string_view name)
     {
-        std::string charName(name);
-        if (!normalizePlayerName(charName))
+        if (Player* player = PlayerNameIndex.Find(GetNameHash(name)); player && Trinity::CaseFoldedNameEqual()(player->GetName(), name))
+            return player;
+
+        if (!HasNameHashCollisions)
             return nullptr;
 
-        auto itr = PlayerNameMap.find(charName);
+        std::shared_lock lock(*HashMapHolder<Player>::GetLock());
+        auto itr = PlayerNameMap.find(name);
         return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
     }
 } // namespace PlayerNameMapHolder
@@ -51,6 +51,7 @@ public:
 
     static void Remove(T* o);
 
+    // doesn't take the lock, GetLock only guards the container
     static T* Find(ObjectGuid guid);
 
     static MapType& GetContainer();
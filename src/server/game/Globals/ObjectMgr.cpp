@@ -36,6 +36,7 @@
 #include "GridDefines.h"
 #include "GroupMgr.h"
 #include "GuildMgr.h"
+#include "Hyperlinks.h"
 #include "InstanceScript.h"
 #include "Item.h"
 #include "ItemBonusMgr.h"
@@ -64,6 +65,7 @@
 #include "SpellInfo.h"
 #include "SpellMgr.h"
 #include "SpellScript.h"
+#include "StartupCache.h"
 #include "StringConvert.h"
 #include "TemporarySummon.h"
 #include "TerrainMgr.h"
@@ -255,6 +257,8 @@ void ObjectMgr::LoadCreatureLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    Trinity::Hyperlinks::ClearValidatedLinkCache();
+
     _creatureLocaleStore.clear(); // need for reload case
 
     //                                               0      1       2     3        4      5
@@ -345,6 +349,93 @@ void ObjectMgr::LoadPointOfInterestLocales()
     TC_LOG_INFO("server.loading", ">> Loaded {} points_of_interest locale strings in {} ms", uint32(_pointOfInterestLocaleStore.size()), GetMSTimeDiffToNow(oldMSTime));
 }
 
+namespace
+{
+void WriteLocaleKey(StartupCacheWriter& writer, uint32 key) { writer.Write(key); }
+void WriteLocaleKey(StartupCacheWriter& writer, std::pair<uint32, uint32> const& key) { writer.Write(key.first); writer.Write(key.second); }
+bool ReadLocaleKey(StartupCacheReader& reader, uint32& key) { return reader.Read(key); }
+bool ReadLocaleKey(StartupCacheReader& reader, std::pair<uint32, uint32>& key) { return reader.Read(key.first) && reader.Read(key.second); }
+
+// Every locale struct is a set of per-locale string vectors, members lists them in a fixed order
+template<typename Key, typename Locale, typename... Members>
+void WriteLocaleStore(StartupCacheWriter& writer, std::unordered_map<Key, Locale> const& store, Members... members)
+{
+    writer.Write(uint32(store.size()));
+    for (auto const& [key, locale] : store)
+    {
+        WriteLocaleKey(writer, key);
+        (writer.Write(locale.*members), ...);
+    }
+}
+
+template<typename Key, typename Locale, typename... Members>
+bool ReadLocaleStore(StartupCacheReader& reader, std::unordered_map<Key, Locale>& store, Members... members)
+{
+    uint32 count = 0;
+    if (!reader.Read(count))
+        return false;
+
+    store.clear();
+    store.reserve(count);
+    for (uint32 i = 0; i < count; ++i)
+    {
+        Key key;
+        Locale locale;
+        if (!ReadLocaleKey(reader, key) || !(reader.Read(locale.*members) && ...))
+            return false;
+
+        store.emplace(key, std::move(locale));
+    }
+
+    return true;
+}
+}
+
+void ObjectMgr::SaveLocalesToCache(StartupCacheWriter& writer) const
+{
+    WriteLocaleStore(writer, _creatureLocaleStore, &CreatureLocale::Name, &CreatureLocale::NameAlt, &CreatureLocale::Title, &CreatureLocale::TitleAlt);
+    WriteLocaleStore(writer, _gameObjectLocaleStore, &GameObjectLocale::Name, &GameObjectLocale::CastBarCaption, &GameObjectLocale::Unk1);
+    WriteLocaleStore(writer, _questTemplateLocaleStore, &QuestTemplateLocale::LogTitle, &QuestTemplateLocale::LogDescription,
+        &QuestTemplateLocale::QuestDescription, &QuestTemplateLocale::AreaDescription, &QuestTemplateLocale::PortraitGiverText,
+        &QuestTemplateLocale::PortraitGiverName, &QuestTemplateLocale::PortraitTurnInText, &QuestTemplateLocale::PortraitTurnInName,
+        &QuestTemplateLocale::QuestCompletionLog);
+    WriteLocaleStore(writer, _questOfferRewardLocaleStore, &QuestOfferRewardLocale::RewardText);
+    WriteLocaleStore(writer, _questRequestItemsLocaleStore, &QuestRequestItemsLocale::CompletionText);
+    WriteLocaleStore(writer, _questObjectivesLocaleStore, &QuestObjectivesLocale::Description);
+    WriteLocaleStore(writer, _pageTextLocaleStore, &PageTextLocale::Text);
+    WriteLocaleStore(writer, _gossipMenuItemsLocaleStore, &GossipMenuItemsLocale::OptionText, &GossipMenuItemsLocale::BoxText);
+    WriteLocaleStore(writer, _pointOfInterestLocaleStore, &PointOfInterestLocale::Name);
+}
+
+bool ObjectMgr::LoadLocalesFromCache(StartupCacheReader& reader)
+{
+    uint32 oldMSTime = getMSTime();
+
+    bool loaded = ReadLocaleStore(reader, _creatureLocaleStore, &CreatureLocale::Name, &CreatureLocale::NameAlt, &CreatureLocale::Title, &CreatureLocale::TitleAlt)
+        && ReadLocaleStore(reader, _gameObjectLocaleStore, &GameObjectLocale::Name, &GameObjectLocale::CastBarCaption, &GameObjectLocale::Unk1)
+        && ReadLocaleStore(reader, _questTemplateLocaleStore, &QuestTemplateLocale::LogTitle, &QuestTemplateLocale::LogDescription,
+            &QuestTemplateLocale::QuestDescription, &QuestTemplateLocale::AreaDescription, &QuestTemplateLocale::PortraitGiverText,
+            &QuestTemplateLocale::PortraitGiverName, &QuestTemplateLocale::PortraitTurnInText, &QuestTemplateLocale::PortraitTurnInName,
+            &QuestTemplateLocale::QuestCompletionLog)
+        && ReadLocaleStore(reader, _questOfferRewardLocaleStore, &QuestOfferRewardLocale::RewardText)
+        && ReadLocaleStore(reader, _questRequestItemsLocaleStore, &QuestRequestItemsLocale::CompletionText)
+        && ReadLocaleStore(reader, _questObjectivesLocaleStore, &QuestObjectivesLocale::Description)
+        && ReadLocaleStore(reader, _pageTextLocaleStore, &PageTextLocale::Text)
+        && ReadLocaleStore(reader, _gossipMenuItemsLocaleStore, &GossipMenuItemsLocale::OptionText, &GossipMenuItemsLocale::BoxText)
+        && ReadLocaleStore(reader, _pointOfInterestLocaleStore, &PointOfInterestLocale::Name)
+        && reader.IsComplete();
+
+    if (!loaded)
+    {
+        TC_LOG_ERROR("server.loading", ">> Startup cache locale strings are incomplete, loading them from the database");
+        return false;
+    }
+
+    TC_LOG_INFO("server.loading", ">> Loaded {} creature, {} gameobject and {} quest locale strings from the startup cache in {} ms", uint32(_creatureLocaleStore.size()),
+        uint32(_gameObjectLocaleStore.size()), uint32(_questTemplateLocaleStore.size()), GetMSTimeDiffToNow(oldMSTime));
+    return true;
+}
+
 void ObjectMgr::LoadCreatureTemplates()
 {
     uint32 oldMSTime = getMSTime();
@@ -396,6 +487,8 @@ void ObjectMgr::LoadCreatureTemplates()
     for (auto const& ctPair : _creatureTemplateStore)
         CheckCreatureTemplate(&ctPair.second);
 
+    _creatureTemplateIndex.Build(_creatureTemplateStore);
+
     TC_LOG_INFO("server.loading", ">> Loaded {} creature definitions in {} ms", _creatureTemplateStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -872,6 +965,8 @@ void ObjectMgr::LoadCreatureTemplateAddons()
     }
     while (result->NextRow());
 
+    _creatureTemplateAddonIndex.Build(_creatureTemplateAddonStore);
+
     TC_LOG_INFO("server.loading", ">> Loaded {} creature template addons in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -1409,6 +1504,9 @@ CreatureAddon const* ObjectMgr::GetCreatureAddon(ObjectGuid::LowType lowguid) co
 
 CreatureAddon const* ObjectMgr::GetCreatureTemplateAddon(uint32 entry) const
 {
+    if (_creatureTemplateAddonIndex.Covers(_creatureTemplateAddonStore.size()))
+        return _creatureTemplateAddonIndex.Find(entry);
+
     CreatureTemplateAddonContainer::const_iterator itr = _creatureTemplateAddonStore.find(entry);
     if (itr != _creatureTemplateAddonStore.end())
         return &(itr->second);
@@ -2124,16 +2222,18 @@ void ObjectMgr::LoadCreatures()
 {
     uint32 oldMSTime = getMSTime();
 
-    //                                               0              1   2    3           4           5           6            7        8             9              10
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id, map, position_x, position_y, position_z, orientation, modelid, equipment_id, spawntimesecs, wander_distance, "
-    //   11               12            13            14                 15          16           17                18                   19                    20
-        "currentwaypoint, curHealthPct, MovementType, spawnDifficulties, eventEntry, poolSpawnId, creature.npcflag, creature.unit_flags, creature.unit_flags2, creature.unit_flags3, "
-    //   21                      22                23                   24                       25                   26
-        "creature.phaseUseFlags, creature.phaseid, creature.phasegroup, creature.terrainSwapMap, creature.ScriptName, creature.StringId "
-        "FROM creature "
-        "LEFT OUTER JOIN game_event_creature ON creature.guid = game_event_creature.guid "
-        "LEFT OUTER JOIN pool_members ON pool_members.type = 0 AND creature.guid = pool_members.spawnId");
-
+    //                                        0              1   2    3           4           5           6            7        8             9              10
+    //                                       "SELECT creature.guid, id, map, position_x, position_y, position_z, orientation, modelid, equipment_id, spawntimesecs, wander_distance, "
+    //                                        11               12            13            14                 15          16           17                18                   19                    20
+    //                                       "currentwaypoint, curHealthPct, MovementType, spawnDifficulties, eventEntry, poolSpawnId, creature.npcflag, creature.unit_flags, creature.unit_flags2, creature.unit_flags3, "
+    //                                        21                      22                23                   24                       25                   26
+    //                                       "creature.phaseUseFlags, creature.phaseid, creature.phasegroup, creature.terrainSwapMap, creature.ScriptName, creature.StringId "
+    //                                       "FROM creature "
+    //                                       "LEFT OUTER JOIN game_event_creature ON creature.guid = game_event_creature.guid "
+    //                                       "LEFT OUTER JOIN pool_members ON pool_members.type = 0 AND creature.guid = pool_members.spawnId"
+
+    // spawn tables are by far the largest ones loaded at startup, read them row by row instead of buffering them
+    PreparedQueryResult result = WorldDatabase.QueryUnbuffered(WorldDatabase.GetPreparedStatement(WORLD_SEL_CREATURE_SPAWNS));
     if (!result)
     {
         TC_LOG_INFO("server.loading", ">> Loaded 0 creatures. DB table `creature` is empty.");
@@ -2147,7 +2247,6 @@ void ObjectMgr::LoadCreatures()
 
     PhaseShift phaseShift;
 
-    _creatureDataStore.reserve(result->GetRowCount());
 
     do
     {
@@ -2411,6 +2510,14 @@ CellObjectGuids const* ObjectMgr::GetCellObjectGuids(uint32 mapid, Difficulty sp
     return nullptr;
 }
 
+GridSpawnIds const* ObjectMgr::GetGridSpawnIds(uint32 mapid, Difficulty spawnMode, uint32 grid_id) const
+{
+    if (GridSpawnIdsMap const* mapGrids = Trinity::Containers::MapGetValuePtr(_mapGridSpawnIdsStore, { mapid, spawnMode }))
+        return Trinity::Containers::MapGetValuePtr(*mapGrids, grid_id);
+
+    return nullptr;
+}
+
 CellObjectGuidsMap const* ObjectMgr::GetMapObjectGuids(uint32 mapid, Difficulty spawnMode)
 {
     return Trinity::Containers::MapGetValuePtr(_mapObjectGuidsStore, { mapid, spawnMode });
@@ -2429,15 +2536,31 @@ CellObjectGuids const* ObjectMgr::GetCellPersonalObjectGuids(uint32 mapid, Diffi
     return nullptr;
 }
 
-template<CellGuidSet CellObjectGuids::*guids>
+static std::pair<uint32 /*gridId*/, GridSpawnIdList::value_type> MakeGridSpawnId(CellCoord const& cellCoord, ObjectGuid::LowType spawnId)
+{
+    GridCoord gridCoord(cellCoord.x_coord / MAX_NUMBER_OF_CELLS, cellCoord.y_coord / MAX_NUMBER_OF_CELLS);
+    uint16 cellIndex = (cellCoord.x_coord % MAX_NUMBER_OF_CELLS) * MAX_NUMBER_OF_CELLS + cellCoord.y_coord % MAX_NUMBER_OF_CELLS;
+    return { gridCoord.GetId(), { cellIndex, spawnId } };
+}
+
+template<CellGuidSet CellObjectGuids::*guids, GridSpawnIdList GridSpawnIds::*gridGuids>
 void ObjectMgr::AddSpawnDataToGrid(SpawnData const* data)
 {
-    uint32 cellId = Trinity::ComputeCellCoord(data->spawnPoint.GetPositionX(), data->spawnPoint.GetPositionY()).GetId();
+    CellCoord cellCoord = Trinity::ComputeCellCoord(data->spawnPoint.GetPositionX(), data->spawnPoint.GetPositionY());
+    uint32 cellId = cellCoord.GetId();
     bool isPersonalPhase = PhasingHandler::IsPersonalPhase(data->phaseId);
     if (!isPersonalPhase)
     {
+        auto [gridId, gridSpawnId] = MakeGridSpawnId(cellCoord, data->spawnId);
         for (Difficulty difficulty : data->spawnDifficulties)
+        {
             (_mapObjectGuidsStore[{ data->mapId, difficulty }][cellId].*guids).insert(data->spawnId);
+
+            GridSpawnIdList& gridSpawns = _mapGridSpawnIdsStore[{ data->mapId, difficulty }][gridId].*gridGuids;
+            auto itr = std::ranges::lower_bound(gridSpawns, gridSpawnId);
+            if (itr == gridSpawns.end() || *itr != gridSpawnId)
+                gridSpawns.insert(itr, gridSpawnId);
+        }
     }
     else
     {
@@ -2446,15 +2569,24 @@ void ObjectMgr::AddSpawnDataToGrid(SpawnData const* data)
     }
 }
 
-template<CellGuidSet CellObjectGuids::*guids>
+template<CellGuidSet CellObjectGuids::*guids, GridSpawnIdList GridSpawnIds::*gridGuids>
 void ObjectMgr::RemoveSpawnDataFromGrid(SpawnData const* data)
 {
-    uint32 cellId = Trinity::ComputeCellCoord(data->spawnPoint.GetPositionX(), data->spawnPoint.GetPositionY()).GetId();
+    CellCoord cellCoord = Trinity::ComputeCellCoord(data->spawnPoint.GetPositionX(), data->spawnPoint.GetPositionY());
+    uint32 cellId = cellCoord.GetId();
     bool isPersonalPhase = PhasingHandler::IsPersonalPhase(data->phaseId);
     if (!isPersonalPhase)
     {
+        auto [gridId, gridSpawnId] = MakeGridSpawnId(cellCoord, data->spawnId);
         for (Difficulty difficulty : data->spawnDifficulties)
+        {
             (_mapObjectGuidsStore[{ data->mapId, difficulty }][cellId].*guids).erase(data->spawnId);
+
+            GridSpawnIdList& gridSpawns = _mapGridSpawnIdsStore[{ data->mapId, difficulty }][gridId].*gridGuids;
+            auto itr = std::ranges::lower_bound(gridSpawns, gridSpawnId);
+            if (itr != gridSpawns.end() && *itr == gridSpawnId)
+                gridSpawns.erase(itr);
+        }
     }
     else
     {
@@ -2465,27 +2597,28 @@ void ObjectMgr::RemoveSpawnDataFromGrid(SpawnData const* data)
 
 void ObjectMgr::AddCreatureToGrid(CreatureData const* data)
 {
-    AddSpawnDataToGrid<&CellObjectGuids::creatures>(data);
+    AddSpawnDataToGrid<&CellObjectGuids::creatures, &GridSpawnIds::creatures>(data);
 }
 
 void ObjectMgr::RemoveCreatureFromGrid(CreatureData const* data)
 {
-    RemoveSpawnDataFromGrid<&CellObjectGuids::creatures>(data);
+    RemoveSpawnDataFromGrid<&CellObjectGuids::creatures, &GridSpawnIds::creatures>(data);
 }
 
 void ObjectMgr::LoadGameObjects()
 {
     uint32 oldMSTime = getMSTime();
 
-    //                                                0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
-    //   7          8          9          10         11             12            13     14                 15          16
-        "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnDifficulties, eventEntry, poolSpawnId, "
-    //   17             18       19          20              21          22
-        "phaseUseFlags, phaseid, phasegroup, terrainSwapMap, ScriptName, StringId "
-        "FROM gameobject LEFT OUTER JOIN game_event_gameobject ON gameobject.guid = game_event_gameobject.guid "
-        "LEFT OUTER JOIN pool_members ON pool_members.type = 1 AND gameobject.guid = pool_members.spawnId");
+    //                                        0                1   2    3           4           5           6
+    //                                       "SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+    //                                        7          8          9          10         11             12            13     14                 15          16
+    //                                       "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnDifficulties, eventEntry, poolSpawnId, "
+    //                                        17             18       19          20              21          22
+    //                                       "phaseUseFlags, phaseid, phasegroup, terrainSwapMap, ScriptName, StringId "
+    //                                       "FROM gameobject LEFT OUTER JOIN game_event_gameobject ON gameobject.guid = game_event_gameobject.guid "
+    //                                       "LEFT OUTER JOIN pool_members ON pool_members.type = 1 AND gameobject.guid = pool_members.spawnId"
 
+    PreparedQueryResult result = WorldDatabase.QueryUnbuffered(WorldDatabase.GetPreparedStatement(WORLD_SEL_GAMEOBJECT_SPAWNS));
     if (!result)
     {
         TC_LOG_INFO("server.loading", ">> Loaded 0 gameobjects. DB table `gameobject` is empty.");
@@ -2499,7 +2632,6 @@ void ObjectMgr::LoadGameObjects()
 
     PhaseShift phaseShift;
 
-    _gameObjectDataStore.reserve(result->GetRowCount());
 
     do
     {
@@ -2970,12 +3102,12 @@ void ObjectMgr::OnDeleteSpawnData(SpawnData const* data)
 
 void ObjectMgr::AddGameobjectToGrid(GameObjectData const* data)
 {
-    AddSpawnDataToGrid<&CellObjectGuids::gameobjects>(data);
+    AddSpawnDataToGrid<&CellObjectGuids::gameobjects, &GridSpawnIds::gameobjects>(data);
 }
 
 void ObjectMgr::RemoveGameobjectFromGrid(GameObjectData const* data)
 {
-    RemoveSpawnDataFromGrid<&CellObjectGuids::gameobjects>(data);
+    RemoveSpawnDataFromGrid<&CellObjectGuids::gameobjects, &GridSpawnIds::gameobjects>(data);
 }
 
 uint32 FillMaxDurability(uint32 itemClass, uint32 itemSubClass, uint32 inventoryType, uint32 quality, uint32 itemLevel)
@@ -3373,6 +3505,8 @@ void ObjectMgr::LoadItemTemplates()
         }
     }
 
+    _itemTemplateIndex.Build(_itemTemplateStore);
+
     TC_LOG_INFO("server.loading", ">> Loaded {} item templates in {} ms", _itemTemplateStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -3444,6 +3578,9 @@ void ObjectMgr::LoadItemScriptNames()
 
 ItemTemplate const* ObjectMgr::GetItemTemplate(uint32 entry) const
 {
+    if (_itemTemplateIndex.Covers(_itemTemplateStore.size()))
+        return _itemTemplateIndex.Find(entry);
+
     return Trinity::Containers::MapGetValuePtr(_itemTemplateStore, entry);
 }
 
@@ -4572,6 +4709,10 @@ void ObjectMgr::LoadQuests()
 {
     uint32 oldMSTime = getMSTime();
 
+    Trinity::Hyperlinks::ClearValidatedLinkCache();
+
+    // must go before the quests it points to
+    _questTemplateIndex.Clear();
     _questTemplates.clear();
     _questTemplatesAutoPush.clear();
     _questObjectives.clear();
@@ -5395,6 +5536,8 @@ void ObjectMgr::LoadQuests()
         if (Quest const* quest = GetQuestTemplate(paragonReputation->QuestID))
             const_cast<Quest*>(quest)->SetSpecialFlag(QUEST_SPECIAL_FLAGS_REPEATABLE);
 
+    _questTemplateIndex.Build(_questTemplates, [](Trinity::unique_trackable_ptr<Quest> const& quest) -> Quest const& { return *quest; });
+
     TC_LOG_INFO("server.loading", ">> Loaded {} quests definitions in {} ms", _questTemplates.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -5414,6 +5557,8 @@ void ObjectMgr::LoadQuestTemplateLocale()
 {
     uint32 oldMSTime = getMSTime();
 
+    Trinity::Hyperlinks::ClearValidatedLinkCache();
+
     _questTemplateLocaleStore.clear(); // need for reload case
     //                                               0     1
     QueryResult result = WorldDatabase.Query("SELECT Id, locale, "
@@ -6382,130 +6527,193 @@ void ObjectMgr::LoadNPCText()
     TC_LOG_INFO("server.loading", ">> Loaded {} npc texts in {} ms", uint32(_npcTextStore.size()), GetMSTimeDiffToNow(oldMSTime));
 }
 
-//not very fast function but it is called only once a day, or on starting-up
+struct ObjectMgr::ExpiredMails
+{
+    time_t Time = 0;
+    uint32 StartMSTime = 0;
+    PreparedQueryResult Mails;
+    std::unordered_map<uint64 /*messageId*/, MailItemInfoVec> Items;
+    bool Loaded = false;
+    uint32 DeletedCount = 0;
+    uint32 ReturnedCount = 0;
+
+    void LoadItems(PreparedQueryResult items)
+    {
+        if (!items)
+            return;
+
+        MailItemInfo item;
+        do
+        {
+            Field* fields = items->Fetch();
+            item.item_guid = fields[0].GetUInt64();
+            item.item_template = fields[1].GetUInt32();
+            uint64 mailId = fields[2].GetUInt64();
+            Items[mailId].push_back(item);
+        } while (items->NextRow());
+    }
+};
+
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
-    uint32 oldMSTime = getMSTime();
+    // the previous run is not done yet, it will also handle the mails that expired meanwhile the next time
+    if (_expiredMails)
+        return;
+
+    std::unique_ptr<ExpiredMails> expiredMails = std::make_unique<ExpiredMails>();
+    expiredMails->Time = GameTime::GetGameTime();
+    expiredMails->StartMSTime = getMSTime();
 
-    time_t curTime = GameTime::GetGameTime();
     tm lt;
-    localtime_r(&curTime, &lt);
+    localtime_r(&expiredMails->Time, &lt);
     TC_LOG_INFO("misc", "Returning mails current time: hour: {}, minute: {}, second: {} ", lt.tm_hour, lt.tm_min, lt.tm_sec);
 
     // Delete all old mails without item and without body immediately, if starting server
     if (!serverUp)
     {
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EMPTY_EXPIRED_MAIL);
-        stmt->setInt64(0, curTime);
+        stmt->setInt64(0, expiredMails->Time);
         CharacterDatabase.Execute(stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
+        stmt->setInt64(0, expiredMails->Time);
+        expiredMails->Mails = CharacterDatabase.Query(stmt);
+        if (!expiredMails->Mails)
+        {
+            TC_LOG_INFO("server.loading", ">> No expired mails found.");
+            return;                                         // any mails need to be returned or deleted
+        }
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+        stmt->setInt64(0, expiredMails->Time);
+        expiredMails->LoadItems(CharacterDatabase.Query(stmt));
+
+        while (!ReturnOrDeleteExpiredMails(*expiredMails, false, 200))
+            ;
+        return;
     }
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
-    stmt->setInt64(0, curTime);
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-    if (!result)
-    {
-        TC_LOG_INFO("server.loading", ">> No expired mails found.");
-        return;                                             // any mails need to be returned or deleted
-    }
+    stmt->setInt64(0, expiredMails->Time);
 
-    std::map<uint64 /*messageId*/, MailItemInfoVec> itemsCache;
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
-    stmt->setUInt32(0, curTime);
-    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
-    {
-        MailItemInfo item;
-        do
+    _expiredMails = std::move(expiredMails);
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
+        .WithChainingPreparedCallback([this](QueryCallback& callback, PreparedQueryResult result)
         {
-            Field* fields = items->Fetch();
-            item.item_guid = fields[0].GetUInt64();
-            item.item_template = fields[1].GetUInt32();
-            uint64 mailId = fields[2].GetUInt64();
-            itemsCache[mailId].push_back(item);
-        } while (items->NextRow());
-    }
+            if (!result)
+            {
+                TC_LOG_INFO("misc", ">> No expired mails found.");
+                _expiredMails = nullptr;
+                return;
+            }
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
-    do
+            _expiredMails->Mails = std::move(result);
+
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+            stmt->setInt64(0, _expiredMails->Time);
+            callback.SetNextQuery(CharacterDatabase.AsyncQuery(stmt));
+        })
+        .WithPreparedCallback([this](PreparedQueryResult items)
+        {
+            _expiredMails->LoadItems(std::move(items));
+            _expiredMails->Loaded = true;
+        }));
+}
+
+void ObjectMgr::UpdateExpiredMails()
+{
+    _queryProcessor.ProcessReadyCallbacks();
+
+    // a transaction of a few hundred mails per world update, neither this thread nor the database stall on a large backlog
+    if (_expiredMails && _expiredMails->Loaded && ReturnOrDeleteExpiredMails(*_expiredMails, true, 200))
+        _expiredMails = nullptr;
+}
+
+// returns true when all mails are processed
+bool ObjectMgr::ReturnOrDeleteExpiredMails(ExpiredMails& expiredMails, bool serverUp, uint32 limit)
+{
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    CharacterDatabasePreparedStatement* stmt;
+
+    bool hasNext = true;
+    for (uint32 i = 0; i < limit && hasNext; ++i, hasNext = expiredMails.Mails->NextRow())
     {
-        Field* fields = result->Fetch();
+        Field* fields = expiredMails.Mails->Fetch();
         ObjectGuid::LowType receiver = fields[3].GetUInt64();
         if (serverUp && ObjectAccessor::FindConnectedPlayer(ObjectGuid::Create<HighGuid::Player>(receiver)))
             continue;
 
-        Mail* m = new Mail;
-        m->messageID      = fields[0].GetUInt64();
-        m->messageType    = fields[1].GetUInt8();
-        m->sender         = fields[2].GetUInt64();
-        m->receiver       = receiver;
-        bool has_items    = fields[4].GetBool();
-        m->expire_time    = fields[5].GetInt64();
-        m->deliver_time   = 0;
-        m->COD            = fields[6].GetUInt64();
-        m->checked        = fields[7].GetUInt8();
-        m->mailTemplateId = fields[8].GetInt16();
+        uint64 messageID   = fields[0].GetUInt64();
+        uint8 messageType  = fields[1].GetUInt8();
+        ObjectGuid::LowType sender = fields[2].GetUInt64();
+        bool has_items     = fields[4].GetBool();
+        uint8 checked      = fields[7].GetUInt8();
 
         // Delete or return mail
         if (has_items)
         {
             // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
+            MailItemInfoVec items;
+            items.swap(expiredMails.Items[messageID]);
 
             // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
-            if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
+            if (messageType != MAIL_NORMAL || (checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
             {
-                CharacterDatabaseTransaction nonTransactional(nullptr);
                 // mail open and then not returned
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
+                for (MailItemInfo const& item : items)
                 {
-                    Item::DeleteFromDB(nonTransactional, itr2->item_guid);
-                    AzeriteItem::DeleteFromDB(nonTransactional, itr2->item_guid);
-                    AzeriteEmpoweredItem::DeleteFromDB(nonTransactional, itr2->item_guid);
+                    Item::DeleteFromDB(trans, item.item_guid);
+                    AzeriteItem::DeleteFromDB(trans, item.item_guid);
+                    AzeriteEmpoweredItem::DeleteFromDB(trans, item.item_guid);
                 }
 
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
-                stmt->setUInt64(0, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                stmt->setUInt64(0, messageID);
+                trans->Append(stmt);
             }
             else
             {
                 // Mail will be returned
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
-                stmt->setUInt64(0, m->receiver);
-                stmt->setUInt64(1, m->sender);
-                stmt->setInt64 (2, curTime + 30 * DAY);
-                stmt->setInt64 (3, curTime);
+                stmt->setUInt64(0, receiver);
+                stmt->setUInt64(1, sender);
+                stmt->setInt64 (2, expiredMails.Time + 30 * DAY);
+                stmt->setInt64 (3, expiredMails.Time);
                 stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
-                stmt->setUInt64(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
+                stmt->setUInt64(5, messageID);
+                trans->Append(stmt);
+                for (MailItemInfo const& item : items)
                 {
                     // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
-                    stmt->setUInt64(0, m->sender);
-                    stmt->setUInt64(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    stmt->setUInt64(0, sender);
+                    stmt->setUInt64(1, item.item_guid);
+                    trans->Append(stmt);
 
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
-                    stmt->setUInt64(0, m->sender);
-                    stmt->setUInt64(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    stmt->setUInt64(0, sender);
+                    stmt->setUInt64(1, item.item_guid);
+                    trans->Append(stmt);
                 }
-                delete m;
-                ++returnedCount;
+                ++expiredMails.ReturnedCount;
                 continue;
             }
         }
 
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
-        stmt->setUInt64(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
-        delete m;
-        ++deletedCount;
+        stmt->setUInt64(0, messageID);
+        trans->Append(stmt);
+        ++expiredMails.DeletedCount;
     }
-    while (result->NextRow());
 
-    TC_LOG_INFO("server.loading", ">> Processed {} expired mails: {} deleted and {} returned in {} ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+    CharacterDatabase.CommitTransaction(trans);
+
+    if (hasNext)
+        return false;
+
+    TC_LOG_INFO(serverUp ? "misc" : "server.loading", ">> Processed {} expired mails: {} deleted and {} returned in {} ms",
+        expiredMails.DeletedCount + expiredMails.ReturnedCount, expiredMails.DeletedCount, expiredMails.ReturnedCount, GetMSTimeDiffToNow(expiredMails.StartMSTime));
+    return true;
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
@@ -6826,6 +7034,9 @@ uint32 ObjectMgr::GetTaxiMountDisplayId(uint32 id, uint32 team, bool allowed_alt
 
 Quest const* ObjectMgr::GetQuestTemplate(uint32 quest_id) const
 {
+    if (_questTemplateIndex.Covers(_questTemplates.size()))
+        return _questTemplateIndex.Find(quest_id);
+
     auto itr = _questTemplates.find(quest_id);
     return itr != _questTemplates.end() ? itr->second.get() : nullptr;
 }
@@ -7470,7 +7681,9 @@ void ObjectMgr::SetHighestGuids()
 
 ObjectGuidGenerator& ObjectMgr::GetGuidSequenceGenerator(HighGuid high)
 {
-    return _guidGenerators.try_emplace(high, high).first->second;
+    // items are created by every map thread, the others almost only by the world thread
+    uint32 blockSize = high == HighGuid::Item ? ItemGuidBlockSize : 1;
+    return _guidGenerators.try_emplace(high, high, UI64LIT(1), blockSize).first->second;
 }
 
 uint32 ObjectMgr::GenerateAuctionID()
@@ -7870,6 +8083,8 @@ void ObjectMgr::LoadGameObjectTemplate()
         }
     } while (result->NextRow());
 
+    _gameObjectTemplateIndex.Build(_gameObjectTemplateStore);
+
     TC_LOG_INFO("server.loading", ">> Loaded {} game object templates in {} ms", _gameObjectTemplateStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -7956,6 +8171,8 @@ void ObjectMgr::LoadGameObjectTemplateAddons()
     }
     while (result->NextRow());
 
+    _gameObjectTemplateAddonIndex.Build(_gameObjectTemplateAddonStore);
+
     TC_LOG_INFO("server.loading", ">> Loaded {} game object template addons in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -10604,11 +10821,17 @@ DestructibleHitpoint const* ObjectMgr::GetDestructibleHitpoint(uint32 entry) con
 
 GameObjectTemplate const* ObjectMgr::GetGameObjectTemplate(uint32 entry) const
 {
+    if (_gameObjectTemplateIndex.Covers(_gameObjectTemplateStore.size()))
+        return _gameObjectTemplateIndex.Find(entry);
+
     return Trinity::Containers::MapGetValuePtr(_gameObjectTemplateStore, entry);
 }
 
 GameObjectTemplateAddon const* ObjectMgr::GetGameObjectTemplateAddon(uint32 entry) const
 {
+    if (_gameObjectTemplateAddonIndex.Covers(_gameObjectTemplateAddonStore.size()))
+        return _gameObjectTemplateAddonIndex.Find(entry);
+
     auto itr = _gameObjectTemplateAddonStore.find(entry);
     if (itr != _gameObjectTemplateAddonStore.end())
         return &itr->second;
@@ -10623,6 +10846,9 @@ GameObjectOverride const* ObjectMgr::GetGameObjectOverride(ObjectGuid::LowType s
 
 CreatureTemplate const* ObjectMgr::GetCreatureTemplate(uint32 entry) const
 {
+    if (_creatureTemplateIndex.Covers(_creatureTemplateStore.size()))
+        return _creatureTemplateIndex.Find(entry);
+
     return Trinity::Containers::MapGetValuePtr(_creatureTemplateStore, entry);
 }
 
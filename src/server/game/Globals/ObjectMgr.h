@@ -19,9 +19,11 @@
 #define _OBJECTMGR_H
 
 #include "Common.h"
+#include "AsyncCallbackProcessor.h"
 #include "ConditionMgr.h"
 #include "CreatureData.h"
 #include "DatabaseEnvFwd.h"
+#include "DenseIndex.h"
 #include "GameObjectData.h"
 #include "ItemTemplate.h"
 #include "IteratorPair.h"
@@ -42,12 +44,15 @@
 #include <atomic>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <unordered_map>
 
 class Item;
 class Unit;
 class Vehicle;
 class Map;
+class StartupCacheReader;
+class StartupCacheWriter;
 enum class GossipOptionFlags : int32;
 enum class GossipOptionNpc : uint8;
 struct AccessRequirement;
@@ -486,6 +491,16 @@ typedef std::unordered_map<uint32/*cell_id*/, CellObjectGuids> CellObjectGuidsMa
 typedef std::unordered_map<std::pair<uint32 /*mapId*/, Difficulty>, CellObjectGuidsMap> MapObjectGuids;
 typedef std::map<std::tuple<uint32/*mapId*/, Difficulty, uint32 /*phaseId*/>, CellObjectGuidsMap> MapPersonalObjectGuids;
 
+// Spawns of one grid sorted by cell in the order ObjectGridLoader visits the cells, a grid load reads them front to back
+typedef std::vector<std::pair<uint16 /*cell_x * MAX_NUMBER_OF_CELLS + cell_y*/, ObjectGuid::LowType>> GridSpawnIdList;
+struct GridSpawnIds
+{
+    GridSpawnIdList creatures;
+    GridSpawnIdList gameobjects;
+};
+typedef std::unordered_map<uint32/*grid_id*/, GridSpawnIds> GridSpawnIdsMap;
+typedef std::unordered_map<std::pair<uint32 /*mapId*/, Difficulty>, GridSpawnIdsMap> MapGridSpawnIds;
+
 struct TrinityString
 {
     std::vector<std::string> Content;
@@ -1267,6 +1282,9 @@ class TC_GAME_API ObjectMgr
         void LoadPageTextLocales();
         void LoadGossipMenuItemsLocales();
         void LoadPointOfInterestLocales();
+        // All localization strings of the loaders above, as one startup cache section
+        void SaveLocalesToCache(StartupCacheWriter& writer) const;
+        bool LoadLocalesFromCache(StartupCacheReader& reader);
         void LoadInstanceTemplate();
         void LoadMailLevelRewards();
         void LoadVehicleTemplateAccessories();
@@ -1348,7 +1366,9 @@ class TC_GAME_API ObjectMgr
 
         SkillTiersEntry const* GetSkillTier(uint32 skillTierId) const;
 
+        // all at once while starting up, later the mails are queried asynchronously and processed in batches by UpdateExpiredMails
         void ReturnOrDeleteOldMails(bool serverUp);
+        void UpdateExpiredMails();
 
         CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
@@ -1396,6 +1416,8 @@ class TC_GAME_API ObjectMgr
         }
 
         CellObjectGuids const* GetCellObjectGuids(uint32 mapid, Difficulty spawnMode, uint32 cell_id);
+        // Spawns of every cell of the grid, one lookup for loading the whole grid. Personal phase spawns are not included
+        GridSpawnIds const* GetGridSpawnIds(uint32 mapid, Difficulty spawnMode, uint32 grid_id) const;
 
         CellObjectGuidsMap const* GetMapObjectGuids(uint32 mapid, Difficulty spawnMode);
 
@@ -1704,8 +1726,12 @@ class TC_GAME_API ObjectMgr
         // first free low guid for selected guid type
         ObjectGuidGenerator& GetGuidSequenceGenerator(HighGuid high);
 
+        // item guids every thread reserves at once, see ObjectGuidGenerator
+        static constexpr uint32 ItemGuidBlockSize = 4096;
+
         std::map<HighGuid, ObjectGuidGenerator> _guidGenerators;
         QuestContainer _questTemplates;
+        Trinity::Containers::DenseIndex<Quest const> _questTemplateIndex;
         std::vector<Quest const*> _questTemplatesAutoPush;
         QuestObjectivesByIdContainer _questObjectives;
 
@@ -1789,10 +1815,10 @@ class TC_GAME_API ObjectMgr
         QuestRelationResult GetQuestRelationsFrom(QuestRelations const& map, uint32 key, bool onlyActive) const { return { map.equal_range(key), onlyActive }; }
         void PlayerCreateInfoAddItemHelper(uint32 race_, uint32 class_, uint32 itemId, int32 count);
 
-        template<CellGuidSet CellObjectGuids::*guids>
+        template<CellGuidSet CellObjectGuids::*guids, GridSpawnIdList GridSpawnIds::*gridGuids>
         void AddSpawnDataToGrid(SpawnData const* data);
 
-        template<CellGuidSet CellObjectGuids::*guids>
+        template<CellGuidSet CellObjectGuids::*guids, GridSpawnIdList GridSpawnIds::*gridGuids>
         void RemoveSpawnDataFromGrid(SpawnData const* data);
 
         MailLevelRewardContainer _mailLevelRewardStore;
@@ -1822,12 +1848,15 @@ class TC_GAME_API ObjectMgr
 
         MapObjectGuids _mapObjectGuidsStore;
         MapPersonalObjectGuids _mapPersonalObjectGuidsStore;
+        MapGridSpawnIds _mapGridSpawnIdsStore;
         CreatureDataContainer _creatureDataStore;
         CreatureTemplateContainer _creatureTemplateStore;
+        Trinity::Containers::DenseIndex<CreatureTemplate const> _creatureTemplateIndex;
         CreatureModelContainer _creatureModelStore;
         std::unordered_map<uint32, CreatureSummonedData> _creatureSummonedDataStore;
         CreatureAddonContainer _creatureAddonStore;
         CreatureTemplateAddonContainer _creatureTemplateAddonStore;
+        Trinity::Containers::DenseIndex<CreatureAddon const> _creatureTemplateAddonIndex;
         CreatureTemplateSparringContainer _creatureTemplateSparringStore;
         std::unordered_map<ObjectGuid::LowType, CreatureMovementData> _creatureMovementOverrides;
         GameObjectAddonContainer _gameObjectAddonStore;
@@ -1842,7 +1871,9 @@ class TC_GAME_API ObjectMgr
         GameObjectLocaleContainer _gameObjectLocaleStore;
         DestructibleHitpointContainer _destructibleHitpointStore;
         GameObjectTemplateContainer _gameObjectTemplateStore;
+        Trinity::Containers::DenseIndex<GameObjectTemplate const> _gameObjectTemplateIndex;
         GameObjectTemplateAddonContainer _gameObjectTemplateAddonStore;
+        Trinity::Containers::DenseIndex<GameObjectTemplateAddon const> _gameObjectTemplateAddonIndex;
         GameObjectOverrideContainer _gameObjectOverrideStore;
         SpawnGroupDataContainer _spawnGroupDataStore;
         std::unordered_map<uint32, std::vector<uint32>> _spawnGroupsByMap;
@@ -1856,6 +1887,7 @@ class TC_GAME_API ObjectMgr
         std::unordered_map<int32 /*choiceId*/, PlayerChoice> _playerChoices;
 
         ItemTemplateContainer _itemTemplateStore;
+        Trinity::Containers::DenseIndex<ItemTemplate const> _itemTemplateIndex;
         QuestTemplateLocaleContainer _questTemplateLocaleStore;
         QuestObjectivesLocaleContainer _questObjectivesLocaleStore;
         QuestOfferRewardLocaleContainer _questOfferRewardLocaleStore;
@@ -1887,6 +1919,12 @@ class TC_GAME_API ObjectMgr
 
         std::set<uint32> _transportMaps; // Helper container storing map ids that are for transports only, loaded from gameobject_template
         VehicleSeatAddonContainer _vehicleSeatAddonStore;
+
+        struct ExpiredMails;
+        static bool ReturnOrDeleteExpiredMails(ExpiredMails& expiredMails, bool serverUp, uint32 limit);
+
+        QueryCallbackProcessor _queryProcessor;
+        std::unique_ptr<ExpiredMails> _expiredMails;        // set while a ReturnOrDeleteOldMails(true) is in progress
 };
 
 #define sObjectMgr ObjectMgr::instance()
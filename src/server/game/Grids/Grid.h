@@ -32,6 +32,7 @@
 #include "Define.h"
 #include "Errors.h"
 #include "TypeContainerVisitor.h"
+#include <atomic>
 
 template
 <
@@ -116,9 +117,15 @@ class Grid
             return i_container.template Size<T>();
         }
 
+        /** Changes whenever a unit enters the grid or moves inside it, for searches that reuse their results while it stays the same
+         */
+        uint32 GetUnitMoveCounter() const { return i_unitMoveCounter.load(std::memory_order_relaxed); }
+        void IncreaseUnitMoveCounter() { i_unitMoveCounter.fetch_add(1, std::memory_order_relaxed); }
+
     private:
         GRID_OBJECT_CONTAINER i_container;
         WORLD_OBJECT_CONTAINER i_objects;
+        std::atomic<uint32> i_unitMoveCounter = 0;
 };
 
 #endif
@@ -18,14 +18,106 @@
 #ifndef _GRIDREFMANAGER
 #define _GRIDREFMANAGER
 
+#include "Define.h"
 #include "RefManager.h"
+#include <boost/container/small_vector.hpp>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 template<class OBJECT>
 class GridReference;
 
+/*
+ * Contiguous copy of object positions of a single cell container.
+ * Lets searchers reject objects by distance without dereferencing them,
+ * the object itself is only touched when its cached position is in range.
+ */
+template<class OBJECT>
+struct GridPositionCache
+{
+    std::vector<float> X;
+    std::vector<float> Y;
+    std::vector<OBJECT*> Objects;
+    std::vector<uint8> InRange;
+    bool Valid = false;
+};
+
 template<class OBJECT>
 class GridRefManager : public RefManager<GridReference<OBJECT>>
 {
+public:
+    // Must be called whenever an object in this container changes position without leaving it
+    void InvalidatePositionCache()
+    {
+        if (_positionCache)
+            _positionCache->Valid = false;
+    }
+
+    // Calls worker for every object whose 2d distance to x,y is at most radius, in container order
+    // Iteration stops early if worker returns false
+    template<typename Worker>
+    void VisitInCircle(float x, float y, float radius, Worker&& worker)
+    {
+        if (!_positionCache)
+            _positionCache = std::make_unique<GridPositionCache<OBJECT>>();
+
+        GridPositionCache<OBJECT>& cache = *_positionCache;
+        if (!cache.Valid)
+            RebuildPositionCache(cache);
+
+        std::size_t count = cache.Objects.size();
+        float radiusSq = radius * radius;
+        float const* __restrict xs = cache.X.data();
+        float const* __restrict ys = cache.Y.data();
+        uint8* __restrict inRange = cache.InRange.data();
+
+        // branchless so that the compiler can vectorize it
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float dx = xs[i] - x;
+            float dy = ys[i] - y;
+            inRange[i] = (dx * dx + dy * dy) <= radiusSq;
+        }
+
+        // worker is allowed to modify this container, collect candidates before calling it
+        boost::container::small_vector<OBJECT*, 16> candidates;
+        for (std::size_t i = 0; i < count; ++i)
+            if (inRange[i])
+                candidates.push_back(cache.Objects[i]);
+
+        for (OBJECT* object : candidates)
+        {
+            if constexpr (std::is_same_v<std::invoke_result_t<Worker&, OBJECT*>, bool>)
+            {
+                if (!worker(object))
+                    return;
+            }
+            else
+                worker(object);
+        }
+    }
+
+private:
+    void RebuildPositionCache(GridPositionCache<OBJECT>& cache)
+    {
+        cache.X.clear();
+        cache.Y.clear();
+        cache.Objects.clear();
+
+        for (GridReference<OBJECT>& ref : *this)
+        {
+            OBJECT* object = ref.GetSource();
+            cache.X.push_back(object->GetPositionX());
+            cache.Y.push_back(object->GetPositionY());
+            cache.Objects.push_back(object);
+        }
+
+        cache.InRange.resize(cache.Objects.size());
+        cache.Valid = true;
+    }
+
+    std::unique_ptr<GridPositionCache<OBJECT>> _positionCache;
 };
 
 template <typename ObjectType>
@@ -33,16 +33,21 @@ class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT, GridRefer
             // called from link()
             this->getTarget()->push_front(this);
             this->getTarget()->incSize();
+            this->getTarget()->InvalidatePositionCache();
         }
         void targetObjectDestroyLink()
         {
             // called from unlink()
             if (this->isValid())
+            {
                 this->getTarget()->decSize();
+                this->getTarget()->InvalidatePositionCache();
+            }
         }
         void sourceObjectDestroyLink()
         {
             // called from invalidate()
+            // only happens when the container itself is destroyed, position cache is already gone
             this->getTarget()->decSize();
         }
     public:
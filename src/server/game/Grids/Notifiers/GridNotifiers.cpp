@@ -22,16 +22,37 @@
 #include "ObjectAccessor.h"
 #include "Transport.h"
 #include "UpdateData.h"
+#include "World.h"
 #include "WorldPacket.h"
 
 using namespace Trinity;
 
-VisibleNotifier::VisibleNotifier(Player& player): i_player(player), i_data(player.GetMapId()), vis_guids(player.m_clientGUIDs)
+VisibleNotifier::VisibleNotifier(Player& player, IncrementalVisibilityScan const* incremental /*= nullptr*/) : i_player(player), i_data(player.GetMapId()),
+    vis_guids(incremental ? GuidFlatSet() : player.m_clientGUIDs), i_incremental(incremental), i_skipped(0), i_mismatches(0)
 {
 }
 
 VisibleNotifier::~VisibleNotifier() = default;
 
+bool VisibleNotifier::IsUnchangedByRelocation(WorldObject const* target)
+{
+    if (!i_incremental)
+        return false;
+
+    // stealth detection and per object sight ranges depend on distance in ways the band check can't cover
+    if (target->m_stealth.GetFlags() || target->IsVisibilityOverridden())
+        return false;
+
+    if (i_incremental->ViewPoint->GetExactDist2dSq(target) >= i_incremental->UnchangedRadiusSq)
+        return false;
+
+    ++i_skipped;
+    if (i_incremental->Verify && i_player.HaveAtClient(target) != i_player.CanSeeOrDetect(target, { .DistanceCheck = true }))
+        ++i_mismatches;
+
+    return true;
+}
+
 void VisibleNotifier::SendToSelf()
 {
     // at this moment i_clientGUIDs have guids that not iterate at grid level checks
@@ -123,20 +144,34 @@ void VisibleChangesNotifier::Visit(DynamicObjectMapType &m)
                     player->UpdateVisibilityOf(i_objects);
 }
 
+void Trinity::CreatureUnitRelocationCheck(Creature* c, Unit* u)
+{
+    if (!u->IsAlive() || !c->IsAlive() || c == u || u->IsInFlight())
+        return;
+
+    if (c->HasUnitState(UNIT_STATE_SIGHTLESS) || !c->IsAIEnabled())
+        return;
+
+    // visibility is only checked for units the AI can react to
+    bool const alertable = u->GetTypeId() == TYPEID_PLAYER && u->HasStealthAura();
+    if (!alertable && !c->AI()->IsInterestedInMoveInLineOfSight(u))
+        return;
+
+    if (c->CanSeeOrDetect(u, { .DistanceCheck = true }))
+        c->AI()->MoveInLineOfSight_Safe(u);
+    else if (alertable && c->CanSeeOrDetect(u, { .DistanceCheck = true, .AlertCheck = true }))
+        c->AI()->TriggerAlert(u);
+}
+
 inline void CreatureUnitRelocationWorker(Creature* c, Unit* u)
 {
     if (!u->IsAlive() || !c->IsAlive() || c == u || u->IsInFlight())
         return;
 
-    if (!c->HasUnitState(UNIT_STATE_SIGHTLESS))
-    {
-        if (c->IsAIEnabled() && c->CanSeeOrDetect(u, { .DistanceCheck = true }))
-            c->AI()->MoveInLineOfSight_Safe(u);
-        else
-            if (u->GetTypeId() == TYPEID_PLAYER && u->HasStealthAura() && c->IsAIEnabled()
-                && c->CanSeeOrDetect(u, { .DistanceCheck = true, .AlertCheck = true }))
-                c->AI()->TriggerAlert(u);
-    }
+    if (c->GetMap()->DeferAggroCheck(c, u))
+        return;
+
+    CreatureUnitRelocationCheck(c, u);
 }
 
 void PlayerRelocationNotifier::Visit(PlayerMapType &m)
@@ -145,9 +180,12 @@ void PlayerRelocationNotifier::Visit(PlayerMapType &m)
     {
         Player* player = iter->GetSource();
 
-        vis_guids.erase(player->GetGUID());
+        if (!IsUnchangedByRelocation(player))
+        {
+            vis_guids.erase(player->GetGUID());
 
-        i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+            i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+        }
 
         if (player->m_seer->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
             continue;
@@ -164,9 +202,12 @@ void PlayerRelocationNotifier::Visit(CreatureMapType &m)
     {
         Creature* c = iter->GetSource();
 
-        vis_guids.erase(c->GetGUID());
+        if (!IsUnchangedByRelocation(c))
+        {
+            vis_guids.erase(c->GetGUID());
 
-        i_player.UpdateVisibilityOf(c, i_data, i_visibleNow);
+            i_player.UpdateVisibilityOf(c, i_data, i_visibleNow);
+        }
 
         if (relocated_for_ai && !c->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
             CreatureUnitRelocationWorker(c, &i_player);
@@ -232,9 +273,21 @@ void DelayedUnitRelocation::Visit(PlayerMapType &m)
         if (player != viewPoint && !viewPoint->IsPositionValid())
             continue;
 
-        PlayerRelocationNotifier relocate(*player);
+        Optional<IncrementalVisibilityScan> incremental;
+        float drift = 0.0f;
+        if (player->CanScanVisibilityIncrementally(drift))
+        {
+            float unchangedRadius = player->GetSightRange() - drift;
+            incremental = IncrementalVisibilityScan{ .ViewPoint = viewPoint, .UnchangedRadiusSq = unchangedRadius * unchangedRadius,
+                .Verify = sWorld->getIntConfig(CONFIG_VISIBILITY_INCREMENTAL) == 2 };
+        }
+
+        PlayerRelocationNotifier relocate(*player, incremental ? &*incremental : nullptr);
         Cell::VisitAllObjects(viewPoint, relocate, i_radius, false);
         relocate.SendToSelf();
+
+        player->OnVisibilityScanned(!incremental);
+        i_map.RecordVisibilityScan(incremental.has_value(), relocate.i_skipped, relocate.i_mismatches);
     }
 }
 
@@ -287,6 +340,20 @@ void ObjectUpdater::Visit(GridRefManager<T> &m)
             iter->GetSource()->Update(i_timeDiff);
 }
 
+void ObjectUpdater::Visit(CreatureMapType &m)
+{
+    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Creature* creature = iter->GetSource();
+        if (!creature->IsInWorld())
+            continue;
+
+        uint32 diff = i_timeDiff;
+        if (creature->ConsumeUpdateDiff(diff, i_reducedRateInterval))
+            creature->Update(diff);
+    }
+}
+
 bool AnyDeadUnitObjectInRangeCheck::operator()(Player* u)
 {
     return !u->IsAlive() && !u->HasAuraType(SPELL_AURA_GHOST) && i_searchObj->IsWithinDistInMap(u, i_range);
@@ -317,7 +384,6 @@ bool AnyDeadUnitSpellTargetInRangeCheck::operator()(Creature* u)
     return AnyDeadUnitObjectInRangeCheck::operator()(u) && WorldObjectSpellTargetCheck::operator()(u);
 }
 
-template void ObjectUpdater::Visit<Creature>(CreatureMapType&);
 template void ObjectUpdater::Visit<GameObject>(GameObjectMapType&);
 template void ObjectUpdater::Visit<DynamicObject>(DynamicObjectMapType&);
 template void ObjectUpdater::Visit<AreaTrigger>(AreaTriggerMapType &);
@@ -45,16 +45,31 @@ namespace Trinity
     template<> struct GridMapTypeMaskForType<SceneObject> : std::integral_constant<GridMapTypeMask, GRID_MAP_TYPE_MASK_SCENEOBJECT> { };
     template<> struct GridMapTypeMaskForType<Conversation> : std::integral_constant<GridMapTypeMask, GRID_MAP_TYPE_MASK_CONVERSATION> { };
 
+    // Scan parameters for relocations that don't need every object in range re-evaluated (Visibility.Incremental)
+    struct IncrementalVisibilityScan
+    {
+        WorldObject const* ViewPoint;
+        float UnchangedRadiusSq;    // objects closer than this were inside sight range since the last full rescan
+        bool Verify;                // still evaluate skipped objects and count disagreements with client state
+    };
+
+    // Lets c react to u moving around it (MoveInLineOfSight or a stealth alert)
+    TC_GAME_API void CreatureUnitRelocationCheck(Creature* c, Unit* u);
+
     struct TC_GAME_API VisibleNotifier
     {
         Player &i_player;
         UpdateData i_data;
         std::set<WorldObject*> i_visibleNow;
-        GuidUnorderedSet vis_guids;
+        GuidFlatSet vis_guids;
+        IncrementalVisibilityScan const* i_incremental;
+        uint32 i_skipped;
+        uint32 i_mismatches;
 
-        VisibleNotifier(Player &player);
+        VisibleNotifier(Player &player, IncrementalVisibilityScan const* incremental = nullptr);
         ~VisibleNotifier();
         template<class T> void Visit(GridRefManager<T> &m);
+        bool IsUnchangedByRelocation(WorldObject const* target);
         void SendToSelf(void);
 
         VisibleNotifier(VisibleNotifier const&) = delete;
@@ -76,7 +91,7 @@ namespace Trinity
 
     struct TC_GAME_API PlayerRelocationNotifier : public VisibleNotifier
     {
-        PlayerRelocationNotifier(Player &player) : VisibleNotifier(player) { }
+        PlayerRelocationNotifier(Player &player, IncrementalVisibilityScan const* incremental = nullptr) : VisibleNotifier(player, incremental) { }
 
         template<class T> void Visit(GridRefManager<T> &m) { VisibleNotifier::Visit(m); }
         void Visit(CreatureMapType &);
@@ -238,8 +253,10 @@ namespace Trinity
     struct ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff) { }
+        uint32 i_reducedRateInterval;   // update interval of creatures nobody can observe, 0 updates every creature every tick
+        explicit ObjectUpdater(const uint32 diff, uint32 reducedRateInterval = 0) : i_timeDiff(diff), i_reducedRateInterval(reducedRateInterval) { }
         template<class T> void Visit(GridRefManager<T> &m);
+        void Visit(CreatureMapType &m);
         void Visit(PlayerMapType &) { }
         void Visit(CorpseMapType &) { }
     };
@@ -371,12 +388,25 @@ namespace Trinity
             }
         }
 
+        // Objects whose center is outside of this circle are skipped without being passed to the check.
+        // Only safe when the check itself never accepts anything outside of it
+        void SetSearchCircle(float x, float y, float radius) { i_searchCircle = { x, y, radius }; }
+
     protected:
         template<typename Container>
         WorldObjectSearcherBase(PhaseShift const& phaseShift, Container& result, Check& check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
             : Result(result), i_mapTypeMask(mapTypeMask), i_phaseShift(&phaseShift), i_check(check) { }
 
     private:
+        struct SearchCircle
+        {
+            float X;
+            float Y;
+            float Radius;
+        };
+
+        Optional<SearchCircle> i_searchCircle;
+
         template<class T>
         void VisitImpl(GridRefManager<T>&);
     };
@@ -23,12 +23,16 @@
 #include "Player.h"
 #include "UpdateData.h"
 #include "WorldSession.h"
+#include <cmath>
 
 template<class T>
 inline void Trinity::VisibleNotifier::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
+        if (IsUnchangedByRelocation(iter->GetSource()))
+            continue;
+
         vis_guids.erase(iter->GetSource()->GetGUID());
         i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
     }
@@ -37,14 +41,14 @@ inline void Trinity::VisibleNotifier::Visit(GridRefManager<T> &m)
 template<typename PacketSender>
 void Trinity::MessageDistDeliverer<PacketSender>::Visit(PlayerMapType& m) const
 {
-    for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    // cached positions reject far objects without dereferencing them
+    m.VisitInCircle(i_source->GetPositionX(), i_source->GetPositionY(), std::sqrt(i_distSq), [&](Player* target)
     {
-        Player* target = iter->GetSource();
         if (!target->InSamePhase(*i_phaseShift))
-            continue;
+            return;
 
         if ((!required3dDist ? target->GetExactDist2dSq(i_source) : target->GetExactDistSq(i_source)) > i_distSq)
-            continue;
+            return;
 
         // Send packet to all who are sharing the player's vision
         if (target->HasSharedVision())
@@ -57,20 +61,20 @@ void Trinity::MessageDistDeliverer<PacketSender>::Visit(PlayerMapType& m) const
 
         if (target->m_seer == target || target->GetVehicle())
             SendPacket(target);
-    }
+    });
 }
 
 template<typename PacketSender>
 void Trinity::MessageDistDeliverer<PacketSender>::Visit(CreatureMapType& m) const
 {
-    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    // cached positions reject far objects without dereferencing them
+    m.VisitInCircle(i_source->GetPositionX(), i_source->GetPositionY(), std::sqrt(i_distSq), [&](Creature* target)
     {
-        Creature* target = iter->GetSource();
         if (!target->InSamePhase(*i_phaseShift))
-            continue;
+            return;
 
         if ((!required3dDist ? target->GetExactDist2dSq(i_source) : target->GetExactDistSq(i_source)) > i_distSq)
-            continue;
+            return;
 
         // Send packet to all who are sharing the creature's vision
         if (target->HasSharedVision())
@@ -80,20 +84,20 @@ void Trinity::MessageDistDeliverer<PacketSender>::Visit(CreatureMapType& m) cons
                 if ((*i)->m_seer == target)
                     SendPacket(*i);
         }
-    }
+    });
 }
 
 template<typename PacketSender>
 void Trinity::MessageDistDeliverer<PacketSender>::Visit(DynamicObjectMapType& m) const
 {
-    for (DynamicObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    // cached positions reject far objects without dereferencing them
+    m.VisitInCircle(i_source->GetPositionX(), i_source->GetPositionY(), std::sqrt(i_distSq), [&](DynamicObject* target)
     {
-        DynamicObject* target = iter->GetSource();
         if (!target->InSamePhase(*i_phaseShift))
-            continue;
+            return;
 
         if ((!required3dDist ? target->GetExactDist2dSq(i_source) : target->GetExactDistSq(i_source)) > i_distSq)
-            continue;
+            return;
 
         if (Unit* caster = target->GetCaster())
         {
@@ -102,20 +106,20 @@ void Trinity::MessageDistDeliverer<PacketSender>::Visit(DynamicObjectMapType& m)
             if (player && player->m_seer == target)
                 SendPacket(player);
         }
-    }
+    });
 }
 
 template<typename PacketSender>
 void Trinity::MessageDistDelivererToHostile<PacketSender>::Visit(PlayerMapType& m) const
 {
-    for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    // cached positions reject far objects without dereferencing them
+    m.VisitInCircle(i_source->GetPositionX(), i_source->GetPositionY(), std::sqrt(i_distSq), [&](Player* target)
     {
-        Player* target = iter->GetSource();
         if (!target->InSamePhase(*i_phaseShift))
-            continue;
+            return;
 
         if (target->GetExactDist2dSq(i_source) > i_distSq)
-            continue;
+            return;
 
         // Send packet to all who are sharing the player's vision
         if (target->HasSharedVision())
@@ -128,20 +132,20 @@ void Trinity::MessageDistDelivererToHostile<PacketSender>::Visit(PlayerMapType&
 
         if (target->m_seer == target || target->GetVehicle())
             SendPacket(target);
-    }
+    });
 }
 
 template<typename PacketSender>
 void Trinity::MessageDistDelivererToHostile<PacketSender>::Visit(CreatureMapType& m) const
 {
-    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    // cached positions reject far objects without dereferencing them
+    m.VisitInCircle(i_source->GetPositionX(), i_source->GetPositionY(), std::sqrt(i_distSq), [&](Creature* target)
     {
-        Creature* target = iter->GetSource();
         if (!target->InSamePhase(*i_phaseShift))
-            continue;
+            return;
 
         if (target->GetExactDist2dSq(i_source) > i_distSq)
-            continue;
+            return;
 
         // Send packet to all who are sharing the creature's vision
         if (target->HasSharedVision())
@@ -151,20 +155,20 @@ void Trinity::MessageDistDelivererToHostile<PacketSender>::Visit(CreatureMapType
                 if ((*i)->m_seer == target)
                     SendPacket(*i);
         }
-    }
+    });
 }
 
 template<typename PacketSender>
 void Trinity::MessageDistDelivererToHostile<PacketSender>::Visit(DynamicObjectMapType& m) const
 {
-    for (DynamicObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    // cached positions reject far objects without dereferencing them
+    m.VisitInCircle(i_source->GetPositionX(), i_source->GetPositionY(), std::sqrt(i_distSq), [&](DynamicObject* target)
     {
-        DynamicObject* target = iter->GetSource();
         if (!target->InSamePhase(*i_phaseShift))
-            continue;
+            return;
 
         if (target->GetExactDist2dSq(i_source) > i_distSq)
-            continue;
+            return;
 
         if (Unit* caster = target->GetCaster())
         {
@@ -173,7 +177,7 @@ void Trinity::MessageDistDelivererToHostile<PacketSender>::Visit(DynamicObjectMa
             if (player && player->m_seer == target)
                 SendPacket(player);
         }
-    }
+    });
 }
 
 // SEARCHERS & LIST SEARCHERS & WORKERS
@@ -187,6 +191,26 @@ inline void Trinity::WorldObjectSearcherBase<Check, Result, MapTypeMaskCheck>::V
     if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
         return;
 
+    if (i_searchCircle)
+    {
+        m.VisitInCircle(i_searchCircle->X, i_searchCircle->Y, i_searchCircle->Radius, [&](T* object)
+        {
+            if (!object->InSamePhase(*i_phaseShift))
+                return true;
+
+            if (i_check(object))
+            {
+                this->Insert(object);
+
+                if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
+                    return false;
+            }
+
+            return true;
+        });
+        return;
+    }
+
     for (GridReference<T> const& ref : m)
     {
         if (!ref.GetSource()->InSamePhase(*i_phaseShift))
@@ -101,45 +101,64 @@ void AddObjectHelper(CellCoord &cell, GridRefManager<T> &m, uint32 &count, Map*
 }
 
 template <class T>
-void LoadHelper(CellGuidSet const& guid_set, CellCoord& cell, GridRefManager<T>& m, uint32& count, Map* map, uint32 phaseId = 0, Optional<ObjectGuid> phaseOwner = {})
+void LoadSpawnHelper(ObjectGuid::LowType guid, CellCoord& cell, GridRefManager<T>& m, uint32& count, Map* map, uint32 phaseId, Optional<ObjectGuid> phaseOwner)
 {
-    for (CellGuidSet::const_iterator i_guid = guid_set.begin(); i_guid != guid_set.end(); ++i_guid)
-    {
-        // Don't spawn at all if there's a respawn timer
-        ObjectGuid::LowType guid = *i_guid;
-        if (!map->ShouldBeSpawnedOnGridLoad<T>(guid))
-            continue;
-
-        T* obj = new T;
-        //TC_LOG_INFO("misc", "DEBUG: LoadHelper from table: {} for (guid: {}) Loading", table, guid);
-        if (!obj->LoadFromDB(guid, map, false, phaseOwner.has_value() /*allowDuplicate*/))
-        {
-            delete obj;
-            continue;
-        }
+    // Don't spawn at all if there's a respawn timer
+    if (!map->ShouldBeSpawnedOnGridLoad<T>(guid))
+        return;
 
-        if (phaseOwner)
-        {
-            PhasingHandler::InitDbPersonalOwnership(obj->GetPhaseShift(), *phaseOwner);
-            map->GetMultiPersonalPhaseTracker().RegisterTrackedObject(phaseId, *phaseOwner, obj);
-        }
+    T* obj = new T;
+    //TC_LOG_INFO("misc", "DEBUG: LoadHelper from table: {} for (guid: {}) Loading", table, guid);
+    if (!obj->LoadFromDB(guid, map, false, phaseOwner.has_value() /*allowDuplicate*/))
+    {
+        delete obj;
+        return;
+    }
 
-        AddObjectHelper(cell, m, count, map, obj);
+    if (phaseOwner)
+    {
+        PhasingHandler::InitDbPersonalOwnership(obj->GetPhaseShift(), *phaseOwner);
+        map->GetMultiPersonalPhaseTracker().RegisterTrackedObject(phaseId, *phaseOwner, obj);
     }
+
+    AddObjectHelper(cell, m, count, map, obj);
+}
+
+template <class T>
+void LoadHelper(CellGuidSet const& guid_set, CellCoord& cell, GridRefManager<T>& m, uint32& count, Map* map, uint32 phaseId = 0, Optional<ObjectGuid> phaseOwner = {})
+{
+    for (ObjectGuid::LowType guid : guid_set)
+        LoadSpawnHelper(guid, cell, m, count, map, phaseId, phaseOwner);
+}
+
+// Loads the spawns of the cell from the spawns of the grid, next is left at the first spawn of the following cells
+template <class T>
+void LoadHelper(GridSpawnIdList const& gridSpawns, std::size_t& next, uint16 cellIndex, CellCoord& cell, GridRefManager<T>& m, uint32& count, Map* map)
+{
+    while (next < gridSpawns.size() && gridSpawns[next].first < cellIndex)
+        ++next;
+
+    for (; next < gridSpawns.size() && gridSpawns[next].first == cellIndex; ++next)
+        LoadSpawnHelper(gridSpawns[next].second, cell, m, count, map, 0, {});
+}
+
+uint16 ObjectGridLoader::GetCellIndex() const
+{
+    return i_cell.CellX() * MAX_NUMBER_OF_CELLS + i_cell.CellY();
 }
 
 void ObjectGridLoader::Visit(GameObjectMapType& m)
 {
     CellCoord cellCoord = i_cell.GetCellCoord();
-    if (CellObjectGuids const* cell_guids = sObjectMgr->GetCellObjectGuids(i_map->GetId(), i_map->GetDifficultyID(), cellCoord.GetId()))
-        LoadHelper(cell_guids->gameobjects, cellCoord, m, i_gameObjects, i_map);
+    if (_gridSpawns)
+        LoadHelper(_gridSpawns->gameobjects, _nextGameObject, GetCellIndex(), cellCoord, m, i_gameObjects, i_map);
 }
 
 void ObjectGridLoader::Visit(CreatureMapType &m)
 {
     CellCoord cellCoord = i_cell.GetCellCoord();
-    if (CellObjectGuids const* cell_guids = sObjectMgr->GetCellObjectGuids(i_map->GetId(), i_map->GetDifficultyID(), cellCoord.GetId()))
-        LoadHelper(cell_guids->creatures, cellCoord, m, i_creatures, i_map);
+    if (_gridSpawns)
+        LoadHelper(_gridSpawns->creatures, _nextCreature, GetCellIndex(), cellCoord, m, i_creatures, i_map);
 }
 
 void ObjectGridLoader::Visit(AreaTriggerMapType& m)
@@ -171,6 +190,9 @@ void ObjectWorldLoader::Visit(CorpseMapType& /*m*/)
 void ObjectGridLoader::LoadN(void)
 {
     i_gameObjects = 0; i_creatures = 0; i_corpses = 0;
+    _gridSpawns = sObjectMgr->GetGridSpawnIds(i_map->GetId(), i_map->GetDifficultyID(), GridCoord(i_cell.GridX(), i_cell.GridY()).GetId());
+    _nextCreature = 0;
+    _nextGameObject = 0;
     i_cell.data.Part.cell_y = 0;
     for (uint32 x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
     {
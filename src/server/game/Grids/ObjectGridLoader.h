@@ -26,6 +26,7 @@
 class MapObject;
 class ObjectGuid;
 class ObjectWorldLoader;
+struct GridSpawnIds;
 
 class TC_GAME_API ObjectGridLoaderBase
 {
@@ -57,7 +58,7 @@ class TC_GAME_API ObjectGridLoader : public ObjectGridLoaderBase
 
     public:
         ObjectGridLoader(NGridType& grid, Map* map, Cell const& cell)
-            : ObjectGridLoaderBase(grid, map, cell)
+            : ObjectGridLoaderBase(grid, map, cell), _gridSpawns(nullptr), _nextCreature(0), _nextGameObject(0)
             { }
 
         void Visit(GameObjectMapType &m);
@@ -69,6 +70,14 @@ class TC_GAME_API ObjectGridLoader : public ObjectGridLoaderBase
         void Visit(ConversationMapType&) const { }
 
         void LoadN();
+
+    private:
+        uint16 GetCellIndex() const;
+
+        // cells are visited in the order of the spawns of the grid, each list is read once front to back
+        GridSpawnIds const* _gridSpawns;
+        std::size_t _nextCreature;
+        std::size_t _nextGameObject;
 };
 
 class TC_GAME_API PersonalPhaseGridLoader : public ObjectGridLoaderBase
@@ -827,8 +827,15 @@ void Group::SendTargetIconList(WorldSession* session) const
 
 void Group::SendUpdate() const
 {
+    // every member is looked up once for the packets of all of them, not once per packet
+    std::vector<Player*> members;
+    members.reserve(m_memberSlots.size());
     for (MemberSlot const& memberSlot : m_memberSlots)
-        SendUpdateToPlayer(memberSlot.guid, &memberSlot);
+        members.push_back(ObjectAccessor::FindConnectedPlayer(memberSlot.guid));
+
+    std::size_t index = 0;
+    for (MemberSlot const& memberSlot : m_memberSlots)
+        SendUpdateToPlayer(members[index++], memberSlot, members);
 }
 
 void Group::SendUpdateToPlayer(ObjectGuid playerGUID, MemberSlot const* slot) const
@@ -849,6 +856,19 @@ void Group::SendUpdateToPlayer(ObjectGuid playerGUID, MemberSlot const* slot) co
         slot = &(*witr);
     }
 
+    std::vector<Player*> members;
+    members.reserve(m_memberSlots.size());
+    for (MemberSlot const& memberSlot : m_memberSlots)
+        members.push_back(ObjectAccessor::FindConnectedPlayer(memberSlot.guid));
+
+    SendUpdateToPlayer(player, *slot, members);
+}
+
+void Group::SendUpdateToPlayer(Player* player, MemberSlot const& slot, std::span<Player* const> members) const
+{
+    if (!player || !player->GetSession() || player->GetGroup() != this)
+        return;
+
     WorldPackets::Party::PartyUpdate partyUpdate;
 
     partyUpdate.PartyFlags = m_groupFlags;
@@ -867,10 +887,10 @@ void Group::SendUpdateToPlayer(ObjectGuid playerGUID, MemberSlot const* slot) co
     uint8 index = 0;
     for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr, ++index)
     {
-        if (slot->guid == citr->guid)
+        if (slot.guid == citr->guid)
             partyUpdate.MyIndex = index;
 
-        Player* member = ObjectAccessor::FindConnectedPlayer(citr->guid);
+        Player* member = members[index];
 
         WorldPackets::Party::PartyPlayerInfo& playerInfos = partyUpdate.PlayerList.emplace_back();
 
@@ -945,15 +965,22 @@ void Group::UpdatePlayerOutOfRange(Player const* player) const
     if (!player || !player->IsInWorld())
         return;
 
-    WorldPackets::Party::PartyMemberFullState packet;
-    packet.Initialize(player);
-    packet.Write();
-
+    // members that see the player get its state from its update fields, usually nobody needs the packet
+    Optional<WorldPackets::Party::PartyMemberFullState> packet;
     for (GroupReference const& itr : GetMembers())
     {
         Player const* member = itr.GetSource();
-        if (member != player && (!member->IsInMap(player) || !member->IsWithinDist(player, member->GetSightRange(), false)))
-            member->SendDirectMessage(packet.GetRawPacket());
+        if (member == player || (member->IsInMap(player) && member->IsWithinDist(player, member->GetSightRange(), false)))
+            continue;
+
+        if (!packet)
+        {
+            packet.emplace();
+            packet->Initialize(player);
+            packet->Write();
+        }
+
+        member->SendDirectMessage(packet->GetRawPacket());
     }
 }
 
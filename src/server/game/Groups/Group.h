@@ -28,6 +28,7 @@
 #include "Timer.h"
 #include "UniqueTrackablePtr.h"
 #include <map>
+#include <span>
 
 class Battlefield;
 class Battleground;
@@ -422,6 +423,8 @@ class TC_GAME_API Group
         void SubGroupCounterIncrease(uint8 subgroup);
         void SubGroupCounterDecrease(uint8 subgroup);
         void ToggleGroupMemberFlag(member_witerator slot, uint8 flag, bool apply);
+        // members holds the connected player of every member slot, in order, or null
+        void SendUpdateToPlayer(Player* player, MemberSlot const& slot, std::span<Player* const> members) const;
 
         MemberSlotList      m_memberSlots;
         GroupRefManager     m_memberMgr;
@@ -533,7 +533,10 @@ Guild::Member::Member(ObjectGuid::LowType guildId, ObjectGuid guid, GuildRankId
     m_totalActivity(0),
     m_weekActivity(0),
     m_totalReputation(0),
-    m_weekReputation(0)
+    m_weekReputation(0),
+    m_onlinePlayer(nullptr),
+    m_rosterLastSavePos(0),
+    m_rosterDataValid(false)
 {}
 
 void Guild::Member::SetStats(Player* player)
@@ -546,6 +549,7 @@ void Guild::Member::SetStats(Player* player)
     m_zoneId    = player->GetZoneId();
     m_accountId = player->GetSession()->GetAccountId();
     m_achievementPoints = player->GetAchievementPoints();
+    InvalidateRosterData();
 }
 
 void Guild::Member::SetStats(std::string_view name, uint8 level, uint8 race, uint8 _class, uint8 gender, uint32 zoneId, uint32 accountId, uint32 reputation)
@@ -558,6 +562,7 @@ void Guild::Member::SetStats(std::string_view name, uint8 level, uint8 race, uin
     m_zoneId    = zoneId;
     m_accountId = accountId;
     m_totalReputation = reputation;
+    InvalidateRosterData();
 }
 
 void Guild::Member::SetPublicNote(std::string_view publicNote)
@@ -566,6 +571,7 @@ void Guild::Member::SetPublicNote(std::string_view publicNote)
         return;
 
     m_publicNote = publicNote;
+    InvalidateRosterData();
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_PNOTE);
     stmt->setString(0, m_publicNote);
@@ -579,6 +585,7 @@ void Guild::Member::SetOfficerNote(std::string_view officerNote)
         return;
 
     m_officerNote = officerNote;
+    InvalidateRosterData();
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_OFFNOTE);
     stmt->setString(0, m_officerNote);
@@ -589,6 +596,7 @@ void Guild::Member::SetOfficerNote(std::string_view officerNote)
 void Guild::Member::ChangeRank(CharacterDatabaseTransaction trans, GuildRankId newRank)
 {
     m_rankId = newRank;
+    InvalidateRosterData();
 
     // Update rank information in player's field, if he is online.
     if (Player* player = FindConnectedPlayer())
@@ -726,6 +734,52 @@ void Guild::Member::ResetValues(bool weekly /* = false*/)
     }
 }
 
+std::span<uint8 const> Guild::Member::GetRosterData(bool withOfficerNote)
+{
+    if (!m_rosterDataValid)
+    {
+        WorldPackets::Guild::GuildRosterMemberData memberData;
+        memberData.Guid = m_guid;
+        memberData.RankID = int32(m_rankId);
+        memberData.AreaID = int32(m_zoneId);
+        memberData.PersonalAchievementPoints = int32(m_achievementPoints);
+        memberData.GuildReputation = int32(m_totalReputation);
+
+        //GuildRosterProfessionData
+
+        memberData.VirtualRealmAddress = GetVirtualRealmAddress();
+        memberData.Status = m_flags;
+        memberData.Level = m_level;
+        memberData.ClassID = m_class;
+        memberData.Gender = m_gender;
+        memberData.RaceID = m_race;
+        memberData.GuildClubMemberID = Battlenet::Services::Clubs::CreateClubMemberId(m_guid);
+
+        memberData.Authenticated = false;
+
+        memberData.Name = m_name;
+        memberData.Note = m_publicNote;
+
+        for (std::size_t i = 0; i < m_rosterData.size(); ++i)
+        {
+            memberData.OfficerNote = i ? std::string_view(m_officerNote) : std::string_view();
+
+            ByteBuffer data(128, ByteBuffer::Reserve{});
+            WorldPackets::Guild::WriteRosterMemberData(data, memberData, m_rosterLastSavePos);
+            m_rosterData[i].assign(data.data(), data.data() + data.size());
+        }
+
+        m_rosterDataValid = true;
+    }
+
+    // LastSave changes with time while the member is offline
+    std::vector<uint8>& rosterData = m_rosterData[withOfficerNote ? 1 : 0];
+    float lastSave = GetInactiveDays();
+    EndianConvert(lastSave);
+    std::memcpy(&rosterData[m_rosterLastSavePos], &lastSave, sizeof(lastSave));
+    return rosterData;
+}
+
 Player* Guild::Member::FindPlayer() const
 {
     return ObjectAccessor::FindPlayer(m_guid);
@@ -1337,37 +1391,11 @@ void Guild::HandleRoster(WorldSession* session)
     roster.CreateDate += session->GetTimezoneOffset();
     roster.GuildFlags = 0;
 
-    roster.MemberData.reserve(m_members.size());
+    roster.SerializedMemberData.reserve(m_members.size());
 
     bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
-    for (auto const& [guid, member] : m_members)
-    {
-        WorldPackets::Guild::GuildRosterMemberData& memberData = roster.MemberData.emplace_back();
-
-        memberData.Guid = member.GetGUID();
-        memberData.RankID = int32(member.GetRankId());
-        memberData.AreaID = int32(member.GetZoneId());
-        memberData.PersonalAchievementPoints = int32(member.GetAchievementPoints());
-        memberData.GuildReputation = int32(member.GetTotalReputation());
-        memberData.LastSave = member.GetInactiveDays();
-
-        //GuildRosterProfessionData
-
-        memberData.VirtualRealmAddress = GetVirtualRealmAddress();
-        memberData.Status = member.GetFlags();
-        memberData.Level = member.GetLevel();
-        memberData.ClassID = member.GetClass();
-        memberData.Gender = member.GetGender();
-        memberData.RaceID = member.GetRace();
-        memberData.GuildClubMemberID = Battlenet::Services::Clubs::CreateClubMemberId(member.GetGUID());
-
-        memberData.Authenticated = false;
-
-        memberData.Name = member.GetName();
-        memberData.Note = member.GetPublicNote();
-        if (sendOfficerNote)
-            memberData.OfficerNote = member.GetOfficerNote();
-    }
+    for (auto& [guid, member] : m_members)
+        roster.SerializedMemberData.push_back(member.GetRosterData(sendOfficerNote));
 
     roster.WelcomeText = m_motd;
     roster.InfoText = m_info;
@@ -2135,6 +2163,12 @@ void Guild::HandleMemberLogout(WorldSession* session)
 
     SendEventPresenceChanged(session, false, true);
     SaveToDB();
+
+    if (Member* member = GetMember(player->GetGUID()))
+    {
+        member->SetOnlinePlayer(nullptr);
+        m_onlineMembers.erase(member);
+    }
 }
 
 void Guild::HandleDelete(WorldSession* session)
@@ -2329,6 +2363,8 @@ void Guild::SendLoginInfo(WorldSession* session)
 
     member->SetStats(player);
     member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+    member->SetOnlinePlayer(player);
+    m_onlineMembers.insert(member);
 }
 
 void Guild::SendEventAwayChanged(ObjectGuid const& memberGuid, bool afk, bool dnd)
@@ -2731,8 +2767,8 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
         WorldPackets::Chat::Chat packet;
         packet.Initialize(officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
         WorldPacket const* data = packet.Write();
-        for (auto const& [guid, member] : m_members)
-            if (Player* player = member.FindConnectedPlayer())
+        for (Member const* member : m_onlineMembers)
+            if (Player* player = member->GetOnlinePlayer())
                 if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
                     !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID(), session->GetAccountGUID()))
                     player->SendDirectMessage(data);
@@ -2746,8 +2782,8 @@ void Guild::BroadcastAddonToGuild(WorldSession* session, bool officerOnly, std::
         WorldPackets::Chat::Chat packet;
         packet.Initialize(officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, isLogged ? LANG_ADDON_LOGGED : LANG_ADDON, session->GetPlayer(), nullptr, msg, 0, "", DEFAULT_LOCALE, prefix);
         WorldPacket const* data = packet.Write();
-        for (auto const& [guid, member] : m_members)
-            if (Player* player = member.FindPlayer())
+        for (Member const* member : m_onlineMembers)
+            if (Player* player = member->GetOnlinePlayer(); player && player->IsInWorld())
                 if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
                     !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID(), session->GetAccountGUID()) &&
                     player->GetSession()->IsAddonRegistered(prefix))
@@ -2757,17 +2793,15 @@ void Guild::BroadcastAddonToGuild(WorldSession* session, bool officerOnly, std::
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, GuildRankId rankId) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (member.IsRank(rankId))
-            if (Player* player = member.FindConnectedPlayer())
-                player->SendDirectMessage(packet);
+    for (Member const* member : m_onlineMembers)
+        if (member->IsRank(rankId))
+            member->GetOnlinePlayer()->SendDirectMessage(packet);
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (Player* player = member.FindConnectedPlayer())
-            player->SendDirectMessage(packet);
+    for (Member const* member : m_onlineMembers)
+        member->GetOnlinePlayer()->SendDirectMessage(packet);
 }
 
 std::vector<Player*> Guild::GetMembersTrackingCriteria(uint32 criteriaId) const
@@ -2989,6 +3023,9 @@ bool Guild::DeleteMember(CharacterDatabaseTransaction trans, ObjectGuid guid, bo
     // Call script on remove before member is actually removed from guild (and database)
     sScriptMgr->OnGuildRemoveMember(this, guid, isDisbanding, isKicked);
 
+    if (Member* member = GetMember(guid))
+        m_onlineMembers.erase(member);
+
     m_members.erase(guid);
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
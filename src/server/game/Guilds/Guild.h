@@ -27,7 +27,9 @@
 #include "SharedDefines.h"
 #include "UniqueTrackablePtr.h"
 #include <set>
+#include <span>
 #include <unordered_map>
+#include <unordered_set>
 
 class GuildAchievementMgr;
 class Item;
@@ -340,13 +342,13 @@ class TC_GAME_API Guild
 
                 void SetPublicNote(std::string_view publicNote);
                 void SetOfficerNote(std::string_view officerNote);
-                void SetZoneId(uint32 id) { m_zoneId = id; }
-                void SetAchievementPoints(uint32 val) { m_achievementPoints = val; }
-                void SetLevel(uint8 var) { m_level = var; }
+                void SetZoneId(uint32 id) { m_zoneId = id; InvalidateRosterData(); }
+                void SetAchievementPoints(uint32 val) { m_achievementPoints = val; InvalidateRosterData(); }
+                void SetLevel(uint8 var) { m_level = var; InvalidateRosterData(); }
 
-                void AddFlag(uint8 var) { m_flags |= var; }
-                void RemFlag(uint8 var) { m_flags &= ~var; }
-                void ResetFlags() { m_flags = GUILDMEMBER_STATUS_NONE; }
+                void AddFlag(uint8 var) { m_flags |= var; InvalidateRosterData(); }
+                void RemFlag(uint8 var) { m_flags &= ~var; InvalidateRosterData(); }
+                void ResetFlags() { m_flags = GUILDMEMBER_STATUS_NONE; InvalidateRosterData(); }
 
                 bool LoadFromDB(Field* fields);
                 void SaveToDB(CharacterDatabaseTransaction trans) const;
@@ -391,6 +393,14 @@ class TC_GAME_API Guild
                 Player* FindPlayer() const;
                 Player* FindConnectedPlayer() const;
 
+                // set between Guild::SendLoginInfo and Guild::HandleMemberLogout
+                Player* GetOnlinePlayer() const { return m_onlinePlayer; }
+                void SetOnlinePlayer(Player* player) { m_onlinePlayer = player; }
+
+                // SMSG_GUILD_ROSTER entry of the member, serialized again only after the member changed
+                std::span<uint8 const> GetRosterData(bool withOfficerNote);
+                void InvalidateRosterData() { m_rosterDataValid = false; }
+
             private:
                 ObjectGuid::LowType m_guildId;
                 // Fields from characters table
@@ -418,6 +428,12 @@ class TC_GAME_API Guild
                 uint64 m_weekActivity;
                 uint32 m_totalReputation;
                 uint32 m_weekReputation;
+
+                Player* m_onlinePlayer;
+
+                std::array<std::vector<uint8>, 2> m_rosterData;     // without and with officer note
+                std::size_t m_rosterLastSavePos;
+                bool m_rosterDataValid;
         };
 
     private:
@@ -892,6 +908,7 @@ class TC_GAME_API Guild
 
         std::vector<RankInfo> m_ranks;
         std::unordered_map<ObjectGuid, Member> m_members;
+        std::unordered_set<Member*> m_onlineMembers;        // members with their player logged in, for broadcasts
         std::vector<BankTab> m_bankTabs;
 
         // These are actually ordered lists. The first element is the oldest entry.
@@ -86,6 +86,22 @@ void WorldSession::HandleAuctionBrowseQuery(WorldPackets::AuctionHouse::AuctionB
         }
     }
 
+    if (sWorld->getBoolConfig(CONFIG_AUCTION_ASYNC_SEARCH))
+    {
+        AuctionBrowseQuery query;
+        query.Name = std::move(name);
+        query.MinLevel = browseQuery.MinLevel;
+        query.MaxLevel = browseQuery.MaxLevel;
+        query.Filters = browseQuery.Filters;
+        query.ClassFilters = std::move(classFilters);
+        query.KnownPetBits = std::move(browseQuery.KnownPets);
+        query.MaxKnownPetLevel = browseQuery.MaxPetLevel;
+        query.Offset = browseQuery.Offset;
+        query.Sorts.assign(browseQuery.Sorts.begin(), browseQuery.Sorts.end());
+        auctionHouse->QueueListBuckets(this, std::move(query), uint32(throttle.DelayUntilNext.count()));
+        return;
+    }
+
     auctionHouse->BuildListBuckets(listBucketsResult, _player,
         name, browseQuery.MinLevel, browseQuery.MaxLevel, browseQuery.Filters, classFilters,
         browseQuery.KnownPets, browseQuery.MaxPetLevel, browseQuery.Offset, browseQuery.Sorts);
@@ -431,6 +447,7 @@ void WorldSession::HandleAuctionPlaceBid(WorldPackets::AuctionHouse::AuctionPlac
     player->ModifyMoney(-int64(priceToPay));
     auction->Bidder = player->GetGUID();
     auction->BidAmount = placeBid.BidAmount;
+    auctionHouse->OnAuctionChanged(auction);
     if (HasPermission(rbac::RBAC_PERM_LOG_GM_TRADE))
         auction->ServerFlags |= AuctionPostingServerFlag::GmLogBuyer;
     else
@@ -34,7 +34,7 @@ void WorldSession::HandleBattlenetChangeRealmTicket(WorldPackets::Battlenet::Cha
 
 void WorldSession::HandleBattlenetRequest(WorldPackets::Battlenet::Request& request)
 {
-    sServiceDispatcher.Dispatch(this, request.Method.GetServiceHash(), request.Method.Token, request.Method.GetMethodId(), std::move(request.Data));
+    sServiceDispatcher.Dispatch(this, request.Method.GetServiceHash(), request.Method.Token, request.Method.GetMethodId(), request.Data);
 }
 
 void WorldSession::SendBattlenetResponse(uint32 serviceHash, uint32 methodId, uint32 token, pb::Message const* response)
@@ -86,3 +86,11 @@ void WorldSession::SendBattlenetRequest(uint32 serviceHash, uint32 methodId, pb:
 
     SendPacket(notification.Write());
 }
+
+RpcMessagePool* WorldSession::GetBattlenetMessagePool()
+{
+    if (!_battlenetMessagePool)
+        _battlenetMessagePool = std::make_unique<RpcMessagePool>();
+
+    return _battlenetMessagePool.get();
+}
@@ -27,6 +27,7 @@
 #include "BattlegroundPackets.h"
 #include "CalendarMgr.h"
 #include "CharacterCache.h"
+#include "CharacterEnumCache.h"
 #include "CharacterPackets.h"
 #include "Chat.h"
 #include "Common.h"
@@ -186,30 +187,6 @@ bool LoginQueryHolder::Initialize()
     stmt->setUInt64(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAILS, stmt);
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
-    stmt->setUInt64(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS, stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_ARTIFACT);
-    stmt->setUInt64(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_ARTIFACT, stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE);
-    stmt->setUInt64(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE, stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE_MILESTONE_POWER);
-    stmt->setUInt64(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_MILESTONE_POWER, stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE_UNLOCKED_ESSENCE);
-    stmt->setUInt64(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_UNLOCKED_ESSENCE, stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE_EMPOWERED);
-    stmt->setUInt64(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS_AZERITE_EMPOWERED, stmt);
-
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SOCIALLIST);
     stmt->setUInt64(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST, stmt);
@@ -396,19 +373,26 @@ public:
 
     bool IsDeletedCharacters() const { return _isDeletedCharacters; }
 
+    void SetQueried(CharacterEnumCache::TimePoint queried, bool writesPending)
+    {
+        _queried = queried;
+        _writesPending = writesPending;
+    }
+
+    CharacterEnumCache::TimePoint GetQueried() const { return _queried; }
+    bool HasWritesPending() const { return _writesPending; }
+
 private:
     bool _isDeletedCharacters = false;
+    CharacterEnumCache::TimePoint _queried;
+    bool _writesPending = true;
 };
 
 void WorldSession::HandleCharEnum(CharacterDatabaseQueryHolder const& holder)
 {
+    EnumCharactersQueryHolder const& enumHolder = static_cast<EnumCharactersQueryHolder const&>(holder);
     WorldPackets::Character::EnumCharactersResult charEnum;
-    charEnum.Success = true;
-    charEnum.IsDeletedCharacters = static_cast<EnumCharactersQueryHolder const&>(holder).IsDeletedCharacters();
-    charEnum.ClassDisableMask = sWorld->getIntConfig(CONFIG_CHARACTER_CREATING_DISABLED_CLASSMASK);
-
-    if (!charEnum.IsDeletedCharacters)
-        _legitCharacters.clear();
+    charEnum.IsDeletedCharacters = enumHolder.IsDeletedCharacters();
 
     std::unordered_map<ObjectGuid::LowType, std::vector<UF::ChrCustomizationChoice>> customizations;
     if (PreparedQueryResult customizationsResult = holder.GetPreparedResult(EnumCharactersQueryHolder::CUSTOMIZATIONS))
@@ -453,20 +437,39 @@ void WorldSession::HandleCharEnum(CharacterDatabaseQueryHolder const& holder)
                         charInfo.Flags2 = CHARACTER_FLAG_2_CUSTOMIZE;
                     }
                 }
-
-                // Do not allow locked characters to login
-                if (!(charInfo.Flags & (CHARACTER_FLAG_LOCKED_FOR_TRANSFER | CHARACTER_FLAG_LOCKED_BY_BILLING)))
-                    _legitCharacters.insert(charInfo.Guid);
             }
 
             if (!sCharacterCache->HasCharacterCacheEntry(charInfo.Guid)) // This can happen if characters are inserted into the database manually. Core hasn't loaded name data yet.
                 sCharacterCache->AddCharacterCacheEntry(charInfo.Guid, GetAccountId(), charInfo.Name, charInfo.SexID, charInfo.RaceID, charInfo.ClassID, charInfo.ExperienceLevel, false);
-
-            charEnum.MaxCharacterLevel = std::max<int32>(charEnum.MaxCharacterLevel, charInfo.ExperienceLevel);
         }
         while (result->NextRow() && charEnum.Characters.size() < MAX_CHARACTERS_PER_REALM);
     }
 
+    if (!charEnum.IsDeletedCharacters && sCharacterEnumCache->IsEnabled())
+        sCharacterEnumCache->Store(GetAccountId(), enumHolder.GetQueried(), enumHolder.HasWritesPending(), charEnum.Characters);
+
+    SendCharEnum(charEnum);
+}
+
+void WorldSession::SendCharEnum(WorldPackets::Character::EnumCharactersResult& charEnum)
+{
+    charEnum.Success = true;
+    charEnum.ClassDisableMask = sWorld->getIntConfig(CONFIG_CHARACTER_CREATING_DISABLED_CLASSMASK);
+
+    if (!charEnum.IsDeletedCharacters)
+        _legitCharacters.clear();
+
+    for (WorldPackets::Character::EnumCharactersResult::CharacterInfo const& character : charEnum.Characters)
+    {
+        WorldPackets::Character::EnumCharactersResult::CharacterInfoBasic const& charInfo = character.Basic;
+
+        // Do not allow locked characters to login
+        if (!charEnum.IsDeletedCharacters && !(charInfo.Flags & (CHARACTER_FLAG_LOCKED_FOR_TRANSFER | CHARACTER_FLAG_LOCKED_BY_BILLING)))
+            _legitCharacters.insert(charInfo.Guid);
+
+        charEnum.MaxCharacterLevel = std::max<int32>(charEnum.MaxCharacterLevel, charInfo.ExperienceLevel);
+    }
+
     for (std::pair<uint8 const, RaceUnlockRequirement> const& requirement : sObjectMgr->GetRaceUnlockRequirements())
     {
         WorldPackets::Character::EnumCharactersResult::RaceUnlock raceUnlock;
@@ -486,10 +489,22 @@ void WorldSession::HandleCharEnum(CharacterDatabaseQueryHolder const& holder)
 
 void WorldSession::HandleCharEnumOpcode(WorldPackets::Character::EnumCharacters& /*enumCharacters*/)
 {
+    // writes queued before (like the save of a character just logged out) may not be visible to the query
+    bool writesPending = CharacterDatabase.QueueSize() != 0;
+
     // remove expired bans
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
     CharacterDatabase.Execute(stmt);
 
+    if (std::shared_ptr<CharacterEnumCache::Characters const> characters = sCharacterEnumCache->Get(GetAccountId()))
+    {
+        WorldPackets::Character::EnumCharactersResult charEnum;
+        charEnum.IsDeletedCharacters = false;
+        charEnum.Characters = *characters;
+        SendCharEnum(charEnum);
+        return;
+    }
+
     /// get all the data necessary for loading all characters (along with their pets) on the account
     std::shared_ptr<EnumCharactersQueryHolder> holder = std::make_shared<EnumCharactersQueryHolder>();
     if (!holder->Initialize(GetAccountId(), sWorld->getBoolConfig(CONFIG_DECLINED_NAMES_USED), false))
@@ -498,6 +513,8 @@ void WorldSession::HandleCharEnumOpcode(WorldPackets::Character::EnumCharacters&
         return;
     }
 
+    holder->SetQueried(std::chrono::steady_clock::now(), writesPending);
+
     AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& result)
     {
         HandleCharEnum(static_cast<EnumCharactersQueryHolder const&>(result));
@@ -995,6 +1012,7 @@ void WorldSession::HandleCharCreateOpcode(WorldPackets::Character::CreateCharact
                     TC_LOG_INFO("entities.player.character", "Account: {} (IP: {}) Create Character: {} {}", GetAccountId(), GetRemoteAddress(), newChar->GetName(), newChar->GetGUID().ToString());
                     sScriptMgr->OnPlayerCreate(newChar.get());
                     sCharacterCache->AddCharacterCacheEntry(newChar->GetGUID(), GetAccountId(), newChar->GetName(), newChar->GetNativeGender(), newChar->GetRace(), newChar->GetClass(), newChar->GetLevel(), false);
+                    sCharacterEnumCache->Invalidate(GetAccountId());
 
                     SendCharCreate(CHAR_CREATE_SUCCESS, newChar->GetGUID());
                 }
@@ -2738,6 +2756,7 @@ void WorldSession::HandleReorderCharacters(WorldPackets::Character::ReorderChara
     }
 
     CharacterDatabase.CommitTransaction(trans);
+    sCharacterEnumCache->Invalidate(GetAccountId());
 }
 
 void WorldSession::HandleOpeningCinematic(WorldPackets::Misc::OpeningCinematic& /*packet*/)
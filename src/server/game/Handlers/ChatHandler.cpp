@@ -298,14 +298,8 @@ ChatMessageResult WorldSession::HandleChatMessage(ChatMsg type, Language lang, s
             }
             else
             {
+                // names are found in any spelling, invalid ones are not found
                 ExtendedPlayerName extName = ExtractExtendedPlayerName(target);
-
-                if (!normalizePlayerName(extName.Name))
-                {
-                    SendChatPlayerNotfoundNotice(target);
-                    break;
-                }
-
                 receiver = ObjectAccessor::FindConnectedPlayerByName(extName.Name);
             }
             if (!receiver || (lang != LANG_ADDON && !receiver->isAcceptWhispers() && receiver->GetSession()->HasPermission(rbac::RBAC_PERM_CAN_FILTER_WHISPERS) && !receiver->IsInWhisperWhiteList(sender->GetGUID())))
@@ -545,10 +539,6 @@ void WorldSession::HandleChatAddonMessage(ChatMsg type, std::string prefix, std:
             else
             {
                 ExtendedPlayerName extName = ExtractExtendedPlayerName(target);
-
-                if (!normalizePlayerName(extName.Name))
-                    break;
-
                 receiver = ObjectAccessor::FindConnectedPlayerByName(extName.Name);
             }
             if (!receiver)
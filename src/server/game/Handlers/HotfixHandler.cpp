@@ -19,32 +19,21 @@
 #include "GameTime.h"
 #include "HotfixPackets.h"
 #include "Log.h"
-#include "MapUtils.h"
 #include "World.h"
 
 void WorldSession::HandleDBQueryBulk(WorldPackets::Hotfix::DBQueryBulk& dbQuery)
 {
-    DB2StorageBase const* store = sDB2Manager.GetStorage(dbQuery.TableHash);
     for (WorldPackets::Hotfix::DBQueryBulk::DBQueryRecord const& record : dbQuery.Queries)
     {
         WorldPackets::Hotfix::DBReply dbReply;
         dbReply.TableHash = dbQuery.TableHash;
         dbReply.RecordID = record.RecordID;
 
-        if (store && store->HasRecord(record.RecordID))
+        if (std::shared_ptr<std::vector<uint8> const> recordData = sDB2Manager.GetSerializedRecord(dbQuery.TableHash, record.RecordID, GetSessionDbcLocale()))
         {
             dbReply.Status = DB2Manager::HotfixRecord::Status::Valid;
             dbReply.Timestamp = GameTime::GetGameTime();
-            store->WriteRecord(record.RecordID, GetSessionDbcLocale(), dbReply.Data);
-
-            if (std::vector<DB2Manager::HotfixOptionalData> const* optionalDataEntries = sDB2Manager.GetHotfixOptionalData(dbQuery.TableHash, record.RecordID, GetSessionDbcLocale()))
-            {
-                for (DB2Manager::HotfixOptionalData const& optionalData : *optionalDataEntries)
-                {
-                    dbReply.Data << uint32(optionalData.Key);
-                    dbReply.Data.append(optionalData.Data.data(), optionalData.Data.size());
-                }
-            }
+            dbReply.Data.append(recordData->data(), recordData->size());
         }
         else
         {
@@ -74,50 +63,19 @@ void WorldSession::SendAvailableHotfixes()
 
 void WorldSession::HandleHotfixRequest(WorldPackets::Hotfix::HotfixRequest& hotfixQuery)
 {
-    DB2Manager::HotfixContainer const& hotfixes = sDB2Manager.GetHotfixData();
     WorldPackets::Hotfix::HotfixConnect hotfixQueryResponse;
     hotfixQueryResponse.Hotfixes.reserve(hotfixQuery.Hotfixes.size());
     for (int32 hotfixId : hotfixQuery.Hotfixes)
     {
-        if (DB2Manager::HotfixPush const* hotfixRecords = Trinity::Containers::MapGetValuePtr(hotfixes, hotfixId))
-        {
-            for (DB2Manager::HotfixRecord const& hotfixRecord : hotfixRecords->Records)
-            {
-                if (!(hotfixRecord.AvailableLocalesMask & (1 << GetSessionDbcLocale())))
-                    continue;
-
-                WorldPackets::Hotfix::HotfixConnect::HotfixData& hotfixData = hotfixQueryResponse.Hotfixes.emplace_back();
-                hotfixData.Record = hotfixRecord;
-                if (hotfixRecord.HotfixStatus == DB2Manager::HotfixRecord::Status::Valid)
-                {
-                    DB2StorageBase const* storage = sDB2Manager.GetStorage(hotfixRecord.TableHash);
-                    if (storage && storage->HasRecord(uint32(hotfixRecord.RecordID)))
-                    {
-                        std::size_t pos = hotfixQueryResponse.HotfixContent.size();
-                        storage->WriteRecord(uint32(hotfixRecord.RecordID), GetSessionDbcLocale(), hotfixQueryResponse.HotfixContent);
+        std::shared_ptr<DB2Manager::SerializedHotfixPush const> push = sDB2Manager.GetSerializedHotfixPush(hotfixId, GetSessionDbcLocale());
+        if (!push)
+            continue;
 
-                        if (std::vector<DB2Manager::HotfixOptionalData> const* optionalDataEntries = sDB2Manager.GetHotfixOptionalData(hotfixRecord.TableHash, hotfixRecord.RecordID, GetSessionDbcLocale()))
-                        {
-                            for (DB2Manager::HotfixOptionalData const& optionalData : *optionalDataEntries)
-                            {
-                                hotfixQueryResponse.HotfixContent << uint32(optionalData.Key);
-                                hotfixQueryResponse.HotfixContent.append(optionalData.Data.data(), optionalData.Data.size());
-                            }
-                        }
+        for (DB2Manager::SerializedHotfix const& hotfix : push->Hotfixes)
+            hotfixQueryResponse.Hotfixes.push_back({ .Record = hotfix.Record, .Size = hotfix.Size });
 
-                        hotfixData.Size = hotfixQueryResponse.HotfixContent.size() - pos;
-                    }
-                    else if (std::vector<uint8> const* blobData = sDB2Manager.GetHotfixBlobData(hotfixRecord.TableHash, hotfixRecord.RecordID, GetSessionDbcLocale()))
-                    {
-                        hotfixData.Size = blobData->size();
-                        hotfixQueryResponse.HotfixContent.append(blobData->data(), blobData->size());
-                    }
-                    else
-                        // Do not send Status::Valid when we don't have a hotfix blob for current locale
-                        hotfixData.Record.HotfixStatus = storage ? DB2Manager::HotfixRecord::Status::RecordRemoved : DB2Manager::HotfixRecord::Status::Invalid;
-                }
-            }
-        }
+        if (!push->Content.empty())
+            hotfixQueryResponse.HotfixContent.append(push->Content.data(), push->Content.size());
     }
 
     SendPacket(hotfixQueryResponse.Write());
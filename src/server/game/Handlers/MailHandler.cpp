@@ -33,8 +33,61 @@
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Player.h"
+#include "QueryHolder.h"
 #include "World.h"
 
+class MailContentLoadQueryHolder : public CharacterDatabaseQueryHolder
+{
+public:
+    enum
+    {
+        BODIES,
+        ITEMS,
+        ITEMS_ARTIFACT,
+        ITEMS_AZERITE,
+        ITEMS_AZERITE_MILESTONE_POWER,
+        ITEMS_AZERITE_UNLOCKED_ESSENCE,
+        ITEMS_AZERITE_EMPOWERED,
+
+        MAX
+    };
+
+    explicit MailContentLoadQueryHolder(ObjectGuid::LowType playerGuid)
+    {
+        SetSize(MAX);
+
+        CharacterDatabasePreparedStatement* stmt;
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL_BODIES);
+        stmt->setUInt64(0, playerGuid);
+        SetPreparedQuery(BODIES, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+        stmt->setUInt64(0, playerGuid);
+        SetPreparedQuery(ITEMS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_ARTIFACT);
+        stmt->setUInt64(0, playerGuid);
+        SetPreparedQuery(ITEMS_ARTIFACT, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE);
+        stmt->setUInt64(0, playerGuid);
+        SetPreparedQuery(ITEMS_AZERITE, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE_MILESTONE_POWER);
+        stmt->setUInt64(0, playerGuid);
+        SetPreparedQuery(ITEMS_AZERITE_MILESTONE_POWER, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE_UNLOCKED_ESSENCE);
+        stmt->setUInt64(0, playerGuid);
+        SetPreparedQuery(ITEMS_AZERITE_UNLOCKED_ESSENCE, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_AZERITE_EMPOWERED);
+        stmt->setUInt64(0, playerGuid);
+        SetPreparedQuery(ITEMS_AZERITE_EMPOWERED, stmt);
+    }
+};
+
 bool WorldSession::CanOpenMailBox(ObjectGuid guid)
 {
     if (guid == _player->GetGUID())
@@ -334,7 +387,7 @@ void WorldSession::HandleSendMail(WorldPackets::Mail::SendMail& sendMail)
 //called when mail is read
 void WorldSession::HandleMailMarkAsRead(WorldPackets::Mail::MailMarkAsRead& markAsRead)
 {
-    if (!CanOpenMailBox(markAsRead.Mailbox))
+    if (!CanOpenMailBox(markAsRead.Mailbox) || !_player->IsMailContentLoaded())
         return;
 
     Player* player = _player;
@@ -352,6 +405,10 @@ void WorldSession::HandleMailMarkAsRead(WorldPackets::Mail::MailMarkAsRead& mark
 //called when client deletes mail
 void WorldSession::HandleMailDelete(WorldPackets::Mail::MailDelete& mailDelete)
 {
+    // the items of the mail are deleted with it
+    if (!_player->IsMailContentLoaded())
+        return;
+
     Mail* m = _player->GetMail(mailDelete.MailID);
     Player* player = _player;
     player->m_mailsUpdated = true;
@@ -371,7 +428,7 @@ void WorldSession::HandleMailDelete(WorldPackets::Mail::MailDelete& mailDelete)
 
 void WorldSession::HandleMailReturnToSender(WorldPackets::Mail::MailReturnToSender& returnToSender)
 {
-    if (!CanOpenMailBox(_player->PlayerTalkClass->GetInteractionData().SourceGuid))
+    if (!CanOpenMailBox(_player->PlayerTalkClass->GetInteractionData().SourceGuid) || !_player->IsMailContentLoaded())
         return;
 
     Player* player = _player;
@@ -424,7 +481,7 @@ void WorldSession::HandleMailTakeItem(WorldPackets::Mail::MailTakeItem& takeItem
 {
     uint64 AttachID = takeItem.AttachID;
 
-    if (!CanOpenMailBox(takeItem.Mailbox))
+    if (!CanOpenMailBox(takeItem.Mailbox) || !_player->IsMailContentLoaded())
         return;
 
     Player* player = _player;
@@ -520,7 +577,7 @@ void WorldSession::HandleMailTakeItem(WorldPackets::Mail::MailTakeItem& takeItem
 
 void WorldSession::HandleMailTakeMoney(WorldPackets::Mail::MailTakeMoney& takeMoney)
 {
-    if (!CanOpenMailBox(takeMoney.Mailbox))
+    if (!CanOpenMailBox(takeMoney.Mailbox) || !_player->IsMailContentLoaded())
         return;
 
     Player* player = _player;
@@ -559,6 +616,40 @@ void WorldSession::HandleGetMailList(WorldPackets::Mail::MailGetList& getList)
         return;
 
     Player* player = _player;
+    if (player->IsMailContentLoaded())
+    {
+        SendMailList(getList.Mailbox);
+        return;
+    }
+
+    // the list is sent once the bodies and items of the mails are loaded
+    if (player->m_mailContentLoading)
+        return;
+
+    player->m_mailContentLoading = true;
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(std::make_shared<MailContentLoadQueryHolder>(player->GetGUID().GetCounter())))
+        .AfterComplete([this, player, mailbox = getList.Mailbox](SQLQueryHolderBase const& holder)
+    {
+        if (GetPlayer() != player)
+            return;
+
+        player->_LoadMailContent(holder.GetPreparedResult(MailContentLoadQueryHolder::BODIES),
+            holder.GetPreparedResult(MailContentLoadQueryHolder::ITEMS),
+            holder.GetPreparedResult(MailContentLoadQueryHolder::ITEMS_ARTIFACT),
+            holder.GetPreparedResult(MailContentLoadQueryHolder::ITEMS_AZERITE),
+            holder.GetPreparedResult(MailContentLoadQueryHolder::ITEMS_AZERITE_MILESTONE_POWER),
+            holder.GetPreparedResult(MailContentLoadQueryHolder::ITEMS_AZERITE_UNLOCKED_ESSENCE),
+            holder.GetPreparedResult(MailContentLoadQueryHolder::ITEMS_AZERITE_EMPOWERED));
+
+        // the mailbox may be out of reach by now
+        if (CanOpenMailBox(mailbox))
+            SendMailList(mailbox);
+    });
+}
+
+void WorldSession::SendMailList(ObjectGuid mailbox)
+{
+    Player* player = _player;
 
     WorldPackets::Mail::MailListResult response;
     time_t curTime = GameTime::GetGameTime();
@@ -576,7 +667,7 @@ void WorldSession::HandleGetMailList(WorldPackets::Mail::MailGetList& getList)
         ++response.TotalNumRecords;
     }
 
-    player->PlayerTalkClass->GetInteractionData().StartInteraction(getList.Mailbox, PlayerInteractionType::MailInfo);
+    player->PlayerTalkClass->GetInteractionData().StartInteraction(mailbox, PlayerInteractionType::MailInfo);
     SendPacket(response.Write());
 
     // recalculate m_nextMailDelivereTime and unReadMails
@@ -586,7 +677,7 @@ void WorldSession::HandleGetMailList(WorldPackets::Mail::MailGetList& getList)
 //used when player copies mail body to his inventory
 void WorldSession::HandleMailCreateTextItem(WorldPackets::Mail::MailCreateTextItem& createTextItem)
 {
-    if (!CanOpenMailBox(createTextItem.Mailbox))
+    if (!CanOpenMailBox(createTextItem.Mailbox) || !_player->IsMailContentLoaded())
         return;
 
     Player* player = _player;
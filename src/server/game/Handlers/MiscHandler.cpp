@@ -142,49 +142,43 @@ void WorldSession::HandleWhoOpcode(WorldPackets::Who::WhoRequestPkt& whoRequest)
     WorldPackets::Who::WhoResponsePkt response;
     response.Token = whoRequest.Token;
 
-    WhoListInfoVector const& whoList = sWhoListStorageMgr->GetWhoList();
-    for (WhoListPlayerInfo const& target : whoList)
+    // returns false when the response is full
+    auto addTarget = [&](WhoListPlayerInfo const& target)
     {
         // player can see member of other team only if has RBAC_PERM_TWO_SIDE_WHO_LIST
         if (target.GetTeam() != team && !HasPermission(rbac::RBAC_PERM_TWO_SIDE_WHO_LIST))
-            continue;
+            return true;
 
         // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if has RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS
         if (target.GetSecurity() > AccountTypes(gmLevelInWhoList) && !HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS))
-            continue;
+            return true;
 
         // check if target is globally visible for player
         if (_player->GetGUID() != target.GetGuid() && !target.IsVisible())
             if (AccountMgr::IsPlayerAccount(_player->GetSession()->GetSecurity()) || target.GetSecurity() > _player->GetSession()->GetSecurity())
-                continue;
+                return true;
 
         // check if target's level is in level range
         uint8 lvl = target.GetLevel();
         if (lvl < request.MinLevel || lvl > request.MaxLevel)
-            continue;
+            return true;
 
         // check if class matches classmask
         if (request.ClassFilter >= 0 && !(request.ClassFilter & (1 << target.GetClass())))
-            continue;
+            return true;
 
         // check if race matches racemask
         if (!request.RaceFilter.HasRace(target.GetRace()))
-            continue;
-
-        if (!whoRequest.Areas.empty())
-        {
-            if (std::find(whoRequest.Areas.begin(), whoRequest.Areas.end(), int32(target.GetZoneId())) == whoRequest.Areas.end())
-                continue;
-        }
+            return true;
 
         std::wstring const& wTargetName = target.GetWidePlayerName();
         if (!(wPlayerName.empty() || wTargetName.find(wPlayerName) != std::wstring::npos))
-            continue;
+            return true;
 
         std::wstring const& wTargetGuildName = target.GetWideGuildName();
 
         if (!wGuildName.empty() && wTargetGuildName.find(wGuildName) == std::wstring::npos)
-            continue;
+            return true;
 
         if (!wWords.empty())
         {
@@ -208,12 +202,12 @@ void WorldSession::HandleWhoOpcode(WorldPackets::Who::WhoRequestPkt& whoRequest)
             }
 
             if (!show)
-                continue;
+                return true;
         }
 
         WorldPackets::Who::WhoEntry whoEntry;
         if (!whoEntry.PlayerData.Initialize(target.GetGuid(), nullptr))
-            continue;
+            return true;
 
         if (!target.GetGuildGuid().IsEmpty())
         {
@@ -229,8 +223,34 @@ void WorldSession::HandleWhoOpcode(WorldPackets::Who::WhoRequestPkt& whoRequest)
 
         // 50 is maximum player count sent to client - can be overridden
         // through config, but is unstable
-        if (response.Response.Entries.size() >= sWorld->getIntConfig(CONFIG_MAX_WHO))
-            break;
+        return response.Response.Entries.size() < sWorld->getIntConfig(CONFIG_MAX_WHO);
+    };
+
+    WhoListInfoVector const& whoList = sWhoListStorageMgr->GetWhoList();
+    if (!whoRequest.Areas.empty())
+    {
+        // only the players of the requested zones are checked
+        bool full = false;
+        for (auto area = whoRequest.Areas.begin(); area != whoRequest.Areas.end() && !full; ++area)
+        {
+            if (std::find(whoRequest.Areas.begin(), area, *area) != area)
+                continue;
+
+            for (uint32 index : sWhoListStorageMgr->GetZoneWhoList(uint32(*area)))
+            {
+                if (!addTarget(whoList[index]))
+                {
+                    full = true;
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        for (WhoListPlayerInfo const& target : whoList)
+            if (!addTarget(target))
+                break;
     }
 
     SendPacket(response.Write());
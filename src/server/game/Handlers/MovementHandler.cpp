@@ -33,6 +33,7 @@
 #include "MoveSpline.h"
 #include "MovementGenerator.h"
 #include "MovementPackets.h"
+#include "MovementRelay.h"
 #include "Player.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
@@ -458,7 +459,19 @@ void WorldSession::HandleMovementOpcode(OpcodeClient opcode, MovementInfo& movem
 
     WorldPackets::Movement::MoveUpdate moveUpdate;
     moveUpdate.Status = &mover->m_movementInfo;
-    mover->SendMessageToSet(moveUpdate.Write(), _player);
+    if (MovementRelay* relay = mover->GetMap()->GetMovementRelay())
+    {
+        // heartbeats only refresh the position of an ongoing movement, observers can take them late
+        if (opcode == CMSG_MOVE_HEARTBEAT)
+            relay->Queue(mover, _player, moveUpdate.Write());
+        else
+        {
+            relay->Cancel(mover->GetGUID());
+            mover->SendMessageToSet(moveUpdate.Write(), _player);
+        }
+    }
+    else
+        mover->SendMessageToSet(moveUpdate.Write(), _player);
 
     if (plrMover)                                            // nothing is charmed, or player charmed
     {
@@ -617,6 +630,9 @@ void WorldSession::HandleMoveKnockBackAck(WorldPackets::Movement::MoveKnockBackA
     movementAck.Ack.Status.time = AdjustClientMovementTime(movementAck.Ack.Status.time);
     _player->m_movementInfo = movementAck.Ack.Status;
 
+    if (MovementRelay* relay = _player->GetMap()->GetMovementRelay())
+        relay->Cancel(_player->GetGUID());
+
     WorldPackets::Movement::MoveUpdateKnockBack updateKnockBack;
     updateKnockBack.Status = &_player->m_movementInfo;
     _player->SendMessageToSet(updateKnockBack.Write(), false);
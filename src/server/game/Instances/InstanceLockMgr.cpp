@@ -25,7 +25,12 @@
 #include "MapManager.h"
 #include "World.h"
 
-InstanceLockData::InstanceLockData() = default;
+namespace
+{
+std::shared_ptr<std::string const> const EmptyInstanceLockData = std::make_shared<std::string const>();
+}
+
+InstanceLockData::InstanceLockData() : Data(EmptyInstanceLockData) { }
 InstanceLockData::~InstanceLockData() = default;
 
 InstanceLock::InstanceLock(uint32 mapId, Difficulty difficultyId, InstanceResetTimePoint expiryTime, uint32 instanceId)
@@ -112,7 +117,7 @@ void InstanceLockMgr::Load()
             uint32 instanceId = fields[0].GetUInt32();
 
             std::shared_ptr<SharedInstanceLockData> data = std::make_shared<SharedInstanceLockData>();
-            data->Data = fields[1].GetString();
+            data->Data = std::make_shared<std::string const>(fields[1].GetString());
             data->CompletedEncountersMask = fields[2].GetUInt32();
             data->InstanceId = instanceId;
 
@@ -140,6 +145,7 @@ void InstanceLockMgr::Load()
             sMapMgr->RegisterInstanceId(instanceId);
 
             InstanceLock* instanceLock;
+            SharedInstanceLockData const* sharedData = nullptr;
             if (MapDb2Entries{ mapId, difficulty }.IsInstanceIdBound())
             {
                 auto sharedDataItr = instanceLockDataById.find(instanceId);
@@ -152,11 +158,17 @@ void InstanceLockMgr::Load()
 
                 instanceLock = new SharedInstanceLock(mapId, difficulty, expiryTime, instanceId, sharedDataItr->second);
                 _instanceLockDataById[instanceId] = sharedDataItr->second;
+                sharedData = sharedDataItr->second.get();
             }
             else
                 instanceLock = new InstanceLock(mapId, difficulty, expiryTime, instanceId);
 
-            instanceLock->GetData()->Data = fields[5].GetString();
+            // locks saved together with the instance state share its data
+            std::string data = fields[5].GetString();
+            if (sharedData && *sharedData->Data == data)
+                instanceLock->GetData()->Data = sharedData->Data;
+            else if (!data.empty())
+                instanceLock->GetData()->Data = std::make_shared<std::string const>(std::move(data));
             instanceLock->GetData()->CompletedEncountersMask = fields[6].GetUInt32();
             instanceLock->SetExtended(fields[8].GetBool());
 
@@ -275,7 +287,7 @@ InstanceLock* InstanceLockMgr::CreateInstanceLockForNewInstance(ObjectGuid const
 }
 
 InstanceLock* InstanceLockMgr::UpdateInstanceLockForPlayer(CharacterDatabaseTransaction trans, ObjectGuid const& playerGuid,
-    MapDb2Entries const& entries, InstanceLockUpdateEvent&& updateEvent)
+    MapDb2Entries const& entries, InstanceLockUpdateEvent&& updateEvent, CharacterDatabasePreparedStatement** batchedStmt /*= nullptr*/)
 {
     InstanceLock* instanceLock = FindActiveInstanceLock(playerGuid, entries, true, true);
     if (!instanceLock)
@@ -348,6 +360,12 @@ InstanceLock* InstanceLockMgr::UpdateInstanceLockForPlayer(CharacterDatabaseTran
 
     instanceLock->SetIsNew(false);
     instanceLock->GetData()->Data = std::move(updateEvent.NewData);
+    if (entries.IsInstanceIdBound())
+    {
+        std::shared_ptr<std::string const> const& sharedData = static_cast<SharedInstanceLock*>(instanceLock)->GetSharedData()->Data;
+        if (*instanceLock->GetData()->Data == *sharedData)
+            instanceLock->GetData()->Data = sharedData;
+    }
     if (updateEvent.CompletedEncounter)
     {
         instanceLock->GetData()->CompletedEncountersMask |= 1u << updateEvent.CompletedEncounter->Bit;
@@ -375,24 +393,21 @@ InstanceLock* InstanceLockMgr::UpdateInstanceLockForPlayer(CharacterDatabaseTran
             playerGuid.ToString(), updateEvent.InstanceId);
     }
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHARACTER_INSTANCE_LOCK);
-    stmt->setUInt64(0, playerGuid.GetCounter());
-    stmt->setUInt32(1, entries.MapDifficulty->MapID);
-    stmt->setUInt32(2, entries.MapDifficulty->LockID);
-    trans->Append(stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHARACTER_INSTANCE_LOCK);
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.AddPreparedStatementRow(batchedStmt ? *batchedStmt : nullptr, CHAR_REP_CHARACTER_INSTANCE_LOCK);
     stmt->setUInt64(0, playerGuid.GetCounter());
     stmt->setUInt32(1, entries.MapDifficulty->MapID);
     stmt->setUInt32(2, entries.MapDifficulty->LockID);
     stmt->setUInt32(3, instanceLock->GetInstanceId());
     stmt->setUInt8(4, entries.MapDifficulty->DifficultyID);
-    stmt->setString(5, instanceLock->GetData()->Data);
+    stmt->setString(5, *instanceLock->GetData()->Data);
     stmt->setUInt32(6, instanceLock->GetData()->CompletedEncountersMask);
     stmt->setUInt32(7, instanceLock->GetData()->EntranceWorldSafeLocId);
     stmt->setUInt64(8, uint64(std::chrono::system_clock::to_time_t(instanceLock->GetExpiryTime())));
     stmt->setUInt8(9, instanceLock->IsExtended() ? 1 : 0);
-    trans->Append(stmt);
+    if (batchedStmt)
+        *batchedStmt = stmt;
+    else
+        trans->Append(stmt);
 
     return instanceLock;
 }
@@ -422,7 +437,7 @@ void InstanceLockMgr::UpdateSharedInstanceLock(CharacterDatabaseTransaction tran
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_INSTANCE);
     stmt->setUInt32(0, sharedData->InstanceId);
-    stmt->setString(1, sharedData->Data);
+    stmt->setString(1, *sharedData->Data);
     stmt->setUInt32(2, sharedData->CompletedEncountersMask);
     stmt->setUInt32(3, sharedData->EntranceWorldSafeLocId);
     trans->Append(stmt);
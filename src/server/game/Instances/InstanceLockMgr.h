@@ -24,6 +24,8 @@
 #include "Hash.h"
 #include "ObjectGuid.h"
 #include "Optional.h"
+#include <boost/container/flat_map.hpp>
+#include <memory>
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -75,7 +77,7 @@ struct InstanceLockData
     InstanceLockData& operator=(InstanceLockData const&) = delete;
     InstanceLockData& operator=(InstanceLockData&&) = delete;
 
-    std::string Data;
+    std::shared_ptr<std::string const> Data;    // never null, shared by the locks saved with the same data
     uint32 CompletedEncountersMask = 0;
     uint32 EntranceWorldSafeLocId = 0;
 };
@@ -177,7 +179,7 @@ struct TC_GAME_API MapDb2Entries
 
 struct InstanceLockUpdateEvent
 {
-    InstanceLockUpdateEvent(uint32 instanceId, std::string newData, uint32 instanceCompletedEncountersMask, DungeonEncounterEntry const* completedEncounter,
+    InstanceLockUpdateEvent(uint32 instanceId, std::shared_ptr<std::string const> newData, uint32 instanceCompletedEncountersMask, DungeonEncounterEntry const* completedEncounter,
         Optional<uint32> entranceWorldSafeLocId) :
         InstanceId(instanceId), NewData(std::move(newData)), InstanceCompletedEncountersMask(instanceCompletedEncountersMask), CompletedEncounter(completedEncounter),
         EntranceWorldSafeLocId(entranceWorldSafeLocId) { }
@@ -189,7 +191,7 @@ struct InstanceLockUpdateEvent
     ~InstanceLockUpdateEvent();
 
     uint32 InstanceId;
-    std::string NewData;
+    std::shared_ptr<std::string const> NewData;
     uint32 InstanceCompletedEncountersMask;
     DungeonEncounterEntry const* CompletedEncounter;
     Optional<uint32> EntranceWorldSafeLocId;
@@ -246,9 +248,12 @@ public:
        @param playerGuid Guid of player who will become locked to instance
        @param entries Map.db2 + MapDifficulty.db2 data for instance
        @param updateEvent New instance lock data
+       @param batchedStmt (Optional) Multi-row statement the lock is saved with instead of appending a statement of its own to trans,
+                          the caller appends it to trans after the last player of an encounter
        @return Updated InstanceLock for player
     */
-    InstanceLock* UpdateInstanceLockForPlayer(CharacterDatabaseTransaction trans, ObjectGuid const& playerGuid, MapDb2Entries const& entries, InstanceLockUpdateEvent&& updateEvent);
+    InstanceLock* UpdateInstanceLockForPlayer(CharacterDatabaseTransaction trans, ObjectGuid const& playerGuid, MapDb2Entries const& entries, InstanceLockUpdateEvent&& updateEvent,
+        CharacterDatabasePreparedStatement** batchedStmt = nullptr);
 
     /**
        @brief Updates existing instance id based lock shared state with new completed encounter and instance state
@@ -302,7 +307,8 @@ private:
 
     ~InstanceLockMgr();
 
-    using PlayerLockMap = std::unordered_map<InstanceLockKey, std::unique_ptr<InstanceLock>>;
+    // players rarely have more than a few locks, kept in one contiguous block
+    using PlayerLockMap = boost::container::flat_map<InstanceLockKey, std::unique_ptr<InstanceLock>>;
     using LockMap = std::unordered_map<ObjectGuid, PlayerLockMap>;
 
     static InstanceLock* FindInstanceLock(LockMap const& locks, ObjectGuid const& playerGuid, MapDb2Entries const& entries);
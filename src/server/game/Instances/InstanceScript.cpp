@@ -461,6 +461,7 @@ bool InstanceScript::SetBossState(uint32 id, EncounterState state)
             }
 
             bossInfo->state = state;
+            instance->InvalidateSpawnGroupConditions();
             if (dungeonEncounter)
                 instance->UpdateInstanceLock({ dungeonEncounter, id, state });
         }
@@ -16,12 +16,14 @@
  */
 
 #include "InstanceScriptData.h"
+#include "Base64.h"
 #include "DB2Stores.h"
 #include "InstanceScript.h"
 #include "Log.h"
 #include "Map.h"
+#include "StartupCache.h"
 #include "World.h"
-#include <rapidjson/pointer.h>
+#include <algorithm>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/error/en.h>
@@ -35,8 +37,190 @@ namespace
     std::string const MoreSaveDataKey = "AdditionalData";
 }
 
+bool InstanceScriptSaveData::FromBinary(std::string_view data)
+{
+    /*
+       Expected layout (base64 encoded after BinaryPrefix)
+
+        uint8 version
+        string header
+        uint16 boss count, one uint8 EncounterState per boss
+        uint16 additional data count, per value: string key, uint8 type (0 = null, 1 = int64, 2 = double) and the value
+    */
+    if (!IsBinary(data))
+        return false;
+
+    Optional<std::vector<uint8>> bytes = Trinity::Encoding::Base64::Decode(data.substr(1));
+    if (!bytes)
+        return false;
+
+    StartupCacheReader reader(*bytes);
+    uint8 version = 0;
+    uint16 bossCount = 0;
+    uint16 valueCount = 0;
+    if (!reader.Read(version) || version != BinaryVersion)
+        return false;
+
+    if (!reader.Read(Header) || !reader.Read(bossCount))
+        return false;
+
+    BossStates.resize(bossCount);
+    if (!reader.ReadBytes(BossStates) || !reader.Read(valueCount))
+        return false;
+
+    AdditionalData.resize(valueCount);
+    for (auto& [key, value] : AdditionalData)
+    {
+        uint8 type = 0;
+        if (!reader.Read(key) || !reader.Read(type))
+            return false;
+
+        switch (type)
+        {
+            case 0:
+                value = std::monostate();
+                break;
+            case 1:
+                if (!reader.Read(value.emplace<int64>()))
+                    return false;
+                break;
+            case 2:
+                if (!reader.Read(value.emplace<double>()))
+                    return false;
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return reader.IsComplete();
+}
+
+bool InstanceScriptSaveData::FromJson(std::string_view data)
+{
+    rapidjson::Document doc;
+    if (doc.Parse(data.data(), data.length()).HasParseError() || !doc.IsObject())
+        return false;
+
+    auto headerItr = doc.FindMember(HeadersKey);
+    if (headerItr != doc.MemberEnd() && headerItr->value.IsString())
+        Header.assign(headerItr->value.GetString(), headerItr->value.GetStringLength());
+
+    auto bossStatesItr = doc.FindMember(BossStatesSaveDataKey);
+    if (bossStatesItr != doc.MemberEnd())
+    {
+        if (!bossStatesItr->value.IsArray())
+            return false;
+
+        for (rapidjson::Value const& bossState : bossStatesItr->value.GetArray())
+        {
+            if (!bossState.IsNumber())
+                return false;
+
+            BossStates.push_back(uint8(bossState.GetInt()));
+        }
+    }
+
+    auto moreDataItr = doc.FindMember(MoreSaveDataKey);
+    if (moreDataItr != doc.MemberEnd())
+    {
+        if (!moreDataItr->value.IsObject())
+            return false;
+
+        for (auto const& [key, value] : moreDataItr->value.GetObject())
+        {
+            std::pair<std::string, Value>& additionalValue = AdditionalData.emplace_back(std::string(key.GetString(), key.GetStringLength()), std::monostate());
+            if (value.IsDouble())
+                additionalValue.second = value.GetDouble();
+            else if (value.IsNumber())
+                additionalValue.second = value.GetInt64();
+            else if (!value.IsNull())
+                return false;
+        }
+    }
+
+    return true;
+}
+
+std::string InstanceScriptSaveData::ToBinary() const
+{
+    StartupCacheWriter writer;
+    writer.Write(BinaryVersion);
+    writer.Write(std::string_view(Header));
+    writer.Write(uint16(BossStates.size()));
+    writer.WriteBytes(BossStates);
+    writer.Write(uint16(AdditionalData.size()));
+    for (auto const& [key, value] : AdditionalData)
+    {
+        writer.Write(std::string_view(key));
+        writer.Write(uint8(value.index()));
+        std::visit([&]<typename T>(T v)
+        {
+            if constexpr (!std::is_same_v<T, std::monostate>)
+                writer.Write(v);
+        }, value);
+    }
+
+    return BinaryPrefix + Trinity::Encoding::Base64::Encode(writer.GetData());
+}
+
+std::string InstanceScriptSaveData::ToJson() const
+{
+    rapidjson::Document doc;
+    doc.SetObject();
+    doc.AddMember(rapidjson::StringRef(HeadersKey), rapidjson::StringRef(Header), doc.GetAllocator());
+
+    rapidjson::Value bossStates(rapidjson::kArrayType);
+    for (uint8 bossState : BossStates)
+        bossStates.PushBack(rapidjson::Value(int32(bossState)), doc.GetAllocator());
+    doc.AddMember(rapidjson::StringRef(BossStatesSaveDataKey), bossStates.Move(), doc.GetAllocator());
+
+    if (!AdditionalData.empty())
+    {
+        rapidjson::Value moreData(rapidjson::kObjectType);
+        for (auto const& [key, value] : AdditionalData)
+        {
+            std::visit([&]<typename T>(T v)
+            {
+                if constexpr (std::is_same_v<T, std::monostate>)
+                    moreData.AddMember(rapidjson::StringRef(key), rapidjson::Value(), doc.GetAllocator());
+                else
+                    moreData.AddMember(rapidjson::StringRef(key), rapidjson::Value(v), doc.GetAllocator());
+            }, value);
+        }
+
+        doc.AddMember(rapidjson::StringRef(MoreSaveDataKey), moreData.Move(), doc.GetAllocator());
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+void InstanceScriptSaveData::SetBossState(uint32 bossId, uint8 state)
+{
+    if (bossId >= BossStates.size())
+        BossStates.resize(bossId + 1, NOT_STARTED);
+
+    BossStates[bossId] = state;
+}
+
+void InstanceScriptSaveData::SetValue(std::string_view key, Value value)
+{
+    auto itr = std::ranges::find(AdditionalData, key, [](std::pair<std::string, Value> const& additionalValue) -> std::string_view { return additionalValue.first; });
+    if (itr != AdditionalData.end())
+        itr->second = value;
+    else
+        AdditionalData.emplace_back(std::string(key), value);
+}
+
 InstanceScriptDataReader::Result InstanceScriptDataReader::Load(char const* data)
 {
+    if (InstanceScriptSaveData::IsBinary(data))
+        return LoadBinary(data);
+
     /*
        Expected JSON
 
@@ -79,6 +263,51 @@ InstanceScriptDataReader::Result InstanceScriptDataReader::Load(char const* data
     return Result::Ok;
 }
 
+InstanceScriptDataReader::Result InstanceScriptDataReader::LoadBinary(std::string_view data)
+{
+    InstanceScriptSaveData saveData;
+    if (!saveData.FromBinary(data))
+    {
+        TC_LOG_ERROR("scripts.data.load", "Malformed or unsupported binary data for instance {} [{}-{} | {}-{}]",
+            GetInstanceId(), GetMapId(), GetMapName(), GetDifficultyId(), GetDifficultyName());
+        return Result::MalformedBinary;
+    }
+
+    if (saveData.Header != _instance.GetHeader())
+    {
+        TC_LOG_ERROR("scripts.data.load", "Incorrect data header for instance {} [{}-{} | {}-{}], expected \"{}\" got \"{}\"",
+            GetInstanceId(), GetMapId(), GetMapName(), GetDifficultyId(), GetDifficultyName(),
+            _instance.GetHeader(), saveData.Header);
+        return Result::UnexpectedHeader;
+    }
+
+    if (saveData.BossStates.size() > _instance.GetEncounterCount())
+    {
+        TC_LOG_ERROR("scripts.data.load", "Boss states has entry for boss with higher id ({}) than number of bosses ({}) for instance {} [{}-{} | {}-{}]",
+            saveData.BossStates.size() - 1, _instance.GetEncounterCount(), GetInstanceId(), GetMapId(), GetMapName(), GetDifficultyId(), GetDifficultyName());
+        return Result::UnknownBoss;
+    }
+
+    for (uint32 bossId = 0; bossId < saveData.BossStates.size(); ++bossId)
+        LoadBossState(bossId, saveData.BossStates[bossId]);
+
+    for (PersistentInstanceScriptValueBase* value : _instance.GetPersistentScriptValues())
+    {
+        auto valueItr = std::ranges::find(saveData.AdditionalData, std::string_view(value->GetName()),
+            [](std::pair<std::string, InstanceScriptSaveData::Value> const& additionalValue) -> std::string_view { return additionalValue.first; });
+        if (valueItr == saveData.AdditionalData.end())
+            continue;
+
+        std::visit([&]<typename T>(T v)
+        {
+            if constexpr (!std::is_same_v<T, std::monostate>)
+                value->LoadValue(v);
+        }, valueItr->second);
+    }
+
+    return Result::Ok;
+}
+
 InstanceScriptDataReader::Result InstanceScriptDataReader::ParseHeader()
 {
     auto headerItr = _doc.FindMember(HeadersKey);
@@ -134,12 +363,7 @@ InstanceScriptDataReader::Result InstanceScriptDataReader::ParseBossStates()
             return Result::BossStateIsNotAnObject;
         }
 
-        EncounterState state = EncounterState(bossState.GetInt());
-        if (state == IN_PROGRESS || state == FAIL || state == SPECIAL)
-            state = NOT_STARTED;
-
-        if (state < TO_BE_DECIDED)
-            _instance.SetBossState(bossId, state);
+        LoadBossState(bossId, bossState.GetInt());
     }
 
     return Result::Ok;
@@ -180,6 +404,15 @@ InstanceScriptDataReader::Result InstanceScriptDataReader::ParseAdditionalData()
     return Result::Ok;
 }
 
+void InstanceScriptDataReader::LoadBossState(uint32 bossId, int32 state)
+{
+    if (state == IN_PROGRESS || state == FAIL || state == SPECIAL)
+        state = NOT_STARTED;
+
+    if (state >= NOT_STARTED && state < TO_BE_DECIDED)
+        _instance.SetBossState(bossId, EncounterState(state));
+}
+
 uint32 InstanceScriptDataReader::GetInstanceId() const { return _instance.instance->GetInstanceId(); }
 uint32 InstanceScriptDataReader::GetMapId() const { return _instance.instance->GetId(); }
 char const* InstanceScriptDataReader::GetMapName() const { return _instance.instance->GetMapName(); }
@@ -188,83 +421,47 @@ char const* InstanceScriptDataReader::GetDifficultyName() const { return sDiffic
 
 std::string InstanceScriptDataWriter::GetString()
 {
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    _doc.Accept(writer);
-
-    return std::string(buffer.GetString(), buffer.GetSize());
+    return sWorld->getBoolConfig(CONFIG_INSTANCE_BINARY_SAVE_DATA) ? _data.ToBinary() : _data.ToJson();
 }
 
 void InstanceScriptDataWriter::FillData(bool withValues)
 {
-    _doc.SetObject();
-    _doc.AddMember(rapidjson::StringRef(HeadersKey), _instance.GetHeader(), _doc.GetAllocator());
+    _data.Header = _instance.GetHeader();
 
-    rapidjson::Value bossStates(rapidjson::kArrayType);
+    _data.BossStates.resize(_instance.GetEncounterCount());
     for (uint32 bossId = 0; bossId < _instance.GetEncounterCount(); ++bossId)
-    {
-        rapidjson::Value bossStateValue(rapidjson::kNumberType);
-        bossStateValue.SetInt(withValues ? _instance.GetBossState(bossId) : NOT_STARTED);
-        bossStates.PushBack(bossStateValue.Move(), _doc.GetAllocator());
-    }
-    _doc.AddMember(rapidjson::StringRef(BossStatesSaveDataKey), bossStates.Move(), _doc.GetAllocator());
+        _data.BossStates[bossId] = withValues ? _instance.GetBossState(bossId) : NOT_STARTED;
 
-    if (!_instance.GetPersistentScriptValues().empty())
+    _data.AdditionalData.clear();
+    for (PersistentInstanceScriptValueBase* additionalValue : _instance.GetPersistentScriptValues())
     {
-        rapidjson::Value moreData(rapidjson::kObjectType);
-        for (PersistentInstanceScriptValueBase* additionalValue : _instance.GetPersistentScriptValues())
+        if (withValues)
         {
-            if (withValues)
-            {
-                UpdateAdditionalSaveDataEvent data = additionalValue->CreateEvent();
-                std::visit([&](auto v)
-                {
-                    moreData.AddMember(rapidjson::StringRef(data.Key), rapidjson::Value(v), _doc.GetAllocator());
-                }, data.Value);
-            }
-            else
-                moreData.AddMember(rapidjson::StringRef(additionalValue->GetName()), rapidjson::Value(), _doc.GetAllocator());
+            UpdateAdditionalSaveDataEvent data = additionalValue->CreateEvent();
+            std::visit([&](auto v) { _data.AdditionalData.emplace_back(data.Key, v); }, data.Value);
         }
-
-        _doc.AddMember(rapidjson::StringRef(MoreSaveDataKey), moreData.Move(), _doc.GetAllocator());
+        else
+            _data.AdditionalData.emplace_back(additionalValue->GetName(), std::monostate());
     }
 }
 
 void InstanceScriptDataWriter::FillDataFrom(std::string const& data)
 {
-    if (_doc.Parse(data).HasParseError())
+    // data of either format is updated in place, only the changed boss state or value is replaced
+    bool loaded = InstanceScriptSaveData::IsBinary(data) ? _data.FromBinary(data) : _data.FromJson(data);
+    if (!loaded)
+    {
+        _data = InstanceScriptSaveData();
         FillData(false);
+    }
 }
 
 void InstanceScriptDataWriter::SetBossState(UpdateBossStateSaveDataEvent const& data)
 {
-    std::string bossIdKey = Trinity::StringFormat("{}", data.BossId);
-
-    rapidjson::Pointer::Token tokens[] =
-    {
-        { BossStatesSaveDataKey.c_str(), uint32(BossStatesSaveDataKey.length()), rapidjson::kPointerInvalidIndex },
-        { bossIdKey.c_str(), uint32(bossIdKey.length()), rapidjson::kPointerInvalidIndex }
-    };
-    rapidjson::Pointer ptr(tokens, std::size(tokens));
-
-    // jsonptr("/BossStates/BossId")
-    rapidjson::Value stateValue(rapidjson::kNumberType);
-    stateValue.SetInt(data.NewState);
-    rapidjson::SetValueByPointer(_doc, ptr, stateValue.Move());
+    _data.SetBossState(data.BossId, uint8(data.NewState));
 }
 
 void InstanceScriptDataWriter::SetAdditionalData(UpdateAdditionalSaveDataEvent const& data)
 {
-    rapidjson::Pointer::Token tokens[] =
-    {
-        { MoreSaveDataKey.c_str(), uint32(MoreSaveDataKey.length()), rapidjson::kPointerInvalidIndex },
-        { data.Key, uint32(strlen(data.Key)), rapidjson::kPointerInvalidIndex }
-    };
-    rapidjson::Pointer ptr(tokens, std::size(tokens));
-
-    // jsonptr("/AdditionalData/CustomValueName")
-    std::visit([&](auto v)
-    {
-        rapidjson::SetValueByPointer(_doc, ptr, v);
-    }, data.Value);
+    std::visit([&](auto v) { _data.SetValue(data.Key, v); }, data.Value);
 }
@@ -21,11 +21,46 @@
 #include "Errors.h" // rapidjson depends on WPAssert
 #include <rapidjson/document.h>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
 
 class InstanceScript;
 struct UpdateBossStateSaveDataEvent;
 struct UpdateAdditionalSaveDataEvent;
 
+/*
+ * Save data of an instance script independent of how it is stored. The JSON form is readable in the database,
+ * the binary form (BinaryPrefix followed by base64 of versioned fields) is much smaller and cheaper to update.
+ * Both are accepted wherever save data is read.
+ */
+struct TC_GAME_API InstanceScriptSaveData
+{
+    using Value = std::variant<std::monostate, int64, double>;
+
+    static constexpr char BinaryPrefix = '#';
+    static constexpr uint8 BinaryVersion = 1;
+
+    static bool IsBinary(std::string_view data) { return !data.empty() && data.front() == BinaryPrefix; }
+
+    // Both return false if data is malformed, data loaded partially must not be used
+    bool FromBinary(std::string_view data);
+    bool FromJson(std::string_view data);
+
+    std::string ToBinary() const;
+    std::string ToJson() const;
+
+    void SetBossState(uint32 bossId, uint8 state);
+    void SetValue(std::string_view key, Value value);
+
+    bool operator==(InstanceScriptSaveData const&) const = default;
+
+    std::string Header;
+    std::vector<uint8> BossStates;                          // indexes are boss ids, values are EncounterState
+    std::vector<std::pair<std::string, Value>> AdditionalData;
+};
+
 class InstanceScriptDataReader
 {
 public:
@@ -43,7 +78,8 @@ public:
         MissingBossState,
         BossStateValueIsNotANumber,
         AdditionalDataIsNotAnObject,
-        AdditionalDataUnexpectedValueType
+        AdditionalDataUnexpectedValueType,
+        MalformedBinary
     };
 
     InstanceScriptDataReader(InstanceScript& instance) : _instance(instance) { }
@@ -51,9 +87,11 @@ public:
     Result Load(char const* data);
 
 private:
+    Result LoadBinary(std::string_view data);
     Result ParseHeader();
     Result ParseBossStates();
     Result ParseAdditionalData();
+    void LoadBossState(uint32 bossId, int32 state);
 
     // logging helpers
     uint32 GetInstanceId() const;
@@ -71,6 +109,7 @@ class InstanceScriptDataWriter
 public:
     InstanceScriptDataWriter(InstanceScript& instance) : _instance(instance) { }
 
+    // Binary unless Instance.BinarySaveData is disabled
     std::string GetString();
     void FillData(bool withValues = true);
     void FillDataFrom(std::string const& data);
@@ -80,7 +119,7 @@ public:
 
 private:
     InstanceScript& _instance;
-    rapidjson::Document _doc;
+    InstanceScriptSaveData _data;
 };
 
 #endif // InstanceScriptData_h__
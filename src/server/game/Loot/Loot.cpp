@@ -873,10 +873,20 @@ bool Loot::FillLoot(uint32 lootId, LootStore const& store, Player* lootOwner, bo
 
     _itemContext = context;
 
-    items.reserve(MAX_NR_LOOT_ITEMS);
+    // Items are rolled into a buffer kept by the thread, the loot only allocates room for the items it got
+    // instead of MAX_NR_LOOT_ITEMS for every corpse, most of which drop only a few items
+    static thread_local std::vector<LootItem> rolledItems;
+    rolledItems.clear();
+    rolledItems.reserve(MAX_NR_LOOT_ITEMS);
+    rolledItems.insert(rolledItems.end(), std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    std::swap(items, rolledItems);
 
     tab->Process(*this, store.IsRatesAllowed(), lootMode, 0);    // Processing is done there, callback via Loot::AddItem()
 
+    std::swap(items, rolledItems);
+    items.assign(std::make_move_iterator(rolledItems.begin()), std::make_move_iterator(rolledItems.end()));
+    rolledItems.clear();
+
     // Setting access rights for group loot case
     Group const* group = lootOwner->GetGroup();
     if (!personal && group)
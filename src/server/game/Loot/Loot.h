@@ -27,6 +27,7 @@
 #include "ObjectGuid.h"
 #include "Optional.h"
 #include "SharedDefines.h"
+#include "SlabAllocator.h"
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -282,7 +283,8 @@ private:
     TimePoint   m_endTime;
 };
 
-struct TC_GAME_API Loot
+// Allocated from a pool, every corpse and opened chest or gathering node gets its own
+struct TC_GAME_API Loot : public Trinity::SlabAllocated<Loot>
 {
     NotNormalLootItemMap const& GetPlayerFFAItems() const { return PlayerFFAItems; }
 
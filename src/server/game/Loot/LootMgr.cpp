@@ -21,6 +21,7 @@
 #include "DatabaseEnv.h"
 #include "ItemBonusMgr.h"
 #include "ItemTemplate.h"
+#include "JobSystem.h"
 #include "Log.h"
 #include "Loot.h"
 #include "MapUtils.h"
@@ -30,6 +31,7 @@
 #include "SpellInfo.h"
 #include "SpellMgr.h"
 #include "World.h"
+#include <mutex>
 
 static constexpr Rates QualityToRate[MAX_ITEM_QUALITY] =
 {
@@ -44,18 +46,25 @@ static constexpr Rates QualityToRate[MAX_ITEM_QUALITY] =
     MAX_RATES,                                              // ITEM_QUALITY_WOW_TOKEN
 };
 
-LootStore LootTemplates_Creature("creature_loot_template",           "creature entry",                  true);
-LootStore LootTemplates_Disenchant("disenchant_loot_template",       "item disenchant id",              true);
-LootStore LootTemplates_Fishing("fishing_loot_template",             "area id",                         true);
-LootStore LootTemplates_Gameobject("gameobject_loot_template",       "gameobject entry",                true);
-LootStore LootTemplates_Item("item_loot_template",                   "item entry",                      true);
-LootStore LootTemplates_Mail("mail_loot_template",                   "mail template id",                false);
-LootStore LootTemplates_Milling("milling_loot_template",             "item entry (herb)",               true);
-LootStore LootTemplates_Pickpocketing("pickpocketing_loot_template", "creature pickpocket lootid",      true);
-LootStore LootTemplates_Prospecting("prospecting_loot_template",     "item entry (ore)",                true);
-LootStore LootTemplates_Reference("reference_loot_template",         "reference id",                    false);
-LootStore LootTemplates_Skinning("skinning_loot_template",           "creature skinning id",            true);
-LootStore LootTemplates_Spell("spell_loot_template",                 "spell id (random item creating)", false);
+LootStore LootTemplates_Creature("creature_loot_template",           "creature entry",                  true,  CONDITION_SOURCE_TYPE_CREATURE_LOOT_TEMPLATE);
+LootStore LootTemplates_Disenchant("disenchant_loot_template",       "item disenchant id",              true,  CONDITION_SOURCE_TYPE_DISENCHANT_LOOT_TEMPLATE);
+LootStore LootTemplates_Fishing("fishing_loot_template",             "area id",                         true,  CONDITION_SOURCE_TYPE_FISHING_LOOT_TEMPLATE);
+LootStore LootTemplates_Gameobject("gameobject_loot_template",       "gameobject entry",                true,  CONDITION_SOURCE_TYPE_GAMEOBJECT_LOOT_TEMPLATE);
+LootStore LootTemplates_Item("item_loot_template",                   "item entry",                      true,  CONDITION_SOURCE_TYPE_ITEM_LOOT_TEMPLATE);
+LootStore LootTemplates_Mail("mail_loot_template",                   "mail template id",                false, CONDITION_SOURCE_TYPE_MAIL_LOOT_TEMPLATE);
+LootStore LootTemplates_Milling("milling_loot_template",             "item entry (herb)",               true,  CONDITION_SOURCE_TYPE_MILLING_LOOT_TEMPLATE);
+LootStore LootTemplates_Pickpocketing("pickpocketing_loot_template", "creature pickpocket lootid",      true,  CONDITION_SOURCE_TYPE_PICKPOCKETING_LOOT_TEMPLATE);
+LootStore LootTemplates_Prospecting("prospecting_loot_template",     "item entry (ore)",                true,  CONDITION_SOURCE_TYPE_PROSPECTING_LOOT_TEMPLATE);
+LootStore LootTemplates_Reference("reference_loot_template",         "reference id",                    false, CONDITION_SOURCE_TYPE_REFERENCE_LOOT_TEMPLATE);
+LootStore LootTemplates_Skinning("skinning_loot_template",           "creature skinning id",            true,  CONDITION_SOURCE_TYPE_SKINNING_LOOT_TEMPLATE);
+LootStore LootTemplates_Spell("spell_loot_template",                 "spell id (random item creating)", false, CONDITION_SOURCE_TYPE_SPELL_LOOT_TEMPLATE);
+
+static LootStore* const AllLootStores[] =
+{
+    &LootTemplates_Creature, &LootTemplates_Disenchant, &LootTemplates_Fishing, &LootTemplates_Gameobject,
+    &LootTemplates_Item, &LootTemplates_Mail, &LootTemplates_Milling, &LootTemplates_Pickpocketing,
+    &LootTemplates_Prospecting, &LootTemplates_Reference, &LootTemplates_Skinning, &LootTemplates_Spell
+};
 
 // Selects invalid loot items to be removed from group possible entries (before rolling)
 struct LootGroupInvalidSelector
@@ -106,12 +115,25 @@ class LootTemplate::LootGroup                               // A set of loot def
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
+        std::vector<float> ExplicitlyChancedSums;           // Running total of the chances of ExplicitlyChanced
+        uint16 ExplicitlyChancedLootModes = 0xFFFF;         // Loot modes every entry of ExplicitlyChanced drops in
+        uint16 EqualChancedLootModes = 0xFFFF;              // Loot modes every entry of EqualChanced drops in
+
         // Rolls an item from the group, returns NULL if all miss their chances
         LootStoreItem const* Roll(uint16 lootMode, Player const* personalLooter = nullptr) const;
 };
 
-LootStore::LootStore(char const* name, char const* entryName, bool ratesAllowed)
-    : m_name(name), m_entryName(entryName), m_ratesAllowed(ratesAllowed)
+// Templates loaded by a background reload, waiting for the world to publish them
+struct LootStore::StagedTemplates
+{
+    std::mutex Lock;
+    std::unique_ptr<LootTemplateMap> Templates;
+    uint32 Count = 0;
+};
+
+LootStore::LootStore(char const* name, char const* entryName, bool ratesAllowed, ConditionSourceType conditionSourceType)
+    : m_name(name), m_entryName(entryName), m_ratesAllowed(ratesAllowed), m_conditionSourceType(conditionSourceType),
+    m_staged(std::make_unique<StagedTemplates>())
 {
 }
 
@@ -129,7 +151,12 @@ void LootStore::Clear()
 // Actual checks are done within LootTemplate::Verify() which is called for every template
 void LootStore::Verify() const
 {
-    for (auto const& [lootId, lootTemplate] : m_LootTemplates)
+    Verify(m_LootTemplates);
+}
+
+void LootStore::Verify(LootTemplateMap const& templates) const
+{
+    for (auto const& [lootId, lootTemplate] : templates)
         lootTemplate->Verify(*this, lootId);
 }
 
@@ -140,6 +167,16 @@ uint32 LootStore::LoadLootTable()
     // Clearing store (for reloading case)
     Clear();
 
+    uint32 count = LoadLootTable(m_LootTemplates);
+
+    Verify();                                           // Checks validity of the loot store
+
+    return count;
+}
+
+// Only reads the item templates and db2 stores, can run on any thread while those are not reloaded
+uint32 LootStore::LoadLootTable(LootTemplateMap& templates) const
+{
     //                                                    0         1     2       3              4         5        6         7         8
     QueryResult result = WorldDatabase.PQuery("SELECT Entry, ItemType, Item, Chance, QuestRequired, LootMode, GroupId, MinCount, MaxCount FROM {}", GetName());
 
@@ -171,7 +208,7 @@ uint32 LootStore::LoadLootTable()
         }
 
         // Looking for the template of the entry
-        auto [tab, isNew] = m_LootTemplates.try_emplace(entry);
+        auto [tab, isNew] = templates.try_emplace(entry);
         if (isNew)
             tab->second.reset(new LootTemplate());
 
@@ -181,11 +218,67 @@ uint32 LootStore::LoadLootTable()
     }
     while (result->NextRow());
 
-    Verify();                                           // Checks validity of the loot store
-
     return count;
 }
 
+void LootStore::ReloadInBackground()
+{
+    sWorld->GetJobSystem().Spawn([](LootStore* store) -> Trinity::Job<void>
+    {
+        store->StageTemplates();
+        co_return;
+    }(this));
+}
+
+void LootStore::StageTemplates()
+{
+    uint32 oldMSTime = getMSTime();
+
+    std::unique_ptr<LootTemplateMap> templates = std::make_unique<LootTemplateMap>();
+    uint32 count = LoadLootTable(*templates);
+    Verify(*templates);
+
+    TC_LOG_INFO("server.loading", ">> Loaded {} loot templates from `{}` in background in {} ms", count, GetName(), GetMSTimeDiffToNow(oldMSTime));
+
+    // a reload finishing after a newer one keeps the newer templates
+    std::scoped_lock lock(m_staged->Lock);
+    m_staged->Templates = std::move(templates);
+    m_staged->Count = count;
+}
+
+bool LootStore::PublishStagedTemplates()
+{
+    std::unique_ptr<LootTemplateMap> templates;
+    uint32 count;
+    {
+        std::scoped_lock lock(m_staged->Lock);
+        templates = std::move(m_staged->Templates);
+        count = m_staged->Count;
+    }
+
+    if (!templates)
+        return false;
+
+    // no map is updated, loot is generated from the templates without keeping pointers to them
+    // so the old templates can be freed right away
+    std::swap(m_LootTemplates, *templates);
+    templates.reset();
+
+    CheckLootRefs();
+    if (this == &LootTemplates_Reference)
+    {
+        for (LootStore* store : AllLootStores)
+            store->ResolveReferences();
+    }
+    else
+        ResolveReferences();
+
+    sConditionMgr->LinkLootConditions(*this);
+
+    TC_LOG_INFO("server.loading", ">> Published {} loot templates of `{}`", count, GetName());
+    return true;
+}
+
 bool LootStore::HaveQuestLootFor(uint32 loot_id) const
 {
     // scan loot for quest items
@@ -229,6 +322,12 @@ void LootStore::CheckLootRefs(LootIdSet* ref_set) const
         lootTemplate->CheckLootRefs(m_LootTemplates, ref_set);
 }
 
+void LootStore::ResolveReferences()
+{
+    for (auto const& [_, lootTemplate] : m_LootTemplates)
+        lootTemplate->ResolveReferences(LootTemplates_Reference.m_LootTemplates);
+}
+
 void LootStore::ReportUnusedIds(LootIdSet const& lootIdSet) const
 {
     // all still listed ids isn't referenced
@@ -423,14 +522,38 @@ bool LootStoreItem::IsValid(LootStore const& store, uint32 entry) const
 void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
 {
     if (item->chance != 0)
+    {
+        ExplicitlyChancedSums.push_back((!ExplicitlyChancedSums.empty() ? ExplicitlyChancedSums.back() : 0.0f) + item->chance);
+        ExplicitlyChancedLootModes &= item->lootmode;
         ExplicitlyChanced.emplace_back(item);
+    }
     else
+    {
+        EqualChancedLootModes &= item->lootmode;
         EqualChanced.emplace_back(item);
+    }
 }
 
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(uint16 lootMode, Player const* personalLooter /*= nullptr*/) const
 {
+    // No entry is filtered out, the entry taking the roll is found with a binary search of the running total of the chances
+    // (the same entry the loop below stops at, the roll is below 100 so an entry with 100% chance always takes it)
+    if (!personalLooter && (lootMode & ExplicitlyChancedLootModes) && (lootMode & EqualChancedLootModes))
+    {
+        if (!ExplicitlyChanced.empty())
+        {
+            auto itr = std::ranges::upper_bound(ExplicitlyChancedSums, rand_chance());
+            if (itr != ExplicitlyChancedSums.end())
+                return ExplicitlyChanced[std::distance(ExplicitlyChancedSums.begin(), itr)].get();
+        }
+
+        if (!EqualChanced.empty())
+            return Trinity::Containers::SelectRandomContainerElement(EqualChanced).get();
+
+        return nullptr;
+    }
+
     auto getValidLoot = [](LootStoreItemList const& items, uint16 lootMode, Player const* personalLooter)
     {
         std::vector<LootStoreItem const*> possibleLoot;
@@ -674,7 +797,7 @@ void LootTemplate::Process(Loot& loot, bool rate, uint16 lootMode, uint8 groupId
                 break;
             case LootStoreItem::Type::Reference:
             {
-                LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(item->itemid);
+                LootTemplate const* Referenced = item->reference;
                 if (!Referenced)
                     continue;                                   // Error message already printed at loading stage
 
@@ -737,7 +860,7 @@ void LootTemplate::ProcessPersonalLoot(std::unordered_map<Player*, std::unique_p
             }
             case LootStoreItem::Type::Reference:
             {
-                LootTemplate const* referenced = LootTemplates_Reference.GetLootFor(item->itemid);
+                LootTemplate const* referenced = item->reference;
                 if (!referenced)
                     continue;                                       // Error message already printed at loading stage
 
@@ -983,6 +1106,13 @@ void LootTemplate::CheckLootRefs(LootTemplateMap const& store, LootIdSet* ref_se
             group->CheckLootRefs(store, ref_set);
 }
 
+void LootTemplate::ResolveReferences(LootTemplateMap const& referenceStore)
+{
+    for (std::unique_ptr<LootStoreItem> const& item : Entries)
+        if (item->type == LootStoreItem::Type::Reference)
+            item->reference = Trinity::Containers::MapGetValuePtr(referenceStore, item->itemid);
+}
+
 bool LootTemplate::LinkConditions(ConditionId const& id, ConditionsReference reference)
 {
     if (!Entries.empty())
@@ -1455,6 +1585,9 @@ void LoadLootTemplates_Reference()
     // output error for any still listed ids (not referenced from any loot table)
     LootTemplates_Reference.ReportUnusedIds(lootIdSet);
 
+    for (LootStore* store : AllLootStores)
+        store->ResolveReferences();
+
     TC_LOG_INFO("server.loading", ">> Loaded reference loot templates in {} ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -1474,3 +1607,9 @@ void LoadLootTables()
 
     LoadLootTemplates_Reference();
 }
+
+void PublishStagedLootTemplates()
+{
+    for (LootStore* store : AllLootStores)
+        store->PublishStagedTemplates();
+}
@@ -54,11 +54,12 @@ struct TC_GAME_API LootStoreItem
     uint8 mincount;                                        // mincount for drop items
     uint8 maxcount;                                        // max drop count for the item mincount or Ref multiplicator
     ConditionsReference conditions;                        // additional loot condition
+    LootTemplate const* reference;                         // referenced template, set by LootStore::ResolveReferences
 
     // Constructor
     LootStoreItem(uint32 _itemid, Type _type, float _chance, bool _needs_quest, uint16 _lootmode, uint8 _groupid, uint8 _mincount, uint8 _maxcount)
         : itemid(_itemid), type(_type), chance(_chance), lootmode(_lootmode),
-        needs_quest(_needs_quest), groupid(_groupid), mincount(_mincount), maxcount(_maxcount)
+        needs_quest(_needs_quest), groupid(_groupid), mincount(_mincount), maxcount(_maxcount), reference(nullptr)
          { }
 
     bool Roll(bool rate) const;                             // Checks if the entry takes it's chance (at loot generation)
@@ -73,7 +74,7 @@ typedef std::set<uint32> LootIdSet;
 class TC_GAME_API LootStore
 {
     public:
-        explicit LootStore(char const* name, char const* entryName, bool ratesAllowed);
+        explicit LootStore(char const* name, char const* entryName, bool ratesAllowed, ConditionSourceType conditionSourceType);
 
         LootStore(LootStore const&) = delete;
         LootStore(LootStore&&) noexcept;
@@ -84,8 +85,15 @@ class TC_GAME_API LootStore
 
         void Verify() const;
 
+        // Loads the table into a new set of templates on a worker thread, the current templates stay in use until PublishStagedTemplates
+        void ReloadInBackground();
+        // Replaces the templates with the ones loaded by the last ReloadInBackground, must be called between map updates
+        bool PublishStagedTemplates();
+
         uint32 LoadAndCollectLootIds(LootIdSet& lootIdSet);
         void CheckLootRefs(LootIdSet* ref_set = nullptr) const; // check existence reference and remove it from ref_set
+        // Points the reference entries to the templates of LootTemplates_Reference, required every time either store was loaded
+        void ResolveReferences();
         void ReportUnusedIds(LootIdSet const& lootIdSet) const;
         void ReportNonExistingId(uint32 lootId, char const* ownerType, uint32 ownerId) const;
 
@@ -99,14 +107,23 @@ class TC_GAME_API LootStore
         char const* GetName() const { return m_name; }
         char const* GetEntryName() const { return m_entryName; }
         bool IsRatesAllowed() const { return m_ratesAllowed; }
+        ConditionSourceType GetConditionSourceType() const { return m_conditionSourceType; }
     protected:
         uint32 LoadLootTable();
         void Clear();
     private:
+        struct StagedTemplates;
+
+        uint32 LoadLootTable(LootTemplateMap& templates) const;
+        void Verify(LootTemplateMap const& templates) const;
+        void StageTemplates();
+
         LootTemplateMap m_LootTemplates;
         char const* m_name;
         char const* m_entryName;
         bool m_ratesAllowed;
+        ConditionSourceType m_conditionSourceType;
+        std::unique_ptr<StagedTemplates> m_staged;
 };
 
 class TC_GAME_API LootTemplate
@@ -142,6 +159,7 @@ class TC_GAME_API LootTemplate
         void Verify(LootStore const& store, uint32 Id) const;
         void CheckLootRefs(LootTemplateMap const& store, LootIdSet* ref_set) const;
         bool LinkConditions(ConditionId const& id, ConditionsReference reference);
+        void ResolveReferences(LootTemplateMap const& referenceStore);
 
     private:
         LootStoreItemList Entries;                          // not grouped only
@@ -185,4 +203,7 @@ TC_GAME_API void LoadLootTemplates_Reference();
 
 TC_GAME_API void LoadLootTables();
 
+// Publishes the templates reloaded in the background, called by the world between map updates
+TC_GAME_API void PublishStagedLootTemplates();
+
 #endif
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AdaptiveVisibility.h"
+#include <algorithm>
+
+AdaptiveVisibility::AdaptiveVisibility(float maxDistance) : _maxDistance(maxDistance), _distance(maxDistance), _averageTickTime(0.0f),
+    _stateTime(0), _state(State::Hold)
+{
+}
+
+bool AdaptiveVisibility::Update(uint32 diff, uint32 tickTime, uint32 zonePlayers, Thresholds const& thresholds)
+{
+    // a single slow tick (grid loading, a script) shouldn't shrink anything
+    _averageTickTime += (float(tickTime) - _averageTickTime) / 8.0f;
+
+    bool overloaded = (thresholds.TickTime && _averageTickTime > float(thresholds.TickTime))
+        || (thresholds.ZonePlayers && zonePlayers > thresholds.ZonePlayers);
+    bool relieved = (!thresholds.TickTime || _averageTickTime < float(thresholds.TickTime) * Relief)
+        && (!thresholds.ZonePlayers || float(zonePlayers) < float(thresholds.ZonePlayers) * Relief);
+
+    float minDistance = std::min(thresholds.MinDistance, _maxDistance);
+    if (_distance < minDistance)
+    {
+        // minimum raised by a config reload
+        _distance = minDistance;
+        _stateTime = 0;
+        return true;
+    }
+
+    State state = State::Hold;
+    if (overloaded && _distance > minDistance)
+        state = State::Shrink;
+    else if (relieved && _distance < _maxDistance)
+        state = State::Grow;
+
+    if (state != _state)
+    {
+        _state = state;
+        _stateTime = 0;
+    }
+    else
+        _stateTime += diff;
+
+    float range = _maxDistance - minDistance;
+    float distance = _distance;
+    switch (_state)
+    {
+        case State::Shrink:
+            if (_stateTime >= ShrinkDelay)
+                distance = std::max(minDistance, _distance - range * ShrinkStep);
+            break;
+        case State::Grow:
+            if (_stateTime >= GrowDelay)
+                distance = std::min(_maxDistance, _distance + range * GrowStep);
+            break;
+        default:
+            break;
+    }
+
+    if (distance == _distance)
+        return false;
+
+    _distance = distance;
+    _stateTime = 0;
+    return true;
+}
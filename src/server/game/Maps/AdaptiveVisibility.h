@@ -0,0 +1,72 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_ADAPTIVE_VISIBILITY_H
+#define TRINITYCORE_ADAPTIVE_VISIBILITY_H
+
+#include "Define.h"
+
+/*
+ * Lowers the visibility distance of a map while its updates are slow or a zone of it is crowded
+ * and restores it afterwards. The distance shrinks quickly once the load stayed above a threshold
+ * for a second and grows back in small steps only after the load stayed well below it for a while,
+ * so a map doesn't flip between both while the reduced distance is what keeps it below the threshold.
+ */
+class TC_GAME_API AdaptiveVisibility
+{
+public:
+    struct Thresholds
+    {
+        uint32 TickTime = 0;        // average update time in milliseconds, 0 disables
+        uint32 ZonePlayers = 0;     // players in the most crowded zone, 0 disables
+        float MinDistance = 0.0f;
+    };
+
+    // time the load must stay above or below the thresholds before the next step
+    static constexpr uint32 ShrinkDelay = 1000;
+    static constexpr uint32 GrowDelay = 5000;
+    // fractions of the difference between configured and minimum distance moved per step
+    static constexpr float ShrinkStep = 0.25f;
+    static constexpr float GrowStep = 0.125f;
+    // load must drop below this fraction of the thresholds before the distance grows again
+    static constexpr float Relief = 0.75f;
+
+    explicit AdaptiveVisibility(float maxDistance);
+
+    // returns true when the distance changed
+    bool Update(uint32 diff, uint32 tickTime, uint32 zonePlayers, Thresholds const& thresholds);
+
+    float GetDistance() const { return _distance; }
+    float GetMaxDistance() const { return _maxDistance; }
+    float GetAverageTickTime() const { return _averageTickTime; }
+
+private:
+    enum class State : uint8
+    {
+        Hold,
+        Shrink,
+        Grow
+    };
+
+    float _maxDistance;
+    float _distance;
+    float _averageTickTime;
+    uint32 _stateTime;
+    State _state;
+};
+
+#endif // TRINITYCORE_ADAPTIVE_VISIBILITY_H
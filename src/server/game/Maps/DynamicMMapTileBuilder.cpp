@@ -21,16 +21,22 @@
 #include "DeadlineTimer.h"
 #include "GameObjectModel.h"
 #include "GameTime.h"
+#include "GridDefines.h"
 #include "Hash.h"
 #include "IoContext.h"
+#include "JobSystem.h"
 #include "Log.h"
 #include "MMapDefines.h"
 #include "MMapManager.h"
 #include "Map.h"
+#include "MapReference.h"
+#include "PathCorridorCache.h"
+#include "Player.h"
 #include "VMapFactory.h"
 #include "VMapManager.h"
 #include "World.h"
 #include "advstd.h"
+#include <limits>
 #include <thread>
 
 namespace
@@ -156,12 +162,6 @@ struct TileCache
         _builderThread.join();
     }
 
-    template <typename Task>
-    auto StartTask(Task&& task)
-    {
-        return Trinity::Asio::post(_taskContext, std::forward<Task>(task));
-    }
-
 private:
     void OnCacheCleanupTimerTick(boost::system::error_code const& error)
     {
@@ -200,11 +200,18 @@ struct DynamicTileBuilder::TileId
     friend bool operator==(TileId const&, TileId const&) = default;
 };
 
+struct DynamicTileBuilder::BuildingTile
+{
+    TileId Id;
+    std::weak_ptr<AsyncTileResult> Result;
+};
+
 struct TileBuildRequest
 {
     DynamicTileBuilder::TileId Id;
     std::weak_ptr<DynamicTileBuilder::AsyncTileResult> Result;
     dtNavMesh* NavMesh;
+    PathCorridorCache* CorridorCache;
 };
 
 bool InvokeAsyncCallbackIfReady(TileBuildRequest& request)
@@ -231,6 +238,10 @@ bool InvokeAsyncCallbackIfReady(TileBuildRequest& request)
             std::memcpy(data, tileResult.data.get(), tileResult.size);
 
             request.NavMesh->addTile(data, tileResult.size, DT_TILE_FREE_DATA, tileRef, nullptr);
+
+            // the new tile is added under the ref of the old one, cached corridors would still match its polygons
+            if (request.CorridorCache)
+                request.CorridorCache->InvalidateTiles();
         }
     }
 
@@ -242,7 +253,7 @@ static constexpr auto SetAsyncCallbackReady = [](DynamicTileBuilder::AsyncTileRe
     result->IsReady.store(true, std::memory_order::release);
 };
 
-DynamicTileBuilder::DynamicTileBuilder(Map* map, dtNavMesh* navMesh) : TileBuilder(sWorld->GetDataPath(), sWorld->GetDataPath(), {}, {}, false, false, false, nullptr),
+DynamicTileBuilder::DynamicTileBuilder(Map* map, dtNavMesh* navMesh) : TileBuilder(sWorld->GetDataPath(), sWorld->GetDataPath(), {}, {}, false, false, false, false, nullptr),
     m_map(map), m_navMesh(navMesh), m_rebuildCheckTimer(1s)
 {
 }
@@ -258,17 +269,67 @@ void DynamicTileBuilder::AddTile(uint32 terrainMapId, uint32 tileX, uint32 tileY
 
 void DynamicTileBuilder::Update(Milliseconds diff)
 {
+    // swapped in first, tiles are only started again after their previous build was applied
+    m_tiles.ProcessReadyCallbacks();
+
     m_rebuildCheckTimer.Update(diff);
-    if (m_rebuildCheckTimer.Passed())
+    if (!m_rebuildCheckTimer.Passed())
+        return;
+
+    std::erase_if(m_buildingTiles, [](BuildingTile const& building)
+    {
+        std::shared_ptr<AsyncTileResult> result = building.Result.lock();
+        return !result || result->IsReady.load(std::memory_order::acquire);
+    });
+
+    // a map rebuilding many tiles at once leaves workers to the other maps and jobs
+    std::size_t maxBuilds = sWorld->GetJobSystem().GetWorkerCount();
+    if (m_buildingTiles.size() < maxBuilds && !m_tilesToRebuild.empty())
     {
-        for (TileId const& tileId : m_tilesToRebuild)
-            m_tiles.AddCallback({ .Id = tileId, .Result = BuildTile(tileId.TerrainMapId, tileId.X, tileId.Y), .NavMesh = m_navMesh });
+        PrioritizeTilesToRebuild();
+
+        for (auto itr = m_tilesToRebuild.begin(); itr != m_tilesToRebuild.end() && m_buildingTiles.size() < maxBuilds;)
+        {
+            TileId tileId = *itr;
+            if (advstd::ranges::contains(m_buildingTiles, tileId, &BuildingTile::Id))
+            {
+                ++itr;
+                continue;
+            }
+
+            std::weak_ptr<AsyncTileResult> result = BuildTile(tileId.TerrainMapId, tileId.X, tileId.Y);
+            m_buildingTiles.push_back({ .Id = tileId, .Result = result });
+            m_tiles.AddCallback({ .Id = tileId, .Result = std::move(result), .NavMesh = m_navMesh, .CorridorCache = m_map->GetPathCorridorCache() });
+            itr = m_tilesToRebuild.erase(itr);
+        }
+    }
 
-        m_tilesToRebuild.clear();
+    // queued tiles are started as soon as builds finish, new changes wait a second to be collected together
+    if (m_tilesToRebuild.empty())
         m_rebuildCheckTimer.Reset(1s);
+}
+
+void DynamicTileBuilder::PrioritizeTilesToRebuild()
+{
+    std::vector<std::pair<int32, int32>> playerTiles;
+    for (MapReference const& ref : m_map->GetPlayers())
+    {
+        GridCoord grid = Trinity::ComputeGridCoord(ref.GetSource()->GetPositionX(), ref.GetSource()->GetPositionY());
+        playerTiles.emplace_back((MAX_NUMBER_OF_GRIDS - 1) - grid.x_coord, (MAX_NUMBER_OF_GRIDS - 1) - grid.y_coord);
     }
 
-    m_tiles.ProcessReadyCallbacks();
+    if (playerTiles.empty())
+        return;
+
+    auto distanceToPlayers = [&](TileId const& tile)
+    {
+        int32 distance = std::numeric_limits<int32>::max();
+        for (auto const& [x, y] : playerTiles)
+            distance = std::min(distance, std::max(std::abs(int32(tile.X) - x), std::abs(int32(tile.Y) - y)));
+        return distance;
+    };
+
+    std::ranges::stable_sort(m_tilesToRebuild, {}, distanceToPlayers);
 }
 
 std::weak_ptr<DynamicTileBuilder::AsyncTileResult> DynamicTileBuilder::BuildTile(uint32 terrainMapId, uint32 tileX, uint32 tileY)
@@ -313,69 +374,76 @@ std::weak_ptr<DynamicTileBuilder::AsyncTileResult> DynamicTileBuilder::BuildTile
         return itr->second.Data;
 
     itr->second.Data = std::make_shared<AsyncTileResult>();
-    tileCache->StartTask([result = itr->second.Data, hash = cacheKey.CachedHash, selfRef = weak_from_this(), terrainMapId, tileX, tileY, gameObjectModelReferences = std::move(gameObjectModelReferences)]() mutable
-    {
-        auto isReadyGuard = Trinity::make_unique_ptr_with_deleter<SetAsyncCallbackReady>(result.get());
+    sWorld->GetJobSystem().Spawn(BuildTileJob(itr->second.Data, itr->first.CachedHash, weak_from_this(), terrainMapId, tileX, tileY, std::move(gameObjectModelReferences)));
 
-        std::shared_ptr<DynamicTileBuilder> self = selfRef.lock();
-        if (!self)
-            return;
+    return itr->second.Data;
+}
 
-        // get navmesh params
-        dtNavMeshParams params;
-        std::vector<OffMeshData> offMeshConnections;
-        if (MMapManager::parseNavMeshParamsFile(sWorld->GetDataPath(), terrainMapId, &params, &offMeshConnections) != LoadResult::Success)
-            return;
+Trinity::Job<void> DynamicTileBuilder::BuildTileJob(std::shared_ptr<AsyncTileResult> result, std::size_t hash, std::weak_ptr<DynamicTileBuilder> selfRef,
+    uint32 terrainMapId, uint32 tileX, uint32 tileY, std::vector<std::shared_ptr<GameObjectModel const>> gameObjectModelReferences)
+{
+    auto isReadyGuard = Trinity::make_unique_ptr_with_deleter<SetAsyncCallbackReady>(result.get());
 
-        std::unique_ptr<VMAP::VMapManager> vmapManager = CreateVMapManager(terrainMapId);
+    std::shared_ptr<DynamicTileBuilder> self = selfRef.lock();
+    if (!self)
+        co_return;
 
-        MeshData meshData;
+    Trinity::JobSystem& jobSystem = sWorld->GetJobSystem();
 
-        // get heightmap data
-        self->m_terrainBuilder.loadMap(terrainMapId, tileX, tileY, meshData, vmapManager.get());
+    // get navmesh params
+    dtNavMeshParams params;
+    std::vector<OffMeshData> offMeshConnections;
+    if (MMapManager::parseNavMeshParamsFile(sWorld->GetDataPath(), terrainMapId, &params, &offMeshConnections) != LoadResult::Success)
+        co_return;
 
-        // get model data
-        self->m_terrainBuilder.loadVMap(terrainMapId, tileX, tileY, meshData, vmapManager.get());
+    std::unique_ptr<VMAP::VMapManager> vmapManager = CreateVMapManager(terrainMapId);
 
-        for (std::shared_ptr<GameObjectModel const> const& gameObjectModel : gameObjectModelReferences)
-        {
-            G3D::Vector3 position = gameObjectModel->GetPosition();
-            position.x = -position.x;
-            position.y = -position.y;
+    MeshData meshData;
 
-            G3D::Matrix3 invRotation = (G3D::Quat(0, 0, 1, 0) * gameObjectModel->GetRotation()).toRotationMatrix().inverse();
+    // get heightmap data
+    self->m_terrainBuilder.loadMap(terrainMapId, tileX, tileY, meshData, vmapManager.get());
 
-            self->m_terrainBuilder.loadVMapModel(gameObjectModel->GetWorldModel().get(), position, invRotation, gameObjectModel->GetScale(),
-                meshData, vmapManager.get());
-        }
+    // the build is split into steps to let jobs queued meanwhile run in between
+    co_await jobSystem.Schedule();
 
-        // if there is no data, give up now
-        if (meshData.solidVerts.empty() && meshData.liquidVerts.empty())
-            return;
+    // get model data
+    self->m_terrainBuilder.loadVMap(terrainMapId, tileX, tileY, meshData, vmapManager.get());
 
-        // remove unused vertices
-        TerrainBuilder::cleanVertices(meshData.solidVerts, meshData.solidTris);
-        TerrainBuilder::cleanVertices(meshData.liquidVerts, meshData.liquidTris);
+    for (std::shared_ptr<GameObjectModel const> const& gameObjectModel : gameObjectModelReferences)
+    {
+        G3D::Vector3 position = gameObjectModel->GetPosition();
+        position.x = -position.x;
+        position.y = -position.y;
 
-        // gather all mesh data for final data check, and bounds calculation
-        std::vector<float> allVerts(meshData.liquidVerts.size() + meshData.solidVerts.size());
-        std::ranges::copy(meshData.liquidVerts, allVerts.begin());
-        std::ranges::copy(meshData.solidVerts, allVerts.begin() + std::ssize(meshData.liquidVerts));
+        G3D::Matrix3 invRotation = (G3D::Quat(0, 0, 1, 0) * gameObjectModel->GetRotation()).toRotationMatrix().inverse();
 
-        // get bounds of current tile
-        float bmin[3], bmax[3];
-        getTileBounds(tileX, tileY, allVerts.data(), allVerts.size() / 3, bmin, bmax);
+        self->m_terrainBuilder.loadVMapModel(gameObjectModel->GetWorldModel().get(), position, invRotation, gameObjectModel->GetScale(),
+            meshData, vmapManager.get());
+    }
 
-        self->m_terrainBuilder.loadOffMeshConnections(terrainMapId, tileX, tileY, meshData, offMeshConnections);
+    // if there is no data, give up now
+    if (meshData.solidVerts.empty() && meshData.liquidVerts.empty())
+        co_return;
 
-        // build navmesh tile
-        std::string debugSuffix = Trinity::StringFormat("_{:016X}", hash);
+    co_await jobSystem.Schedule();
 
-        result->Result = self->buildMoveMapTile(terrainMapId, tileX, tileY, meshData, bmin, bmax, &params);
-        if (self->m_debugOutput && result->Result.data)
-            self->saveMoveMapTileToFile(terrainMapId, tileX, tileY, nullptr, result->Result, debugSuffix);
-    });
+    // remove unused vertices
+    TerrainBuilder::cleanVertices(meshData.solidVerts, meshData.solidTris);
+    TerrainBuilder::cleanVertices(meshData.liquidVerts, meshData.liquidTris);
 
-    return itr->second.Data;
+    // get bounds of current tile
+    float bmin[3], bmax[3];
+    getTileBounds(tileX, tileY, meshData, bmin, bmax);
+
+    self->m_terrainBuilder.loadOffMeshConnections(terrainMapId, tileX, tileY, meshData, offMeshConnections);
+
+    co_await jobSystem.Schedule();
+
+    // build navmesh tile
+    std::string debugSuffix = Trinity::StringFormat("_{:016X}", hash);
+
+    result->Result = self->buildMoveMapTile(terrainMapId, tileX, tileY, meshData, bmin, bmax, &params);
+    if (self->m_debugOutput && result->Result.data)
+        self->saveMoveMapTileToFile(terrainMapId, tileX, tileY, nullptr, result->Result, debugSuffix);
 }
 }
@@ -23,8 +23,15 @@
 #include "Timer.h"
 #include <atomic>
 
+class GameObjectModel;
 class Map;
 
+namespace Trinity
+{
+template<typename T>
+class Job;
+}
+
 namespace MMAP
 {
 struct TileBuildRequest;
@@ -51,14 +58,23 @@ public:
     };
 
 private:
+    struct TileId;
+
+    // tiles closer to a player are built first, the others keep their queue order
+    void PrioritizeTilesToRebuild();
     std::weak_ptr<AsyncTileResult> BuildTile(uint32 terrainMapId, uint32 tileX, uint32 tileY);
+    static Trinity::Job<void> BuildTileJob(std::shared_ptr<AsyncTileResult> result, std::size_t hash, std::weak_ptr<DynamicTileBuilder> selfRef,
+        uint32 terrainMapId, uint32 tileX, uint32 tileY, std::vector<std::shared_ptr<GameObjectModel const>> gameObjectModelReferences);
 
     Map* m_map;
     dtNavMesh* m_navMesh;
 
-    struct TileId;
     std::vector<TileId> m_tilesToRebuild;
 
+    // builds started by this map that did not finish yet, a tile is not started again until its previous build was swapped in
+    struct BuildingTile;
+    std::vector<BuildingTile> m_buildingTiles;
+
     TimeTracker m_rebuildCheckTimer;
 
     friend TileBuildRequest;
@@ -19,8 +19,11 @@
 #include "DB2Stores.h"
 #include "GridDefines.h"
 #include "Log.h"
+#include "Position.h"
 #include <G3D/Plane.h>
 #include <G3D/Ray.h>
+#include <algorithm>
+#include <type_traits>
 
 // *****************************
 // Grid function
@@ -135,6 +138,36 @@ void GridMap::unloadData()
     _gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
+std::size_t GridMap::GetMemoryUsage() const
+{
+    std::size_t size = sizeof(GridMap);
+    if (_areaMap)
+        size += 16 * 16 * sizeof(uint16);
+
+    std::size_t heightSize = sizeof(float);
+    if (_gridGetHeight == &GridMap::getHeightFromUint16)
+        heightSize = sizeof(uint16);
+    else if (_gridGetHeight == &GridMap::getHeightFromUint8)
+        heightSize = sizeof(uint8);
+
+    if (m_V9)
+        size += 129 * 129 * heightSize;
+    if (m_V8)
+        size += 128 * 128 * heightSize;
+    if (_minHeightPlanes)
+        size += 8 * sizeof(G3D::Plane);
+    if (_liquidEntry)
+        size += 16 * 16 * sizeof(uint16);
+    if (_liquidFlags)
+        size += 16 * 16 * sizeof(map_liquidHeaderTypeFlags);
+    if (_liquidMap)
+        size += std::size_t(_liquidWidth) * std::size_t(_liquidHeight) * sizeof(float);
+    if (_holes)
+        size += 16 * 16 * 8;
+
+    return size;
+}
+
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
 {
     map_areaHeader header;
@@ -311,6 +344,31 @@ float GridMap::getHeightFromFloat(float x, float y) const
     if (!m_V8 || !m_V9)
         return _gridHeight;
 
+    return getHeightFromGrid(m_V9, m_V8, x, y);
+}
+
+float GridMap::getHeightFromUint8(float x, float y) const
+{
+    if (!m_uint8_V8 || !m_uint8_V9)
+        return _gridHeight;
+
+    return getHeightFromGrid(m_uint8_V9, m_uint8_V8, x, y);
+}
+
+float GridMap::getHeightFromUint16(float x, float y) const
+{
+    if (!m_uint16_V8 || !m_uint16_V9)
+        return _gridHeight;
+
+    return getHeightFromGrid(m_uint16_V9, m_uint16_V8, x, y);
+}
+
+template<typename T>
+inline float GridMap::getHeightFromGrid(T const* v9, T const* v8, float x, float y) const
+{
+    // integer heights are solved exactly and scaled afterwards
+    using Height = std::conditional_t<std::is_floating_point_v<T>, float, int32>;
+
     x = MAP_RESOLUTION * (CENTER_GRID_ID - x/SIZE_OF_GRIDS);
     y = MAP_RESOLUTION * (CENTER_GRID_ID - y/SIZE_OF_GRIDS);
 
@@ -339,16 +397,17 @@ float GridMap::getHeightFromFloat(float x, float y) const
     // 2 - solve linear equation from triangle points
     // Calculate coefficients for solve h = a*x + b*y + c
 
-    float a, b, c;
+    Height a, b, c;
+    T const* V9_h1_ptr = &v9[x_int*128 + x_int + y_int];
+    Height h5 = 2 * Height(v8[x_int*128 + y_int]);
     // Select triangle:
     if (x+y < 1)
     {
         if (x > y)
         {
             // 1 triangle (h1, h2, h5 points)
-            float h1 = m_V9[(x_int)*129 + y_int];
-            float h2 = m_V9[(x_int+1)*129 + y_int];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Height h1 = V9_h1_ptr[  0];
+            Height h2 = V9_h1_ptr[129];
             a = h2-h1;
             b = h5-h1-h2;
             c = h1;
@@ -356,9 +415,8 @@ float GridMap::getHeightFromFloat(float x, float y) const
         else
         {
             // 2 triangle (h1, h3, h5 points)
-            float h1 = m_V9[x_int*129 + y_int  ];
-            float h3 = m_V9[x_int*129 + y_int+1];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Height h1 = V9_h1_ptr[0];
+            Height h3 = V9_h1_ptr[1];
             a = h5 - h1 - h3;
             b = h3 - h1;
             c = h1;
@@ -369,9 +427,8 @@ float GridMap::getHeightFromFloat(float x, float y) const
         if (x > y)
         {
             // 3 triangle (h2, h4, h5 points)
-            float h2 = m_V9[(x_int+1)*129 + y_int  ];
-            float h4 = m_V9[(x_int+1)*129 + y_int+1];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Height h2 = V9_h1_ptr[129];
+            Height h4 = V9_h1_ptr[130];
             a = h2 + h4 - h5;
             b = h4 - h2;
             c = h5 - h4;
@@ -379,156 +436,39 @@ float GridMap::getHeightFromFloat(float x, float y) const
         else
         {
             // 4 triangle (h3, h4, h5 points)
-            float h3 = m_V9[(x_int)*129 + y_int+1];
-            float h4 = m_V9[(x_int+1)*129 + y_int+1];
-            float h5 = 2 * m_V8[x_int*128 + y_int];
+            Height h3 = V9_h1_ptr[  1];
+            Height h4 = V9_h1_ptr[130];
             a = h4 - h3;
             b = h3 + h4 - h5;
             c = h5 - h4;
         }
     }
+
     // Calculate height
-    return a * x + b * y + c;
+    if constexpr (std::is_floating_point_v<T>)
+        return a * x + b * y + c;
+    else
+        return (float)((a * x) + (b * y) + c)*_gridIntHeightMultiplier + _gridHeight;
 }
 
-float GridMap::getHeightFromUint8(float x, float y) const
+template<typename T>
+void GridMap::getHeightsFromGrid(T const* v9, T const* v8, std::span<Position const> positions, std::span<float> heights) const
 {
-    if (!m_uint8_V8 || !m_uint8_V9)
-        return _gridHeight;
-
-    x = MAP_RESOLUTION * (CENTER_GRID_ID - x/SIZE_OF_GRIDS);
-    y = MAP_RESOLUTION * (CENTER_GRID_ID - y/SIZE_OF_GRIDS);
-
-    int x_int = (int)x;
-    int y_int = (int)y;
-    x -= x_int;
-    y -= y_int;
-    x_int&=(MAP_RESOLUTION - 1);
-    y_int&=(MAP_RESOLUTION - 1);
-
-    if (isHole(x_int, y_int))
-        return INVALID_HEIGHT;
-
-    int32 a, b, c;
-    uint8 *V9_h1_ptr = &m_uint8_V9[x_int*128 + x_int + y_int];
-    if (x+y < 1)
-    {
-        if (x > y)
-        {
-            // 1 triangle (h1, h2, h5 points)
-            int32 h1 = V9_h1_ptr[  0];
-            int32 h2 = V9_h1_ptr[129];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h2-h1;
-            b = h5-h1-h2;
-            c = h1;
-        }
-        else
-        {
-            // 2 triangle (h1, h3, h5 points)
-            int32 h1 = V9_h1_ptr[0];
-            int32 h3 = V9_h1_ptr[1];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h5 - h1 - h3;
-            b = h3 - h1;
-            c = h1;
-        }
-    }
-    else
-    {
-        if (x > y)
-        {
-            // 3 triangle (h2, h4, h5 points)
-            int32 h2 = V9_h1_ptr[129];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h2 + h4 - h5;
-            b = h4 - h2;
-            c = h5 - h4;
-        }
-        else
-        {
-            // 4 triangle (h3, h4, h5 points)
-            int32 h3 = V9_h1_ptr[  1];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint8_V8[x_int*128 + y_int];
-            a = h4 - h3;
-            b = h3 + h4 - h5;
-            c = h5 - h4;
-        }
-    }
-    // Calculate height
-    return (float)((a * x) + (b * y) + c)*_gridIntHeightMultiplier + _gridHeight;
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        heights[i] = getHeightFromGrid(v9, v8, positions[i].GetPositionX(), positions[i].GetPositionY());
 }
 
-float GridMap::getHeightFromUint16(float x, float y) const
+void GridMap::getHeight(std::span<Position const> positions, std::span<float> heights) const
 {
-    if (!m_uint16_V8 || !m_uint16_V9)
-        return _gridHeight;
-
-    x = MAP_RESOLUTION * (CENTER_GRID_ID - x/SIZE_OF_GRIDS);
-    y = MAP_RESOLUTION * (CENTER_GRID_ID - y/SIZE_OF_GRIDS);
-
-    int x_int = (int)x;
-    int y_int = (int)y;
-    x -= x_int;
-    y -= y_int;
-    x_int&=(MAP_RESOLUTION - 1);
-    y_int&=(MAP_RESOLUTION - 1);
-
-    if (isHole(x_int, y_int))
-        return INVALID_HEIGHT;
-
-    int32 a, b, c;
-    uint16 *V9_h1_ptr = &m_uint16_V9[x_int*128 + x_int + y_int];
-    if (x+y < 1)
-    {
-        if (x > y)
-        {
-            // 1 triangle (h1, h2, h5 points)
-            int32 h1 = V9_h1_ptr[  0];
-            int32 h2 = V9_h1_ptr[129];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h2-h1;
-            b = h5-h1-h2;
-            c = h1;
-        }
-        else
-        {
-            // 2 triangle (h1, h3, h5 points)
-            int32 h1 = V9_h1_ptr[0];
-            int32 h3 = V9_h1_ptr[1];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h5 - h1 - h3;
-            b = h3 - h1;
-            c = h1;
-        }
-    }
+    // the storage format is resolved once per batch instead of calling through _gridGetHeight per position
+    if (_gridGetHeight == &GridMap::getHeightFromFloat && m_V8 && m_V9)
+        getHeightsFromGrid(m_V9, m_V8, positions, heights);
+    else if (_gridGetHeight == &GridMap::getHeightFromUint16 && m_uint16_V8 && m_uint16_V9)
+        getHeightsFromGrid(m_uint16_V9, m_uint16_V8, positions, heights);
+    else if (_gridGetHeight == &GridMap::getHeightFromUint8 && m_uint8_V8 && m_uint8_V9)
+        getHeightsFromGrid(m_uint8_V9, m_uint8_V8, positions, heights);
     else
-    {
-        if (x > y)
-        {
-            // 3 triangle (h2, h4, h5 points)
-            int32 h2 = V9_h1_ptr[129];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h2 + h4 - h5;
-            b = h4 - h2;
-            c = h5 - h4;
-        }
-        else
-        {
-            // 4 triangle (h3, h4, h5 points)
-            int32 h3 = V9_h1_ptr[  1];
-            int32 h4 = V9_h1_ptr[130];
-            int32 h5 = 2 * m_uint16_V8[x_int*128 + y_int];
-            a = h4 - h3;
-            b = h3 + h4 - h5;
-            c = h5 - h4;
-        }
-    }
-    // Calculate height
-    return (float)((a * x) + (b * y) + c)*_gridIntHeightMultiplier + _gridHeight;
+        std::fill_n(heights.begin(), positions.size(), _gridHeight);
 }
 
 bool GridMap::isHole(int row, int col) const
@@ -22,8 +22,10 @@
 #include "MapDefines.h"
 #include "Optional.h"
 #include <cstdio>
+#include <span>
 
 struct LiquidData;
+struct Position;
 enum ZLiquidStatus : uint32;
 namespace G3D { class Plane; }
 
@@ -78,6 +80,10 @@ class TC_GAME_API GridMap
     float getHeightFromUint16(float x, float y) const;
     float getHeightFromUint8(float x, float y) const;
     float getHeightFromFlat(float x, float y) const;
+    template<typename T>
+    float getHeightFromGrid(T const* v9, T const* v8, float x, float y) const;
+    template<typename T>
+    void getHeightsFromGrid(T const* v9, T const* v8, std::span<Position const> positions, std::span<float> heights) const;
 
 public:
     GridMap();
@@ -93,8 +99,13 @@ public:
     LoadResult loadData(char const* filename);
     void unloadData();
 
+    // bytes allocated for the loaded data
+    std::size_t GetMemoryUsage() const;
+
     uint16 getArea(float x, float y) const;
     float getHeight(float x, float y) const { return (this->*_gridGetHeight)(x, y); }
+    // heights[i] is the height at positions[i], every position must be on this grid
+    void getHeight(std::span<Position const> positions, std::span<float> heights) const;
     float getMinHeight(float x, float y) const;
     float getLiquidLevel(float x, float y) const;
     ZLiquidStatus GetLiquidStatus(float x, float y, float z, Optional<map_liquidHeaderTypeFlags> ReqLiquidType, LiquidData* data = nullptr, float collisionHeight = 2.03128f) const; // DEFAULT_COLLISION_HEIGHT in Object.h
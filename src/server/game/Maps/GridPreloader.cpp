@@ -0,0 +1,131 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPreloader.h"
+#include "Common.h"
+#include "TerrainMgr.h"
+#include "ThreadPool.h"
+
+namespace
+{
+// unused preloads give their terrain reference back after this long
+constexpr int32 PRELOAD_EXPIRE_TIME = 60 * IN_MILLISECONDS;
+
+// terrain files are indexed in the opposite direction of grid coordinates
+int32 TerrainX(GridCoord const& grid) { return (MAX_NUMBER_OF_GRIDS - 1) - grid.x_coord; }
+int32 TerrainY(GridCoord const& grid) { return (MAX_NUMBER_OF_GRIDS - 1) - grid.y_coord; }
+}
+
+GridPreloader::GridPreloader(std::shared_ptr<TerrainInfo> terrain, Trinity::ThreadPool* pool) : _terrain(std::move(terrain)), _pool(pool)
+{
+}
+
+GridPreloader::~GridPreloader()
+{
+    for (auto const& [key, preload] : _preloads)
+        Release(key, preload);
+}
+
+void GridPreloader::Schedule(GridCoord const& grid)
+{
+    uint32 key = MakeKey(grid);
+    auto [itr, inserted] = _preloads.try_emplace(key);
+    itr->second.ExpireTimer = PRELOAD_EXPIRE_TIME;
+    if (!inserted)
+        return;
+
+    std::shared_ptr<std::atomic<LoadState>> state = std::make_shared<std::atomic<LoadState>>(LoadState::Pending);
+    itr->second.State = state;
+    ++_stats.Scheduled;
+
+    _pool->PostWork([terrain = _terrain, state, gx = TerrainX(grid), gy = TerrainY(grid)]
+    {
+        terrain->LoadMapAndVMap(gx, gy);
+
+        // the map gave up on this preload while it was loading, nobody else will release the reference
+        LoadState expected = LoadState::Pending;
+        if (!state->compare_exchange_strong(expected, LoadState::Loaded))
+            terrain->UnloadMap(gx, gy);
+
+        state->notify_all();
+    });
+}
+
+void GridPreloader::OnGridCreating(GridCoord const& grid)
+{
+    auto itr = _preloads.find(MakeKey(grid));
+    if (itr == _preloads.end())
+    {
+        ++_stats.Misses;
+        return;
+    }
+
+    // wait for the background load instead of racing it for the same files
+    if (itr->second.State->load() == LoadState::Pending)
+    {
+        ++_stats.Late;
+        itr->second.State->wait(LoadState::Pending);
+    }
+    else
+        ++_stats.Hits;
+}
+
+void GridPreloader::OnGridCreated(GridCoord const& grid)
+{
+    // the map holds its own terrain reference now
+    auto itr = _preloads.find(MakeKey(grid));
+    if (itr == _preloads.end())
+        return;
+
+    Release(itr->first, itr->second);
+    _preloads.erase(itr);
+}
+
+void GridPreloader::Update(uint32 diff)
+{
+    for (auto itr = _preloads.begin(); itr != _preloads.end();)
+    {
+        itr->second.ExpireTimer -= diff;
+        if (itr->second.ExpireTimer > 0)
+        {
+            ++itr;
+            continue;
+        }
+
+        ++_stats.Expired;
+        Release(itr->first, itr->second);
+        itr = _preloads.erase(itr);
+    }
+}
+
+GridPreloader::Stats GridPreloader::TakeStats()
+{
+    Stats stats = _stats;
+    _stats = { };
+    return stats;
+}
+
+void GridPreloader::Release(uint32 key, Preload const& preload)
+{
+    // still loading, the background task releases the reference when done
+    LoadState expected = LoadState::Pending;
+    if (preload.State->compare_exchange_strong(expected, LoadState::Cancelled))
+        return;
+
+    GridCoord grid(key / MAX_NUMBER_OF_GRIDS, key % MAX_NUMBER_OF_GRIDS);
+    _terrain->UnloadMap(TerrainX(grid), TerrainY(grid));
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_GRID_PRELOADER_H
+#define TRINITYCORE_GRID_PRELOADER_H
+
+#include "Define.h"
+#include "GridDefines.h"
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+class TerrainInfo;
+
+namespace Trinity
+{
+class ThreadPool;
+}
+
+/*
+ * Loads terrain of grids a map expects to create soon on a background pool.
+ * Each preload holds a terrain reference until the map creates the grid itself (or the
+ * preload expires), everything touching map objects stays on the map thread.
+ */
+class TC_GAME_API GridPreloader
+{
+public:
+    struct Stats
+    {
+        uint32 Scheduled = 0;
+        uint32 Hits = 0;        // grid created after its preload finished
+        uint32 Late = 0;        // grid created while its preload was still running
+        uint32 Misses = 0;      // grid created without being predicted
+        uint32 Expired = 0;     // preload released without the grid being created
+    };
+
+    GridPreloader(std::shared_ptr<TerrainInfo> terrain, Trinity::ThreadPool* pool);
+    ~GridPreloader();
+
+    GridPreloader(GridPreloader const&) = delete;
+    GridPreloader(GridPreloader&&) = delete;
+    GridPreloader& operator=(GridPreloader const&) = delete;
+    GridPreloader& operator=(GridPreloader&&) = delete;
+
+    void Schedule(GridCoord const& grid);
+
+    // must bracket the terrain load made by Map::EnsureGridCreated
+    void OnGridCreating(GridCoord const& grid);
+    void OnGridCreated(GridCoord const& grid);
+
+    void Update(uint32 diff);
+
+    Stats TakeStats();
+
+private:
+    enum class LoadState : uint8
+    {
+        Pending,
+        Loaded,
+        Cancelled
+    };
+
+    struct Preload
+    {
+        std::shared_ptr<std::atomic<LoadState>> State;
+        int32 ExpireTimer;
+    };
+
+    static uint32 MakeKey(GridCoord const& grid) { return grid.x_coord * MAX_NUMBER_OF_GRIDS + grid.y_coord; }
+
+    void Release(uint32 key, Preload const& preload);
+
+    std::shared_ptr<TerrainInfo> _terrain;
+    Trinity::ThreadPool* _pool;
+    std::unordered_map<uint32, Preload> _preloads;
+    Stats _stats;
+};
+
+#endif // TRINITYCORE_GRID_PRELOADER_H
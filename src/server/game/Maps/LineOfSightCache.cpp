@@ -0,0 +1,126 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSightCache.h"
+#include "Hash.h"
+#include "PhaseShift.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+// a busy map rotates early instead of growing without limit
+constexpr std::size_t LINE_OF_SIGHT_CACHE_MAX_ENTRIES = 65536;
+}
+
+LineOfSightCache::LineOfSightCache(uint32 duration, float tolerance) : _dynamicGeneration(0), _duration(duration), _rotateTimer(duration),
+    _tolerance(std::max(tolerance, 0.01f))
+{
+}
+
+LineOfSightCache::Key LineOfSightCache::MakeKey(PhaseShift const& phaseShift, uint32 terrainMapId, uint32 ignoreFlags, float x1, float y1, float z1, float x2, float y2, float z2) const
+{
+    std::size_t phaseHash = 0;
+    Trinity::hash_combine(phaseHash, phaseShift.GetFlags().AsUnderlyingType());
+    Trinity::hash_combine(phaseHash, phaseShift.GetPersonalGuid());
+    for (PhaseShift::PhaseRef const& phase : phaseShift.GetPhases())
+    {
+        Trinity::hash_combine(phaseHash, phase.Id);
+        Trinity::hash_combine(phaseHash, phase.Flags.AsUnderlyingType());
+    }
+
+    auto quantize = [this](float coord) { return int32(std::floor(coord / _tolerance)); };
+
+    return
+    {
+        .Endpoints = { quantize(x1), quantize(y1), quantize(z1), quantize(x2), quantize(y2), quantize(z2) },
+        .TerrainMapId = terrainMapId,
+        .IgnoreFlags = ignoreFlags,
+        .PhaseHash = phaseHash
+    };
+}
+
+std::size_t LineOfSightCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hashVal = key.PhaseHash;
+    for (int32 endpoint : key.Endpoints)
+        Trinity::hash_combine(hashVal, endpoint);
+    Trinity::hash_combine(hashVal, key.TerrainMapId);
+    Trinity::hash_combine(hashVal, key.IgnoreFlags);
+    return hashVal;
+}
+
+LineOfSightCache::Entry LineOfSightCache::Find(Key const& key, uint32 generation)
+{
+    std::scoped_lock lock(_lock);
+    Entry entry;
+    auto itr = _current.find(key);
+    if (itr != _current.end())
+        entry = itr->second;
+    else if (itr = _previous.find(key); itr != _previous.end())
+        entry = itr->second;
+
+    if (entry.DynamicGeneration != generation)
+        entry.Dynamic.reset();
+
+    return entry;
+}
+
+void LineOfSightCache::Record(Key const& key, Entry const& entry, uint32 generation, bool computed)
+{
+    std::scoped_lock lock(_lock);
+    if (!computed)
+    {
+        ++_stats.Hits;
+        return;
+    }
+
+    ++_stats.Misses;
+    if (_current.size() >= LINE_OF_SIGHT_CACHE_MAX_ENTRIES)
+        Rotate();
+
+    // a dynamic result cast while the tree changed keeps its old generation and is never read
+    Entry& stored = _current[key];
+    stored = entry;
+    stored.DynamicGeneration = generation;
+}
+
+void LineOfSightCache::Rotate()
+{
+    _previous = std::exchange(_current, {});
+}
+
+void LineOfSightCache::Update(uint32 diff)
+{
+    if (_rotateTimer > diff)
+    {
+        _rotateTimer -= diff;
+        return;
+    }
+
+    _rotateTimer = _duration;
+
+    std::scoped_lock lock(_lock);
+    Rotate();
+}
+
+LineOfSightCache::Stats LineOfSightCache::TakeStats()
+{
+    std::scoped_lock lock(_lock);
+    return std::exchange(_stats, {});
+}
@@ -0,0 +1,128 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+#define TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+
+#include "Define.h"
+#include "Optional.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+class PhaseShift;
+
+/*
+ * Keeps line of sight results of a map for a short time. Endpoints are quantized to the tolerance,
+ * so a ray is looked up again once either end moved into another cell of that size; the phases of the
+ * asking object and the terrain swap are part of the key.
+ * Entries live between one and two durations. The static (vmap) part of a result only expires, the
+ * dynamic (gameobject) part is also dropped whenever the dynamic tree of the map changes.
+ */
+class TC_GAME_API LineOfSightCache
+{
+public:
+    struct Stats
+    {
+        uint32 Hits = 0;            // queries answered without casting a ray
+        uint32 Misses = 0;          // queries that cast at least one ray
+    };
+
+    struct Key
+    {
+        std::array<int32, 6> Endpoints;
+        uint32 TerrainMapId;
+        uint32 IgnoreFlags;
+        std::size_t PhaseHash;
+
+        bool operator==(Key const& right) const = default;
+    };
+
+    LineOfSightCache(uint32 duration, float tolerance);
+
+    LineOfSightCache(LineOfSightCache const&) = delete;
+    LineOfSightCache(LineOfSightCache&&) = delete;
+    LineOfSightCache& operator=(LineOfSightCache const&) = delete;
+    LineOfSightCache& operator=(LineOfSightCache&&) = delete;
+
+    Key MakeKey(PhaseShift const& phaseShift, uint32 terrainMapId, uint32 ignoreFlags, float x1, float y1, float z1, float x2, float y2, float z2) const;
+
+    // Cached result of the ray, staticCheck and dynamicCheck are only called for the parts that are not cached.
+    // Rays are cast outside of the lock, parallel island updates may query the same map
+    template<typename StaticCheck, typename DynamicCheck>
+    bool IsInLineOfSight(Key const& key, bool checkStatic, bool checkDynamic, StaticCheck&& staticCheck, DynamicCheck&& dynamicCheck)
+    {
+        uint32 generation = _dynamicGeneration.load(std::memory_order_acquire);
+        Entry entry = Find(key, generation);
+        bool computed = false;
+        if (checkStatic && !entry.Static)
+        {
+            entry.Static = staticCheck();
+            computed = true;
+        }
+
+        if (!checkStatic || *entry.Static)
+        {
+            if (checkDynamic && !entry.Dynamic)
+            {
+                entry.Dynamic = dynamicCheck();
+                computed = true;
+            }
+        }
+
+        Record(key, entry, generation, computed);
+        return (!checkStatic || *entry.Static) && (!checkDynamic || *entry.Dynamic);
+    }
+
+    // Called whenever a gameobject model is added, removed, moved or toggled
+    void InvalidateDynamic() { _dynamicGeneration.fetch_add(1, std::memory_order_release); }
+
+    void Update(uint32 diff);
+
+    Stats TakeStats();
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Entry
+    {
+        Optional<bool> Static;
+        Optional<bool> Dynamic;
+        uint32 DynamicGeneration = 0;
+    };
+
+    using Container = std::unordered_map<Key, Entry, KeyHash>;
+
+    Entry Find(Key const& key, uint32 generation);
+    void Record(Key const& key, Entry const& entry, uint32 generation, bool computed);
+    void Rotate();
+
+    std::mutex _lock;
+    Container _current;
+    Container _previous;
+    std::atomic<uint32> _dynamicGeneration;
+    uint32 _duration;
+    uint32 _rotateTimer;
+    float _tolerance;
+    Stats _stats;
+};
+
+#endif // TRINITYCORE_LINE_OF_SIGHT_CACHE_H
@@ -16,6 +16,7 @@
  */
 
 #include "Map.h"
+#include "AdaptiveVisibility.h"
 #include "Battleground.h"
 #include "BattlegroundMgr.h"
 #include "BattlegroundScript.h"
@@ -30,29 +31,43 @@
 #include "GameTime.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "GridPreloader.h"
 #include "GridStates.h"
 #include "Group.h"
 #include "InstanceLockMgr.h"
 #include "InstancePackets.h"
 #include "InstanceScenario.h"
 #include "InstanceScript.h"
+#include "JobSystem.h"
+#include "LineOfSightCache.h"
 #include "Log.h"
 #include "MMapManager.h"
+#include "MapIslandPartitioner.h"
 #include "MapManager.h"
 #include "MapUtils.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MotionMaster.h"
+#include "MoveSpline.h"
+#include "MoveSplineBatch.h"
+#include "MovementRelay.h"
 #include "ObjectAccessor.h"
 #include "ObjectGridLoader.h"
 #include "ObjectMgr.h"
+#include "PathCorridorCache.h"
+#include "PathGenerator.h"
 #include "Pet.h"
 #include "PhasingHandler.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "SpellAuras.h"
 #include "TerrainMgr.h"
+#include "TimerWheel.h"
+#include "ThreadPool.h"
 #include "Transport.h"
+#include "UpdateData.h"
+#include "UpdateTime.h"
 #include "VMapFactory.h"
 #include "VMapManager.h"
 #include "Vehicle.h"
@@ -64,7 +79,8 @@
 #include "WorldSession.h"
 #include "WorldStateMgr.h"
 #include "WorldStatePackets.h"
-#include <boost/heap/fibonacci_heap.hpp>
+#include <atomic>
+#include <latch>
 #include <sstream>
 
 #define DEFAULT_GRID_EXPIRY     300
@@ -78,18 +94,28 @@ ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), DefaultWeather(nullptr), Weathe
 
 RespawnInfo::~RespawnInfo() = default;
 
-struct RespawnInfoWithHandle;
-struct RespawnListContainer : boost::heap::fibonacci_heap<RespawnInfoWithHandle*, boost::heap::compare<CompareRespawnInfo>>
+struct RespawnInfoWithHandle : RespawnInfo, Trinity::Containers::TimerWheelNode
 {
+    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other) { }
 };
 
-struct RespawnInfoWithHandle : RespawnInfo
+// respawn times are in seconds, one tick per second
+struct RespawnListContainer : Trinity::Containers::TimerWheel<RespawnInfoWithHandle>
 {
-    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other) { }
+    RespawnListContainer() : TimerWheel(uint64(GameTime::GetGameTime())) { }
 
-    RespawnListContainer::handle_type handle;
+    void Schedule(RespawnInfoWithHandle* info) { TimerWheel::Schedule(info, uint64(std::max<time_t>(info->respawnTime, 0))); }
 };
 
+namespace
+{
+// bumped by changes that can affect spawn group conditions of every map (realm world states, game events, condition reloads)
+std::atomic<uint32> SpawnGroupConditionGeneration = 0;
+
+// spawn group conditions are still fully re-evaluated this often (in seconds), for changes nobody reports
+constexpr time_t SPAWN_GROUP_CONDITION_RECHECK_INTERVAL = MINUTE;
+}
+
 Map::~Map()
 {
     // Delete all waiting spawns, else there will be a memory leak
@@ -141,7 +167,10 @@ m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_mapRefIter(m
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
 i_gridExpiry(expiry), m_terrain(sTerrainMgr.LoadTerrain(id)), m_forceEnabledNavMeshFilterFlags(0), m_forceDisabledNavMeshFilterFlags(0), i_grids(),
-i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0), _vignetteUpdateTimer(5200, 5200)
+_islandUpdateInProgress(false), i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0),
+_spawnGroupConditionsChanged(true), _spawnGroupConditionGeneration(0), _nextSpawnGroupConditionCheck(0), _updateDataPool(std::make_unique<UpdateDataPool>()),
+_gridPreloadTimer(0), _movementRelayReportTimer(0), _lineOfSightCacheReportTimer(0), _pathCorridorCacheReportTimer(0), _deferAggroChecks(false), _hibernatedSnapshotBytes(0), _updateStartTime(0), _lastUpdateTime(0), _lastUpdateOverBudget(false),
+_deferredPhaseTrackerDiff(0), _vignetteUpdatePending(false), _vignetteUpdateTimer(5200, 5200)
 {
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
@@ -156,6 +185,23 @@ i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _r
 
     m_terrain->LoadMMapInstance(GetId(), GetInstanceId());
 
+    if (Trinity::ThreadPool* preloadPool = sMapMgr->GetGridPreloadPool())
+        _gridPreloader = std::make_unique<GridPreloader>(m_terrain, preloadPool);
+
+    _dynamicTree.setRebuildPool(sMapMgr->GetDynamicTreePool());
+
+    if (uint32 movementRelayWindow = sWorld->getIntConfig(CONFIG_MAPUPDATE_MOVEMENT_RELAY_WINDOW))
+        _movementRelay = std::make_unique<MovementRelay>(this, movementRelayWindow);
+
+    if (uint32 lineOfSightCacheDuration = sWorld->getIntConfig(CONFIG_MAPUPDATE_LOS_CACHE_DURATION))
+        _lineOfSightCache = std::make_unique<LineOfSightCache>(lineOfSightCacheDuration, sWorld->getFloatConfig(CONFIG_MAPUPDATE_LOS_CACHE_TOLERANCE));
+
+    if (uint32 pathCorridorCacheDuration = sWorld->getIntConfig(CONFIG_MAPUPDATE_PATH_CORRIDOR_CACHE_DURATION))
+        _pathCorridorCache = std::make_unique<PathCorridorCache>(pathCorridorCacheDuration);
+
+    if (sWorld->getBoolConfig(CONFIG_MAPUPDATE_SPLINE_BATCH))
+        _moveSplineBatch = std::make_unique<Movement::MoveSplineBatch>(sWorld->getFloatConfig(CONFIG_MAPUPDATE_SPLINE_BATCH_RELOCATION_DISTANCE));
+
     if (MMAP::MMapManager::isRebuildingTilesEnabledOnMap(GetId()))
         m_mmapTileRebuilder = std::make_shared<MMAP::DynamicTileBuilder>(this, MMAP::MMapManager::instance()->GetNavMesh(GetId(), GetInstanceId()));
 
@@ -189,6 +235,34 @@ void Map::AddToGrid(T* obj, Cell const& cell)
 
     if constexpr (std::is_base_of_v<MapObject, T>)
         obj->SetCurrentCell(cell);
+
+    if constexpr (std::is_same_v<T, Player> || std::is_same_v<T, Creature>)
+        IncreaseUnitMoveCounter(cell);
+}
+
+void Map::IncreaseUnitMoveCounter(Cell const& cell)
+{
+    if (NGridType* grid = getNGrid(cell.GridX(), cell.GridY()))
+        grid->GetGridType(cell.CellX(), cell.CellY()).IncreaseUnitMoveCounter();
+}
+
+uint32 Map::GetUnitMoveCounter(WorldObject const* center, float radius) const
+{
+    // same cells as Cell::Visit searches
+    CellArea area = Cell::CalculateCellArea(center->GetPositionX(), center->GetPositionY(), radius + center->GetCombatReach());
+
+    uint32 counter = 0;
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            Cell cell(CellCoord(x, y));
+            if (NGridType const* grid = getNGrid(cell.GridX(), cell.GridY()))
+                counter += grid->GetGridType(cell.CellX(), cell.CellY()).GetUnitMoveCounter();
+        }
+    }
+
+    return counter;
 }
 
 template<>
@@ -294,8 +368,21 @@ void Map::EnsureGridCreated(GridCoord const& p)
         int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
         int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
 
-        m_terrain->LoadMapAndVMap(gx, gy);
-        m_terrain->LoadMMap(GetInstanceId(), gx, gy);
+        // a hibernated grid hands its terrain reference over to the new grid
+        HibernatedGrid* hibernated = FindHibernatedGrid(ngrid->GetGridId());
+        if (hibernated && hibernated->HoldsTerrain)
+            hibernated->HoldsTerrain = false;
+        else
+        {
+            if (_gridPreloader)
+                _gridPreloader->OnGridCreating(p);
+
+            m_terrain->LoadMapAndVMap(gx, gy);
+            m_terrain->LoadMMap(GetInstanceId(), gx, gy);
+
+            if (_gridPreloader)
+                _gridPreloader->OnGridCreated(p);
+        }
     }
 }
 
@@ -332,6 +419,7 @@ bool Map::EnsureGridLoaded(Cell const& cell)
         setGridObjectDataLoaded(true, cell.GridX(), cell.GridY());
 
         LoadGridObjects(grid, cell);
+        ReviveHibernatedGrid(*grid);
 
         Balance();
         return true;
@@ -440,29 +528,78 @@ void Map::SetWorldStateValue(int32 worldStateId, int32 value, bool hidden)
         return;
 
     itr->second = value;
+    InvalidateSpawnGroupConditions();
 
     WorldStateTemplate const* worldStateTemplate = sWorldStateMgr->GetWorldStateTemplate(worldStateId);
     if (worldStateTemplate)
         sScriptMgr->OnWorldStateValueChange(worldStateTemplate, oldValue, value, this);
 
-    // Broadcast update to all players on the map
-    WorldPackets::WorldState::UpdateWorldState updateWorldState;
-    updateWorldState.VariableID = worldStateId;
-    updateWorldState.Value = value;
-    updateWorldState.Hidden = hidden;
-    updateWorldState.Write();
+    auto pending = std::ranges::find(_pendingWorldStateUpdates, worldStateId, &PendingWorldStateUpdate::WorldStateId);
+    if (pending != _pendingWorldStateUpdates.end())
+    {
+        pending->Value = value;
+        pending->Hidden = hidden;
+    }
+    else
+        _pendingWorldStateUpdates.push_back({ .WorldStateId = worldStateId, .Value = value, .Hidden = hidden });
+}
+
+void Map::SendWorldStateUpdates()
+{
+    if (_pendingWorldStateUpdates.empty())
+        return;
 
+    if (m_mapRefManager.empty())
+    {
+        _pendingWorldStateUpdates.clear();
+        return;
+    }
+
+    // the area restriction of each packet, null for map wide world states
+    std::vector<WorldPacket> packets;
+    std::vector<WorldStateTemplate const*> areaRestrictions;
+    packets.reserve(_pendingWorldStateUpdates.size());
+    areaRestrictions.reserve(_pendingWorldStateUpdates.size());
+    for (PendingWorldStateUpdate const& pending : _pendingWorldStateUpdates)
+    {
+        WorldPackets::WorldState::UpdateWorldState updateWorldState;
+        updateWorldState.VariableID = pending.WorldStateId;
+        updateWorldState.Value = pending.Value;
+        updateWorldState.Hidden = pending.Hidden;
+        packets.push_back(*updateWorldState.Write());
+
+        WorldStateTemplate const* worldStateTemplate = sWorldStateMgr->GetWorldStateTemplate(pending.WorldStateId);
+        areaRestrictions.push_back(worldStateTemplate && !worldStateTemplate->AreaIds.empty() ? worldStateTemplate : nullptr);
+    }
+
+    _pendingWorldStateUpdates.clear();
+
+    bool hasAreaRestrictions = std::ranges::any_of(areaRestrictions, [](WorldStateTemplate const* worldStateTemplate) { return worldStateTemplate != nullptr; });
+
+    // players of the same area receive the same packets, the area restrictions are only checked once per area
+    std::vector<std::pair<uint32, std::vector<WorldPacket const*>>> packetsByArea;
     for (MapReference const& mapReference : m_mapRefManager)
     {
-        if (worldStateTemplate && !worldStateTemplate->AreaIds.empty())
+        Player* player = mapReference.GetSource();
+        if (!hasAreaRestrictions)
         {
-            bool isInAllowedArea = std::any_of(worldStateTemplate->AreaIds.begin(), worldStateTemplate->AreaIds.end(),
-                [playerAreaId = mapReference.GetSource()->GetAreaId()](uint32 requiredAreaId) { return DB2Manager::IsInArea(playerAreaId, requiredAreaId); });
-            if (!isInAllowedArea)
-                continue;
+            for (WorldPacket const& packet : packets)
+                player->SendDirectMessage(&packet);
+            continue;
         }
 
-        mapReference.GetSource()->SendDirectMessage(updateWorldState.GetRawPacket());
+        uint32 playerAreaId = player->GetAreaId();
+        auto areaItr = std::ranges::find(packetsByArea, playerAreaId, &std::pair<uint32, std::vector<WorldPacket const*>>::first);
+        if (areaItr == packetsByArea.end())
+        {
+            areaItr = packetsByArea.emplace(packetsByArea.end(), playerAreaId, std::vector<WorldPacket const*>());
+            for (std::size_t i = 0; i < packets.size(); ++i)
+                if (!areaRestrictions[i] || std::ranges::any_of(areaRestrictions[i]->AreaIds, [playerAreaId](uint32 requiredAreaId) { return DB2Manager::IsInArea(playerAreaId, requiredAreaId); }))
+                    areaItr->second.push_back(&packets[i]);
+        }
+
+        for (WorldPacket const* packet : areaItr->second)
+            player->SendDirectMessage(packet);
     }
 }
 
@@ -516,6 +653,8 @@ void Map::InitializeObject(GameObject* obj)
 template<class T>
 bool Map::AddToMap(T* obj)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     /// @todo Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
     {
@@ -606,36 +745,577 @@ bool Map::IsGridLoaded(GridCoord const& p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+void Map::UpdateCell(uint32 cellId, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer>& gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer>& worldVisitor)
+{
+    TC_PROFILE_ZONE("Map::UpdateCell");
+    CellCoord pair(cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+    Cell cell(pair);
+    cell.SetNoCreate();
+    Visit(cell, gridVisitor);
+    Visit(cell, worldVisitor);
+}
+
+template<typename Worker>
+void Map::VisitCellActivatorsOf(Player* player, Worker&& worker)
+{
+    worker(player);
+
+    // If player is using far sight or mind vision, visit that object too
+    if (WorldObject* viewPoint = player->GetViewpoint())
+        worker(viewPoint);
+
+    // Handle updates for creatures in combat with player and are more than 60 yards away
+    if (player->IsInCombat())
+    {
+        // copied, updating them may change the combat references
+        std::vector<Creature*> toVisit = player->GetCombatManager().GetDistantPvECombatPartners(GetVisibilityRange());
+        for (Creature* unit : toVisit)
+            worker(unit);
+    }
+
+    { // Update any creatures that own auras the player has applications of
+        std::unordered_set<Unit*> toVisit;
+        for (std::pair<uint32, AuraApplication*> pair : player->GetAppliedAuras())
+        {
+            if (Unit* caster = pair.second->GetBase()->GetCaster())
+                if (caster->GetTypeId() != TYPEID_PLAYER && !caster->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                    toVisit.insert(caster);
+        }
+        for (Unit* unit : toVisit)
+            worker(unit);
+    }
+
+    { // Update player's summons
+        std::vector<Unit*> toVisit;
+
+        // Totems
+        for (ObjectGuid const& summonGuid : player->m_SummonSlot)
+            if (!summonGuid.IsEmpty())
+                if (Creature* unit = GetCreature(summonGuid))
+                    if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                        toVisit.push_back(unit);
+
+        for (Unit* unit : toVisit)
+            worker(unit);
+    }
+}
+
+uint32 Map::CollectNearbyCellsOf(WorldObject const* obj, std::vector<uint32>& cells)
 {
     // Check for valid position
     if (!obj->IsPositionValid())
+        return 0;
+
+    // Update mobs/objects in ALL visible cells around object!
+    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->GetGridActivationRange());
+
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            // marked cells are those that have already been collected
+            // don't update the same cell twice
+            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            if (isCellMarked(cell_id))
+                continue;
+
+            markCell(cell_id);
+            cells.push_back(cell_id);
+        }
+    }
+
+    return (area.high_bound.x_coord - area.low_bound.x_coord + 1) * (area.high_bound.y_coord - area.low_bound.y_coord + 1);
+}
+
+void Map::MarkCellsObservedBy(WorldObject const* obj, float range)
+{
+    if (!obj->IsPositionValid())
+        return;
+
+    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), range);
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            uint32 cellId = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            if (observed_cells.test(cellId))
+                continue;
+
+            observed_cells.set(cellId);
+            _observedCells.push_back(cellId);
+        }
+    }
+}
+
+bool Map::CanUpdateCellIslandsInParallel() const
+{
+    // instances are small enough to be handled by a single MapUpdater thread
+    return !Instanceable() && sMapMgr->GetIslandUpdatePool() && m_mapRefManager.size() > 1;
+}
+
+namespace
+{
+// how often Map::PredictGridPreloads extrapolates player movement
+constexpr uint32 GRID_PRELOAD_PREDICTION_INTERVAL = 500;
+
+// how often Map::UpdateMovementRelay reports its statistics
+constexpr uint32 MOVEMENT_RELAY_REPORT_INTERVAL = 1000;
+// how often Map::UpdateLineOfSightCache reports its statistics
+constexpr uint32 LINE_OF_SIGHT_CACHE_REPORT_INTERVAL = 1000;
+constexpr uint32 PATH_CORRIDOR_CACHE_REPORT_INTERVAL = 1000;
+
+// move list slot of the island updated by the current thread, the map thread always uses slot 0
+thread_local std::size_t MoveListSlot = 0;
+}
+
+void Map::UpdateCellIslands(uint32 diff, std::vector<uint32> const& cells, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
+    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer>& worldVisitor)
+{
+    TC_PROFILE_ZONE("Map::UpdateCellIslands");
+    // objects in cells this far apart can't see each other, interactions between them are
+    // limited to map wide containers which are protected by _islandSharedLock during the update
+    uint32 separation = uint32(std::ceil(2.0f * GetVisibilityRange() / SIZE_OF_GRID_CELL)) + 1;
+    std::vector<std::vector<uint32>> islands = Trinity::PartitionCellsIntoIslands(cells, separation);
+
+    TC_METRIC_VALUE("map_update_islands", uint64(islands.size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (islands.size() < 2)
+    {
+        for (uint32 cellId : cells)
+            UpdateCell(cellId, gridVisitor, worldVisitor);
+        return;
+    }
+
+    _islandUpdateInProgress = true;
+
+    // the largest island stays on the map thread, everything else goes to the island pool
+    auto largest = std::max_element(islands.begin(), islands.end(), [](std::vector<uint32> const& left, std::vector<uint32> const& right)
+    {
+        return left.size() < right.size();
+    });
+    std::iter_swap(islands.begin(), largest);
+
+    // every island appends cell moves to its own slot, merged in island order by MoveAll*InMoveList
+    _creaturesToMove.SetSlotCount(islands.size());
+    _gameObjectsToMove.SetSlotCount(islands.size());
+    _dynamicObjectsToMove.SetSlotCount(islands.size());
+    _areaTriggersToMove.SetSlotCount(islands.size());
+
+    std::latch pendingIslands(std::ptrdiff_t(islands.size() - 1));
+    for (std::size_t i = 1; i < islands.size(); ++i)
+    {
+        sMapMgr->GetIslandUpdatePool()->PostWork([&, i, island = &islands[i]]
+        {
+            Trinity::ObjectUpdater islandUpdater(diff);
+            TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> islandGridVisitor(islandUpdater);
+            TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> islandWorldVisitor(islandUpdater);
+
+            MoveListSlot = i;
+            for (uint32 cellId : *island)
+                UpdateCell(cellId, islandGridVisitor, islandWorldVisitor);
+            MoveListSlot = 0;
+
+            pendingIslands.count_down();
+        });
+    }
+
+    for (uint32 cellId : islands.front())
+        UpdateCell(cellId, gridVisitor, worldVisitor);
+
+    pendingIslands.wait();
+
+    _islandUpdateInProgress = false;
+}
+
+namespace
+{
+template<typename T, typename Work>
+Trinity::Job<void> ProcessChunkJob(std::span<T> items, Work& work, std::latch& pending)
+{
+    for (T& item : items)
+        work(item);
+
+    pending.count_down();
+    co_return;
+}
+
+// the calling thread takes a share as well and returns once every item was processed
+template<typename T, typename Work>
+void ProcessInParallel(std::span<T> items, Work work)
+{
+    Trinity::JobSystem& jobSystem = sWorld->GetJobSystem();
+    std::size_t chunkSize = (items.size() + jobSystem.GetWorkerCount()) / (jobSystem.GetWorkerCount() + 1);
+    if (!chunkSize || chunkSize >= items.size())
+    {
+        for (T& item : items)
+            work(item);
+        return;
+    }
+
+    std::span<T> own = items.first(chunkSize);
+    std::span<T> remaining = items.subspan(chunkSize);
+
+    std::latch pending(std::ptrdiff_t((remaining.size() + chunkSize - 1) / chunkSize));
+    while (!remaining.empty())
+    {
+        std::size_t count = std::min(chunkSize, remaining.size());
+        jobSystem.Spawn(ProcessChunkJob(remaining.first(count), work, pending));
+        remaining = remaining.subspan(count);
+    }
+
+    for (T& item : own)
+        work(item);
+
+    pending.wait();
+}
+}
+
+void Map::ProcessDeferredAggroChecks()
+{
+    if (_deferredAggroChecks.empty())
+        return;
+
+    if (_deferredAggroChecks.size() >= sWorld->getIntConfig(CONFIG_MAPUPDATE_PARALLEL_AGGRO_CHECKS_MIN_PAIRS))
+    {
+        TC_PROFILE_ZONE("Map::ProcessDeferredAggroChecks");
+
+        // only rays of checks that can still end in an attack, the rest of the decision is made by the checks themselves
+        std::vector<std::pair<Creature*, Unit*>> rays;
+        for (auto const& [creature, unit] : _deferredAggroChecks)
+        {
+            if (!creature->IsAIEnabled() || creature->IsEngaged() || !creature->HasReactState(REACT_AGGRESSIVE) || creature->HasUnitState(UNIT_STATE_SIGHTLESS))
+                continue;
+
+            if (!creature->IsWithinDistInMap(unit, creature->GetAttackDistance(unit) + creature->m_CombatDistance))
+                continue;
+
+            rays.emplace_back(creature, unit);
+        }
+
+        // object state is only read until every ray was cast, results are kept by the line of sight cache of the map
+        ProcessInParallel(std::span<std::pair<Creature*, Unit*> const>(rays), [](std::pair<Creature*, Unit*> const& ray)
+        {
+            (void)ray.first->IsWithinLOSInMap(ray.second);
+        });
+    }
+
+    // objects are only removed from the map after the notifies, every pointer is still valid
+    for (auto const& [creature, unit] : _deferredAggroChecks)
+        Trinity::CreatureUnitRelocationCheck(creature, unit);
+
+    _deferredAggroChecks.clear();
+}
+
+bool Map::QueuePathCalculation(PathGenerator* path)
+{
+    if (!sWorld->getIntConfig(CONFIG_MAPUPDATE_ASYNC_PATHFINDING_MIN_REQUESTS))
+        return false;
+
+    auto islandLock = AcquireIslandSharedLock();
+    _queuedPathCalculations.push_back({ .Path = path, .QueueTime = std::chrono::steady_clock::now() });
+    return true;
+}
+
+void Map::CancelPathCalculation(PathGenerator* path)
+{
+    auto islandLock = AcquireIslandSharedLock();
+    auto itr = std::ranges::find(_queuedPathCalculations, path, &QueuedPathCalculation::Path);
+    if (itr != _queuedPathCalculations.end())
+        itr->Path = nullptr;
+}
+
+void Map::ProcessQueuedPathCalculations()
+{
+    std::erase_if(_queuedPathCalculations, [](QueuedPathCalculation const& queued) { return !queued.Path; });
+    if (_queuedPathCalculations.empty())
+        return;
+
+    TC_PROFILE_ZONE("Map::ProcessQueuedPathCalculations");
+    std::vector<PathGenerator*> paths;
+    paths.reserve(_queuedPathCalculations.size());
+    for (QueuedPathCalculation const& queued : _queuedPathCalculations)
+    {
+        // the result of an object that left the map in the meantime is never used
+        queued.Path->_queuedOn = nullptr;
+        if (queued.Path->_source->IsInWorld())
+            paths.push_back(queued.Path);
+    }
+
+    // searches only read the state of their objects and the map, every thread uses its own navmesh query
+    auto calculate = [](PathGenerator* path) { path->FinishCalculation(); };
+    if (paths.size() >= sWorld->getIntConfig(CONFIG_MAPUPDATE_ASYNC_PATHFINDING_MIN_REQUESTS))
+        ProcessInParallel(std::span<PathGenerator*>(paths), calculate);
+    else
+        std::ranges::for_each(paths, calculate);
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration maxLatency = std::chrono::steady_clock::duration::zero();
+    for (QueuedPathCalculation const& queued : _queuedPathCalculations)
+        maxLatency = std::max(maxLatency, now - queued.QueueTime);
+
+    TC_METRIC_VALUE("map_pathfinding_queued", uint64(_queuedPathCalculations.size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_pathfinding_latency", uint64(std::chrono::duration_cast<std::chrono::microseconds>(maxLatency).count()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _queuedPathCalculations.clear();
+}
+
+std::unique_lock<std::recursive_mutex> Map::AcquireIslandSharedLock()
+{
+    if (!_islandUpdateInProgress)
+        return {};
+
+    return std::unique_lock(_islandSharedLock);
+}
+
+bool Map::AppendCreateValuesBlock(ByteBuffer& data, ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey)
+{
+    auto islandLock = AcquireIslandSharedLock();
+    std::span<uint8 const> values = _updateDataPool->FindCreateValuesBlock(guid, generation, fieldFlags, viewerKey);
+    if (values.empty())
+        return false;
+
+    data.append(values.data(), values.size());
+    return true;
+}
+
+void Map::StoreCreateValuesBlock(ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey, std::span<uint8 const> values)
+{
+    auto islandLock = AcquireIslandSharedLock();
+    _updateDataPool->StoreCreateValuesBlock(guid, generation, fieldFlags, viewerKey, values);
+}
+
+void Map::PredictGridPreloads(uint32 diff)
+{
+    _gridPreloader->Update(diff);
+
+    if (_gridPreloadTimer > diff)
+    {
+        _gridPreloadTimer -= diff;
+        return;
+    }
+
+    _gridPreloadTimer = GRID_PRELOAD_PREDICTION_INTERVAL;
+
+    int32 lookahead = int32(sWorld->getIntConfig(CONFIG_MAPUPDATE_GRID_PRELOAD_LOOKAHEAD));
+    for (MapReference const& ref : m_mapRefManager)
+    {
+        Player const* player = ref.GetSource();
+        if (!player->IsInWorld() || player->GetTransport())
+            continue;
+
+        // check half way too, fast movement can skip over a grid entirely
+        for (int32 time : { lookahead / 2, lookahead })
+        {
+            if (!player->movespline->Finalized())
+            {
+                Movement::Location predicted = player->movespline->ComputePosition(time);
+                SchedulePreloadsAround(predicted.x, predicted.y);
+            }
+            else if (player->isMoving())
+            {
+                float distance = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * time / float(IN_MILLISECONDS);
+                SchedulePreloadsAround(player->GetPositionX() + distance * std::cos(player->GetOrientation()),
+                    player->GetPositionY() + distance * std::sin(player->GetOrientation()));
+            }
+        }
+    }
+
+    GridPreloader::Stats stats = _gridPreloader->TakeStats();
+    if (!stats.Scheduled && !stats.Hits && !stats.Late && !stats.Misses && !stats.Expired)
+        return;
+
+    TC_METRIC_VALUE("map_grid_preload_scheduled", uint64(stats.Scheduled),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_grid_preload_hits", uint64(stats.Hits),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_grid_preload_late", uint64(stats.Late),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_grid_preload_misses", uint64(stats.Misses),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_grid_preload_expired", uint64(stats.Expired),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::UpdateMovementRelay(uint32 diff)
+{
+    TC_PROFILE_ZONE("Map::UpdateMovementRelay");
+    _movementRelay->Update(diff);
+
+    if (_movementRelayReportTimer > diff)
+    {
+        _movementRelayReportTimer -= diff;
+        return;
+    }
+
+    _movementRelayReportTimer = MOVEMENT_RELAY_REPORT_INTERVAL;
+
+    MovementRelay::Stats stats = _movementRelay->TakeStats();
+    if (!stats.Relayed && !stats.Superseded && !stats.Dropped)
+        return;
+
+    TC_METRIC_VALUE("map_movement_relay_relayed", uint64(stats.Relayed),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_movement_relay_superseded", uint64(stats.Superseded),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_movement_relay_superseded_bytes", stats.SupersededBytes,
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_movement_relay_dropped", uint64(stats.Dropped),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_movement_relay_flush_time", stats.FlushTime,
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::UpdateLineOfSightCache(uint32 diff)
+{
+    _lineOfSightCache->Update(diff);
+
+    if (_lineOfSightCacheReportTimer > diff)
+    {
+        _lineOfSightCacheReportTimer -= diff;
         return;
+    }
+
+    _lineOfSightCacheReportTimer = LINE_OF_SIGHT_CACHE_REPORT_INTERVAL;
+
+    LineOfSightCache::Stats stats = _lineOfSightCache->TakeStats();
+    if (!stats.Hits && !stats.Misses)
+        return;
+
+    TC_METRIC_VALUE("map_los_cache_hits", uint64(stats.Hits),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_los_cache_misses", uint64(stats.Misses),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_los_cache_hit_rate", double(stats.Hits) / double(stats.Hits + stats.Misses),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::UpdatePathCorridorCache(uint32 diff)
+{
+    _pathCorridorCache->Update(diff);
+
+    if (_pathCorridorCacheReportTimer > diff)
+    {
+        _pathCorridorCacheReportTimer -= diff;
+        return;
+    }
+
+    _pathCorridorCacheReportTimer = PATH_CORRIDOR_CACHE_REPORT_INTERVAL;
+
+    PathCorridorCache::Stats stats = _pathCorridorCache->TakeStats();
+    if (!stats.Hits && !stats.Joined && !stats.Misses)
+        return;
+
+    TC_METRIC_VALUE("map_path_corridor_cache_hits", uint64(stats.Hits),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_path_corridor_cache_joined", uint64(stats.Joined),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_path_corridor_cache_misses", uint64(stats.Misses),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::UpdateAdaptiveVisibility(uint32 diff)
+{
+    AdaptiveVisibility::Thresholds thresholds
+    {
+        .TickTime = sWorld->getIntConfig(CONFIG_VISIBILITY_ADAPTIVE_TICK_TIME),
+        .ZonePlayers = sWorld->getIntConfig(CONFIG_VISIBILITY_ADAPTIVE_ZONE_PLAYERS),
+        .MinDistance = sWorld->getFloatConfig(CONFIG_VISIBILITY_ADAPTIVE_MIN_DISTANCE)
+    };
+
+    bool changed = false;
+    if (!thresholds.TickTime && !thresholds.ZonePlayers)
+    {
+        // disabled by a config reload
+        changed = m_VisibleDistance != _adaptiveVisibility->GetMaxDistance();
+        m_VisibleDistance = _adaptiveVisibility->GetMaxDistance();
+        _adaptiveVisibility.reset();
+    }
+    else
+    {
+        // created on first use, InitVisibilityDistance of derived maps runs after the Map constructor
+        if (!_adaptiveVisibility)
+            _adaptiveVisibility = std::make_unique<AdaptiveVisibility>(m_VisibleDistance);
+
+        uint32 zonePlayers = 0;
+        for (auto const& [zoneId, players] : _zonePlayers)
+            zonePlayers = std::max(zonePlayers, uint32(players.size()));
+
+        changed = _adaptiveVisibility->Update(diff, _lastUpdateTime, zonePlayers, thresholds);
+        m_VisibleDistance = _adaptiveVisibility->GetDistance();
+
+        TC_METRIC_VALUE("map_visibility_distance", m_VisibleDistance,
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+
+    if (!changed)
+        return;
+
+    TC_LOG_DEBUG("maps", "Map {} instance {} visibility distance changed to {:.1f}", GetId(), GetInstanceId(), m_VisibleDistance);
+
+    // players standing still must drop what is now too far away or see what came back into range
+    for (MapReference const& ref : m_mapRefManager)
+        if (Player* player = ref.GetSource())
+            player->UpdateObjectVisibility(false);
+}
 
-    // Update mobs/objects in ALL visible cells around object!
-    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->GetGridActivationRange());
+void Map::SchedulePreloadsAround(float x, float y)
+{
+    if (!Trinity::IsValidMapCoord(x, y))
+        return;
 
-    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
-    {
-        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
-        {
-            // marked cells are those that have been visited
-            // don't visit the same cell twice
-            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            if (isCellMarked(cell_id))
-                continue;
+    // grids that will be needed once the player arrives, visibility included
+    float range = GetVisibilityRange();
+    float minX = x - range, minY = y - range, maxX = x + range, maxY = y + range;
+    Trinity::NormalizeMapCoord(minX);
+    Trinity::NormalizeMapCoord(minY);
+    Trinity::NormalizeMapCoord(maxX);
+    Trinity::NormalizeMapCoord(maxY);
 
-            markCell(cell_id);
-            CellCoord pair(x, y);
-            Cell cell(pair);
-            cell.SetNoCreate();
-            Visit(cell, gridVisitor);
-            Visit(cell, worldVisitor);
-        }
-    }
+    GridCoord low = Trinity::ComputeGridCoord(minX, minY);
+    GridCoord high = Trinity::ComputeGridCoord(maxX, maxY);
+    for (uint32 gx = low.x_coord; gx <= high.x_coord; ++gx)
+        for (uint32 gy = low.y_coord; gy <= high.y_coord; ++gy)
+            if (!getNGrid(gx, gy))
+                _gridPreloader->Schedule(GridCoord(gx, gy));
 }
 
-void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
+void Map::UpdatePlayerZoneStats(Player* player, uint32 oldZone, uint32 newZone)
 {
     // Nothing to do if no change
     if (oldZone == newZone)
@@ -643,50 +1323,111 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
     if (oldZone != MAP_INVALID_ZONE)
     {
-        uint32& oldZoneCount = _zonePlayerCountMap[oldZone];
-        ASSERT(oldZoneCount, "A player left zone %u (went to %u) - but there were no players in the zone!", oldZone, newZone);
-        --oldZoneCount;
+        std::vector<Player*>& oldZonePlayers = _zonePlayers[oldZone];
+        auto itr = std::find(oldZonePlayers.begin(), oldZonePlayers.end(), player);
+        ASSERT(itr != oldZonePlayers.end(), "A player left zone %u (went to %u) - but was not in the zone!", oldZone, newZone);
+        *itr = oldZonePlayers.back();
+        oldZonePlayers.pop_back();
     }
-    ++_zonePlayerCountMap[newZone];
+
+    // players leaving the map are taken out of the index
+    if (newZone != MAP_INVALID_ZONE)
+        _zonePlayers[newZone].push_back(player);
+}
+
+std::span<Player* const> Map::GetZonePlayers(uint32 zoneId) const
+{
+    auto itr = _zonePlayers.find(zoneId);
+    if (itr == _zonePlayers.end())
+        return {};
+
+    return itr->second;
+}
+
+bool Map::IsOverUpdateBudget() const
+{
+    uint32 budget = sWorld->getIntConfig(CONFIG_MAPUPDATE_TICK_BUDGET);
+    return budget && GetMSTimeDiffToNow(_updateStartTime) > budget;
 }
 
 void Map::Update(uint32 t_diff)
 {
+    TC_PROFILE_ZONE("Map::Update");
+    _updateStartTime = getMSTime();
+
+    // zones of whatever else the thread does (the world update when it updates maps itself) are kept apart
+    uint32 hitchThreshold = sWorldUpdateTime.GetHitchThreshold();
+    std::vector<Trinity::ProfilerZoneStats> outerZones;
+    if (hitchThreshold)
+        outerZones = sProfiler->TakeThreadZoneStats();
+
     _dynamicTree.update(t_diff);
     if (m_mmapTileRebuilder)
         m_mmapTileRebuilder->Update(Milliseconds(t_diff));
 
     /// update worldsessions for existing players
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld())
+        TC_PROFILE_ZONE("Map::UpdateSessions");
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
         {
-            //player->Update(t_diff);
-            WorldSession* session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(t_diff, updater);
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld())
+            {
+                //player->Update(t_diff);
+                WorldSession* session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(t_diff, updater);
+            }
         }
     }
 
+    if (_movementRelay)
+        UpdateMovementRelay(t_diff);
+
+    if (_lineOfSightCache)
+        UpdateLineOfSightCache(t_diff);
+
+    if (_pathCorridorCache)
+        UpdatePathCorridorCache(t_diff);
+
     /// process any due respawns
-    if (_respawnCheckTimer <= t_diff)
+    if (_respawnCheckTimer > t_diff)
+        _respawnCheckTimer -= t_diff;
+    else if (!IsOverUpdateBudget())
     {
         ProcessRespawns();
-        UpdateSpawnGroupConditions();
+        if (ConsumeSpawnGroupConditionChanges())
+            UpdateSpawnGroupConditions();
+
         _respawnCheckTimer = sWorld->getIntConfig(CONFIG_RESPAWN_MINCHECKINTERVALMS);
     }
-    else
-        _respawnCheckTimer -= t_diff;
+
+    if (_gridPreloader)
+        PredictGridPreloads(t_diff);
+
+    if (_adaptiveVisibility || sWorld->getIntConfig(CONFIG_VISIBILITY_ADAPTIVE_TICK_TIME) || sWorld->getIntConfig(CONFIG_VISIBILITY_ADAPTIVE_ZONE_PLAYERS))
+        UpdateAdaptiveVisibility(t_diff);
 
     /// update active cells around players and active objects
-    resetMarkedCells();
+    // only bits set during previous tick need to be cleared
+    for (uint32 cellId : _activeCells)
+        marked_cells.reset(cellId);
 
-    Trinity::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+    _activeCells.clear();
+    uint32 cellsVisited = 0;
+
+    for (uint32 cellId : _observedCells)
+        observed_cells.reset(cellId);
+
+    _observedCells.clear();
+    uint32 reducedRateInterval = sWorld->getIntConfig(CONFIG_MAPUPDATE_REDUCED_RATE_INTERVAL);
+    // creatures players can see must keep moving smoothly
+    float observedRange = std::max(float(sWorld->getIntConfig(CONFIG_MAPUPDATE_REDUCED_RATE_DISTANCE)), GetVisibilityRange());
+
+    auto collectCells = [&](WorldObject* obj)
+    {
+        cellsVisited += CollectNearbyCellsOf(obj, _activeCells);
+    };
 
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
@@ -700,48 +1441,13 @@ void Map::Update(uint32 t_diff)
         // update players at tick
         player->Update(t_diff);
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
-
-        // If player is using far sight or mind vision, visit that object too
-        if (WorldObject* viewPoint = player->GetViewpoint())
-            VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+        VisitCellActivatorsOf(player, collectCells);
 
-        // Handle updates for creatures in combat with player and are more than 60 yards away
-        if (player->IsInCombat())
+        if (reducedRateInterval)
         {
-            std::vector<Unit*> toVisit;
-            for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
-                if (Creature* unit = pair.second->GetOther(player)->ToCreature())
-                    if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.push_back(unit);
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
-        }
-
-        { // Update any creatures that own auras the player has applications of
-            std::unordered_set<Unit*> toVisit;
-            for (std::pair<uint32, AuraApplication*> pair : player->GetAppliedAuras())
-            {
-                if (Unit* caster = pair.second->GetBase()->GetCaster())
-                    if (caster->GetTypeId() != TYPEID_PLAYER && !caster->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.insert(caster);
-            }
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
-        }
-
-        { // Update player's summons
-            std::vector<Unit*> toVisit;
-
-            // Totems
-            for (ObjectGuid const& summonGuid : player->m_SummonSlot)
-                if (!summonGuid.IsEmpty())
-                    if (Creature* unit = GetCreature(summonGuid))
-                        if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                            toVisit.push_back(unit);
-
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+            MarkCellsObservedBy(player, observedRange);
+            if (WorldObject* viewPoint = player->GetViewpoint())
+                MarkCellsObservedBy(viewPoint, observedRange);
         }
     }
 
@@ -754,9 +1460,37 @@ void Map::Update(uint32 t_diff)
         if (!obj || !obj->IsInWorld())
             continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+        collectCells(obj);
+    }
+
+    // every active cell is updated exactly once, no matter how many activators overlap it
+    Trinity::ObjectUpdater updater(t_diff, reducedRateInterval);
+    // for creature
+    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+    // for pets
+    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+
+    // moving creatures of the active cells are relocated before anything of the cells is updated
+    if (_moveSplineBatch)
+    {
+        TC_PROFILE_ZONE("Map::UpdateSplines");
+        _moveSplineBatch->Update(*this, t_diff);
     }
 
+    if (CanUpdateCellIslandsInParallel())
+        UpdateCellIslands(t_diff, _activeCells, grid_object_update, world_object_update);
+    else
+        for (uint32 cellId : _activeCells)
+            UpdateCell(cellId, grid_object_update, world_object_update);
+
+    TC_METRIC_VALUE("map_cells_visited", uint64(cellsVisited),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_cells_updated", uint64(_activeCells.size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
     {
         WorldObject* obj = *_transportsUpdateIter;
@@ -764,8 +1498,15 @@ void Map::Update(uint32 t_diff)
         obj->Update(t_diff);
     }
 
+    // movement generators follow the paths they queued during the object updates next tick
+    ProcessQueuedPathCalculations();
+
     if (_vignetteUpdateTimer.Update(t_diff))
+        _vignetteUpdatePending = true;
+
+    if (_vignetteUpdatePending && !IsOverUpdateBudget())
     {
+        _vignetteUpdatePending = false;
         for (Vignettes::VignetteData* vignette : _infiniteAOIVignettes)
         {
             if (vignette->NeedUpdate)
@@ -793,7 +1534,7 @@ void Map::Update(uint32 t_diff)
     }
 
     _weatherUpdateTimer.Update(t_diff);
-    if (_weatherUpdateTimer.Passed())
+    if (_weatherUpdateTimer.Passed() && !IsOverUpdateBudget())
     {
         for (auto&& zoneInfo : _zoneDynamicInfo)
             if (zoneInfo.second.DefaultWeather && !zoneInfo.second.DefaultWeather->Update(_weatherUpdateTimer.GetInterval()))
@@ -803,7 +1544,12 @@ void Map::Update(uint32 t_diff)
     }
 
     // update phase shift objects
-    GetMultiPersonalPhaseTracker().Update(this, t_diff);
+    _deferredPhaseTrackerDiff += t_diff;
+    if (!IsOverUpdateBudget())
+    {
+        GetMultiPersonalPhaseTracker().Update(this, _deferredPhaseTrackerDiff);
+        _deferredPhaseTrackerDiff = 0;
+    }
 
     MoveAllCreaturesInMoveList();
     MoveAllGameObjectsInMoveList();
@@ -814,6 +1560,8 @@ void Map::Update(uint32 t_diff)
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    SendWorldStateUpdates();
+
     TC_METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         TC_METRIC_TAG("map_id", std::to_string(GetId())),
         TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
@@ -821,6 +1569,20 @@ void Map::Update(uint32 t_diff)
     TC_METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         TC_METRIC_TAG("map_id", std::to_string(GetId())),
         TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _lastUpdateTime = GetMSTimeDiffToNow(_updateStartTime);
+    _lastUpdateOverBudget = IsOverUpdateBudget();
+
+    if (hitchThreshold)
+    {
+        // zones of cell islands updated by other threads are missing from the breakdown
+        std::vector<Trinity::ProfilerZoneStats> zones = sProfiler->TakeThreadZoneStats();
+        if (_lastUpdateTime >= hitchThreshold)
+            sWorldUpdateTime.RecordHitch(Trinity::StringFormat("map {} instance {} update", GetId(), GetInstanceId()), _lastUpdateTime, zones,
+                Trinity::StringFormat("    {} players, {} cells updated", GetPlayersCountExceptGMs(), _activeCells.size()));
+
+        sProfiler->AddThreadZoneStats(outerZones);
+    }
 }
 
 struct ResetNotifier
@@ -837,6 +1599,8 @@ struct ResetNotifier
 
 void Map::ProcessRelocationNotifies(const uint32 diff)
 {
+    _deferAggroChecks = _lineOfSightCache && sWorld->getIntConfig(CONFIG_MAPUPDATE_PARALLEL_AGGRO_CHECKS_MIN_PAIRS);
+
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end(); ++i)
     {
         NGridType *grid = i->GetSource();
@@ -874,6 +1638,39 @@ void Map::ProcessRelocationNotifies(const uint32 diff)
         }
     }
 
+    if (_deferAggroChecks)
+    {
+        _deferAggroChecks = false;
+        ProcessDeferredAggroChecks();
+    }
+
+    if (_visibilityScanStats.Full || _visibilityScanStats.Incremental)
+    {
+        TC_METRIC_VALUE("map_visibility_full_scans", uint64(_visibilityScanStats.Full),
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        TC_METRIC_VALUE("map_visibility_incremental_scans", uint64(_visibilityScanStats.Incremental),
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        TC_METRIC_VALUE("map_visibility_skipped_objects", uint64(_visibilityScanStats.Skipped),
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        if (_visibilityScanStats.Mismatches)
+        {
+            TC_LOG_DEBUG("maps", "Map {} instance {}: {} objects skipped by incremental visibility scans disagree with client state",
+                GetId(), GetInstanceId(), _visibilityScanStats.Mismatches);
+
+            TC_METRIC_VALUE("map_visibility_mismatches", uint64(_visibilityScanStats.Mismatches),
+                TC_METRIC_TAG("map_id", std::to_string(GetId())),
+                TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+        }
+
+        _visibilityScanStats = { };
+    }
+
     ResetNotifier reset;
     TypeContainerVisitor<ResetNotifier, GridTypeMapContainer >  grid_notifier(reset);
     TypeContainerVisitor<ResetNotifier, WorldTypeMapContainer > world_notifier(reset);
@@ -941,6 +1738,8 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
 template<class T>
 void Map::RemoveFromMap(T *obj, bool remove)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     bool const inWorld = obj->IsInWorld() && obj->GetTypeId() >= TYPEID_UNIT && obj->GetTypeId() <= TYPEID_GAMEOBJECT;
     obj->RemoveFromWorld();
     if (obj->isActiveObject())
@@ -1028,6 +1827,7 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     Cell new_cell(x, y);
 
     player->Relocate(x, y, z, orientation);
+    player->InvalidateGridPositionCache();
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
 
@@ -1042,12 +1842,15 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
 
         AddToGrid(player, new_cell);
     }
+    else
+        IncreaseUnitMoveCounter(new_cell);
 
     player->UpdatePositionData();
-    player->UpdateObjectVisibility(false);
+    player->GetCombatManager().OnOwnerRelocated();
+    player->UpdateObjectVisibilityOnRelocation();
 }
 
-void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail)
+void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail, bool updateVisibility)
 {
     ASSERT(CheckGridIntegrity(creature, false, "Creature"));
 
@@ -1069,10 +1872,14 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     else
     {
         creature->Relocate(x, y, z, ang);
+        creature->InvalidateGridPositionCache();
+        IncreaseUnitMoveCounter(new_cell);
         if (creature->IsVehicle())
             creature->GetVehicleKit()->RelocatePassengers();
-        creature->UpdateObjectVisibility(false);
+        if (updateVisibility)
+            creature->UpdateObjectVisibility(false);
         creature->UpdatePositionData();
+        creature->GetCombatManager().OnOwnerRelocated();
         RemoveCreatureFromMoveList(creature);
     }
 
@@ -1101,6 +1908,7 @@ void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float
     else
     {
         go->Relocate(x, y, z, orientation);
+        go->InvalidateGridPositionCache();
         go->AfterRelocation();
         RemoveGameObjectFromMoveList(go);
     }
@@ -1130,6 +1938,7 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
     else
     {
         dynObj->Relocate(x, y, z, orientation);
+        dynObj->InvalidateGridPositionCache();
         dynObj->UpdatePositionData();
         dynObj->UpdateObjectVisibility(false);
         RemoveDynamicObjectFromMoveList(dynObj);
@@ -1160,6 +1969,7 @@ void Map::AreaTriggerRelocation(AreaTrigger* at, float x, float y, float z, floa
     else
     {
         at->Relocate(x, y, z, orientation);
+        at->InvalidateGridPositionCache();
         at->UpdateShape();
         at->UpdateObjectVisibility(false);
         RemoveAreaTriggerFromMoveList(at);
@@ -1174,7 +1984,7 @@ void Map::AddCreatureToMoveList(Creature* c, float x, float y, float z, float an
         return;
 
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _creaturesToMove.push_back(c);
+        _creaturesToMove.Append(MoveListSlot, c);
     c->SetNewCellPosition(x, y, z, ang);
 }
 
@@ -1193,7 +2003,7 @@ void Map::AddGameObjectToMoveList(GameObject* go, float x, float y, float z, flo
         return;
 
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _gameObjectsToMove.push_back(go);
+        _gameObjectsToMove.Append(MoveListSlot, go);
     go->SetNewCellPosition(x, y, z, ang);
 }
 
@@ -1212,7 +2022,7 @@ void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj, float x, float y, fl
         return;
 
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _dynamicObjectsToMove.push_back(dynObj);
+        _dynamicObjectsToMove.Append(MoveListSlot, dynObj);
     dynObj->SetNewCellPosition(x, y, z, ang);
 }
 
@@ -1231,7 +2041,7 @@ void Map::AddAreaTriggerToMoveList(AreaTrigger* at, float x, float y, float z, f
         return;
 
     if (at->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _areaTriggersToMove.push_back(at);
+        _areaTriggersToMove.Append(MoveListSlot, at);
     at->SetNewCellPosition(x, y, z, ang);
 }
 
@@ -1247,9 +2057,8 @@ void Map::RemoveAreaTriggerFromMoveList(AreaTrigger* at)
 void Map::MoveAllCreaturesInMoveList()
 {
     _creatureToMoveLock = true;
-    for (std::vector<Creature*>::iterator itr = _creaturesToMove.begin(); itr != _creaturesToMove.end(); ++itr)
+    for (Creature* c : _creaturesToMove.Merge())
     {
-        Creature* c = *itr;
         if (c->FindMap() != this) //pet is teleported to another map
             continue;
 
@@ -1268,10 +2077,13 @@ void Map::MoveAllCreaturesInMoveList()
         {
             // update pos
             c->Relocate(c->_newPosition);
+            c->InvalidateGridPositionCache();
+            IncreaseUnitMoveCounter(c->GetCurrentCell());
             if (c->IsVehicle())
                 c->GetVehicleKit()->RelocatePassengers();
             //CreatureRelocationNotify(c, new_cell, new_cell.cellCoord());
             c->UpdatePositionData();
+            c->GetCombatManager().OnOwnerRelocated();
             c->UpdateObjectVisibility(false);
         }
         else
@@ -1297,16 +2109,15 @@ void Map::MoveAllCreaturesInMoveList()
             }
         }
     }
-    _creaturesToMove.clear();
+    _creaturesToMove.Clear();
     _creatureToMoveLock = false;
 }
 
 void Map::MoveAllGameObjectsInMoveList()
 {
     _gameObjectsToMoveLock = true;
-    for (std::vector<GameObject*>::iterator itr = _gameObjectsToMove.begin(); itr != _gameObjectsToMove.end(); ++itr)
+    for (GameObject* go : _gameObjectsToMove.Merge())
     {
-        GameObject* go = *itr;
         if (go->FindMap() != this) //transport is teleported to another map
             continue;
 
@@ -1325,6 +2136,7 @@ void Map::MoveAllGameObjectsInMoveList()
         {
             // update pos
             go->Relocate(go->_newPosition);
+            go->InvalidateGridPositionCache();
             go->AfterRelocation();
         }
         else
@@ -1341,16 +2153,15 @@ void Map::MoveAllGameObjectsInMoveList()
             }
         }
     }
-    _gameObjectsToMove.clear();
+    _gameObjectsToMove.Clear();
     _gameObjectsToMoveLock = false;
 }
 
 void Map::MoveAllDynamicObjectsInMoveList()
 {
     _dynamicObjectsToMoveLock = true;
-    for (std::vector<DynamicObject*>::iterator itr = _dynamicObjectsToMove.begin(); itr != _dynamicObjectsToMove.end(); ++itr)
+    for (DynamicObject* dynObj : _dynamicObjectsToMove.Merge())
     {
-        DynamicObject* dynObj = *itr;
         if (dynObj->FindMap() != this) //transport is teleported to another map
             continue;
 
@@ -1369,6 +2180,7 @@ void Map::MoveAllDynamicObjectsInMoveList()
         {
             // update pos
             dynObj->Relocate(dynObj->_newPosition);
+            dynObj->InvalidateGridPositionCache();
             dynObj->UpdatePositionData();
             dynObj->UpdateObjectVisibility(false);
         }
@@ -1380,16 +2192,15 @@ void Map::MoveAllDynamicObjectsInMoveList()
         }
     }
 
-    _dynamicObjectsToMove.clear();
+    _dynamicObjectsToMove.Clear();
     _dynamicObjectsToMoveLock = false;
 }
 
 void Map::MoveAllAreaTriggersInMoveList()
 {
     _areaTriggersToMoveLock = true;
-    for (std::vector<AreaTrigger*>::iterator itr = _areaTriggersToMove.begin(); itr != _areaTriggersToMove.end(); ++itr)
+    for (AreaTrigger* at : _areaTriggersToMove.Merge())
     {
-        AreaTrigger* at = *itr;
         if (at->FindMap() != this) //transport is teleported to another map
             continue;
 
@@ -1408,6 +2219,7 @@ void Map::MoveAllAreaTriggersInMoveList()
         {
             // update pos
             at->Relocate(at->_newPosition);
+            at->InvalidateGridPositionCache();
             at->UpdateShape();
             at->UpdateObjectVisibility(false);
         }
@@ -1419,7 +2231,7 @@ void Map::MoveAllAreaTriggersInMoveList()
         }
     }
 
-    _areaTriggersToMove.clear();
+    _areaTriggersToMove.Clear();
     _areaTriggersToMoveLock = false;
 }
 
@@ -1529,9 +2341,11 @@ bool Map::CreatureRespawnRelocation(Creature* c, bool diffGridOnly)
     if (CreatureCellRelocation(c, resp_cell))
     {
         c->Relocate(resp);
+        c->InvalidateGridPositionCache();
         c->GetMotionMaster()->Initialize(); // prevent possible problems with default move generators
         //CreatureRelocationNotify(c, resp_cell, resp_cell.GetCellCoord());
         c->UpdatePositionData();
+        c->GetCombatManager().OnOwnerRelocated();
         c->UpdateObjectVisibility(false);
         return true;
     }
@@ -1556,6 +2370,7 @@ bool Map::GameObjectRespawnRelocation(GameObject* go, bool diffGridOnly)
     if (GameObjectCellRelocation(go, resp_cell))
     {
         go->Relocate(resp);
+        go->InvalidateGridPositionCache();
         go->UpdatePositionData();
         go->UpdateObjectVisibility(false);
         return true;
@@ -1568,6 +2383,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
 {
     const uint32 x = ngrid.getX();
     const uint32 y = ngrid.getY();
+    bool hibernated = false;
 
     {
         if (!unloadAll)
@@ -1599,6 +2415,9 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
             MoveAllCreaturesInMoveList();
             MoveAllGameObjectsInMoveList();
             MoveAllAreaTriggersInMoveList();
+
+            // only creatures that belong to this grid are left at this point
+            hibernated = HibernateGrid(ngrid);
         }
 
         {
@@ -1623,10 +2442,14 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
         delete &ngrid;
         setNGrid(nullptr, x, y);
     }
-    int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
-    int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
 
-    m_terrain->UnloadMap(gx, gy);
+    if (!hibernated)
+    {
+        int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
+        int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
+
+        m_terrain->UnloadMap(gx, gy);
+    }
 
     TC_LOG_DEBUG("maps", "Unloading grid[{}, {}] for map {} finished", x, y, GetId());
     return true;
@@ -1652,8 +2475,8 @@ void Map::RemoveAllPlayers()
 void Map::UnloadAll()
 {
     // clear all delayed moves, useless anyway do this moves before map unload.
-    _creaturesToMove.clear();
-    _gameObjectsToMove.clear();
+    _creaturesToMove.Clear();
+    _gameObjectsToMove.Clear();
 
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
     {
@@ -1683,6 +2506,167 @@ void Map::UnloadAll()
     _corpsesByCell.clear();
     _corpsesByPlayer.clear();
     _corpseBones.clear();
+
+    ReleaseHibernatedGrids(0, 0);
+}
+
+namespace
+{
+// state of a grid's creatures kept while the grid is hibernated
+struct GridSnapshotWriter
+{
+    explicit GridSnapshotWriter(ByteBuffer& data) : Data(data), Count(0) { }
+
+    void Visit(CreatureMapType& creatures)
+    {
+        for (CreatureMapType::iterator itr = creatures.begin(); itr != creatures.end(); ++itr)
+        {
+            Creature const* creature = itr->GetSource();
+            if (!creature->GetSpawnId() || !creature->IsAlive() || creature->IsInCombat())
+                continue;
+
+            Data << uint64(creature->GetSpawnId());
+            Data << creature->GetPositionX() << creature->GetPositionY() << creature->GetPositionZ() << creature->GetOrientation();
+            Data << uint64(creature->GetHealth());
+            Data << int32(creature->GetPower(creature->GetPowerType()));
+            ++Count;
+        }
+    }
+
+    template<class T> void Visit(GridRefManager<T>&) { }
+
+    ByteBuffer& Data;
+    uint32 Count;
+};
+}
+
+Map::HibernatedGrid* Map::FindHibernatedGrid(uint32 gridId)
+{
+    auto itr = std::ranges::find(_hibernatedGrids, gridId, &HibernatedGrid::GridId);
+    return itr != _hibernatedGrids.end() ? &*itr : nullptr;
+}
+
+bool Map::HibernateGrid(NGridType& ngrid)
+{
+    std::size_t maxGrids = sWorld->getIntConfig(CONFIG_GRID_HIBERNATION_MAX_GRIDS);
+    if (!maxGrids)
+        return false;
+
+    std::size_t maxSnapshotBytes = std::size_t(sWorld->getIntConfig(CONFIG_GRID_HIBERNATION_MAX_SNAPSHOT_SIZE)) * 1024;
+
+    std::vector<uint8> snapshot;
+    auto itr = std::ranges::find(_hibernatedGrids, ngrid.GetGridId(), &HibernatedGrid::GridId);
+    if (itr != _hibernatedGrids.end())
+    {
+        // grid was recreated but its objects were never loaded, the old snapshot is still the most recent one
+        _hibernatedSnapshotBytes -= itr->Snapshot.size();
+        if (!ngrid.isGridObjectDataLoaded())
+            snapshot = std::move(itr->Snapshot);
+
+        _hibernatedGrids.erase(itr);
+    }
+
+    if (ngrid.isGridObjectDataLoaded() && maxSnapshotBytes)
+    {
+        ByteBuffer data;
+        data << uint32(0);
+
+        GridSnapshotWriter writer(data);
+        TypeContainerVisitor<GridSnapshotWriter, GridTypeMapContainer> visitor(writer);
+        ngrid.VisitAllGrids(visitor);
+
+        if (writer.Count)
+        {
+            data.put<uint32>(0, writer.Count);
+            snapshot = std::move(data).Release();
+            snapshot.shrink_to_fit();
+        }
+    }
+
+    TC_LOG_DEBUG("maps", "Hibernating grid[{}, {}] for map {} ({} bytes snapshot)", ngrid.getX(), ngrid.getY(), GetId(), snapshot.size());
+
+    _hibernatedSnapshotBytes += snapshot.size();
+    _hibernatedGrids.push_back({ .GridId = ngrid.GetGridId(), .HoldsTerrain = true, .Snapshot = std::move(snapshot) });
+
+    ReleaseHibernatedGrids(maxGrids, maxSnapshotBytes);
+    return true;
+}
+
+void Map::ReviveHibernatedGrid(NGridType& ngrid)
+{
+    auto itr = std::ranges::find(_hibernatedGrids, ngrid.GetGridId(), &HibernatedGrid::GridId);
+    if (itr == _hibernatedGrids.end())
+        return;
+
+    ASSERT(!itr->HoldsTerrain);
+
+    _hibernatedSnapshotBytes -= itr->Snapshot.size();
+    ByteBuffer data(std::move(itr->Snapshot));
+    _hibernatedGrids.erase(itr);
+
+    if (data.empty())
+        return;
+
+    uint32 count = data.read<uint32>();
+    uint32 revived = 0;
+    for (uint32 i = 0; i < count; ++i)
+    {
+        ObjectGuid::LowType spawnId = data.read<uint64>();
+        Position pos;
+        pos.m_positionX = data.read<float>();
+        pos.m_positionY = data.read<float>();
+        pos.m_positionZ = data.read<float>();
+        pos.SetOrientation(data.read<float>());
+        uint64 health = data.read<uint64>();
+        int32 power = data.read<int32>();
+
+        for (auto const& [_, creature] : Trinity::Containers::MapEqualRange(_creatureBySpawnIdStore, spawnId))
+        {
+            if (!creature->IsAlive() || creature->IsInCombat())
+                continue;
+
+            creature->SetHealth(std::min(health, creature->GetMaxHealth()));
+            creature->SetPower(creature->GetPowerType(), power);
+
+            // creatures that left the grid were evacuated to their respawn position and start over from there
+            GridCoord gridCoord = Trinity::ComputeGridCoord(pos.GetPositionX(), pos.GetPositionY());
+            if (gridCoord.x_coord == uint32(ngrid.getX()) && gridCoord.y_coord == uint32(ngrid.getY()))
+                CreatureRelocation(creature, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), pos.GetOrientation());
+
+            ++revived;
+            break;
+        }
+    }
+
+    TC_LOG_DEBUG("maps", "Revived {} of {} creatures of hibernated grid[{}, {}] for map {}", revived, count, ngrid.getX(), ngrid.getY(), GetId());
+}
+
+void Map::ReleaseHibernatedGrids(std::size_t maxGrids, std::size_t maxSnapshotBytes)
+{
+    std::size_t heldGrids = std::ranges::count(_hibernatedGrids, true, &HibernatedGrid::HoldsTerrain);
+
+    // oldest hibernated grids are released first
+    for (auto itr = _hibernatedGrids.begin(); itr != _hibernatedGrids.end() && (heldGrids > maxGrids || _hibernatedSnapshotBytes > maxSnapshotBytes);)
+    {
+        if (_hibernatedSnapshotBytes > maxSnapshotBytes)
+        {
+            _hibernatedSnapshotBytes -= itr->Snapshot.size();
+            itr->Snapshot = { };
+        }
+
+        if (heldGrids > maxGrids && itr->HoldsTerrain)
+        {
+            GridCoord p((itr->GridId / MAX_NUMBER_OF_GRIDS), (itr->GridId % MAX_NUMBER_OF_GRIDS));
+            m_terrain->UnloadMap((MAX_NUMBER_OF_GRIDS - 1) - p.x_coord, (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord);
+            itr->HoldsTerrain = false;
+            --heldGrids;
+        }
+
+        if (!itr->HoldsTerrain && itr->Snapshot.empty())
+            itr = _hibernatedGrids.erase(itr);
+        else
+            ++itr;
+    }
 }
 
 void Map::GetFullTerrainStatusForPosition(PhaseShift const& phaseShift, float x, float y, float z, PositionFullTerrainStatus& data,
@@ -1727,6 +2711,11 @@ float Map::GetStaticHeight(PhaseShift const& phaseShift, float x, float y, float
     return m_terrain->GetStaticHeight(phaseShift, GetId(), x, y, z, checkVMap, maxSearchDist);
 }
 
+void Map::GetStaticHeight(PhaseShift const& phaseShift, std::span<Position const> positions, std::vector<float>& heights, bool checkVMap, float maxSearchDist)
+{
+    m_terrain->GetStaticHeight(phaseShift, GetId(), positions, heights, checkVMap, maxSearchDist);
+}
+
 float Map::GetWaterLevel(PhaseShift const& phaseShift, float x, float y)
 {
     return m_terrain->GetWaterLevel(phaseShift, GetId(), x, y);
@@ -1749,15 +2738,103 @@ float Map::GetWaterOrGroundLevel(PhaseShift const& phaseShift, float x, float y,
 
 bool Map::isInLineOfSight(PhaseShift const& phaseShift, float x1, float y1, float z1, float x2, float y2, float z2, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
-    if ((checks & LINEOFSIGHT_CHECK_VMAP)
-      && !VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(PhasingHandler::GetTerrainMapId(phaseShift, GetId(), m_terrain.get(), x1, y1), x1, y1, z1, x2, y2, z2, ignoreFlags))
+    bool checkStatic = (checks & LINEOFSIGHT_CHECK_VMAP) != 0;
+    bool checkDynamic = sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT);
+    if (!checkStatic && !checkDynamic)
+        return true;
+
+    uint32 terrainMapId = PhasingHandler::GetTerrainMapId(phaseShift, GetId(), m_terrain.get(), x1, y1);
+    auto staticCheck = [&]
+    {
+        return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(terrainMapId, x1, y1, z1, x2, y2, z2, ignoreFlags);
+    };
+    auto dynamicCheck = [&]
+    {
+        return _dynamicTree.isInLineOfSight({ x1, y1, z1 }, { x2, y2, z2 }, phaseShift);
+    };
+
+    if (_lineOfSightCache)
+        return _lineOfSightCache->IsInLineOfSight(_lineOfSightCache->MakeKey(phaseShift, terrainMapId, uint32(ignoreFlags), x1, y1, z1, x2, y2, z2),
+            checkStatic, checkDynamic, staticCheck, dynamicCheck);
+
+    if (checkStatic && !staticCheck())
         return false;
-    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT)
-      && !_dynamicTree.isInLineOfSight({ x1, y1, z1 }, { x2, y2, z2 }, phaseShift))
+    if (checkDynamic && !dynamicCheck())
         return false;
     return true;
 }
 
+void Map::isInLineOfSight(std::span<LineOfSightQuery const> queries, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, std::vector<bool>& results) const
+{
+    results.assign(queries.size(), true);
+    bool checkStatic = (checks & LINEOFSIGHT_CHECK_VMAP) != 0;
+    bool checkDynamic = sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT);
+    if (!checkStatic && !checkDynamic)
+        return;
+
+    // cached rays are answered without touching the trees, the cache is consulted per ray
+    if (_lineOfSightCache)
+    {
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            LineOfSightQuery const& query = queries[i];
+            results[i] = isInLineOfSight(*query.Phases, query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2, checks, ignoreFlags);
+        }
+        return;
+    }
+
+    if (checkStatic)
+    {
+        std::vector<uint32> terrainMapIds(queries.size());
+        for (std::size_t i = 0; i < queries.size(); ++i)
+            terrainMapIds[i] = PhasingHandler::GetTerrainMapId(*queries[i].Phases, GetId(), m_terrain.get(), queries[i].X1, queries[i].Y1);
+
+        // terrain swaps change per grid, rays of a batch nearly always share a single terrain map
+        std::vector<uint32> distinctTerrainMapIds = terrainMapIds;
+        std::sort(distinctTerrainMapIds.begin(), distinctTerrainMapIds.end());
+        distinctTerrainMapIds.erase(std::unique(distinctTerrainMapIds.begin(), distinctTerrainMapIds.end()), distinctTerrainMapIds.end());
+
+        VMAP::VMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
+        std::vector<std::size_t> indices;
+        std::vector<VMAP::LineOfSightRay> rays;
+        std::vector<bool> terrainResults;
+        for (uint32 terrainMapId : distinctTerrainMapIds)
+        {
+            indices.clear();
+            rays.clear();
+            for (std::size_t i = 0; i < queries.size(); ++i)
+            {
+                if (terrainMapIds[i] != terrainMapId)
+                    continue;
+
+                LineOfSightQuery const& query = queries[i];
+                indices.push_back(i);
+                rays.push_back({ .X1 = query.X1, .Y1 = query.Y1, .Z1 = query.Z1, .X2 = query.X2, .Y2 = query.Y2, .Z2 = query.Z2 });
+            }
+
+            vmgr->isInLineOfSight(terrainMapId, rays, ignoreFlags, terrainResults);
+            for (std::size_t j = 0; j < indices.size(); ++j)
+                results[indices[j]] = terrainResults[j];
+        }
+    }
+
+    if (checkDynamic)
+    {
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            LineOfSightQuery const& query = queries[i];
+            if (results[i])
+                results[i] = _dynamicTree.isInLineOfSight({ query.X1, query.Y1, query.Z1 }, { query.X2, query.Y2, query.Z2 }, *query.Phases);
+        }
+    }
+}
+
+void Map::InvalidateDynamicLineOfSight()
+{
+    if (_lineOfSightCache)
+        _lineOfSightCache->InvalidateDynamic();
+}
+
 bool Map::getObjectHitPos(PhaseShift const& phaseShift, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -1800,6 +2877,10 @@ TransferAbortParams Map::PlayerCannotEnter(uint32 mapid, Player* player)
     if (!entry)
         return TRANSFER_ABORT_MAP_NOT_ALLOWED;
 
+    // runs on another node
+    if (!sMapMgr->IsMapHosted(mapid))
+        return TRANSFER_ABORT_MAP_NOT_ALLOWED;
+
     if (!entry->IsDungeon())
         return TRANSFER_ABORT_NONE;
 
@@ -1963,23 +3044,45 @@ inline void Map::setNGrid(NGridType *grid, uint32 x, uint32 y)
 
 void Map::SendObjectUpdates()
 {
+    TC_PROFILE_ZONE("Map::SendObjectUpdates");
+    if (_updateObjects.empty())
+        return;
+
     UpdateDataMapType update_players;
+    update_players.reserve(m_mapRefManager.size());
+
+    // receivers are almost always players of this map, give them pooled buffers upfront
+    for (MapReference const& ref : m_mapRefManager)
+        update_players.try_emplace(ref.GetSource(), GetId(), _updateDataPool->AcquireStorage());
 
+    std::unordered_set<Object*> updateObjects;
     while (!_updateObjects.empty())
     {
-        Object* obj = *_updateObjects.begin();
-        ASSERT(obj->IsInWorld());
-        _updateObjects.erase(_updateObjects.begin());
-        obj->BuildUpdate(update_players);
+        // objects queued while building updates are picked up by the next batch
+        updateObjects.swap(_updateObjects);
+        for (Object* obj : updateObjects)
+        {
+            ASSERT(obj->IsInWorld());
+            obj->BuildUpdate(update_players);
+        }
+
+        updateObjects.clear();
     }
 
-    WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
+    WorldPacket packet(_updateDataPool->AcquireStorage(), CONNECTION_TYPE_DEFAULT);
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
-        iter->second.BuildPacket(&packet);
-        iter->first->SendDirectMessage(&packet);
-        packet.clear();                                     // clean the string
+        if (iter->second.HasData())
+        {
+            iter->second.BuildPacket(&packet);
+            iter->first->SendDirectMessage(&packet);
+            packet.clear();                                 // clean the string
+        }
+
+        _updateDataPool->ReleaseStorage(iter->second.ReleaseStorage());
     }
+
+    _updateDataPool->ReleaseStorage(std::move(packet).Release());
 }
 
 // CheckRespawn MUST do one of the following:
@@ -2062,7 +3165,7 @@ void Map::Respawn(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
     if (info->respawnTime <= GameTime::GetGameTime())
         return;
     info->respawnTime = GameTime::GetGameTime();
-    _respawnTimes->increase(static_cast<RespawnInfoWithHandle*>(info)->handle);
+    _respawnTimes->Schedule(static_cast<RespawnInfoWithHandle*>(info));
     SaveRespawnInfoDB(*info, dbTrans);
 }
 
@@ -2091,6 +3194,8 @@ size_t Map::DespawnAll(SpawnObjectType type, ObjectGuid::LowType spawnId)
 
 bool Map::AddRespawnInfo(RespawnInfo const& info)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     if (!info.spawnId)
     {
         TC_LOG_ERROR("maps", "Attempt to insert respawn info for zero spawn id (type {})", uint32(info.type));
@@ -2119,7 +3224,7 @@ bool Map::AddRespawnInfo(RespawnInfo const& info)
         ABORT_MSG("Invalid respawn info for spawn id (%u," UI64FMTD ") being inserted", uint32(info.type), info.spawnId);
 
     RespawnInfoWithHandle* ri = new RespawnInfoWithHandle(info);
-    ri->handle = _respawnTimes->push(ri);
+    _respawnTimes->Schedule(ri);
     bySpawnIdMap->emplace(ri->spawnId, ri);
     return true;
 }
@@ -2152,15 +3257,19 @@ RespawnInfo* Map::GetRespawnInfo(SpawnObjectType type, ObjectGuid::LowType spawn
 
 void Map::UnloadAllRespawnInfos() // delete everything from memory
 {
-    for (RespawnInfo* info : *_respawnTimes)
+    _respawnTimes->Clear();
+    for (auto const& [spawnId, info] : _creatureRespawnTimesBySpawnId)
+        delete info;
+    for (auto const& [spawnId, info] : _gameObjectRespawnTimesBySpawnId)
         delete info;
-    _respawnTimes->clear();
     _creatureRespawnTimesBySpawnId.clear();
     _gameObjectRespawnTimesBySpawnId.clear();
 }
 
 void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     // Delete from all relevant containers to ensure consistency
     ASSERT(info);
 
@@ -2174,8 +3283,8 @@ void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTr
     ASSERT(it != range.second, "Respawn stores inconsistent for map %u, spawnid " UI64FMTD " (type %u)", GetId(), info->spawnId, uint32(info->type));
     spawnMap->erase(it);
 
-    // respawn heap
-    _respawnTimes->erase(static_cast<RespawnInfoWithHandle*>(info)->handle);
+    // respawn queue
+    _respawnTimes->Cancel(static_cast<RespawnInfoWithHandle*>(info));
 
     // database
     DeleteRespawnInfoFromDB(info->type, info->spawnId, dbTrans);
@@ -2225,17 +3334,14 @@ void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gr
 
 void Map::ProcessRespawns()
 {
+    TC_PROFILE_ZONE("Map::ProcessRespawns");
     time_t now = GameTime::GetGameTime();
-    while (!_respawnTimes->empty())
+    // entries are taken out of the queue as they become due, only those are visited
+    while (RespawnInfoWithHandle* next = _respawnTimes->PopExpired(uint64(now)))
     {
-        RespawnInfoWithHandle* next = _respawnTimes->top();
-        if (now < next->respawnTime) // done for this tick
-            break;
-
         if (uint32 poolId = sPoolMgr->IsPartOfAPool(next->type, next->spawnId)) // is this part of a pool?
         { // if yes, respawn will be handled by (external) pooling logic, just delete the respawn time
             // step 1: remove entry from maps to avoid it being reachable by outside logic
-            _respawnTimes->pop();
             ASSERT_NOTNULL(GetRespawnMapForType(next->type))->erase(next->spawnId);
 
             // step 2: tell pooling logic to do its thing
@@ -2248,7 +3354,6 @@ void Map::ProcessRespawns()
         else if (CheckRespawn(next)) // see if we're allowed to respawn
         { // ok, respawn
             // step 1: remove entry from maps to avoid it being reachable by outside logic
-            _respawnTimes->pop();
             ASSERT_NOTNULL(GetRespawnMapForType(next->type))->erase(next->spawnId);
 
             // step 2: do the respawn, which involves external logic
@@ -2260,15 +3365,14 @@ void Map::ProcessRespawns()
         }
         else if (!next->respawnTime)
         { // just remove this respawn entry without rescheduling
-            _respawnTimes->pop();
             ASSERT_NOTNULL(GetRespawnMapForType(next->type))->erase(next->spawnId);
             RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
             delete next;
         }
         else
-        { // new respawn time, update heap position
+        { // new respawn time, put it back in the queue
             ASSERT(now < next->respawnTime); // infinite loop guard
-            _respawnTimes->decrease(next->handle);
+            _respawnTimes->Schedule(next);
             SaveRespawnInfoDB(*next);
         }
     }
@@ -2302,10 +3406,7 @@ void Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::Low
     if (!(data->spawnGroupData->flags & SPAWNGROUP_FLAG_DYNAMIC_SPAWN_RATE))
         return;
 
-    auto it = _zonePlayerCountMap.find(obj->GetZoneId());
-    if (it == _zonePlayerCountMap.end())
-        return;
-    uint32 const playerCount = it->second;
+    uint32 const playerCount = GetZonePlayers(obj->GetZoneId()).size();
     if (!playerCount)
         return;
     double const adjustFactor = sWorld->getFloatConfig(type == SPAWN_TYPE_GAMEOBJECT ? CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT : CONFIG_RESPAWN_DYNAMICRATE_CREATURE) / playerCount;
@@ -2503,6 +3604,24 @@ void Map::InitSpawnGroupState()
     }
 }
 
+void Map::InvalidateAllSpawnGroupConditions()
+{
+    ++SpawnGroupConditionGeneration;
+}
+
+bool Map::ConsumeSpawnGroupConditionChanges()
+{
+    uint32 generation = SpawnGroupConditionGeneration.load(std::memory_order_relaxed);
+    time_t now = GameTime::GetGameTime();
+    if (!_spawnGroupConditionsChanged && generation == _spawnGroupConditionGeneration && now < _nextSpawnGroupConditionCheck)
+        return false;
+
+    _spawnGroupConditionsChanged = false;
+    _spawnGroupConditionGeneration = generation;
+    _nextSpawnGroupConditionCheck = now + SPAWN_GROUP_CONDITION_RECHECK_INTERVAL;
+    return true;
+}
+
 void Map::UpdateSpawnGroupConditions()
 {
     std::vector<uint32> const* spawnGroups = sObjectMgr->GetSpawnGroupsForMap(GetId());
@@ -2577,6 +3696,8 @@ void Map::DelayedUpdate(uint32 t_diff)
 
 void Map::AddObjectToRemoveList(WorldObject* obj)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
     obj->SetDestroyedObject(true);
@@ -2587,6 +3708,8 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 
 void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
     // i_objectsToSwitch is iterated only in Map::RemoveAllObjectsInRemoveList() and it uses
     // the contained objects only if GetTypeId() == TYPEID_UNIT , so we can return in all other cases
@@ -2740,6 +3863,8 @@ void Map::RemoveWorldObject(WorldObject* obj)
 
 void Map::AddToActive(WorldObject* obj)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     m_activeNonPlayers.insert(obj);
 
     Optional<Position> respawnLocation;
@@ -2773,6 +3898,8 @@ void Map::AddToActive(WorldObject* obj)
 
 void Map::RemoveFromActive(WorldObject* obj)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     // Map::Update for active object in proccess
     if (m_activeNonPlayersIter != m_activeNonPlayers.end())
     {
@@ -3022,10 +4149,10 @@ void InstanceMap::CreateInstanceData()
 
     InstanceLockData const* lockData = i_instanceLock->GetInstanceInitializationData();
     i_data->SetEntranceLocation(lockData->EntranceWorldSafeLocId);
-    if (!lockData->Data.empty())
+    if (!lockData->Data->empty())
     {
         TC_LOG_DEBUG("maps", "Loading instance data for `{}` with id {}", sObjectMgr->GetScriptName(i_script_id), i_InstanceId);
-        i_data->Load(lockData->Data.c_str());
+        i_data->Load(lockData->Data->c_str());
     }
     else
         i_data->Create();
@@ -3125,6 +4252,16 @@ void InstanceMap::SetInstanceScenario(InstanceScenario* scenario)
     }
 }
 
+template<typename Update>
+static std::shared_ptr<std::string const> GetUpdatedSaveData(std::unordered_map<std::string, std::shared_ptr<std::string const>>& updatedSaveData, std::string const* oldData, Update update)
+{
+    auto [itr, inserted] = updatedSaveData.try_emplace(oldData ? *oldData : std::string());
+    if (inserted)
+        itr->second = std::make_shared<std::string const>(update(itr->first));
+
+    return itr->second;
+}
+
 void InstanceMap::UpdateInstanceLock(UpdateBossStateSaveDataEvent const& updateSaveDataEvent)
 {
     if (i_instanceLock)
@@ -3136,9 +4273,13 @@ void InstanceMap::UpdateInstanceLock(UpdateBossStateSaveDataEvent const& updateS
         CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
         if (entries.IsInstanceIdBound())
-            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), i_data->GetSaveData(),
+            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), std::make_shared<std::string const>(i_data->GetSaveData()),
                 instanceCompletedEncounters, updateSaveDataEvent.DungeonEncounter, i_data->GetEntranceLocationForCompletedEncounters(instanceCompletedEncounters)));
 
+        // players saved together share their data, it is updated only once for each version of it
+        std::unordered_map<std::string, std::shared_ptr<std::string const>> updatedSaveData;
+        CharacterDatabasePreparedStatement* lockStmt = nullptr;
+
         for (MapReference& mapReference : m_mapRefManager)
         {
             Player* player = mapReference.GetSource();
@@ -3151,15 +4292,15 @@ void InstanceMap::UpdateInstanceLock(UpdateBossStateSaveDataEvent const& updateS
             uint32 playerCompletedEncounters = 0;
             if (playerLock)
             {
-                oldData = &playerLock->GetData()->Data;
+                oldData = playerLock->GetData()->Data.get();
                 playerCompletedEncounters = playerLock->GetData()->CompletedEncountersMask | (1u << updateSaveDataEvent.DungeonEncounter->Bit);
             }
 
             bool isNewLock = !playerLock || playerLock->IsNew() || playerLock->IsExpired();
 
             InstanceLock const* newLock = sInstanceLockMgr.UpdateInstanceLockForPlayer(trans, player->GetGUID(), entries,
-                InstanceLockUpdateEvent(GetInstanceId(), i_data->UpdateBossStateSaveData(oldData ? *oldData : "", updateSaveDataEvent),
-                    instanceCompletedEncounters, updateSaveDataEvent.DungeonEncounter, i_data->GetEntranceLocationForCompletedEncounters(playerCompletedEncounters)));
+                InstanceLockUpdateEvent(GetInstanceId(), GetUpdatedSaveData(updatedSaveData, oldData, [&](std::string const& data) { return i_data->UpdateBossStateSaveData(data, updateSaveDataEvent); }),
+                    instanceCompletedEncounters, updateSaveDataEvent.DungeonEncounter, i_data->GetEntranceLocationForCompletedEncounters(playerCompletedEncounters)), &lockStmt);
 
             if (isNewLock)
             {
@@ -3171,6 +4312,9 @@ void InstanceMap::UpdateInstanceLock(UpdateBossStateSaveDataEvent const& updateS
             }
         }
 
+        if (lockStmt)
+            trans->Append(lockStmt);
+
         CharacterDatabase.CommitTransaction(trans);
     }
 }
@@ -3186,9 +4330,12 @@ void InstanceMap::UpdateInstanceLock(UpdateAdditionalSaveDataEvent const& update
         CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
         if (entries.IsInstanceIdBound())
-            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), i_data->GetSaveData(),
+            sInstanceLockMgr.UpdateSharedInstanceLock(trans, InstanceLockUpdateEvent(GetInstanceId(), std::make_shared<std::string const>(i_data->GetSaveData()),
                 instanceCompletedEncounters, nullptr, {}));
 
+        std::unordered_map<std::string, std::shared_ptr<std::string const>> updatedSaveData;
+        CharacterDatabasePreparedStatement* lockStmt = nullptr;
+
         for (MapReference& mapReference : m_mapRefManager)
         {
             Player* player = mapReference.GetSource();
@@ -3199,13 +4346,13 @@ void InstanceMap::UpdateInstanceLock(UpdateAdditionalSaveDataEvent const& update
             InstanceLock const* playerLock = sInstanceLockMgr.FindActiveInstanceLock(player->GetGUID(), entries);
             std::string const* oldData = nullptr;
             if (playerLock)
-                oldData = &playerLock->GetData()->Data;
+                oldData = playerLock->GetData()->Data.get();
 
             bool isNewLock = !playerLock || playerLock->IsNew() || playerLock->IsExpired();
 
             InstanceLock const* newLock = sInstanceLockMgr.UpdateInstanceLockForPlayer(trans, player->GetGUID(), entries,
-                InstanceLockUpdateEvent(GetInstanceId(), i_data->UpdateAdditionalSaveData(oldData ? *oldData : "", updateSaveDataEvent),
-                    instanceCompletedEncounters, nullptr, {}));
+                InstanceLockUpdateEvent(GetInstanceId(), GetUpdatedSaveData(updatedSaveData, oldData, [&](std::string const& data) { return i_data->UpdateAdditionalSaveData(data, updateSaveDataEvent); }),
+                    instanceCompletedEncounters, nullptr, {}), &lockStmt);
 
             if (isNewLock)
             {
@@ -3217,6 +4364,9 @@ void InstanceMap::UpdateInstanceLock(UpdateAdditionalSaveDataEvent const& update
             }
         }
 
+        if (lockStmt)
+            trans->Append(lockStmt);
+
         CharacterDatabase.CommitTransaction(trans);
     }
 }
@@ -3231,7 +4381,7 @@ void InstanceMap::CreateInstanceLockForPlayer(Player* player)
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
     InstanceLock const* newLock = sInstanceLockMgr.UpdateInstanceLockForPlayer(trans, player->GetGUID(), entries,
-        InstanceLockUpdateEvent(GetInstanceId(), i_data->GetSaveData(), i_instanceLock->GetData()->CompletedEncountersMask, nullptr, {}));
+        InstanceLockUpdateEvent(GetInstanceId(), std::make_shared<std::string const>(i_data->GetSaveData()), i_instanceLock->GetData()->CompletedEncountersMask, nullptr, {}));
 
     CharacterDatabase.CommitTransaction(trans);
 
@@ -3809,6 +4959,8 @@ void Map::DeleteCorpseData()
 
 void Map::AddCorpse(Corpse* corpse)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     corpse->SetMap(this);
 
     _corpsesByCell[corpse->GetCellCoord().GetId()].insert(corpse);
@@ -3820,6 +4972,8 @@ void Map::AddCorpse(Corpse* corpse)
 
 void Map::RemoveCorpse(Corpse* corpse)
 {
+    auto islandLock = AcquireIslandSharedLock();
+
     ASSERT(corpse);
 
     corpse->UpdateObjectVisibilityOnDestroy();
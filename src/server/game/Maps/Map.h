@@ -27,6 +27,7 @@
 #include "GridRefManager.h"
 #include "GroupInstanceReference.h"
 #include "MapDefines.h"
+#include "MapMoveList.h"
 #include "MapReference.h"
 #include "MapRefManager.h"
 #include "MPSCQueue.h"
@@ -39,29 +40,40 @@
 #include "UniqueTrackablePtr.h"
 #include "WorldStateDefines.h"
 #include <bitset>
+#include <chrono>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <span>
 #include <unordered_set>
 
 class Battleground;
 class BattlegroundMap;
 class BattlegroundScript;
+class AdaptiveVisibility;
+class ByteBuffer;
 class CreatureGroup;
 class GameObjectModel;
+class GridPreloader;
+class LineOfSightCache;
+class MovementRelay;
 class Group;
 class InstanceLock;
 class InstanceMap;
 class InstanceScript;
 class InstanceScenario;
 class Object;
+class PathCorridorCache;
+class PathGenerator;
 class PhaseShift;
 class Player;
 class SpawnedPoolData;
 class TempSummon;
 class TerrainInfo;
 class Unit;
+class UpdateDataPool;
 class Weather;
 class WorldObject;
 class WorldPacket;
@@ -84,6 +96,7 @@ namespace Trinity { struct ObjectUpdater; }
 namespace Vignettes { struct VignetteData; }
 namespace VMAP { enum class ModelIgnoreFlags : uint32; }
 namespace MMAP { class DynamicTileBuilder; }
+namespace Movement { class MoveSplineBatch; }
 
 enum TransferAbortReason : uint32
 {
@@ -152,14 +165,18 @@ struct ZoneDynamicInfo
     std::vector<LightOverride> LightOverrides;
 };
 
+// Segment checked by the batched Map::isInLineOfSight, phases are those of the object looking from X1, Y1, Z1
+struct LineOfSightQuery
+{
+    PhaseShift const* Phases;
+    float X1, Y1, Z1;
+    float X2, Y2, Z2;
+};
+
 #define MIN_UNLOAD_DELAY      1                             // immediate unload
 #define MAP_INVALID_ZONE      0xFFFFFFFF
 
 struct RespawnInfo; // forward declaration
-struct CompareRespawnInfo
-{
-    bool operator()(RespawnInfo const* a, RespawnInfo const* b) const;
-};
 using ZoneDynamicInfoMap = std::unordered_map<uint32 /*zoneId*/, ZoneDynamicInfo>;
 struct RespawnListContainer;
 using RespawnInfoMap = std::unordered_map<ObjectGuid::LowType, RespawnInfo*>;
@@ -173,17 +190,6 @@ struct TC_GAME_API RespawnInfo
     time_t respawnTime;
     uint32 gridId;
 };
-inline bool CompareRespawnInfo::operator()(RespawnInfo const* a, RespawnInfo const* b) const
-{
-    if (a == b)
-        return false;
-    if (a->respawnTime != b->respawnTime)
-        return (a->respawnTime > b->respawnTime);
-    if (a->spawnId != b->spawnId)
-        return a->spawnId < b->spawnId;
-    ASSERT(a->type != b->type, "Duplicate respawn entry for spawnId (%u," UI64FMTD ") found!", a->type, a->spawnId);
-    return a->type < b->type;
-}
 
 template <typename ObjectType>
 struct MapStoredObjectsUnorderedMap
@@ -248,7 +254,6 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         template<class T> bool AddToMap(T *);
         template<class T> void RemoveFromMap(T *, bool);
 
-        void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
         virtual void Update(uint32);
 
         float GetVisibilityRange() const { return m_VisibleDistance; }
@@ -256,11 +261,14 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         virtual void InitVisibilityDistance();
 
         void PlayerRelocation(Player*, float x, float y, float z, float orientation);
-        void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail = true);
+        void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail = true, bool updateVisibility = true);
         void GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail = true);
         void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float orientation);
         void AreaTriggerRelocation(AreaTrigger* at, float x, float y, float z, float orientation);
 
+        // sum of the unit move counters of the cells within radius of center, changes when a unit enters any of them or moves inside them
+        uint32 GetUnitMoveCounter(WorldObject const* center, float radius) const;
+
         template<class T, class CONTAINER>
         void Visit(Cell const& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
 
@@ -296,6 +304,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         static void DeleteStateMachine();
 
         TerrainInfo* GetTerrain() const { return m_terrain.get(); }
+        // null unless MapUpdate.MovementRelay.Window is set
+        MovementRelay* GetMovementRelay() const { return _movementRelay.get(); }
 
         // custom PathGenerator include and exclude filter flags
         // these modify what kind of terrain types are available in current instance
@@ -322,6 +332,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         float GetGridHeight(PhaseShift const& phaseShift, float x, float y);
         float GetStaticHeight(PhaseShift const& phaseShift, float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH);
         float GetStaticHeight(PhaseShift const& phaseShift, Position const& pos, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) { return GetStaticHeight(phaseShift, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), checkVMap, maxSearchDist); }
+        void GetStaticHeight(PhaseShift const& phaseShift, std::span<Position const> positions, std::vector<float>& heights, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH);
         float GetHeight(PhaseShift const& phaseShift, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) { return std::max<float>(GetStaticHeight(phaseShift, x, y, z, vmap, maxSearchDist), GetGameObjectFloor(phaseShift, x, y, z, maxSearchDist)); }
         float GetHeight(PhaseShift const& phaseShift, Position const& pos, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) { return GetHeight(phaseShift, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), vmap, maxSearchDist); }
 
@@ -385,10 +396,19 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void AddObjectToSwitchList(WorldObject* obj, bool on);
         virtual void DelayedUpdate(uint32 diff);
 
-        void resetMarkedCells() { marked_cells.reset(); }
         bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
         void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
 
+        // cells within visibility range (or MapUpdate.ReducedRate.Distance) of a player or their viewpoint, only tracked while reduced rate updates are enabled
+        bool IsCellObservedByPlayers(uint32 cellId) const { return observed_cells.test(cellId); }
+
+        void RecordVisibilityScan(bool incremental, uint32 skipped, uint32 mismatches)
+        {
+            ++(incremental ? _visibilityScanStats.Incremental : _visibilityScanStats.Full);
+            _visibilityScanStats.Skipped += skipped;
+            _visibilityScanStats.Mismatches += mismatches;
+        }
+
         bool HavePlayers() const { return !m_mapRefManager.empty(); }
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(NGridType const& ngrid) const;
@@ -401,6 +421,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         typedef MapRefManager PlayerList;
         PlayerList const& GetPlayers() const { return m_mapRefManager; }
 
+        // players by the zone of their last Player::UpdateZone, in no particular order
+        std::span<Player* const> GetZonePlayers(uint32 zoneId) const;
+
         template <typename T>
         void DoOnPlayers(T&& fn)
         {
@@ -493,9 +516,32 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         BattlegroundMap const* ToBattlegroundMap() const { if (IsBattlegroundOrArena()) return reinterpret_cast<BattlegroundMap const*>(this); return nullptr; }
 
         bool isInLineOfSight(PhaseShift const& phaseShift, float x1, float y1, float z1, float x2, float y2, float z2, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        // results[i] tells whether queries[i] is in line of sight, the static trees are searched once per terrain map
+        void isInLineOfSight(std::span<LineOfSightQuery const> queries, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, std::vector<bool>& results) const;
         void Balance() { _dynamicTree.balance(); }
-        void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); }
-        void InsertGameObjectModel(GameObjectModel const& model) { _dynamicTree.insert(model); }
+        void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); InvalidateDynamicLineOfSight(); }
+        void InsertGameObjectModel(GameObjectModel const& model) { _dynamicTree.insert(model); InvalidateDynamicLineOfSight(); }
+        // drops cached gameobject line of sight results, called when a model changes without leaving the tree
+        void InvalidateDynamicLineOfSight();
+
+        // Queues the relocation check of creature against unit while ProcessRelocationNotifies collects them, false if it has to run now
+        bool DeferAggroCheck(Creature* creature, Unit* unit)
+        {
+            if (!_deferAggroChecks)
+                return false;
+
+            _deferredAggroChecks.emplace_back(creature, unit);
+            return true;
+        }
+
+        // Queues the search of path to run once the objects of the map were updated (MapUpdate.AsyncPathfinding.MinRequests), false if it has to run now
+        bool QueuePathCalculation(PathGenerator* path);
+        void CancelPathCalculation(PathGenerator* path);
+        // Corridors of recent path searches shared by creatures heading to the same polygon (MapUpdate.PathCorridorCache.Duration), null if disabled
+        PathCorridorCache* GetPathCorridorCache() const { return _pathCorridorCache.get(); }
+
+        // Linear creature splines advanced together before the objects are updated (MapUpdate.SplineBatch), null if disabled
+        Movement::MoveSplineBatch* GetMoveSplineBatch() const { return _moveSplineBatch.get(); }
         bool ContainsGameObjectModel(GameObjectModel const& model) const { return _dynamicTree.contains(model);}
         std::span<GameObjectModel const* const> GetGameObjectModelsInGrid(uint32 gx, uint32 gy) const { return _dynamicTree.getModelsInGrid(gx, gy); }
         float GetGameObjectFloor(PhaseShift const& phaseShift, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
@@ -523,7 +569,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         time_t GetCreatureRespawnTime(ObjectGuid::LowType spawnId) const { return GetRespawnTime(SPAWN_TYPE_CREATURE, spawnId); }
         time_t GetGORespawnTime(ObjectGuid::LowType spawnId) const { return GetRespawnTime(SPAWN_TYPE_GAMEOBJECT, spawnId); }
 
-        void UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone);
+        void UpdatePlayerZoneStats(Player* player, uint32 oldZone, uint32 newZone);
 
         void SaveRespawnTime(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 entry, time_t respawnTime, uint32 gridId, CharacterDatabaseTransaction dbTrans = nullptr, bool startup = false);
         void SaveRespawnInfoDB(RespawnInfo const& info, CharacterDatabaseTransaction dbTrans = nullptr);
@@ -557,6 +603,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         inline ObjectGuid::LowType GenerateLowGuid()
         {
             static_assert(ObjectGuidTraits<high>::SequenceSource.HasFlag(ObjectGuidSequenceSource::Map), "Only map specific guid can be generated in Map context");
+            auto islandLock = AcquireIslandSharedLock();
             return GetGuidSequenceGenerator(high).Generate();
         }
 
@@ -569,19 +616,31 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         void AddUpdateObject(Object* obj)
         {
+            auto islandLock = AcquireIslandSharedLock();
             _updateObjects.insert(obj);
         }
 
         void RemoveUpdateObject(Object* obj)
         {
+            auto islandLock = AcquireIslandSharedLock();
             _updateObjects.erase(obj);
         }
 
+        UpdateDataPool& GetUpdateDataPool() { return *_updateDataPool; }
+
+        // values of create blocks shared between the viewers of an object, see Object::BuildCreateUpdateBlockForPlayer
+        bool AppendCreateValuesBlock(ByteBuffer& data, ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey);
+        void StoreCreateValuesBlock(ObjectGuid const& guid, uint64 generation, uint8 fieldFlags, std::span<uint8 const> viewerKey, std::span<uint8 const> values);
+
         size_t GetActiveNonPlayersCount() const
         {
             return m_activeNonPlayers.size();
         }
 
+        // duration of the last Update call and whether it went over MapUpdate.TickBudget
+        uint32 GetLastUpdateTime() const { return _lastUpdateTime; }
+        bool IsLastUpdateOverBudget() const { return _lastUpdateOverBudget; }
+
         virtual std::string GetDebugInfo() const;
 
     private:
@@ -609,16 +668,16 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void RemoveAreaTriggerFromMoveList(AreaTrigger* at);
 
         bool _creatureToMoveLock;
-        std::vector<Creature*> _creaturesToMove;
+        Trinity::MapMoveList<Creature> _creaturesToMove;
 
         bool _gameObjectsToMoveLock;
-        std::vector<GameObject*> _gameObjectsToMove;
+        Trinity::MapMoveList<GameObject> _gameObjectsToMove;
 
         bool _dynamicObjectsToMoveLock;
-        std::vector<DynamicObject*> _dynamicObjectsToMove;
+        Trinity::MapMoveList<DynamicObject> _dynamicObjectsToMove;
 
         bool _areaTriggersToMoveLock;
-        std::vector<AreaTrigger*> _areaTriggersToMove;
+        Trinity::MapMoveList<AreaTrigger> _areaTriggersToMove;
 
         bool IsGridLoaded(GridCoord const&) const;
         void EnsureGridCreated(GridCoord const&);
@@ -686,6 +745,104 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        std::vector<uint32> _activeCells;   // cells marked in marked_cells, in collection order
+        std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> observed_cells;
+        std::vector<uint32> _observedCells; // cells set in observed_cells
+
+        void MarkCellsObservedBy(WorldObject const* obj, float range);
+
+        // player relocation visibility scans since the last ProcessRelocationNotifies report
+        struct VisibilityScanStats
+        {
+            uint32 Full = 0;
+            uint32 Incremental = 0;
+            uint32 Skipped = 0;     // objects left alone by incremental scans
+            uint32 Mismatches = 0;  // skipped objects whose visibility should have changed (Visibility.Incremental = 2)
+        } _visibilityScanStats;
+
+        // calls worker for every object that keeps cells around it active
+        template<typename Worker>
+        void VisitCellActivatorsOf(Player* player, Worker&& worker);
+        // appends cells in grid activation range of obj that were not marked yet, returns number of cells in range
+        uint32 CollectNearbyCellsOf(WorldObject const* obj, std::vector<uint32>& cells);
+        void UpdateCell(uint32 cellId, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer>& gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer>& worldVisitor);
+
+        // parallel update of independent cell islands (MapUpdate.IslandThreads)
+        bool CanUpdateCellIslandsInParallel() const;
+        void UpdateCellIslands(uint32 diff, std::vector<uint32> const& cells, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
+            TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer>& worldVisitor);
+
+        // schedules terrain preloads for grids players are heading to (MapUpdate.GridPreload.Threads)
+        void PredictGridPreloads(uint32 diff);
+        void SchedulePreloadsAround(float x, float y);
+
+        std::unique_ptr<GridPreloader> _gridPreloader;
+        uint32 _gridPreloadTimer;
+
+        // batches movement heartbeats relayed to observers (MapUpdate.MovementRelay.Window)
+        void UpdateMovementRelay(uint32 diff);
+
+        std::unique_ptr<MovementRelay> _movementRelay;
+        uint32 _movementRelayReportTimer;
+
+        // lowers the visibility distance while the map is overloaded (Visibility.Adaptive.*)
+        void UpdateAdaptiveVisibility(uint32 diff);
+
+        std::unique_ptr<AdaptiveVisibility> _adaptiveVisibility;
+
+        // short lived line of sight results (MapUpdate.LineOfSightCache.Duration)
+        void UpdateLineOfSightCache(uint32 diff);
+
+        // aggro checks of relocation notifies, their rays are cast on the job system into the line of sight cache
+        // before the checks run on the map thread (MapUpdate.ParallelAggroChecks.MinPairs)
+        void ProcessDeferredAggroChecks();
+
+        std::vector<std::pair<Creature*, Unit*>> _deferredAggroChecks;
+        bool _deferAggroChecks;
+
+        // path searches of movement generators, run in parallel with the map thread waiting for them
+        void ProcessQueuedPathCalculations();
+
+        struct QueuedPathCalculation
+        {
+            PathGenerator* Path;        // null once cancelled
+            std::chrono::steady_clock::time_point QueueTime;
+        };
+
+        std::vector<QueuedPathCalculation> _queuedPathCalculations;
+
+        // polygon corridors of recent path searches (MapUpdate.PathCorridorCache.Duration)
+        void UpdatePathCorridorCache(uint32 diff);
+
+        std::unique_ptr<PathCorridorCache> _pathCorridorCache;
+        uint32 _pathCorridorCacheReportTimer;
+
+        std::unique_ptr<LineOfSightCache> _lineOfSightCache;
+        uint32 _lineOfSightCacheReportTimer;
+
+        std::unique_ptr<Movement::MoveSplineBatch> _moveSplineBatch;
+
+        // unloaded grids that kept their terrain loaded and a snapshot of their creatures (GridUnload.Hibernation.MaxGrids)
+        struct HibernatedGrid
+        {
+            uint32 GridId;
+            bool HoldsTerrain;      // cleared once the grid is created again, the reference is taken over by the grid
+            std::vector<uint8> Snapshot;
+        };
+
+        HibernatedGrid* FindHibernatedGrid(uint32 gridId);
+        bool HibernateGrid(NGridType& ngrid);
+        void ReviveHibernatedGrid(NGridType& ngrid);
+        void ReleaseHibernatedGrids(std::size_t maxGrids, std::size_t maxSnapshotBytes);
+
+        std::vector<HibernatedGrid> _hibernatedGrids;   // oldest first
+        std::size_t _hibernatedSnapshotBytes;
+
+        // serializes access to map wide containers while islands are being updated, does nothing otherwise
+        std::unique_lock<std::recursive_mutex> AcquireIslandSharedLock();
+
+        bool _islandUpdateInProgress;
+        std::recursive_mutex _islandSharedLock;
 
         //these functions used to process player/mob aggro reactions and
         //visibility calculations. Highly optimized for massive calculations
@@ -760,11 +917,17 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void InitSpawnGroupState();
         void UpdateSpawnGroupConditions();
 
+        // spawn group conditions are only re-evaluated after something they depend on changed
+        void InvalidateSpawnGroupConditions() { _spawnGroupConditionsChanged = true; }
+        static void InvalidateAllSpawnGroupConditions();
+
     private:
         // Type specific code for add/remove to/from grid
         template<class T>
         void AddToGrid(T* object, Cell const& cell);
 
+        void IncreaseUnitMoveCounter(Cell const& cell);
+
         template<class T>
         void DeleteFromWorld(T*);
 
@@ -804,11 +967,26 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::unordered_set<uint32> _toggledSpawnGroupIds;
 
         uint32 _respawnCheckTimer;
-        std::unordered_map<uint32, uint32> _zonePlayerCountMap;
+
+        bool ConsumeSpawnGroupConditionChanges();
+
+        bool _spawnGroupConditionsChanged;
+        uint32 _spawnGroupConditionGeneration;
+        time_t _nextSpawnGroupConditionCheck;
+        std::unordered_map<uint32, std::vector<Player*>> _zonePlayers;
 
         ZoneDynamicInfoMap _zoneDynamicInfo;
         IntervalTimer _weatherUpdateTimer;
 
+        // non-essential work is deferred to the next tick once the update took longer than MapUpdate.TickBudget
+        bool IsOverUpdateBudget() const;
+
+        uint32 _updateStartTime;
+        uint32 _lastUpdateTime;
+        bool _lastUpdateOverBudget;
+        uint32 _deferredPhaseTrackerDiff;
+        bool _vignetteUpdatePending;
+
         ObjectGuidGenerator& GetGuidSequenceGenerator(HighGuid high);
 
         std::map<HighGuid, ObjectGuidGenerator> _guidGenerators;
@@ -822,6 +1000,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::unordered_set<Corpse*> _corpseBones;
 
         std::unordered_set<Object*> _updateObjects;
+        std::unique_ptr<UpdateDataPool> _updateDataPool;
 
         MPSCQueue<FarSpellCallback> _farSpellCallbacks;
 
@@ -844,7 +1023,18 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         WorldStateValueContainer const& GetWorldStateValues() const { return _worldStateValues; }
 
     private:
+        struct PendingWorldStateUpdate
+        {
+            int32 WorldStateId;
+            int32 Value;
+            bool Hidden;
+        };
+
+        // changes of a tick are sent together at the end of Update, only the last value of each world state
+        void SendWorldStateUpdates();
+
         WorldStateValueContainer _worldStateValues;
+        std::vector<PendingWorldStateUpdate> _pendingWorldStateUpdates;
 
         /*********************************************************/
         /***                   Vignettes                       ***/
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapIslandPartitioner.h"
+#include "GridDefines.h"
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <unordered_map>
+
+namespace
+{
+struct DisjointSet
+{
+    explicit DisjointSet(std::size_t size) : Parent(size)
+    {
+        std::iota(Parent.begin(), Parent.end(), 0);
+    }
+
+    std::size_t Find(std::size_t i)
+    {
+        while (Parent[i] != i)
+        {
+            Parent[i] = Parent[Parent[i]];
+            i = Parent[i];
+        }
+        return i;
+    }
+
+    void Union(std::size_t a, std::size_t b)
+    {
+        a = Find(a);
+        b = Find(b);
+        if (a != b)
+            Parent[std::max(a, b)] = std::min(a, b);
+    }
+
+    std::vector<std::size_t> Parent;
+};
+}
+
+std::vector<std::vector<uint32>> Trinity::PartitionCellsIntoIslands(std::vector<uint32> const& cellIds, uint32 separation)
+{
+    std::vector<std::vector<uint32>> islands;
+    if (cellIds.empty())
+        return islands;
+
+    separation = std::max(separation, 1u);
+
+    // bucket cells into blocks of separation x separation cells, only cells in neighbouring blocks can be close enough to connect
+    auto blockKey = [separation](uint32 x, uint32 y) { return ((x / separation) << 16) | (y / separation); };
+
+    std::unordered_map<uint32, std::vector<std::size_t>> blocks;
+    blocks.reserve(cellIds.size());
+    for (std::size_t i = 0; i < cellIds.size(); ++i)
+        blocks[blockKey(cellIds[i] % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellIds[i] / TOTAL_NUMBER_OF_CELLS_PER_MAP)].push_back(i);
+
+    DisjointSet sets(cellIds.size());
+    for (std::size_t i = 0; i < cellIds.size(); ++i)
+    {
+        int32 x = int32(cellIds[i] % TOTAL_NUMBER_OF_CELLS_PER_MAP);
+        int32 y = int32(cellIds[i] / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+        int32 blockX = x / int32(separation);
+        int32 blockY = y / int32(separation);
+
+        for (int32 bx = blockX - 1; bx <= blockX + 1; ++bx)
+        {
+            for (int32 by = blockY - 1; by <= blockY + 1; ++by)
+            {
+                if (bx < 0 || by < 0)
+                    continue;
+
+                auto itr = blocks.find((uint32(bx) << 16) | uint32(by));
+                if (itr == blocks.end())
+                    continue;
+
+                for (std::size_t other : itr->second)
+                {
+                    if (other <= i)
+                        continue;
+
+                    uint32 dx = std::abs(x - int32(cellIds[other] % TOTAL_NUMBER_OF_CELLS_PER_MAP));
+                    uint32 dy = std::abs(y - int32(cellIds[other] / TOTAL_NUMBER_OF_CELLS_PER_MAP));
+                    if (std::max(dx, dy) <= separation)
+                        sets.Union(i, other);
+                }
+            }
+        }
+    }
+
+    std::unordered_map<std::size_t, std::size_t> islandIndexes;
+    for (std::size_t i = 0; i < cellIds.size(); ++i)
+    {
+        auto [itr, isNew] = islandIndexes.try_emplace(sets.Find(i), islands.size());
+        if (isNew)
+            islands.emplace_back();
+
+        islands[itr->second].push_back(cellIds[i]);
+    }
+
+    return islands;
+}
@@ -0,0 +1,38 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MAP_ISLAND_PARTITIONER_H
+#define TRINITYCORE_MAP_ISLAND_PARTITIONER_H
+
+#include "Define.h"
+#include <vector>
+
+namespace Trinity
+{
+/**
+ * Splits a set of active cells into islands.
+ * Two cells end up in the same island when they are at most `separation` cells apart
+ * (chebyshev distance), transitively - cells of two different islands are always
+ * more than `separation` cells away from each other.
+ *
+ * @param cellIds cell ids in Map::CollectNearbyCellsOf format (y * TOTAL_NUMBER_OF_CELLS_PER_MAP + x)
+ * @param separation minimum distance in cells between islands
+ */
+TC_GAME_API std::vector<std::vector<uint32>> PartitionCellsIntoIslands(std::vector<uint32> const& cellIds, uint32 separation);
+}
+
+#endif // TRINITYCORE_MAP_ISLAND_PARTITIONER_H
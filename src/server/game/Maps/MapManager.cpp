@@ -20,6 +20,7 @@
 #include "Battleground.h"
 #include "BattlegroundScript.h"
 #include "CharacterCache.h"
+#include "Config.h"
 #include "Containers.h"
 #include "DatabaseEnv.h"
 #include "DB2Stores.h"
@@ -28,10 +29,14 @@
 #include "InstanceLockMgr.h"
 #include "Log.h"
 #include "Map.h"
+#include "Metric.h"
 #include "OutdoorPvPMgr.h"
 #include "Player.h"
 #include "ScenarioMgr.h"
 #include "ScriptMgr.h"
+#include "StringConvert.h"
+#include "ThreadPool.h"
+#include "Util.h"
 #include "World.h"
 #include "WorldStateMgr.h"
 
@@ -54,7 +59,38 @@ void MapManager::Initialize()
     int num_threads(sWorld->getIntConfig(CONFIG_NUMTHREADS));
     // Start mtmaps if needed.
     if (num_threads > 0)
-        m_updater.activate(num_threads);
+    {
+        MapUpdaterWorkerSettings workerSettings;
+        workerSettings.Affinity = sConfigMgr->GetStringDefault("MapUpdate.Threads.Affinity", "");
+        workerSettings.OwnArenas = sConfigMgr->GetBoolDefault("Allocator.MapThreadArenas", false);
+        workerSettings.HugePageArenas = sConfigMgr->GetBoolDefault("Allocator.HugePages.MapThreads", false);
+        m_updater.activate(num_threads, MapUpdaterMode(sWorld->getIntConfig(CONFIG_MAPUPDATE_SCHEDULER)), std::move(workerSettings));
+    }
+
+    if (uint32 islandThreads = sWorld->getIntConfig(CONFIG_MAPUPDATE_ISLAND_THREADS))
+        _islandUpdatePool = std::make_unique<Trinity::ThreadPool>(islandThreads);
+
+    if (uint32 preloadThreads = sWorld->getIntConfig(CONFIG_MAPUPDATE_GRID_PRELOAD_THREADS))
+        _gridPreloadPool = std::make_unique<Trinity::ThreadPool>(preloadThreads);
+
+    if (uint32 dynamicTreeThreads = sWorld->getIntConfig(CONFIG_MAPUPDATE_DYNAMIC_TREE_THREADS))
+        _dynamicTreePool = std::make_unique<Trinity::ThreadPool>(dynamicTreeThreads);
+
+    std::string hostedMaps = sConfigMgr->GetStringDefault("Node.HostedMaps", "");
+    for (std::string_view token : Trinity::Tokenize(hostedMaps, ',', false))
+    {
+        Optional<uint32> mapId = Trinity::StringTo<uint32>(token);
+        if (!mapId || !sMapStore.LookupEntry(*mapId))
+        {
+            TC_LOG_ERROR("server.loading", "Node.HostedMaps contains invalid map id '{}', skipped", token);
+            continue;
+        }
+
+        _hostedMaps.insert(*mapId);
+    }
+
+    if (!_hostedMaps.empty())
+        TC_LOG_INFO("server.loading", "Hosting {} maps, players are not allowed to enter any other map", _hostedMaps.size());
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -351,7 +387,15 @@ void MapManager::Update(uint32 diff)
         m_updater.wait();
 
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+    {
+        if (iter->second->IsLastUpdateOverBudget())
+            TC_METRIC_VALUE("world_update_time", uint64(iter->second->GetLastUpdateTime()),
+                TC_METRIC_TAG("type", "Map over budget"),
+                TC_METRIC_TAG("map_id", std::to_string(iter->second->GetId())),
+                TC_METRIC_TAG("map_instanceid", std::to_string(iter->second->GetInstanceId())));
+
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
+    }
 
     i_timer.SetCurrent(0);
 }
@@ -399,6 +443,24 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    if (_islandUpdatePool)
+    {
+        _islandUpdatePool->Join();
+        _islandUpdatePool.reset();
+    }
+
+    if (_gridPreloadPool)
+    {
+        _gridPreloadPool->Join();
+        _gridPreloadPool.reset();
+    }
+
+    if (_dynamicTreePool)
+    {
+        _dynamicTreePool->Join();
+        _dynamicTreePool.reset();
+    }
+
     Map::DeleteStateMachine();
 }
 
@@ -28,6 +28,7 @@
 #include <boost/dynamic_bitset_fwd.hpp>
 #include <map>
 #include <shared_mutex>
+#include <unordered_set>
 
 class Battleground;
 class BattlegroundMap;
@@ -37,6 +38,12 @@ class InstanceLock;
 class InstanceMap;
 class Map;
 class Player;
+
+namespace Trinity
+{
+class ThreadPool;
+}
+
 enum Difficulty : uint8;
 
 class TC_GAME_API MapManager
@@ -80,6 +87,9 @@ class TC_GAME_API MapManager
 
         static bool IsValidMAP(uint32 mapId);
 
+        // maps this worldserver runs players into, all of them unless Node.HostedMaps is set
+        bool IsMapHosted(uint32 mapId) const { return _hostedMaps.empty() || _hostedMaps.contains(mapId); }
+
         static bool IsValidMapCoord(uint32 mapid, float x, float y)
         {
             return IsValidMAP(mapid) && Trinity::IsValidMapCoord(x, y);
@@ -119,6 +129,15 @@ class TC_GAME_API MapManager
 
         MapUpdater * GetMapUpdater() { return &m_updater; }
 
+        // shared by all maps that update their grid islands in parallel, null when disabled
+        Trinity::ThreadPool* GetIslandUpdatePool() { return _islandUpdatePool.get(); }
+
+        // background terrain loading for grids players are predicted to enter, null when disabled
+        Trinity::ThreadPool* GetGridPreloadPool() { return _gridPreloadPool.get(); }
+
+        // background rebuilds of gameobject collision trees, null when disabled
+        Trinity::ThreadPool* GetDynamicTreePool() { return _dynamicTreePool.get(); }
+
         template<typename Worker>
         void DoForAllMaps(Worker&& worker);
 
@@ -155,6 +174,10 @@ class TC_GAME_API MapManager
         std::unique_ptr<InstanceIds> _freeInstanceIds;
         uint32 _nextInstanceId;
         MapUpdater m_updater;
+        std::unique_ptr<Trinity::ThreadPool> _islandUpdatePool;
+        std::unique_ptr<Trinity::ThreadPool> _gridPreloadPool;
+        std::unique_ptr<Trinity::ThreadPool> _dynamicTreePool;
+        std::unordered_set<uint32> _hostedMaps;
 
         // atomic op counter for active scripts amount
         std::atomic<std::size_t> _scheduledScripts;
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MAP_MOVE_LIST_H
+#define TRINITYCORE_MAP_MOVE_LIST_H
+
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Objects waiting for their cell relocation at the end of the map update.
+ * Every thread updating a part of the map appends to its own slot, so no locking is needed
+ * while islands are updated in parallel. Slots are merged in slot order afterwards which keeps
+ * relocation order independent of thread scheduling.
+ */
+template<typename T>
+class MapMoveList
+{
+public:
+    MapMoveList() : _slots(1) { }
+
+    void SetSlotCount(std::size_t count)
+    {
+        if (count > _slots.size())
+            _slots.resize(count);
+    }
+
+    void Append(std::size_t slot, T* object) { _slots[slot].push_back(object); }
+
+    // Moves everything into the first slot and returns it, entries stay valid until Clear
+    std::vector<T*>& Merge()
+    {
+        std::vector<T*>& merged = _slots.front();
+        for (std::size_t i = 1; i < _slots.size(); ++i)
+        {
+            merged.insert(merged.end(), _slots[i].begin(), _slots[i].end());
+            _slots[i].clear();
+        }
+
+        return merged;
+    }
+
+    void Clear()
+    {
+        for (std::vector<T*>& slot : _slots)
+            slot.clear();
+    }
+
+private:
+    std::vector<std::vector<T*>> _slots;
+};
+}
+
+#endif // TRINITYCORE_MAP_MOVE_LIST_H
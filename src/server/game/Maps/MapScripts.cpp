@@ -27,6 +27,7 @@
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
+#include "Profiler.h"
 #include "Transport.h"
 #include "WaypointManager.h"
 
@@ -313,6 +314,8 @@ void Map::ScriptsProcess()
     if (m_scriptSchedule.empty())
         return;
 
+    TC_PROFILE_ZONE("Map::ScriptsProcess");
+
     ///- Process overdue queued scripts
     ScriptScheduleMap::iterator iter = m_scriptSchedule.begin();
     // ok as multimap is a *sorted* associative container
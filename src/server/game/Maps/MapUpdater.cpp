@@ -17,36 +17,79 @@
 
 #include "MapUpdater.h"
 #include "DatabaseEnv.h"
+#include "Log.h"
+#include "MallocControl.h"
 #include "Map.h"
 #include "Metric.h"
+#include "ProcessPriority.h"
+#include "WorkStealingQueue.h"
+#include <algorithm>
 
 class MapUpdateRequest
 {
     private:
 
-        Map& m_map;
-        MapUpdater& m_updater;
+        Map* m_map;
         uint32 m_diff;
+        uint64 m_cost;
 
     public:
 
-        MapUpdateRequest(Map& m, MapUpdater& u, uint32 d)
-            : m_map(m), m_updater(u), m_diff(d)
+        MapUpdateRequest(Map& m, uint32 d)
+            : m_map(&m), m_diff(d), m_cost(0)
         {
         }
 
+        void reset(Map& m, uint32 d)
+        {
+            m_map = &m;
+            m_diff = d;
+            m_cost = estimate_cost(m);
+        }
+
+        uint64 cost() const { return m_cost; }
+
         void call()
         {
-            TC_METRIC_TIMER("map_update_time_diff", TC_METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-            m_map.Update (m_diff);
-            m_updater.update_finished();
+            TC_METRIC_TIMER("map_update_time_diff", TC_METRIC_TAG("map_id", std::to_string(m_map->GetId())));
+            m_map->Update(m_diff);
+        }
+
+        // Rough relative cost of a single Map::Update call - players drive visibility and
+        // cell activation and dominate the update time, creatures only add their own AI/movement
+        static uint64 estimate_cost(Map const& map)
+        {
+            return uint64(map.GetPlayers().size()) * 100
+                + uint64(map.GetActiveNonPlayersCount()) * 10
+                + uint64(map.GetCreatureBySpawnIdStore().size());
         }
 };
 
-void MapUpdater::activate(size_t num_threads)
+MapUpdater::MapUpdater() : _cancelationToken(false), pending_requests(0), _mode(MapUpdaterMode::SharedQueue),
+    _scheduledRequests(0), _pendingStealingRequests(0), _generation(0)
 {
-    for (size_t i = 0; i < num_threads; ++i)
-        _workerThreads.emplace_back(&MapUpdater::WorkerThread, this);
+}
+
+MapUpdater::~MapUpdater() = default;
+
+void MapUpdater::activate(size_t num_threads, MapUpdaterMode mode, MapUpdaterWorkerSettings workerSettings)
+{
+    _mode = mode;
+    _workerSettings = std::move(workerSettings);
+
+    switch (_mode)
+    {
+        case MapUpdaterMode::WorkStealing:
+            _stealingQueue = std::make_unique<Trinity::WorkStealingQueue<MapUpdateRequest*>>(num_threads);
+            for (size_t i = 0; i < num_threads; ++i)
+                _workerThreads.emplace_back(&MapUpdater::StealingWorkerThread, this, i);
+            break;
+        case MapUpdaterMode::SharedQueue:
+        default:
+            for (size_t i = 0; i < num_threads; ++i)
+                _workerThreads.emplace_back(&MapUpdater::WorkerThread, this);
+            break;
+    }
 }
 
 void MapUpdater::deactivate()
@@ -55,14 +98,38 @@ void MapUpdater::deactivate()
 
     wait();
 
-    _queue.Cancel();
+    if (_mode == MapUpdaterMode::WorkStealing)
+    {
+        {
+            std::scoped_lock lock(_lock);
+            _workAvailableCondition.notify_all();
+        }
+
+        _stealingQueue->Clear();
+    }
+    else
+        _queue.Cancel();
 
     for (auto& thread : _workerThreads)
         thread.join();
+
+    _workerThreads.clear();
+    _stealingQueue.reset();
+    _requestPool.clear();
 }
 
 void MapUpdater::wait()
 {
+    if (_mode == MapUpdaterMode::WorkStealing)
+    {
+        dispatch_scheduled();
+
+        std::unique_lock lock(_lock);
+
+        _condition.wait(lock, [&] { return _pendingStealingRequests.load(std::memory_order_acquire) == 0; });
+        return;
+    }
+
     std::unique_lock lock(_lock);
 
     _condition.wait(lock, [&] { return pending_requests == 0; });
@@ -70,11 +137,26 @@ void MapUpdater::wait()
 
 void MapUpdater::schedule_update(Map& map, uint32 diff)
 {
+    if (_mode == MapUpdaterMode::WorkStealing)
+    {
+        // requests are only collected here, they are sorted and handed to workers in wait()
+        if (_scheduledRequests < _requestPool.size())
+            _requestPool[_scheduledRequests]->reset(map, diff);
+        else
+        {
+            _requestPool.push_back(std::make_unique<MapUpdateRequest>(map, diff));
+            _requestPool.back()->reset(map, diff);
+        }
+
+        ++_scheduledRequests;
+        return;
+    }
+
     std::scoped_lock lock(_lock);
 
     ++pending_requests;
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff));
+    _queue.Push(new MapUpdateRequest(map, diff));
 }
 
 bool MapUpdater::activated() const
@@ -91,12 +173,52 @@ void MapUpdater::update_finished()
     _condition.notify_all();
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::dispatch_scheduled()
+{
+    if (!_scheduledRequests)
+        return;
+
+    // start the most expensive maps first so that a large continent does not end up
+    // being the last thing running while every other worker is already idle
+    std::stable_sort(_requestPool.begin(), _requestPool.begin() + _scheduledRequests, [](std::unique_ptr<MapUpdateRequest> const& left, std::unique_ptr<MapUpdateRequest> const& right)
+    {
+        return left->cost() > right->cost();
+    });
+
+    _pendingStealingRequests.store(_scheduledRequests, std::memory_order_release);
+
+    // deal requests round robin, each worker deque ends up sorted by descending cost
+    for (size_t i = 0; i < _scheduledRequests; ++i)
+        _stealingQueue->Push(i, _requestPool[i].get());
+
+    _scheduledRequests = 0;
+
+    std::scoped_lock lock(_lock);
+    ++_generation;
+    _workAvailableCondition.notify_all();
+}
+
+void MapUpdater::InitializeWorkerThread()
 {
+    SetCurrentThreadAffinity("maps", _workerSettings.Affinity);
+
+    // grids, their objects and navmesh tiles loaded by a worker stay apart from what other threads allocate
+    if (_workerSettings.OwnArenas)
+    {
+        Optional<uint32> arena = Trinity::MallocControl::CreateArena(_workerSettings.HugePageArenas);
+        if (!arena || !Trinity::MallocControl::SetCurrentThreadArena(*arena))
+            TC_LOG_ERROR("maps", "Map update thread could not get a malloc arena of its own, is the server built without jemalloc?");
+    }
+
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
     HotfixDatabase.WarnAboutSyncQueries(true);
+}
+
+void MapUpdater::WorkerThread()
+{
+    InitializeWorkerThread();
 
     while (true)
     {
@@ -108,7 +230,41 @@ void MapUpdater::WorkerThread()
             return;
 
         request->call();
+        update_finished();
 
         delete request;
     }
 }
+
+void MapUpdater::StealingWorkerThread(size_t workerIndex)
+{
+    InitializeWorkerThread();
+
+    uint32 seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(_lock);
+
+            _workAvailableCondition.wait(lock, [&] { return _cancelationToken || _generation != seenGeneration; });
+
+            if (_cancelationToken)
+                return;
+
+            seenGeneration = _generation;
+        }
+
+        MapUpdateRequest* request = nullptr;
+        while (_stealingQueue->Pop(workerIndex, request))
+        {
+            request->call();
+
+            if (_pendingStealingRequests.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::scoped_lock lock(_lock);
+                _condition.notify_all();
+            }
+        }
+    }
+}
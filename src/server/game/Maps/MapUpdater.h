@@ -21,19 +21,40 @@
 #include "Define.h"
 #include "ProducerConsumerQueue.h"
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
 class MapUpdateRequest;
 class Map;
 
+namespace Trinity
+{
+template<typename T>
+class WorkStealingQueue;
+}
+
+enum class MapUpdaterMode : uint8
+{
+    SharedQueue     = 0,    // single queue shared by all workers, maps are started in scheduling order
+    WorkStealing    = 1     // per-worker deques, maps are started in order of estimated cost
+};
+
+struct MapUpdaterWorkerSettings
+{
+    std::string Affinity;           // processors of every worker, see SetCurrentThreadAffinity
+    bool OwnArenas = false;         // every worker allocates from a malloc arena of its own
+    bool HugePageArenas = false;    // memory of those arenas is backed by transparent huge pages
+};
+
 class TC_GAME_API MapUpdater
 {
     public:
 
-        MapUpdater() : _cancelationToken(false), pending_requests(0) {}
-        ~MapUpdater() { };
+        MapUpdater();
+        ~MapUpdater();
 
         friend class MapUpdateRequest;
 
@@ -41,12 +62,14 @@ class TC_GAME_API MapUpdater
 
         void wait();
 
-        void activate(size_t num_threads);
+        void activate(size_t num_threads, MapUpdaterMode mode = MapUpdaterMode::SharedQueue, MapUpdaterWorkerSettings workerSettings = {});
 
         void deactivate();
 
         bool activated() const;
 
+        MapUpdaterMode mode() const { return _mode; }
+
     private:
 
         ProducerConsumerQueue<MapUpdateRequest*> _queue;
@@ -57,10 +80,27 @@ class TC_GAME_API MapUpdater
         std::mutex _lock;
         std::condition_variable _condition;
         size_t pending_requests;
+        MapUpdaterWorkerSettings _workerSettings;
 
         void update_finished();
 
+        void InitializeWorkerThread();
+
         void WorkerThread();
+
+        // work stealing mode
+        MapUpdaterMode _mode;
+
+        std::unique_ptr<Trinity::WorkStealingQueue<MapUpdateRequest*>> _stealingQueue;
+        std::vector<std::unique_ptr<MapUpdateRequest>> _requestPool;   // reused between ticks, only touched by the scheduling thread
+        size_t _scheduledRequests;
+        std::atomic<size_t> _pendingStealingRequests;
+        uint32 _generation;
+        std::condition_variable _workAvailableCondition;
+
+        void dispatch_scheduled();
+
+        void StealingWorkerThread(size_t workerIndex);
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
@@ -0,0 +1,111 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementRelay.h"
+#include "Map.h"
+#include "Pet.h"
+#include "Player.h"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace
+{
+// a mover that got further than it could have moved on its own since its held heartbeat was sent
+// was moved by something else (teleport, transport), that heartbeat would snap observers back
+constexpr float MAX_HELD_MOVER_DRIFT = 10.0f;
+}
+
+MovementRelay::MovementRelay(Map* map, uint32 window) : _map(map), _window(window), _flushTimer(0)
+{
+}
+
+void MovementRelay::Queue(Unit const* mover, Player const* skipped, WorldPacket const* packet)
+{
+    auto [itr, isNew] = _held.try_emplace(mover->GetGUID());
+    if (!isNew)
+    {
+        ++_stats.Superseded;
+        _stats.SupersededBytes += itr->second.Packet.size();
+    }
+
+    itr->second.Skipped = skipped ? skipped->GetGUID() : ObjectGuid::Empty;
+    itr->second.MoverPosition = mover->GetPosition();
+    itr->second.Packet = *packet;
+}
+
+void MovementRelay::Cancel(ObjectGuid const& mover)
+{
+    if (_held.erase(mover))
+        ++_stats.Dropped;
+}
+
+void MovementRelay::Update(uint32 diff)
+{
+    _flushTimer += diff;
+    if (_flushTimer < _window)
+        return;
+
+    Flush();
+}
+
+void MovementRelay::Flush()
+{
+    // the oldest held heartbeat was queued at most this long ago
+    uint32 heldTime = std::max(_window, _flushTimer);
+    _flushTimer = 0;
+
+    if (_held.empty())
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto const& [moverGuid, held] : _held)
+    {
+        Unit* mover = nullptr;
+        if (moverGuid.IsPlayer())
+            mover = _map->GetPlayer(moverGuid);
+        else if (moverGuid.IsPet())
+            mover = _map->GetPet(moverGuid);
+        else
+            mover = _map->GetCreature(moverGuid);
+
+        if (!mover || !mover->IsInWorld())
+        {
+            ++_stats.Dropped;
+            continue;
+        }
+
+        float maxDrift = MAX_HELD_MOVER_DRIFT + mover->GetSpeed(mover->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * heldTime / float(IN_MILLISECONDS);
+        if (mover->GetExactDist(held.MoverPosition) > maxDrift)
+        {
+            ++_stats.Dropped;
+            continue;
+        }
+
+        Player const* skipped = !held.Skipped.IsEmpty() ? _map->GetPlayer(held.Skipped) : nullptr;
+        mover->SendMessageToSet(&held.Packet, skipped);
+        ++_stats.Relayed;
+    }
+
+    _held.clear();
+    _stats.FlushTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+MovementRelay::Stats MovementRelay::TakeStats()
+{
+    return std::exchange(_stats, {});
+}
@@ -0,0 +1,80 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MOVEMENT_RELAY_H
+#define TRINITYCORE_MOVEMENT_RELAY_H
+
+#include "Define.h"
+#include "ObjectGuid.h"
+#include "Position.h"
+#include "WorldPacket.h"
+#include <unordered_map>
+
+class Map;
+class Player;
+class Unit;
+
+/*
+ * Holds back movement heartbeats relayed to observers for a short window.
+ * A newer heartbeat of the same mover replaces the held one, so observers of a player running in a
+ * straight line receive one update per window instead of one per client heartbeat.
+ * Everything else (starts, stops, jumps, knockbacks, teleports) is sent immediately and drops
+ * the held heartbeat of its mover, which would otherwise arrive after newer state.
+ */
+class TC_GAME_API MovementRelay
+{
+public:
+    struct Stats
+    {
+        uint32 Relayed = 0;         // heartbeats broadcast after being held
+        uint32 Superseded = 0;      // heartbeats replaced by a newer one before being broadcast
+        uint64 SupersededBytes = 0; // size of the packets above, saved once per observer
+        uint32 Dropped = 0;         // heartbeats discarded because their mover changed state in another way
+        uint64 FlushTime = 0;       // microseconds spent broadcasting held heartbeats
+    };
+
+    MovementRelay(Map* map, uint32 window);
+
+    MovementRelay(MovementRelay const&) = delete;
+    MovementRelay(MovementRelay&&) = delete;
+    MovementRelay& operator=(MovementRelay const&) = delete;
+    MovementRelay& operator=(MovementRelay&&) = delete;
+
+    void Queue(Unit const* mover, Player const* skipped, WorldPacket const* packet);
+    void Cancel(ObjectGuid const& mover);
+
+    void Update(uint32 diff);
+    void Flush();
+
+    Stats TakeStats();
+
+private:
+    struct HeldUpdate
+    {
+        ObjectGuid Skipped;
+        Position MoverPosition;
+        WorldPacket Packet;
+    };
+
+    Map* _map;
+    std::unordered_map<ObjectGuid, HeldUpdate> _held;
+    uint32 _window;
+    uint32 _flushTimer;
+    Stats _stats;
+};
+
+#endif // TRINITYCORE_MOVEMENT_RELAY_H
@@ -19,9 +19,11 @@
 #include "DB2Stores.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "GameTime.h"
 #include "GridMap.h"
 #include "Log.h"
 #include "Memory.h"
+#include "Metric.h"
 #include "MMapManager.h"
 #include "PhasingHandler.h"
 #include "Random.h"
@@ -30,8 +32,9 @@
 #include "VMapManager.h"
 #include "World.h"
 #include <G3D/g3dmath.h>
+#include <algorithm>
 
-TerrainInfo::TerrainInfo(uint32 mapId) : _mapId(mapId), _parentTerrain(nullptr), _loadedGrids(), _cleanupTimer(randtime(CleanupInterval / 2, CleanupInterval))
+TerrainInfo::TerrainInfo(uint32 mapId) : _mapId(mapId), _parentTerrain(nullptr), _releaseTime(), _loadedGrids(), _cleanupTimer(randtime(CleanupInterval / 2, CleanupInterval))
 {
 }
 
@@ -159,7 +162,15 @@ void TerrainInfo::LoadMapAndVMap(int32 gx, int32 gy)
         return;
 
     std::scoped_lock lock(_loadMutex);
+    LoadGrid(gx, gy);
+}
+
+void TerrainInfo::LoadGrid(int32 gx, int32 gy)
+{
+    TimePoint start = std::chrono::steady_clock::now();
     LoadMapAndVMapImpl(gx, gy);
+    ++_loadStats.Loads;
+    _loadStats.LoadTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
 }
 
 void TerrainInfo::LoadMMapInstance(uint32 mapId, uint32 instanceId)
@@ -263,7 +274,8 @@ void TerrainInfo::LoadMMapImpl(uint32 instanceId, int32 gx, int32 gy)
 
 void TerrainInfo::UnloadMap(int32 gx, int32 gy)
 {
-    --_referenceCountFromMap[gx][gy];
+    if (--_referenceCountFromMap[gx][gy] == 0)
+        _releaseTime[gx][gy] = GameTime::GetGameTimeMS();
     // unload later
 }
 
@@ -302,7 +314,7 @@ GridMap* TerrainInfo::GetGrid(uint32 mapId, float x, float y, bool loadIfMissing
     if (!(_loadedGrids[gx] & (UI64LIT(1) << gy)) && loadIfMissing)
     {
         std::scoped_lock lock(_loadMutex);
-        LoadMapAndVMapImpl(gx, gy);
+        LoadGrid(gx, gy);
     }
 
     GridMap* grid = _gridMap[gx][gy].get();
@@ -332,6 +344,55 @@ void TerrainInfo::CleanUpGrids(uint32 diff)
     _cleanupTimer.Reset(CleanupInterval);
 }
 
+void TerrainInfo::GetUnreferencedGrids(std::vector<UnreferencedGrid>& grids)
+{
+    std::scoped_lock lock(_loadMutex);
+    for (int32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+        if (_loadedGrids[x])
+            for (int32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+                if ((_loadedGrids[x] & (UI64LIT(1) << y)) && !_referenceCountFromMap[x][y])
+                    grids.push_back({ .Terrain = this, .X = x, .Y = y, .ReleaseTime = _releaseTime[x][y], .MemoryUsage = GetGridMemoryUsage(x, y) });
+}
+
+std::size_t TerrainInfo::UnloadUnreferencedGrid(int32 gx, int32 gy)
+{
+    std::scoped_lock lock(_loadMutex);
+    if (!(_loadedGrids[gx] & (UI64LIT(1) << gy)) || _referenceCountFromMap[gx][gy])
+        return 0;
+
+    std::size_t memoryUsage = GetGridMemoryUsage(gx, gy);
+    UnloadMapImpl(gx, gy);
+    return memoryUsage;
+}
+
+std::size_t TerrainInfo::GetGridMemoryUsage()
+{
+    std::scoped_lock lock(_loadMutex);
+    std::size_t memoryUsage = 0;
+    for (int32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+        if (_loadedGrids[x])
+            for (int32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+                if (_loadedGrids[x] & (UI64LIT(1) << y))
+                    memoryUsage += GetGridMemoryUsage(x, y);
+
+    return memoryUsage;
+}
+
+std::size_t TerrainInfo::GetGridMemoryUsage(int32 gx, int32 gy) const
+{
+    std::size_t memoryUsage = _gridMap[gx][gy] ? _gridMap[gx][gy]->GetMemoryUsage() : 0;
+    for (std::shared_ptr<TerrainInfo> const& childTerrain : _childTerrain)
+        memoryUsage += childTerrain->GetGridMemoryUsage(gx, gy);
+
+    return memoryUsage;
+}
+
+TerrainInfo::LoadStats TerrainInfo::TakeLoadStats()
+{
+    std::scoped_lock lock(_loadMutex);
+    return std::exchange(_loadStats, {});
+}
+
 static bool IsInWMOInterior(uint32 mogpFlags)
 {
     return (mogpFlags & 0x2000) != 0;
@@ -697,23 +758,32 @@ float TerrainInfo::GetGridHeight(PhaseShift const& phaseShift, uint32 mapId, flo
     return VMAP_INVALID_HEIGHT_VALUE;
 }
 
-float TerrainInfo::GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/)
+void TerrainInfo::GetGridHeight(PhaseShift const& phaseShift, uint32 mapId, std::span<Position const> positions, std::vector<float>& heights)
 {
-    // find raw .map surface under Z coordinates
-    float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
-    uint32 terrainMapId = PhasingHandler::GetTerrainMapId(phaseShift, mapId, this, x, y);
-    float gridHeight = GetGridHeight(phaseShift, mapId, x, y);
-    if (G3D::fuzzyGe(z, gridHeight - GROUND_HEIGHT_TOLERANCE))
-        mapHeight = gridHeight;
+    heights.assign(positions.size(), VMAP_INVALID_HEIGHT_VALUE);
 
-    float vmapHeight = VMAP_INVALID_HEIGHT_VALUE;
-    if (checkVMap)
+    std::size_t runStart = 0;
+    GridMap* runGrid = nullptr;
+    for (std::size_t i = 0; i <= positions.size(); ++i)
     {
-        VMAP::VMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
-        if (vmgr->isHeightCalcEnabled())
-            vmapHeight = vmgr->getHeight(terrainMapId, x, y, z, maxSearchDist);
+        GridMap* grid = nullptr;
+        if (i < positions.size())
+            grid = GetGrid(PhasingHandler::GetTerrainMapId(phaseShift, mapId, this, positions[i].GetPositionX(), positions[i].GetPositionY()),
+                positions[i].GetPositionX(), positions[i].GetPositionY());
+
+        if (i < positions.size() && grid == runGrid)
+            continue;
+
+        if (runGrid)
+            runGrid->getHeight(positions.subspan(runStart, i - runStart), std::span(heights).subspan(runStart, i - runStart));
+
+        runStart = i;
+        runGrid = grid;
     }
+}
 
+static float SelectStaticHeight(float z, float mapHeight, float vmapHeight)
+{
     // mapHeight set for any above raw ground Z or <= INVALID_HEIGHT
     // vmapheight set for any under Z value or <= INVALID_HEIGHT
     if (vmapHeight > INVALID_HEIGHT)
@@ -736,6 +806,76 @@ float TerrainInfo::GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, f
     return mapHeight;                               // explicitly use map data
 }
 
+float TerrainInfo::GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/)
+{
+    // find raw .map surface under Z coordinates
+    float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
+    uint32 terrainMapId = PhasingHandler::GetTerrainMapId(phaseShift, mapId, this, x, y);
+    float gridHeight = GetGridHeight(phaseShift, mapId, x, y);
+    if (G3D::fuzzyGe(z, gridHeight - GROUND_HEIGHT_TOLERANCE))
+        mapHeight = gridHeight;
+
+    float vmapHeight = VMAP_INVALID_HEIGHT_VALUE;
+    if (checkVMap)
+    {
+        VMAP::VMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
+        if (vmgr->isHeightCalcEnabled())
+            vmapHeight = vmgr->getHeight(terrainMapId, x, y, z, maxSearchDist);
+    }
+
+    return SelectStaticHeight(z, mapHeight, vmapHeight);
+}
+
+void TerrainInfo::GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, std::span<Position const> positions, std::vector<float>& heights, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/)
+{
+    std::vector<float> mapHeights;
+    GetGridHeight(phaseShift, mapId, positions, mapHeights);
+
+    std::vector<uint32> terrainMapIds(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        Position const& pos = positions[i];
+        terrainMapIds[i] = PhasingHandler::GetTerrainMapId(phaseShift, mapId, this, pos.GetPositionX(), pos.GetPositionY());
+        if (!G3D::fuzzyGe(pos.GetPositionZ(), mapHeights[i] - GROUND_HEIGHT_TOLERANCE))
+            mapHeights[i] = VMAP_INVALID_HEIGHT_VALUE;
+    }
+
+    std::vector<float> vmapHeights(positions.size(), VMAP_INVALID_HEIGHT_VALUE);
+    VMAP::VMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
+    if (checkVMap && vmgr->isHeightCalcEnabled())
+    {
+        // terrain swaps change per grid, positions of a batch nearly always share a single terrain map
+        std::vector<uint32> distinctTerrainMapIds = terrainMapIds;
+        std::sort(distinctTerrainMapIds.begin(), distinctTerrainMapIds.end());
+        distinctTerrainMapIds.erase(std::unique(distinctTerrainMapIds.begin(), distinctTerrainMapIds.end()), distinctTerrainMapIds.end());
+
+        std::vector<std::size_t> indices;
+        std::vector<VMAP::HeightQuery> points;
+        std::vector<float> terrainHeights;
+        for (uint32 terrainMapId : distinctTerrainMapIds)
+        {
+            indices.clear();
+            points.clear();
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                if (terrainMapIds[i] != terrainMapId)
+                    continue;
+
+                indices.push_back(i);
+                points.push_back({ .X = positions[i].GetPositionX(), .Y = positions[i].GetPositionY(), .Z = positions[i].GetPositionZ() });
+            }
+
+            vmgr->getHeight(terrainMapId, points, maxSearchDist, terrainHeights);
+            for (std::size_t j = 0; j < indices.size(); ++j)
+                vmapHeights[indices[j]] = terrainHeights[j];
+        }
+    }
+
+    heights.resize(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        heights[i] = SelectStaticHeight(positions[i].GetPositionZ(), mapHeights[i], vmapHeights[i]);
+}
+
 float TerrainInfo::GetWaterLevel(PhaseShift const& phaseShift, uint32 mapId, float x, float y)
 {
     if (GridMap* gmap = GetGrid(PhasingHandler::GetTerrainMapId(phaseShift, mapId, this, x, y), x, y))
@@ -785,7 +925,9 @@ float TerrainInfo::GetWaterOrGroundLevel(PhaseShift const& phaseShift, uint32 ma
     return VMAP_INVALID_HEIGHT_VALUE;
 }
 
-TerrainMgr::TerrainMgr() = default;
+TerrainMgr::TerrainMgr() : _budgetTimer(BudgetCheckInterval), _metricsTimer(MetricsInterval)
+{
+}
 
 TerrainMgr::~TerrainMgr() = default;
 
@@ -833,10 +975,85 @@ void TerrainMgr::UnloadAll()
 
 void TerrainMgr::Update(uint32 diff)
 {
-    // global garbage collection
+    if (uint32 budget = sWorld->getIntConfig(CONFIG_GRID_TERRAIN_MEMORY_BUDGET))
+    {
+        // unreferenced grids stay loaded until the budget is exceeded
+        _budgetTimer.Update(diff);
+        if (_budgetTimer.Passed())
+        {
+            EnforceMemoryBudget(std::size_t(budget) * 1024 * 1024);
+            _budgetTimer.Reset(BudgetCheckInterval);
+        }
+    }
+    else
+    {
+        // global garbage collection
+        for (auto& [mapId, terrainRef] : _terrainMaps)
+            if (std::shared_ptr<TerrainInfo> terrain = terrainRef.lock())
+                terrain->CleanUpGrids(diff);
+    }
+
+    _metricsTimer.Update(diff);
+    if (_metricsTimer.Passed())
+    {
+        ReportMetrics();
+        _metricsTimer.Reset(MetricsInterval);
+    }
+}
+
+void TerrainMgr::EnforceMemoryBudget(std::size_t budget)
+{
+    std::vector<std::shared_ptr<TerrainInfo>> terrains;
+    std::size_t memoryUsage = 0;
+    for (auto& [mapId, terrainRef] : _terrainMaps)
+    {
+        if (std::shared_ptr<TerrainInfo> terrain = terrainRef.lock())
+        {
+            memoryUsage += terrain->GetGridMemoryUsage();
+            terrains.push_back(std::move(terrain));
+        }
+    }
+
+    if (memoryUsage <= budget)
+        return;
+
+    std::vector<TerrainInfo::UnreferencedGrid> grids;
+    for (std::shared_ptr<TerrainInfo> const& terrain : terrains)
+        terrain->GetUnreferencedGrids(grids);
+
+    // grids loaded without ever being referenced by a map have a release time of 0 and go first
+    std::ranges::sort(grids, {}, &TerrainInfo::UnreferencedGrid::ReleaseTime);
+    for (TerrainInfo::UnreferencedGrid const& grid : grids)
+    {
+        if (memoryUsage <= budget)
+            break;
+
+        memoryUsage -= std::min(memoryUsage, grid.Terrain->UnloadUnreferencedGrid(grid.X, grid.Y));
+    }
+}
+
+void TerrainMgr::ReportMetrics()
+{
+    std::size_t memoryUsage = 0;
+    std::vector<TerrainInfo::UnreferencedGrid> unreferencedGrids;
+    TerrainInfo::LoadStats loadStats;
     for (auto& [mapId, terrainRef] : _terrainMaps)
+    {
         if (std::shared_ptr<TerrainInfo> terrain = terrainRef.lock())
-            terrain->CleanUpGrids(diff);
+        {
+            memoryUsage += terrain->GetGridMemoryUsage();
+            terrain->GetUnreferencedGrids(unreferencedGrids);
+            TerrainInfo::LoadStats terrainStats = terrain->TakeLoadStats();
+            loadStats.Loads += terrainStats.Loads;
+            loadStats.LoadTime += terrainStats.LoadTime;
+        }
+    }
+
+    TC_METRIC_VALUE("terrain_grid_memory", uint64(memoryUsage));
+    TC_METRIC_VALUE("terrain_unreferenced_grids", uint64(unreferencedGrids.size()));
+    TC_METRIC_VALUE("terrain_grid_loads", loadStats.Loads);
+    if (loadStats.Loads)
+        TC_METRIC_VALUE("terrain_grid_load_time", loadStats.LoadTime / loadStats.Loads);
 }
 
 uint32 TerrainMgr::GetAreaId(PhaseShift const& phaseShift, uint32 mapid, float x, float y, float z)
@@ -28,6 +28,7 @@
 #include <bitset>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -80,6 +81,29 @@ private:
 public:
     void CleanUpGrids(uint32 diff);
 
+    struct UnreferencedGrid
+    {
+        TerrainInfo* Terrain;
+        int32 X;
+        int32 Y;
+        uint32 ReleaseTime;         // game time its last map reference was released
+        std::size_t MemoryUsage;
+    };
+
+    struct LoadStats
+    {
+        uint32 Loads = 0;
+        uint64 LoadTime = 0;        // microseconds spent loading maps and vmaps
+    };
+
+    // loaded grids no map holds a reference to
+    void GetUnreferencedGrids(std::vector<UnreferencedGrid>& grids);
+    // unloads the grid unless it was referenced again, returns the memory freed
+    std::size_t UnloadUnreferencedGrid(int32 gx, int32 gy);
+    // memory of the loaded .map data of this terrain and its child terrains
+    std::size_t GetGridMemoryUsage();
+    LoadStats TakeLoadStats();
+
     void GetFullTerrainStatusForPosition(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, PositionFullTerrainStatus& data, Optional<map_liquidHeaderTypeFlags> reqLiquidType = {}, float collisionHeight = 2.03128f, DynamicMapTree const* dynamicMapTree = nullptr); // DEFAULT_COLLISION_HEIGHT in Object.h
     ZLiquidStatus GetLiquidStatus(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, Optional<map_liquidHeaderTypeFlags> ReqLiquidType = {}, LiquidData* data = nullptr, float collisionHeight = 2.03128f); // DEFAULT_COLLISION_HEIGHT in Object.h
 
@@ -93,8 +117,12 @@ public:
 
     float GetMinHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y);
     float GetGridHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y);
+    // heights[i] is the grid height at positions[i], consecutive positions on the same grid are sampled together
+    void GetGridHeight(PhaseShift const& phaseShift, uint32 mapId, std::span<Position const> positions, std::vector<float>& heights);
     float GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH);
     float GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, Position const& pos, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) { return GetStaticHeight(phaseShift, mapId, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), checkVMap, maxSearchDist); }
+    // heights[i] is the static height at positions[i], the vmap trees are queried once per terrain map
+    void GetStaticHeight(PhaseShift const& phaseShift, uint32 mapId, std::span<Position const> positions, std::vector<float>& heights, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH);
 
     float GetWaterLevel(PhaseShift const& phaseShift, uint32 mapId, float x, float y);
     bool IsInWater(PhaseShift const& phaseShift, uint32 mapId, float x, float y, float z, LiquidData* data = nullptr);
@@ -105,6 +133,10 @@ public:
 private:
     static constexpr int32 GetBitsetIndex(int32 gx, int32 gy) { return gx * MAX_NUMBER_OF_GRIDS + gy; }
 
+    // caller must hold _loadMutex
+    void LoadGrid(int32 gx, int32 gy);
+    std::size_t GetGridMemoryUsage(int32 gx, int32 gy) const;
+
     uint32 _mapId;
 
     TerrainInfo* _parentTerrain;
@@ -113,6 +145,8 @@ private:
     std::mutex _loadMutex;
     std::unique_ptr<GridMap> _gridMap[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
     std::atomic<uint16> _referenceCountFromMap[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+    std::atomic<uint32> _releaseTime[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+    LoadStats _loadStats;
     std::array<uint64, MAX_NUMBER_OF_GRIDS> _loadedGrids;
     std::bitset<MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS> _gridFileExists; // cache what grids are available for this map (not including parent/child maps)
 
@@ -158,10 +192,20 @@ public:
 private:
     std::shared_ptr<TerrainInfo> LoadTerrainImpl(uint32 mapId);
 
+    // unloads the least recently released unreferenced grids until the terrain of all maps fits into budget
+    void EnforceMemoryBudget(std::size_t budget);
+    void ReportMetrics();
+
     std::unordered_map<uint32, std::weak_ptr<TerrainInfo>> _terrainMaps;
 
     // parent map links
     std::unordered_map<uint32, std::vector<uint32>> _parentMapData;
+
+    static constexpr Milliseconds BudgetCheckInterval = 5s;
+    static constexpr Milliseconds MetricsInterval = 10s;
+
+    TimeTracker _budgetTimer;
+    TimeTracker _metricsTimer;
 };
 
 #define sTerrainMgr TerrainMgr::Instance()
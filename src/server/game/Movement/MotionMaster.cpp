@@ -30,6 +30,7 @@
 #include "Player.h"
 #include "ScriptSystem.h"
 #include "Types.h"
+#include <boost/container/small_vector.hpp>
 #include <boost/container/static_vector.hpp>
 #include <algorithm>
 #include <iterator>
@@ -87,8 +88,9 @@ MotionMaster::~MotionMaster()
 {
     _delayedActions.clear();
 
-    for (auto itr = _generators.begin(); itr != _generators.end(); itr = _generators.erase(itr))
-        MovementGeneratorPointerDeleter(*itr);
+    for (MovementGenerator* movement : _generators)
+        MovementGeneratorPointerDeleter(movement);
+    _generators.clear();
 }
 
 void MotionMaster::Initialize()
@@ -375,8 +377,7 @@ void MotionMaster::Remove(MovementGenerator* movement, MovementSlot slot/* = MOT
         case MOTION_SLOT_ACTIVE:
             if (!_generators.empty())
             {
-                auto bounds = _generators.equal_range(movement);
-                auto itr = std::find(bounds.first, bounds.second, movement);
+                auto itr = std::ranges::find(_generators, movement);
                 if (itr != _generators.end())
                     Remove(itr, GetCurrentMovementGenerator() == *itr, false);
             }
@@ -617,6 +618,14 @@ void MotionMaster::MoveFollow(Unit* target, float dist, Optional<ChaseAngle> ang
     }
 
     TC_LOG_DEBUG("movement.motionmaster", "MotionMaster::MoveFollow: '{}', starts following '{}'", _owner->GetGUID(), target->GetGUID());
+
+    // replacing the active follow movement, reuse it instead of allocating and initializing a new one
+    if (slot == MOTION_SLOT_ACTIVE && !HasFlag(MOTIONMASTER_FLAG_DELAYED) && !_generators.empty() && _generators.front()->GetMovementGeneratorType() == FOLLOW_MOTION_TYPE)
+    {
+        static_cast<FollowMovementGenerator*>(_generators.front())->Retarget(_owner, target, dist, angle, duration, ignoreTargetWalk, std::move(scriptResult));
+        return;
+    }
+
     Add(new FollowMovementGenerator(target, dist, angle, duration, ignoreTargetWalk, std::move(scriptResult)), slot);
 }
 
@@ -627,6 +636,14 @@ void MotionMaster::MoveChase(Unit* target, Optional<ChaseRange> dist, Optional<C
         return;
 
     TC_LOG_DEBUG("movement.motionmaster", "MotionMaster::MoveChase: '{}', starts chasing '{}'", _owner->GetGUID(), target->GetGUID());
+
+    // retargeting the active chase, reuse it instead of allocating and initializing a new one
+    if (!HasFlag(MOTIONMASTER_FLAG_DELAYED) && !_generators.empty() && _generators.front()->GetMovementGeneratorType() == CHASE_MOTION_TYPE)
+    {
+        static_cast<ChaseMovementGenerator*>(_generators.front())->Retarget(_owner, target, dist, angle);
+        return;
+    }
+
     Add(new ChaseMovementGenerator(target, dist, angle));
 }
 
@@ -1255,17 +1272,18 @@ void MotionMaster::DirectClear(std::function<bool(MovementGenerator*)> const& fi
         return;
 
     MovementGenerator const* top = GetCurrentMovementGenerator();
-    for (auto itr = _generators.begin(); itr != _generators.end();)
+    boost::container::small_vector<MovementGenerator*, 4> removed;
+    _generators.erase(std::remove_if(_generators.begin(), _generators.end(), [&](MovementGenerator* movement)
     {
-        if (filter(*itr))
-        {
-            MovementGenerator* movement = *itr;
-            itr = _generators.erase(itr);
-            Delete(movement, movement == top, false);
-        }
-        else
-            ++itr;
-    }
+        if (!filter(movement))
+            return false;
+
+        removed.push_back(movement);
+        return true;
+    }), _generators.end());
+
+    for (MovementGenerator* movement : removed)
+        Delete(movement, movement == top, false);
 }
 
 void MotionMaster::DirectAdd(MovementGenerator* movement, MovementSlot slot/* = MOTION_SLOT_ACTIVE*/)
@@ -1334,7 +1352,7 @@ void MotionMaster::DirectAdd(MovementGenerator* movement, MovementSlot slot/* =
             else
                 _defaultGenerator->Deactivate(_owner);
 
-            _generators.emplace(movement);
+            _generators.insert(std::upper_bound(_generators.begin(), _generators.end(), movement, MovementGeneratorComparator()), movement);
             AddBaseUnitState(movement);
             break;
         default:
@@ -25,9 +25,9 @@
 #include "MovementDefines.h"
 #include "MovementGenerator.h"
 #include "SharedDefines.h"
+#include <boost/container/small_vector.hpp>
 #include <deque>
 #include <functional>
-#include <set>
 #include <unordered_map>
 #include <vector>
 
@@ -240,7 +240,8 @@ class TC_GAME_API MotionMaster
 
     private:
         typedef std::unique_ptr<MovementGenerator, MovementGeneratorDeleter> MovementGeneratorPointer;
-        typedef std::multiset<MovementGenerator*, MovementGeneratorComparator> MotionMasterContainer;
+        // kept sorted by MovementGeneratorComparator, there are rarely more than a few generators at once
+        typedef boost::container::small_vector<MovementGenerator*, 4> MotionMasterContainer;
         typedef std::unordered_multimap<uint32, MovementGenerator const*> MotionMasterUnitStatesContainer;
 
         void AddFlag(uint8 const flag) { _flags |= flag; }
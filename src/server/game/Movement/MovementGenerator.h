@@ -24,6 +24,7 @@
 #include "ObjectRegistry.h"
 #include "Optional.h"
 #include "ScriptActionResult.h"
+#include <array>
 
 class Creature;
 class Unit;
@@ -123,6 +124,67 @@ class MovementGeneratorMedium : public MovementGenerator
         }
 };
 
+/*
+ * Class allocation of the generators that combat AIs switch between all the time. Each thread keeps a small
+ * free list per generator type, generators are created and deleted by the map update of their owner.
+ * Blocks of another size (derived classes) and requests beyond the free list go to the global allocator.
+ */
+template <class T>
+class PooledMovementGenerator
+{
+    public:
+        static void* operator new(std::size_t size)
+        {
+            if (size == sizeof(T) && !FreeList::Destroyed)
+            {
+                FreeList& freeList = GetFreeList();
+                if (freeList.Count)
+                    return freeList.Blocks[--freeList.Count];
+            }
+
+            return ::operator new(size);
+        }
+
+        static void operator delete(void* pointer, std::size_t size)
+        {
+            if (size == sizeof(T) && !FreeList::Destroyed)
+            {
+                FreeList& freeList = GetFreeList();
+                if (freeList.Count < freeList.Blocks.size())
+                {
+                    freeList.Blocks[freeList.Count++] = pointer;
+                    return;
+                }
+            }
+
+            ::operator delete(pointer);
+        }
+
+    private:
+        struct FreeList
+        {
+            ~FreeList()
+            {
+                while (Count)
+                    ::operator delete(Blocks[--Count]);
+
+                Destroyed = true;
+            }
+
+            std::array<void*, 64> Blocks;
+            std::size_t Count = 0;
+
+            // generators deleted during thread exit after the free list itself go straight to the allocator
+            static inline thread_local bool Destroyed = false;
+        };
+
+        static FreeList& GetFreeList()
+        {
+            thread_local FreeList freeList;
+            return freeList;
+        }
+};
+
 typedef FactoryHolder<MovementGenerator, Unit, MovementGeneratorType> MovementGeneratorCreator;
 
 struct IdleMovementFactory : public MovementGeneratorCreator
@@ -79,6 +79,7 @@ void ChaseMovementGenerator::Initialize(Unit* /*owner*/)
     AddFlag(MOVEMENTGENERATOR_FLAG_INITIALIZED | MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
 
     _path = nullptr;
+    _pendingPathShortened.reset();
     _lastTargetPosition.reset();
 }
 
@@ -103,6 +104,12 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
     // the owner might be unable to move (rooted or casting), or we have lost the target, pause movement
     if (owner->HasUnitState(UNIT_STATE_NOT_MOVE) || owner->IsMovementPreventedByCasting() || HasLostTarget(owner, target))
     {
+        if (_pendingPathShortened)
+        {
+            _path = nullptr;
+            _pendingPathShortened.reset();
+        }
+
         owner->StopMoving();
         _lastTargetPosition.reset();
         if (Creature* cOwner = owner->ToCreature())
@@ -131,6 +138,7 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
         {
             RemoveFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
             _path = nullptr;
+            _pendingPathShortened.reset();
             if (Creature* cOwner = owner->ToCreature())
                 cOwner->SetCannotReachTarget(false);
             owner->StopMoving();
@@ -140,11 +148,20 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
         }
     }
 
+    // a path queued during an earlier update, the previous one was followed in the meantime
+    if (_pendingPathShortened && !_path->IsCalculating())
+    {
+        bool shortenPath = *_pendingPathShortened;
+        _pendingPathShortened.reset();
+        LaunchPath(owner, target, shortenPath, maxTarget);
+    }
+
     // if we're done moving, we want to clean up
     if (owner->HasUnitState(UNIT_STATE_CHASE_MOVE) && owner->movespline->Finalized())
     {
         RemoveFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
         _path = nullptr;
+        _pendingPathShortened.reset();
         if (Creature* cOwner = owner->ToCreature())
             cOwner->SetCannotReachTarget(false);
         owner->ClearUnitState(UNIT_STATE_CHASE_MOVE);
@@ -166,6 +183,7 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
                 cOwner->SetCannotReachTarget(true);
                 cOwner->StopMoving();
                 _path = nullptr;
+                _pendingPathShortened.reset();
                 return true;
             }
 
@@ -174,7 +192,10 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
 
             // make a new path if we have to...
             if (!_path || moveToward != _movingTowards)
+            {
                 _path = std::make_unique<PathGenerator>(owner);
+                _pendingPathShortened.reset();
+            }
 
             float x, y, z;
             bool shortenPath;
@@ -195,45 +216,22 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
             if (owner->IsHovering())
                 owner->UpdateAllowedPositionZ(x, y, z);
 
-            bool success = _path->CalculatePath(x, y, z, owner->CanFly());
-            if (!success || (_path->GetPathType() & (PATHFIND_NOPATH /* | PATHFIND_INCOMPLETE*/)))
+            if (!_path->CalculatePathAsync(x, y, z, owner->CanFly()))
             {
+                _pendingPathShortened.reset();
                 if (cOwner)
                     cOwner->SetCannotReachTarget(true);
                 owner->StopMoving();
                 return true;
             }
 
-            if (shortenPath)
-                _path->ShortenPathUntilDist(PositionToVector3(target->GetPosition()), maxTarget);
-
-            if (cOwner)
-                cOwner->SetCannotReachTarget(false);
-
-            bool walk = false;
-            if (cOwner && !cOwner->IsPet())
+            if (_path->IsCalculating())
+                _pendingPathShortened = shortenPath;
+            else
             {
-                switch (cOwner->GetMovementTemplate().GetChase())
-                {
-                    case CreatureChaseMovementType::CanWalk:
-                        walk = owner->IsWalking();
-                        break;
-                    case CreatureChaseMovementType::AlwaysWalk:
-                        walk = true;
-                        break;
-                    default:
-                        break;
-                }
+                _pendingPathShortened.reset();
+                LaunchPath(owner, target, shortenPath, maxTarget);
             }
-
-            owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
-            AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
-
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(_path->GetPath());
-            init.SetWalk(walk);
-            init.SetFacing(target);
-            init.Launch();
         }
     }
 
@@ -241,8 +239,57 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
     return true;
 }
 
+void ChaseMovementGenerator::LaunchPath(Unit* owner, Unit* target, bool shortenPath, float maxTarget)
+{
+    Creature* const cOwner = owner->ToCreature();
+    if (_path->GetPathType() & (PATHFIND_NOPATH /* | PATHFIND_INCOMPLETE*/))
+    {
+        if (cOwner)
+            cOwner->SetCannotReachTarget(true);
+        owner->StopMoving();
+        return;
+    }
+
+    if (shortenPath)
+        _path->ShortenPathUntilDist(PositionToVector3(target->GetPosition()), maxTarget);
+
+    if (cOwner)
+        cOwner->SetCannotReachTarget(false);
+
+    bool walk = false;
+    if (cOwner && !cOwner->IsPet())
+    {
+        switch (cOwner->GetMovementTemplate().GetChase())
+        {
+            case CreatureChaseMovementType::CanWalk:
+                walk = owner->IsWalking();
+                break;
+            case CreatureChaseMovementType::AlwaysWalk:
+                walk = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
+    AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(_path->GetPath());
+    init.SetWalk(walk);
+    init.SetFacing(target);
+    init.Launch();
+}
+
 void ChaseMovementGenerator::Deactivate(Unit* owner)
 {
+    if (_pendingPathShortened)
+    {
+        _path = nullptr;
+        _pendingPathShortened.reset();
+    }
+
     AddFlag(MOVEMENTGENERATOR_FLAG_DEACTIVATED);
     RemoveFlag(MOVEMENTGENERATOR_FLAG_TRANSITORY | MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
     owner->ClearUnitState(UNIT_STATE_CHASE_MOVE);
@@ -250,6 +297,21 @@ void ChaseMovementGenerator::Deactivate(Unit* owner)
         cOwner->SetCannotReachTarget(false);
 }
 
+void ChaseMovementGenerator::Retarget(Unit* owner, Unit* target, Optional<ChaseRange> range, Optional<ChaseAngle> angle)
+{
+    owner->ClearUnitState(UNIT_STATE_CHASE_MOVE);
+    if (Creature* cOwner = owner->ToCreature())
+        cOwner->SetCannotReachTarget(false);
+
+    SetTarget(ASSERT_NOTNULL(target));
+    _range = range;
+    _angle = angle;
+    _rangeCheckTimer.Reset(RANGE_CHECK_INTERVAL);
+    _movingTowards = true;
+    _mutualChase = true;
+    Flags = MOVEMENTGENERATOR_FLAG_INITIALIZATION_PENDING;
+}
+
 void ChaseMovementGenerator::Finalize(Unit* owner, bool active, bool/* movementInform*/)
 {
     AddFlag(MOVEMENTGENERATOR_FLAG_FINALIZED);
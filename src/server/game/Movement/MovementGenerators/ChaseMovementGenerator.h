@@ -28,7 +28,7 @@
 class PathGenerator;
 class Unit;
 
-class ChaseMovementGenerator : public MovementGenerator, public AbstractFollower
+class ChaseMovementGenerator : public MovementGenerator, public AbstractFollower, public PooledMovementGenerator<ChaseMovementGenerator>
 {
     public:
         explicit ChaseMovementGenerator(Unit* target, Optional<ChaseRange> range = {}, Optional<ChaseAngle> angle = {});
@@ -43,13 +43,19 @@ class ChaseMovementGenerator : public MovementGenerator, public AbstractFollower
 
         void UnitSpeedChanged() override { _lastTargetPosition.reset(); }
 
+        // Turns the active chase into a new one, same as finalizing it and adding another
+        void Retarget(Unit* owner, Unit* target, Optional<ChaseRange> range, Optional<ChaseAngle> angle);
+
     private:
         static constexpr uint32 RANGE_CHECK_INTERVAL = 100; // time (ms) until we attempt to recalculate
 
-        Optional<ChaseRange> const _range;
-        Optional<ChaseAngle> const _angle;
+        void LaunchPath(Unit* owner, Unit* target, bool shortenPath, float maxTarget);
+
+        Optional<ChaseRange> _range;
+        Optional<ChaseAngle> _angle;
 
         std::unique_ptr<PathGenerator> _path;
+        Optional<bool> _pendingPathShortened;   // set while _path is calculated, the path is launched once it is done
         Optional<Position> _lastTargetPosition;
         TimeTracker _rangeCheckTimer;
         bool _movingTowards = true;
@@ -64,6 +64,7 @@ void FollowMovementGenerator::Initialize(Unit* owner)
     owner->StopMoving();
     UpdatePetSpeed(owner);
     _path = nullptr;
+    _pathPending = false;
     _lastTargetPosition.reset();
 }
 
@@ -99,6 +100,7 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
     if (owner->HasUnitState(UNIT_STATE_NOT_MOVE) || owner->IsMovementPreventedByCasting())
     {
         _path = nullptr;
+        _pathPending = false;
         owner->StopMoving();
         _lastTargetPosition.reset();
         return true;
@@ -117,6 +119,7 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
         {
             RemoveFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
             _path = nullptr;
+            _pathPending = false;
             owner->StopMoving();
             _lastTargetPosition.reset();
             DoMovementInform(owner, target);
@@ -124,10 +127,18 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
         }
     }
 
+    // a path queued during an earlier update, the previous one was followed in the meantime
+    if (_pathPending && !_path->IsCalculating())
+    {
+        _pathPending = false;
+        LaunchPath(owner, target);
+    }
+
     if (owner->HasUnitState(UNIT_STATE_FOLLOW_MOVE) && owner->movespline->Finalized())
     {
         RemoveFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
         _path = nullptr;
+        _pathPending = false;
         owner->ClearUnitState(UNIT_STATE_FOLLOW_MOVE);
         DoMovementInform(owner, target);
     }
@@ -170,34 +181,73 @@ bool FollowMovementGenerator::Update(Unit* owner, uint32 diff)
                     allowShortcut = true;
             }
 
-            bool success = _path->CalculatePath(x, y, z, allowShortcut);
-            if (!success || (_path->GetPathType() & PATHFIND_NOPATH))
+            if (!_path->CalculatePathAsync(x, y, z, allowShortcut))
             {
+                _pathPending = false;
                 owner->StopMoving();
                 return true;
             }
 
-            owner->AddUnitState(UNIT_STATE_FOLLOW_MOVE);
-            AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
-
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(_path->GetPath());
-            if (!_ignoreTargetWalk)
-                init.SetWalk(target->IsWalking());
-            init.SetFacing(target->GetOrientation());
-            init.Launch();
+            _pathPending = _path->IsCalculating();
+            if (!_pathPending)
+                LaunchPath(owner, target);
         }
     }
     return true;
 }
 
+void FollowMovementGenerator::LaunchPath(Unit* owner, Unit* target)
+{
+    if (_path->GetPathType() & PATHFIND_NOPATH)
+    {
+        owner->StopMoving();
+        return;
+    }
+
+    owner->AddUnitState(UNIT_STATE_FOLLOW_MOVE);
+    AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(_path->GetPath());
+    if (!_ignoreTargetWalk)
+        init.SetWalk(target->IsWalking());
+    init.SetFacing(target->GetOrientation());
+    init.Launch();
+}
+
 void FollowMovementGenerator::Deactivate(Unit* owner)
 {
+    if (_pathPending)
+    {
+        _path = nullptr;
+        _pathPending = false;
+    }
+
     AddFlag(MOVEMENTGENERATOR_FLAG_DEACTIVATED);
     RemoveFlag(MOVEMENTGENERATOR_FLAG_TRANSITORY | MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
     owner->ClearUnitState(UNIT_STATE_FOLLOW_MOVE);
 }
 
+void FollowMovementGenerator::Retarget(Unit* owner, Unit* target, float range, Optional<ChaseAngle> angle, Optional<Milliseconds> duration,
+    bool ignoreTargetWalk, Optional<Scripting::v2::ActionResultSetter<MovementStopReason>>&& scriptResult)
+{
+    owner->ClearUnitState(UNIT_STATE_FOLLOW_MOVE);
+    UpdatePetSpeed(owner);
+    SetScriptResult(MovementStopReason::Interrupted);
+
+    SetTarget(ASSERT_NOTNULL(target));
+    _range = range;
+    _angle = angle;
+    _ignoreTargetWalk = ignoreTargetWalk;
+    _checkTimer.Reset(CHECK_INTERVAL);
+    _duration.reset();
+    if (duration)
+        _duration.emplace(*duration);
+
+    ScriptResult = std::move(scriptResult);
+    Flags = MOVEMENTGENERATOR_FLAG_INITIALIZATION_PENDING;
+}
+
 void FollowMovementGenerator::Finalize(Unit* owner, bool active, bool movementInform)
 {
     AddFlag(MOVEMENTGENERATOR_FLAG_FINALIZED);
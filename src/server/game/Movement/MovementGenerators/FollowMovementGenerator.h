@@ -29,7 +29,7 @@ class Unit;
 
 #define FOLLOW_RANGE_TOLERANCE 1.0f
 
-class FollowMovementGenerator : public MovementGenerator, public AbstractFollower
+class FollowMovementGenerator : public MovementGenerator, public AbstractFollower, public PooledMovementGenerator<FollowMovementGenerator>
 {
     public:
         explicit FollowMovementGenerator(Unit* target, float range, Optional<ChaseAngle> angle, Optional<Milliseconds> duration,
@@ -45,18 +45,24 @@ class FollowMovementGenerator : public MovementGenerator, public AbstractFollowe
 
         void UnitSpeedChanged() override { _lastTargetPosition.reset(); }
 
+        // Turns the active follow movement into a new one, same as finalizing it and adding another
+        void Retarget(Unit* owner, Unit* target, float range, Optional<ChaseAngle> angle, Optional<Milliseconds> duration,
+            bool ignoreTargetWalk, Optional<Scripting::v2::ActionResultSetter<MovementStopReason>>&& scriptResult);
+
     private:
         static constexpr uint32 CHECK_INTERVAL = 100;
 
         void UpdatePetSpeed(Unit* owner);
+        void LaunchPath(Unit* owner, Unit* target);
 
-        float const _range;
-        Optional<ChaseAngle const> _angle;
+        float _range;
+        Optional<ChaseAngle> _angle;
         bool _ignoreTargetWalk;
 
         TimeTracker _checkTimer;
         Optional<TimeTracker> _duration;
         std::unique_ptr<PathGenerator> _path;
+        bool _pathPending = false;              // _path is calculated, it is launched once it is done
         Optional<Position> _lastTargetPosition;
 };
 
@@ -35,7 +35,7 @@ struct GenericMovementGeneratorArgs
     Optional<Scripting::v2::ActionResultSetter<MovementStopReason>> ScriptResult;
 };
 
-class GenericMovementGenerator : public MovementGenerator
+class GenericMovementGenerator : public MovementGenerator, public PooledMovementGenerator<GenericMovementGenerator>
 {
     public:
         explicit GenericMovementGenerator(std::function<void(Movement::MoveSplineInit& init)>&& initializer, MovementGeneratorType type, uint32 id,
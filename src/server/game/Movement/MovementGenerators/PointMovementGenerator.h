@@ -27,7 +27,7 @@ namespace Movement
     struct SpellEffectExtraData;
 }
 
-class PointMovementGenerator : public MovementGenerator
+class PointMovementGenerator : public MovementGenerator, public PooledMovementGenerator<PointMovementGenerator>
 {
     public:
         explicit PointMovementGenerator(uint32 id, float x, float y, float z, bool generatePath, Optional<float> speed = {}, Optional<float> finalOrient = {},
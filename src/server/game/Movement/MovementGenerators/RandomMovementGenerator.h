@@ -26,7 +26,7 @@
 class PathGenerator;
 
 template<class T>
-class RandomMovementGenerator : public MovementGeneratorMedium<T, RandomMovementGenerator<T>>
+class RandomMovementGenerator : public MovementGeneratorMedium<T, RandomMovementGenerator<T>>, public PooledMovementGenerator<RandomMovementGenerator<T>>
 {
     public:
         explicit RandomMovementGenerator(float distance = 0.0f, Optional<Milliseconds> duration = {},
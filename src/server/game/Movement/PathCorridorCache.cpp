@@ -0,0 +1,147 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCorridorCache.h"
+#include "Hash.h"
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+// chasers coming from different sides of a target get their own corridors, the oldest one is replaced
+constexpr std::size_t PATH_CORRIDOR_CACHE_MAX_CORRIDORS_PER_KEY = 4;
+// a busy map rotates early instead of growing without limit
+constexpr std::size_t PATH_CORRIDOR_CACHE_MAX_CORRIDORS = 4096;
+}
+
+PathCorridorCache::PathCorridorCache(uint32 duration) : _corridorCount(0), _duration(duration), _rotateTimer(duration)
+{
+}
+
+std::size_t PathCorridorCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hashVal = 0;
+    Trinity::hash_combine(hashVal, key.NavMesh);
+    Trinity::hash_combine(hashVal, key.EndPoly);
+    Trinity::hash_combine(hashVal, key.IncludeFlags);
+    Trinity::hash_combine(hashVal, key.ExcludeFlags);
+    return hashVal;
+}
+
+uint32 PathCorridorCache::Find(Key const& key, dtPolyRef startPoly, std::span<dtPolyRef const> neighbours, std::span<dtPolyRef> path)
+{
+    std::scoped_lock lock(_lock);
+    if (uint32 length = CopyFrom(key, startPoly, path))
+    {
+        ++_stats.Hits;
+        return length;
+    }
+
+    if (!path.empty())
+    {
+        for (dtPolyRef neighbour : neighbours)
+        {
+            if (uint32 length = CopyFrom(key, neighbour, path.subspan(1)))
+            {
+                path[0] = startPoly;
+                ++_stats.Joined;
+                return length + 1;
+            }
+        }
+    }
+
+    ++_stats.Misses;
+    return 0;
+}
+
+uint32 PathCorridorCache::CopyFrom(Key const& key, dtPolyRef poly, std::span<dtPolyRef> path) const
+{
+    for (Container const* container : { &_current, &_previous })
+    {
+        auto itr = container->find(key);
+        if (itr == container->end())
+            continue;
+
+        for (Corridor const& corridor : itr->second)
+        {
+            auto start = std::ranges::find(corridor, poly);
+            if (start == corridor.end())
+                continue;
+
+            std::size_t length = std::distance(start, corridor.end());
+            if (length > path.size())
+                continue;
+
+            std::ranges::copy(start, corridor.end(), path.begin());
+            return uint32(length);
+        }
+    }
+
+    return 0;
+}
+
+void PathCorridorCache::Store(Key const& key, std::span<dtPolyRef const> corridor)
+{
+    if (corridor.size() < 2 || corridor.back() != key.EndPoly)
+        return;
+
+    std::scoped_lock lock(_lock);
+    if (_corridorCount >= PATH_CORRIDOR_CACHE_MAX_CORRIDORS)
+        Rotate();
+
+    std::vector<Corridor>& corridors = _current[key];
+    if (corridors.size() >= PATH_CORRIDOR_CACHE_MAX_CORRIDORS_PER_KEY)
+        corridors.erase(corridors.begin());
+    else
+        ++_corridorCount;
+
+    corridors.emplace_back(corridor.begin(), corridor.end());
+}
+
+void PathCorridorCache::InvalidateTiles()
+{
+    std::scoped_lock lock(_lock);
+    _current.clear();
+    _previous.clear();
+    _corridorCount = 0;
+}
+
+void PathCorridorCache::Rotate()
+{
+    _previous = std::exchange(_current, {});
+    _corridorCount = 0;
+}
+
+void PathCorridorCache::Update(uint32 diff)
+{
+    if (_rotateTimer > diff)
+    {
+        _rotateTimer -= diff;
+        return;
+    }
+
+    _rotateTimer = _duration;
+
+    std::scoped_lock lock(_lock);
+    Rotate();
+}
+
+PathCorridorCache::Stats PathCorridorCache::TakeStats()
+{
+    std::scoped_lock lock(_lock);
+    return std::exchange(_stats, {});
+}
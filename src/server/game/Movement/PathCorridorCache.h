@@ -0,0 +1,99 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PATH_CORRIDOR_CACHE_H
+#define TRINITYCORE_PATH_CORRIDOR_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Keeps the polygon corridors of recent path searches of a map, keyed by the polygon the path ends at and
+ * the filter it was searched with. Any path starting on one of these corridors is the rest of it, so creatures
+ * chasing the same target behind each other share one search; a creature one polygon off a corridor only adds
+ * the step onto it.
+ * Corridors live between one and two durations, a target moving into another polygon just stops using them.
+ * Every corridor is dropped whenever a tile of the navmesh is rebuilt.
+ */
+class TC_GAME_API PathCorridorCache
+{
+public:
+    struct Stats
+    {
+        uint32 Hits = 0;            // searches answered by a corridor starting on the start polygon
+        uint32 Joined = 0;          // searches answered by a corridor next to the start polygon
+        uint32 Misses = 0;          // searches run on the navmesh
+    };
+
+    struct Key
+    {
+        dtNavMesh const* NavMesh;
+        dtPolyRef EndPoly;
+        uint16 IncludeFlags;
+        uint16 ExcludeFlags;
+
+        bool operator==(Key const& right) const = default;
+    };
+
+    explicit PathCorridorCache(uint32 duration);
+
+    PathCorridorCache(PathCorridorCache const&) = delete;
+    PathCorridorCache(PathCorridorCache&&) = delete;
+    PathCorridorCache& operator=(PathCorridorCache const&) = delete;
+    PathCorridorCache& operator=(PathCorridorCache&&) = delete;
+
+    // Copies the corridor from startPoly to the end polygon of key into path and returns its length, 0 if none is cached.
+    // Without one passing startPoly, a corridor passing one of neighbours is used with startPoly put in front of it
+    uint32 Find(Key const& key, dtPolyRef startPoly, std::span<dtPolyRef const> neighbours, std::span<dtPolyRef> path);
+
+    // Keeps the polygons of a finished search, corridors not reaching the end polygon of key are ignored
+    void Store(Key const& key, std::span<dtPolyRef const> corridor);
+
+    // Called whenever a tile of the navmesh was replaced, polygon refs of rebuilt tiles are reused for other polygons
+    void InvalidateTiles();
+
+    void Update(uint32 diff);
+
+    Stats TakeStats();
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    using Corridor = std::vector<dtPolyRef>;
+    using Container = std::unordered_map<Key, std::vector<Corridor>, KeyHash>;
+
+    // length of the copied part of a corridor passing poly, 0 if none does
+    uint32 CopyFrom(Key const& key, dtPolyRef poly, std::span<dtPolyRef> path) const;
+    void Rotate();
+
+    std::mutex _lock;
+    Container _current;
+    Container _previous;
+    std::size_t _corridorCount;
+    uint32 _duration;
+    uint32 _rotateTimer;
+    Stats _stats;
+};
+
+#endif // TRINITYCORE_PATH_CORRIDOR_CACHE_H
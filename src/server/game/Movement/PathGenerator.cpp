@@ -25,14 +25,16 @@
 #include "MMapManager.h"
 #include "Map.h"
 #include "Metric.h"
+#include "PathCorridorCache.h"
 #include "PhasingHandler.h"
+#include <array>
 
 ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false),
     _forceDestination(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
     _startPosition(PositionToVector3(owner->GetPosition())), _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _queuedOn(nullptr)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
@@ -51,11 +53,37 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
 
 PathGenerator::~PathGenerator()
 {
+    CancelCalculation();
+
     TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::~PathGenerator() for {}", _source->GetGUID().ToString());
 }
 
 bool PathGenerator::CalculatePath(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest)
 {
+    return StartCalculation(srcX, srcY, srcZ, destX, destY, destZ, forceDest, false);
+}
+
+bool PathGenerator::CalculatePathAsync(float destX, float destY, float destZ, bool forceDest)
+{
+    float x, y, z;
+    _source->GetPosition(x, y, z);
+    return StartCalculation(x, y, z, destX, destY, destZ, forceDest, true);
+}
+
+void PathGenerator::CancelCalculation()
+{
+    if (!_queuedOn)
+        return;
+
+    _queuedOn->CancelPathCalculation(this);
+    _queuedOn = nullptr;
+}
+
+bool PathGenerator::StartCalculation(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest, bool async)
+{
+    // a search still queued would overwrite the new result
+    CancelCalculation();
+
     if (!Trinity::IsValidMapCoord(destX, destY, destZ) || !Trinity::IsValidMapCoord(srcX, srcY, srcZ))
         return false;
 
@@ -84,10 +112,32 @@ bool PathGenerator::CalculatePath(float srcX, float srcY, float srcZ, float dest
 
     UpdateFilter();
 
-    BuildPolyPath(start, dest);
+    if (async && _source->GetMap()->QueuePathCalculation(this))
+    {
+        _queuedOn = _source->GetMap();
+        return true;
+    }
+
+    FinishCalculation();
     return true;
 }
 
+void PathGenerator::FinishCalculation()
+{
+    // the query of the map is not thread safe, every thread searches with its own
+    _navMeshQuery = MMAP::MMapManager::GetThreadNavMeshQuery(_navMesh);
+    if (!_navMeshQuery)
+    {
+        BuildShortcut();
+        _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
+        return;
+    }
+
+    G3D::Vector3 start = _startPosition;
+    G3D::Vector3 dest = _endPosition;
+    BuildPolyPath(start, dest);
+}
+
 bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool forceDest)
 {
     float x, y, z;
@@ -497,17 +547,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
             }
         }
         else
-        {
-            dtResult = _navMeshQuery->findPath(
-                            startPoly,          // start polygon
-                            endPoly,            // end polygon
-                            startPoint,         // start position
-                            endPoint,           // end position
-                            &_filter,           // polygon search filter
-                            _pathPolyRefs,     // [out] path
-                            (int*)&_polyLength,
-                            MAX_PATH_LENGTH);   // max number of polygons in output path
-        }
+            dtResult = FindPolyPath(startPoly, endPoly, startPoint, endPoint);
 
         if (!_polyLength || dtStatusFailed(dtResult))
         {
@@ -531,6 +571,53 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     BuildPointPath(startPoint, endPoint);
 }
 
+// Full search of the poly path, creatures heading to the same polygon share their corridors through the cache of the map
+dtStatus PathGenerator::FindPolyPath(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint)
+{
+    PathCorridorCache* corridorCache = _source->GetMap()->GetPathCorridorCache();
+    if (corridorCache)
+    {
+        // polygons reachable in one step from the start, a corridor passing any of them only needs that step added
+        std::array<dtPolyRef, DT_VERTS_PER_POLYGON + 2> neighbours;
+        std::size_t neighbourCount = 0;
+        dtMeshTile const* tile = nullptr;
+        dtPoly const* poly = nullptr;
+        if (dtStatusSucceed(_navMesh->getTileAndPolyByRef(startPoly, &tile, &poly)))
+        {
+            for (uint32 link = poly->firstLink; link != DT_NULL_LINK && neighbourCount < neighbours.size(); link = tile->links[link].next)
+            {
+                dtPolyRef neighbour = tile->links[link].ref;
+                dtMeshTile const* neighbourTile = nullptr;
+                dtPoly const* neighbourPoly = nullptr;
+                if (neighbour && dtStatusSucceed(_navMesh->getTileAndPolyByRef(neighbour, &neighbourTile, &neighbourPoly))
+                    && _filter.passFilter(neighbour, neighbourTile, neighbourPoly))
+                    neighbours[neighbourCount++] = neighbour;
+            }
+        }
+
+        PathCorridorCache::Key key = { .NavMesh = _navMesh, .EndPoly = endPoly, .IncludeFlags = _filter.getIncludeFlags(), .ExcludeFlags = _filter.getExcludeFlags() };
+        _polyLength = corridorCache->Find(key, startPoly, std::span(neighbours.data(), neighbourCount), std::span(_pathPolyRefs));
+        if (_polyLength)
+            return DT_SUCCESS;
+
+        dtStatus result = _navMeshQuery->findPath(startPoly, endPoly, startPoint, endPoint, &_filter, _pathPolyRefs, (int*)&_polyLength, MAX_PATH_LENGTH);
+        if (dtStatusSucceed(result) && !dtStatusDetail(result, DT_PARTIAL_RESULT))
+            corridorCache->Store(key, std::span(_pathPolyRefs, _polyLength));
+
+        return result;
+    }
+
+    return _navMeshQuery->findPath(
+                    startPoly,          // start polygon
+                    endPoly,            // end polygon
+                    startPoint,         // start position
+                    endPoint,           // end position
+                    &_filter,           // polygon search filter
+                    _pathPolyRefs,     // [out] path
+                    (int*)&_polyLength,
+                    MAX_PATH_LENGTH);   // max number of polygons in output path
+}
+
 void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoint)
 {
     float pathPoints[MAX_POINT_PATH_LENGTH*VERTEX_SIZE];
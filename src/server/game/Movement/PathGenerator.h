@@ -24,6 +24,7 @@
 #include "MoveSplineInitArgs.h"
 #include <G3D/Vector3.h>
 
+class Map;
 class WorldObject;
 
 // 74*4.0f=296y number_of_points*interval = max_path_len
@@ -67,6 +68,11 @@ class TC_GAME_API PathGenerator
         // return: true if new path was calculated, false otherwise (no change needed)
         bool CalculatePath(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest = false);
         bool CalculatePath(float destX, float destY, float destZ, bool forceDest = false);
+        // Same as CalculatePath, but with MapUpdate.AsyncPathfinding enabled the search is queued and runs in parallel with
+        // the other searches of the map once its objects were updated. The previous result stays until IsCalculating returns false
+        bool CalculatePathAsync(float destX, float destY, float destZ, bool forceDest = false);
+        bool IsCalculating() const { return _queuedOn != nullptr; }
+        void CancelCalculation();
         bool IsInvalidDestinationZ(WorldObject const* target) const;
 
         // option setters - use optional
@@ -88,6 +94,7 @@ class TC_GAME_API PathGenerator
         void ShortenPathUntilDist(G3D::Vector3 const& target, float dist);
 
     private:
+        friend class Map;
 
         dtPolyRef _pathPolyRefs[MAX_PATH_LENGTH];   // array of detour polygon references
         uint32 _polyLength;                         // number of polygons in the path
@@ -110,6 +117,12 @@ class TC_GAME_API PathGenerator
 
         dtQueryFilter _filter;  // use single filter for all movements, update it when needed
 
+        Map* _queuedOn;         // map the search is queued on until it was run
+
+        bool StartCalculation(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest, bool async);
+        // runs the search prepared by StartCalculation, only reads the state of the source and its map
+        void FinishCalculation();
+
         void SetStartPosition(G3D::Vector3 const& point) { _startPosition = point; }
         void SetEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; _endPosition = point; }
         void SetActualEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; }
@@ -130,6 +143,7 @@ class TC_GAME_API PathGenerator
         bool HaveTile(G3D::Vector3 const& p) const;
 
         void BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
+        dtStatus FindPolyPath(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint);
         void BuildPointPath(float const* startPoint, float const* endPoint);
         void BuildShortcut();
 
@@ -52,6 +52,7 @@ namespace Movement
     {
         friend class WorldPackets::Movement::CommonMovement;
         friend class WorldPackets::Movement::MonsterMove;
+        friend class MoveSplineBatch;
 
     public:
         typedef Spline<int32> MySpline;
@@ -0,0 +1,276 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MoveSplineBatch.h"
+#include "Creature.h"
+#include "GridDefines.h"
+#include "Map.h"
+#include "MoveSpline.h"
+#include <cmath>
+
+namespace Movement
+{
+MoveSplineBatch::MoveSplineBatch(float relocationDistance) : _relocationDistanceSq(relocationDistance * relocationDistance),
+    _updating(false), _removedCount(0)
+{
+}
+
+MoveSplineBatch::~MoveSplineBatch()
+{
+    for (Creature* creature : _creatures)
+        if (creature)
+            creature->_moveSplineBatchSlot = NoSlot;
+}
+
+bool MoveSplineBatch::CanAdvance(Creature const* creature)
+{
+    MoveSpline const& spline = *creature->movespline;
+    if (!spline.Initialized() || spline.Finalized() || spline.onTransport)
+        return false;
+
+    if (spline.spline.mode() != SplineBase::ModeLinear || spline.anim_tier)
+        return false;
+
+    return !spline.splineflags.HasFlag(MoveSplineFlagEnum::Parabolic | MoveSplineFlagEnum::Falling | MoveSplineFlagEnum::Turning
+        | MoveSplineFlagEnum::OrientationFixed | MoveSplineFlagEnum::JumpOrientationFixed);
+}
+
+void MoveSplineBatch::Add(Creature* creature)
+{
+    if (!CanAdvance(creature))
+    {
+        Remove(creature);
+        return;
+    }
+
+    if (creature->_moveSplineBatchSlot == NoSlot)
+    {
+        creature->_moveSplineBatchSlot = uint32(_creatures.size());
+        _creatures.push_back(creature);
+        _splineIds.emplace_back();
+        _pointIndexes.emplace_back();
+        _segmentStarts.emplace_back();
+        _segmentEnds.emplace_back();
+        _segmentScales.emplace_back();
+        _startX.emplace_back();
+        _startY.emplace_back();
+        _startZ.emplace_back();
+        _deltaX.emplace_back();
+        _deltaY.emplace_back();
+        _deltaZ.emplace_back();
+        _orientations.emplace_back();
+        _relocatedX.emplace_back();
+        _relocatedY.emplace_back();
+        _relocatedZ.emplace_back();
+    }
+
+    uint32 slot = creature->_moveSplineBatchSlot;
+    Load(slot);
+    _relocatedX[slot] = creature->GetPositionX();
+    _relocatedY[slot] = creature->GetPositionY();
+    _relocatedZ[slot] = creature->GetPositionZ();
+}
+
+void MoveSplineBatch::Remove(Creature* creature)
+{
+    uint32 slot = creature->_moveSplineBatchSlot;
+    if (slot == NoSlot)
+        return;
+
+    creature->_moveSplineBatchSlot = NoSlot;
+
+    // slots must not move while they are iterated, the gaps are closed once the update finished
+    if (_updating)
+    {
+        _creatures[slot] = nullptr;
+        ++_removedCount;
+    }
+    else
+        Erase(slot);
+}
+
+void MoveSplineBatch::Load(uint32 slot)
+{
+    MoveSpline const& spline = *_creatures[slot]->movespline;
+    int32 point = spline.point_Idx;
+    Vector3 const& start = spline.spline.getPoint(point);
+    Vector3 const& end = spline.spline.getPoint(point + 1);
+
+    _splineIds[slot] = spline.GetId();
+    _pointIndexes[slot] = point;
+    _segmentStarts[slot] = spline.spline.length(point);
+    _segmentEnds[slot] = spline.spline.length(point + 1);
+    int32 duration = _segmentEnds[slot] - _segmentStarts[slot];
+    _segmentScales[slot] = duration > 0 ? 1.0f / float(duration) : 0.0f;
+    _startX[slot] = start.x;
+    _startY[slot] = start.y;
+    _startZ[slot] = start.z;
+    _deltaX[slot] = end.x - start.x;
+    _deltaY[slot] = end.y - start.y;
+    _deltaZ[slot] = end.z - start.z;
+
+    // same as MoveSpline::computePosition, the derivative of a linear segment is constant
+    float orientation = spline.initialOrientation;
+    if (_deltaX[slot] != 0.0f || _deltaY[slot] != 0.0f)
+        orientation = std::atan2(_deltaY[slot], _deltaX[slot]);
+    if (spline.splineflags.Backward)
+        orientation -= float(M_PI);
+    _orientations[slot] = orientation;
+}
+
+void MoveSplineBatch::Erase(uint32 slot)
+{
+    uint32 last = uint32(_creatures.size() - 1);
+    if (slot != last)
+    {
+        _creatures[slot] = _creatures[last];
+        _splineIds[slot] = _splineIds[last];
+        _pointIndexes[slot] = _pointIndexes[last];
+        _segmentStarts[slot] = _segmentStarts[last];
+        _segmentEnds[slot] = _segmentEnds[last];
+        _segmentScales[slot] = _segmentScales[last];
+        _startX[slot] = _startX[last];
+        _startY[slot] = _startY[last];
+        _startZ[slot] = _startZ[last];
+        _deltaX[slot] = _deltaX[last];
+        _deltaY[slot] = _deltaY[last];
+        _deltaZ[slot] = _deltaZ[last];
+        _orientations[slot] = _orientations[last];
+        _relocatedX[slot] = _relocatedX[last];
+        _relocatedY[slot] = _relocatedY[last];
+        _relocatedZ[slot] = _relocatedZ[last];
+        if (_creatures[slot])
+            _creatures[slot]->_moveSplineBatchSlot = slot;
+    }
+
+    _creatures.pop_back();
+    _splineIds.pop_back();
+    _pointIndexes.pop_back();
+    _segmentStarts.pop_back();
+    _segmentEnds.pop_back();
+    _segmentScales.pop_back();
+    _startX.pop_back();
+    _startY.pop_back();
+    _startZ.pop_back();
+    _deltaX.pop_back();
+    _deltaY.pop_back();
+    _deltaZ.pop_back();
+    _orientations.pop_back();
+    _relocatedX.pop_back();
+    _relocatedY.pop_back();
+    _relocatedZ.pop_back();
+}
+
+void MoveSplineBatch::Compact()
+{
+    for (uint32 slot = uint32(_creatures.size()); slot > 0 && _removedCount; --slot)
+    {
+        if (_creatures[slot - 1])
+            continue;
+
+        Erase(slot - 1);
+        --_removedCount;
+    }
+}
+
+void MoveSplineBatch::Update(Map& map, uint32 diff)
+{
+    _updating = true;
+
+    _advanced.clear();
+    _times.clear();
+    std::size_t count = _creatures.size();
+    for (uint32 slot = 0; slot < count; ++slot)
+    {
+        Creature* creature = _creatures[slot];
+        if (!creature || !map.isCellMarked(Trinity::ComputeCellCoord(creature->GetPositionX(), creature->GetPositionY()).GetId()))
+            continue;
+
+        MoveSpline& spline = *creature->movespline;
+        // the spline was stopped or finished by a zero length update since it was launched
+        if (!CanAdvance(creature))
+        {
+            Remove(creature);
+            continue;
+        }
+
+        if (spline.GetId() != _splineIds[slot] || spline.point_Idx != _pointIndexes[slot])
+            Load(slot);
+
+        int32 time = spline.time_passed + int32(diff);
+        if (time >= _segmentEnds[slot])
+        {
+            // segment ends, arrivals and cycles are handled by the spline itself
+            creature->UpdateSplineMovement(diff);
+            if (creature->_moveSplineBatchSlot != slot)
+                continue;
+
+            if (!CanAdvance(creature))
+            {
+                Remove(creature);
+                continue;
+            }
+
+            Load(slot);
+            _relocatedX[slot] = creature->GetPositionX();
+            _relocatedY[slot] = creature->GetPositionY();
+            _relocatedZ[slot] = creature->GetPositionZ();
+            continue;
+        }
+
+        spline.time_passed = time;
+        _advanced.push_back(slot);
+        _times.push_back(time);
+    }
+
+    // every spline advanced this tick stays within its current segment
+    std::size_t advancedCount = _advanced.size();
+    _x.resize(advancedCount);
+    _y.resize(advancedCount);
+    _z.resize(advancedCount);
+    for (std::size_t i = 0; i < advancedCount; ++i)
+    {
+        uint32 slot = _advanced[i];
+        float u = float(_times[i] - _segmentStarts[slot]) * _segmentScales[slot];
+        _x[i] = _startX[slot] + _deltaX[slot] * u;
+        _y[i] = _startY[slot] + _deltaY[slot] * u;
+        _z[i] = _startZ[slot] + _deltaZ[slot] * u;
+    }
+
+    for (std::size_t i = 0; i < advancedCount; ++i)
+    {
+        uint32 slot = _advanced[i];
+        Creature* creature = _creatures[slot];
+        if (!creature)
+            continue;
+
+        float dx = _x[i] - _relocatedX[slot];
+        float dy = _y[i] - _relocatedY[slot];
+        float dz = _z[i] - _relocatedZ[slot];
+        if (dx * dx + dy * dy + dz * dz < _relocationDistanceSq)
+            continue;
+
+        creature->UpdateSplinePosition(Location(_x[i], _y[i], _z[i], _orientations[slot]));
+        _relocatedX[slot] = _x[i];
+        _relocatedY[slot] = _y[i];
+        _relocatedZ[slot] = _z[i];
+    }
+
+    _updating = false;
+    Compact();
+}
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYSERVER_MOVESPLINEBATCH_H
+#define TRINITYSERVER_MOVESPLINEBATCH_H
+
+#include "Define.h"
+#include <limits>
+#include <vector>
+
+class Creature;
+class Map;
+
+namespace Movement
+{
+    /*
+     * Linear splines of the creatures of a map, advanced together before the objects of the map are updated.
+     * The current segment of every spline is kept in flat arrays and interpolated in one pass; the creature
+     * is only called back when its spline reaches the end of a segment or moved further than the relocation
+     * distance since it was last relocated. Splines of any other kind (smooth, falling, parabolic, turning,
+     * on a transport) are left to Unit::UpdateSplineMovement.
+     */
+    class TC_GAME_API MoveSplineBatch
+    {
+    public:
+        static constexpr uint32 NoSlot = std::numeric_limits<uint32>::max();
+
+        explicit MoveSplineBatch(float relocationDistance);
+        ~MoveSplineBatch();
+
+        MoveSplineBatch(MoveSplineBatch const&) = delete;
+        MoveSplineBatch(MoveSplineBatch&&) = delete;
+        MoveSplineBatch& operator=(MoveSplineBatch const&) = delete;
+        MoveSplineBatch& operator=(MoveSplineBatch&&) = delete;
+
+        // Takes over the spline just launched by creature if the batch can advance it, gives it back otherwise
+        void Add(Creature* creature);
+        void Remove(Creature* creature);
+
+        // Advances the splines of creatures in cells marked for update this tick
+        void Update(Map& map, uint32 diff);
+
+        std::size_t GetSize() const { return _creatures.size() - _removedCount; }
+
+    private:
+        static bool CanAdvance(Creature const* creature);
+        void Load(uint32 slot);
+        void Erase(uint32 slot);
+        void Compact();
+
+        float _relocationDistanceSq;
+        bool _updating;
+        std::size_t _removedCount;
+
+        // one element per spline, the segment is reloaded whenever the spline moved past it
+        std::vector<Creature*> _creatures;
+        std::vector<uint32> _splineIds;
+        std::vector<int32> _pointIndexes;
+        std::vector<int32> _segmentStarts;
+        std::vector<int32> _segmentEnds;
+        std::vector<float> _segmentScales;      // 1 / segment duration
+        std::vector<float> _startX, _startY, _startZ;
+        std::vector<float> _deltaX, _deltaY, _deltaZ;
+        std::vector<float> _orientations;
+        std::vector<float> _relocatedX, _relocatedY, _relocatedZ;
+
+        // filled during Update, splines staying inside their segment this tick
+        std::vector<uint32> _advanced;
+        std::vector<int32> _times;
+        std::vector<float> _x, _y, _z;
+    };
+}
+
+#endif // TRINITYSERVER_MOVESPLINEBATCH_H
@@ -17,7 +17,9 @@
 
 #include "MoveSplineInit.h"
 #include "Creature.h"
+#include "Map.h"
 #include "MoveSpline.h"
+#include "MoveSplineBatch.h"
 #include "MovementPackets.h"
 #include "PathGenerator.h"
 #include "Unit.h"
@@ -173,6 +175,10 @@ namespace Movement
 
         unit->SendMessageToSet(packet.Write(), true);
 
+        if (Creature* creature = unit->ToCreature(); creature && creature->IsInWorld())
+            if (MoveSplineBatch* batch = creature->GetMap()->GetMoveSplineBatch())
+                batch->Add(creature);
+
         return move_spline.Duration();
     }
 
@@ -93,6 +93,7 @@ public:
     PhaseShift& operator=(PhaseShift&& right) noexcept;
     ~PhaseShift();
 
+    EnumFlag<PhaseShiftFlags> GetFlags() const { return Flags; }
     ObjectGuid GetPersonalGuid() const { return PersonalGuid; }
 
     bool AddPhase(uint32 phaseId, PhaseFlags flags, std::vector<Condition> const* areaConditions, int32 references = 1);
@@ -134,6 +135,11 @@ protected:
     int32 PersonalReferences = 0;
     int32 DefaultReferences = 0;
     bool IsDbPhaseShift = false;
+
+    // State of the player the area conditions of Phases were last evaluated for, see PhasingHandler::OnAreaChange
+    uint32 AreaConditionsStoreRevision = 0;
+    uint32 AreaConditionsQuestStatusRevision = 0;
+    uint32 AreaConditionsAuraApplicationRevision = 0;
 };
 
 #endif // PhaseShift_h__
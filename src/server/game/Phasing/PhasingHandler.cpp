@@ -303,8 +303,26 @@ void PhasingHandler::OnAreaChange(WorldObject* object)
     PhaseShift& phaseShift = object->GetPhaseShift();
     PhaseShift& suppressedPhaseShift = object->GetSuppressedPhaseShift();
     PhaseShift::PhaseContainer oldPhases = std::move(phaseShift.Phases); // for comparison
+    PhaseShift::PhaseContainer oldSuppressedPhases = std::move(suppressedPhaseShift.Phases);
     ConditionSourceInfo srcInfo = ConditionSourceInfo(object);
 
+    // conditions only reading quests and auras of the player still have the result of the previous area if neither changed since
+    bool canReuseResults = HasAreaConditionsState(object, phaseShift);
+    auto isMeetingConditions = [&](PhaseAreaInfo const& phaseArea)
+    {
+        if (canReuseResults && !phaseArea.Conditions.empty() && phaseArea.Conditions.front().CacheableList)
+        {
+            PhaseShift::PhaseRef const key(phaseArea.PhaseInfo->Id, PhaseFlags::None, nullptr);
+            if (auto itr = oldPhases.find(key); itr != oldPhases.end() && itr->AreaConditions == &phaseArea.Conditions)
+                return true;
+
+            if (auto itr = oldSuppressedPhases.find(key); itr != oldSuppressedPhases.end() && itr->AreaConditions == &phaseArea.Conditions)
+                return false;
+        }
+
+        return sConditionMgr->IsObjectMeetToConditions(srcInfo, phaseArea.Conditions);
+    };
+
     object->GetPhaseShift().ClearPhases();
     object->GetSuppressedPhaseShift().ClearPhases();
 
@@ -323,7 +341,7 @@ void PhasingHandler::OnAreaChange(WorldObject* object)
                 if (DisableMgr::IsDisabledFor(DISABLE_TYPE_PHASE_AREA, phaseId, object))
                     continue;
 
-                if (sConditionMgr->IsObjectMeetToConditions(srcInfo, phaseArea.Conditions))
+                if (isMeetingConditions(phaseArea))
                     phaseShift.AddPhase(phaseId, GetPhaseFlags(phaseId), &phaseArea.Conditions);
                 else
                     suppressedPhaseShift.AddPhase(phaseId, GetPhaseFlags(phaseId), &phaseArea.Conditions);
@@ -333,6 +351,8 @@ void PhasingHandler::OnAreaChange(WorldObject* object)
         areaEntry = sAreaTableStore.LookupEntry(areaEntry->ParentAreaID);
     }
 
+    StoreAreaConditionsState(object, phaseShift);
+
     bool changed = phaseShift.Phases != oldPhases;
     if (Unit* unit = object->ToUnit())
     {
@@ -372,16 +392,37 @@ void PhasingHandler::OnAreaChange(WorldObject* object)
 }
 
 bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibility /*= true*/)
+{
+    return UpdateConditionalPhases(object, updateVisibility, 0);
+}
+
+bool PhasingHandler::OnQuestChange(WorldObject* object, uint32 questId, bool updateVisibility /*= true*/)
+{
+    return UpdateConditionalPhases(object, updateVisibility, questId);
+}
+
+bool PhasingHandler::UpdateConditionalPhases(WorldObject* object, bool updateVisibility, uint32 changedQuestId)
 {
     PhaseShift& phaseShift = object->GetPhaseShift();
     PhaseShift& suppressedPhaseShift = object->GetSuppressedPhaseShift();
+    PhaseShift::PhaseContainer oldPhases = phaseShift.Phases; // for comparison
     PhaseShift newSuppressions;
     ConditionSourceInfo srcInfo = ConditionSourceInfo(object);
     bool changed = false;
 
+    // without a changed quest every condition is evaluated again
+    auto needsEvaluation = [&](ConditionContainer const& conditions)
+    {
+        return !changedQuestId || sConditionMgr->IsConditionListDependingOnQuest(conditions, changedQuestId);
+    };
+    auto terrainSwapNeedsEvaluation = [&](uint32 terrainSwapId)
+    {
+        return !changedQuestId || sConditionMgr->IsNotGroupedEntryDependingOnQuest(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, terrainSwapId, changedQuestId);
+    };
+
     for (auto itr = phaseShift.Phases.begin(); itr != phaseShift.Phases.end();)
     {
-        if (itr->AreaConditions && !sConditionMgr->IsObjectMeetToConditions(srcInfo, *itr->AreaConditions))
+        if (itr->AreaConditions && needsEvaluation(*itr->AreaConditions) && !sConditionMgr->IsObjectMeetToConditions(srcInfo, *itr->AreaConditions))
         {
             newSuppressions.AddPhase(itr->Id, itr->Flags, itr->AreaConditions, itr->References);
             phaseShift.ModifyPhasesReferences(itr, -itr->References);
@@ -393,9 +434,10 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
 
     for (auto itr = suppressedPhaseShift.Phases.begin(); itr != suppressedPhaseShift.Phases.end();)
     {
-        if (!DisableMgr::IsDisabledFor(DISABLE_TYPE_PHASE_AREA, itr->Id, object) && sConditionMgr->IsObjectMeetToConditions(srcInfo, *ASSERT_NOTNULL(itr->AreaConditions)))
+        if (needsEvaluation(*ASSERT_NOTNULL(itr->AreaConditions)) && !DisableMgr::IsDisabledFor(DISABLE_TYPE_PHASE_AREA, itr->Id, object)
+            && sConditionMgr->IsObjectMeetToConditions(srcInfo, *itr->AreaConditions))
         {
-            changed = phaseShift.AddPhase(itr->Id, itr->Flags, itr->AreaConditions, itr->References) || changed;
+            phaseShift.AddPhase(itr->Id, itr->Flags, itr->AreaConditions, itr->References);
             suppressedPhaseShift.ModifyPhasesReferences(itr, -itr->References);
             itr = suppressedPhaseShift.Phases.erase(itr);
         }
@@ -405,7 +447,7 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
 
     for (auto itr = phaseShift.VisibleMapIds.begin(); itr != phaseShift.VisibleMapIds.end();)
     {
-        if (!sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
+        if (terrainSwapNeedsEvaluation(itr->first) && !sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
         {
             newSuppressions.AddVisibleMapId(itr->first, itr->second.VisibleMapInfo, itr->second.References);
             for (uint32 uiMapPhaseId : itr->second.VisibleMapInfo->UiMapPhaseIDs)
@@ -419,7 +461,7 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
 
     for (auto itr = suppressedPhaseShift.VisibleMapIds.begin(); itr != suppressedPhaseShift.VisibleMapIds.end();)
     {
-        if (sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
+        if (terrainSwapNeedsEvaluation(itr->first) && sConditionMgr->IsObjectMeetingNotGroupedConditions(CONDITION_SOURCE_TYPE_TERRAIN_SWAP, itr->first, srcInfo))
         {
             changed = phaseShift.AddVisibleMapId(itr->first, itr->second.VisibleMapInfo, itr->second.References) || changed;
             for (uint32 uiMapPhaseId : itr->second.VisibleMapInfo->UiMapPhaseIDs)
@@ -461,13 +503,20 @@ bool PhasingHandler::OnConditionChange(WorldObject* object, bool updateVisibilit
     if (phaseShift.PersonalReferences)
         phaseShift.PersonalGuid = object->GetGUID();
 
-    changed = changed || !newSuppressions.Phases.empty() || !newSuppressions.VisibleMapIds.empty();
+    // a phase suppressed here can still be kept by an aura, visibility is only updated when the phases differ afterwards
+    changed = changed || !newSuppressions.VisibleMapIds.empty() || phaseShift.Phases != oldPhases;
     for (PhaseShift::PhaseRef const& phaseRef : newSuppressions.Phases)
         suppressedPhaseShift.AddPhase(phaseRef.Id, phaseRef.Flags, phaseRef.AreaConditions, phaseRef.References);
 
     for (std::pair<uint32 const, PhaseShift::VisibleMapIdRef> const& visibleMap : newSuppressions.VisibleMapIds)
         suppressedPhaseShift.AddVisibleMapId(visibleMap.first, visibleMap.second.VisibleMapInfo, visibleMap.second.References);
 
+    // phases whose conditions were not evaluated may be stale for anything but changedQuestId
+    if (!changedQuestId)
+        StoreAreaConditionsState(object, phaseShift);
+    else
+        phaseShift.AreaConditionsStoreRevision = 0;
+
     if (unit)
     {
         if (changed)
@@ -691,6 +740,26 @@ bool PhasingHandler::IsPersonalPhase(uint32 phaseId)
     return false;
 }
 
+void PhasingHandler::StoreAreaConditionsState(WorldObject const* object, PhaseShift& phaseShift)
+{
+    Player const* player = object->ToPlayer();
+    if (!player)
+        return;
+
+    phaseShift.AreaConditionsStoreRevision = sConditionMgr->GetStoreRevision();
+    phaseShift.AreaConditionsQuestStatusRevision = player->GetQuestStatusRevision();
+    phaseShift.AreaConditionsAuraApplicationRevision = player->GetAuraApplicationRevision();
+}
+
+bool PhasingHandler::HasAreaConditionsState(WorldObject const* object, PhaseShift const& phaseShift)
+{
+    Player const* player = object->ToPlayer();
+    return player && phaseShift.AreaConditionsStoreRevision
+        && phaseShift.AreaConditionsStoreRevision == sConditionMgr->GetStoreRevision()
+        && phaseShift.AreaConditionsQuestStatusRevision == player->GetQuestStatusRevision()
+        && phaseShift.AreaConditionsAuraApplicationRevision == player->GetAuraApplicationRevision();
+}
+
 void PhasingHandler::UpdateVisibilityIfNeeded(WorldObject* object, bool updateVisibility, bool changed)
 {
     if (changed && object->IsInWorld())
@@ -698,6 +767,10 @@ void PhasingHandler::UpdateVisibilityIfNeeded(WorldObject* object, bool updateVi
         if (Player* player = object->ToPlayer())
             SendToPlayer(player);
 
+        // gameobject models block line of sight only for objects sharing their phases
+        if (object->IsGameObject())
+            object->GetMap()->InvalidateDynamicLineOfSight();
+
         if (updateVisibility)
         {
             if (Player* player = object->ToPlayer())
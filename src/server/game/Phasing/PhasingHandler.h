@@ -53,6 +53,8 @@ public:
     static void OnMapChange(WorldObject* object);
     static void OnAreaChange(WorldObject* object);
     static bool OnConditionChange(WorldObject* object, bool updateVisibility = true);
+    // Same as OnConditionChange but only evaluates the phases and terrain swaps whose conditions can depend on questId
+    static bool OnQuestChange(WorldObject* object, uint32 questId, bool updateVisibility = true);
 
     static void SendToPlayer(Player const* player, PhaseShift const& phaseShift);
     static void SendToPlayer(Player const* player);
@@ -85,6 +87,9 @@ private:
     static void RemovePhaseGroup(WorldObject* object, std::vector<uint32> const* phasesInGroup, bool updateVisibility, ControlledUnitVisitor& visitor);
     static void AddVisibleMapId(WorldObject* object, uint32 visibleMapId, ControlledUnitVisitor& visitor);
     static void RemoveVisibleMapId(WorldObject* object, uint32 visibleMapId, ControlledUnitVisitor& visitor);
+    static bool UpdateConditionalPhases(WorldObject* object, bool updateVisibility, uint32 changedQuestId);
+    static void StoreAreaConditionsState(WorldObject const* object, PhaseShift& phaseShift);
+    static bool HasAreaConditionsState(WorldObject const* object, PhaseShift const& phaseShift);
     static void UpdateVisibilityIfNeeded(WorldObject* object, bool updateVisibility, bool changed);
 };
 
@@ -24,12 +24,38 @@
 #include "Map.h"
 #include "MapUtils.h"
 #include "ObjectMgr.h"
+#include "Optional.h"
 #include <fmt/ranges.h>
 
-PoolObject::PoolObject(uint64 _guid, float _chance) : guid(_guid), chance(std::fabs(_chance))
+PoolObject::PoolObject(uint64 _guid, float _chance) : guid(_guid), chance(std::fabs(_chance)), index(0)
 {
 }
 
+namespace
+{
+bool IsMemberBitSet(SpawnedPoolMembers const& members, uint32 pool_id, uint32 index)
+{
+    auto itr = members.find(pool_id);
+    return itr != members.end() && index / 64 < itr->second.size() && (itr->second[index / 64] >> (index % 64)) & 1;
+}
+
+void SetMemberBit(SpawnedPoolMembers& members, uint32 pool_id, uint32 index)
+{
+    std::vector<uint64>& bits = members[pool_id];
+    if (index / 64 >= bits.size())
+        bits.resize(index / 64 + 1);
+
+    bits[index / 64] |= UI64LIT(1) << (index % 64);
+}
+
+void ClearMemberBit(SpawnedPoolMembers& members, uint32 pool_id, uint32 index)
+{
+    auto itr = members.find(pool_id);
+    if (itr != members.end() && index / 64 < itr->second.size())
+        itr->second[index / 64] &= ~(UI64LIT(1) << (index % 64));
+}
+}
+
 ////////////////////////////////////////////////////////////
 // template class SpawnedPoolData
 
@@ -47,14 +73,16 @@ uint32 SpawnedPoolData::GetSpawnedObjects(uint32 pool_id) const
 template<>
 TC_GAME_API bool SpawnedPoolData::IsSpawnedObject<Creature>(uint64 db_guid) const
 {
-    return mSpawnedCreatures.find(db_guid) != mSpawnedCreatures.end();
+    PoolMember const* member = sPoolMgr->GetPoolMember<Creature>(db_guid);
+    return member && IsMemberBitSet(mSpawnedCreatures, member->PoolId, member->Index);
 }
 
 // Method that tell if a gameobject is spawned currently
 template<>
 TC_GAME_API bool SpawnedPoolData::IsSpawnedObject<GameObject>(uint64 db_guid) const
 {
-    return mSpawnedGameobjects.find(db_guid) != mSpawnedGameobjects.end();
+    PoolMember const* member = sPoolMgr->GetPoolMember<GameObject>(db_guid);
+    return member && IsMemberBitSet(mSpawnedGameobjects, member->PoolId, member->Index);
 }
 
 // Method that tell if a pool is spawned currently
@@ -78,48 +106,66 @@ bool SpawnedPoolData::IsSpawnedObject(SpawnObjectType type, uint64 db_guid_or_po
 }
 
 template<>
-void SpawnedPoolData::AddSpawn<Creature>(uint64 db_guid, uint32 pool_id)
+bool SpawnedPoolData::IsSpawnedMember<Creature>(uint32 pool_id, PoolObject const& obj) const
+{
+    return IsMemberBitSet(mSpawnedCreatures, pool_id, obj.index);
+}
+
+template<>
+bool SpawnedPoolData::IsSpawnedMember<GameObject>(uint32 pool_id, PoolObject const& obj) const
+{
+    return IsMemberBitSet(mSpawnedGameobjects, pool_id, obj.index);
+}
+
+template<>
+bool SpawnedPoolData::IsSpawnedMember<Pool>(uint32 /*pool_id*/, PoolObject const& obj) const
+{
+    return IsSpawnedObject<Pool>(obj.guid);
+}
+
+template<>
+void SpawnedPoolData::AddSpawn<Creature>(PoolObject const& obj, uint32 pool_id)
 {
-    mSpawnedCreatures.insert(db_guid);
+    SetMemberBit(mSpawnedCreatures, pool_id, obj.index);
     ++mSpawnedPools[pool_id];
 }
 
 template<>
-void SpawnedPoolData::AddSpawn<GameObject>(uint64 db_guid, uint32 pool_id)
+void SpawnedPoolData::AddSpawn<GameObject>(PoolObject const& obj, uint32 pool_id)
 {
-    mSpawnedGameobjects.insert(db_guid);
+    SetMemberBit(mSpawnedGameobjects, pool_id, obj.index);
     ++mSpawnedPools[pool_id];
 }
 
 template<>
-void SpawnedPoolData::AddSpawn<Pool>(uint64 sub_pool_id, uint32 pool_id)
+void SpawnedPoolData::AddSpawn<Pool>(PoolObject const& obj, uint32 pool_id)
 {
-    mSpawnedPools[sub_pool_id] = 0;
+    mSpawnedPools[obj.guid] = 0;
     ++mSpawnedPools[pool_id];
 }
 
 template<>
-void SpawnedPoolData::RemoveSpawn<Creature>(uint64 db_guid, uint32 pool_id)
+void SpawnedPoolData::RemoveSpawn<Creature>(PoolObject const& obj, uint32 pool_id)
 {
-    mSpawnedCreatures.erase(db_guid);
+    ClearMemberBit(mSpawnedCreatures, pool_id, obj.index);
     uint32& val = mSpawnedPools[pool_id];
     if (val > 0)
         --val;
 }
 
 template<>
-void SpawnedPoolData::RemoveSpawn<GameObject>(uint64 db_guid, uint32 pool_id)
+void SpawnedPoolData::RemoveSpawn<GameObject>(PoolObject const& obj, uint32 pool_id)
 {
-    mSpawnedGameobjects.erase(db_guid);
+    ClearMemberBit(mSpawnedGameobjects, pool_id, obj.index);
     uint32& val = mSpawnedPools[pool_id];
     if (val > 0)
         --val;
 }
 
 template<>
-void SpawnedPoolData::RemoveSpawn<Pool>(uint64 sub_pool_id, uint32 pool_id)
+void SpawnedPoolData::RemoveSpawn<Pool>(PoolObject const& obj, uint32 pool_id)
 {
-    mSpawnedPools.erase(sub_pool_id);
+    mSpawnedPools.erase(obj.guid);
     uint32& val = mSpawnedPools[pool_id];
     if (val > 0)
         --val;
@@ -158,12 +204,38 @@ bool PoolGroup<Pool>::isEmptyDeepCheck() const
 
 // Method to add a gameobject/creature guid to the proper list depending on pool type and chance value
 template <class T>
-void PoolGroup<T>::AddEntry(PoolObject& poolitem, uint32 maxentries)
+uint32 PoolGroup<T>::AddEntry(PoolObject& poolitem, uint32 maxentries)
 {
+    poolitem.index = uint32(ExplicitlyChanced.size() + EqualChanced.size());
     if (poolitem.chance != 0 && maxentries == 1)
         ExplicitlyChanced.push_back(poolitem);
     else
         EqualChanced.push_back(poolitem);
+
+    return poolitem.index;
+}
+
+// Prepares rolling the explicitly chanced objects, needed after every change of them
+template <class T>
+void PoolGroup<T>::BuildChanceTable()
+{
+    if (ExplicitlyChanced.empty())
+    {
+        ExplicitChances = {};
+        return;
+    }
+
+    std::vector<double> chances;
+    chances.reserve(ExplicitlyChanced.size() + 1);
+    double left = 100.0;
+    for (PoolObject const& obj : ExplicitlyChanced)
+    {
+        chances.push_back(obj.chance);
+        left -= obj.chance;
+    }
+
+    chances.push_back(std::max(left, 0.0));
+    ExplicitChances.Build(chances);
 }
 
 // Method to check the chances are proper in this object pool
@@ -181,22 +253,61 @@ bool PoolGroup<T>::CheckPool() const
     return true;
 }
 
+namespace
+{
+// Position of an object already known to belong to the pool
+template <class T>
+Optional<uint32> GetPoolMemberIndex(uint32 pool_id, uint64 guid)
+{
+    PoolMember const* member = sPoolMgr->GetPoolMember<T>(guid);
+    if (!member || member->PoolId != pool_id)
+        return {};
+
+    return member->Index;
+}
+
+// Child pools are tracked by their id, not by their position
+template <>
+Optional<uint32> GetPoolMemberIndex<Pool>(uint32 pool_id, uint64 child_pool_id)
+{
+    if (sPoolMgr->IsPartOfAPool<Pool>(child_pool_id) != pool_id)
+        return {};
+
+    return 0;
+}
+}
+
 // Main method to despawn a creature or gameobject in a pool
 // If no guid is passed, the pool is just removed (event end case)
 // If guid is filled, cache will be used and no removal will occur, it just fill the cache
 template<class T>
 void PoolGroup<T>::DespawnObject(SpawnedPoolData& spawns, uint64 guid, bool alwaysDeleteRespawnTime)
 {
+    if (guid)
+    {
+        Optional<uint32> index = GetPoolMemberIndex<T>(poolId, guid);
+        if (!index)
+            return;
+
+        PoolObject obj(guid, 0.0f);
+        obj.index = *index;
+        if (spawns.IsSpawnedMember<T>(poolId, obj))
+        {
+            Despawn1Object(spawns, guid, alwaysDeleteRespawnTime);
+            spawns.RemoveSpawn<T>(obj, poolId);
+        }
+        else if (alwaysDeleteRespawnTime)
+            RemoveRespawnTimeFromDB(spawns, guid);
+        return;
+    }
+
     for (size_t i=0; i < EqualChanced.size(); ++i)
     {
         // if spawned
-        if (spawns.IsSpawnedObject<T>(EqualChanced[i].guid))
+        if (spawns.IsSpawnedMember<T>(poolId, EqualChanced[i]))
         {
-            if (!guid || EqualChanced[i].guid == guid)
-            {
-                Despawn1Object(spawns, EqualChanced[i].guid, alwaysDeleteRespawnTime);
-                spawns.RemoveSpawn<T>(EqualChanced[i].guid, poolId);
-            }
+            Despawn1Object(spawns, EqualChanced[i].guid, alwaysDeleteRespawnTime);
+            spawns.RemoveSpawn<T>(EqualChanced[i], poolId);
         }
         else if (alwaysDeleteRespawnTime)
             RemoveRespawnTimeFromDB(spawns, EqualChanced[i].guid);
@@ -205,13 +316,10 @@ void PoolGroup<T>::DespawnObject(SpawnedPoolData& spawns, uint64 guid, bool alwa
     for (size_t i = 0; i < ExplicitlyChanced.size(); ++i)
     {
         // spawned
-        if (spawns.IsSpawnedObject<T>(ExplicitlyChanced[i].guid))
+        if (spawns.IsSpawnedMember<T>(poolId, ExplicitlyChanced[i]))
         {
-            if (!guid || ExplicitlyChanced[i].guid == guid)
-            {
-                Despawn1Object(spawns, ExplicitlyChanced[i].guid, alwaysDeleteRespawnTime);
-                spawns.RemoveSpawn<T>(ExplicitlyChanced[i].guid, poolId);
-            }
+            Despawn1Object(spawns, ExplicitlyChanced[i].guid, alwaysDeleteRespawnTime);
+            spawns.RemoveSpawn<T>(ExplicitlyChanced[i], poolId);
         }
         else if (alwaysDeleteRespawnTime)
             RemoveRespawnTimeFromDB(spawns, ExplicitlyChanced[i].guid);
@@ -284,6 +392,42 @@ void PoolGroup<Pool>::RemoveOneRelation(uint32 child_pool_id)
             break;
         }
     }
+
+    BuildChanceTable();
+}
+
+template <class T>
+bool PoolGroup<T>::CanRoll(SpawnedPoolData const& spawns, PoolObject const& obj, uint64 triggerFrom) const
+{
+    // Triggering object is marked as spawned at this time and can be also rolled (respawn case)
+    return obj.guid == triggerFrom || !spawns.IsSpawnedMember<T>(poolId, obj);
+}
+
+template <class T>
+void PoolGroup<T>::RollEqualChanced(SpawnedPoolData const& spawns, uint32 count, uint64 triggerFrom, std::vector<PoolObject*>& rolledObjects)
+{
+    // Large pools with few of their objects spawned (gathering nodes, rares) draw random objects until
+    // enough unspawned ones are found instead of collecting all unspawned ones
+    if (std::size_t(count) * 4 <= EqualChanced.size())
+    {
+        for (uint32 attempts = count * 8 + 8; attempts && rolledObjects.size() < count; --attempts)
+        {
+            PoolObject* obj = &EqualChanced[urand(0, uint32(EqualChanced.size() - 1))];
+            if (CanRoll(spawns, *obj, triggerFrom) && std::ranges::find(rolledObjects, obj) == rolledObjects.end())
+                rolledObjects.push_back(obj);
+        }
+
+        if (rolledObjects.size() == count)
+            return;
+
+        rolledObjects.clear();
+    }
+
+    for (PoolObject& obj : EqualChanced)
+        if (CanRoll(spawns, obj, triggerFrom))
+            rolledObjects.push_back(&obj);
+
+    Trinity::Containers::RandomResize(rolledObjects, count);
 }
 
 template <class T>
@@ -299,49 +443,38 @@ void PoolGroup<T>::SpawnObject(SpawnedPoolData& spawns, uint32 limit, uint64 tri
 
     if (count > 0)
     {
-        PoolObjectList rolledObjects;
+        std::vector<PoolObject*> rolledObjects;
         rolledObjects.reserve(count);
 
         // roll objects to be spawned
-        if (!ExplicitlyChanced.empty())
+        if (!ExplicitChances.IsEmpty())
         {
-            float roll = rand_chance();
-
-            for (PoolObject& obj : ExplicitlyChanced)
+            // a spawned object gives its chance to the next unspawned one, the last column rolls none of them
+            for (uint32 i = ExplicitChances.Select(); i < ExplicitlyChanced.size(); ++i)
             {
-                roll -= obj.chance;
-                // Triggering object is marked as spawned at this time and can be also rolled (respawn case)
-                // so this need explicit check for this case
-                if (roll < 0 && (obj.guid == triggerFrom || !spawns.IsSpawnedObject<T>(obj.guid)))
+                if (CanRoll(spawns, ExplicitlyChanced[i], triggerFrom))
                 {
-                    rolledObjects.push_back(obj);
+                    rolledObjects.push_back(&ExplicitlyChanced[i]);
                     break;
                 }
             }
         }
 
         if (!EqualChanced.empty() && rolledObjects.empty())
-        {
-            std::copy_if(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(rolledObjects), [triggerFrom, &spawns](PoolObject const& object)
-            {
-                return object.guid == triggerFrom || !spawns.IsSpawnedObject<T>(object.guid);
-            });
-
-            Trinity::Containers::RandomResize(rolledObjects, count);
-        }
+            RollEqualChanced(spawns, count, triggerFrom, rolledObjects);
 
         // try to spawn rolled objects
-        for (PoolObject& obj : rolledObjects)
+        for (PoolObject* obj : rolledObjects)
         {
-            if (obj.guid == triggerFrom)
+            if (obj->guid == triggerFrom)
             {
-                ReSpawn1Object(spawns, &obj);
+                ReSpawn1Object(spawns, obj);
                 triggerFrom = 0;
             }
             else
             {
-                spawns.AddSpawn<T>(obj.guid, poolId);
-                Spawn1Object(spawns, &obj);
+                spawns.AddSpawn<T>(*obj, poolId);
+                Spawn1Object(spawns, obj);
             }
         }
     }
@@ -526,9 +659,8 @@ void PoolMgr::LoadFromDB()
                 PoolObject plObject = PoolObject(guid, chance);
                 PoolGroup<Creature>& cregroup = mPoolCreatureGroups[pool_id];
                 cregroup.SetPoolId(pool_id);
-                cregroup.AddEntry(plObject, pPoolTemplate->MaxLimit);
-                SearchPair p(guid, pool_id);
-                mCreatureSearchMap.insert(p);
+                uint32 index = cregroup.AddEntry(plObject, pPoolTemplate->MaxLimit);
+                mCreatureSearchMap.try_emplace(guid, PoolMember{ .PoolId = pool_id, .Index = index });
 
                 ++count;
             }
@@ -595,9 +727,8 @@ void PoolMgr::LoadFromDB()
                 PoolObject plObject = PoolObject(guid, chance);
                 PoolGroup<GameObject>& gogroup = mPoolGameobjectGroups[pool_id];
                 gogroup.SetPoolId(pool_id);
-                gogroup.AddEntry(plObject, pPoolTemplate->MaxLimit);
-                SearchPair p(guid, pool_id);
-                mGameobjectSearchMap.insert(p);
+                uint32 index = gogroup.AddEntry(plObject, pPoolTemplate->MaxLimit);
+                mGameobjectSearchMap.try_emplace(guid, PoolMember{ .PoolId = pool_id, .Index = index });
 
                 ++count;
             }
@@ -708,6 +839,13 @@ void PoolMgr::LoadFromDB()
         }
     }
 
+    for (auto& [poolId, group] : mPoolCreatureGroups)
+        group.BuildChanceTable();
+    for (auto& [poolId, group] : mPoolGameobjectGroups)
+        group.BuildChanceTable();
+    for (auto& [poolId, group] : mPoolPoolGroups)
+        group.BuildChanceTable();
+
     for (auto const& [poolId, templateData] : mPoolTemplate)
     {
         if (IsEmpty(poolId))
@@ -18,6 +18,7 @@
 #ifndef TRINITY_POOLHANDLER_H
 #define TRINITY_POOLHANDLER_H
 
+#include "AliasTable.h"
 #include "Define.h"
 #include "SpawnData.h"
 #include <map>
@@ -41,14 +42,21 @@ struct PoolObject
 {
     uint64 guid;
     float chance;
+    uint32 index;                                           // order in the pool, the bit of the object in SpawnedPoolData
     PoolObject(uint64 _guid, float _chance);
 };
 
+struct PoolMember
+{
+    uint32 PoolId;
+    uint32 Index;
+};
+
 class Pool                                                  // for Pool of Pool case
 {
 };
 
-typedef std::set<uint64> SpawnedPoolObjects;
+typedef std::unordered_map<uint32, std::vector<uint64>> SpawnedPoolMembers;   // bits per pool id
 typedef std::map<uint64, uint32> SpawnedPoolPools;
 
 class TC_GAME_API SpawnedPoolData
@@ -69,17 +77,21 @@ class TC_GAME_API SpawnedPoolData
 
         bool IsSpawnedObject(SpawnObjectType type, uint64 db_guid_or_pool_id) const;
 
+        /// Same without looking up the pool of the object
+        template<typename T>
+        bool IsSpawnedMember(uint32 pool_id, PoolObject const& obj) const;
+
         uint32 GetSpawnedObjects(uint32 pool_id) const;
 
         template<typename T>
-        void AddSpawn(uint64 db_guid_or_pool_id, uint32 pool_id);
+        void AddSpawn(PoolObject const& obj, uint32 pool_id);
 
         template<typename T>
-        void RemoveSpawn(uint64 db_guid_or_pool_id, uint32 pool_id);
+        void RemoveSpawn(PoolObject const& obj, uint32 pool_id);
     private:
         Map* mOwner;
-        SpawnedPoolObjects mSpawnedCreatures;
-        SpawnedPoolObjects mSpawnedGameobjects;
+        SpawnedPoolMembers mSpawnedCreatures;
+        SpawnedPoolMembers mSpawnedGameobjects;
         SpawnedPoolPools   mSpawnedPools;
 };
 
@@ -99,7 +111,8 @@ class TC_GAME_API PoolGroup
         void SetPoolId(uint32 pool_id) { poolId = pool_id; }
         bool isEmpty() const { return ExplicitlyChanced.empty() && EqualChanced.empty(); }
         bool isEmptyDeepCheck() const;
-        void AddEntry(PoolObject& poolitem, uint32 maxentries);
+        uint32 AddEntry(PoolObject& poolitem, uint32 maxentries);
+        void BuildChanceTable();
         bool CheckPool() const;
         void DespawnObject(SpawnedPoolData& spawns, uint64 guid=0, bool alwaysDeleteRespawnTime = false);
         void Despawn1Object(SpawnedPoolData& spawns, uint64 guid, bool alwaysDeleteRespawnTime = false, bool saveRespawnTime = true);
@@ -111,9 +124,13 @@ class TC_GAME_API PoolGroup
         void RemoveOneRelation(uint32 child_pool_id);
         uint32 GetPoolId() const { return poolId; }
     private:
+        bool CanRoll(SpawnedPoolData const& spawns, PoolObject const& obj, uint64 triggerFrom) const;
+        void RollEqualChanced(SpawnedPoolData const& spawns, uint32 count, uint64 triggerFrom, std::vector<PoolObject*>& rolledObjects);
+
         uint32 poolId;
         PoolObjectList ExplicitlyChanced;
         PoolObjectList EqualChanced;
+        Trinity::AliasTable ExplicitChances;                // last column is the chance left for the equally chanced objects
 };
 
 class TC_GAME_API PoolMgr
@@ -138,6 +155,9 @@ class TC_GAME_API PoolMgr
         uint32 IsPartOfAPool(uint64 db_guid_or_pool_id) const;
         uint32 IsPartOfAPool(SpawnObjectType type, uint64 spawnId) const;
 
+        template<typename T>
+        PoolMember const* GetPoolMember(uint64 db_guid) const;
+
         template<typename T>
         bool IsSpawnedObject(SpawnedPoolData& spawnedPoolData, uint64 db_guid_or_pool_id) const { return spawnedPoolData.IsSpawnedObject<T>(db_guid_or_pool_id); }
 
@@ -165,13 +185,14 @@ class TC_GAME_API PoolMgr
         typedef std::unordered_map<uint32, PoolGroup<Pool>>       PoolGroupPoolMap;
         typedef std::pair<uint64, uint32> SearchPair;
         typedef std::map<uint64, uint32> SearchMap;
+        typedef std::unordered_map<uint64, PoolMember> MemberSearchMap;
 
         PoolTemplateDataMap    mPoolTemplate;
         PoolGroupCreatureMap   mPoolCreatureGroups;
         PoolGroupGameObjectMap mPoolGameobjectGroups;
         PoolGroupPoolMap       mPoolPoolGroups;
-        SearchMap mCreatureSearchMap;
-        SearchMap mGameobjectSearchMap;
+        MemberSearchMap mCreatureSearchMap;
+        MemberSearchMap mGameobjectSearchMap;
         SearchMap mPoolSearchMap;
         std::unordered_map<uint32, std::vector<uint32>> mAutoSpawnPoolsPerMap;
 };
@@ -182,9 +203,9 @@ class TC_GAME_API PoolMgr
 template<>
 inline uint32 PoolMgr::IsPartOfAPool<Creature>(uint64 db_guid) const
 {
-    SearchMap::const_iterator itr = mCreatureSearchMap.find(db_guid);
+    MemberSearchMap::const_iterator itr = mCreatureSearchMap.find(db_guid);
     if (itr != mCreatureSearchMap.end())
-        return itr->second;
+        return itr->second.PoolId;
 
     return 0;
 }
@@ -193,9 +214,9 @@ inline uint32 PoolMgr::IsPartOfAPool<Creature>(uint64 db_guid) const
 template<>
 inline uint32 PoolMgr::IsPartOfAPool<GameObject>(uint64 db_guid) const
 {
-    SearchMap::const_iterator itr = mGameobjectSearchMap.find(db_guid);
+    MemberSearchMap::const_iterator itr = mGameobjectSearchMap.find(db_guid);
     if (itr != mGameobjectSearchMap.end())
-        return itr->second;
+        return itr->second.PoolId;
 
     return 0;
 }
@@ -211,4 +232,18 @@ inline uint32 PoolMgr::IsPartOfAPool<Pool>(uint64 pool_id) const
     return 0;
 }
 
+template<>
+inline PoolMember const* PoolMgr::GetPoolMember<Creature>(uint64 db_guid) const
+{
+    MemberSearchMap::const_iterator itr = mCreatureSearchMap.find(db_guid);
+    return itr != mCreatureSearchMap.end() ? &itr->second : nullptr;
+}
+
+template<>
+inline PoolMember const* PoolMgr::GetPoolMember<GameObject>(uint64 db_guid) const
+{
+    MemberSearchMap::const_iterator itr = mGameobjectSearchMap.find(db_guid);
+    return itr != mGameobjectSearchMap.end() ? &itr->second : nullptr;
+}
+
 #endif
@@ -51,6 +51,7 @@
 #include "Vehicle.h"
 #include "Weather.h"
 #include "WorldPacket.h"
+#include <array>
 #include <unordered_map>
 
 // Trait which indicates whether this script type
@@ -316,6 +317,9 @@ private:
 template<typename /*ScriptType*/, bool /*IsDatabaseBound*/>
 class SpecializedScriptRegistry;
 
+// Hooks of a database unbound script type tracked by its registry, one bit of ScriptObject::_unusedHooks each
+constexpr uint8 MAX_SCRIPT_HOOKS = 64;
+
 // This is the global static registry of scripts.
 template<class ScriptType>
 class ScriptRegistry final
@@ -731,6 +735,11 @@ public:
     void BeforeReleaseContext(std::string const& context) final override
     {
         auto idsToRemove = static_cast<Base*>(this)->GetScriptIDsToRemove(context);
+
+        // Modules without scripts of this type don't affect any object, don't walk the maps for them
+        if (idsToRemove.empty())
+            return;
+
         DestroyScriptIdsWithVisitor(VisitObjectsToSwapOnMap(idsToRemove));
 
         // Add the new ids which are removed to the global ids to remove set
@@ -748,6 +757,10 @@ public:
         ids_removed_.insert(static_cast<Base*>(this)->GetRecentlyAddedScriptIDs().begin(),
                             static_cast<Base*>(this)->GetRecentlyAddedScriptIDs().end());
 
+        // Objects only lose their AI when one of their ids was removed
+        if (ids_removed_.empty())
+            return;
+
         auto const visitor = VisitObjectsToSwapOnMap(ids_removed_);
         DestroyScriptIdsWithVisitor(visitor);
         InitializeScriptIdsWithVisitor(visitor);
@@ -1181,6 +1194,7 @@ public:
         this->BeforeReleaseContext(context);
 
         _scripts.erase(context);
+        CountHookListeners();
     }
 
     void SwapContext(bool initialize) final override
@@ -1199,6 +1213,7 @@ public:
         this->BeforeUnload();
 
         _scripts.clear();
+        CountHookListeners();
     }
 
     void SyncScriptNames() final override
@@ -1227,6 +1242,10 @@ public:
 
         // We're dealing with a code-only script, just add it.
         _scripts.insert(std::make_pair(sScriptMgr->GetCurrentScriptContext(), std::move(script_ptr)));
+
+        // until its default implementation of a hook is called the script is assumed to override it
+        for (std::atomic<uint32>& count : _hookListenerCounts)
+            count.fetch_add(1, std::memory_order_relaxed);
     }
 
     ScriptStoreType& GetScripts()
@@ -1234,8 +1253,40 @@ public:
         return _scripts;
     }
 
+    bool HasHookListeners(uint8 hook) const
+    {
+        return _hookListenerCounts[hook].load(std::memory_order_relaxed) != 0;
+    }
+
+    static bool IsHookUnused(ScriptType const* script, uint8 hook)
+    {
+        return (script->_unusedHooks.load(std::memory_order_relaxed) & (UI64LIT(1) << hook)) != 0;
+    }
+
+    // Called by the default implementation of a hook, the script is skipped for that hook from now on
+    void MarkHookUnused(ScriptType* script, uint8 hook)
+    {
+        uint64 bit = UI64LIT(1) << hook;
+        if (!(script->_unusedHooks.fetch_or(bit, std::memory_order_relaxed) & bit))
+            _hookListenerCounts[hook].fetch_sub(1, std::memory_order_relaxed);
+    }
+
 private:
+    void CountHookListeners()
+    {
+        for (uint8 hook = 0; hook < MAX_SCRIPT_HOOKS; ++hook)
+        {
+            uint32 count = 0;
+            for (auto const& [context, script] : _scripts)
+                if (!IsHookUnused(script.get(), hook))
+                    ++count;
+
+            _hookListenerCounts[hook].store(count, std::memory_order_relaxed);
+        }
+    }
+
     ScriptStoreType _scripts;
+    std::array<std::atomic<uint32>, MAX_SCRIPT_HOOKS> _hookListenerCounts = { };
 };
 
 // Utility macros to refer to the script registry.
@@ -1260,6 +1311,13 @@ private:
     FOR_SCRIPTS(T, itr, end) \
         itr->second
 
+// Same as FOREACH_SCRIPT but only calls the scripts overriding hook H, nothing is iterated when none of them does
+#define FOREACH_SCRIPT_HOOK(T, H) \
+    if (ScriptRegistry<T>::Instance()->HasHookListeners(uint8(T##Hook::H))) \
+        for (SCR_REG_ITR(T) itr = SCR_REG_LST(T).begin(); itr != SCR_REG_LST(T).end(); ++itr) \
+            if (!ScriptRegistry<T>::IsHookUnused(itr->second.get(), uint8(T##Hook::H))) \
+                itr->second
+
 // Utility macros for finding specific scripts.
 #define GET_SCRIPT(T, I, V) \
     T* V = ScriptRegistry<T>::Instance()->GetScriptById(I); \
@@ -1271,7 +1329,105 @@ private:
     if (!V) \
         return R;
 
-ScriptObject::ScriptObject(char const* name) noexcept : _name(name)
+enum class ServerScriptHook : uint8
+{
+    OnNetworkStart,
+    OnNetworkStop,
+    OnSocketOpen,
+    OnSocketClose,
+    OnPacketSend,
+    OnPacketReceive,
+    Max
+};
+
+enum class WorldScriptHook : uint8
+{
+    OnOpenStateChange,
+    OnConfigLoad,
+    OnMotdChange,
+    OnShutdownInitiate,
+    OnShutdownCancel,
+    OnUpdate,
+    OnStartup,
+    OnShutdown,
+    Max
+};
+
+enum class FormulaScriptHook : uint8
+{
+    OnHonorCalculation,
+    OnGrayLevelCalculation,
+    OnColorCodeCalculation,
+    OnZeroDifferenceCalculation,
+    OnBaseGainCalculation,
+    OnGainCalculation,
+    OnGroupRateCalculation,
+    Max
+};
+
+enum class UnitScriptHook : uint8
+{
+    OnHeal,
+    OnDamage,
+    ModifyPeriodicDamageAurasTick,
+    ModifyMeleeDamage,
+    ModifySpellDamageTaken,
+    Max
+};
+
+enum class DynamicObjectScriptHook : uint8
+{
+    OnUpdate,
+    Max
+};
+
+enum class PlayerScriptHook : uint8
+{
+    OnPVPKill,
+    OnCreatureKill,
+    OnPlayerKilledByCreature,
+    OnLevelChanged,
+    OnFreeTalentPointsChanged,
+    OnTalentsReset,
+    OnMoneyChanged,
+    OnMoneyLimit,
+    OnGiveXP,
+    OnReputationChange,
+    OnDuelRequest,
+    OnDuelStart,
+    OnDuelEnd,
+    OnChat,
+    OnChatWhisper,
+    OnChatGroup,
+    OnChatGuild,
+    OnChatChannel,
+    OnClearEmote,
+    OnTextEmote,
+    OnSpellCast,
+    OnLogin,
+    OnLogout,
+    OnCreate,
+    OnDelete,
+    OnFailedDelete,
+    OnSave,
+    OnBindToInstance,
+    OnUpdateZone,
+    OnMapChanged,
+    OnQuestStatusChange,
+    OnPlayerRepop,
+    OnMovieComplete,
+    Max
+};
+
+static_assert(uint8(PlayerScriptHook::Max) <= MAX_SCRIPT_HOOKS);
+
+template<typename ScriptType, typename Hook>
+void MarkHookUnused(ScriptType* script, Hook hook)
+{
+    ScriptRegistry<ScriptType>::Instance()->MarkHookUnused(script, uint8(hook));
+}
+
+ScriptObject::ScriptObject(char const* name) noexcept : _name(name), _unusedHooks(0)
 {
     sScriptMgr->IncreaseScriptCount();
 }
@@ -1468,101 +1624,101 @@ SpellScriptLoader* ScriptMgr::GetSpellScriptLoader(uint32 scriptId)
 
 void ScriptMgr::OnNetworkStart()
 {
-    FOREACH_SCRIPT(ServerScript)->OnNetworkStart();
+    FOREACH_SCRIPT_HOOK(ServerScript, OnNetworkStart)->OnNetworkStart();
 }
 
 void ScriptMgr::OnNetworkStop()
 {
-    FOREACH_SCRIPT(ServerScript)->OnNetworkStop();
+    FOREACH_SCRIPT_HOOK(ServerScript, OnNetworkStop)->OnNetworkStop();
 }
 
 void ScriptMgr::OnSocketOpen(std::shared_ptr<WorldSocket> const& socket)
 {
     ASSERT(socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnSocketOpen(socket);
+    FOREACH_SCRIPT_HOOK(ServerScript, OnSocketOpen)->OnSocketOpen(socket);
 }
 
 void ScriptMgr::OnSocketClose(std::shared_ptr<WorldSocket> const& socket)
 {
     ASSERT(socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnSocketClose(socket);
+    FOREACH_SCRIPT_HOOK(ServerScript, OnSocketClose)->OnSocketClose(socket);
 }
 
 void ScriptMgr::OnPacketReceive(WorldSession* session, WorldPacket const& packet)
 {
-    if (SCR_REG_LST(ServerScript).empty())
+    if (!ScriptRegistry<ServerScript>::Instance()->HasHookListeners(uint8(ServerScriptHook::OnPacketReceive)))
         return;
 
     WorldPacket copy(packet);
-    FOREACH_SCRIPT(ServerScript)->OnPacketReceive(session, copy);
+    FOREACH_SCRIPT_HOOK(ServerScript, OnPacketReceive)->OnPacketReceive(session, copy);
 }
 
 void ScriptMgr::OnPacketSend(WorldSession* session, WorldPacket const& packet)
 {
     ASSERT(session);
 
-    if (SCR_REG_LST(ServerScript).empty())
+    if (!ScriptRegistry<ServerScript>::Instance()->HasHookListeners(uint8(ServerScriptHook::OnPacketSend)))
         return;
 
     WorldPacket copy(packet);
-    FOREACH_SCRIPT(ServerScript)->OnPacketSend(session, copy);
+    FOREACH_SCRIPT_HOOK(ServerScript, OnPacketSend)->OnPacketSend(session, copy);
 }
 
 void ScriptMgr::OnOpenStateChange(bool open)
 {
-    FOREACH_SCRIPT(WorldScript)->OnOpenStateChange(open);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnOpenStateChange)->OnOpenStateChange(open);
 }
 
 void ScriptMgr::OnConfigLoad(bool reload)
 {
-    FOREACH_SCRIPT(WorldScript)->OnConfigLoad(reload);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnConfigLoad)->OnConfigLoad(reload);
 }
 
 void ScriptMgr::OnMotdChange(std::string& newMotd)
 {
-    FOREACH_SCRIPT(WorldScript)->OnMotdChange(newMotd);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnMotdChange)->OnMotdChange(newMotd);
 }
 
 void ScriptMgr::OnShutdownInitiate(ShutdownExitCode code, ShutdownMask mask)
 {
-    FOREACH_SCRIPT(WorldScript)->OnShutdownInitiate(code, mask);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnShutdownInitiate)->OnShutdownInitiate(code, mask);
 }
 
 void ScriptMgr::OnShutdownCancel()
 {
-    FOREACH_SCRIPT(WorldScript)->OnShutdownCancel();
+    FOREACH_SCRIPT_HOOK(WorldScript, OnShutdownCancel)->OnShutdownCancel();
 }
 
 void ScriptMgr::OnWorldUpdate(uint32 diff)
 {
-    FOREACH_SCRIPT(WorldScript)->OnUpdate(diff);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnUpdate)->OnUpdate(diff);
 }
 
 void ScriptMgr::OnHonorCalculation(float& honor, uint8 level, float multiplier)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnHonorCalculation(honor, level, multiplier);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnHonorCalculation)->OnHonorCalculation(honor, level, multiplier);
 }
 
 void ScriptMgr::OnGrayLevelCalculation(uint8& grayLevel, uint8 playerLevel)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnGrayLevelCalculation(grayLevel, playerLevel);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnGrayLevelCalculation)->OnGrayLevelCalculation(grayLevel, playerLevel);
 }
 
 void ScriptMgr::OnColorCodeCalculation(XPColorChar& color, uint8 playerLevel, uint8 mobLevel)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnColorCodeCalculation(color, playerLevel, mobLevel);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnColorCodeCalculation)->OnColorCodeCalculation(color, playerLevel, mobLevel);
 }
 
 void ScriptMgr::OnZeroDifferenceCalculation(uint8& diff, uint8 playerLevel)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnZeroDifferenceCalculation(diff, playerLevel);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnZeroDifferenceCalculation)->OnZeroDifferenceCalculation(diff, playerLevel);
 }
 
 void ScriptMgr::OnBaseGainCalculation(uint32& gain, uint8 playerLevel, uint8 mobLevel)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnBaseGainCalculation(gain, playerLevel, mobLevel);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnBaseGainCalculation)->OnBaseGainCalculation(gain, playerLevel, mobLevel);
 }
 
 void ScriptMgr::OnGainCalculation(uint32& gain, Player* player, Unit* unit)
@@ -1570,12 +1726,12 @@ void ScriptMgr::OnGainCalculation(uint32& gain, Player* player, Unit* unit)
     ASSERT(player);
     ASSERT(unit);
 
-    FOREACH_SCRIPT(FormulaScript)->OnGainCalculation(gain, player, unit);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnGainCalculation)->OnGainCalculation(gain, player, unit);
 }
 
 void ScriptMgr::OnGroupRateCalculation(float& rate, uint32 count, bool isRaid)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnGroupRateCalculation(rate, count, isRaid);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnGroupRateCalculation)->OnGroupRateCalculation(rate, count, isRaid);
 }
 
 template <typename ScriptType, typename MapType, typename... Args, std::invocable<ScriptType*, MapType*, Args...> Action>
@@ -1629,7 +1785,7 @@ void ScriptMgr::OnPlayerEnterMap(Map* map, Player* player)
     ASSERT(map);
     ASSERT(player);
 
-    FOREACH_SCRIPT(PlayerScript)->OnMapChanged(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnMapChanged)->OnMapChanged(player);
 
     ForEachMapScript([](auto* script, auto* map, Player* player) { script->OnPlayerEnter(map, player); }, map, player);
 }
@@ -1852,6 +2008,10 @@ bool ScriptMgr::OnConditionCheck(Condition const* condition, ConditionSourceInfo
 {
     ASSERT(condition);
 
+    // most conditions have no script, don't look them up
+    if (!condition->ScriptId)
+        return true;
+
     GET_SCRIPT_RET(ConditionScript, condition->ScriptId, tmpscript, true);
     return tmpscript->OnConditionCheck(condition, sourceInfo);
 }
@@ -1917,8 +2077,7 @@ void ScriptMgr::OnDynamicObjectUpdate(DynamicObject* dynobj, uint32 diff)
 {
     ASSERT(dynobj);
 
-    FOR_SCRIPTS(DynamicObjectScript, itr, end)
-        itr->second->OnUpdate(dynobj, diff);
+    FOREACH_SCRIPT_HOOK(DynamicObjectScript, OnUpdate)->OnUpdate(dynobj, diff);
 }
 
 void ScriptMgr::OnAddPassenger(Transport* transport, Player* player)
@@ -1964,12 +2123,12 @@ void ScriptMgr::OnRelocate(Transport* transport, uint32 mapId, float x, float y,
 
 void ScriptMgr::OnStartup()
 {
-    FOREACH_SCRIPT(WorldScript)->OnStartup();
+    FOREACH_SCRIPT_HOOK(WorldScript, OnStartup)->OnStartup();
 }
 
 void ScriptMgr::OnShutdown()
 {
-    FOREACH_SCRIPT(WorldScript)->OnShutdown();
+    FOREACH_SCRIPT_HOOK(WorldScript, OnShutdown)->OnShutdown();
 }
 
 // Achievement
@@ -1994,162 +2153,162 @@ bool ScriptMgr::OnCriteriaCheck(uint32 scriptId, Player* source, Unit* target)
 // Player
 void ScriptMgr::OnPVPKill(Player* killer, Player* killed)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnPVPKill(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPVPKill)->OnPVPKill(killer, killed);
 }
 
 void ScriptMgr::OnCreatureKill(Player* killer, Creature* killed)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnCreatureKill(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnCreatureKill)->OnCreatureKill(killer, killed);
 }
 
 void ScriptMgr::OnPlayerKilledByCreature(Creature* killer, Player* killed)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnPlayerKilledByCreature(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerKilledByCreature)->OnPlayerKilledByCreature(killer, killed);
 }
 
 void ScriptMgr::OnPlayerLevelChanged(Player* player, uint8 oldLevel)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnLevelChanged(player, oldLevel);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnLevelChanged)->OnLevelChanged(player, oldLevel);
 }
 
 void ScriptMgr::OnPlayerFreeTalentPointsChanged(Player* player, uint32 points)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnFreeTalentPointsChanged(player, points);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnFreeTalentPointsChanged)->OnFreeTalentPointsChanged(player, points);
 }
 
 void ScriptMgr::OnPlayerTalentsReset(Player* player, bool noCost)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnTalentsReset(player, noCost);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnTalentsReset)->OnTalentsReset(player, noCost);
 }
 
 void ScriptMgr::OnPlayerMoneyChanged(Player* player, int64& amount)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyChanged(player, amount);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnMoneyChanged)->OnMoneyChanged(player, amount);
 }
 
 void ScriptMgr::OnPlayerMoneyLimit(Player* player, int64 amount)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyLimit(player, amount);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnMoneyLimit)->OnMoneyLimit(player, amount);
 }
 
 void ScriptMgr::OnGivePlayerXP(Player* player, uint32& amount, Unit* victim)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnGiveXP(player, amount, victim);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnGiveXP)->OnGiveXP(player, amount, victim);
 }
 
 void ScriptMgr::OnPlayerReputationChange(Player* player, uint32 factionID, int32& standing, bool incremental)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnReputationChange(player, factionID, standing, incremental);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnReputationChange)->OnReputationChange(player, factionID, standing, incremental);
 }
 
 void ScriptMgr::OnPlayerDuelRequest(Player* target, Player* challenger)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDuelRequest(target, challenger);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnDuelRequest)->OnDuelRequest(target, challenger);
 }
 
 void ScriptMgr::OnPlayerDuelStart(Player* player1, Player* player2)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDuelStart(player1, player2);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnDuelStart)->OnDuelStart(player1, player2);
 }
 
 void ScriptMgr::OnPlayerDuelEnd(Player* winner, Player* loser, DuelCompleteType type)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDuelEnd(winner, loser, type);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnDuelEnd)->OnDuelEnd(winner, loser, type);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnChat)->OnChat(player, type, lang, msg);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Player* receiver)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, receiver);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnChatWhisper)->OnChat(player, type, lang, msg, receiver);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Group* group)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, group);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnChatGroup)->OnChat(player, type, lang, msg, group);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Guild* guild)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, guild);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnChatGuild)->OnChat(player, type, lang, msg, guild);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Channel* channel)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, channel);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnChatChannel)->OnChat(player, type, lang, msg, channel);
 }
 
 void ScriptMgr::OnPlayerClearEmote(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnClearEmote(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnClearEmote)->OnClearEmote(player);
 }
 
 void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emoteNum, ObjectGuid guid)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnTextEmote(player, textEmote, emoteNum, guid);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnTextEmote)->OnTextEmote(player, textEmote, emoteNum, guid);
 }
 
 void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnSpellCast(player, spell, skipCheck);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnSpellCast)->OnSpellCast(player, spell, skipCheck);
 }
 
 void ScriptMgr::OnPlayerLogin(Player* player, bool firstLogin)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnLogin(player, firstLogin);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnLogin)->OnLogin(player, firstLogin);
 }
 
 void ScriptMgr::OnPlayerLogout(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnLogout(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnLogout)->OnLogout(player);
 }
 
 void ScriptMgr::OnPlayerCreate(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnCreate(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnCreate)->OnCreate(player);
 }
 
 void ScriptMgr::OnPlayerDelete(ObjectGuid guid, uint32 accountId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDelete(guid, accountId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnDelete)->OnDelete(guid, accountId);
 }
 
 void ScriptMgr::OnPlayerFailedDelete(ObjectGuid guid, uint32 accountId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnFailedDelete(guid, accountId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnFailedDelete)->OnFailedDelete(guid, accountId);
 }
 
 void ScriptMgr::OnPlayerSave(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnSave(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnSave)->OnSave(player);
 }
 
 void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, uint32 mapid, bool permanent, uint8 extendState)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnBindToInstance(player, difficulty, mapid, permanent, extendState);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnBindToInstance)->OnBindToInstance(player, difficulty, mapid, permanent, extendState);
 }
 
 void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newArea)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnUpdateZone(player, newZone, newArea);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnUpdateZone)->OnUpdateZone(player, newZone, newArea);
 }
 
 void ScriptMgr::OnQuestStatusChange(Player* player, uint32 questId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnQuestStatusChange(player, questId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnQuestStatusChange)->OnQuestStatusChange(player, questId);
 }
 
 void ScriptMgr::OnPlayerRepop(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnPlayerRepop(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerRepop)->OnPlayerRepop(player);
 }
 
 void ScriptMgr::OnMovieComplete(Player* player, uint32 movieId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMovieComplete(player, movieId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnMovieComplete)->OnMovieComplete(player, movieId);
 }
 
 void ScriptMgr::OnPlayerChoiceResponse(WorldObject* object, Player* player, PlayerChoice const* choice, PlayerChoiceResponse const* response, uint16 clientIdentifier)
@@ -2283,27 +2442,27 @@ void ScriptMgr::OnGroupDisband(Group* group)
 // Unit
 void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 {
-    FOREACH_SCRIPT(UnitScript)->OnHeal(healer, reciever, gain);
+    FOREACH_SCRIPT_HOOK(UnitScript, OnHeal)->OnHeal(healer, reciever, gain);
 }
 
 void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->OnDamage(attacker, victim, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, OnDamage)->OnDamage(attacker, victim, damage);
 }
 
 void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyPeriodicDamageAurasTick(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifyPeriodicDamageAurasTick)->ModifyPeriodicDamageAurasTick(target, attacker, damage);
 }
 
 void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyMeleeDamage(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifyMeleeDamage)->ModifyMeleeDamage(target, attacker, damage);
 }
 
 void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage, SpellInfo const* spellInfo)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifySpellDamageTaken(target, attacker, damage, spellInfo);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifySpellDamageTaken)->ModifySpellDamageTaken(target, attacker, damage, spellInfo);
 }
 
 // Scene
@@ -2415,26 +2574,32 @@ ServerScript::~ServerScript() = default;
 
 void ServerScript::OnNetworkStart()
 {
+    MarkHookUnused(this, ServerScriptHook::OnNetworkStart);
 }
 
 void ServerScript::OnNetworkStop()
 {
+    MarkHookUnused(this, ServerScriptHook::OnNetworkStop);
 }
 
 void ServerScript::OnSocketOpen(std::shared_ptr<WorldSocket> /*socket*/)
 {
+    MarkHookUnused(this, ServerScriptHook::OnSocketOpen);
 }
 
 void ServerScript::OnSocketClose(std::shared_ptr<WorldSocket> /*socket*/)
 {
+    MarkHookUnused(this, ServerScriptHook::OnSocketClose);
 }
 
 void ServerScript::OnPacketSend(WorldSession* /*session*/, WorldPacket& /*packet*/)
 {
+    MarkHookUnused(this, ServerScriptHook::OnPacketSend);
 }
 
 void ServerScript::OnPacketReceive(WorldSession* /*session*/, WorldPacket& /*packet*/)
 {
+    MarkHookUnused(this, ServerScriptHook::OnPacketReceive);
 }
 
 WorldScript::WorldScript(char const* name) noexcept
@@ -2447,34 +2612,42 @@ WorldScript::~WorldScript() = default;
 
 void WorldScript::OnOpenStateChange(bool /*open*/)
 {
+    MarkHookUnused(this, WorldScriptHook::OnOpenStateChange);
 }
 
 void WorldScript::OnConfigLoad(bool /*reload*/)
 {
+    MarkHookUnused(this, WorldScriptHook::OnConfigLoad);
 }
 
 void WorldScript::OnMotdChange(std::string& /*newMotd*/)
 {
+    MarkHookUnused(this, WorldScriptHook::OnMotdChange);
 }
 
 void WorldScript::OnShutdownInitiate(ShutdownExitCode /*code*/, ShutdownMask /*mask*/)
 {
+    MarkHookUnused(this, WorldScriptHook::OnShutdownInitiate);
 }
 
 void WorldScript::OnShutdownCancel()
 {
+    MarkHookUnused(this, WorldScriptHook::OnShutdownCancel);
 }
 
 void WorldScript::OnUpdate(uint32 /*diff*/)
 {
+    MarkHookUnused(this, WorldScriptHook::OnUpdate);
 }
 
 void WorldScript::OnStartup()
 {
+    MarkHookUnused(this, WorldScriptHook::OnStartup);
 }
 
 void WorldScript::OnShutdown()
 {
+    MarkHookUnused(this, WorldScriptHook::OnShutdown);
 }
 
 FormulaScript::FormulaScript(char const* name) noexcept
@@ -2487,30 +2660,37 @@ FormulaScript::~FormulaScript() = default;
 
 void FormulaScript::OnHonorCalculation(float& /*honor*/, uint8 /*level*/, float /*multiplier*/)
 {
+    MarkHookUnused(this, FormulaScriptHook::OnHonorCalculation);
 }
 
 void FormulaScript::OnGrayLevelCalculation(uint8& /*grayLevel*/, uint8 /*playerLevel*/)
 {
+    MarkHookUnused(this, FormulaScriptHook::OnGrayLevelCalculation);
 }
 
 void FormulaScript::OnColorCodeCalculation(XPColorChar& /*color*/, uint8 /*playerLevel*/, uint8 /*mobLevel*/)
 {
+    MarkHookUnused(this, FormulaScriptHook::OnColorCodeCalculation);
 }
 
 void FormulaScript::OnZeroDifferenceCalculation(uint8& /*diff*/, uint8 /*playerLevel*/)
 {
+    MarkHookUnused(this, FormulaScriptHook::OnZeroDifferenceCalculation);
 }
 
 void FormulaScript::OnBaseGainCalculation(uint32& /*gain*/, uint8 /*playerLevel*/, uint8 /*mobLevel*/)
 {
+    MarkHookUnused(this, FormulaScriptHook::OnBaseGainCalculation);
 }
 
 void FormulaScript::OnGainCalculation(uint32& /*gain*/, Player* /*player*/, Unit* /*unit*/)
 {
+    MarkHookUnused(this, FormulaScriptHook::OnGainCalculation);
 }
 
 void FormulaScript::OnGroupRateCalculation(float& /*rate*/, uint32 /*count*/, bool /*isRaid*/)
 {
+    MarkHookUnused(this, FormulaScriptHook::OnGroupRateCalculation);
 }
 
 template <class TMap>
@@ -2648,22 +2828,27 @@ UnitScript::~UnitScript() = default;
 
 void UnitScript::OnHeal(Unit* /*healer*/, Unit* /*reciever*/, uint32& /*gain*/)
 {
+    MarkHookUnused(this, UnitScriptHook::OnHeal);
 }
 
 void UnitScript::OnDamage(Unit* /*attacker*/, Unit* /*victim*/, uint32& /*damage*/)
 {
+    MarkHookUnused(this, UnitScriptHook::OnDamage);
 }
 
 void UnitScript::ModifyPeriodicDamageAurasTick(Unit* /*target*/, Unit* /*attacker*/, uint32& /*damage*/)
 {
+    MarkHookUnused(this, UnitScriptHook::ModifyPeriodicDamageAurasTick);
 }
 
 void UnitScript::ModifyMeleeDamage(Unit* /*target*/, Unit* /*attacker*/, uint32& /*damage*/)
 {
+    MarkHookUnused(this, UnitScriptHook::ModifyMeleeDamage);
 }
 
 void UnitScript::ModifySpellDamageTaken(Unit* /*target*/, Unit* /*attacker*/, int32& /*damage*/, SpellInfo const* /*spellInfo*/)
 {
+    MarkHookUnused(this, UnitScriptHook::ModifySpellDamageTaken);
 }
 
 CreatureScript::CreatureScript(char const* name) noexcept
@@ -2836,6 +3021,7 @@ DynamicObjectScript::~DynamicObjectScript() = default;
 
 void DynamicObjectScript::OnUpdate(DynamicObject* /*obj*/, uint32 /*diff*/)
 {
+    MarkHookUnused(this, DynamicObjectScriptHook::OnUpdate);
 }
 
 TransportScript::TransportScript(char const* name) noexcept
@@ -2896,134 +3082,167 @@ PlayerScript::~PlayerScript() = default;
 
 void PlayerScript::OnPVPKill(Player* /*killer*/, Player* /*killed*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnPVPKill);
 }
 
 void PlayerScript::OnCreatureKill(Player* /*killer*/, Creature* /*killed*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnCreatureKill);
 }
 
 void PlayerScript::OnPlayerKilledByCreature(Creature* /*killer*/, Player* /*killed*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnPlayerKilledByCreature);
 }
 
 void PlayerScript::OnLevelChanged(Player* /*player*/, uint8 /*oldLevel*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnLevelChanged);
 }
 
 void PlayerScript::OnFreeTalentPointsChanged(Player* /*player*/, uint32 /*points*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnFreeTalentPointsChanged);
 }
 
 void PlayerScript::OnTalentsReset(Player* /*player*/, bool /*noCost*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnTalentsReset);
 }
 
 void PlayerScript::OnMoneyChanged(Player* /*player*/, int64& /*amount*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnMoneyChanged);
 }
 
 void PlayerScript::OnMoneyLimit(Player* /*player*/, int64 /*amount*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnMoneyLimit);
 }
 
 void PlayerScript::OnGiveXP(Player* /*player*/, uint32& /*amount*/, Unit* /*victim*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnGiveXP);
 }
 
 void PlayerScript::OnReputationChange(Player* /*player*/, uint32 /*factionId*/, int32& /*standing*/, bool /*incremental*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnReputationChange);
 }
 
 void PlayerScript::OnDuelRequest(Player* /*target*/, Player* /*challenger*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnDuelRequest);
 }
 
 void PlayerScript::OnDuelStart(Player* /*player1*/, Player* /*player2*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnDuelStart);
 }
 
 void PlayerScript::OnDuelEnd(Player* /*winner*/, Player* /*loser*/, DuelCompleteType /*type*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnDuelEnd);
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnChat);
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Player* /*receiver*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnChatWhisper);
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Group* /*group*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnChatGroup);
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Guild* /*guild*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnChatGuild);
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Channel* /*channel*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnChatChannel);
 }
 
 void PlayerScript::OnClearEmote(Player* /*player*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnClearEmote);
 }
 
 void PlayerScript::OnTextEmote(Player* /*player*/, uint32 /*textEmote*/, uint32 /*emoteNum*/, ObjectGuid /*guid*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnTextEmote);
 }
 
 void PlayerScript::OnSpellCast(Player* /*player*/, Spell* /*spell*/, bool /*skipCheck*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnSpellCast);
 }
 
 void PlayerScript::OnLogin(Player* /*player*/, bool /*firstLogin*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnLogin);
 }
 
 void PlayerScript::OnLogout(Player* /*player*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnLogout);
 }
 
 void PlayerScript::OnCreate(Player* /*player*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnCreate);
 }
 
 void PlayerScript::OnDelete(ObjectGuid /*guid*/, uint32 /*accountId*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnDelete);
 }
 
 void PlayerScript::OnFailedDelete(ObjectGuid /*guid*/, uint32 /*accountId*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnFailedDelete);
 }
 
 void PlayerScript::OnSave(Player* /*player*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnSave);
 }
 
 void PlayerScript::OnBindToInstance(Player* /*player*/, Difficulty /*difficulty*/, uint32 /*mapId*/, bool /*permanent*/, uint8 /*extendState*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnBindToInstance);
 }
 
 void PlayerScript::OnUpdateZone(Player* /*player*/, uint32 /*newZone*/, uint32 /*newArea*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnUpdateZone);
 }
 
 void PlayerScript::OnMapChanged(Player* /*player*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnMapChanged);
 }
 
 void PlayerScript::OnQuestStatusChange(Player* /*player*/, uint32 /*questId*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnQuestStatusChange);
 }
 
 void PlayerScript::OnPlayerRepop(Player* /*player*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnPlayerRepop);
 }
 
 void PlayerScript::OnMovieComplete(Player* /*player*/, uint32 /*movieId*/)
 {
+    MarkHookUnused(this, PlayerScriptHook::OnMovieComplete);
 }
 
 AccountScript::AccountScript(char const* name) noexcept
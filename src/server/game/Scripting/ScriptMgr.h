@@ -22,6 +22,7 @@
 #include "ObjectGuid.h"
 #include "Tuples.h"
 #include <boost/preprocessor/punctuation/remove_parens.hpp>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -175,10 +176,16 @@ enum XPColorChar : uint8;
     event on all registered scripts of that type.
 */
 
+template<typename /*ScriptType*/, bool /*IsDatabaseBound*/>
+class SpecializedScriptRegistry;
+
 class TC_GAME_API ScriptObject
 {
     friend class ScriptMgr;
 
+    template<typename, bool>
+    friend class SpecializedScriptRegistry;
+
     public:
 
         ScriptObject(ScriptObject const& right) = delete;
@@ -196,6 +203,9 @@ class TC_GAME_API ScriptObject
     private:
 
         std::string const _name;
+
+        // Hooks this script does not override, a bit is set the first time the default implementation of a hook runs
+        std::atomic<uint64> _unusedHooks;
 };
 
 class TC_GAME_API SpellScriptLoader : public ScriptObject
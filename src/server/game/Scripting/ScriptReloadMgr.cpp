@@ -641,6 +641,7 @@ public:
 
         DispatchRunningBuildJobs();
         DispatchModuleChanges();
+        DispatchPreparedModules();
     }
 
     /// Unloads the manager and cancels all runnings jobs immediately
@@ -659,6 +660,9 @@ public:
             _build_job.reset();
         }
 
+        // Wait for the modules which are still being loaded
+        _prepared_modules.clear();
+
         // Release all strong references to script modules
         // to trigger unload actions as early as possible,
         // otherwise the worldserver will crash on exit.
@@ -826,50 +830,84 @@ private:
         if (GetMSTimeDiffToNow(_last_time_library_changed) < 500)
             return;
 
-        for (auto const& path : _libraries_changed)
+        for (auto itr = _libraries_changed.begin(); itr != _libraries_changed.end();)
         {
+            fs::path const& path = *itr;
+
+            // The previous version is still being loaded, deal with the change once it is running
+            if (_prepared_modules.find(path) != _prepared_modules.end())
+            {
+                ++itr;
+                continue;
+            }
+
             bool const is_running =
                 _running_script_module_names.find(path) != _running_script_module_names.end();
 
             bool const exists = fs::exists(path);
 
-            if (is_running)
+            if (exists)
             {
-                if (exists)
-                    ProcessReloadScriptModule(path);
-                else
-                    ProcessUnloadScriptModule(path);
+                // Copying and opening the library is done in the background, the running version of
+                // the module is only replaced once the new one was loaded successfully
+                fs::path cache_path = GenerateUniquePathForLibraryInCache(path);
+                _prepared_modules.emplace(path, std::async(std::launch::async, &PrepareScriptModule, path, std::move(cache_path)));
             }
-            else if (exists)
-                ProcessLoadScriptModule(path);
-        }
+            else if (is_running)
+                ProcessUnloadScriptModule(path);
 
-        _libraries_changed.clear();
+            itr = _libraries_changed.erase(itr);
+        }
     }
 
-    void ProcessLoadScriptModule(fs::path const& path, bool swap_context = true)
+    /// Called periodically on the worldserver tick to swap in the modules
+    /// which were loaded in the background.
+    void DispatchPreparedModules()
     {
-        ASSERT(_running_script_module_names.find(path) == _running_script_module_names.end(),
-               "Can't load a module which is running already!");
+        for (auto itr = _prepared_modules.begin(); itr != _prepared_modules.end();)
+        {
+            if (itr->second.wait_for(0s) != std::future_status::ready)
+            {
+                ++itr;
+                continue;
+            }
 
-        // Copy the shared library into a cache
-        auto cache_path = GenerateUniquePathForLibraryInCache(path);
+            fs::path const path = itr->first;
+            Optional<std::shared_ptr<ScriptModule>> module = itr->second.get();
+            itr = _prepared_modules.erase(itr);
+
+            bool const is_running =
+                _running_script_module_names.find(path) != _running_script_module_names.end();
+
+            if (!module)
+            {
+                if (is_running)
+                    TC_LOG_ERROR("scripts.hotswap", ">> Keeping the running version of script module \"{}\".",
+                        path.filename().generic_string());
+                continue;
+            }
+
+            if (is_running)
+                ProcessUnloadScriptModule(path, false);
+
+            ActivateScriptModule(path, std::move(*module));
+        }
+    }
 
+    /// Copies the shared library into the cache and opens it, doesn't touch any script registry
+    /// and may be called from any thread.
+    static Optional<std::shared_ptr<ScriptModule>> PrepareScriptModule(fs::path const& path, fs::path const& cache_path)
+    {
         {
             boost::system::error_code code;
             fs::copy_file(path, cache_path, code);
             if (code)
             {
-                TC_LOG_FATAL("scripts.hotswap", ">> Failed to create cache entry for module "
+                TC_LOG_ERROR("scripts.hotswap", ">> Failed to create cache entry for module "
                     "\"{}\" at \"{}\" with reason (\"{}\")!",
                     path.filename().generic_string(), cache_path.generic_string(),
                     code.message());
-
-                // Find a better solution for this but it's much better
-                // to start the core without scripts
-                std::this_thread::sleep_for(std::chrono::seconds(5));
-                ABORT();
-                return;
+                return {};
             }
 
             TC_LOG_TRACE("scripts.hotswap", ">> Copied the shared library \"{}\" to \"{}\" for caching.",
@@ -878,6 +916,22 @@ private:
 
         auto module = ScriptModule::CreateFromPath(path, cache_path);
         if (!module)
+        {
+            TC_LOG_ERROR("scripts.hotswap", ">> Failed to load script module \"{}\"!",
+                path.filename().generic_string());
+            return {};
+        }
+
+        return module;
+    }
+
+    void ProcessLoadScriptModule(fs::path const& path, bool swap_context = true)
+    {
+        ASSERT(_running_script_module_names.find(path) == _running_script_module_names.end(),
+               "Can't load a module which is running already!");
+
+        auto module = PrepareScriptModule(path, GenerateUniquePathForLibraryInCache(path));
+        if (!module)
         {
             TC_LOG_FATAL("scripts.hotswap", ">> Failed to load script module \"{}\"!",
                 path.filename().generic_string());
@@ -889,12 +943,21 @@ private:
             return;
         }
 
+        ActivateScriptModule(path, std::move(*module), swap_context);
+    }
+
+    /// Registers the scripts of a loaded module, the previous version of the module has to be released before.
+    void ActivateScriptModule(fs::path const& path, std::shared_ptr<ScriptModule> module, bool swap_context = true)
+    {
+        ASSERT(_running_script_module_names.find(path) == _running_script_module_names.end(),
+               "Can't load a module which is running already!");
+
         // Limit the git revision hash to 7 characters.
-        std::string module_revision((*module)->GetScriptModuleRevisionHash());
+        std::string module_revision(module->GetScriptModuleRevisionHash());
         if (module_revision.size() >= 7)
             module_revision = module_revision.substr(0, 7);
 
-        std::string const module_name = (*module)->GetScriptModule();
+        std::string const module_name = module->GetScriptModule();
         TC_LOG_INFO("scripts.hotswap", ">> Loaded script module \"{}\" (\"{}\" - {}).",
             path.filename().generic_string(), module_name, module_revision);
 
@@ -935,26 +998,20 @@ private:
             module_name);
 
         // Store the module
-        _known_modules_build_directives.insert(std::make_pair(module_name, (*module)->GetBuildDirective()));
+        _known_modules_build_directives.insert(std::make_pair(module_name, module->GetBuildDirective()));
         _running_script_modules.insert(std::make_pair(module_name,
-            std::make_pair(*module, std::move(listener))));
+            std::make_pair(module, std::move(listener))));
         _running_script_module_names.insert(std::make_pair(path, module_name));
 
         // Process the script loading after the module was registered correctly (#17557).
         sScriptMgr->SetScriptContext(module_name);
-        (*module)->AddScripts();
+        module->AddScripts();
         TC_LOG_TRACE("scripts.hotswap", ">> Registered all scripts of module {}.", module_name);
 
         if (swap_context)
             sScriptMgr->SwapScriptContext();
     }
 
-    void ProcessReloadScriptModule(fs::path const& path)
-    {
-        ProcessUnloadScriptModule(path, false);
-        ProcessLoadScriptModule(path);
-    }
-
     void ProcessUnloadScriptModule(fs::path const& path, bool finish = true)
     {
         auto const itr = _running_script_module_names.find(path);
@@ -1394,6 +1451,8 @@ private:
 
     // Change requests to load or unload shared libraries
     std::unordered_set<fs::path /*path*/> _libraries_changed;
+    // Shared libraries which are copied into the cache and opened in the background
+    std::unordered_map<fs::path /*path*/, std::future<Optional<std::shared_ptr<ScriptModule>>>> _prepared_modules;
     // The timestamp which indicates the last time a library was changed
     uint32 _last_time_library_changed;
 
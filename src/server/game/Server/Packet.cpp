@@ -17,16 +17,23 @@
 
 #include "Packet.h"
 #include "Errors.h"
+#include "PacketBufferPool.h"
 
 WorldPackets::Packet::Packet(WorldPacket&& worldPacket) : _worldPacket(std::move(worldPacket))
 {
 }
 
 WorldPackets::ServerPacket::ServerPacket(OpcodeServer opcode, size_t initialSize /*= 200*/, ConnectionType connection /*= CONNECTION_TYPE_DEFAULT*/)
-    : Packet(WorldPacket(opcode, initialSize, connection))
+    : Packet(WorldPacket(opcode, PacketBufferPool::Acquire(opcodeTable.GetServerPacketSizeHint(opcode, initialSize)), connection))
 {
 }
 
+WorldPackets::ServerPacket::~ServerPacket()
+{
+    opcodeTable.RecordServerPacketSize(GetOpcode(), _worldPacket.size());
+    PacketBufferPool::Release(std::move(_worldPacket).Release());
+}
+
 void WorldPackets::ServerPacket::Read()
 {
     ASSERT(!"Read not implemented for server packets.");
@@ -47,6 +47,7 @@ namespace WorldPackets
     {
     public:
         ServerPacket(OpcodeServer opcode, size_t initialSize = 200, ConnectionType connection = CONNECTION_TYPE_DEFAULT);
+        ~ServerPacket();
 
         void Read() override final;
 
@@ -0,0 +1,161 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketCompressor.h"
+#include "Log.h"
+#include <mutex>
+#include <vector>
+#include <zlib.h>
+
+namespace
+{
+struct PooledStream
+{
+    z_stream* Stream;
+    int32 Level;
+    int32 MemLevel;
+};
+
+std::mutex PoolLock;
+std::vector<PooledStream> Pool;
+
+void DestroyStream(z_stream* stream)
+{
+    deflateEnd(stream);
+    delete stream;
+}
+
+z_stream* AcquireStream(int32 level, int32 memLevel)
+{
+    std::scoped_lock lock(PoolLock);
+    for (auto itr = Pool.begin(); itr != Pool.end(); ++itr)
+    {
+        if (itr->Level != level || itr->MemLevel != memLevel)
+            continue;
+
+        z_stream* stream = itr->Stream;
+        Pool.erase(itr);
+        return stream;
+    }
+
+    return nullptr;
+}
+
+bool ReleaseStream(z_stream* stream, int32 level, int32 memLevel, std::size_t maxPooledStreams)
+{
+    if (deflateReset(stream) != Z_OK)
+        return false;
+
+    std::scoped_lock lock(PoolLock);
+    // settings changed on config reload, streams created with the old ones will never be acquired again
+    std::erase_if(Pool, [&](PooledStream const& pooled)
+    {
+        if (pooled.Level == level && pooled.MemLevel == memLevel)
+            return false;
+
+        DestroyStream(pooled.Stream);
+        return true;
+    });
+
+    if (Pool.size() >= maxPooledStreams)
+        return false;
+
+    Pool.push_back({ .Stream = stream, .Level = level, .MemLevel = memLevel });
+    return true;
+}
+}
+
+PacketCompressor::PacketCompressor() : _stream(nullptr), _level(0), _memLevel(0), _maxPooledStreams(0)
+{
+}
+
+PacketCompressor::~PacketCompressor()
+{
+    if (_stream && !ReleaseStream(_stream, _level, _memLevel, _maxPooledStreams))
+        DestroyStream(_stream);
+}
+
+bool PacketCompressor::Initialize(int32 level, int32 memLevel, std::size_t maxPooledStreams)
+{
+    _level = level;
+    _memLevel = memLevel;
+    _maxPooledStreams = maxPooledStreams;
+
+    _stream = AcquireStream(level, memLevel);
+    if (_stream)
+        return true;
+
+    _stream = new z_stream();
+    _stream->zalloc = (alloc_func)nullptr;
+    _stream->zfree = (free_func)nullptr;
+    _stream->opaque = (voidpf)nullptr;
+    _stream->avail_in = 0;
+    _stream->next_in = nullptr;
+    int32 z_res = deflateInit2(_stream, level, Z_DEFLATED, -15, memLevel, Z_DEFAULT_STRATEGY);
+    if (z_res != Z_OK)
+    {
+        TC_LOG_ERROR("network", "Can't initialize packet compression (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+        delete _stream;
+        _stream = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+uint32 PacketCompressor::GetMaxCompressedSize(uint32 size) const
+{
+    return deflateBound(_stream, size);
+}
+
+uint32 PacketCompressor::Compress(uint8* buffer, uint32 opcode, uint8 const* data, std::size_t size)
+{
+    uint32 bufferSize = deflateBound(_stream, size + sizeof(opcode));
+
+    _stream->next_out = buffer;
+    _stream->avail_out = bufferSize;
+    _stream->next_in = (Bytef*)&opcode;
+    _stream->avail_in = sizeof(opcode);
+
+    int32 z_res = deflate(_stream, Z_NO_FLUSH);
+    if (z_res != Z_OK)
+    {
+        TC_LOG_ERROR("network", "Can't compress packet opcode (zlib: deflate) Error code: {} ({}, msg: {})", z_res, zError(z_res), _stream->msg);
+        return 0;
+    }
+
+    _stream->next_in = (Bytef*)data;
+    _stream->avail_in = size;
+
+    z_res = deflate(_stream, Z_SYNC_FLUSH);
+    if (z_res != Z_OK)
+    {
+        TC_LOG_ERROR("network", "Can't compress packet data (zlib: deflate) Error code: {} ({}, msg: {})", z_res, zError(z_res), _stream->msg);
+        return 0;
+    }
+
+    return bufferSize - _stream->avail_out;
+}
+
+void PacketCompressor::ClearPool()
+{
+    std::scoped_lock lock(PoolLock);
+    for (PooledStream const& pooled : Pool)
+        DestroyStream(pooled.Stream);
+
+    Pool.clear();
+}
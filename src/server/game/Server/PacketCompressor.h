@@ -0,0 +1,63 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PACKET_COMPRESSOR_H
+#define TRINITYCORE_PACKET_COMPRESSOR_H
+
+#include "Define.h"
+#include <cstddef>
+
+typedef struct z_stream_s z_stream;
+
+/*
+ * Per connection deflate stream used for SMSG_COMPRESSED_PACKET.
+ * The client inflates all packets of a connection as one continuous stream, so the state cannot be shared
+ * between sockets - but it can be reused: streams of closed connections are reset and handed to the next
+ * connection instead of being freed, avoiding the large deflate state allocations during login storms.
+ */
+class TC_GAME_API PacketCompressor
+{
+public:
+    PacketCompressor();
+    ~PacketCompressor();
+
+    PacketCompressor(PacketCompressor const&) = delete;
+    PacketCompressor(PacketCompressor&&) = delete;
+    PacketCompressor& operator=(PacketCompressor const&) = delete;
+    PacketCompressor& operator=(PacketCompressor&&) = delete;
+
+    // maxPooledStreams limits how many released streams with the same settings are kept for reuse
+    bool Initialize(int32 level, int32 memLevel, std::size_t maxPooledStreams);
+    bool IsInitialized() const { return _stream != nullptr; }
+
+    // Upper bound of Compress output for a packet of given size (including opcode)
+    uint32 GetMaxCompressedSize(uint32 size) const;
+
+    // Compresses opcode followed by data into buffer, which must hold at least GetMaxCompressedSize(size + sizeof(opcode)) bytes
+    // Returns number of bytes written, 0 on failure
+    uint32 Compress(uint8* buffer, uint32 opcode, uint8 const* data, std::size_t size);
+
+    static void ClearPool();
+
+private:
+    z_stream* _stream;
+    int32 _level;
+    int32 _memLevel;
+    std::size_t _maxPooledStreams;
+};
+
+#endif // TRINITYCORE_PACKET_COMPRESSOR_H
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "PacketRateLimiter.h"
+#include <algorithm>
+
+PacketRateLimiter::PacketRateLimiter() : _limits(), _window(1000), _disconnectFactor(0), _enabled(false)
+{
+}
+
+void PacketRateLimiter::Initialize(uint32 window, std::array<uint32, size_t(OpcodeClass::Max)> const& limits, uint32 disconnectFactor)
+{
+    _window = std::max(window, 1u);
+    _limits = limits;
+    _disconnectFactor = disconnectFactor;
+    _enabled = std::ranges::any_of(_limits, [](uint32 limit) { return limit != 0; });
+    _windows = { };
+}
+
+PacketRateLimiter::Result PacketRateLimiter::Check(OpcodeClass opcodeClass, uint32 now)
+{
+    uint32 limit = _limits[size_t(opcodeClass)];
+    if (!limit)
+        return Result::Accept;
+
+    SlidingWindow& window = _windows[size_t(opcodeClass)];
+    uint32 elapsed = now - window.Start;
+    if (elapsed >= _window)
+    {
+        // the previous window only counts if it is the one right before the current
+        window.Previous = elapsed < 2 * _window ? window.Current : 0;
+        window.Current = 0;
+        window.Start = now - elapsed % _window;
+        elapsed = now - window.Start;
+    }
+
+    // dropped packets are counted too, a client has to slow down below the limit to get through again
+    uint64 count = uint64(window.Previous) * (_window - elapsed) / _window + window.Current;
+    ++window.Current;
+
+    if (count < limit)
+        return Result::Accept;
+
+    if (_disconnectFactor && count >= uint64(limit) * _disconnectFactor)
+        return Result::Disconnect;
+
+    return Result::Drop;
+}
+
+PacketRateLimiter::OpcodeClass PacketRateLimiter::GetOpcodeClass(OpcodeClient opcode)
+{
+    ClientOpcodeHandler const* handler = opcodeTable[opcode];
+    if (!handler)
+        return OpcodeClass::Socket;
+
+    switch (handler->ProcessingPlace)
+    {
+        case PROCESS_THREADUNSAFE:
+            return OpcodeClass::WorldThread;
+        case PROCESS_THREADSAFE:
+            return OpcodeClass::MapThread;
+        default:
+            break;
+    }
+
+    return OpcodeClass::Socket;
+}
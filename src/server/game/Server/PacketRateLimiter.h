@@ -0,0 +1,77 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRINITYCORE_PACKET_RATE_LIMITER_H
+#define TRINITYCORE_PACKET_RATE_LIMITER_H
+
+#include "Define.h"
+#include "Opcodes.h"
+#include <array>
+
+/*
+ * Per connection packet rate limit, checked as soon as a packet is decrypted and before it is copied into a WorldPacket.
+ * Opcodes are grouped by the thread handling them - flooding packets processed by the world thread hurts everyone on
+ * the realm while map thread packets only slow down one map. Each group counts packets in a sliding window approximated
+ * from the current and the previous fixed window, which takes constant time and memory per packet.
+ */
+class TC_GAME_API PacketRateLimiter
+{
+public:
+    enum class OpcodeClass : uint8
+    {
+        Socket,         // handled by WorldSocket itself, in place or not at all
+        WorldThread,
+        MapThread,
+
+        Max
+    };
+
+    enum class Result : uint8
+    {
+        Accept,
+        Drop,
+        Disconnect
+    };
+
+    PacketRateLimiter();
+
+    // limits are packets per window, 0 disables the limit of an opcode class
+    // clients sending more than disconnectFactor times the limit are disconnected, 0 only drops their packets
+    void Initialize(uint32 window, std::array<uint32, size_t(OpcodeClass::Max)> const& limits, uint32 disconnectFactor);
+    bool IsEnabled() const { return _enabled; }
+
+    Result Check(OpcodeClass opcodeClass, uint32 now);
+
+    static OpcodeClass GetOpcodeClass(OpcodeClient opcode);
+
+private:
+    struct SlidingWindow
+    {
+        uint32 Start = 0;
+        uint32 Current = 0;
+        uint32 Previous = 0;
+    };
+
+    std::array<SlidingWindow, size_t(OpcodeClass::Max)> _windows;
+    std::array<uint32, size_t(OpcodeClass::Max)> _limits;
+    uint32 _window;
+    uint32 _disconnectFactor;
+    bool _enabled;
+};
+
+#endif // TRINITYCORE_PACKET_RATE_LIMITER_H
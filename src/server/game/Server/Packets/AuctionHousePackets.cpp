@@ -652,6 +652,13 @@ WorldPacket const* AuctionReplicateResponse::Write()
     _worldPacket << uint32(ChangeNumberGlobal);
     _worldPacket << uint32(ChangeNumberCursor);
     _worldPacket << uint32(ChangeNumberTombstone);
+    if (!SerializedItems.empty())
+    {
+        _worldPacket << uint32(SerializedItemCount);
+        _worldPacket.append(SerializedItems.data(), SerializedItems.size());
+        return &_worldPacket;
+    }
+
     _worldPacket << Size<uint32>(Items);
 
     for (AuctionItem const& item : Items)
@@ -660,6 +667,15 @@ WorldPacket const* AuctionReplicateResponse::Write()
     return &_worldPacket;
 }
 
+std::vector<uint8> AuctionReplicateResponse::WriteItems(std::span<AuctionItem const> items)
+{
+    ByteBuffer data(items.size() * 165, ByteBuffer::Reserve{});
+    for (AuctionItem const& item : items)
+        data << item;
+
+    return std::move(data).Release();
+}
+
 WorldPacket const* AuctionWonNotification::Write()
 {
     _worldPacket << Info;
@@ -23,6 +23,7 @@
 #include "DBCEnums.h"
 #include "ItemPacketsCommon.h"
 #include "ObjectGuid.h"
+#include <span>
 
 struct AuctionsBucketKey;
 struct AuctionPosting;
@@ -525,6 +526,12 @@ namespace WorldPackets
             uint32 ChangeNumberTombstone = 0;
             uint32 Result = 0;
             std::vector<AuctionItem> Items;
+
+            // items written by WriteItems, sent instead of Items when set
+            std::span<uint8 const> SerializedItems;
+            uint32 SerializedItemCount = 0;
+
+            static std::vector<uint8> WriteItems(std::span<AuctionItem const> items);
         };
 
         class AuctionWonNotification final : public ServerPacket
@@ -70,13 +70,14 @@ ByteBuffer& operator<<(ByteBuffer& data, GuildRosterProfessionData const& roster
     return data;
 }
 
-ByteBuffer& operator<<(ByteBuffer& data, GuildRosterMemberData const& rosterMemberData)
+void WriteRosterMemberData(ByteBuffer& data, GuildRosterMemberData const& rosterMemberData, std::size_t& lastSavePos)
 {
     data << rosterMemberData.Guid;
     data << int32(rosterMemberData.RankID);
     data << int32(rosterMemberData.AreaID);
     data << int32(rosterMemberData.PersonalAchievementPoints);
     data << int32(rosterMemberData.GuildReputation);
+    lastSavePos = data.wpos();
     data << float(rosterMemberData.LastSave);
 
     for (uint8 i = 0; i < 2; i++)
@@ -102,7 +103,12 @@ ByteBuffer& operator<<(ByteBuffer& data, GuildRosterMemberData const& rosterMemb
     data << SizedString::Data(rosterMemberData.Name);
     data << SizedString::Data(rosterMemberData.Note);
     data << SizedString::Data(rosterMemberData.OfficerNote);
+}
 
+ByteBuffer& operator<<(ByteBuffer& data, GuildRosterMemberData const& rosterMemberData)
+{
+    std::size_t lastSavePos;
+    WriteRosterMemberData(data, rosterMemberData, lastSavePos);
     return data;
 }
 
@@ -111,7 +117,7 @@ WorldPacket const* GuildRoster::Write()
     _worldPacket << int32(NumAccounts);
     _worldPacket << CreateDate;
     _worldPacket << int32(GuildFlags);
-    _worldPacket << Size<uint32>(MemberData);
+    _worldPacket << uint32(MemberData.size() + SerializedMemberData.size());
     _worldPacket << SizedString::BitsSize<11>(WelcomeText);
     _worldPacket << SizedString::BitsSize<11>(InfoText);
     _worldPacket.FlushBits();
@@ -119,6 +125,9 @@ WorldPacket const* GuildRoster::Write()
     for (GuildRosterMemberData const& member : MemberData)
         _worldPacket << member;
 
+    for (std::span<uint8 const> member : SerializedMemberData)
+        _worldPacket.append(member.data(), member.size());
+
     _worldPacket << SizedString::Data(WelcomeText);
     _worldPacket << SizedString::Data(InfoText);
 
@@ -121,6 +121,9 @@ namespace WorldPackets
             MythicPlus::DungeonScoreSummary DungeonScore;
         };
 
+        /// Writes a roster entry like GuildRoster does, lastSavePos is set to the position of LastSave in data
+        void WriteRosterMemberData(ByteBuffer& data, GuildRosterMemberData const& rosterMemberData, std::size_t& lastSavePos);
+
         class GuildRoster final : public ServerPacket
         {
         public:
@@ -129,6 +132,7 @@ namespace WorldPackets
             WorldPacket const* Write() override;
 
             std::vector<GuildRosterMemberData> MemberData;
+            std::vector<std::span<uint8 const>> SerializedMemberData;   // written by WriteRosterMemberData, sent after MemberData
             std::string WelcomeText;
             std::string InfoText;
             WowTime CreateDate;
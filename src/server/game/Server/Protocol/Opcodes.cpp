@@ -20,6 +20,7 @@
 #include "Util.h"
 #include "WorldSession.h"
 #include "Packets/AllPackets.h"
+#include <bit>
 #include <charconv>
 
 namespace
@@ -132,6 +133,59 @@ void OpcodeTable::ValidateAndSetServerOpcode(OpcodeServer opcode, char const* na
     _internalTableServer[GetOpcodeArrayIndex(opcode)].reset(new ServerOpcodeHandler{ .Name = name, .Status = status, .ConnectionIndex = conIdx });
 }
 
+std::size_t OpcodeTable::GetServerPacketSizeHint(OpcodeServer index, std::size_t defaultSize) const
+{
+    if (!IsValid(index))
+        return defaultSize;
+
+    if (uint32 estimate = _serverPacketSizes[GetOpcodeArrayIndex(index)].Estimate.load(std::memory_order_relaxed))
+        return estimate;
+
+    return defaultSize;
+}
+
+void OpcodeTable::RecordServerPacketSize(OpcodeServer index, std::size_t size)
+{
+    if (!size || !IsValid(index))
+        return;
+
+    ServerPacketSizeStats& stats = _serverPacketSizes[GetOpcodeArrayIndex(index)];
+    std::size_t bucket = std::min<std::size_t>(std::bit_width((size - 1) / ServerPacketSizeStats::MinBucketSize), ServerPacketSizeStats::NumBuckets - 1);
+    stats.Counts[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    uint32 samples = stats.Samples.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (samples % ServerPacketSizeStats::SamplesPerEstimate)
+        return;
+
+    std::array<uint32, ServerPacketSizeStats::NumBuckets> counts;
+    uint32 total = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        counts[i] = stats.Counts[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    if (samples >= ServerPacketSizeStats::MaxSamples)
+    {
+        for (std::size_t i = 0; i < counts.size(); ++i)
+            stats.Counts[i].fetch_sub(counts[i] / 2, std::memory_order_relaxed);
+
+        stats.Samples.fetch_sub(samples / 2, std::memory_order_relaxed);
+    }
+
+    uint32 threshold = total - total / 20;
+    uint32 cumulative = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        cumulative += counts[i];
+        if (cumulative >= threshold)
+        {
+            stats.Estimate.store(uint32(ServerPacketSizeStats::MinBucketSize << i), std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
 /// Correspondence between opcodes and their names
 void OpcodeTable::Initialize()
 {
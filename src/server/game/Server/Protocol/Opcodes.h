@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "StringFormatFwd.h"
 #include <array>
+#include <atomic>
 #include <memory>
 
 enum ConnectionType : int8
@@ -2293,6 +2294,19 @@ struct ServerOpcodeHandler
     ConnectionType ConnectionIndex;
 };
 
+/// Histogram of recently serialized sizes of a server opcode, bucket N counts packets of up to (MinBucketSize << N) bytes
+struct ServerPacketSizeStats
+{
+    static constexpr std::size_t MinBucketSize = 0x100;
+    static constexpr std::size_t NumBuckets = 11;
+    static constexpr uint32 SamplesPerEstimate = 32;
+    static constexpr uint32 MaxSamples = 1024;              // counts are halved past this so that the estimate follows recent traffic
+
+    std::array<std::atomic<uint32>, NumBuckets> Counts = { };
+    std::atomic<uint32> Samples = 0;
+    std::atomic<uint32> Estimate = 0;                       // bucket holding the 95th percentile, 0 until enough samples were seen
+};
+
 template <typename OpcodeEnum>
 struct FormattedOpcodeName
 {
@@ -2347,6 +2361,11 @@ public:
         return _internalTableServer[GetOpcodeArrayIndex(index)].get();
     }
 
+    /// Storage to reserve for a new packet - running 95th percentile of recent sizes of the opcode or defaultSize if not known yet
+    std::size_t GetServerPacketSizeHint(OpcodeServer index, std::size_t defaultSize) const;
+    /// Feeds the size of a fully written packet into the estimate, updates are relaxed and may be lost under contention
+    void RecordServerPacketSize(OpcodeServer index, std::size_t size);
+
 private:
     bool ValidateClientOpcode(OpcodeClient opcode, char const* name) const;
     void ValidateAndSetClientOpcode(OpcodeClient opcode, char const* name, SessionStatus status, ClientOpcodeHandler::HandlerFunction call, PacketProcessing processing);
@@ -2359,6 +2378,7 @@ private:
 
     std::array<std::unique_ptr<ClientOpcodeHandler>, NUM_CMSG_OPCODES> _internalTableClient;
     std::array<std::unique_ptr<ServerOpcodeHandler>, NUM_SMSG_OPCODES> _internalTableServer;
+    std::array<ServerPacketSizeStats, NUM_SMSG_OPCODES> _serverPacketSizes;
 
     friend fmt::formatter<FormattedOpcodeName<OpcodeClient>, char, void>;
     friend fmt::formatter<FormattedOpcodeName<OpcodeServer>, char, void>;
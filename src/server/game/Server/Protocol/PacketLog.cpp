@@ -18,10 +18,17 @@
 #include "PacketLog.h"
 #include "Config.h"
 #include "GameTime.h"
+#include "Hash.h"
 #include "IpAddress.h"
+#include "Log.h"
+#include "LogRingBuffer.h"
 #include "RealmList.h"
+#include "StringConvert.h"
 #include "Timer.h"
+#include "Util.h"
 #include "WorldPacket.h"
+#include <algorithm>
+#include <zlib.h>
 
 #pragma pack(push, 1)
 
@@ -59,17 +66,54 @@ struct PacketHeader
 
 #pragma pack(pop)
 
-PacketLog::PacketLog() : _file(nullptr)
+namespace
+{
+// what a thread writes to its ring buffer, followed by the payload
+struct PacketLogRecord
+{
+    TimePoint Time;
+    PacketHeader Header;
+};
+
+struct PacketLogThreadBuffer
+{
+    std::shared_ptr<Trinity::LogRingBuffer> Buffer;
+};
+
+thread_local PacketLogThreadBuffer ThreadBuffer;
+
+std::unordered_set<uint32> ParseIds(std::string const& ids)
+{
+    std::unordered_set<uint32> result;
+    for (std::string_view id : Trinity::Tokenize(ids, ' ', false))
+        if (Optional<uint32> value = Trinity::StringTo<uint32>(id, 0))
+            result.insert(*value);
+
+    return result;
+}
+}
+
+PacketLog::PacketLog() : _file(nullptr), _gzFile(nullptr), _samplePercent(100), _bufferSize(0), _stopping(false)
 {
     std::call_once(_initializeFlag, &PacketLog::Initialize, this);
 }
 
 PacketLog::~PacketLog()
 {
+    if (_writer.joinable())
+    {
+        _stopping = true;
+        _writer.join();
+    }
+
     if (_file)
         fclose(_file);
 
+    if (_gzFile)
+        gzclose(_gzFile);
+
     _file = nullptr;
+    _gzFile = nullptr;
 }
 
 PacketLog* PacketLog::instance()
@@ -89,7 +133,10 @@ void PacketLog::Initialize()
     std::string logname = sConfigMgr->GetStringDefault("PacketLogFile", "");
     if (!logname.empty())
     {
-        _file = fopen((logsDir + logname).c_str(), "wb");
+        if (sConfigMgr->GetBoolDefault("PacketLog.Compression", false))
+            _gzFile = gzopen((logsDir + logname).c_str(), "wb");
+        else
+            _file = fopen((logsDir + logname).c_str(), "wb");
 
         if (CanLogPacket())
         {
@@ -107,15 +154,39 @@ void PacketLog::Initialize()
             header.SniffStartTicks = getMSTime();
             header.OptionalDataSize = 0;
 
-            fwrite(&header, sizeof(header), 1, _file);
+            Write(&header, sizeof(header));
+
+            _accounts = ParseIds(sConfigMgr->GetStringDefault("PacketLog.Accounts", ""));
+            _opcodes = ParseIds(sConfigMgr->GetStringDefault("PacketLog.Opcodes", ""));
+            _samplePercent = std::min<uint32>(sConfigMgr->GetIntDefault("PacketLog.SamplePercent", 100), 100);
+            _bufferSize = std::max<uint32>(sConfigMgr->GetIntDefault("PacketLog.BufferSize", 4 * 1024 * 1024), 64 * 1024);
+            _writer = std::thread(&PacketLog::RunWriter, this);
         }
     }
 }
 
-void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType)
+bool PacketLog::IsFiltered(uint32 opcode, std::string_view address, uint32 accountId) const
 {
-    std::scoped_lock lock(_logPacketLock);
+    if (!_accounts.empty() && !_accounts.contains(accountId))
+        return true;
+
+    if (!_opcodes.empty() && !_opcodes.contains(opcode))
+        return true;
+
+    // all connections of a client address are logged or none of them, a sniff missing some packets of a connection is useless
+    return _samplePercent < 100 && Trinity::HashFnv1a(address) % 100 >= _samplePercent;
+}
 
+void PacketLog::Write(void const* data, std::size_t size)
+{
+    if (_gzFile)
+        gzwrite(_gzFile, data, unsigned(size));
+    else
+        fwrite(data, 1, size, _file);
+}
+
+void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType, uint32 accountId)
+{
     PacketHeader header;
     header.Direction = direction == CLIENT_TO_SERVER ? 0x47534d43 : 0x47534d53;
     header.ConnectionId = connectionType;
@@ -134,6 +205,9 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
         memcpy(header.OptionalData.SocketIPBytes, bytes.data(), bytes.size());
     }
 
+    if (IsFiltered(packet.GetOpcode(), { reinterpret_cast<char const*>(header.OptionalData.SocketIPBytes), sizeof(header.OptionalData.SocketIPBytes) }, accountId))
+        return;
+
     header.OptionalData.SocketPort = port;
     std::size_t size = packet.size();
     if (direction == CLIENT_TO_SERVER)
@@ -142,14 +216,104 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
     header.Length = size + sizeof(header.Opcode);
     header.Opcode = packet.GetOpcode();
 
-    fwrite(&header, sizeof(header), 1, _file);
+    if (!ThreadBuffer.Buffer)
+    {
+        ThreadBuffer.Buffer = std::make_shared<Trinity::LogRingBuffer>(_bufferSize);
+
+        std::scoped_lock lock(_buffersLock);
+        _buffers.push_back(ThreadBuffer.Buffer);
+    }
+
+    uint8* record = ThreadBuffer.Buffer->Reserve(sizeof(PacketLogRecord) + size);
+    if (!record)
+        return;
+
+    PacketLogRecord logRecord;
+    logRecord.Time = std::chrono::steady_clock::now();
+    logRecord.Header = header;
+    memcpy(record, &logRecord, sizeof(logRecord));
     if (size)
     {
         uint8 const* data = packet.data();
         if (direction == CLIENT_TO_SERVER)
             data += 4;
-        fwrite(data, 1, size, _file);
+        memcpy(record + sizeof(logRecord), data, size);
+    }
+
+    ThreadBuffer.Buffer->Commit();
+}
+
+void PacketLog::RunWriter()
+{
+    TimePoint nextFlush = std::chrono::steady_clock::now();
+    while (true)
+    {
+        bool stopping = _stopping.load(std::memory_order_acquire);
+        if (WritePackets())
+            continue;
+
+        // gzip flushes cost compression, they are only done once per second to keep the file readable while the server runs
+        if (_gzFile && std::chrono::steady_clock::now() >= nextFlush)
+        {
+            gzflush(_gzFile, Z_SYNC_FLUSH);
+            nextFlush = std::chrono::steady_clock::now() + 1s;
+        }
+
+        if (stopping)
+            break;
+
+        std::this_thread::sleep_for(5ms);
     }
+}
+
+std::size_t PacketLog::WritePackets()
+{
+    std::vector<std::shared_ptr<Trinity::LogRingBuffer>> buffers;
+    {
+        std::scoped_lock lock(_buffersLock);
+        // the thread owning the buffer exited and everything it logged was written
+        std::erase_if(_buffers, [](std::shared_ptr<Trinity::LogRingBuffer> const& buffer) { return buffer.use_count() == 1 && buffer->IsEmpty(); });
+        buffers = _buffers;
+    }
+
+    struct PendingRecord
+    {
+        TimePoint Time;
+        uint8 const* Data;
+    };
+
+    std::vector<PendingRecord> records;
+    std::vector<uint64> positions(buffers.size());
+    uint64 dropped = 0;
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+        positions[i] = buffers[i]->Read([&](uint8 const* data)
+        {
+            PacketLogRecord record;
+            memcpy(&record, data, sizeof(record));
+            records.push_back({ .Time = record.Time, .Data = data });
+        });
+        dropped += buffers[i]->TakeDroppedCount();
+    }
+
+    // packets of different threads are interleaved in the order they were logged
+    std::stable_sort(records.begin(), records.end(), [](PendingRecord const& left, PendingRecord const& right) { return left.Time < right.Time; });
+    for (PendingRecord const& pending : records)
+    {
+        PacketLogRecord record;
+        memcpy(&record, pending.Data, sizeof(record));
+        Write(&record.Header, sizeof(record.Header));
+        Write(pending.Data + sizeof(record), record.Header.Length - sizeof(record.Header.Opcode));
+    }
+
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+        buffers[i]->Release(positions[i]);
+
+    if (!records.empty() && _file)
+        fflush(_file);
+
+    if (dropped)
+        TC_LOG_ERROR("network", "PacketLog: {} packets were not logged, packet log buffers are full (PacketLog.BufferSize)", dropped);
 
-    fflush(_file);
+    return records.size();
 }
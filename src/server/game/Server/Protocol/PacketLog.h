@@ -19,7 +19,12 @@
 #define TRINITY_PACKETLOG_H
 
 #include "Common.h"
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 enum Direction
 {
@@ -29,6 +34,12 @@ enum Direction
 
 class WorldPacket;
 enum ConnectionType : int8;
+typedef struct gzFile_s* gzFile;
+
+namespace Trinity
+{
+    class LogRingBuffer;
+}
 
 namespace boost
 {
@@ -41,12 +52,16 @@ namespace boost
     }
 }
 
+/*
+ * Threads copy the packets they log to their own ring buffer, a single writer thread merges them in arrival
+ * order and writes them to the file, gzip compressed if PacketLog.Compression is set.
+ * Packets can be limited to some accounts, opcodes and a percentage of the client addresses.
+ */
 class TC_GAME_API PacketLog
 {
     private:
         PacketLog();
         ~PacketLog();
-        std::mutex _logPacketLock;
         std::once_flag _initializeFlag;
 
     public:
@@ -58,11 +73,28 @@ class TC_GAME_API PacketLog
         static PacketLog* instance();
 
         void Initialize();
-        bool CanLogPacket() const { return (_file != nullptr); }
-        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType);
+        bool CanLogPacket() const { return _file != nullptr || _gzFile != nullptr; }
+        /// accountId is 0 before the connection is authenticated
+        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, ConnectionType connectionType, uint32 accountId);
 
     private:
+        bool IsFiltered(uint32 opcode, std::string_view address, uint32 accountId) const;
+        void Write(void const* data, std::size_t size);
+        void RunWriter();
+        std::size_t WritePackets();
+
         FILE* _file;
+        gzFile _gzFile;
+
+        std::unordered_set<uint32> _accounts;
+        std::unordered_set<uint32> _opcodes;
+        uint32 _samplePercent;
+
+        std::size_t _bufferSize;
+        std::atomic<bool> _stopping;
+        std::thread _writer;
+        std::mutex _buffersLock;
+        std::vector<std::shared_ptr<Trinity::LogRingBuffer>> _buffers;
 };
 
 #define sPacketLog PacketLog::instance()
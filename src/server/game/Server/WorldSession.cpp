@@ -26,6 +26,7 @@
 #include "BattlePetMgr.h"
 #include "BattlegroundMgr.h"
 #include "BattlenetPackets.h"
+#include "CharacterEnumCache.h"
 #include "CharacterPackets.h"
 #include "ChatPackets.h"
 #include "ClientConfigPackets.h"
@@ -46,21 +47,39 @@
 #include "OutdoorPvPMgr.h"
 #include "PacketUtilities.h"
 #include "Player.h"
+#include "Profiler.h"
 #include "QueryHolder.h"
 #include "QueryResultStructured.h"
 #include "Random.h"
 #include "RBAC.h"
 #include "RealmList.h"
 #include "ScriptMgr.h"
+#include "ServiceBase.h"
 #include "SocialMgr.h"
 #include "World.h"
 #include "WorldSocket.h"
 #include <boost/circular_buffer.hpp>
+#include <bit>
 
 namespace {
 
 std::string const DefaultPlayerName = "<none>";
 
+/// A heartbeat immediately followed by another one for the same mover carries nothing the next one doesn't
+bool IsSupersededMovementHeartbeat(WorldPacket const* packet, WorldPacket const* next)
+{
+    if (packet->GetOpcode() != CMSG_MOVE_HEARTBEAT || next->GetOpcode() != CMSG_MOVE_HEARTBEAT)
+        return false;
+
+    if (packet->size() < 2 || next->size() < 2)
+        return false;
+
+    // both start with the packed guid of the mover, identical guids have identical packed forms
+    uint8 const* data = packet->data();
+    std::size_t guidSize = 2 + std::popcount(data[0]) + std::popcount(data[1]);
+    return packet->size() >= guidSize && next->size() >= guidSize && memcmp(data, next->data(), guidSize) == 0;
+}
+
 } // namespace
 
 bool MapSessionFilter::Process(WorldPacket* packet)
@@ -182,8 +201,7 @@ WorldSession::~WorldSession()
     delete _RBACData;
 
     ///- empty incoming packet queue
-    WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    for (WorldPacket* packet : _recvQueue)
         delete packet;
 
     LoginDatabase.PExecute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
@@ -319,7 +337,7 @@ void WorldSession::AddInstanceConnection(WorldSession* session, std::weak_ptr<Wo
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvInbox.Enqueue(new_packet);
 }
 
 /// Logging helper for unexpected opcodes
@@ -354,17 +372,29 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     WorldPacket* packet = nullptr;
     //! Delete packet after processing by default
     bool deletePacket = true;
-    std::vector<WorldPacket*> requeuePackets;
     uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime();
+    bool coalesceHeartbeats = sWorld->getBoolConfig(CONFIG_COALESCE_MOVEMENT_HEARTBEATS);
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 100;
 
-    while (m_Socket[CONNECTION_TYPE_REALM] && _recvQueue.next(packet, updater))
+    _recvInbox.Drain([&](WorldPacket* received) { _recvQueue.push_back(received); });
+
+    while (m_Socket[CONNECTION_TYPE_REALM] && !_recvQueue.empty() && updater.Process(_recvQueue.front()))
     {
+        packet = _recvQueue.front();
+        _recvQueue.pop_front();
+
+        if (coalesceHeartbeats && !_recvQueue.empty() && IsSupersededMovementHeartbeat(packet, _recvQueue.front()))
+        {
+            delete packet;
+            continue;
+        }
+
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
         TC_METRIC_DETAILED_TIMER("worldsession_update_opcode_time", TC_METRIC_TAG("opcode", opHandle->Name));
+        TC_PROFILE_ZONE(opHandle->Name);
 
         try
         {
@@ -378,7 +408,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         //! the client to be in world yet. We will re-add the packets to the bottom of the queue and process them later.
                         if (!m_playerRecentlyLogout)
                         {
-                            requeuePackets.push_back(packet);
+                            _requeuePackets.push_back(packet);
                             deletePacket = false;
                             TC_LOG_DEBUG("network", "Re-enqueueing packet with opcode {} with with status STATUS_LOGGEDIN. "
                                 "Player is currently not in world yet.", GetOpcodeNameForLogging(static_cast<OpcodeClient>(packet->GetOpcode())));
@@ -497,7 +527,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     TC_METRIC_VALUE("processed_packets", processedPackets);
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _recvQueue.insert(_recvQueue.begin(), _requeuePackets.begin(), _requeuePackets.end());
+    _requeuePackets.clear();
 
     if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
     {
@@ -679,6 +710,9 @@ void WorldSession::LogoutPlayer(bool save)
 
         SetPlayer(nullptr); //! Pointer already deleted during RemovePlayerFromMap
 
+        //! The character list shows where the character was saved
+        sCharacterEnumCache->Invalidate(GetAccountId());
+
         //! Send the 'logout complete' packet to the client
         //! Client will respond by sending 3x CMSG_CANCEL_TRADE, which we currently dont handle
         SendPacket(WorldPackets::Character::LogoutComplete().Write());
@@ -1207,6 +1241,18 @@ QueryCallback WorldSession::LoadPermissionsAsync()
     return _RBACData->LoadFromDBAsync();
 }
 
+void WorldSession::LoadPermissions(PreparedQueryResult result)
+{
+    uint32 id = GetAccountId();
+    uint8 secLevel = GetSecurity();
+
+    TC_LOG_DEBUG("rbac", "WorldSession::LoadPermissions [AccountId: {}, Name: {}, realmId: {}, secLevel: {}]",
+        id, _accountName, sRealmList->GetCurrentRealmId().Realm, secLevel);
+
+    _RBACData = new rbac::RBACData(id, _accountName, sRealmList->GetCurrentRealmId().Realm, secLevel);
+    _RBACData->LoadFromDBCallback(std::move(result));
+}
+
 class AccountInfoQueryHolderPerRealm : public CharacterDatabaseQueryHolder
 {
 public:
@@ -29,15 +29,17 @@
 #include "DatabaseEnvFwd.h"
 #include "Duration.h"
 #include "IteratorPair.h"
-#include "LockedQueue.h"
+#include "MPSCInbox.h"
 #include "ObjectGuid.h"
 #include "Opcodes.h"
 #include "Optional.h"
 #include "RaceMask.h"
 #include "SharedDefines.h"
+#include "WorldPacket.h"
 #include <boost/circular_buffer_fwd.hpp>
 #include <array>
 #include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -50,6 +52,7 @@ class Item;
 class LoginQueryHolder;
 class MessageBuffer;
 class Player;
+class RpcMessagePool;
 class Unit;
 class WorldPacket;
 class WorldSession;
@@ -251,6 +254,7 @@ namespace WorldPackets
 
         class AlterApperance;
         class EnumCharacters;
+        class EnumCharactersResult;
         class CreateCharacter;
         class CharDelete;
         class CharacterRenameRequest;
@@ -995,6 +999,7 @@ class TC_GAME_API WorldSession
         bool HasPermission(uint32 permissionId);
         void LoadPermissions();
         QueryCallback LoadPermissionsAsync();
+        void LoadPermissions(PreparedQueryResult result);   // result of a permission query issued together with account info
         void InvalidateRBACData(); // Used to force LoadPermissions at next HasPermission check
 
         AccountTypes GetSecurity() const { return _security; }
@@ -1062,6 +1067,7 @@ class TC_GAME_API WorldSession
         void SendShowBank(ObjectGuid guid, PlayerInteractionType interactionType);
         bool CanOpenMailBox(ObjectGuid guid);
         void SendShowMailBox(ObjectGuid guid);
+        void SendMailList(ObjectGuid mailbox);
         void SendTabardVendorActivate(ObjectGuid guid, TabardVendorType type);
         void SendSpiritResurrect();
         void SendBindPoint(Creature* npc);
@@ -1220,6 +1226,7 @@ class TC_GAME_API WorldSession
         void LogUnprocessedTail(WorldPacket const* packet);
 
         void HandleCharEnum(CharacterDatabaseQueryHolder const& holder);
+        void SendCharEnum(WorldPackets::Character::EnumCharactersResult& charEnum);
         void HandleCharEnumOpcode(WorldPackets::Character::EnumCharacters& /*enumCharacters*/);
         void HandleCharUndeleteEnumOpcode(WorldPackets::Character::EnumCharacters& /*enumCharacters*/);
         void HandleCharDeleteOpcode(WorldPackets::Character::CharDelete& charDelete);
@@ -1852,6 +1859,7 @@ class TC_GAME_API WorldSession
         void SendBattlenetResponse(uint32 serviceHash, uint32 methodId, uint32 token, uint32 status);
         void SendBattlenetRequest(uint32 serviceHash, uint32 methodId, pb::Message const* request, std::function<void(MessageBuffer)> callback);
         void SendBattlenetRequest(uint32 serviceHash, uint32 methodId, pb::Message const* request);
+        RpcMessagePool* GetBattlenetMessagePool();
 
         std::array<uint8, 32> const& GetRealmListSecret() const { return _realmListSecret; }
         void SetRealmListSecret(std::array<uint8, 32> const& secret) { _realmListSecret = secret; }
@@ -1975,6 +1983,7 @@ class TC_GAME_API WorldSession
         std::unordered_map<uint32 /*realmAddress*/, uint8> _realmCharacterCounts;
         std::unordered_map<uint32, std::function<void(MessageBuffer)>> _battlenetResponseCallbacks;
         uint32 _battlenetRequestToken;
+        std::unique_ptr<RpcMessagePool> _battlenetMessagePool;
 
         time_t _logoutTime;
         bool m_inQueue;                                     // session wait in auth.queue
@@ -1994,7 +2003,10 @@ class TC_GAME_API WorldSession
         bool _filterAddonMessages;
         uint32 recruiterId;
         bool isRecruiter;
-        LockedQueue<WorldPacket*> _recvQueue;
+        Trinity::MPSCInbox<WorldPacket, &WorldPacket::SessionQueueLink> _recvInbox;
+        // packets drained from _recvInbox, only accessed by the thread currently updating the session
+        std::deque<WorldPacket*> _recvQueue;
+        std::vector<WorldPacket*> _requeuePackets;
         rbac::RBACData* _RBACData;
         uint32 expireTime;
         bool forceExit;
@@ -27,13 +27,16 @@
 #include "HMAC.h"
 #include "IPLocation.h"
 #include "IpBanCheckConnectionInitializer.h"
+#include "Optional.h"
 #include "PacketLog.h"
 #include "ProtobufJSON.h"
+#include "QueryHolder.h"
 #include "RealmList.h"
 #include "RBAC.h"
 #include "RealmList.pb.h"
 #include "ScriptMgr.h"
 #include "SessionKeyGenerator.h"
+#include "Timer.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -63,18 +66,14 @@ std::array<uint8, 32> const WorldSocket::EncryptionKeySeed = { 0x71, 0xC9, 0xED,
 
 WorldSocket::WorldSocket(Trinity::Net::IoContextTcpSocket&& socket) : BaseSocket(std::move(socket)),
     _type(CONNECTION_TYPE_REALM), _key(0), _serverChallenge(), _sessionKey(), _encryptKey(), _OverSpeedPings(0),
-    _worldSession(nullptr), _authed(false), _canRequestHotfixes(true), _headerBuffer(sizeof(IncomingPacketHeader)), _sendBufferSize(4096), _compressionStream(nullptr)
+    _worldSession(nullptr), _accountId(0), _authed(false), _canRequestHotfixes(true), _headerBuffer(sizeof(IncomingPacketHeader)), _sendBufferSize(4096)
 {
+    _rateLimiter.Initialize(sWorld->getIntConfig(CONFIG_PACKET_RATE_LIMIT_WINDOW),
+        { sWorld->getIntConfig(CONFIG_PACKET_RATE_LIMIT_SOCKET), sWorld->getIntConfig(CONFIG_PACKET_RATE_LIMIT_WORLD_THREAD), sWorld->getIntConfig(CONFIG_PACKET_RATE_LIMIT_MAP_THREAD) },
+        sWorld->getIntConfig(CONFIG_PACKET_RATE_LIMIT_DISCONNECT_FACTOR));
 }
 
-WorldSocket::~WorldSocket()
-{
-    if (_compressionStream)
-    {
-        deflateEnd(_compressionStream);
-        delete _compressionStream;
-    }
-}
+WorldSocket::~WorldSocket() = default;
 
 struct WorldSocketProtocolInitializer final : Trinity::Net::SocketConnectionInitializer
 {
@@ -181,17 +180,10 @@ void WorldSocketProtocolInitializer::HandleDataReady()
 
 bool WorldSocket::InitializeCompression()
 {
-    _compressionStream = new z_stream();
-    _compressionStream->zalloc = (alloc_func)nullptr;
-    _compressionStream->zfree = (free_func)nullptr;
-    _compressionStream->opaque = (voidpf)nullptr;
-    _compressionStream->avail_in = 0;
-    _compressionStream->next_in = nullptr;
-    int32 z_res = deflateInit2(_compressionStream, sWorld->getIntConfig(CONFIG_COMPRESSION), Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
-    if (z_res != Z_OK)
+    if (!_compressor.Initialize(sWorld->getIntConfig(CONFIG_COMPRESSION), sWorld->getIntConfig(CONFIG_COMPRESSION_MEM_LEVEL),
+        sWorld->getIntConfig(CONFIG_COMPRESSION_STREAM_POOL_SIZE)))
     {
         CloseSocket();
-        TC_LOG_ERROR("network", "Can't initialize packet compression (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
         return false;
     }
 
@@ -201,39 +193,50 @@ bool WorldSocket::InitializeCompression()
 bool WorldSocket::Update()
 {
     EncryptablePacket* queued;
-    MessageBuffer buffer(_sendBufferSize);
+    Optional<MessageBuffer> buffer; // only acquired once there is something to send
     while (_bufferQueue.Dequeue(queued))
     {
         uint32 packetSize = queued->size() + 4 /*opcode*/;
         if (packetSize > MinSizeForCompression && queued->NeedsEncryption())
-            packetSize = deflateBound(_compressionStream, packetSize) + sizeof(CompressedWorldPacket);
+            packetSize = _compressor.GetMaxCompressedSize(packetSize) + sizeof(CompressedWorldPacket);
 
         // Flush current buffer if too small for next packet
-        if (buffer.GetRemainingSpace() < packetSize + sizeof(PacketHeader))
+        if (buffer && buffer->GetRemainingSpace() < packetSize + sizeof(PacketHeader))
         {
-            QueuePacket(std::move(buffer));
-            buffer.Resize(_sendBufferSize);
+            _authCrypt.EncryptSendBatch();
+            QueuePacket(std::move(*buffer));
+            buffer.reset();
         }
 
-        if (buffer.GetRemainingSpace() >= packetSize + sizeof(PacketHeader))
-            WritePacketToBuffer(*queued, buffer);
+        if (packetSize + sizeof(PacketHeader) <= _sendBufferSize)
+        {
+            if (!buffer)
+                buffer = AcquireWriteBuffer(_sendBufferSize);
+
+            WritePacketToBuffer(*queued, *buffer);
+        }
         else    // single packet larger than _sendBufferSize
         {
-            MessageBuffer packetBuffer(packetSize + sizeof(PacketHeader));
+            MessageBuffer packetBuffer = AcquireWriteBuffer(packetSize + sizeof(PacketHeader));
             WritePacketToBuffer(*queued, packetBuffer);
+            _authCrypt.EncryptSendBatch();
             QueuePacket(std::move(packetBuffer));
         }
 
         delete queued;
     }
 
-    if (buffer.GetActiveSize() > 0)
-        QueuePacket(std::move(buffer));
+    if (buffer && buffer->GetActiveSize() > 0)
+    {
+        _authCrypt.EncryptSendBatch();
+        QueuePacket(std::move(*buffer));
+    }
 
     if (!BaseSocket::Update())
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _queryHolderProcessor.ProcessReadyCallbacks();
 
     return true;
 }
@@ -325,6 +328,7 @@ void WorldSocket::SetWorldSession(WorldSession* session)
 {
     std::scoped_lock sessionGuard(_worldSessionLock);
     _worldSession = session;
+    _accountId = session->GetAccountId();
     _authed = true;
 }
 
@@ -364,8 +368,8 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
         return ReadDataHandlerResult::Error;
     }
 
-    WorldPacket packet(std::move(_packetBuffer).Release(), GetConnectionType());
-    OpcodeClient opcode = packet.read<OpcodeClient>();
+    OpcodeClient opcode;
+    memcpy(&opcode, _packetBuffer.GetReadPointer(), sizeof(opcode));
     if (!opcodeTable.IsValid(opcode))
     {
         TC_LOG_ERROR("network", "WorldSocket::ReadHeaderHandler(): client {} sent wrong opcode (opcode: {})",
@@ -373,10 +377,31 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
         return ReadDataHandlerResult::Error;
     }
 
+    if (_rateLimiter.IsEnabled())
+    {
+        switch (_rateLimiter.Check(PacketRateLimiter::GetOpcodeClass(opcode), getMSTime()))
+        {
+            case PacketRateLimiter::Result::Drop:
+                TC_LOG_DEBUG("network", "WorldSocket::ReadDataHandler(): client {} exceeded packet rate limit, dropping {}",
+                    GetRemoteIpAddress(), GetOpcodeNameForLogging(opcode));
+                // keeps the buffer storage for the next packet, dropping allocates nothing
+                _packetBuffer.Reset();
+                return ReadDataHandlerResult::Ok;
+            case PacketRateLimiter::Result::Disconnect:
+                TC_LOG_ERROR("network", "WorldSocket::ReadDataHandler(): client {} flooded {}, disconnecting",
+                    GetRemoteIpAddress(), GetOpcodeNameForLogging(opcode));
+                return ReadDataHandlerResult::Error;
+            default:
+                break;
+        }
+    }
+
+    WorldPacket packet(std::move(_packetBuffer).Release(), GetConnectionType());
+    packet.read_skip<OpcodeClient>();
     packet.SetOpcode(opcode);
 
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort(), GetConnectionType());
+        sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort(), GetConnectionType(), _accountId.load(std::memory_order_relaxed));
 
     std::unique_lock<std::mutex> sessionGuard(_worldSessionLock, std::defer_lock);
 
@@ -532,7 +557,7 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
         return;
 
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort(), GetConnectionType());
+        sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort(), GetConnectionType(), _accountId.load(std::memory_order_relaxed));
 
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
 }
@@ -558,7 +583,7 @@ void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBu
         uint8* compressionInfo = buffer.GetWritePointer();
         buffer.WriteCompleted(sizeof(CompressedWorldPacket));
 
-        uint32 compressedSize = CompressPacket(buffer.GetWritePointer(), packet);
+        uint32 compressedSize = _compressor.Compress(buffer.GetWritePointer(), opcode, packet.data(), packetSize);
 
         cmp.CompressedAdler = adler32(0x9827D8F1, buffer.GetWritePointer(), compressedSize);
 
@@ -574,41 +599,10 @@ void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBu
     memcpy(dataPos, &opcode, sizeof(opcode));
     packetSize += sizeof(opcode);
 
-    PacketHeader header;
-    header.Size = packetSize;
-    _authCrypt.EncryptSend(dataPos, header.Size, header.Tag);
-
-    memcpy(headerPos, &header, sizeof(PacketHeader));
-}
-
-uint32 WorldSocket::CompressPacket(uint8* buffer, WorldPacket const& packet)
-{
-    uint32 opcode = packet.GetOpcode();
-    uint32 bufferSize = deflateBound(_compressionStream, packet.size() + sizeof(opcode));
-
-    _compressionStream->next_out = buffer;
-    _compressionStream->avail_out = bufferSize;
-    _compressionStream->next_in = (Bytef*)&opcode;
-    _compressionStream->avail_in = sizeof(opcode);
-
-    int32 z_res = deflate(_compressionStream, Z_NO_FLUSH);
-    if (z_res != Z_OK)
-    {
-        TC_LOG_ERROR("network", "Can't compress packet opcode (zlib: deflate) Error code: {} ({}, msg: {})", z_res, zError(z_res), _compressionStream->msg);
-        return 0;
-    }
-
-    _compressionStream->next_in = (Bytef*)packet.data();
-    _compressionStream->avail_in = packet.size();
-
-    z_res = deflate(_compressionStream, Z_SYNC_FLUSH);
-    if (z_res != Z_OK)
-    {
-        TC_LOG_ERROR("network", "Can't compress packet data (zlib: deflate) Error code: {} ({}, msg: {})", z_res, zError(z_res), _compressionStream->msg);
-        return 0;
-    }
-
-    return bufferSize - _compressionStream->avail_out;
+    // encrypted with the other packets of the buffer before it is queued, the tag is written into the header in place
+    PacketHeader* header = reinterpret_cast<PacketHeader*>(headerPos);
+    header->Size = packetSize;
+    _authCrypt.AddToSendBatch(dataPos, packetSize, &header->Tag);
 }
 
 struct AccountInfo
@@ -672,6 +666,38 @@ struct AccountInfo
     }
 };
 
+// Account and its permissions are looked up by name together, the session is ready without another round trip
+class AuthSessionQueryHolder : public LoginDatabaseQueryHolder
+{
+public:
+    enum
+    {
+        ACCOUNT_INFO = 0,
+        PERMISSIONS,
+
+        MAX_QUERIES
+    };
+
+    AuthSessionQueryHolder() { SetSize(MAX_QUERIES); }
+
+    bool Initialize(int32 realmId, std::string const& accountName)
+    {
+        bool ok = true;
+
+        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_INFO_BY_NAME);
+        stmt->setInt32(0, realmId);
+        stmt->setString(1, accountName);
+        ok = SetPreparedQuery(ACCOUNT_INFO, stmt) && ok;
+
+        stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_RBAC_ACCOUNT_PERMISSIONS_BY_NAME);
+        stmt->setString(0, accountName);
+        stmt->setInt32(1, realmId);
+        ok = SetPreparedQuery(PERMISSIONS, stmt) && ok;
+
+        return ok;
+    }
+};
+
 void WorldSocket::HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession)
 {
     std::shared_ptr<JSON::RealmList::RealmJoinTicket> joinTicket = std::make_shared<JSON::RealmList::RealmJoinTicket>();
@@ -683,18 +709,24 @@ void WorldSocket::HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSess
     }
 
     // Get the account information from the auth database
-    LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_INFO_BY_NAME);
-    stmt->setInt32(0, int32(sRealmList->GetCurrentRealmId().Realm));
-    stmt->setString(1, joinTicket->gameaccount());
+    std::shared_ptr<AuthSessionQueryHolder> holder = std::make_shared<AuthSessionQueryHolder>();
+    if (!holder->Initialize(int32(sRealmList->GetCurrentRealmId().Realm), joinTicket->gameaccount()))
+    {
+        SendAuthResponseError(ERROR_INTERNAL);
+        DelayedCloseSocket();
+        return;
+    }
 
-    QueueQuery(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback([this, authSession = std::move(authSession), joinTicket = std::move(joinTicket)](PreparedQueryResult result) mutable
+    _queryHolderProcessor.AddCallback(LoginDatabase.DelayQueryHolder(holder)).AfterComplete([this, authSession = std::move(authSession), joinTicket = std::move(joinTicket)](SQLQueryHolderBase const& holder) mutable
     {
-        HandleAuthSessionCallback(std::move(authSession), std::move(joinTicket), std::move(result));
-    }));
+        AuthSessionQueryHolder const& authHolder = static_cast<AuthSessionQueryHolder const&>(holder);
+        HandleAuthSessionCallback(std::move(authSession), std::move(joinTicket), authHolder.GetPreparedResult(AuthSessionQueryHolder::ACCOUNT_INFO),
+            authHolder.GetPreparedResult(AuthSessionQueryHolder::PERMISSIONS));
+    });
 }
 
 void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession,
-    std::shared_ptr<JSON::RealmList::RealmJoinTicket> joinTicket, PreparedQueryResult result)
+    std::shared_ptr<JSON::RealmList::RealmJoinTicket> joinTicket, PreparedQueryResult result, PreparedQueryResult permissions)
 {
     // Stop if the account is not found
     if (!result)
@@ -807,7 +839,7 @@ void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::
         return;
     }
 
-    if (IpLocationRecord const* location = sIPLocation->GetLocationRecord(address))
+    if (IpLocationRecord const* location = sIPLocation->GetLocationRecord(GetRemoteIpAddress()))
         _ipCountry = location->CountryCode;
 
     ///- Re-check ip locking (same check as in auth).
@@ -886,24 +918,17 @@ void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::
     sScriptMgr->OnAccountLogin(account.Game.Id);
 
     _authed = true;
+    _accountId = account.Game.Id;
     _worldSession = new WorldSession(account.Game.Id, std::move(*joinTicket->mutable_gameaccount()), account.BattleNet.Id,
         static_pointer_cast<WorldSocket>(shared_from_this()), account.Game.Security, account.Game.Expansion, mutetime,
         account.Game.OS, account.Game.TimezoneOffset, account.Game.Build, buildVariant, account.Game.Locale,
         account.Game.Recruiter, account.Game.IsRectuiter);
 
-    QueueQuery(_worldSession->LoadPermissionsAsync().WithPreparedCallback([this](PreparedQueryResult result)
-    {
-        LoadSessionPermissionsCallback(std::move(result));
-    }));
-    AsyncRead(Trinity::Net::InvokeReadHandlerCallback<WorldSocket>{ .Socket = this });
-}
-
-void WorldSocket::LoadSessionPermissionsCallback(PreparedQueryResult result)
-{
     // RBAC must be loaded before adding session to check for skip queue permission
-    _worldSession->GetRBACData()->LoadFromDBCallback(result);
+    _worldSession->LoadPermissions(std::move(permissions));
 
     SendPacketAndLogOpcode(*WorldPackets::Auth::EnterEncryptedMode(_encryptKey, true).Write());
+    AsyncRead(Trinity::Net::InvokeReadHandlerCallback<WorldSocket>{ .Socket = this });
 }
 
 void WorldSocket::HandleAuthContinuedSession(std::shared_ptr<WorldPackets::Auth::AuthContinuedSession> authSession)
@@ -22,6 +22,9 @@
 #include "AuthDefines.h"
 #include "DatabaseEnvFwd.h"
 #include "MessageBuffer.h"
+#include "PacketBufferPool.h"
+#include "PacketCompressor.h"
+#include "PacketRateLimiter.h"
 #include "Socket.h"
 #include "WorldPacket.h"
 #include "WorldPacketCrypt.h"
@@ -35,7 +38,6 @@ namespace JSON::RealmList
 class RealmJoinTicket;
 }
 
-typedef struct z_stream_s z_stream;
 class EncryptablePacket;
 class WorldPacket;
 class WorldSession;
@@ -45,11 +47,18 @@ enum OpcodeClient : uint32;
 class EncryptablePacket : public WorldPacket
 {
 public:
-    EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptablePacket(WorldPacket const& packet, bool encrypt)
+        : WorldPacket(packet.GetOpcode(), PacketBufferPool::Acquire(packet.size()), packet.GetConnection()), _encrypt(encrypt)
     {
+        append(packet);
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    ~EncryptablePacket()
+    {
+        PacketBufferPool::Release(std::move(*this).Release());
+    }
+
     bool NeedsEncryption() const { return _encrypt; }
 
     std::atomic<EncryptablePacket*> SocketQueueLink;
@@ -144,14 +153,12 @@ private:
     /// sends and logs network.opcode without accessing WorldSession
     void SendPacketAndLogOpcode(WorldPacket const& packet);
     void WritePacketToBuffer(EncryptablePacket const& packet, MessageBuffer& buffer);
-    uint32 CompressPacket(uint8* buffer, WorldPacket const& packet);
 
     void HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession);
     void HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession,
-        std::shared_ptr<JSON::RealmList::RealmJoinTicket> joinTicket, PreparedQueryResult result);
+        std::shared_ptr<JSON::RealmList::RealmJoinTicket> joinTicket, PreparedQueryResult result, PreparedQueryResult permissions);
     void HandleAuthContinuedSession(std::shared_ptr<WorldPackets::Auth::AuthContinuedSession> authSession);
     void HandleAuthContinuedSessionCallback(std::shared_ptr<WorldPackets::Auth::AuthContinuedSession> authSession, PreparedQueryResult result);
-    void LoadSessionPermissionsCallback(PreparedQueryResult result);
     void HandleConnectToFailed(WorldPackets::Auth::ConnectToFailed& connectToFailed);
     bool HandlePing(WorldPackets::Auth::Ping& ping);
     void HandleEnterEncryptedModeAck();
@@ -169,6 +176,7 @@ private:
 
     std::mutex _worldSessionLock;
     WorldSession* _worldSession;
+    std::atomic<uint32> _accountId;             // of _worldSession, for packet log filters on any thread
     bool _authed;
     bool _canRequestHotfixes;
 
@@ -177,9 +185,11 @@ private:
     MPSCQueue<EncryptablePacket, &EncryptablePacket::SocketQueueLink> _bufferQueue;
     std::size_t _sendBufferSize;
 
-    z_stream* _compressionStream;
+    PacketCompressor _compressor;
+    PacketRateLimiter _rateLimiter;
 
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<SQLQueryHolderCallback> _queryHolderProcessor;
     std::string _ipCountry;
 };
 
@@ -51,6 +51,7 @@ WorldSocketMgr& WorldSocketMgr::Instance()
 bool WorldSocketMgr::StartNetwork(Trinity::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port, int threadCount)
 {
     _tcpNoDelay = sConfigMgr->GetBoolDefault("Network.TcpNodelay", true);
+    _threadAffinity = sConfigMgr->GetStringDefault("Network.Threads.Affinity", "");
 
     int const max_connections = TRINITY_MAX_LISTEN_CONNECTIONS;
     TC_LOG_DEBUG("misc", "Max allowed socket connections {}", max_connections);
@@ -82,6 +83,8 @@ void WorldSocketMgr::StopNetwork()
 {
     BaseSocketMgr::StopNetwork();
 
+    PacketCompressor::ClearPool();
+
     sScriptMgr->OnNetworkStop();
 }
 
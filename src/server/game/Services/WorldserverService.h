@@ -37,6 +37,7 @@ namespace Battlenet
         void SendResponse(uint32 serviceHash, uint32 methodId, uint32 token, uint32 status) override { _session->SendBattlenetResponse(serviceHash, methodId, token, status); }
         void SendResponse(uint32 serviceHash, uint32 methodId, uint32 token, google::protobuf::Message const* response) override { _session->SendBattlenetResponse(serviceHash, methodId, token, response); }
         std::string GetCallerInfo() const override { return _session->GetPlayerInfo(); }
+        RpcMessagePool* GetMessagePool() override { return _session->GetBattlenetMessagePool(); }
 
         WorldSession* _session;
     };
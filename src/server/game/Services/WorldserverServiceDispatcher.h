@@ -49,7 +49,7 @@ namespace Battlenet
     class WorldserverServiceDispatcher
     {
     public:
-        void Dispatch(WorldSession* session, uint32 serviceHash, uint32 token, uint32 methodId, MessageBuffer buffer);
+        void Dispatch(WorldSession* session, uint32 serviceHash, uint32 token, uint32 methodId, MessageBuffer& buffer);
 
         static WorldserverServiceDispatcher& Instance();
 
@@ -63,12 +63,12 @@ namespace Battlenet
         }
 
         template<class Service>
-        static void Dispatch(WorldSession* session, uint32 token, uint32 methodId, MessageBuffer buffer)
+        static void Dispatch(WorldSession* session, uint32 token, uint32 methodId, MessageBuffer& buffer)
         {
-            Service(session).CallServerMethod(token, methodId, std::move(buffer));
+            Service(session).CallServerMethod(token, methodId, buffer);
         }
 
-        typedef void(*ServiceMethod)(WorldSession*, uint32, uint32, MessageBuffer);
+        typedef void(*ServiceMethod)(WorldSession*, uint32, uint32, MessageBuffer&);
         std::unordered_map<uint32, ServiceMethod> _dispatchers;
     };
 }
@@ -758,6 +758,17 @@ void AuraEffect::GetApplicationList(Container& applicationContainer) const
     }
 }
 
+void AuraEffect::SetAmount(int32 amount)
+{
+    _amount = amount;
+    m_canBeRecalculated = false;
+
+    // targets cache the aggregated amounts of their registered effects
+    for (auto const& [targetGuid, aurApp] : GetBase()->GetApplicationMap())
+        if (aurApp->HasEffect(GetEffIndex()))
+            aurApp->GetTarget()->InvalidateAuraModifierCache(GetAuraType());
+}
+
 int32 AuraEffect::CalculateAmount(Unit* caster)
 {
     Unit* unitOwner = GetBase()->GetOwner()->ToUnit();
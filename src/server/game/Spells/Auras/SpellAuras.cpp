@@ -18,6 +18,7 @@
 #include "SpellAuras.h"
 #include "CellImpl.h"
 #include "Common.h"
+#include "CombatLogPackets.h"
 #include "Containers.h"
 #include "CreatureAI.h"
 #include "DynamicObject.h"
@@ -182,6 +183,7 @@ void AuraApplication::_HandleEffect(uint8 effIndex, bool apply)
         aurEff->HandleEffect(this, AURA_EFFECT_HANDLE_REAL, false);
     }
 
+    GetTarget()->IncreaseAuraApplicationRevision();
     SetNeedClientUpdate();
 }
 
@@ -484,7 +486,8 @@ m_applyTime(GameTime::GetGameTime()), m_owner(createInfo._owner), m_timeCla(0),
 m_casterLevel(createInfo.Caster ? createInfo.Caster->GetLevel() : m_spellInfo->SpellLevel), m_procCharges(0), m_stackAmount(createInfo.StackAmount),
 m_isRemoved(false), m_isSingleTarget(false), m_isUsingCharges(false), m_dropEvent(nullptr),
 m_procCooldown(TimePoint::min()),
-m_lastProcAttemptTime(GameTime::Now() - Seconds(10)), m_lastProcSuccessTime(GameTime::Now() - Seconds(120)), m_scriptRef(this, NoopAuraDeleter())
+m_lastProcAttemptTime(GameTime::Now() - Seconds(10)), m_lastProcSuccessTime(GameTime::Now() - Seconds(120)), m_procEntry(nullptr),
+m_procEntryGeneration(0), m_scriptHookMask(0), m_periodicLogBatch(nullptr), m_scriptRef(this, NoopAuraDeleter())
 {
     if (!m_spellInfo->HasAttribute(SPELL_ATTR6_DO_NOT_CONSUME_RESOURCES))
     {
@@ -821,6 +824,14 @@ void Aura::UpdateOwner(uint32 diff, WorldObject* owner)
 {
     ASSERT(owner == m_owner);
 
+    // passive and permanent auras without periodic effects skip the caster and spellmod lookups until their targets are refreshed
+    if (!HasTimersToUpdate() && m_updateTargetMapInterval > int32(diff))
+    {
+        m_updateTargetMapInterval -= diff;
+        _DeleteRemovedApplications();
+        return;
+    }
+
     Unit* caster = GetCaster();
     // Apply spellmods for channeled auras
     // used for example when triggered spell of spell:10 is modded
@@ -844,10 +855,28 @@ void Aura::UpdateOwner(uint32 diff, WorldObject* owner)
     else
         m_updateTargetMapInterval -= diff;
 
-    // update aura effects
+    // update aura effects, ticks of several effects on the same target are sent as one log
+    CombatLogBatch periodicLogs;
+    uint32 periodicEffects = 0;
+    for (AuraEffect const* effect : GetAuraEffects())
+        if (effect->IsPeriodic())
+            ++periodicEffects;
+
+    if (periodicEffects > 1)
+        m_periodicLogBatch = &periodicLogs;
+
     for (AuraEffect* effect : GetAuraEffects())
         effect->Update(diff, caster);
 
+    m_periodicLogBatch = nullptr;
+    for (std::unique_ptr<WorldPackets::CombatLog::CombatLogServerPacket>& log : periodicLogs)
+    {
+        // the batch only ever holds periodic aura logs, see Unit::SendPeriodicAuraLog
+        WorldPackets::CombatLog::SpellPeriodicAuraLog* periodicLog = static_cast<WorldPackets::CombatLog::SpellPeriodicAuraLog*>(log.get());
+        if (Unit* target = ObjectAccessor::GetUnit(*m_owner, periodicLog->TargetGUID))
+            target->SendPeriodicAuraLogMessage(periodicLog);
+    }
+
     // remove spellmods after effects update
     if (modSpell)
         modOwner->SetSpellModTakingSpell(modSpell, false);
@@ -907,6 +936,18 @@ void Aura::Update(uint32 diff, Unit* caster)
     }
 }
 
+bool Aura::HasTimersToUpdate() const
+{
+    if (m_duration > 0)
+        return true;
+
+    for (AuraEffect const* effect : GetAuraEffects())
+        if (effect->IsPeriodic())
+            return true;
+
+    return false;
+}
+
 int32 Aura::CalcMaxDuration(Unit* caster) const
 {
     return Aura::CalcMaxDuration(GetSpellInfo(), caster, nullptr);
@@ -1007,7 +1048,7 @@ void Aura::SetCharges(uint8 charges)
 uint8 Aura::CalcMaxCharges(Unit* caster) const
 {
     uint32 maxProcCharges = m_spellInfo->ProcCharges;
-    if (SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(GetSpellInfo()))
+    if (SpellProcEntry const* procEntry = GetProcEntry())
         maxProcCharges = procEntry->Charges;
 
     if (caster)
@@ -1782,6 +1823,18 @@ bool Aura::IsProcOnCooldown(TimePoint now) const
     return m_procCooldown > now;
 }
 
+SpellProcEntry const* Aura::GetProcEntry() const
+{
+    uint32 generation = sSpellMgr->GetSpellProcGeneration();
+    if (m_procEntryGeneration != generation)
+    {
+        m_procEntry = sSpellMgr->GetSpellProcEntry(GetSpellInfo());
+        m_procEntryGeneration = generation;
+    }
+
+    return m_procEntry;
+}
+
 void Aura::AddProcCooldown(SpellProcEntry const* procEntry, TimePoint now)
 {
     // cooldowns should be added to the whole aura (see 51698 area aura)
@@ -1804,7 +1857,7 @@ void Aura::PrepareProcToTrigger(AuraApplication* aurApp, ProcEventInfo& eventInf
     if (!prepare)
         return;
 
-    SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(GetSpellInfo());
+    SpellProcEntry const* procEntry = GetProcEntry();
     ASSERT(procEntry);
 
     PrepareProcChargeDrop(procEntry, eventInfo);
@@ -1841,7 +1894,7 @@ void Aura::ConsumeProcCharges(SpellProcEntry const* procEntry)
 
 uint32 Aura::GetProcEffectMask(AuraApplication* aurApp, ProcEventInfo& eventInfo, TimePoint now) const
 {
-    SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(GetSpellInfo());
+    SpellProcEntry const* procEntry = GetProcEntry();
     // only auras with spell proc entry can trigger proc
     if (!procEntry)
         return 0;
@@ -2036,7 +2089,7 @@ void Aura::TriggerProcOnEvent(uint32 procEffectMask, AuraApplication* aurApp, Pr
         }
     }
 
-    ConsumeProcCharges(ASSERT_NOTNULL(sSpellMgr->GetSpellProcEntry(GetSpellInfo())));
+    ConsumeProcCharges(ASSERT_NOTNULL(GetProcEntry()));
 }
 
 float Aura::CalcPPMProcChance(Unit* actor) const
@@ -2069,11 +2122,15 @@ void Aura::LoadScripts()
     {
         TC_LOG_DEBUG("spells", "Aura::LoadScripts: Script `{}` for aura `{}` is loaded now", script->GetScriptName(), m_spellInfo->Id);
         script->Register();
+        m_scriptHookMask |= script->_GetHookMask();
     }
 }
 
 bool Aura::CallScriptCheckAreaTargetHandlers(Unit* target)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_CHECK_AREA_TARGET))
+        return true;
+
     bool result = true;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2088,6 +2145,9 @@ bool Aura::CallScriptCheckAreaTargetHandlers(Unit* target)
 
 void Aura::CallScriptDispel(DispelInfo* dispelInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_DISPEL))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_DISPEL);
@@ -2100,6 +2160,9 @@ void Aura::CallScriptDispel(DispelInfo* dispelInfo)
 
 void Aura::CallScriptAfterDispel(DispelInfo* dispelInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_AFTER_DISPEL))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_AFTER_DISPEL);
@@ -2112,6 +2175,9 @@ void Aura::CallScriptAfterDispel(DispelInfo* dispelInfo)
 
 void Aura::CallScriptOnHeartbeat()
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_ON_HEARTBEAT))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_ON_HEARTBEAT);
@@ -2124,6 +2190,9 @@ void Aura::CallScriptOnHeartbeat()
 
 bool Aura::CallScriptEffectApplyHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp, AuraEffectHandleModes mode)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_APPLY))
+        return false;
+
     bool preventDefault = false;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2143,6 +2212,9 @@ bool Aura::CallScriptEffectApplyHandlers(AuraEffect const* aurEff, AuraApplicati
 
 bool Aura::CallScriptEffectRemoveHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp, AuraEffectHandleModes mode)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_REMOVE))
+        return false;
+
     bool preventDefault = false;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2161,6 +2233,9 @@ bool Aura::CallScriptEffectRemoveHandlers(AuraEffect const* aurEff, AuraApplicat
 
 void Aura::CallScriptAfterEffectApplyHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp, AuraEffectHandleModes mode)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_APPLY))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_AFTER_APPLY, aurApp);
@@ -2174,6 +2249,9 @@ void Aura::CallScriptAfterEffectApplyHandlers(AuraEffect const* aurEff, AuraAppl
 
 void Aura::CallScriptAfterEffectRemoveHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp, AuraEffectHandleModes mode)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_REMOVE))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_AFTER_REMOVE, aurApp);
@@ -2187,6 +2265,9 @@ void Aura::CallScriptAfterEffectRemoveHandlers(AuraEffect const* aurEff, AuraApp
 
 bool Aura::CallScriptEffectPeriodicHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_PERIODIC))
+        return false;
+
     bool preventDefault = false;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2206,6 +2287,9 @@ bool Aura::CallScriptEffectPeriodicHandlers(AuraEffect const* aurEff, AuraApplic
 
 void Aura::CallScriptEffectUpdatePeriodicHandlers(AuraEffect* aurEff)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_UPDATE_PERIODIC))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_UPDATE_PERIODIC);
@@ -2219,6 +2303,9 @@ void Aura::CallScriptEffectUpdatePeriodicHandlers(AuraEffect* aurEff)
 
 void Aura::CallScriptEffectCalcAmountHandlers(AuraEffect const* aurEff, int32& amount, bool& canBeRecalculated)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_CALC_AMOUNT))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_CALC_AMOUNT);
@@ -2232,6 +2319,9 @@ void Aura::CallScriptEffectCalcAmountHandlers(AuraEffect const* aurEff, int32& a
 
 void Aura::CallScriptEffectCalcPeriodicHandlers(AuraEffect const* aurEff, bool& isPeriodic, int32& amplitude)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_CALC_PERIODIC))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_CALC_PERIODIC);
@@ -2245,6 +2335,9 @@ void Aura::CallScriptEffectCalcPeriodicHandlers(AuraEffect const* aurEff, bool&
 
 void Aura::CallScriptEffectCalcSpellModHandlers(AuraEffect const* aurEff, SpellModifier*& spellMod)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_CALC_SPELLMOD))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_CALC_SPELLMOD);
@@ -2258,6 +2351,9 @@ void Aura::CallScriptEffectCalcSpellModHandlers(AuraEffect const* aurEff, SpellM
 
 void Aura::CallScriptEffectCalcCritChanceHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp, Unit const* victim, float& critChance)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_CALC_CRIT_CHANCE))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_CALC_CRIT_CHANCE, aurApp);
@@ -2271,6 +2367,9 @@ void Aura::CallScriptEffectCalcCritChanceHandlers(AuraEffect const* aurEff, Aura
 
 void Aura::CallScriptCalcDamageAndHealingHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp, Unit* victim, int32& damageOrHealing, int32& flatMod, float& pctMod)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_CALC_DAMAGE_AND_HEALING))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_CALC_DAMAGE_AND_HEALING, aurApp);
@@ -2284,6 +2383,9 @@ void Aura::CallScriptCalcDamageAndHealingHandlers(AuraEffect const* aurEff, Aura
 
 void Aura::CallScriptEffectAbsorbHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, DamageInfo& dmgInfo, uint32& absorbAmount, bool& defaultPrevented)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_ABSORB))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_ABSORB, aurApp);
@@ -2300,6 +2402,9 @@ void Aura::CallScriptEffectAbsorbHandlers(AuraEffect* aurEff, AuraApplication co
 
 void Aura::CallScriptEffectAfterAbsorbHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, DamageInfo& dmgInfo, uint32& absorbAmount)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_ABSORB))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_AFTER_ABSORB, aurApp);
@@ -2313,6 +2418,9 @@ void Aura::CallScriptEffectAfterAbsorbHandlers(AuraEffect* aurEff, AuraApplicati
 
 void Aura::CallScriptEffectAbsorbHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, HealInfo& healInfo, uint32& absorbAmount, bool& defaultPrevented)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_ABSORB))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_ABSORB, aurApp);
@@ -2329,6 +2437,9 @@ void Aura::CallScriptEffectAbsorbHandlers(AuraEffect* aurEff, AuraApplication co
 
 void Aura::CallScriptEffectAfterAbsorbHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, HealInfo& healInfo, uint32& absorbAmount)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_ABSORB))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_AFTER_ABSORB, aurApp);
@@ -2342,6 +2453,9 @@ void Aura::CallScriptEffectAfterAbsorbHandlers(AuraEffect* aurEff, AuraApplicati
 
 void Aura::CallScriptEffectManaShieldHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, DamageInfo& dmgInfo, uint32& absorbAmount, bool& defaultPrevented)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_MANASHIELD))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_MANASHIELD, aurApp);
@@ -2358,6 +2472,9 @@ void Aura::CallScriptEffectManaShieldHandlers(AuraEffect* aurEff, AuraApplicatio
 
 void Aura::CallScriptEffectAfterManaShieldHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, DamageInfo& dmgInfo, uint32& absorbAmount)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_MANASHIELD))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_AFTER_MANASHIELD, aurApp);
@@ -2371,6 +2488,9 @@ void Aura::CallScriptEffectAfterManaShieldHandlers(AuraEffect* aurEff, AuraAppli
 
 void Aura::CallScriptEffectSplitHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, DamageInfo& dmgInfo, uint32& splitAmount)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_SPLIT))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_SPLIT, aurApp);
@@ -2384,6 +2504,9 @@ void Aura::CallScriptEffectSplitHandlers(AuraEffect* aurEff, AuraApplication con
 
 void Aura::CallScriptEnterLeaveCombatHandlers(AuraApplication const* aurApp, bool isNowInCombat)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_ENTER_LEAVE_COMBAT))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_ENTER_LEAVE_COMBAT, aurApp);
@@ -2396,6 +2519,9 @@ void Aura::CallScriptEnterLeaveCombatHandlers(AuraApplication const* aurApp, boo
 
 bool Aura::CallScriptCheckProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_CHECK_PROC))
+        return true;
+
     bool result = true;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2411,6 +2537,9 @@ bool Aura::CallScriptCheckProcHandlers(AuraApplication const* aurApp, ProcEventI
 
 bool Aura::CallScriptPrepareProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_PREPARE_PROC))
+        return true;
+
     bool prepare = true;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2429,6 +2558,9 @@ bool Aura::CallScriptPrepareProcHandlers(AuraApplication const* aurApp, ProcEven
 
 bool Aura::CallScriptProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_PROC))
+        return false;
+
     bool handled = false;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2445,6 +2577,9 @@ bool Aura::CallScriptProcHandlers(AuraApplication const* aurApp, ProcEventInfo&
 
 void Aura::CallScriptAfterProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_AFTER_PROC))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_AFTER_PROC, aurApp);
@@ -2457,6 +2592,9 @@ void Aura::CallScriptAfterProcHandlers(AuraApplication const* aurApp, ProcEventI
 
 bool Aura::CallScriptCheckEffectProcHandlers(AuraEffect const* aurEff, AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_CHECK_EFFECT_PROC))
+        return true;
+
     bool result = true;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2473,6 +2611,9 @@ bool Aura::CallScriptCheckEffectProcHandlers(AuraEffect const* aurEff, AuraAppli
 
 bool Aura::CallScriptEffectProcHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_PROC))
+        return false;
+
     bool preventDefault = false;
     for (AuraScript* script : m_loadedScripts)
     {
@@ -2491,6 +2632,9 @@ bool Aura::CallScriptEffectProcHandlers(AuraEffect* aurEff, AuraApplication cons
 
 void Aura::CallScriptAfterEffectProcHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
+    if (!HasScriptHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_PROC))
+        return;
+
     for (AuraScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(AURA_SCRIPT_HOOK_EFFECT_AFTER_PROC, aurApp);
@@ -212,6 +212,8 @@ class TC_GAME_API Aura
 
         void UpdateOwner(uint32 diff, WorldObject* owner);
         void Update(uint32 diff, Unit* caster);
+        // false when nothing but the periodic target refresh is left to update: no duration counting down and no periodic effect
+        bool HasTimersToUpdate() const;
 
         time_t GetApplyTime() const { return m_applyTime; }
         int32 GetMaxDuration() const { return m_maxDuration; }
@@ -289,12 +291,17 @@ class TC_GAME_API Aura
         AuraApplication* GetApplicationOfTarget(ObjectGuid guid);
         bool IsAppliedOnTarget(ObjectGuid guid) const;
 
+        // set while the effects are updated when more than one of them can tick, their logs of a target are merged
+        CombatLogBatch* GetPeriodicLogBatch() const { return m_periodicLogBatch; }
+
         void SetNeedClientUpdateForTargets() const;
         void HandleAuraSpecificMods(AuraApplication const* aurApp, Unit* caster, bool apply, bool onReapply);
         bool CanBeAppliedOn(Unit* target);
         bool CheckAreaTarget(Unit* target);
         bool CanStackWith(Aura const* existingAura) const;
 
+        // Proc entry of the spell, cached until the proc table is reloaded
+        SpellProcEntry const* GetProcEntry() const;
         bool IsProcOnCooldown(TimePoint now) const;
         void AddProcCooldown(SpellProcEntry const* procEntry, TimePoint now);
         void ResetProcCooldown();
@@ -385,6 +392,7 @@ class TC_GAME_API Aura
 
     private:
         AuraScript* GetScriptByType(std::type_info const& type) const;
+        bool HasScriptHook(uint32 hookType) const { return (m_scriptHookMask & (UI64LIT(1) << hookType)) != 0; }
         void _DeleteRemovedApplications();
 
     protected:
@@ -421,6 +429,12 @@ class TC_GAME_API Aura
         TimePoint m_lastProcAttemptTime;
         TimePoint m_lastProcSuccessTime;
 
+        mutable SpellProcEntry const* m_procEntry;
+        mutable uint32 m_procEntryGeneration;
+
+        uint64 m_scriptHookMask;                            // hook types with handlers in any of m_loadedScripts, set by LoadScripts
+        CombatLogBatch* m_periodicLogBatch;
+
     private:
         std::vector<AuraApplication*> _removedApplications;
 
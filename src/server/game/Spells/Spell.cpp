@@ -43,6 +43,8 @@
 #include "Log.h"
 #include "Loot.h"
 #include "LootMgr.h"
+#include "Map.h"
+#include "MapUtils.h"
 #include "MotionMaster.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
@@ -50,6 +52,7 @@
 #include "Pet.h"
 #include "PhasingHandler.h"
 #include "Player.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "SharedDefines.h"
 #include "SpellAuraEffects.h"
@@ -480,6 +483,7 @@ m_spellValue(new SpellValue(m_spellInfo, caster)), _spellEvent(nullptr)
     m_delayStart = 0;
     m_delayMoment = 0;
     m_delayAtDamageCount = 0;
+    m_scriptHookMask = 0;
 
     m_applyMultiplierMask = 0;
     memset(m_damageMultipliers, 0, sizeof(m_damageMultipliers));
@@ -545,6 +549,7 @@ m_spellValue(new SpellValue(m_spellInfo, caster)), _spellEvent(nullptr)
     effectInfo = nullptr;
     m_damage = 0;
     m_healing = 0;
+    m_combatLogBatch = nullptr;
     m_hitMask = PROC_HIT_NONE;
     m_procSpellType = PROC_SPELL_TYPE_NONE;
     focusObject = nullptr;
@@ -1274,6 +1279,9 @@ void Spell::SelectImplicitConeTargets(SpellEffectInfo const& spellEffectInfo, Sp
     {
         float extraSearchRadius = radius > 0.0f ? EXTRA_CELL_SEARCH_RADIUS : 0.0f;
         Trinity::WorldObjectSpellConeTargetCheck check(*m_caster, DegToRad(coneAngle), m_spellInfo->Width ? m_spellInfo->Width : m_caster->GetCombatReach(), radius, m_caster, m_spellInfo, selectionType, condList, objectType);
+        if (!check.CanMatchAnyTarget())
+            return;
+
         Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellConeTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
         SearchTargets<Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellConeTargetCheck> >(searcher, containerTypeMask, m_caster, m_caster, radius + extraSearchRadius);
 
@@ -1425,6 +1433,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffectInfo const& spellEffectInfo, Sp
                 targets.resize(maxTargets);
         }
 
+        PrepareAreaTargetsLineOfSight(targets, center);
+
         for (WorldObject* itr : targets)
         {
             if (Unit* unit = itr->ToUnit())
@@ -1434,6 +1444,9 @@ void Spell::SelectImplicitAreaTargets(SpellEffectInfo const& spellEffectInfo, Sp
             else if (Corpse* corpse = itr->ToCorpse())
                 AddCorpseTarget(corpse, effMask);
         }
+
+        m_areaLineOfSightCenter = nullptr;
+        m_areaLineOfSight.clear();
     }
 }
 
@@ -2156,6 +2169,9 @@ void Spell::SearchTargets(SEARCHER& searcher, uint32 containerMask, WorldObject*
 
         Map* map = referer->GetMap();
 
+        // checks compare against distance between object edges, pad the prefilter with the largest expected combat reach
+        searcher.SetSearchCircle(x, y, radius + EXTRA_CELL_SEARCH_RADIUS);
+
         if (searchInWorld)
             Cell::VisitWorldObjects(x, y, map, searcher, radius);
 
@@ -2190,10 +2206,47 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, SpellEffectInfo
 
     float extraSearchRadius = range > 0.0f ? EXTRA_CELL_SEARCH_RADIUS : 0.0f;
     Trinity::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList, objectType, searchReason);
+    if (!check.CanMatchAnyTarget())
+        return;
+
     Trinity::WorldObjectListSearcher searcher(PhasingHandler::GetAlwaysVisiblePhaseShift(), targets, check, containerTypeMask);
     SearchTargets(searcher, containerTypeMask, m_caster, position, range + extraSearchRadius);
 }
 
+void Spell::PrepareAreaTargetsLineOfSight(std::list<WorldObject*> const& targets, Position const* center)
+{
+    if (m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_spellInfo->Id, nullptr, SPELL_DISABLE_LOS))
+        return;
+
+    // same rays as IsWithinLOS(target, *center, M2) casts from CheckEffectTarget
+    std::vector<WorldObject const*> sources;
+    std::vector<LineOfSightQuery> queries;
+    for (WorldObject const* target : targets)
+    {
+        if (!target->IsUnit() || !target->IsInWorld() || target->GetMap() != m_caster->GetMap())
+            continue;
+
+        LineOfSightQuery& query = queries.emplace_back();
+        query.Phases = &target->GetPhaseShift();
+        query.X2 = center->GetPositionX();
+        query.Y2 = center->GetPositionY();
+        query.Z2 = center->GetPositionZ();
+        target->GetLineOfSightRay(query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2);
+        sources.push_back(target);
+    }
+
+    // a single ray gains nothing from a batch
+    if (queries.size() < 2)
+        return;
+
+    std::vector<bool> results;
+    m_caster->GetMap()->isInLineOfSight(queries, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2, results);
+
+    m_areaLineOfSightCenter = center;
+    for (std::size_t i = 0; i < sources.size(); ++i)
+        m_areaLineOfSight[sources[i]] = results[i];
+}
+
 void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType,
     SpellTargetCheckTypes selectType, SpellEffectInfo const& spellEffectInfo, bool isChainHeal)
 {
@@ -2876,7 +2929,7 @@ void Spell::TargetInfo::DoDamageAndTriggers(Spell* spell)
                 ProcHitMask |= PROC_HIT_NORMAL;
 
             healInfo = std::make_unique<HealInfo>(caster, spell->unitTarget, addhealth, spell->m_spellInfo, spell->m_spellInfo->GetSchoolMask());
-            caster->HealBySpell(*healInfo, IsCrit);
+            caster->HealBySpell(*healInfo, IsCrit, spell->m_combatLogBatch);
             spell->unitTarget->GetThreatManager().ForwardThreatForAssistingMe(caster, float(healInfo->GetEffectiveHeal()) * 0.5f, spell->m_spellInfo);
             spell->m_healing = healInfo->GetEffectiveHeal();
 
@@ -2920,7 +2973,7 @@ void Spell::TargetInfo::DoDamageAndTriggers(Spell* spell)
                 caster->DealSpellDamage(&damageInfo, true);
 
                 // Send log damage message to client
-                caster->SendSpellNonMeleeDamageLog(&damageInfo);
+                caster->SendSpellNonMeleeDamageLog(&damageInfo, spell->m_combatLogBatch);
             }
 
             // Do triggers for unit
@@ -3981,8 +4034,18 @@ void Spell::DoProcessTargetContainer(Container& targetContainer)
             if (target.EffectMask & (1 << spellEffectInfo.EffectIndex))
                 target.DoTargetSpellHit(this, spellEffectInfo);
 
+    // the caster sends the logs of every target, find the players receiving them only once for area spells
+    CombatLogBatch combatLogs;
+    if (targetContainer.size() > 1)
+        m_combatLogBatch = &combatLogs;
+
     for (TargetInfoBase& target : targetContainer)
         target.DoDamageAndTriggers(this);
+
+    m_combatLogBatch = nullptr;
+    if (!combatLogs.empty())
+        if (Unit* caster = m_originalCaster ? m_originalCaster : m_caster->ToUnit())
+            caster->SendCombatLogMessages(combatLogs);
 }
 
 void Spell::handle_immediate()
@@ -4255,6 +4318,8 @@ void Spell::SendSpellCooldown()
 
 void Spell::update(uint32 difftime)
 {
+    TC_PROFILE_ZONE("Spell::update");
+
     // update pointers based at it's GUIDs
     if (!UpdatePointers())
     {
@@ -8593,13 +8658,19 @@ void Spell::HandleLaunchPhase()
         if (m_applyMultiplierMask & (1 << spellEffectInfo.EffectIndex))
             multiplier = spellEffectInfo.CalcDamageMultiplier(m_originalCaster, this);
 
+        // GetUnitTargetCountForEffect and GetUnitTargetIndexForEffect for every target without scanning all targets each time
+        int64 unitTargetCount = GetUnitTargetCountForEffect(spellEffectInfo.EffectIndex);
+        int32 unitTargetIndex = 0;
         for (TargetInfo& target : m_UniqueTargetInfo)
         {
             uint32 mask = target.EffectMask;
             if (!(mask & (1 << spellEffectInfo.EffectIndex)))
                 continue;
 
-            DoEffectOnLaunchTarget(target, multiplier, spellEffectInfo);
+            if (target.MissCondition == SPELL_MISS_NONE)
+                DoEffectOnLaunchTarget(target, multiplier, spellEffectInfo, unitTargetCount, unitTargetIndex++);
+            else
+                DoEffectOnLaunchTarget(target, multiplier, spellEffectInfo, unitTargetCount, int32(unitTargetCount));
         }
     }
 
@@ -8638,7 +8709,7 @@ void Spell::PreprocessSpellLaunch(TargetInfo& targetInfo)
     targetInfo.IsCrit = roll_chance_f(critChance);
 }
 
-void Spell::DoEffectOnLaunchTarget(TargetInfo& targetInfo, float multiplier, SpellEffectInfo const& spellEffectInfo)
+void Spell::DoEffectOnLaunchTarget(TargetInfo& targetInfo, float multiplier, SpellEffectInfo const& spellEffectInfo, int64 unitTargetCount, int32 unitTargetIndex)
 {
     Unit* unit = nullptr;
     // In case spell hit target, do all effect on that target
@@ -8665,8 +8736,8 @@ void Spell::DoEffectOnLaunchTarget(TargetInfo& targetInfo, float multiplier, Spe
 
             if (m_originalCaster->GetTypeId() == TYPEID_PLAYER)
             {
-                int64 targetCount = !isAoeTarget && m_spellValue->ParentSpellTargetCount ? *m_spellValue->ParentSpellTargetCount : GetUnitTargetCountForEffect(spellEffectInfo.EffectIndex);
-                int32 targetIndex = !isAoeTarget && m_spellValue->ParentSpellTargetIndex ? *m_spellValue->ParentSpellTargetIndex : GetUnitTargetIndexForEffect(targetInfo.TargetGUID, spellEffectInfo.EffectIndex);
+                int64 targetCount = !isAoeTarget && m_spellValue->ParentSpellTargetCount ? *m_spellValue->ParentSpellTargetCount : unitTargetCount;
+                int32 targetIndex = !isAoeTarget && m_spellValue->ParentSpellTargetIndex ? *m_spellValue->ParentSpellTargetIndex : unitTargetIndex;
 
                 // sqrt target cap damage calculation
                 if (m_spellInfo->SqrtDamageAndHealingDiminishing.MaxTargets
@@ -8688,8 +8759,8 @@ void Spell::DoEffectOnLaunchTarget(TargetInfo& targetInfo, float multiplier, Spe
         {
             if (m_originalCaster->GetTypeId() == TYPEID_PLAYER)
             {
-                int64 targetCount = !isAoeTarget && m_spellValue->ParentSpellTargetCount ? *m_spellValue->ParentSpellTargetCount : GetUnitTargetCountForEffect(spellEffectInfo.EffectIndex);
-                int32 targetIndex = !isAoeTarget && m_spellValue->ParentSpellTargetIndex ? *m_spellValue->ParentSpellTargetIndex : GetUnitTargetIndexForEffect(targetInfo.TargetGUID, spellEffectInfo.EffectIndex);
+                int64 targetCount = !isAoeTarget && m_spellValue->ParentSpellTargetCount ? *m_spellValue->ParentSpellTargetCount : unitTargetCount;
+                int32 targetIndex = !isAoeTarget && m_spellValue->ParentSpellTargetIndex ? *m_spellValue->ParentSpellTargetIndex : unitTargetIndex;
 
                 // sqrt target cap healing calculation
                 if (m_spellInfo->SqrtDamageAndHealingDiminishing.MaxTargets
@@ -8854,11 +8925,15 @@ void Spell::LoadScripts()
     {
         TC_LOG_DEBUG("spells", "Spell::LoadScripts: Script `{}` for spell `{}` is loaded now", script->GetScriptName(), m_spellInfo->Id);
         script->Register();
+        m_scriptHookMask |= script->_GetHookMask();
     }
 }
 
 void Spell::CallScriptOnPrecastHandler()
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_ON_PRECAST))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_ON_PRECAST);
@@ -8869,6 +8944,9 @@ void Spell::CallScriptOnPrecastHandler()
 
 void Spell::CallScriptBeforeCastHandlers()
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_BEFORE_CAST))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_BEFORE_CAST);
@@ -8881,6 +8959,9 @@ void Spell::CallScriptBeforeCastHandlers()
 
 void Spell::CallScriptOnCastHandlers()
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_ON_CAST))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_ON_CAST);
@@ -8893,6 +8974,9 @@ void Spell::CallScriptOnCastHandlers()
 
 void Spell::CallScriptAfterCastHandlers()
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_AFTER_CAST))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_AFTER_CAST);
@@ -8905,6 +8989,9 @@ void Spell::CallScriptAfterCastHandlers()
 
 SpellCastResult Spell::CallScriptCheckCastHandlers()
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_CHECK_CAST))
+        return SPELL_CAST_OK;
+
     SpellCastResult retVal = SPELL_CAST_OK;
     for (SpellScript* script : m_loadedScripts)
     {
@@ -8923,6 +9010,9 @@ SpellCastResult Spell::CallScriptCheckCastHandlers()
 
 int32 Spell::CallScriptCalcCastTimeHandlers(int32 castTime)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_CALC_CAST_TIME))
+        return castTime;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_CALC_CAST_TIME);
@@ -8934,6 +9024,13 @@ int32 Spell::CallScriptCalcCastTimeHandlers(int32 castTime)
 
 bool Spell::CallScriptEffectHandlers(SpellEffIndex effIndex, SpellEffectHandleMode mode)
 {
+    // handle modes are declared in the same order as their hook types
+    static_assert(SPELL_SCRIPT_HOOK_EFFECT_LAUNCH_TARGET == SPELL_SCRIPT_HOOK_EFFECT_LAUNCH + SPELL_EFFECT_HANDLE_LAUNCH_TARGET);
+    static_assert(SPELL_SCRIPT_HOOK_EFFECT_HIT == SPELL_SCRIPT_HOOK_EFFECT_LAUNCH + SPELL_EFFECT_HANDLE_HIT);
+    static_assert(SPELL_SCRIPT_HOOK_EFFECT_HIT_TARGET == SPELL_SCRIPT_HOOK_EFFECT_LAUNCH + SPELL_EFFECT_HANDLE_HIT_TARGET);
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_EFFECT_LAUNCH + mode))
+        return false;
+
     // execute script effect handler hooks and check if effects was prevented
     bool preventDefault = false;
     for (SpellScript* script : m_loadedScripts)
@@ -8980,6 +9077,9 @@ bool Spell::CallScriptEffectHandlers(SpellEffIndex effIndex, SpellEffectHandleMo
 
 void Spell::CallScriptSuccessfulDispel(SpellEffIndex effIndex)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_EFFECT_SUCCESSFUL_DISPEL))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_EFFECT_SUCCESSFUL_DISPEL);
@@ -8992,6 +9092,9 @@ void Spell::CallScriptSuccessfulDispel(SpellEffIndex effIndex)
 
 void Spell::CallScriptBeforeHitHandlers(SpellMissInfo missInfo)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_BEFORE_HIT))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_InitHit();
@@ -9005,6 +9108,9 @@ void Spell::CallScriptBeforeHitHandlers(SpellMissInfo missInfo)
 
 void Spell::CallScriptOnHitHandlers()
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_HIT))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_HIT);
@@ -9017,6 +9123,9 @@ void Spell::CallScriptOnHitHandlers()
 
 void Spell::CallScriptAfterHitHandlers()
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_AFTER_HIT))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_AFTER_HIT);
@@ -9029,6 +9138,9 @@ void Spell::CallScriptAfterHitHandlers()
 
 void Spell::CallScriptCalcCritChanceHandlers(Unit const* victim, float& critChance)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_CALC_CRIT_CHANCE))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_CALC_CRIT_CHANCE);
@@ -9041,6 +9153,9 @@ void Spell::CallScriptCalcCritChanceHandlers(Unit const* victim, float& critChan
 
 void Spell::CallScriptCalcDamageHandlers(SpellEffectInfo const& spellEffectInfo, Unit* victim, int32& damage, int32& flatMod, float& pctMod)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_CALC_DAMAGE))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_CALC_DAMAGE);
@@ -9053,6 +9168,9 @@ void Spell::CallScriptCalcDamageHandlers(SpellEffectInfo const& spellEffectInfo,
 
 void Spell::CallScriptCalcHealingHandlers(SpellEffectInfo const& spellEffectInfo, Unit* victim, int32& healing, int32& flatMod, float& pctMod)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_CALC_HEALING))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_CALC_HEALING);
@@ -9065,6 +9183,9 @@ void Spell::CallScriptCalcHealingHandlers(SpellEffectInfo const& spellEffectInfo
 
 void Spell::CallScriptObjectAreaTargetSelectHandlers(std::list<WorldObject*>& targets, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_OBJECT_AREA_TARGET_SELECT))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_OBJECT_AREA_TARGET_SELECT);
@@ -9078,6 +9199,9 @@ void Spell::CallScriptObjectAreaTargetSelectHandlers(std::list<WorldObject*>& ta
 
 void Spell::CallScriptObjectTargetSelectHandlers(WorldObject*& target, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_OBJECT_TARGET_SELECT))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_OBJECT_TARGET_SELECT);
@@ -9091,6 +9215,9 @@ void Spell::CallScriptObjectTargetSelectHandlers(WorldObject*& target, SpellEffI
 
 void Spell::CallScriptDestinationTargetSelectHandlers(SpellDestination& target, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_DESTINATION_TARGET_SELECT))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_DESTINATION_TARGET_SELECT);
@@ -9104,6 +9231,9 @@ void Spell::CallScriptDestinationTargetSelectHandlers(SpellDestination& target,
 
 void Spell::CallScriptOnResistAbsorbCalculateHandlers(DamageInfo const& damageInfo, uint32& resistAmount, int32& absorbAmount)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_ON_RESIST_ABSORB_CALCULATION))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_ON_RESIST_ABSORB_CALCULATION);
@@ -9116,6 +9246,9 @@ void Spell::CallScriptOnResistAbsorbCalculateHandlers(DamageInfo const& damageIn
 
 void Spell::CallScriptEmpowerStageCompletedHandlers(int32 completedStagesCount)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_EMPOWER_STAGE_COMPLETED))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_EMPOWER_STAGE_COMPLETED);
@@ -9128,6 +9261,9 @@ void Spell::CallScriptEmpowerStageCompletedHandlers(int32 completedStagesCount)
 
 void Spell::CallScriptEmpowerCompletedHandlers(int32 completedStagesCount)
 {
+    if (!HasScriptHook(SPELL_SCRIPT_HOOK_EMPOWER_COMPLETED))
+        return;
+
     for (SpellScript* script : m_loadedScripts)
     {
         script->_PrepareScriptCall(SPELL_SCRIPT_HOOK_EMPOWER_COMPLETED);
@@ -9352,6 +9488,10 @@ bool Spell::IsWithinLOS(WorldObject const* source, Position const& target, VMAP:
     if (DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_spellInfo->Id, nullptr, SPELL_DISABLE_LOS))
         return true;
 
+    if (&target == m_areaLineOfSightCenter && ignoreFlags == VMAP::ModelIgnoreFlags::M2)
+        if (bool const* result = Trinity::Containers::MapGetValuePtr(m_areaLineOfSight, source))
+            return *result;
+
     return source->IsWithinLOS(target.GetPositionX(), target.GetPositionY(), target.GetPositionZ(), LINEOFSIGHT_ALL_CHECKS, ignoreFlags);
 }
 
@@ -9368,10 +9508,13 @@ namespace Trinity
 
 WorldObjectSpellTargetCheck::WorldObjectSpellTargetCheck(WorldObject* caster, WorldObject* referer, SpellInfo const* spellInfo,
             SpellTargetCheckTypes selectionType, ConditionContainer const* condList, SpellTargetObjectTypes objectType) : _caster(caster), _referer(referer), _spellInfo(spellInfo),
-    _targetSelectionType(selectionType), _condSrcInfo(nullptr), _condList(condList), _objectType(objectType)
+    _targetSelectionType(selectionType), _condSrcInfo(nullptr), _condList(condList), _canMatchAnyTarget(true), _objectType(objectType)
 {
     if (condList)
+    {
         _condSrcInfo = std::make_unique<ConditionSourceInfo>(nullptr, caster);
+        _canMatchAnyTarget = sConditionMgr->PrecheckConditions(*_condSrcInfo, *condList, 0, _condPrecheck);
+    }
 }
 
 WorldObjectSpellTargetCheck::~WorldObjectSpellTargetCheck()
@@ -9380,6 +9523,9 @@ WorldObjectSpellTargetCheck::~WorldObjectSpellTargetCheck()
 
 bool WorldObjectSpellTargetCheck::operator()(WorldObject* target) const
 {
+    if (!_canMatchAnyTarget)
+        return false;
+
     if (_spellInfo->CheckTarget(_caster, target, true) != SPELL_CAST_OK)
         return false;
 
@@ -9467,7 +9613,7 @@ bool WorldObjectSpellTargetCheck::operator()(WorldObject* target) const
     if (!_condSrcInfo)
         return true;
     _condSrcInfo->mConditionTargets[0] = target;
-    return sConditionMgr->IsObjectMeetToConditions(*_condSrcInfo, *_condList);
+    return sConditionMgr->IsObjectMeetToConditions(*_condSrcInfo, *_condList, _condPrecheck);
 }
 
 WorldObjectSpellNearbyTargetCheck::WorldObjectSpellNearbyTargetCheck(float range, WorldObject* caster, SpellInfo const* spellInfo,
@@ -32,6 +32,7 @@
 #include "UniqueTrackablePtr.h"
 #include <memory>
 #include <typeinfo>
+#include <unordered_map>
 
 namespace WorldPackets::Spells
 {
@@ -485,6 +486,8 @@ class TC_GAME_API Spell
             Trinity::WorldObjectSpellAreaTargetSearchReason searchReason);
         void SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType,
             SpellTargetCheckTypes selectType, SpellEffectInfo const& spellEffectInfo, bool isChainHeal);
+        // Checks the line of sight of every unit in targets to center in one batch, answered by IsWithinLOS until cleared
+        void PrepareAreaTargetsLineOfSight(std::list<WorldObject*> const& targets, Position const* center);
 
         GameObject* SearchSpellFocus();
 
@@ -792,6 +795,7 @@ class TC_GAME_API Spell
         // Damage and healing in effects need just calculate
         int32 m_damage;           // Damage  in effects count here
         int32 m_healing;          // Healing in effects count here
+        CombatLogBatch* m_combatLogBatch; // Damage and healing logs sent once all targets of a container were processed
 
         // ******************************************
         // Spell trigger system
@@ -877,6 +881,9 @@ class TC_GAME_API Spell
         };
         std::vector<CorpseTargetInfo> m_UniqueCorpseTargetInfo;
 
+        Position const* m_areaLineOfSightCenter = nullptr;
+        std::unordered_map<WorldObject const*, bool> m_areaLineOfSight;
+
         template <class Container>
         void DoProcessTargetContainer(Container& targetContainer);
 
@@ -898,7 +905,7 @@ class TC_GAME_API Spell
         bool UpdateChanneledTargetList();
         bool IsValidDeadOrAliveTarget(Unit const* target) const;
         void HandleLaunchPhase();
-        void DoEffectOnLaunchTarget(TargetInfo& targetInfo, float multiplier, SpellEffectInfo const& spellEffectInfo);
+        void DoEffectOnLaunchTarget(TargetInfo& targetInfo, float multiplier, SpellEffectInfo const& spellEffectInfo, int64 unitTargetCount, int32 unitTargetIndex);
         void ResetCombatTimers();
 
         void PrepareTargetProcessing();
@@ -931,7 +938,9 @@ class TC_GAME_API Spell
         void CallScriptEmpowerCompletedHandlers(int32 completedStagesCount);
         bool CheckScriptEffectImplicitTargets(uint32 effIndex, uint32 effIndexToCheck);
         SpellScript* GetScriptByType(std::type_info const& type) const;
+        bool HasScriptHook(uint32 hookType) const { return (m_scriptHookMask & (UI64LIT(1) << hookType)) != 0; }
         std::vector<SpellScript*> m_loadedScripts;
+        uint64 m_scriptHookMask; // hook types with handlers in any of m_loadedScripts, set by LoadScripts
 
         struct HitTriggerSpell
         {
@@ -990,6 +999,8 @@ namespace Trinity
         SpellTargetCheckTypes _targetSelectionType;
         std::unique_ptr<ConditionSourceInfo> _condSrcInfo;
         ConditionContainer const* _condList;
+        ConditionPrecheck _condPrecheck;        // conditions not depending on the target are only evaluated once
+        bool _canMatchAnyTarget;
         SpellTargetObjectTypes _objectType;
 
         WorldObjectSpellTargetCheck(WorldObject* caster, WorldObject* referer, SpellInfo const* spellInfo,
@@ -997,6 +1008,10 @@ namespace Trinity
         ~WorldObjectSpellTargetCheck();
 
         bool operator()(WorldObject* target) const;
+
+    public:
+        // False if the target independent checks already failed, searching for targets can be skipped
+        bool CanMatchAnyTarget() const { return _canMatchAnyTarget; }
     };
 
     struct TC_GAME_API WorldObjectSpellNearbyTargetCheck : public WorldObjectSpellTargetCheck
@@ -26,6 +26,7 @@
 #include "Position.h"
 #include "ScriptActionResult.h"
 #include <any>
+#include <memory>
 #include <vector>
 
 class AuraEffect;
@@ -48,6 +49,12 @@ namespace UF
 
 namespace WorldPackets
 {
+    namespace CombatLog
+    {
+        class CombatLogServerPacket;
+        class SpellPeriodicAuraLog;
+    }
+
     namespace Spells
     {
         struct SpellCastRequest;
@@ -56,6 +63,9 @@ namespace WorldPackets
     }
 }
 
+// Combat log packets of one source delivered together by WorldObject::SendCombatLogMessages
+typedef std::vector<std::unique_ptr<WorldPackets::CombatLog::CombatLogServerPacket>> CombatLogBatch;
+
 enum class SpellInterruptFlags : uint32
 {
     None                        = 0,
@@ -544,6 +554,8 @@ public:
         _storage[1] = int32(procFlags2);
     }
 
+    using Base::operator|=;
+
     constexpr ProcFlagsInit& operator|=(ProcFlags procFlags)
     {
         _storage[0] |= int32(procFlags);
@@ -3426,6 +3426,8 @@ void Spell::EffectApplyGlyph()
     else if (glyphId)
         glyphs.push_back(glyphId);
 
+    player->SetSaveDataChanged(PlayerSaveData::Glyphs);
+
     player->RemoveAurasWithInterruptFlags(SpellAuraInterruptFlags2::ChangeGlyph);
 
     if (GlyphPropertiesEntry const* glyphProperties = sGlyphPropertiesStore.LookupEntry(glyphId))
@@ -138,7 +138,7 @@ struct SpellHistory::PersistenceHelper<Pet>
     }
 };
 
-SpellHistory::SpellHistory(Unit* owner) : _owner(owner), _schoolLockouts()
+SpellHistory::SpellHistory(Unit* owner) : _owner(owner), _schoolLockouts(), _nextExpiry(TimePoint::max())
 {
 }
 
@@ -159,7 +159,9 @@ void SpellHistory::LoadFromDB(PreparedQueryResult cooldownsResult, PreparedQuery
             {
                 _spellCooldowns[spellId] = cooldown;
                 if (cooldown.CategoryId)
-                    _categoryCooldowns[cooldown.CategoryId] = &_spellCooldowns[spellId];
+                    _categoryCooldowns[cooldown.CategoryId] = spellId;
+
+                ScheduleExpiry(std::min(cooldown.CooldownEnd, cooldown.CategoryEnd));
             }
 
         } while (cooldownsResult->NextRow());
@@ -173,7 +175,10 @@ void SpellHistory::LoadFromDB(PreparedQueryResult cooldownsResult, PreparedQuery
             uint32 categoryId = 0;
             ChargeEntry charges;
             if (StatementInfo::ReadCharge(fields, &categoryId, &charges))
+            {
                 _categoryCharges[categoryId].push_back(charges);
+                ScheduleExpiry(charges.RechargeEnd);
+            }
 
         } while (chargesResult->NextRow());
     }
@@ -189,44 +194,60 @@ void SpellHistory::SaveToDB(CharacterDatabaseTransaction trans)
     StatementInfo::SetIdentifier(stmt, index++, _owner);
     trans->Append(stmt);
 
+    // every cooldown and charge is written with a single multi-row statement per table
+    CharacterDatabasePreparedStatement* cooldownStmt = nullptr;
     for (auto const& [spellId, cooldown] : _spellCooldowns)
     {
         if (!cooldown.OnHold)
         {
             index = 0;
-            stmt = CharacterDatabase.GetPreparedStatement(StatementInfo::CooldownsInsertStatement);
-            StatementInfo::SetIdentifier(stmt, index++, _owner);
-            StatementInfo::WriteCooldown(stmt, index, cooldown);
-            trans->Append(stmt);
+            cooldownStmt = CharacterDatabase.AddPreparedStatementRow(cooldownStmt, StatementInfo::CooldownsInsertStatement);
+            StatementInfo::SetIdentifier(cooldownStmt, index++, _owner);
+            StatementInfo::WriteCooldown(cooldownStmt, index, cooldown);
         }
     }
 
+    if (cooldownStmt)
+        trans->Append(cooldownStmt);
+
     stmt = CharacterDatabase.GetPreparedStatement(StatementInfo::ChargesDeleteStatement);
     StatementInfo::SetIdentifier(stmt, 0, _owner);
     trans->Append(stmt);
 
+    CharacterDatabasePreparedStatement* chargeStmt = nullptr;
     for (auto const& [categoryId, consumedCharges] : _categoryCharges)
     {
         for (ChargeEntry const& charge : consumedCharges)
         {
             index = 0;
-            stmt = CharacterDatabase.GetPreparedStatement(StatementInfo::ChargesInsertStatement);
-            StatementInfo::SetIdentifier(stmt, index++, _owner);
-            StatementInfo::WriteCharge(stmt, index, categoryId, charge);
-            trans->Append(stmt);
+            chargeStmt = CharacterDatabase.AddPreparedStatementRow(chargeStmt, StatementInfo::ChargesInsertStatement);
+            StatementInfo::SetIdentifier(chargeStmt, index++, _owner);
+            StatementInfo::WriteCharge(chargeStmt, index, categoryId, charge);
         }
     }
+
+    if (chargeStmt)
+        trans->Append(chargeStmt);
 }
 
 void SpellHistory::Update()
 {
     TimePoint now = time_point_cast<Duration>(GameTime::GetTime<Clock>());
+    if (now < _nextExpiry)
+        return;
+
+    // sweep everything that expired at once and remember when the next entry does
+    TimePoint nextExpiry = TimePoint::max();
     for (auto itr = _categoryCooldowns.begin(); itr != _categoryCooldowns.end();)
     {
-        if (itr->second->CategoryEnd < now)
+        CooldownEntry const* cooldown = GetCategoryCooldown(itr->first);
+        if (!cooldown || cooldown->CategoryEnd < now)
             itr = _categoryCooldowns.erase(itr);
         else
+        {
+            nextExpiry = std::min(nextExpiry, cooldown->CategoryEnd);
             ++itr;
+        }
     }
 
     for (auto itr = _spellCooldowns.begin(); itr != _spellCooldowns.end();)
@@ -234,12 +255,34 @@ void SpellHistory::Update()
         if (itr->second.CooldownEnd < now)
             itr = EraseCooldown(itr);
         else
+        {
+            nextExpiry = std::min(nextExpiry, itr->second.CooldownEnd);
             ++itr;
+        }
     }
 
     for (auto& [chargeCategoryId, chargeRefreshTimes] : _categoryCharges)
-        while (!chargeRefreshTimes.empty() && chargeRefreshTimes.front().RechargeEnd <= now)
-            chargeRefreshTimes.pop_front();
+    {
+        auto firstPending = std::ranges::find_if(chargeRefreshTimes, [now](ChargeEntry const& charge) { return charge.RechargeEnd > now; });
+        chargeRefreshTimes.erase(chargeRefreshTimes.begin(), firstPending);
+        if (!chargeRefreshTimes.empty())
+            nextExpiry = std::min(nextExpiry, chargeRefreshTimes.front().RechargeEnd);
+    }
+
+    _nextExpiry = nextExpiry;
+}
+
+SpellHistory::CooldownEntry const* SpellHistory::GetCategoryCooldown(uint32 categoryId) const
+{
+    auto catItr = _categoryCooldowns.find(categoryId);
+    if (catItr == _categoryCooldowns.end())
+        return nullptr;
+
+    auto itr = _spellCooldowns.find(catItr->second);
+    if (itr == _spellCooldowns.end())
+        return nullptr;
+
+    return &itr->second;
 }
 
 void SpellHistory::HandleCooldowns(SpellInfo const* spellInfo, Item const* item, Spell* spell /*= nullptr*/)
@@ -556,12 +599,13 @@ void SpellHistory::SendCooldownEvent(SpellInfo const* spellInfo, uint32 itemId /
         GetCooldownDurations(spellInfo, itemId, nullptr, &category, nullptr);
 
         auto categoryItr = _categoryCooldowns.find(category);
-        if (categoryItr != _categoryCooldowns.end() && categoryItr->second->SpellId != spellInfo->Id)
+        if (categoryItr != _categoryCooldowns.end() && categoryItr->second != spellInfo->Id)
         {
-            player->SendDirectMessage(WorldPackets::Spells::CooldownEvent(player != _owner, categoryItr->second->SpellId).Write());
+            uint32 categorySpellId = categoryItr->second;
+            player->SendDirectMessage(WorldPackets::Spells::CooldownEvent(player != _owner, categorySpellId).Write());
 
             if (startCooldown)
-                StartCooldown(sSpellMgr->AssertSpellInfo(categoryItr->second->SpellId, _owner->GetMap()->GetDifficultyID()), itemId, spell);
+                StartCooldown(sSpellMgr->AssertSpellInfo(categorySpellId, _owner->GetMap()->GetDifficultyID()), itemId, spell);
         }
 
         player->SendDirectMessage(WorldPackets::Spells::CooldownEvent(player != _owner, spellInfo->Id).Write());
@@ -586,7 +630,9 @@ void SpellHistory::AddCooldown(uint32 spellId, uint32 itemId, TimePoint cooldown
         cooldownEntry.OnHold = onHold;
 
         if (categoryId)
-            _categoryCooldowns[categoryId] = &cooldownEntry;
+            _categoryCooldowns[categoryId] = spellId;
+
+        ScheduleExpiry(std::min(cooldownEnd, categoryEnd));
     }
 }
 
@@ -615,6 +661,8 @@ void SpellHistory::ModifySpellCooldown(CooldownStorageType::iterator& itr, Durat
             itr->second.CooldownEnd = itr->second.CategoryEnd;
     }
 
+    ScheduleExpiry(std::min(itr->second.CooldownEnd, itr->second.CategoryEnd));
+
     if (Player* playerOwner = GetPlayerOwner())
     {
         WorldPackets::Spells::ModifyCooldown modifyCooldown;
@@ -627,6 +675,8 @@ void SpellHistory::ModifySpellCooldown(CooldownStorageType::iterator& itr, Durat
 
     if (itr->second.CooldownEnd <= now)
         itr = EraseCooldown(itr);
+    else
+        ++itr;
 }
 
 void SpellHistory::UpdateCooldownRecoveryRate(CooldownStorageType::iterator& itr, float modChange, bool apply)
@@ -644,6 +694,8 @@ void SpellHistory::UpdateCooldownRecoveryRate(CooldownStorageType::iterator& itr
     if (itr->second.CategoryId)
         itr->second.CategoryEnd = now + duration_cast<Duration>((itr->second.CategoryEnd - now) * modChange);
 
+    ScheduleExpiry(std::min(itr->second.CooldownEnd, itr->second.CategoryEnd));
+
     if (Player* playerOwner = GetPlayerOwner())
     {
         WorldPackets::Spells::UpdateCooldown updateCooldown;
@@ -742,11 +794,11 @@ SpellHistory::Duration SpellHistory::GetRemainingCooldown(SpellInfo const* spell
         end = itr->second.CooldownEnd;
     else
     {
-        auto catItr = _categoryCooldowns.find(spellInfo->GetCategory());
-        if (catItr == _categoryCooldowns.end())
+        CooldownEntry const* categoryCooldown = GetCategoryCooldown(spellInfo->GetCategory());
+        if (!categoryCooldown)
             return Duration::zero();
 
-        end = catItr->second->CategoryEnd;
+        end = categoryCooldown->CategoryEnd;
     }
 
     TimePoint now = time_point_cast<Duration>(GameTime::GetTime<Clock>());
@@ -759,11 +811,11 @@ SpellHistory::Duration SpellHistory::GetRemainingCooldown(SpellInfo const* spell
 
 SpellHistory::Duration SpellHistory::GetRemainingCategoryCooldown(uint32 categoryId) const
 {
-    auto catItr = _categoryCooldowns.find(categoryId);
-    if (catItr == _categoryCooldowns.end())
+    CooldownEntry const* categoryCooldown = GetCategoryCooldown(categoryId);
+    if (!categoryCooldown)
         return Duration::zero();
 
-    TimePoint end = catItr->second->CategoryEnd;
+    TimePoint end = categoryCooldown->CategoryEnd;
 
     TimePoint now = time_point_cast<Duration>(GameTime::GetTime<Clock>());
     if (end < now)
@@ -861,13 +913,14 @@ void SpellHistory::ConsumeCharge(uint32 chargeCategoryId)
         return;
 
     TimePoint recoveryStart;
-    std::deque<ChargeEntry>& charges = _categoryCharges[chargeCategoryId];
+    ChargeEntryCollection& charges = _categoryCharges[chargeCategoryId];
     if (charges.empty())
         recoveryStart = time_point_cast<Duration>(GameTime::GetTime<Clock>());
     else
         recoveryStart = charges.back().RechargeEnd;
 
     charges.emplace_back(recoveryStart, Milliseconds(chargeRecovery));
+    ScheduleExpiry(charges.front().RechargeEnd);
 }
 
 void SpellHistory::ModifyChargeRecoveryTime(uint32 chargeCategoryId, Duration cooldownMod)
@@ -889,7 +942,10 @@ void SpellHistory::ModifyChargeRecoveryTime(uint32 chargeCategoryId, Duration co
     }
 
     while (!itr->second.empty() && itr->second.front().RechargeEnd < now)
-        itr->second.pop_front();
+        itr->second.erase(itr->second.begin());
+
+    if (!itr->second.empty())
+        ScheduleExpiry(itr->second.front().RechargeEnd);
 
     SendSetSpellCharges(chargeCategoryId, itr->second);
 }
@@ -922,6 +978,8 @@ void SpellHistory::UpdateChargeRecoveryRate(uint32 chargeCategoryId, float modCh
         prevEnd = chargeItr->RechargeEnd;
     }
 
+    ScheduleExpiry(itr->second.front().RechargeEnd);
+
     if (Player* playerOwner = GetPlayerOwner())
     {
         WorldPackets::Spells::UpdateChargeCategoryCooldown updateChargeCategoryCooldown;
@@ -1077,7 +1135,7 @@ void SpellHistory::ResumeCooldowns()
 
     Duration pausedDuration = time_point_cast<Duration>(GameTime::GetTime<Clock>()) - *_pauseTime;
 
-    for (auto itr = _spellCooldowns.begin(); itr != _spellCooldowns.end();)
+    for (auto itr = _spellCooldowns.begin(); itr != _spellCooldowns.end(); ++itr)
         itr->second.CooldownEnd += pausedDuration;
 
     for (auto& [chargeCategoryId, chargeRefreshTimes] : _categoryCharges)
@@ -1086,6 +1144,7 @@ void SpellHistory::ResumeCooldowns()
 
     _pauseTime.reset();
 
+    _nextExpiry = TimePoint::min();
     Update();
 }
 
@@ -1190,6 +1249,8 @@ void SpellHistory::RestoreCooldownStateAfterDuel()
                 itr->second = cooldown;
         }
 
+        _nextExpiry = TimePoint::min();
+
         // update the client: restore old cooldowns
         WorldPackets::Spells::SpellCooldown spellCooldown;
         spellCooldown.Caster = _owner->GetGUID();
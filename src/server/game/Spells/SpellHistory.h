@@ -24,8 +24,9 @@
 #include "GameTime.h"
 #include "Optional.h"
 #include "SharedDefines.h"
-#include <deque>
-#include <unordered_map>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/small_vector.hpp>
+#include <algorithm>
 #include <vector>
 
 class Item;
@@ -82,11 +83,12 @@ public:
         TimePoint RechargeEnd;
     };
 
-    using ChargeEntryCollection = std::deque<ChargeEntry>;
-    using CooldownStorageType = std::unordered_map<uint32 /*spellId*/, CooldownEntry>;
-    using CategoryCooldownStorageType = std::unordered_map<uint32 /*categoryId*/, CooldownEntry*>;
-    using ChargeStorageType = std::unordered_map<uint32 /*categoryId*/, ChargeEntryCollection>;
-    using GlobalCooldownStorageType = std::unordered_map<uint32 /*categoryId*/, TimePoint>;
+    // sorted vectors, a unit rarely has more than a few dozen cooldowns and they are looked up on every cast
+    using ChargeEntryCollection = boost::container::small_vector<ChargeEntry, 3>;
+    using CooldownStorageType = boost::container::flat_map<uint32 /*spellId*/, CooldownEntry>;
+    using CategoryCooldownStorageType = boost::container::flat_map<uint32 /*categoryId*/, uint32 /*spellId*/>;
+    using ChargeStorageType = boost::container::flat_map<uint32 /*categoryId*/, ChargeEntryCollection>;
+    using GlobalCooldownStorageType = boost::container::flat_map<uint32 /*categoryId*/, TimePoint>;
 
     explicit SpellHistory(Unit* owner);
     ~SpellHistory();
@@ -220,6 +222,12 @@ private:
         return _spellCooldowns.erase(itr);
     }
 
+    // cooldown entry holding the cooldown of categoryId, nullptr if the category is not on cooldown
+    CooldownEntry const* GetCategoryCooldown(uint32 categoryId) const;
+
+    // Update only sweeps the containers once something may have expired
+    void ScheduleExpiry(TimePoint end) { _nextExpiry = std::min(_nextExpiry, end); }
+
     void SendSetSpellCharges(uint32 chargeCategoryId, ChargeEntryCollection const& chargeCollection) const;
 
     Unit* _owner;
@@ -230,6 +238,7 @@ private:
     ChargeStorageType _categoryCharges;
     GlobalCooldownStorageType _globalCooldowns;
     Optional<TimePoint> _pauseTime;
+    TimePoint _nextExpiry;
 
     template<class T>
     struct PersistenceHelper { };
@@ -23,6 +23,7 @@
 #include "DB2HotfixGenerator.h"
 #include "DB2Stores.h"
 #include "DatabaseEnv.h"
+#include "DifficultyFallbackTable.h"
 #include "LanguageMgr.h"
 #include "Log.h"
 #include "MapUtils.h"
@@ -63,6 +64,26 @@ namespace
         >
     > mSpellInfoMap;
 
+    // mSpellInfoMap with difficulty fallbacks resolved, rebuilt whenever spells were added to it
+    DifficultyFallbackTable<SpellInfo> mSpellInfoLookup;
+
+    void BuildSpellInfoLookup()
+    {
+        std::vector<std::tuple<uint32, Difficulty, SpellInfo const*>> spellInfos;
+        spellInfos.reserve(mSpellInfoMap.size());
+        for (SpellInfo const& spellInfo : mSpellInfoMap)
+            spellInfos.emplace_back(spellInfo.Id, spellInfo.Difficulty, &spellInfo);
+
+        std::ranges::sort(spellInfos, {}, [](auto const& spellInfo) { return std::make_pair(std::get<0>(spellInfo), std::get<1>(spellInfo)); });
+
+        mSpellInfoLookup.Build(spellInfos, [](Difficulty difficulty) -> Optional<Difficulty>
+        {
+            if (DifficultyEntry const* difficultyEntry = sDifficultyStore.LookupEntry(difficulty))
+                return Difficulty(difficultyEntry->FallbackDifficultyID);
+            return {};
+        });
+    }
+
     class ServersideSpellName
     {
     public:
@@ -99,6 +120,7 @@ namespace
     std::vector<ServersideSpellName> mServersideSpellNames;
 
     std::unordered_map<std::pair<uint32, Difficulty>, SpellProcEntry> mSpellProcMap;
+    uint32 mSpellProcGeneration = 0;
     std::unordered_map<int32, CreatureImmunities> mCreatureImmunities;
 }
 
@@ -521,6 +543,11 @@ SpellProcEntry const* SpellMgr::GetSpellProcEntry(SpellInfo const* spellInfo) co
     return nullptr;
 }
 
+uint32 SpellMgr::GetSpellProcGeneration() const
+{
+    return mSpellProcGeneration;
+}
+
 bool SpellMgr::CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo)
 {
     // proc type doesn't match
@@ -691,6 +718,9 @@ CreatureImmunities const* SpellMgr::GetCreatureImmunities(int32 creatureImmuniti
 
 SpellInfo const* SpellMgr::GetSpellInfo(uint32 spellId, Difficulty difficulty) const
 {
+    if (!mSpellInfoLookup.IsEmpty())
+        return mSpellInfoLookup.Find(spellId, difficulty);
+
     auto itr = mSpellInfoMap.find(boost::make_tuple(spellId, difficulty));
     if (itr != mSpellInfoMap.end())
         return &*itr;
@@ -1348,6 +1378,7 @@ void SpellMgr::LoadSpellGroupStackRules()
 
     mSpellGroupStack.clear();                                  // need for reload case
     mSpellSameEffectStack.clear();
+    Unit::InvalidateAllAuraModifierCaches();
 
     std::vector<uint32> sameEffectGroups;
 
@@ -1499,6 +1530,7 @@ void SpellMgr::LoadSpellProcs()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcMap.clear();                             // need for reload case
+    ++mSpellProcGeneration;                            // entries cached by auras are invalid now
 
     //                                                     0           1                2                 3                 4                 5                 6
     QueryResult result = WorldDatabase.Query("SELECT SpellId, SchoolMask, SpellFamilyName, SpellFamilyMask0, SpellFamilyMask1, SpellFamilyMask2, SpellFamilyMask3, "
@@ -2712,11 +2744,14 @@ void SpellMgr::LoadSpellInfoStore()
         mSpellInfoMap.emplace(spellNameEntry, key.second, data);
     }
 
+    BuildSpellInfoLookup();
+
     TC_LOG_INFO("server.loading", ">> Loaded SpellInfo store in {} ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
 void SpellMgr::UnloadSpellInfoStore()
 {
+    mSpellInfoLookup.Clear();
     mSpellInfoMap.clear();
     mServersideSpellNames.clear();
 }
@@ -2969,6 +3004,8 @@ void SpellMgr::LoadSpellInfoServerside()
         } while (spellsResult->NextRow());
     }
 
+    BuildSpellInfoLookup();
+
     TC_LOG_INFO("server.loading", ">> Loaded {} serverside spells {} ms", mServersideSpellNames.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -702,6 +702,8 @@ class TC_GAME_API SpellMgr
 
         // Spell proc table
         SpellProcEntry const* GetSpellProcEntry(SpellInfo const* spellInfo) const;
+        // Changes whenever the proc table is reloaded
+        uint32 GetSpellProcGeneration() const;
         static bool CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo);
 
         // Spell threat table
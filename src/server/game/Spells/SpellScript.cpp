@@ -346,6 +346,42 @@ void SpellScript::_InitHit()
     m_hitPreventDefaultEffectMask = 0;
 }
 
+uint64 SpellScript::_GetHookMask() const
+{
+    static_assert(SPELL_SCRIPT_HOOK_EMPOWER_COMPLETED < 64);
+
+    // OnPrecast and CalcCastTime are virtual functions, overriding them cannot be detected
+    uint64 mask = (UI64LIT(1) << SPELL_SCRIPT_HOOK_ON_PRECAST) | (UI64LIT(1) << SPELL_SCRIPT_HOOK_CALC_CAST_TIME);
+    auto addHook = [&mask](SpellScriptHookType hookType, auto const& hookList)
+    {
+        if (!hookList.empty())
+            mask |= UI64LIT(1) << hookType;
+    };
+
+    addHook(SPELL_SCRIPT_HOOK_EFFECT_LAUNCH, OnEffectLaunch);
+    addHook(SPELL_SCRIPT_HOOK_EFFECT_LAUNCH_TARGET, OnEffectLaunchTarget);
+    addHook(SPELL_SCRIPT_HOOK_EFFECT_HIT, OnEffectHit);
+    addHook(SPELL_SCRIPT_HOOK_EFFECT_HIT_TARGET, OnEffectHitTarget);
+    addHook(SPELL_SCRIPT_HOOK_EFFECT_SUCCESSFUL_DISPEL, OnEffectSuccessfulDispel);
+    addHook(SPELL_SCRIPT_HOOK_BEFORE_HIT, BeforeHit);
+    addHook(SPELL_SCRIPT_HOOK_HIT, OnHit);
+    addHook(SPELL_SCRIPT_HOOK_AFTER_HIT, AfterHit);
+    addHook(SPELL_SCRIPT_HOOK_OBJECT_AREA_TARGET_SELECT, OnObjectAreaTargetSelect);
+    addHook(SPELL_SCRIPT_HOOK_OBJECT_TARGET_SELECT, OnObjectTargetSelect);
+    addHook(SPELL_SCRIPT_HOOK_DESTINATION_TARGET_SELECT, OnDestinationTargetSelect);
+    addHook(SPELL_SCRIPT_HOOK_CHECK_CAST, OnCheckCast);
+    addHook(SPELL_SCRIPT_HOOK_BEFORE_CAST, BeforeCast);
+    addHook(SPELL_SCRIPT_HOOK_ON_CAST, OnCast);
+    addHook(SPELL_SCRIPT_HOOK_ON_RESIST_ABSORB_CALCULATION, OnCalculateResistAbsorb);
+    addHook(SPELL_SCRIPT_HOOK_AFTER_CAST, AfterCast);
+    addHook(SPELL_SCRIPT_HOOK_CALC_CRIT_CHANCE, OnCalcCritChance);
+    addHook(SPELL_SCRIPT_HOOK_CALC_DAMAGE, CalcDamage);
+    addHook(SPELL_SCRIPT_HOOK_CALC_HEALING, CalcHealing);
+    addHook(SPELL_SCRIPT_HOOK_EMPOWER_STAGE_COMPLETED, OnEmpowerStageCompleted);
+    addHook(SPELL_SCRIPT_HOOK_EMPOWER_COMPLETED, OnEmpowerCompleted);
+    return mask;
+}
+
 void SpellScript::_PrepareScriptCall(SpellScriptHookType hookType)
 {
     m_currentScriptState = hookType;
@@ -998,6 +1034,51 @@ bool AuraScript::_IsDefaultActionPrevented() const
     }
 }
 
+uint64 AuraScript::_GetHookMask() const
+{
+    static_assert(AURA_SCRIPT_HOOK_AFTER_PROC < 64);
+
+    uint64 mask = 0;
+    auto addHook = [&mask](AuraScriptHookType hookType, auto const& hookList)
+    {
+        if (!hookList.empty())
+            mask |= UI64LIT(1) << hookType;
+    };
+
+    addHook(AURA_SCRIPT_HOOK_EFFECT_APPLY, OnEffectApply);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_APPLY, AfterEffectApply);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_REMOVE, OnEffectRemove);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_REMOVE, AfterEffectRemove);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_PERIODIC, OnEffectPeriodic);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_UPDATE_PERIODIC, OnEffectUpdatePeriodic);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_CALC_AMOUNT, DoEffectCalcAmount);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_CALC_PERIODIC, DoEffectCalcPeriodic);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_CALC_SPELLMOD, DoEffectCalcSpellMod);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_CALC_CRIT_CHANCE, DoEffectCalcCritChance);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_CALC_DAMAGE_AND_HEALING, DoEffectCalcDamageAndHealing);
+    // damage and heal absorbs share their hook types
+    addHook(AURA_SCRIPT_HOOK_EFFECT_ABSORB, OnEffectAbsorb);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_ABSORB, OnEffectAbsorbHeal);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_ABSORB, AfterEffectAbsorb);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_ABSORB, AfterEffectAbsorbHeal);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_MANASHIELD, OnEffectManaShield);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_MANASHIELD, AfterEffectManaShield);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_SPLIT, OnEffectSplit);
+    addHook(AURA_SCRIPT_HOOK_CHECK_AREA_TARGET, DoCheckAreaTarget);
+    addHook(AURA_SCRIPT_HOOK_DISPEL, OnDispel);
+    addHook(AURA_SCRIPT_HOOK_AFTER_DISPEL, AfterDispel);
+    addHook(AURA_SCRIPT_HOOK_ON_HEARTBEAT, OnHeartbeat);
+    addHook(AURA_SCRIPT_HOOK_ENTER_LEAVE_COMBAT, OnEnterLeaveCombat);
+    addHook(AURA_SCRIPT_HOOK_CHECK_PROC, DoCheckProc);
+    addHook(AURA_SCRIPT_HOOK_CHECK_EFFECT_PROC, DoCheckEffectProc);
+    addHook(AURA_SCRIPT_HOOK_PREPARE_PROC, DoPrepareProc);
+    addHook(AURA_SCRIPT_HOOK_PROC, OnProc);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_PROC, OnEffectProc);
+    addHook(AURA_SCRIPT_HOOK_EFFECT_AFTER_PROC, AfterEffectProc);
+    addHook(AURA_SCRIPT_HOOK_AFTER_PROC, AfterProc);
+    return mask;
+}
+
 void AuraScript::PreventDefaultAction()
 {
     switch (m_currentScriptState)
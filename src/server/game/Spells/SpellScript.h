@@ -717,6 +717,7 @@ public:
     bool _Validate(SpellInfo const* entry) override;
     bool _Load(Spell* spell);
     void _InitHit();
+    uint64 _GetHookMask() const;
     bool _IsEffectPrevented(SpellEffIndex effIndex) const { return (m_hitPreventEffectMask & (1 << effIndex)) != 0; }
     bool _IsDefaultEffectPrevented(SpellEffIndex effIndex) const { return (m_hitPreventDefaultEffectMask & (1 << effIndex)) != 0; }
     void _PrepareScriptCall(SpellScriptHookType hookType);
@@ -1624,6 +1625,7 @@ public:
     void _PrepareScriptCall(AuraScriptHookType hookType, AuraApplication const* aurApp = nullptr);
     void _FinishScriptCall();
     bool _IsDefaultActionPrevented() const;
+    uint64 _GetHookMask() const;
 private:
     Aura* m_aura;
     AuraApplication const* m_auraApplication;
@@ -0,0 +1,158 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupCache.h"
+#include "CryptoHash.h"
+#include "Log.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+constexpr uint32 StartupCacheMagic = 0x43534354; // "TCSC"
+constexpr uint32 StartupCacheVersion = 1;
+
+using Checksum = Trinity::Crypto::SHA1::Digest;
+}
+
+StartupCache::StartupCache(std::string path, std::string_view key) : _path(std::move(path)),
+    _key(Trinity::Crypto::SHA1::GetDigestOf(key))
+{
+}
+
+StartupCache::~StartupCache() = default;
+
+bool StartupCache::Open()
+{
+    try
+    {
+        boost::interprocess::file_mapping file(_path.c_str(), boost::interprocess::read_only);
+        _region = std::make_unique<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const& e)
+    {
+        TC_LOG_INFO("server.loading", "Startup cache {} could not be opened ({}), stores are loaded from the database", _path, e.what());
+        return false;
+    }
+
+    StartupCacheReader reader(std::span(static_cast<uint8 const*>(_region->get_address()), _region->get_size()));
+    uint32 magic = 0, version = 0, sectionCount = 0;
+    Checksum key = { };
+    bool valid = reader.Read(magic) && magic == StartupCacheMagic
+        && reader.Read(version) && version == StartupCacheVersion
+        && reader.ReadBytes(key);
+
+    if (!valid || key != _key)
+    {
+        TC_LOG_INFO("server.loading", "Startup cache {} was written for a different database or core revision, ignoring it", _path);
+        _region.reset();
+        return false;
+    }
+
+    // payloads are not read here, they are only checked when their section is requested
+    valid = reader.Read(sectionCount);
+    for (uint32 i = 0; i < sectionCount && valid; ++i)
+    {
+        std::string name;
+        uint64 size = 0;
+        Section section;
+        valid = reader.Read(name) && reader.Read(size) && reader.ReadBytes(section.Checksum) && reader.ReadView(size, section.Data);
+        if (valid)
+            _sections.insert_or_assign(std::move(name), section);
+    }
+
+    if (!valid || !reader.IsComplete())
+    {
+        TC_LOG_ERROR("server.loading", "Startup cache {} is damaged, stores are loaded from the database", _path);
+        _sections.clear();
+        _region.reset();
+        return false;
+    }
+
+    return true;
+}
+
+Optional<StartupCacheReader> StartupCache::GetSection(std::string_view name) const
+{
+    auto itr = _sections.find(name);
+    if (itr == _sections.end())
+        return {};
+
+    if (Trinity::Crypto::SHA1::GetDigestOf(itr->second.Data.data(), itr->second.Data.size()) != itr->second.Checksum)
+    {
+        TC_LOG_ERROR("server.loading", "Startup cache {}: section {} does not match its checksum, loading it from the database", _path, name);
+        return {};
+    }
+
+    return StartupCacheReader(itr->second.Data);
+}
+
+StartupCacheWriter& StartupCache::AddSection(std::string name)
+{
+    StartupCacheWriter& writer = _newSections[std::move(name)];
+    writer = StartupCacheWriter();
+    return writer;
+}
+
+bool StartupCache::Save()
+{
+    std::map<std::string, Section, std::less<>> sections = _sections;
+    for (auto const& [name, writer] : _newSections)
+        sections.insert_or_assign(name, Section{ .Data = writer.GetData(), .Checksum = Trinity::Crypto::SHA1::GetDigestOf(writer.GetData().data(), writer.GetData().size()) });
+
+    StartupCacheWriter file;
+    file.Write(StartupCacheMagic);
+    file.Write(StartupCacheVersion);
+    file.WriteBytes(_key);
+
+    file.Write(uint32(sections.size()));
+    for (auto const& [name, section] : sections)
+    {
+        file.Write(std::string_view(name));
+        file.Write(uint64(section.Data.size()));
+        file.WriteBytes(section.Checksum);
+        file.WriteBytes(section.Data);
+    }
+
+    // everything was copied out of the mapped file, it can be replaced now
+    _sections.clear();
+    _region.reset();
+
+    std::string tempPath = _path + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<char const*>(file.GetData().data()), file.GetData().size());
+        if (!out)
+        {
+            TC_LOG_ERROR("server.loading", "Startup cache {} could not be written", tempPath);
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    std::remove(_path.c_str());
+    if (std::rename(tempPath.c_str(), _path.c_str()) != 0)
+    {
+        TC_LOG_ERROR("server.loading", "Startup cache {} could not be replaced by {}", _path, tempPath);
+        return false;
+    }
+
+    TC_LOG_INFO("server.loading", "Startup cache {} saved ({} sections, {} bytes)", _path, sections.size(), file.GetData().size());
+    return true;
+}
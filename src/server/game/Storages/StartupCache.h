@@ -0,0 +1,198 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_STARTUP_CACHE_H
+#define TRINITYCORE_STARTUP_CACHE_H
+
+#include "Define.h"
+#include "Optional.h"
+#include <array>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace boost::interprocess
+{
+class mapped_region;
+}
+
+class StartupCacheWriter
+{
+public:
+    template<typename T> requires std::is_arithmetic_v<T>
+    void Write(T value)
+    {
+        uint8 const* bytes = reinterpret_cast<uint8 const*>(&value);
+        _data.insert(_data.end(), bytes, bytes + sizeof(T));
+    }
+
+    void Write(std::string_view value)
+    {
+        Write(uint32(value.length()));
+        _data.insert(_data.end(), value.begin(), value.end());
+    }
+
+    void Write(std::vector<std::string> const& values)
+    {
+        Write(uint32(values.size()));
+        for (std::string const& value : values)
+            Write(std::string_view(value));
+    }
+
+    void WriteBytes(std::span<uint8 const> bytes)
+    {
+        _data.insert(_data.end(), bytes.begin(), bytes.end());
+    }
+
+    std::vector<uint8> const& GetData() const { return _data; }
+
+private:
+    std::vector<uint8> _data;
+};
+
+// Reads values back in the order they were written, every read past the end of the section fails and marks the reader invalid
+class StartupCacheReader
+{
+public:
+    explicit StartupCacheReader(std::span<uint8 const> data) : _data(data), _position(0), _valid(true) { }
+
+    template<typename T> requires std::is_arithmetic_v<T>
+    bool Read(T& value)
+    {
+        if (!CanRead(sizeof(T)))
+            return false;
+
+        std::memcpy(&value, _data.data() + _position, sizeof(T));
+        _position += sizeof(T);
+        return true;
+    }
+
+    bool Read(std::string& value)
+    {
+        uint32 length = 0;
+        if (!Read(length) || !CanRead(length))
+            return false;
+
+        value.assign(reinterpret_cast<char const*>(_data.data() + _position), length);
+        _position += length;
+        return true;
+    }
+
+    bool Read(std::vector<std::string>& values)
+    {
+        uint32 count = 0;
+        if (!Read(count) || !CanRead(count))    // every string takes at least one byte of length
+            return false;
+
+        values.resize(count);
+        for (std::string& value : values)
+            if (!Read(value))
+                return false;
+
+        return true;
+    }
+
+    bool ReadBytes(std::span<uint8> bytes)
+    {
+        if (!CanRead(bytes.size()))
+            return false;
+
+        std::memcpy(bytes.data(), _data.data() + _position, bytes.size());
+        _position += bytes.size();
+        return true;
+    }
+
+    // Returns the next size bytes without copying them, the view is only valid as long as the underlying data
+    bool ReadView(std::size_t size, std::span<uint8 const>& view)
+    {
+        if (!CanRead(size))
+            return false;
+
+        view = _data.subspan(_position, size);
+        _position += size;
+        return true;
+    }
+
+    // True if every read succeeded and the whole section was consumed
+    bool IsComplete() const { return _valid && _position == _data.size(); }
+
+private:
+    bool CanRead(std::size_t size)
+    {
+        if (_valid && _data.size() - _position >= size)
+            return true;
+
+        _valid = false;
+        return false;
+    }
+
+    std::span<uint8 const> _data;
+    std::size_t _position;
+    bool _valid;
+};
+
+/*
+ * Binary image of stores derived from the world database, written after a full load and memory mapped
+ * on the next startup. The file is only used when its key matches, the key is built from the applied
+ * database updates and the core revision; every section carries its own checksum.
+ */
+class TC_GAME_API StartupCache
+{
+public:
+    StartupCache(std::string path, std::string_view key);
+    ~StartupCache();
+
+    StartupCache(StartupCache const&) = delete;
+    StartupCache(StartupCache&&) = delete;
+    StartupCache& operator=(StartupCache const&) = delete;
+    StartupCache& operator=(StartupCache&&) = delete;
+
+    // Maps the file, returns false if it does not exist, is damaged or was written for a different key
+    bool Open();
+
+    // Reader over a stored section, nothing if the section is missing or its checksum does not match
+    Optional<StartupCacheReader> GetSection(std::string_view name) const;
+
+    // Starts a section of the next file, replacing any section added before with the same name
+    StartupCacheWriter& AddSection(std::string name);
+
+    bool HasNewSections() const { return !_newSections.empty(); }
+
+    // Writes every added section along with the still valid ones of the opened file, which is released.
+    // The previous file is replaced only once the new one is complete
+    bool Save();
+
+private:
+    struct Section
+    {
+        std::span<uint8 const> Data;
+        std::array<uint8, 20> Checksum;
+    };
+
+    std::string _path;
+    std::array<uint8, 20> _key;
+    std::unique_ptr<boost::interprocess::mapped_region> _region;
+    std::map<std::string, Section, std::less<>> _sections;
+    std::map<std::string, StartupCacheWriter> _newSections;
+};
+
+#endif // TRINITYCORE_STARTUP_CACHE_H
@@ -32,40 +32,115 @@ WhoListStorageMgr* WhoListStorageMgr::instance()
     return &instance;
 }
 
+namespace
+{
+bool NormalizeName(std::string const& name, std::wstring& wideName)
+{
+    if (!Utf8toWStr(name, wideName))
+        return false;
+
+    wstrToLower(wideName);
+    return true;
+}
+}
+
 void WhoListStorageMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
+    ++_updateCounter;
     _whoListStorage.reserve(sWorld->GetPlayerCount()+1);
 
     HashMapHolder<Player>::MapType const& m = ObjectAccessor::GetPlayers();
     for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
     {
-        if (!itr->second->FindMap() || itr->second->GetSession()->PlayerLoading())
+        Player* player = itr->second;
+        if (!player->FindMap() || player->GetSession()->PlayerLoading())
             continue;
 
-        std::string playerName = itr->second->GetName();
-        std::wstring widePlayerName;
-        if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+        std::string const& playerName = player->GetName();
+        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
+        ObjectGuid guildGuid;
+        if (Guild* guild = player->GetGuild())
+            guildGuid = guild->GetGUID();
 
-        wstrToLower(widePlayerName);
+        auto [indexItr, inserted] = _whoListIndex.try_emplace(player->GetGUID(), uint32(_whoListStorage.size()));
+        if (inserted)
+        {
+            std::wstring widePlayerName;
+            std::wstring wideGuildName;
+            if (!NormalizeName(playerName, widePlayerName) || !NormalizeName(guildName, wideGuildName))
+            {
+                _whoListIndex.erase(indexItr);
+                continue;
+            }
 
-        std::string guildName = sGuildMgr->GetGuildNameById(itr->second->GetGuildId());
-        std::wstring wideGuildName;
-        if (!Utf8toWStr(guildName, wideGuildName))
+            _whoListStorage.emplace_back(player->GetGUID(), player->GetTeam(), player->GetSession()->GetSecurity(), player->GetLevel(),
+                player->GetClass(), player->GetRace(), player->GetZoneId(), player->GetNativeGender(), player->IsVisible(),
+                player->IsGameMaster(), widePlayerName, wideGuildName, playerName, guildName, guildGuid);
+            _whoListStorage.back()._updateCounter = _updateCounter;
             continue;
+        }
 
-        wstrToLower(wideGuildName);
+        // entries that aren't refreshed are removed below
+        WhoListPlayerInfo& info = _whoListStorage[indexItr->second];
+        if (info._playerName != playerName)
+        {
+            if (!NormalizeName(playerName, info._widePlayerName))
+                continue;
 
-        Guild* guild = itr->second->GetGuild();
-        ObjectGuid guildGuid;
+            info._playerName = playerName;
+        }
 
-        if (guild)
-            guildGuid = guild->GetGUID();
+        if (info._guildName != guildName)
+        {
+            if (!NormalizeName(guildName, info._wideGuildName))
+                continue;
+
+            info._guildName = std::move(guildName);
+        }
 
-        _whoListStorage.emplace_back(itr->second->GetGUID(), itr->second->GetTeam(), itr->second->GetSession()->GetSecurity(), itr->second->GetLevel(),
-            itr->second->GetClass(), itr->second->GetRace(), itr->second->GetZoneId(), itr->second->GetNativeGender(), itr->second->IsVisible(),
-            itr->second->IsGameMaster(), widePlayerName, wideGuildName, playerName, guildName, guildGuid);
+        info._team = player->GetTeam();
+        info._security = player->GetSession()->GetSecurity();
+        info._level = player->GetLevel();
+        info._class = player->GetClass();
+        info._race = player->GetRace();
+        info._zoneid = player->GetZoneId();
+        info._gender = player->GetNativeGender();
+        info._visible = player->IsVisible();
+        info._gamemaster = player->IsGameMaster();
+        info._guildguid = guildGuid;
+        info._updateCounter = _updateCounter;
     }
+
+    // remove players that logged out, the last entry takes their place
+    for (uint32 i = 0; i < _whoListStorage.size();)
+    {
+        if (_whoListStorage[i]._updateCounter == _updateCounter)
+        {
+            ++i;
+            continue;
+        }
+
+        _whoListIndex.erase(_whoListStorage[i]._guid);
+        if (i + 1 != _whoListStorage.size())
+        {
+            _whoListStorage[i] = std::move(_whoListStorage.back());
+            _whoListIndex[_whoListStorage[i]._guid] = i;
+        }
+        _whoListStorage.pop_back();
+    }
+
+    for (auto& [zoneId, players] : _zoneWhoList)
+        players.clear();
+
+    for (uint32 i = 0; i < _whoListStorage.size(); ++i)
+        _zoneWhoList[_whoListStorage[i]._zoneid].push_back(i);
+}
+
+std::span<uint32 const> WhoListStorageMgr::GetZoneWhoList(uint32 zoneId) const
+{
+    auto itr = _zoneWhoList.find(zoneId);
+    if (itr == _zoneWhoList.end())
+        return {};
+
+    return itr->second;
 }
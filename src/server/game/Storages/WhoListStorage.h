@@ -20,6 +20,8 @@
 
 #include "Common.h"
 #include "ObjectGuid.h"
+#include <span>
+#include <unordered_map>
 
 class WhoListPlayerInfo
 {
@@ -46,6 +48,8 @@ public:
     ObjectGuid GetGuildGuid() const { return _guildguid; }
 
 private:
+    friend class WhoListStorageMgr;
+
     ObjectGuid _guid;
     uint32 _team;
     AccountTypes _security;
@@ -61,6 +65,7 @@ private:
     std::string _playerName;
     std::string _guildName;
     ObjectGuid _guildguid;
+    uint32 _updateCounter = 0;
 };
 
 typedef std::vector<WhoListPlayerInfo> WhoListInfoVector;
@@ -81,9 +86,15 @@ public:
 
     void Update();
     WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
+    /// Indexes into GetWhoList() of the players in the zone
+    std::span<uint32 const> GetZoneWhoList(uint32 zoneId) const;
 
 protected:
+    // entries are kept between updates, player and guild names are only converted again when they changed
     WhoListInfoVector _whoListStorage;
+    std::unordered_map<ObjectGuid, uint32> _whoListIndex;
+    std::unordered_map<uint32, std::vector<uint32>> _zoneWhoList;
+    uint32 _updateCounter = 0;
 };
 
 #define sWhoListStorageMgr WhoListStorageMgr::instance()
@@ -192,21 +192,23 @@ uint32 CreatureTextMgr::SendChat(Creature* source, uint8 textGroup, WorldObject
 
     CreatureTextGroup const& textGroupContainer = itr->second;  //has all texts in the group
     CreatureTextRepeatIds repeatGroup = source->GetTextRepeatGroup(textGroup);//has all textIDs from the group that were already said
-    CreatureTextGroup tempGroup;//will use this to talk after sorting repeatGroup
+    std::vector<CreatureTextEntry const*> tempGroup;//will use this to talk after sorting repeatGroup
+    tempGroup.reserve(textGroupContainer.size());
 
     for (CreatureTextGroup::const_iterator giter = textGroupContainer.begin(); giter != textGroupContainer.end(); ++giter)
         if (std::find(repeatGroup.begin(), repeatGroup.end(), giter->id) == repeatGroup.end())
-            tempGroup.push_back(*giter);
+            tempGroup.push_back(&*giter);
 
     if (tempGroup.empty())
     {
         source->ClearTextRepeatGroup(textGroup);
-        tempGroup = textGroupContainer;
+        for (CreatureTextEntry const& text : textGroupContainer)
+            tempGroup.push_back(&text);
     }
 
-    auto iter = Trinity::Containers::SelectRandomWeightedContainerElement(tempGroup, [](CreatureTextEntry const& t) -> double
+    CreatureTextEntry const* iter = *Trinity::Containers::SelectRandomWeightedContainerElement(tempGroup, [](CreatureTextEntry const* t) -> double
     {
-        return t.probability;
+        return t->probability;
     });
 
     ChatMsg finalType = (msgType == CHAT_MSG_ADDON) ? iter->type : msgType;
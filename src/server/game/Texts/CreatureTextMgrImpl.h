@@ -112,20 +112,18 @@ void CreatureTextMgr::SendChatPacket(WorldObject* source, Builder const& builder
     {
         case TEXT_RANGE_AREA:
         {
+            // areas are part of a zone, only the players of that zone need to be checked
             uint32 areaId = source->GetAreaId();
-            Map::PlayerList const& players = source->GetMap()->GetPlayers();
-            for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
-                if (itr->GetSource()->GetAreaId() == areaId && (!team || Team(itr->GetSource()->GetEffectiveTeam()) == team) && (!gmOnly || itr->GetSource()->IsGameMaster()))
-                    localizer(itr->GetSource());
+            for (Player* player : source->GetMap()->GetZonePlayers(source->GetZoneId()))
+                if (player->GetAreaId() == areaId && (!team || Team(player->GetEffectiveTeam()) == team) && (!gmOnly || player->IsGameMaster()))
+                    localizer(player);
             return;
         }
         case TEXT_RANGE_ZONE:
         {
-            uint32 zoneId = source->GetZoneId();
-            Map::PlayerList const& players = source->GetMap()->GetPlayers();
-            for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
-                if (itr->GetSource()->GetZoneId() == zoneId && (!team || Team(itr->GetSource()->GetEffectiveTeam()) == team) && (!gmOnly || itr->GetSource()->IsGameMaster()))
-                    localizer(itr->GetSource());
+            for (Player* player : source->GetMap()->GetZonePlayers(source->GetZoneId()))
+                if ((!team || Team(player->GetEffectiveTeam()) == team) && (!gmOnly || player->IsGameMaster()))
+                    localizer(player);
             return;
         }
         case TEXT_RANGE_MAP:
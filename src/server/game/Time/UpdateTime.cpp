@@ -16,6 +16,15 @@
  */
 
 #include "UpdateTime.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "StringFormat.h"
+
+namespace
+{
+// zones listed per hitch, the rest only add up to the tick total
+constexpr std::size_t HitchZoneCount = 20;
+}
 
 // create instance
 WorldUpdateTime sWorldUpdateTime;
@@ -34,3 +43,25 @@ void UpdateTime::UpdateWithDiff(uint32 diff)
 {
     _lastUpdateTime = diff;
 }
+
+void WorldUpdateTime::SetHitchThreshold(uint32 threshold)
+{
+    _hitchThreshold = threshold;
+    sProfiler->SetZoneStatsEnabled(threshold != 0);
+}
+
+void WorldUpdateTime::RecordHitch(std::string_view tick, uint32 duration, std::vector<Trinity::ProfilerZoneStats> const& zones, std::string_view details) const
+{
+    std::string message = Trinity::StringFormat("Hitch: {} took {} ms", tick, duration);
+    if (!details.empty())
+    {
+        message += '\n';
+        message += details;
+    }
+
+    for (std::size_t i = 0; i < zones.size() && i < HitchZoneCount; ++i)
+        Trinity::StringFormatTo(std::back_inserter(message), "\n    {:.3f} ms in {} x {}",
+            std::chrono::duration<double, std::milli>(zones[i].Total).count(), zones[i].Count, zones[i].Name);
+
+    TC_LOG_WARN("server.hitch", "{}", message);
+}
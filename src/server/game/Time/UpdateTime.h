@@ -19,6 +19,13 @@
 #define __UPDATETIME_H
 
 #include "Define.h"
+#include <string_view>
+#include <vector>
+
+namespace Trinity
+{
+struct ProfilerZoneStats;
+}
 
 class TC_GAME_API UpdateTime
 {
@@ -37,7 +44,17 @@ class TC_GAME_API UpdateTime
 class TC_GAME_API WorldUpdateTime : public UpdateTime
 {
     public:
-        WorldUpdateTime() : UpdateTime() { }
+        WorldUpdateTime() : UpdateTime(), _hitchThreshold(0) { }
+
+        // World and map ticks taking at least threshold milliseconds are logged with their breakdown, 0 disables it
+        void SetHitchThreshold(uint32 threshold);
+        uint32 GetHitchThreshold() const { return _hitchThreshold; }
+
+        // Logs the slowest zones of a tick that went over the hitch threshold
+        void RecordHitch(std::string_view tick, uint32 duration, std::vector<Trinity::ProfilerZoneStats> const& zones, std::string_view details = {}) const;
+
+    private:
+        uint32 _hitchThreshold;
 };
 
 TC_GAME_API extern WorldUpdateTime sWorldUpdateTime;
@@ -26,6 +26,11 @@
 #include "SpellInfo.h"
 #include <sstream>
 
+namespace
+{
+std::size_t const MaxIdsPerDelete = 1000;
+}
+
 void CharacterDatabaseCleaner::CleanDatabase()
 {
     // config to disable
@@ -73,8 +78,7 @@ void CharacterDatabaseCleaner::CheckUnique(char const* column, char const* table
         return;
     }
 
-    bool found = false;
-    std::ostringstream ss;
+    std::vector<uint32> invalidIds;
     do
     {
         Field* fields = result->Fetch();
@@ -82,22 +86,22 @@ void CharacterDatabaseCleaner::CheckUnique(char const* column, char const* table
         uint32 id = fields[0].GetUInt32();
 
         if (!check(id))
-        {
-            if (!found)
-            {
-                ss << "DELETE FROM " << table << " WHERE " << column << " IN (";
-                found = true;
-            }
-            else
-                ss << ',';
-
-            ss << id;
-        }
+            invalidIds.push_back(id);
     }
     while (result->NextRow());
 
-    if (found)
+    // one statement per chunk of ids, a single huge statement would lock the table for a long time
+    for (std::size_t i = 0; i < invalidIds.size(); i += MaxIdsPerDelete)
     {
+        std::ostringstream ss;
+        ss << "DELETE FROM " << table << " WHERE " << column << " IN (";
+        for (std::size_t j = i; j < std::min(i + MaxIdsPerDelete, invalidIds.size()); ++j)
+        {
+            if (j != i)
+                ss << ',';
+
+            ss << invalidIds[j];
+        }
         ss << ')';
         CharacterDatabase.Execute(ss.str().c_str());
     }
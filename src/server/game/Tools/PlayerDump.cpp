@@ -18,13 +18,16 @@
 #include "PlayerDump.h"
 #include "AccountMgr.h"
 #include "CharacterCache.h"
+#include "CharacterEnumCache.h"
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "Log.h"
 #include "ObjectMgr.h"
+#include "Optional.h"
 #include "Player.h"
 #include "StringConvert.h"
 #include "World.h"
+#include <cctype>
 #include <fstream>
 #include <sstream>
 
@@ -150,27 +153,8 @@ DumpTable const DumpTables[] =
 
 uint32 const DUMP_TABLE_COUNT = std::extent<decltype(DumpTables)>::value;
 
-// helper class to dump sql queries to a printable string
-class StringTransaction
-{
-    public:
-        StringTransaction() : _buf() { }
-
-        void Append(char const* sql)
-        {
-            std::ostringstream oss;
-            oss << sql << '\n';
-            _buf += oss.str();
-        }
-
-        char const* GetBuffer() const
-        {
-            return _buf.c_str();
-        }
-
-    private:
-        std::string _buf;
-};
+// rows of one table are merged into inserts of about this size when a dump is loaded
+std::size_t const MaxBulkInsertLength = 256 * 1024;
 
 // dynamic data, loaded at startup
 struct TableField
@@ -426,81 +410,104 @@ void PlayerDump::InitializeTables()
 }
 
 // Low level functions
-inline bool FindColumn(TableStruct const& ts, std::string const& str, std::string const& column, std::string::size_type& s, std::string::size_type& e)
+// Values of one dump line, the line is split once and the changed values are put in when it is built again
+class DumpLineValues
 {
-    int32 columnIndex = GetColumnIndexByName(ts, column);
-    if (columnIndex == -1)
-        return false;
-
-    // array indices start at 0, compensate
-    ++columnIndex;
-
-    s = str.find("VALUES (");
-    if (s == std::string::npos)
-        return false;
-    s += 8;
-    e = s;
-
-    bool isQuoted = str[s] == '\'';
-    if (isQuoted)
-    {
-        ++s;
-        ++e;
-        // find first unescaped quote
-        do
+    public:
+        bool Parse(std::string const& line)
         {
-            e = str.find('\'', e);
-            if (e == std::string::npos)
+            _line = &line;
+            _spans.clear();
+            _replaced.clear();
+
+            std::string::size_type s = line.find("VALUES (");
+            if (s == std::string::npos)
                 return false;
-            if (str[e - 1] == '\\')
-                continue;
-            if (e + 1 < str.length() && str[e + 1] == '\'')
+            s += 8;
+
+            while (s < line.length())
             {
-                ++e;
-                continue;
+                std::string::size_type e;
+                if (line[s] == '\'')
+                {
+                    // find the closing quote, skipping backslash escapes and doubled quotes
+                    ++s;
+                    for (e = s; e < line.length(); ++e)
+                    {
+                        if (line[e] == '\\')
+                            ++e;
+                        else if (line[e] == '\'')
+                        {
+                            if (e + 1 < line.length() && line[e + 1] == '\'')
+                                ++e;
+                            else
+                                break;
+                        }
+                    }
+
+                    if (e >= line.length())
+                        return false;
+
+                    _spans.emplace_back(s, e);
+                    ++e;
+                }
+                else
+                {
+                    e = line.find_first_of(",)", s);
+                    if (e == std::string::npos)
+                        return false;
+
+                    _spans.emplace_back(s, e);
+                }
+
+                if (e >= line.length() || line[e] == ')')
+                    break;
+
+                // move past ", "
+                s = e + 2;
             }
-            break;
-        } while (true);
-    }
-    else
-        e = str.find_first_of(",)", e);
 
-    for (int32 i = 1; i < columnIndex; ++i)
-    {
-        // if previous value was quoted, move old e to comma
-        if (isQuoted)
-            ++e;
-
-        // move past ", "
-        s = e + 2;
-        e = s;
-        isQuoted = str[s] == '\'';
-        if (isQuoted)
+            _replaced.resize(_spans.size());
+            return true;
+        }
+
+        bool Has(int32 index) const { return index >= 0 && std::size_t(index) < _spans.size(); }
+
+        std::string_view Get(int32 index) const
+        {
+            if (_replaced[index])
+                return *_replaced[index];
+
+            return std::string_view(*_line).substr(_spans[index].first, _spans[index].second - _spans[index].first);
+        }
+
+        void Set(int32 index, std::string value) { _replaced[index] = std::move(value); }
+
+        std::string Build() const
         {
-            ++s;
-            ++e;
-            // find first unescaped quote
-            do
+            std::string line;
+            line.reserve(_line->length() + 32);
+
+            std::string::size_type copied = 0;
+            for (std::size_t i = 0; i < _spans.size(); ++i)
             {
-                e = str.find('\'', e);
-                if (e == std::string::npos)
-                    return false;
-                if (str[e - 1] == '\\')
+                if (!_replaced[i])
                     continue;
-                if (e + 1 < str.length() && str[e + 1] == '\'')
-                {
-                    ++e;
-                    continue;
-                }
-                break;
-            } while (str[e - 1] == '\\');
+
+                line.append(*_line, copied, _spans[i].first - copied);
+                line += *_replaced[i];
+                copied = _spans[i].second;
+            }
+
+            line.append(*_line, copied);
+            return line;
         }
-        else
-            e = str.find_first_of(",)", e);
-    }
 
-    return true;
-}
+    private:
+        std::string const* _line = nullptr;
+        std::vector<std::pair<std::string::size_type, std::string::size_type>> _spans;
+        std::vector<Optional<std::string>> _replaced;
+};
 
 inline std::string GetTableName(std::string const& str)
 {
@@ -554,26 +561,26 @@ inline bool ValidateFields(TableStruct const& ts, std::string const& str, size_t
     return true;
 }
 
-inline bool ChangeColumn(TableStruct const& ts, std::string& str, std::string const& column, std::string const& with, bool allowZero = false)
+inline bool ChangeColumn(TableStruct const& ts, DumpLineValues& values, std::string const& column, std::string const& with, bool allowZero = false)
 {
-    std::string::size_type s, e;
-    if (!FindColumn(ts, str, column, s, e))
+    int32 columnIndex = GetColumnIndexByName(ts, column);
+    if (!values.Has(columnIndex))
         return false;
 
-    if (allowZero && str.substr(s, e - s) == "0")
+    if (allowZero && values.Get(columnIndex) == "0")
         return true;                                        // not an error
 
-    str.replace(s, e - s, with);
+    values.Set(columnIndex, with);
     return true;
 }
 
-inline std::string GetColumn(TableStruct const& ts, std::string& str, std::string const& column)
+inline std::string GetColumn(TableStruct const& ts, DumpLineValues const& values, std::string const& column)
 {
-    std::string::size_type s, e;
-    if (!FindColumn(ts, str, column, s, e))
+    int32 columnIndex = GetColumnIndexByName(ts, column);
+    if (!values.Has(columnIndex))
         return "";
 
-    return str.substr(s, e - s);
+    return std::string(values.Get(columnIndex));
 }
 
 template <typename T, template<class, class, class...> class MapType, class... Rest>
@@ -589,37 +596,37 @@ inline T RegisterNewGuid(T oldGuid, MapType<T, T, Rest...>& guidMap, T guidOffse
 }
 
 template <typename T, template<class, class, class...> class MapType, class... Rest>
-inline bool ChangeGuid(TableStruct const& ts, std::string& str, std::string const& column, MapType<T, T, Rest...>& guidMap, T guidOffset, bool allowZero = false)
+inline bool ChangeGuid(TableStruct const& ts, DumpLineValues& values, std::string const& column, MapType<T, T, Rest...>& guidMap, T guidOffset, bool allowZero = false)
 {
-    T oldGuid = Trinity::StringTo<T>(GetColumn(ts, str, column)).template value_or<T>(0);
+    T oldGuid = Trinity::StringTo<T>(GetColumn(ts, values, column)).template value_or<T>(0);
     if (allowZero && !oldGuid)
         return true;                                        // not an error
 
-    std::string chritem;
     T newGuid = RegisterNewGuid(oldGuid, guidMap, guidOffset);
-    chritem = std::to_string(newGuid);
-
-    return ChangeColumn(ts, str, column, chritem, allowZero);
+    return ChangeColumn(ts, values, column, std::to_string(newGuid), allowZero);
 }
 
-inline void AppendTableDump(StringTransaction& trans, TableStruct const& tableStruct, QueryResult result)
+inline void AppendTableDump(std::ostream& out, TableStruct const& tableStruct, QueryResult result)
 {
     if (!result)
         return;
 
-    do
+    std::string insert = "INSERT INTO `" + tableStruct.TableName + "` (";
+    for (auto itr = tableStruct.TableFields.begin(); itr != tableStruct.TableFields.end();)
     {
-        std::ostringstream ss;
-        ss << "INSERT INTO `" << tableStruct.TableName << "` (";
-        for (auto itr = tableStruct.TableFields.begin(); itr != tableStruct.TableFields.end();)
-        {
-            ss << '`' << itr->FieldName << '`';
-            ++itr;
+        insert += '`';
+        insert += itr->FieldName;
+        insert += '`';
+        ++itr;
 
-            if (itr != tableStruct.TableFields.end())
-                ss << ", ";
-        }
-        ss << ") VALUES (";
+        if (itr != tableStruct.TableFields.end())
+            insert += ", ";
+    }
+    insert += ") VALUES (";
+
+    do
+    {
+        out << insert;
 
         uint32 const fieldSize = uint32(tableStruct.TableFields.size());
         Field* fields = result->Fetch();
@@ -627,33 +634,31 @@ inline void AppendTableDump(StringTransaction& trans, TableStruct const& tableSt
         for (uint32 i = 0; i < fieldSize;)
         {
             if (fields[i].IsNull())
-                ss << "'NULL'";
+                out << "'NULL'";
             else
             {
                 if (!tableStruct.TableFields[i].IsBinaryField)
                 {
                     std::string s(fields[i].GetString());
                     CharacterDatabase.EscapeString(s);
-                    ss << '\'' << s << '\'';
+                    out << '\'' << s << '\'';
                 }
                 else
                 {
                     std::span<uint8 const> b = fields[i].GetBinaryView();
 
                     if (!b.empty())
-                        ss << "0x" << ByteArrayToHexStr(b);
+                        out << "0x" << ByteArrayToHexStr(b);
                     else
-                        ss << '\'' << '\'';
+                        out << '\'' << '\'';
                 }
             }
 
             ++i;
             if (i != fieldSize)
-                ss << ", ";
+                out << ", ";
         }
-        ss << ");";
-
-        trans.Append(ss.str().c_str());
+        out << ");\n";
     } while (result->NextRow());
 }
 
@@ -732,7 +737,7 @@ void PlayerDumpWriter::PopulateGuids(ObjectGuid::LowType guid)
     }
 }
 
-bool PlayerDumpWriter::AppendTable(StringTransaction& trans, ObjectGuid::LowType guid, TableStruct const& tableStruct, DumpTable const& dumpTable)
+bool PlayerDumpWriter::AppendTable(std::ostream& out, ObjectGuid::LowType guid, TableStruct const& tableStruct, DumpTable const& dumpTable)
 {
     std::string whereStr;
     switch (dumpTable.Type)
@@ -788,7 +793,7 @@ bool PlayerDumpWriter::AppendTable(StringTransaction& trans, ObjectGuid::LowType
             break;
     }
 
-    AppendTableDump(trans, tableStruct, result);
+    AppendTableDump(out, tableStruct, result);
     return true;
 }
 
@@ -796,19 +801,23 @@ PlayerDumpWriter::PlayerDumpWriter() = default;
 
 bool PlayerDumpWriter::GetDump(ObjectGuid::LowType guid, std::string& dump)
 {
-    dump =  "IMPORTANT NOTE: THIS DUMPFILE IS MADE FOR USE WITH THE 'PDUMP' COMMAND ONLY - EITHER THROUGH INGAME CHAT OR ON CONSOLE!\n";
-    dump += "IMPORTANT NOTE: DO NOT apply it directly - it will irreversibly DAMAGE and CORRUPT your database! You have been warned!\n\n";
+    std::ostringstream out;
+    bool success = WriteDump(out, guid);
+    dump = std::move(out).str();
+    return success;
+}
 
-    StringTransaction trans;
+bool PlayerDumpWriter::WriteDump(std::ostream& out, ObjectGuid::LowType guid)
+{
+    out << "IMPORTANT NOTE: THIS DUMPFILE IS MADE FOR USE WITH THE 'PDUMP' COMMAND ONLY - EITHER THROUGH INGAME CHAT OR ON CONSOLE!\n";
+    out << "IMPORTANT NOTE: DO NOT apply it directly - it will irreversibly DAMAGE and CORRUPT your database! You have been warned!\n\n";
 
     // collect guids
     PopulateGuids(guid);
     for (uint32 i = 0; i < DUMP_TABLE_COUNT; ++i)
-        if (!AppendTable(trans, guid, CharacterTables[i], DumpTables[i]))
+        if (!AppendTable(out, guid, CharacterTables[i], DumpTables[i]))
             return false;
 
-    dump += trans.GetBuffer();
-
     /// @todo Add instance/group..
     /// @todo Add a dump level option to skip some non-important tables
 
@@ -828,17 +837,15 @@ DumpReturn PlayerDumpWriter::WriteDumpToFile(std::string const& file, ObjectGuid
             return DUMP_FILE_OPEN_ERROR;
     }
 
-    FileHandle fout = GetFileHandle(file.c_str(), "w");
+    // rows are written as they are fetched, the dump is never held in memory as a whole
+    std::ofstream fout(file, std::ios::trunc);
     if (!fout)
         return DUMP_FILE_OPEN_ERROR;
 
-    DumpReturn ret = DUMP_SUCCESS;
-    std::string dump;
-    if (!GetDump(guid, dump))
-        ret = DUMP_CHARACTER_DELETED;
+    if (!WriteDump(fout, guid))
+        return DUMP_CHARACTER_DELETED;
 
-    fprintf(fout.get(), "%s", dump.c_str());
-    return ret;
+    return DUMP_SUCCESS;
 }
 
 DumpReturn PlayerDumpWriter::WriteDumpToString(std::string& dump, ObjectGuid::LowType guid)
@@ -857,7 +864,7 @@ inline void FixNULLfields(std::string& line)
     while (pos != std::string::npos)
     {
         line.replace(pos, NullString.length(), "NULL");
-        pos = line.find(NullString);
+        pos = line.find(NullString, pos + 4);
     }
 }
 
@@ -925,6 +932,10 @@ DumpReturn PlayerDumpReader::LoadDump(std::istream& input, uint32 account, std::
     // for logs
     size_t lineNumber = 0;
 
+    DumpLineValues values;
+    std::string insertPrefix;
+    std::string insert;
+
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     while (std::getline(input, line))
     {
@@ -969,6 +980,12 @@ DumpReturn PlayerDumpReader::LoadDump(std::istream& input, uint32 account, std::
         if (!ValidateFields(ts, line, lineNumber))
             return DUMP_FILE_BROKEN;
 
+        if (!values.Parse(line))
+        {
+            TC_LOG_ERROR("misc", "LoadPlayerDump: (line {}) Can't split the values of table `{}`!", lineNumber, tn);
+            return DUMP_FILE_BROKEN;
+        }
+
         // per field guid offsetting
         for (TableField const& field : ts.TableFields)
         {
@@ -978,33 +995,33 @@ DumpReturn PlayerDumpReader::LoadDump(std::istream& input, uint32 account, std::
             switch (field.FieldGuidType)
             {
                 case GUID_TYPE_ACCOUNT:
-                    if (!ChangeColumn(ts, line, field.FieldName, chraccount))
+                    if (!ChangeColumn(ts, values, field.FieldName, chraccount))
                         return DUMP_FILE_BROKEN;
                     break;
                 case GUID_TYPE_CHAR:
-                    if (!ChangeColumn(ts, line, field.FieldName, newguid))
+                    if (!ChangeColumn(ts, values, field.FieldName, newguid))
                         return DUMP_FILE_BROKEN;
                     break;
                 case GUID_TYPE_PET:
-                    if (!ChangeGuid(ts, line, field.FieldName, petIds, petLowGuidOffset))
+                    if (!ChangeGuid(ts, values, field.FieldName, petIds, petLowGuidOffset))
                         return DUMP_FILE_BROKEN;
                     break;
                 case GUID_TYPE_MAIL:
-                    if (!ChangeGuid(ts, line, field.FieldName, mails, mailLowGuidOffset))
+                    if (!ChangeGuid(ts, values, field.FieldName, mails, mailLowGuidOffset))
                         return DUMP_FILE_BROKEN;
                     break;
                 case GUID_TYPE_ITEM:
-                    if (!ChangeGuid(ts, line, field.FieldName, items, itemLowGuidOffset, true))
+                    if (!ChangeGuid(ts, values, field.FieldName, items, itemLowGuidOffset, true))
                         return DUMP_FILE_BROKEN;
                     break;
                 case GUID_TYPE_EQUIPMENT_SET:
-                    if (!ChangeGuid(ts, line, field.FieldName, equipmentSetIds, equipmentSetGuidOffset))
+                    if (!ChangeGuid(ts, values, field.FieldName, equipmentSetIds, equipmentSetGuidOffset))
                         return DUMP_FILE_BROKEN;
                     break;
                 case GUID_TYPE_NULL:
                 {
                     static std::string const NullString("NULL");
-                    if (!ChangeColumn(ts, line, field.FieldName, NullString))
+                    if (!ChangeColumn(ts, values, field.FieldName, NullString))
                         return DUMP_FILE_BROKEN;
                     break;
                 }
@@ -1016,25 +1033,25 @@ DumpReturn PlayerDumpReader::LoadDump(std::istream& input, uint32 account, std::
         {
             case DTT_CHARACTER:
             {
-                race = Trinity::StringTo<uint8>(GetColumn(ts, line, "race")).value_or<uint8>(0);
-                playerClass = Trinity::StringTo<uint8>(GetColumn(ts, line, "class")).value_or<uint8>(0);
-                gender = Trinity::StringTo<uint8>(GetColumn(ts, line, "gender")).value_or<uint8>(0);
-                level = Trinity::StringTo<uint8>(GetColumn(ts, line, "level")).value_or<uint8>(0);
+                race = Trinity::StringTo<uint8>(GetColumn(ts, values, "race")).value_or<uint8>(0);
+                playerClass = Trinity::StringTo<uint8>(GetColumn(ts, values, "class")).value_or<uint8>(0);
+                gender = Trinity::StringTo<uint8>(GetColumn(ts, values, "gender")).value_or<uint8>(0);
+                level = Trinity::StringTo<uint8>(GetColumn(ts, values, "level")).value_or<uint8>(0);
                 if (name.empty())
                 {
                     // generate a temporary name
                     std::string guidPart = Trinity::StringFormat("{:X}", guid);
                     std::size_t maxCharsFromOriginalName = MAX_PLAYER_NAME - guidPart.length();
 
-                    name = GetColumn(ts, line, "name").substr(0, maxCharsFromOriginalName) + guidPart;
+                    name = GetColumn(ts, values, "name").substr(0, maxCharsFromOriginalName) + guidPart;
 
                     // characters.at_login set to "rename on login"
-                    if (!ChangeColumn(ts, line, "name", name))
+                    if (!ChangeColumn(ts, values, "name", name))
                         return DUMP_FILE_BROKEN;
-                    if (!ChangeColumn(ts, line, "at_login", "1"))
+                    if (!ChangeColumn(ts, values, "at_login", "1"))
                         return DUMP_FILE_BROKEN;
                 }
-                else if (!ChangeColumn(ts, line, "name", name)) // characters.name
+                else if (!ChangeColumn(ts, values, "name", name)) // characters.name
                     return DUMP_FILE_BROKEN;
                 break;
             }
@@ -1042,18 +1059,42 @@ DumpReturn PlayerDumpReader::LoadDump(std::istream& input, uint32 account, std::
                 break;
         }
 
+        line = values.Build();
         FixNULLfields(line);
 
-        trans->Append(line.c_str());
+        // rows of the same table and columns follow each other, they are inserted with one statement
+        std::string::size_type valuesPos = line.find("VALUES (");
+        std::string_view rowPrefix = std::string_view(line).substr(0, valuesPos + 7);
+        std::string_view row = std::string_view(line).substr(valuesPos + 7);
+        while (!row.empty() && (row.back() == ';' || std::isspace(static_cast<unsigned char>(row.back()))))
+            row.remove_suffix(1);
+
+        if (rowPrefix == insertPrefix && insert.length() + row.length() < MaxBulkInsertLength)
+        {
+            insert += ", ";
+            insert += row;
+        }
+        else
+        {
+            if (!insert.empty())
+                trans->Append(insert.c_str());
+
+            insertPrefix = rowPrefix;
+            insert.assign(rowPrefix).append(row);
+        }
     }
 
     if (input.fail() && !input.eof())
         return DUMP_FILE_BROKEN;
 
+    if (!insert.empty())
+        trans->Append(insert.c_str());
+
     CharacterDatabase.CommitTransaction(trans);
 
     // in case of name conflict player has to rename at login anyway
     sCharacterCache->AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(guid), account, name, gender, race, playerClass, level, false);
+    sCharacterEnumCache->Invalidate(account);
 
     sObjectMgr->GetGenerator<HighGuid::Item>().Set(sObjectMgr->GetGenerator<HighGuid::Item>().GetNextAfterMaxUsed() + items.size());
     sObjectMgr->_mailId += mails.size();
@@ -72,7 +72,6 @@ enum DumpReturn
 
 struct DumpTable;
 struct TableStruct;
-class StringTransaction;
 
 class TC_GAME_API PlayerDump
 {
@@ -99,7 +98,8 @@ class TC_GAME_API PlayerDumpWriter final : public PlayerDump
         DumpReturn WriteDumpToString(std::string& dump, ObjectGuid::LowType guid);
 
     private:
-        bool AppendTable(StringTransaction& trans, ObjectGuid::LowType guid, TableStruct const& tableStruct, DumpTable const& dumpTable);
+        bool WriteDump(std::ostream& out, ObjectGuid::LowType guid);
+        bool AppendTable(std::ostream& out, ObjectGuid::LowType guid, TableStruct const& tableStruct, DumpTable const& dumpTable);
         void PopulateGuids(ObjectGuid::LowType guid);
 
         std::set<uint32> _pets;
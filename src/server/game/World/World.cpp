@@ -36,6 +36,7 @@
 #include "ChannelMgr.h"
 #include "CharacterCache.h"
 #include "CharacterDatabaseCleaner.h"
+#include "CharacterEnumCache.h"
 #include "CharacterTemplateDataStore.h"
 #include "Chat.h"
 #include "ChatCommand.h"
@@ -47,6 +48,7 @@
 #include "CreatureGroups.h"
 #include "CreatureTextMgr.h"
 #include "DB2Stores.h"
+#include "DBUpdater.h"
 #include "DatabaseEnv.h"
 #include "DetourMemoryFunctions.h"
 #include "DisableMgr.h"
@@ -61,7 +63,9 @@
 #include "GuildMgr.h"
 #include "IPLocation.h"
 #include "InstanceLockMgr.h"
+#include "IpBanList.h"
 #include "ItemBonusMgr.h"
+#include "JobSystem.h"
 #include "LFGMgr.h"
 #include "Language.h"
 #include "LanguageMgr.h"
@@ -82,6 +86,7 @@
 #include "Player.h"
 #include "PlayerDump.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "QuestPools.h"
 #include "RealmList.h"
 #include "ScenarioMgr.h"
@@ -91,7 +96,9 @@
 #include "SkillExtraItems.h"
 #include "SmartScriptMgr.h"
 #include "SpellMgr.h"
+#include "StartupCache.h"
 #include "SupportMgr.h"
+#include "TaskGraph.h"
 #include "TaxiPathGraph.h"
 #include "TerrainMgr.h"
 #include "TraitMgr.h"
@@ -169,6 +176,8 @@ World::World()
     _guidAlert = false;
     _warnDiff = 0;
     _warnShutdownTime = GameTime::GetGameTime();
+
+    _worldThreadJobs = std::make_unique<Trinity::JobResumeQueue>();
 }
 
 /// World destructor
@@ -620,6 +629,7 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "InstantFlightPaths"sv, .DefaultValue = false, .Index = CONFIG_INSTANT_TAXI },
         { .Name = "Instance.IgnoreLevel"sv, .DefaultValue = false, .Index = CONFIG_INSTANCE_IGNORE_LEVEL },
         { .Name = "Instance.IgnoreRaid"sv, .DefaultValue = false, .Index = CONFIG_INSTANCE_IGNORE_RAID },
+        { .Name = "Instance.BinarySaveData"sv, .DefaultValue = true, .Index = CONFIG_INSTANCE_BINARY_SAVE_DATA },
         { .Name = "CastUnstuck"sv, .DefaultValue = true, .Index = CONFIG_CAST_UNSTUCK },
         { .Name = "GM.AllowInvite"sv, .DefaultValue = false, .Index = CONFIG_ALLOW_GM_GROUP },
         { .Name = "GM.LowerSecurity"sv, .DefaultValue = false, .Index = CONFIG_GM_LOWER_SECURITY },
@@ -690,6 +700,13 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "AllowLoggingIPAddressesInDatabase"sv, .DefaultValue = true, .Index = CONFIG_ALLOW_LOGGING_IP_ADDRESSES_IN_DATABASE },
         { .Name = "Loot.EnableAELoot"sv, .DefaultValue = true, .Index = CONFIG_ENABLE_AE_LOOT },
         { .Name = "Load.Locales"sv, .DefaultValue = true, .Index = CONFIG_LOAD_LOCALES },
+        { .Name = "Load.MapDB2Files"sv, .DefaultValue = false, .Index = CONFIG_LOAD_MAP_DB2_FILES, .Reloadable = false },
+        { .Name = "Load.LazyGameTables"sv, .DefaultValue = false, .Index = CONFIG_LOAD_LAZY_GAME_TABLES, .Reloadable = false },
+        { .Name = "MapUpdate.SharedValuesUpdates"sv, .DefaultValue = false, .Index = CONFIG_MAPUPDATE_SHARED_VALUES_UPDATES },
+        { .Name = "MapUpdate.SplineBatch"sv, .DefaultValue = false, .Index = CONFIG_MAPUPDATE_SPLINE_BATCH, .Reloadable = false },
+        { .Name = "Network.CoalesceMovementHeartbeats"sv, .DefaultValue = false, .Index = CONFIG_COALESCE_MOVEMENT_HEARTBEATS },
+        { .Name = "Conditions.PlayerResultCache"sv, .DefaultValue = false, .Index = CONFIG_CONDITION_RESULT_CACHE },
+        { .Name = "Auction.AsyncSearch"sv, .DefaultValue = false, .Index = CONFIG_AUCTION_ASYNC_SEARCH },
     } };
 
     static constexpr ConfigOptionLoadDefinitionArray<uint32, INT_CONFIG_VALUE_COUNT> ints =
@@ -740,6 +757,7 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "CharacterCreating.Disabled"sv, .DefaultValue = 0, .Index = CONFIG_CHARACTER_CREATING_DISABLED },
         { .Name = "CharacterCreating.Disabled.ClassMask"sv, .DefaultValue = 0, .Index = CONFIG_CHARACTER_CREATING_DISABLED_CLASSMASK },
         { .Name = "CharactersPerRealm"sv, .DefaultValue = 60, .Index = CONFIG_CHARACTERS_PER_REALM, .Min = 1, .Max = MAX_CHARACTERS_PER_REALM },
+        { .Name = "CharacterEnumCache.Duration"sv, .DefaultValue = 0, .Index = CONFIG_CHARACTER_ENUM_CACHE_DURATION },
         { .Name = "CharactersPerAccount"sv, .DefaultValue = 60, .Index = CONFIG_CHARACTERS_PER_ACCOUNT, .Min = 1, .Max = MAX_CHARACTERS_PER_REALM },
         { .Name = "CharacterCreating.EvokersPerRealm"sv, .DefaultValue = 1, .Index = CONFIG_CHARACTER_CREATING_EVOKERS_PER_REALM, .Min = 1, .Max = MAX_CHARACTERS_PER_REALM },
         { .Name = "CharacterCreating.MinLevelForDemonHunter"sv, .DefaultValue = 0, .Index = CONFIG_CHARACTER_CREATING_MIN_LEVEL_FOR_DEMON_HUNTER },
@@ -835,11 +853,16 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "Visibility.Notify.Period.InInstances"sv, .DefaultValue = DEFAULT_VISIBILITY_NOTIFY_PERIOD, .Index = CONFIG_VISIBILITY_NOTIFY_PERIOD_INSTANCE },
         { .Name = "Visibility.Notify.Period.InBG"sv, .DefaultValue = DEFAULT_VISIBILITY_NOTIFY_PERIOD, .Index = CONFIG_VISIBILITY_NOTIFY_PERIOD_BATTLEGROUND },
         { .Name = "Visibility.Notify.Period.InArenas"sv, .DefaultValue = DEFAULT_VISIBILITY_NOTIFY_PERIOD, .Index = CONFIG_VISIBILITY_NOTIFY_PERIOD_ARENA },
+        { .Name = "Visibility.Incremental"sv, .DefaultValue = 0, .Index = CONFIG_VISIBILITY_INCREMENTAL, .Min = 0, .Max = 2 },
+        { .Name = "Visibility.Adaptive.TickTime"sv, .DefaultValue = 0, .Index = CONFIG_VISIBILITY_ADAPTIVE_TICK_TIME },
+        { .Name = "Visibility.Adaptive.ZonePlayers"sv, .DefaultValue = 0, .Index = CONFIG_VISIBILITY_ADAPTIVE_ZONE_PLAYERS },
+        { .Name = "CombatLog.Periodic.ObserverRate"sv, .DefaultValue = 1, .Index = CONFIG_COMBAT_LOG_PERIODIC_OBSERVER_RATE },
         { .Name = "CharDelete.Method"sv, .DefaultValue = 0, .Index = CONFIG_CHARDELETE_METHOD },
         { .Name = "CharDelete.MinLevel"sv, .DefaultValue = 0, .Index = CONFIG_CHARDELETE_MIN_LEVEL },
         { .Name = "CharDelete.DeathKnight.MinLevel"sv, .DefaultValue = 0, .Index = CONFIG_CHARDELETE_DEATH_KNIGHT_MIN_LEVEL },
         { .Name = "CharDelete.DemonHunter.MinLevel"sv, .DefaultValue = 0, .Index = CONFIG_CHARDELETE_DEMON_HUNTER_MIN_LEVEL },
         { .Name = "CharDelete.KeepDays"sv, .DefaultValue = 30, .Index = CONFIG_CHARDELETE_KEEP_DAYS },
+        { .Name = "CharDelete.OldPerUpdate"sv, .DefaultValue = 5, .Index = CONFIG_CHARDELETE_OLD_PER_UPDATE, .Min = 1 },
         { .Name = "NoGrayAggro.Above"sv, .DefaultValue = 0, .Index = CONFIG_NO_GRAY_AGGRO_ABOVE },
         { .Name = "NoGrayAggro.Below"sv, .DefaultValue = 0, .Index = CONFIG_NO_GRAY_AGGRO_BELOW },
         { .Name = "Respawn.MinCheckIntervalMS"sv, .DefaultValue = 5000, .Index = CONFIG_RESPAWN_MINCHECKINTERVALMS },
@@ -856,6 +879,27 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "PvPToken.ItemID"sv, .DefaultValue = 29434, .Index = CONFIG_PVP_TOKEN_ID },
         { .Name = "PvPToken.ItemCount"sv, .DefaultValue = 1, .Index = CONFIG_PVP_TOKEN_COUNT, .Min = 1 },
         { .Name = "MapUpdate.Threads"sv, .DefaultValue = 1, .Index = CONFIG_NUMTHREADS, .Min = 1 },
+        { .Name = "MapUpdate.Scheduler"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_SCHEDULER, .Max = 1, .Reloadable = false },
+        { .Name = "MapUpdate.IslandThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_ISLAND_THREADS, .Reloadable = false },
+        { .Name = "MapUpdate.GridPreload.Threads"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_GRID_PRELOAD_THREADS, .Reloadable = false },
+        { .Name = "MapUpdate.GridPreload.Lookahead"sv, .DefaultValue = 5000, .Index = CONFIG_MAPUPDATE_GRID_PRELOAD_LOOKAHEAD, .Min = 500, .Max = 30000 },
+        { .Name = "GridUnload.Hibernation.MaxGrids"sv, .DefaultValue = 0, .Index = CONFIG_GRID_HIBERNATION_MAX_GRIDS },
+        { .Name = "GridUnload.Hibernation.MaxSnapshotSize"sv, .DefaultValue = 256, .Index = CONFIG_GRID_HIBERNATION_MAX_SNAPSHOT_SIZE },
+        { .Name = "GridUnload.TerrainMemoryBudget"sv, .DefaultValue = 0, .Index = CONFIG_GRID_TERRAIN_MEMORY_BUDGET },
+        { .Name = "MapUpdate.ReducedRate.Interval"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_REDUCED_RATE_INTERVAL, .Max = 5000 },
+        { .Name = "MapUpdate.ReducedRate.Distance"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_REDUCED_RATE_DISTANCE, .Max = uint32(MAX_VISIBILITY_DISTANCE) },
+        { .Name = "MapUpdate.TickBudget"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_TICK_BUDGET },
+        { .Name = "MapUpdate.DynamicTree.Threads"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_DYNAMIC_TREE_THREADS, .Reloadable = false },
+        { .Name = "HitchLog.Threshold"sv, .DefaultValue = 0, .Index = CONFIG_HITCH_LOG_THRESHOLD },
+        { .Name = "Compression.MemLevel"sv, .DefaultValue = 8, .Index = CONFIG_COMPRESSION_MEM_LEVEL, .Min = 1, .Max = MAX_MEM_LEVEL },
+        { .Name = "Compression.StreamPoolSize"sv, .DefaultValue = 32, .Index = CONFIG_COMPRESSION_STREAM_POOL_SIZE },
+        { .Name = "MapUpdate.MovementRelay.Window"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_MOVEMENT_RELAY_WINDOW, .Max = 500, .Reloadable = false },
+        { .Name = "MapUpdate.LineOfSightCache.Duration"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_LOS_CACHE_DURATION, .Max = 1000, .Reloadable = false },
+        { .Name = "MapUpdate.ParallelAggroChecks.MinPairs"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_PARALLEL_AGGRO_CHECKS_MIN_PAIRS },
+        { .Name = "MapUpdate.AsyncPathfinding.MinRequests"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_ASYNC_PATHFINDING_MIN_REQUESTS },
+        { .Name = "MapUpdate.PathCorridorCache.Duration"sv, .DefaultValue = 0, .Index = CONFIG_MAPUPDATE_PATH_CORRIDOR_CACHE_DURATION, .Max = 5000, .Reloadable = false },
+        { .Name = "Startup.LoaderThreads"sv, .DefaultValue = 1, .Index = CONFIG_STARTUP_LOADER_THREADS, .Min = 1, .Reloadable = false },
+        { .Name = "JobSystem.Threads"sv, .DefaultValue = 2, .Index = CONFIG_JOB_SYSTEM_THREADS, .Min = 1, .Reloadable = false },
         { .Name = "Command.LookupMaxResults"sv, .DefaultValue = 0, .Index = CONFIG_MAX_RESULTS_LOOKUP_COMMANDS },
         { .Name = "FeatureSystem.CharacterUndelete.Cooldown"sv, .DefaultValue = 2592000, .Index = CONFIG_FEATURE_SYSTEM_CHARACTER_UNDELETE_COOLDOWN },
         { .Name = "DungeonFinder.OptionsMask"sv, .DefaultValue = 1, .Index = CONFIG_LFG_OPTIONSMASK },
@@ -887,6 +931,11 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "PacketSpoof.Policy"sv, .DefaultValue = WorldSession::DosProtection::POLICY_KICK, .Index = CONFIG_PACKET_SPOOF_POLICY },
         { .Name = "PacketSpoof.BanMode"sv, .DefaultValue = BAN_ACCOUNT, .Index = CONFIG_PACKET_SPOOF_BANMODE, .Min = BAN_ACCOUNT, .Max = BAN_IP },
         { .Name = "PacketSpoof.BanDuration"sv, .DefaultValue = 86400, .Index = CONFIG_PACKET_SPOOF_BANDURATION },
+        { .Name = "PacketRateLimit.Window"sv, .DefaultValue = 1000, .Index = CONFIG_PACKET_RATE_LIMIT_WINDOW, .Min = 100, .Max = 60000 },
+        { .Name = "PacketRateLimit.Socket"sv, .DefaultValue = 0, .Index = CONFIG_PACKET_RATE_LIMIT_SOCKET },
+        { .Name = "PacketRateLimit.WorldThread"sv, .DefaultValue = 0, .Index = CONFIG_PACKET_RATE_LIMIT_WORLD_THREAD },
+        { .Name = "PacketRateLimit.MapThread"sv, .DefaultValue = 0, .Index = CONFIG_PACKET_RATE_LIMIT_MAP_THREAD },
+        { .Name = "PacketRateLimit.DisconnectFactor"sv, .DefaultValue = 4, .Index = CONFIG_PACKET_RATE_LIMIT_DISCONNECT_FACTOR },
         { .Name = "AuctionHouseBot.Update.Interval"sv, .DefaultValue = 20, .Index = CONFIG_AHBOT_UPDATE_INTERVAL },
         { .Name = "BlackMarket.MaxAuctions"sv, .DefaultValue = 12, .Index = CONFIG_BLACKMARKET_MAXAUCTIONS },
         { .Name = "BlackMarket.UpdatePeriod"sv, .DefaultValue = 24, .Index = CONFIG_BLACKMARKET_UPDATE_PERIOD },
@@ -918,6 +967,7 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "Visibility.Distance.Instances"sv, .DefaultValue = DEFAULT_VISIBILITY_INSTANCE, .Index = CONFIG_MAX_VISIBILITY_DISTANCE_INSTANCE, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
         { .Name = "Visibility.Distance.BG"sv, .DefaultValue = DEFAULT_VISIBILITY_BGARENAS, .Index = CONFIG_MAX_VISIBILITY_DISTANCE_BATTLEGROUND, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
         { .Name = "Visibility.Distance.Arenas"sv, .DefaultValue = DEFAULT_VISIBILITY_BGARENAS, .Index = CONFIG_MAX_VISIBILITY_DISTANCE_ARENA, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
+        { .Name = "Visibility.Adaptive.MinDistance"sv, .DefaultValue = 60.0f, .Index = CONFIG_VISIBILITY_ADAPTIVE_MIN_DISTANCE, .Min = 0.0f, .Max = MAX_VISIBILITY_DISTANCE },
         { .Name = "Respawn.DynamicRateCreature"sv, .DefaultValue = 10.0f, .Index = CONFIG_RESPAWN_DYNAMICRATE_CREATURE, .Min = 0.0f },
         { .Name = "Respawn.DynamicRateGameObject"sv, .DefaultValue = 10.0f, .Index = CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT, .Min = 0.0f },
         { .Name = "Stats.Limits.Dodge"sv, .DefaultValue = 95.0f, .Index = CONFIG_STATS_LIMITS_DODGE },
@@ -927,6 +977,8 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "Pvp.FactionBalance.Pct5"sv, .DefaultValue = 0.6f, .Index = CONFIG_CALL_TO_ARMS_5_PCT },
         { .Name = "Pvp.FactionBalance.Pct10"sv, .DefaultValue = 0.7f, .Index = CONFIG_CALL_TO_ARMS_10_PCT },
         { .Name = "Pvp.FactionBalance.Pct20"sv, .DefaultValue = 0.8f, .Index = CONFIG_CALL_TO_ARMS_20_PCT },
+        { .Name = "MapUpdate.LineOfSightCache.Tolerance"sv, .DefaultValue = 0.25f, .Index = CONFIG_MAPUPDATE_LOS_CACHE_TOLERANCE, .Min = 0.01f, .Max = 5.0f, .Reloadable = false },
+        { .Name = "MapUpdate.SplineBatch.RelocationDistance"sv, .DefaultValue = 0.0f, .Index = CONFIG_MAPUPDATE_SPLINE_BATCH_RELOCATION_DISTANCE, .Min = 0.0f, .Max = 5.0f, .Reloadable = false },
     } };
 
     static constexpr ConfigOptionLoadDefinitionArray<float, MAX_RATES> rates =
@@ -1126,6 +1178,9 @@ void World::LoadConfigSettings(bool reload)
     // Visibility in Arenas
     validateVisibilityDistance(CONFIG_MAX_VISIBILITY_DISTANCE_ARENA, "Visibility.Distance.Arenas");
 
+    // lowest visibility of crowded maps
+    validateVisibilityDistance(CONFIG_VISIBILITY_ADAPTIVE_MIN_DISTANCE, "Visibility.Adaptive.MinDistance");
+
     // No aggro from gray mobs
     if (m_int_configs[CONFIG_NO_GRAY_AGGRO_ABOVE] > m_int_configs[CONFIG_MAX_PLAYER_LEVEL])
     {
@@ -1177,6 +1232,11 @@ void World::LoadConfigSettings(bool reload)
 
     TC_LOG_INFO("server.loading", "WORLD: MMap data directory is: {}mmaps", m_dataPath);
 
+    bool mapTileFiles = sConfigMgr->GetBoolDefault("mmap.mapTileFiles"sv, false);
+    MMAP::MMapManager::instance()->setMapTileFiles(mapTileFiles);
+    if (mapTileFiles)
+        TC_LOG_INFO("server.loading", "MMap tiles are mapped from their files, unchanged pages are shared with other processes");
+
     bool enableLOS = sConfigMgr->GetBoolDefault("vmap.enableLOS"sv, true);
     bool enableHeight = sConfigMgr->GetBoolDefault("vmap.enableHeight"sv, true);
 
@@ -1185,16 +1245,21 @@ void World::LoadConfigSettings(bool reload)
 
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableLineOfSightCalc(enableLOS);
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableHeightCalc(enableHeight);
+    VMAP::VMapFactory::createOrGetVMapManager()->setMapModelFiles(sConfigMgr->GetBoolDefault("vmap.mapModelFiles"sv, false));
     TC_LOG_INFO("server.loading", "VMap support included. LineOfSight: {}, getHeight: {}, indoorCheck: {}", enableLOS, enableHeight, m_bool_configs[CONFIG_VMAP_INDOOR_CHECK]);
     TC_LOG_INFO("server.loading", "VMap data directory is: {}vmaps", m_dataPath);
 
     if (m_bool_configs[CONFIG_START_ALL_SPELLS])
         TC_LOG_WARN("server.loading", "PlayerStart.AllSpells enabled - may not function as intended!");
 
+    sWorldUpdateTime.SetHitchThreshold(m_int_configs[CONFIG_HITCH_LOG_THRESHOLD]);
+
     //packet spoof punishment
     if (m_int_configs[CONFIG_PACKET_SPOOF_BANMODE] == BAN_CHARACTER)
         m_int_configs[CONFIG_PACKET_SPOOF_BANMODE] = BAN_ACCOUNT;
 
+    sCharacterEnumCache->SetDuration(Seconds(m_int_configs[CONFIG_CHARACTER_ENUM_CACHE_DURATION]));
+
     _gameRules =
     {
         { .Rule = ::GameRule::TransmogEnabled, .Value = true }
@@ -1224,6 +1289,49 @@ void World::LoadConfigSettings(bool reload)
 }
 
 /// Initialize the World
+namespace
+{
+// Runs independent loaders each on their own world database connection, the thread count is capped by WorldDatabase.SynchThreads
+void RunStartupLoaders(Trinity::TaskGraph& loaders, std::string_view stage)
+{
+    std::size_t threadCount = std::min<std::size_t>(sWorld->getIntConfig(CONFIG_STARTUP_LOADER_THREADS), WorldDatabase.GetSynchConnectionCount());
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    loaders.Run(threadCount);
+    std::chrono::steady_clock::duration wallTime = std::chrono::steady_clock::now() - start;
+
+    std::chrono::steady_clock::duration loadTime = std::chrono::steady_clock::duration::zero();
+    for (Trinity::TaskGraph::TaskId id = 0; id < loaders.GetTaskCount(); ++id)
+    {
+        loadTime += loaders.GetDuration(id);
+        TC_LOG_DEBUG("server.loading", "{}: {} took {} ms", stage, loaders.GetName(id),
+            std::chrono::duration_cast<Milliseconds>(loaders.GetDuration(id)).count());
+    }
+
+    TC_LOG_INFO("server.loading", ">> {}: {} loaders took {} ms on {} thread(s), {} ms if run one after another", stage, loaders.GetTaskCount(),
+        std::chrono::duration_cast<Milliseconds>(wallTime).count(), threadCount, std::chrono::duration_cast<Milliseconds>(loadTime).count());
+}
+
+// The cache is keyed by the applied world database updates and the core revision, a change of either one invalidates it
+std::unique_ptr<StartupCache> OpenStartupCache()
+{
+    std::string path = sConfigMgr->GetStringDefault("StartupCache.File"sv, ""sv);
+    if (path.empty())
+        return nullptr;
+
+    std::string updatesHash = DBUpdater<WorldDatabaseConnection>::GetAppliedUpdatesHash(WorldDatabase);
+    if (updatesHash.empty())
+    {
+        TC_LOG_ERROR("server.loading", "Startup cache disabled, the `updates` table of the world database could not be read");
+        return nullptr;
+    }
+
+    std::unique_ptr<StartupCache> cache = std::make_unique<StartupCache>(std::move(path), Trinity::StringFormat("{}:{}", GitRevision::GetFullVersion(), updatesHash));
+    cache->Open();
+    return cache;
+}
+}
+
 bool World::SetInitialWorldSettings()
 {
     sLog->SetRealmId(sRealmList->GetCurrentRealmId().Realm);
@@ -1245,6 +1353,8 @@ bool World::SetInitialWorldSettings()
     ///- Initialize config settings
     LoadConfigSettings();
 
+    _jobSystem = std::make_unique<Trinity::JobSystem>(m_int_configs[CONFIG_JOB_SYSTEM_THREADS]);
+
     ///- Initialize Allowed Security Level
     LoadDBAllowedSecurityLevel();
 
@@ -1312,9 +1422,9 @@ bool World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Indexing loaded data stores...");
     sDB2Manager.IndexLoadedStores();
     ///- Load M2 fly by cameras
-    LoadM2Cameras(m_dataPath);
+    LoadM2Cameras(m_dataPath, getBoolConfig(CONFIG_LOAD_LAZY_GAME_TABLES));
     ///- Load GameTables
-    LoadGameTables(m_dataPath);
+    LoadGameTables(m_dataPath, getBoolConfig(CONFIG_LOAD_LAZY_GAME_TABLES));
 
     //Load weighted graph on taxi nodes path
     TaxiPathGraph::Initialize();
@@ -1402,19 +1512,31 @@ bool World::SetInitialWorldSettings()
     sMapMgr->InitInstanceIds();
     sInstanceLockMgr.Load();
 
+    std::unique_ptr<StartupCache> startupCache = OpenStartupCache();
+
     TC_LOG_INFO("server.loading", "Loading Localization strings...");
     uint32 oldMSTime = getMSTime();
-    if (m_bool_configs[CONFIG_LOAD_LOCALES])
+    Optional<StartupCacheReader> cachedLocales;
+    if (m_bool_configs[CONFIG_LOAD_LOCALES] && startupCache)
+        cachedLocales = startupCache->GetSection("ObjectMgr.Locales"sv);
+
+    if (m_bool_configs[CONFIG_LOAD_LOCALES] && (!cachedLocales || !sObjectMgr->LoadLocalesFromCache(*cachedLocales)))
     {
-        sObjectMgr->LoadCreatureLocales();
-        sObjectMgr->LoadGameObjectLocales();
-        sObjectMgr->LoadQuestTemplateLocale();
-        sObjectMgr->LoadQuestOfferRewardLocale();
-        sObjectMgr->LoadQuestRequestItemsLocale();
-        sObjectMgr->LoadQuestObjectivesLocale();
-        sObjectMgr->LoadPageTextLocales();
-        sObjectMgr->LoadGossipMenuItemsLocales();
-        sObjectMgr->LoadPointOfInterestLocales();
+        // every locale loader fills its own store only, none of them depend on each other
+        Trinity::TaskGraph localeLoaders;
+        localeLoaders.Add("creature locales", [] { sObjectMgr->LoadCreatureLocales(); });
+        localeLoaders.Add("gameobject locales", [] { sObjectMgr->LoadGameObjectLocales(); });
+        localeLoaders.Add("quest template locales", [] { sObjectMgr->LoadQuestTemplateLocale(); });
+        localeLoaders.Add("quest offer reward locales", [] { sObjectMgr->LoadQuestOfferRewardLocale(); });
+        localeLoaders.Add("quest request items locales", [] { sObjectMgr->LoadQuestRequestItemsLocale(); });
+        localeLoaders.Add("quest objectives locales", [] { sObjectMgr->LoadQuestObjectivesLocale(); });
+        localeLoaders.Add("page text locales", [] { sObjectMgr->LoadPageTextLocales(); });
+        localeLoaders.Add("gossip menu items locales", [] { sObjectMgr->LoadGossipMenuItemsLocales(); });
+        localeLoaders.Add("point of interest locales", [] { sObjectMgr->LoadPointOfInterestLocales(); });
+        RunStartupLoaders(localeLoaders, "Localization strings");
+
+        if (startupCache)
+            sObjectMgr->SaveLocalesToCache(startupCache->AddSection("ObjectMgr.Locales"));
     }
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
@@ -2063,6 +2185,12 @@ bool World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Loading phase names...");
     sObjectMgr->LoadPhaseNames();
 
+    if (startupCache && startupCache->HasNewSections())
+        startupCache->Save();
+
+    if (getBoolConfig(CONFIG_LOAD_LAZY_GAME_TABLES))
+        ReportGameTableUsage();
+
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
 
     TC_LOG_INFO("server.worldserver", "World initialized in {} minutes {} seconds", startupDuration / 60000, startupDuration % 60000 / 1000);
@@ -2114,6 +2242,11 @@ void World::LoadAutobroadcasts()
 void World::Update(uint32 diff)
 {
     TC_METRIC_TIMER("world_update_time_total");
+    uint32 updateStartTime = getMSTime();
+    uint32 hitchThreshold = sWorldUpdateTime.GetHitchThreshold();
+    if (hitchThreshold)
+        sProfiler->TakeThreadZoneStats();
+
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
     time_t currentGameTime = GameTime::GetGameTime();
@@ -2133,6 +2266,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_WHO_LIST].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update who list"));
+        TC_PROFILE_ZONE("Update who list");
         m_timers[WUPDATE_WHO_LIST].Reset();
         sWhoListStorageMgr->Update();
     }
@@ -2144,6 +2278,7 @@ void World::Update(uint32 diff)
         if (getBoolConfig(CONFIG_PRESERVE_CUSTOM_CHANNELS))
         {
             TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Save custom channels"));
+            TC_PROFILE_ZONE("Save custom channels");
             ChannelMgr* mgr1 = ASSERT_NOTNULL(ChannelMgr::ForTeam(PANDARIA_NEUTRAL));
             mgr1->SaveToDB();
             ChannelMgr* mgr2 = ASSERT_NOTNULL(ChannelMgr::ForTeam(ALLIANCE));
@@ -2157,30 +2292,35 @@ void World::Update(uint32 diff)
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Check daily reset times"));
+        TC_PROFILE_ZONE("Check daily reset times");
         CheckScheduledResetTimes();
     }
 
     if (currentGameTime > m_NextRandomBGReset)
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Reset random BG"));
+        TC_PROFILE_ZONE("Reset random BG");
         ResetRandomBG();
     }
 
     if (currentGameTime > m_NextCalendarOldEventsDeletionTime)
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Delete old calendar events"));
+        TC_PROFILE_ZONE("Delete old calendar events");
         CalendarDeleteOldEvents();
     }
 
     if (currentGameTime > m_NextGuildReset)
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Reset guild cap"));
+        TC_PROFILE_ZONE("Reset guild cap");
         ResetGuildCap();
     }
 
     if (currentGameTime > m_NextCurrencyReset)
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Reset currency weekly cap"));
+        TC_PROFILE_ZONE("Reset currency weekly cap");
         ResetCurrencyWeekCap();
     }
 
@@ -2188,6 +2328,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_AUCTIONS].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update expired auctions"));
+        TC_PROFILE_ZONE("Update expired auctions");
         m_timers[WUPDATE_AUCTIONS].Reset();
 
         ///- Update mails (return old mails with item, or delete them)
@@ -2205,6 +2346,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_AUCTIONS_PENDING].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update pending auctions"));
+        TC_PROFILE_ZONE("Update pending auctions");
         m_timers[WUPDATE_AUCTIONS_PENDING].Reset();
 
         sAuctionMgr->UpdatePendingAuctions();
@@ -2213,6 +2355,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_BLACKMARKET].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update pending black market auctions"));
+        TC_PROFILE_ZONE("Update pending black market auctions");
         m_timers[WUPDATE_BLACKMARKET].Reset();
 
         ///- Update blackmarket, refresh auctions if necessary
@@ -2234,6 +2377,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_AHBOT].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update AHBot"));
+        TC_PROFILE_ZONE("Update AHBot");
         sAuctionBot->Update();
         m_timers[WUPDATE_AHBOT].Reset();
     }
@@ -2245,6 +2389,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_CHECK_FILECHANGES].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update HotSwap"));
+        TC_PROFILE_ZONE("Update HotSwap");
         sScriptReloadMgr->Update();
         m_timers[WUPDATE_CHECK_FILECHANGES].Reset();
     }
@@ -2252,6 +2397,7 @@ void World::Update(uint32 diff)
     {
         /// <li> Handle session updates when the timer has passed
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update sessions"));
+        TC_PROFILE_ZONE("Update sessions");
         UpdateSessions(diff);
     }
 
@@ -2259,6 +2405,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_UPTIME].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update uptime"));
+        TC_PROFILE_ZONE("Update uptime");
         uint32 tmpDiff = GameTime::GetUptime();
         uint32 maxOnlinePlayers = GetMaxPlayerCount();
 
@@ -2280,6 +2427,7 @@ void World::Update(uint32 diff)
         if (m_timers[WUPDATE_CLEANDB].Passed())
         {
             TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Clean logs table"));
+            TC_PROFILE_ZONE("Clean logs table");
             m_timers[WUPDATE_CLEANDB].Reset();
 
             LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_DEL_OLD_LOGS);
@@ -2292,15 +2440,20 @@ void World::Update(uint32 diff)
         }
     }
 
+    /// <li> Publish the loot templates reloaded in the background, maps are not updated right now
+    PublishStagedLootTemplates();
+
     /// <li> Handle all other objects
     ///- Update objects when the timer has passed (maps, transport, creatures, ...)
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update maps"));
+        TC_PROFILE_ZONE("Update maps");
         sMapMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Terrain data cleanup"));
+        TC_PROFILE_ZONE("Terrain data cleanup");
         sTerrainMgr.Update(diff);
     }
 
@@ -2309,6 +2462,7 @@ void World::Update(uint32 diff)
         if (m_timers[WUPDATE_AUTOBROADCAST].Passed())
         {
             TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Send autobroadcast"));
+            TC_PROFILE_ZONE("Send autobroadcast");
             m_timers[WUPDATE_AUTOBROADCAST].Reset();
             SendAutoBroadcast();
         }
@@ -2316,47 +2470,68 @@ void World::Update(uint32 diff)
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update battlegrounds"));
+        TC_PROFILE_ZONE("Update battlegrounds");
         sBattlegroundMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update outdoor pvp"));
+        TC_PROFILE_ZONE("Update outdoor pvp");
         sOutdoorPvPMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update battlefields"));
+        TC_PROFILE_ZONE("Update battlefields");
         sBattlefieldMgr->Update(diff);
     }
 
     ///- Delete all characters which have been deleted X days before
     if (m_timers[WUPDATE_DELETECHARS].Passed())
     {
-        TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Delete old characters"));
         m_timers[WUPDATE_DELETECHARS].Reset();
-        Player::DeleteOldCharacters();
+        QueueOldCharacterDeletions();
     }
 
+    ProcessOldCharacterDeletions();
+
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update groups"));
+        TC_PROFILE_ZONE("Update groups");
         sGroupMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update LFG"));
+        TC_PROFILE_ZONE("Update LFG");
         sLFGMgr->Update(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Process query callbacks"));
+        TC_PROFILE_ZONE("Process query callbacks");
         // execute callbacks from sql queries that were queued recently
         ProcessQueryCallbacks();
     }
 
+    {
+        TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update expired mails"));
+        TC_PROFILE_ZONE("Update expired mails");
+        // return or delete the next batch of the mails found by the last ReturnOrDeleteOldMails
+        sObjectMgr->UpdateExpiredMails();
+    }
+
+    {
+        TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Resume world thread jobs"));
+        TC_PROFILE_ZONE("Resume world thread jobs");
+        _worldThreadJobs->Process();
+    }
+
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Remove old corpses"));
+        TC_PROFILE_ZONE("Remove old corpses");
         m_timers[WUPDATE_CORPSES].Reset();
         sMapMgr->DoForAllMaps([](Map* map)
         {
@@ -2368,16 +2543,25 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_EVENTS].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update game events"));
+        TC_PROFILE_ZONE("Update game events");
         m_timers[WUPDATE_EVENTS].Reset();                   // to give time for Update() to be processed
         uint32 nextGameEvent = sGameEventMgr->Update();
         m_timers[WUPDATE_EVENTS].SetInterval(nextGameEvent);
         m_timers[WUPDATE_EVENTS].Reset();
     }
 
+    ///- Spawn and remove the objects of started and stopped game events a few grids at a time
+    {
+        TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Apply game event spawns"));
+        TC_PROFILE_ZONE("Apply game event spawns");
+        sGameEventMgr->UpdateSpawnChanges();
+    }
+
     ///- Ping to keep MySQL connections alive
     if (m_timers[WUPDATE_PINGDB].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Ping MySQL"));
+        TC_PROFILE_ZONE("Ping MySQL");
         m_timers[WUPDATE_PINGDB].Reset();
         TC_LOG_DEBUG("misc", "Ping MySQL to keep connection alive");
         CharacterDatabase.KeepAlive();
@@ -2389,6 +2573,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_GUILDSAVE].Passed())
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Save guilds"));
+        TC_PROFILE_ZONE("Save guilds");
         m_timers[WUPDATE_GUILDSAVE].Reset();
         sGuildMgr->SaveGuilds();
     }
@@ -2405,21 +2590,46 @@ void World::Update(uint32 diff)
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Process cli commands"));
+        TC_PROFILE_ZONE("Process cli commands");
         // And last, but not least handle the issued cli commands
         ProcessCliCommands();
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update world scripts"));
+        TC_PROFILE_ZONE("Update world scripts");
         sScriptMgr->OnWorldUpdate(diff);
     }
 
     {
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update metrics"));
+        TC_PROFILE_ZONE("Update metrics");
         // Stats logger update
         sMetric->Update();
         TC_METRIC_VALUE("update_time_diff", diff);
     }
+
+    if (hitchThreshold)
+    {
+        std::vector<Trinity::ProfilerZoneStats> zones = sProfiler->TakeThreadZoneStats();
+        uint32 updateTime = GetMSTimeDiffToNow(updateStartTime);
+        if (updateTime >= hitchThreshold)
+        {
+            struct MapUpdateTime { uint32 Id; uint32 InstanceId; uint32 UpdateTime; };
+            std::vector<MapUpdateTime> maps;
+            sMapMgr->DoForAllMaps([&](Map* map)
+            {
+                maps.push_back({ .Id = map->GetId(), .InstanceId = map->GetInstanceId(), .UpdateTime = map->GetLastUpdateTime() });
+            });
+
+            std::ranges::sort(maps, std::ranges::greater(), &MapUpdateTime::UpdateTime);
+            std::string slowestMaps = "    slowest maps:";
+            for (std::size_t i = 0; i < maps.size() && i < 5; ++i)
+                slowestMaps += Trinity::StringFormat(" {}/{} {} ms", maps[i].Id, maps[i].InstanceId, maps[i].UpdateTime);
+
+            sWorldUpdateTime.RecordHitch("world update", updateTime, zones, slowestMaps);
+        }
+    }
 }
 
 void World::ForceGameEventUpdate()
@@ -2673,6 +2883,7 @@ BanReturn World::BanAccount(BanMode mode, std::string const& nameOrIP, uint32 du
             stmt->setString(2, author);
             stmt->setString(3, reason);
             LoginDatabase.Execute(stmt);
+            sIpBanList->AddBan(nameOrIP, duration_secs ? GameTime::GetGameTime() + duration_secs : 0);
             break;
         }
         case BAN_ACCOUNT:
@@ -2744,6 +2955,7 @@ bool World::RemoveBanAccount(BanMode mode, std::string const& nameOrIP)
         stmt = LoginDatabase.GetPreparedStatement(LOGIN_DEL_IP_NOT_BANNED);
         stmt->setString(0, nameOrIP);
         LoginDatabase.Execute(stmt);
+        sIpBanList->RemoveBan(nameOrIP);
     }
     else
     {
@@ -3043,6 +3255,45 @@ void World::UpdateRealmCharCount(uint32 accountId)
     }));
 }
 
+void World::QueueOldCharacterDeletions()
+{
+    uint32 keepDays = getIntConfig(CONFIG_CHARDELETE_KEEP_DAYS);
+    if (!keepDays || !_oldCharacterDeletions.empty())
+        return;
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_OLD_CHARS);
+    stmt->setUInt32(0, static_cast<uint32>(GameTime::GetGameTime() - static_cast<time_t>(keepDays) * DAY));
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([this](PreparedQueryResult result)
+    {
+        if (!result)
+            return;
+
+        TC_LOG_DEBUG("entities.player", "World::QueueOldCharacterDeletions: Found {} character(s) to delete", result->GetRowCount());
+        do
+        {
+            Field* fields = result->Fetch();
+            _oldCharacterDeletions.emplace_back(ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt64()), fields[1].GetUInt32());
+        } while (result->NextRow());
+    }));
+}
+
+void World::ProcessOldCharacterDeletions()
+{
+    if (_oldCharacterDeletions.empty())
+        return;
+
+    TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Delete old characters"));
+    TC_PROFILE_ZONE("Delete old characters");
+
+    // every deletion queries mails, items and pets of the character, a few per update keep the world update smooth
+    for (uint32 i = 0; i < getIntConfig(CONFIG_CHARDELETE_OLD_PER_UPDATE) && !_oldCharacterDeletions.empty(); ++i)
+    {
+        auto [guid, accountId] = _oldCharacterDeletions.front();
+        _oldCharacterDeletions.pop_front();
+        Player::DeleteFromDB(guid, accountId, true, true);
+    }
+}
+
 void World::_UpdateRealmCharCount(PreparedQueryResult resultCharCount)
 {
     if (resultCharCount)
@@ -3445,6 +3696,12 @@ void World::ProcessQueryCallbacks()
     _queryProcessor.ProcessReadyCallbacks();
 }
 
+void World::StopJobSystem()
+{
+    if (_jobSystem)
+        _jobSystem->Stop();
+}
+
 void World::ReloadRBAC()
 {
     // Passive reload, we mark the data as invalidated and next time a permission is checked it will be reloaded
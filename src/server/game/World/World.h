@@ -32,6 +32,7 @@
 #include "Timer.h"
 
 #include <atomic>
+#include <deque>
 #include <list>
 #include <map>
 #include <memory>
@@ -45,6 +46,12 @@ class WorldSession;
 class WorldSocket;
 enum class GameRule : int32;
 
+namespace Trinity
+{
+class JobResumeQueue;
+class JobSystem;
+}
+
 // ServerMessages.dbc
 enum ServerMessageType
 {
@@ -117,6 +124,7 @@ enum WorldBoolConfigs : uint32
     CONFIG_INSTANT_TAXI,
     CONFIG_INSTANCE_IGNORE_LEVEL,
     CONFIG_INSTANCE_IGNORE_RAID,
+    CONFIG_INSTANCE_BINARY_SAVE_DATA,
     CONFIG_CAST_UNSTUCK,
     CONFIG_ALLOW_GM_GROUP,
     CONFIG_GM_LOWER_SECURITY,
@@ -198,6 +206,13 @@ enum WorldBoolConfigs : uint32
     CONFIG_BATTLEGROUNDMAP_LOAD_GRIDS,
     CONFIG_ENABLE_AE_LOOT,
     CONFIG_LOAD_LOCALES,
+    CONFIG_LOAD_MAP_DB2_FILES,
+    CONFIG_LOAD_LAZY_GAME_TABLES,
+    CONFIG_MAPUPDATE_SHARED_VALUES_UPDATES,
+    CONFIG_MAPUPDATE_SPLINE_BATCH,
+    CONFIG_COALESCE_MOVEMENT_HEARTBEATS,
+    CONFIG_CONDITION_RESULT_CACHE,
+    CONFIG_AUCTION_ASYNC_SEARCH,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -229,6 +244,9 @@ enum WorldFloatConfigs : uint32
     CONFIG_MAX_VISIBILITY_DISTANCE_INSTANCE,
     CONFIG_MAX_VISIBILITY_DISTANCE_BATTLEGROUND,
     CONFIG_MAX_VISIBILITY_DISTANCE_ARENA,
+    CONFIG_VISIBILITY_ADAPTIVE_MIN_DISTANCE,
+    CONFIG_MAPUPDATE_LOS_CACHE_TOLERANCE,
+    CONFIG_MAPUPDATE_SPLINE_BATCH_RELOCATION_DISTANCE,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -255,6 +273,7 @@ enum WorldIntConfigs : uint32
     CONFIG_CHARACTER_CREATING_DISABLED_CLASSMASK,
     CONFIG_CHARACTERS_PER_ACCOUNT,
     CONFIG_CHARACTERS_PER_REALM,
+    CONFIG_CHARACTER_ENUM_CACHE_DURATION,
     CONFIG_CHARACTER_CREATING_EVOKERS_PER_REALM,
     CONFIG_CHARACTER_CREATING_MIN_LEVEL_FOR_DEMON_HUNTER,
     CONFIG_CHARACTER_CREATING_MIN_LEVEL_FOR_EVOKER,
@@ -352,6 +371,27 @@ enum WorldIntConfigs : uint32
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAPUPDATE_SCHEDULER,
+    CONFIG_MAPUPDATE_ISLAND_THREADS,
+    CONFIG_MAPUPDATE_GRID_PRELOAD_THREADS,
+    CONFIG_MAPUPDATE_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_GRID_HIBERNATION_MAX_GRIDS,
+    CONFIG_GRID_HIBERNATION_MAX_SNAPSHOT_SIZE,
+    CONFIG_GRID_TERRAIN_MEMORY_BUDGET,
+    CONFIG_MAPUPDATE_REDUCED_RATE_INTERVAL,
+    CONFIG_MAPUPDATE_REDUCED_RATE_DISTANCE,
+    CONFIG_MAPUPDATE_TICK_BUDGET,
+    CONFIG_MAPUPDATE_DYNAMIC_TREE_THREADS,
+    CONFIG_HITCH_LOG_THRESHOLD,
+    CONFIG_COMPRESSION_MEM_LEVEL,
+    CONFIG_COMPRESSION_STREAM_POOL_SIZE,
+    CONFIG_MAPUPDATE_MOVEMENT_RELAY_WINDOW,
+    CONFIG_MAPUPDATE_LOS_CACHE_DURATION,
+    CONFIG_MAPUPDATE_PARALLEL_AGGRO_CHECKS_MIN_PAIRS,
+    CONFIG_MAPUPDATE_ASYNC_PATHFINDING_MIN_REQUESTS,
+    CONFIG_MAPUPDATE_PATH_CORRIDOR_CACHE_DURATION,
+    CONFIG_STARTUP_LOADER_THREADS,
+    CONFIG_JOB_SYSTEM_THREADS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
@@ -367,6 +407,7 @@ enum WorldIntConfigs : uint32
     CONFIG_CHARDELETE_MIN_LEVEL,
     CONFIG_CHARDELETE_DEATH_KNIGHT_MIN_LEVEL,
     CONFIG_CHARDELETE_DEMON_HUNTER_MIN_LEVEL,
+    CONFIG_CHARDELETE_OLD_PER_UPDATE,
     CONFIG_AUTOBROADCAST_CENTER,
     CONFIG_AUTOBROADCAST_INTERVAL,
     CONFIG_MAX_RESULTS_LOOKUP_COMMANDS,
@@ -394,6 +435,11 @@ enum WorldIntConfigs : uint32
     CONFIG_PACKET_SPOOF_POLICY,
     CONFIG_PACKET_SPOOF_BANMODE,
     CONFIG_PACKET_SPOOF_BANDURATION,
+    CONFIG_PACKET_RATE_LIMIT_WINDOW,
+    CONFIG_PACKET_RATE_LIMIT_SOCKET,
+    CONFIG_PACKET_RATE_LIMIT_WORLD_THREAD,
+    CONFIG_PACKET_RATE_LIMIT_MAP_THREAD,
+    CONFIG_PACKET_RATE_LIMIT_DISCONNECT_FACTOR,
     CONFIG_ACC_PASSCHANGESEC,
     CONFIG_BG_REWARD_WINNER_HONOR_FIRST,
     CONFIG_BG_REWARD_WINNER_HONOR_LAST,
@@ -431,6 +477,10 @@ enum WorldIntConfigs : uint32
     CONFIG_VISIBILITY_NOTIFY_PERIOD_INSTANCE,
     CONFIG_VISIBILITY_NOTIFY_PERIOD_BATTLEGROUND,
     CONFIG_VISIBILITY_NOTIFY_PERIOD_ARENA,
+    CONFIG_VISIBILITY_INCREMENTAL,
+    CONFIG_VISIBILITY_ADAPTIVE_TICK_TIME,
+    CONFIG_VISIBILITY_ADAPTIVE_ZONE_PLAYERS,
+    CONFIG_COMBAT_LOG_PERIODIC_OBSERVER_RATE,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -670,6 +720,12 @@ class TC_GAME_API World
         void Update(uint32 diff);
 
         void UpdateSessions(uint32 diff);
+
+        /// Workers for game code moved off the world and map threads, see Trinity::Job
+        Trinity::JobSystem& GetJobSystem() { return *_jobSystem; }
+        /// Jobs awaiting it are resumed by the world thread during Update
+        Trinity::JobResumeQueue& GetWorldThreadJobs() { return *_worldThreadJobs; }
+        void StopJobSystem();
         /// Set a server rate (see #Rates)
         void setRate(Rates rate, float value) { rate_values[rate]=value; }
         /// Get a server rate (see #Rates)
@@ -797,6 +853,10 @@ class TC_GAME_API World
         // callback for UpdateRealmCharacters
         void _UpdateRealmCharCount(PreparedQueryResult resultCharCount);
 
+        // old deleted characters are looked up asynchronously and removed a few per update
+        void QueueOldCharacterDeletions();
+        void ProcessOldCharacterDeletions();
+
         void InitQuestResetTimes();
         void CheckScheduledResetTimes();
         void InitCurrencyResetTime();
@@ -893,6 +953,11 @@ class TC_GAME_API World
         void DoGuidAlertRestart();
         QueryCallbackProcessor _queryProcessor;
 
+        std::deque<std::pair<ObjectGuid, uint32>> _oldCharacterDeletions;
+
+        std::unique_ptr<Trinity::JobSystem> _jobSystem;
+        std::unique_ptr<Trinity::JobResumeQueue> _worldThreadJobs;
+
         std::string _guidWarningMsg;
         std::string _alertRestartReason;
 
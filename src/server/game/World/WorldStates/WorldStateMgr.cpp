@@ -212,6 +212,8 @@ void WorldStateMgr::SetValue(int32 worldStateId, int32 value, bool hidden, Map*
         if (worldStateTemplate)
             sScriptMgr->OnWorldStateValueChange(worldStateTemplate, oldValue, value, nullptr);
 
+        Map::InvalidateAllSpawnGroupConditions();
+
         // Broadcast update to all players on the server
         WorldPackets::WorldState::UpdateWorldState updateWorldState;
         updateWorldState.VariableID = worldStateId;
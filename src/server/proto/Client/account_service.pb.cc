@@ -3191,7 +3191,7 @@ google::protobuf::ServiceDescriptor const* AccountService::descriptor() {
   return AccountService_descriptor_;
 }
 
-void AccountService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void AccountService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 13:
       ParseAndHandleResolveAccount(token, methodId, buffer);
@@ -3305,198 +3305,198 @@ uint32 AccountService::HandleGetAccountPlatformRestrictions(::bgs::protocol::acc
 }
 
 void AccountService::ParseAndHandleResolveAccount(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::ResolveAccountRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::ResolveAccountRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.ResolveAccount");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.ResolveAccount", "bgs.protocol.account.v1.ResolveAccountRequest", &request);
+  LogCallServerMethod("AccountService.ResolveAccount", "bgs.protocol.account.v1.ResolveAccountRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.ResolveAccount", ::bgs::protocol::account::v1::ResolveAccountResponse::descriptor());
-  ::bgs::protocol::account::v1::ResolveAccountResponse response;
-  uint32 status = HandleResolveAccount(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::ResolveAccountResponse> response(GetMessagePool());
+  uint32 status = HandleResolveAccount(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleSubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::SubscriptionUpdateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::SubscriptionUpdateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.Subscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.Subscribe", "bgs.protocol.account.v1.SubscriptionUpdateRequest", &request);
+  LogCallServerMethod("AccountService.Subscribe", "bgs.protocol.account.v1.SubscriptionUpdateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.Subscribe", ::bgs::protocol::account::v1::SubscriptionUpdateResponse::descriptor());
-  ::bgs::protocol::account::v1::SubscriptionUpdateResponse response;
-  uint32 status = HandleSubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::SubscriptionUpdateResponse> response(GetMessagePool());
+  uint32 status = HandleSubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleUnsubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::SubscriptionUpdateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::SubscriptionUpdateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.Unsubscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.Unsubscribe", "bgs.protocol.account.v1.SubscriptionUpdateRequest", &request);
+  LogCallServerMethod("AccountService.Unsubscribe", "bgs.protocol.account.v1.SubscriptionUpdateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.Unsubscribe", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnsubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnsubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetAccountState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetAccountStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAccountStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetAccountState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetAccountState", "bgs.protocol.account.v1.GetAccountStateRequest", &request);
+  LogCallServerMethod("AccountService.GetAccountState", "bgs.protocol.account.v1.GetAccountStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetAccountState", ::bgs::protocol::account::v1::GetAccountStateResponse::descriptor());
-  ::bgs::protocol::account::v1::GetAccountStateResponse response;
-  uint32 status = HandleGetAccountState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAccountStateResponse> response(GetMessagePool());
+  uint32 status = HandleGetAccountState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetGameAccountState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetGameAccountStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetGameAccountStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetGameAccountState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetGameAccountState", "bgs.protocol.account.v1.GetGameAccountStateRequest", &request);
+  LogCallServerMethod("AccountService.GetGameAccountState", "bgs.protocol.account.v1.GetGameAccountStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetGameAccountState", ::bgs::protocol::account::v1::GetGameAccountStateResponse::descriptor());
-  ::bgs::protocol::account::v1::GetGameAccountStateResponse response;
-  uint32 status = HandleGetGameAccountState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetGameAccountStateResponse> response(GetMessagePool());
+  uint32 status = HandleGetGameAccountState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetLicenses(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetLicensesRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetLicensesRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetLicenses");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetLicenses", "bgs.protocol.account.v1.GetLicensesRequest", &request);
+  LogCallServerMethod("AccountService.GetLicenses", "bgs.protocol.account.v1.GetLicensesRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetLicenses", ::bgs::protocol::account::v1::GetLicensesResponse::descriptor());
-  ::bgs::protocol::account::v1::GetLicensesResponse response;
-  uint32 status = HandleGetLicenses(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetLicensesResponse> response(GetMessagePool());
+  uint32 status = HandleGetLicenses(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetGameTimeRemainingInfo(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetGameTimeRemainingInfoRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetGameTimeRemainingInfoRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetGameTimeRemainingInfo");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetGameTimeRemainingInfo", "bgs.protocol.account.v1.GetGameTimeRemainingInfoRequest", &request);
+  LogCallServerMethod("AccountService.GetGameTimeRemainingInfo", "bgs.protocol.account.v1.GetGameTimeRemainingInfoRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetGameTimeRemainingInfo", ::bgs::protocol::account::v1::GetGameTimeRemainingInfoResponse::descriptor());
-  ::bgs::protocol::account::v1::GetGameTimeRemainingInfoResponse response;
-  uint32 status = HandleGetGameTimeRemainingInfo(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetGameTimeRemainingInfoResponse> response(GetMessagePool());
+  uint32 status = HandleGetGameTimeRemainingInfo(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetGameSessionInfo(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetGameSessionInfoRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetGameSessionInfoRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetGameSessionInfo");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetGameSessionInfo", "bgs.protocol.account.v1.GetGameSessionInfoRequest", &request);
+  LogCallServerMethod("AccountService.GetGameSessionInfo", "bgs.protocol.account.v1.GetGameSessionInfoRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetGameSessionInfo", ::bgs::protocol::account::v1::GetGameSessionInfoResponse::descriptor());
-  ::bgs::protocol::account::v1::GetGameSessionInfoResponse response;
-  uint32 status = HandleGetGameSessionInfo(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetGameSessionInfoResponse> response(GetMessagePool());
+  uint32 status = HandleGetGameSessionInfo(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetCAISInfo(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetCAISInfoRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetCAISInfoRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetCAISInfo");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetCAISInfo", "bgs.protocol.account.v1.GetCAISInfoRequest", &request);
+  LogCallServerMethod("AccountService.GetCAISInfo", "bgs.protocol.account.v1.GetCAISInfoRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetCAISInfo", ::bgs::protocol::account::v1::GetCAISInfoResponse::descriptor());
-  ::bgs::protocol::account::v1::GetCAISInfoResponse response;
-  uint32 status = HandleGetCAISInfo(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetCAISInfoResponse> response(GetMessagePool());
+  uint32 status = HandleGetCAISInfo(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetAuthorizedData(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetAuthorizedDataRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAuthorizedDataRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetAuthorizedData");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetAuthorizedData", "bgs.protocol.account.v1.GetAuthorizedDataRequest", &request);
+  LogCallServerMethod("AccountService.GetAuthorizedData", "bgs.protocol.account.v1.GetAuthorizedDataRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetAuthorizedData", ::bgs::protocol::account::v1::GetAuthorizedDataResponse::descriptor());
-  ::bgs::protocol::account::v1::GetAuthorizedDataResponse response;
-  uint32 status = HandleGetAuthorizedData(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAuthorizedDataResponse> response(GetMessagePool());
+  uint32 status = HandleGetAuthorizedData(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetSignedAccountState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetSignedAccountStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetSignedAccountStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetSignedAccountState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetSignedAccountState", "bgs.protocol.account.v1.GetSignedAccountStateRequest", &request);
+  LogCallServerMethod("AccountService.GetSignedAccountState", "bgs.protocol.account.v1.GetSignedAccountStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetSignedAccountState", ::bgs::protocol::account::v1::GetSignedAccountStateResponse::descriptor());
-  ::bgs::protocol::account::v1::GetSignedAccountStateResponse response;
-  uint32 status = HandleGetSignedAccountState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetSignedAccountStateResponse> response(GetMessagePool());
+  uint32 status = HandleGetSignedAccountState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetAccountInfo(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetAccountInfoRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAccountInfoRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetAccountInfo");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetAccountInfo", "bgs.protocol.account.v1.GetAccountInfoRequest", &request);
+  LogCallServerMethod("AccountService.GetAccountInfo", "bgs.protocol.account.v1.GetAccountInfoRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetAccountInfo", ::bgs::protocol::account::v1::GetAccountInfoResponse::descriptor());
-  ::bgs::protocol::account::v1::GetAccountInfoResponse response;
-  uint32 status = HandleGetAccountInfo(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAccountInfoResponse> response(GetMessagePool());
+  uint32 status = HandleGetAccountInfo(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AccountService::ParseAndHandleGetAccountPlatformRestrictions(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::account::v1::GetAccountPlatformRestrictionsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAccountPlatformRestrictionsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AccountService.GetAccountPlatformRestrictions");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AccountService.GetAccountPlatformRestrictions", "bgs.protocol.account.v1.GetAccountPlatformRestrictionsRequest", &request);
+  LogCallServerMethod("AccountService.GetAccountPlatformRestrictions", "bgs.protocol.account.v1.GetAccountPlatformRestrictionsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AccountService.GetAccountPlatformRestrictions", ::bgs::protocol::account::v1::GetAccountPlatformRestrictionsResponse::descriptor());
-  ::bgs::protocol::account::v1::GetAccountPlatformRestrictionsResponse response;
-  uint32 status = HandleGetAccountPlatformRestrictions(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::account::v1::GetAccountPlatformRestrictionsResponse> response(GetMessagePool());
+  uint32 status = HandleGetAccountPlatformRestrictions(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // ===================================================================
@@ -3532,7 +3532,7 @@ void AccountListener::OnGameSessionUpdated(::bgs::protocol::account::v1::GameAcc
   SendRequest(service_hash_, 4 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void AccountListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {
+void AccountListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {
   LogDisallowedMethod(methodId);
 }
 
@@ -2407,7 +2407,7 @@ class TC_PROTO_API AccountService : public ServiceBase
 
   static google::protobuf::ServiceDescriptor const* descriptor();
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 
  protected:
   // server methods --------------------------------------------------
@@ -2465,7 +2465,7 @@ class TC_PROTO_API AccountListener : public ServiceBase
   void OnGameAccountsUpdated(::bgs::protocol::account::v1::GameAccountNotification const* request, bool client = false, bool server = false);
   void OnGameSessionUpdated(::bgs::protocol::account::v1::GameAccountSessionNotification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
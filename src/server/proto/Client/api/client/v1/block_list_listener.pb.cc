@@ -313,7 +313,7 @@ void BlockListListener::OnBlockedPlayerRemoved(::bgs::protocol::block_list::v1::
   SendRequest(service_hash_, 2 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void BlockListListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {
+void BlockListListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {
   LogDisallowedMethod(methodId);
 }
 
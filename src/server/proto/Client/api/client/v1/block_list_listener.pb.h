@@ -226,7 +226,7 @@ class TC_PROTO_API BlockListListener : public ServiceBase
   void OnBlockedPlayerAdded(::bgs::protocol::block_list::v1::client::BlockedPlayerAddedNotification const* request, bool client = false, bool server = false);
   void OnBlockedPlayerRemoved(::bgs::protocol::block_list::v1::client::BlockedPlayerRemovedNotification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
@@ -793,7 +793,7 @@ google::protobuf::ServiceDescriptor const* BlockListService::descriptor() {
   return BlockListService_descriptor_;
 }
 
-void BlockListService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void BlockListService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleSubscribe(token, methodId, buffer);
@@ -851,93 +851,93 @@ uint32 BlockListService::HandleBlockPlayerForSession(::bgs::protocol::block_list
 }
 
 void BlockListService::ParseAndHandleSubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::block_list::v1::client::SubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::SubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("BlockListService.Subscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("BlockListService.Subscribe", "bgs.protocol.block_list.v1.client.SubscribeRequest", &request);
+  LogCallServerMethod("BlockListService.Subscribe", "bgs.protocol.block_list.v1.client.SubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "BlockListService.Subscribe", ::bgs::protocol::block_list::v1::client::SubscribeResponse::descriptor());
-  ::bgs::protocol::block_list::v1::client::SubscribeResponse response;
-  uint32 status = HandleSubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::SubscribeResponse> response(GetMessagePool());
+  uint32 status = HandleSubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void BlockListService::ParseAndHandleUnsubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::block_list::v1::client::UnsubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::UnsubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("BlockListService.Unsubscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("BlockListService.Unsubscribe", "bgs.protocol.block_list.v1.client.UnsubscribeRequest", &request);
+  LogCallServerMethod("BlockListService.Unsubscribe", "bgs.protocol.block_list.v1.client.UnsubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "BlockListService.Unsubscribe", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnsubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnsubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void BlockListService::ParseAndHandleGetState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::block_list::v1::client::GetStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::GetStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("BlockListService.GetState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("BlockListService.GetState", "bgs.protocol.block_list.v1.client.GetStateRequest", &request);
+  LogCallServerMethod("BlockListService.GetState", "bgs.protocol.block_list.v1.client.GetStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "BlockListService.GetState", ::bgs::protocol::block_list::v1::client::GetStateResponse::descriptor());
-  ::bgs::protocol::block_list::v1::client::GetStateResponse response;
-  uint32 status = HandleGetState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::GetStateResponse> response(GetMessagePool());
+  uint32 status = HandleGetState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void BlockListService::ParseAndHandleBlockPlayer(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::block_list::v1::client::BlockPlayerRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::BlockPlayerRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("BlockListService.BlockPlayer");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("BlockListService.BlockPlayer", "bgs.protocol.block_list.v1.client.BlockPlayerRequest", &request);
+  LogCallServerMethod("BlockListService.BlockPlayer", "bgs.protocol.block_list.v1.client.BlockPlayerRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "BlockListService.BlockPlayer", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleBlockPlayer(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleBlockPlayer(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void BlockListService::ParseAndHandleUnblockPlayer(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::block_list::v1::client::UnblockPlayerRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::UnblockPlayerRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("BlockListService.UnblockPlayer");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("BlockListService.UnblockPlayer", "bgs.protocol.block_list.v1.client.UnblockPlayerRequest", &request);
+  LogCallServerMethod("BlockListService.UnblockPlayer", "bgs.protocol.block_list.v1.client.UnblockPlayerRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "BlockListService.UnblockPlayer", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnblockPlayer(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnblockPlayer(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void BlockListService::ParseAndHandleBlockPlayerForSession(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::block_list::v1::client::BlockPlayerRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::block_list::v1::client::BlockPlayerRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("BlockListService.BlockPlayerForSession");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("BlockListService.BlockPlayerForSession", "bgs.protocol.block_list.v1.client.BlockPlayerRequest", &request);
+  LogCallServerMethod("BlockListService.BlockPlayerForSession", "bgs.protocol.block_list.v1.client.BlockPlayerRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "BlockListService.BlockPlayerForSession", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleBlockPlayerForSession(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleBlockPlayerForSession(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
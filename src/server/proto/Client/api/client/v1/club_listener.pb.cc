@@ -258,7 +258,7 @@ void ClubListener::OnStreamAdvanceViewTime(::bgs::protocol::club::v1::client::St
   SendRequest(service_hash_, 155 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void ClubListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {
+void ClubListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {
   LogDisallowedMethod(methodId);
 }
 
@@ -83,7 +83,7 @@ class TC_PROTO_API ClubListener : public ServiceBase
   void OnStreamUnreadIndicator(::bgs::protocol::club::v1::client::StreamUnreadIndicatorNotification const* request, bool client = false, bool server = false);
   void OnStreamAdvanceViewTime(::bgs::protocol::club::v1::client::StreamAdvanceViewTimeNotification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
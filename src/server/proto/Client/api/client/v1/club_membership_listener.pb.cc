@@ -1035,7 +1035,7 @@ void ClubMembershipListener::OnStreamMentionAdvanceViewTime(::bgs::protocol::clu
   SendRequest(service_hash_, 8 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void ClubMembershipListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {
+void ClubMembershipListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {
   LogDisallowedMethod(methodId);
 }
 
@@ -776,7 +776,7 @@ class TC_PROTO_API ClubMembershipListener : public ServiceBase
   void OnStreamMentionRemoved(::bgs::protocol::club_membership::v1::client::StreamMentionRemovedNotification const* request, bool client = false, bool server = false);
   void OnStreamMentionAdvanceViewTime(::bgs::protocol::club_membership::v1::client::StreamMentionAdvanceViewTimeNotification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
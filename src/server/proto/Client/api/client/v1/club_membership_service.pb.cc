@@ -1159,7 +1159,7 @@ google::protobuf::ServiceDescriptor const* ClubMembershipService::descriptor() {
   return ClubMembershipService_descriptor_;
 }
 
-void ClubMembershipService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void ClubMembershipService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleSubscribe(token, methodId, buffer);
@@ -1225,108 +1225,108 @@ uint32 ClubMembershipService::HandleAdvanceStreamMentionViewTime(::bgs::protocol
 }
 
 void ClubMembershipService::ParseAndHandleSubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club_membership::v1::client::SubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::SubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubMembershipService.Subscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubMembershipService.Subscribe", "bgs.protocol.club_membership.v1.client.SubscribeRequest", &request);
+  LogCallServerMethod("ClubMembershipService.Subscribe", "bgs.protocol.club_membership.v1.client.SubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubMembershipService.Subscribe", ::bgs::protocol::club_membership::v1::client::SubscribeResponse::descriptor());
-  ::bgs::protocol::club_membership::v1::client::SubscribeResponse response;
-  uint32 status = HandleSubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::SubscribeResponse> response(GetMessagePool());
+  uint32 status = HandleSubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubMembershipService::ParseAndHandleUnsubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club_membership::v1::client::UnsubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::UnsubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubMembershipService.Unsubscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubMembershipService.Unsubscribe", "bgs.protocol.club_membership.v1.client.UnsubscribeRequest", &request);
+  LogCallServerMethod("ClubMembershipService.Unsubscribe", "bgs.protocol.club_membership.v1.client.UnsubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubMembershipService.Unsubscribe", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnsubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnsubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubMembershipService::ParseAndHandleGetState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club_membership::v1::client::GetStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::GetStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubMembershipService.GetState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubMembershipService.GetState", "bgs.protocol.club_membership.v1.client.GetStateRequest", &request);
+  LogCallServerMethod("ClubMembershipService.GetState", "bgs.protocol.club_membership.v1.client.GetStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubMembershipService.GetState", ::bgs::protocol::club_membership::v1::client::GetStateResponse::descriptor());
-  ::bgs::protocol::club_membership::v1::client::GetStateResponse response;
-  uint32 status = HandleGetState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::GetStateResponse> response(GetMessagePool());
+  uint32 status = HandleGetState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubMembershipService::ParseAndHandleUpdateClubSharedSettings(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club_membership::v1::client::UpdateClubSharedSettingsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::UpdateClubSharedSettingsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubMembershipService.UpdateClubSharedSettings");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubMembershipService.UpdateClubSharedSettings", "bgs.protocol.club_membership.v1.client.UpdateClubSharedSettingsRequest", &request);
+  LogCallServerMethod("ClubMembershipService.UpdateClubSharedSettings", "bgs.protocol.club_membership.v1.client.UpdateClubSharedSettingsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubMembershipService.UpdateClubSharedSettings", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUpdateClubSharedSettings(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUpdateClubSharedSettings(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubMembershipService::ParseAndHandleGetStreamMentions(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club_membership::v1::client::GetStreamMentionsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::GetStreamMentionsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubMembershipService.GetStreamMentions");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubMembershipService.GetStreamMentions", "bgs.protocol.club_membership.v1.client.GetStreamMentionsRequest", &request);
+  LogCallServerMethod("ClubMembershipService.GetStreamMentions", "bgs.protocol.club_membership.v1.client.GetStreamMentionsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubMembershipService.GetStreamMentions", ::bgs::protocol::club_membership::v1::client::GetStreamMentionsResponse::descriptor());
-  ::bgs::protocol::club_membership::v1::client::GetStreamMentionsResponse response;
-  uint32 status = HandleGetStreamMentions(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::GetStreamMentionsResponse> response(GetMessagePool());
+  uint32 status = HandleGetStreamMentions(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubMembershipService::ParseAndHandleRemoveStreamMentions(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club_membership::v1::client::RemoveStreamMentionsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::RemoveStreamMentionsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubMembershipService.RemoveStreamMentions");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubMembershipService.RemoveStreamMentions", "bgs.protocol.club_membership.v1.client.RemoveStreamMentionsRequest", &request);
+  LogCallServerMethod("ClubMembershipService.RemoveStreamMentions", "bgs.protocol.club_membership.v1.client.RemoveStreamMentionsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubMembershipService.RemoveStreamMentions", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleRemoveStreamMentions(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleRemoveStreamMentions(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubMembershipService::ParseAndHandleAdvanceStreamMentionViewTime(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club_membership::v1::client::AdvanceStreamMentionViewTimeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club_membership::v1::client::AdvanceStreamMentionViewTimeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubMembershipService.AdvanceStreamMentionViewTime");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubMembershipService.AdvanceStreamMentionViewTime", "bgs.protocol.club_membership.v1.client.AdvanceStreamMentionViewTimeRequest", &request);
+  LogCallServerMethod("ClubMembershipService.AdvanceStreamMentionViewTime", "bgs.protocol.club_membership.v1.client.AdvanceStreamMentionViewTimeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubMembershipService.AdvanceStreamMentionViewTime", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAdvanceStreamMentionViewTime(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAdvanceStreamMentionViewTime(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -834,7 +834,7 @@ class TC_PROTO_API ClubMembershipService : public ServiceBase
 
   static google::protobuf::ServiceDescriptor const* descriptor();
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 
  protected:
   // server methods --------------------------------------------------
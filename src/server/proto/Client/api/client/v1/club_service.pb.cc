@@ -243,7 +243,7 @@ google::protobuf::ServiceDescriptor const* ClubService::descriptor() {
   return ClubService_descriptor_;
 }
 
-void ClubService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void ClubService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleSubscribe(token, methodId, buffer);
@@ -693,828 +693,828 @@ uint32 ClubService::HandleGetStreamMessage(::bgs::protocol::club::v1::client::Ge
 }
 
 void ClubService::ParseAndHandleSubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::SubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::SubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.Subscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.Subscribe", "bgs.protocol.club.v1.client.SubscribeRequest", &request);
+  LogCallServerMethod("ClubService.Subscribe", "bgs.protocol.club.v1.client.SubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.Subscribe", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUnsubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UnsubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UnsubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.Unsubscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.Unsubscribe", "bgs.protocol.club.v1.client.UnsubscribeRequest", &request);
+  LogCallServerMethod("ClubService.Unsubscribe", "bgs.protocol.club.v1.client.UnsubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.Unsubscribe", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnsubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnsubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleCreate(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::CreateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.Create");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.Create", "bgs.protocol.club.v1.client.CreateRequest", &request);
+  LogCallServerMethod("ClubService.Create", "bgs.protocol.club.v1.client.CreateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.Create", ::bgs::protocol::club::v1::client::CreateResponse::descriptor());
-  ::bgs::protocol::club::v1::client::CreateResponse response;
-  uint32 status = HandleCreate(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateResponse> response(GetMessagePool());
+  uint32 status = HandleCreate(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleDestroy(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::DestroyRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::DestroyRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.Destroy");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.Destroy", "bgs.protocol.club.v1.client.DestroyRequest", &request);
+  LogCallServerMethod("ClubService.Destroy", "bgs.protocol.club.v1.client.DestroyRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.Destroy", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleDestroy(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleDestroy(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetDescription(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetDescriptionRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetDescriptionRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetDescription");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetDescription", "bgs.protocol.club.v1.client.GetDescriptionRequest", &request);
+  LogCallServerMethod("ClubService.GetDescription", "bgs.protocol.club.v1.client.GetDescriptionRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetDescription", ::bgs::protocol::club::v1::client::GetDescriptionResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetDescriptionResponse response;
-  uint32 status = HandleGetDescription(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetDescriptionResponse> response(GetMessagePool());
+  uint32 status = HandleGetDescription(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetClubType(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetClubTypeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetClubTypeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetClubType");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetClubType", "bgs.protocol.club.v1.client.GetClubTypeRequest", &request);
+  LogCallServerMethod("ClubService.GetClubType", "bgs.protocol.club.v1.client.GetClubTypeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetClubType", ::bgs::protocol::club::v1::client::GetClubTypeResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetClubTypeResponse response;
-  uint32 status = HandleGetClubType(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetClubTypeResponse> response(GetMessagePool());
+  uint32 status = HandleGetClubType(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUpdateClubState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UpdateClubStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UpdateClubStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.UpdateClubState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.UpdateClubState", "bgs.protocol.club.v1.client.UpdateClubStateRequest", &request);
+  LogCallServerMethod("ClubService.UpdateClubState", "bgs.protocol.club.v1.client.UpdateClubStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.UpdateClubState", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUpdateClubState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUpdateClubState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUpdateClubSettings(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UpdateClubSettingsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UpdateClubSettingsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.UpdateClubSettings");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.UpdateClubSettings", "bgs.protocol.club.v1.client.UpdateClubSettingsRequest", &request);
+  LogCallServerMethod("ClubService.UpdateClubSettings", "bgs.protocol.club.v1.client.UpdateClubSettingsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.UpdateClubSettings", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUpdateClubSettings(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUpdateClubSettings(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleJoin(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::JoinRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::JoinRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.Join");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.Join", "bgs.protocol.club.v1.client.JoinRequest", &request);
+  LogCallServerMethod("ClubService.Join", "bgs.protocol.club.v1.client.JoinRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.Join", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleJoin(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleJoin(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleLeave(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::LeaveRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::LeaveRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.Leave");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.Leave", "bgs.protocol.club.v1.client.LeaveRequest", &request);
+  LogCallServerMethod("ClubService.Leave", "bgs.protocol.club.v1.client.LeaveRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.Leave", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleLeave(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleLeave(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleKick(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::KickRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::KickRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.Kick");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.Kick", "bgs.protocol.club.v1.client.KickRequest", &request);
+  LogCallServerMethod("ClubService.Kick", "bgs.protocol.club.v1.client.KickRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.Kick", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleKick(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleKick(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetMember(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetMemberRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetMemberRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetMember");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetMember", "bgs.protocol.club.v1.client.GetMemberRequest", &request);
+  LogCallServerMethod("ClubService.GetMember", "bgs.protocol.club.v1.client.GetMemberRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetMember", ::bgs::protocol::club::v1::client::GetMemberResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetMemberResponse response;
-  uint32 status = HandleGetMember(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetMemberResponse> response(GetMessagePool());
+  uint32 status = HandleGetMember(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetMembers(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetMembersRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetMembersRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetMembers");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetMembers", "bgs.protocol.club.v1.client.GetMembersRequest", &request);
+  LogCallServerMethod("ClubService.GetMembers", "bgs.protocol.club.v1.client.GetMembersRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetMembers", ::bgs::protocol::club::v1::client::GetMembersResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetMembersResponse response;
-  uint32 status = HandleGetMembers(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetMembersResponse> response(GetMessagePool());
+  uint32 status = HandleGetMembers(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUpdateMemberState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UpdateMemberStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UpdateMemberStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.UpdateMemberState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.UpdateMemberState", "bgs.protocol.club.v1.client.UpdateMemberStateRequest", &request);
+  LogCallServerMethod("ClubService.UpdateMemberState", "bgs.protocol.club.v1.client.UpdateMemberStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.UpdateMemberState", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUpdateMemberState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUpdateMemberState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUpdateSubscriberState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UpdateSubscriberStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UpdateSubscriberStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.UpdateSubscriberState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.UpdateSubscriberState", "bgs.protocol.club.v1.client.UpdateSubscriberStateRequest", &request);
+  LogCallServerMethod("ClubService.UpdateSubscriberState", "bgs.protocol.club.v1.client.UpdateSubscriberStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.UpdateSubscriberState", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUpdateSubscriberState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUpdateSubscriberState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleAssignRole(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::AssignRoleRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::AssignRoleRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.AssignRole");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.AssignRole", "bgs.protocol.club.v1.client.AssignRoleRequest", &request);
+  LogCallServerMethod("ClubService.AssignRole", "bgs.protocol.club.v1.client.AssignRoleRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.AssignRole", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAssignRole(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAssignRole(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUnassignRole(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UnassignRoleRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UnassignRoleRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.UnassignRole");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.UnassignRole", "bgs.protocol.club.v1.client.UnassignRoleRequest", &request);
+  LogCallServerMethod("ClubService.UnassignRole", "bgs.protocol.club.v1.client.UnassignRoleRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.UnassignRole", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnassignRole(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnassignRole(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleSendInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::SendInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::SendInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.SendInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.SendInvitation", "bgs.protocol.club.v1.client.SendInvitationRequest", &request);
+  LogCallServerMethod("ClubService.SendInvitation", "bgs.protocol.club.v1.client.SendInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.SendInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSendInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSendInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleAcceptInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::AcceptInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::AcceptInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.AcceptInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.AcceptInvitation", "bgs.protocol.club.v1.client.AcceptInvitationRequest", &request);
+  LogCallServerMethod("ClubService.AcceptInvitation", "bgs.protocol.club.v1.client.AcceptInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.AcceptInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAcceptInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAcceptInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleDeclineInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::DeclineInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::DeclineInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.DeclineInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.DeclineInvitation", "bgs.protocol.club.v1.client.DeclineInvitationRequest", &request);
+  LogCallServerMethod("ClubService.DeclineInvitation", "bgs.protocol.club.v1.client.DeclineInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.DeclineInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleDeclineInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleDeclineInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleRevokeInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::RevokeInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::RevokeInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.RevokeInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.RevokeInvitation", "bgs.protocol.club.v1.client.RevokeInvitationRequest", &request);
+  LogCallServerMethod("ClubService.RevokeInvitation", "bgs.protocol.club.v1.client.RevokeInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.RevokeInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleRevokeInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleRevokeInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetInvitation", "bgs.protocol.club.v1.client.GetInvitationRequest", &request);
+  LogCallServerMethod("ClubService.GetInvitation", "bgs.protocol.club.v1.client.GetInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetInvitation", ::bgs::protocol::club::v1::client::GetInvitationResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetInvitationResponse response;
-  uint32 status = HandleGetInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetInvitationResponse> response(GetMessagePool());
+  uint32 status = HandleGetInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetInvitations(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetInvitationsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetInvitationsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetInvitations");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetInvitations", "bgs.protocol.club.v1.client.GetInvitationsRequest", &request);
+  LogCallServerMethod("ClubService.GetInvitations", "bgs.protocol.club.v1.client.GetInvitationsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetInvitations", ::bgs::protocol::club::v1::client::GetInvitationsResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetInvitationsResponse response;
-  uint32 status = HandleGetInvitations(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetInvitationsResponse> response(GetMessagePool());
+  uint32 status = HandleGetInvitations(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleSendSuggestion(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::SendSuggestionRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::SendSuggestionRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.SendSuggestion");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.SendSuggestion", "bgs.protocol.club.v1.client.SendSuggestionRequest", &request);
+  LogCallServerMethod("ClubService.SendSuggestion", "bgs.protocol.club.v1.client.SendSuggestionRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.SendSuggestion", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSendSuggestion(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSendSuggestion(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleAcceptSuggestion(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::AcceptSuggestionRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::AcceptSuggestionRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.AcceptSuggestion");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.AcceptSuggestion", "bgs.protocol.club.v1.client.AcceptSuggestionRequest", &request);
+  LogCallServerMethod("ClubService.AcceptSuggestion", "bgs.protocol.club.v1.client.AcceptSuggestionRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.AcceptSuggestion", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAcceptSuggestion(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAcceptSuggestion(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleDeclineSuggestion(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::DeclineSuggestionRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::DeclineSuggestionRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.DeclineSuggestion");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.DeclineSuggestion", "bgs.protocol.club.v1.client.DeclineSuggestionRequest", &request);
+  LogCallServerMethod("ClubService.DeclineSuggestion", "bgs.protocol.club.v1.client.DeclineSuggestionRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.DeclineSuggestion", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleDeclineSuggestion(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleDeclineSuggestion(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetSuggestion(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetSuggestionRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetSuggestionRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetSuggestion");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetSuggestion", "bgs.protocol.club.v1.client.GetSuggestionRequest", &request);
+  LogCallServerMethod("ClubService.GetSuggestion", "bgs.protocol.club.v1.client.GetSuggestionRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetSuggestion", ::bgs::protocol::club::v1::client::GetSuggestionResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetSuggestionResponse response;
-  uint32 status = HandleGetSuggestion(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetSuggestionResponse> response(GetMessagePool());
+  uint32 status = HandleGetSuggestion(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetSuggestions(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetSuggestionsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetSuggestionsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetSuggestions");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetSuggestions", "bgs.protocol.club.v1.client.GetSuggestionsRequest", &request);
+  LogCallServerMethod("ClubService.GetSuggestions", "bgs.protocol.club.v1.client.GetSuggestionsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetSuggestions", ::bgs::protocol::club::v1::client::GetSuggestionsResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetSuggestionsResponse response;
-  uint32 status = HandleGetSuggestions(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetSuggestionsResponse> response(GetMessagePool());
+  uint32 status = HandleGetSuggestions(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleCreateTicket(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::CreateTicketRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateTicketRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.CreateTicket");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.CreateTicket", "bgs.protocol.club.v1.client.CreateTicketRequest", &request);
+  LogCallServerMethod("ClubService.CreateTicket", "bgs.protocol.club.v1.client.CreateTicketRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.CreateTicket", ::bgs::protocol::club::v1::client::CreateTicketResponse::descriptor());
-  ::bgs::protocol::club::v1::client::CreateTicketResponse response;
-  uint32 status = HandleCreateTicket(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateTicketResponse> response(GetMessagePool());
+  uint32 status = HandleCreateTicket(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleDestroyTicket(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::DestroyTicketRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::DestroyTicketRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.DestroyTicket");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.DestroyTicket", "bgs.protocol.club.v1.client.DestroyTicketRequest", &request);
+  LogCallServerMethod("ClubService.DestroyTicket", "bgs.protocol.club.v1.client.DestroyTicketRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.DestroyTicket", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleDestroyTicket(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleDestroyTicket(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleRedeemTicket(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::RedeemTicketRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::RedeemTicketRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.RedeemTicket");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.RedeemTicket", "bgs.protocol.club.v1.client.RedeemTicketRequest", &request);
+  LogCallServerMethod("ClubService.RedeemTicket", "bgs.protocol.club.v1.client.RedeemTicketRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.RedeemTicket", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleRedeemTicket(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleRedeemTicket(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetTicket(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetTicketRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetTicketRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetTicket");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetTicket", "bgs.protocol.club.v1.client.GetTicketRequest", &request);
+  LogCallServerMethod("ClubService.GetTicket", "bgs.protocol.club.v1.client.GetTicketRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetTicket", ::bgs::protocol::club::v1::client::GetTicketResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetTicketResponse response;
-  uint32 status = HandleGetTicket(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetTicketResponse> response(GetMessagePool());
+  uint32 status = HandleGetTicket(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetTickets(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetTicketsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetTicketsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetTickets");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetTickets", "bgs.protocol.club.v1.client.GetTicketsRequest", &request);
+  LogCallServerMethod("ClubService.GetTickets", "bgs.protocol.club.v1.client.GetTicketsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetTickets", ::bgs::protocol::club::v1::client::GetTicketsResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetTicketsResponse response;
-  uint32 status = HandleGetTickets(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetTicketsResponse> response(GetMessagePool());
+  uint32 status = HandleGetTickets(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleAddBan(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::AddBanRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::AddBanRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.AddBan");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.AddBan", "bgs.protocol.club.v1.client.AddBanRequest", &request);
+  LogCallServerMethod("ClubService.AddBan", "bgs.protocol.club.v1.client.AddBanRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.AddBan", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAddBan(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAddBan(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleRemoveBan(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::RemoveBanRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::RemoveBanRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.RemoveBan");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.RemoveBan", "bgs.protocol.club.v1.client.RemoveBanRequest", &request);
+  LogCallServerMethod("ClubService.RemoveBan", "bgs.protocol.club.v1.client.RemoveBanRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.RemoveBan", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleRemoveBan(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleRemoveBan(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetBan(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetBanRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetBanRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetBan");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetBan", "bgs.protocol.club.v1.client.GetBanRequest", &request);
+  LogCallServerMethod("ClubService.GetBan", "bgs.protocol.club.v1.client.GetBanRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetBan", ::bgs::protocol::club::v1::client::GetBanResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetBanResponse response;
-  uint32 status = HandleGetBan(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetBanResponse> response(GetMessagePool());
+  uint32 status = HandleGetBan(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetBans(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetBansRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetBansRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetBans");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetBans", "bgs.protocol.club.v1.client.GetBansRequest", &request);
+  LogCallServerMethod("ClubService.GetBans", "bgs.protocol.club.v1.client.GetBansRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetBans", ::bgs::protocol::club::v1::client::GetBansResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetBansResponse response;
-  uint32 status = HandleGetBans(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetBansResponse> response(GetMessagePool());
+  uint32 status = HandleGetBans(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleSubscribeStream(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::SubscribeStreamRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::SubscribeStreamRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.SubscribeStream");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.SubscribeStream", "bgs.protocol.club.v1.client.SubscribeStreamRequest", &request);
+  LogCallServerMethod("ClubService.SubscribeStream", "bgs.protocol.club.v1.client.SubscribeStreamRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.SubscribeStream", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSubscribeStream(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSubscribeStream(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUnsubscribeStream(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UnsubscribeStreamRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UnsubscribeStreamRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.UnsubscribeStream");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.UnsubscribeStream", "bgs.protocol.club.v1.client.UnsubscribeStreamRequest", &request);
+  LogCallServerMethod("ClubService.UnsubscribeStream", "bgs.protocol.club.v1.client.UnsubscribeStreamRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.UnsubscribeStream", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnsubscribeStream(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnsubscribeStream(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleCreateStream(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::CreateStreamRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateStreamRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.CreateStream");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.CreateStream", "bgs.protocol.club.v1.client.CreateStreamRequest", &request);
+  LogCallServerMethod("ClubService.CreateStream", "bgs.protocol.club.v1.client.CreateStreamRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.CreateStream", ::bgs::protocol::club::v1::client::CreateStreamResponse::descriptor());
-  ::bgs::protocol::club::v1::client::CreateStreamResponse response;
-  uint32 status = HandleCreateStream(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateStreamResponse> response(GetMessagePool());
+  uint32 status = HandleCreateStream(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleDestroyStream(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::DestroyStreamRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::DestroyStreamRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.DestroyStream");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.DestroyStream", "bgs.protocol.club.v1.client.DestroyStreamRequest", &request);
+  LogCallServerMethod("ClubService.DestroyStream", "bgs.protocol.club.v1.client.DestroyStreamRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.DestroyStream", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleDestroyStream(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleDestroyStream(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetStream(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetStreamRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetStream");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetStream", "bgs.protocol.club.v1.client.GetStreamRequest", &request);
+  LogCallServerMethod("ClubService.GetStream", "bgs.protocol.club.v1.client.GetStreamRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetStream", ::bgs::protocol::club::v1::client::GetStreamResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetStreamResponse response;
-  uint32 status = HandleGetStream(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamResponse> response(GetMessagePool());
+  uint32 status = HandleGetStream(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetStreams(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetStreamsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetStreams");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetStreams", "bgs.protocol.club.v1.client.GetStreamsRequest", &request);
+  LogCallServerMethod("ClubService.GetStreams", "bgs.protocol.club.v1.client.GetStreamsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetStreams", ::bgs::protocol::club::v1::client::GetStreamsResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetStreamsResponse response;
-  uint32 status = HandleGetStreams(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamsResponse> response(GetMessagePool());
+  uint32 status = HandleGetStreams(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleUpdateStreamState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::UpdateStreamStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::UpdateStreamStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.UpdateStreamState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.UpdateStreamState", "bgs.protocol.club.v1.client.UpdateStreamStateRequest", &request);
+  LogCallServerMethod("ClubService.UpdateStreamState", "bgs.protocol.club.v1.client.UpdateStreamStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.UpdateStreamState", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUpdateStreamState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUpdateStreamState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleSetStreamFocus(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::SetStreamFocusRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::SetStreamFocusRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.SetStreamFocus");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.SetStreamFocus", "bgs.protocol.club.v1.client.SetStreamFocusRequest", &request);
+  LogCallServerMethod("ClubService.SetStreamFocus", "bgs.protocol.club.v1.client.SetStreamFocusRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.SetStreamFocus", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSetStreamFocus(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSetStreamFocus(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetStreamVoiceToken(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetStreamVoiceTokenRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamVoiceTokenRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetStreamVoiceToken");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetStreamVoiceToken", "bgs.protocol.club.v1.client.GetStreamVoiceTokenRequest", &request);
+  LogCallServerMethod("ClubService.GetStreamVoiceToken", "bgs.protocol.club.v1.client.GetStreamVoiceTokenRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetStreamVoiceToken", ::bgs::protocol::club::v1::client::GetStreamVoiceTokenResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetStreamVoiceTokenResponse response;
-  uint32 status = HandleGetStreamVoiceToken(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamVoiceTokenResponse> response(GetMessagePool());
+  uint32 status = HandleGetStreamVoiceToken(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleKickFromStreamVoice(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::KickFromStreamVoiceRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::KickFromStreamVoiceRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.KickFromStreamVoice");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.KickFromStreamVoice", "bgs.protocol.club.v1.client.KickFromStreamVoiceRequest", &request);
+  LogCallServerMethod("ClubService.KickFromStreamVoice", "bgs.protocol.club.v1.client.KickFromStreamVoiceRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.KickFromStreamVoice", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleKickFromStreamVoice(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleKickFromStreamVoice(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleCreateMessage(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::CreateMessageRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateMessageRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.CreateMessage");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.CreateMessage", "bgs.protocol.club.v1.client.CreateMessageRequest", &request);
+  LogCallServerMethod("ClubService.CreateMessage", "bgs.protocol.club.v1.client.CreateMessageRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.CreateMessage", ::bgs::protocol::club::v1::client::CreateMessageResponse::descriptor());
-  ::bgs::protocol::club::v1::client::CreateMessageResponse response;
-  uint32 status = HandleCreateMessage(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::CreateMessageResponse> response(GetMessagePool());
+  uint32 status = HandleCreateMessage(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleDestroyMessage(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::DestroyMessageRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::DestroyMessageRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.DestroyMessage");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.DestroyMessage", "bgs.protocol.club.v1.client.DestroyMessageRequest", &request);
+  LogCallServerMethod("ClubService.DestroyMessage", "bgs.protocol.club.v1.client.DestroyMessageRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.DestroyMessage", ::bgs::protocol::club::v1::client::DestroyMessageResponse::descriptor());
-  ::bgs::protocol::club::v1::client::DestroyMessageResponse response;
-  uint32 status = HandleDestroyMessage(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::DestroyMessageResponse> response(GetMessagePool());
+  uint32 status = HandleDestroyMessage(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleEditMessage(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::EditMessageRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::EditMessageRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.EditMessage");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.EditMessage", "bgs.protocol.club.v1.client.EditMessageRequest", &request);
+  LogCallServerMethod("ClubService.EditMessage", "bgs.protocol.club.v1.client.EditMessageRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.EditMessage", ::bgs::protocol::club::v1::client::EditMessageResponse::descriptor());
-  ::bgs::protocol::club::v1::client::EditMessageResponse response;
-  uint32 status = HandleEditMessage(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::EditMessageResponse> response(GetMessagePool());
+  uint32 status = HandleEditMessage(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleSetMessagePinned(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::SetMessagePinnedRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::SetMessagePinnedRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.SetMessagePinned");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.SetMessagePinned", "bgs.protocol.club.v1.client.SetMessagePinnedRequest", &request);
+  LogCallServerMethod("ClubService.SetMessagePinned", "bgs.protocol.club.v1.client.SetMessagePinnedRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.SetMessagePinned", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSetMessagePinned(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSetMessagePinned(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleSetTypingIndicator(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::SetTypingIndicatorRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::SetTypingIndicatorRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.SetTypingIndicator");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.SetTypingIndicator", "bgs.protocol.club.v1.client.SetTypingIndicatorRequest", &request);
+  LogCallServerMethod("ClubService.SetTypingIndicator", "bgs.protocol.club.v1.client.SetTypingIndicatorRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.SetTypingIndicator", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSetTypingIndicator(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSetTypingIndicator(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleAdvanceStreamViewTime(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::AdvanceStreamViewTimeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::AdvanceStreamViewTimeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.AdvanceStreamViewTime");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.AdvanceStreamViewTime", "bgs.protocol.club.v1.client.AdvanceStreamViewTimeRequest", &request);
+  LogCallServerMethod("ClubService.AdvanceStreamViewTime", "bgs.protocol.club.v1.client.AdvanceStreamViewTimeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.AdvanceStreamViewTime", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAdvanceStreamViewTime(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAdvanceStreamViewTime(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetStreamHistory(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetStreamHistoryRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamHistoryRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetStreamHistory");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetStreamHistory", "bgs.protocol.club.v1.client.GetStreamHistoryRequest", &request);
+  LogCallServerMethod("ClubService.GetStreamHistory", "bgs.protocol.club.v1.client.GetStreamHistoryRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetStreamHistory", ::bgs::protocol::club::v1::client::GetStreamHistoryResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetStreamHistoryResponse response;
-  uint32 status = HandleGetStreamHistory(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamHistoryResponse> response(GetMessagePool());
+  uint32 status = HandleGetStreamHistory(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ClubService::ParseAndHandleGetStreamMessage(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::club::v1::client::GetStreamMessageRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamMessageRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ClubService.GetStreamMessage");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ClubService.GetStreamMessage", "bgs.protocol.club.v1.client.GetStreamMessageRequest", &request);
+  LogCallServerMethod("ClubService.GetStreamMessage", "bgs.protocol.club.v1.client.GetStreamMessageRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ClubService.GetStreamMessage", ::bgs::protocol::club::v1::client::GetStreamMessageResponse::descriptor());
-  ::bgs::protocol::club::v1::client::GetStreamMessageResponse response;
-  uint32 status = HandleGetStreamMessage(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::club::v1::client::GetStreamMessageResponse> response(GetMessagePool());
+  uint32 status = HandleGetStreamMessage(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
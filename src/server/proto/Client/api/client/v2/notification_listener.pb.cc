@@ -201,7 +201,7 @@ void NotificationListener::OnNotificationReceived(::bgs::protocol::notification:
   SendRequest(service_hash_, 1 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void NotificationListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {
+void NotificationListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {
   LogDisallowedMethod(methodId);
 }
 
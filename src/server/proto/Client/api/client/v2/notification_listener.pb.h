@@ -135,7 +135,7 @@ class TC_PROTO_API NotificationListener : public ServiceBase
   // client methods --------------------------------------------------
   void OnNotificationReceived(::bgs::protocol::notification::v2::client::NotificationReceivedNotification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
@@ -198,7 +198,7 @@ google::protobuf::ServiceDescriptor const* NotificationService::descriptor() {
   return NotificationService_descriptor_;
 }
 
-void NotificationService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void NotificationService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleSendNotification(token, methodId, buffer);
@@ -216,18 +216,18 @@ uint32 NotificationService::HandleSendNotification(::bgs::protocol::notification
 }
 
 void NotificationService::ParseAndHandleSendNotification(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::notification::v2::client::SendNotificationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::notification::v2::client::SendNotificationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("NotificationService.SendNotification");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("NotificationService.SendNotification", "bgs.protocol.notification.v2.client.SendNotificationRequest", &request);
+  LogCallServerMethod("NotificationService.SendNotification", "bgs.protocol.notification.v2.client.SendNotificationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "NotificationService.SendNotification", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSendNotification(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSendNotification(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -254,7 +254,7 @@ google::protobuf::ServiceDescriptor const* ReportService::descriptor() {
   return ReportService_descriptor_;
 }
 
-void ReportService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void ReportService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleSubmitReport(token, methodId, buffer);
@@ -272,18 +272,18 @@ uint32 ReportService::HandleSubmitReport(::bgs::protocol::report::v2::SubmitRepo
 }
 
 void ReportService::ParseAndHandleSubmitReport(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::report::v2::SubmitReportRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::report::v2::SubmitReportRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ReportService.SubmitReport");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ReportService.SubmitReport", "bgs.protocol.report.v2.SubmitReportRequest", &request);
+  LogCallServerMethod("ReportService.SubmitReport", "bgs.protocol.report.v2.SubmitReportRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ReportService.SubmitReport", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSubmitReport(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSubmitReport(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -607,7 +607,7 @@ class TC_PROTO_API WhisperListener : public ServiceBase
   void OnAdvanceClearTime(::bgs::protocol::whisper::v2::client::AdvanceClearTimeNotification const* request, bool client = false, bool server = false);
   void OnTypingIndicator(::bgs::protocol::whisper::v2::client::TypingIndicatorNotification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
@@ -1110,7 +1110,7 @@ google::protobuf::ServiceDescriptor const* WhisperService::descriptor() {
   return WhisperService_descriptor_;
 }
 
-void WhisperService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void WhisperService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleSubscribe(token, methodId, buffer);
@@ -1176,108 +1176,108 @@ uint32 WhisperService::HandleSetTypingIndicator(::bgs::protocol::whisper::v2::cl
 }
 
 void WhisperService::ParseAndHandleSubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::whisper::v2::client::SubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::SubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("WhisperService.Subscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("WhisperService.Subscribe", "bgs.protocol.whisper.v2.client.SubscribeRequest", &request);
+  LogCallServerMethod("WhisperService.Subscribe", "bgs.protocol.whisper.v2.client.SubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "WhisperService.Subscribe", ::bgs::protocol::whisper::v2::client::SubscribeResponse::descriptor());
-  ::bgs::protocol::whisper::v2::client::SubscribeResponse response;
-  uint32 status = HandleSubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::SubscribeResponse> response(GetMessagePool());
+  uint32 status = HandleSubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void WhisperService::ParseAndHandleUnsubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::whisper::v2::client::UnsubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::UnsubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("WhisperService.Unsubscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("WhisperService.Unsubscribe", "bgs.protocol.whisper.v2.client.UnsubscribeRequest", &request);
+  LogCallServerMethod("WhisperService.Unsubscribe", "bgs.protocol.whisper.v2.client.UnsubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "WhisperService.Unsubscribe", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnsubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnsubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void WhisperService::ParseAndHandleGetWhisperHistory(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::whisper::v2::client::GetWhisperHistoryRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::GetWhisperHistoryRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("WhisperService.GetWhisperHistory");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("WhisperService.GetWhisperHistory", "bgs.protocol.whisper.v2.client.GetWhisperHistoryRequest", &request);
+  LogCallServerMethod("WhisperService.GetWhisperHistory", "bgs.protocol.whisper.v2.client.GetWhisperHistoryRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "WhisperService.GetWhisperHistory", ::bgs::protocol::whisper::v2::client::GetWhisperHistoryResponse::descriptor());
-  ::bgs::protocol::whisper::v2::client::GetWhisperHistoryResponse response;
-  uint32 status = HandleGetWhisperHistory(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::GetWhisperHistoryResponse> response(GetMessagePool());
+  uint32 status = HandleGetWhisperHistory(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void WhisperService::ParseAndHandleSendWhisper(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::whisper::v2::client::SendWhisperRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::SendWhisperRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("WhisperService.SendWhisper");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("WhisperService.SendWhisper", "bgs.protocol.whisper.v2.client.SendWhisperRequest", &request);
+  LogCallServerMethod("WhisperService.SendWhisper", "bgs.protocol.whisper.v2.client.SendWhisperRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "WhisperService.SendWhisper", ::bgs::protocol::whisper::v2::client::SendWhisperResponse::descriptor());
-  ::bgs::protocol::whisper::v2::client::SendWhisperResponse response;
-  uint32 status = HandleSendWhisper(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::SendWhisperResponse> response(GetMessagePool());
+  uint32 status = HandleSendWhisper(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void WhisperService::ParseAndHandleAdvanceViewTime(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::whisper::v2::client::AdvanceViewTimeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::AdvanceViewTimeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("WhisperService.AdvanceViewTime");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("WhisperService.AdvanceViewTime", "bgs.protocol.whisper.v2.client.AdvanceViewTimeRequest", &request);
+  LogCallServerMethod("WhisperService.AdvanceViewTime", "bgs.protocol.whisper.v2.client.AdvanceViewTimeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "WhisperService.AdvanceViewTime", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAdvanceViewTime(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAdvanceViewTime(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void WhisperService::ParseAndHandleAdvanceClearTime(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::whisper::v2::client::AdvanceClearTimeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::AdvanceClearTimeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("WhisperService.AdvanceClearTime");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("WhisperService.AdvanceClearTime", "bgs.protocol.whisper.v2.client.AdvanceClearTimeRequest", &request);
+  LogCallServerMethod("WhisperService.AdvanceClearTime", "bgs.protocol.whisper.v2.client.AdvanceClearTimeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "WhisperService.AdvanceClearTime", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAdvanceClearTime(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAdvanceClearTime(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void WhisperService::ParseAndHandleSetTypingIndicator(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::whisper::v2::client::SetTypingIndicatorRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::whisper::v2::client::SetTypingIndicatorRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("WhisperService.SetTypingIndicator");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("WhisperService.SetTypingIndicator", "bgs.protocol.whisper.v2.client.SetTypingIndicatorRequest", &request);
+  LogCallServerMethod("WhisperService.SetTypingIndicator", "bgs.protocol.whisper.v2.client.SetTypingIndicatorRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "WhisperService.SetTypingIndicator", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSetTypingIndicator(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSetTypingIndicator(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
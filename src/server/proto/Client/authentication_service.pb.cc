@@ -1287,7 +1287,7 @@ void AuthenticationListener::OnLogonQueueEnd(::bgs::protocol::NoData const* requ
   SendRequest(service_hash_, 13 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void AuthenticationListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {
+void AuthenticationListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {
   LogDisallowedMethod(methodId);
 }
 
@@ -1304,7 +1304,7 @@ google::protobuf::ServiceDescriptor const* AuthenticationService::descriptor() {
   return AuthenticationService_descriptor_;
 }
 
-void AuthenticationService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void AuthenticationService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleLogon(token, methodId, buffer);
@@ -1338,48 +1338,48 @@ uint32 AuthenticationService::HandleGenerateWebCredentials(::bgs::protocol::auth
 }
 
 void AuthenticationService::ParseAndHandleLogon(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::authentication::v1::LogonRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::authentication::v1::LogonRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AuthenticationService.Logon");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AuthenticationService.Logon", "bgs.protocol.authentication.v1.LogonRequest", &request);
+  LogCallServerMethod("AuthenticationService.Logon", "bgs.protocol.authentication.v1.LogonRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AuthenticationService.Logon", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleLogon(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleLogon(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AuthenticationService::ParseAndHandleVerifyWebCredentials(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::authentication::v1::VerifyWebCredentialsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::authentication::v1::VerifyWebCredentialsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AuthenticationService.VerifyWebCredentials");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AuthenticationService.VerifyWebCredentials", "bgs.protocol.authentication.v1.VerifyWebCredentialsRequest", &request);
+  LogCallServerMethod("AuthenticationService.VerifyWebCredentials", "bgs.protocol.authentication.v1.VerifyWebCredentialsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AuthenticationService.VerifyWebCredentials", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleVerifyWebCredentials(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleVerifyWebCredentials(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void AuthenticationService::ParseAndHandleGenerateWebCredentials(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::authentication::v1::GenerateWebCredentialsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::authentication::v1::GenerateWebCredentialsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("AuthenticationService.GenerateWebCredentials");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("AuthenticationService.GenerateWebCredentials", "bgs.protocol.authentication.v1.GenerateWebCredentialsRequest", &request);
+  LogCallServerMethod("AuthenticationService.GenerateWebCredentials", "bgs.protocol.authentication.v1.GenerateWebCredentialsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "AuthenticationService.GenerateWebCredentials", ::bgs::protocol::authentication::v1::GenerateWebCredentialsResponse::descriptor());
-  ::bgs::protocol::authentication::v1::GenerateWebCredentialsResponse response;
-  uint32 status = HandleGenerateWebCredentials(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::authentication::v1::GenerateWebCredentialsResponse> response(GetMessagePool());
+  uint32 status = HandleGenerateWebCredentials(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1491,7 +1491,7 @@ void ConnectionService::RequestDisconnect(::bgs::protocol::connection::v1::Disco
   SendRequest(service_hash_, 7 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void ConnectionService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void ConnectionService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleConnect(token, methodId, buffer);
@@ -1557,100 +1557,100 @@ uint32 ConnectionService::HandleRequestDisconnect(::bgs::protocol::connection::v
 }
 
 void ConnectionService::ParseAndHandleConnect(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::connection::v1::ConnectRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::connection::v1::ConnectRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ConnectionService.Connect");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ConnectionService.Connect", "bgs.protocol.connection.v1.ConnectRequest", &request);
+  LogCallServerMethod("ConnectionService.Connect", "bgs.protocol.connection.v1.ConnectRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ConnectionService.Connect", ::bgs::protocol::connection::v1::ConnectResponse::descriptor());
-  ::bgs::protocol::connection::v1::ConnectResponse response;
-  uint32 status = HandleConnect(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::connection::v1::ConnectResponse> response(GetMessagePool());
+  uint32 status = HandleConnect(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ConnectionService::ParseAndHandleBind(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::connection::v1::BindRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::connection::v1::BindRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ConnectionService.Bind");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ConnectionService.Bind", "bgs.protocol.connection.v1.BindRequest", &request);
+  LogCallServerMethod("ConnectionService.Bind", "bgs.protocol.connection.v1.BindRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ConnectionService.Bind", ::bgs::protocol::connection::v1::BindResponse::descriptor());
-  ::bgs::protocol::connection::v1::BindResponse response;
-  uint32 status = HandleBind(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::connection::v1::BindResponse> response(GetMessagePool());
+  uint32 status = HandleBind(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ConnectionService::ParseAndHandleEcho(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::connection::v1::EchoRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::connection::v1::EchoRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ConnectionService.Echo");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ConnectionService.Echo", "bgs.protocol.connection.v1.EchoRequest", &request);
+  LogCallServerMethod("ConnectionService.Echo", "bgs.protocol.connection.v1.EchoRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ConnectionService.Echo", ::bgs::protocol::connection::v1::EchoResponse::descriptor());
-  ::bgs::protocol::connection::v1::EchoResponse response;
-  uint32 status = HandleEcho(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::connection::v1::EchoResponse> response(GetMessagePool());
+  uint32 status = HandleEcho(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ConnectionService::ParseAndHandleForceDisconnect(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::connection::v1::DisconnectNotification request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::connection::v1::DisconnectNotification> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ConnectionService.ForceDisconnect");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  uint32 status = HandleForceDisconnect(&request);
-  LogCallServerMethod("ConnectionService.ForceDisconnect", "bgs.protocol.connection.v1.DisconnectNotification", &request);
+  uint32 status = HandleForceDisconnect(request.get());
+  LogCallServerMethod("ConnectionService.ForceDisconnect", "bgs.protocol.connection.v1.DisconnectNotification", request.get());
   if (status)
     SendResponse(service_hash_, methodId, token, status);
 }
 
 void ConnectionService::ParseAndHandleKeepAlive(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::NoData request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::NoData> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ConnectionService.KeepAlive");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  uint32 status = HandleKeepAlive(&request);
-  LogCallServerMethod("ConnectionService.KeepAlive", "bgs.protocol.NoData", &request);
+  uint32 status = HandleKeepAlive(request.get());
+  LogCallServerMethod("ConnectionService.KeepAlive", "bgs.protocol.NoData", request.get());
   if (status)
     SendResponse(service_hash_, methodId, token, status);
 }
 
 void ConnectionService::ParseAndHandleEncrypt(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::connection::v1::EncryptRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::connection::v1::EncryptRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ConnectionService.Encrypt");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ConnectionService.Encrypt", "bgs.protocol.connection.v1.EncryptRequest", &request);
+  LogCallServerMethod("ConnectionService.Encrypt", "bgs.protocol.connection.v1.EncryptRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ConnectionService.Encrypt", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleEncrypt(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleEncrypt(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ConnectionService::ParseAndHandleRequestDisconnect(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::connection::v1::DisconnectRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::connection::v1::DisconnectRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ConnectionService.RequestDisconnect");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  uint32 status = HandleRequestDisconnect(&request);
-  LogCallServerMethod("ConnectionService.RequestDisconnect", "bgs.protocol.connection.v1.DisconnectRequest", &request);
+  uint32 status = HandleRequestDisconnect(request.get());
+  LogCallServerMethod("ConnectionService.RequestDisconnect", "bgs.protocol.connection.v1.DisconnectRequest", request.get());
   if (status)
     SendResponse(service_hash_, methodId, token, status);
 }
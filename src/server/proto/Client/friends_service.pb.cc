@@ -2254,7 +2254,7 @@ google::protobuf::ServiceDescriptor const* FriendsService::descriptor() {
   return FriendsService_descriptor_;
 }
 
-void FriendsService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void FriendsService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleSubscribe(token, methodId, buffer);
@@ -2368,198 +2368,198 @@ uint32 FriendsService::HandleCreateFriendship(::bgs::protocol::friends::v1::Crea
 }
 
 void FriendsService::ParseAndHandleSubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::SubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::SubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.Subscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.Subscribe", "bgs.protocol.friends.v1.SubscribeRequest", &request);
+  LogCallServerMethod("FriendsService.Subscribe", "bgs.protocol.friends.v1.SubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.Subscribe", ::bgs::protocol::friends::v1::SubscribeResponse::descriptor());
-  ::bgs::protocol::friends::v1::SubscribeResponse response;
-  uint32 status = HandleSubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::friends::v1::SubscribeResponse> response(GetMessagePool());
+  uint32 status = HandleSubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleSendInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::SendInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::SendInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.SendInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.SendInvitation", "bgs.protocol.friends.v1.SendInvitationRequest", &request);
+  LogCallServerMethod("FriendsService.SendInvitation", "bgs.protocol.friends.v1.SendInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.SendInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleSendInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleSendInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleAcceptInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::AcceptInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::AcceptInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.AcceptInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.AcceptInvitation", "bgs.protocol.friends.v1.AcceptInvitationRequest", &request);
+  LogCallServerMethod("FriendsService.AcceptInvitation", "bgs.protocol.friends.v1.AcceptInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.AcceptInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleAcceptInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleAcceptInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleRevokeInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::RevokeInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::RevokeInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.RevokeInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.RevokeInvitation", "bgs.protocol.friends.v1.RevokeInvitationRequest", &request);
+  LogCallServerMethod("FriendsService.RevokeInvitation", "bgs.protocol.friends.v1.RevokeInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.RevokeInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleRevokeInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleRevokeInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleDeclineInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::DeclineInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::DeclineInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.DeclineInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.DeclineInvitation", "bgs.protocol.friends.v1.DeclineInvitationRequest", &request);
+  LogCallServerMethod("FriendsService.DeclineInvitation", "bgs.protocol.friends.v1.DeclineInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.DeclineInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleDeclineInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleDeclineInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleIgnoreInvitation(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::IgnoreInvitationRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::IgnoreInvitationRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.IgnoreInvitation");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.IgnoreInvitation", "bgs.protocol.friends.v1.IgnoreInvitationRequest", &request);
+  LogCallServerMethod("FriendsService.IgnoreInvitation", "bgs.protocol.friends.v1.IgnoreInvitationRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.IgnoreInvitation", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleIgnoreInvitation(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleIgnoreInvitation(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleRemoveFriend(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::RemoveFriendRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::RemoveFriendRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.RemoveFriend");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.RemoveFriend", "bgs.protocol.friends.v1.RemoveFriendRequest", &request);
+  LogCallServerMethod("FriendsService.RemoveFriend", "bgs.protocol.friends.v1.RemoveFriendRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.RemoveFriend", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleRemoveFriend(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleRemoveFriend(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleViewFriends(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::ViewFriendsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::ViewFriendsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.ViewFriends");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.ViewFriends", "bgs.protocol.friends.v1.ViewFriendsRequest", &request);
+  LogCallServerMethod("FriendsService.ViewFriends", "bgs.protocol.friends.v1.ViewFriendsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.ViewFriends", ::bgs::protocol::friends::v1::ViewFriendsResponse::descriptor());
-  ::bgs::protocol::friends::v1::ViewFriendsResponse response;
-  uint32 status = HandleViewFriends(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::friends::v1::ViewFriendsResponse> response(GetMessagePool());
+  uint32 status = HandleViewFriends(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleUpdateFriendState(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::UpdateFriendStateRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::UpdateFriendStateRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.UpdateFriendState");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.UpdateFriendState", "bgs.protocol.friends.v1.UpdateFriendStateRequest", &request);
+  LogCallServerMethod("FriendsService.UpdateFriendState", "bgs.protocol.friends.v1.UpdateFriendStateRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.UpdateFriendState", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUpdateFriendState(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUpdateFriendState(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleUnsubscribe(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::UnsubscribeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::UnsubscribeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.Unsubscribe");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.Unsubscribe", "bgs.protocol.friends.v1.UnsubscribeRequest", &request);
+  LogCallServerMethod("FriendsService.Unsubscribe", "bgs.protocol.friends.v1.UnsubscribeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.Unsubscribe", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleUnsubscribe(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleUnsubscribe(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleRevokeAllInvitations(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::RevokeAllInvitationsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::RevokeAllInvitationsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.RevokeAllInvitations");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.RevokeAllInvitations", "bgs.protocol.friends.v1.RevokeAllInvitationsRequest", &request);
+  LogCallServerMethod("FriendsService.RevokeAllInvitations", "bgs.protocol.friends.v1.RevokeAllInvitationsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.RevokeAllInvitations", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleRevokeAllInvitations(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleRevokeAllInvitations(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleGetFriendList(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::GetFriendListRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::GetFriendListRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.GetFriendList");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.GetFriendList", "bgs.protocol.friends.v1.GetFriendListRequest", &request);
+  LogCallServerMethod("FriendsService.GetFriendList", "bgs.protocol.friends.v1.GetFriendListRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.GetFriendList", ::bgs::protocol::friends::v1::GetFriendListResponse::descriptor());
-  ::bgs::protocol::friends::v1::GetFriendListResponse response;
-  uint32 status = HandleGetFriendList(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::friends::v1::GetFriendListResponse> response(GetMessagePool());
+  uint32 status = HandleGetFriendList(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void FriendsService::ParseAndHandleCreateFriendship(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::friends::v1::CreateFriendshipRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::friends::v1::CreateFriendshipRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("FriendsService.CreateFriendship");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("FriendsService.CreateFriendship", "bgs.protocol.friends.v1.CreateFriendshipRequest", &request);
+  LogCallServerMethod("FriendsService.CreateFriendship", "bgs.protocol.friends.v1.CreateFriendshipRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "FriendsService.CreateFriendship", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandleCreateFriendship(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandleCreateFriendship(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // ===================================================================
@@ -2610,7 +2610,7 @@ void FriendsListener::OnUpdateFriendState(::bgs::protocol::friends::v1::UpdateFr
   SendRequest(service_hash_, 7 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void FriendsListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer /*buffer*/) {
+void FriendsListener::CallServerMethod(uint32 /*token*/, uint32 methodId, MessageBuffer& /*buffer*/) {
   LogDisallowedMethod(methodId);
 }
 
@@ -1432,7 +1432,7 @@ void GameUtilitiesService::UnregisterUtilities(::bgs::protocol::game_utilities::
   SendRequest(service_hash_, 12 | (client ? 0x40000000 : 0) | (server ? 0x80000000 : 0), request);
 }
 
-void GameUtilitiesService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void GameUtilitiesService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleProcessClientRequest(token, methodId, buffer);
@@ -1506,115 +1506,115 @@ uint32 GameUtilitiesService::HandleUnregisterUtilities(::bgs::protocol::game_uti
 }
 
 void GameUtilitiesService::ParseAndHandleProcessClientRequest(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::ClientRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::ClientRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.ProcessClientRequest");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("GameUtilitiesService.ProcessClientRequest", "bgs.protocol.game_utilities.v1.ClientRequest", &request);
+  LogCallServerMethod("GameUtilitiesService.ProcessClientRequest", "bgs.protocol.game_utilities.v1.ClientRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "GameUtilitiesService.ProcessClientRequest", ::bgs::protocol::game_utilities::v1::ClientResponse::descriptor());
-  ::bgs::protocol::game_utilities::v1::ClientResponse response;
-  uint32 status = HandleProcessClientRequest(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::ClientResponse> response(GetMessagePool());
+  uint32 status = HandleProcessClientRequest(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void GameUtilitiesService::ParseAndHandlePresenceChannelCreated(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::PresenceChannelCreatedRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::PresenceChannelCreatedRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.PresenceChannelCreated");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("GameUtilitiesService.PresenceChannelCreated", "bgs.protocol.game_utilities.v1.PresenceChannelCreatedRequest", &request);
+  LogCallServerMethod("GameUtilitiesService.PresenceChannelCreated", "bgs.protocol.game_utilities.v1.PresenceChannelCreatedRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "GameUtilitiesService.PresenceChannelCreated", ::bgs::protocol::NoData::descriptor());
-  ::bgs::protocol::NoData response;
-  uint32 status = HandlePresenceChannelCreated(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::NoData> response(GetMessagePool());
+  uint32 status = HandlePresenceChannelCreated(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void GameUtilitiesService::ParseAndHandleProcessServerRequest(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::ServerRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::ServerRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.ProcessServerRequest");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("GameUtilitiesService.ProcessServerRequest", "bgs.protocol.game_utilities.v1.ServerRequest", &request);
+  LogCallServerMethod("GameUtilitiesService.ProcessServerRequest", "bgs.protocol.game_utilities.v1.ServerRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "GameUtilitiesService.ProcessServerRequest", ::bgs::protocol::game_utilities::v1::ServerResponse::descriptor());
-  ::bgs::protocol::game_utilities::v1::ServerResponse response;
-  uint32 status = HandleProcessServerRequest(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::ServerResponse> response(GetMessagePool());
+  uint32 status = HandleProcessServerRequest(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void GameUtilitiesService::ParseAndHandleOnGameAccountOnline(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::GameAccountOnlineNotification request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::GameAccountOnlineNotification> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.OnGameAccountOnline");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  uint32 status = HandleOnGameAccountOnline(&request);
-  LogCallServerMethod("GameUtilitiesService.OnGameAccountOnline", "bgs.protocol.game_utilities.v1.GameAccountOnlineNotification", &request);
+  uint32 status = HandleOnGameAccountOnline(request.get());
+  LogCallServerMethod("GameUtilitiesService.OnGameAccountOnline", "bgs.protocol.game_utilities.v1.GameAccountOnlineNotification", request.get());
   if (status)
     SendResponse(service_hash_, methodId, token, status);
 }
 
 void GameUtilitiesService::ParseAndHandleOnGameAccountOffline(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::GameAccountOfflineNotification request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::GameAccountOfflineNotification> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.OnGameAccountOffline");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  uint32 status = HandleOnGameAccountOffline(&request);
-  LogCallServerMethod("GameUtilitiesService.OnGameAccountOffline", "bgs.protocol.game_utilities.v1.GameAccountOfflineNotification", &request);
+  uint32 status = HandleOnGameAccountOffline(request.get());
+  LogCallServerMethod("GameUtilitiesService.OnGameAccountOffline", "bgs.protocol.game_utilities.v1.GameAccountOfflineNotification", request.get());
   if (status)
     SendResponse(service_hash_, methodId, token, status);
 }
 
 void GameUtilitiesService::ParseAndHandleGetAllValuesForAttribute(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::GetAllValuesForAttributeRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::GetAllValuesForAttributeRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.GetAllValuesForAttribute");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("GameUtilitiesService.GetAllValuesForAttribute", "bgs.protocol.game_utilities.v1.GetAllValuesForAttributeRequest", &request);
+  LogCallServerMethod("GameUtilitiesService.GetAllValuesForAttribute", "bgs.protocol.game_utilities.v1.GetAllValuesForAttributeRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "GameUtilitiesService.GetAllValuesForAttribute", ::bgs::protocol::game_utilities::v1::GetAllValuesForAttributeResponse::descriptor());
-  ::bgs::protocol::game_utilities::v1::GetAllValuesForAttributeResponse response;
-  uint32 status = HandleGetAllValuesForAttribute(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::GetAllValuesForAttributeResponse> response(GetMessagePool());
+  uint32 status = HandleGetAllValuesForAttribute(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void GameUtilitiesService::ParseAndHandleRegisterUtilities(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::RegisterUtilitiesRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::RegisterUtilitiesRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.RegisterUtilities");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("GameUtilitiesService.RegisterUtilities", "bgs.protocol.game_utilities.v1.RegisterUtilitiesRequest", &request);
+  LogCallServerMethod("GameUtilitiesService.RegisterUtilities", "bgs.protocol.game_utilities.v1.RegisterUtilitiesRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "GameUtilitiesService.RegisterUtilities", ::bgs::protocol::game_utilities::v1::RegisterUtilitiesResponse::descriptor());
-  ::bgs::protocol::game_utilities::v1::RegisterUtilitiesResponse response;
-  uint32 status = HandleRegisterUtilities(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::RegisterUtilitiesResponse> response(GetMessagePool());
+  uint32 status = HandleRegisterUtilities(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void GameUtilitiesService::ParseAndHandleUnregisterUtilities(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::game_utilities::v1::UnregisterUtilitiesRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::game_utilities::v1::UnregisterUtilitiesRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("GameUtilitiesService.UnregisterUtilities");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  uint32 status = HandleUnregisterUtilities(&request);
-  LogCallServerMethod("GameUtilitiesService.UnregisterUtilities", "bgs.protocol.game_utilities.v1.UnregisterUtilitiesRequest", &request);
+  uint32 status = HandleUnregisterUtilities(request.get());
+  LogCallServerMethod("GameUtilitiesService.UnregisterUtilities", "bgs.protocol.game_utilities.v1.UnregisterUtilitiesRequest", request.get());
   if (status)
     SendResponse(service_hash_, methodId, token, status);
 }
@@ -280,7 +280,7 @@ class TC_PROTO_API NotificationService : public ServiceBase
 
   static google::protobuf::ServiceDescriptor const* descriptor();
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 
  protected:
   // server methods --------------------------------------------------
@@ -317,7 +317,7 @@ class TC_PROTO_API NotificationListener : public ServiceBase
   // client methods --------------------------------------------------
   void OnNotificationReceived(::bgs::protocol::notification::v1::Notification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
@@ -250,7 +250,7 @@ class TC_PROTO_API PresenceListener : public ServiceBase
   void OnSubscribe(::bgs::protocol::presence::v1::SubscribeNotification const* request, bool client = false, bool server = false);
   void OnStateChanged(::bgs::protocol::presence::v1::StateChangedNotification const* request, bool client = false, bool server = false);
 
-  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) final;
+  void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) final;
 };
 
 // ===================================================================
@@ -403,7 +403,7 @@ google::protobuf::ServiceDescriptor const* ResourcesService::descriptor() {
   return ResourcesService_descriptor_;
 }
 
-void ResourcesService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) {
+void ResourcesService::CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) {
   switch(methodId & 0x3FFFFFFF) {
     case 1:
       ParseAndHandleGetContentHandle(token, methodId, buffer);
@@ -429,33 +429,33 @@ uint32 ResourcesService::HandleGetTitleIcons(::bgs::protocol::resources::v1::Get
 }
 
 void ResourcesService::ParseAndHandleGetContentHandle(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::resources::v1::ContentHandleRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::resources::v1::ContentHandleRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ResourcesService.GetContentHandle");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ResourcesService.GetContentHandle", "bgs.protocol.resources.v1.ContentHandleRequest", &request);
+  LogCallServerMethod("ResourcesService.GetContentHandle", "bgs.protocol.resources.v1.ContentHandleRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ResourcesService.GetContentHandle", ::bgs::protocol::ContentHandle::descriptor());
-  ::bgs::protocol::ContentHandle response;
-  uint32 status = HandleGetContentHandle(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::ContentHandle> response(GetMessagePool());
+  uint32 status = HandleGetContentHandle(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 void ResourcesService::ParseAndHandleGetTitleIcons(uint32 token, uint32 methodId, MessageBuffer& buffer) {
-  ::bgs::protocol::resources::v1::GetTitleIconsRequest request;
-  if (!request.ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
+  PooledRpcMessage<::bgs::protocol::resources::v1::GetTitleIconsRequest> request(GetMessagePool());
+  if (!request->ParseFromArray(buffer.GetReadPointer(), buffer.GetActiveSize())) {
     LogFailedParsingRequest("ResourcesService.GetTitleIcons");
     SendResponse(service_hash_, methodId, token, ERROR_RPC_MALFORMED_REQUEST);
     return;
   }
-  LogCallServerMethod("ResourcesService.GetTitleIcons", "bgs.protocol.resources.v1.GetTitleIconsRequest", &request);
+  LogCallServerMethod("ResourcesService.GetTitleIcons", "bgs.protocol.resources.v1.GetTitleIconsRequest", request.get());
   std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> continuation = CreateServerContinuation(token, methodId, "ResourcesService.GetTitleIcons", ::bgs::protocol::resources::v1::GetTitleIconsResponse::descriptor());
-  ::bgs::protocol::resources::v1::GetTitleIconsResponse response;
-  uint32 status = HandleGetTitleIcons(&request, &response, continuation);
+  PooledRpcMessage<::bgs::protocol::resources::v1::GetTitleIconsResponse> response(GetMessagePool());
+  uint32 status = HandleGetTitleIcons(request.get(), response.get(), continuation);
   if (continuation)
-    continuation(this, status, &response);
+    continuation(this, status, response.get());
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -20,6 +20,27 @@
 #include "Log.h"
 #include <google/protobuf/message.h>
 
+RpcMessagePool::RpcMessagePool() = default;
+
+RpcMessagePool::~RpcMessagePool() = default;
+
+void RpcMessagePool::Release(std::unique_ptr<google::protobuf::Message> message)
+{
+    message->Clear();
+    std::unique_ptr<google::protobuf::Message>& slot = _messages[message->GetDescriptor()];
+    if (!slot)
+        slot = std::move(message);
+}
+
+std::unique_ptr<google::protobuf::Message> RpcMessagePool::Take(google::protobuf::Descriptor const* descriptor)
+{
+    auto itr = _messages.find(descriptor);
+    if (itr == _messages.end())
+        return nullptr;
+
+    return std::move(itr->second);
+}
+
 void ServiceBase::LogDisallowedMethod(uint32 methodId)
 {
     TC_LOG_ERROR("service.protobuf", "{} Server tried to call server method {}",
@@ -21,7 +21,9 @@
 #include "MessageBuffer.h"
 #include "Define.h"
 #include <functional>
+#include <memory>
 #include <string>
+#include <unordered_map>
 
 namespace google
 {
@@ -32,6 +34,63 @@ namespace google
     }
 }
 
+// Messages of the rpc calls handled for one session, given back after every call and reused by the next call of the same method.
+// Cleared messages keep the memory of their strings, repeated fields and submessages, so handling a call rarely allocates.
+class TC_PROTO_API RpcMessagePool
+{
+public:
+    RpcMessagePool();
+    ~RpcMessagePool();
+
+    RpcMessagePool(RpcMessagePool const&) = delete;
+    RpcMessagePool(RpcMessagePool&&) = delete;
+    RpcMessagePool& operator=(RpcMessagePool const&) = delete;
+    RpcMessagePool& operator=(RpcMessagePool&&) = delete;
+
+    template<class T>
+    std::unique_ptr<T> Acquire()
+    {
+        if (std::unique_ptr<google::protobuf::Message> message = Take(T::descriptor()))
+            return std::unique_ptr<T>(static_cast<T*>(message.release()));
+
+        return std::make_unique<T>();
+    }
+
+    void Release(std::unique_ptr<google::protobuf::Message> message);
+
+private:
+    std::unique_ptr<google::protobuf::Message> Take(google::protobuf::Descriptor const* descriptor);
+
+    // one spare message per type, a nested call of the same method allocates its own
+    std::unordered_map<google::protobuf::Descriptor const*, std::unique_ptr<google::protobuf::Message>> _messages;
+};
+
+template<class T>
+class PooledRpcMessage
+{
+public:
+    explicit PooledRpcMessage(RpcMessagePool* pool) : _pool(pool), _message(pool ? pool->Acquire<T>() : std::make_unique<T>()) { }
+
+    ~PooledRpcMessage()
+    {
+        if (_pool)
+            _pool->Release(std::move(_message));
+    }
+
+    PooledRpcMessage(PooledRpcMessage const&) = delete;
+    PooledRpcMessage(PooledRpcMessage&&) = delete;
+    PooledRpcMessage& operator=(PooledRpcMessage const&) = delete;
+    PooledRpcMessage& operator=(PooledRpcMessage&&) = delete;
+
+    T* get() const { return _message.get(); }
+    T* operator->() const { return _message.get(); }
+    T& operator*() const { return *_message; }
+
+private:
+    RpcMessagePool* _pool;
+    std::unique_ptr<T> _message;
+};
+
 class TC_PROTO_API ServiceBase
 {
 public:
@@ -39,7 +98,7 @@ public:
 
     virtual ~ServiceBase() { }
 
-    virtual void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer buffer) = 0;
+    virtual void CallServerMethod(uint32 token, uint32 methodId, MessageBuffer& buffer) = 0;
 
     virtual std::string GetCallerInfo() const = 0;
 
@@ -53,6 +112,9 @@ public:
     uint32 GetServiceHash() const { return service_hash_; }
 
 protected:
+    // messages of server method calls are taken from here, nullptr to allocate them for every call
+    virtual RpcMessagePool* GetMessagePool() { return nullptr; }
+
     std::function<void(ServiceBase*, uint32, ::google::protobuf::Message const*)> CreateServerContinuation(uint32 token, uint32 methodId, char const* methodName, google::protobuf::Descriptor const* outputDescriptor);
 
     virtual void SendRequest(uint32 serviceHash, uint32 methodId, google::protobuf::Message const* request, std::function<void(MessageBuffer)> callback) = 0;
@@ -45,9 +45,11 @@ EndScriptData */
 #include "MapManager.h"
 #include "MovementPackets.h"
 #include "ObjectAccessor.h"
+#include "MallocControl.h"
 #include "ObjectMgr.h"
 #include "PhasingHandler.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "RBAC.h"
 #include "SpellMgr.h"
 #include "SpellPackets.h"
@@ -127,7 +129,9 @@ public:
             { "asan memoryleak",    HandleDebugMemoryLeak,                 rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "asan outofbounds",   HandleDebugOutOfBounds,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "guidlimits",         HandleDebugGuidLimitsCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "memory",             HandleDebugMemoryCommand,              rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "objectcount",        HandleDebugObjectCountCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "profile",            HandleDebugProfileCommand,             rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "questreset",         HandleDebugQuestResetCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "personalclone",      HandleDebugBecomePersonalClone,        rbac::RBAC_PERM_COMMAND_DEBUG,   Console::No }
         };
@@ -1707,6 +1711,44 @@ public:
         return true;
     }
 
+    static bool HandleDebugMemoryCommand(ChatHandler* handler)
+    {
+        Optional<Trinity::MallocControl::Stats> stats = Trinity::MallocControl::GetStats();
+        if (!stats)
+        {
+            handler->SendSysMessage("Allocator statistics are only available on builds using jemalloc.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        auto toMiB = [](uint64 bytes) { return double(bytes) / (1024.0 * 1024.0); };
+
+        handler->PSendSysMessage("Allocated: %.1f MiB, active: %.1f MiB, resident: %.1f MiB, mapped: %.1f MiB, retained: %.1f MiB",
+            toMiB(stats->AllocatedBytes), toMiB(stats->ActiveBytes), toMiB(stats->ResidentBytes), toMiB(stats->MappedBytes), toMiB(stats->RetainedBytes));
+
+        for (Trinity::MallocControl::ArenaStats const& arena : stats->Arenas)
+            handler->PSendSysMessage("Arena %u: %u threads, allocated: %.1f MiB, active: %.1f MiB, dirty: %.1f MiB, muzzy: %.1f MiB",
+                arena.Index, arena.Threads, toMiB(arena.AllocatedBytes), toMiB(arena.ActiveBytes), toMiB(arena.DirtyBytes), toMiB(arena.MuzzyBytes));
+
+        return true;
+    }
+
+    static bool HandleDebugProfileCommand(ChatHandler* handler, Optional<uint32> seconds)
+    {
+        // ten seconds cover a hundred map ticks at the default update rate
+        uint32 duration = std::clamp<uint32>(seconds.value_or(10), 1, 300);
+        std::string path = sLog->GetLogsDir() + "profile_" + TimeToTimestampStr(GameTime::GetGameTime()) + ".json";
+        if (!sProfiler->StartCapture(Seconds(duration), path))
+        {
+            handler->SendSysMessage("A profile is already being captured.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        handler->PSendSysMessage("Capturing a profile for %u seconds, it will be written to %s", duration, path.c_str());
+        return true;
+    }
+
     class CreatureCountWorker
     {
     public:
@@ -35,6 +35,7 @@ EndScriptData */
 #include "CreatureTextMgr.h"
 #include "DatabaseEnv.h"
 #include "DisableMgr.h"
+#include "Hyperlinks.h"
 #include "ItemEnchantmentMgr.h"
 #include "Language.h"
 #include "LFGMgr.h"
@@ -456,6 +457,7 @@ public:
             sObjectMgr->CheckCreatureTemplate(cInfo);
         }
 
+        Trinity::Hyperlinks::ClearValidatedLinkCache();
         sObjectMgr->InitializeQueriesData(QUERY_DATA_CREATURES);
         sScriptMgr->NotifyScriptIDUpdate();
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
@@ -555,10 +557,8 @@ public:
     static bool HandleReloadLootTemplatesCreatureCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`creature_loot_template`)");
-        LoadLootTemplates_Creature();
-        LootTemplates_Creature.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `creature_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Creature.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `creature_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
@@ -573,109 +573,88 @@ public:
     static bool HandleReloadLootTemplatesDisenchantCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`disenchant_loot_template`)");
-        LoadLootTemplates_Disenchant();
-        LootTemplates_Disenchant.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `disenchant_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Disenchant.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `disenchant_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesFishingCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`fishing_loot_template`)");
-        LoadLootTemplates_Fishing();
-        LootTemplates_Fishing.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `fishing_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Fishing.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `fishing_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesGameobjectCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`gameobject_loot_template`)");
-        LoadLootTemplates_Gameobject();
-        LootTemplates_Gameobject.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `gameobject_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Gameobject.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `gameobject_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesItemCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`item_loot_template`)");
-        LoadLootTemplates_Item();
-        LootTemplates_Item.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `item_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Item.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `item_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesMillingCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`milling_loot_template`)");
-        LoadLootTemplates_Milling();
-        LootTemplates_Milling.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `milling_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Milling.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `milling_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesPickpocketingCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`pickpocketing_loot_template`)");
-        LoadLootTemplates_Pickpocketing();
-        LootTemplates_Pickpocketing.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `pickpocketing_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Pickpocketing.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `pickpocketing_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesProspectingCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`prospecting_loot_template`)");
-        LoadLootTemplates_Prospecting();
-        LootTemplates_Prospecting.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `prospecting_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Prospecting.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `prospecting_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesMailCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`mail_loot_template`)");
-        LoadLootTemplates_Mail();
-        LootTemplates_Mail.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `mail_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Mail.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `mail_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesReferenceCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`reference_loot_template`)");
-        LoadLootTemplates_Reference();
-        handler->SendGlobalGMSysMessage("DB table `reference_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Reference.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `reference_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesSkinningCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`skinning_loot_template`)");
-        LoadLootTemplates_Skinning();
-        LootTemplates_Skinning.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `skinning_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Skinning.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `skinning_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
     static bool HandleReloadLootTemplatesSpellCommand(ChatHandler* handler, char const* /*args*/)
     {
         TC_LOG_INFO("misc", "Re-Loading Loot Tables... (`spell_loot_template`)");
-        LoadLootTemplates_Spell();
-        LootTemplates_Spell.CheckLootRefs();
-        handler->SendGlobalGMSysMessage("DB table `spell_loot_template` reloaded.");
-        sConditionMgr->LoadConditions(true);
+        LootTemplates_Spell.ReloadInBackground();
+        handler->SendGlobalGMSysMessage("DB table `spell_loot_template` is being reloaded, the new loot is used once it finished loading.");
         return true;
     }
 
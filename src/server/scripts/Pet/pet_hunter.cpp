@@ -82,11 +82,11 @@ struct npc_pet_hunter_snake_trap : public ScriptedAI
                     targets.push_back(enemy);
             };
 
-            for (std::pair<ObjectGuid const, PvPCombatReference*> const& pair : summoner->GetCombatManager().GetPvPCombatRefs())
+            for (auto const& pair : summoner->GetCombatManager().GetPvPCombatRefs())
                 addTargetIfValid(pair.second);
 
             if (targets.empty())
-                for (std::pair<ObjectGuid const, CombatReference*> const& pair : summoner->GetCombatManager().GetPvECombatRefs())
+                for (auto const& pair : summoner->GetCombatManager().GetPvECombatRefs())
                     addTargetIfValid(pair.second);
 
             for (Unit* target : targets)
@@ -19,8 +19,11 @@
 #include "ByteBuffer.h"
 #include "DB2DatabaseLoader.h"
 #include "DB2FileSystemSource.h"
+#include "DB2MappedFileSource.h"
 #include "DB2Meta.h"
+#include "DB2StringArena.h"
 #include "StringFormat.h"
+#include <boost/interprocess/mapped_region.hpp>
 
 DB2StorageBase::DB2StorageBase(char const* fileName, DB2LoadInfo const* loadInfo)
     : _tableHash(0), _layoutHash(0), _fileName(fileName), _fieldCount(0), _loadInfo(loadInfo), _dataTable(nullptr), _dataTableEx(),
@@ -85,18 +88,38 @@ void DB2StorageBase::WriteRecord(uint32 id, LocaleConstant locale, ByteBuffer& b
     }
 }
 
-void DB2StorageBase::Load(std::string const& path, LocaleConstant locale)
+void DB2StorageBase::Load(std::string const& path, LocaleConstant locale, bool mapFile)
 {
     DB2FileLoader db2;
-    DB2FileSystemSource source(path + _fileName);
+    std::unique_ptr<DB2FileSource> source;
+    if (mapFile)
+    {
+        std::unique_ptr<DB2MappedFileSource> mappedSource = std::make_unique<DB2MappedFileSource>(path + _fileName);
+        if (mappedSource->IsOpen())
+            source = std::move(mappedSource);
+    }
+
+    if (!source)
+        source = std::make_unique<DB2FileSystemSource>(path + _fileName);
+
     // Check if load was successful, only then continue
-    db2.Load(&source, _loadInfo);
+    db2.Load(source.get(), _loadInfo);
 
     _fieldCount = db2.GetCols();
     _tableHash = db2.GetTableHash();
     _layoutHash = db2.GetLayoutHash();
     _minId = db2.GetMinId();
 
+    // records stored like the structure stay in the mapping, there are no strings to load for them
+    if (uint8* fileData = source->GetMappedData())
+    {
+        if (db2.AutoProduceDataInPlace(fileData, _indexTableSize, _indexTable, _dataTable))
+        {
+            _mappedFile = static_cast<DB2MappedFileSource*>(source.get())->ReleaseMapping();
+            return;
+        }
+    }
+
     // load raw non-string data
     _dataTable = db2.AutoProduceData(_indexTableSize, _indexTable);
 
@@ -133,6 +156,63 @@ void DB2StorageBase::LoadFromDB()
     _stringPool.shrink_to_fit();
 }
 
+void DB2StorageBase::InternStrings()
+{
+    if (!_loadInfo->GetStringFieldCount(false) || !_indexTable)
+        return;
+
+    std::unique_lock lock = sDB2StringArena.Lock();
+    for (uint32 id = 0; id < _indexTableSize; ++id)
+    {
+        char* entry = _indexTable[id];
+        if (!entry)
+            continue;
+
+        if (!_loadInfo->Meta->HasIndexFieldInData())
+            entry += 4;
+
+        for (uint32 i = 0; i < _loadInfo->Meta->FieldCount; ++i)
+        {
+            for (uint8 arr = 0; arr < _loadInfo->Meta->Fields[i].ArraySize; ++arr)
+            {
+                switch (_loadInfo->Meta->Fields[i].Type)
+                {
+                    case FT_INT:
+                    case FT_FLOAT:
+                        entry += 4;
+                        break;
+                    case FT_BYTE:
+                        entry += 1;
+                        break;
+                    case FT_SHORT:
+                        entry += 2;
+                        break;
+                    case FT_LONG:
+                        entry += 8;
+                        break;
+                    case FT_STRING:
+                        for (char const*& str : reinterpret_cast<LocalizedString*>(entry)->Str)
+                            if (str)
+                                str = sDB2StringArena.Intern(str);
+                        entry += sizeof(LocalizedString);
+                        break;
+                    case FT_STRING_NOT_LOCALIZED:
+                        if (char const*& str = *reinterpret_cast<char const**>(entry))
+                            str = sDB2StringArena.Intern(str);
+                        entry += sizeof(char const*);
+                        break;
+                }
+            }
+        }
+    }
+    lock.unlock();
+
+    for (char* strings : _stringPool)
+        delete[] strings;
+    _stringPool.clear();
+    _stringPool.shrink_to_fit();
+}
+
 void DB2StorageBase::LoadStringsFromDB(LocaleConstant locale)
 {
     if (!_loadInfo->GetStringFieldCount(true))
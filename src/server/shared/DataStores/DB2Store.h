@@ -21,11 +21,17 @@
 #include "Common.h"
 #include "Errors.h"
 #include "DBStorageIterator.h"
+#include <memory>
 #include <vector>
 
 class ByteBuffer;
 struct DB2LoadInfo;
 
+namespace boost::interprocess
+{
+class mapped_region;
+}
+
 /// Interface class for common access
 class TC_SHARED_API DB2StorageBase
 {
@@ -49,10 +55,13 @@ public:
     DB2LoadInfo const* GetLoadInfo() const { return _loadInfo; }
     uint32 GetNumRows() const { return _indexTableSize; }
 
-    void Load(std::string const& path, LocaleConstant locale);
+    // mapFile keeps the file mapped and points records into it when they are stored exactly like the structure
+    void Load(std::string const& path, LocaleConstant locale, bool mapFile = false);
     void LoadStringsFrom(std::string const& path, LocaleConstant locale);
     void LoadFromDB();
     void LoadStringsFromDB(LocaleConstant locale);
+    // Moves every string into DB2StringArena and frees the string blocks of all loaded locales, no strings can be loaded afterwards
+    void InternStrings();
 
 protected:
     uint32 _tableHash;
@@ -66,6 +75,7 @@ protected:
     char** _indexTable;
     uint32 _indexTableSize;
     uint32 _minId;
+    std::unique_ptr<boost::interprocess::mapped_region> _mappedFile;
 
     friend class UnitTestDataLoader;
 };
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DB2StringArena.h"
+#include <cstring>
+
+namespace
+{
+constexpr std::size_t BlockSize = 0x100000;
+}
+
+DB2StringArena::DB2StringArena() : _blockFree(0), _memoryUsage(0)
+{
+}
+
+DB2StringArena::~DB2StringArena() = default;
+
+DB2StringArena& DB2StringArena::Instance()
+{
+    static DB2StringArena instance;
+    return instance;
+}
+
+char const* DB2StringArena::Intern(std::string_view str)
+{
+    if (auto itr = _strings.find(str); itr != _strings.end())
+        return itr->data();
+
+    std::size_t size = str.size() + 1;
+    char* copy;
+    if (size > BlockSize / 4)
+    {
+        // long strings get their own allocation, the current block stays in use
+        copy = _largeStrings.emplace_back(new char[size]).get();
+        _memoryUsage += size;
+    }
+    else
+    {
+        if (size > _blockFree)
+        {
+            _blocks.emplace_back(new char[BlockSize]);
+            _blockFree = BlockSize;
+            _memoryUsage += BlockSize;
+        }
+
+        copy = _blocks.back().get() + BlockSize - _blockFree;
+        _blockFree -= size;
+    }
+
+    std::memcpy(copy, str.data(), str.size());
+    copy[str.size()] = '\0';
+    _strings.emplace(copy, str.size());
+    return copy;
+}
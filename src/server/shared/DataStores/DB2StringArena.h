@@ -0,0 +1,62 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DB2STRINGARENA_H
+#define DB2STRINGARENA_H
+
+#include "Define.h"
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+/// Strings of every loaded store, each distinct string is kept once whatever store or locale it came from
+class TC_SHARED_API DB2StringArena
+{
+public:
+    static DB2StringArena& Instance();
+
+    DB2StringArena(DB2StringArena const&) = delete;
+    DB2StringArena(DB2StringArena&&) = delete;
+    DB2StringArena& operator=(DB2StringArena const&) = delete;
+    DB2StringArena& operator=(DB2StringArena&&) = delete;
+
+    /// Held while interning the strings of one store, parallel loads lock once per store
+    std::unique_lock<std::mutex> Lock() { return std::unique_lock(_lock); }
+
+    /// Returns the null terminated copy of str owned by the arena, lock must be held
+    char const* Intern(std::string_view str);
+
+    std::size_t GetStringCount() const { return _strings.size(); }
+    std::size_t GetMemoryUsage() const { return _memoryUsage; }
+
+private:
+    DB2StringArena();
+    ~DB2StringArena();
+
+    std::mutex _lock;
+    std::unordered_set<std::string_view> _strings;     ///< views into _blocks, without the terminator
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    std::vector<std::unique_ptr<char[]>> _largeStrings;
+    std::size_t _blockFree;
+    std::size_t _memoryUsage;
+};
+
+#define sDB2StringArena DB2StringArena::Instance()
+
+#endif // DB2STRINGARENA_H
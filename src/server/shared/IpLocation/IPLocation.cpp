@@ -22,33 +22,208 @@
 #include "IpAddress.h"
 #include "Log.h"
 #include "Util.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <algorithm>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <unordered_map>
+
+//! Preprocessed tables as written to IPLocationFile.Cache, in host byte order
+//! header, ipv6 from, ipv6 to, ipv4 from, ipv4 to, ipv4 countries, ipv6 countries, country code and name strings
+struct IpLocationStore::CacheHeader
+{
+    static constexpr uint32 MagicValue = 0x434C5049; // "IPLC"
+    static constexpr uint32 VersionValue = 1;
+
+    uint32 Magic = MagicValue;
+    uint32 Version = VersionValue;
+    uint64 SourceSize = 0;
+    int64 SourceWriteTime = 0;
+    uint32 CountryCount = 0;
+    uint32 Ipv4Count = 0;
+    uint32 Ipv6Count = 0;
+    uint32 StringsSize = 0;
+
+    std::size_t GetDataSize() const
+    {
+        std::size_t size = sizeof(CacheHeader)
+            + Ipv6Count * sizeof(Ipv6Key) * 2
+            + Ipv4Count * sizeof(uint32) * 2
+            + (Ipv4Count + Ipv6Count) * sizeof(uint16)
+            + StringsSize;
+        return (size + sizeof(uint64) - 1) / sizeof(uint64);
+    }
+
+    bool IsSameSource(CacheHeader const& other) const
+    {
+        return Magic == other.Magic && Version == other.Version && SourceSize == other.SourceSize && SourceWriteTime == other.SourceWriteTime;
+    }
+};
+
+struct IpLocationStore::Ranges
+{
+    std::vector<IpLocationRecord> Countries;
+    std::vector<Ipv6Key> Ipv6From;
+    std::vector<Ipv6Key> Ipv6To;
+    std::vector<uint16> Ipv6Countries;
+    std::vector<uint32> Ipv4From;
+    std::vector<uint32> Ipv4To;
+    std::vector<uint16> Ipv4Countries;
+};
+
+namespace
+{
+//! Index of the last value not greater than value (values.size() if there is none), without branching on the comparisons
+template <typename T>
+std::size_t FindLastNotGreater(std::span<T const> values, T const& value)
+{
+    if (values.empty())
+        return values.size();
+
+    T const* base = values.data();
+    std::size_t length = values.size();
+    while (length > 1)
+    {
+        std::size_t half = length / 2;
+        base = base[half] <= value ? base + half : base;
+        length -= half;
+    }
+
+    return *base <= value ? std::size_t(base - values.data()) : values.size();
+}
+
+template <typename T>
+std::span<T const> TakeSpan(std::byte const*& position, std::size_t count)
+{
+    std::span<T const> result(reinterpret_cast<T const*>(position), count);
+    position += count * sizeof(T);
+    return result;
+}
+
+template <typename T>
+void Append(std::byte*& position, std::vector<T> const& values)
+{
+    if (!values.empty())
+        memcpy(position, values.data(), values.size() * sizeof(T));
+    position += values.size() * sizeof(T);
+}
+}
 
 IpLocationStore::IpLocationStore() = default;
 IpLocationStore::~IpLocationStore() = default;
 
 void IpLocationStore::Load()
 {
-    _ipLocationStore.clear();
     TC_LOG_INFO("server.loading", "Loading IP Location Database...");
 
     std::string databaseFilePath = sConfigMgr->GetStringDefault("IPLocationFile", "");
     if (databaseFilePath.empty())
+    {
+        Clear();
         return;
+    }
 
-    // Check if file exists
-    std::ifstream databaseFile(databaseFilePath);
-    if (!databaseFile)
+    LoadFromFile(databaseFilePath, sConfigMgr->GetStringDefault("IPLocationFile.Cache", ""));
+}
+
+bool IpLocationStore::LoadFromFile(std::string const& databaseFilePath, std::string const& cacheFilePath)
+{
+    Clear();
+
+    std::error_code error;
+    CacheHeader header;
+    header.SourceSize = std::filesystem::file_size(databaseFilePath, error);
+    if (error)
     {
         TC_LOG_ERROR("server.loading", "IPLocation: No ip database file exists ({}).", databaseFilePath);
-        return;
+        return false;
+    }
+
+    header.SourceWriteTime = std::filesystem::last_write_time(databaseFilePath, error).time_since_epoch().count();
+
+    if (!cacheFilePath.empty() && LoadCache(cacheFilePath, header))
+    {
+        TC_LOG_INFO("server.loading", ">> Mapped {} ip location entries from {}.", GetRangeCount(), cacheFilePath);
+        return true;
+    }
+
+    Ranges ranges;
+    if (!LoadCsv(databaseFilePath, ranges))
+        return false;
+
+    std::string strings;
+    for (IpLocationRecord const& country : ranges.Countries)
+    {
+        strings.append(country.CountryCode).push_back('\0');
+        strings.append(country.CountryName).push_back('\0');
+    }
+
+    header.CountryCount = uint32(ranges.Countries.size());
+    header.Ipv4Count = uint32(ranges.Ipv4From.size());
+    header.Ipv6Count = uint32(ranges.Ipv6From.size());
+    header.StringsSize = uint32(strings.size());
+
+    _data.resize(header.GetDataSize());
+    std::byte* position = reinterpret_cast<std::byte*>(_data.data());
+    memcpy(position, &header, sizeof(header));
+    position += sizeof(header);
+    Append(position, ranges.Ipv6From);
+    Append(position, ranges.Ipv6To);
+    Append(position, ranges.Ipv4From);
+    Append(position, ranges.Ipv4To);
+    Append(position, ranges.Ipv4Countries);
+    Append(position, ranges.Ipv6Countries);
+    memcpy(position, strings.data(), strings.size());
+
+    bool tablesSet = SetTables(_data, header);
+    ASSERT(tablesSet);
+
+    TC_LOG_INFO("server.loading", ">> Loaded {} ip location entries.", GetRangeCount());
+
+    if (cacheFilePath.empty())
+        return true;
+
+    // written next to the cache first, processes loading at the same time either map the old file or the complete new one
+    std::string temporaryFilePath = cacheFilePath + ".tmp";
+    {
+        std::ofstream cacheFile(temporaryFilePath, std::ios::binary | std::ios::trunc);
+        cacheFile.write(reinterpret_cast<char const*>(_data.data()), std::streamsize(_data.size() * sizeof(uint64)));
+        if (!cacheFile)
+        {
+            TC_LOG_ERROR("server.loading", "IPLocation: Could not write ip database cache file ({}).", temporaryFilePath);
+            return true;
+        }
     }
 
+    std::filesystem::rename(temporaryFilePath, cacheFilePath, error);
+    if (error)
+        TC_LOG_ERROR("server.loading", "IPLocation: Could not replace ip database cache file ({}): {}.", cacheFilePath, error.message());
+
+    return true;
+}
+
+void IpLocationStore::Clear()
+{
+    _countries.clear();
+    _ipv4From = {};
+    _ipv4To = {};
+    _ipv4Countries = {};
+    _ipv6From = {};
+    _ipv6To = {};
+    _ipv6Countries = {};
+    _data.clear();
+    _mapping.reset();
+}
+
+bool IpLocationStore::LoadCsv(std::string const& databaseFilePath, Ranges& ranges) const
+{
+    std::ifstream databaseFile(databaseFilePath);
     if (!databaseFile.is_open())
     {
         TC_LOG_ERROR("server.loading", "IPLocation: Ip database file ({}) can not be opened.", databaseFilePath);
-        return;
+        return false;
     }
 
     std::string ipFrom;
@@ -60,17 +235,33 @@ void IpLocationStore::Load()
     BigNumber ipv6MappedMask(0xFFFF);
     ipv6MappedMask <<= 32;
 
-    auto parseStringToIPv6 = [&](std::string const& str) -> Optional<std::array<uint8, 16>>
+    auto parseStringToIPv6 = [&](std::string const& str) -> Optional<Ipv6Key>
     {
-        bnParser.SetDecStr(str);
         if (!bnParser.SetDecStr(str))
             return {};
         // convert ipv4 to ipv6 v4 mapped value
         if (bnParser <= ipv4Max)
             bnParser += ipv6MappedMask;
-        return bnParser.ToByteArray<16>(false);
+
+        std::array<uint8, 16> bytes = bnParser.ToByteArray<16>(false);
+        Ipv6Key key = { };
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            key.High = (key.High << 8) | bytes[i];
+            key.Low = (key.Low << 8) | bytes[i + 8];
+        }
+        return key;
+    };
+
+    struct Range
+    {
+        Ipv6Key From;
+        Ipv6Key To;
+        uint16 Country;
     };
 
+    std::vector<Range> csvRanges;
+    std::unordered_map<std::string, uint16> countryIndexes;
     while (databaseFile.good())
     {
         // Read lines
@@ -98,24 +289,123 @@ void IpLocationStore::Load()
         // Convert country code to lowercase
         strToLower(countryCode);
 
-        Optional<std::array<uint8, 16>> from = parseStringToIPv6(ipFrom);
+        Optional<Ipv6Key> from = parseStringToIPv6(ipFrom);
         if (!from)
             continue;
 
-        Optional<std::array<uint8, 16>> to = parseStringToIPv6(ipTo);
+        Optional<Ipv6Key> to = parseStringToIPv6(ipTo);
         if (!to)
             continue;
 
-        _ipLocationStore.emplace_back(*from, *to, std::move(countryCode), std::move(countryName));
+        auto [country, inserted] = countryIndexes.try_emplace(countryCode, uint16(ranges.Countries.size()));
+        if (inserted)
+        {
+            ASSERT(ranges.Countries.size() < std::numeric_limits<uint16>::max(), "Too many countries in ip database file");
+            ranges.Countries.emplace_back(std::move(countryCode), std::move(countryName));
+        }
+
+        csvRanges.push_back({ .From = *from, .To = *to, .Country = country->second });
     }
 
-    std::ranges::sort(_ipLocationStore, {}, &IpLocationRecord::IpFrom);
-    ASSERT(std::ranges::is_sorted(_ipLocationStore, [](IpLocationRecord const& a, IpLocationRecord const& b) { return a.IpFrom < b.IpTo; }),
+    std::ranges::sort(csvRanges, {}, &Range::From);
+    ASSERT(std::ranges::adjacent_find(csvRanges, [](Range const& a, Range const& b) { return a.To >= b.From; }) == csvRanges.end(),
         "Overlapping IP ranges detected in database file");
 
-    databaseFile.close();
+    // ipv4 mapped addresses go to the ipv4 table, ranges crossing the borders of ::ffff:0:0/96 are split
+    Ipv6Key constexpr mappedFirst = { .High = 0, .Low = 0xFFFF00000000 };
+    Ipv6Key constexpr mappedLast = { .High = 0, .Low = 0xFFFFFFFFFFFF };
+    auto addIpv6 = [&](Ipv6Key from, Ipv6Key to, uint16 country)
+    {
+        ranges.Ipv6From.push_back(from);
+        ranges.Ipv6To.push_back(to);
+        ranges.Ipv6Countries.push_back(country);
+    };
+
+    for (Range const& range : csvRanges)
+    {
+        if (range.To < mappedFirst || range.From > mappedLast)
+        {
+            addIpv6(range.From, range.To, range.Country);
+            continue;
+        }
+
+        if (range.From < mappedFirst)
+            addIpv6(range.From, { .High = 0, .Low = mappedFirst.Low - 1 }, range.Country);
+
+        ranges.Ipv4From.push_back(uint32(std::max(range.From, mappedFirst).Low));
+        ranges.Ipv4To.push_back(uint32(std::min(range.To, mappedLast).Low));
+        ranges.Ipv4Countries.push_back(range.Country);
+
+        if (range.To > mappedLast)
+            addIpv6({ .High = 0, .Low = mappedLast.Low + 1 }, range.To, range.Country);
+    }
+
+    return true;
+}
+
+bool IpLocationStore::LoadCache(std::string const& cacheFilePath, CacheHeader const& expectedHeader)
+{
+    std::error_code error;
+    if (!std::filesystem::exists(cacheFilePath, error))
+        return false;
+
+    try
+    {
+        boost::interprocess::file_mapping file(cacheFilePath.c_str(), boost::interprocess::read_only);
+        _mapping = std::make_unique<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const& e)
+    {
+        TC_LOG_ERROR("server.loading", "IPLocation: Ip database cache file ({}) can not be mapped: {}.", cacheFilePath, e.what());
+        return false;
+    }
+
+    std::span<uint64 const> data(static_cast<uint64 const*>(_mapping->get_address()), _mapping->get_size() / sizeof(uint64));
+    if (data.size() * sizeof(uint64) != _mapping->get_size() || !SetTables(data, expectedHeader))
+    {
+        TC_LOG_INFO("server.loading", "IPLocation: Ip database cache file ({}) is outdated or broken, rebuilding it.", cacheFilePath);
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool IpLocationStore::SetTables(std::span<uint64 const> data, CacheHeader const& expectedHeader)
+{
+    static_assert(sizeof(CacheHeader) % sizeof(uint64) == 0, "tables following the header must stay aligned");
+
+    CacheHeader header;
+    if (data.size() * sizeof(uint64) < sizeof(header))
+        return false;
+
+    memcpy(&header, data.data(), sizeof(header));
+    if (!header.IsSameSource(expectedHeader) || header.GetDataSize() != data.size())
+        return false;
 
-    TC_LOG_INFO("server.loading", ">> Loaded {} ip location entries.", _ipLocationStore.size());
+    std::byte const* position = reinterpret_cast<std::byte const*>(data.data()) + sizeof(header);
+    _ipv6From = TakeSpan<Ipv6Key>(position, header.Ipv6Count);
+    _ipv6To = TakeSpan<Ipv6Key>(position, header.Ipv6Count);
+    _ipv4From = TakeSpan<uint32>(position, header.Ipv4Count);
+    _ipv4To = TakeSpan<uint32>(position, header.Ipv4Count);
+    _ipv4Countries = TakeSpan<uint16>(position, header.Ipv4Count);
+    _ipv6Countries = TakeSpan<uint16>(position, header.Ipv6Count);
+    std::span<char const> strings = TakeSpan<char>(position, header.StringsSize);
+
+    _countries.reserve(header.CountryCount);
+    while (!strings.empty() && _countries.size() < header.CountryCount)
+    {
+        std::string code(strings.data(), strnlen(strings.data(), strings.size()));
+        strings = strings.subspan(std::min(code.size() + 1, strings.size()));
+        std::string name(strings.data(), strnlen(strings.data(), strings.size()));
+        strings = strings.subspan(std::min(name.size() + 1, strings.size()));
+        _countries.emplace_back(std::move(code), std::move(name));
+    }
+
+    auto isValidCountry = [&](uint16 country) { return country < _countries.size(); };
+    return _countries.size() == header.CountryCount
+        && std::ranges::all_of(_ipv4Countries, isValidCountry) && std::ranges::all_of(_ipv6Countries, isValidCountry)
+        && std::ranges::is_sorted(_ipv4From) && std::ranges::is_sorted(_ipv6From);
 }
 
 IpLocationRecord const* IpLocationStore::GetLocationRecord(std::string const& ipAddress) const
@@ -125,22 +415,48 @@ IpLocationRecord const* IpLocationStore::GetLocationRecord(std::string const& ip
     if (error)
         return nullptr;
 
-    std::array<uint8, 16> bytes = [&]() -> std::array<uint8, 16>
+    return GetLocationRecord(address);
+}
+
+IpLocationRecord const* IpLocationStore::GetLocationRecord(boost::asio::ip::address const& address) const
+{
+    if (address.is_v4())
+        return GetIpv4LocationRecord(Trinity::Net::address_to_uint(address.to_v4()));
+
+    if (!address.is_v6())
+        return nullptr;
+
+    boost::asio::ip::address_v6 v6 = address.to_v6();
+    if (v6.is_v4_mapped())
+        return GetIpv4LocationRecord(Trinity::Net::address_to_uint(Trinity::Net::make_address_v4(Trinity::Net::v4_mapped, v6)));
+
+    std::array<uint8, 16> bytes = v6.to_bytes();
+    Ipv6Key key = { };
+    for (std::size_t i = 0; i < 8; ++i)
     {
-        if (address.is_v6())
-            return address.to_v6().to_bytes();
-        if (address.is_v4())
-            return Trinity::Net::make_address_v6(Trinity::Net::v4_mapped, address.to_v4()).to_bytes();
-        return {};
-    }();
-    auto itr = std::ranges::upper_bound(_ipLocationStore, bytes, {}, &IpLocationRecord::IpTo);
-    if (itr == _ipLocationStore.end())
+        key.High = (key.High << 8) | bytes[i];
+        key.Low = (key.Low << 8) | bytes[i + 8];
+    }
+
+    return GetIpv6LocationRecord(key);
+}
+
+IpLocationRecord const* IpLocationStore::GetIpv4LocationRecord(uint32 address) const
+{
+    std::size_t index = FindLastNotGreater(_ipv4From, address);
+    if (index >= _ipv4From.size() || address > _ipv4To[index])
         return nullptr;
 
-    if (bytes < itr->IpFrom)
+    return &_countries[_ipv4Countries[index]];
+}
+
+IpLocationRecord const* IpLocationStore::GetIpv6LocationRecord(Ipv6Key const& address) const
+{
+    std::size_t index = FindLastNotGreater(_ipv6From, address);
+    if (index >= _ipv6From.size() || address > _ipv6To[index])
         return nullptr;
 
-    return &(*itr);
+    return &_countries[_ipv6Countries[index]];
 }
 
 IpLocationStore* IpLocationStore::Instance()
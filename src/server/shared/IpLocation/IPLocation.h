@@ -18,19 +18,25 @@
 #ifndef IPLOCATION_H
 #define IPLOCATION_H
 
+#include "AsioHacksFwd.h"
 #include "Define.h"
-#include <array>
+#include <compare>
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
+namespace boost::interprocess
+{
+class mapped_region;
+}
+
 struct IpLocationRecord
 {
-    IpLocationRecord() : IpFrom(), IpTo() { }
-    IpLocationRecord(std::array<uint8, 16> ipFrom, std::array<uint8, 16> ipTo, std::string&& countryCode, std::string&& countryName)
-        : IpFrom(ipFrom), IpTo(ipTo), CountryCode(std::move(countryCode)), CountryName(std::move(countryName)) { }
+    IpLocationRecord() = default;
+    IpLocationRecord(std::string&& countryCode, std::string&& countryName)
+        : CountryCode(std::move(countryCode)), CountryName(std::move(countryName)) { }
 
-    std::array<uint8, 16> IpFrom;
-    std::array<uint8, 16> IpTo;
     std::string CountryCode;
     std::string CountryName;
 };
@@ -47,10 +53,50 @@ class TC_SHARED_API IpLocationStore
         static IpLocationStore* Instance();
 
         void Load();
+
+        //! Loads the ranges of an IP2Location csv file. If cacheFilePath is not empty the ranges are mapped from that file
+        //! when it was made from the same csv file, otherwise it is (re)written after parsing the csv file
+        bool LoadFromFile(std::string const& databaseFilePath, std::string const& cacheFilePath);
+
         IpLocationRecord const* GetLocationRecord(std::string const& ipAddress) const;
+        IpLocationRecord const* GetLocationRecord(boost::asio::ip::address const& address) const;
+
+        std::size_t GetRangeCount() const { return _ipv4From.size() + _ipv6From.size(); }
 
     private:
-        std::vector<IpLocationRecord> _ipLocationStore;
+        struct Ipv6Key
+        {
+            uint64 High;
+            uint64 Low;
+
+            friend std::strong_ordering operator<=>(Ipv6Key const& left, Ipv6Key const& right) = default;
+        };
+
+        struct CacheHeader;
+        struct Ranges;
+
+        void Clear();
+        bool LoadCsv(std::string const& databaseFilePath, Ranges& ranges) const;
+        bool LoadCache(std::string const& cacheFilePath, CacheHeader const& expectedHeader);
+        bool SetTables(std::span<uint64 const> data, CacheHeader const& expectedHeader);
+
+        IpLocationRecord const* GetIpv4LocationRecord(uint32 address) const;
+        IpLocationRecord const* GetIpv6LocationRecord(Ipv6Key const& address) const;
+
+        //! Countries are stored once, ranges refer to them by index
+        std::vector<IpLocationRecord> _countries;
+
+        //! Sorted, non overlapping ranges (both ends included), ipv4 and ipv4 mapped addresses are only in the ipv4 table
+        std::span<uint32 const> _ipv4From;
+        std::span<uint32 const> _ipv4To;
+        std::span<uint16 const> _ipv4Countries;
+        std::span<Ipv6Key const> _ipv6From;
+        std::span<Ipv6Key const> _ipv6To;
+        std::span<uint16 const> _ipv6Countries;
+
+        //! Backing storage of the tables, laid out like the cache file
+        std::vector<uint64> _data;
+        std::unique_ptr<boost::interprocess::mapped_region> _mapping;
 };
 
 #define sIPLocation IpLocationStore::Instance()
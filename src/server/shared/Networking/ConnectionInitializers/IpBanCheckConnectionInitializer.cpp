@@ -18,8 +18,14 @@
 #include "IpBanCheckConnectionInitializer.h"
 #include "DatabaseEnv.h"
 #include "IpAddress.h"
+#include "IpBanList.h"
 #include "Log.h"
 
+Optional<bool> Trinity::Net::IpBanCheckHelpers::IsBannedInList(boost::asio::ip::address const& ipAddress)
+{
+    return sIpBanList->IsBanned(ipAddress, time(nullptr));
+}
+
 QueryCallback Trinity::Net::IpBanCheckHelpers::AsyncQuery(boost::asio::ip::address const& ipAddress)
 {
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_INFO);
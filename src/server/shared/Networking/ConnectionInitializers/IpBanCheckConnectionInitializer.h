@@ -20,6 +20,7 @@
 
 #include "AsioHacksFwd.h"
 #include "DatabaseEnvFwd.h"
+#include "Optional.h"
 #include "QueryCallback.h"
 #include "SocketConnectionInitializer.h"
 
@@ -27,6 +28,7 @@ namespace Trinity::Net
 {
 namespace IpBanCheckHelpers
 {
+TC_SHARED_API Optional<bool> IsBannedInList(boost::asio::ip::address const& ipAddress);
 TC_SHARED_API QueryCallback AsyncQuery(boost::asio::ip::address const& ipAddress);
 TC_SHARED_API bool IsBanned(PreparedQueryResult const& result);
 TC_SHARED_API void LogFailure(boost::asio::ip::address const& ipAddress);
@@ -39,6 +41,19 @@ struct IpBanCheckConnectionInitializer final : SocketConnectionInitializer
 
     void Start() override
     {
+        if (Optional<bool> banned = IpBanCheckHelpers::IsBannedInList(_socket->GetRemoteIpAddress()))
+        {
+            if (*banned)
+            {
+                IpBanCheckHelpers::LogFailure(_socket->GetRemoteIpAddress());
+                _socket->CloseSocket();
+                return;
+            }
+
+            this->InvokeNext();
+            return;
+        }
+
         _socket->QueueQuery(IpBanCheckHelpers::AsyncQuery(_socket->GetRemoteIpAddress()).WithPreparedCallback([socketRef = _socket->weak_from_this(), self = this->shared_from_this()](PreparedQueryResult const& result)
         {
             std::shared_ptr<SocketImpl> socket = static_pointer_cast<SocketImpl>(socketRef.lock());
@@ -0,0 +1,156 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "IpBanList.h"
+#include "DatabaseEnv.h"
+#include "DeadlineTimer.h"
+#include "IoContext.h"
+#include "IpAddress.h"
+#include "Log.h"
+
+IpBanList::IpBanList() : _settledChanges(0), _updateInterval(0)
+{
+}
+
+IpBanList::~IpBanList() = default;
+
+IpBanList* IpBanList::Instance()
+{
+    static IpBanList instance;
+    return &instance;
+}
+
+void IpBanList::Initialize(Trinity::Asio::IoContext& ioContext, uint32 updateInterval)
+{
+    _updateInterval = updateInterval;
+    if (!_updateInterval)
+        return;
+
+    _updateTimer = std::make_unique<Trinity::Asio::DeadlineTimer>(ioContext);
+    Update();
+}
+
+void IpBanList::Close()
+{
+    if (_updateTimer)
+        _updateTimer->cancel();
+}
+
+bool IpBanList::IsEnabled() const
+{
+    std::scoped_lock lock(_snapshotMutex);
+    return _snapshot != nullptr;
+}
+
+Optional<bool> IpBanList::IsBanned(boost::asio::ip::address const& address, time_t now) const
+{
+    std::shared_ptr<BanMap const> snapshot;
+    {
+        std::scoped_lock lock(_snapshotMutex);
+        snapshot = _snapshot;
+    }
+
+    if (!snapshot)
+        return {};
+
+    auto itr = snapshot->find(address.to_string());
+    if (itr == snapshot->end())
+        return false;
+
+    return !itr->second || itr->second > now;
+}
+
+void IpBanList::AddBan(std::string const& ip, time_t unbanDate)
+{
+    ApplyChange(ip, unbanDate);
+}
+
+void IpBanList::RemoveBan(std::string const& ip)
+{
+    ApplyChange(ip, {});
+}
+
+void IpBanList::Load(std::unordered_map<std::string, time_t> bans)
+{
+    Publish(std::move(bans));
+}
+
+void IpBanList::Update()
+{
+    TC_LOG_DEBUG("server", "Updating ip ban list...");
+
+    BanMap bans;
+    if (PreparedQueryResult result = LoginDatabase.Query(LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_BANNED_ACTIVE)))
+    {
+        bans.reserve(result->GetRowCount());
+        do
+        {
+            Field* fields = result->Fetch();
+            bans[fields[0].GetString()] = fields[1].GetUInt64() ? 0 : time_t(fields[2].GetUInt32());
+        } while (result->NextRow());
+    }
+
+    Publish(std::move(bans));
+
+    _updateTimer->expires_after(std::chrono::seconds(_updateInterval));
+    _updateTimer->async_wait([this](boost::system::error_code const& error)
+    {
+        if (error)
+            return;
+
+        Update();
+    });
+}
+
+void IpBanList::Publish(BanMap&& bans)
+{
+    std::scoped_lock lock(_snapshotMutex);
+
+    // changes older than the previous reload are in the database by now
+    _changes.erase(_changes.begin(), _changes.begin() + _settledChanges);
+    _settledChanges = _changes.size();
+
+    for (auto const& [ip, unbanDate] : _changes)
+    {
+        if (unbanDate)
+            bans[ip] = *unbanDate;
+        else
+            bans.erase(ip);
+    }
+
+    std::size_t count = bans.size();
+    _snapshot = std::make_shared<BanMap const>(std::move(bans));
+    TC_LOG_DEBUG("server", "Loaded {} active ip bans", count);
+}
+
+void IpBanList::ApplyChange(std::string const& ip, Optional<time_t> unbanDate)
+{
+    std::scoped_lock lock(_snapshotMutex);
+    if (!_snapshot)
+        return;
+
+    _changes.emplace_back(ip, unbanDate);
+
+    std::shared_ptr<BanMap> bans = std::make_shared<BanMap>(*_snapshot);
+    if (unbanDate)
+        (*bans)[ip] = *unbanDate;
+    else
+        bans->erase(ip);
+
+    _snapshot = std::move(bans);
+}
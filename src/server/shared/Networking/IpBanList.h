@@ -0,0 +1,83 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRINITYCORE_IP_BAN_LIST_H
+#define TRINITYCORE_IP_BAN_LIST_H
+
+#include "AsioHacksFwd.h"
+#include "Define.h"
+#include "Optional.h"
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Active ip bans kept in memory so that accepted connections are not held back by a login database query each
+class TC_SHARED_API IpBanList
+{
+public:
+    static IpBanList* Instance();
+
+    IpBanList(IpBanList const&) = delete;
+    IpBanList(IpBanList&&) = delete;
+    IpBanList& operator=(IpBanList const&) = delete;
+    IpBanList& operator=(IpBanList&&) = delete;
+
+    ~IpBanList();
+
+    /// Loads the list and reloads it every updateInterval seconds, 0 keeps it disabled
+    void Initialize(Trinity::Asio::IoContext& ioContext, uint32 updateInterval);
+    void Close();
+
+    bool IsEnabled() const;
+
+    /// Empty while the list is disabled, the caller has to ask the database then
+    Optional<bool> IsBanned(boost::asio::ip::address const& address, time_t now) const;
+
+    /// Bans issued and lifted by this process are applied right away, others show up on the next reload
+    void AddBan(std::string const& ip, time_t unbanDate);
+    void RemoveBan(std::string const& ip);
+
+    /// Replaces the list without a database, used by tests
+    void Load(std::unordered_map<std::string, time_t> bans);
+
+private:
+    // ip -> unban date, 0 for permanent bans
+    using BanMap = std::unordered_map<std::string, time_t>;
+
+    IpBanList();
+
+    void Update();
+    void Publish(BanMap&& bans);
+    void ApplyChange(std::string const& ip, Optional<time_t> unbanDate);
+
+    // only guards swapping the pointer, readers keep their snapshot for as long as they need it
+    mutable std::mutex _snapshotMutex;
+    std::shared_ptr<BanMap const> _snapshot;
+    // changes made since the last reload, the async writes might not have reached the database when the next one runs
+    std::vector<std::pair<std::string, Optional<time_t>>> _changes;
+    std::size_t _settledChanges;
+    uint32 _updateInterval;
+    std::unique_ptr<Trinity::Asio::DeadlineTimer> _updateTimer;
+};
+
+#define sIpBanList IpBanList::Instance()
+
+#endif // TRINITYCORE_IP_BAN_LIST_H
@@ -0,0 +1,150 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketBufferPool.h"
+#include <array>
+#include <bit>
+#include <mutex>
+
+namespace
+{
+constexpr std::size_t NumSizeClasses = std::countr_zero(PacketBufferPool::MaxBufferSize) - std::countr_zero(PacketBufferPool::MinBufferSize) + 1;
+
+// buffers kept per size class by each thread, half of them are moved to the shared pool on overflow
+constexpr std::size_t MaxThreadCachedBuffers = 32;
+// buffers moved between a thread cache and the shared pool at once
+constexpr std::size_t TransferBatchSize = MaxThreadCachedBuffers / 2;
+// upper bound of memory held by the shared pool per size class
+constexpr std::size_t MaxSharedBytesPerClass = 4 * 1024 * 1024;
+
+constexpr std::size_t GetClassSize(std::size_t sizeClass)
+{
+    return PacketBufferPool::MinBufferSize << sizeClass;
+}
+
+// smallest class able to hold capacity bytes
+std::size_t GetAcquireClass(std::size_t capacity)
+{
+    if (capacity <= PacketBufferPool::MinBufferSize)
+        return 0;
+
+    return std::bit_width(capacity - 1) - std::countr_zero(PacketBufferPool::MinBufferSize);
+}
+
+// largest class whose requests a buffer of given capacity can serve
+std::size_t GetReleaseClass(std::size_t capacity)
+{
+    return std::bit_width(capacity) - 1 - std::countr_zero(PacketBufferPool::MinBufferSize);
+}
+
+using BufferList = std::vector<std::vector<uint8>>;
+
+struct SharedPool
+{
+    struct SizeClass
+    {
+        std::mutex Lock;
+        BufferList Buffers;
+    };
+
+    std::array<SizeClass, NumSizeClasses> Classes;
+
+    static SharedPool& Instance()
+    {
+        // leaked on purpose, thread caches flush into it during thread exit which may happen after static destruction
+        static SharedPool* instance = new SharedPool();
+        return *instance;
+    }
+
+    void Take(std::size_t sizeClass, BufferList& destination)
+    {
+        SizeClass& pool = Classes[sizeClass];
+        std::scoped_lock lock(pool.Lock);
+        while (!pool.Buffers.empty() && destination.size() < TransferBatchSize)
+        {
+            destination.push_back(std::move(pool.Buffers.back()));
+            pool.Buffers.pop_back();
+        }
+    }
+
+    void Give(std::size_t sizeClass, BufferList& source, std::size_t count)
+    {
+        std::size_t maxBuffers = std::max<std::size_t>(MaxSharedBytesPerClass / GetClassSize(sizeClass), TransferBatchSize);
+        SizeClass& pool = Classes[sizeClass];
+        std::scoped_lock lock(pool.Lock);
+        for (; count && !source.empty(); --count)
+        {
+            if (pool.Buffers.size() < maxBuffers)
+                pool.Buffers.push_back(std::move(source.back()));
+
+            source.pop_back();
+        }
+    }
+};
+
+struct ThreadCache
+{
+    std::array<BufferList, NumSizeClasses> Classes;
+
+    ~ThreadCache()
+    {
+        for (std::size_t sizeClass = 0; sizeClass < NumSizeClasses; ++sizeClass)
+            SharedPool::Instance().Give(sizeClass, Classes[sizeClass], Classes[sizeClass].size());
+    }
+};
+
+thread_local ThreadCache LocalCache;
+}
+
+std::vector<uint8> PacketBufferPool::Acquire(std::size_t capacity)
+{
+    std::vector<uint8> buffer;
+    if (capacity > MaxBufferSize)
+    {
+        buffer.reserve(capacity);
+        return buffer;
+    }
+
+    std::size_t sizeClass = GetAcquireClass(capacity);
+    BufferList& cached = LocalCache.Classes[sizeClass];
+    if (cached.empty())
+        SharedPool::Instance().Take(sizeClass, cached);
+
+    if (!cached.empty())
+    {
+        buffer = std::move(cached.back());
+        cached.pop_back();
+        buffer.clear();
+    }
+    else
+        buffer.reserve(GetClassSize(sizeClass));
+
+    return buffer;
+}
+
+void PacketBufferPool::Release(std::vector<uint8>&& buffer)
+{
+    std::size_t capacity = buffer.capacity();
+    if (capacity < MinBufferSize || capacity > MaxBufferSize * 2)
+        return;
+
+    std::size_t sizeClass = std::min(GetReleaseClass(capacity), NumSizeClasses - 1);
+    BufferList& cached = LocalCache.Classes[sizeClass];
+    cached.push_back(std::move(buffer));
+    if (cached.size() > MaxThreadCachedBuffers)
+        SharedPool::Instance().Give(sizeClass, cached, TransferBatchSize);
+}
@@ -0,0 +1,43 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PACKET_BUFFER_POOL_H
+#define TRINITYCORE_PACKET_BUFFER_POOL_H
+
+#include "Define.h"
+#include <vector>
+
+/*
+ * Recycles packet storage so that building and sending a packet does not hit the allocator.
+ * Buffers are grouped in power of two size classes, each thread keeps a small cache per class and
+ * exchanges batches with a shared pool - packets are usually built on map threads and released on
+ * network threads, so buffers have to flow back between them.
+ */
+class TC_SHARED_API PacketBufferPool
+{
+public:
+    static constexpr std::size_t MinBufferSize = 0x100;
+    static constexpr std::size_t MaxBufferSize = 0x10000;
+
+    // Returns an empty vector with at least capacity bytes reserved
+    static std::vector<uint8> Acquire(std::size_t capacity);
+
+    // Hands the storage of a no longer needed packet back to the pool, buffers outside of pooled size classes are freed
+    static void Release(std::vector<uint8>&& buffer);
+};
+
+#endif // TRINITYCORE_PACKET_BUFFER_POOL_H
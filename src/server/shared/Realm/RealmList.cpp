@@ -51,7 +51,7 @@ bool CompressJson(std::string const& json, std::vector<uint8>* compressed)
 }
 }
 
-RealmList::RealmList() : _updateInterval(0)
+RealmList::RealmList() : _snapshot(std::make_shared<Snapshot const>()), _updateInterval(0)
 {
 }
 
@@ -106,11 +106,12 @@ void RealmList::UpdateRealms()
     PreparedQueryResult result = LoginDatabase.Query(stmt);
 
     std::map<Battlenet::RealmHandle, std::string> existingRealms;
-    for (auto const& p : _realms)
+    for (auto const& p : GetSnapshot()->Realms)
         existingRealms[p.first] = p.second->Name;
 
-    std::unordered_set<std::string> newSubRegions;
-    RealmMap newRealms;
+    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>();
+    std::unordered_set<std::string>& newSubRegions = snapshot->SubRegions;
+    RealmMap& newRealms = snapshot->Realms;
 
     // Circle through results and add them to the realm map
     if (result)
@@ -186,16 +187,16 @@ void RealmList::UpdateRealms()
     for (auto itr = existingRealms.begin(); itr != existingRealms.end(); ++itr)
         TC_LOG_INFO("realmlist", "Removed realm \"{}\".", itr->second);
 
-    {
-        std::scoped_lock lock(_realmsMutex);
+    snapshot->RemovedRealms.swap(existingRealms);
+    BuildResponses(*snapshot);
 
-        _subRegions.swap(newSubRegions);
-        _realms.swap(newRealms);
-        _removedRealms.swap(existingRealms);
+    if (_currentRealmId)
+        if (std::shared_ptr<Realm> realm = Trinity::Containers::MapGetValuePtr(snapshot->Realms, *_currentRealmId))
+            _currentRealmId = realm->Id;    // fill other fields of realm id
 
-        if (_currentRealmId)
-            if (std::shared_ptr<Realm> realm = Trinity::Containers::MapGetValuePtr(_realms, *_currentRealmId))
-                _currentRealmId = realm->Id;    // fill other fields of realm id
+    {
+        std::scoped_lock lock(_snapshotMutex);
+        _snapshot = std::move(snapshot);
     }
 
     if (_updateInterval)
@@ -211,10 +212,57 @@ void RealmList::UpdateRealms()
     }
 }
 
+void RealmList::BuildResponses(Snapshot& snapshot)
+{
+    for (auto const& [id, realm] : snapshot.Realms)
+    {
+        snapshot.Builds.insert(realm->Build);
+
+        // only sent to accounts allowed on the realm and running its build, populationstate and flags are always the same
+        if (realm->PopulationLevel == RealmPopulationState::Offline)
+            continue;
+
+        JSON::RealmList::RealmEntry realmEntry;
+        FillRealmEntry(*realm, realm->Build, realm->AllowedSecurityLevel, &realmEntry);
+
+        std::string json = "JamJSONRealmEntry:" + JSON::Serialize(realmEntry);
+        CompressJson(json, &snapshot.RealmEntries[id]);
+    }
+
+    // all builds no realm runs see every realm with a version mismatch
+    while (snapshot.Builds.contains(snapshot.OtherBuild))
+        ++snapshot.OtherBuild;
+
+    std::unordered_set<std::string> subRegions = snapshot.SubRegions;
+    for (auto const& [id, _] : snapshot.RemovedRealms)
+        subRegions.insert(id.GetSubRegionAddress());
+
+    for (std::string const& subRegion : subRegions)
+    {
+        std::map<std::pair<uint32, uint8>, std::vector<uint8>>& realmLists = snapshot.RealmLists[subRegion];
+        auto buildForClientBuild = [&](uint32 clientBuild)
+        {
+            // realms never require more than SEC_ADMINISTRATOR
+            for (uint8 securityLevel = SEC_PLAYER; securityLevel <= SEC_ADMINISTRATOR; ++securityLevel)
+                realmLists[{ clientBuild, securityLevel }] = BuildRealmList(snapshot, clientBuild, AccountTypes(securityLevel), subRegion);
+        };
+
+        for (uint32 clientBuild : snapshot.Builds)
+            buildForClientBuild(clientBuild);
+
+        buildForClientBuild(snapshot.OtherBuild);
+    }
+}
+
+std::shared_ptr<RealmList::Snapshot const> RealmList::GetSnapshot() const
+{
+    std::scoped_lock lock(_snapshotMutex);
+    return _snapshot;
+}
+
 std::shared_ptr<Realm const> RealmList::GetRealm(Battlenet::RealmHandle const& id) const
 {
-    std::shared_lock lock(_realmsMutex);
-    return Trinity::Containers::MapGetValuePtr(_realms, id);
+    return Trinity::Containers::MapGetValuePtr(GetSnapshot()->Realms, id);
 }
 
 Battlenet::RealmHandle RealmList::GetCurrentRealmId() const
@@ -236,12 +284,12 @@ std::shared_ptr<Realm const> RealmList::GetCurrentRealm() const
 
 void RealmList::WriteSubRegions(bgs::protocol::game_utilities::v1::GetAllValuesForAttributeResponse* response) const
 {
-    std::shared_lock lock(_realmsMutex);
-    for (std::string const& subRegion : _subRegions)
+    std::shared_ptr<Snapshot const> snapshot = GetSnapshot();
+    for (std::string const& subRegion : snapshot->SubRegions)
         response->add_attribute_value()->set_string_value(subRegion);
 }
 
-void RealmList::FillRealmEntry(Realm const& realm, uint32 clientBuild, AccountTypes accountSecurityLevel, JSON::RealmList::RealmEntry* realmEntry) const
+void RealmList::FillRealmEntry(Realm const& realm, uint32 clientBuild, AccountTypes accountSecurityLevel, JSON::RealmList::RealmEntry* realmEntry)
 {
     realmEntry->set_wowrealmaddress(realm.Id.GetAddress());
     realmEntry->set_cfgtimezonesid(1);
@@ -281,46 +329,52 @@ void RealmList::FillRealmEntry(Realm const& realm, uint32 clientBuild, AccountTy
 
 std::vector<uint8> RealmList::GetRealmEntryJSON(Battlenet::RealmHandle const& id, uint32 build, AccountTypes accountSecurityLevel) const
 {
-    std::vector<uint8> compressed;
-    if (std::shared_ptr<Realm const> realm = GetRealm(id))
+    std::shared_ptr<Snapshot const> snapshot = GetSnapshot();
+    if (std::shared_ptr<Realm const> realm = Trinity::Containers::MapGetValuePtr(snapshot->Realms, id))
+        if (realm->Build == build && accountSecurityLevel >= realm->AllowedSecurityLevel)
+            if (std::vector<uint8> const* compressed = Trinity::Containers::MapGetValuePtr(snapshot->RealmEntries, id))
+                return *compressed;
+
+    return {};
+}
+
+std::vector<uint8> RealmList::GetRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const
+{
+    std::shared_ptr<Snapshot const> snapshot = GetSnapshot();
+    if (auto realmLists = snapshot->RealmLists.find(subRegion); realmLists != snapshot->RealmLists.end())
     {
-        if (realm->PopulationLevel != RealmPopulationState::Offline && realm->Build == build && accountSecurityLevel >= realm->AllowedSecurityLevel)
-        {
-            JSON::RealmList::RealmEntry realmEntry;
-            FillRealmEntry(*realm, build, accountSecurityLevel, &realmEntry);
+        if (!snapshot->Builds.contains(build))
+            build = snapshot->OtherBuild;
 
-            std::string json = "JamJSONRealmEntry:" + JSON::Serialize(realmEntry);
-            CompressJson(json, &compressed);
-        }
+        if (std::vector<uint8> const* compressed = Trinity::Containers::MapGetValuePtr(realmLists->second, { build, uint8(std::min(accountSecurityLevel, SEC_ADMINISTRATOR)) }))
+            return *compressed;
     }
 
-    return compressed;
+    // subregion without any realms
+    return BuildRealmList(*snapshot, build, accountSecurityLevel, subRegion);
 }
 
-std::vector<uint8> RealmList::GetRealmList(uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion) const
+std::vector<uint8> RealmList::BuildRealmList(Snapshot const& snapshot, uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion)
 {
     JSON::RealmList::RealmListUpdates realmList;
+    for (auto const& [_, realm] : snapshot.Realms)
     {
-        std::shared_lock lock(_realmsMutex);
-        for (auto const& [_, realm] : _realms)
-        {
-            if (realm->Id.GetSubRegionAddress() != subRegion)
-                continue;
+        if (realm->Id.GetSubRegionAddress() != subRegion)
+            continue;
 
-            JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
-            FillRealmEntry(*realm, build, accountSecurityLevel, state->mutable_update());
-            state->set_deleting(false);
-        }
+        JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
+        FillRealmEntry(*realm, build, accountSecurityLevel, state->mutable_update());
+        state->set_deleting(false);
+    }
 
-        for (auto const& [id, _] : _removedRealms)
-        {
-            if (id.GetSubRegionAddress() != subRegion)
-                continue;
+    for (auto const& [id, _] : snapshot.RemovedRealms)
+    {
+        if (id.GetSubRegionAddress() != subRegion)
+            continue;
 
-            JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
-            state->set_wowrealmaddress(id.GetAddress());
-            state->set_deleting(true);
-        }
+        JSON::RealmList::RealmListUpdatePart* state = realmList.add_updates();
+        state->set_wowrealmaddress(id.GetAddress());
+        state->set_deleting(true);
     }
 
     std::string json = "JSONRealmListUpdates:" + JSON::Serialize(realmList);
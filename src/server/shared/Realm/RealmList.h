@@ -26,7 +26,9 @@
 #include <array>
 #include <map>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -72,18 +74,34 @@ public:
         AccountTypes accountSecurityLevel, bgs::protocol::game_utilities::v1::ClientResponse* response) const;
 
 private:
+    // Realms loaded by one UpdateRealms call, never modified once published
+    struct Snapshot
+    {
+        RealmMap Realms;
+        std::map<Battlenet::RealmHandle, std::string> RemovedRealms;
+        std::unordered_set<std::string> SubRegions;
+
+        // compressed responses built when the snapshot is loaded
+        std::set<uint32> Builds;
+        uint32 OtherBuild = 0;                                      // a build no realm runs, stands in for all of them
+        std::map<Battlenet::RealmHandle, std::vector<uint8>> RealmEntries;
+        std::unordered_map<std::string, std::map<std::pair<uint32, uint8>, std::vector<uint8>>> RealmLists;  // subregion -> (build, security level)
+    };
+
     RealmList();
 
     void UpdateRealms();
     static void UpdateRealm(Realm& realm, Battlenet::RealmHandle const& id, uint32 build, std::string const& name,
         std::vector<boost::asio::ip::address>&& addresses,
         uint16 port, uint8 icon, RealmFlags flag, uint8 timezone, AccountTypes allowedSecurityLevel, RealmPopulationState population);
-    void FillRealmEntry(Realm const& realm, uint32 clientBuild, AccountTypes accountSecurityLevel, JSON::RealmList::RealmEntry* realmEntry) const;
-
-    mutable std::shared_mutex _realmsMutex;
-    RealmMap _realms;
-    std::map<Battlenet::RealmHandle, std::string> _removedRealms;
-    std::unordered_set<std::string> _subRegions;
+    static void FillRealmEntry(Realm const& realm, uint32 clientBuild, AccountTypes accountSecurityLevel, JSON::RealmList::RealmEntry* realmEntry);
+    static std::vector<uint8> BuildRealmList(Snapshot const& snapshot, uint32 build, AccountTypes accountSecurityLevel, std::string const& subRegion);
+    static void BuildResponses(Snapshot& snapshot);
+    std::shared_ptr<Snapshot const> GetSnapshot() const;
+
+    // only guards swapping the pointer, readers keep their snapshot for as long as they need it
+    mutable std::mutex _snapshotMutex;
+    std::shared_ptr<Snapshot const> _snapshot;
     uint32 _updateInterval;
     std::unique_ptr<Trinity::Asio::DeadlineTimer> _updateTimer;
     std::unique_ptr<Trinity::Net::Resolver> _resolver;
@@ -30,11 +30,14 @@
 #include "GitRevision.h"
 #include "InstanceLockMgr.h"
 #include "IoContext.h"
+#include "IpBanList.h"
 #include "IpNetwork.h"
 #include "Locales.h"
+#include "MallocControl.h"
 #include "MapManager.h"
 #include "Memory.h"
 #include "Metric.h"
+#include "MetricHttpService.h"
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvP/OutdoorPvPMgr.h"
@@ -119,6 +122,7 @@ private:
 
 void SignalHandler(boost::system::error_code const& error, int signalNumber);
 std::unique_ptr<Trinity::Net::AsyncAcceptor> StartRaSocketAcceptor(Trinity::Asio::IoContext& ioContext);
+void ConfigureAllocator();
 bool StartDB();
 void StopDB();
 void WorldUpdateLoop();
@@ -229,6 +233,8 @@ int main(int argc, char** argv)
     sLog->RegisterAppender<AppenderDB>();
     // If logs are supposed to be handled async then we need to pass the IoContext into the Log singleton
     sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false) ? ioContext.get() : nullptr);
+    if (int32 deferredBufferSize = sConfigMgr->GetIntDefault("Log.Deferred.BufferSize", 0); deferredBufferSize > 0)
+        sLog->SetDeferred(std::size_t(deferredBufferSize) * 1024);
 
     Trinity::Banner::Show("worldserver-daemon",
         [](char const* text)
@@ -290,6 +296,8 @@ int main(int argc, char** argv)
     // Set process priority according to configuration settings
     SetProcessPriority("server.worldserver", sConfigMgr->GetIntDefault(CONFIG_PROCESSOR_AFFINITY, 0), sConfigMgr->GetBoolDefault(CONFIG_HIGH_PRIORITY, false));
 
+    ConfigureAllocator();
+
     // Start the databases
     if (!StartDB())
         return 1;
@@ -305,6 +313,10 @@ int main(int argc, char** argv)
 
     auto sRealmListHandle = Trinity::make_unique_ptr_with_deleter<&RealmList::Close>(sRealmList);
 
+    sIpBanList->Initialize(*ioContext, sConfigMgr->GetIntDefault("IpBanList.UpdateInterval", 0));
+
+    auto sIpBanListHandle = Trinity::make_unique_ptr_with_deleter<&IpBanList::Close>(sIpBanList);
+
     ///- Get the realm Id from the configuration file
     uint32 realmId = sConfigMgr->GetIntDefault("RealmID", 0);
     if (!realmId)
@@ -333,6 +345,11 @@ int main(int argc, char** argv)
             TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
             TC_METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
             TC_METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+            CharacterDatabase.ReportResultCacheMetrics();
+            LoginDatabase.ReportStatementLatencyMetrics();
+            CharacterDatabase.ReportStatementLatencyMetrics();
+            WorldDatabase.ReportStatementLatencyMetrics();
+            HotfixDatabase.ReportStatementLatencyMetrics();
         });
 
     realm = nullptr;
@@ -345,6 +362,28 @@ int main(int argc, char** argv)
             metric->Unload();
         });
 
+    // Start the Prometheus exporter if enabled
+    MetricHttpService* metricHttpService = nullptr;
+    if (sMetric->IsPullEnabled())
+    {
+        int32 metricPort = sConfigMgr->GetIntDefault("Metric.Prometheus.Port", 9464);
+        if (metricPort <= 0 || metricPort > 0xFFFF)
+        {
+            TC_LOG_ERROR("server.worldserver", "Specified Prometheus exporter port ({}) out of allowed range (1-65535)", metricPort);
+            return 1;
+        }
+
+        if (!sMetricHttpService.StartNetwork(*ioContext, sConfigMgr->GetStringDefault("Metric.Prometheus.BindIP", "127.0.0.1"), uint16(metricPort)))
+        {
+            TC_LOG_ERROR("server.worldserver", "Failed to initialize Prometheus exporter");
+            return 1;
+        }
+
+        metricHttpService = &sMetricHttpService;
+    }
+
+    auto metricHttpServiceHandle = Trinity::make_unique_ptr_with_deleter<&MetricHttpService::StopNetwork>(metricHttpService);
+
     auto scriptReloadMgrHandle = Trinity::make_unique_ptr_with_deleter<&ScriptReloadMgr::Unload>(sScriptReloadMgr);
 
     sScriptMgr->SetScriptLoader(AddScripts);
@@ -352,8 +391,14 @@ int main(int argc, char** argv)
 
     // Initialize the World
     sSecretMgr->Initialize(SECRET_OWNER_WORLDSERVER);
-    if (!sWorld->SetInitialWorldSettings())
-        return 1;
+    {
+        // db2 stores and templates loaded now are kept until shutdown, they are best packed into huge pages
+        Trinity::MallocControl::ScopedThreadArena storesArena(sConfigMgr->GetBoolDefault("Allocator.HugePages.Stores", false)
+            ? Trinity::MallocControl::CreateArena(true) : Optional<uint32>());
+
+        if (!sWorld->SetInitialWorldSettings())
+            return 1;
+    }
 
     auto instanceLockMgrHandle = Trinity::make_unique_ptr_with_deleter<&InstanceLockMgr::Unload>(&sInstanceLockMgr);
 
@@ -367,6 +412,9 @@ int main(int argc, char** argv)
     // unload battleground templates before different singletons destroyed
     auto battlegroundMgrHandle = Trinity::make_unique_ptr_with_deleter<&BattlegroundMgr::DeleteAllBattlegrounds>(sBattlegroundMgr);
 
+    // finish queued jobs while everything they may reference is still loaded
+    auto jobSystemHandle = Trinity::make_unique_ptr_with_deleter<&World::StopJobSystem>(sWorld);
+
     // Start the Remote Access port (acceptor) if enabled
     std::unique_ptr<Trinity::Net::AsyncAcceptor> raAcceptor;
     if (sConfigMgr->GetBoolDefault("Ra.Enable", false))
@@ -648,6 +696,22 @@ std::unique_ptr<Trinity::Net::AsyncAcceptor> StartRaSocketAcceptor(Trinity::Asio
     return acceptor;
 }
 
+void ConfigureAllocator()
+{
+    if (!Trinity::MallocControl::IsAvailable())
+    {
+        TC_LOG_INFO("server.worldserver", "Allocator settings are ignored, the server is built without jemalloc");
+        return;
+    }
+
+    if (sConfigMgr->GetBoolDefault("Allocator.BackgroundThreads", false) && !Trinity::MallocControl::SetBackgroundThreads(true))
+        TC_LOG_ERROR("server.worldserver", "Could not start the allocator background threads");
+
+    int32 decayTime = sConfigMgr->GetIntDefault("Allocator.DecayTime", 10000);
+    if (decayTime != 10000 && !Trinity::MallocControl::SetDecayTime(Milliseconds(decayTime)))
+        TC_LOG_ERROR("server.worldserver", "Allocator.DecayTime {} could not be set", decayTime);
+}
+
 /// Initialize connection to the databases
 bool StartDB()
 {
@@ -0,0 +1,54 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricHttpService.h"
+#include "Metric.h"
+
+Trinity::Net::Http::RequestHandlerResult MetricHttpSession::RequestHandler(Trinity::Net::Http::RequestContext& context)
+{
+    return sMetricHttpService.HandleRequest(std::static_pointer_cast<MetricHttpSession>(shared_from_this()), context);
+}
+
+std::shared_ptr<Trinity::Net::Http::SessionState> MetricHttpSession::ObtainSessionState(Trinity::Net::Http::RequestContext& /*context*/) const
+{
+    return sMetricHttpService.CreateNewSessionState(GetRemoteIpAddress());
+}
+
+MetricHttpService& MetricHttpService::Instance()
+{
+    static MetricHttpService instance;
+    return instance;
+}
+
+bool MetricHttpService::StartNetwork(Trinity::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port, int32 threadCount)
+{
+    if (!HttpService::StartNetwork(ioContext, bindIp, port, threadCount))
+        return false;
+
+    RegisterHandler(boost::beast::http::verb::get, "/metrics", [](std::shared_ptr<MetricHttpSession> /*session*/, Trinity::Net::Http::RequestContext& context)
+    {
+        context.response.set(boost::beast::http::field::content_type, "text/plain; version=0.0.4; charset=utf-8");
+        context.response.body() = sMetric->Scrape();
+        return Trinity::Net::Http::RequestHandlerResult::Handled;
+    }, Trinity::Net::Http::RequestHandlerFlag::DoNotLogResponseContent);
+
+    _acceptor->AsyncAccept([this](Trinity::Net::IoContextTcpSocket&& sock, uint32 threadIndex)
+    {
+        OnSocketOpen(std::move(sock), threadIndex);
+    });
+    return true;
+}
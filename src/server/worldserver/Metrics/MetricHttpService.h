@@ -0,0 +1,48 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_METRIC_HTTP_SERVICE_H
+#define TRINITYCORE_METRIC_HTTP_SERVICE_H
+
+#include "HttpService.h"
+#include "HttpSocket.h"
+
+class MetricHttpSession final : public Trinity::Net::Http::Socket
+{
+public:
+    using Socket::Socket;
+
+    Trinity::Net::Http::RequestHandlerResult RequestHandler(Trinity::Net::Http::RequestContext& context) override;
+
+protected:
+    std::shared_ptr<Trinity::Net::Http::SessionState> ObtainSessionState(Trinity::Net::Http::RequestContext& context) const override;
+};
+
+// Serves every metric on GET /metrics for Prometheus, they are only formatted when scraped
+class MetricHttpService : public Trinity::Net::Http::HttpService<MetricHttpSession>
+{
+public:
+    MetricHttpService() : HttpService("metric") { }
+
+    static MetricHttpService& Instance();
+
+    bool StartNetwork(Trinity::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port, int32 threadCount = 1) override;
+};
+
+#define sMetricHttpService MetricHttpService::Instance()
+
+#endif // TRINITYCORE_METRIC_HTTP_SERVICE_H
@@ -0,0 +1,445 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Banner.h"
+#include "CryptoHash.h"
+#include "GitRevision.h"
+#include "Locales.h"
+#include "Memory.h"
+#include "Optional.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include <boost/filesystem/directory.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/program_options.hpp>
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+constexpr char ExecutableSuffix[] = ".exe";
+#else
+constexpr char ExecutableSuffix[] = "";
+#endif
+
+// Directories written by the tools inside the work directory, removed before every run
+constexpr char const* ToolDirectories[] = { "maps", "dbc", "gt", "cameras", "Buildings", "vmaps", "mmaps" };
+
+struct StepResult
+{
+    std::string Name;
+    int32 ExitCode = -1;
+    double WallTime = 0.0;                          // seconds
+    uint64 PeakMemory = 0;                          // bytes, peak resident set of the tool process
+    std::map<std::string, std::string> Outputs;     // path relative to the work directory -> sha256
+};
+
+/**
+ * Runs executable inside workDirectory and waits for it to exit, output of the tool goes to our own stdout
+ *
+ * @return false if the process could not be started
+ */
+bool RunProcess(fs::path const& executable, std::vector<std::string> const& args, fs::path const& workDirectory, StepResult& result)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+    std::string commandLine = Trinity::StringFormat(R"("{}")", executable.string());
+    for (std::string const& arg : args)
+        commandLine += Trinity::StringFormat(R"( "{}")", arg);
+
+    STARTUPINFOA startupInfo = { };
+    startupInfo.cb = sizeof(startupInfo);
+    PROCESS_INFORMATION processInfo = { };
+    if (!CreateProcessA(nullptr, commandLine.data(), nullptr, nullptr, FALSE, 0, nullptr, workDirectory.string().c_str(), &startupInfo, &processInfo))
+        return false;
+
+    WaitForSingleObject(processInfo.hProcess, INFINITE);
+
+    DWORD exitCode = DWORD(-1);
+    GetExitCodeProcess(processInfo.hProcess, &exitCode);
+    result.ExitCode = int32(exitCode);
+
+    PROCESS_MEMORY_COUNTERS counters = { };
+    if (GetProcessMemoryInfo(processInfo.hProcess, &counters, sizeof(counters)))
+        result.PeakMemory = counters.PeakWorkingSetSize;
+
+    CloseHandle(processInfo.hThread);
+    CloseHandle(processInfo.hProcess);
+#else
+    std::string executableName = executable.string();
+    std::string workDirectoryName = workDirectory.string();
+    std::vector<char*> argv;
+    argv.push_back(executableName.data());
+    for (std::string const& arg : args)
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0)
+        return false;
+
+    if (pid == 0)
+    {
+        if (chdir(workDirectoryName.c_str()) == 0)
+            execv(executableName.c_str(), argv.data());
+
+        _exit(127);
+    }
+
+    int status = 0;
+    rusage usage = { };
+    if (wait4(pid, &status, 0, &usage) != pid)
+        return false;
+
+    result.ExitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_APPLE
+    result.PeakMemory = uint64(usage.ru_maxrss);            // bytes
+#else
+    result.PeakMemory = uint64(usage.ru_maxrss) * 1024;     // kilobytes
+#endif
+#endif
+
+    result.WallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+Optional<std::string> HashFile(fs::path const& path)
+{
+    auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(path.string().c_str(), "rb"));
+    if (!file)
+        return {};
+
+    Trinity::Crypto::SHA256 hash;
+    uint8 buffer[64 * 1024];
+    while (std::size_t read = fread(buffer, 1, sizeof(buffer), file.get()))
+        hash.UpdateData(buffer, read);
+
+    if (ferror(file.get()))
+        return {};
+
+    hash.Finalize();
+    return ByteArrayToHexStr(hash.GetDigest());
+}
+
+// Hashes every file below workDirectory/directory whose name starts with prefix
+void HashOutputs(fs::path const& workDirectory, std::string const& directory, std::string const& prefix, StepResult& result)
+{
+    boost::system::error_code ec;
+    for (fs::recursive_directory_iterator itr(workDirectory / directory, ec), end; !ec && itr != end; itr.increment(ec))
+    {
+        if (!fs::is_regular_file(itr->status()) || !itr->path().filename().string().starts_with(prefix))
+            continue;
+
+        std::string name = itr->path().lexically_relative(workDirectory).generic_string();
+        result.Outputs[name] = HashFile(itr->path()).value_or("<unreadable>");
+    }
+}
+
+void WriteReport(fs::path const& fileName, std::vector<uint32> const& maps, uint32 threads, std::vector<StepResult> const& steps)
+{
+    rapidjson::Document doc;
+    doc.SetObject();
+    rapidjson::Document::AllocatorType& allocator = doc.GetAllocator();
+    doc.AddMember("revision", rapidjson::Value(GitRevision::GetFullVersion(), allocator), allocator);
+    doc.AddMember("threads", threads, allocator);
+
+    rapidjson::Value mapList(rapidjson::kArrayType);
+    for (uint32 mapId : maps)
+        mapList.PushBack(mapId, allocator);
+    doc.AddMember("maps", mapList.Move(), allocator);
+
+    rapidjson::Value stepList(rapidjson::kArrayType);
+    for (StepResult const& step : steps)
+    {
+        rapidjson::Value outputs(rapidjson::kObjectType);
+        for (auto const& [name, hash] : step.Outputs)
+            outputs.AddMember(rapidjson::Value(name.c_str(), allocator), rapidjson::Value(hash.c_str(), allocator), allocator);
+
+        rapidjson::Value value(rapidjson::kObjectType);
+        value.AddMember("name", rapidjson::Value(step.Name.c_str(), allocator), allocator);
+        value.AddMember("exit_code", step.ExitCode, allocator);
+        value.AddMember("wall_time", step.WallTime, allocator);
+        value.AddMember("peak_memory", step.PeakMemory, allocator);
+        value.AddMember("outputs", outputs.Move(), allocator);
+        stepList.PushBack(value.Move(), allocator);
+    }
+    doc.AddMember("steps", stepList.Move(), allocator);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+
+    std::ofstream file(fileName.string(), std::ios::binary | std::ios::trunc);
+    file << buffer.GetString() << '\n';
+}
+
+/**
+ * Compares the outputs of steps against the report of an earlier run
+ *
+ * @return number of steps whose outputs differ, steps missing from the reference are not counted
+ */
+Optional<uint32> CompareWithReference(fs::path const& fileName, std::vector<StepResult> const& steps)
+{
+    std::ifstream file(fileName.string(), std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Could not open reference report " << fileName.string() << '\n';
+        return {};
+    }
+
+    std::stringstream content;
+    content << file.rdbuf();
+
+    rapidjson::Document doc;
+    if (doc.Parse(content.str().c_str()).HasParseError() || !doc.IsObject() || !doc.HasMember("steps") || !doc["steps"].IsArray())
+    {
+        std::cerr << "Reference report " << fileName.string() << " is not a benchmark report\n";
+        return {};
+    }
+
+    uint32 differences = 0;
+    for (StepResult const& step : steps)
+    {
+        rapidjson::Value const* reference = nullptr;
+        for (rapidjson::Value const& value : doc["steps"].GetArray())
+            if (value.IsObject() && value.HasMember("name") && value["name"].IsString() && step.Name == value["name"].GetString())
+                reference = &value;
+
+        if (!reference || !reference->HasMember("outputs") || !(*reference)["outputs"].IsObject())
+        {
+            std::cout << step.Name << ": not in the reference report\n";
+            continue;
+        }
+
+        std::map<std::string, std::string> expected;
+        for (auto const& member : (*reference)["outputs"].GetObject())
+            if (member.value.IsString())
+                expected.emplace(member.name.GetString(), member.value.GetString());
+
+        // only the first few mismatches of a step are listed, a broken tool usually changes all of its files
+        uint32 mismatches = 0;
+        auto reportMismatch = [&](std::string const& name, char const* what)
+        {
+            if (++mismatches <= 10)
+                std::cout << step.Name << ": " << name << ' ' << what << '\n';
+        };
+
+        for (auto const& [name, hash] : step.Outputs)
+        {
+            auto itr = expected.find(name);
+            if (itr == expected.end())
+                reportMismatch(name, "was not in the reference output");
+            else if (itr->second != hash)
+                reportMismatch(name, "differs from the reference output");
+        }
+
+        for (auto const& [name, hash] : expected)
+            if (!step.Outputs.contains(name))
+                reportMismatch(name, "is missing");
+
+        if (reference->HasMember("wall_time") && (*reference)["wall_time"].IsNumber() && (*reference)["wall_time"].GetDouble() > 0.0)
+            std::cout << Trinity::StringFormat("{}: {:.1f} s ({:+.1f}% against the reference)", step.Name, step.WallTime,
+                (step.WallTime / (*reference)["wall_time"].GetDouble() - 1.0) * 100.0) << '\n';
+
+        if (mismatches)
+        {
+            std::cout << step.Name << ": " << mismatches << " output files differ from the reference\n";
+            ++differences;
+        }
+    }
+
+    return differences;
+}
+
+/**
+ * Parses command line arguments
+ *
+ * @return Non-empty optional if program should exit immediately (holds exit code in that case)
+ */
+Optional<int> HandleArgs(int argc, char* argv[], fs::path* binDirectory, std::string* dataDirectory, fs::path* workDirectory,
+    std::vector<uint32>* maps, uint32* threads, std::string* report, std::string* reference)
+{
+    std::string bin;
+    std::string work;
+    po::options_description visible("Usage: extractor_benchmark [OPTION]... --data <client directory>\n\n"
+        "Runs mapextractor, vmap4extractor, vmap4assembler and mmaps_generator on a fixed set\n"
+        "of maps and records wall time, peak memory and output hashes of every step.\n\n"
+        "Where OPTION can be any of");
+    visible.add_options()
+        ("data", po::value(dataDirectory)->required(), "client directory the extractors read from")
+        ("bin", po::value(&bin), "directory containing the tools, default: directory of this executable")
+        ("work", po::value(&work)->default_value("benchmark"), "directory the tools write into, its tool output directories are cleared first")
+        ("maps", po::value(maps)->multitoken()->default_value(std::vector<uint32>{ 33, 389 }, "33 389"), "map ids the pipeline runs on")
+        ("threads", po::value<uint32>(threads)->default_value(std::thread::hardware_concurrency()), "number of threads each tool uses")
+        ("report", po::value(report)->default_value("benchmark.json"), "file the report is written to")
+        ("reference", po::value(reference), "report of an earlier run, fails if any output differs from it")
+        ("help,h", "print usage message")
+        ("version,v", "print version build info");
+
+    po::variables_map variablesMap;
+    try
+    {
+        store(po::command_line_parser(argc, argv).options(visible).run(), variablesMap);
+
+        if (variablesMap.find("help") != variablesMap.end())
+        {
+            std::cout << visible << '\n';
+            return 0;
+        }
+
+        if (variablesMap.find("version") != variablesMap.end())
+        {
+            std::cout << GitRevision::GetFullVersion() << '\n';
+            return 0;
+        }
+
+        notify(variablesMap);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    *binDirectory = bin.empty() ? fs::absolute(argv[0]).parent_path() : fs::absolute(bin);
+    *workDirectory = fs::absolute(work);
+    return {};
+}
+}
+
+int main(int argc, char* argv[])
+{
+    Trinity::VerifyOsVersion();
+
+    Trinity::Locale::Init();
+
+    fs::path binDirectory, workDirectory;
+    std::string dataDirectory, report, reference;
+    std::vector<uint32> maps;
+    uint32 threads = 0;
+    if (Optional<int> exitCode = HandleArgs(argc, argv, &binDirectory, &dataDirectory, &workDirectory, &maps, &threads, &report, &reference))
+        return *exitCode;
+
+    Trinity::Banner::Show("extractor benchmark", [](char const* text) { std::cout << text << std::endl; }, nullptr);
+
+    boost::system::error_code ec;
+    fs::create_directories(workDirectory, ec);
+    for (char const* directory : ToolDirectories)
+        fs::remove_all(workDirectory / directory, ec);
+
+    // the assembler and mmaps_generator expect their output directories to exist
+    fs::create_directory(workDirectory / "vmaps", ec);
+    fs::create_directory(workDirectory / "mmaps", ec);
+
+    std::string mapList;
+    for (uint32 mapId : maps)
+        mapList += Trinity::StringFormat("{}{}", mapList.empty() ? "" : ",", mapId);
+    std::string threadCount = Trinity::StringFormat("{}", threads);
+    std::string absoluteData = fs::absolute(dataDirectory).string();
+
+    struct Step
+    {
+        std::string Name;
+        std::string Executable;
+        std::vector<std::string> Args;
+        std::string OutputDirectory;
+        std::string OutputPrefix;
+    };
+
+    // --full makes mapextractor convert every tile instead of skipping those unchanged since the previous run
+    std::vector<Step> pipeline =
+    {
+        { "mapextractor", "mapextractor", { "-i", absoluteData, "-o", workDirectory.string(), "-e", "3", "--full", "--maps", mapList, "--threads", threadCount }, "maps", "" },
+        { "vmap4extractor", "vmap4extractor", { "-d", absoluteData, "--maps", mapList, "--threads", threadCount }, "", "" },
+        { "vmap4assembler", "vmap4assembler", { "Buildings", "vmaps", "--threads", threadCount }, "vmaps", "" },
+    };
+
+    for (uint32 mapId : maps)
+        pipeline.push_back({ Trinity::StringFormat("mmaps_generator {}", mapId), "mmaps_generator", { std::to_string(mapId), "--silent", "--threads", threadCount }, "mmaps", Trinity::StringFormat("{:04}", mapId) });
+
+    std::vector<StepResult> results;
+    bool failed = false;
+    for (Step const& step : pipeline)
+    {
+        std::cout << "Running " << step.Name << std::endl;
+
+        StepResult& result = results.emplace_back();
+        result.Name = step.Name;
+        fs::path executable = binDirectory / (step.Executable + ExecutableSuffix);
+        if (!RunProcess(executable, step.Args, workDirectory, result))
+        {
+            std::cerr << "Could not start " << executable.string() << '\n';
+            failed = true;
+            break;
+        }
+
+        if (!step.OutputDirectory.empty())
+            HashOutputs(workDirectory, step.OutputDirectory, step.OutputPrefix, result);
+
+        std::cout << Trinity::StringFormat("{} finished with exit code {} in {:.1f} s, peak memory {} MB, {} output files",
+            step.Name, result.ExitCode, result.WallTime, result.PeakMemory / (1024 * 1024), result.Outputs.size()) << std::endl;
+
+        // later steps read what this one wrote
+        if (result.ExitCode != 0)
+        {
+            failed = true;
+            break;
+        }
+    }
+
+    WriteReport(report, maps, threads, results);
+    std::cout << "Report written to " << report << std::endl;
+
+    if (!reference.empty())
+    {
+        Optional<uint32> differences = CompareWithReference(reference, results);
+        if (!differences || *differences)
+            failed = true;
+    }
+
+    return failed ? 1 : 0;
+}
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+#include "WheatyExceptionReport.h"
+// must be at end of file because of init_seg pragma
+INIT_CRASH_HANDLER();
+#endif
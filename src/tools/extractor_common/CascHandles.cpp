@@ -16,6 +16,7 @@
  */
 
 #include "CascHandles.h"
+#include "Hash.h"
 #include "IoContext.h"
 #include "Resolver.h"
 #include <CascLib.h>
@@ -25,7 +26,11 @@
 #include <boost/asio/write.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/filesystem/operations.hpp>
+#include <algorithm>
+#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 char const* CASC::HumanReadableCASCError(uint32 error)
 {
@@ -155,10 +160,101 @@ namespace
         size_t infoDataSizeNeeded = 0;
         return ::CascGetStorageInfo(storage, storageInfoClass, value, sizeof(T), &infoDataSizeNeeded);
     }
+
+    struct BlockCacheKey
+    {
+        CASC::ContentKey ContentKey;
+        bool Zerofilled;            // encrypted parts of the same file read as zeros or not at all
+        uint64 BlockIndex;
+
+        friend bool operator==(BlockCacheKey const& left, BlockCacheKey const& right) = default;
+    };
+
+    struct BlockCacheKeyHash
+    {
+        std::size_t operator()(BlockCacheKey const& key) const
+        {
+            // content keys are md5 hashes, any part of them is as good as the whole key
+            uint64 contentHash;
+            memcpy(&contentHash, key.ContentKey.data(), sizeof(contentHash));
+            std::size_t hash = std::size_t(contentHash);
+            Trinity::hash_combine(hash, key.BlockIndex);
+            Trinity::hash_combine(hash, key.Zerofilled);
+            return hash;
+        }
+    };
+
+    struct BlockCacheStorage
+    {
+        using LruList = std::list<std::pair<BlockCacheKey, CASC::BlockCache::Block>>;
+
+        void Trim()
+        {
+            while (Size > Capacity && !Lru.empty())
+            {
+                Size -= Lru.back().second->size();
+                Blocks.erase(Lru.back().first);
+                Lru.pop_back();
+            }
+        }
+
+        std::mutex Lock;
+        std::size_t Capacity = CASC::BlockCache::DefaultCapacity;
+        std::size_t Size = 0;
+        LruList Lru;                // most recently used first
+        std::unordered_map<BlockCacheKey, LruList::iterator, BlockCacheKeyHash> Blocks;
+    };
+
+    BlockCacheStorage& GetBlockCache()
+    {
+        static BlockCacheStorage cache;
+        return cache;
+    }
 }
 
 namespace CASC
 {
+void BlockCache::SetCapacity(std::size_t bytes)
+{
+    BlockCacheStorage& cache = GetBlockCache();
+    std::scoped_lock lock(cache.Lock);
+    cache.Capacity = bytes;
+    cache.Trim();
+}
+
+std::size_t BlockCache::GetCapacity()
+{
+    BlockCacheStorage& cache = GetBlockCache();
+    std::scoped_lock lock(cache.Lock);
+    return cache.Capacity;
+}
+
+BlockCache::Block BlockCache::Find(ContentKey const& key, bool zerofilled, uint64 blockIndex)
+{
+    BlockCacheStorage& cache = GetBlockCache();
+    std::scoped_lock lock(cache.Lock);
+    auto itr = cache.Blocks.find({ .ContentKey = key, .Zerofilled = zerofilled, .BlockIndex = blockIndex });
+    if (itr == cache.Blocks.end())
+        return nullptr;
+
+    cache.Lru.splice(cache.Lru.begin(), cache.Lru, itr->second);
+    return itr->second->second;
+}
+
+void BlockCache::Insert(ContentKey const& key, bool zerofilled, uint64 blockIndex, Block block)
+{
+    BlockCacheStorage& cache = GetBlockCache();
+    std::scoped_lock lock(cache.Lock);
+    BlockCacheKey blockKey{ .ContentKey = key, .Zerofilled = zerofilled, .BlockIndex = blockIndex };
+    if (cache.Blocks.contains(blockKey) || block->size() > cache.Capacity)
+        return;
+
+    cache.Size += block->size();
+    cache.Lru.emplace_front(blockKey, std::move(block));
+    cache.Blocks.emplace(blockKey, cache.Lru.begin());
+    cache.Trim();
+}
+
 using CASCCharType = std::remove_const_t<std::remove_pointer_t<decltype(CASC_OPEN_STORAGE_ARGS::szLocalPath)>>;
 using CASCStringType = std::basic_string<CASCCharType>;
 
@@ -288,7 +384,7 @@ File* Storage::OpenFile(char const* fileName, uint32 localeMask, bool printError
         return nullptr;
     }
 
-    return new File(handle);
+    return new File(handle, zerofillEncryptedParts);
 }
 
 File* Storage::OpenFile(uint32 fileDataId, uint32 localeMask, bool printErrors /*= false*/, bool zerofillEncryptedParts /*= false*/) const
@@ -309,11 +405,25 @@ File* Storage::OpenFile(uint32 fileDataId, uint32 localeMask, bool printErrors /
         return nullptr;
     }
 
-    return new File(handle);
+    return new File(handle, zerofillEncryptedParts);
 }
 
-File::File(HANDLE handle) : _handle(handle)
+File::File(HANDLE handle, bool zerofillEncryptedParts) : _handle(handle), _zerofilled(zerofillEncryptedParts), _size(-1), _position(0)
 {
+    if (!BlockCache::GetCapacity())
+        return;
+
+    ULONGLONG size;
+    if (!::CascGetFileSize64(_handle, &size))
+        return;
+
+    // files the storage knows no content key for can't be told apart, they are never cached
+    Optional<ContentKey> contentKey = GetContentKey();
+    if (!contentKey || std::ranges::all_of(*contentKey, [](uint8 byte) { return byte == 0; }))
+        return;
+
+    _cacheKey = contentKey;
+    _size = int64(size);
 }
 
 File::~File()
@@ -330,6 +440,18 @@ uint32 File::GetId() const
     return info.FileDataId;
 }
 
+Optional<ContentKey> File::GetContentKey() const
+{
+    CASC_FILE_FULL_INFO info;
+    if (!::CascGetFileInfo(_handle, CascFileFullInfo, &info, sizeof(info), nullptr))
+        return {};
+
+    ContentKey contentKey;
+    static_assert(sizeof(info.CKey) == contentKey.size());
+    memcpy(contentKey.data(), info.CKey, contentKey.size());
+    return contentKey;
+}
+
 int64 File::GetSize() const
 {
     ULONGLONG size;
@@ -341,6 +463,9 @@ int64 File::GetSize() const
 
 int64 File::GetPointer() const
 {
+    if (_cacheKey)
+        return _position;
+
     ULONGLONG position;
     if (!::CascSetFilePointer64(_handle, 0, &position, FILE_CURRENT))
         return -1;
@@ -350,13 +475,71 @@ int64 File::GetPointer() const
 
 bool File::SetPointer(int64 position)
 {
+    if (_cacheKey)
+    {
+        if (position < 0 || position > _size)
+            return false;
+
+        _position = position;
+        return true;
+    }
+
     LONG parts[2];
     memcpy(parts, &position, sizeof(parts));
     return ::CascSetFilePointer64(_handle, position, nullptr, FILE_BEGIN);
 }
 
+BlockCache::Block File::LoadBlock(uint64 blockIndex)
+{
+    int64 start = int64(blockIndex * BlockCache::BlockSize);
+    std::vector<uint8> data(std::size_t(std::min<int64>(BlockCache::BlockSize, _size - start)));
+    DWORD read = 0;
+    if (!::CascSetFilePointer64(_handle, start, nullptr, FILE_BEGIN) || !::CascReadFile(_handle, data.data(), DWORD(data.size()), &read) || read != data.size())
+        return nullptr;
+
+    BlockCache::Block block = std::make_shared<std::vector<uint8> const>(std::move(data));
+    BlockCache::Insert(*_cacheKey, _zerofilled, blockIndex, block);
+    return block;
+}
+
 bool File::ReadFile(void* buffer, uint32 bytes, uint32* bytesRead)
 {
+    if (_cacheKey)
+    {
+        uint8* output = static_cast<uint8*>(buffer);
+        uint32 read = 0;
+        while (read < bytes && _position < _size)
+        {
+            uint64 blockIndex = uint64(_position) / BlockCache::BlockSize;
+            BlockCache::Block block = BlockCache::Find(*_cacheKey, _zerofilled, blockIndex);
+            if (!block)
+                block = LoadBlock(blockIndex);
+
+            if (!block)
+            {
+                // the block may cover parts the caller never asked for (encrypted frames), read the rest of the request directly
+                DWORD directRead = 0;
+                if (!::CascSetFilePointer64(_handle, _position, nullptr, FILE_BEGIN) || !::CascReadFile(_handle, output + read, bytes - read, &directRead))
+                    return false;
+
+                read += directRead;
+                _position += directRead;
+                break;
+            }
+
+            uint32 offset = uint32(uint64(_position) - blockIndex * BlockCache::BlockSize);
+            uint32 count = std::min<uint32>(bytes - read, uint32(block->size()) - offset);
+            memcpy(output + read, block->data() + offset, count);
+            read += count;
+            _position += count;
+        }
+
+        if (bytesRead)
+            *bytesRead = read;
+
+        return true;
+    }
+
     DWORD bytesReadDWORD;
     if (!::CascReadFile(_handle, buffer, bytes, &bytesReadDWORD))
         return false;
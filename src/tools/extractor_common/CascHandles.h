@@ -19,7 +19,11 @@
 #define CascHandles_h__
 
 #include "Define.h"
+#include "Optional.h"
 #include <CascPort.h>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace boost
 {
@@ -35,6 +39,29 @@ namespace CASC
 
     class File;
 
+    using ContentKey = std::array<uint8, 16>;
+
+    /*
+     * Contents of files read from any storage, kept in blocks of BlockSize and shared by all threads. Blocks are keyed by
+     * content key, files opened again (models referenced by many tiles) are read from memory. Files are read from the storage
+     * in whole blocks, the many small reads of the db2 loader are served from the block read ahead of them.
+     */
+    class BlockCache
+    {
+    public:
+        static constexpr uint32 BlockSize = 256 * 1024;
+        static constexpr std::size_t DefaultCapacity = std::size_t(256) * 1024 * 1024;
+
+        using Block = std::shared_ptr<std::vector<uint8> const>;
+
+        // Limits the memory used by cached blocks, 0 disables the cache
+        static void SetCapacity(std::size_t bytes);
+        static std::size_t GetCapacity();
+
+        static Block Find(ContentKey const& key, bool zerofilled, uint64 blockIndex);
+        static void Insert(ContentKey const& key, bool zerofilled, uint64 blockIndex, Block block);
+    };
+
     class Storage
     {
     public:
@@ -67,15 +94,24 @@ namespace CASC
         ~File();
 
         uint32 GetId() const;
+        Optional<ContentKey> GetContentKey() const;
         int64 GetSize() const;
         int64 GetPointer() const;
         bool SetPointer(int64 position);
         bool ReadFile(void* buffer, uint32 bytes, uint32* bytesRead);
 
     private:
-        File(HANDLE handle);
+        File(HANDLE handle, bool zerofillEncryptedParts);
+
+        BlockCache::Block LoadBlock(uint64 blockIndex);
 
         HANDLE _handle;
+
+        // files without content key are read directly
+        Optional<ContentKey> _cacheKey;
+        bool _zerofilled;
+        int64 _size;
+        int64 _position;
     };
 }
 
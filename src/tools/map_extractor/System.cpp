@@ -27,7 +27,9 @@
 #include "MapDefines.h"
 #include "MapUtils.h"
 #include "Memory.h"
+#include "StringConvert.h"
 #include "StringFormat.h"
+#include "ThreadPool.h"
 #include "Util.h"
 #include "adt.h"
 #include "wdt.h"
@@ -36,9 +38,16 @@
 #include <boost/filesystem/directory.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <array>
+#include <atomic>
 #include <bitset>
+#include <chrono>
+#include <map>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -81,6 +90,7 @@ std::unordered_map<uint32, LiquidObjectEntry> LiquidObjects;
 std::unordered_map<uint32, LiquidTypeEntry> LiquidTypes;
 std::set<uint32> CameraFileDataIds;
 bool PrintProgress = true;
+uint32 Threads = std::thread::hardware_concurrency();
 boost::filesystem::path input_path;
 boost::filesystem::path output_path;
 
@@ -116,6 +126,8 @@ uint32 CONF_Locale = 0;
 char const* CONF_Product = "wow";
 char const* CONF_Region = "eu";
 bool CONF_UseRemoteCasc = false;
+bool CONF_UseManifest = true;
+std::unordered_set<uint32> CONF_Maps;           // only these maps are extracted if not empty
 
 #define CASC_LOCALES_COUNT 17
 
@@ -172,6 +184,10 @@ void Usage(char const* prg)
         "-p which installed product to open (wow/wowt/wow_beta)\n"\
         "-c use remote casc\n"\
         "-r set remote casc region - standard: eu\n"\
+        "--threads number of threads to use, default: all cpu cores\n"\
+        "--full convert every map tile, even those unchanged since the last extraction\n"\
+        "--maps comma separated list of map ids to extract, default: all maps\n"\
+        "--cache size of the casc read cache in MB, 0 disables it, default: 256\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"\n", prg, prg);
     exit(1);
 }
@@ -191,6 +207,47 @@ void HandleArgs(int argc, char* arg[])
         if (arg[c][0] != '-')
             Usage(arg[0]);
 
+        if (!strcmp(arg[c], "--threads"))
+        {
+            if (c + 1 < argc && strlen(arg[c + 1]))      // all ok
+                Threads = Trinity::StringTo<uint32>(arg[++c]).value_or(std::thread::hardware_concurrency());
+            else
+                Usage(arg[0]);
+            continue;
+        }
+
+        if (!strcmp(arg[c], "--full"))
+        {
+            CONF_UseManifest = false;
+            continue;
+        }
+
+        if (!strcmp(arg[c], "--cache"))
+        {
+            Optional<uint32> megabytes = c + 1 < argc ? Trinity::StringTo<uint32>(arg[++c]) : Optional<uint32>();
+            if (!megabytes)
+                Usage(arg[0]);
+
+            CASC::BlockCache::SetCapacity(std::size_t(*megabytes) * 1024 * 1024);
+            continue;
+        }
+
+        if (!strcmp(arg[c], "--maps"))
+        {
+            if (c + 1 >= argc)
+                Usage(arg[0]);
+
+            for (std::string_view mapId : Trinity::Tokenize(arg[++c], ',', false))
+            {
+                Optional<uint32> id = Trinity::StringTo<uint32>(mapId);
+                if (!id)
+                    Usage(arg[0]);
+
+                CONF_Maps.insert(*id);
+            }
+            continue;
+        }
+
         switch (arg[c][1])
         {
             case 'i':
@@ -312,7 +369,7 @@ void ReadMapDBC()
         }
     }
 
-    std::erase_if(map_ids, [](MapEntry const& map) { return !map.WdtFileDataId; });
+    std::erase_if(map_ids, [](MapEntry const& map) { return !map.WdtFileDataId || (!CONF_Maps.empty() && !CONF_Maps.contains(map.Id)); });
 
     printf("Done! (" SZFMTD " maps loaded)\n", map_ids.size());
 }
@@ -1080,10 +1137,91 @@ bool IsDeepWaterIgnored(uint32 mapId, uint32 x, uint32 y)
     return false;
 }
 
-void ExtractMaps(uint32 build)
+// **************************************************
+// Extraction manifest
+// **************************************************
+// Content keys of the adt files the .map files were converted from, tiles whose adt did not change since
+// the last extraction are not converted again (and keep their modification time for mmaps_generator)
+using ContentKey = std::array<uint8, 16>;
+using ExtractManifest = std::map<uint64, ContentKey>;
+
+inline uint64 MakeManifestKey(uint32 mapId, uint32 y, uint32 x)
+{
+    return (uint64(mapId) << 16) | (y << 8) | x;
+}
+
+// Everything else that ends up in the .map files, the manifest is discarded when any of it changed
+std::string GetManifestSettings()
+{
+    std::string liquids;
+    for (auto const& [id, liquidMaterial] : std::map(LiquidMaterials.begin(), LiquidMaterials.end()))
+        liquids += Trinity::StringFormat("{}:{}:{};", id, liquidMaterial.Flags.AsUnderlyingType(), liquidMaterial.LVF);
+    for (auto const& [id, liquidObject] : std::map(LiquidObjects.begin(), LiquidObjects.end()))
+        liquids += Trinity::StringFormat("{}:{};", id, liquidObject.LiquidTypeID);
+    for (auto const& [id, liquidType] : std::map(LiquidTypes.begin(), LiquidTypes.end()))
+        liquids += Trinity::StringFormat("{}:{}:{};", id, liquidType.SoundBank, liquidType.MaterialID);
+
+    return Trinity::StringFormat("{} {} {} {} {} {} {} {} {} {}", std::string_view(MapMagic.data(), MapMagic.size()), MapVersionMagic,
+        CONF_allow_height_limit, CONF_use_minHeight, CONF_allow_float_to_int, CONF_float_to_int8_limit, CONF_float_to_int16_limit,
+        CONF_flat_height_delta_limit, CONF_flat_liquid_delta_limit, std::hash<std::string>()(liquids));
+}
+
+ExtractManifest LoadManifest(std::string const& fileName, std::string const& settings)
+{
+    ExtractManifest manifest;
+    auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(fileName.c_str(), "r"));
+    if (!file)
+        return manifest;
+
+    char line[512];
+    if (!fgets(line, sizeof(line), file.get()) || std::string_view(line) != settings + '\n')
+    {
+        printf("Extraction settings changed since the last extraction, converting all map tiles\n");
+        return manifest;
+    }
+
+    while (fgets(line, sizeof(line), file.get()))
+    {
+        std::vector<std::string_view> tokens = Trinity::Tokenize(line, ' ', false);
+        if (tokens.size() != 2 || tokens[1].size() < 2 * std::tuple_size_v<ContentKey>)
+            continue;
+
+        Optional<uint64> key = Trinity::StringTo<uint64>(tokens[0]);
+        if (!key)
+            continue;
+
+        manifest[*key] = HexStrToByteArray<std::tuple_size_v<ContentKey>>(tokens[1].substr(0, 2 * std::tuple_size_v<ContentKey>));
+    }
+
+    return manifest;
+}
+
+void SaveManifest(std::string const& fileName, std::string const& settings, ExtractManifest const& manifest)
+{
+    auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(fileName.c_str(), "w"));
+    if (!file)
+    {
+        printf("Can't create the manifest file '%s'\n", fileName.c_str());
+        return;
+    }
+
+    fprintf(file.get(), "%s\n", settings.c_str());
+    for (auto const& [key, contentKey] : manifest)
+        fprintf(file.get(), UI64FMTD " %s\n", key, ByteArrayToHexStr(contentKey).c_str());
+}
+
+template<typename FileId>
+Optional<ContentKey> GetContentKey(FileId fileId)
 {
-    std::string outputFileName;
+    std::unique_ptr<CASC::File> file(CascStorage->OpenFile(fileId, CASC_LOCALE_ALL_WOW));
+    if (!file)
+        return {};
+
+    return file->GetContentKey();
+}
 
+void ExtractMaps(uint32 build)
+{
     printf("Extracting maps...\n");
 
     ReadMapDBC();
@@ -1094,54 +1232,125 @@ void ExtractMaps(uint32 build)
 
     CreateDir(output_path / "maps");
 
-    printf("Convert map files\n");
-    for (std::size_t z = 0; z < map_ids.size(); ++z)
+    Threads = std::max(Threads, 1u);
+    printf("Convert map files using %u threads\n", Threads);
+
+    // every tile is converted on its own, each job opens its own files from the storage and writes one .map file.
+    // Tiles of one map only write their own element, the tilelists are written in map order once all of them finished
+    std::vector<std::array<bool, WDT_MAP_SIZE * WDT_MAP_SIZE>> existingTiles(map_ids.size());
+    std::atomic<uint32> queuedTiles = 0;
+    std::atomic<uint32> convertedTiles = 0;
+    std::atomic<uint32> unchangedTiles = 0;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    std::string manifestFileName = (output_path / "maps" / "extract.manifest").string();
+    std::string manifestSettings = GetManifestSettings();
+    ExtractManifest const previousManifest = CONF_UseManifest ? LoadManifest(manifestFileName, manifestSettings) : ExtractManifest();
+    ExtractManifest manifest;
+    std::mutex manifestLock;
+
+    // tiles of maps left out by --maps stay valid for their next extraction
+    if (!CONF_Maps.empty())
+        for (auto const& [key, contentKey] : previousManifest)
+            if (!CONF_Maps.contains(uint32(key >> 16)))
+                manifest.emplace(key, contentKey);
+
     {
-        printf("Extract %s (" SZFMTD "/" SZFMTD ")                  \n", map_ids[z].Name.c_str(), z + 1, map_ids.size());
-        // Loadup map grid data
-        ChunkedFile wdt;
-        std::bitset<(WDT_MAP_SIZE) * (WDT_MAP_SIZE)> existingTiles;
-        if (wdt.loadFile(CascStorage, map_ids[z].WdtFileDataId, Trinity::StringFormat("WDT for map {}", map_ids[z].Id), false))
+        Trinity::ThreadPool threadPool(Threads);
+
+        for (std::size_t z = 0; z < map_ids.size(); ++z)
         {
-            FileChunk const* mphd = wdt.GetChunk("MPHD");
-            FileChunk const* main = wdt.GetChunk("MAIN");
-            FileChunk const* maid = wdt.GetChunk("MAID");
-            for (uint32 y = 0; y < WDT_MAP_SIZE; ++y)
+            threadPool.PostWork([&, z]
             {
-                for (uint32 x = 0; x < WDT_MAP_SIZE; ++x)
-                {
-                    if (!(main->As<wdt_MAIN>()->adt_list[y][x].flag & 0x1))
-                        continue;
+                MapEntry const& mapEntry = map_ids[z];
 
-                    outputFileName = Trinity::StringFormat("{}/maps/{:04}_{:02}_{:02}.map", output_path.string(), map_ids[z].Id, y, x);
-                    bool ignoreDeepWater = IsDeepWaterIgnored(map_ids[z].Id, y, x);
-                    if (mphd && mphd->As<wdt_MPHD>()->flags & 0x200)
-                    {
-                        existingTiles[y * WDT_MAP_SIZE + x] = ConvertADT(maid->As<wdt_MAID>()->adt_files[y][x].rootADT, map_ids[z].Name, outputFileName, y, x, build, ignoreDeepWater);
-                    }
-                    else
+                // Loadup map grid data
+                ChunkedFile wdt;
+                if (!wdt.loadFile(CascStorage, mapEntry.WdtFileDataId, Trinity::StringFormat("WDT for map {}", mapEntry.Id), false))
+                    return;
+
+                printf("Extract %s (" SZFMTD "/" SZFMTD ")                  \n", mapEntry.Name.c_str(), z + 1, map_ids.size());
+
+                FileChunk const* mphd = wdt.GetChunk("MPHD");
+                FileChunk const* main = wdt.GetChunk("MAIN");
+                FileChunk const* maid = wdt.GetChunk("MAID");
+                bool hasFileDataIds = mphd && mphd->As<wdt_MPHD>()->flags & 0x200;
+                for (uint32 y = 0; y < WDT_MAP_SIZE; ++y)
+                {
+                    for (uint32 x = 0; x < WDT_MAP_SIZE; ++x)
                     {
-                        std::string storagePath = Trinity::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].Directory, map_ids[z].Directory, x, y);
-                        existingTiles[y * WDT_MAP_SIZE + x] = ConvertADT(storagePath, map_ids[z].Name, outputFileName, y, x, build, ignoreDeepWater);
+                        if (!(main->As<wdt_MAIN>()->adt_list[y][x].flag & 0x1))
+                            continue;
+
+                        // the wdt is gone by the time the tile is converted, only take what is needed to find the adt
+                        uint32 rootAdtFileDataId = hasFileDataIds ? maid->As<wdt_MAID>()->adt_files[y][x].rootADT : 0;
+                        ++queuedTiles;
+                        threadPool.PostWork([&, z, x, y, rootAdtFileDataId, hasFileDataIds]
+                        {
+                            MapEntry const& mapEntry = map_ids[z];
+                            std::string outputFileName = Trinity::StringFormat("{}/maps/{:04}_{:02}_{:02}.map", output_path.string(), mapEntry.Id, y, x);
+                            std::string storagePath = hasFileDataIds ? std::string() : Trinity::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", mapEntry.Directory, mapEntry.Directory, x, y);
+                            uint64 manifestKey = MakeManifestKey(mapEntry.Id, y, x);
+                            Optional<ContentKey> contentKey = hasFileDataIds ? GetContentKey(rootAdtFileDataId) : GetContentKey(storagePath.c_str());
+                            bool& exists = existingTiles[z][y * WDT_MAP_SIZE + x];
+
+                            ContentKey const* previousContentKey = Trinity::Containers::MapGetValuePtr(previousManifest, manifestKey);
+                            if (contentKey && previousContentKey && *contentKey == *previousContentKey && boost::filesystem::exists(outputFileName))
+                            {
+                                exists = true;
+                                ++unchangedTiles;
+                            }
+                            else
+                            {
+                                bool ignoreDeepWater = IsDeepWaterIgnored(mapEntry.Id, y, x);
+                                if (hasFileDataIds)
+                                    exists = ConvertADT(rootAdtFileDataId, mapEntry.Name, outputFileName, y, x, build, ignoreDeepWater);
+                                else
+                                    exists = ConvertADT(storagePath, mapEntry.Name, outputFileName, y, x, build, ignoreDeepWater);
+                            }
+
+                            if (exists && contentKey)
+                            {
+                                std::scoped_lock lock(manifestLock);
+                                manifest[manifestKey] = *contentKey;
+                            }
+
+                            // draw progress bar
+                            uint32 converted = ++convertedTiles;
+                            if (PrintProgress && !(converted % 64))
+                            {
+                                std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - startTime;
+                                printf("Processing........................%u/%u tiles (%.1f tiles/s)\r", converted, queuedTiles.load(), converted / std::max(elapsed.count(), 0.001f));
+                            }
+                        });
                     }
                 }
-
-                // draw progress bar
-                if (PrintProgress)
-                    printf("Processing........................%d%%\r", (100 * (y + 1)) / WDT_MAP_SIZE);
-            }
+            });
         }
 
+        threadPool.Join();
+    }
+
+    for (std::size_t z = 0; z < map_ids.size(); ++z)
+    {
+        std::bitset<(WDT_MAP_SIZE) * (WDT_MAP_SIZE)> tiles;
+        for (std::size_t i = 0; i < existingTiles[z].size(); ++i)
+            tiles[i] = existingTiles[z][i];
+
         if (auto tileList = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(Trinity::StringFormat("{}/maps/{:04}.tilelist", output_path.string(), map_ids[z].Id).c_str(), "wb")))
         {
             fwrite(MapMagic.data(), 1, MapMagic.size(), tileList.get());
             fwrite(&MapVersionMagic, 1, sizeof(MapVersionMagic), tileList.get());
             fwrite(&build, sizeof(build), 1, tileList.get());
-            fwrite(existingTiles.to_string().c_str(), 1, existingTiles.size(), tileList.get());
+            fwrite(tiles.to_string().c_str(), 1, tiles.size(), tileList.get());
         }
     }
 
-    printf("\n");
+    SaveManifest(manifestFileName, manifestSettings, manifest);
+
+    std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - startTime;
+    printf("\nProcessed %u tiles of " SZFMTD " maps in %.1f s (%.1f tiles/s), %u of them were unchanged\n", convertedTiles.load(), map_ids.size(), elapsed.count(),
+        convertedTiles.load() / std::max(elapsed.count(), 0.001f), unchangedTiles.load());
 }
 
 bool ExtractFile(CASC::File* fileInArchive, std::string const& filename)
@@ -25,7 +25,10 @@
 #include "PathCommon.h"
 #include "StringConvert.h"
 #include "StringFormat.h"
+#include "Timer.h"
+#include "VMapManager.h"
 #include <boost/filesystem/directory.hpp>
+#include <boost/filesystem/operations.hpp>
 
 namespace FileExtensions
 {
@@ -37,7 +40,7 @@ namespace MMAP
 {
     MapTileBuilder::MapTileBuilder(MapBuilder* mapBuilder, Optional<float> maxWalkableAngle, Optional<float> maxWalkableAngleNotSteep,
         bool skipLiquid, bool bigBaseUnit, bool debugOutput, std::vector<OffMeshData> const* offMeshConnections) :
-        TileBuilder(mapBuilder->m_inputDirectory, mapBuilder->m_outputDirectory, maxWalkableAngle, maxWalkableAngleNotSteep, skipLiquid, bigBaseUnit, debugOutput, offMeshConnections),
+        TileBuilder(mapBuilder->m_inputDirectory, mapBuilder->m_outputDirectory, maxWalkableAngle, maxWalkableAngleNotSteep, skipLiquid, bigBaseUnit, debugOutput, mapBuilder->m_compressTiles, offMeshConnections),
         m_mapBuilder(mapBuilder),
         m_workerThread(&MapTileBuilder::WorkerThread, this)
     {
@@ -62,11 +65,13 @@ namespace MMAP
     MapBuilder::MapBuilder(boost::filesystem::path const& inputDirectory, boost::filesystem::path const& outputDirectory,
         Optional<float> maxWalkableAngle, Optional<float> maxWalkableAngleNotSteep, bool skipLiquid,
         bool skipContinents, bool skipJunkMaps, bool skipBattlegrounds,
-        bool debugOutput, bool bigBaseUnit, int mapid, char const* offMeshFilePath, unsigned int threads) :
+        bool debugOutput, bool bigBaseUnit, bool compressTiles, int mapid, char const* offMeshFilePath, unsigned int threads, uint32 shardIndex, uint32 shardCount) :
         m_inputDirectory     (inputDirectory),
         m_outputDirectory    (outputDirectory),
         m_debugOutput        (debugOutput),
         m_threads            (threads),
+        m_shardIndex         (shardIndex),
+        m_shardCount         (shardCount),
         m_skipContinents     (skipContinents),
         m_skipJunkMaps       (skipJunkMaps),
         m_skipBattlegrounds  (skipBattlegrounds),
@@ -74,9 +79,12 @@ namespace MMAP
         m_maxWalkableAngle   (maxWalkableAngle),
         m_maxWalkableAngleNotSteep (maxWalkableAngleNotSteep),
         m_bigBaseUnit        (bigBaseUnit),
+        m_compressTiles      (compressTiles),
         m_mapid              (mapid),
         m_totalTiles         (0u),
         m_totalTilesProcessed(0u),
+        m_totalTileTime      (0u),
+        m_slowestTileTime    (0u),
         _cancelationToken    (false)
     {
 
@@ -135,7 +143,7 @@ namespace MMAP
                     for (uint32 tileX = 0; tileX < 64; ++tileX)
                         for (uint32 tileY = 0; tileY < 64; ++tileY)
                             if (tilesData[std::size(tilesData) - 1 - (tileX * 64 + tileY)] == '1')
-                                if (tiles.insert(VMAP::StaticMapTree::packTileID(tileX, tileY)).second)
+                                if (tiles.insert(VMAP::StaticMapTree::packTileID(tileX, tileY)).second && isTileInShard(*mapId, tileX, tileY))
                                     ++m_totalTiles;
                 }
             }
@@ -168,13 +176,16 @@ namespace MMAP
                 uint32 tileY = Trinity::StringTo<uint32>(std::string_view(fileName).substr(8, 2)).value_or(0);
                 uint32 tileID = VMAP::StaticMapTree::packTileID(tileX, tileY);
 
-                if (tiles.insert(tileID).second)
+                if (tiles.insert(tileID).second && isTileInShard(*mapId, tileX, tileY))
                     ++m_totalTiles;
             }
         }
 
         TC_LOG_INFO("maps.mmapgen", "Discovering maps... found {}.", m_tiles.size());
-        TC_LOG_INFO("maps.mmapgen", "Discovering tiles... found {}.\n", m_totalTiles);
+        if (m_shardCount > 1)
+            TC_LOG_INFO("maps.mmapgen", "Discovering tiles... found {} in shard {}/{}.\n", m_totalTiles, m_shardIndex, m_shardCount);
+        else
+            TC_LOG_INFO("maps.mmapgen", "Discovering tiles... found {}.\n", m_totalTiles);
     }
 
     /**************************************************************************/
@@ -242,7 +253,9 @@ namespace MMAP
                 return;
             }
 
+            uint32 start = getMSTime();
             buildTile(tileInfo.m_mapId, tileInfo.m_tileX, tileInfo.m_tileY, navMesh);
+            m_mapBuilder->onTileBuilt(tileInfo, GetMSTimeDiffToNow(start));
 
             dtFreeNavMesh(navMesh);
         }
@@ -257,17 +270,25 @@ namespace MMAP
             m_tileBuilders[i].reset(new MapTileBuilder(this, m_maxWalkableAngle, m_maxWalkableAngleNotSteep,
                 m_skipLiquid, m_bigBaseUnit, m_debugOutput, &m_offMeshConnections));
 
+        std::vector<TileInfo> tiles;
+        tiles.reserve(m_totalTiles);
         if (mapID)
         {
-            buildMap(*mapID);
+            buildMap(*mapID, tiles);
         }
         else
         {
             // Build all maps if no map id has been specified
             for (auto& [mapId, _] : m_tiles)
-                buildMap(mapId);
+                buildMap(mapId, tiles);
         }
 
+        // the most expensive tiles of all maps are started first, all threads keep busy with the cheap ones until the end
+        std::ranges::stable_sort(tiles, std::ranges::greater(), &TileInfo::m_estimatedCost);
+        uint32 start = getMSTime();
+        for (TileInfo const& tileInfo : tiles)
+            _queue.Push(tileInfo);
+
         while (!_queue.Empty())
         {
             std::this_thread::sleep_for(std::chrono::milliseconds(1000));
@@ -278,6 +299,49 @@ namespace MMAP
         _queue.Cancel();
 
         m_tileBuilders.clear();
+
+        if (m_slowestTileTime)
+        {
+            uint32 buildTime = GetMSTimeDiffToNow(start);
+            TC_LOG_INFO("maps.mmapgen", "Tiles were built in {} ms, {} ms of work on {} threads ({}% busy)", buildTime, m_totalTileTime, m_threads,
+                buildTime ? m_totalTileTime * 100 / (uint64(buildTime) * m_threads) : 100);
+            TC_LOG_INFO("maps.mmapgen", "Critical path: [Map {:04}] tile [{:02},{:02}] took {} ms (estimated cost {})", m_slowestTile.m_mapId,
+                m_slowestTile.m_tileX, m_slowestTile.m_tileY, m_slowestTileTime, m_slowestTile.m_estimatedCost);
+        }
+    }
+
+    void MapBuilder::onTileBuilt(TileInfo const& tileInfo, uint32 buildTime)
+    {
+        std::scoped_lock lock(m_tileTimesLock);
+        m_totalTileTime += buildTime;
+        if (buildTime > m_slowestTileTime)
+        {
+            m_slowestTileTime = buildTime;
+            m_slowestTile = tileInfo;
+        }
+    }
+
+    uint64 MapBuilder::estimateTileCost(uint32 mapID, uint32 tileX, uint32 tileY) const
+    {
+        // the tile is built from the terrain of itself and its neighbours, its vmap lists the models (and their triangles) placed on it
+        auto getSize = [&](auto getFileName)
+        {
+            for (int32 inputMapId = mapID; inputMapId != -1; inputMapId = sMapStore[inputMapId].ParentMapID)
+            {
+                boost::system::error_code ec;
+                uintmax_t size = boost::filesystem::file_size(getFileName(uint32(inputMapId)), ec);
+                if (!ec)
+                    return uint64(size);
+            }
+            return uint64(0);
+        };
+
+        uint64 cost = getSize([&](uint32 inputMapId) { return (m_inputDirectory / "vmaps" / VMAP::VMapManager::getTileFileName(inputMapId, tileX, tileY, "vmtile")).string(); });
+        for (uint32 x = std::max(tileX, 1u) - 1; x <= std::min(tileX + 1, 63u); ++x)
+            for (uint32 y = std::max(tileY, 1u) - 1; y <= std::min(tileY + 1, 63u); ++y)
+                cost += getSize([&](uint32 inputMapId) { return Trinity::StringFormat("{}/maps/{:04}_{:02}_{:02}.map", m_inputDirectory.generic_string(), inputMapId, x, y); });
+
+        return cost;
     }
 
     /**************************************************************************/
@@ -360,7 +424,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void MapBuilder::buildMap(uint32 mapID)
+    void MapBuilder::buildMap(uint32 mapID, std::vector<TileInfo>& tileInfos)
     {
         std::span<uint32 const> tiles = getTileList(mapID);
 
@@ -369,16 +433,25 @@ namespace MMAP
             // build navMesh
             dtNavMesh* navMesh = nullptr;
             buildNavMesh(mapID, navMesh);
+            // every shard writes the same .mmap file, only the tiles are split between them
+            std::vector<uint32> shardTiles;
+            std::ranges::copy_if(tiles, std::back_inserter(shardTiles), [&](uint32 packedTile)
+            {
+                uint32 tileX, tileY;
+                VMAP::StaticMapTree::unpackTileID(packedTile, tileX, tileY);
+                return isTileInShard(mapID, tileX, tileY);
+            });
+
             if (!navMesh)
             {
                 TC_LOG_ERROR("maps.mmapgen", "[Map {:04}] Failed creating navmesh!", mapID);
-                m_totalTilesProcessed += tiles.size();
+                m_totalTilesProcessed += shardTiles.size();
                 return;
             }
 
             // now start building mmtiles for each tile
-            TC_LOG_INFO("maps.mmapgen", "[Map {:04}] We have {} tiles.", mapID, tiles.size());
-            for (uint32 packedTile : tiles)
+            TC_LOG_INFO("maps.mmapgen", "[Map {:04}] We have {} tiles.", mapID, shardTiles.size());
+            for (uint32 packedTile : shardTiles)
             {
                 uint32 tileX, tileY;
 
@@ -389,8 +462,9 @@ namespace MMAP
                 tileInfo.m_mapId = mapID;
                 tileInfo.m_tileX = tileX;
                 tileInfo.m_tileY = tileY;
+                tileInfo.m_estimatedCost = estimateTileCost(mapID, tileX, tileY);
                 memcpy(&tileInfo.m_navMeshParams, navMesh->getParams(), sizeof(dtNavMeshParams));
-                _queue.Push(tileInfo);
+                tileInfos.push_back(tileInfo);
             }
 
             dtFreeNavMesh(navMesh);
@@ -568,6 +642,13 @@ namespace MMAP
         }
     }
 
+    /**************************************************************************/
+    bool MapBuilder::isTileInShard(uint32 mapID, uint32 tileX, uint32 tileY) const
+    {
+        // neighbouring tiles go to different shards, the expensive continents are spread over all of them
+        return (mapID * 64 * 64 + tileX * 64 + tileY) % m_shardCount == m_shardIndex;
+    }
+
     /**************************************************************************/
     bool MapTileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
     {
@@ -587,9 +668,46 @@ namespace MMAP
         if (header.mmapVersion != MMAP_VERSION)
             return false;
 
+        file.reset();
+
+        boost::system::error_code ec;
+        std::time_t tileTime = boost::filesystem::last_write_time(fileName, ec);
+        if (ec || hasNewerInput(mapID, tileX, tileY, tileTime))
+            return false;
+
         return TileBuilder::shouldSkipTile(mapID, tileX, tileY);
     }
 
+    bool MapTileBuilder::hasNewerInput(uint32 mapID, uint32 tileX, uint32 tileY, std::time_t tileTime) const
+    {
+        // a tile is built from the terrain and vmap of itself and its neighbours, falling back to the parent maps
+        auto isNewer = [&](auto getFileName)
+        {
+            for (int32 inputMapId = mapID; inputMapId != -1; inputMapId = sMapStore[inputMapId].ParentMapID)
+            {
+                boost::system::error_code ec;
+                std::time_t inputTime = boost::filesystem::last_write_time(getFileName(uint32(inputMapId)), ec);
+                if (!ec)
+                    return inputTime > tileTime;
+            }
+            return false;
+        };
+
+        for (uint32 x = std::max(tileX, 1u) - 1; x <= std::min(tileX + 1, 63u); ++x)
+        {
+            for (uint32 y = std::max(tileY, 1u) - 1; y <= std::min(tileY + 1, 63u); ++y)
+            {
+                if (isNewer([&](uint32 inputMapId) { return Trinity::StringFormat("{}/maps/{:04}_{:02}_{:02}.map", m_mapBuilder->m_inputDirectory.generic_string(), inputMapId, x, y); }))
+                    return true;
+
+                if (isNewer([&](uint32 inputMapId) { return (m_mapBuilder->m_inputDirectory / "vmaps" / VMAP::VMapManager::getTileFileName(inputMapId, x, y, "vmtile")).string(); }))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
     std::string MapTileBuilder::GetProgressText() const
     {
         return Trinity::StringFormat("{}%", m_mapBuilder->currentPercentageDone());
@@ -26,6 +26,8 @@
 #include <boost/filesystem/path.hpp>
 #include <DetourNavMesh.h>
 #include <atomic>
+#include <ctime>
+#include <mutex>
 #include <span>
 #include <thread>
 #include <vector>
@@ -36,11 +38,12 @@ namespace MMAP
 
     struct TileInfo
     {
-        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_navMeshParams() {}
+        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_estimatedCost(), m_navMeshParams() {}
 
         uint32 m_mapId;
         uint32 m_tileX;
         uint32 m_tileY;
+        uint64 m_estimatedCost;
         dtNavMeshParams m_navMeshParams;
     };
 
@@ -69,6 +72,9 @@ namespace MMAP
             void OnTileDone() override;
 
         private:
+            // whether any of the files the tile is built from changed after tileTime
+            bool hasNewerInput(uint32 mapID, uint32 tileX, uint32 tileY, std::time_t tileTime) const;
+
             MapBuilder* m_mapBuilder;
             std::thread m_workerThread;
     };
@@ -89,9 +95,12 @@ namespace MMAP
                 bool skipBattlegrounds,
                 bool debugOutput,
                 bool bigBaseUnit,
+                bool compressTiles,
                 int mapid,
                 char const* offMeshFilePath,
-                unsigned int threads);
+                unsigned int threads,
+                uint32 shardIndex,
+                uint32 shardCount);
 
             ~MapBuilder();
 
@@ -104,8 +113,11 @@ namespace MMAP
             void buildMaps(Optional<uint32> mapID);
 
         private:
-            // builds all mmap tiles for the specified map id (ignores skip settings)
-            void buildMap(uint32 mapID);
+            // collects all mmap tiles for the specified map id (ignores skip settings)
+            void buildMap(uint32 mapID, std::vector<TileInfo>& tiles);
+            // size of the terrain and vmap data the tile is built from, the tiles with the most of it take the longest to build
+            uint64 estimateTileCost(uint32 mapID, uint32 tileX, uint32 tileY) const;
+            void onTileBuilt(TileInfo const& tileInfo, uint32 buildTime);
             // detect maps and tiles
             void discoverTiles();
             std::span<uint32 const> getTileList(uint32 mapID) const;
@@ -117,6 +129,8 @@ namespace MMAP
             bool isDevMap(uint32 mapID) const;
             bool isBattlegroundMap(uint32 mapID) const;
             bool isContinentMap(uint32 mapID) const;
+            // whether the tile is built by this generator when the tiles are split between several of them
+            bool isTileInShard(uint32 mapID, uint32 tileX, uint32 tileY) const;
 
             uint32 percentageDone(uint32 totalTiles, uint32 totalTilesDone) const;
             uint32 currentPercentageDone() const;
@@ -131,6 +145,8 @@ namespace MMAP
 
             std::vector<OffMeshData> m_offMeshConnections;
             unsigned int m_threads;
+            uint32 m_shardIndex;
+            uint32 m_shardCount;
             bool m_skipContinents;
             bool m_skipJunkMaps;
             bool m_skipBattlegrounds;
@@ -139,12 +155,18 @@ namespace MMAP
             Optional<float> m_maxWalkableAngle;
             Optional<float> m_maxWalkableAngleNotSteep;
             bool m_bigBaseUnit;
+            bool m_compressTiles;
 
             int32 m_mapid;
 
             uint32 m_totalTiles;
             std::atomic<uint32> m_totalTilesProcessed;
 
+            std::mutex m_tileTimesLock;
+            uint64 m_totalTileTime;
+            uint32 m_slowestTileTime;
+            TileInfo m_slowestTile;
+
             std::vector<std::unique_ptr<TileBuilder>> m_tileBuilders;
             ProducerConsumerQueue<TileInfo> _queue;
             std::atomic<bool> _cancelationToken;
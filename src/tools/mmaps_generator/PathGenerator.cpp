@@ -25,6 +25,7 @@
 #include "MapBuilder.h"
 #include "Memory.h"
 #include "PathCommon.h"
+#include "StringConvert.h"
 #include "Timer.h"
 #include "Util.h"
 #include "VMapManager.h"
@@ -150,9 +151,12 @@ bool handleArgs(int argc, char** argv,
                bool& debugOutput,
                bool& silent,
                bool& bigBaseUnit,
+               bool& compressTiles,
                char const*& offMeshInputPath,
                char const*& file,
                unsigned int& threads,
+               uint32& shardIndex,
+               uint32& shardCount,
                boost::filesystem::path& inputDirectory,
                boost::filesystem::path& outputDirectory)
 {
@@ -191,6 +195,25 @@ bool handleArgs(int argc, char** argv,
                 return false;
             threads = static_cast<unsigned int>(std::max(0, atoi(param)));
         }
+        else if (strcmp(argv[i], "--shard") == 0)
+        {
+            param = argv[++i];
+            if (!param)
+                return false;
+
+            char* sindex = strtok(param, "/");
+            char* scount = strtok(nullptr, "/");
+            Optional<uint32> index = Trinity::StringTo<uint32>(sindex ? sindex : "");
+            Optional<uint32> count = Trinity::StringTo<uint32>(scount ? scount : "");
+            if (!index || !count || *index >= *count)
+            {
+                TC_LOG_ERROR("tool.mmapgen.commandline", "invalid shard, expected <index>/<count> with index below count.");
+                return false;
+            }
+
+            shardIndex = *index;
+            shardCount = *count;
+        }
         else if (strcmp(argv[i], "--file") == 0)
         {
             param = argv[++i];
@@ -302,6 +325,19 @@ bool handleArgs(int argc, char** argv,
             else
                 TC_LOG_ERROR("tool.mmapgen.commandline", "invalid option for '--bigBaseUnit', using default false");
         }
+        else if (strcmp(argv[i], "--compressTiles") == 0)
+        {
+            param = argv[++i];
+            if (!param)
+                return false;
+
+            if (strcmp(param, "true") == 0)
+                compressTiles = true;
+            else if (strcmp(param, "false") == 0)
+                compressTiles = false;
+            else
+                TC_LOG_ERROR("tool.mmapgen.commandline", "invalid option for '--compressTiles', using default false");
+        }
         else if (strcmp(argv[i], "--offMeshInput") == 0)
         {
             param = argv[++i];
@@ -444,6 +480,7 @@ int main(int argc, char** argv)
     Trinity::Banner::Show("MMAP generator", [](char const* text) { TC_LOG_INFO("tool.mmapgen", "{}", text); }, nullptr);
 
     unsigned int threads = std::thread::hardware_concurrency();
+    uint32 shardIndex = 0, shardCount = 1;
     int mapnum = -1;
     int tileX = -1, tileY = -1;
     Optional<float> maxAngle, maxAngleNotSteep;
@@ -453,7 +490,8 @@ int main(int argc, char** argv)
          skipBattlegrounds = false,
          debugOutput = false,
          silent = false,
-         bigBaseUnit = false;
+         bigBaseUnit = false,
+         compressTiles = false;
     char const* offMeshInputPath = nullptr;
     char const* file = nullptr;
     boost::filesystem::path inputDirectory = boost::filesystem::current_path();
@@ -462,7 +500,7 @@ int main(int argc, char** argv)
     bool validParam = handleArgs(argc, argv, mapnum,
                                  tileX, tileY, maxAngle, maxAngleNotSteep,
                                  skipLiquid, skipContinents, skipJunkMaps, skipBattlegrounds,
-                                 debugOutput, silent, bigBaseUnit, offMeshInputPath, file, threads,
+                                 debugOutput, silent, bigBaseUnit, compressTiles, offMeshInputPath, file, threads, shardIndex, shardCount,
                                  inputDirectory, outputDirectory);
 
     if (!validParam)
@@ -491,7 +529,7 @@ int main(int argc, char** argv)
     MMAP::CreateVMapManager = &MMAP::VMapFactory::CreateVMapManager;
 
     MMAP::MapBuilder builder(inputDirectory, outputDirectory, maxAngle, maxAngleNotSteep, skipLiquid, skipContinents, skipJunkMaps,
-                       skipBattlegrounds, debugOutput, bigBaseUnit, mapnum, offMeshInputPath, threads);
+                       skipBattlegrounds, debugOutput, bigBaseUnit, compressTiles, mapnum, offMeshInputPath, threads, shardIndex, shardCount);
 
     uint32 start = getMSTime();
     if (file)
@@ -0,0 +1,338 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Banner.h"
+#include "GitRevision.h"
+#include "Locales.h"
+#include "Optional.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+namespace po = boost::program_options;
+
+namespace
+{
+#pragma pack(push, 1)
+
+// PKT 3.1 as written by PacketLog
+struct LogHeader
+{
+    char Signature[3];
+    uint16 FormatVersion;
+    uint8 SnifferId;
+    uint32 Build;
+    char Locale[4];
+    uint8 SessionKey[40];
+    uint32 SniffStartUnixtime;
+    uint32 SniffStartTicks;
+    uint32 OptionalDataSize;
+};
+
+struct PacketHeader
+{
+    struct OptionalData
+    {
+        uint8 SocketIPBytes[16];
+        uint32 SocketPort;
+    };
+
+    uint32 Direction;
+    uint32 ConnectionId;
+    uint32 ArrivalTicks;
+    uint32 OptionalDataSize;
+    uint32 Length;
+    OptionalData OptionalData;
+    uint32 Opcode;
+};
+
+#pragma pack(pop)
+
+constexpr uint32 ClientToServer = 0x47534d43;
+
+struct Packet
+{
+    uint32 Time;            // milliseconds since the first packet of the file
+    uint32 Connection;      // index into the connection list
+    uint32 Opcode;
+    uint32 Size;
+    bool FromClient;
+};
+
+struct Connection
+{
+    std::array<uint8, 16> Address = { };
+    uint32 Port = 0;
+    uint32 Type = 0;
+    std::array<uint32, 2> Packets = { };
+    std::array<uint64, 2> Bytes = { };
+    uint32 FirstTime = 0;
+    uint32 LastTime = 0;
+};
+
+struct OpcodeStats
+{
+    uint32 Count = 0;
+    uint64 Bytes = 0;
+};
+
+bool ReadPackets(std::string const& fileName, std::vector<Packet>* packets, std::vector<Connection>* connections)
+{
+    // gzread reads uncompressed files as they are
+    gzFile file = gzopen(fileName.c_str(), "rb");
+    if (!file)
+    {
+        std::cerr << "Could not open " << fileName << '\n';
+        return false;
+    }
+
+    auto read = [&](void* data, std::size_t size) { return gzread(file, data, unsigned(size)) == int(size); };
+
+    LogHeader header;
+    if (!read(&header, sizeof(header)) || std::memcmp(header.Signature, "PKT", 3) != 0 || header.FormatVersion != 0x0301)
+    {
+        std::cerr << fileName << " is not a PKT 3.1 file\n";
+        gzclose(file);
+        return false;
+    }
+
+    std::vector<uint8> skipped(header.OptionalDataSize);
+    read(skipped.data(), skipped.size());
+
+    std::map<std::pair<std::array<uint8, 16>, uint32>, uint32> connectionIndexes;
+    Optional<uint32> firstTicks;
+    PacketHeader packetHeader;
+    std::vector<uint8> payload;
+    while (read(&packetHeader, sizeof(packetHeader)))
+    {
+        uint32 size = packetHeader.Length - sizeof(packetHeader.Opcode);
+        payload.resize(size);
+        if (!read(payload.data(), size))
+        {
+            std::cerr << fileName << " ends inside a packet, the server was probably still writing it\n";
+            break;
+        }
+
+        if (!firstTicks)
+            firstTicks = packetHeader.ArrivalTicks;
+
+        std::array<uint8, 16> address;
+        std::memcpy(address.data(), packetHeader.OptionalData.SocketIPBytes, address.size());
+        auto [itr, inserted] = connectionIndexes.try_emplace({ address, packetHeader.OptionalData.SocketPort }, uint32(connections->size()));
+        if (inserted)
+        {
+            Connection& connection = connections->emplace_back();
+            connection.Address = address;
+            connection.Port = packetHeader.OptionalData.SocketPort;
+            connection.Type = packetHeader.ConnectionId;
+            connection.FirstTime = packetHeader.ArrivalTicks - *firstTicks;
+        }
+
+        Packet& packet = packets->emplace_back();
+        packet.Time = packetHeader.ArrivalTicks - *firstTicks;
+        packet.Connection = itr->second;
+        packet.Opcode = packetHeader.Opcode;
+        packet.Size = size;
+        packet.FromClient = packetHeader.Direction == ClientToServer;
+
+        Connection& connection = (*connections)[packet.Connection];
+        ++connection.Packets[packet.FromClient];
+        connection.Bytes[packet.FromClient] += size;
+        connection.LastTime = packet.Time;
+    }
+
+    gzclose(file);
+    return true;
+}
+
+std::string FormatAddress(Connection const& connection)
+{
+    // PacketLog stores ipv4 addresses in the first 4 bytes
+    if (std::all_of(connection.Address.begin() + 4, connection.Address.end(), [](uint8 byte) { return byte == 0; }))
+        return Trinity::StringFormat("{}.{}.{}.{}:{}", connection.Address[0], connection.Address[1], connection.Address[2], connection.Address[3], connection.Port);
+
+    return Trinity::StringFormat("[{}]:{}", ByteArrayToHexStr(connection.Address), connection.Port);
+}
+
+/**
+ * Parses command line arguments
+ *
+ * @return Non-empty optional if program should exit immediately (holds exit code in that case)
+ */
+Optional<int> HandleArgs(int argc, char* argv[], std::string* file, uint32* copies, float* timeScale, uint32* spread, uint32* seed, uint32* topOpcodes)
+{
+    po::options_description visible("Usage: packet_log_stats [OPTION]... <packet log>\n\n"
+        "Splits a packet log written by PacketLogFile into connections and reports their traffic.\n"
+        "The load profile replays every connection again for each copy, shifted by a random\n"
+        "delay and sped up by the time scale, and reports the packet and byte rates that results in.\n\n"
+        "Where OPTION can be any of");
+    visible.add_options()
+        ("copies", po::value<uint32>(copies)->default_value(1), "number of times every connection is replayed in the load profile")
+        ("time-scale", po::value<float>(timeScale)->default_value(1.0f), "speed of the replayed connections, 2 replays them twice as fast")
+        ("spread", po::value<uint32>(spread)->default_value(60), "copies start within this many seconds of each other")
+        ("seed", po::value<uint32>(seed)->default_value(1), "seed of the copy delays, equal seeds give equal profiles")
+        ("top", po::value<uint32>(topOpcodes)->default_value(20), "number of opcodes listed")
+        ("help,h", "print usage message")
+        ("version,v", "print version build info");
+
+    po::options_description hidden;
+    hidden.add_options()
+        ("file", po::value(file)->required(), "packet log");
+
+    po::options_description all;
+    all.add(visible).add(hidden);
+
+    po::positional_options_description positional;
+    positional.add("file", 1);
+
+    po::variables_map variablesMap;
+    try
+    {
+        store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), variablesMap);
+
+        if (variablesMap.find("help") != variablesMap.end())
+        {
+            std::cout << visible << '\n';
+            return 0;
+        }
+
+        if (variablesMap.find("version") != variablesMap.end())
+        {
+            std::cout << GitRevision::GetFullVersion() << '\n';
+            return 0;
+        }
+
+        notify(variablesMap);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    if (*copies < 1 || *timeScale <= 0.0f)
+    {
+        std::cerr << "--copies must be at least 1 and --time-scale above 0\n";
+        return 1;
+    }
+
+    return {};
+}
+}
+
+int main(int argc, char* argv[])
+{
+    Trinity::VerifyOsVersion();
+
+    Trinity::Locale::Init();
+
+    std::string file;
+    uint32 copies = 1, spread = 0, seed = 0, topOpcodes = 0;
+    float timeScale = 1.0f;
+    if (Optional<int> exitCode = HandleArgs(argc, argv, &file, &copies, &timeScale, &spread, &seed, &topOpcodes))
+        return *exitCode;
+
+    Trinity::Banner::Show("packet log stats", [](char const* text) { std::cout << text << std::endl; }, nullptr);
+
+    std::vector<Packet> packets;
+    std::vector<Connection> connections;
+    if (!ReadPackets(file, &packets, &connections))
+        return 1;
+
+    std::cout << Trinity::StringFormat("{} packets in {} connections over {:.1f} s\n\n", packets.size(), connections.size(),
+        packets.empty() ? 0.0f : packets.back().Time / 1000.0f);
+
+    std::cout << "Connections (address, type, duration, client packets/bytes, server packets/bytes)\n";
+    for (Connection const& connection : connections)
+        std::cout << Trinity::StringFormat("  {:<40} {} {:>8.1f} s {:>8} {:>10} {:>8} {:>12}\n", FormatAddress(connection), connection.Type,
+            (connection.LastTime - connection.FirstTime) / 1000.0f, connection.Packets[1], connection.Bytes[1], connection.Packets[0], connection.Bytes[0]);
+
+    std::map<uint32, OpcodeStats> serverOpcodes;
+    for (Packet const& packet : packets)
+    {
+        if (packet.FromClient)
+            continue;
+
+        OpcodeStats& stats = serverOpcodes[packet.Opcode];
+        ++stats.Count;
+        stats.Bytes += packet.Size;
+    }
+
+    std::vector<std::pair<uint32, OpcodeStats>> sortedOpcodes(serverOpcodes.begin(), serverOpcodes.end());
+    std::ranges::sort(sortedOpcodes, [](auto const& left, auto const& right) { return left.second.Bytes > right.second.Bytes; });
+    sortedOpcodes.resize(std::min<std::size_t>(sortedOpcodes.size(), topOpcodes));
+
+    std::cout << "\nServer opcodes by bytes (opcode, packets, bytes)\n";
+    for (auto const& [opcode, stats] : sortedOpcodes)
+        std::cout << Trinity::StringFormat("  0x{:06X} {:>10} {:>14}\n", opcode, stats.Count, stats.Bytes);
+
+    // every copy of a connection is delayed by the same random amount, so its packets keep their relative order
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<uint32> delay(0, spread * 1000);
+    std::vector<uint32> copyDelays(std::size_t(copies) * connections.size());
+    for (uint32& copyDelay : copyDelays)
+        copyDelay = delay(random);
+
+    struct Second
+    {
+        uint64 ClientPackets = 0;
+        uint64 ServerBytes = 0;
+    };
+
+    std::vector<Second> timeline;
+    for (Packet const& packet : packets)
+    {
+        for (uint32 copy = 0; copy < copies; ++copy)
+        {
+            uint32 time = uint32((packet.Time - connections[packet.Connection].FirstTime) / timeScale) + copyDelays[copy * connections.size() + packet.Connection];
+            std::size_t second = time / 1000;
+            if (second >= timeline.size())
+                timeline.resize(second + 1);
+
+            if (packet.FromClient)
+                ++timeline[second].ClientPackets;
+            else
+                timeline[second].ServerBytes += packet.Size;
+        }
+    }
+
+    if (timeline.empty())
+        return 0;
+
+    Second peak, total;
+    for (Second const& second : timeline)
+    {
+        peak.ClientPackets = std::max(peak.ClientPackets, second.ClientPackets);
+        peak.ServerBytes = std::max(peak.ServerBytes, second.ServerBytes);
+        total.ClientPackets += second.ClientPackets;
+        total.ServerBytes += second.ServerBytes;
+    }
+
+    std::cout << Trinity::StringFormat("\nLoad profile of {} sessions at {}x speed over {} s\n", copies * connections.size(), timeScale, timeline.size());
+    std::cout << Trinity::StringFormat("  client packets/s: {:.0f} average, {} peak\n", double(total.ClientPackets) / timeline.size(), peak.ClientPackets);
+    std::cout << Trinity::StringFormat("  server bytes/s:   {:.0f} average, {} peak\n", double(total.ServerBytes) / timeline.size(), peak.ServerBytes);
+    return 0;
+}
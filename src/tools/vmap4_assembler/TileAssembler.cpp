@@ -17,6 +17,7 @@
 
 #include "TileAssembler.h"
 #include "BoundingIntervalHierarchy.h"
+#include "CryptoHash.h"
 #include "Duration.h"
 #include "IteratorPair.h"
 #include "MapTree.h"
@@ -43,6 +44,24 @@ namespace VMAP
         return Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(p.string().c_str(), mode));
     }
 
+    static Optional<Trinity::Crypto::SHA256::Digest> HashFile(boost::filesystem::path const& p)
+    {
+        auto file = OpenFile(p, "rb");
+        if (!file)
+            return {};
+
+        Trinity::Crypto::SHA256 hash;
+        uint8 buffer[64 * 1024];
+        while (std::size_t read = fread(buffer, 1, sizeof(buffer), file.get()))
+            hash.UpdateData(buffer, read);
+
+        if (ferror(file.get()))
+            return {};
+
+        hash.Finalize();
+        return hash.GetDigest();
+    }
+
     G3D::Vector3 ModelPosition::transform(G3D::Vector3 const& pIn) const
     {
         G3D::Vector3 out = pIn * iScale;
@@ -143,16 +162,49 @@ namespace VMAP
 
         // add an object models, listed in temp_gameobject_models file
         exportGameobjectModels();
-        // export objects
-        printf("\nConverting Model Files\n");
+        // the same model is often extracted under several names, identical raw files are converted once and copied
+        std::vector<std::string const*> modelFiles;
+        modelFiles.reserve(spawnedModelFiles.size());
         for (std::string const& spawnedModelFile : spawnedModelFiles)
+            modelFiles.push_back(&spawnedModelFile);
+
+        std::vector<Optional<Trinity::Crypto::SHA256::Digest>> modelHashes(modelFiles.size());
         {
-            threadPool.PostWork([&]
+            Trinity::ThreadPool hashPool(iThreads);
+            for (std::size_t i = 0; i < modelFiles.size(); ++i)
+                hashPool.PostWork([&, i] { modelHashes[i] = HashFile(iSrcDir / *modelFiles[i]); });
+
+            hashPool.Join();
+        }
+
+        std::map<Trinity::Crypto::SHA256::Digest, std::size_t> convertedModels;
+        std::vector<std::pair<std::string const*, std::string const*>> copiedModels;    // converted model, copy
+        std::vector<std::string const*> modelsToConvert;
+        for (std::size_t i = 0; i < modelFiles.size(); ++i)
+        {
+            if (modelHashes[i])
             {
-                printf("Converting %s\n", spawnedModelFile.c_str());
-                if (!convertRawFile(spawnedModelFile))
+                auto [itr, inserted] = convertedModels.try_emplace(*modelHashes[i], i);
+                if (!inserted)
                 {
-                    printf("error converting %s\n", spawnedModelFile.c_str());
+                    copiedModels.emplace_back(modelFiles[itr->second], modelFiles[i]);
+                    continue;
+                }
+            }
+
+            modelsToConvert.push_back(modelFiles[i]);
+        }
+
+        // export objects
+        printf("\nConverting Model Files (" SZFMTD " unique of " SZFMTD ")\n", modelsToConvert.size(), modelFiles.size());
+        for (std::string const* spawnedModelFile : modelsToConvert)
+        {
+            threadPool.PostWork([&, spawnedModelFile]
+            {
+                printf("Converting %s\n", spawnedModelFile->c_str());
+                if (!convertRawFile(*spawnedModelFile))
+                {
+                    printf("error converting %s\n", spawnedModelFile->c_str());
                     abortThreads();
                 }
             });
@@ -163,6 +215,18 @@ namespace VMAP
         if (aborted)
             return false;
 
+        for (auto const& [convertedModel, copy] : copiedModels)
+        {
+            boost::filesystem::path destination = iDestDir / (*copy + ".vmo");
+            boost::filesystem::remove(destination, ec);
+            boost::filesystem::copy_file(iDestDir / (*convertedModel + ".vmo"), destination, ec);
+            if (ec)
+            {
+                printf("error copying %s to %s: %s\n", convertedModel->c_str(), copy->c_str(), ec.message().c_str());
+                return false;
+            }
+        }
+
         return true;
     }
 
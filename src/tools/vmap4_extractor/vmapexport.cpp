@@ -39,6 +39,7 @@
 #include <map>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <cstdio>
 
@@ -78,6 +79,7 @@ char const* CascRegion = "eu";
 bool UseRemoteCasc = false;
 uint32 DbcLocale = 0;
 uint32 Threads = std::thread::hardware_concurrency();
+std::unordered_set<uint32> MapFilter;                    // only these maps are extracted if not empty
 
 // Constants
 
@@ -322,11 +324,31 @@ bool IsLiquidIgnored(uint32 liquidTypeId)
 
 void ParsMapFiles()
 {
+    // maps left out by --maps are still loaded when they are the parent of one that is extracted
+    std::unordered_set<uint32> loadedMaps;
+    for (MapEntry const& mapEntry : map_ids)
+    {
+        if (!MapFilter.empty() && !MapFilter.contains(mapEntry.Id))
+            continue;
+
+        loadedMaps.insert(mapEntry.Id);
+        for (int16 parentMapId = mapEntry.ParentMapID; parentMapId >= 0;)
+        {
+            loadedMaps.insert(uint32(parentMapId));
+            auto parentMapItr = std::ranges::find(map_ids, uint32(parentMapId), &MapEntry::Id);
+            parentMapId = parentMapItr != map_ids.end() ? parentMapItr->ParentMapID : -1;
+        }
+    }
+
     std::unordered_map<uint32, WDTFile> wdts;
     std::map<uint32, std::vector<MapEntry const*>> steps;
     for (MapEntry const& mapEntry : map_ids)
     {
-        steps[mapEntry.ChildDepth].push_back(&mapEntry);
+        if (!loadedMaps.contains(mapEntry.Id))
+            continue;
+
+        if (MapFilter.empty() || MapFilter.contains(mapEntry.Id))
+            steps[mapEntry.ChildDepth].push_back(&mapEntry);
 
         // preload WDTs
         std::string description = Trinity::StringFormat("WDT for map {} - {} (FileDataID {})", mapEntry.Id, mapEntry.Name, mapEntry.WdtFileDataId);
@@ -584,6 +606,29 @@ bool processArgv(int argc, char ** argv, const char *versionString)
             else
                 result = false;
         }
+        else if (strcmp("--cache", argv[i]) == 0)
+        {
+            Optional<uint32> megabytes = i + 1 < argc ? Trinity::StringTo<uint32>(argv[++i]) : Optional<uint32>();
+            if (megabytes)
+                CASC::BlockCache::SetCapacity(std::size_t(*megabytes) * 1024 * 1024);
+            else
+                result = false;
+        }
+        else if (strcmp("--maps", argv[i]) == 0)
+        {
+            if (i + 1 < argc && strlen(argv[i + 1]))
+            {
+                for (std::string_view mapId : Trinity::Tokenize(argv[++i], ',', false))
+                {
+                    if (Optional<uint32> id = Trinity::StringTo<uint32>(mapId))
+                        MapFilter.insert(*id);
+                    else
+                        result = false;
+                }
+            }
+            else
+                result = false;
+        }
         else
         {
             result = false;
@@ -603,6 +648,8 @@ bool processArgv(int argc, char ** argv, const char *versionString)
         printf("   -r  set remote casc region - standard: eu\n");
         printf("   -dl dbc locale\n");
         printf("   --threads <N> number of threads to use, default: all cpu cores\n");
+        printf("   --maps <id,...> comma separated list of map ids to extract, default: all maps\n");
+        printf("   --cache <MB> size of the casc read cache, 0 disables it, default: 256\n");
         printf("   -? : This message.\n");
     }
 
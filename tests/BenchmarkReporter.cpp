@@ -0,0 +1,84 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define CATCH_CONFIG_EXTERNAL_INTERFACES
+#include "catch2/catch.hpp"
+#include <iomanip>
+
+namespace
+{
+/*
+ * Writes the results of every benchmark as one JSON document for regression tracking:
+ * tests "[benchmark],[!benchmark]" -r benchmark-json -o benchmarks.json
+ * Durations are nanoseconds per run of the benchmark body.
+ */
+class BenchmarkJsonReporter : public Catch::StreamingReporterBase<BenchmarkJsonReporter>
+{
+public:
+    using StreamingReporterBase::StreamingReporterBase;
+
+    static std::string getDescription() { return "Reports benchmark results as JSON"; }
+
+    void assertionStarting(Catch::AssertionInfo const& /*assertionInfo*/) override { }
+    bool assertionEnded(Catch::AssertionStats const& /*assertionStats*/) override { return true; }
+
+    void testRunStarting(Catch::TestRunInfo const& testRunInfo) override
+    {
+        StreamingReporterBase::testRunStarting(testRunInfo);
+        stream << "{\n  \"benchmarks\": [";
+    }
+
+    void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override
+    {
+        stream << (_first ? "\n" : ",\n") << std::setprecision(6)
+            << "    { \"test_case\": " << Quote(currentTestCaseInfo->name)
+            << ", \"name\": " << Quote(stats.info.name)
+            << ", \"samples\": " << stats.info.samples
+            << ", \"iterations\": " << stats.info.iterations
+            << ", \"mean\": " << stats.mean.point.count()
+            << ", \"mean_lower\": " << stats.mean.lower_bound.count()
+            << ", \"mean_upper\": " << stats.mean.upper_bound.count()
+            << ", \"standard_deviation\": " << stats.standardDeviation.point.count()
+            << ", \"outlier_variance\": " << stats.outlierVariance << " }";
+        _first = false;
+    }
+
+    void testRunEnded(Catch::TestRunStats const& testRunStats) override
+    {
+        stream << (_first ? "" : "\n  ") << "],\n  \"failed_assertions\": " << testRunStats.totals.assertions.failed << "\n}\n";
+        StreamingReporterBase::testRunEnded(testRunStats);
+    }
+
+private:
+    static std::string Quote(std::string const& text)
+    {
+        std::string quoted = "\"";
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                quoted += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20)
+                quoted += c;
+        }
+        return quoted + '"';
+    }
+
+    bool _first = true;
+};
+}
+
+CATCH_REGISTER_REPORTER("benchmark-json", BenchmarkJsonReporter)
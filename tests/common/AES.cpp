@@ -0,0 +1,114 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AES.h"
+#include "CryptoRandom.h"
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+using Trinity::Crypto::AES;
+
+namespace
+{
+AES::IV MakeIV(uint64 counter)
+{
+    AES::IV iv = { };
+    std::memcpy(iv.data(), &counter, sizeof(counter));
+    return iv;
+}
+}
+
+TEST_CASE("Batches match single messages", "[AES]")
+{
+    std::array<uint8, 32> key = Trinity::Crypto::GetRandomBytes<32>();
+    AES single(true, 256), batched(true, 256), decrypt(false, 256);
+    single.Init(key);
+    batched.Init(key);
+    decrypt.Init(key);
+
+    std::vector<std::vector<uint8>> messages;
+    for (size_t size : { 0, 1, 15, 16, 17, 300, 4096 })
+    {
+        std::vector<uint8>& message = messages.emplace_back(size);
+        for (size_t i = 0; i < size; ++i)
+            message[i] = uint8(i * 7 + size);
+    }
+
+    std::vector<std::vector<uint8>> batchedData = messages;
+    std::vector<std::array<uint8, AES::TAG_SIZE_BYTES>> batchedTags(messages.size());
+    std::vector<AES::BatchEntry> entries;
+    for (size_t i = 0; i < messages.size(); ++i)
+        entries.push_back({ .Iv = MakeIV(i), .Data = batchedData[i].data(), .Length = batchedData[i].size(),
+            .TagData = reinterpret_cast<AES::Tag*>(batchedTags[i].data()) });
+
+    REQUIRE(batched.ProcessBatch(entries));
+
+    for (size_t i = 0; i < messages.size(); ++i)
+    {
+        std::vector<uint8> data = messages[i];
+        AES::Tag tag;
+        REQUIRE(single.Process(MakeIV(i), data.data(), data.size(), tag));
+        REQUIRE(data == batchedData[i]);
+        REQUIRE(std::memcmp(tag, batchedTags[i].data(), sizeof(tag)) == 0);
+
+        REQUIRE(decrypt.Process(MakeIV(i), data.data(), data.size(), tag));
+        REQUIRE(data == messages[i]);
+    }
+
+    SECTION("decrypting checks the tags")
+    {
+        ++batchedTags[3][0];
+        REQUIRE(!decrypt.ProcessBatch(entries));
+    }
+}
+
+TEST_CASE("World packet encryption throughput", "[.][benchmark][AES]")
+{
+    // OpenSSL picks its AES-NI/VAES code by itself, OPENSSL_ia32cap=~0x200000200000000 in the environment turns it off for comparison
+    std::array<uint8, 32> key = Trinity::Crypto::GetRandomBytes<32>();
+    AES aes(true, 256);
+    aes.Init(key);
+
+    for (size_t size : { 32, 256, 4096 })
+    {
+        // one send buffer of packets, like WorldSocket::Update fills it
+        size_t count = 65536 / size;
+        std::vector<uint8> buffer(count * size);
+        std::vector<std::array<uint8, AES::TAG_SIZE_BYTES>> tags(count);
+        std::vector<AES::BatchEntry> entries(count);
+        uint64 counter = 0;
+
+        uint32 rounds = 0;
+        auto begin = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed;
+        do
+        {
+            for (size_t i = 0; i < count; ++i)
+                entries[i] = { .Iv = MakeIV(counter++), .Data = &buffer[i * size], .Length = size, .TagData = reinterpret_cast<AES::Tag*>(tags[i].data()) };
+
+            REQUIRE(aes.ProcessBatch(entries));
+            ++rounds;
+            elapsed = std::chrono::steady_clock::now() - begin;
+        } while (elapsed.count() < 0.2);
+
+        double bytes = double(rounds) * buffer.size();
+        WARN(size << " byte packets: " << uint64(bytes / elapsed.count() / 1000000) << " MB/s, " << uint64(elapsed.count() * 1e9 / (double(rounds) * count)) << " ns per packet");
+    }
+}
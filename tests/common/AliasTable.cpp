@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AliasTable.h"
+#include <array>
+
+using Trinity::AliasTable;
+
+namespace
+{
+// exact chance of every index, every column is split at a fine grid of rolls
+std::vector<double> GetChances(AliasTable const& table)
+{
+    constexpr uint32 Rolls = 10000;
+    std::vector<double> chances(table.GetSize());
+    for (uint32 column = 0; column < table.GetSize(); ++column)
+        for (uint32 roll = 0; roll < Rolls; ++roll)
+            chances[table.Select(column, (roll + 0.5) / Rolls)] += 1.0 / (Rolls * table.GetSize());
+
+    return chances;
+}
+}
+
+TEST_CASE("Chances follow the weights", "[AliasTable]")
+{
+    AliasTable table;
+
+    SECTION("uneven weights")
+    {
+        std::array<double, 5> weights = { 10.0, 30.0, 5.0, 50.0, 5.0 };
+        table.Build(weights);
+        std::vector<double> chances = GetChances(table);
+        for (std::size_t i = 0; i < weights.size(); ++i)
+            REQUIRE(chances[i] == Approx(weights[i] / 100.0).margin(0.0001));
+    }
+
+    SECTION("zero weights are never selected")
+    {
+        std::array<double, 4> weights = { 0.0, 1.0, 0.0, 3.0 };
+        table.Build(weights);
+        std::vector<double> chances = GetChances(table);
+        REQUIRE(chances[0] == 0.0);
+        REQUIRE(chances[2] == 0.0);
+        REQUIRE(chances[1] == Approx(0.25).margin(0.0001));
+        REQUIRE(chances[3] == Approx(0.75).margin(0.0001));
+    }
+
+    SECTION("a single weight")
+    {
+        std::array<double, 1> weights = { 42.0 };
+        table.Build(weights);
+        REQUIRE(table.Select(0, 0.99) == 0);
+        REQUIRE(table.Select() == 0);
+    }
+
+    SECTION("no weight at all")
+    {
+        std::array<double, 3> weights = { 0.0, 0.0, 0.0 };
+        table.Build(weights);
+        REQUIRE(table.IsEmpty());
+    }
+}
+
+TEST_CASE("Random selection", "[AliasTable]")
+{
+    std::array<double, 3> weights = { 1.0, 0.0, 1.0 };
+    AliasTable table;
+    table.Build(weights);
+
+    std::array<uint32, 3> counts = { };
+    for (uint32 i = 0; i < 10000; ++i)
+        ++counts[table.Select()];
+
+    REQUIRE(counts[1] == 0);
+    REQUIRE(counts[0] > 4000);
+    REQUIRE(counts[2] > 4000);
+}
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AsyncCallbackProcessor.h"
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct SignaledCallback
+{
+    std::future<int> Result;
+    std::shared_ptr<AsyncCompletionSignal> Completion;
+    std::function<void(int)> Callback;
+};
+
+bool InvokeAsyncCallbackIfReady(SignaledCallback& callback)
+{
+    if (callback.Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    int value = -1;
+    try
+    {
+        value = callback.Result.get();
+    }
+    catch (std::future_error const&)
+    {
+    }
+
+    callback.Callback(value);
+    return true;
+}
+
+AsyncCompletionSignal* GetAsyncCallbackCompletionSignal(SignaledCallback& callback) { return callback.Completion.get(); }
+
+struct PolledCallback
+{
+    std::future<int> Result;
+    std::function<void(int)> Callback;
+};
+
+bool InvokeAsyncCallbackIfReady(PolledCallback& callback)
+{
+    if (callback.Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    callback.Callback(callback.Result.get());
+    return true;
+}
+
+SignaledCallback MakeCallback(AsyncCompletionPromise<int>& promise, std::vector<int>& results)
+{
+    return { .Result = promise.GetFuture(), .Completion = promise.GetSignal(), .Callback = [&results](int value) { results.push_back(value); } };
+}
+}
+
+TEST_CASE("AsyncCallbackProcessor invokes signaled callbacks once completed", "[AsyncCallbackProcessor]")
+{
+    AsyncCallbackProcessor<SignaledCallback> processor;
+    std::vector<int> results;
+
+    SECTION("Result ready before the callback was added")
+    {
+        AsyncCompletionPromise<int> promise;
+        SignaledCallback callback = MakeCallback(promise, results);
+        promise.SetValue(1);
+        processor.AddCallback(std::move(callback));
+
+        processor.ProcessReadyCallbacks();
+        REQUIRE(results == std::vector<int>{ 1 });
+        REQUIRE(processor.Empty());
+    }
+
+    SECTION("Result ready after the callback was added")
+    {
+        AsyncCompletionPromise<int> first, second;
+        processor.AddCallback(MakeCallback(first, results));
+        processor.AddCallback(MakeCallback(second, results));
+
+        processor.ProcessReadyCallbacks();
+        REQUIRE(results.empty());
+
+        second.SetValue(2);
+        processor.ProcessReadyCallbacks();
+        REQUIRE(results == std::vector<int>{ 2 });
+        REQUIRE(!processor.Empty());
+
+        first.SetValue(1);
+        processor.ProcessReadyCallbacks();
+        processor.ProcessReadyCallbacks();
+        REQUIRE(results == std::vector<int>{ 2, 1 });
+        REQUIRE(processor.Empty());
+    }
+
+    SECTION("Abandoned promise still completes the callback")
+    {
+        {
+            AsyncCompletionPromise<int> promise;
+            processor.AddCallback(MakeCallback(promise, results));
+        }
+
+        processor.ProcessReadyCallbacks();
+        REQUIRE(results == std::vector<int>{ -1 });
+        REQUIRE(processor.Empty());
+    }
+
+    SECTION("Cancelled callbacks ignore later completions")
+    {
+        AsyncCompletionPromise<int> promise;
+        processor.AddCallback(MakeCallback(promise, results));
+        processor.CancelAll();
+        promise.SetValue(1);
+
+        processor.ProcessReadyCallbacks();
+        REQUIRE(results.empty());
+        REQUIRE(processor.Empty());
+    }
+
+    SECTION("Results completed by other threads")
+    {
+        constexpr int Count = 1000;
+        std::vector<AsyncCompletionPromise<int>> promises(Count);
+        for (AsyncCompletionPromise<int>& promise : promises)
+            processor.AddCallback(MakeCallback(promise, results));
+
+        std::thread producer([&]
+        {
+            for (int i = 0; i < Count; ++i)
+                promises[i].SetValue(i);
+        });
+
+        while (!processor.Empty())
+            processor.ProcessReadyCallbacks();
+
+        producer.join();
+        REQUIRE(results.size() == Count);
+    }
+}
+
+TEST_CASE("AsyncCallbackProcessor polls callbacks without signal", "[AsyncCallbackProcessor]")
+{
+    AsyncCallbackProcessor<PolledCallback> processor;
+    std::vector<int> results;
+
+    std::promise<int> promise;
+    processor.AddCallback({ .Result = promise.get_future(), .Callback = [&results](int value) { results.push_back(value); } });
+
+    processor.ProcessReadyCallbacks();
+    REQUIRE(results.empty());
+
+    promise.set_value(3);
+    processor.ProcessReadyCallbacks();
+    REQUIRE(results == std::vector<int>{ 3 });
+    REQUIRE(processor.Empty());
+}
@@ -0,0 +1,158 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "BoundingIntervalHierarchy.h"
+#include "TriangleIntersection.h"
+#include "WorldModel.h"
+#include <random>
+#include <vector>
+
+using G3D::Vector3;
+
+namespace
+{
+// Small triangles packed into a few dense clusters (building details) spread over a large mostly empty area
+struct TriangleSoup
+{
+    TriangleSoup(uint32 count, uint32 seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> area(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> cluster(-5.0f, 5.0f);
+        std::uniform_real_distribution<float> size(-0.5f, 0.5f);
+
+        std::vector<Vector3> clusterCenters;
+        for (uint32 i = 0; i < 8; ++i)
+            clusterCenters.emplace_back(area(generator), area(generator), area(generator) * 0.1f);
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            Vector3 center = i % 10 ? clusterCenters[i % clusterCenters.size()] + Vector3(cluster(generator), cluster(generator), cluster(generator))
+                : Vector3(area(generator), area(generator), area(generator) * 0.1f);
+            uint32 first = uint32(Points.size());
+            for (uint32 j = 0; j < 3; ++j)
+                Points.push_back(center + Vector3(size(generator), size(generator), size(generator)));
+            Triangles.push_back({ first, first + 1, first + 2 });
+        }
+
+        for (uint32 i = 0; i < 1000; ++i)
+        {
+            // rays aimed at random triangles, most of them hit
+            Vector3 origin(area(generator), area(generator), 100.0f);
+            VMAP::MeshTriangle const& target = Triangles[generator() % Triangles.size()];
+            Vector3 center = (Points[target.idx0] + Points[target.idx1] + Points[target.idx2]) / 3.0f;
+            Rays.push_back(G3D::Ray::fromOriginAndDirection(origin, (center - origin).directionOrZero()));
+        }
+    }
+
+    BIH Build(BIH::SplitMethod splitMethod) const
+    {
+        BIH tree;
+        tree.build(Triangles, [&](VMAP::MeshTriangle const& triangle, G3D::AABox& bounds)
+        {
+            bounds = G3D::AABox(Points[triangle.idx0].min(Points[triangle.idx1].min(Points[triangle.idx2])),
+                Points[triangle.idx0].max(Points[triangle.idx1].max(Points[triangle.idx2])));
+        }, 3, false, splitMethod);
+        return tree;
+    }
+
+    float Intersect(BIH const& tree, G3D::Ray const& ray) const
+    {
+        auto callback = [&](G3D::Ray const& r, uint32 index, float& distance, bool /*stopAtFirst*/)
+        {
+            return VMAP::IntersectTriangle(Triangles[index], Points.data(), r, distance);
+        };
+
+        float distance = G3D::finf();
+        tree.intersectRay(ray, callback, distance);
+        return distance;
+    }
+
+    std::vector<Vector3> Points;
+    std::vector<VMAP::MeshTriangle> Triangles;
+    std::vector<G3D::Ray> Rays;
+};
+}
+
+TEST_CASE("BIH split methods find the closest hit", "[BIH]")
+{
+    TriangleSoup soup(2000, 4321);
+    BIH midpoint = soup.Build(BIH::SplitMethod::Midpoint);
+    BIH sah = soup.Build(BIH::SplitMethod::BinnedSAH);
+    REQUIRE(sah.primCount() == soup.Triangles.size());
+
+    uint32 hits = 0;
+    for (G3D::Ray const& ray : soup.Rays)
+    {
+        float expected = G3D::finf();
+        for (VMAP::MeshTriangle const& triangle : soup.Triangles)
+            VMAP::IntersectTriangle(triangle, soup.Points.data(), ray, expected);
+
+        REQUIRE(soup.Intersect(midpoint, ray) == expected);
+        REQUIRE(soup.Intersect(sah, ray) == expected);
+        hits += expected < G3D::finf();
+    }
+
+    REQUIRE(hits > 900);
+}
+
+TEST_CASE("BIH split methods agree on large inputs", "[BIH]")
+{
+    // large enough for the halves near the root to be built concurrently
+    TriangleSoup soup(60000, 1234);
+    BIH midpoint = soup.Build(BIH::SplitMethod::Midpoint);
+    BIH sah = soup.Build(BIH::SplitMethod::BinnedSAH);
+    REQUIRE(sah.primCount() == soup.Triangles.size());
+
+    for (G3D::Ray const& ray : soup.Rays)
+        REQUIRE(soup.Intersect(sah, ray) == soup.Intersect(midpoint, ray));
+}
+
+TEST_CASE("BIH build and query cost of the split methods", "[.][benchmark][BIH]")
+{
+    TriangleSoup soup(60000, 1234);
+    BIH midpoint = soup.Build(BIH::SplitMethod::Midpoint);
+    BIH sah = soup.Build(BIH::SplitMethod::BinnedSAH);
+
+    BENCHMARK("build midpoint")
+    {
+        return soup.Build(BIH::SplitMethod::Midpoint);
+    };
+
+    BENCHMARK("build binned SAH")
+    {
+        return soup.Build(BIH::SplitMethod::BinnedSAH);
+    };
+
+    BENCHMARK("query midpoint")
+    {
+        float sum = 0.0f;
+        for (G3D::Ray const& ray : soup.Rays)
+            sum += std::min(soup.Intersect(midpoint, ray), 1000.0f);
+        return sum;
+    };
+
+    BENCHMARK("query binned SAH")
+    {
+        float sum = 0.0f;
+        for (G3D::Ray const& ray : soup.Rays)
+            sum += std::min(soup.Intersect(sah, ray), 1000.0f);
+        return sum;
+    };
+}
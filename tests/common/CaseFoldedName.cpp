@@ -0,0 +1,57 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CaseFoldedName.h"
+
+TEST_CASE("Names are compared ignoring case", "[CaseFoldedName]")
+{
+    Trinity::CaseFoldedNameEqual equal;
+    Trinity::CaseFoldedNameHash hash;
+
+    REQUIRE(equal("Arthas", "arTHAS"));
+    REQUIRE(hash("Arthas") == hash("ARTHAS"));
+    REQUIRE(!equal("Arthas", "Artha"));
+    REQUIRE(!equal("Arthas", "Arthass"));
+    REQUIRE(!equal("", "A"));
+
+    // latin-1 and cyrillic letters fold like normalizePlayerName folds them
+    REQUIRE(equal("\xC3\x89lise", "\xC3\xA9LISE"));                 // Élise, éLISE
+    REQUIRE(hash("\xC3\x89lise") == hash("\xC3\xA9LISE"));
+    REQUIRE(equal("\xD0\x90\xD0\xBD\xD0\xBD\xD0\xB0", "\xD0\xB0\xD0\x9D\xD0\x9D\xD0\x90")); // Анна, аННА
+
+    // invalid UTF-8 equals nothing, not even itself
+    REQUIRE(!equal("Ab\xFF", "Ab\xFF"));
+    REQUIRE(!equal("Ab\xFF", "Ab"));
+}
+
+TEST_CASE("Maps keyed by names are searched with any spelling", "[CaseFoldedName]")
+{
+    Trinity::CaseFoldedNameMap<int> names;
+    names["Jaina"] = 1;
+    names["Thrall"] = 2;
+
+    std::string_view query = "THRALL";
+    REQUIRE(names.find(query) != names.end());
+    REQUIRE(names.find(query)->second == 2);
+    REQUIRE(names.find(std::string_view("jaina"))->second == 1);
+    REQUIRE(names.find(std::string_view("Sylvanas")) == names.end());
+
+    names.erase(std::string("JAINA"));
+    REQUIRE(names.size() == 1);
+}
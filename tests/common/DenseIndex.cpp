@@ -0,0 +1,68 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "DenseIndex.h"
+#include <memory>
+#include <unordered_map>
+
+TEST_CASE("Lookup", "[DenseIndex]")
+{
+    std::unordered_map<uint32, int> map = { { 100, 1 }, { 101, 2 }, { 103, 3 } };
+    Trinity::Containers::DenseIndex<int const> index;
+    index.Build(map);
+
+    REQUIRE(!index.IsEmpty());
+    REQUIRE(index.Find(100) == &map[100]);
+    REQUIRE(index.Find(101) == &map[101]);
+    REQUIRE(index.Find(102) == nullptr);
+    REQUIRE(index.Find(103) == &map[103]);
+    REQUIRE(index.Find(99) == nullptr);
+    REQUIRE(index.Find(104) == nullptr);
+    REQUIRE(index.Find(0) == nullptr);
+
+    REQUIRE(index.Covers(map.size()));
+    map[102] = 4;
+    REQUIRE(!index.Covers(map.size()));
+}
+
+TEST_CASE("Sparse ids", "[DenseIndex]")
+{
+    std::unordered_map<uint32, int> map = { { 1, 1 }, { 1000, 2 } };
+    Trinity::Containers::DenseIndex<int const> index;
+    index.Build(map);
+
+    REQUIRE(index.IsEmpty());
+    REQUIRE(!index.Covers(map.size()));
+    REQUIRE(index.Find(1) == nullptr);
+}
+
+TEST_CASE("Projection", "[DenseIndex]")
+{
+    std::unordered_map<uint32, std::unique_ptr<int>> map;
+    map[5] = std::make_unique<int>(5);
+    map[6] = std::make_unique<int>(6);
+    Trinity::Containers::DenseIndex<int const> index;
+    index.Build(map, [](std::unique_ptr<int> const& value) -> int const& { return *value; });
+
+    REQUIRE(index.Find(5) == map[5].get());
+    REQUIRE(index.Find(6) == map[6].get());
+
+    index.Clear();
+    REQUIRE(index.Find(5) == nullptr);
+}
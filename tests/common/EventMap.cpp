@@ -384,3 +384,100 @@ TEST_CASE("Reset map", "[EventMap]")
 
     REQUIRE(eventMap.Empty());
 }
+
+TEST_CASE("Events of the same time execute in scheduling order", "[EventMap]")
+{
+    EventMap eventMap;
+    eventMap.ScheduleEvent(EVENT_2, 1s);
+    eventMap.ScheduleEvent(EVENT_1, 1s, GROUP_1);
+    eventMap.ScheduleEvent(EVENT_3, 500ms);
+
+    eventMap.Update(1000);
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+    REQUIRE(eventMap.Empty());
+
+    SECTION("Delayed groups go after events already scheduled for that time")
+    {
+        eventMap.ScheduleEvent(EVENT_1, 1s, GROUP_1);
+        eventMap.ScheduleEvent(EVENT_3, 1s, GROUP_1);
+        eventMap.ScheduleEvent(EVENT_2, 2s, GROUP_2);
+        eventMap.DelayEvents(1s, GROUP_1);
+
+        eventMap.Update(2000);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+    }
+}
+
+TEST_CASE("Phase and group masks", "[EventMap]")
+{
+    EventMap eventMap;
+    eventMap.ScheduleEvent(EVENT_1, 1s, GROUP_1, PHASE_1);
+    eventMap.ScheduleEvent(EVENT_2, 1s, GROUP_2, PHASE_2);
+    eventMap.ScheduleEvent(EVENT_3, 1s, GROUP_1, PHASE_2);
+
+    SECTION("Events of inactive phases are dropped")
+    {
+        eventMap.SetPhase(PHASE_2);
+        eventMap.Update(1000);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+        REQUIRE(eventMap.ExecuteEvent() == 0);
+        REQUIRE(eventMap.Empty());
+    }
+
+    SECTION("Groups are cancelled regardless of phase")
+    {
+        eventMap.CancelEventGroup(GROUP_1);
+        eventMap.SetPhase(PHASE_2);
+        eventMap.Update(1000);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+        REQUIRE(eventMap.Empty());
+    }
+
+    SECTION("Repeated events keep group and phase")
+    {
+        eventMap.SetPhase(PHASE_1);
+        eventMap.Update(1000);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+        eventMap.Repeat(1s);
+        eventMap.CancelEventGroup(GROUP_2);
+
+        eventMap.SetPhase(PHASE_2);
+        eventMap.Update(1000);
+        REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+        REQUIRE(eventMap.ExecuteEvent() == 0);
+
+        eventMap.Repeat(1s);
+        eventMap.CancelEventGroup(GROUP_1);
+        REQUIRE(eventMap.Empty());
+    }
+}
+
+TEST_CASE("Many scheduled events", "[EventMap]")
+{
+    EventMap eventMap;
+    for (uint32 i = 1; i <= 40; ++i)
+        eventMap.ScheduleEvent(i, Milliseconds((i * 37) % 41), i % 2 ? GROUP_1 : GROUP_2);
+
+    eventMap.CancelEventGroup(GROUP_2);
+
+    eventMap.Update(100);
+    Milliseconds previous = 0ms;
+    uint32 count = 0;
+    EventMap copy = eventMap;
+    while (uint32 eventId = copy.ExecuteEvent())
+    {
+        Milliseconds time = Milliseconds((eventId * 37) % 41);
+        REQUIRE(eventId % 2 == 1);
+        REQUIRE(time >= previous);
+        previous = time;
+        ++count;
+    }
+
+    REQUIRE(count == 20);
+    REQUIRE(eventMap.GetTimeUntilEvent(2) == Milliseconds::max());
+}
@@ -0,0 +1,232 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "EventProcessor.h"
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct RecordingEvent : BasicEvent
+{
+    RecordingEvent(std::vector<int>& executed, int id, bool deletable = true) : Executed(executed), Id(id), Deletable(deletable) { }
+
+    bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
+    {
+        Executed.push_back(Id);
+        return true;
+    }
+
+    bool IsDeletable() const override { return Deletable; }
+
+    void Abort(uint64 /*e_time*/) override { Executed.push_back(-Id); }
+
+    std::vector<int>& Executed;
+    int Id;
+    bool Deletable;
+};
+
+struct RepeatingEvent : BasicEvent
+{
+    RepeatingEvent(EventProcessor& events, uint32& count) : Events(events), Count(count) { }
+
+    bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
+    {
+        if (++Count == 3)
+            return true;
+
+        Events.AddEventAtOffset(this, 100ms);
+        return false;
+    }
+
+    EventProcessor& Events;
+    uint32& Count;
+};
+
+struct CountingEvent : BasicEvent
+{
+    explicit CountingEvent(uint64& executed) : Executed(executed) { }
+
+    bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
+    {
+        ++Executed;
+        return true;
+    }
+
+    uint64& Executed;
+};
+
+// previous implementation, kept as baseline for the benchmark
+class MultimapEventProcessor
+{
+public:
+    ~MultimapEventProcessor()
+    {
+        for (auto const& [_, event] : _events)
+            delete event;
+    }
+
+    void AddEventAtOffset(BasicEvent* event, Milliseconds offset) { _events.emplace(_time + offset.count(), event); }
+
+    void Update(uint32 diff)
+    {
+        _time += diff;
+        for (auto itr = _events.begin(); itr != _events.end() && itr->first <= _time; itr = _events.begin())
+        {
+            BasicEvent* event = itr->second;
+            _events.erase(itr);
+            if (event->Execute(_time, diff))
+                delete event;
+        }
+    }
+
+private:
+    uint64 _time = 0;
+    std::multimap<uint64, BasicEvent*> _events;
+};
+
+template<typename Processor>
+std::chrono::duration<double, std::milli> RunEventMix(uint64& executed)
+{
+    // most units are idle, the others keep spell delays, aura ticks and a few long timers going
+    constexpr uint32 UnitCount = 5000;
+    constexpr uint32 TickCount = 2000;
+    std::vector<std::unique_ptr<Processor>> units(UnitCount);
+    for (std::unique_ptr<Processor>& unit : units)
+        unit = std::make_unique<Processor>();
+
+    std::mt19937 random(12345);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 tick = 0; tick < TickCount; ++tick)
+    {
+        for (uint32 i = 0; i < UnitCount; ++i)
+        {
+            if (i % 5 < 2)
+            {
+                uint32 roll = random() % 100;
+                if (roll < 30)
+                    units[i]->AddEventAtOffset(new CountingEvent(executed), Milliseconds(random() % 500));
+                else if (roll < 60)
+                    units[i]->AddEventAtOffset(new CountingEvent(executed), Milliseconds(1000 + random() % 2000));
+                else if (roll < 65)
+                    units[i]->AddEventAtOffset(new CountingEvent(executed), Milliseconds(30000 + random() % 60000));
+            }
+
+            units[i]->Update(50);
+        }
+    }
+
+    return std::chrono::steady_clock::now() - start;
+}
+}
+
+TEST_CASE("EventProcessor executes events in time order", "[EventProcessor]")
+{
+    std::vector<int> executed;
+    EventProcessor events;
+
+    events.AddEventAtOffset(new RecordingEvent(executed, 3), 300ms);
+    events.AddEventAtOffset(new RecordingEvent(executed, 1), 100ms);
+    events.AddEventAtOffset(new RecordingEvent(executed, 2), 100ms);
+    events.AddEventAtOffset(new RecordingEvent(executed, 4), 10s);
+    REQUIRE(events.GetEventCount() == 4);
+
+    events.Update(50);
+    REQUIRE(executed.empty());
+
+    events.Update(300);
+    REQUIRE(executed == std::vector<int>{ 1, 2, 3 });
+    REQUIRE(events.GetEventCount() == 1);
+
+    SECTION("Events can be moved")
+    {
+        std::vector<BasicEvent*> pending;
+        events.ForEachEvent([&](BasicEvent* event) { pending.push_back(event); });
+        REQUIRE(pending.size() == 1);
+
+        events.ModifyEventTime(pending.front(), events.CalculateTime(100ms));
+        events.Update(100);
+        REQUIRE(executed == std::vector<int>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Events added while updating execute in the same update when due")
+    {
+        events.AddEventAtOffset([&] { events.AddEventAtOffset(new RecordingEvent(executed, 5), 0ms); }, 10ms);
+        events.Update(100);
+        REQUIRE(executed == std::vector<int>{ 1, 2, 3, 5 });
+    }
+}
+
+TEST_CASE("EventProcessor reschedules events that are not done", "[EventProcessor]")
+{
+    EventProcessor events;
+    uint32 count = 0;
+    events.AddEventAtOffset(new RepeatingEvent(events, count), 100ms);
+
+    for (uint32 i = 0; i < 10; ++i)
+        events.Update(100);
+
+    REQUIRE(count == 3);
+    REQUIRE(events.GetEventCount() == 0);
+}
+
+TEST_CASE("EventProcessor aborts events", "[EventProcessor]")
+{
+    std::vector<int> executed;
+    EventProcessor events;
+
+    SECTION("Scheduled aborts happen at the event time")
+    {
+        RecordingEvent* event = new RecordingEvent(executed, 1);
+        events.AddEventAtOffset(event, 100ms);
+        event->ScheduleAbort();
+        events.Update(100);
+        REQUIRE(executed == std::vector<int>{ -1 });
+        REQUIRE(events.GetEventCount() == 0);
+    }
+
+    SECTION("Non deletable events survive KillAllEvents unless forced")
+    {
+        events.AddEventAtOffset(new RecordingEvent(executed, 2, false), 200ms);
+        events.AddEventAtOffset(new RecordingEvent(executed, 1), 100ms);
+
+        events.KillAllEvents(false);
+        REQUIRE(executed == std::vector<int>{ -1, -2 });
+        REQUIRE(events.GetEventCount() == 1);
+
+        events.KillAllEvents(true);
+        REQUIRE(events.GetEventCount() == 0);
+    }
+}
+
+// Run explicitly with "[!benchmark]" to compare against the multimap based processor
+TEST_CASE("EventProcessor benchmark", "[.][!benchmark][EventProcessor]")
+{
+    uint64 wheelExecuted = 0, multimapExecuted = 0;
+    std::chrono::duration<double, std::milli> wheel = RunEventMix<EventProcessor>(wheelExecuted);
+    std::chrono::duration<double, std::milli> multimap = RunEventMix<MultimapEventProcessor>(multimapExecuted);
+
+    REQUIRE(wheelExecuted == multimapExecuted);
+    std::cout << "timer wheel: " << wheel.count() << " ms, multimap: " << multimap.count() << " ms, "
+        << wheelExecuted << " events executed" << std::endl;
+}
@@ -18,6 +18,7 @@
 #include "tc_catch2.h"
 
 #include "FlatSet.h"
+#include <unordered_set>
 
 TEST_CASE("Insertion", "[FlatSet]")
 {
@@ -58,3 +59,132 @@ TEST_CASE("Erase", "[FlatSet]")
     REQUIRE(flat.erase(7) == 1);
     REQUIRE(flat.size() == 3);
 }
+
+namespace
+{
+// every key lands in the same home slot, exercises probing and the backward shift of erase
+struct CollidingHash
+{
+    std::size_t operator()(uint64 /*key*/) const { return 0; }
+};
+}
+
+TEST_CASE("Hash set insertion", "[FlatHashSet]")
+{
+    Trinity::Containers::FlatHashSet<uint64> set;
+    REQUIRE(set.empty());
+    REQUIRE(set.begin() == set.end());
+    REQUIRE(!set.contains(0));
+
+    for (uint64 key = 0; key < 1000; ++key)
+        REQUIRE(set.insert(key * 7).second);
+
+    REQUIRE(!set.insert(0).second);
+    REQUIRE(*set.insert(14).first == 14);
+    REQUIRE(set.size() == 1000);
+    REQUIRE(set.capacity() * 3 >= set.size() * 4);
+
+    std::vector<uint64> keys(set.begin(), set.end());
+    std::ranges::sort(keys);
+    for (uint64 key = 0; key < 1000; ++key)
+    {
+        REQUIRE(keys[key] == key * 7);
+        REQUIRE(set.contains(key * 7));
+        REQUIRE(!set.contains(key * 7 + 1));
+    }
+
+    SECTION("copies are independent")
+    {
+        Trinity::Containers::FlatHashSet<uint64> copy = set;
+        copy.erase(7);
+        REQUIRE(set.contains(7));
+        REQUIRE(copy.size() == 999);
+    }
+
+    SECTION("moved from sets are empty")
+    {
+        Trinity::Containers::FlatHashSet<uint64> moved = std::move(set);
+        REQUIRE(moved.size() == 1000);
+        REQUIRE(set.empty());
+        REQUIRE(!set.contains(7));
+        REQUIRE(set.insert(7).second);
+    }
+
+    SECTION("clearing keeps the capacity")
+    {
+        std::size_t capacity = set.capacity();
+        set.clear();
+        REQUIRE(set.empty());
+        REQUIRE(set.begin() == set.end());
+        REQUIRE(!set.contains(7));
+        REQUIRE(set.capacity() == capacity);
+    }
+}
+
+TEST_CASE("Hash set erase", "[FlatHashSet]")
+{
+    Trinity::Containers::FlatHashSet<uint64, CollidingHash> set;
+    for (uint64 key = 0; key < 12; ++key)
+        set.insert(key);
+
+    REQUIRE(set.erase(0) == 1);
+    REQUIRE(set.erase(5) == 1);
+    REQUIRE(set.erase(11) == 1);
+    REQUIRE(set.erase(5) == 0);
+    REQUIRE(set.size() == 9);
+    for (uint64 key = 0; key < 12; ++key)
+        REQUIRE(set.contains(key) == (key != 0 && key != 5 && key != 11));
+
+    REQUIRE(set.insert(5).second);
+    REQUIRE(set.find(5) != set.end());
+    REQUIRE(*set.find(5) == 5);
+    REQUIRE(set.find(0) == set.end());
+}
+
+TEST_CASE("Hash set against std::unordered_set", "[FlatHashSet]")
+{
+    Trinity::Containers::FlatHashSet<uint64> set;
+    std::unordered_set<uint64> reference;
+    uint64 state = 12345;
+    for (uint32 i = 0; i < 20000; ++i)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64 key = (state >> 33) % 512;
+        if (state & 1)
+            REQUIRE(set.insert(key).second == reference.insert(key).second);
+        else
+            REQUIRE(set.erase(key) == reference.erase(key));
+    }
+
+    REQUIRE(set.size() == reference.size());
+    for (uint64 key : set)
+        REQUIRE(reference.contains(key));
+}
+
+TEST_CASE("Visible object set copies", "[.][benchmark][FlatHashSet]")
+{
+    // a player in a crowded zone, VisibleNotifier copies the set for every visibility update
+    std::vector<uint64> keys(800);
+    for (uint64 i = 0; i < keys.size(); ++i)
+        keys[i] = (UI64LIT(0x2C) << 58) | (i * 31337);
+
+    Trinity::Containers::FlatHashSet<uint64> flat;
+    flat.insert(keys.begin(), keys.end());
+    std::unordered_set<uint64> node(keys.begin(), keys.end());
+
+    BENCHMARK("FlatHashSet copy and erase")
+    {
+        Trinity::Containers::FlatHashSet<uint64> copy = flat;
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+            copy.erase(keys[i]);
+        return copy.size();
+    };
+
+    BENCHMARK("std::unordered_set copy and erase")
+    {
+        std::unordered_set<uint64> copy = node;
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+            copy.erase(keys[i]);
+        return copy.size();
+    };
+}
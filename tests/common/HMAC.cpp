@@ -0,0 +1,79 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CryptoHash.h"
+#include "CryptoRandom.h"
+#include "HMAC.h"
+#include "Util.h"
+#include <array>
+#include <string_view>
+
+using namespace std::string_view_literals;
+
+namespace
+{
+// test case 2 of RFC 4231
+std::array<uint8, 4> constexpr Key = { 'J', 'e', 'f', 'e' };
+}
+
+TEST_CASE("HMAC digests match the RFC 4231 vectors", "[HMAC]")
+{
+    std::string_view data = "what do ya want for nothing?"sv;
+
+    REQUIRE(ByteArrayToHexStr(Trinity::Crypto::HMAC_SHA256::GetDigestOf(Key, data))
+        == "5BDCC146BF60754E6A042426089575C75A003F089D2739839DEC58B964EC3843");
+    REQUIRE(ByteArrayToHexStr(Trinity::Crypto::HMAC_SHA512::GetDigestOf(Key, data))
+        == "164B7A7BFCF819E2E395FBE73B56E0A387BD64222E831FD610270CD7EA2505549758BF75C05A994A6D034F65F8F0E6FDCAEAB1A34D4A6B4B636E070A38BCE737");
+    REQUIRE(ByteArrayToHexStr(Trinity::Crypto::HMAC_SHA1::GetDigestOf(Key, data))
+        == "EFFCDF6AE5EB2FA2D27416D5F184DF9C259A7C79");
+}
+
+TEST_CASE("HMAC copies continue independently", "[HMAC]")
+{
+    Trinity::Crypto::HMAC_SHA256 hmac(Key);
+    hmac.UpdateData("what do ya want "sv);
+
+    Trinity::Crypto::HMAC_SHA256 copy(hmac);
+    Trinity::Crypto::HMAC_SHA256 moved(std::move(hmac));
+
+    copy.UpdateData("for nothing?"sv);
+    copy.Finalize();
+    moved.UpdateData("for something?"sv);
+    moved.Finalize();
+
+    REQUIRE(copy.GetDigest() == Trinity::Crypto::HMAC_SHA256::GetDigestOf(Key, "what do ya want for nothing?"sv));
+    REQUIRE(moved.GetDigest() == Trinity::Crypto::HMAC_SHA256::GetDigestOf(Key, "what do ya want for something?"sv));
+}
+
+TEST_CASE("Handshake digest cost", "[.][benchmark][HMAC]")
+{
+    std::array<uint8, 32> key = Trinity::Crypto::GetRandomBytes<32>();
+    std::array<uint8, 64> data = Trinity::Crypto::GetRandomBytes<64>();
+
+    // the world server handshake does five of these per connection
+    BENCHMARK("HMAC SHA256")
+    {
+        return Trinity::Crypto::HMAC_SHA256::GetDigestOf(key, data);
+    };
+
+    BENCHMARK("SHA512")
+    {
+        return Trinity::Crypto::SHA512::GetDigestOf(data);
+    };
+}
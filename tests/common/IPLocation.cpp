@@ -0,0 +1,174 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "IPLocation.h"
+#include "IpAddress.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace
+{
+// IP2Location DB1 lines, ipv4 ranges as plain numbers and ipv6 ranges as 128 bit numbers
+constexpr char const* DatabaseLines =
+    "\"0\",\"16777215\",\"-\",\"-\"\n"
+    "\"16777216\",\"16777471\",\"US\",\"United States of America\"\n"
+    "\"16777472\",\"16778239\",\"CN\",\"China\"\r\n"
+    "\"16778240\",\"16779263\",\"AU\",\"Australia\"\n"
+    "\"3232235520\",\"3232301055\",\"US\",\"United States of America\"\n"
+    "\"281470681743360\",\"281470698520575\",\"DE\",\"Germany\"\n"
+    "\"42540766411282592856903984951653826560\",\"42540766490510755371168322545197776895\",\"DE\",\"Germany\"\n";
+
+struct DatabaseFiles
+{
+    explicit DatabaseFiles(std::string const& name)
+    {
+        std::filesystem::path directory = std::filesystem::temp_directory_path();
+        Csv = (directory / (name + ".csv")).string();
+        Cache = (directory / (name + ".bin")).string();
+        std::filesystem::remove(Cache);
+
+        std::ofstream(Csv, std::ios::binary) << DatabaseLines;
+    }
+
+    ~DatabaseFiles()
+    {
+        std::filesystem::remove(Csv);
+        std::filesystem::remove(Cache);
+    }
+
+    std::string Csv;
+    std::string Cache;
+};
+
+std::string GetCountryCode(IpLocationStore const& store, std::string const& address)
+{
+    IpLocationRecord const* record = store.GetLocationRecord(address);
+    return record ? record->CountryCode : "";
+}
+
+void CheckLookups(IpLocationStore const& store)
+{
+    REQUIRE(GetCountryCode(store, "1.0.0.0") == "us");
+    REQUIRE(GetCountryCode(store, "1.0.0.255") == "us");
+    REQUIRE(GetCountryCode(store, "1.0.1.0") == "cn");
+    REQUIRE(GetCountryCode(store, "1.0.7.255") == "au");
+    REQUIRE(GetCountryCode(store, "1.0.8.0").empty());
+    REQUIRE(GetCountryCode(store, "192.168.12.34") == "us");
+    REQUIRE(GetCountryCode(store, "::ffff:192.168.12.34") == "us");
+    REQUIRE(GetCountryCode(store, "2001:db8::1") == "de");
+    REQUIRE(GetCountryCode(store, "2001:db9::1").empty());
+    REQUIRE(GetCountryCode(store, "not an address").empty());
+
+    // ranges given in the ipv4 mapped space of the ipv6 database end up in the ipv4 table
+    REQUIRE(GetCountryCode(store, "0.0.0.1") == "de");
+    REQUIRE(GetCountryCode(store, "0.255.255.255") == "de");
+
+    // countries are stored once
+    REQUIRE(store.GetLocationRecord("1.0.0.1") == store.GetLocationRecord("192.168.0.1"));
+    REQUIRE(store.GetLocationRecord("1.0.0.1")->CountryName == "United States of America");
+    REQUIRE(store.GetLocationRecord("1.0.1.1")->CountryName == "China");
+}
+}
+
+TEST_CASE("IP location lookups", "[IPLocation]")
+{
+    DatabaseFiles files("tc_iplocation_test");
+    IpLocationStore store;
+
+    SECTION("without cache file")
+    {
+        REQUIRE(store.LoadFromFile(files.Csv, ""));
+        REQUIRE(store.GetRangeCount() == 6);
+        CheckLookups(store);
+    }
+
+    SECTION("with cache file")
+    {
+        REQUIRE(store.LoadFromFile(files.Csv, files.Cache));
+        REQUIRE(std::filesystem::exists(files.Cache));
+        CheckLookups(store);
+
+        IpLocationStore mapped;
+        REQUIRE(mapped.LoadFromFile(files.Csv, files.Cache));
+        REQUIRE(mapped.GetRangeCount() == 6);
+        CheckLookups(mapped);
+    }
+
+    SECTION("broken cache files are rebuilt")
+    {
+        std::ofstream(files.Cache, std::ios::binary) << "IPLC garbage";
+        REQUIRE(store.LoadFromFile(files.Csv, files.Cache));
+        CheckLookups(store);
+        REQUIRE(std::filesystem::file_size(files.Cache) > 16);
+    }
+
+    SECTION("a missing database file clears the store")
+    {
+        REQUIRE(store.LoadFromFile(files.Csv, ""));
+        REQUIRE(!store.LoadFromFile(files.Csv + ".missing", ""));
+        REQUIRE(store.GetRangeCount() == 0);
+        REQUIRE(!store.GetLocationRecord("1.0.0.1"));
+    }
+}
+
+TEST_CASE("IP location lookup cost", "[.][benchmark][IPLocation]")
+{
+    DatabaseFiles files("tc_iplocation_benchmark");
+    {
+        // ranges of a few hundred addresses over the whole ipv4 space, like the real database
+        std::ofstream csv(files.Csv, std::ios::binary | std::ios::app);
+        for (uint64 from = 0xC0A90000; from < 0xFFFFFFFF - 512; from += 300)
+            csv << '"' << from << "\",\"" << from + 255 << "\",\"FR\",\"France\"\n";
+    }
+
+    IpLocationStore store;
+    REQUIRE(store.LoadFromFile(files.Csv, files.Cache));
+
+    std::mt19937 generator(1234);
+    std::vector<boost::asio::ip::address> addresses;
+    std::vector<std::string> addressStrings;
+    for (uint32 i = 0; i < 1000; ++i)
+    {
+        addresses.push_back(boost::asio::ip::address_v4(0xC0A90000 + generator() % 0x3F000000));
+        addressStrings.push_back(addresses.back().to_string());
+    }
+
+    BENCHMARK("lookup address")
+    {
+        std::size_t found = 0;
+        for (boost::asio::ip::address const& address : addresses)
+            found += store.GetLocationRecord(address) != nullptr;
+        return found;
+    };
+
+    BENCHMARK("lookup address string")
+    {
+        std::size_t found = 0;
+        for (std::string const& address : addressStrings)
+            found += store.GetLocationRecord(address) != nullptr;
+        return found;
+    };
+
+    BENCHMARK("load mapped cache")
+    {
+        IpLocationStore mapped;
+        return mapped.LoadFromFile(files.Csv, files.Cache);
+    };
+}
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "JobSystem.h"
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+using Trinity::Job;
+using Trinity::JobSystem;
+
+namespace
+{
+template<typename T>
+T RunAndWait(JobSystem& jobs, Job<T> job)
+{
+    std::promise<T> promise;
+    std::future<T> future = promise.get_future();
+    jobs.Spawn([](Job<T> job, std::promise<T>& promise) -> Job<>
+    {
+        try
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                co_await std::move(job);
+                promise.set_value();
+            }
+            else
+                promise.set_value(co_await std::move(job));
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+    }(std::move(job), promise));
+    return future.get();
+}
+
+Job<int> Square(JobSystem& jobs, int value)
+{
+    co_await jobs.Schedule();
+    co_return value * value;
+}
+
+Job<std::thread::id> GetWorkerThread(JobSystem& jobs)
+{
+    co_await jobs.Schedule();
+    co_return std::this_thread::get_id();
+}
+
+Job<int> Fail(JobSystem& jobs)
+{
+    co_await jobs.Schedule();
+    throw std::runtime_error("job failed");
+}
+}
+
+TEST_CASE("JobSystem runs jobs on its workers", "[JobSystem]")
+{
+    JobSystem jobs(2);
+    REQUIRE(RunAndWait(jobs, GetWorkerThread(jobs)) != std::this_thread::get_id());
+}
+
+TEST_CASE("JobSystem awaits nested jobs", "[JobSystem]")
+{
+    JobSystem jobs(2);
+    REQUIRE(RunAndWait(jobs, [](JobSystem& jobs) -> Job<int>
+    {
+        int first = co_await Square(jobs, 3);
+        int second = co_await Square(jobs, 4);
+        co_return first + second;
+    }(jobs)) == 25);
+
+    SECTION("Exceptions are rethrown to the awaiting job")
+    {
+        REQUIRE_THROWS_AS(RunAndWait(jobs, Fail(jobs)), std::runtime_error);
+    }
+}
+
+TEST_CASE("JobSystem forks and joins jobs", "[JobSystem]")
+{
+    JobSystem jobs(4);
+
+    SECTION("Results keep the order of the jobs")
+    {
+        std::vector<int> results = RunAndWait(jobs, [](JobSystem& jobs) -> Job<std::vector<int>>
+        {
+            std::vector<Job<int>> squares;
+            for (int i = 0; i < 100; ++i)
+                squares.push_back(Square(jobs, i));
+
+            co_return co_await jobs.WhenAll(std::move(squares));
+        }(jobs));
+
+        REQUIRE(results.size() == 100);
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(results[i] == i * i);
+    }
+
+    SECTION("Nothing to join")
+    {
+        REQUIRE(RunAndWait(jobs, [](JobSystem& jobs) -> Job<std::vector<int>>
+        {
+            co_return co_await jobs.WhenAll(std::vector<Job<int>>());
+        }(jobs)).empty());
+    }
+
+    SECTION("Failed jobs fail the join")
+    {
+        REQUIRE_THROWS_AS(RunAndWait(jobs, [](JobSystem& jobs) -> Job<std::vector<int>>
+        {
+            std::vector<Job<int>> results;
+            results.push_back(Square(jobs, 2));
+            results.push_back(Fail(jobs));
+            co_return co_await jobs.WhenAll(std::move(results));
+        }(jobs)), std::runtime_error);
+    }
+}
+
+TEST_CASE("JobResumeQueue resumes jobs on the processing thread", "[JobSystem]")
+{
+    JobSystem jobs(2);
+    Trinity::JobResumeQueue queue;
+    std::atomic<bool> waiting = false;
+    std::thread::id resumedOn;
+
+    jobs.Spawn([](JobSystem& jobs, Trinity::JobResumeQueue& queue, std::atomic<bool>& waiting, std::thread::id& resumedOn) -> Job<>
+    {
+        co_await jobs.Schedule();
+        waiting = true;
+        co_await queue.Resume();
+        resumedOn = std::this_thread::get_id();
+    }(jobs, queue, waiting, resumedOn));
+
+    while (!waiting)
+        std::this_thread::yield();
+
+    // waiting is set before the job suspends, it may not be queued yet
+    while (!queue.Process())
+        std::this_thread::yield();
+
+    REQUIRE(resumedOn == std::this_thread::get_id());
+}
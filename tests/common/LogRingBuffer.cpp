@@ -0,0 +1,149 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "DeferredLogRecord.h"
+#include "LogRingBuffer.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+enum class TestEnum : uint8 { Value = 7 };
+
+template<typename... Args>
+std::string RoundTrip(Trinity::FormatStringView fmt, Args const&... args)
+{
+    using namespace Trinity::Impl::DeferredLog;
+    std::vector<uint8> data((std::size_t(0) + ... + GetStoredSize(args)));
+    uint8* position = data.data();
+    (Store(position, args), ...);
+    return Format<StoredTypeT<Args>...>(fmt, data.data());
+}
+}
+
+TEST_CASE("LogRingBuffer delivers records in order", "[LogRingBuffer]")
+{
+    Trinity::LogRingBuffer buffer(256);
+    std::vector<uint32> read;
+    auto readAll = [&]
+    {
+        buffer.Release(buffer.Read([&](uint8 const* data)
+        {
+            uint32 value;
+            std::memcpy(&value, data, sizeof(value));
+            read.push_back(value);
+        }));
+    };
+
+    SECTION("records wrap around the end of the ring")
+    {
+        for (uint32 i = 0; i < 100; ++i)
+        {
+            uint8* data = buffer.Reserve(20);
+            REQUIRE(data);
+            std::memcpy(data, &i, sizeof(i));
+            buffer.Commit();
+            readAll();
+        }
+
+        REQUIRE(read.size() == 100);
+        for (uint32 i = 0; i < 100; ++i)
+            REQUIRE(read[i] == i);
+        REQUIRE(buffer.IsEmpty());
+    }
+
+    SECTION("records that don't fit are dropped and counted")
+    {
+        uint32 written = 0;
+        while (uint8* data = buffer.Reserve(20))
+        {
+            std::memcpy(data, &written, sizeof(written));
+            buffer.Commit();
+            ++written;
+        }
+
+        REQUIRE(written == 256 / 32);
+        REQUIRE(!buffer.Reserve(300));
+        REQUIRE(buffer.TakeDroppedCount() == 2);
+        REQUIRE(buffer.TakeDroppedCount() == 0);
+
+        readAll();
+        REQUIRE(read.size() == written);
+        REQUIRE(buffer.Reserve(20));
+    }
+
+    SECTION("uncommitted records are not read")
+    {
+        REQUIRE(buffer.Reserve(20));
+        readAll();
+        REQUIRE(read.empty());
+    }
+}
+
+TEST_CASE("LogRingBuffer is read while written by another thread", "[LogRingBuffer]")
+{
+    Trinity::LogRingBuffer buffer(1024);
+    constexpr uint32 Count = 100000;
+
+    std::thread producer([&]
+    {
+        for (uint32 i = 0; i < Count;)
+        {
+            if (uint8* data = buffer.Reserve(sizeof(i) + i % 40))
+            {
+                std::memcpy(data, &i, sizeof(i));
+                buffer.Commit();
+                ++i;
+            }
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    uint32 expected = 0;
+    bool ordered = true;
+    while (expected < Count)
+    {
+        buffer.Release(buffer.Read([&](uint8 const* data)
+        {
+            uint32 value;
+            std::memcpy(&value, data, sizeof(value));
+            ordered = ordered && value == expected;
+            ++expected;
+        }));
+    }
+
+    producer.join();
+    REQUIRE(ordered);
+}
+
+TEST_CASE("Deferred log arguments format like the original ones", "[LogRingBuffer]")
+{
+    using namespace Trinity::Impl::DeferredLog;
+    static_assert(CanStore<int, std::string&, char const(&)[4], double const&, TestEnum>);
+    static_assert(!CanStore<int, std::vector<int>>);
+
+    std::string text = "text";
+    char const* cstring = "cstring";
+    REQUIRE(RoundTrip("{} {} {} {:.2f} {} {}", 42, text, cstring, 1.5, std::string_view("view"), uint64(1) << 40) == "42 text cstring 1.50 view 1099511627776");
+    REQUIRE(RoundTrip("{}{}", 'a', true) == "atrue");
+    REQUIRE(RoundTrip("no arguments") == "no arguments");
+    REQUIRE(RoundTrip("{}", std::string()) == "");
+}
@@ -0,0 +1,155 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MMapTileCompression.h"
+#include <DetourAlloc.h>
+#include <DetourNavMeshBuilder.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Uneven terrain of quads as detour stores it, with the polygons, fallback detail meshes and bounding volumes of a real tile
+struct GridTile
+{
+    explicit GridTile(uint16 size)
+    {
+        std::mt19937 generator(1234);
+        std::uniform_int_distribution<uint16> height(100, 140);
+
+        std::vector<uint16> verts;
+        for (uint16 y = 0; y <= size; ++y)
+            for (uint16 x = 0; x <= size; ++x)
+                verts.insert(verts.end(), { uint16(x * 4), height(generator), uint16(y * 4) });
+
+        int constexpr nvp = 6;
+        std::vector<uint16> polys;
+        for (uint16 y = 0; y < size; ++y)
+        {
+            for (uint16 x = 0; x < size; ++x)
+            {
+                uint16 first = y * (size + 1) + x;
+                polys.insert(polys.end(), { first, uint16(first + size + 1), uint16(first + size + 2), uint16(first + 1) });
+                polys.insert(polys.end(), nvp * 2 - 4, 0xFFFF);
+            }
+        }
+
+        std::vector<uint16> polyFlags(size * size, 1);
+        std::vector<uint8> polyAreas(size * size, 11);
+
+        dtNavMeshCreateParams params = { };
+        params.verts = verts.data();
+        params.vertCount = int(verts.size() / 3);
+        params.polys = polys.data();
+        params.polyFlags = polyFlags.data();
+        params.polyAreas = polyAreas.data();
+        params.polyCount = int(polyFlags.size());
+        params.nvp = nvp;
+        params.walkableHeight = 1.5f;
+        params.walkableRadius = 0.5f;
+        params.walkableClimb = 1.0f;
+        params.bmax[0] = size * 4 * 0.25f;
+        params.bmax[1] = 200 * 0.25f;
+        params.bmax[2] = size * 4 * 0.25f;
+        params.cs = 0.25f;
+        params.ch = 0.25f;
+        params.buildBvTree = true;
+
+        unsigned char* tileData = nullptr;
+        int tileSize = 0;
+        if (dtCreateNavMeshData(&params, &tileData, &tileSize))
+        {
+            Data.assign(tileData, tileData + tileSize);
+            dtFree(tileData);
+        }
+    }
+
+    std::vector<unsigned char> Data;
+};
+}
+
+TEST_CASE("Compressed navmesh tiles inflate to the original tile", "[MMapTileCompression]")
+{
+    GridTile tile(64);
+    REQUIRE(!tile.Data.empty());
+
+    std::vector<unsigned char> compressed = MMAP::CompressTileData(tile.Data.data(), uint32(tile.Data.size()));
+    REQUIRE(!compressed.empty());
+    REQUIRE(compressed.size() < tile.Data.size());
+
+    uint32 size = MMAP::GetDecompressedTileSize(compressed.data(), uint32(compressed.size()));
+    REQUIRE(size == tile.Data.size());
+
+    std::vector<unsigned char> decompressed(size);
+    REQUIRE(MMAP::DecompressTileData(compressed.data(), uint32(compressed.size()), decompressed.data(), size));
+    REQUIRE(decompressed == tile.Data);
+
+    SECTION("truncated data is rejected")
+    {
+        REQUIRE(!MMAP::DecompressTileData(compressed.data(), uint32(compressed.size() / 2), decompressed.data(), size));
+        REQUIRE(MMAP::GetDecompressedTileSize(compressed.data(), sizeof(uint32)) == 0);
+    }
+
+    SECTION("a wrong tile size is rejected")
+    {
+        REQUIRE(!MMAP::DecompressTileData(compressed.data(), uint32(compressed.size()), decompressed.data(), size - 1));
+    }
+}
+
+TEST_CASE("Incompressible navmesh tiles are stored as they are", "[MMapTileCompression]")
+{
+    std::mt19937 generator(4321);
+    std::vector<unsigned char> data(64 * 1024);
+    for (unsigned char& byte : data)
+        byte = uint8(generator());
+
+    REQUIRE(MMAP::CompressTileData(data.data(), uint32(data.size())).empty());
+}
+
+TEST_CASE("Navmesh tile load cost with and without compression", "[.][benchmark][MMapTileCompression]")
+{
+    GridTile tile(128);
+    std::vector<unsigned char> compressed = MMAP::CompressTileData(tile.Data.data(), uint32(tile.Data.size()));
+    INFO("tile " << tile.Data.size() << " bytes, compressed " << compressed.size() << " bytes");
+    REQUIRE(!compressed.empty());
+
+    // the reads saved by the smaller file have to pay for inflating it
+    BENCHMARK("copy uncompressed tile")
+    {
+        unsigned char* data = static_cast<unsigned char*>(dtAlloc(int(tile.Data.size()), DT_ALLOC_PERM));
+        memcpy(data, tile.Data.data(), tile.Data.size());
+        unsigned char last = data[tile.Data.size() - 1];
+        dtFree(data);
+        return last;
+    };
+
+    BENCHMARK("inflate compressed tile")
+    {
+        unsigned char* data = static_cast<unsigned char*>(dtAlloc(int(tile.Data.size()), DT_ALLOC_PERM));
+        bool result = MMAP::DecompressTileData(compressed.data(), uint32(compressed.size()), data, uint32(tile.Data.size()));
+        dtFree(data);
+        return result;
+    };
+
+    BENCHMARK("compress tile")
+    {
+        return MMAP::CompressTileData(tile.Data.data(), uint32(tile.Data.size())).size();
+    };
+}
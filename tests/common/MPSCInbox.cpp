@@ -0,0 +1,85 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MPSCInbox.h"
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Item
+{
+    explicit Item(int producer, int value) : Producer(producer), Value(value) { }
+
+    int Producer;
+    int Value;
+    std::atomic<Item*> Link;
+};
+}
+
+TEST_CASE("MPSCInbox", "[MPSCInbox]")
+{
+    Trinity::MPSCInbox<Item, &Item::Link> inbox;
+
+    SECTION("Drains in enqueue order")
+    {
+        REQUIRE(inbox.Empty());
+        for (int i = 0; i < 5; ++i)
+            inbox.Enqueue(new Item(0, i));
+
+        std::vector<int> values;
+        REQUIRE(inbox.Drain([&](Item* item) { values.push_back(item->Value); delete item; }) == 5);
+        REQUIRE(values == std::vector<int>{ 0, 1, 2, 3, 4 });
+        REQUIRE(inbox.Empty());
+        REQUIRE(inbox.Drain([](Item* item) { delete item; }) == 0);
+    }
+
+    SECTION("Keeps per producer order with concurrent producers")
+    {
+        constexpr int Producers = 4;
+        constexpr int ItemsPerProducer = 10000;
+
+        std::vector<std::thread> threads;
+        for (int producer = 0; producer < Producers; ++producer)
+            threads.emplace_back([&, producer]
+            {
+                for (int i = 0; i < ItemsPerProducer; ++i)
+                    inbox.Enqueue(new Item(producer, i));
+            });
+
+        std::vector<int> next(Producers, 0);
+        bool ordered = true;
+        std::size_t drained = 0;
+        auto consume = [&](Item* item)
+        {
+            ordered = ordered && item->Value == next[item->Producer];
+            next[item->Producer] = item->Value + 1;
+            delete item;
+        };
+
+        while (drained < std::size_t(Producers * ItemsPerProducer))
+            drained += inbox.Drain(consume);
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        REQUIRE(ordered);
+        REQUIRE(inbox.Empty());
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Define.h"
+#include "MPSCQueue.h"
+#include "Optional.h"
+#include "ProducerConsumerQueue.h"
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Item
+{
+    explicit Item(uint32 value) : Value(value) { }
+
+    uint32 Value;
+    std::atomic<Item*> Link;
+};
+
+constexpr uint32 Producers = 4;
+constexpr uint32 ItemsPerProducer = 10000;
+
+// every producer enqueues its own range of values while the calling thread dequeues, returns the sum of the values
+template <class Enqueue, class Dequeue>
+uint64 RunProducers(Enqueue enqueue, Dequeue dequeue)
+{
+    std::vector<std::thread> threads;
+    for (uint32 producer = 0; producer < Producers; ++producer)
+        threads.emplace_back([&, producer]
+        {
+            for (uint32 i = 0; i < ItemsPerProducer; ++i)
+                enqueue(producer * ItemsPerProducer + i);
+        });
+
+    uint64 sum = 0;
+    for (uint32 received = 0; received < Producers * ItemsPerProducer;)
+    {
+        if (Optional<uint32> value = dequeue())
+        {
+            sum += *value;
+            ++received;
+        }
+        else
+            std::this_thread::yield();
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    return sum;
+}
+
+constexpr uint64 ExpectedSum = uint64(Producers * ItemsPerProducer) * (Producers * ItemsPerProducer - 1) / 2;
+}
+
+TEST_CASE("MPSCQueue", "[MPSCQueue]")
+{
+    SECTION("Dequeues in enqueue order")
+    {
+        MPSCQueue<Item, &Item::Link> queue;
+        for (uint32 i = 0; i < 5; ++i)
+            queue.Enqueue(new Item(i));
+
+        Item* item = nullptr;
+        for (uint32 i = 0; i < 5; ++i)
+        {
+            REQUIRE(queue.Dequeue(item));
+            REQUIRE(item->Value == i);
+            delete item;
+        }
+
+        REQUIRE(!queue.Dequeue(item));
+    }
+
+    SECTION("Receives everything of concurrent producers")
+    {
+        MPSCQueue<Item> queue;
+        uint64 sum = RunProducers([&](uint32 value) { queue.Enqueue(new Item(value)); }, [&]() -> Optional<uint32>
+        {
+            Item* item = nullptr;
+            if (!queue.Dequeue(item))
+                return {};
+
+            uint32 value = item->Value;
+            delete item;
+            return value;
+        });
+
+        REQUIRE(sum == ExpectedSum);
+    }
+}
+
+TEST_CASE("Queue throughput with concurrent producers", "[.][benchmark][MPSCQueue]")
+{
+    BENCHMARK("MPSCQueue, intrusive")
+    {
+        MPSCQueue<Item, &Item::Link> queue;
+        return RunProducers([&](uint32 value) { queue.Enqueue(new Item(value)); }, [&]() -> Optional<uint32>
+        {
+            Item* item = nullptr;
+            if (!queue.Dequeue(item))
+                return {};
+
+            uint32 value = item->Value;
+            delete item;
+            return value;
+        });
+    };
+
+    BENCHMARK("MPSCQueue, non intrusive")
+    {
+        MPSCQueue<Item> queue;
+        return RunProducers([&](uint32 value) { queue.Enqueue(new Item(value)); }, [&]() -> Optional<uint32>
+        {
+            Item* item = nullptr;
+            if (!queue.Dequeue(item))
+                return {};
+
+            uint32 value = item->Value;
+            delete item;
+            return value;
+        });
+    };
+
+    BENCHMARK("ProducerConsumerQueue")
+    {
+        ProducerConsumerQueue<Item*> queue;
+        return RunProducers([&](uint32 value) { queue.Push(new Item(value)); }, [&]() -> Optional<uint32>
+        {
+            Item* item = nullptr;
+            if (!queue.Pop(item))
+                return {};
+
+            uint32 value = item->Value;
+            delete item;
+            return value;
+        });
+    };
+}
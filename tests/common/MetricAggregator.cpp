@@ -0,0 +1,78 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MetricAggregator.h"
+#include <map>
+#include <thread>
+
+namespace
+{
+std::map<std::string, MetricTimerSummary> FlushAll(MetricTimerAggregator& aggregator)
+{
+    std::map<std::string, MetricTimerSummary> summaries;
+    aggregator.Flush([&](std::string const& category, std::vector<MetricTag> const& tags, MetricTimerSummary const& summary)
+    {
+        std::string key = category;
+        for (MetricTag const& tag : tags)
+            key += "," + tag.first + "=" + tag.second;
+        summaries[key] = summary;
+    });
+    return summaries;
+}
+}
+
+TEST_CASE("MetricTimerAggregator summarizes durations per series", "[MetricTimerAggregator]")
+{
+    using namespace std::chrono_literals;
+
+    MetricTimerAggregator aggregator;
+    std::array<MetricTagView, 1> tags = { MetricTagView("type", "a") };
+    for (int32 i = 1; i <= 100; ++i)
+        aggregator.Record("update_time", tags, std::chrono::milliseconds(i));
+    aggregator.Record("update_time", {}, 5ms);
+
+    std::thread([&] { aggregator.Record("update_time", {}, 7ms); }).join();
+
+    std::map<std::string, MetricTimerSummary> summaries = FlushAll(aggregator);
+    REQUIRE(summaries.size() == 2);
+
+    MetricTimerSummary const& tagged = summaries["update_time,type=a"];
+    REQUIRE(tagged.Count == 100);
+    REQUIRE(tagged.Mean == 50);
+    REQUIRE(tagged.Max == 100);
+    // percentiles are bucketed by powers of two, they are only accurate within a factor of two
+    REQUIRE(tagged.P50 >= 50);
+    REQUIRE(tagged.P50 <= 100);
+    REQUIRE(tagged.P99 <= 100);
+
+    // both threads recorded into their own shard, they are merged into one point
+    REQUIRE(summaries["update_time"].Count == 2);
+    REQUIRE(summaries["update_time"].Max == 7);
+
+    SECTION("series are reset after being flushed")
+    {
+        REQUIRE(FlushAll(aggregator).empty());
+
+        aggregator.Record("update_time", tags, 3ms);
+        summaries = FlushAll(aggregator);
+        REQUIRE(summaries.size() == 1);
+        REQUIRE(summaries["update_time,type=a"].Count == 1);
+        REQUIRE(summaries["update_time,type=a"].Max == 3);
+    }
+}
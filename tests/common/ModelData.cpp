@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ModelData.h"
+#include <array>
+
+using VMAP::ModelArray;
+using VMAP::ModelDataReader;
+
+TEST_CASE("ModelDataReader views aligned arrays of mapped data", "[ModelData]")
+{
+    alignas(uint32) std::array<uint8, 13> data = { 'T', 'E', 'S', 'T', 2, 0, 0, 0, 7, 0, 0, 0, 9 };
+
+    SECTION("mapped data is viewed in place")
+    {
+        ModelDataReader reader(data, true);
+        uint32 count = 0;
+        ModelArray<uint32> array;
+        REQUIRE(reader.readChunk("TEST", 4));
+        REQUIRE(reader.read(count));
+        REQUIRE(reader.readArray(count - 1, array));
+        REQUIRE(array.size() == 1);
+        REQUIRE(array[0] == 7);
+        REQUIRE(array.data() == reinterpret_cast<uint32 const*>(data.data() + 8));
+
+        ModelArray<uint32> copy = array;
+        REQUIRE(copy.data() == array.data());
+    }
+
+    SECTION("misaligned and read data is copied")
+    {
+        ModelDataReader reader(std::span<uint8 const>(data).subspan(1), true);
+        ModelArray<uint32> array;
+        REQUIRE(reader.readArray(1, array));
+        REQUIRE(array.data() != reinterpret_cast<uint32 const*>(data.data() + 1));
+
+        ModelDataReader readReader(data, false);
+        ModelArray<uint32> readArray;
+        REQUIRE(readReader.readArray(2, readArray));
+        REQUIRE(readArray.data() != reinterpret_cast<uint32 const*>(data.data()));
+        REQUIRE(readArray[1] == 2);
+
+        ModelArray<uint32> moved = std::move(readArray);
+        REQUIRE(moved[1] == 2);
+        REQUIRE(readArray.empty());
+    }
+
+    SECTION("reads past the end fail")
+    {
+        ModelDataReader reader(data, true);
+        ModelArray<uint32> array;
+        REQUIRE(!reader.readChunk("TSET", 4));
+        REQUIRE(!reader.readArray(4, array));
+        REQUIRE(reader.readArray(3, array));
+        uint32 value = 0;
+        REQUIRE(!reader.read(value));
+    }
+
+    SECTION("padding is skipped up to the end of the data")
+    {
+        ModelDataReader reader(data, true);
+        REQUIRE(reader.skip(8));
+        REQUIRE(reader.position() == 8);
+        uint32 value = 0;
+        REQUIRE(reader.read(value));
+        REQUIRE(value == 7);
+        REQUIRE(!reader.skip(2));
+        REQUIRE(reader.skip(1));
+        REQUIRE(reader.position() == data.size());
+    }
+}
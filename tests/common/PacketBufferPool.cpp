@@ -0,0 +1,70 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "PacketBufferPool.h"
+#include <algorithm>
+#include <thread>
+
+TEST_CASE("PacketBufferPool", "[PacketBufferPool]")
+{
+    SECTION("Acquired buffers are empty and large enough")
+    {
+        for (std::size_t size : { std::size_t(0), std::size_t(1), std::size_t(256), std::size_t(257), std::size_t(5000), std::size_t(0x10000), std::size_t(0x20000) })
+        {
+            std::vector<uint8> buffer = PacketBufferPool::Acquire(size);
+            REQUIRE(buffer.empty());
+            REQUIRE(buffer.capacity() >= size);
+            PacketBufferPool::Release(std::move(buffer));
+        }
+    }
+
+    SECTION("Released buffers are reused")
+    {
+        std::vector<uint8> buffer = PacketBufferPool::Acquire(1000);
+        buffer.resize(700, 0xAB);
+        uint8 const* storage = buffer.data();
+        PacketBufferPool::Release(std::move(buffer));
+
+        std::vector<uint8> reused = PacketBufferPool::Acquire(1000);
+        REQUIRE(reused.data() == storage);
+        REQUIRE(reused.empty());
+
+        // the released buffer is too small for this one
+        PacketBufferPool::Release(std::move(reused));
+        std::vector<uint8> larger = PacketBufferPool::Acquire(2000);
+        REQUIRE(larger.data() != storage);
+        REQUIRE(larger.capacity() >= 2000);
+    }
+
+    SECTION("Buffers released on another thread come back")
+    {
+        std::vector<std::vector<uint8>> buffers;
+        for (int i = 0; i < 64; ++i)
+            buffers.push_back(PacketBufferPool::Acquire(3000));
+
+        std::vector<uint8 const*> storages;
+        for (std::vector<uint8> const& buffer : buffers)
+            storages.push_back(buffer.data());
+
+        std::thread([&] { for (std::vector<uint8>& buffer : buffers) PacketBufferPool::Release(std::move(buffer)); }).join();
+
+        std::vector<uint8> reused = PacketBufferPool::Acquire(3000);
+        REQUIRE(std::ranges::find(storages, reused.data()) != storages.end());
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Containers.h"
+#include "Random.h"
+#include "SFMTRand.h"
+#include <memory>
+#include <numeric>
+#include <random>
+
+TEST_CASE("Bulk generation continues the sequence", "[Random]")
+{
+    std::unique_ptr<SFMTRand> single = std::make_unique<SFMTRand>(1234);
+    std::unique_ptr<SFMTRand> bulk = std::make_unique<SFMTRand>(1234);
+
+    // a few values, an unaligned array, one large enough for block mode and the values after it
+    std::vector<uint32> values(10000);
+    std::size_t offset = 0;
+    for (std::size_t size : { 3, 1, 700, 4000, 17, 3000 })
+    {
+        bulk->RandomUInt32(std::span(values).subspan(offset, size));
+        offset += size;
+    }
+
+    for (std::size_t i = 0; i < offset; ++i)
+        REQUIRE(values[i] == single->RandomUInt32());
+
+    REQUIRE(bulk->RandomUInt32() == single->RandomUInt32());
+}
+
+TEST_CASE("Buffered engine", "[Random]")
+{
+    BufferedRandomEngine engine;
+    std::uniform_int_distribution<uint32> distribution(0, 9);
+    std::array<uint32, 10> counts = { };
+    for (uint32 i = 0; i < 10000; ++i)
+        ++counts[distribution(engine)];
+
+    for (uint32 count : counts)
+        REQUIRE(count > 800);
+
+    std::vector<uint32> shuffled(1000);
+    std::iota(shuffled.begin(), shuffled.end(), 0);
+    Trinity::Containers::RandomShuffle(shuffled);
+    std::vector<uint32> sorted = shuffled;
+    std::ranges::sort(sorted);
+    REQUIRE(shuffled != sorted);
+    for (uint32 i = 0; i < sorted.size(); ++i)
+        REQUIRE(sorted[i] == i);
+}
+
+TEST_CASE("Random number throughput", "[.][benchmark][Random]")
+{
+    std::vector<uint32> values(4096);
+
+    BENCHMARK("rand32 per value")
+    {
+        for (uint32& value : values)
+            value = rand32();
+        return values[0];
+    };
+
+    BENCHMARK("rand32 bulk")
+    {
+        rand32(values);
+        return values[0];
+    };
+
+    BENCHMARK("urand, RandomEngine")
+    {
+        uint32 sum = 0;
+        for (uint32 i = 0; i < 4096; ++i)
+            sum += urand(0, 99);
+        return sum;
+    };
+
+    BENCHMARK("uniform_int_distribution, BufferedRandomEngine")
+    {
+        BufferedRandomEngine engine;
+        std::uniform_int_distribution<uint32> distribution(0, 99);
+        uint32 sum = 0;
+        for (uint32 i = 0; i < 4096; ++i)
+            sum += distribution(engine);
+        return sum;
+    };
+
+    BENCHMARK("shuffle 4096")
+    {
+        Trinity::Containers::RandomShuffle(values);
+        return values[0];
+    };
+}
@@ -0,0 +1,193 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "SeqLockHashMap.h"
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+
+using Trinity::Containers::SeqLockHashMap;
+
+namespace
+{
+// every key lands in the same home slot, exercises probing and the backward shift of Remove
+struct CollidingHash
+{
+    std::size_t operator()(uint64 /*key*/) const { return 0; }
+};
+
+// runs readers on their own threads for a while, returns lookups per second of all of them together
+template <class Find>
+double MeasureReaders(uint32 threadCount, Find const& find)
+{
+    std::atomic<bool> start = false;
+    std::atomic<bool> stop = false;
+    std::atomic<uint64> lookups = 0;
+    std::atomic<uint64> hits = 0;
+    std::vector<std::thread> threads;
+    for (uint32 t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            while (!start)
+                std::this_thread::yield();
+
+            uint64 count = 0;
+            uint64 found = 0;
+            for (uint64 key = t; !stop.load(std::memory_order_relaxed); key = (key + 7) % 2048, ++count)
+                found += find(key) != nullptr;
+
+            lookups += count;
+            hits += found;
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop = true;
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    REQUIRE(hits > 0);
+    return double(lookups) / elapsed.count();
+}
+}
+
+TEST_CASE("Insert, find and remove", "[SeqLockHashMap]")
+{
+    SeqLockHashMap<uint64, int> map;
+    std::vector<int> values(1000);
+
+    for (uint64 key = 0; key < values.size(); ++key)
+        map.Insert(key * 3, &values[key]);
+
+    REQUIRE(map.GetSize() == values.size());
+    REQUIRE(map.GetCapacity() >= values.size() * 2);
+    for (uint64 key = 0; key < values.size(); ++key)
+    {
+        REQUIRE(map.Find(key * 3) == &values[key]);
+        REQUIRE(map.Find(key * 3 + 1) == nullptr);
+    }
+
+    SECTION("inserting a key again replaces its value")
+    {
+        int other = 0;
+        map.Insert(3, &other);
+        REQUIRE(map.GetSize() == values.size());
+        REQUIRE(map.Find(3) == &other);
+    }
+
+    SECTION("removed keys are gone, the others stay")
+    {
+        for (uint64 key = 0; key < values.size(); key += 2)
+            map.Remove(key * 3);
+
+        map.Remove(1);
+        REQUIRE(map.GetSize() == values.size() / 2);
+        for (uint64 key = 0; key < values.size(); ++key)
+            REQUIRE(map.Find(key * 3) == (key % 2 ? &values[key] : nullptr));
+    }
+}
+
+TEST_CASE("Removing from a probe sequence", "[SeqLockHashMap]")
+{
+    SeqLockHashMap<uint64, int, CollidingHash> map;
+    std::vector<int> values(20);
+    for (uint64 key = 0; key < values.size(); ++key)
+        map.Insert(key, &values[key]);
+
+    map.Remove(0);
+    map.Remove(10);
+    map.Remove(19);
+    for (uint64 key = 0; key < values.size(); ++key)
+        REQUIRE(map.Find(key) == (key == 0 || key == 10 || key == 19 ? nullptr : &values[key]));
+
+    map.Insert(10, &values[10]);
+    REQUIRE(map.Find(10) == &values[10]);
+    REQUIRE(map.GetSize() == values.size() - 2);
+}
+
+TEST_CASE("Readers see stable keys while others are written", "[SeqLockHashMap]")
+{
+    SeqLockHashMap<uint64, int> map;
+    std::vector<int> values(4096);
+    for (uint64 key = 0; key < 64; ++key)
+        map.Insert(key, &values[key]);
+
+    std::atomic<bool> stop = false;
+    std::atomic<bool> failed = false;
+    std::vector<std::thread> readers;
+    for (uint32 t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&]
+        {
+            while (!stop.load(std::memory_order_relaxed))
+                for (uint64 key = 0; key < 64; ++key)
+                    if (map.Find(key) != &values[key])
+                        failed = true;
+        });
+    }
+
+    // other keys come and go, the map grows a few times meanwhile
+    for (uint32 round = 0; round < 20; ++round)
+    {
+        for (uint64 key = 64; key < 64 + round * 200; ++key)
+            map.Insert(key, &values[key]);
+        for (uint64 key = 64; key < 64 + round * 200; ++key)
+            map.Remove(key);
+    }
+
+    stop = true;
+    for (std::thread& reader : readers)
+        reader.join();
+
+    REQUIRE(!failed);
+    REQUIRE(map.GetSize() == 64);
+}
+
+TEST_CASE("Concurrent lookup scaling", "[.][benchmark][SeqLockHashMap]")
+{
+    // 2000 online players, looked up by guid from every map thread
+    std::vector<int> values(2048);
+    SeqLockHashMap<uint64, int> map;
+    std::unordered_map<uint64, int*> lockedMap;
+    std::shared_mutex lock;
+    for (uint64 key = 0; key < 2000; ++key)
+    {
+        map.Insert(key, &values[key]);
+        lockedMap[key] = &values[key];
+    }
+
+    for (uint32 threads : { 1, 4, 16, 32 })
+    {
+        double seqLock = MeasureReaders(threads, [&](uint64 key) { return map.Find(key); });
+        double sharedMutex = MeasureReaders(threads, [&](uint64 key) -> int*
+        {
+            std::shared_lock guard(lock);
+            auto itr = lockedMap.find(key);
+            return itr != lockedMap.end() ? itr->second : nullptr;
+        });
+
+        WARN(threads << " readers: " << uint64(seqLock / 1000000) << "M lookups/s, shared_mutex " << uint64(sharedMutex / 1000000) << "M lookups/s");
+    }
+}
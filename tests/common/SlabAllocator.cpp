@@ -0,0 +1,104 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "SlabAllocator.h"
+#include <vector>
+
+namespace
+{
+struct PooledBase : Trinity::SlabAllocated<PooledBase>
+{
+    virtual ~PooledBase() = default;
+    int Value = 0;
+};
+
+struct PooledDerived : PooledBase
+{
+    char Padding[200] = { };
+};
+}
+
+TEST_CASE("SlabAllocator places consecutive allocations next to each other", "[SlabAllocator]")
+{
+    Trinity::SlabAllocator allocator(100, 8);
+
+    std::byte* first = static_cast<std::byte*>(allocator.Allocate());
+    std::byte* second = static_cast<std::byte*>(allocator.Allocate());
+    REQUIRE(second > first);
+    REQUIRE(std::size_t(second - first) == Trinity::SlabAllocator::HeaderSize + 112);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(first) % alignof(std::max_align_t) == 0);
+
+    Trinity::SlabAllocator::Deallocate(first);
+    Trinity::SlabAllocator::Deallocate(second);
+}
+
+TEST_CASE("SlabAllocator returns empty slabs", "[SlabAllocator]")
+{
+    Trinity::SlabAllocator allocator(64, 4);
+
+    std::vector<void*> objects;
+    for (int i = 0; i < 16; ++i)
+        objects.push_back(allocator.Allocate());
+
+    REQUIRE(allocator.GetStats().Slabs == 4);
+    REQUIRE(allocator.GetStats().Objects == 16);
+
+    SECTION("Freed slots are reused before growing")
+    {
+        Trinity::SlabAllocator::Deallocate(objects[5]);
+        void* reused = allocator.Allocate();
+        REQUIRE(reused == objects[5]);
+        REQUIRE(allocator.GetStats().Slabs == 4);
+    }
+
+    SECTION("Only one empty slab is kept")
+    {
+        for (void* object : objects)
+            Trinity::SlabAllocator::Deallocate(object);
+
+        REQUIRE(allocator.GetStats().Slabs == 1);
+        REQUIRE(allocator.GetStats().Objects == 0);
+        objects.clear();
+    }
+
+    for (void* object : objects)
+        Trinity::SlabAllocator::Deallocate(object);
+}
+
+TEST_CASE("SlabAllocated hierarchy shares one pool", "[SlabAllocator]")
+{
+    Trinity::SlabPool& pool = PooledBase::GetSlabPool();
+    std::size_t objectsBefore = pool.GetStats().Objects;
+
+    PooledBase* base = new PooledBase();
+    PooledBase* derived = new PooledDerived();
+    derived->Value = 5;
+    REQUIRE(pool.GetStats().Objects == objectsBefore + 2);
+
+    delete base;
+    delete derived;
+    REQUIRE(pool.GetStats().Objects == objectsBefore);
+
+    SECTION("Oversized objects bypass slabs")
+    {
+        void* big = pool.Allocate(Trinity::SlabPool::MaxObjectSize + 1);
+        REQUIRE(pool.GetStats().Objects == objectsBefore);
+        Trinity::SlabPool::Deallocate(big);
+    }
+}
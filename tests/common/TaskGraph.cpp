@@ -0,0 +1,85 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "TaskGraph.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+TEST_CASE("TaskGraph runs tasks sequentially in insertion order", "[TaskGraph]")
+{
+    Trinity::TaskGraph graph;
+    std::vector<int> order;
+    Trinity::TaskGraph::TaskId first = graph.Add("first", [&] { order.push_back(1); });
+    graph.Add("second", [&] { order.push_back(2); }, { first });
+    graph.Add("third", [&] { order.push_back(3); });
+
+    graph.Run(1);
+
+    REQUIRE(order == std::vector<int>{ 1, 2, 3 });
+    REQUIRE(graph.GetTaskCount() == 3);
+    REQUIRE(graph.GetName(first) == "first");
+}
+
+TEST_CASE("TaskGraph starts tasks only after their dependencies", "[TaskGraph]")
+{
+    Trinity::TaskGraph graph;
+    std::mutex lock;
+    std::vector<Trinity::TaskGraph::TaskId> finished;
+    auto record = [&](Trinity::TaskGraph::TaskId id)
+    {
+        return [&, id]
+        {
+            std::scoped_lock guard(lock);
+            finished.push_back(id);
+        };
+    };
+
+    // a -> c, b -> c, c -> d, e independent
+    Trinity::TaskGraph::TaskId a = graph.Add("a", record(0));
+    Trinity::TaskGraph::TaskId b = graph.Add("b", record(1));
+    Trinity::TaskGraph::TaskId c = graph.Add("c", record(2), { a, b });
+    Trinity::TaskGraph::TaskId d = graph.Add("d", record(3), { c });
+    graph.Add("e", record(4));
+
+    graph.Run(4);
+
+    REQUIRE(finished.size() == 5);
+    auto position = [&](Trinity::TaskGraph::TaskId id) { return std::find(finished.begin(), finished.end(), id) - finished.begin(); };
+    REQUIRE(position(a) < position(c));
+    REQUIRE(position(b) < position(c));
+    REQUIRE(position(c) < position(d));
+}
+
+TEST_CASE("TaskGraph executes every task exactly once", "[TaskGraph]")
+{
+    constexpr std::size_t TaskCount = 200;
+
+    Trinity::TaskGraph graph;
+    std::vector<std::atomic<int>> executions(TaskCount);
+    Trinity::TaskGraph::TaskId root = graph.Add("root", [&] { ++executions[0]; });
+    for (std::size_t i = 1; i < TaskCount; ++i)
+        graph.Add("task", [&, i] { ++executions[i]; }, { i % 3 ? root : i - 1 });
+
+    graph.Run(8);
+
+    for (std::atomic<int> const& count : executions)
+        REQUIRE(count == 1);
+}
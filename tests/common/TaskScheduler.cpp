@@ -0,0 +1,169 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "TaskScheduler.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+TEST_CASE("TaskScheduler executes tasks in time order", "[TaskScheduler]")
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+
+    scheduler.Schedule(2s, [&](TaskContext) { executed.push_back(3); });
+    scheduler.Schedule(1s, [&](TaskContext) { executed.push_back(1); });
+    scheduler.Schedule(1s, [&](TaskContext) { executed.push_back(2); });
+
+    scheduler.Update(500ms);
+    REQUIRE(executed.empty());
+
+    scheduler.Update(1500ms);
+    REQUIRE(executed == std::vector<int>{ 1, 2, 3 });
+}
+
+TEST_CASE("TaskScheduler repeats tasks", "[TaskScheduler]")
+{
+    TaskScheduler scheduler;
+    uint32 count = 0;
+    scheduler.Schedule(1s, [&](TaskContext context)
+    {
+        ++count;
+        if (context.GetRepeatCounter() < 2)
+            context.Repeat();
+    });
+
+    scheduler.Update(10s);
+    REQUIRE(count == 3);
+
+    SECTION("Repeating twice from the same context asserts")
+    {
+        scheduler.Schedule(1s, [&](TaskContext context)
+        {
+            context.Repeat();
+            REQUIRE_THROWS(context.Repeat());
+        });
+    }
+}
+
+TEST_CASE("TaskScheduler groups", "[TaskScheduler]")
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+
+    scheduler.Schedule(1s, 1, [&](TaskContext) { executed.push_back(1); });
+    scheduler.Schedule(1s, 2, [&](TaskContext) { executed.push_back(2); });
+    scheduler.Schedule(1s, [&](TaskContext) { executed.push_back(3); });
+
+    SECTION("Cancelled groups are not executed")
+    {
+        scheduler.CancelGroup(1);
+        scheduler.Update(1s);
+        REQUIRE(executed == std::vector<int>{ 2, 3 });
+    }
+
+    SECTION("Delayed groups execute after the others")
+    {
+        scheduler.DelayGroup(1, 500ms);
+        scheduler.Update(1s);
+        REQUIRE(executed == std::vector<int>{ 2, 3 });
+        scheduler.Update(500ms);
+        REQUIRE(executed == std::vector<int>{ 2, 3, 1 });
+    }
+
+    SECTION("Rescheduled tasks keep their order")
+    {
+        scheduler.RescheduleAll(2s);
+        scheduler.Update(1s);
+        REQUIRE(executed.empty());
+        scheduler.Update(1s);
+        REQUIRE(executed == std::vector<int>{ 1, 2, 3 });
+    }
+}
+
+TEST_CASE("TaskScheduler batches", "[TaskScheduler]")
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+
+    scheduler.Schedule(1s, [&](TaskContext) { executed.push_back(1); });
+    scheduler.Batch([&](TaskScheduler::TaskBatch& batch)
+    {
+        batch.Schedule(2s, [&](TaskContext) { executed.push_back(3); })
+            .Schedule(1s, 5, [&](TaskContext) { executed.push_back(2); });
+    });
+
+    SECTION("Batched tasks execute in time order after tasks scheduled before them")
+    {
+        scheduler.Update(2s);
+        REQUIRE(executed == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Batched tasks keep their group")
+    {
+        scheduler.CancelGroup(5);
+        scheduler.Update(2s);
+        REQUIRE(executed == std::vector<int>{ 1, 3 });
+    }
+
+    SECTION("Batches scheduled from a context start at the end of the task")
+    {
+        scheduler.CancelAll();
+        scheduler.Schedule(1s, [&](TaskContext context)
+        {
+            context.Batch([&](TaskScheduler::TaskBatch& batch)
+            {
+                batch.Schedule(0s, [&](TaskContext) { executed.push_back(4); });
+            });
+        });
+
+        scheduler.Update(3s);
+        REQUIRE(executed == std::vector<int>{ 4 });
+    }
+}
+
+// Run explicitly with "[!benchmark]"
+TEST_CASE("TaskScheduler benchmark", "[.][!benchmark][TaskScheduler]")
+{
+    // every scheduler repeats a few abilities on different timers, like a creature script in combat
+    constexpr uint32 SchedulerCount = 10000;
+    constexpr uint32 UpdateCount = 600;
+    uint64 executed = 0;
+
+    std::vector<std::unique_ptr<TaskScheduler>> schedulers(SchedulerCount);
+    for (uint32 i = 0; i < SchedulerCount; ++i)
+    {
+        schedulers[i] = std::make_unique<TaskScheduler>();
+        for (uint32 ability = 0; ability < 4; ++ability)
+            schedulers[i]->Schedule(Milliseconds(500 + (i * 7 + ability * 1300) % 8000), [&](TaskContext context)
+            {
+                ++executed;
+                context.Repeat();
+            });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 update = 0; update < UpdateCount; ++update)
+        for (std::unique_ptr<TaskScheduler>& scheduler : schedulers)
+            scheduler->Update(100ms);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(executed > 0);
+    std::cout << SchedulerCount << " schedulers: " << elapsed.count() << " ms, " << executed << " tasks executed" << std::endl;
+}
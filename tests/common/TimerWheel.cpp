@@ -0,0 +1,109 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "TimerWheel.h"
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Timer : Trinity::Containers::TimerWheelNode
+{
+    int Id = 0;
+};
+}
+
+TEST_CASE("TimerWheel expires entries at their tick", "[TimerWheel]")
+{
+    Trinity::Containers::TimerWheel<Timer> wheel(100);
+
+    Timer soon, later, past;
+    soon.Id = 1;
+    later.Id = 2;
+    past.Id = 3;
+
+    wheel.Schedule(&soon, 110);
+    wheel.Schedule(&later, 100 + 5000);
+    wheel.Schedule(&past, 50);
+
+    REQUIRE(wheel.PopExpired(100) == &past);
+    REQUIRE(wheel.PopExpired(109) == nullptr);
+    REQUIRE(wheel.PopExpired(110) == &soon);
+    REQUIRE_FALSE(soon.IsScheduled());
+    REQUIRE(later.IsScheduled());
+
+    SECTION("Cancelled entries never expire")
+    {
+        wheel.Cancel(&later);
+        REQUIRE(wheel.PopExpired(10000) == nullptr);
+    }
+
+    SECTION("Rescheduling moves the entry")
+    {
+        wheel.Schedule(&later, 200);
+        REQUIRE(wheel.PopExpired(200) == &later);
+    }
+
+    SECTION("Destroyed entries unschedule themselves")
+    {
+        {
+            Timer temporary;
+            wheel.Schedule(&temporary, 120);
+        }
+        REQUIRE(wheel.PopExpired(4999) == nullptr);
+        REQUIRE(wheel.PopExpired(5100) == &later);
+    }
+}
+
+TEST_CASE("TimerWheel matches an ordered reference", "[TimerWheel]")
+{
+    std::mt19937 rng(42);
+    std::vector<Timer> timers(2000);
+    std::multimap<uint64, Timer*> reference;
+
+    uint64 now = 1000;
+    Trinity::Containers::TimerWheel<Timer> wheel(now);
+
+    // spread over every level, including ones far enough to wrap the coarsest level
+    std::uniform_int_distribution<uint64> delay(0, uint64(1) << 26);
+    for (std::size_t i = 0; i < timers.size(); ++i)
+    {
+        timers[i].Id = int(i);
+        uint64 expiry = now + (i % 4 ? delay(rng) % 5000 : delay(rng));
+        wheel.Schedule(&timers[i], expiry);
+        reference.emplace(expiry, &timers[i]);
+    }
+
+    std::uniform_int_distribution<uint64> step(1, 1 << 16);
+    while (!reference.empty())
+    {
+        now += step(rng);
+        std::vector<Timer*> expired;
+        while (Timer* timer = wheel.PopExpired(now))
+        {
+            REQUIRE(timer->GetExpiry() <= now);
+            expired.push_back(timer);
+        }
+
+        std::size_t expectedCount = std::distance(reference.begin(), reference.upper_bound(now));
+        REQUIRE(expired.size() == expectedCount);
+        reference.erase(reference.begin(), reference.upper_bound(now));
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "TriangleIntersection.h"
+#include "WorldModel.h"
+#include <random>
+#include <vector>
+
+using G3D::Vector3;
+
+TEST_CASE("IntersectTriangles matches the scalar triangle test", "[TriangleIntersection]")
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    auto randomPoint = [&] { return Vector3(coord(generator), coord(generator), coord(generator)); };
+
+    uint32 hits = 0;
+    for (uint32 iteration = 0; iteration < 2000; ++iteration)
+    {
+        std::vector<Vector3> points;
+        std::vector<VMAP::MeshTriangle> triangles;
+        std::vector<uint32> indices;
+        uint32 count = iteration % 7 + 1;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            uint32 first = uint32(points.size());
+            points.push_back(randomPoint());
+            points.push_back(randomPoint());
+            points.push_back(randomPoint());
+            triangles.push_back({ first, first + 1, first + 2 });
+            indices.push_back(count - i - 1);
+        }
+
+        // aimed at the first triangle, most rays hit something
+        Vector3 origin = randomPoint() * 2.0f;
+        Vector3 target = (points[0] + points[1] + points[2]) / 3.0f;
+        G3D::Ray ray = G3D::Ray::fromOriginAndDirection(origin, (target - origin).directionOrZero());
+        float maxDistance = iteration % 3 ? G3D::finf() : 15.0f;
+
+        float scalarDistance = maxDistance;
+        bool scalarHit = false;
+        for (uint32 index : indices)
+            scalarHit = VMAP::IntersectTriangle(triangles[index], points.data(), ray, scalarDistance) || scalarHit;
+
+        float packetDistance = maxDistance;
+        bool packetHit = VMAP::IntersectTriangles(indices, triangles.data(), points.data(), ray, packetDistance);
+
+        REQUIRE(packetHit == scalarHit);
+        REQUIRE(packetDistance == Approx(scalarDistance));
+        hits += scalarHit;
+    }
+
+    // the rays must actually hit something for the comparison to mean anything
+    REQUIRE(hits > 1000);
+}
+
+TEST_CASE("IntersectTriangles ignores degenerate and distant triangles", "[TriangleIntersection]")
+{
+    std::vector<Vector3> points = { { 0, -1, -1 }, { 0, 1, -1 }, { 0, 0, 1 }, { 5, -1, -1 }, { 5, 1, -1 }, { 5, 0, 1 }, { 2, 0, 0 }, { 2, 0, 0 }, { 2, 0, 0 } };
+    std::vector<VMAP::MeshTriangle> triangles = { { 0, 1, 2 }, { 3, 4, 5 }, { 6, 7, 8 } };
+    std::vector<uint32> indices = { 2, 1, 0 };
+    G3D::Ray ray = G3D::Ray::fromOriginAndDirection(Vector3(-5, 0, 0), Vector3(1, 0, 0));
+
+    float distance = 100.0f;
+    REQUIRE(VMAP::IntersectTriangles(indices, triangles.data(), points.data(), ray, distance));
+    REQUIRE(distance == Approx(5.0f));
+
+    distance = 4.0f;
+    REQUIRE(!VMAP::IntersectTriangles(indices, triangles.data(), points.data(), ray, distance));
+    REQUIRE(distance == 4.0f);
+}
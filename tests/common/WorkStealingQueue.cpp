@@ -0,0 +1,84 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "WorkStealingQueue.h"
+#include <atomic>
+#include <thread>
+
+TEST_CASE("WorkStealingQueue pops own tasks in push order", "[WorkStealingQueue]")
+{
+    Trinity::WorkStealingQueue<int> queue(2);
+    queue.Push(0, 1);
+    queue.Push(0, 2);
+    queue.Push(1, 3);
+
+    int value = 0;
+    REQUIRE(queue.Pop(0, value));
+    REQUIRE(value == 1);
+    REQUIRE(queue.Pop(0, value));
+    REQUIRE(value == 2);
+
+    SECTION("Empty worker steals from others")
+    {
+        REQUIRE(queue.Pop(0, value));
+        REQUIRE(value == 3);
+        REQUIRE_FALSE(queue.Pop(0, value));
+        REQUIRE_FALSE(queue.Pop(1, value));
+    }
+
+    SECTION("Clear drops remaining tasks")
+    {
+        queue.Clear();
+        REQUIRE_FALSE(queue.Pop(1, value));
+    }
+}
+
+TEST_CASE("WorkStealingQueue executes every task exactly once", "[WorkStealingQueue]")
+{
+    constexpr std::size_t WorkerCount = 4;
+    constexpr int TaskCount = 10000;
+
+    Trinity::WorkStealingQueue<int> queue(WorkerCount);
+
+    // everything goes to worker 0, the rest has to steal
+    for (int i = 1; i <= TaskCount; ++i)
+        queue.Push(0, i);
+
+    std::atomic<long long> sum = 0;
+    std::atomic<int> executed = 0;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < WorkerCount; ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            int task = 0;
+            while (queue.Pop(i, task))
+            {
+                sum += task;
+                ++executed;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    REQUIRE(executed == TaskCount);
+    REQUIRE(sum == (long long)TaskCount * (TaskCount + 1) / 2);
+}
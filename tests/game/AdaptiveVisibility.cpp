@@ -0,0 +1,92 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AdaptiveVisibility.h"
+
+using Thresholds = AdaptiveVisibility::Thresholds;
+
+namespace
+{
+// runs 50ms ticks for the given time, returns how often the distance changed
+uint32 Run(AdaptiveVisibility& visibility, uint32 time, uint32 tickTime, uint32 zonePlayers, Thresholds const& thresholds)
+{
+    uint32 changes = 0;
+    for (uint32 elapsed = 0; elapsed < time; elapsed += 50)
+        changes += visibility.Update(50, tickTime, zonePlayers, thresholds);
+    return changes;
+}
+}
+
+TEST_CASE("Adaptive visibility follows the load", "[AdaptiveVisibility]")
+{
+    AdaptiveVisibility visibility(100.0f);
+    Thresholds thresholds{ .TickTime = 40, .ZonePlayers = 200, .MinDistance = 60.0f };
+
+    REQUIRE(Run(visibility, 10000, 10, 50, thresholds) == 0);
+    REQUIRE(visibility.GetDistance() == 100.0f);
+
+    SECTION("single slow ticks are ignored")
+    {
+        visibility.Update(50, 200, 50, thresholds);
+        REQUIRE(Run(visibility, 10000, 10, 50, thresholds) == 0);
+        REQUIRE(visibility.GetDistance() == 100.0f);
+    }
+
+    SECTION("slow updates shrink the distance down to the minimum")
+    {
+        REQUIRE(Run(visibility, 1500, 80, 50, thresholds) == 1);
+        REQUIRE(visibility.GetDistance() == Approx(90.0f));
+
+        Run(visibility, 10000, 80, 50, thresholds);
+        REQUIRE(visibility.GetDistance() == 60.0f);
+
+        // load between relief and threshold keeps the distance
+        REQUIRE(Run(visibility, 20000, 35, 50, thresholds) == 0);
+
+        // growing back is slower than shrinking
+        REQUIRE(Run(visibility, 6000, 10, 50, thresholds) == 1);
+        REQUIRE(visibility.GetDistance() == Approx(65.0f));
+        Run(visibility, 60000, 10, 50, thresholds);
+        REQUIRE(visibility.GetDistance() == 100.0f);
+    }
+
+    SECTION("crowded zones shrink the distance")
+    {
+        Run(visibility, 3000, 10, 300, thresholds);
+        REQUIRE(visibility.GetDistance() < 100.0f);
+
+        // players leaving but still above relief
+        REQUIRE(Run(visibility, 20000, 10, 180, thresholds) == 0);
+    }
+
+    SECTION("maps below the minimum keep their distance")
+    {
+        AdaptiveVisibility small(40.0f);
+        REQUIRE(Run(small, 10000, 80, 300, thresholds) == 0);
+        REQUIRE(small.GetDistance() == 40.0f);
+    }
+
+    SECTION("a raised minimum applies immediately")
+    {
+        Run(visibility, 10000, 80, 50, thresholds);
+        thresholds.MinDistance = 80.0f;
+        REQUIRE(visibility.Update(50, 80, 50, thresholds));
+        REQUIRE(visibility.GetDistance() == 80.0f);
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AuctionHouseMgr.h"
+
+namespace
+{
+AuctionReplicatePageCache::Page MakePage(uint32 lastAuctionId, bool isFull, TimePoint now)
+{
+    AuctionReplicatePageCache::Page page;
+    page.Items = { 1, 2, 3 };
+    page.ItemCount = 1;
+    page.LastAuctionId = lastAuctionId;
+    page.IsFull = isFull;
+    page.BuildTime = now;
+    return page;
+}
+}
+
+TEST_CASE("Replicate pages are shared until an auction they cover changes", "[AuctionReplicatePageCache]")
+{
+    TimePoint now = TimePoint(1h);
+    AuctionReplicatePageCache cache;
+
+    // auctions 1-100 in pages of 50, then the partial page after the last auction
+    cache.Store(0, 50, MakePage(50, true, now), now);
+    cache.Store(50, 50, MakePage(100, true, now), now);
+    cache.Store(100, 50, MakePage(120, false, now), now);
+    REQUIRE(cache.GetSize() == 3);
+    REQUIRE(cache.Find(0, 50, now));
+    REQUIRE(cache.Find(0, 50, now)->LastAuctionId == 50);
+    REQUIRE(!cache.Find(0, 100, now));
+    REQUIRE(!cache.Find(25, 50, now));
+
+    SECTION("changed auctions drop the page containing them")
+    {
+        cache.Invalidate(75);
+        REQUIRE(cache.Find(0, 50, now));
+        REQUIRE(!cache.Find(50, 50, now));
+        REQUIRE(cache.Find(100, 50, now));
+
+        cache.Invalidate(50);
+        REQUIRE(!cache.Find(0, 50, now));
+    }
+
+    SECTION("new auctions only drop the last page")
+    {
+        cache.Invalidate(121);
+        REQUIRE(cache.Find(0, 50, now));
+        REQUIRE(cache.Find(50, 50, now));
+        REQUIRE(!cache.Find(100, 50, now));
+    }
+
+    SECTION("old pages are built again")
+    {
+        REQUIRE(cache.Find(0, 50, now + AuctionReplicatePageCache::MaxAge - 1s));
+        REQUIRE(!cache.Find(0, 50, now + AuctionReplicatePageCache::MaxAge));
+    }
+
+    SECTION("the cache does not grow past its limit")
+    {
+        for (uint32 cursor = 200; cache.GetSize() < AuctionReplicatePageCache::MaxPages; ++cursor)
+            cache.Store(cursor, 1, MakePage(cursor + 1, true, now), now);
+
+        // expired pages go first
+        TimePoint later = now + AuctionReplicatePageCache::MaxAge;
+        cache.Store(0, 10, MakePage(10, true, later), later);
+        REQUIRE(cache.GetSize() == 1);
+        REQUIRE(cache.Find(0, 10, later));
+    }
+}
@@ -0,0 +1,283 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AuctionHouseMgr.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace
+{
+// Buckets like the ones of a busy auction house, names built from a small vocabulary so that searches match some of them
+struct AuctionHouseBuckets
+{
+    AuctionHouseBuckets(uint32 count, uint32 seed)
+    {
+        static constexpr std::wstring_view Words[] = { L"linen", L"silk", L"iron", L"bracers", L"cloak", L"of the bear", L"potion", L"elixir", L"boots", L"ring" };
+
+        std::mt19937 generator(seed);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            std::unique_ptr<AuctionsBucketData> bucket = std::make_unique<AuctionsBucketData>();
+            bucket->Key = AuctionsBucketKey(i + 1, 0, 0, 0);
+            bucket->ItemClass = uint8(generator() % MAX_ITEM_CLASS);
+            bucket->ItemSubClass = uint8(generator() % 12);
+            bucket->InventoryType = uint8(generator() % 30);
+            bucket->RequiredLevel = uint8(generator() % 70);
+            std::shared_ptr<AuctionsBucketNames> fullName = std::make_shared<AuctionsBucketNames>();
+            (*fullName)[LOCALE_enUS] = std::wstring(Words[generator() % std::size(Words)]) + L" " + std::wstring(Words[generator() % std::size(Words)]);
+            bucket->FullName = std::move(fullName);
+            Buckets.push_back(std::move(bucket));
+        }
+    }
+
+    // the filters BuildListBuckets applied to every bucket before the index existed
+    std::vector<AuctionsBucketKey> Filter(std::wstring_view name, uint8 minLevel, uint8 maxLevel, Optional<AuctionSearchClassFilters> const& classFilters,
+        bool exactMatch = false) const
+    {
+        std::vector<AuctionsBucketKey> result;
+        for (std::unique_ptr<AuctionsBucketData> const& bucket : Buckets)
+        {
+            std::wstring const& fullName = (*bucket->FullName)[LOCALE_enUS];
+            if (!name.empty() && (exactMatch ? fullName != name : fullName.find(name) == std::wstring::npos))
+                continue;
+
+            if ((minLevel && bucket->RequiredLevel < minLevel) || (maxLevel && bucket->RequiredLevel > maxLevel))
+                continue;
+
+            if (classFilters)
+            {
+                AuctionSearchClassFilters::SubclassFilter const& filter = classFilters->Classes[bucket->ItemClass];
+                if (filter.SubclassMask == AuctionSearchClassFilters::FILTER_SKIP_CLASS)
+                    continue;
+
+                if (filter.SubclassMask != AuctionSearchClassFilters::FILTER_SKIP_SUBCLASS)
+                {
+                    if (!(filter.SubclassMask & (1 << bucket->ItemSubClass)))
+                        continue;
+
+                    if (!(filter.InvTypes[bucket->ItemSubClass] & (UI64LIT(1) << bucket->InventoryType)))
+                        continue;
+                }
+            }
+
+            result.push_back(bucket->Key);
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<std::unique_ptr<AuctionsBucketData>> Buckets;
+};
+
+template<typename Index>
+std::vector<AuctionsBucketKey> Search(Index const& index, std::wstring_view name, uint8 minLevel, uint8 maxLevel,
+    Optional<AuctionSearchClassFilters> const& classFilters, bool exactMatch = false)
+{
+    std::vector<AuctionsBucketKey> result;
+    index.Search(LOCALE_enUS, name, exactMatch, minLevel, maxLevel, classFilters, result);
+    std::sort(result.begin(), result.end());
+    return result;
+}
+}
+
+TEST_CASE("Auction bucket index finds the same buckets as a full scan", "[AuctionsBucketIndex]")
+{
+    AuctionHouseBuckets auctionHouse(2000, 1234);
+    AuctionsBucketIndex index;
+    for (std::unique_ptr<AuctionsBucketData> const& bucket : auctionHouse.Buckets)
+        index.Add(bucket.get());
+
+    REQUIRE(index.GetSize() == auctionHouse.Buckets.size());
+
+    Optional<AuctionSearchClassFilters> classFilters;
+    SECTION("names and levels")
+    {
+        for (std::wstring_view name : { L"", L"s", L"silk", L"of the", L"cloak of the bear", L"nothing" })
+        {
+            REQUIRE(Search(index, name, 0, 0, classFilters) == auctionHouse.Filter(name, 0, 0, classFilters));
+            REQUIRE(Search(index, name, 10, 0, classFilters) == auctionHouse.Filter(name, 10, 0, classFilters));
+            REQUIRE(Search(index, name, 0, 30, classFilters) == auctionHouse.Filter(name, 0, 30, classFilters));
+            REQUIRE(Search(index, name, 20, 20, classFilters) == auctionHouse.Filter(name, 20, 20, classFilters));
+        }
+
+        REQUIRE(!auctionHouse.Filter(L"silk ring", 0, 0, classFilters, true).empty());
+        REQUIRE(Search(index, L"silk ring", 0, 0, classFilters, true) == auctionHouse.Filter(L"silk ring", 0, 0, classFilters, true));
+        REQUIRE(Search(index, L"silk", 0, 0, classFilters, true).empty());
+    }
+
+    SECTION("classes, subclasses and inventory types")
+    {
+        classFilters.emplace();
+        classFilters->Classes[ITEM_CLASS_CONSUMABLE].SubclassMask = AuctionSearchClassFilters::FILTER_SKIP_SUBCLASS;
+        classFilters->Classes[ITEM_CLASS_ARMOR].SubclassMask = (1 << 1) | (1 << 4);
+        classFilters->Classes[ITEM_CLASS_ARMOR].InvTypes[1] = AuctionSearchClassFilters::FILTER_SKIP_INVTYPE;
+        classFilters->Classes[ITEM_CLASS_ARMOR].InvTypes[4] = (UI64LIT(1) << INVTYPE_WRISTS) | (UI64LIT(1) << INVTYPE_FEET);
+
+        REQUIRE(!auctionHouse.Filter(L"", 0, 0, classFilters).empty());
+        REQUIRE(Search(index, L"", 0, 0, classFilters) == auctionHouse.Filter(L"", 0, 0, classFilters));
+        REQUIRE(Search(index, L"i", 5, 50, classFilters) == auctionHouse.Filter(L"i", 5, 50, classFilters));
+        REQUIRE(Search(index, L"linen", 0, 0, classFilters) == auctionHouse.Filter(L"linen", 0, 0, classFilters));
+    }
+
+    SECTION("removed buckets are not found")
+    {
+        std::vector<std::unique_ptr<AuctionsBucketData>> removed;
+        for (std::size_t i = 0; i < auctionHouse.Buckets.size(); ++i)
+        {
+            index.Remove(auctionHouse.Buckets[i].get());
+            removed.push_back(std::move(auctionHouse.Buckets[i]));
+            auctionHouse.Buckets.erase(auctionHouse.Buckets.begin() + i);
+        }
+
+        REQUIRE(index.GetSize() == auctionHouse.Buckets.size());
+
+        REQUIRE(Search(index, L"", 0, 0, classFilters) == auctionHouse.Filter(L"", 0, 0, classFilters));
+        REQUIRE(Search(index, L"boots", 15, 40, classFilters) == auctionHouse.Filter(L"boots", 15, 40, classFilters));
+    }
+
+    SECTION("snapshots keep the buckets indexed when they were taken")
+    {
+        std::shared_ptr<AuctionsBucketIndex::Snapshot const> snapshot = index.GetSnapshot();
+        REQUIRE(index.GetSnapshot() == snapshot);
+        std::vector<AuctionsBucketKey> expected = auctionHouse.Filter(L"", 0, 0, classFilters);
+
+        for (std::size_t i = 0; i < auctionHouse.Buckets.size(); i += 3)
+            index.Remove(auctionHouse.Buckets[i].get());
+
+        AuctionHouseBuckets added(100, 4321);
+        for (std::unique_ptr<AuctionsBucketData>& bucket : added.Buckets)
+        {
+            bucket->Key.ItemId += 1000000;
+            index.Add(bucket.get());
+        }
+
+        REQUIRE(Search(*snapshot, L"", 0, 0, classFilters) == expected);
+        REQUIRE(snapshot->GetSize() == auctionHouse.Buckets.size());
+
+        std::shared_ptr<AuctionsBucketIndex::Snapshot const> newSnapshot = index.GetSnapshot();
+        REQUIRE(newSnapshot != snapshot);
+        REQUIRE(newSnapshot->GetSize() == index.GetSize());
+        REQUIRE(Search(*newSnapshot, L"", 0, 0, classFilters) == Search(index, L"", 0, 0, classFilters));
+        REQUIRE(Search(*newSnapshot, L"", 0, 0, classFilters).size() == index.GetSize());
+    }
+
+    SECTION("buckets added together are found like buckets added one by one")
+    {
+        AuctionHouseBuckets added(500, 4321);
+        std::vector<AuctionsBucketData const*> newBuckets;
+        for (std::unique_ptr<AuctionsBucketData>& bucket : added.Buckets)
+        {
+            bucket->Key.ItemId += 1000000;
+            newBuckets.push_back(bucket.get());
+        }
+
+        AuctionsBucketIndex sequential;
+        for (std::unique_ptr<AuctionsBucketData> const& bucket : auctionHouse.Buckets)
+            sequential.Add(bucket.get());
+        for (AuctionsBucketData const* bucket : newBuckets)
+            sequential.Add(bucket);
+
+        index.Add(newBuckets);
+        REQUIRE(index.GetSize() == sequential.GetSize());
+
+        for (std::wstring_view name : { L"", L"silk", L"of the bear" })
+        {
+            REQUIRE(Search(index, name, 0, 0, classFilters) == Search(sequential, name, 0, 0, classFilters));
+            REQUIRE(Search(index, name, 25, 45, classFilters) == Search(sequential, name, 25, 45, classFilters));
+        }
+
+        for (std::size_t i = 0; i < newBuckets.size(); i += 2)
+        {
+            index.Remove(newBuckets[i]);
+            sequential.Remove(newBuckets[i]);
+        }
+
+        REQUIRE(Search(index, L"", 0, 0, classFilters) == Search(sequential, L"", 0, 0, classFilters));
+    }
+}
+
+TEST_CASE("Auction bucket search cost with and without the index", "[.][benchmark][AuctionsBucketIndex]")
+{
+    AuctionHouseBuckets auctionHouse(50000, 4321);
+    AuctionsBucketIndex index;
+    for (std::unique_ptr<AuctionsBucketData> const& bucket : auctionHouse.Buckets)
+        index.Add(bucket.get());
+
+    Optional<AuctionSearchClassFilters> classFilters;
+    classFilters.emplace();
+    classFilters->Classes[ITEM_CLASS_ARMOR].SubclassMask = AuctionSearchClassFilters::FILTER_SKIP_SUBCLASS;
+
+    BENCHMARK("full scan by name")
+    {
+        return auctionHouse.Filter(L"bracers", 0, 0, {}).size();
+    };
+
+    BENCHMARK("index by name")
+    {
+        return Search(index, L"bracers", 0, 0, {}).size();
+    };
+
+    BENCHMARK("full scan by class and level")
+    {
+        return auctionHouse.Filter(L"", 30, 40, classFilters).size();
+    };
+
+    BENCHMARK("index by class and level")
+    {
+        return Search(index, L"", 30, 40, classFilters).size();
+    };
+
+    // a refill of the auction house bot touches every group once instead of once per auction
+    AuctionHouseBuckets refill(1000, 1234);
+    std::vector<AuctionsBucketData const*> refillBuckets;
+    for (std::unique_ptr<AuctionsBucketData>& bucket : refill.Buckets)
+    {
+        bucket->Key.ItemId += 1000000;
+        refillBuckets.push_back(bucket.get());
+    }
+
+    BENCHMARK("post refill one by one")
+    {
+        for (AuctionsBucketData const* bucket : refillBuckets)
+            index.Add(bucket);
+        for (AuctionsBucketData const* bucket : refillBuckets)
+            index.Remove(bucket);
+        return index.GetSize();
+    };
+
+    BENCHMARK("post refill together")
+    {
+        index.Add(refillBuckets);
+        for (AuctionsBucketData const* bucket : refillBuckets)
+            index.Remove(bucket);
+        return index.GetSize();
+    };
+
+    // the changed group is copied once since the previous snapshot still uses it
+    std::shared_ptr<AuctionsBucketIndex::Snapshot const> snapshot = index.GetSnapshot();
+    BENCHMARK("snapshot after posting an auction")
+    {
+        index.Remove(auctionHouse.Buckets[0].get());
+        index.Add(auctionHouse.Buckets[0].get());
+        snapshot = index.GetSnapshot();
+        return snapshot->GetSize();
+    };
+}
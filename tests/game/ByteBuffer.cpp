@@ -0,0 +1,89 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ByteBuffer.h"
+
+TEST_CASE("Values and bits read back as written", "[ByteBuffer]")
+{
+    ByteBuffer buffer;
+    buffer << uint8(7) << uint16(0x1234) << uint32(0xDEADBEEF) << uint64(UI64LIT(0x0102030405060708)) << 1.5f;
+    buffer.WriteBit(true);
+    buffer.WriteBits(5, 3);
+    buffer.WriteBits(0x3FF, 10);
+    buffer.FlushBits();
+    buffer.WriteString(std::string_view("hello"));
+    buffer << int32(-42);
+
+    REQUIRE(buffer.read<uint8>() == 7);
+    REQUIRE(buffer.read<uint16>() == 0x1234);
+    REQUIRE(buffer.read<uint32>() == 0xDEADBEEF);
+    REQUIRE(buffer.read<uint64>() == UI64LIT(0x0102030405060708));
+    REQUIRE(buffer.read<float>() == 1.5f);
+    REQUIRE(buffer.ReadBit());
+    REQUIRE(buffer.ReadBits(3) == 5);
+    REQUIRE(buffer.ReadBits(10) == 0x3FF);
+    buffer.ResetBitPos();
+    REQUIRE(buffer.ReadString(5) == "hello");
+    REQUIRE(buffer.read<int32>() == -42);
+    REQUIRE(buffer.rpos() == buffer.wpos());
+    REQUIRE_THROWS_AS(buffer.read<uint8>(), ByteBufferPositionException);
+}
+
+TEST_CASE("ByteBuffer throughput", "[.][benchmark][ByteBuffer]")
+{
+    // roughly the field mix of a movement update: counters, positions and flag bits
+    constexpr uint32 Values = 1000;
+
+    BENCHMARK("write")
+    {
+        ByteBuffer buffer(Values * 13, ByteBuffer::Reserve{});
+        for (uint32 i = 0; i < Values; ++i)
+        {
+            buffer << uint32(i) << float(i) << float(i * 2);
+            buffer.WriteBit(i & 1);
+            buffer.WriteBits(i, 7);
+            buffer.FlushBits();
+        }
+        return buffer.wpos();
+    };
+
+    ByteBuffer written;
+    for (uint32 i = 0; i < Values; ++i)
+    {
+        written << uint32(i) << float(i) << float(i * 2);
+        written.WriteBit(i & 1);
+        written.WriteBits(i, 7);
+        written.FlushBits();
+    }
+
+    BENCHMARK("read")
+    {
+        written.rpos(0);
+        uint32 sum = 0;
+        for (uint32 i = 0; i < Values; ++i)
+        {
+            sum += written.read<uint32>();
+            sum += uint32(written.read<float>() + written.read<float>());
+            sum += written.ReadBit();
+            sum += written.ReadBits(7);
+            written.ResetBitPos();
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,92 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CharacterEnumCache.h"
+
+TEST_CASE("Character lists are kept until they expire or are invalidated", "[CharacterEnumCache]")
+{
+    CharacterEnumCache cache;
+    CharacterEnumCache::TimePoint now = std::chrono::steady_clock::now();
+    REQUIRE(!cache.IsEnabled());
+
+    SECTION("nothing is stored while disabled")
+    {
+        cache.Store(1, now, false, {}, now);
+        REQUIRE(!cache.Get(1, now));
+    }
+
+    cache.SetDuration(60s);
+    REQUIRE(cache.IsEnabled());
+
+    cache.Store(1, now, false, {}, now);
+    REQUIRE(cache.Get(1, now + 59s));
+    REQUIRE(!cache.Get(2, now));
+
+    SECTION("entries expire")
+    {
+        REQUIRE(!cache.Get(1, now + 60s));
+    }
+
+    SECTION("invalidated accounts are queried again")
+    {
+        cache.Invalidate(1, now + 1s);
+        REQUIRE(!cache.Get(1, now + 1s));
+
+        // the query was already running when the account was invalidated
+        cache.Store(1, now, false, {}, now + 2s);
+        REQUIRE(!cache.Get(1, now + 2s));
+
+        cache.Store(1, now + 2s, false, {}, now + 2s);
+        REQUIRE(cache.Get(1, now + 2s));
+    }
+
+    SECTION("queries started behind other writes wait for the invalidating writes to settle")
+    {
+        cache.Invalidate(1, now + 1s);
+        cache.Store(1, now + 2s, true, {}, now + 2s);
+        REQUIRE(!cache.Get(1, now + 2s));
+
+        cache.Store(1, now + 40s, true, {}, now + 40s);
+        REQUIRE(cache.Get(1, now + 40s));
+    }
+
+    SECTION("disabling drops everything")
+    {
+        cache.SetDuration(0s);
+        REQUIRE(cache.GetSize() == 0);
+    }
+}
+
+TEST_CASE("Expired character lists are removed as the cache grows", "[CharacterEnumCache]")
+{
+    CharacterEnumCache cache;
+    cache.SetDuration(60s);
+    CharacterEnumCache::TimePoint now = std::chrono::steady_clock::now();
+
+    for (uint32 accountId = 0; accountId < 1000; ++accountId)
+        cache.Store(accountId, now, false, {}, now);
+
+    REQUIRE(cache.GetSize() == 1000);
+
+    for (uint32 accountId = 1000; accountId < 2000; ++accountId)
+        cache.Store(accountId, now + 120s, false, {}, now + 120s);
+
+    REQUIRE(cache.GetSize() < 2000);
+    REQUIRE(cache.Get(1999, now + 120s));
+}
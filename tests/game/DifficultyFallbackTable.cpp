@@ -0,0 +1,166 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "DifficultyFallbackTable.h"
+#include <boost/multi_index/composite_key.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index_container.hpp>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace
+{
+// mythic -> heroic -> normal -> none, like the raid difficulties of Difficulty.db2
+Optional<Difficulty> GetRaidFallback(Difficulty difficulty)
+{
+    switch (difficulty)
+    {
+        case DIFFICULTY_MYTHIC_RAID: return DIFFICULTY_HEROIC_RAID;
+        case DIFFICULTY_HEROIC_RAID: return DIFFICULTY_NORMAL_RAID;
+        case DIFFICULTY_NORMAL_RAID: return DIFFICULTY_NONE;
+        case DIFFICULTY_LFR_NEW: return DIFFICULTY_NORMAL_RAID;
+        default: return {};
+    }
+}
+
+struct Value
+{
+    uint32 Id;
+    ::Difficulty Difficulty;
+};
+}
+
+TEST_CASE("DifficultyFallbackTable resolves difficulty fallbacks", "[DifficultyFallbackTable]")
+{
+    std::vector<Value> storage = { { 1, DIFFICULTY_NONE }, { 2, DIFFICULTY_NONE }, { 2, DIFFICULTY_HEROIC_RAID }, { 5, DIFFICULTY_NORMAL_RAID } };
+    std::vector<std::tuple<uint32, Difficulty, Value const*>> values;
+    for (Value const& value : storage)
+        values.emplace_back(value.Id, value.Difficulty, &value);
+
+    DifficultyFallbackTable<Value> table;
+    REQUIRE(table.IsEmpty());
+    table.Build(values, GetRaidFallback);
+    REQUIRE_FALSE(table.IsEmpty());
+
+    SECTION("Exact difficulties")
+    {
+        REQUIRE(table.Find(1, DIFFICULTY_NONE) == &storage[0]);
+        REQUIRE(table.Find(2, DIFFICULTY_HEROIC_RAID) == &storage[2]);
+        REQUIRE(table.Find(5, DIFFICULTY_NORMAL_RAID) == &storage[3]);
+    }
+
+    SECTION("Fallback chains")
+    {
+        REQUIRE(table.Find(1, DIFFICULTY_MYTHIC_RAID) == &storage[0]);
+        REQUIRE(table.Find(2, DIFFICULTY_MYTHIC_RAID) == &storage[2]);
+        REQUIRE(table.Find(2, DIFFICULTY_NORMAL_RAID) == &storage[1]);
+        REQUIRE(table.Find(2, DIFFICULTY_LFR_NEW) == &storage[1]);
+        REQUIRE(table.Find(5, DIFFICULTY_MYTHIC_RAID) == &storage[3]);
+    }
+
+    SECTION("Difficulties outside of any chain")
+    {
+        REQUIRE(table.Find(1, DIFFICULTY_MYTHIC) == nullptr);
+        REQUIRE(table.Find(5, DIFFICULTY_NONE) == nullptr);
+    }
+
+    SECTION("Ids without values")
+    {
+        REQUIRE(table.Find(0, DIFFICULTY_NONE) == nullptr);
+        REQUIRE(table.Find(3, DIFFICULTY_MYTHIC_RAID) == nullptr);
+        REQUIRE(table.Find(6, DIFFICULTY_NONE) == nullptr);
+    }
+
+    SECTION("Looping chains end")
+    {
+        table.Build(values, [](Difficulty /*difficulty*/) -> Optional<Difficulty> { return DIFFICULTY_MYTHIC; });
+        REQUIRE(table.Find(1, DIFFICULTY_HEROIC_RAID) == nullptr);
+        REQUIRE(table.Find(2, DIFFICULTY_HEROIC_RAID) == &storage[2]);
+    }
+}
+
+// Run explicitly with "[!benchmark]"
+TEST_CASE("DifficultyFallbackTable benchmark", "[.][!benchmark][DifficultyFallbackTable]")
+{
+    // spell lookups of a mythic raid encounter: most spells only have a DIFFICULTY_NONE entry,
+    // boss abilities have entries for some raid difficulties
+    constexpr uint32 SpellCount = 400000;
+    constexpr uint32 LookupCount = 20000000;
+
+    std::mt19937 random(42);
+    std::vector<Value> storage;
+    for (uint32 id = 1; id < SpellCount; id += 1 + random() % 2)
+    {
+        storage.push_back({ id, DIFFICULTY_NONE });
+        if (random() % 20 == 0)
+            storage.push_back({ id, DIFFICULTY_HEROIC_RAID });
+    }
+
+    struct IdDifficultyIndex;
+    boost::multi_index::multi_index_container<
+        Value,
+        boost::multi_index::indexed_by<
+            boost::multi_index::hashed_unique<
+                boost::multi_index::tag<IdDifficultyIndex>,
+                boost::multi_index::composite_key<
+                    Value,
+                    boost::multi_index::member<Value, uint32, &Value::Id>,
+                    boost::multi_index::member<Value, Difficulty, &Value::Difficulty>
+                >
+            >
+        >
+    > map(storage.begin(), storage.end());
+
+    std::vector<std::tuple<uint32, Difficulty, Value const*>> values;
+    for (Value const& value : storage)
+        values.emplace_back(value.Id, value.Difficulty, &value);
+
+    DifficultyFallbackTable<Value> table;
+    table.Build(values, GetRaidFallback);
+
+    // a few hundred spells cast over and over by players and the encounter
+    std::vector<uint32> trace(LookupCount);
+    std::vector<uint32> hotSpells(500);
+    for (uint32& spell : hotSpells)
+        spell = storage[random() % storage.size()].Id;
+    for (uint32& spell : trace)
+        spell = random() % 10 ? hotSpells[random() % hotSpells.size()] : storage[random() % storage.size()].Id;
+
+    auto start = std::chrono::steady_clock::now();
+    uint64 tableHits = 0;
+    for (uint32 spell : trace)
+        tableHits += table.Find(spell, DIFFICULTY_MYTHIC_RAID) != nullptr;
+    std::chrono::duration<double, std::milli> tableTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    uint64 mapHits = 0;
+    for (uint32 spell : trace)
+    {
+        auto itr = map.find(boost::make_tuple(spell, DIFFICULTY_MYTHIC_RAID));
+        for (Optional<Difficulty> fallback = GetRaidFallback(DIFFICULTY_MYTHIC_RAID); itr == map.end() && fallback; fallback = GetRaidFallback(*fallback))
+            itr = map.find(boost::make_tuple(spell, *fallback));
+        mapHits += itr != map.end();
+    }
+    std::chrono::duration<double, std::milli> mapTime = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(tableHits == mapHits);
+    std::cout << "fallback table: " << tableTime.count() << " ms, multi_index with fallback walk: " << mapTime.count() << " ms" << std::endl;
+}
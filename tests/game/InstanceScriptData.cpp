@@ -0,0 +1,105 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "InstanceScriptData.h"
+
+namespace
+{
+InstanceScriptSaveData MakeSaveData()
+{
+    InstanceScriptSaveData data;
+    data.Header = "ICC";
+    data.BossStates = { 3, 0, 3, 0 };
+    data.AdditionalData.emplace_back("TeamInInstance", int64(67));
+    data.AdditionalData.emplace_back("Ratio", 0.5);
+    data.AdditionalData.emplace_back("Unset", std::monostate());
+    return data;
+}
+}
+
+TEST_CASE("InstanceScriptSaveData round trips", "[InstanceScriptData]")
+{
+    InstanceScriptSaveData data = MakeSaveData();
+
+    SECTION("Binary")
+    {
+        std::string binary = data.ToBinary();
+        REQUIRE(InstanceScriptSaveData::IsBinary(binary));
+
+        InstanceScriptSaveData loaded;
+        REQUIRE(loaded.FromBinary(binary));
+        REQUIRE(loaded == data);
+        REQUIRE(binary.size() < data.ToJson().size());
+    }
+
+    SECTION("JSON")
+    {
+        std::string json = data.ToJson();
+        REQUIRE_FALSE(InstanceScriptSaveData::IsBinary(json));
+
+        InstanceScriptSaveData loaded;
+        REQUIRE(loaded.FromJson(json));
+        REQUIRE(loaded == data);
+    }
+}
+
+TEST_CASE("InstanceScriptSaveData reads JSON saved by older revisions", "[InstanceScriptData]")
+{
+    InstanceScriptSaveData loaded;
+    REQUIRE(loaded.FromJson(R"({"Header":"ICC","BossStates":[3,0,3,0],"AdditionalData":{"TeamInInstance":67,"Ratio":0.5,"Unset":null}})"));
+    REQUIRE(loaded == MakeSaveData());
+}
+
+TEST_CASE("InstanceScriptSaveData rejects malformed binary data", "[InstanceScriptData]")
+{
+    std::string binary = MakeSaveData().ToBinary();
+    InstanceScriptSaveData loaded;
+
+    SECTION("Truncated")
+    {
+        REQUIRE_FALSE(loaded.FromBinary(binary.substr(0, binary.size() - 4)));
+    }
+
+    SECTION("Not base64")
+    {
+        REQUIRE_FALSE(loaded.FromBinary("#not base64!"));
+    }
+
+    SECTION("Unknown version")
+    {
+        InstanceScriptSaveData data;
+        std::string empty = data.ToBinary();
+        REQUIRE(loaded.FromBinary(empty));
+        REQUIRE(empty.substr(1, 2) == "AQ");    // version 1 is the first byte
+        REQUIRE_FALSE(loaded.FromBinary("#Ag" + empty.substr(3)));
+    }
+}
+
+TEST_CASE("InstanceScriptSaveData updates single values", "[InstanceScriptData]")
+{
+    InstanceScriptSaveData data = MakeSaveData();
+    data.SetBossState(1, 3);
+    data.SetBossState(5, 3);
+    data.SetValue("Ratio", 1.5);
+    data.SetValue("New", int64(2));
+
+    REQUIRE(data.BossStates == std::vector<uint8>{ 3, 3, 3, 0, 0, 3 });
+    REQUIRE(data.AdditionalData[1].second == InstanceScriptSaveData::Value(1.5));
+    REQUIRE(data.AdditionalData.back() == std::pair<std::string, InstanceScriptSaveData::Value>("New", int64(2)));
+}
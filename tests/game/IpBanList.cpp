@@ -0,0 +1,61 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "tc_catch2.h"
+
+#include "IpAddress.h"
+#include "IpBanList.h"
+
+TEST_CASE("Ip ban list", "[IpBanList]")
+{
+    time_t constexpr now = 1700000000;
+    sIpBanList->Load({ { "10.0.0.1", 0 }, { "10.0.0.2", now + 60 }, { "10.0.0.3", now - 60 }, { "2001:db8::1", 0 } });
+    REQUIRE(sIpBanList->IsEnabled());
+
+    SECTION("permanent and running bans")
+    {
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.1"), now) == true);
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.2"), now) == true);
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("2001:db8::1"), now) == true);
+    }
+
+    SECTION("expired and unknown addresses")
+    {
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.2"), now + 60) == false);
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.3"), now) == false);
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.4"), now) == false);
+    }
+
+    SECTION("changes apply immediately and survive the next reload")
+    {
+        sIpBanList->AddBan("10.0.0.4", 0);
+        sIpBanList->RemoveBan("10.0.0.1");
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.4"), now) == true);
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.1"), now) == false);
+
+        // reload racing the database writes
+        sIpBanList->Load({ { "10.0.0.1", 0 } });
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.4"), now) == true);
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.1"), now) == false);
+
+        // the one after that trusts the database
+        sIpBanList->Load({ { "10.0.0.1", 0 } });
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.4"), now) == false);
+        REQUIRE(sIpBanList->IsBanned(Trinity::Net::make_address("10.0.0.1"), now) == true);
+    }
+}
@@ -0,0 +1,251 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "LFGMatchmaker.h"
+#include <random>
+
+using namespace lfg;
+
+namespace
+{
+// Players and groups queued in one queue, as LFGQueue adds them to the matchmaker (explicit realm, no realm list in tests)
+struct Queue
+{
+    LfgMatchmaker::QueueId Join(uint8 roles, LfgDungeonSet const& dungeons, bool isLfgGroup = false)
+    {
+        ObjectGuid guid = ObjectGuidFactory::CreatePlayer(1, ++LastGuid);
+        LfgMatchmaker::QueueId id = Matchmaker.Add(guid, { { guid, roles } }, dungeons, isLfgGroup);
+        return id;
+    }
+
+    LfgMatchmaker::QueueId JoinGroup(std::vector<uint8> const& roles, LfgDungeonSet const& dungeons, bool isLfgGroup = false)
+    {
+        LfgRolesMap members;
+        for (uint8 memberRoles : roles)
+            members[ObjectGuidFactory::CreatePlayer(1, ++LastGuid)] = memberRoles;
+
+        return Matchmaker.Add(ObjectGuid::Create<HighGuid::Party>(++LastGuid), members, dungeons, isLfgGroup);
+    }
+
+    // same as LFGQueue::FindGroups, the group leaves the waiting list when it is accepted
+    bool Find(LfgMatchmaker::QueueId id, std::function<bool(std::span<LfgMatchmaker::QueueId const>)> accept = nullptr)
+    {
+        bool found = Matchmaker.FindGroup(id, [&](std::span<LfgMatchmaker::QueueId const> group)
+        {
+            if (accept && !accept(group))
+                return false;
+
+            LastGroup.assign(group.begin(), group.end());
+            for (LfgMatchmaker::QueueId member : group)
+                Matchmaker.RemoveFromWaiting(member);
+            return true;
+        });
+
+        if (!found)
+            Matchmaker.AddToWaiting(id);
+        return found;
+    }
+
+    LfgMatchmaker Matchmaker;
+    std::vector<LfgMatchmaker::QueueId> LastGroup;
+    uint64 LastGuid = 0;
+};
+
+constexpr uint8 Tank = PLAYER_ROLE_TANK;
+constexpr uint8 Healer = PLAYER_ROLE_HEALER;
+constexpr uint8 Dps = PLAYER_ROLE_DAMAGE;
+}
+
+TEST_CASE("Role states", "[LfgMatchmaker]")
+{
+    auto combine = [](std::initializer_list<uint8> roles)
+    {
+        LfgMatchmaker::RoleStates states = LfgMatchmaker::NoPlayersRoleStates;
+        for (uint8 playerRoles : roles)
+            states = LfgMatchmaker::CombineRoleStates(states, LfgMatchmaker::GetRoleStates(playerRoles));
+        return states;
+    };
+
+    REQUIRE(combine({ Tank, Healer, Dps, Dps, Dps }) != 0);
+    REQUIRE(combine({ Tank | Healer, Tank, Dps, Dps, Dps }) != 0);
+    REQUIRE(combine({ Tank | Healer | Dps, Tank | Dps, Healer | Dps, Dps, Dps }) != 0);
+    REQUIRE(combine({ Tank, Tank }) == 0);
+    REQUIRE(combine({ Dps, Dps, Dps, Dps }) == 0);
+    REQUIRE(combine({ Tank | Healer, Tank, Healer }) == 0);
+    REQUIRE(combine({ PLAYER_ROLE_LEADER }) == 0);
+
+    // two halves of a group fit together exactly when all of its players do
+    REQUIRE(LfgMatchmaker::CombineRoleStates(combine({ Tank | Dps, Dps }), combine({ Healer | Tank, Tank })) == combine({ Tank | Dps, Dps, Healer | Tank, Tank }));
+    REQUIRE(LfgMatchmaker::CombineRoleStates(combine({ Dps, Dps }), combine({ Dps, Dps })) == 0);
+}
+
+TEST_CASE("Matchmaker forms full groups", "[LfgMatchmaker]")
+{
+    Queue queue;
+    LfgDungeonSet dungeons = { 1, 2, 3 };
+
+    SECTION("a group forms when its last role is found")
+    {
+        LfgMatchmaker::QueueId dps1 = queue.Join(Dps, dungeons);
+        LfgMatchmaker::QueueId dps2 = queue.Join(Dps, dungeons);
+        LfgMatchmaker::QueueId dps3 = queue.Join(Dps, dungeons);
+        LfgMatchmaker::QueueId dps4 = queue.Join(Dps, dungeons);
+        LfgMatchmaker::QueueId tank = queue.Join(Tank, dungeons);
+        for (LfgMatchmaker::QueueId id : { dps1, dps2, dps3, dps4, tank })
+            REQUIRE(!queue.Find(id));
+
+        uint8 tanks, healers, dps;
+        queue.Matchmaker.GetNeededRoles(tank, tanks, healers, dps);
+        REQUIRE(tanks == 0);
+        REQUIRE(healers == 1);
+        REQUIRE(dps == 0);
+
+        LfgMatchmaker::QueueId healer = queue.Join(Healer, dungeons);
+        REQUIRE(queue.Find(healer));
+        REQUIRE(queue.LastGroup == std::vector<LfgMatchmaker::QueueId>{ healer, tank, dps1, dps2, dps3 });
+        REQUIRE(queue.Matchmaker.GetWaitingCount() == 1);
+        REQUIRE(queue.Matchmaker.GetWaiting()[0] == dps4);
+    }
+
+    SECTION("groups only form for a dungeon all of them selected")
+    {
+        LfgMatchmaker::QueueId tank = queue.Join(Tank, { 1 });
+        LfgMatchmaker::QueueId healer = queue.Join(Healer, { 2 });
+        queue.Find(tank);
+        queue.Find(healer);
+        queue.Find(queue.Join(Dps, { 1, 2 }));
+        queue.Find(queue.Join(Dps, { 1, 2 }));
+        REQUIRE(!queue.Find(queue.Join(Dps, { 1, 2 })));
+
+        REQUIRE(queue.Find(queue.Join(Healer, { 1, 3 })));
+        REQUIRE(std::ranges::find(queue.LastGroup, tank) != queue.LastGroup.end());
+        REQUIRE(std::ranges::find(queue.LastGroup, healer) == queue.LastGroup.end());
+    }
+
+    SECTION("queued groups are combined with players")
+    {
+        queue.Find(queue.Join(Tank, dungeons));
+        queue.Find(queue.JoinGroup({ Dps, Dps, Dps }, dungeons));
+        REQUIRE(!queue.Find(queue.JoinGroup({ Healer, Dps }, dungeons)));
+        REQUIRE(queue.Find(queue.Join(Healer, dungeons)));
+        REQUIRE(queue.LastGroup.size() == 3);
+
+        // full groups need nobody else
+        REQUIRE(queue.Find(queue.JoinGroup({ Tank, Healer, Dps, Dps, Dps }, dungeons)));
+        REQUIRE(queue.LastGroup.size() == 1);
+    }
+
+    SECTION("two lfg groups are never combined")
+    {
+        queue.Find(queue.JoinGroup({ Tank, Healer, Dps }, dungeons, true));
+        REQUIRE(!queue.Find(queue.JoinGroup({ Dps, Dps }, dungeons, true)));
+        REQUIRE(queue.Find(queue.JoinGroup({ Dps, Dps }, dungeons)));
+    }
+
+    SECTION("rejected groups don't stop the search")
+    {
+        LfgMatchmaker::QueueId tank1 = queue.Join(Tank, dungeons);
+        LfgMatchmaker::QueueId tank2 = queue.Join(Tank, dungeons);
+        for (LfgMatchmaker::QueueId id : { tank1, tank2, queue.Join(Healer, dungeons), queue.Join(Dps, dungeons), queue.Join(Dps, dungeons) })
+            queue.Find(id);
+
+        // the first tank ignores the new player
+        REQUIRE(queue.Find(queue.Join(Dps, dungeons), [&](std::span<LfgMatchmaker::QueueId const> group)
+        {
+            return std::ranges::find(group, tank1) == group.end();
+        }));
+        REQUIRE(std::ranges::find(queue.LastGroup, tank2) != queue.LastGroup.end());
+    }
+
+    SECTION("best groups are forgotten when one of their members leaves")
+    {
+        LfgMatchmaker::QueueId tank = queue.Join(Tank, dungeons);
+        LfgMatchmaker::QueueId healer = queue.Join(Healer, dungeons);
+        queue.Find(tank);
+        queue.Find(healer);
+        REQUIRE(queue.Matchmaker.GetBestGroup(tank) == std::vector<LfgMatchmaker::QueueId>{ healer, tank });
+
+        queue.Matchmaker.Remove(healer);
+        REQUIRE(queue.Matchmaker.GetBestGroup(tank).size() == 1);
+
+        uint8 tanks, healers, dps;
+        queue.Matchmaker.GetNeededRoles(tank, tanks, healers, dps);
+        REQUIRE(tanks == 0);
+        REQUIRE(healers == 1);
+        REQUIRE(dps == 3);
+
+        // ids are reused
+        REQUIRE(queue.Join(Healer, dungeons) == healer);
+        REQUIRE(queue.Matchmaker.GetWaitingCount() == 1);
+    }
+}
+
+TEST_CASE("Matchmaker cost with thousands queued", "[.][benchmark][LfgMatchmaker]")
+{
+    // a peak hour queue, mostly dps waiting for random dungeons of one expansion
+    Queue queue;
+    std::mt19937 generator(1234);
+    auto randomDungeons = [&]()
+    {
+        LfgDungeonSet dungeons;
+        for (uint32 i = 0; i < 8; ++i)
+            dungeons.insert(generator() % 40);
+        return dungeons;
+    };
+
+    for (uint32 i = 0; i < 3000; ++i)
+    {
+        uint32 roll = generator() % 100;
+        queue.Find(queue.Join(roll < 4 ? Tank : roll < 8 ? Healer : Dps, randomDungeons()));
+    }
+
+    WARN(queue.Matchmaker.GetWaitingCount() << " waiting");
+
+    // the proposal fails, the others go back to the front like LFGMgr::RemoveProposal puts them
+    auto join = [&](uint8 roles)
+    {
+        LfgMatchmaker::QueueId id = queue.Join(roles, randomDungeons());
+        bool found = queue.Find(id);
+        if (found)
+            for (auto member = queue.LastGroup.rbegin(); member != queue.LastGroup.rend(); ++member)
+                if (*member != id)
+                    queue.Matchmaker.AddToWaiting(*member, true);
+
+        queue.Matchmaker.Remove(id);
+        return found;
+    };
+
+    BENCHMARK("dps joins")
+    {
+        return join(Dps);
+    };
+
+    BENCHMARK("tank joins")
+    {
+        return join(Tank);
+    };
+
+    BENCHMARK("nobody fits")
+    {
+        LfgMatchmaker::QueueId id = queue.Join(Tank, randomDungeons());
+        bool found = queue.Matchmaker.FindGroup(id, [](std::span<LfgMatchmaker::QueueId const>) { return false; });
+        queue.Matchmaker.Remove(id);
+        return found;
+    };
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "LineOfSightCache.h"
+#include "PhaseShift.h"
+
+TEST_CASE("LineOfSightCache reuses results of nearby rays", "[LineOfSightCache]")
+{
+    LineOfSightCache cache(100, 1.0f);
+    PhaseShift phaseShift;
+    int staticCasts = 0, dynamicCasts = 0;
+    auto staticCheck = [&] { ++staticCasts; return true; };
+    auto dynamicCheck = [&] { ++dynamicCasts; return false; };
+
+    REQUIRE(!cache.IsInLineOfSight(cache.MakeKey(phaseShift, 0, 0, 0.1f, 0.1f, 0.1f, 10.1f, 0.1f, 0.1f), true, true, staticCheck, dynamicCheck));
+
+    SECTION("endpoints within the tolerance hit")
+    {
+        REQUIRE(!cache.IsInLineOfSight(cache.MakeKey(phaseShift, 0, 0, 0.9f, 0.5f, 0.2f, 10.8f, 0.3f, 0.9f), true, true, staticCheck, dynamicCheck));
+        REQUIRE(staticCasts == 1);
+        REQUIRE(dynamicCasts == 1);
+
+        LineOfSightCache::Stats stats = cache.TakeStats();
+        REQUIRE(stats.Hits == 1);
+        REQUIRE(stats.Misses == 1);
+    }
+
+    SECTION("moved endpoints and other terrain miss")
+    {
+        cache.IsInLineOfSight(cache.MakeKey(phaseShift, 0, 0, 1.1f, 0.1f, 0.1f, 10.1f, 0.1f, 0.1f), true, true, staticCheck, dynamicCheck);
+        cache.IsInLineOfSight(cache.MakeKey(phaseShift, 1, 0, 0.1f, 0.1f, 0.1f, 10.1f, 0.1f, 0.1f), true, true, staticCheck, dynamicCheck);
+        REQUIRE(staticCasts == 3);
+    }
+
+    SECTION("dynamic tree changes only drop the dynamic part")
+    {
+        cache.InvalidateDynamic();
+        cache.IsInLineOfSight(cache.MakeKey(phaseShift, 0, 0, 0.1f, 0.1f, 0.1f, 10.1f, 0.1f, 0.1f), true, true, staticCheck, dynamicCheck);
+        REQUIRE(staticCasts == 1);
+        REQUIRE(dynamicCasts == 2);
+    }
+
+    SECTION("entries expire after two durations")
+    {
+        cache.Update(100);
+        cache.IsInLineOfSight(cache.MakeKey(phaseShift, 0, 0, 0.1f, 0.1f, 0.1f, 10.1f, 0.1f, 0.1f), true, false, staticCheck, dynamicCheck);
+        REQUIRE(staticCasts == 1);
+
+        cache.Update(100);
+        cache.Update(100);
+        cache.IsInLineOfSight(cache.MakeKey(phaseShift, 0, 0, 0.1f, 0.1f, 0.1f, 10.1f, 0.1f, 0.1f), true, false, staticCheck, dynamicCheck);
+        REQUIRE(staticCasts == 2);
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "GridDefines.h"
+#include "MapIslandPartitioner.h"
+#include <algorithm>
+
+namespace
+{
+constexpr uint32 MakeCellId(uint32 x, uint32 y) { return y * TOTAL_NUMBER_OF_CELLS_PER_MAP + x; }
+
+std::size_t IslandOf(std::vector<std::vector<uint32>> const& islands, uint32 cellId)
+{
+    for (std::size_t i = 0; i < islands.size(); ++i)
+        if (std::find(islands[i].begin(), islands[i].end(), cellId) != islands[i].end())
+            return i;
+
+    return islands.size();
+}
+}
+
+TEST_CASE("PartitionCellsIntoIslands", "[MapIslandPartitioner]")
+{
+    SECTION("No cells")
+    {
+        REQUIRE(Trinity::PartitionCellsIntoIslands({}, 3).empty());
+    }
+
+    SECTION("Close cells share an island")
+    {
+        std::vector<uint32> cells = { MakeCellId(10, 10), MakeCellId(11, 10), MakeCellId(13, 12) };
+        auto islands = Trinity::PartitionCellsIntoIslands(cells, 2);
+        REQUIRE(islands.size() == 1);
+        REQUIRE(islands[0].size() == 3);
+    }
+
+    SECTION("Far cells are split")
+    {
+        std::vector<uint32> cells = { MakeCellId(10, 10), MakeCellId(11, 11), MakeCellId(40, 10), MakeCellId(10, 40) };
+        auto islands = Trinity::PartitionCellsIntoIslands(cells, 3);
+        REQUIRE(islands.size() == 3);
+        REQUIRE(IslandOf(islands, MakeCellId(10, 10)) == IslandOf(islands, MakeCellId(11, 11)));
+        REQUIRE(IslandOf(islands, MakeCellId(10, 10)) != IslandOf(islands, MakeCellId(40, 10)));
+        REQUIRE(IslandOf(islands, MakeCellId(40, 10)) != IslandOf(islands, MakeCellId(10, 40)));
+    }
+
+    SECTION("Islands connect transitively")
+    {
+        std::vector<uint32> cells;
+        for (uint32 x = 0; x < 30; x += 3)
+            cells.push_back(MakeCellId(x, 5));
+
+        auto islands = Trinity::PartitionCellsIntoIslands(cells, 3);
+        REQUIRE(islands.size() == 1);
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MapMoveList.h"
+
+TEST_CASE("MapMoveList merges slots in slot order", "[MapMoveList]")
+{
+    int objects[5] = { };
+    Trinity::MapMoveList<int> moveList;
+
+    SECTION("single slot keeps append order")
+    {
+        moveList.Append(0, &objects[1]);
+        moveList.Append(0, &objects[0]);
+
+        REQUIRE(moveList.Merge() == std::vector<int*>{ &objects[1], &objects[0] });
+    }
+
+    SECTION("merge order does not depend on append interleaving")
+    {
+        moveList.SetSlotCount(3);
+        moveList.Append(2, &objects[4]);
+        moveList.Append(1, &objects[2]);
+        moveList.Append(0, &objects[0]);
+        moveList.Append(2, &objects[3]);
+        moveList.Append(0, &objects[1]);
+
+        REQUIRE(moveList.Merge() == std::vector<int*>{ &objects[0], &objects[1], &objects[2], &objects[4], &objects[3] });
+    }
+
+    SECTION("clear empties every slot")
+    {
+        moveList.SetSlotCount(2);
+        moveList.Append(1, &objects[0]);
+        moveList.Clear();
+
+        REQUIRE(moveList.Merge().empty());
+    }
+}
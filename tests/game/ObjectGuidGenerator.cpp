@@ -0,0 +1,83 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ObjectGuidSequenceGenerator.h"
+#include <algorithm>
+#include <thread>
+
+TEST_CASE("Values without blocks are sequential", "[ObjectGuidGenerator]")
+{
+    ObjectGuidGenerator generator(HighGuid::Item, 10);
+    REQUIRE(generator.Generate() == 10);
+    REQUIRE(generator.Generate() == 11);
+    REQUIRE(generator.GetNextAfterMaxUsed() == 12);
+}
+
+TEST_CASE("Blocks are reserved per thread", "[ObjectGuidGenerator]")
+{
+    ObjectGuidGenerator generator(HighGuid::Item, 1, 100);
+
+    SECTION("a thread continues its block")
+    {
+        REQUIRE(generator.Generate() == 1);
+        REQUIRE(generator.Generate() == 2);
+        REQUIRE(generator.GetNextAfterMaxUsed() == 101);
+    }
+
+    SECTION("Set discards the reserved blocks")
+    {
+        generator.Generate();
+        generator.Set(500);
+        REQUIRE(generator.Generate() == 500);
+        REQUIRE(generator.GetNextAfterMaxUsed() == 600);
+    }
+
+    SECTION("generators do not share blocks")
+    {
+        ObjectGuidGenerator other(HighGuid::Item, 1000, 100);
+        REQUIRE(generator.Generate() == 1);
+        REQUIRE(other.Generate() == 1000);
+        REQUIRE(generator.Generate() == 2);
+    }
+
+    SECTION("values of all threads are unique")
+    {
+        std::vector<std::vector<ObjectGuid::LowType>> values(4);
+        std::vector<std::thread> threads;
+        for (std::vector<ObjectGuid::LowType>& threadValues : values)
+        {
+            threads.emplace_back([&]
+            {
+                for (uint32 i = 0; i < 1000; ++i)
+                    threadValues.push_back(generator.Generate());
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        std::vector<ObjectGuid::LowType> all;
+        for (std::vector<ObjectGuid::LowType> const& threadValues : values)
+            all.insert(all.end(), threadValues.begin(), threadValues.end());
+
+        std::ranges::sort(all);
+        REQUIRE(std::ranges::adjacent_find(all) == all.end());
+        REQUIRE(all.size() == 4000);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "PacketCompressor.h"
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <zlib.h>
+
+namespace
+{
+// roughly shaped like update object data: runs of small integers and repeated guids mixed with noise
+std::vector<uint8> MakePacketData(std::size_t size, uint32 seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<uint8> data(size);
+    for (std::size_t i = 0; i < size; ++i)
+        data[i] = (i % 16) < 10 ? uint8(i / 64) : uint8(rng() % 8);
+    return data;
+}
+
+struct Inflater
+{
+    Inflater()
+    {
+        stream.zalloc = nullptr;
+        stream.zfree = nullptr;
+        stream.opaque = nullptr;
+        inflateInit2(&stream, -15);
+    }
+
+    ~Inflater() { inflateEnd(&stream); }
+
+    std::vector<uint8> Inflate(uint8* data, uint32 size, std::size_t uncompressedSize)
+    {
+        std::vector<uint8> result(uncompressedSize);
+        stream.next_in = data;
+        stream.avail_in = size;
+        stream.next_out = result.data();
+        stream.avail_out = uint32(result.size());
+        inflate(&stream, Z_SYNC_FLUSH);
+        result.resize(result.size() - stream.avail_out);
+        return result;
+    }
+
+    z_stream stream = { };
+};
+
+std::vector<uint8> WithOpcode(uint32 opcode, std::vector<uint8> const& data)
+{
+    std::vector<uint8> result(sizeof(opcode) + data.size());
+    memcpy(result.data(), &opcode, sizeof(opcode));
+    memcpy(result.data() + sizeof(opcode), data.data(), data.size());
+    return result;
+}
+}
+
+TEST_CASE("PacketCompressor", "[PacketCompressor]")
+{
+    PacketCompressor::ClearPool();
+
+    SECTION("Packets form one continuous stream")
+    {
+        PacketCompressor compressor;
+        REQUIRE(compressor.Initialize(1, 8, 4));
+
+        Inflater inflater;
+        for (uint32 i = 0; i < 8; ++i)
+        {
+            std::vector<uint8> data = MakePacketData(2000 + i * 500, i);
+            std::vector<uint8> buffer(compressor.GetMaxCompressedSize(uint32(data.size() + 4)));
+            uint32 compressedSize = compressor.Compress(buffer.data(), 0x1000 + i, data.data(), data.size());
+            REQUIRE(compressedSize > 0);
+            REQUIRE(inflater.Inflate(buffer.data(), compressedSize, data.size() + 4) == WithOpcode(0x1000 + i, data));
+        }
+    }
+
+    SECTION("Reused streams start from a clean state")
+    {
+        std::vector<uint8> data = MakePacketData(4000, 42);
+        {
+            PacketCompressor compressor;
+            REQUIRE(compressor.Initialize(1, 8, 4));
+            std::vector<uint8> buffer(compressor.GetMaxCompressedSize(uint32(data.size() + 4)));
+            REQUIRE(compressor.Compress(buffer.data(), 1, data.data(), data.size()) > 0);
+        }
+
+        PacketCompressor compressor;
+        REQUIRE(compressor.Initialize(1, 8, 4));
+        Inflater inflater;
+        std::vector<uint8> buffer(compressor.GetMaxCompressedSize(uint32(data.size() + 4)));
+        uint32 compressedSize = compressor.Compress(buffer.data(), 2, data.data(), data.size());
+        REQUIRE(inflater.Inflate(buffer.data(), compressedSize, data.size() + 4) == WithOpcode(2, data));
+    }
+
+    PacketCompressor::ClearPool();
+}
+
+// Run explicitly with "[!benchmark]" to print CPU time per MB of packet data for every compression level
+TEST_CASE("PacketCompressor benchmark", "[.][!benchmark][PacketCompressor]")
+{
+    std::vector<std::vector<uint8>> packets;
+    std::size_t totalSize = 0;
+    for (uint32 i = 0; totalSize < 16 * 1024 * 1024; ++i)
+    {
+        packets.push_back(MakePacketData(1024 + (i * 7919) % 32768, i));
+        totalSize += packets.back().size() + 4;
+    }
+
+    for (int32 level = Z_BEST_SPEED; level <= Z_BEST_COMPRESSION; ++level)
+    {
+        PacketCompressor compressor;
+        REQUIRE(compressor.Initialize(level, 8, 0));
+
+        std::vector<uint8> buffer;
+        std::size_t compressedTotal = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::vector<uint8> const& packet : packets)
+        {
+            buffer.resize(compressor.GetMaxCompressedSize(uint32(packet.size() + 4)));
+            compressedTotal += compressor.Compress(buffer.data(), 1, packet.data(), packet.size());
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "level " << level << ": " << elapsed.count() / (double(totalSize) / (1024 * 1024)) << " ms/MB, ratio "
+            << double(compressedTotal) / double(totalSize) << std::endl;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "tc_catch2.h"
+
+#include "PacketRateLimiter.h"
+
+using Class = PacketRateLimiter::OpcodeClass;
+using Result = PacketRateLimiter::Result;
+
+TEST_CASE("Packet rate limiter", "[PacketRateLimiter]")
+{
+    PacketRateLimiter limiter;
+    REQUIRE(!limiter.IsEnabled());
+
+    limiter.Initialize(1000, { 0, 10, 0 }, 2);
+    REQUIRE(limiter.IsEnabled());
+
+    uint32 now = 50000;
+    for (uint32 i = 0; i < 10; ++i)
+        REQUIRE(limiter.Check(Class::WorldThread, now) == Result::Accept);
+
+    SECTION("packets over the limit are dropped, floods disconnect")
+    {
+        for (uint32 i = 0; i < 10; ++i)
+            REQUIRE(limiter.Check(Class::WorldThread, now + 500) == Result::Drop);
+        REQUIRE(limiter.Check(Class::WorldThread, now + 500) == Result::Disconnect);
+    }
+
+    SECTION("opcode classes are counted separately")
+    {
+        REQUIRE(limiter.Check(Class::WorldThread, now) == Result::Drop);
+        for (uint32 i = 0; i < 100; ++i)
+        {
+            REQUIRE(limiter.Check(Class::MapThread, now) == Result::Accept);
+            REQUIRE(limiter.Check(Class::Socket, now) == Result::Accept);
+        }
+    }
+
+    SECTION("the previous window is weighted by how much of it still overlaps")
+    {
+        // half of the previous 10 packets still count
+        REQUIRE(limiter.Check(Class::WorldThread, now + 1500) == Result::Accept);
+        for (uint32 i = 0; i < 4; ++i)
+            REQUIRE(limiter.Check(Class::WorldThread, now + 1500) == Result::Accept);
+        REQUIRE(limiter.Check(Class::WorldThread, now + 1500) == Result::Drop);
+    }
+
+    SECTION("idle clients start over")
+    {
+        for (uint32 i = 0; i < 10; ++i)
+            REQUIRE(limiter.Check(Class::WorldThread, now + 2000) == Result::Accept);
+    }
+}
+
+TEST_CASE("Packet rate limiter cost", "[.][benchmark][PacketRateLimiter]")
+{
+    PacketRateLimiter limiter;
+    limiter.Initialize(1000, { 100, 100, 100 }, 0);
+
+    uint32 now = 0;
+    BENCHMARK("check")
+    {
+        return limiter.Check(Class::MapThread, ++now / 64);
+    };
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "PathCorridorCache.h"
+#include <array>
+
+TEST_CASE("PathCorridorCache shares corridors ending at the same polygon", "[PathCorridorCache]")
+{
+    PathCorridorCache cache(100);
+    PathCorridorCache::Key key = { .NavMesh = nullptr, .EndPoly = 5, .IncludeFlags = 1, .ExcludeFlags = 0 };
+    std::array<dtPolyRef, 8> path = { };
+
+    std::array<dtPolyRef, 5> corridor = { 1, 2, 3, 4, 5 };
+    cache.Store(key, corridor);
+
+    SECTION("start polygons on the corridor get its rest")
+    {
+        REQUIRE(cache.Find(key, 3, {}, path) == 3);
+        REQUIRE(path[0] == 3);
+        REQUIRE(path[2] == 5);
+
+        PathCorridorCache::Stats stats = cache.TakeStats();
+        REQUIRE(stats.Hits == 1);
+        REQUIRE(stats.Misses == 0);
+    }
+
+    SECTION("start polygons next to the corridor add the step onto it")
+    {
+        std::array<dtPolyRef, 2> neighbours = { 9, 2 };
+        REQUIRE(cache.Find(key, 8, neighbours, path) == 5);
+        REQUIRE(path[0] == 8);
+        REQUIRE(path[1] == 2);
+        REQUIRE(cache.TakeStats().Joined == 1);
+    }
+
+    SECTION("other end polygons, filters and short outputs miss")
+    {
+        PathCorridorCache::Key otherEnd = key;
+        otherEnd.EndPoly = 4;
+        PathCorridorCache::Key otherFilter = key;
+        otherFilter.ExcludeFlags = 2;
+
+        REQUIRE(cache.Find(otherEnd, 1, {}, path) == 0);
+        REQUIRE(cache.Find(otherFilter, 1, {}, path) == 0);
+        REQUIRE(cache.Find(key, 1, {}, std::span(path).first(4)) == 0);
+        REQUIRE(cache.Find(key, 7, {}, path) == 0);
+        REQUIRE(cache.TakeStats().Misses == 4);
+    }
+
+    SECTION("incomplete corridors are not kept")
+    {
+        std::array<dtPolyRef, 2> partial = { 6, 7 };
+        cache.Store(key, partial);
+        REQUIRE(cache.Find(key, 6, {}, path) == 0);
+    }
+
+    SECTION("tile rebuilds drop every corridor")
+    {
+        cache.InvalidateTiles();
+        REQUIRE(cache.Find(key, 1, {}, path) == 0);
+    }
+
+    SECTION("corridors expire after two durations")
+    {
+        cache.Update(100);
+        REQUIRE(cache.Find(key, 1, {}, path) == 5);
+        cache.Update(100);
+        REQUIRE(cache.Find(key, 1, {}, path) == 0);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ServiceBase.h"
+#include "attribute_types.pb.h"
+#include <string>
+
+using bgs::protocol::AttributeFilter;
+
+namespace
+{
+// Attributes like the ones of game utilities client requests
+std::string MakeRequest(uint32 attributeCount)
+{
+    AttributeFilter filter;
+    filter.set_op(AttributeFilter::MATCH_ALL);
+    for (uint32 i = 0; i < attributeCount; ++i)
+    {
+        bgs::protocol::Attribute* attribute = filter.add_attribute();
+        attribute->set_name("Command_RealmListRequest_v1_" + std::to_string(i));
+        attribute->mutable_value()->set_string_value("0-0-0");
+    }
+
+    return filter.SerializeAsString();
+}
+}
+
+TEST_CASE("Pooled rpc messages are cleared and reused", "[RpcMessagePool]")
+{
+    RpcMessagePool pool;
+    std::string request = MakeRequest(4);
+
+    AttributeFilter const* first;
+    {
+        PooledRpcMessage<AttributeFilter> message(&pool);
+        REQUIRE(message->ParseFromString(request));
+        REQUIRE(message->attribute_size() == 4);
+        first = message.get();
+    }
+
+    SECTION("the next message of the same type is the released one, empty")
+    {
+        PooledRpcMessage<AttributeFilter> message(&pool);
+        REQUIRE(message.get() == first);
+        REQUIRE(message->attribute_size() == 0);
+        REQUIRE(message->ByteSize() == 0);
+    }
+
+    SECTION("nested messages of the same type get their own")
+    {
+        PooledRpcMessage<AttributeFilter> outer(&pool);
+        PooledRpcMessage<AttributeFilter> inner(&pool);
+        REQUIRE(outer.get() == first);
+        REQUIRE(inner.get() != first);
+    }
+
+    SECTION("messages of other types are not mixed up")
+    {
+        PooledRpcMessage<bgs::protocol::Attribute> message(&pool);
+        REQUIRE(static_cast<void const*>(message.get()) != static_cast<void const*>(first));
+        REQUIRE(!message->has_name());
+    }
+}
+
+TEST_CASE("Rpc messages without a pool", "[RpcMessagePool]")
+{
+    PooledRpcMessage<AttributeFilter> message(nullptr);
+    REQUIRE(message->ParseFromString(MakeRequest(2)));
+    REQUIRE(message->attribute(1).value().string_value() == "0-0-0");
+}
+
+TEST_CASE("Rpc message parse cost with and without a pool", "[.][benchmark][RpcMessagePool]")
+{
+    RpcMessagePool pool;
+    std::string request = MakeRequest(8);
+
+    BENCHMARK("new message")
+    {
+        PooledRpcMessage<AttributeFilter> message(nullptr);
+        message->ParseFromString(request);
+        return message->attribute_size();
+    };
+
+    BENCHMARK("pooled message")
+    {
+        PooledRpcMessage<AttributeFilter> message(&pool);
+        message->ParseFromString(request);
+        return message->attribute_size();
+    };
+}
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Opcodes.h"
+
+TEST_CASE("Server packet size hints", "[Opcodes]")
+{
+    std::unique_ptr<OpcodeTable> table = std::make_unique<OpcodeTable>();
+
+    SECTION("Unknown opcodes use the default size")
+    {
+        REQUIRE(table->GetServerPacketSizeHint(SMSG_ATTACK_STOP, 200) == 200);
+    }
+
+    SECTION("Hint follows the 95th percentile")
+    {
+        for (int i = 0; i < 62; ++i)
+            table->RecordServerPacketSize(SMSG_UPDATE_OBJECT, 300);
+        for (int i = 0; i < 2; ++i)
+            table->RecordServerPacketSize(SMSG_UPDATE_OBJECT, 150000);
+
+        REQUIRE(table->GetServerPacketSizeHint(SMSG_UPDATE_OBJECT, 200) == 512);
+        REQUIRE(table->GetServerPacketSizeHint(SMSG_ATTACK_STOP, 200) == 200);
+
+        for (int i = 0; i < 64; ++i)
+            table->RecordServerPacketSize(SMSG_UPDATE_OBJECT, 150000);
+
+        REQUIRE(table->GetServerPacketSizeHint(SMSG_UPDATE_OBJECT, 200) == 0x40000);
+    }
+}
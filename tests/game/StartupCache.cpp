@@ -0,0 +1,105 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "StartupCache.h"
+#include <cstdio>
+#include <filesystem>
+
+TEST_CASE("StartupCacheReader reads back written values", "[StartupCache]")
+{
+    StartupCacheWriter writer;
+    writer.Write(uint32(42));
+    writer.Write(std::string_view("text"));
+    writer.Write(std::vector<std::string>{ "", "enUS", "deDE" });
+
+    StartupCacheReader reader(writer.GetData());
+    uint32 number = 0;
+    std::string text;
+    std::vector<std::string> texts;
+    REQUIRE(reader.Read(number));
+    REQUIRE(reader.Read(text));
+    REQUIRE(reader.Read(texts));
+    REQUIRE(reader.IsComplete());
+    REQUIRE(number == 42);
+    REQUIRE(text == "text");
+    REQUIRE(texts == std::vector<std::string>{ "", "enUS", "deDE" });
+
+    SECTION("Reading past the end fails")
+    {
+        REQUIRE_FALSE(reader.Read(number));
+        REQUIRE_FALSE(reader.IsComplete());
+    }
+
+    SECTION("Truncated data fails")
+    {
+        StartupCacheReader truncated(std::span(writer.GetData()).first(writer.GetData().size() - 1));
+        REQUIRE(truncated.Read(number));
+        REQUIRE(truncated.Read(text));
+        REQUIRE_FALSE(truncated.Read(texts));
+        REQUIRE_FALSE(truncated.IsComplete());
+    }
+}
+
+TEST_CASE("StartupCache keeps sections only for the same key", "[StartupCache]")
+{
+    std::string path = (std::filesystem::temp_directory_path() / "tc_startup_cache_test.bin").string();
+
+    {
+        StartupCache cache(path, "key");
+        REQUIRE_FALSE(cache.Open());
+        cache.AddSection("first").Write(uint32(1));
+        cache.AddSection("second").Write(uint64(2));
+        REQUIRE(cache.HasNewSections());
+        REQUIRE(cache.Save());
+    }
+
+    SECTION("Same key")
+    {
+        StartupCache cache(path, "key");
+        REQUIRE(cache.Open());
+
+        Optional<StartupCacheReader> first = cache.GetSection("first");
+        REQUIRE(first.has_value());
+        uint32 value = 0;
+        REQUIRE(first->Read(value));
+        REQUIRE(value == 1);
+        REQUIRE(first->IsComplete());
+
+        REQUIRE(cache.GetSection("second").has_value());
+        REQUIRE_FALSE(cache.GetSection("third").has_value());
+
+        // sections not added again are carried over to the new file
+        cache.AddSection("third").Write(uint8(3));
+        REQUIRE(cache.Save());
+
+        StartupCache reopened(path, "key");
+        REQUIRE(reopened.Open());
+        REQUIRE(reopened.GetSection("second").has_value());
+        REQUIRE(reopened.GetSection("third").has_value());
+    }
+
+    SECTION("Different key")
+    {
+        StartupCache cache(path, "other key");
+        REQUIRE_FALSE(cache.Open());
+        REQUIRE_FALSE(cache.GetSection("first").has_value());
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,170 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Random.h"
+#include <boost/heap/fibonacci_heap.hpp>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// Same heap layout as ThreatManager::Heap, the entries stand in for the threat references of one creature
+namespace
+{
+struct Entry;
+
+struct CompareEntries
+{
+    bool operator()(Entry const* a, Entry const* b) const;
+};
+
+using EntryHeap = boost::heap::fibonacci_heap<Entry const*, boost::heap::compare<CompareEntries>>;
+
+struct Entry
+{
+    float Threat = 0.0f;
+    EntryHeap::handle_type Handle;
+    bool Pending = false;
+};
+
+bool CompareEntries::operator()(Entry const* a, Entry const* b) const { return a->Threat < b->Threat; }
+
+struct ThreatList
+{
+    explicit ThreatList(std::size_t size) : Entries(size)
+    {
+        for (Entry& entry : Entries)
+        {
+            entry.Threat = frand(0.0f, 100000.0f);
+            entry.Handle = Heap.push(&entry);
+        }
+    }
+
+    // what ThreatManager does outside of UpdateBatch, every change fixes up the heap
+    void ScaleEach(float factor)
+    {
+        for (Entry& entry : Entries)
+        {
+            entry.Threat *= factor;
+            if (factor > 1.0f)
+                Heap.increase(entry.Handle);
+            else
+                Heap.decrease(entry.Handle);
+        }
+    }
+
+    void ScaleBatched(float factor)
+    {
+        for (Entry& entry : Entries)
+        {
+            entry.Threat *= factor;
+            entry.Pending = true;
+        }
+        Flush();
+    }
+
+    // what ThreatManager::FlushHeapUpdates does at the end of an UpdateBatch
+    void Flush()
+    {
+        Entry* last = nullptr;
+        for (Entry& entry : Entries)
+        {
+            if (!std::exchange(entry.Pending, false))
+                continue;
+            if (last)
+                Heap.update_lazy(last->Handle);
+            last = &entry;
+        }
+        if (last)
+            Heap.update(last->Handle);
+    }
+
+    std::vector<float> Sorted() const
+    {
+        std::vector<float> sorted;
+        for (auto itr = Heap.ordered_begin(); itr != Heap.ordered_end(); ++itr)
+            sorted.push_back((*itr)->Threat);
+        return sorted;
+    }
+
+    std::vector<Entry> Entries;
+    EntryHeap Heap;
+};
+}
+
+TEST_CASE("Batched heap updates keep the threat list sorted", "[ThreatManager]")
+{
+    ThreatList list(40);
+
+    SECTION("partial changes")
+    {
+        for (std::size_t i = 0; i < list.Entries.size(); i += 3)
+        {
+            list.Entries[i].Threat = frand(0.0f, 200000.0f);
+            list.Entries[i].Pending = true;
+        }
+        list.Flush();
+    }
+
+    SECTION("decrease all")
+    {
+        list.ScaleBatched(0.5f);
+    }
+
+    SECTION("reset all")
+    {
+        list.ScaleBatched(0.0f);
+    }
+
+    std::vector<float> expected;
+    for (Entry const& entry : list.Entries)
+        expected.push_back(entry.Threat);
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+
+    REQUIRE(list.Sorted() == expected);
+    REQUIRE(list.Heap.top()->Threat == expected.front());
+}
+
+// 25 player raid against a boss and its adds, every creature scales the threat of the whole raid (threat wipes, fades)
+TEST_CASE("Threat list updates of a raid encounter", "[.][benchmark][ThreatManager]")
+{
+    std::vector<ThreatList> creatures;
+    creatures.reserve(40);
+    for (int i = 0; i < 40; ++i)
+        creatures.emplace_back(25);
+
+    BENCHMARK("fix up heap per change")
+    {
+        for (ThreatList& creature : creatures)
+        {
+            creature.ScaleEach(0.9f);
+            creature.ScaleEach(1.0f / 0.9f);
+        }
+        return creatures.front().Heap.top();
+    };
+
+    BENCHMARK("fix up heap per batch")
+    {
+        for (ThreatList& creature : creatures)
+        {
+            creature.ScaleBatched(0.9f);
+            creature.ScaleBatched(1.0f / 0.9f);
+        }
+        return creatures.front().Heap.top();
+    };
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "UpdateMask.h"
+#include <vector>
+
+namespace
+{
+template<uint32 Bits>
+std::vector<uint32> GetSetBits(UpdateMask<Bits> const& mask, uint32 first, uint32 count)
+{
+    std::vector<uint32> bits;
+    for (uint32 bit : mask.GetSetBits(first, count))
+        bits.push_back(bit);
+    return bits;
+}
+}
+
+TEST_CASE("Set bits of an update mask range", "[UpdateMask]")
+{
+    UpdateMask<300> mask;
+
+    SECTION("empty ranges have no bits")
+    {
+        REQUIRE(GetSetBits(mask, 0, 300).empty());
+        REQUIRE(GetSetBits(mask, 52, 0).empty());
+    }
+
+    SECTION("bits are relative to the range start, in order")
+    {
+        for (uint32 bit : { 51, 52, 60, 83, 84, 200, 226, 227 })
+            mask.Set(bit);
+
+        REQUIRE(GetSetBits(mask, 52, 175) == std::vector<uint32>{ 0, 8, 31, 32, 148, 174 });
+        REQUIRE(GetSetBits(mask, 0, 300) == std::vector<uint32>{ 51, 52, 60, 83, 84, 200, 226, 227 });
+        REQUIRE(GetSetBits(mask, 85, 100).empty());
+    }
+
+    SECTION("the last block of the mask is scanned")
+    {
+        mask.Set(299);
+        REQUIRE(GetSetBits(mask, 290, 10) == std::vector<uint32>{ 9 });
+    }
+
+    SECTION("all indexes are returned when the mask is ignored")
+    {
+        uint32 blocks[] = { 0x5u };
+        std::vector<uint32> bits;
+        for (uint32 bit : UpdateMaskHelpers::SetBitRange(blocks, 0, 4, true))
+            bits.push_back(bit);
+
+        REQUIRE(bits == std::vector<uint32>{ 0, 1, 2, 3 });
+    }
+}
+
+TEST_CASE("Update mask iteration", "[.][benchmark][UpdateMask]")
+{
+    // a few changed fields of a large object, as for most value updates
+    UpdateMask<1024> mask;
+    for (uint32 bit : { 3, 40, 41, 300, 301, 302, 777, 1000 })
+        mask.Set(bit);
+
+    BENCHMARK("test every bit")
+    {
+        uint32 sum = 0;
+        for (uint32 bit = 0; bit < 1024; ++bit)
+            if (mask[bit])
+                sum += bit;
+        return sum;
+    };
+
+    BENCHMARK("GetSetBits")
+    {
+        uint32 sum = 0;
+        for (uint32 bit : mask.GetSetBits(0, 1024))
+            sum += bit;
+        return sum;
+    };
+}